@@ -9,7 +9,7 @@
 #include "sub_menu.h" 
 
 static const SubMenuItem GPIOMenuItems[] = {
-    { "MONITOR UART", UART, uart_monitor_start },      // Abre o notepad e escreve uma msg
+    { "MONITOR UART", &UART, uart_monitor_start },      // Abre o notepad e escreve uma msg
 
     // Adicione mais payloads aqui...
 };
@@ -1,12 +1,14 @@
 #include "UART.h"
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "driver/uart.h"
-#include "driver/gpio.h"
 #include "esp_log.h"
 #include "st7789.h"
-#include "pin_def.h"
+#include "st7789_text.h"
+#include "input.h"
 
 // --- Definições e Variáveis Estáticas ---
 
@@ -27,10 +29,31 @@ static int baud_rate_index = 4;
 #define HISTORY_BUFFER_LINES 100
 #define MAX_COLS  40
 
+// Layout: cabeçalho fixo e área de texto que rola por hardware
+#define HEADER_HEIGHT       30
+#define LINE_HEIGHT         14
+#define TEXT_X              5
+#define TEXT_Y_PAD          5
+#define SCROLLBAR_WIDTH     6
+#define SCROLLBAR_Y_START   HEADER_HEIGHT
+#define SCROLLBAR_HEIGHT    208
+#define TEXT_AREA_WIDTH     (ST7789_WIDTH - SCROLLBAR_WIDTH)
+
 static char history_buffer[HISTORY_BUFFER_LINES][MAX_COLS];
 static int head_index = 0;
 static int total_lines_in_buffer = 0;
 static int view_offset = 0;
+static uint32_t line_seq = 0;          // Quebras de linha desde a limpeza (índice absoluto da linha atual)
+
+// Estado do que já está na tela (só a task leitora desenha)
+#define NOT_DRAWN UINT32_MAX
+static uint32_t drawn_top = NOT_DRAWN; // Linha absoluta no topo da área de texto
+static uint32_t drawn_seq = 0;         // line_seq no último desenho
+static bool hw_scroll = false;
+static bool sb_visible = false;
+static int sb_thumb_y = 0, sb_thumb_h = 0;
+static volatile bool needs_redraw = false;
+static volatile bool header_dirty = false;
 
 // Controle do loop
 static bool is_running = false;
@@ -44,14 +67,18 @@ static void clear_history_buffer() {
         memset(history_buffer[i], 0, MAX_COLS);
     }
     head_index = 0;
-    total_lines_in_buffer = 0;
+    total_lines_in_buffer = 1;   // A linha atual, ainda vazia
     view_offset = 0;
+    line_seq = 0;
+    drawn_top = NOT_DRAWN;
+    drawn_seq = 0;
 }
 
 static void history_buffer_add_char(char c) {
     if (c == '\n' || c == '\r') {
         if(c == '\r' && history_buffer[head_index][0] != 0) return;
         head_index = (head_index + 1) % HISTORY_BUFFER_LINES;
+        line_seq++;
         memset(history_buffer[head_index], 0, MAX_COLS);
         if (total_lines_in_buffer < HISTORY_BUFFER_LINES) {
             total_lines_in_buffer++;
@@ -73,18 +100,47 @@ static void history_buffer_add_char(char c) {
     }
 }
 
-// --- NOVO: Função da Barra de Rolagem (baseada na sua referência) ---
-static void draw_uart_scrollbar() {
-    // Só desenha se o conteúdo for maior que a tela
-    if (total_lines_in_buffer <= VISIBLE_LINES) return;
+// Linha absoluta mostrada no topo da área de texto
+static uint32_t top_line(void) {
+    return line_seq - (total_lines_in_buffer - 1) + view_offset;
+}
+
+static void draw_header(void) {
+    st7789_fill_rect_fb(0, 0, ST7789_WIDTH, HEADER_HEIGHT, ST7789_COLOR_BLACK);
+    st7789_set_text_size(2);
+
+    char status_str[32];
+    sprintf(status_str, "Baud: %d", BAUD_RATES[baud_rate_index]);
+    st7789_draw_text_fb(5, 5, status_str, ST7789_COLOR_PURPLE, ST7789_COLOR_BLACK);
+    st7789_draw_hline_fb(0, 25, ST7789_WIDTH, ST7789_COLOR_WHITE);
+    st7789_set_text_size(1);
+}
 
-    // Constantes para a barra de rolagem
-    const int SCROLLBAR_WIDTH = 6;
-    const int SCROLLBAR_Y_START = 30;
-    const int SCROLLBAR_HEIGHT = 208; // Altura da área de texto
+// Redesenha a faixa da linha de tela `row`, incluindo o trilho da barra
+static void draw_row(int row, uint32_t line) {
+    int y = HEADER_HEIGHT + row * LINE_HEIGHT;
 
-    // Desenha o fundo da barra (trilha)
-    st7789_draw_vline_fb(ST7789_WIDTH - SCROLLBAR_WIDTH / 2, SCROLLBAR_Y_START, SCROLLBAR_HEIGHT, ST7789_COLOR_PURPLE);
+    st7789_fill_rect_fb(0, y, ST7789_WIDTH, LINE_HEIGHT, ST7789_COLOR_BLACK);
+    if (line <= line_seq) {
+        st7789_set_text_clip(0, y, TEXT_AREA_WIDTH, LINE_HEIGHT);
+        st7789_draw_text_fb(TEXT_X, y + TEXT_Y_PAD, history_buffer[line % HISTORY_BUFFER_LINES],
+                            ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
+        st7789_reset_text_clip();
+    }
+
+    int track_end = SCROLLBAR_Y_START + SCROLLBAR_HEIGHT;
+    if (sb_visible && y < track_end) {
+        int h = (y + LINE_HEIGHT > track_end) ? track_end - y : LINE_HEIGHT;
+        st7789_draw_vline_fb(ST7789_WIDTH - SCROLLBAR_WIDTH / 2, y, h, ST7789_COLOR_PURPLE);
+    }
+}
+
+// Barra de rolagem. O trilho rola junto com o texto; só o trecho em que o
+// indicador estava (já deslocado `scrolled` pixels) e onde ele fica agora é
+// repintado.
+static void draw_uart_scrollbar(int scrolled) {
+    // Só desenha se o conteúdo for maior que a tela
+    if (total_lines_in_buffer <= VISIBLE_LINES) return;
 
     // Calcula a altura do indicador (thumb)
     float thumb_height = ((float)VISIBLE_LINES / total_lines_in_buffer) * SCROLLBAR_HEIGHT;
@@ -93,39 +149,71 @@ static void draw_uart_scrollbar() {
     // Calcula a posição Y do indicador
     float max_scroll_range = total_lines_in_buffer - VISIBLE_LINES;
     float scroll_percentage = (float)view_offset / max_scroll_range;
-    float thumb_y = SCROLLBAR_Y_START + (scroll_percentage * (SCROLLBAR_HEIGHT - thumb_height));
-    
-    // Desenha o indicador
-    st7789_fill_rect_fb(ST7789_WIDTH - SCROLLBAR_WIDTH, (int)thumb_y, SCROLLBAR_WIDTH, (int)thumb_height, ST7789_COLOR_PURPLE);
+    int thumb_y = SCROLLBAR_Y_START + (int)(scroll_percentage * (SCROLLBAR_HEIGHT - thumb_height));
+    int thumb_h = (int)thumb_height;
+
+    int from = SCROLLBAR_Y_START;
+    int to = SCROLLBAR_Y_START + SCROLLBAR_HEIGHT;
+    if (sb_visible) {
+        int old_y = sb_thumb_y - scrolled;
+        if (old_y == thumb_y && sb_thumb_h == thumb_h) return;
+        from = old_y < thumb_y ? old_y : thumb_y;
+        to = (old_y + sb_thumb_h > thumb_y + thumb_h) ? old_y + sb_thumb_h : thumb_y + thumb_h;
+        if (from < SCROLLBAR_Y_START) from = SCROLLBAR_Y_START;
+        if (to > SCROLLBAR_Y_START + SCROLLBAR_HEIGHT) to = SCROLLBAR_Y_START + SCROLLBAR_HEIGHT;
+    }
+
+    st7789_fill_rect_fb(TEXT_AREA_WIDTH, from, SCROLLBAR_WIDTH, to - from, ST7789_COLOR_BLACK);
+    st7789_draw_vline_fb(ST7789_WIDTH - SCROLLBAR_WIDTH / 2, from, to - from, ST7789_COLOR_PURPLE);
+    st7789_fill_rect_fb(TEXT_AREA_WIDTH, thumb_y, SCROLLBAR_WIDTH, thumb_h, ST7789_COLOR_PURPLE);
+
+    sb_visible = true;
+    sb_thumb_y = thumb_y;
+    sb_thumb_h = thumb_h;
 }
 
+// Atualiza só o que mudou desde o último desenho. Linhas novas no fim entram
+// rolando a região por hardware: o barramento leva apenas as faixas expostas.
+static void update_screen(void) {
+    if (header_dirty) {
+        header_dirty = false;
+        draw_header();
+    }
 
-static void redraw_screen() {
-    st7789_fill_screen_fb(ST7789_COLOR_BLACK);
-    st7789_set_text_size(2);
-    
-    char status_str[32];
-    sprintf(status_str, "Baud: %d", BAUD_RATES[baud_rate_index]);
-    st7789_draw_text_fb(5, 5, status_str, ST7789_COLOR_PURPLE, ST7789_COLOR_BLACK);
-    st7789_draw_hline_fb(0, 25, ST7789_WIDTH, ST7789_COLOR_WHITE);
-    st7789_set_text_size(1);
+    uint32_t top = top_line();
+    int32_t delta = (int32_t)(top - drawn_top);
+    int scrolled = 0;
 
-    for (int i = 0; i < VISIBLE_LINES; i++) {
-        if (view_offset + i < total_lines_in_buffer) {
-            int line_to_draw_index = (head_index - (total_lines_in_buffer - 1) + view_offset + i + HISTORY_BUFFER_LINES) % HISTORY_BUFFER_LINES;
-            st7789_draw_text_fb(5, 35 + (i * 14), history_buffer[line_to_draw_index], ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
+    if (drawn_top == NOT_DRAWN || delta <= -VISIBLE_LINES || delta >= VISIBLE_LINES ||
+        (delta != 0 && !hw_scroll)) {
+        sb_visible = false;
+        for (int i = 0; i < VISIBLE_LINES; i++) {
+            draw_row(i, top + i);
+        }
+    } else {
+        if (delta != 0) {
+            scrolled = delta * LINE_HEIGHT;
+            st7789_scroll_region_scroll(scrolled, ST7789_COLOR_BLACK);
+        }
+        for (int i = 0; i < VISIBLE_LINES; i++) {
+            uint32_t line = top + i;
+            bool exposed = (delta > 0) ? (i >= VISIBLE_LINES - delta) : (i < -delta);
+            // Linhas que podem ter recebido caracteres desde o último desenho
+            bool changed = line >= drawn_seq && line <= line_seq;
+            if (exposed || changed) {
+                draw_row(i, line);
+            }
         }
     }
-    
-    // Chama a nova função para desenhar a barra de rolagem
-    draw_uart_scrollbar();
 
+    draw_uart_scrollbar(scrolled);
+    drawn_top = top;
+    drawn_seq = line_seq;
     st7789_flush();
 }
 
 static void uart_reader_task(void *pvParameters) {
     uint8_t *data = (uint8_t *) malloc(UART_BUFFER_SIZE);
-    bool needs_redraw = false;
 
     while (is_running) {
         int len = uart_read_bytes(UART_PORT_NUM, data, UART_BUFFER_SIZE, 20 / portTICK_PERIOD_MS);
@@ -136,9 +224,9 @@ static void uart_reader_task(void *pvParameters) {
             needs_redraw = true;
         }
 
-        if (needs_redraw) {
-            redraw_screen();
+        if (needs_redraw || header_dirty) {
             needs_redraw = false;
+            update_screen();
         }
     }
     free(data);
@@ -171,73 +259,78 @@ void uart_monitor_deinit(void) {
 // Em seu arquivo UART.c
 
 void uart_monitor_start(void) {
-    // --- NOVO: Bloco de configuração dos botões com PULL-UP ---
-    // Isso resolve o problema de "toques fantasma"
-    gpio_config_t io_conf = {
-        .pin_bit_mask = (1ULL << BTN_UP) | (1ULL << BTN_DOWN) |
-                        (1ULL << BTN_LEFT) | (1ULL << BTN_RIGHT) |
-                        (1ULL << BTN_OK) | (1ULL << BTN_BACK),
-        .mode = GPIO_MODE_INPUT,
-        .pull_up_en = GPIO_PULLUP_ENABLE, // Habilita o pull-up interno
-        .pull_down_en = GPIO_PULLDOWN_DISABLE,
-        .intr_type = GPIO_INTR_DISABLE
-    };
-    gpio_config(&io_conf);
-    // --- FIM DO NOVO BLOCO ---
-
     uart_monitor_init();
     is_running = true;
-    
+
+    // Tela inteira uma vez; depois só as faixas alteradas
+    st7789_flush_mode_t prev_mode = st7789_get_flush_mode();
+    st7789_set_flush_mode(ST7789_FLUSH_DAMAGE);
+    st7789_fill_screen_fb(ST7789_COLOR_BLACK);
+    hw_scroll = st7789_scroll_region_set(HEADER_HEIGHT, VISIBLE_LINES * LINE_HEIGHT) == ESP_OK;
+
     clear_history_buffer();
-    redraw_screen();
+    header_dirty = true;
+    update_screen();
 
     xTaskCreate(uart_reader_task, "uart_reader_task", 4096, NULL, 10, &uart_reader_task_handle);
 
+    input_flush();
     while (is_running) {
-        if (gpio_get_level(BTN_UP) == 0) {
-            vTaskDelay(pdMS_TO_TICKS(100));
-            if (view_offset > 0) {
-                view_offset--;
-                redraw_screen();
-            }
-        }
-        if (gpio_get_level(BTN_DOWN) == 0) {
-            vTaskDelay(pdMS_TO_TICKS(100));
-            if (view_offset < (total_lines_in_buffer - VISIBLE_LINES)) {
-                view_offset++;
-                redraw_screen();
-            }
-        }
-        if (gpio_get_level(BTN_LEFT) == 0) {
-            vTaskDelay(pdMS_TO_TICKS(150));
-            if (baud_rate_index == 0) baud_rate_index = (sizeof(BAUD_RATES)/sizeof(BAUD_RATES[0])) - 1;
-            else baud_rate_index--;
-            uart_set_baudrate(UART_PORT_NUM, BAUD_RATES[baud_rate_index]);
-            redraw_screen();
-        }
-        if (gpio_get_level(BTN_RIGHT) == 0) {
-            vTaskDelay(pdMS_TO_TICKS(150));
-            baud_rate_index = (baud_rate_index + 1) % (sizeof(BAUD_RATES) / sizeof(BAUD_RATES[0]));
-            uart_set_baudrate(UART_PORT_NUM, BAUD_RATES[baud_rate_index]);
-            redraw_screen();
-        }
-        if (gpio_get_level(BTN_OK) == 0) {
-            vTaskDelay(pdMS_TO_TICKS(150));
-            const char* cmd = "help\r\n";
-            uart_write_bytes(UART_PORT_NUM, cmd, strlen(cmd));
-        }
-        if (gpio_get_level(BTN_BACK) == 0) {
-            vTaskDelay(pdMS_TO_TICKS(150));
-            is_running = false;
+        input_event_t ev;
+        if (!input_wait_event(&ev, INPUT_WAIT_FOREVER)) continue;
+        bool press = ev.type == INPUT_EVENT_PRESS;
+        bool step = press || ev.type == INPUT_EVENT_REPEAT;
+        const int num_rates = sizeof(BAUD_RATES) / sizeof(BAUD_RATES[0]);
+
+        switch (ev.button) {
+            case INPUT_BTN_UP:
+                if (step && view_offset > 0) {
+                    view_offset--;
+                    needs_redraw = true;
+                }
+                break;
+            case INPUT_BTN_DOWN:
+                if (step && view_offset < (total_lines_in_buffer - VISIBLE_LINES)) {
+                    view_offset++;
+                    needs_redraw = true;
+                }
+                break;
+            case INPUT_BTN_LEFT:
+                if (press) {
+                    baud_rate_index = (baud_rate_index == 0) ? num_rates - 1 : baud_rate_index - 1;
+                    uart_set_baudrate(UART_PORT_NUM, BAUD_RATES[baud_rate_index]);
+                    header_dirty = true;
+                }
+                break;
+            case INPUT_BTN_RIGHT:
+                if (press) {
+                    baud_rate_index = (baud_rate_index + 1) % num_rates;
+                    uart_set_baudrate(UART_PORT_NUM, BAUD_RATES[baud_rate_index]);
+                    header_dirty = true;
+                }
+                break;
+            case INPUT_BTN_OK:
+                if (press) {
+                    const char* cmd = "help\r\n";
+                    uart_write_bytes(UART_PORT_NUM, cmd, strlen(cmd));
+                }
+                break;
+            case INPUT_BTN_BACK:
+                if (press) is_running = false;
+                break;
+            default:
+                break;
         }
-        
-        vTaskDelay(pdMS_TO_TICKS(50));
     }
 
-    if (uart_reader_task_handle != NULL) {
-        vTaskDelete(uart_reader_task_handle);
-        uart_reader_task_handle = NULL;
+    // A task leitora termina sozinha no próximo timeout de leitura; só depois
+    // dela a região de rolagem pode ser desfeita
+    while (uart_reader_task_handle != NULL) {
+        vTaskDelay(pdMS_TO_TICKS(10));
     }
+    st7789_scroll_region_reset();
+    st7789_set_flush_mode(prev_mode);
+
     uart_monitor_deinit();
     ESP_LOGI(TAG, "Saindo do Monitor UART.");
-}
\ No newline at end of file
+}
@@ -33,10 +33,10 @@ static void payload_action_linux_rickroll(void);
 // --- Lista de Itens do Menu de Payloads ---
 // Cada item define o texto que aparece na tela e a função que será chamada.
 static const SubMenuItem payloadMenuItems[] = {
-    { "Hello World",   bad, payload_action_hello },      // Abre o notepad e escreve uma msg
-    { "Abrir PowerShell", bad, payload_action_powershell }, // Abre o terminal PowerShell no Windows
-    { "Rick Roll",     bad, payload_action_rickroll },   // Abre o navegador no vídeo clássico
-    { "Linux Rick Roll",     bad,  payload_action_linux_rickroll },
+    { "Hello World",   &bad, payload_action_hello },      // Abre o notepad e escreve uma msg
+    { "Abrir PowerShell", &bad, payload_action_powershell }, // Abre o terminal PowerShell no Windows
+    { "Rick Roll",     &bad, payload_action_rickroll },   // Abre o navegador no vídeo clássico
+    { "Linux Rick Roll",     &bad,  payload_action_linux_rickroll },
     // Adicione mais payloads aqui...
 };
 static const int payloadMenuSize = sizeof(payloadMenuItems) / sizeof(SubMenuItem);
@@ -51,7 +51,7 @@ static void bad_usb_action_payloads(void) {
 // --- Menu Principal do Módulo BadUSB ---
 // Este é o primeiro menu que o usuário vê ao entrar na função BadUSB.
 static const SubMenuItem badUsbMenuItems[] = {
-    { "Payloads", evil, bad_usb_action_payloads },
+    { "Payloads", &evil, bad_usb_action_payloads },
 };
 static const int badUsbMenuSize = sizeof(badUsbMenuItems) / sizeof(SubMenuItem);
 
@@ -1,5 +1,6 @@
 #include "battery_ui.h"
 #include "st7789.h"
+#include "ui.h"
 #include "bq25896.h" // Inclui o driver BQ25896 atualizado
 #include "pin_def.h" // Assumindo que BTN_BACK está definido aqui
 #include "freertos/FreeRTOS.h"
@@ -13,76 +14,60 @@
 #define BATTERY_COLOR_LOW  ST7789_COLOR_RED
 
 
-static void draw_battery_ui(int percentage, uint16_t voltage_mv, bq25896_charge_status_t status) {
-    char buffer[50];
-
-    st7789_fill_screen_fb(ST7789_COLOR_BLACK);
-
-    st7789_draw_text_fb(45, 10, "Status da Bateria", ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
+// Elementos fixos: divisória do título e o polo da bateria
+static void draw_battery_decor(ui_widget_t *w) {
     st7789_draw_hline_fb(10, 30, 220, ST7789_COLOR_DARKGRAY);
+    st7789_fill_rect_fb(220, 80, 10, 40, ST7789_COLOR_WHITE);
+}
 
-    int bat_x = 20;
-    int bat_y = 60;
-    int bat_w = 200;
-    int bat_h = 80;
-    st7789_draw_round_rect_fb(bat_x, bat_y, bat_w, bat_h, 10, ST7789_COLOR_WHITE);
-
-    st7789_fill_rect_fb(bat_x + bat_w, bat_y + 20, 10, bat_h - 40, ST7789_COLOR_WHITE);
-
-
-    if (percentage > 0) {
-        int bar_margin = 8;
-        int bar_w = ((bat_w - (bar_margin * 2)) * percentage) / 100;
-        int bar_h = bat_h - (bar_margin * 2);
-        int bar_x = bat_x + bar_margin;
-        int bar_y = bat_y + bar_margin;
-
-        uint16_t bar_color;
-        // Usa bq25896_is_charging() que acabamos de criar
-        if (bq25896_is_charging()) {
-            bar_color = ST7789_COLOR_CYAN; // Cor azul enquanto carrega
-        } else {
-            if (percentage > 50) bar_color = BATTERY_COLOR_HIGH;
-            else if (percentage > 20) bar_color = BATTERY_COLOR_MID;
-            else bar_color = BATTERY_COLOR_LOW;
-        }
-        
-        st7789_fill_round_rect_fb(bar_x, bar_y, bar_w, bar_h, 5, bar_color);
-    }
-    
-
-    sprintf(buffer, "Tensao: %.2f V", voltage_mv / 1000.0f);
-    st7789_draw_text_fb(20, 160, buffer, ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
-
-    const char* status_text;
+static const char *charge_status_text(bq25896_charge_status_t status) {
     switch(status) {
         case CHARGE_STATUS_NOT_CHARGING:
-            status_text = "Status: Nao esta a carregar";
-            break;
+            return "Status: Nao esta a carregar";
         case CHARGE_STATUS_PRECHARGE:
-            status_text = "Status: Pre-Carga";
-            break;
+            return "Status: Pre-Carga";
         case CHARGE_STATUS_FAST_CHARGE:
-            status_text = "Status: Carregando";
-            break;
+            return "Status: Carregando";
         case CHARGE_STATUS_CHARGE_DONE:
-            status_text = "Status: Carga Completa";
-            break;
+            return "Status: Carga Completa";
         default:
-            status_text = "Status: Desconhecido";
-            break;
+            return "Status: Desconhecido";
     }
+}
 
-
-    st7789_draw_text_fb(20, 180, status_text, ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
-    
-    st7789_draw_text_fb(40, 220, "Pressione VOLTAR", ST7789_COLOR_YELLOW, ST7789_COLOR_BLACK);
-
-    st7789_flush();
+static uint16_t battery_bar_color(int percentage) {
+    // Usa bq25896_is_charging() que acabamos de criar
+    if (bq25896_is_charging()) {
+        return ST7789_COLOR_CYAN; // Cor azul enquanto carrega
+    }
+    if (percentage > 50) return BATTERY_COLOR_HIGH;
+    if (percentage > 20) return BATTERY_COLOR_MID;
+    return BATTERY_COLOR_LOW;
 }
 
 
 void show_battery_screen(void) {
+    ui_screen_t screen;
+    ui_widget_t decor;
+    ui_label_t title, voltage_label, status_label, hint;
+    ui_progress_t bar;
+
+    ui_screen_init(&screen, ST7789_COLOR_BLACK);
+    ui_label_init(&title, 45, 10, 190, 7, "Status da Bateria", ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
+    ui_widget_init(&decor, 10, 30, 220, 90, draw_battery_decor, ST7789_COLOR_BLACK);
+    ui_progress_init(&bar, 20, 60, 200, 80, BATTERY_COLOR_HIGH, ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
+    ui_progress_set_style(&bar, 10, 8);
+    ui_label_init(&voltage_label, 20, 160, 200, 7, NULL, ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
+    ui_label_init(&status_label, 20, 180, 200, 7, NULL, ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
+    ui_label_init(&hint, 40, 220, 190, 7, "Pressione VOLTAR", ST7789_COLOR_YELLOW, ST7789_COLOR_BLACK);
+
+    ui_screen_add(&screen, &decor);
+    ui_screen_add(&screen, &title.base);
+    ui_screen_add(&screen, &bar.base);
+    ui_screen_add(&screen, &voltage_label.base);
+    ui_screen_add(&screen, &status_label.base);
+    ui_screen_add(&screen, &hint.base);
+    ui_screen_show(&screen);
 
     while (1) {
          // Chamadas para as funções do driver BQ25896
@@ -90,7 +75,13 @@ void show_battery_screen(void) {
         int percentage = bq25896_get_battery_percentage(voltage);
         bq25896_charge_status_t status = bq25896_get_charge_status();
 
-        draw_battery_ui(percentage, voltage, status);
+        // Só os widgets cujo valor mudou são redesenhados e enviados
+        ui_lock();
+        ui_progress_set_value(&bar, percentage);
+        ui_progress_set_color(&bar, battery_bar_color(percentage));
+        ui_label_set_textf(&voltage_label, "Tensao: %.2f V", voltage / 1000.0f);
+        ui_label_set_text(&status_label, charge_status_text(status));
+        ui_unlock();
 
         // Certifique-se de que BTN_BACK está configurado como um pino de entrada com pull-up/down apropriado.
         // Adicione um pequeno debounce para o botão
@@ -104,4 +95,6 @@ void show_battery_screen(void) {
         // Aguardar antes de atualizar a tela novamente
         vTaskDelay(pdMS_TO_TICKS(500)); // Atualiza a cada 500ms
     }
-}
\ No newline at end of file
+
+    ui_screen_hide();
+}
@@ -106,9 +106,9 @@ static void bluetooth_action_spam(void);
 
 // Itens do Menu Bluetooth
 static const SubMenuItem bluetoothMenuItems[] = {
-    { "Scanner BLE", scan, bluetooth_action_scan },
-    { "Advertise", blu_main, bluetooth_action_advertise },
-    { "Spam BLE", blu_main, bluetooth_action_spam },
+    { "Scanner BLE", &scan, bluetooth_action_scan },
+    { "Advertise", &blu_main, bluetooth_action_advertise },
+    { "Spam BLE", &blu_main, bluetooth_action_spam },
 };
 static const int bluetoothMenuSize = sizeof(bluetoothMenuItems) / sizeof(SubMenuItem);
 
@@ -145,7 +145,7 @@ static void bluetooth_action_scan(void) {
         strncpy(device_labels[i], scanned_devices[i].name, sizeof(device_labels[i]) - 1);
         device_labels[i][sizeof(device_labels[i]) - 1] = '\0';
         device_menu[i].label = device_labels[i];
-        device_menu[i].icon = blu_main;
+        device_menu[i].icon = &blu_main;
         device_menu[i].action = NULL;
     }
 
@@ -292,7 +292,7 @@ static void bluetooth_action_spam(void) {
             strncpy(attack_labels[i], attack_type->name, sizeof(attack_labels[i]) - 1);
             attack_labels[i][sizeof(attack_labels[i]) - 1] = '\0';
             attack_menu[i].label = attack_labels[i];
-            attack_menu[i].icon = blu_main;
+            attack_menu[i].icon = &blu_main;
             attack_menu[i].action = NULL;
         }
     }
@@ -14,6 +14,7 @@
 
 #include "rssi_analyser.h"
 #include "st7789.h"
+#include "ui.h"
 #include "pin_def.h"
 #include "driver/gpio.h"
 #include "bluetooth_scanner.h"
@@ -45,37 +46,8 @@ static volatile int8_t s_latest_rssi_value;
 static const char *TAG = "RSSI_ANALYSER";
 
 // --- Funções auxiliares estáticas ---
-static int map_value(int value, int in_min, int in_max, int out_min, int out_max) {
-    if (in_max == in_min) return out_min;
-    return (value - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
-}
-
-static void draw_rssi_graph_background(void) {
-    int y_base = GRAPH_Y + GRAPH_HEIGHT;
-    for (int rssi = -20; rssi >= -100; rssi -= 20) {
-        int y_pos = map_value(rssi, -100, 0, y_base, GRAPH_Y);
-        st7789_draw_hline_fb(GRAPH_X, y_pos, GRAPH_WIDTH, COLOR_GRID);
-        char rssi_str[5];
-        snprintf(rssi_str, sizeof(rssi_str), "%d", rssi);
-        st7789_draw_text_fb(GRAPH_X - 25, y_pos - 4, rssi_str, COLOR_TEXT_SECONDARY, COLOR_BACKGROUND);
-    }
-    st7789_draw_rect_fb(GRAPH_X, GRAPH_Y, GRAPH_WIDTH, GRAPH_HEIGHT, COLOR_TEXT_SECONDARY);
-}
-
-static void draw_rssi_curve(const int* rssi_history, int num_points) {
-    int y_base = GRAPH_Y + GRAPH_HEIGHT;
-    int prev_x = -1, prev_y = -1;
-    for (int i = 0; i < num_points; i++) {
-        int current_x = map_value(i, 0, NUM_SAMPLES - 1, GRAPH_X, GRAPH_X + GRAPH_WIDTH - 1);
-        int y_curve = map_value(rssi_history[i], -100, 0, y_base, GRAPH_Y);
-        if (y_curve < GRAPH_Y) y_curve = GRAPH_Y;
-        if (y_curve > y_base) y_curve = y_base;
-        if (prev_x != -1) {
-            st7789_draw_line_fb(prev_x, prev_y, current_x, y_curve, GRAPH_COLOR);
-        }
-        prev_x = current_x;
-        prev_y = y_curve;
-    }
+static void draw_divider(ui_widget_t *w) {
+    st7789_draw_hline_fb(w->x, w->y, w->w, COLOR_DIVIDER);
 }
 
 // --- Callback para o scanner ---
@@ -103,15 +75,33 @@ void show_rssi_analyser(const BtDevice *dev) {
         return;
     }
 
-    int rssi_history[NUM_SAMPLES];
-    for (int i = 0; i < NUM_SAMPLES; i++) {
-        rssi_history[i] = -100;
-    }
-    int current_index = 0;
+    // Tela retida: a cada amostra só o gráfico e o valor atual são redesenhados
+    ui_screen_t screen;
+    ui_label_t title, current_label, hint;
+    ui_widget_t divider;
+    ui_graph_t graph;
+
+    ui_screen_init(&screen, COLOR_BACKGROUND);
+    ui_label_init(&title, 10, 10, 220, 14, NULL, COLOR_TEXT_PRIMARY, COLOR_BACKGROUND);
+    ui_label_set_font(&title, &font_5x7, 2);
+    ui_label_set_textf(&title, "RSSI: %.20s", dev->name);
+    ui_widget_init(&divider, 10, 35, 220, 1, draw_divider, COLOR_BACKGROUND);
+    ui_graph_init(&graph, GRAPH_X, GRAPH_Y, GRAPH_WIDTH, GRAPH_HEIGHT, NUM_SAMPLES,
+                  -100, 0, GRAPH_COLOR, COLOR_BACKGROUND);
+    ui_graph_set_grid(&graph, 20, COLOR_GRID, COLOR_TEXT_SECONDARY, true);
+    ui_label_init(&current_label, 10, 210, 220, 7, NULL, COLOR_HIGHLIGHT, COLOR_BACKGROUND);
+    ui_label_init(&hint, 10, 225, 220, 7, "BACK: Voltar", COLOR_TEXT_SECONDARY, COLOR_BACKGROUND);
+
+    ui_screen_add(&screen, &title.base);
+    ui_screen_add(&screen, &divider);
+    ui_screen_add(&screen, &graph.base);
+    ui_screen_add(&screen, &current_label.base);
+    ui_screen_add(&screen, &hint.base);
+    ui_screen_show(&screen);
     
     // Variáveis de controle do loop
     bool monitoring = true;
-    bool needs_redraw = true; // Força o desenho da tela na primeira iteração
+    bool needs_update = true; // Força a primeira amostra na primeira iteração
     uint64_t last_update_time = 0;
     const uint64_t update_interval_us = 500 * 1000; // 500ms em microssegundos
 
@@ -124,46 +114,17 @@ void show_rssi_analyser(const BtDevice *dev) {
             continue; // Pula para a próxima iteração para sair imediatamente
         }
 
-        // --- 2. LÓGICA DE ATUALIZAÇÃO DA TELA (baseada no tempo) ---
+        // --- 2. NOVA AMOSTRA (baseada no tempo) ---
         uint64_t current_time = esp_timer_get_time();
-        if ((current_time - last_update_time >= update_interval_us) || needs_redraw) {
-            
-            // Atualiza os dados do histórico
+        if ((current_time - last_update_time >= update_interval_us) || needs_update) {
             last_update_time = current_time;
             int current_rssi = s_latest_rssi_value;
-            rssi_history[current_index] = current_rssi;
-            current_index = (current_index + 1) % NUM_SAMPLES;
-
-            // Prepara buffer ordenado para o desenho
-            int ordered_rssi[NUM_SAMPLES];
-            for(int i = 0; i < NUM_SAMPLES; i++) {
-                ordered_rssi[i] = rssi_history[(current_index + i) % NUM_SAMPLES];
-            }
-
-            // Inicia o redesenho da tela
-            st7789_fill_screen_fb(COLOR_BACKGROUND);
-
-            // Título
-            char title[32];
-            snprintf(title, sizeof(title), "RSSI: %.20s", dev->name);
-            st7789_set_text_size(2);
-            st7789_draw_text_fb(10, 10, title, COLOR_TEXT_PRIMARY, COLOR_BACKGROUND);
-            st7789_set_text_size(1);
-            st7789_draw_hline_fb(10, 35, 220, COLOR_DIVIDER);
-
-            // Fundo do gráfico e curva
-            draw_rssi_graph_background();
-            draw_rssi_curve(ordered_rssi, NUM_SAMPLES);
-            
-            // Textos informativos
-            char rssi_str[16];
-            snprintf(rssi_str, sizeof(rssi_str), "Atual: %d dBm", current_rssi);
-            st7789_draw_text_fb(10, 210, rssi_str, COLOR_HIGHLIGHT, COLOR_BACKGROUND);
-            st7789_draw_text_fb(10, 225, "BACK: Voltar", COLOR_TEXT_SECONDARY, COLOR_BACKGROUND);
-
-            // Envia o frame buffer para o display
-            st7789_flush();
-            needs_redraw = false; // Marca que a tela foi redesenhada
+
+            ui_lock();
+            ui_graph_push(&graph, current_rssi);
+            ui_label_set_textf(&current_label, "Atual: %d dBm", current_rssi);
+            ui_unlock();
+            needs_update = false;
         }
 
         // --- 3. PAUSA CURTA ---
@@ -172,6 +133,8 @@ void show_rssi_analyser(const BtDevice *dev) {
         vTaskDelay(pdMS_TO_TICKS(50));
     }
 
+    ui_screen_hide();
+
     // --- LIMPEZA ---
     bluetooth_scanner_stop();
 }
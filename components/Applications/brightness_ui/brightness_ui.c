@@ -15,11 +15,10 @@
 #include "brightness_ui.h"
 #include "backlight.h"
 #include "st7789.h"
-#include "driver/gpio.h"
+#include "input.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include <stdio.h>
-#include "pin_def.h"
 
 #define BRIGHTNESS_MIN 1
 #define BRIGHTNESS_MAX 255
@@ -58,22 +57,25 @@ static void draw_brightness_ui(uint8_t brightness)
     st7789_flush();
 }
 
-static bool button_pressed(gpio_num_t pin)
-{
-    return gpio_get_level(pin) == 0;
-}
-
 void show_brightness_screen(void)
 {
     uint8_t brightness = backlight_get_brightness();
     draw_brightness_ui(brightness);
-
-    vTaskDelay(pdMS_TO_TICKS(250));
+    input_flush();
 
     while (1)
     {
+        input_event_t ev;
+        if (!input_wait_event(&ev, INPUT_WAIT_FOREVER))
+        {
+            continue;
+        }
+
+        bool press = ev.type == INPUT_EVENT_PRESS;
+        bool step = press || ev.type == INPUT_EVENT_REPEAT;
         bool changed = false;
-        if (button_pressed(BTN_UP))
+
+        if (ev.button == INPUT_BTN_UP && step)
         {
             if (brightness <= BRIGHTNESS_MAX - BRIGHTNESS_STEP)
             {
@@ -85,8 +87,7 @@ void show_brightness_screen(void)
             }
             changed = true;
         }
-
-        if (button_pressed(BTN_DOWN))
+        else if (ev.button == INPUT_BTN_DOWN && step)
         {
             if (brightness >= BRIGHTNESS_MIN + BRIGHTNESS_STEP)
             {
@@ -98,20 +99,15 @@ void show_brightness_screen(void)
             }
             changed = true;
         }
+        else if (ev.button == INPUT_BTN_BACK && press)
+        {
+            break;
+        }
 
         if (changed)
         {
             backlight_set_brightness(brightness);
             draw_brightness_ui(brightness);
-            vTaskDelay(pdMS_TO_TICKS(200));
-        }
-
-        if (button_pressed(BTN_BACK))
-        {
-            vTaskDelay(pdMS_TO_TICKS(200));
-            break;
         }
-
-        vTaskDelay(pdMS_TO_TICKS(50));
     }
 }
@@ -13,27 +13,9 @@
 // limitations under the License.
 
 #include "st7789.h"
-#include "home.h"  // coloque os bitmaps aqui (image_octo__1__bits etc.)
-
-
-const uint8_t image_wifi_full_bits[] = {0x01,0xf0,0x00,0x07,0xfc,0x00,0x1e,0x0f,0x00,0x39,0xf3,0x80,0x77,0xfd,0xc0,0xef,0x1e,0xe0,0x5c,0xe7,0x40,0x3b,0xfb,0x80,0x17,0x1d,0x00,0x0e,0xee,0x00,0x05,0xf4,0x00,0x03,0xb8,0x00,0x01,0x50,0x00,0x00,0xe0,0x00,0x00,0x40,0x00,0x00,0x00,0x00};
-
-const uint8_t image_battery_charging_bits[] = {0x00,0x02,0x00,0x0f,0xe4,0xfe,0x10,0x0c,0x01,0x10,0x08,0x01,0x70,0x18,0x01,0x80,0x30,0x01,0x80,0x3f,0x81,0x80,0x7f,0x01,0x80,0x03,0x01,0x80,0x06,0x01,0x70,0x04,0x01,0x10,0x0c,0x01,0x10,0x08,0x01,0x0f,0xd3,0xfe,0x00,0x10,0x00,0x00,0x00,0x00};
-
-const uint8_t image_SDcardMounted_bits[] = {0xff,0xe0,0xff,0x20,0xff,0xe0,0xff,0x20,0xff,0xe0,0xff,0x20,0xff,0xe0,0xe6,0x00};
-
-const uint8_t image_MHz_bits[] = {0xc3,0x61,0x80,0x00,0xe7,0x61,0x80,0x00,0xff,0x61,0x80,0x00,0xff,0x61,0xbf,0x80,0xdb,0x7f,0xbf,0x80,0xdb,0x7f,0x83,0x00,0xdb,0x61,0x86,0x00,0xc3,0x61,0x8c,0x00,0xc3,0x61,0x98,0x00,0xc3,0x61,0xbf,0x80,0xc3,0x61,0xbf,0x80};   
-    
-const uint8_t  image_octo_1_bits[] = {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xe0,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x00,0x1f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xe0,0x01,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x03,0xf0,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x03,0xe0,0x1f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x07,0xe0,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xc3,0xf0,0x07,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0x00,0x0f,0xc0,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf7,0xf8,0x03,0xff,0x00,0x00,0x00,0x00,0x00,0x01,0xf0,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x9f,0xff,0xfc,0x00,0xff,0xf0,0x00,0x00,0x00,0x00,0x01,0xe0,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x3e,0xff,0xf8,0x00,0x7f,0xfe,0x00,0x00,0x00,0x00,0x03,0xc0,0x00,0x00,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x7f,0xbf,0xc0,0x03,0xff,0xff,0xc0,0x00,0x00,0x00,0x07,0xc0,0x00,0x01,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xff,0xef,0xe0,0x07,0xff,0xff,0xf0,0x00,0x00,0x00,0x0f,0x80,0x00,0x03,0xf0,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xff,0xfb,0xf0,0x07,0xff,0x8f,0xfc,0x00,0x00,0x00,0x0f,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xe1,0xfe,0xfc,0x07,0xff,0xc1,0xff,0x00,0x00,0x00,0x1e,0x00,0x00,0x1f,0x80,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0x80,0x7f,0xfe,0x00,0x7f,0xe0,0x3f,0xc0,0x00,0x00,0x3e,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfc,0x00,0x1f,0xff,0x00,0x7d,0xf0,0x0f,0xe0,0x00,0x00,0x7c,0x00,0x00,0x7e,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xf8,0x00,0x07,0xff,0x80,0xfc,0xf0,0x03,0xf8,0x00,0x00,0x78,0x00,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0x01,0xff,0xc1,0xf8,0xf0,0x00,0xfc,0x00,0x00,0xf0,0x00,0x03,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x80,0x00,0x00,0xff,0xe0,0xf0,0x78,0x00,0x7e,0x00,0x01,0xf0,0x00,0x07,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x7f,0xf0,0x00,0xf8,0x00,0x1f,0x80,0x01,0xe0,0x00,0x0f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x1f,0xf8,0x03,0xf8,0x00,0x0f,0xc0,0x01,0xc0,0x00,0x1f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0x0f,0xff,0xff,0xf8,0x00,0x07,0xe0,0x01,0x80,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf0,0x00,0x00,0x00,0x07,0xff,0xff,0xf8,0x00,0x01,0xf0,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x03,0xff,0xff,0xf0,0x00,0x00,0xf8,0x00,0x00,0x01,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x01,0xff,0xff,0xf0,0x00,0x00,0x7c,0x00,0x00,0x03,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0xff,0xff,0xe0,0x00,0x00,0x3e,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x02,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0x80,0x00,0x00,0x1e,0x00,0x00,0x1f,0x80,0x00,0x00,0x00,0x1f,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x3f,0xfe,0x00,0x00,0x00,0x1f,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0xff,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x3e,0x00,0x00,0x00,0x07,0xff,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x87,0xc0,0x00,0x38,0x00,0x00,0x00,0x1f,0xfc,0x00,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xf3,0xc0,0x00,0x30,0x00,0x00,0x00,0xff,0xe0,0x00,0x00,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xfd,0xe0,0x00,0x00,0x00,0x00,0x07,0xff,0x00,0x00,0x01,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xf0,0x00,0x00,0x00,0x00,0x3f,0xf8,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x3f,0xf0,0x00,0x00,0x00,0x01,0xff,0xc0,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x0f,0xf8,0x00,0x00,0x00,0x0f,0xfe,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x3f,0xf8,0x00,0x00,0x00,0x3f,0xf8,0x00,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x3f,0xfc,0x00,0x00,0x01,0xff,0xc0,0x00,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x7f,0xfe,0x00,0x00,0x0f,0xfe,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x7f,0xfe,0x00,0x00,0x7f,0xf0,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x7f,0xff,0x00,0x00,0xff,0x80,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x78,0xff,0x00,0x00,0xfc,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x70,0xff,0x00,0x00,0xf0,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x01,0xff,0xc0,0x00,0x00,0x00,0x1c,0x70,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x07,0xff,0xf0,0x00,0x00,0x00,0x1e,0x70,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x1f,0xff,0xfc,0x00,0x00,0x00,0x1e,0x78,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x7f,0xff,0xfe,0x00,0x00,0x00,0x0e,0x3f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0xfe,0xff,0xff,0x80,0x00,0x00,0x0f,0x3f,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x01,0xf9,0xff,0xff,0xc0,0x00,0x00,0x0f,0x3f,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x03,0xe3,0xff,0xff,0xe0,0x00,0x00,0x07,0x9f,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x07,0xc7,0xff,0xff,0xe0,0x00,0x00,0x07,0x9f,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x07,0x8f,0xff,0xff,0xf0,0x00,0x00,0x03,0xcf,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x0f,0x0f,0xc7,0xff,0xf8,0x00,0x00,0x03,0xc7,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x0f,0x1f,0x83,0xff,0xf8,0x00,0x00,0x01,0xe7,0xff,0xbe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x1e,0x1f,0x83,0xff,0xf8,0x00,0x00,0x01,0xe3,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x1e,0x1f,0x83,0xff,0xfc,0x00,0x00,0x00,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x1c,0x1f,0x83,0xff,0xfc,0x00,0x00,0x00,0xff,0xff,0xf7,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x3c,0x1f,0x83,0xff,0xfc,0x00,0x00,0x00,0x7f,0x00,0x77,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x3c,0x1f,0xef,0xff,0xfe,0x00,0x00,0x00,0x7c,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x3c,0x1f,0xff,0xff,0xfe,0x00,0x00,0x00,0x78,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x3c,0x1f,0xff,0xff,0xfe,0x00,0x00,0x00,0xf0,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x3c,0x1f,0xff,0xff,0xfe,0x00,0x00,0x00,0xf0,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x3c,0x0f,0xff,0xff,0xfe,0x00,0x00,0x00,0xe0,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x3c,0x0f,0xff,0xff,0xfc,0x00,0x00,0x00,0xe0,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x3c,0x07,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x60,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x1c,0x03,0xff,0xff,0xff,0xf0,0x00,0x00,0x00,0xf8,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x1e,0x03,0xff,0xff,0xff,0xf0,0x00,0x00,0x00,0xfc,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x1e,0x00,0xff,0xff,0xff,0xf0,0x00,0x00,0x00,0x7f,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x0f,0x00,0x7f,0xf0,0x00,0x20,0x00,0x00,0x00,0xff,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x0f,0x81,0xff,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x07,0x83,0xf8,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x03,0xcf,0xe0,0x00,0x00,0x70,0x00,0x00,0x0f,0xfe,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x03,0xff,0x80,0x00,0x00,0xf0,0x00,0x00,0x3f,0xfe,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x01,0xff,0x00,0x00,0x00,0xf0,0x00,0x00,0xff,0xff,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0xfc,0x00,0x00,0x01,0xe0,0x00,0x03,0xff,0xff,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0xf8,0x00,0x00,0x03,0xf0,0x00,0x3f,0xff,0xff,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x01,0xf0,0x00,0x00,0x03,0xff,0xff,0xff,0xff,0xff,0x01,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x01,0xe0,0x00,0x00,0x07,0xff,0xff,0xff,0xff,0xff,0x01,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x80,0x00,0x00,0x07,0xff,0xff,0xff,0xff,0xff,0x01,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xff,0xff,0xff,0x00,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xff,0xff,0xff,0x00,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xff,0xff,0xff,0x00,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x7f,0xff,0xff,0xff,0xff,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xff,0xff,0xff,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xff,0xff,0xff,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xff,0xff,0xfe,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xff,0xfe,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x9c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0x00,0x3e,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xfc,0x00,0x1e,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xf0,0x00,0x3c,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xde,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xe0,0x00,0x3c,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xc0,0x00,0x78,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x03,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0xf8,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfc,0x03,0xf0,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x01,0xe7,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xff,0xe0,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x01,0xe7,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xc0,0x00,0x01,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0xf3,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0xf3,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf8,0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x79,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x3c,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xe0,0x00,0x1e,0x00,0x00,0x00,0x3c,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xf8,0x00,0x7f,0x00,0x00,0x00,0x1e,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x0f,0xfe,0x00,0x00,0x00,0x1e,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xfc,0x00,0x00,0x00,0x0e,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xe0,0x00,0x00,0x00,0x0f,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0x00,0x00,0x00,0x00,0x0f,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x9e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x8e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-
-
-const uint8_t  octo2[] = {0x00,0x00,0x63,0x00,0x00,0x06,0x0c,0x00,0x00,0x61,0x80,0x03,0x00,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x80,0x00,0x63,0x00,0x00,0x06,0x0c,0x00,0x00,0x61,0x80,0x03,0x00,0x03,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0xe0,0x00,0x63,0x00,0x00,0x06,0x0c,0x00,0x00,0x61,0x80,0x03,0x00,0x03,0x18,0x00,0x0f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0xf8,0x00,0x63,0x00,0x00,0x0e,0x0c,0x00,0x00,0x61,0x80,0x03,0x00,0x03,0x18,0x00,0x1f,0xff,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x03,0x00,0x7c,0x00,0x63,0x00,0x00,0x0e,0x1c,0x00,0x00,0x61,0x80,0x03,0x00,0x03,0x18,0x00,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xe0,0x00,0x00,0x00,0x03,0x03,0x00,0x1e,0x00,0x63,0x00,0x00,0x0c,0x1c,0x00,0x00,0x61,0x80,0x07,0x00,0x03,0x18,0x00,0x18,0x1f,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc0,0x03,0x03,0x00,0x0e,0x00,0x63,0x00,0x00,0x1c,0x18,0x00,0x00,0x61,0x80,0x07,0x00,0x03,0x18,0x00,0x38,0x00,0x00,0x00,0x0f,0xff,0xff,0xff,0xff,0xff,0xfe,0x03,0x03,0x00,0x07,0x00,0x63,0x00,0x00,0x18,0x18,0x00,0x00,0x71,0x80,0x06,0x00,0x07,0x38,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xff,0xff,0x83,0x03,0x00,0x03,0x80,0x63,0x00,0x00,0x38,0x38,0x00,0x00,0x71,0x80,0x06,0x00,0x07,0x38,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xbf,0xc3,0x03,0x00,0x01,0x80,0x63,0x00,0x00,0x30,0x38,0x00,0x00,0x71,0x80,0x0e,0x00,0x07,0x38,0x00,0x38,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xf3,0x03,0x00,0x01,0xc0,0x63,0x00,0x00,0x70,0x30,0x00,0x00,0x71,0x80,0x0c,0x00,0x06,0x30,0x00,0x39,0xff,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x7b,0x03,0x00,0x00,0xc0,0x63,0x00,0x00,0xe0,0x70,0x00,0x00,0x71,0xc0,0x0c,0x00,0x06,0x30,0x00,0x39,0xff,0xff,0xff,0xff,0xf8,0x00,0x00,0x00,0x00,0x07,0x3b,0x03,0x00,0x00,0xc0,0x63,0x00,0x01,0xc0,0xe0,0x00,0x00,0x71,0xc0,0x1c,0x00,0x06,0x30,0x00,0x39,0xdf,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x07,0x1b,0x03,0x00,0x00,0xe0,0x63,0x00,0x07,0x80,0xe0,0x00,0x00,0x31,0xc0,0x1c,0x00,0x06,0x30,0x00,0x39,0xc0,0x00,0x0f,0xff,0xff,0xff,0xff,0xff,0xff,0x87,0x1b,0x03,0x00,0x00,0xe0,0x63,0x00,0x0f,0x01,0xc0,0x00,0x00,0x30,0xc0,0x18,0x00,0x0e,0x70,0x00,0x39,0xc0,0x00,0x00,0x00,0x03,0xff,0xff,0xff,0xff,0xc7,0x1b,0x03,0x00,0x00,0x60,0x63,0x00,0x3e,0x03,0x80,0x00,0x00,0x30,0xc0,0x18,0x00,0x0c,0x70,0x00,0x39,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xc7,0x1b,0x03,0x00,0x00,0x60,0x63,0x00,0x7c,0x07,0x00,0x00,0x00,0x38,0xc0,0x38,0x00,0x0c,0x60,0x00,0x39,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc7,0x1b,0x03,0x00,0x00,0x70,0x63,0x01,0xf0,0x1e,0x00,0x00,0x00,0x38,0xe0,0x38,0x00,0x1c,0x60,0x00,0x39,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc7,0x1b,0x03,0x00,0x00,0x70,0x63,0x07,0xe0,0x3c,0x00,0x00,0x00,0x18,0x60,0x30,0x00,0x1c,0xe0,0x00,0x39,0xcf,0xe7,0xf8,0x00,0x00,0x7c,0x00,0x00,0x01,0xc7,0x1b,0x03,0x00,0x00,0x70,0x63,0x3f,0x80,0xf8,0x00,0x00,0x00,0x18,0x70,0x30,0x00,0x18,0xe0,0x00,0x39,0xc7,0xe7,0xff,0xf0,0x01,0xff,0x80,0x00,0x01,0xc7,0x1b,0x83,0x00,0x00,0x38,0x63,0xfe,0x03,0xf0,0x00,0x00,0x00,0x1c,0x70,0x30,0x00,0x38,0xc0,0x00,0x39,0xc7,0xe7,0xff,0xf8,0x07,0xff,0xc0,0x00,0x01,0xc7,0x1b,0x83,0x00,0x00,0x38,0x6f,0xf8,0x0f,0xc0,0x00,0x00,0x00,0x1c,0x38,0x30,0x00,0x71,0xc0,0x00,0x39,0xc0,0x00,0x07,0xf0,0x0f,0x81,0xe0,0x7f,0x01,0xc7,0x1b,0x83,0x00,0x80,0x1c,0xff,0xc0,0x7f,0x00,0x00,0x00,0x00,0x0c,0x38,0x70,0x00,0x71,0xc0,0x00,0x39,0xc0,0x00,0x00,0x00,0x1e,0x00,0x70,0x7f,0xf1,0xc7,0x1b,0x87,0x00,0xfc,0x7f,0xff,0x07,0xfc,0x00,0x03,0xff,0xe0,0x0e,0x1c,0x70,0x00,0xe3,0x80,0x00,0x39,0xc0,0x00,0x00,0x00,0x38,0x00,0x38,0x7f,0xf1,0xc7,0x19,0x87,0x00,0xff,0xff,0xfb,0xff,0xf0,0x01,0xff,0xff,0xf8,0x06,0x0e,0x70,0x01,0xc3,0x80,0x00,0x39,0xc0,0x00,0x00,0x00,0x38,0x00,0x1c,0x01,0xe1,0xc7,0x39,0x87,0x00,0x7f,0xff,0xff,0xff,0x80,0x7f,0xff,0xff,0xfc,0x07,0x0f,0x70,0x03,0xc7,0x00,0x00,0x39,0xc7,0xff,0x80,0x00,0x70,0x00,0x1c,0x00,0x01,0xc7,0x19,0xc7,0x00,0x01,0x00,0x7f,0xf8,0x0f,0xff,0xf1,0xff,0xfc,0x03,0x07,0xf0,0x0f,0x8f,0x00,0x00,0x39,0xc7,0xff,0xfb,0x00,0x60,0x00,0x0e,0x00,0x01,0xc7,0x19,0xc6,0x00,0x00,0x00,0x63,0x03,0xff,0xfc,0x3f,0xff,0x1c,0x03,0x81,0xf8,0x3e,0x0e,0x00,0x00,0x39,0xc7,0xff,0xfb,0x00,0xe0,0x00,0x0e,0x00,0x01,0xc7,0x38,0xc6,0x00,0x00,0x00,0x63,0x7f,0xff,0x07,0xff,0xe0,0x1c,0x01,0xc0,0xff,0xfc,0x1c,0x00,0x00,0x39,0xc0,0x00,0x72,0x00,0xe0,0x00,0x06,0x00,0x01,0xc7,0x38,0xe6,0x00,0x00,0x00,0x6f,0xff,0xe0,0xff,0xfc,0x00,0x1c,0x00,0xe0,0x7f,0xf0,0x38,0x00,0x00,0x39,0xc0,0x00,0x00,0x00,0xc0,0x00,0x06,0x1f,0xf1,0xc7,0x38,0x66,0x01,0x00,0x01,0xff,0xf8,0x3f,0xff,0x80,0x00,0x1c,0x00,0x70,0x77,0x80,0xf0,0x00,0x00,0x39,0xc0,0x00,0x00,0x00,0xc0,0x00,0x07,0x1f,0xf1,0xc7,0x38,0x76,0x03,0x00,0x3f,0xff,0x07,0xff,0xf0,0x00,0x00,0x1c,0x00,0x7c,0x70,0x01,0xe0,0x00,0x00,0x39,0xc0,0x00,0x00,0x00,0xc3,0x00,0x07,0x0f,0xf1,0xc7,0x38,0x3e,0x07,0x03,0xff,0xe0,0xff,0xfc,0x00,0x00,0x03,0x1c,0x00,0x1f,0x70,0x07,0xc0,0x00,0x00,0x39,0xc7,0xf9,0xc0,0x00,0xc7,0x83,0xc7,0x00,0x01,0xc7,0x38,0x1e,0x1f,0x07,0xfc,0x1f,0xff,0x80,0x00,0x00,0x7f,0x1c,0x00,0x0f,0xf0,0x3f,0x80,0x00,0x00,0x39,0xcf,0xfb,0xff,0xe0,0xcf,0xc7,0xe7,0x00,0x01,0xc7,0x38,0x0f,0xfe,0x0f,0xc3,0xff,0xf0,0x00,0x00,0x1f,0xff,0x1c,0x00,0x07,0xff,0xfe,0x00,0x00,0x00,0x39,0xc7,0xfb,0xff,0xe0,0xdf,0xcf,0xe7,0x00,0x01,0xc7,0x38,0x0f,0xf8,0x0e,0x3f,0xfe,0x00,0x00,0x01,0xff,0xfb,0x1c,0x00,0x01,0xff,0xf8,0x00,0x00,0x00,0x39,0xc0,0x00,0xff,0xe0,0xdf,0xcf,0xf7,0x00,0x01,0xc7,0x38,0x0e,0xc0,0x0e,0x3f,0xc0,0x00,0x00,0x7f,0xff,0x03,0x1c,0x00,0x00,0x7f,0xc0,0x00,0x00,0x00,0x39,0xc0,0x00,0x00,0x00,0xdf,0xcf,0xf7,0x0f,0x01,0xc7,0x38,0x0e,0x00,0x0e,0x38,0x00,0x00,0x0f,0xff,0xe0,0x03,0x1c,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x39,0xc0,0x00,0x00,0x00,0xff,0xcf,0xe6,0x1f,0xf1,0xc7,0x38,0x0e,0x00,0x0e,0x30,0x00,0x01,0xff,0xfc,0x00,0x03,0x1c,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x39,0xc0,0x00,0x00,0x00,0xef,0x8f,0xee,0x1f,0xf1,0xc7,0x38,0x0c,0x00,0x0e,0x30,0x00,0x3f,0xff,0x80,0x00,0x03,0x18,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x39,0xc7,0xe0,0x00,0x00,0x67,0x77,0xee,0x01,0xf1,0xc7,0x38,0x0c,0x00,0x0e,0x30,0x07,0xff,0xf0,0x00,0x00,0x03,0x18,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x39,0xcf,0xff,0xff,0x00,0x70,0x73,0x8c,0x00,0x01,0xc7,0x38,0x0c,0x00,0x0e,0x30,0xff,0xfe,0x00,0x00,0x00,0x03,0x18,0x00,0x00,0x60,0x00,0x00,0x00,0x00,0x39,0xc7,0xff,0xff,0xf0,0x30,0x70,0x1c,0x00,0x01,0xc7,0x38,0x0c,0x00,0x0e,0x31,0xff,0xc0,0x00,0x00,0x00,0x03,0x18,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x39,0xc0,0x3f,0xff,0xf0,0x30,0xf0,0x18,0x00,0x01,0xc7,0x38,0x0c,0x00,0x0e,0x31,0xf8,0x00,0x01,0xe0,0x00,0x03,0x18,0x00,0x00,0xe0,0x00,0x01,0xff,0xf8,0x39,0xc0,0x00,0x00,0xf0,0x30,0xf0,0x38,0x70,0x01,0xc7,0x38,0x0c,0x00,0x0c,0x31,0x80,0x00,0x07,0xf8,0x00,0x03,0x18,0x00,0x00,0xc0,0x00,0x0f,0xff,0xff,0x39,0xc0,0x00,0x00,0x00,0x30,0xf8,0x30,0xff,0xf1,0xc6,0x38,0x0c,0x00,0x0c,0x31,0x80,0x00,0x1f,0xfc,0x00,0x03,0x18,0x00,0x00,0xc0,0x00,0x3f,0xff,0xff,0xf9,0xc0,0x00,0x00,0x00,0x30,0xb0,0x30,0xff,0xf5,0xc6,0x38,0x0c,0x00,0x0c,0x31,0x80,0x00,0x1f,0xfe,0x00,0x03,0x18,0x00,0x01,0xc0,0x00,0xff,0x00,0x0f,0xf9,0xc7,0x00,0x00,0x00,0x30,0x00,0x30,0x0f,0xf1,0xc6,0x38,0x0c,0x00,0x0c,0x31,0x80,0x00,0x3c,0x1e,0x00,0x03,0x18,0x00,0x01,0x80,0x03,0xf8,0x00,0x01,0xfd,0xc7,0xff,0xe0,0x00,0x32,0x00,0x30,0x00,0x01,0xc6,0x38,0x0c,0x00,0x0c,0x31,0x80,0x00,0x78,0x0f,0x00,0x03,0x18,0x00,0x03,0x80,0x07,0xc0,0x00,0x00,0x3f,0xc7,0xff,0xef,0xfc,0x37,0x62,0x30,0x00,0x01,0xc6,0x38,0x0c,0x00,0x0c,0x31,0x80,0x00,0x70,0x07,0x00,0x03,0x18,0x00,0x03,0x80,0x0f,0x80,0x00,0x00,0x0f,0xc0,0xff,0xef,0xfc,0x3f,0x77,0x70,0x00,0x01,0xc6,0x38,0x0c,0x00,0x0c,0x31,0x80,0x00,0xf0,0x07,0x80,0x03,0x18,0x00,0x07,0x00,0x3e,0x00,0x00,0x00,0x07,0xc0,0x00,0x07,0xfc,0x1f,0xff,0xf0,0x00,0x01,0xc6,0x38,0x0e,0x00,0x0c,0x31,0x80,0x00,0xe0,0x03,0x80,0x03,0x18,0x00,0x07,0x00,0x7c,0x00,0x00,0x00,0x01,0xe0,0x00,0x00,0x00,0x0b,0xff,0xe1,0xff,0xe1,0xc6,0x38,0x0e,0x00,0x0c,0x31,0x80,0x00,0xe0,0x03,0x80,0x03,0x18,0x00,0x0e,0x00,0xf0,0x00,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0x00,0x9d,0xc1,0xff,0xf1,0xc6,0x38,0x0e,0x00,0x0c,0x31,0x80,0x00,0xe0,0x03,0x80,0x03,0x18,0x00,0x0e,0x01,0xe0,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xf1,0xc6,0x38,0x06,0x00,0x0c,0x31,0x80,0x00,0xe0,0x03,0x80,0x03,0x18,0x00,0x1c,0x03,0xc0,0x00,0x00,0x00,0x00,0x3c,0x1f,0xc0,0x00,0x00,0x00,0x00,0x00,0x01,0xc6,0x38,0x06,0x00,0x0c,0x31,0x80,0x00,0xe0,0x03,0x80,0x03,0x18,0x00,0x38,0x07,0x80,0x00,0x00,0x00,0x00,0x1e,0x1f,0xff,0xf8,0x00,0x00,0x00,0x00,0x01,0xc6,0x38,0x06,0x00,0x0c,0x31,0x80,0x00,0xe0,0x03,0x80,0x03,0x18,0x00,0x38,0x0f,0x03,0xf0,0x00,0x00,0x00,0x0f,0x1f,0xff,0xff,0xcf,0xe0,0x00,0x00,0x01,0xc6,0x38,0x07,0x00,0x0c,0x31,0x80,0x00,0xe0,0x07,0xe0,0x03,0x18,0x00,0x70,0x0e,0x1f,0xfe,0x00,0x00,0x00,0x07,0x80,0x7f,0xff,0xff,0xff,0xfe,0x00,0x01,0xc6,0x38,0x07,0x00,0xfc,0x31,0x80,0x00,0xe0,0xff,0xe0,0x03,0x18,0x01,0xe0,0x1c,0x7f,0xff,0x80,0x00,0x00,0x03,0x80,0x00,0x07,0xcf,0xff,0xff,0xf7,0x81,0xc6,0x38,0x03,0x00,0xfc,0x31,0x80,0x00,0xcf,0xff,0xe0,0x03,0x18,0x03,0xc0,0x39,0xff,0xff,0xe0,0x00,0x00,0x01,0xc0,0x00,0x00,0x00,0x7f,0xff,0xf7,0xf1,0xc6,0x38,0x03,0x80,0xec,0x31,0x80,0x01,0xff,0xf8,0x60,0x03,0x18,0x0f,0x80,0x3b,0xff,0xff,0xf8,0x00,0x00,0x01,0xe0,0x00,0x00,0x00,0x00,0x07,0xf7,0xf1,0xc6,0x38,0x03,0x80,0x0c,0x31,0x80,0x07,0xff,0x80,0x60,0x03,0x1f,0xff,0x00,0x77,0xfc,0x00,0xfc,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0xe1,0xc6,0x3f,0xf9,0xc0,0x0c,0x31,0x80,0x07,0xf0,0x00,0x60,0x03,0x1f,0xfc,0x00,0xef,0xf0,0x00,0x3e,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc6,0x3f,0xff,0xc0,0x0c,0x31,0x80,0x07,0x00,0x00,0x60,0x03,0x1b,0xf0,0x00,0xff,0xe0,0x00,0x0f,0x00,0x00,0x00,0x7f,0xff,0xe0,0x00,0x00,0x00,0x00,0x01,0xc6,0x33,0xff,0xff,0x0c,0x31,0x80,0x07,0x00,0x00,0x60,0x03,0x18,0x00,0x01,0xdf,0xc0,0x00,0x07,0xc0,0x00,0x00,0x3f,0xff,0xff,0xfc,0x00,0x00,0x00,0x01,0xc6,0x38,0x07,0xff,0x0c,0x31,0x80,0x07,0x00,0xc0,0x60,0x03,0x18,0x00,0x01,0xbf,0x80,0x1c,0x01,0xe0,0x00,0x00,0x3c,0xff,0xff,0xff,0xff,0xc0,0x00,0x01,0xc6,0x30,0x00,0x77,0x0c,0x31,0x80,0x07,0x03,0xe0,0x60,0x03,0x18,0x00,0x03,0xff,0x00,0x7e,0x00,0xf0,0x00,0x00,0x1c,0x00,0x1f,0xff,0xff,0xff,0xf0,0x01,0xc6,0x30,0x00,0x70,0x0c,0x31,0x80,0x07,0x03,0xe0,0x60,0x03,0x18,0x00,0x03,0x7e,0x00,0xff,0x00,0x78,0x00,0x00,0x0e,0x00,0x00,0x03,0xff,0xff,0xff,0xff,0xc6,0x38,0x00,0x38,0x0c,0x31,0x80,0x07,0x03,0xf0,0x60,0x03,0x18,0x00,0x07,0xfc,0x00,0xe7,0x00,0x38,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x3f,0xff,0xff,0xc6,0x30,0x00,0x1c,0x0c,0x31,0x80,0x07,0x07,0xe0,0x60,0x03,0x18,0x00,0x07,0xfc,0x01,0xc3,0x80,0x1c,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xc6,0x30,0x00,0x0e,0x0c,0x31,0x80,0x07,0x03,0xe0,0x60,0x03,0x18,0x00,0x06,0xf8,0x01,0xfb,0x80,0x0e,0x00,0x00,0x07,0xff,0x00,0x00,0x00,0x00,0x00,0x03,0x86,0x30,0x00,0x07,0x0c,0x31,0x80,0x07,0x03,0xe0,0x60,0x07,0x18,0x00,0x0f,0xf8,0x01,0xbb,0x80,0x0f,0x00,0x00,0x07,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0x06,0x30,0x00,0x03,0x0c,0x31,0x80,0x07,0x01,0xc0,0x60,0x07,0x18,0x00,0x0d,0xf0,0x03,0xfb,0x80,0x07,0x00,0x00,0x03,0xff,0xff,0xff,0xf0,0x00,0x00,0x00,0x06,0x70,0x00,0x01,0x0c,0x31,0x80,0x07,0x01,0xc0,0x60,0x07,0x18,0x00,0x0f,0xf0,0x03,0xfb,0x80,0x03,0x80,0x00,0x03,0x80,0xff,0xff,0xff,0xfc,0x00,0x00,0x06,0xf0,0x00,0x00,0x0c,0x31,0x80,0x07,0x03,0xe0,0x70,0x07,0x18,0x00,0x1f,0xe0,0x03,0x7b,0x80,0x01,0xc0,0x00,0x03,0x80,0x01,0x9f,0xff,0xff,0xff,0x00,0x07,0xe0,0x00,0x00,0x0c,0x31,0x80,0x07,0x03,0xe0,0x60,0x07,0x18,0x00,0x1f,0xe0,0x03,0x7b,0x80,0x01,0xc0,0x00,0x01,0xc0,0x01,0x80,0x0f,0xff,0xff,0xff,0x87,0xc0,0x00,0x00,0x0c,0x31,0x80,0x06,0x03,0xe0,0x70,0x07,0x18,0x00,0x1b,0xc0,0x03,0x73,0x80,0x00,0xe0,0x00,0x01,0xc0,0x01,0x80,0x0e,0x01,0xff,0xff,0xff,0x80,0x00,0x00,0x0c,0x31,0x80,0x06,0x03,0xc0,0x70,0x07,0x18,0x00,0x1b,0xc0,0x03,0x73,0x00,0x00,0xf0,0x00,0x01,0xc0,0x3f,0x80,0x0e,0x00,0x00,0x7f,0xff,0x00,0x00,0x00,0x0c,0x31,0x80,0x06,0x00,0x10,0xf0,0x07,0x38,0x00,0x3f,0xc0,0x03,0x77,0x00,0x00,0x70,0x00,0x00,0xc0,0xff,0x80,0x0f,0xc0,0x00,0x00,0x3c,0x00,0x00,0x00,0x0c,0x31,0x80,0x06,0x00,0x07,0xe0,0x07,0x38,0x00,0x3f,0x80,0x03,0x87,0x00,0x00,0x38,0x00,0x00,0xe1,0xff,0x80,0x0f,0xf0,0x7c,0x00,0x00,0x00,0x00,0x00,0x0c,0x31,0x80,0x06,0x00,0x3f,0xe0,0x07,0x38,0x00,0xff,0x80,0x03,0x8e,0x00,0x00,0x38,0x00,0x00,0xe1,0xc1,0xff,0x0f,0xf8,0x7f,0xf8,0x00,0x00,0x00,0x00,0x0c,0x31,0x80,0x07,0x01,0xff,0x00,0x07,0x38,0x07,0xf7,0x80,0x01,0xde,0x00,0x00,0x1c,0x00,0x00,0xe3,0x81,0xff,0xfe,0x7c,0x7f,0xff,0xf0,0x00,0x00,0x00,0x0c,0x31,0x80,0x06,0x1f,0xf8,0x00,0x0f,0x38,0x1f,0xf7,0x00,0x01,0xfc,0x00,0x00,0x1c,0x00,0x00,0x63,0x80,0xff,0xfe,0x0e,0x63,0xff,0xff,0xc0,0x00,0x00,0x0c,0x31,0x80,0x06,0xff,0xc0,0x00,0x7f,0x38,0xff,0x37,0x00,0x00,0xf8,0x00,0x00,0x0e,0x00,0x00,0x63,0xc0,0x00,0xfc,0x06,0x60,0x03,0xff,0xff,0x80,0x00,0x0c,0x31,0x80,0x07,0xfe,0x00,0x03,0xfe,0x3f,0xf8,0x37,0x00,0x00,0x20,0x00,0x00,0x0e,0x00,0x00,0x71,0xf0,0x00,0x00,0x0e,0x60,0x00,0x07,0xff,0xfe,0x00,0x0c,0x31,0x80,0x07,0xf0,0x00,0x1f,0xf0,0x3f,0xc0,0x37,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x70,0xfe,0x00,0x00,0x1e,0xe0,0x00,0x00,0x3f,0xff,0xfc,0x0c,0x31,0x80,0x07,0x00,0x00,0xff,0x80,0x3f,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x70,0x7f,0xf8,0x01,0xfc,0xe3,0xc0,0x00,0x00,0x7f,0xff,0x0c,0x31,0x80,0x00,0x00,0x07,0xfc,0x00,0x38,0x00,0x7e,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x7c,0x0f,0xff,0xff,0xf0,0xe7,0xff,0x00,0x00,0x01,0xff,0x0c,0x31,0x80,0x00,0x00,0x1f,0xe0,0x00,0x78,0x00,0x7f,0xff,0x00,0x03,0x00,0x00,0x03,0x00,0x00,0x7f,0x81,0xff,0xff,0xe0,0xe7,0xff,0xfc,0x00,0x00,0x07,0x0c,0x31,0x80,0x00,0x00,0xff,0x00,0x03,0xf8,0x00,0x7f,0xff,0xff,0x03,0x80,0x00,0x03,0x80,0x00,0x3f,0xe0,0x03,0xfe,0x00,0xe6,0x7f,0xff,0xf0,0x00,0x00,0x0c,0x31,0x80,0x00,0x07,0xf8,0x00,0x1f,0xe0,0x00,0x7e,0xff,0xff,0x03,0xff,0xff,0x03,0x80,0x00,0x3f,0xf8,0x00,0x00,0x00,0xc6,0x00,0xff,0xff,0xc0,0x00,0x0c,0x31,0x80,0x00,0x3f,0xe0,0x00,0xff,0x00,0x00,0x7e,0xcf,0xff,0x03,0xff,0xff,0xc1,0x80,0x00,0x3f,0xfc,0x00,0x00,0x00,0xc6,0x00,0x03,0xff,0xff,0x80,0x0c,0x31,0x80,0x01,0xff,0x00,0x07,0xfc,0x00,0x00,0x7e,0xcf,0xf7,0x03,0xff,0xff,0xe1,0xc0,0x00,0x3f,0xbf,0x00,0x00,0x00,0xc6,0x00,0x00,0x0f,0xff,0xfe,0x0c,0x31,0x80,0x0f,0xf8,0x00,0x3f,0xe0,0x00,0x00,0x7c,0xc7,0xf7,0x03,0x8f,0xef,0xe1,0xc0,0x00,0x3f,0x8f,0x80,0x00,0x00,0xc6,0x00,0x00,0x00,0x3f,0xff,0x0c,0x31,0x80,0x7f,0xc0,0x00,0xff,0x00,0x00,0x00,0x3c,0xe7,0xe6,0x03,0x8f,0xe0,0xc1,0xc0,0x00,0x7f,0x83,0xf8,0x00,0x00,0xce,0x30,0x00,0x00,0x00,0xff,0x0c,0x31,0x83,0xfe,0x00,0x07,0xf8,0x00,0x00,0x00,0x3c,0xe7,0xee,0x01,0x8f,0xe0,0xc1,0xc0,0x00,0x7f,0x81,0xff,0xf0,0x00,0xce,0x7f,0x80,0x00,0x00,0x03,0x0c,0x31,0x9f,0xf0,0x00,0x3f,0xc0,0x00,0x00,0x00,0x3c,0x71,0xce,0x01,0xcf,0xc1,0xc0,0xc0,0x00,0x7f,0x00,0xff,0xff,0xc0,0xce,0x7f,0xfe,0x00,0x00,0x00,0x0c,0x31,0xff,0x80,0x01,0xff,0x00,0x00,0x00,0x00,0x3c,0x70,0x1c,0x01,0xc7,0x81,0xc0,0xc0,0x00,0x7f,0x00,0x73,0xff,0xfe,0xce,0x1f,0xff,0xe0,0x00,0x00,0x0c,0x31,0xfc,0x00,0x0f,0xf8,0x1f,0xc0,0x00,0x00,0x3c,0x3c,0x3c,0x00,0xe0,0x03,0x80,0xc0,0x00,0x7f,0x00,0x70,0x0f,0xff,0xcc,0x00,0x7f,0xf3,0x80,0x00,0x0c,0x31,0xe0,0x00,0x7f,0xb0,0x7f,0xf0,0x00,0x00,0x3c,0x3f,0xf8,0x00,0xf0,0x07,0x80,0xc0,0x00,0x7f,0x00,0x30,0x00,0x1f,0xcc,0x00,0x03,0xf3,0xfc,0x00,0x0c,0x30,0x00,0x03,0xfe,0x31,0xff,0xf8,0x00,0x00,0x3c,0x0f,0xf0,0x00,0x78,0x0f,0x00,0xc0,0x00,0x7f,0x00,0x38,0x00,0x01,0xcc,0x00,0x00,0x03,0xff,0xe0,0x0c,0x30,0x00,0x1f,0xf0,0x3f,0xe0,0x7c,0x00,0x00,0x1c,0x07,0xc0,0x00,0x3f,0xfe,0x00,0xc0,0x00,0x7f,0x00,0x3f,0x80,0x01,0x8c,0x60,0x00,0x00,0x7f,0xf8,0x0e,0x30,0x00,0xff,0x80,0x3f,0x80,0x1e,0x00,0x00,0x1c,0x00,0x00,0x00,0x1f,0xfc,0x00,0xc0,0x00,0xff,0x00,0x3f,0xfe,0x01,0x8c,0xff,0x00,0x00,0x03,0xf8,0x0f,0x30,0x07,0xfd,0x80,0x3f,0x00,0x0f,0x00,0x00,0x1c,0x00,0x00,0x00,0x0f,0xf8,0x00,0xc0,0x00,0xff,0x00,0x1f,0xff,0xe1,0x8c,0xff,0xf0,0x00,0x00,0x18,0x07,0xb0,0x1f,0xe7,0x80,0x3e,0x00,0x07,0x80,0x00,0x1c,0x00,0x00,0x00,0x01,0xc0,0x00,0xc0,0x00,0xff,0x00,0x18,0x3f,0xff,0x8c,0x3f,0xf3,0xc0,0x00,0x00,0x03,0xf0,0xff,0x1f,0x81,0xfc,0x00,0x03,0xc0,0x00,0x0c,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x01,0xfe,0x00,0x18,0x06,0xff,0x8c,0x01,0xf7,0xe0,0x00,0x00,0x01,0xf7,0xfc,0x3f,0x8f,0xf8,0x00,0x01,0xc0,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0xc0,0x01,0xfe,0x00,0x18,0x06,0xef,0x9c,0x00,0x03,0xe3,0xe0,0x00,0x03,0xff,0xc0,0x79,0xbf,0xf8,0x00,0x00,0xe0,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x01,0xc0,0x01,0xfe,0x00,0x18,0x06,0xe1,0x9c,0x00,0x00,0x47,0xff,0x00,0x1f,0xff,0xc0,0xf3,0xfe,0x30,0x00,0x00,0x70,0x00,0x0e,0x00,0x03,0xe0,0x00,0x00,0x01,0xc0,0x03,0xfe,0x00,0x38,0x06,0xe3,0x9c,0x40,0x00,0x01,0xff,0xf0,0x7f,0x39,0xc1,0xc3,0xf0,0x71,0xe0,0x00,0x70,0x00,0x0e,0x00,0x0f,0xfc,0x00,0x00,0x01,0xc0,0x03,0xfe,0x00,0x38,0x06,0xe3,0x98,0xfe,0x00,0x00,0x1f,0xf0,0xfc,0x39,0xc3,0x81,0x80,0x77,0xf8,0x00,0x38,0x00,0x3e,0x00,0x1f,0xfe,0x00,0x00,0x01,0xc0,0x07,0xfe,0x00,0x38,0x06,0xe3,0x98,0xff,0x60,0x00,0x00,0xf0,0xf0,0x38,0xc3,0x80,0x00,0x7f,0xfe,0x00,0x1c,0x00,0xfe,0x00,0x3f,0x7f,0x00,0x00,0x01,0x80,0x07,0xfe,0x00,0x38,0x06,0xe3,0x98,0x3f,0x7f,0x00,0x00,0x00,0xc0,0x38,0xc3,0x80,0x00,0x7f,0xff,0x00,0x1c,0x01,0xf7,0x00,0x3c,0x07,0x80,0x00,0x01,0x80,0x0f,0xfe,0x00,0x38,0x06,0xe3,0x18,0x02,0x7f,0xc0,0x00,0x00,0x00,0x38,0xe3,0x80,0x00,0xff,0x07,0x00,0x0e,0x07,0xc7,0x00,0x10,0x03,0xc0,0x00,0x03,0x80,0x0f,0xfe,0x00,0x30,0x06,0xe3,0x18,0x00,0x1f,0xc7,0xc0,0x00,0x00,0x30,0xe1,0xe0,0x0f,0xfc,0x03,0x80,0x0f,0x1f,0x87,0x00,0x00,0x01,0xc0,0x00,0x03,0x80,0x1f,0xfc,0x00,0x30,0x0e,0xe3,0x18,0x00,0x00,0xc7,0xfc,0x00,0x00,0x30,0x60,0xff,0xff,0xe0,0x01,0xc0,0x07,0xfe,0x07,0x00,0x00,0x00,0x80,0x00,0x03,0x00,0x3f,0xfc,0x00,0x70,0x0e,0xe3,0x18,0xc0,0x00,0x07,0xff,0xc0,0x00,0x70,0x70,0x7f,0xff,0x00,0x01,0xc0,0x03,0xf8,0x03,0x00,0x00,0x00,0x00,0x00,0x03,0x00,0x7f,0xfc,0x00,0x70,0x0e,0xe3,0x19,0xfc,0x00,0x00,0x7f,0xf0,0x00,0x70,0x70,0x1f,0xe0,0x00,0x00,0xe0,0x01,0xe0,0x0f,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x7f,0xfc,0x00,0x70,0x0e,0xe3,0x39,0xff,0xe0,0x00,0x03,0xf0,0x00,0x60,0x38,0x00,0x00,0x00,0x00,0xe0,0x00,0xf8,0x7f,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0xff,0xfc,0x00,0x70,0x0c,0xe3,0x38,0x7f,0xfe,0x00,0x00,0x20,0x00,0xe0,0x3c,0x00,0x00,0x00,0x00,0x60,0x00,0x7f,0xff,0x00,0x00,0x00,0x00,0x00,0x06,0x01,0xff,0xfc,0x00,0x60,0x0c,0xe3,0x38,0x03,0xff,0x80,0x00,0x00,0x01,0xc0,0x1e,0x00,0x1f,0xe0,0x00,0x70,0x00,0x1f,0xfb,0x00,0x00,0x00,0x00,0x00,0x0e,0x03,0xff,0xfc,0x00,0x60,0x0c,0xc7,0x30,0x00,0x3f,0xce,0x00,0x00,0x03,0xc0,0x0f,0x81,0xff,0xfc,0x00,0x70,0x00,0x07,0xc7,0x00,0x00,0x00,0x00,0x00,0x0e,0x07,0xff,0xfc,0x00,0xe0,0x0c,0xc7,0x30,0x00,0x03,0x8f,0xe0,0x00,0x07,0x80,0x07,0xff,0xff,0xff,0x00,0x38,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x1c,0x0f,0xff,0xf8,0x00,0xe0,0x1c,0xc7,0x31,0x80,0x00,0x0f,0xf7,0x00,0x0f,0x00,0x03,0xff,0xe0,0x1f,0xc0,0x78,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x1c,0x0e,0xff,0xf8,0x00,0xe0,0x19,0xc7,0x33,0xf8,0x00,0x01,0xe7,0xe0,0x3e,0x00,0x00,0xfe,0x00,0x03,0xf3,0xf8,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x7f,0xf8,0x00,0xe0,0x19,0xc6,0x31,0xff,0x80,0x00,0x07,0xe0,0x78,0x00,0x00,0x00,0x00,0x00,0xff,0xfc,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x1f,0xf8,0x00,0xc0,0x39,0x86,0x30,0x7f,0xfc,0x00,0x00,0xe0,0xf0,0x00,0x00,0x00,0x00,0x00,0x3f,0x9c,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x0f,0xf8,0x00,0xc0,0x33,0x86,0x30,0x07,0xff,0x80,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0xfe,0x0e,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x0f,0xf8,0x01,0xc0,0x73,0x86,0x70,0x00,0x7f,0x8c,0x00,0x00,0xc0,0x00,0x00,0x00,0x00,0x03,0xff,0x06,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x60,0x00,0x07,0xf8,0x01,0xc0,0xe3,0x06,0x70,0x00,0x07,0x9f,0xc0,0x00,0x80,0x00,0x00,0x00,0x00,0x0f,0xe7,0x1f,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xf8,0x01,0xc3,0xc7,0x06,0x70,0x00,0x00,0x1f,0xfc,0x00,0x80,0x00,0x00,0x00,0x00,0x3f,0x83,0xbf,0x80,0x00,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf0,0x01,0xff,0xce,0x06,0x78,0x00,0x00,0x03,0xff,0xc0,0x80,0x00,0x00,0x00,0x00,0xfe,0x01,0xff,0xc0,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x01,0xff,0x0e,0x06,0x7f,0x80,0x00,0x00,0x3f,0xc0,0x80,0x00,0x00,0x00,0x03,0xf0,0x03,0xf1,0xc0,0x1f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x01,0xfc,0x1c,0x0e,0x3f,0xf8,0x00,0x00,0x03,0xc0,0xc0,0x00,0x00,0x00,0x0f,0xc0,0x0f,0xc0,0xf7,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x03,0x80,0x78,0x0e,0x07,0xff,0x00,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x3f,0x00,0x3f,0x80,0x7f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x03,0x80,0xf0,0x0c,0x00,0x7f,0xf0,0x00,0x00,0x01,0xf0,0x01,0xf8,0x00,0xfc,0x00,0xff,0x81,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x03,0xff,0xe0,0x0f,0xc0,0x07,0xff,0x00,0x00,0x01,0xff,0xff,0xfe,0x03,0xf0,0x03,0xf3,0x07,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x03,0xff,0xc0,0x07,0xf8,0x00,0xff,0xf0,0x00,0x01,0x3f,0xff,0xff,0x8f,0xc0,0x0f,0xc7,0x1f,0x80,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0x40,0x00,0x07,0x83,0xff,0x00,0x0f,0xff,0x80,0x0f,0xfe,0x00,0x01,0x0f,0xfe,0x0f,0xff,0x00,0x3f,0x0e,0x3e,0x00,0x00,0x00,0x18,0x00,0x00,0x00,0x00,0x00,0xf0,0x00,0x03,0x83,0x00,0x00,0x1e,0x3f,0xf0,0x00,0xff,0xe0,0x01,0x00,0x00,0x01,0xfc,0x00,0xfc,0x1e,0x78,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0xfc,0x00,0x01,0xc7,0x00,0x00,0x7c,0x07,0xfe,0x00,0x1f,0xfc,0x01,0x00,0x00,0x03,0xf0,0x03,0xf0,0x3c,0xf0,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x01,0xc7,0x00,0x01,0xf0,0x00,0x7f,0xe0,0x01,0xff,0xc1,0x00,0x00,0x0f,0xf0,0x0f,0xc1,0xf9,0xe0,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0xe7,0x00,0x03,0xe0,0x80,0x0f,0xfe,0x00,0x1f,0xff,0x00,0x00,0x3f,0x38,0x3f,0x07,0xe1,0xc0,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x01,0x80,0x07,0x80,0x00,0xe7,0x00,0x07,0x83,0xf0,0x00,0xff,0xc0,0x01,0xff,0x00,0x00,0xfc,0x1c,0xfe,0x0f,0xc3,0x80,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x01,0x80,0x03,0xc0,0x00,0x77,0x00,0x1f,0x0f,0xfe,0x00,0x1f,0xfc,0x00,0x3f,0x00,0x03,0xf0,0x1d,0xf0,0x3e,0x07,0x80,0x00,0x00,0x01,0xc0,0x00,0x00,0x00,0x01,0xc0,0x01,0xe0,0x00,0x76,0x00,0x3c,0x0f,0x7f,0xc0,0x01,0xff,0x80,0x03,0x00,0x0f,0xc0,0x0f,0xfc,0x78,0x07,0x00,0x00,0x00,0x03,0xc0,0x00,0x0c,0x00,0x01,0xc0,0x00,0xf0,0x00,0x3e,0x00,0xf8,0x1c,0x0f,0xf8,0x00,0x3f,0xf8,0x00,0x00,0x3f,0x00,0x1f,0xff,0xf0,0x0e,0x00,0x00,0x00,0x03,0x80,0x00,0x1e,0x00,0x00,0xe0,0x00,0x70,0x00,0x3e,0x01,0xf0,0x3c,0x01,0xfe,0x00,0x03,0xff,0x00,0x00,0xfc,0x00,0x7e,0x1f,0xe0,0x0e,0x00,0x00,0x00,0x0f,0x80,0x00,0x1e,0x00,0x00,0x70,0x00,0x78,0x00,0x3e,0x07,0xc0,0x7f,0x80,0x3f,0xc0,0x00,0x7f,0xf0,0x03,0xf0,0x01,0xf8,0x03,0xfc,0x0c,0x00,0x00,0x00,0x1f,0x00,0x00,0x3f,0x00,0x00,0x70,0x00,0x78,0x00,0x1e,0x0f,0x80,0xef,0xf0,0x07,0xf8,0x00,0x07,0xfe,0x0f,0xc0,0x07,0xe0,0x00,0x7f,0x9c,0x00,0x00,0x00,0xff,0x00,0x00,0x3f,0x00,0x00,0x38,0x00,0x7c,0x00,0x1e,0x1e,0x00,0x43,0xfc,0x00,0xff,0x00,0x00,0xff,0x3f,0x00,0x1f,0x80,0x00,0x0f,0xdc,0x00,0x00,0xff,0xfe,0x00,0x00,0x7f,0x80,0x00,0x38,0x00,0x7c,0x00,0x1c,0x3c,0x00,0x00,0x7f,0x80,0x3f,0xe0,0x00,0x0f,0xfc,0x00,0x7e,0x00,0x00,0x01,0xf8,0x00,0x3f,0xff,0xfc,0x00,0x00,0x7f,0x80,0x00,0x38,0x00,0x7c,0x00,0x1c,0x3f,0x80,0x00,0x0f,0xf0,0x07,0xfc,0x00,0x01,0xf0,0x01,0xf8,0x00,0x00,0x03,0xf8,0x00,0xff,0xff,0xfc,0x00,0x00,0xff,0xc0,0x00,0x1c,0x00,0x7c,0x00,0x1c,0x3f,0xe0,0x00,0x03,0xfc,0x00,0xff,0x80,0x00,0xc0,0x07,0xe0,0x00,0x00,0x0f,0xf8,0x01,0xff,0xff,0xf8,0x00,0x00,0xff,0xc0,0x00,0x1c,0x00,0x7c,0x00,0x1c,0x3b,0xf8,0x00,0x00,0x7f,0x80,0x1f,0xf0,0x00,0x00,0x1f,0x80,0x00,0x00,0x3f,0xb0,0x03,0xe1,0xff,0xf8,0x00,0x01,0xff,0xe0,0x00,0x0e,0x00,0x78,0x00,0x1c,0x38,0x7f,0x00,0x00,0x0f,0xf0,0x03,0xfe,0x00,0x00,0x7e,0x00,0x00,0x00,0xfe,0x30,0x07,0x83,0xff,0xf0,0x00,0x03,0xff,0xe0,0x00,0x0e,0x00,0x78,0x00,0x1c,0x38,0x1f,0xc0,0x00,0x03,0xfc,0x00,0x7f,0x00,0x01,0xf8,0x00,0x00,0x01,0xf8,0x70,0x0f,0xfb,0xff,0xf0,0x00,0x07,0xff,0xf0,0x00,0x0e,0x00,0xf0,0x00,0x1c,0x38,0x07,0xf0,0x00,0x00,0x7f,0x80,0x1f,0x01,0x03,0xe0,0x00,0x00,0x07,0xe0,0xf0,0x0f,0xff,0xff,0xf0,0x00,0x0f,0xff,0xf0,0x00,0x0e,0x03,0xe0,0x00,0x1c,0x3e,0x00,0xfc,0x00,0x00,0x0f,0xf0,0x0f,0x03,0x0f,0xc0,0x00,0x00,0x1f,0x83,0xf0,0x1c,0x3f,0xff,0xe0,0x00,0x1f,0xff,0xf0,0x00,0x06,0x0f,0xc0,0x00,0x1c,0x1f,0x80,0x3f,0x80,0x00,0x03,0xfc,0x1e,0x07,0x3f,0x00,0x00,0x00,0x3e,0x07,0xf0,0x1c,0x07,0xff,0xe0,0x00,0x7f,0xff,0xf8,0x00,0x07,0x1f,0x80,0x00,0x1c,0x07,0xe0,0x0f,0xe0,0x00,0x00,0x7f,0xbc,0x07,0xfc,0x00,0x00,0x00,0xfc,0x1f,0xf0,0x3f,0x00,0xff,0xc0,0x01,0xff,0xff,0xf8,0x00,0x07,0x7e,0x00,0x00,0x18,0x01,0xf8,0x03,0xf8,0x00,0x00,0x1f,0xf8,0x0e,0xf0,0x00,0x00,0x01,0xf0,0x7f,0xf0,0x3f,0xc0,0x3f,0xe0,0x07,0xff,0xff,0xf8,0x00,0x07,0xf8,0x00,0x00,0x38,0x00,0x7e,0x00,0x7f,0x00,0x00,0x03,0xf0,0x1c,0xc0,0x00,0x00,0x07,0xc0,0xf9,0xf0,0x77,0xf8,0x07,0xfc,0x0f,0xff,0xff,0xf8,0x00,0x07,0xe0,0x00,0x00,0x38,0x00,0x1f,0x80,0x1f,0xc0,0x00,0x00,0x60,0x38,0x00,0x00,0x00,0x1f,0x83,0xe0,0x70,0x61,0xff,0x00,0xff,0x9f,0xff,0xff,0xfc,0x00,0x07,0xc0,0x00,0x00,0x70,0x00,0x1f,0xe0,0x07,0xf0,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x3e,0x0f,0xf0,0xf8,0xe3,0xff,0xc0,0x1f,0xff,0xff,0xff,0xfc,0x00,0x07,0x80,0x00,0x00,0x70,0x00,0x19,0xfc,0x01,0xfe,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0xf8,0x1f,0xfd,0xff,0xff,0x87,0xf8,0x03,0xff,0xff,0xff,0xfc,0x00,0x0f,0x00,0x00,0x00,0xe0,0x00,0x18,0xff,0x00,0x3f,0x80,0x00,0x01,0xe1,0x00,0x00,0x01,0xf0,0x7c,0x7f,0xdf,0xff,0x13,0xff,0x00,0x7f,0xff,0xff,0xfc,0x00,0x0e,0x00,0x00,0x01,0xe0,0x00,0x18,0xdf,0xc0,0x0f,0xe0,0x00,0x03,0xc1,0x00,0x00,0x01,0xe0,0x78,0x0f,0xef,0x9f,0xef,0x3f,0xe0,0x0f,0xff,0xff,0xfc,0x00,0x1c,0x00,0x00,0x03,0xe0,0x00,0x18,0xc3,0xf0,0x01,0xfc,0x00,0x03,0x83,0x00,0x00,0x01,0xf8,0x7f,0x3f,0xfe,0x43,0xfe,0x07,0xf8,0x01,0xff,0xff,0xfc,0x00,0x38,0x00,0x00,0x07,0xe0,0x00,0x18,0xc0,0xfe,0x00,0x7f,0x00,0x07,0x07,0x00,0x00,0x01,0xfe,0x1f,0xf8,0xff,0x07,0xff,0x0f,0xff,0x00,0x3f,0xff,0xfc,0x00,0x38,0x00,0x00,0x1f,0xe0,0x00,0x18,0xc0,0x3f,0x80,0x1f,0xc0,0x0e,0x0f,0x00,0x00,0x01,0x9f,0x87,0xf0,0x7f,0xde,0x3f,0xfe,0x1f,0xe0,0x07,0xff,0xfc,0x00,0x30,0x00,0x00,0xfe,0xc0,0x00,0x18,0xc0,0x0f,0xe0,0x07,0xf8,0x1c,0x1e,0x00,0x00,0x01,0x87,0xe0,0xfc,0xf7,0xfc,0x0f,0xf8,0x0f,0xfc,0x01,0xff,0xf8,0x00,0x70,0x00,0x1f,0xfc,0xc0,0x00,0x18,0xc0,0x03,0xf8,0x00,0xfe,0x38,0x3c,0x00,0x00,0x01,0x81,0xf8,0x3f,0xc1,0xfe,0x3f,0xfe,0x1e,0xff,0x00,0x3f,0xf8,0x00,0x70,0x01,0xff,0xf8,0xc0,0x00,0x18,0xc0,0x00,0xfe,0x00,0x3f,0xf0,0x38,0x00,0x00,0x01,0x80,0x7f,0x0f,0xe0,0x3f,0xf8,0x3f,0xfc,0x1f,0xe0,0x0f,0xf8,0x00,0x60,0x0f,0xff,0xf8,0xc0,0x00,0x18,0xc0,0x00,0x3f,0x80,0x07,0xf0,0x70,0x00,0x00,0x01,0xe0,0x1f,0xc3,0xf8,0x0f,0xf0,0x1f,0xf0,0x7f,0xf8,0x1e,0xff,0x00,0xe0,0x1f,0xff,0xf8,0xc0,0x00,0x18,0xc0,0x00,0xff,0xe0,0x01,0xe0,0xe0,0x00,0x00,0x01,0xf8,0x07,0xf0,0xfe,0x03,0xf8,0x3d,0xfc,0xf0,0xfc,0x3f,0x1f,0xe0,0xe0,0x3e,0x1f,0xf8,0xc0,0x00,0x18,0xc0,0x01,0xe1,0xf8,0x00,0x61,0xc0,0x00,0x00,0x00,0x7e,0x01,0xfc,0x3f,0xc0,0xff,0xf8,0x7f,0xe0,0x3c,0x77,0x07,0xfc,0xe0,0x7f,0x0f,0xf8,0xc0,0x00,0x18,0xc0,0x03,0xc0,0x7f,0x00,0x63,0xc0,0x00,0x00,0x00,0x1f,0x80,0x7f,0x07,0xf0,0x1f,0xe0,0xff,0xe0,0x70,0xf7,0x00,0xff,0xe0,0xff,0x8f,0xf8,0xc0,0x00,0x18,0xc0,0x03,0x80,0x1f,0xc0,0x63,0x80,0x00,0x00,0x00,0x07,0xe0,0x1f,0xc1,0xfc,0x07,0xf1,0xe3,0xfc,0xe1,0xc7,0x00,0x1f,0xe0,0xff,0xcf,0xf0,0xc0,0x00,0x18,0xc0,0x07,0x00,0x07,0xf0,0x67,0x00,0x00,0x00,0x00,0x01,0xf8,0x03,0xf0,0x7f,0x1f,0xff,0xc0,0xff,0xc3,0x87,0x00,0x07,0xe1,0xff,0xcf,0xf0,0xc0,0x00,0x18,0xc0,0x0e,0x00,0x00,0xfc,0x6e,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0xfc,0x1f,0xfc,0x3f,0x80,0x1f,0x87,0x0e,0x00,0x03,0xe1,0xff,0xcf,0xf0,0xc0,0x00,0x18,0xc0,0x0e,0x00,0x00,0x7f,0xfc,0x00,0x00,0x00,0x00,0x00,0x1f,0x80,0x3f,0x03,0xf8,0x1f,0xf0,0x0f,0x0e,0x1e,0x00,0x07,0xf3,0xff,0x9f,0xf1,0xc0,0x00,0x18,0xc0,0x0c,0x00,0x00,0x7f,0xfc,0x00,0x00,0x00,0x00,0x00,0x07,0xe0,0x0f,0xc0,0xfe,0x3d,0xfc,0x1e,0x1c,0x3c,0x00,0x0f,0x7f,0x7f,0x1f,0xf1,0xc0,0x00,0x18,0xc0,0x1c,0x00,0x00,0x73,0xf8,0x00,0x00,0x00,0x00,0x00,0x01,0xf8,0x03,0xf0,0x3f,0xf8,0x7f,0x3c,0x38,0x78,0x00,0x0e,0xbf,0x0e,0x3f,0xe1,0x80,0x00,0x18,0xc0,0x1c,0x00,0x00,0x71,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0xfe,0x0f,0xe0,0x3f,0xf8,0x70,0xf0,0x00,0x1d,0xfc,0x0e,0x3f,0xe3,0x80,0x00,0x18,0xc0,0x18,0x00,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x80,0x3f,0x81,0xfc,0xf3,0xf0,0xe1,0xe0,0x00,0x39,0xf4,0x1c,0x7f,0xe3,0x80,0x00,0x18,0xc0,0x18,0x00,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xe0,0x0f,0xe0,0x7f,0xe1,0xc1,0xc3,0xc0,0x00,0x78,0xef,0xb8,0xff,0xe7,0x00,0x00,0x18,0xc0,0x1c,0x00,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf8,0x03,0xf8,0x1f,0xc7,0x87,0x87,0x80,0x00,0x76,0x0f,0xb8,0xe7,0xff,0x00,0x00,0x18,0xc0,0x1c,0x00,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0xfe,0x07,0xff,0x0f,0x0f,0x00,0x00,0xef,0x83,0x71,0xc0,0xff,0x00,0x00,0x18,0xc0,0x0c,0x00,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x80,0x1f,0x81,0xfe,0x1e,0x1e,0x00,0x01,0xcf,0xb8,0xe3,0x80,0x1f,0xe0,0x00,0x18,0xc0,0x0e,0x00,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xe0,0x07,0xe0,0x3c,0x3c,0x3c,0x00,0x01,0xc3,0xbe,0xe3,0x80,0x07,0xf8,0x00,0x18,0xc0,0x0f,0x00,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf8,0x01,0xf8,0x08,0x78,0x78,0x00,0x03,0xf0,0x3f,0xc7,0x00,0x00,0xff,0x00,0x18,0xc0,0x07,0x80,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x7f,0x00,0xf0,0xf0,0x00,0x01,0xfe,0x0f,0x8e,0x00,0x00,0x1f,0xc0,0x18,0xc0,0x03,0xe0,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x80,0x1f,0xc1,0xe1,0xe0,0x00,0x01,0xff,0xc3,0x8e,0x00,0x00,0x07,0xf8,0x18,0xc0,0x00,0xf0,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xe0,0x07,0xf3,0xc3,0xc0,0x00,0x01,0x8f,0xf7,0x1c,0x00,0x00,0x00,0xfe,0x18,0xc0,0x00,0x78,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf8,0x01,0xff,0x87,0x80,0x00,0x01,0x83,0xfe,0x38,0x00,0x00,0x00,0x3f,0xd8,0xc0,0x00,0x1c,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x3f,0x0f,0x00,0x00,0x01,0xc0,0x7e,0x38,0x00,0x00,0x00,0x07,0xf8,0xc0,0x00,0x0e,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xc0,0x0e,0x1e,0x00,0x00,0x01,0xf8,0x00,0x70,0x00,0x00,0x00,0x01,0xfe,0xc0,0x00,0x07,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xf0,0x0e,0x3c,0x00,0x00,0x00,0xfe,0x00,0xe0,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x07,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xfc,0x0e,0x78,0x00,0x00,0x00,0x3f,0xe1,0xe0,0x00,0x00,0x00,0x00,0x07,0xf0,0x00,0x03,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x0e,0xf0,0x00,0x00,0x00,0x07,0xff,0xc0,0x00,0x00,0x00,0x00,0x01,0xfe,0x00,0x03,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xce,0xe0,0x00,0x00,0x00,0x00,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x3f,0xc0,0x03,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xef,0xc0,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xf0,0x03,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xfe,0x03,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x83,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xc7,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc7,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xce,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xce,0x00,0x71,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xdc,0x00,0x71,0x80,0x00};
-
-
-
-const uint8_t  octo3[] =  {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xfc,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x9c,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x9c,0x00,0x00,0x01,0xff,0x00,0x00,0x00,0x0f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x00,0x00,0x03,0x9c,0x00,0x00,0x03,0xc7,0x80,0x00,0x00,0x7f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0xe3,0xd0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xc0,0x00,0x03,0xfc,0x00,0x00,0x03,0x83,0x80,0x00,0x03,0xff,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0xe1,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xff,0xf8,0x00,0x03,0xfc,0x00,0x00,0x03,0x81,0xc0,0x00,0x1f,0xff,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0xe1,0xc0,0x00,0x00,0x00,0x0f,0xfe,0x00,0x07,0xfc,0x07,0xfe,0x00,0x01,0xf8,0x00,0x00,0x03,0x81,0xc0,0x0f,0xff,0xe0,0x0f,0xfc,0x00,0x00,0x00,0x00,0x00,0xe1,0xc0,0x00,0x00,0x00,0x7f,0xff,0xc0,0x1f,0xe0,0x00,0x7f,0xc0,0x00,0xf0,0x00,0x00,0x07,0x81,0xc0,0x0f,0xff,0x00,0x01,0xff,0x00,0x00,0x00,0x00,0x00,0xe1,0xc0,0x00,0x00,0x01,0xff,0xff,0xf0,0x1f,0x00,0x00,0x1f,0xf0,0x00,0x00,0x00,0x00,0x03,0x81,0xc0,0x07,0xf8,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0xe3,0xc0,0x00,0x00,0x07,0xfc,0x07,0xfe,0x0c,0x00,0x00,0x07,0xfe,0x00,0x00,0x00,0x00,0x03,0x83,0xc0,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0xff,0x80,0x00,0x00,0x1f,0xe0,0x00,0xff,0x00,0x00,0x00,0x03,0xff,0xe0,0x00,0x02,0x00,0x03,0xc3,0x80,0x00,0x00,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x00,0x7f,0x80,0x00,0x00,0xff,0x80,0x00,0x3f,0x00,0x00,0x00,0x03,0x1f,0xff,0x00,0x3f,0x00,0x01,0xef,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x0f,0xfe,0x00,0x00,0x07,0x00,0x00,0x00,0x03,0x83,0xff,0xff,0xff,0x00,0x01,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x7f,0xff,0xff,0x00,0x00,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x07,0xff,0xf8,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfe,0x00,0x1f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xe0,0x00,0x03,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x7f,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0x1f,0x80,0x00,0x07,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf0,0x00,0x00,0x00,0x07,0xe0,0x00,0x0f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x01,0xf0,0x00,0x0f,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0xf8,0x00,0x0e,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x01,0xee,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x0e,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x01,0xce,0x00,0x00,0x07,0x80,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x0e,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x01,0xce,0x00,0x00,0x0f,0xc0,0x00,0x00,0x3c,0x00,0x0e,0x00,0x00,0x00,0x0f,0x00,0x0f,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x01,0xfe,0x00,0x00,0x1f,0xe0,0x00,0x00,0x78,0x00,0x3f,0x80,0x00,0x00,0x07,0x80,0x07,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0xfe,0x00,0x00,0x1f,0xe0,0x00,0x00,0xf0,0x00,0x7f,0xc0,0x00,0x00,0x07,0x80,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x7c,0x00,0x00,0x1c,0xe0,0x00,0x01,0xe0,0x00,0x7f,0xc0,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x38,0x00,0x00,0x1c,0x60,0x00,0x01,0xe0,0x00,0xf1,0xe0,0x00,0x00,0x01,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0xe0,0x00,0x03,0xc0,0x00,0xe0,0xe0,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x7f,0x00,0xe0,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xe0,0x00,0x03,0x80,0x01,0xe0,0xf0,0x00,0x00,0x00,0xf0,0x00,0x00,0x01,0xff,0xc1,0xe0,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0x07,0x80,0x01,0xc0,0x70,0x00,0x00,0x00,0x78,0x00,0x00,0x03,0xff,0xf3,0xe0,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xc0,0x00,0x0f,0x00,0x01,0xce,0x70,0x00,0x00,0x00,0x38,0x00,0x00,0x07,0xf3,0xff,0xe0,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x00,0x0e,0x00,0x01,0xde,0x70,0x00,0x00,0x00,0x3c,0x00,0x00,0x0f,0x70,0x7f,0xe0,0x00,0x00,0x00,0x00,0x7f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x03,0x9e,0x70,0x00,0x00,0x00,0x1c,0x00,0x00,0x1e,0x70,0x3e,0xe0,0x00,0x00,0x00,0x00,0xff,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x03,0x9e,0x70,0x00,0x00,0x00,0x1e,0x00,0x00,0x3c,0x70,0x1c,0xe0,0x00,0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x03,0x9e,0x70,0x00,0x00,0x00,0x0e,0x00,0x00,0x7b,0x70,0x08,0xe0,0x00,0x00,0x00,0x00,0xe0,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x03,0xbe,0x70,0x00,0x00,0x00,0x0e,0x00,0x00,0x77,0x70,0x00,0xe0,0x00,0x00,0x00,0x00,0xe0,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x03,0xbe,0xf0,0x00,0x00,0x00,0x0f,0x00,0x00,0x7a,0x70,0x0c,0xe0,0x00,0x00,0x00,0x00,0xe0,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x03,0xbe,0xe0,0x00,0x00,0x00,0x07,0x00,0x00,0x38,0x70,0x1e,0xe0,0x00,0x00,0x00,0x00,0xf8,0x07,0x00,0x00,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0x70,0x00,0x03,0xbc,0xe0,0x00,0x00,0x00,0x07,0x00,0x00,0x3e,0x70,0x3f,0xe0,0x00,0x00,0x00,0x00,0xff,0xfe,0x00,0x00,0x00,0x00,0xff,0xfe,0x00,0x00,0x00,0x70,0x00,0x03,0x9c,0xe0,0x00,0x00,0x00,0x03,0x80,0x00,0x1f,0x70,0xff,0xe0,0x00,0x00,0x00,0x00,0xff,0xfe,0x00,0x00,0x00,0xff,0xff,0xff,0x00,0x00,0x00,0xf0,0x00,0x03,0x98,0xe0,0x00,0x00,0x00,0x03,0x80,0x00,0x0f,0xf3,0xf3,0xe0,0x00,0x00,0x00,0x00,0xff,0xfe,0x00,0x00,0x1f,0xff,0xff,0xff,0x80,0x00,0x00,0xe0,0x00,0x01,0xc1,0xc0,0x00,0x00,0x00,0x03,0x80,0x00,0x07,0xff,0xe1,0xe0,0x00,0x00,0x00,0x00,0xc0,0xfe,0x00,0x00,0x3f,0xff,0xf0,0x03,0x80,0x00,0x00,0xe0,0x00,0x01,0xc1,0xc0,0x00,0x00,0x00,0x03,0xc0,0x00,0x01,0xff,0xc0,0xe0,0x00,0x00,0x00,0x00,0xc0,0x0e,0x00,0x00,0x7f,0xf8,0x00,0x03,0x80,0x00,0x00,0xe0,0x00,0x01,0xe3,0xc0,0x00,0x00,0x00,0x01,0xc0,0x00,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x01,0xc0,0x0e,0x00,0x00,0xf8,0x00,0x00,0x03,0x80,0x00,0x01,0xc0,0x00,0x00,0xff,0x80,0x00,0x00,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc0,0x0e,0x00,0x00,0xe0,0x00,0x1f,0xf3,0x80,0x00,0x01,0xc0,0x00,0x00,0xff,0x00,0x00,0x00,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc0,0x0e,0x00,0x00,0xe0,0x1f,0xff,0xfb,0x80,0x00,0x01,0xc0,0x00,0x00,0x7e,0x00,0x00,0x00,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc0,0x0e,0x00,0x00,0xe3,0xff,0xff,0xfb,0x80,0x00,0x01,0xc0,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc0,0x0e,0x00,0x00,0xe7,0xff,0xfe,0x3b,0x80,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc0,0x1c,0x00,0x00,0xe7,0xff,0x00,0x3b,0x80,0x00,0x03,0xc0,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc0,0x1c,0x00,0x00,0xe7,0x00,0x00,0x39,0xc0,0x00,0x03,0x80,0x00,0x70,0x00,0x30,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc0,0x1c,0x00,0x00,0xe7,0x00,0x00,0x39,0xc0,0x00,0x03,0x9f,0xff,0x70,0x00,0x38,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x01,0xc0,0x1c,0x00,0x00,0xe7,0x00,0x00,0x39,0xc0,0x00,0x03,0x9f,0xff,0xf0,0x00,0x38,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x01,0xc0,0x1c,0x00,0x00,0xe7,0x00,0x00,0x39,0xc0,0x00,0x03,0x8f,0xff,0xe0,0x00,0x3f,0xff,0x80,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x01,0xc0,0x1c,0x00,0x00,0x77,0x00,0x00,0x1d,0xc0,0x00,0x03,0x8e,0x3f,0xe0,0x00,0x1f,0xff,0xf0,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xef,0x01,0xfc,0x1c,0x00,0x00,0x77,0x00,0x00,0x1d,0xc0,0x00,0x03,0x8e,0x00,0xe0,0x00,0x1f,0xff,0xf0,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x01,0xff,0xfc,0x00,0x00,0x77,0x00,0x00,0x1d,0xc0,0x00,0x03,0x9c,0x00,0xe0,0x00,0x1c,0x1f,0xf0,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0xff,0xf8,0x00,0x00,0x77,0x00,0x00,0x1d,0xc0,0x00,0x03,0x9c,0x10,0xe0,0x00,0x38,0x00,0xe0,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe7,0x00,0x3f,0xf0,0x00,0x00,0x77,0x00,0x00,0x1d,0xc0,0x00,0x03,0x9c,0x38,0xe0,0x00,0x38,0x00,0xe0,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x00,0x00,0x20,0x00,0x00,0x77,0x00,0x00,0x1d,0xc0,0x00,0x03,0x9c,0x7c,0xe0,0x00,0x3b,0xc0,0xe0,0x00,0x00,0xe0,0x18,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,0x00,0x00,0x77,0x00,0x00,0x1d,0xc0,0x00,0x03,0x9c,0xfc,0xe0,0x00,0x3f,0xe0,0xe0,0x00,0x00,0xe0,0x7e,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0x77,0x80,0x00,0x1d,0xc0,0x00,0x03,0x9e,0xfe,0xe0,0x00,0x3f,0xe0,0xe0,0x00,0x01,0xe0,0x7e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x80,0x00,0x1c,0xe0,0x00,0x03,0x8e,0xff,0xe0,0x00,0x3f,0xe0,0xe0,0x00,0x01,0xc0,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x80,0x00,0x1c,0xe0,0x00,0x03,0x8e,0xff,0xc0,0x00,0x3f,0xe0,0xe0,0x00,0x01,0xc0,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0x80,0x00,0x1c,0xe0,0x00,0x03,0x8f,0xff,0xc0,0x00,0x3f,0xe0,0xe0,0x00,0x01,0xc0,0xe7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7b,0x80,0x00,0x1d,0xe0,0x00,0x03,0x87,0xff,0x80,0x00,0x3f,0xe1,0xc0,0x00,0x01,0xc0,0x7e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x80,0x00,0x0f,0xf0,0x00,0x01,0xc3,0xff,0x00,0x00,0x1f,0xe1,0xc0,0x00,0x01,0xc0,0x7e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x80,0x00,0x0f,0xf8,0x00,0x01,0xc1,0xfe,0x00,0x00,0x1f,0xe3,0xc0,0x00,0x01,0xc0,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x80,0x00,0x0f,0xfc,0x00,0x01,0xc0,0xfc,0x00,0x00,0x0f,0xcf,0x80,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3b,0x80,0x00,0x0f,0x3e,0x00,0x01,0xc0,0x00,0x00,0x00,0x07,0xff,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xe0,0x00,0x00,0x3b,0x80,0x00,0x0f,0x1e,0x00,0x01,0xc0,0x00,0x00,0x00,0x03,0xfe,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xf8,0x00,0x00,0x3b,0x80,0x00,0x0f,0x0f,0x00,0x01,0xc0,0x00,0x00,0x00,0x01,0xfc,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x1f,0xfe,0x00,0x00,0x3b,0x80,0x00,0x0f,0x87,0x00,0x01,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x7f,0xff,0x00,0x00,0x3b,0x80,0x00,0x0f,0x87,0x80,0x00,0xe0,0x00,0x07,0xe0,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xf0,0xfe,0x0f,0x80,0x00,0x39,0xc0,0x00,0x0f,0xc3,0x80,0x00,0xe0,0x00,0x1f,0xf8,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xf1,0xf0,0x1f,0xc0,0x00,0x39,0xc0,0x00,0x0f,0xc3,0x80,0x00,0xe0,0x00,0x3f,0xfe,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xfb,0xe0,0x1d,0xe0,0x00,0x39,0xc0,0x00,0x0e,0xe3,0x80,0x00,0xe0,0x00,0x7f,0xff,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xbf,0x80,0x1c,0xf0,0x00,0x39,0xc0,0x00,0x0e,0xeb,0x80,0x00,0xe0,0x00,0x78,0x0f,0x80,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x9f,0x80,0x1c,0x78,0x00,0x1d,0xc0,0x00,0x0e,0xe3,0x80,0x00,0xe0,0x00,0xf0,0x07,0x80,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x8f,0x00,0x39,0xb8,0x00,0x1d,0xc0,0x00,0x07,0x73,0x80,0x00,0xe0,0x00,0xe0,0x03,0xc0,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x86,0x00,0x39,0xdc,0x00,0x1d,0xc0,0x00,0x07,0x73,0x80,0x00,0xe0,0x00,0x60,0x01,0xe0,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x39,0x9c,0x00,0x1d,0xc0,0x00,0x07,0x73,0x80,0x00,0xe0,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x8e,0x00,0x38,0x3c,0x00,0x1d,0xc0,0x00,0x07,0x73,0x80,0x00,0xe0,0x00,0x00,0x00,0xc0,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x0f,0xf0,0x00,0x00,0x03,0x8f,0x00,0x3c,0x3c,0x00,0x1d,0xc0,0x00,0x07,0x73,0x80,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x07,0xff,0xf8,0x00,0x00,0x03,0x9f,0xc0,0x1c,0xf8,0x00,0x1d,0xc0,0x00,0x07,0x77,0x80,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x01,0xff,0xff,0xf8,0x00,0x00,0x03,0xbf,0xe0,0x1d,0xf0,0x00,0x1d,0xc0,0x00,0x7f,0x77,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0xff,0xff,0xff,0x38,0x00,0x00,0x03,0xf9,0xfc,0x1f,0xe0,0x00,0x1c,0xe0,0x7f,0xff,0x77,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x3f,0xff,0xff,0x80,0x38,0x00,0x00,0x03,0xf0,0xff,0xff,0xc0,0x00,0x1c,0xff,0xff,0xfe,0x7e,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc0,0x0f,0xff,0xff,0xe0,0x00,0x38,0x00,0x00,0x07,0xe0,0x3f,0xff,0x00,0x00,0x1c,0xff,0xff,0xfc,0x7e,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc0,0xff,0xff,0xf0,0x00,0x00,0x78,0x00,0x00,0x07,0xc0,0x0f,0xfc,0x00,0x00,0x1c,0xff,0xfc,0x00,0x3c,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc1,0xff,0xfc,0x00,0x00,0x00,0x70,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x0e,0x7e,0x00,0x00,0x38,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x83,0xfe,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x3e,0x00,0x38,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x83,0xc0,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x7e,0x00,0x78,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x83,0x80,0x00,0x00,0x00,0x00,0x70,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x7e,0x00,0xf0,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc7,0x80,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x20,0xff,0xf0,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc7,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0xff,0xff,0xe0,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xe7,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x7f,0xff,0xff,0xc0,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf7,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xfc,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x00,0x01,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf8,0x1c,0x00,0x07,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0x1c,0x00,0x0f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x00,0x1c,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x40,0x1e,0x00,0x00,0x00,0x00,0x01,0xc0,0x00,0x00,0x00,0x01,0x80,0x00,0x00,0x00,0x00,0x1c,0x00,0x1c,0x00,0xfe,0x00,0x40,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x0e,0x00,0x00,0x00,0x00,0x01,0xc0,0x00,0x00,0x00,0x01,0xc0,0x00,0x00,0x00,0x00,0x1c,0x00,0x0e,0x07,0xf8,0x00,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0x1c,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x01,0xc0,0x00,0x00,0xf0,0x00,0x1c,0x00,0x0f,0xff,0xe0,0x01,0xe0,0x00,0x1f,0xf0,0x00,0x00,0x00,0x60,0x1c,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x01,0xe0,0x00,0x01,0xf8,0x00,0x1c,0x00,0x07,0xff,0xc0,0x03,0xc0,0x00,0x7f,0xfc,0x00,0x0c,0x00,0x70,0x1c,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x01,0xe0,0x00,0x01,0xf8,0x00,0x1c,0x00,0x07,0xfe,0x00,0x07,0x80,0x00,0xff,0xfe,0x00,0x0e,0x00,0x70,0x1c,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x01,0xf0,0x00,0x03,0x9c,0x00,0x1c,0x00,0x01,0xf0,0x00,0x07,0x80,0x01,0xf8,0x3f,0x80,0x0e,0x00,0x70,0x38,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x01,0xf0,0x00,0x03,0x9c,0x00,0x1c,0x00,0x00,0x00,0x00,0x0f,0x00,0x07,0xe0,0x07,0xc0,0x0e,0x00,0x38,0x38,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x01,0xf0,0x00,0x03,0xf8,0x00,0x1c,0x00,0x00,0x00,0x00,0x1e,0x00,0x0f,0x80,0x03,0xc0,0x0e,0x00,0x38,0x38,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x01,0xf8,0x00,0x01,0xf8,0x00,0x1c,0x00,0x00,0x00,0x00,0x3c,0x00,0x1f,0x00,0x01,0xe0,0x06,0x00,0x1c,0x38,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x01,0xf8,0x06,0x01,0xf8,0x00,0x1c,0x00,0x00,0x00,0x00,0x38,0x00,0x1e,0x00,0x00,0xf0,0x07,0x00,0x1c,0x70,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x01,0xf8,0x07,0x00,0xe0,0x00,0x0e,0x00,0x00,0x00,0x00,0x78,0x00,0x3c,0x00,0x00,0x78,0x07,0x00,0x0e,0x70,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x03,0xb8,0x07,0x80,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0xf0,0x00,0x78,0x00,0x00,0x38,0x07,0x00,0x0f,0x70,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x03,0xb8,0x07,0x80,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0xe0,0x00,0xf0,0x00,0x00,0x3c,0x07,0x00,0x0f,0xf0,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x07,0xb8,0x07,0xc0,0x00,0x00,0x07,0x00,0x00,0x00,0x01,0xe0,0x00,0xe0,0x00,0x00,0x1c,0x07,0x01,0xff,0xf0,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x07,0x38,0x07,0xc0,0x00,0x00,0x07,0x00,0x00,0x00,0x03,0xc0,0x01,0xe0,0x00,0x00,0x1e,0x07,0x1f,0xff,0xe0,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x07,0x38,0x07,0xc0,0x00,0x00,0x03,0x80,0x00,0x00,0x03,0x80,0x03,0xc0,0x00,0x00,0x0e,0x03,0xff,0xfe,0xe0,0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x0e,0x78,0x07,0xe0,0x00,0x00,0x03,0xc0,0x00,0x00,0x07,0x80,0x03,0x80,0x01,0xf0,0x0e,0x3f,0xff,0xc0,0xe0,0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x0e,0x70,0x07,0xe0,0x00,0x00,0x01,0xe0,0x00,0x00,0x07,0x00,0x07,0x80,0x07,0xfc,0x07,0xff,0xf8,0x01,0xe0,0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x1c,0x70,0x07,0xe0,0x00,0x00,0x00,0xf0,0x00,0x00,0x0f,0x00,0x07,0x00,0x0f,0xfe,0x07,0xff,0x80,0x0f,0xc0,0x00,0x00,0x00,0x00,0x1c,0x00,0x00,0x00,0x00,0x1c,0xf0,0x0f,0xe0,0x00,0x00,0x00,0xf8,0x00,0x00,0x0e,0x00,0x0f,0x00,0x1f,0x1f,0x07,0xf8,0x00,0xff,0xc0,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x3c,0xe0,0x0e,0xe0,0x00,0x00,0x00,0x7e,0x00,0x00,0x1e,0x00,0x0e,0x00,0x1e,0x3f,0x83,0x80,0x0f,0xff,0xc0,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x38,0xe0,0x0e,0xe0,0x00,0x00,0x00,0x3f,0x00,0x00,0x1c,0x00,0x1e,0x00,0x3c,0x7f,0x83,0xc0,0x7f,0xf9,0xc0,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x79,0xc0,0x1e,0xe0,0x00,0x00,0x00,0x1f,0xe0,0x00,0x3c,0x00,0x1c,0x00,0x38,0xff,0xc1,0xe3,0xff,0xc3,0x80,0x00,0x00,0x00,0x00,0x38,0x07,0x80,0x00,0x00,0x71,0xc0,0x1c,0xe0,0x00,0x40,0x00,0x07,0xfe,0x07,0xf8,0x00,0x38,0x00,0x78,0xf9,0xf0,0xe7,0xff,0xc3,0x80,0x00,0x00,0x00,0x00,0x78,0x0f,0xc0,0x00,0x00,0x73,0xc0,0x39,0xe0,0x01,0xf8,0x00,0x01,0xff,0xff,0xf8,0x00,0x78,0x00,0x78,0xfe,0xff,0xe7,0xe3,0xff,0x80,0x00,0x00,0x00,0x00,0x70,0x1f,0xe0,0x00,0x00,0x73,0x80,0x39,0xc0,0x01,0xff,0x00,0x00,0x7f,0xff,0xf8,0x00,0x70,0x00,0xf0,0xff,0x7f,0xe3,0xe1,0xff,0x80,0x00,0x00,0x00,0x00,0x70,0x3c,0xe0,0x00,0x00,0xe3,0x80,0x71,0xc0,0x03,0xff,0xc0,0x00,0x0f,0xff,0x70,0x00,0xf0,0x00,0xf0,0xe7,0xdf,0xc1,0xff,0xff,0x00,0x00,0x00,0x00,0x01,0xf0,0x38,0x70,0x00,0x00,0xe3,0x80,0x73,0xc0,0x03,0x8f,0xf0,0x00,0x00,0x00,0x70,0x01,0xe0,0x01,0xf0,0x7b,0xf7,0x80,0x7f,0xff,0x00,0x00,0x00,0x00,0x0f,0xe0,0x38,0x70,0x00,0x00,0xe7,0x00,0xe3,0x80,0x07,0x03,0xfe,0x00,0x00,0x00,0xe0,0x03,0xc0,0x01,0xf0,0x7c,0xf8,0x00,0x3f,0xdf,0x00,0x00,0x00,0x00,0xff,0xe0,0x38,0x70,0x00,0x00,0xe7,0x00,0xe3,0x80,0x07,0x00,0xff,0x80,0x00,0x00,0xe0,0x07,0xc0,0x01,0xf0,0x3f,0x7e,0x00,0x0f,0x8f,0x00,0x00,0x00,0x07,0xff,0x80,0x3c,0xf0,0x00,0x00,0xe7,0x00,0xe7,0x80,0x07,0x30,0x1f,0xc0,0x00,0x00,0xe0,0x0f,0x80,0x03,0xf0,0x0f,0xdf,0x80,0x07,0xce,0x00,0x00,0x00,0x7f,0xfc,0x00,0x1f,0xe0,0x00,0x00,0xe7,0x00,0xe7,0x00,0x0e,0x7e,0x07,0xe0,0x00,0x00,0xe0,0x1f,0x00,0x03,0xf0,0x07,0xef,0xc0,0x03,0xfe,0x00,0x00,0x03,0xff,0xc0,0x00,0x1f,0xe0,0x00,0x00,0xe7,0x01,0xc7,0x00,0x0e,0x7f,0x81,0xe0,0x00,0x01,0xe0,0x3e,0x00,0x07,0xf0,0x01,0xfb,0xf0,0x00,0xfe,0x00,0x00,0x1f,0xfe,0x00,0x00,0x0f,0xc0,0x00,0x00,0xe7,0x81,0xc7,0x00,0x0e,0x7f,0xf0,0x60,0x00,0x01,0xc0,0x38,0x00,0x07,0x70,0x00,0x7c,0xfc,0x00,0x7e,0x00,0x00,0xff,0xe0,0x00,0x00,0x03,0x00,0x00,0x00,0xe3,0x81,0xc7,0x00,0x0e,0x3f,0xf8,0x70,0x00,0x01,0xc0,0x30,0x00,0x07,0x70,0x00,0x7f,0x7e,0x00,0x3c,0x00,0x0f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf3,0x81,0xc7,0x00,0x0c,0x0f,0xfc,0xe0,0x00,0x01,0xc0,0x00,0x00,0x0f,0x70,0x00,0xef,0xdf,0x80,0x1c,0x00,0x7f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x73,0xc1,0xc7,0x00,0x00,0x03,0xfc,0xe0,0x00,0x01,0xc0,0x00,0x00,0x0e,0x70,0x00,0xe7,0xe7,0xe0,0x1c,0x03,0xff,0xc7,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0xc1,0xc7,0x00,0x00,0x00,0xfc,0xe0,0x00,0x01,0xc0,0x00,0x00,0x0e,0x70,0x00,0xe1,0xfb,0xf0,0x1c,0x3f,0xfe,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x71,0xe1,0xc7,0x00,0x00,0x00,0x3c,0xe0,0x00,0x01,0xc0,0x00,0x00,0x1c,0x70,0x00,0x60,0xfc,0xfc,0x39,0xff,0xe0,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xe0,0xe7,0x00,0x00,0x00,0x01,0xe0,0x00,0x01,0xc0,0x00,0x00,0x1c,0x78,0x00,0x70,0x3f,0x7f,0x3f,0xff,0xc0,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0xf0,0xe7,0x80,0x00,0x00,0x01,0xc0,0x00,0x01,0xc0,0x00,0x00,0x3c,0x38,0x00,0x70,0x0f,0x9f,0xff,0xf1,0xc0,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x70,0xe3,0x80,0x00,0x00,0x01,0xc0,0x00,0x01,0xc0,0x00,0x00,0x38,0x38,0x00,0x70,0x07,0xe7,0xff,0x83,0x80,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1c,0x70,0x73,0x80,0x00,0x00,0x01,0xc0,0x00,0x01,0xc0,0x00,0x00,0x78,0x38,0x00,0x70,0x07,0xfb,0xf8,0x03,0x80,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x38,0x73,0xc0,0x0c,0x00,0x03,0x80,0x00,0x01,0xc0,0x00,0x00,0x70,0x3c,0x00,0x38,0x07,0x7c,0x70,0x07,0x80,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x38,0x71,0xc0,0x0e,0x00,0x01,0x80,0x00,0x01,0xc0,0x00,0x00,0xf0,0x1c,0x00,0x38,0x07,0x3f,0xf0,0x07,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x38,0x39,0xc0,0x1e,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x01,0xe0,0x1c,0x00,0x38,0x07,0x0f,0xf0,0x0f,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x38,0x39,0xc0,0x3c,0x00,0x00,0x00,0x00,0x00,0xe0,0x00,0x01,0xc0,0x1e,0x00,0x1c,0x03,0x87,0xe0,0x0e,0x00,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x38,0x39,0xc0,0x3c,0x00,0x00,0x00,0x3c,0x00,0xf0,0x00,0x03,0xc0,0x1e,0x00,0x1c,0x03,0x81,0x80,0x1c,0x01,0xf0,0x00,0x01,0x80,0x00,0x00,0x00,0x00,0x07,0x18,0x39,0xc0,0x7c,0x00,0x00,0x00,0x7e,0x00,0x70,0x00,0x07,0x80,0x1e,0x00,0x1c,0x03,0x80,0x00,0x3c,0x03,0xe0,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x07,0x18,0x39,0xc0,0x78,0x00,0x00,0x00,0xff,0x00,0x78,0x00,0x0f,0x00,0x1f,0x00,0x0e,0x01,0xc0,0x00,0x38,0x0f,0xc0,0x7e,0x0f,0xc0,0x00,0x00,0x00,0x00,0x07,0x38,0x39,0xc0,0xf8,0x00,0x00,0x00,0xe7,0x80,0x3c,0x00,0x3f,0x00,0x1f,0x00,0x0e,0x01,0xe0,0x00,0x78,0x7f,0x81,0xff,0x9f,0x80,0x00,0x00,0xff,0x00,0x07,0x38,0x39,0xc0,0xf8,0x00,0x00,0x01,0xc3,0x80,0x1f,0x00,0xff,0x00,0x3f,0x80,0x0e,0x00,0xe0,0x00,0xff,0xff,0x03,0xff,0xff,0x80,0x00,0x00,0xff,0xfe,0x07,0x38,0x39,0xc0,0xf8,0x00,0x00,0x01,0xc3,0x80,0x0f,0xff,0xff,0x00,0x3b,0x80,0x0e,0x00,0xf0,0x01,0xff,0xfc,0x07,0xe7,0xfb,0x80,0x00,0x00,0xff,0xff,0xe7,0x38,0x39,0xc1,0xf8,0x00,0x00,0x01,0xc3,0x80,0x07,0xff,0xf7,0x00,0x39,0xc0,0x07,0x00,0x78,0x03,0xff,0xf0,0x0f,0x00,0xf3,0x80,0x00,0x00,0xff,0xff,0xff,0x38,0x3b,0xc1,0xf8,0x00,0x00,0x01,0xe3,0x80,0x03,0xff,0xcf,0x00,0x39,0xe0,0x07,0x00,0x3f,0x0f,0x80,0x00,0x1e,0x80,0x77,0x80,0x00,0x00,0x00,0x0f,0xfe,0x70,0x73,0x81,0xf8,0x00,0x00,0x00,0xff,0x00,0x00,0x7f,0x0e,0x00,0x78,0xe0,0x07,0x00,0x1f,0xff,0x00,0x00,0x1d,0xc0,0x07,0x00,0x00,0x00,0x00,0x00,0x7e,0x78,0x73,0x81,0xf8,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0x0e,0x00,0x70,0xf0,0x07,0x00,0x0f,0xfe,0x00,0x00,0x1d,0xc0,0x07,0x00,0x00,0x00,0x00,0x00,0x0e,0x7f,0x77,0x81,0xdc,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,0x1e,0x00,0x70,0x70,0x07,0x00,0x03,0xf8,0x00,0x00,0x1c,0x00,0x77,0x00,0x00,0x00,0x00,0x00,0x1c,0x7f,0xe7,0x01,0xdc,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x1c,0x00,0xf0,0x70,0x07,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0xf3,0x00,0x00,0x00,0x00,0x00,0x1c,0xef,0xe7,0x00,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0xe0,0x38,0x07,0x00,0x00,0x00,0x00,0x00,0x0f,0x81,0xfb,0x80,0x00,0x00,0x00,0x00,0x1c,0xe3,0xe7,0x00,0xee,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x01,0xe0,0x38,0x07,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0x80,0x00,0x00,0x00,0x00,0x1c,0xe0,0xcf,0x80,0xee,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf0,0x03,0xc0,0x38,0x07,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0x9f,0x80,0x00,0x3f,0x00,0x00,0x1c,0xe1,0xcf,0xc0,0xee,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xe0,0x03,0x80,0x1c,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x0f,0x80,0x1f,0xff,0x00,0x00,0x1c,0xe1,0xcf,0xf0,0xee,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xc0,0x07,0x80,0x1c,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x07,0x81,0xff,0xff,0x00,0x00,0x1c,0xe1,0xce,0xfe,0xee,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x0f,0x00,0x1c,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xff,0x00,0x00,0x1c,0xe1,0xce,0x7f,0xee,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x1e,0x00,0x1c,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xfc,0x00,0x00,0x00,0x1c,0xe1,0xce,0x1f,0xdc,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x00,0x7c,0x00,0x1c,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0x80,0x00,0x00,0x00,0x1e,0xe1,0xce,0x07,0xdc,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x03,0xf8,0x00,0x1c,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf8,0x00,0x00,0x00,0x00,0x0e,0x70,0xe7,0x03,0xbe,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf0,0x00,0x38,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xc0,0x00,0x00,0x00,0x00,0x0e,0x70,0xe7,0x03,0xbf,0xc0,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xc0,0x00,0x38,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xfe,0x00,0x00,0x00,0x00,0x00,0x07,0x70,0xe7,0x07,0x7f,0xf0,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x00,0x00,0x38,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xf8,0x00,0x00,0x00,0x00,0x00,0x07,0x38,0x77,0x07,0x73,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x00,0x00,0x70,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,0x00,0x07,0xb8,0x77,0x07,0x70,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xb8,0x77,0x07,0x70,0x1f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xe0,0xf0,0x00,0x00,0x00,0x00,0x00,0x03,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xb8,0x73,0x07,0x70,0x07,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xe1,0xf0,0x00,0x00,0x00,0x00,0x00,0x1f,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xb8,0x3b,0x07,0x70,0x00,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xc7,0xe0,0x00,0x00,0x00,0x00,0x00,0x7f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x98,0x3b,0x07,0x70,0x00,0x1f,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xc0,0x00,0x00,0x00,0x00,0x01,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x98,0x3f,0x03,0x70,0x00,0x03,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x00,0x00,0x00,0x00,0x00,0x0f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x37,0x03,0xf0,0x00,0x00,0x3f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0x00,0x00,0x3f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x03,0xb0,0x00,0x00,0x07,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x7f,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-
-const uint8_t  octo4[] = {0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x03,0x80,0x00,0x00,0x00,0x00,0x03,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x03,0x80,0x00,0x00,0x00,0x00,0x03,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x03,0x80,0x00,0x00,0x1f,0x00,0x03,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x03,0x80,0x00,0x00,0x3f,0x80,0x03,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x03,0x80,0x00,0x00,0x7f,0x80,0x03,0x87,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x03,0x80,0x00,0x00,0x73,0x80,0x03,0x87,0x00,0x01,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x00,0x00,0x00,0xff,0xff,0xff,0x80,0x03,0x83,0xff,0xf8,0x73,0x80,0x03,0x87,0x00,0x01,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x80,0x03,0x83,0xff,0xf8,0x7f,0xff,0xff,0x87,0x00,0x03,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x3e,0x17,0x80,0x03,0x83,0x80,0x38,0x7f,0xff,0xff,0x87,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xff,0x00,0x00,0x07,0x80,0x03,0x83,0x80,0x38,0x7f,0xff,0xff,0x87,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x03,0x83,0x80,0x38,0x70,0x00,0x03,0x87,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf0,0x03,0xc7,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x03,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x03,0xcf,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x03,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x03,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x03,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x03,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x03,0xcf,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xfc,0x03,0xcf,0x00,0x00,0x01,0xf0,0x00,0x00,0x00,0x01,0xe0,0x00,0x00,0x00,0x0f,0x80,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf8,0x03,0xcf,0x00,0x00,0x03,0xf8,0x00,0x00,0x1f,0xff,0xf0,0x00,0x00,0x00,0x1f,0xc0,0x00,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xff,0xf0,0x03,0xcf,0x00,0xff,0xff,0xf8,0x00,0x00,0x1f,0xff,0xff,0xfe,0x00,0x00,0x1f,0xc0,0x00,0x00,0x07,0x0e,0x03,0x87,0x1c,0xe3,0x9e,0x07,0x1e,0x00,0x00,0x00,0x03,0xcf,0x00,0xff,0xff,0xf8,0x00,0x00,0x1d,0xff,0xff,0xfe,0x00,0x7f,0x1d,0xc0,0x00,0x00,0x07,0x0e,0x03,0x87,0x1c,0xe7,0x9e,0x07,0x1e,0x00,0x00,0x00,0x03,0xcf,0x00,0x07,0xff,0xf8,0x1f,0x00,0x1c,0x03,0xf1,0xfe,0x00,0xff,0xff,0xff,0xe0,0x00,0x07,0x0e,0x03,0x87,0x1c,0xe7,0x9e,0x07,0x1e,0x00,0x00,0x00,0x03,0xcf,0x00,0x00,0x01,0xe3,0xff,0x00,0x1c,0x03,0xe0,0x0e,0x00,0xff,0xff,0xff,0xf0,0x00,0x07,0x0e,0x03,0x87,0x1c,0xe7,0x9e,0x07,0x1e,0x00,0x00,0x00,0x03,0xcf,0x00,0x00,0x00,0xef,0xff,0x80,0x1c,0x00,0xc0,0x0e,0x00,0xe0,0x0f,0xff,0xf0,0x00,0x07,0x0e,0x03,0x87,0x1c,0xe7,0x9e,0x07,0x1e,0x00,0x00,0x00,0x03,0xcf,0x00,0xff,0xc0,0xef,0xff,0x80,0x1c,0x40,0x00,0x0e,0x00,0xe0,0x02,0x00,0x70,0x00,0x07,0x0e,0x03,0x87,0x1c,0xe7,0x9e,0x07,0x1e,0x00,0x00,0x00,0x03,0xcf,0x00,0xff,0xc0,0xe0,0x3f,0x00,0x1d,0xfd,0xff,0xce,0x00,0xe0,0x00,0x00,0x70,0x00,0x07,0x0e,0x03,0x87,0x1c,0xe7,0x9e,0x07,0x1e,0x00,0x00,0x00,0x03,0xcf,0x00,0x7f,0xc0,0xe0,0x1e,0x00,0x1d,0xfd,0xff,0xee,0x00,0xe7,0x80,0x00,0x70,0x00,0x07,0x0e,0x03,0x87,0x1c,0xe7,0x9e,0x07,0x1e,0x00,0x00,0x00,0x03,0xcf,0x00,0x01,0xc0,0xe0,0x0e,0x00,0x3c,0x3c,0xff,0xce,0x00,0xef,0xff,0xcc,0x70,0x00,0x07,0x0e,0x03,0x87,0x1c,0xe7,0x9e,0x07,0x1e,0x00,0x00,0x00,0x03,0xcf,0x00,0x01,0xc0,0xe0,0x0e,0x00,0x3d,0xff,0xce,0x0e,0x00,0xef,0xff,0xff,0x70,0x00,0x07,0x0e,0x03,0x87,0x1c,0xe7,0x9e,0x07,0x1e,0x00,0x00,0x00,0x03,0xcf,0x00,0x01,0xc0,0xe0,0x0e,0x00,0x3d,0xff,0xee,0x0e,0x00,0xe3,0xff,0xff,0x70,0x00,0x07,0x0e,0x03,0x87,0x1c,0xe7,0x9e,0x07,0x1e,0x00,0x00,0x00,0x03,0xcf,0x00,0x01,0xc1,0xe0,0x0e,0x00,0x39,0xff,0xee,0x1e,0x00,0xe3,0xff,0xff,0x70,0x00,0x07,0x0e,0x03,0x87,0x1c,0xe7,0x9e,0x07,0x1e,0x00,0x00,0x00,0x03,0xcf,0x00,0x1f,0xff,0xff,0xfe,0x00,0x38,0x00,0x00,0x1e,0x00,0xe3,0x3f,0xff,0x70,0x00,0x07,0xfe,0x03,0x8f,0x1c,0xe7,0xfe,0x07,0x1e,0x00,0x00,0x00,0x03,0xcf,0x00,0x3f,0xff,0xff,0xfe,0x00,0x39,0xfc,0xf8,0x1c,0x00,0xe0,0x03,0xcc,0x70,0x00,0x07,0xfe,0x03,0xff,0x1d,0xe3,0xfe,0x07,0xfe,0x00,0x00,0x00,0x03,0xcf,0x00,0x1f,0xff,0xff,0xfe,0x00,0x3b,0xff,0xff,0x1c,0x00,0xe0,0x00,0x00,0x70,0x00,0x03,0xfc,0x03,0xff,0x1f,0xe7,0xfe,0x07,0xfe,0x00,0x00,0x00,0x03,0xcf,0x00,0x01,0xc0,0x00,0x00,0x00,0x38,0xfd,0xff,0x1c,0x00,0xe6,0x00,0x00,0x70,0x00,0x01,0xf8,0x03,0x8f,0x1f,0xc7,0xff,0x03,0xfc,0x00,0x00,0x00,0x03,0xcf,0x00,0x01,0xc0,0x00,0x00,0x00,0x78,0x00,0x00,0x1c,0x01,0xee,0xff,0xfc,0x70,0x00,0x01,0xf8,0x03,0xff,0x07,0x87,0xff,0x03,0xfc,0x00,0x00,0x00,0x03,0xcf,0x00,0x01,0xc0,0x00,0x1c,0x00,0x70,0x00,0x00,0x3c,0x01,0xe6,0xff,0xfc,0x70,0x00,0x01,0xf8,0x03,0xfe,0x07,0x07,0xfe,0x07,0xbe,0x00,0x00,0x00,0x03,0xcf,0x00,0x01,0xc7,0xff,0xfe,0x00,0x70,0x00,0x00,0x3c,0x01,0xe0,0x03,0xfc,0xf0,0x00,0x01,0xf8,0x01,0xfc,0x07,0x01,0xfc,0x0f,0x1f,0x00,0x00,0x00,0x03,0xc6,0x00,0x00,0x0f,0xff,0xff,0x00,0x70,0x00,0x00,0x38,0x01,0xc0,0x00,0x00,0xf0,0x00,0x01,0xf8,0x01,0xfc,0x07,0x01,0xfc,0x1e,0xf7,0x00,0x00,0x00,0x03,0xc7,0xff,0x80,0x07,0xff,0xff,0x00,0x7f,0xc0,0x00,0x38,0x01,0xce,0xff,0x00,0xe0,0x00,0x01,0xf8,0x01,0xfc,0x07,0x01,0xfc,0x1f,0xff,0x80,0x00,0x00,0x03,0xff,0xff,0xfc,0x00,0x00,0x7f,0x00,0x7f,0xff,0xff,0xf8,0x01,0xce,0xff,0x80,0xe0,0x00,0x01,0xf8,0x01,0xfc,0x07,0x01,0xfc,0x1f,0xff,0x80,0x00,0x00,0x1f,0xff,0xff,0xff,0x80,0x00,0x3e,0x00,0x7f,0xff,0xff,0xf8,0x01,0xc0,0xff,0x80,0xe0,0x00,0x01,0xf8,0x01,0xfc,0x07,0x01,0xfc,0x3f,0x9f,0x80,0x00,0x00,0xff,0xff,0xff,0xff,0xf0,0x00,0x00,0x00,0x00,0x03,0xff,0xf0,0x03,0xc0,0x00,0x00,0xe0,0x00,0x01,0xf8,0x01,0xfc,0x07,0x01,0xfc,0x3f,0x9f,0x80,0x00,0x03,0xff,0xc0,0x00,0x3f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xc0,0x00,0x00,0xe0,0x00,0x01,0xf8,0x01,0xfc,0x07,0x01,0xfc,0x1f,0x9f,0x80,0x00,0x0f,0xfc,0x00,0x00,0x03,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x01,0xe0,0x00,0x01,0xf8,0x01,0xfc,0x07,0x01,0xfc,0x1f,0x9f,0x00,0x00,0x3f,0xe0,0x00,0x00,0x00,0x7f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xfc,0x01,0xe0,0x00,0x01,0xf8,0x01,0xfc,0x07,0x03,0xfe,0x0f,0xbf,0x00,0x00,0x7f,0x00,0x00,0x00,0x00,0x1f,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0xff,0xc0,0x00,0x01,0xf8,0x01,0xfc,0x07,0x07,0xbe,0x0f,0xbe,0x00,0x01,0xfc,0x03,0xe0,0x00,0x00,0x07,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xff,0xc0,0x00,0x01,0xf8,0x01,0xfc,0x07,0x07,0xfe,0x07,0x9c,0x00,0x07,0xf0,0x0f,0xff,0xf0,0x00,0x01,0xfc,0x00,0x00,0x00,0x7c,0x00,0xf8,0x00,0x00,0x03,0xff,0xc0,0x00,0x01,0xf8,0x01,0xfc,0x07,0x07,0xfe,0x01,0x18,0x00,0x0f,0xe0,0x1f,0xff,0xfc,0x00,0x00,0x7f,0x00,0x00,0x00,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0xfc,0x07,0x07,0xfe,0x00,0x00,0x00,0x1f,0x80,0x3e,0x7f,0xfe,0x00,0x00,0x1f,0x80,0x00,0x00,0xff,0xff,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x03,0x9c,0x00,0xfc,0x07,0x03,0xfe,0x00,0x00,0x00,0x3f,0x00,0x7c,0x7e,0x1e,0x00,0x00,0x0f,0xc0,0x00,0x00,0xe1,0xff,0xff,0xff,0xe0,0x00,0x00,0x00,0x00,0x03,0xdc,0x00,0xf8,0x07,0x03,0xfe,0x00,0x00,0x00,0x7c,0x00,0x7b,0xfe,0x0f,0x00,0x00,0x07,0xe0,0x00,0x00,0xe0,0x01,0xff,0xff,0xf0,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0xf8,0x07,0x03,0xfe,0x00,0x00,0x00,0xf8,0x00,0x7f,0xff,0x9f,0x00,0x00,0x03,0xf0,0x00,0x00,0xe0,0x00,0xf8,0x07,0xf0,0x00,0x00,0x00,0x00,0x01,0xf8,0x00,0xf8,0x07,0x03,0xfe,0x00,0x00,0x01,0xf0,0x00,0xf7,0xff,0xdf,0x80,0x00,0x01,0xf8,0x00,0x00,0xe0,0x00,0x70,0x00,0xf0,0x00,0x00,0x00,0x00,0x01,0xf8,0x00,0x70,0x07,0x01,0xdc,0x00,0x00,0x03,0xe0,0x00,0xe0,0x3f,0xbf,0x00,0x00,0x00,0xfc,0x00,0x00,0xe0,0xe7,0x80,0x00,0xf0,0x00,0x00,0x00,0x00,0x01,0xf8,0x00,0x70,0x07,0x00,0x88,0x00,0x00,0x03,0xe0,0x01,0xe0,0x00,0x3f,0x00,0x00,0x00,0x7c,0x00,0x01,0xe0,0xef,0xe0,0x00,0xf0,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0x00,0x03,0x00,0x00,0x00,0x00,0x07,0xc0,0x01,0xef,0x00,0x3f,0x00,0x00,0x00,0x3e,0x00,0x01,0xe0,0xff,0xf0,0x00,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x01,0xdf,0xff,0x7e,0x00,0x00,0x00,0x1f,0x00,0x01,0xe0,0x3c,0xf8,0x00,0xe0,0x1f,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x03,0xdf,0xff,0x7e,0x00,0x00,0x00,0x1f,0x80,0x01,0xc0,0x7a,0x78,0x00,0xe0,0x1f,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x03,0xc7,0xfe,0xfe,0x00,0x00,0x00,0x0f,0x80,0x01,0xc7,0xf8,0x38,0x00,0xe0,0x03,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x03,0xc7,0x70,0xfc,0x00,0x00,0x00,0x07,0xc0,0x01,0xc7,0xff,0xf8,0xf0,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x03,0xf7,0x71,0xfc,0x00,0x00,0x00,0x03,0xc0,0x01,0xc7,0xff,0xff,0xf8,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x03,0xff,0xff,0xf8,0x00,0x00,0x00,0x03,0xe0,0x01,0xc0,0x77,0xff,0xfc,0xe0,0x1f,0xc0,0x00,0x00,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x01,0xff,0xff,0xf8,0x00,0x00,0x00,0x01,0xe0,0x03,0xc0,0x70,0x78,0xf9,0xe0,0x1f,0xe0,0x00,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0x01,0xff,0xff,0xf0,0x00,0x00,0x00,0x01,0xe0,0x03,0xc0,0x70,0x78,0xf9,0xe0,0x1f,0xe0,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x00,0x00,0xff,0xff,0xe0,0x00,0x00,0x00,0x01,0xf0,0x03,0x80,0xf0,0x70,0x01,0xe0,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x1f,0x00,0x3f,0xff,0xc0,0x00,0x00,0x00,0x00,0xf0,0x03,0x80,0xf8,0x70,0x01,0xc0,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf0,0x7f,0x80,0x07,0xff,0x80,0x7f,0x00,0x00,0x00,0xf8,0x03,0x8f,0xfc,0x70,0x01,0xc0,0x07,0xfe,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xe0,0xff,0xc0,0x00,0x00,0x00,0xff,0x80,0x00,0x00,0xf8,0x07,0x9f,0xfc,0x7c,0x01,0xc0,0x03,0xff,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xe1,0xff,0xe0,0x00,0x00,0x01,0xff,0xe0,0x00,0x00,0x78,0x07,0x87,0xf8,0xff,0xf1,0xc0,0x00,0xfe,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xe3,0xc0,0xc0,0x00,0x00,0x03,0xc3,0xf0,0x00,0x00,0x78,0x07,0x00,0x78,0x7f,0xf3,0xc0,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xe3,0x80,0x00,0x00,0x00,0x01,0x80,0xf0,0x00,0x00,0x7c,0x07,0x00,0x00,0x01,0xe3,0xc0,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x7c,0x07,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x3f,0x80,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x3c,0x0f,0xfc,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0xff,0xe0,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x0f,0xff,0xff,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x03,0xe0,0x01,0xff,0xf0,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x03,0xff,0xff,0xff,0x83,0x80,0x00,0x00,0x00,0x00,0x00,0x01,0xe0,0x03,0xf1,0xf8,0x00,0x00,0x03,0xc0,0x3f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x01,0xff,0xff,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x01,0xf0,0x07,0xc0,0x78,0x00,0x00,0x03,0xc0,0x7f,0xe0,0x00,0x00,0x03,0xf8,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x7f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x0f,0x80,0x7c,0x00,0x00,0x03,0xc0,0xff,0xf0,0x00,0x00,0x0f,0xfe,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x1f,0x00,0x3c,0x00,0x00,0x03,0xc1,0xf0,0xf8,0x00,0x00,0x1f,0xff,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x1e,0x00,0xfc,0x00,0x00,0x03,0xc1,0xe0,0x7c,0x00,0x00,0x3e,0x1f,0x80,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x70,0x3e,0x01,0xfc,0x00,0x00,0x03,0xc3,0xc0,0x3c,0x00,0x00,0x7c,0x07,0xc0,0x00,0x00,0x3f,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf0,0x3c,0x03,0xfe,0x00,0x00,0x03,0xc3,0xc0,0x1e,0x00,0x00,0x78,0x03,0xc0,0x00,0x00,0x3f,0xff,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf0,0x7c,0x03,0xcf,0x00,0x00,0x03,0xc7,0x80,0x1e,0x00,0x00,0xf0,0x01,0xe0,0x00,0x00,0x3c,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xe0,0x78,0x07,0x8f,0x00,0x00,0x03,0xc7,0x83,0xde,0x00,0x00,0xf0,0x01,0xe0,0x00,0x00,0x3c,0x00,0x3f,0xff,0xff,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x0f,0xc0,0x78,0x07,0xff,0x00,0x00,0x03,0xe7,0x87,0xee,0x00,0x01,0xe7,0x01,0xe0,0x00,0x00,0x7c,0x00,0x00,0x03,0xff,0xff,0xff,0xff,0x80,0x00,0x00,0x00,0x1f,0x80,0xf8,0x07,0xfe,0x00,0x00,0x01,0xe7,0x8f,0xfe,0x00,0x01,0xff,0xc0,0xe0,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x3f,0xff,0xff,0xff,0xe0,0x00,0x00,0x7e,0x00,0xf0,0x0f,0xfe,0x00,0x00,0x01,0xe7,0x9f,0xfe,0x00,0x01,0xff,0xe0,0xe0,0x00,0x00,0x7f,0xff,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0xff,0x00,0x00,0xfc,0x00,0xf0,0x0f,0x1e,0x00,0x00,0x01,0xe7,0x9f,0xff,0x00,0x01,0xff,0xe0,0xf0,0x00,0x00,0x7f,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0x3f,0xff,0x00,0x01,0xf0,0x00,0xf0,0x0e,0x1e,0x00,0x00,0x01,0xe7,0x9f,0xff,0x00,0x01,0xff,0xf0,0xf0,0x00,0x00,0xfb,0xff,0xff,0xff,0xf8,0x00,0x00,0x00,0x00,0x07,0x00,0x01,0xe0,0x01,0xe0,0x1e,0x1c,0x00,0x00,0x00,0xf3,0x9f,0xfe,0x00,0x01,0xff,0xf0,0xe0,0x00,0x00,0xf0,0x00,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x03,0xc0,0x01,0xe0,0x5e,0x1c,0x00,0x00,0x00,0xf3,0xdf,0xfe,0x00,0x01,0xff,0xf0,0xe0,0x00,0x01,0xf0,0x00,0x00,0x1f,0xff,0xff,0xff,0xe0,0x00,0x00,0x00,0x03,0xc0,0x01,0xe3,0xfe,0x3c,0x00,0x00,0x00,0xfb,0xdf,0xbe,0x00,0x01,0xff,0xf1,0xe0,0x00,0x01,0xf0,0x00,0x00,0x00,0x07,0xff,0xff,0xff,0xf0,0x00,0x00,0x03,0x80,0x01,0xe7,0xfc,0x3c,0x00,0x00,0x00,0x79,0xff,0xfe,0x00,0x01,0xfd,0xf1,0xe0,0x00,0x01,0xe0,0x00,0x00,0x00,0x00,0x01,0xff,0xff,0xff,0xfc,0x00,0x03,0x80,0x03,0xdf,0xfc,0x3f,0x00,0x00,0x00,0x7d,0xff,0xfc,0x00,0x00,0xff,0xf1,0xe0,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xff,0x00,0x03,0x80,0x03,0xff,0x3c,0x3f,0xc0,0x00,0x00,0x7c,0xff,0xfc,0x00,0x00,0xff,0xe3,0xc0,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfb,0xff,0x00,0x03,0xc0,0x03,0xfc,0x38,0x3f,0xe0,0x00,0x00,0x3c,0x7f,0xf8,0x00,0x00,0x7f,0xe7,0x80,0x00,0x07,0xc0,0x00,0x01,0xff,0x00,0x00,0x00,0x00,0xf0,0xf0,0x00,0x03,0xc0,0x03,0xf8,0x7f,0xf9,0xf8,0x00,0x00,0x3e,0x3f,0xf0,0x00,0x00,0x7f,0xff,0x80,0x00,0x0f,0x80,0x00,0x07,0xff,0xe0,0x00,0x00,0x01,0xe0,0xe0,0x00,0x01,0xe0,0x03,0xf8,0x7f,0xfe,0xfc,0x00,0x00,0x1e,0x1f,0xe0,0x00,0x00,0x3f,0xff,0x00,0x00,0x1f,0x00,0x00,0x1f,0xff,0xf8,0x00,0x00,0x01,0xe1,0xe0,0x00,0x01,0xf0,0x03,0xf0,0x7f,0xff,0x7e,0x00,0x00,0x1f,0x00,0x06,0x00,0x00,0x0f,0xfc,0x00,0x00,0x1f,0x00,0x00,0x3f,0x83,0xfe,0x00,0x00,0x03,0xc1,0xe0,0x00,0x00,0xf8,0x07,0xf0,0xf8,0x3f,0x9f,0x00,0x00,0x0f,0x00,0x0f,0x00,0x01,0xc3,0xe0,0x00,0x00,0x3e,0x00,0x00,0x7c,0x00,0x7f,0x00,0x00,0x07,0x83,0xc0,0x00,0x00,0x7c,0x07,0xf0,0xf0,0x07,0xcf,0x80,0x00,0x0f,0x00,0x0f,0xc0,0x03,0xe0,0x00,0x00,0x00,0x7c,0x00,0x00,0xf8,0x00,0x1f,0xc0,0x00,0x0f,0x03,0xc0,0x00,0x00,0x3c,0x07,0xf0,0xf0,0x03,0xc7,0x80,0x00,0x0f,0x80,0x07,0xf8,0x1f,0xf0,0x00,0x00,0x00,0x7c,0x00,0x01,0xe0,0x00,0x07,0xe0,0x00,0x3e,0x07,0x80,0x00,0x00,0x1e,0x07,0xf8,0xf8,0x00,0x03,0xc0,0x00,0x07,0x80,0x03,0xff,0xff,0xf0,0x00,0x00,0x00,0xf8,0x00,0x03,0xc0,0x00,0x03,0xfc,0x01,0xfc,0x07,0x80,0x00,0x00,0x0f,0x07,0x79,0xf8,0x00,0x03,0xe0,0x00,0x07,0x80,0x01,0xff,0xff,0xc0,0x00,0x07,0x00,0xf0,0x00,0x03,0xc0,0x00,0x78,0xff,0xff,0xf8,0x1f,0x00,0x00,0x00,0x07,0x0f,0x7d,0xff,0x00,0x01,0xe0,0x00,0x07,0x80,0x01,0xff,0xff,0x80,0x00,0x0f,0x80,0xf0,0x00,0x07,0x80,0x03,0xff,0x3f,0xff,0xe0,0x1e,0x00,0x00,0x00,0x07,0x8f,0x3f,0xff,0xe0,0x01,0xf0,0x00,0x07,0x80,0x00,0xff,0xff,0x80,0x00,0x1f,0xc1,0xe0,0x00,0x07,0x80,0x07,0xff,0x87,0xff,0x00,0x7c,0x00,0x00,0x00,0x07,0x8f,0x1f,0xcf,0xf8,0x00,0xf0,0x00,0x07,0x80,0x00,0xff,0xcf,0x00,0x00,0x3f,0xc1,0xe0,0x00,0x0f,0x00,0x07,0xff,0xe0,0x00,0x00,0xf8,0x00,0x00,0x00,0x07,0x0f,0x07,0xc3,0xfc,0x00,0x78,0x00,0x07,0x80,0x00,0x7e,0x1f,0x00,0x00,0x7f,0x81,0xe0,0x00,0x0f,0x00,0x7f,0x83,0xf8,0x00,0x01,0xf0,0x00,0x00,0x00,0x0f,0x0e,0x03,0xc3,0xf8,0x00,0x7c,0x00,0x07,0x80,0x00,0x3f,0xfe,0x00,0x00,0xff,0x81,0xe0,0x00,0x1e,0x00,0x7f,0xe1,0xfe,0x00,0x07,0xe0,0x00,0x00,0x00,0x1e,0x1e,0x0f,0xfb,0xc7,0x00,0x3c,0x00,0x07,0x80,0x00,0x1f,0xfc,0x00,0x01,0xfe,0x01,0xe0,0x00,0x3c,0x00,0xff,0xf0,0x7f,0xc0,0x3f,0xc0,0x00,0x00,0x00,0x1e,0x1e,0x1f,0xff,0xc7,0x80,0x3e,0x00,0x07,0x80,0x00,0x0f,0xf8,0x00,0x01,0xfe,0x01,0xf0,0x00,0x7c,0x00,0xff,0xf8,0x1f,0xff,0xff,0x00,0x00,0x00,0x00,0x3c,0x1e,0x3e,0xff,0xf3,0xc0,0x1f,0x80,0x0f,0x80,0x00,0x03,0xe0,0x00,0x03,0xfc,0x01,0xf8,0x00,0xf8,0x00,0xfc,0x7c,0x07,0xff,0xfc,0x00,0x00,0x00,0x00,0x38,0x3c,0x3c,0x1f,0xf9,0xc0,0x0f,0xe0,0x3f,0x80,0x00,0x00,0x00,0x00,0x07,0xf8,0x00,0xff,0x07,0xf0,0x00,0x3c,0x3c,0x00,0x7f,0xe0,0x00,0x00,0x00,0x00,0x78,0x3c,0x3f,0xe3,0xf9,0xc0,0x07,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x0f,0xf0,0x00,0xff,0xff,0xe0,0x00,0x78,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x7c,0x7f,0xfb,0xf8,0x00,0x01,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x1f,0xe0,0x00,0xff,0xff,0x80,0x03,0xf8,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x78,0x7f,0xff,0xfc,0x00,0x00,0x7f,0xfe,0x00,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x7f,0xfe,0x00,0x07,0xf8,0x1c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0xf8,0x3f,0xff,0xfc,0x70,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x7f,0xc0,0x00,0x3e,0x00,0x00,0x07,0xf0,0x3c,0x00,0x00,0x00,0x00,0x08,0x00,0x00,0x38,0xf0,0x3f,0xff,0xde,0x78,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0xfb,0xc0,0x00,0x3f,0x00,0x00,0x0f,0xf0,0x3c,0x00,0x00,0x00,0x00,0xfe,0x00,0x00,0x39,0xf0,0x1f,0x7f,0xdf,0x78,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x01,0xf7,0x80,0x00,0x1f,0x80,0x00,0x01,0xe0,0x3c,0x00,0x00,0x00,0x0f,0xff,0x00,0x00,0x03,0xe0,0x0f,0x7f,0x8f,0x3c,0x00,0x00,0xf8,0x00,0x00,0x00,0x00,0x03,0xef,0x80,0x0e,0x07,0xc0,0x00,0x03,0xe0,0x78,0x00,0x00,0x00,0xff,0xff,0x00,0x00,0x07,0xc0,0x0f,0x7f,0x0f,0x9e,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0x03,0xdf,0x00,0x0f,0x03,0xe0,0x00,0x73,0xc0,0xf8,0x00,0x00,0x0f,0xff,0x8e,0xf8,0x00,0x0f,0x80,0x0e,0x74,0x07,0x8e,0x00,0x03,0xe0,0x06,0x00,0x00,0x00,0xff,0xbf,0xf8,0x07,0x81,0xf8,0x00,0xf7,0xc1,0xf0,0x00,0x00,0x7f,0xfc,0x1e,0xff,0xc0,0x1f,0x00,0x1e,0xf0,0x03,0xc0,0x00,0x07,0xc0,0x0e,0x00,0x00,0x03,0xff,0x7f,0xfc,0x07,0xc0,0xfc,0x01,0xef,0x83,0xe0,0x00,0x07,0xff,0xc0,0x1e,0xff,0xfc,0x3e,0x00,0x1e,0xe0,0x03,0xe1,0xc0,0x0f,0x80,0x1e,0x00,0x00,0x0f,0xff,0xff,0xff,0x03,0xf0,0x7e,0x03,0xdf,0x07,0xc0,0x00,0x7f,0xfc,0x00,0x1c,0x07,0xff,0xfc,0x00,0x1c,0xe0,0x01,0xf1,0xf8,0x3f,0x00,0x1e,0x00,0x00,0x0f,0xbf,0xf8,0x1f,0x81,0xfc,0x1f,0xfb,0xbe,0x07,0xc0,0x07,0xff,0xc0,0x00,0x3c,0x00,0x7f,0xff,0x80,0x3d,0xe0,0x00,0xfc,0xfc,0xfe,0x00,0x1e,0x00,0x00,0x1e,0x7f,0xe0,0x0f,0xc0,0x7e,0x0f,0xf8,0x7c,0x0f,0x80,0x7f,0xfe,0x00,0x00,0x3c,0x00,0x0f,0xef,0xf8,0x3d,0xc0,0x00,0x7e,0x7f,0xfc,0x00,0x3c,0x00,0x00,0x1c,0x7f,0xc0,0x07,0xe0,0x3f,0x07,0xf1,0xf8,0x1f,0x03,0xff,0xe0,0x00,0x00,0x3c,0x00,0x7f,0xcf,0xff,0xb9,0xc0,0x03,0xff,0xff,0xf0,0x00,0x3c,0x00,0x00,0x3d,0xff,0x00,0x03,0xe0,0x1f,0x83,0xff,0xf0,0x1e,0x1f,0xfe,0x00,0x00,0x00,0x78,0xff,0xff,0x00,0xff,0xfb,0xc0,0x0f,0xff,0xff,0xc0,0x00,0x78,0x00,0x1c,0x3f,0xfe,0x00,0x01,0xf0,0x07,0xc0,0xff,0xc0,0x1e,0x7f,0xe0,0x00,0x00,0x00,0x78,0xff,0xfc,0x00,0x07,0xfb,0xf8,0x3f,0xff,0xfc,0x00,0x00,0x78,0x00,0x3c,0x3f,0xfc,0x00,0x00,0xfc,0x03,0xe0,0x7f,0x80,0x1c,0xff,0x00,0x00,0x00,0x00,0x78,0xff,0xe0,0x00,0x00,0x7b,0xff,0xff,0x00,0x00,0x00,0x00,0xf0,0x00,0x3c,0x1f,0xf8,0x03,0x80,0x7f,0x01,0xe0,0x3e,0x00,0x3c,0xf0,0x00,0x00,0x00,0x00,0x70,0x00,0x01,0xfc,0x00,0x7f,0xff,0xf8,0x00,0x00,0x00,0x00,0xf0,0x00,0x7c,0x1f,0xf8,0x0f,0x80,0x7f,0xe1,0xe0,0x1e,0x00,0x3d,0xe0,0x00,0x00,0x00,0x00,0xf0,0x00,0x3f,0xfe,0x00,0x7f,0x87,0xe0,0x00,0x00,0x00,0x01,0xe0,0x00,0x7c,0x1f,0xf0,0x3f,0x00,0x3f,0xff,0xe0,0x0f,0x00,0x1d,0xe0,0x00,0x00,0x00,0x00,0xf0,0x01,0xff,0xfe,0x00,0x7f,0x07,0xc0,0x00,0x00,0x00,0x01,0xe0,0x00,0xfc,0x3e,0xf0,0x7e,0x00,0x03,0xff,0xc0,0x0f,0x00,0x1f,0xc0,0x00,0x00,0x00,0x00,0xf0,0x03,0xff,0xfe,0x00,0x7e,0x0f,0x80,0x00,0x00,0x00,0x03,0xc0,0x00,0xfc,0x3c,0xf0,0xf8,0x00,0x00,0x7f,0x80,0x0f,0x80,0x1f,0xc0,0x00,0x00,0x00,0x01,0xe0,0x07,0xff,0xfc,0x00,0x7e,0x1f,0x00,0x00,0x00,0x00,0x07,0xc0,0x01,0xfc,0xf9,0xf9,0xf0,0x00,0x00,0x00,0x00,0x0f,0x80,0x1f,0xc0,0x00,0x00,0x00,0x01,0xe0,0x07,0xff,0xf0,0x00,0xfe,0x1e,0x00,0x00,0x00,0x00,0x1f,0xc0,0x01,0xfd,0xf3,0xf9,0xe0,0x00,0x00,0x00,0x00,0x07,0x80,0x0f,0x80,0x00,0x00,0x00,0x01,0xe0,0x07,0xff,0x00,0x00,0xfc,0x1c,0x00,0x00,0x00,0x00,0xff,0x80,0x03,0xff,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0x07,0x80,0x0f,0x80,0x00,0x00,0x00,0x01,0xc0,0x07,0xf8,0x06,0x00,0xfc,0x3c,0x00,0x3e,0x00,0x07,0xff,0x80,0x07,0xff,0xbf,0xff,0xc0,0x38,0x00,0x00,0x00,0x07,0x80,0x07,0x80,0x00,0x00,0x00,0x03,0xc0,0x01,0x80,0x1f,0xe0,0xf8,0x3c,0x00,0xff,0xc7,0xff,0xff,0x80,0x07,0xbf,0x9f,0x9f,0x80,0xf8,0x00,0x00,0x00,0x0f,0x80,0x0f,0x00,0x00,0x00,0x00,0x03,0xc0,0x00,0x07,0x7f,0xf8,0xf0,0x7c,0x01,0xff,0xff,0xff,0xff,0x80,0x0f,0x3f,0xcf,0x87,0x81,0xf0,0x00,0x00,0x00,0x0f,0x00,0x0f,0x00,0x00,0x0c,0x00,0x03,0xc0,0x00,0x3f,0xf9,0xf8,0xe0,0xfc,0x03,0xe3,0xff,0xff,0xff,0xf0,0x1f,0x3f,0xef,0x87,0x87,0xf8,0x00,0x00,0x00,0x0f,0x00,0x0e,0x00,0x00,0x3e,0x00,0x07,0x80,0x00,0x7f,0xf8,0x00,0x61,0xfc,0x07,0x80,0xff,0x80,0x1f,0xff,0x9e,0x3f,0xff,0x07,0xff,0xfc,0x00,0x00,0x00,0x1e,0x00,0x1e,0x00,0x00,0xff,0x00,0x07,0x80,0x00,0x7c,0xf8,0x00,0x03,0xfc,0x07,0xe0,0x3f,0xc0,0x01,0xff,0xfc,0x0f,0xfe,0x07,0xff,0x3e,0x00,0x00,0x00,0x3e,0x00,0x1e,0x00,0x00,0xff,0x00,0x07,0x80,0x00,0x7f,0xf8,0x00,0x7f,0xfe,0x0f,0xfc,0x0f,0xe0,0x00,0x0f,0xff,0x8f,0xfc,0x07,0xfe,0x1f,0x80,0x00,0x00,0x7c,0x7f,0xde,0x00,0x01,0xef,0x00,0x0f,0x00,0x03,0xff,0xe0,0x00,0xff,0xff,0x1f,0xff,0x83,0xf8,0x00,0x00,0xff,0xdf,0xfc,0x07,0xbe,0x0f,0xe0,0x00,0x00,0xff,0xff,0xfc,0x00,0x03,0xcf,0x00,0x0f,0x00,0x3f,0xff,0x80,0x00,0x7f,0xff,0xfe,0x1f,0xc0,0xfe,0x0f,0x80,0x0f,0xff,0xc0,0x07,0xbc,0x07,0xf8,0x00,0x03,0xff,0xff,0xfc,0x00,0x03,0x8f,0x00,0x0f,0x00,0xff,0xc3,0x00,0x00,0x7f,0xef,0xff,0xc3,0xe0,0x7f,0xff,0xf0,0x00,0x7f,0xfe,0x07,0xbc,0x07,0xff,0x80,0x1f,0xff,0xc0,0x7c,0x00,0x03,0x9e,0x00,0x1e,0x00,0xfc,0x00,0x00,0x00,0xff,0xdf,0xff,0xe3,0xe0,0x1f,0xff,0xfc,0x00,0xff,0xff,0xf7,0xfc,0x07,0xff,0xff,0xff,0xfe,0x00,0x38,0x00,0x07,0x9e,0x00,0x1e,0x00,0xe0,0x07,0xf8,0x03,0xff,0xbe,0xfb,0xe7,0xe0,0x07,0xfc,0xfe,0x00,0xff,0x3f,0xff,0xfc,0x07,0x9f,0xff,0xff,0xf0,0x00,0x78,0x00,0x07,0xfc,0x00,0x1e,0x00,0x00,0x3f,0xfe,0x07,0xdf,0xf9,0xf7,0xcf,0xe0,0x00,0x00,0x1f,0x01,0xfe,0x01,0xff,0xfc,0x07,0x8f,0xff,0xff,0x80,0x01,0xf8,0x00,0x03,0xf8,0x00,0x3e,0x00,0x00,0xff,0xff,0x0f,0x8f,0xff,0xef,0x9f,0xe0,0x00,0x70,0x0f,0x03,0xfc,0x00,0x1f,0xff,0xc7,0x87,0x9f,0xfc,0x00,0x07,0xf0,0x00,0x03,0xf0,0x00,0x3c,0x00,0x01,0xfe,0x0f,0xdf,0x03,0xff,0x9e,0x7e,0xe0,0x01,0xff,0x07,0x03,0xf8,0x00,0x00,0xff,0xff,0xc7,0xff,0xe0,0x00,0x3f,0xf0,0x00,0x00,0xc0,0x00,0x3c,0x00,0x07,0xf1,0xe3,0xfe,0x60,0x7f,0xfc,0xf8,0xf0,0x03,0xff,0xf7,0x07,0xf0,0x00,0x00,0x07,0xff,0xf3,0xff,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x00,0x7c,0x00,0x1f,0xcf,0xe1,0xfd,0xf8,0x0f,0xf9,0xf0,0xf0,0x07,0xdf,0xff,0x87,0xe0,0x1c,0x00,0x00,0x7f,0xff,0xf8,0x00,0x0f,0xff,0xe0,0x00,0x00,0x00,0x00,0x78,0x00,0x7f,0x1f,0xc1,0xff,0xfe,0x01,0xf3,0xe0,0xf0,0x1f,0xfc,0xff,0xff,0xc0,0x3f,0x8e,0x00,0x03,0xff,0xc0,0x00,0x3f,0xff,0xe0,0x00,0x00,0x00,0x00,0x78,0x00,0xfc,0x1e,0x03,0xff,0xbe,0xe0,0x07,0xc1,0xf0,0x3f,0xfe,0x3f,0xff,0x80,0x7f,0xff,0xe0,0x0f,0xfe,0x00,0x01,0xff,0xff,0xe0,0x00,0x00,0x00,0x00,0xf8,0x00,0xf0,0x00,0x07,0xdf,0x3f,0xf0,0x0f,0x03,0xe0,0x7f,0xfe,0xf8,0x7f,0xfc,0x7f,0xff,0xf8,0x3f,0xf0,0x00,0x0f,0xff,0xff,0xc0,0x00,0x00,0x00,0x00,0xff,0xc0,0x00,0x00,0x07,0x9f,0x7f,0xf8,0x1e,0x07,0xc1,0xf8,0xfc,0xf8,0x1f,0xff,0xff,0xff,0xf9,0xff,0x80,0x00,0x7f,0xff,0xf3,0xc0,0x00,0x00,0x00,0x00,0xff,0xfe,0x00,0x00,0x0f,0x1f,0xff,0x3c,0x3c,0x1f,0x83,0xef,0x79,0xf0,0x3c,0x7f,0xff,0x18,0x11,0xfc,0x00,0x03,0xff,0xff,0xff,0xc0,0x00,0x00,0x00,0x07,0xe3,0xff,0x00,0x00,0x0f,0x07,0xff,0x7c,0xf8,0x3e,0x0f,0xdf,0xe7,0xce,0x3d,0x87,0xff,0x80,0x03,0xf0,0x00,0x1f,0xff,0xfe,0xff,0xc0,0x00,0x00,0x00,0x3f,0xc0,0x3f,0x00,0x00,0x0f,0x81,0xcf,0xf9,0xf0,0x7c,0x1f,0x3f,0xff,0x8f,0xe3,0xfc,0xff,0xf8,0x03,0xfc,0x00,0x3f,0xdf,0xff,0xff,0x80,0x00,0x00,0x01,0xff,0x80,0x03,0x00,0x00,0x0f,0xf8,0x07,0xf3,0xe0,0xf8,0x3e,0x3f,0xff,0x7f,0xfd,0xff,0x0f,0xff,0x03,0xff,0x80,0x3f,0x7f,0xff,0xff,0x80,0x00,0x00,0x07,0xfe,0x00,0x00,0x00,0x00,0x0f,0xff,0x83,0xc7,0xc3,0xf0,0xfc,0x3f,0xbf,0xff,0xdc,0x7f,0xe3,0xff,0xc3,0xff,0xf8,0x3f,0xfe,0x7f,0xff,0x80,0x00,0x00,0x3f,0xf0,0x00,0x00,0x00,0x60,0x07,0xff,0xf0,0x0f,0x87,0xc1,0xf7,0xce,0x03,0xff,0xf8,0x3f,0xff,0xdf,0xc1,0xff,0xff,0x07,0xff,0xff,0xff,0x00,0x00,0x01,0xff,0x80,0x00,0x00,0x01,0xfc,0x07,0x87,0xff,0x3e,0x0f,0x83,0xe7,0xf8,0x07,0xcf,0xf8,0x7d,0xef,0xf7,0xc0,0xff,0xff,0xe0,0x7f,0xf1,0xff,0x00,0x00,0x07,0xfc,0x00,0x00,0x00,0x07,0xff,0x07,0x81,0xff,0xfc,0x1f,0x0f,0xcf,0xfc,0x0f,0xe1,0xfc,0xfb,0xfb,0xef,0x80,0x7f,0xff,0xfc,0x0f,0xff,0xff,0x00,0x00,0x3f,0xf0,0x07,0xc0,0x00,0x0f,0x9f,0x03,0xc7,0x8f,0xf8,0x7e,0x1f,0x7f,0xfc,0x3f,0xfb,0xfd,0xe7,0xfc,0x3f,0x00,0x0f,0xff,0xff,0xc0,0xff,0xfe,0x00,0x01,0xff,0x80,0x1f,0xfe,0x00,0x0f,0xff,0x03,0xff,0xc0,0xe0,0xf8,0x7e,0x7f,0xff,0xff,0xff,0xff,0xcf,0x3e,0x7e,0x00,0x00,0xff,0xff,0xf8,0x1f,0xfe,0x00,0x07,0xfc,0x00,0x7f,0xff,0x00,0x07,0xfc,0x01,0xff,0xc0,0x03,0xf0,0xff,0xff,0xe7,0xff,0xff,0xff,0x8f,0xbc,0xf8,0x08,0x00,0x1f,0xff,0xff,0x03,0xfe,0x00,0x3f,0xe0,0x00,0x7c,0x7f,0x00,0x01,0xf0,0x00,0x7f,0xe0,0x07,0xe1,0xf7,0x9f,0xc0,0x7f,0xff,0xf3,0x1f,0xfb,0xf0,0x3f,0x00,0x03,0xff,0xff,0xf0,0x3c,0x00,0xff,0x80,0x00,0x7e,0x78,0x00,0x00,0x00,0x00,0x3f,0xfc,0x0f,0x83,0xe7,0xfb,0xbc,0x3f,0xff,0xfe,0x3f,0xf7,0xe0,0x7f,0xc0,0x00,0x7f,0xef,0xfe,0x3c,0x07,0xfc,0x00,0x00,0x7e,0x78,0x01,0x00,0x00,0x00,0x7f,0xff,0xff,0x03,0xfe,0x78,0x7c,0x1f,0xff,0xff,0xff,0xef,0x80,0xff,0xe0,0x00,0x0f,0xff,0xff,0xfc,0x3f,0xf0,0x3c,0x00,0x7f,0xf8,0x07,0x00,0x00,0x3f,0xff,0xbf,0xfe,0x01,0xff,0xb0,0xf9,0x87,0xff,0x1f,0xf3,0x9f,0x03,0xe1,0xf0,0x00,0x01,0xff,0xdf,0xf8,0xff,0x80,0x3f,0x00,0x3f,0xf0,0x1f,0x00,0x07,0xff,0xfe,0x07,0xf8,0x00,0x7f,0xf0,0xe3,0xc8,0xf0,0x79,0xe0,0x3e,0x03,0xf0,0xf0,0x00,0x00,0x3f,0xfb,0xff,0xfc,0x01,0xdf,0xc0,0x1f,0xc0,0x7f,0x00,0x1f,0xff,0xfc,0x00,0x00,0x00,0x0f,0xff,0x07,0xfc,0x01,0xff,0xf0,0xf8,0x03,0xff,0xf0,0x00,0x00,0x07,0xff,0x7f,0xf0,0x01,0xff,0xf0,0x07,0x00,0xfc,0x00,0x7f,0xe0,0x7c,0x00,0x00,0x00,0x01,0xff,0xef,0xfd,0xc3,0xff,0x7f,0xf0,0x03,0xff,0xf0,0x1c,0x0f,0x00,0xff,0xff,0x80,0x00,0xfd,0xf8,0x00,0x01,0xf0,0x00,0xfe,0x01,0xf8,0x00,0x00,0x00,0x00,0x1f,0xfe,0xfb,0xef,0xc7,0x3f,0xe0,0x03,0xff,0xf0,0x3c,0x7f,0x00,0x1f,0xfc,0x00,0x00,0x7f,0x7c,0x00,0x03,0xe0,0x01,0xf0,0x07,0xf0,0x00,0x00,0x00,0x00,0x03,0xff,0xf7,0xcf,0x8c,0x1f,0xc0,0x01,0xff,0xf0,0x38,0xfe,0x00,0x03,0xe0,0x00,0x00,0x1f,0x3f,0x00,0x07,0xc0,0x01,0xe0,0x1f,0xc0,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x0e,0x1f,0x1f,0x80,0x00,0x7f,0xe0,0x38,0xf1,0xff,0x00,0x00,0x00,0x00,0x07,0x0f,0x80,0x07,0x80,0x03,0xc0,0x3f,0x00,0x00,0x00,0x78,0x00,0x00,0x07,0xff,0xc0,0x3f,0x3f,0x00,0x00,0x1f,0x80,0x38,0x01,0xff,0x00,0x00,0x02,0x00,0x00,0x07,0xc0,0x0f,0x00,0x03,0xc0,0x7c,0x00,0xf8,0x01,0xff,0x00,0x00,0x00,0x7f,0xf8,0x1e,0x7c,0x00,0x00,0x02,0x00,0x3c,0x03,0xff,0x80,0x00,0x37,0x80,0x00,0x03,0xe0,0x1e,0x00,0x07,0x80,0xf8,0x07,0xfe,0x01,0xff,0xc0,0x00,0x00,0x0f,0xff,0x0d,0xf8,0x03,0xe0,0x00,0x00,0x3c,0x01,0xff,0x80,0x00,0x7f,0xc0,0x00,0x01,0xf8,0x7e,0x00,0x07,0x81,0xe0,0x0f,0xff,0x03,0xc7,0xe0,0x00,0x00,0x00,0xff,0xf3,0xf0,0x1f,0xf0,0x00,0x00,0x1e,0x01,0xff,0x80,0x00,0x3f,0xf0,0x00,0x00,0xff,0xfc,0x00,0x1f,0x03,0xc0,0x0f,0xff,0x03,0xc7,0xe0,0x1e,0x0f,0x80,0x1f,0xff,0xc0,0x3f,0xf0,0x00,0x00,0x1f,0x00,0xff,0x00,0x00,0x3f,0xf8,0x00,0x00,0x3f,0xf0,0x00,0xfe,0x03,0xc0,0x0f,0xff,0x03,0xff,0xfc,0x1e,0x0f,0xf0,0x01,0xff,0x80,0x3f,0xf0,0x00,0x30,0x0f,0xc0,0x00,0x00,0x00,0x1f,0xfc,0x00,0xf8,0x0f,0xc0,0x00,0xfc,0x03,0xc0,0x0f,0xff,0x01,0xff,0xff,0x8e,0x1f,0xfc,0x00,0x3f,0x00,0x3f,0xc0,0x00,0xfe,0x07,0xf8,0x00,0x00,0x3f,0x8f,0xbc,0x03,0xfc,0x00,0x00,0x00,0xf0,0x01,0xc0,0x0f,0xff,0x00,0x3f,0xff,0xf0,0x0f,0xfe,0x00,0x00,0x00,0x1e,0x00,0x03,0xff,0x01,0xff,0x80,0x00,0x7f,0x07,0x9e,0x03,0xfc,0x00,0x00,0x00,0x00,0x01,0xf0,0x0f,0xff,0x00,0x07,0x83,0xf0,0x07,0xfe,0x00,0x00,0x00,0x00,0x00,0x0f,0xdf,0x00,0x7f,0xf0,0x00,0x7f,0x03,0xcf,0x03,0xfc,0x00,0x03,0xe0,0x00,0x00,0xf8,0x07,0xfe,0x00,0x00,0x00,0x60,0x00,0xfc,0x00,0x00,0x00,0x00,0x00,0x1f,0x7e,0x00,0x0f,0xfe,0x00,0x3f,0x81,0xe7,0x81,0xe0,0x07,0x07,0xf0,0x00,0x00,0x7c,0x00,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x1f,0xf8,0x00,0x01,0xff,0xc0,0x3f,0xc0,0xff,0x80,0x00,0x1f,0x07,0xf0,0x00,0x00,0x3c,0x00,0x00,0x0e,0x40,0x00,0x00,0x00,0x00,0x0f,0x00,0x3f,0x80,0x00,0x0f,0xf0,0x00,0x00,0x1f,0xf0,0x1f,0xe0,0x7f,0x80,0x00,0x7f,0x07,0xf0,0x00,0x00,0x1c,0x00,0x00,0x1f,0xf8,0x00,0x00,0x00,0x00,0x3f,0x00,0x7f,0xe0,0x00,0x01,0xc0,0x00,0x00,0x03,0xf8,0x0f,0xc0,0x3f,0xc0,0x01,0xfc,0x1f,0xf0,0x00,0x00,0x1c,0x00,0x00,0x1f,0xff,0x00,0x00,0x07,0x00,0x7e,0x00,0x7f,0xe0,0x00,0x00,0x00,0x00,0x06,0x00,0xfc,0x02,0x00,0x03,0xf0,0x03,0xe0,0x3f,0xe0,0x00,0x00,0x3c,0x00,0x00,0x3f,0xff,0x80,0x00,0x1f,0x80,0xf8,0x00,0x7f,0xe0,0x1f,0x00,0x00,0x10,0x1f,0xc0,0x3f,0x00,0x00,0x00,0xfc,0x01,0x80,0xfc,0x00,0x01,0xff,0xfc,0x00,0x00,0x3f,0xbf,0xe0,0x00,0x7f,0xc0,0x00,0x0f,0xbf,0xe0,0x1f,0xc0,0x00,0x7c,0x3f,0xf0,0x0f,0x80,0x00,0x00,0x7f,0x00,0x03,0xf0,0x00,0x1f,0xff,0xf8,0x01,0xfe,0x1f,0xf3,0xfc,0x01,0xf9,0xc0,0x00,0x3f,0x87,0xe0,0x3f,0xe0,0x01,0xfe,0x3f,0xf0,0x07,0x80,0x00,0x00,0x1f,0x80,0x0f,0xc0,0x00,0x7f,0xff,0xe0,0x07,0xff,0x0f,0xff,0xfe,0x07,0xf3,0xc0,0x00,0x7f,0x01,0xc0,0x3f,0xe0,0x07,0xee,0x3f,0xf0,0x03,0xc0,0x00,0x00,0x07,0xc0,0x1f,0x80,0x01,0xff,0x00,0x00,0x1f,0xff,0x81,0xff,0x1c,0x0f,0xcf,0xc0,0x00,0xfe,0x00,0x00,0x7f,0xe0,0x0f,0xdf,0x1f,0xe0,0x01,0xe0,0x07,0xe0,0x03,0xe0,0x3e,0x00,0x07,0xfc,0x00,0x00,0x3f,0x03,0x80,0x1e,0x00,0x0f,0xff,0x00,0x00,0x7f,0xc0,0x00,0xff,0xc0,0x0f,0xfe,0x07,0xe0,0x01,0xe0,0x3f,0xe0,0x01,0xe0,0x3c,0x00,0x0f,0xff,0x80,0x00,0x3c,0x00,0x00,0x00,0x00,0x0f,0xfe,0x00,0x00,0x1f,0xf0,0x03,0xff,0x80,0x07,0xfc,0x00,0x00,0x00,0xf0,0x3f,0xf0,0x00,0xe0,0x18,0x00,0x3f,0xbf,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf8,0x00,0x00,0x3f,0xf8,0x07,0xfe,0x00,0x03,0xf0,0x00,0x00,0x00,0xf0,0x3f,0xf0,0x00,0xf0,0x00,0x00,0x7c,0x07,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xe0,0x03,0x80,0x3f,0xb0,0x0f,0xbc,0x00,0x01,0x80,0x00,0x00,0x00,0x70,0x3f,0xe0,0x00,0xf0,0x00,0x01,0xf8,0x00,0xff,0xc0,0x00,0x01,0xff,0xc0,0x03,0xfc,0x00,0x07,0xe0,0x07,0x00,0x3f,0x78,0x01,0xe0,0x00,0x00,0x78,0x00,0x78,0x1f,0x1e,0x00,0x70,0x00,0x07,0xe0,0x00,0x1f,0xf8,0x00,0x0f,0xff,0xff,0xff,0xf0,0x00,0x0f,0xf0,0x00,0x00,0x7c,0x78,0x03,0xfc,0x00,0x01,0xf8,0x00,0x78,0x00,0x3f,0x00,0x70,0x00,0x0f,0xc0,0x00,0x03,0xff,0x00,0x7f,0xff,0xff,0xff,0xc0,0x00,0x0f,0xf0,0x00,0x01,0xf8,0xf0,0x0f,0xfe,0x00,0x87,0xf3,0x80,0x78,0x00,0x3f,0x80,0x70,0x00,0x3f,0x00,0x80,0x00,0x7f,0xe0,0xfe,0x00,0x7f,0xfe,0x00,0x00,0x07,0xf0,0x00,0x03,0xf0,0xe0,0x1f,0xfe,0x01,0xcf,0xcf,0x80,0x70,0x00,0x3f,0x80,0xf0,0x00,0xfe,0x00,0xf0,0x00,0x0f,0xfd,0xf8,0x00,0x01,0xc0,0x00,0x00,0x01,0xe0,0x00,0x1f,0xc1,0xe0,0x1f,0xf0,0x01,0xcf,0xff,0x80,0xf0,0x00,0x3f,0x80,0xf0,0x01,0xf8,0x03,0xfe,0x00,0x01,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x81,0xe0,0x09,0xf0,0x00,0x07,0xfe,0x00,0xf0,0x00,0x1f,0x00,0xf0,0x07,0xe0,0x07,0xff,0x80,0x00,0x3f,0xe0,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x03,0xfc,0x01,0xe0,0x00,0x78,0x00,0x01,0xf8,0x01,0xe0,0x00,0x00,0x01,0xe0,0x1f,0x80,0x1f,0x1f,0xf0,0x00,0x0f,0xfc,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x0f,0xf0,0x01,0xe0,0x00,0x30,0x00,0x00,0x60,0x03,0xe0,0x00,0x00,0x01,0xe0,0x3f,0x00,0x7e,0x03,0xfe,0x00,0x0f,0xff,0x80,0x00,0x00,0x3f,0xf0,0x00,0x00,0x3f,0xc0,0x01,0xe0,0x00,0x00,0x00,0x00,0x00,0x03,0xc0,0x00,0x00,0x03,0xc0,0xfc,0x00,0xfc,0x00,0xff,0xc0,0x0e,0x3f,0xf0,0x00,0x00,0x07,0xf8,0x00,0x00,0xfe,0x00,0x01,0xe0,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x00,0x03,0xc1,0xf8,0x03,0xf0,0x00,0x1f,0xf0,0x1e,0x07,0xfc,0x00,0x00,0x00,0x78,0x00,0x03,0xf8,0x00,0x00,0xf0,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x07,0x87,0xe0,0x07,0xc0};
+#include "st7789_asset.h"
+#include "home.h"
+#include "icons.h"
 
 
 void home(void) {
@@ -54,15 +36,11 @@ void home(void) {
     st7789_fill_circle_fb(22, 21, 4, 0x895F);
 
     // 4. Desenha os ícones (bitmaps)
-    st7789_draw_bitmap_fb(202, 13, image_wifi_full_bits, 19, 16, 0x895F);
-    st7789_draw_bitmap_fb(171, 13, image_battery_charging_bits, 24, 16, 0x895F);
-    st7789_draw_bitmap_fb(151, 16, image_SDcardMounted_bits, 11, 8, 0x895F);
-    st7789_draw_bitmap_fb(117, 15, image_MHz_bits, 25, 11, 0x895F);
-    
-    // ATENÇÃO: O bitmap 'octo4' tem dados para uma imagem pequena, mas está sendo
-    // desenhado com 240x210. Isso provavelmente não produzirá o resultado esperado.
-    // Verifique os dados e as dimensões do seu bitmap.
-    st7789_draw_bitmap_fb(0, 30, octo2, 240, 210, 0x895F);
+    st7789_draw_asset_mono_fb(202, 13, &home_wifi, 0x895F);
+    st7789_draw_asset_mono_fb(171, 13, &home_battery, 0x895F);
+    st7789_draw_asset_mono_fb(151, 16, &home_sd, 0x895F);
+    st7789_draw_asset_mono_fb(117, 15, &home_mhz, 0x895F);
+    st7789_draw_asset_mono_fb(0, 30, &home_octo, 0x895F);
 
     // --- FIM DO FRAME ---
     // 5. Envia o framebuffer completo para a tela de uma só vez!
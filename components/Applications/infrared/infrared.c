@@ -513,6 +513,22 @@ static void ir_action_browser(void) {
     }
 }
 
+// Progresso do burst: redesenha a cada arquivo, BACK cancela
+static bool burst_event(const ir_burst_event_t *event, void *ctx) {
+    int total = *(const int *)ctx;
+
+    if (event->type == IR_BURST_EVENT_FILE) {
+        int current = (int)event->stats->files;
+        draw_retro_burst_ui(current < total ? current : total, total);
+    }
+
+    if (!gpio_get_level(BTN_BACK)) {
+        while (!gpio_get_level(BTN_BACK)) vTaskDelay(pdMS_TO_TICKS(50));
+        return false;
+    }
+    return true;
+}
+
 static void ir_action_burst(void) {
     ESP_LOGI(TAG, "Burst All Files");
     while (!gpio_get_level(BTN_OK)) vTaskDelay(pdMS_TO_TICKS(50));
@@ -527,46 +543,13 @@ static void ir_action_burst(void) {
     }
     
     int total_files = g_browser.count;
-    int current_file = 0;
+    ir_burst_stats_t stats = {0};
     
-    DIR *dir = opendir(IR_STORAGE_BASE_PATH);
-    if (!dir) {
-        ESP_LOGE(TAG, "Erro ao abrir diretório");
-        return;
+    esp_err_t ret = ir_burst_run(NULL, burst_event, &total_files, &stats);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Erro no burst: %s", esp_err_to_name(ret));
     }
     
-    struct dirent *entry;
-    while ((entry = readdir(dir)) != NULL) {
-        if (!gpio_get_level(BTN_BACK)) {
-            while (!gpio_get_level(BTN_BACK)) vTaskDelay(pdMS_TO_TICKS(50));
-            ESP_LOGW(TAG, "Burst cancelado");
-            break;
-        }
-        
-        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
-            continue;
-        }
-        
-        size_t len = strlen(entry->d_name);
-        if (len > 3) {
-            const char *ext = entry->d_name + len - 3;
-            if (strcasecmp(ext, ".ir") == 0) {
-                char filename[MAX_FILENAME];
-                strncpy(filename, entry->d_name, len - 3);
-                filename[len - 3] = '\0';
-                
-                current_file++;
-                
-                draw_retro_burst_ui(current_file, total_files);
-                
-                ir_tx_send_from_file(filename);
-                
-                vTaskDelay(pdMS_TO_TICKS(500));
-            }
-        }
-    }
-    closedir(dir);
-    
-    ESP_LOGI(TAG, "Burst finalizado: %d/%d", current_file, total_files);
+    ESP_LOGI(TAG, "Burst finalizado: %lu/%d", stats.files, total_files);
     vTaskDelay(pdMS_TO_TICKS(1000));
 }
@@ -3,8 +3,7 @@
 #include <string.h>
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
-#include "pin_def.h"
-#include "driver/gpio.h"
+#include "input.h"
 
 // ---- Configurações de Layout ----
 #define KEYBOARD_X_OFFSET 4
@@ -152,42 +151,12 @@ static int handle_key_press() {
     return 0;
 }
 
-// ** REATORADO: Função de leitura de botões mais limpa e eficiente **
-int get_single_button_press() {
-    const int buttons[] = {BTN_UP, BTN_DOWN, BTN_LEFT, BTN_RIGHT, BTN_OK, BTN_BACK};
-    const int num_buttons = sizeof(buttons) / sizeof(buttons[0]);
-    int pressed_button = -1;
-
-    // 1. Espera soltar qualquer botão que já esteja pressionado
-    bool any_pressed;
-    do {
-        any_pressed = false;
-        for (int i = 0; i < num_buttons; i++) {
-            if (gpio_get_level(buttons[i]) == 0) {
-                any_pressed = true;
-                break;
-            }
-        }
-        if (any_pressed) vTaskDelay(pdMS_TO_TICKS(20));
-    } while (any_pressed);
-
-    // 2. Espera por um novo pressionamento
+// Espera o próximo toque; segurar um direcional repete o movimento
+static input_button_t wait_button(void) {
+    input_event_t ev;
     while (true) {
-        for (int i = 0; i < num_buttons; i++) {
-            if (gpio_get_level(buttons[i]) == 0) {
-                // Botão pressionado, aguarda debounce
-                vTaskDelay(pdMS_TO_TICKS(50));
-                // Confirma se ainda está pressionado
-                if (gpio_get_level(buttons[i]) == 0) {
-                    // Espera soltar o botão
-                    while (gpio_get_level(buttons[i]) == 0) {
-                        vTaskDelay(pdMS_TO_TICKS(10));
-                    }
-                    return buttons[i]; // Retorna o botão que foi pressionado
-                }
-            }
-        }
-        vTaskDelay(pdMS_TO_TICKS(20));
+        if (!input_wait_event(&ev, INPUT_WAIT_FOREVER)) continue;
+        if (ev.type == INPUT_EVENT_PRESS || ev.type == INPUT_EVENT_REPEAT) return ev.button;
     }
 }
 
@@ -198,18 +167,19 @@ bool show_keyboard_ui(char* buffer, int buffer_size, const char* prompt) {
     cursor_x = 0;
     cursor_y = 0;
     current_layout = LAYOUT_LOWERCASE;
+    input_flush();
     
     while (1) {
         draw_keyboard(prompt);
         st7789_flush();
-        int button = get_single_button_press();
+        input_button_t button = wait_button();
         
-        if (button == BTN_OK) {
+        if (button == INPUT_BTN_OK) {
             if (handle_key_press() == 1) { // Ação foi "Salvar"
                 st7789_set_text_size(2); 
                 return true;
             }
-        } else if (button == BTN_BACK) {
+        } else if (button == INPUT_BTN_BACK) {
             if (strlen(text_buffer) > 0) {
                 text_buffer[strlen(text_buffer) - 1] = '\0';
             } else { // Sai se o buffer estiver vazio
@@ -219,10 +189,10 @@ bool show_keyboard_ui(char* buffer, int buffer_size, const char* prompt) {
         } else {
             // ** REATORADO: Lógica de navegação mais robusta **
             int dx = 0, dy = 0;
-            if (button == BTN_RIGHT) dx = 1;
-            if (button == BTN_LEFT) dx = -1;
-            if (button == BTN_DOWN) dy = 1;
-            if (button == BTN_UP) dy = -1;
+            if (button == INPUT_BTN_RIGHT) dx = 1;
+            if (button == INPUT_BTN_LEFT) dx = -1;
+            if (button == INPUT_BTN_DOWN) dy = 1;
+            if (button == INPUT_BTN_UP) dy = -1;
 
             const char* (*keys)[NUM_COLS] = (current_layout == LAYOUT_LOWERCASE) ? layout_lowercase : (current_layout == LAYOUT_UPPERCASE) ? layout_uppercase : layout_symbols;
             
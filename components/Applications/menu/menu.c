@@ -15,8 +15,8 @@
 
 #include "menu_generic.h"
 #include "st7789.h"
-#include "pin_def.h"
-#include "driver/gpio.h"
+#include "ui.h"
+#include "input.h"
 #include "led_control.h"
 #include "home.h"
 #include "wifi.h"
@@ -31,6 +31,7 @@
 #include "GPIO.h"
 #include "storage_read.h"
 #include "storage_dir.h"
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 
@@ -57,21 +58,21 @@ static app_state_t current_state = STATE_HOME;
 
 
 MenuItem main_menu_items[] = {
-    {"WiFi", wifi_main, show_wifi_menu},
-    {"Bluetooth", blu_main, show_bluetooth_menu},
-    {"NFC", nfc_main, NULL},
-    {"RF", rf_main, NULL},
-    {"Infravermelho", infra_main, show_infrared_menu},
-    {"BadUSB", bad, show_bad_usb_menu},
-    {"GPIOS", conf_main, show_gpio_menu},
-    {"MicroSD", sd_main, show_sd_menu},
+    {"WiFi", &wifi_main, show_wifi_menu},
+    {"Bluetooth", &blu_main, show_bluetooth_menu},
+    {"NFC", &nfc_main, NULL},
+    {"RF", &rf_main, NULL},
+    {"Infravermelho", &infra_main, show_infrared_menu},
+    {"BadUSB", &bad, show_bad_usb_menu},
+    {"GPIOS", &conf_main, show_gpio_menu},
+    {"MicroSD", &sd_main, show_sd_menu},
 };
 
 MenuItem config_menu_items[] = {
-    {"Brilho", brilho, show_brightness_screen},
-    {"bluetooth", blu_main, NULL},
-    {"Buzzer", Music, NULL},
-    {"Tela", inatividade, NULL},
+    {"Brilho", &brilho, show_brightness_screen},
+    {"bluetooth", &blu_main, NULL},
+    {"Buzzer", &Music, NULL},
+    {"Tela", &inatividade, NULL},
     {"Bateria", NULL, show_battery_screen},
 };
 
@@ -90,14 +91,8 @@ Menu Config_main = {
 
 // Task da interface
 void menu_task(void *pvParameters) {
-    gpio_config_t io_conf = {
-        .intr_type = GPIO_INTR_DISABLE,
-        .mode = GPIO_MODE_INPUT,
-        .pin_bit_mask = (1ULL << BTN_UP) | (1ULL << BTN_DOWN) | (1ULL << BTN_OK) | (1ULL << BTN_BACK) | (1ULL << BTN_LEFT),
-        .pull_up_en = GPIO_PULLUP_ENABLE,
-        .pull_down_en = GPIO_PULLDOWN_DISABLE,
-    };
-    gpio_config(&io_conf);
+    // Os botões passam a ser lidos por interrupção pelo serviço de entrada
+    input_init();
 
     current_state = STATE_HOME;
 
@@ -106,18 +101,17 @@ void menu_task(void *pvParameters) {
             case STATE_HOME:
                 home();
                 led_blink_blue();
+                input_flush();
                 while (current_state == STATE_HOME) {
-                    if (!gpio_get_level(BTN_LEFT)) {
+                    input_event_t ev;
+                    if (!input_wait_event(&ev, INPUT_WAIT_FOREVER)) continue;
+                    if (ev.type != INPUT_EVENT_PRESS) continue;
+
+                    if (ev.button == INPUT_BTN_LEFT) {
                         current_state = STATE_MENU;
-                        vTaskDelay(pdMS_TO_TICKS(1000));
-                        break;
-                    } else if (!gpio_get_level(BTN_DOWN)) {
+                    } else if (ev.button == INPUT_BTN_DOWN) {
                         current_state = STATE_CONFIG;
-                        vTaskDelay(pdMS_TO_TICKS(50));
-                        break;
                     }
-
-                    vTaskDelay(pdMS_TO_TICKS(10));
                 }
                 break;
 
@@ -133,8 +127,6 @@ void menu_task(void *pvParameters) {
                 current_state = STATE_HOME;
                 break;
         }
-
-        vTaskDelay(pdMS_TO_TICKS(50));
     }
 }
 
@@ -142,6 +134,8 @@ typedef struct {
     char names[32][64];
     bool is_dir[32];
     int count;
+    char display[32][35];          // Nome com prefixo, como aparece na lista
+    const char *labels[32];
 } file_list_t;
 
 static void list_callback(const char *name, bool is_dir, void *user_data) {
@@ -154,34 +148,46 @@ static void list_callback(const char *name, bool is_dir, void *user_data) {
     }
 }
 
-void draw_file_list(const file_list_t *list, int selected_index) {
-    st7789_fill_screen_fb(COLOR_BLACK);
-    st7789_draw_text_fb(5, 5, "MicroSD", COLOR_WHITE, COLOR_BLACK);
-    st7789_draw_hline_fb(0, 25, 240, COLOR_GRAY);
+// Monta os rótulos exibidos pela lista a partir dos nomes lidos do cartão
+static void build_file_labels(file_list_t *list) {
+    for (int i = 0; i < list->count; i++) {
+        const char* prefix = list->is_dir[i] ? "[D] " : "    ";
+
+        // "%.28s" limita o nome: 4 (prefixo) + 28 (nome) + 1 (null) cabem nos 35 bytes.
+        snprintf(list->display[i], sizeof(list->display[i]), "%s%.28s", prefix, list->names[i]);
+        list->labels[i] = list->display[i];
+    }
+}
+
+// Tela da lista de arquivos: título, divisória e a lista rolável
+typedef struct {
+    ui_screen_t screen;
+    ui_label_t title;
+    ui_widget_t divider;
+    ui_label_t empty;
+    ui_list_t list;
+} file_list_screen_t;
+
+static void draw_divider(ui_widget_t *w) {
+    st7789_draw_hline_fb(w->x, w->y, w->w, COLOR_GRAY);
+}
 
+static void file_list_screen_init(file_list_screen_t *s, const file_list_t *list) {
+    ui_screen_init(&s->screen, COLOR_BLACK);
+    ui_label_init(&s->title, 5, 5, 230, 7, "MicroSD", COLOR_WHITE, COLOR_BLACK);
+    ui_widget_init(&s->divider, 0, 25, 240, 1, draw_divider, COLOR_BLACK);
+    ui_list_init(&s->list, 0, 35, 240, 13 * 15, 15, COLOR_WHITE, COLOR_BLACK, COLOR_BLACK, COLOR_WHITE);
+    ui_list_set_items(&s->list, list->labels, list->count);
+    ui_list_set_scrollbar(&s->list, true);
+    ui_label_init(&s->empty, 20, 100, 200, 7, "Nenhum arquivo encontrado", COLOR_YELLOW, COLOR_BLACK);
+
+    ui_screen_add(&s->screen, &s->title.base);
+    ui_screen_add(&s->screen, &s->divider);
     if (list->count == 0) {
-        st7789_draw_text_fb(20, 100, "Nenhum arquivo encontrado", COLOR_YELLOW, COLOR_BLACK);
+        ui_screen_add(&s->screen, &s->empty.base);
     } else {
-        for (int i = 0; i < list->count; i++) {
-            uint16_t text_color = (i == selected_index) ? COLOR_BLACK : COLOR_WHITE;
-            uint16_t bg_color = (i == selected_index) ? COLOR_WHITE : COLOR_BLACK;
-            
-            char display_name[35];
-
-            // --- INÍCIO DA CORREÇÃO ---
-            const char* prefix = list->is_dir[i] ? "[D] " : "    ";
-            const char* filename = list->names[i];
-
-            // A mágica está no "%.28s". Isso diz ao snprintf:
-            // "Pegue a string 'filename', mas use no máximo 28 caracteres dela."
-            // Isso garante que 4 (prefixo) + 28 (nome) + 1 (null) cabem nos 35 bytes.
-            snprintf(display_name, sizeof(display_name), "%s%.28s", prefix, filename);
-            // --- FIM DA CORREÇÃO ---
-            
-            st7789_draw_text_fb(10, 35 + (i * 15), display_name, text_color, bg_color);
-        }
+        ui_screen_add(&s->screen, &s->list.base);
     }
-    st7789_flush();
 }
 
 void show_file_content_screen(const char* filename, const char* content) {
@@ -195,10 +201,11 @@ void show_file_content_screen(const char* filename, const char* content) {
     st7789_flush();
 
     // Espera o usuário pressionar "Voltar"
-    vTaskDelay(pdMS_TO_TICKS(500));
-    while (gpio_get_level(BTN_BACK)) {
-        vTaskDelay(pdMS_TO_TICKS(50));
-    }
+    input_event_t ev;
+    input_flush();
+    do {
+        input_wait_event(&ev, INPUT_WAIT_FOREVER);
+    } while (ev.button != INPUT_BTN_BACK || ev.type != INPUT_EVENT_PRESS);
 }
 
 void show_sd_menu(void) {
@@ -207,9 +214,10 @@ void show_sd_menu(void) {
     if (file_list == NULL) return;
 
     file_list->count = 0;
-    int selected_item = 0;
 
-    if (storage_dir_list("/", list_callback, file_list) != ESP_OK) {
+    // Pastas primeiro, por nome; a listagem fica em cache até o diretório mudar
+    if (storage_dir_list_sorted("/", STORAGE_SORT_NAME, STORAGE_SORT_DIRS_FIRST,
+                                list_callback, file_list) != ESP_OK) {
         st7789_fill_screen_fb(COLOR_BLACK);
         st7789_draw_text_fb(20, 100, "Erro ao ler o cartao SD!", COLOR_RED, COLOR_BLACK);
         st7789_flush();
@@ -218,22 +226,38 @@ void show_sd_menu(void) {
         return;
     }
 
-    while (1) {
-        draw_file_list(file_list, selected_item);
-
-        if (!gpio_get_level(BTN_DOWN)) {
-            selected_item = (selected_item + 1) % (file_list->count == 0 ? 1 : file_list->count);
-            vTaskDelay(pdMS_TO_TICKS(200));
-        } else if (!gpio_get_level(BTN_UP)) {
-            selected_item = (selected_item - 1 + (file_list->count == 0 ? 1 : file_list->count)) % (file_list->count == 0 ? 1 : file_list->count);
-            vTaskDelay(pdMS_TO_TICKS(200));
-        } else if (!gpio_get_level(BTN_OK)) {
+    build_file_labels(file_list);
+
+    file_list_screen_t* ui = malloc(sizeof(file_list_screen_t));
+    if (ui == NULL) {
+        free(file_list);
+        return;
+    }
+    file_list_screen_init(ui, file_list);
+    ui_screen_show(&ui->screen);
+
+    bool running = true;
+    input_flush();
+
+    while (running) {
+        input_event_t ev;
+        if (!input_wait_event(&ev, INPUT_WAIT_FOREVER)) continue;
+        bool press = ev.type == INPUT_EVENT_PRESS;
+
+        if (ev.button == INPUT_BTN_DOWN && (press || ev.type == INPUT_EVENT_REPEAT)) {
+            ui_list_move(&ui->list, 1);
+        } else if (ev.button == INPUT_BTN_UP && (press || ev.type == INPUT_EVENT_REPEAT)) {
+            ui_list_move(&ui->list, -1);
+        } else if (ev.button == INPUT_BTN_OK && press) {
+            int selected_item = ui->list.selected;
             if (file_list->count > 0 && !file_list->is_dir[selected_item]) {
                 char* file_content = malloc(2048);
                 if (file_content) {
                     char file_path[256];
                     snprintf(file_path, sizeof(file_path), "/%s", file_list->names[selected_item]);
 
+                    // As telas de conteúdo e de erro desenham no modo imediato
+                    ui_screen_hide();
                     if (storage_read_string(file_path, file_content, 2048) == ESP_OK) {
                         show_file_content_screen(file_list->names[selected_item], file_content);
                     } else {
@@ -242,15 +266,17 @@ void show_sd_menu(void) {
                         st7789_flush();
                         vTaskDelay(pdMS_TO_TICKS(1500));
                     }
+                    input_flush();
+                    ui_screen_show(&ui->screen);
                     free(file_content);
                 }
             }
-            vTaskDelay(pdMS_TO_TICKS(200));
-        } else if (!gpio_get_level(BTN_BACK)) {
-            vTaskDelay(pdMS_TO_TICKS(200));
-            break; 
+        } else if (ev.button == INPUT_BTN_BACK && press) {
+            running = false;
         }
-        vTaskDelay(pdMS_TO_TICKS(50));
     }
+
+    ui_screen_hide();
+    free(ui);
     free(file_list);
 }
@@ -14,10 +14,11 @@
 
 #pragma once
 #include <stdint.h>
+#include "asset.h"
 
 typedef struct {
     const char* label;
-    const uint16_t* icon;
+    const asset_image_t* icon;
     void (*action)(void);
 } MenuItem;
 
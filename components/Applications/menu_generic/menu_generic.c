@@ -14,8 +14,9 @@
 
 #include "menu_generic.h"
 #include "st7789.h"
-#include "pin_def.h"
-#include "driver/gpio.h"
+#include "st7789_asset.h"
+#include "ui.h"
+#include "input.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
 #include "menu.h"
@@ -24,17 +25,21 @@
 #define ITEM_HEIGHT         50
 #define ITEM_WIDTH          220
 #define ITEM_SPACING        8
-#define SCROLL_BAR_WIDTH    5
+#define MAX_VISIBLE_ITEMS   4
+#define ROW_HEIGHT          60
+#define START_Y             10
 
 
-static void draw_menu_item(Menu* menu, int index, int posY, bool isSelected) {
+// Desenha um item na linha (x, y) da lista; o fundo já foi limpo pela lista
+static void draw_menu_item(ui_list_t *list, int index, int x, int y, int w, int h, bool isSelected) {
+    Menu* menu = (Menu*)list->user;
     const MenuItem* item = &menu->items[index];
+    int posY = y + START_Y;
 
     uint16_t rect_color = isSelected ? ST7789_COLOR_WHITE : ST7789_COLOR_PURPLE;
     
     const int iconSize = 24;
     const int fontHeight = 16;
-    const int padding = 10;
 
     int contentHeight = iconSize > fontHeight ? iconSize : fontHeight;
     int contentY = posY + (ITEM_HEIGHT - contentHeight) / 2;
@@ -50,7 +55,7 @@ static void draw_menu_item(Menu* menu, int index, int posY, bool isSelected) {
     int textX = iconX + iconSize + 10;
 
     if (item->icon != NULL) {
-        st7789_draw_image_fb(iconX, iconY, iconSize, iconSize, item->icon);
+        st7789_draw_asset_fb(iconX, iconY, item->icon);
     }
     st7789_draw_text_fb(textX, textY, item->label, ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
 
@@ -63,86 +68,53 @@ static void draw_menu_item(Menu* menu, int index, int posY, bool isSelected) {
 }
 
 
-
-static void draw_scroll_bar(Menu* menu, int scrollOffset) {
-    const int maxVisibleItems = 4;
-
-    if (menu->item_count <= maxVisibleItems) {
-        return; 
-    }
-
-    int screenHeight = ST7789_HEIGHT;
-    int usableHeight = screenHeight;
-
-    int spacing = 5;
-    for (int y = 0; y < screenHeight; y += spacing) {
-        st7789_draw_pixel_fb(ST7789_WIDTH - SCROLL_BAR_WIDTH / 2, y, ST7789_COLOR_GRAY);
-    }
-
-    float scrollBarHeight = (float)usableHeight * ((float)maxVisibleItems / menu->item_count);
-    if (scrollBarHeight < 6) scrollBarHeight = 6;
-
-    float maxScrollArea = usableHeight - scrollBarHeight;
-    float scrollY = ((float)scrollOffset / (menu->item_count - maxVisibleItems)) * maxScrollArea;
-    if (scrollY > maxScrollArea) scrollY = maxScrollArea;
-
-    st7789_fill_round_rect_fb(
-        237,                  
-        (int)scrollY,         
-        6,                    
-        (int)scrollBarHeight, 
-        3,                    
-        ST7789_COLOR_PURPLE   
-    );
-}
-    
-
-
+// A lista é retida: trocar a seleção redesenha só os dois itens afetados e
+// uma tela parada não gera nenhum envio ao display.
 void show_menu(Menu* menu) {
-    const int maxVisibleItems = 4;
-    const int startY = 10;
-    const int itemHeight = 60;
-
-    int selectedIndex = 0;
-    int scrollOffset = 0;
+    ui_screen_t screen;
+    ui_list_t list;
+
+    ui_screen_init(&screen, ST7789_COLOR_BLACK);
+    ui_list_init(&list, 0, 0, ST7789_WIDTH, MAX_VISIBLE_ITEMS * ROW_HEIGHT, ROW_HEIGHT,
+                 ST7789_COLOR_WHITE, ST7789_COLOR_BLACK, ST7789_COLOR_WHITE, ST7789_COLOR_PURPLE);
+    ui_list_set_items(&list, NULL, menu->item_count);
+    ui_list_set_drawer(&list, draw_menu_item, menu);
+    ui_list_set_scrollbar(&list, true);
+    ui_screen_add(&screen, &list.base);
+    ui_screen_show(&screen);
 
     bool inMenu = true;
+    input_flush();
 
     while (inMenu) {
-        st7789_fill_screen_fb(ST7789_COLOR_BLACK);
-
-        if (selectedIndex < scrollOffset) {
-            scrollOffset = selectedIndex;
-        } else if (selectedIndex >= scrollOffset + maxVisibleItems) {
-            scrollOffset = selectedIndex - maxVisibleItems + 1;
-        }
-
-        for (int i = 0; i < maxVisibleItems; i++) {
-            int menuIndex = i + scrollOffset;
-            if (menuIndex < menu->item_count) {
-                draw_menu_item(menu, menuIndex, startY + i * itemHeight, menuIndex == selectedIndex);
-            }
+        input_event_t ev;
+        if (!input_wait_event(&ev, INPUT_WAIT_FOREVER)) continue;
+        bool press = ev.type == INPUT_EVENT_PRESS;
+
+        switch (ev.button) {
+            case INPUT_BTN_UP:
+                if (press || ev.type == INPUT_EVENT_REPEAT) ui_list_move(&list, -1);
+                break;
+            case INPUT_BTN_DOWN:
+                if (press || ev.type == INPUT_EVENT_REPEAT) ui_list_move(&list, 1);
+                break;
+            case INPUT_BTN_OK:
+                if (press && menu->items[list.selected].action) {
+                    // A ação desenha no modo imediato; a lista volta inteira depois
+                    ui_screen_hide();
+                    menu->items[list.selected].action();
+                    // Descarta o que a ação deixou na fila (telas que ainda leem os pinos)
+                    input_flush();
+                    ui_screen_show(&screen);
+                }
+                break;
+            case INPUT_BTN_BACK:
+                if (press) inMenu = false;
+                break;
+            default:
+                break;
         }
-
-        draw_scroll_bar(menu, scrollOffset);
-
-        st7789_flush();
-
-        if (!gpio_get_level(BTN_UP)) {
-            selectedIndex = (selectedIndex - 1 + menu->item_count) % menu->item_count;
-            vTaskDelay(pdMS_TO_TICKS(150));
-        } else if (!gpio_get_level(BTN_DOWN)) {
-            selectedIndex = (selectedIndex + 1) % menu->item_count;
-            vTaskDelay(pdMS_TO_TICKS(150));
-        } else if (!gpio_get_level(BTN_OK)) {
-            if (menu->items[selectedIndex].action)
-                menu->items[selectedIndex].action();
-            vTaskDelay(pdMS_TO_TICKS(200));
-        } else if (!gpio_get_level(BTN_BACK)) {
-            inMenu = false;
-            vTaskDelay(pdMS_TO_TICKS(200));
-        }
-
-        vTaskDelay(pdMS_TO_TICKS(50));
     }
+
+    ui_screen_hide();
 }
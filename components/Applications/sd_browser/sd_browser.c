@@ -64,8 +64,10 @@ void sd_browser_start(void) {
     
     file_list->count = 0;
 
-    // Tenta listar os ficheiros da raiz "/"
-    if (storage_dir_list("/", list_callback, file_list) != ESP_OK) {
+    // Tenta listar os ficheiros da raiz "/" (pastas primeiro, por nome; a
+    // listagem fica em cache, reabrir o browser não relê o cartão)
+    if (storage_dir_list_sorted("/", STORAGE_SORT_NAME, STORAGE_SORT_DIRS_FIRST,
+                                list_callback, file_list) != ESP_OK) {
         menu_draw_header("Erro no SD Card");
         st7789_draw_text_fb(20, 100, "Erro ao ler o cartao SD!", ST7789_COLOR_RED, ST7789_COLOR_BLACK);
         st7789_flush();
@@ -84,7 +86,7 @@ void sd_browser_start(void) {
     for (int i = 0; i < file_list->count; i++) {
         sub_menu_items[i].label = file_list->names[i];
         // Define o ícone com base se é diretório ou não
-        sub_menu_items[i].icon = file_list->is_dir[i] ? icon_folder : icon_file;
+        sub_menu_items[i].icon = file_list->is_dir[i] ? &icon_folder : &icon_file;
         sub_menu_items[i].action = NULL;
     }
 
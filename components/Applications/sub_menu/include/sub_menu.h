@@ -17,11 +17,12 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include "asset.h"
 
 // Estrutura única para todos os itens de menu
 typedef struct SubMenuItem {
     const char *label;
-    const uint16_t *icon;
+    const asset_image_t *icon;
     void (*action)(void); 
 } SubMenuItem;
 
@@ -16,6 +16,7 @@
 
 // Dependências
 #include "st7789.h"
+#include "st7789_asset.h"
 #include "driver/gpio.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
@@ -166,7 +167,7 @@ void menu_draw_item(const SubMenuItem *item, int posY, bool selected) {
     // Desenha o ícone, se existir
     if (item->icon) {
         int iconY = posY + (itemHeight - iconSize) / 2;
-        st7789_draw_image_fb(iconX, iconY, iconSize, iconSize, item->icon);
+        st7789_draw_asset_fb(iconX, iconY, item->icon);
     }
     
     // ✨ NOVO: Desenha a bolinha de seleção no canto direito se o item estiver selecionado
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "traffic_analyzer.h"
+#include <stdlib.h>
 #include <string.h>
 #include <stdio.h>
 #include <stdatomic.h>
@@ -24,6 +25,7 @@
 #include "esp_wifi.h"
 #include "esp_private/wifi.h"
 #include "st7789.h"
+#include "ui.h"
 #include "pin_def.h"
 #include "driver/gpio.h"
 #include "storage_write.h"
@@ -59,9 +61,19 @@ typedef struct {
     uint8_t data[1500];
 } packet_data_t;
 
+// Tela retida: a task de atualização só altera o modelo dos widgets
+typedef struct {
+    ui_screen_t screen;
+    ui_label_t title, pps, peak, status, filename;
+    ui_label_t cat_label[3], cat_value[3];
+    ui_progress_t cat_bar[3];
+    ui_widget_t rec;
+    ui_graph_t graph;
+} traffic_ui_t;
+
 static atomic_int g_mgmt_packets = 0, g_ctrl_packets = 0, g_data_packets = 0;
-static int g_pps_history[HISTORY_SIZE] = {0};
-static int g_history_index = 0, g_current_total_pps = 0, g_current_mgmt_pps = 0;
+static traffic_ui_t *g_ui = NULL;
+static int g_current_total_pps = 0, g_current_mgmt_pps = 0;
 static int g_current_ctrl_pps = 0, g_current_data_pps = 0, g_peak_pps = 0;
 static bool g_is_capturing_to_sd = false;
 static TaskHandle_t g_traffic_task_handle = NULL;
@@ -110,6 +122,7 @@ static void pcap_writer_task(void *pvParameters) {
         }
     }
     // --- ROTINA DE LIMPEZA DA TAREFA ---
+    storage_sync(g_capture_filename); // 0. Grava o que ainda está na fila de write-back
     if (g_pcap_queue != NULL) {
         vQueueDelete(g_pcap_queue); // 1. A tarefa apaga a fila que usou
         g_pcap_queue = NULL;        // 2. Sinaliza que a fila não existe mais
@@ -118,6 +131,89 @@ static void pcap_writer_task(void *pvParameters) {
     vTaskDelete(NULL); // 3. A tarefa se autodestrói
 }
 
+static int map_value(int value, int in_min, int in_max, int out_min, int out_max) {
+    if (value <= in_min) return out_min;
+    if (value >= in_max) return out_max;
+    return (value - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
+}
+
+static void draw_rec_indicator(ui_widget_t *w) {
+    st7789_fill_rect_fb(w->x, w->y, w->w, w->h, ST7789_COLOR_RED);
+}
+
+static void traffic_ui_init(traffic_ui_t *ui) {
+    static const char *cat_names[3] = { "Gestao:", "Controlo:", "Dados:" };
+    static const uint16_t cat_colors[3] = { ST7789_COLOR_CYAN, ST7789_COLOR_YELLOW, ST7789_COLOR_GREEN };
+
+    ui_screen_init(&ui->screen, ST7789_COLOR_BLACK);
+    ui_label_init(&ui->title, 0, 5, 240, 7, NULL, ST7789_COLOR_PURPLE, ST7789_COLOR_BLACK);
+    ui_label_set_align(&ui->title, UI_ALIGN_CENTER);
+    ui_widget_init(&ui->rec, 220, 5, 10, 10, draw_rec_indicator, ST7789_COLOR_BLACK);
+    ui->rec.visible = false;
+    ui_label_init(&ui->pps, 15, 35, 120, 7, NULL, ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
+    ui_label_init(&ui->peak, 140, 35, 95, 7, NULL, ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
+    ui_graph_init(&ui->graph, GRAPH_X, GRAPH_Y, GRAPH_WIDTH, GRAPH_HEIGHT, HISTORY_SIZE,
+                  0, 500, ST7789_COLOR_RED, ST7789_COLOR_BLACK);
+    ui_graph_set_grid(&ui->graph, 0, ST7789_COLOR_BLACK, ST7789_COLOR_DARKGRAY, false);
+
+    ui_screen_add(&ui->screen, &ui->title.base);
+    ui_screen_add(&ui->screen, &ui->rec);
+    ui_screen_add(&ui->screen, &ui->pps.base);
+    ui_screen_add(&ui->screen, &ui->peak.base);
+    ui_screen_add(&ui->screen, &ui->graph.base);
+
+    for (int i = 0; i < 3; i++) {
+        int y = 170 + i * 15;
+        ui_label_init(&ui->cat_label[i], GRAPH_X, y, 65, 7, cat_names[i], cat_colors[i], ST7789_COLOR_BLACK);
+        ui_progress_init(&ui->cat_bar[i], 80, y, 100, 10, cat_colors[i], ST7789_COLOR_BLACK, ST7789_COLOR_BLACK);
+        ui_label_init(&ui->cat_value[i], 190, y, 45, 7, "0", ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
+        ui_screen_add(&ui->screen, &ui->cat_label[i].base);
+        ui_screen_add(&ui->screen, &ui->cat_bar[i].base);
+        ui_screen_add(&ui->screen, &ui->cat_value[i].base);
+    }
+
+    ui_label_init(&ui->status, 10, 220, 135, 7, "Pressione OK para gravar", ST7789_COLOR_GRAY, ST7789_COLOR_BLACK);
+    ui_label_init(&ui->filename, 150, 220, 90, 7, NULL, ST7789_COLOR_GRAY, ST7789_COLOR_BLACK);
+    ui_screen_add(&ui->screen, &ui->status.base);
+    ui_screen_add(&ui->screen, &ui->filename.base);
+}
+
+static void traffic_ui_set_channel(traffic_ui_t *ui, int channel) {
+    ui_label_set_textf(&ui->title, "Analisador | Canal: %d", channel);
+}
+
+static void traffic_ui_set_capture(traffic_ui_t *ui, bool capturing) {
+    ui_lock();
+    ui_set_visible(&ui->rec, capturing);
+    ui_set_visible(&ui->filename.base, capturing);
+    if (capturing) {
+        ui_label_set_text(&ui->filename, g_capture_filename);
+        ui_label_set_textf(&ui->status, "Pacotes: %lu", g_packets_captured_count);
+    } else {
+        ui_label_set_text(&ui->status, "Pressione OK para gravar");
+    }
+    ui_unlock();
+}
+
+// Aplica uma nova amostra: gráfico, contadores e barras de proporção
+static void traffic_ui_update(traffic_ui_t *ui) {
+    int pps[3] = { g_current_mgmt_pps, g_current_ctrl_pps, g_current_data_pps };
+    int total_for_bar = (g_current_total_pps == 0) ? 1 : g_current_total_pps;
+
+    ui_lock();
+    ui_graph_push(&ui->graph, g_current_total_pps);
+    ui_label_set_textf(&ui->pps, "PPS: %d", g_current_total_pps);
+    ui_label_set_textf(&ui->peak, "Pico: %d", g_peak_pps);
+    for (int i = 0; i < 3; i++) {
+        ui_progress_set_value(&ui->cat_bar[i], map_value(pps[i], 0, total_for_bar, 0, 100));
+        ui_label_set_textf(&ui->cat_value[i], "%d", pps[i]);
+    }
+    if (g_is_capturing_to_sd) {
+        ui_label_set_textf(&ui->status, "Pacotes: %lu", g_packets_captured_count);
+    }
+    ui_unlock();
+}
+
 static void traffic_update_task(void *pvParameters) {
     const int update_interval_ms = 250;
     while (1) {
@@ -131,62 +227,24 @@ static void traffic_update_task(void *pvParameters) {
         g_current_data_pps = data_count * factor;
         g_current_total_pps = g_current_mgmt_pps + g_current_ctrl_pps + g_current_data_pps;
         if (g_current_total_pps > g_peak_pps) g_peak_pps = g_current_total_pps;
-        g_pps_history[g_history_index] = g_current_total_pps;
-        g_history_index = (g_history_index + 1) % HISTORY_SIZE;
-    }
-}
-
-static int map_value(int value, int in_min, int in_max, int out_min, int out_max) {
-    if (value <= in_min) return out_min;
-    if (value >= in_max) return out_max;
-    return (value - in_min) * (out_max - out_min) / (in_max - in_min) + out_min;
-}
-
-static void draw_ui_on_framebuffer(int channel) {
-    char buffer[64];
-    int max_graph_pps = 500;
-    st7789_fill_screen_fb(ST7789_COLOR_BLACK);
-    snprintf(buffer, sizeof(buffer), "Analisador | Canal: %d", channel);
-    st7789_draw_text_centered(120, 5, buffer, ST7789_COLOR_PURPLE);
-    if (g_is_capturing_to_sd) {
-        st7789_fill_rect_fb(220, 5, 10, 10, ST7789_COLOR_RED);
-        st7789_draw_text_fb(150, 220, g_capture_filename, ST7789_COLOR_GRAY, ST7789_COLOR_BLACK);
-        snprintf(buffer, sizeof(buffer), "Pacotes: %lu", g_packets_captured_count);
-        st7789_draw_text_fb(10, 220, buffer, ST7789_COLOR_GRAY, ST7789_COLOR_BLACK);
-    } else {
-         st7789_draw_text_fb(10, 220, "Pressione OK para gravar", ST7789_COLOR_GRAY, ST7789_COLOR_BLACK);
-    }
-    st7789_draw_rect_fb(GRAPH_X, GRAPH_Y, GRAPH_WIDTH, GRAPH_HEIGHT, ST7789_COLOR_DARKGRAY);
-    st7789_draw_text_fb(GRAPH_X, 170, "Gestao:", ST7789_COLOR_CYAN, ST7789_COLOR_BLACK);
-    st7789_draw_text_fb(GRAPH_X, 185, "Controlo:", ST7789_COLOR_YELLOW, ST7789_COLOR_BLACK);
-    st7789_draw_text_fb(GRAPH_X, 200, "Dados:", ST7789_COLOR_GREEN, ST7789_COLOR_BLACK);
-    for (int i = 0; i < GRAPH_WIDTH - 1; i++) {
-        int hist_idx1 = (g_history_index + i) % HISTORY_SIZE;
-        int hist_idx2 = (g_history_index + i + 1) % HISTORY_SIZE;
-        int y1 = GRAPH_Y + GRAPH_HEIGHT - map_value(g_pps_history[hist_idx1], 0, max_graph_pps, 0, GRAPH_HEIGHT -1);
-        int y2 = GRAPH_Y + GRAPH_HEIGHT - map_value(g_pps_history[hist_idx2], 0, max_graph_pps, 0, GRAPH_HEIGHT -1);
-        st7789_draw_line_fb(GRAPH_X + i, y1, GRAPH_X + i + 1, y2, ST7789_COLOR_RED);
+        if (g_ui) {
+            traffic_ui_update(g_ui);
+        }
     }
-    snprintf(buffer, sizeof(buffer), "PPS: %d", g_current_total_pps);
-    st7789_draw_text_fb(15, 35, buffer, ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
-    snprintf(buffer, sizeof(buffer), "Pico: %d", g_peak_pps);
-    st7789_draw_text_fb(140, 35, buffer, ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
-    int total_for_bar = (g_current_total_pps == 0) ? 1 : g_current_total_pps;
-    st7789_fill_rect_fb(80, 170, map_value(g_current_mgmt_pps, 0, total_for_bar, 0, 100), 10, ST7789_COLOR_CYAN);
-    st7789_fill_rect_fb(80, 185, map_value(g_current_ctrl_pps, 0, total_for_bar, 0, 100), 10, ST7789_COLOR_YELLOW);
-    st7789_fill_rect_fb(80, 200, map_value(g_current_data_pps, 0, total_for_bar, 0, 100), 10, ST7789_COLOR_GREEN);
-    snprintf(buffer, sizeof(buffer), "%d", g_current_mgmt_pps); st7789_draw_text_fb(190, 170, buffer, ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
-    snprintf(buffer, sizeof(buffer), "%d", g_current_ctrl_pps); st7789_draw_text_fb(190, 185, buffer, ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
-    snprintf(buffer, sizeof(buffer), "%d", g_current_data_pps); st7789_draw_text_fb(190, 200, buffer, ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
 }
 
 void show_traffic_analyzer(void) {
     int current_channel = 1;
     bool running = true;
-    g_history_index = 0;
     g_peak_pps = 0;
-    memset(g_pps_history, 0, sizeof(g_pps_history));
     g_is_capturing_to_sd = false;
+
+    g_ui = malloc(sizeof(traffic_ui_t));
+    if (g_ui == NULL) return;
+    traffic_ui_init(g_ui);
+    traffic_ui_set_channel(g_ui, current_channel);
+    ui_screen_show(&g_ui->screen);
+
     xTaskCreate(traffic_update_task, "traffic_task", 2048, NULL, 5, &g_traffic_task_handle);
     esp_wifi_set_promiscuous(true);
     esp_wifi_set_channel(current_channel, WIFI_SECOND_CHAN_NONE);
@@ -197,11 +255,13 @@ void show_traffic_analyzer(void) {
             current_channel = (current_channel % 13) + 1;
             esp_wifi_set_channel(current_channel, WIFI_SECOND_CHAN_NONE);
             g_peak_pps = 0;
+            traffic_ui_set_channel(g_ui, current_channel);
         } else if (!gpio_get_level(BTN_DOWN)) {
             while(!gpio_get_level(BTN_DOWN)) vTaskDelay(pdMS_TO_TICKS(10));
             current_channel = (current_channel == 1) ? 13 : current_channel - 1;
             esp_wifi_set_channel(current_channel, WIFI_SECOND_CHAN_NONE);
             g_peak_pps = 0;
+            traffic_ui_set_channel(g_ui, current_channel);
         } else if (!gpio_get_level(BTN_BACK)) {
             while(!gpio_get_level(BTN_BACK)) vTaskDelay(pdMS_TO_TICKS(10));
             running = false;
@@ -223,10 +283,12 @@ void show_traffic_analyzer(void) {
                 g_pcap_queue = xQueueCreate(20, sizeof(packet_data_t));
                 if (g_pcap_queue == NULL) {
                     g_is_capturing_to_sd = false;
+                    ui_screen_hide();
                     st7789_fill_rect_fb(0, 80, 240, 80, ST7789_COLOR_RED);
                     st7789_draw_text_centered(120, 100, "Erro: Pouca Memoria!", ST7789_COLOR_WHITE);
                     st7789_flush();
                     vTaskDelay(pdMS_TO_TICKS(2000));
+                    ui_screen_show(&g_ui->screen);
                 } else {
                     xTaskCreate(pcap_writer_task, "pcap_writer", 4096, NULL, 4, &g_pcap_writer_task_handle);
                 }
@@ -235,9 +297,8 @@ void show_traffic_analyzer(void) {
                 // A tarefa de escrita tratará de apagar a fila.
                 // Não fazemos mais nada aqui.
             }
+            traffic_ui_set_capture(g_ui, g_is_capturing_to_sd);
         }
-        draw_ui_on_framebuffer(current_channel);
-        st7789_flush();
         vTaskDelay(pdMS_TO_TICKS(100));
     }
     if (g_is_capturing_to_sd) {
@@ -247,4 +308,8 @@ void show_traffic_analyzer(void) {
     vTaskDelete(g_traffic_task_handle);
     esp_wifi_set_promiscuous(false);
     esp_wifi_set_promiscuous_rx_cb(NULL);
+
+    ui_screen_hide();
+    free(g_ui);
+    g_ui = NULL;
 }
@@ -23,6 +23,7 @@
 #include "led_control.h"
 #include "pin_def.h"
 #include "st7789.h"
+#include "st7789_asset.h"
 #include "sub_menu.h"
 #include "wifi_deauther.h"
 #include "wifi_service.h"
@@ -42,11 +43,11 @@ static void wifi_action_evil_twin(void);
 static void wifi_action_analyze(void); 
 // --- Itens do Menu WiFi ---
 static const SubMenuItem wifiMenuItems[] = {
-    { "Scan Redes", scan, wifi_action_scan },
-    { "Analisar Redes", analyzer_main, wifi_action_analyze }, 
-    { "Analisar Trafego", analyzer_main, show_traffic_analyzer },
-    { "Atacar Alvo",   deauth, wifi_action_attack },
-    { "Evil Twin",     evil, wifi_action_evil_twin },
+    { "Scan Redes", &scan, wifi_action_scan },
+    { "Analisar Redes", &analyzer_main, wifi_action_analyze }, 
+    { "Analisar Trafego", &analyzer_main, show_traffic_analyzer },
+    { "Atacar Alvo",   &deauth, wifi_action_attack },
+    { "Evil Twin",     &evil, wifi_action_evil_twin },
 };
 static const int wifiMenuSize = sizeof(wifiMenuItems) / sizeof(SubMenuItem);
 static bool g_is_scanning = false; // Sinalizador para controlar a tarefa de animação
@@ -71,9 +72,9 @@ void scan_animation_task(void *pvParameters) {
 
         // 3. Desenha a imagem correspondente a este frame da animação
         if (show_first_image) {
-            st7789_draw_bitmap_fb(-17, 79, octo_ant, 200, 179, ST7789_COLOR_PURPLE);
+            st7789_draw_asset_mono_fb(-17, 79, &octo_ant, ST7789_COLOR_PURPLE);
         } else {
-            st7789_draw_bitmap_fb(-17, 79, octo_ant1, 200, 179, ST7789_COLOR_PURPLE);
+            st7789_draw_asset_mono_fb(-17, 79, &octo_ant1, ST7789_COLOR_PURPLE);
         }
         
         // 4. Envia o frame completo (fundo preto + texto + imagem) para o ecrã
@@ -151,7 +152,7 @@ static void wifi_action_attack(void) {
             strncpy(ap_labels[i], (const char *)ap->ssid, sizeof(ap_labels[i]) - 1);
             ap_labels[i][sizeof(ap_labels[i]) - 1] = '\0';
             ap_menu[i].label = ap_labels[i];
-            ap_menu[i].icon = wifi_main;
+            ap_menu[i].icon = &wifi_main;
             ap_menu[i].action = NULL; // Ação não é necessária para um seletor
         }
     }
@@ -249,7 +250,7 @@ static void wifi_action_evil_twin(void) {
             strncpy(ap_labels[i], (const char *)ap->ssid, sizeof(ap_labels[i]) - 1);
             ap_labels[i][sizeof(ap_labels[i]) - 1] = '\0';
             ap_menu[i].label = ap_labels[i];
-            ap_menu[i].icon = wifi_main;
+            ap_menu[i].icon = &wifi_main;
             ap_menu[i].action = NULL;
         }
     }
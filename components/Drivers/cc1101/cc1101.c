@@ -15,6 +15,7 @@
 
 #include "cc1101.h"
 #include "spi.h"
+#include "spi_arbiter.h"
 #include "pin_def.h"
 #include <string.h>
 #include <esp_log.h>
@@ -25,25 +26,23 @@
 static const char *TAG = "CC1101";
 static spi_device_handle_t cc1101_spi;
 
+// Acessos ao CC1101 passam pelo árbitro na classe de rádio: um strobe ou
+// leitura de FIFO não espera mais que um bloco de outra transferência.
+#define CC1101_SPI_DEADLINE_US 500
+
 // Função auxiliar: Envia um strobe (comando) ao CC1101 via SPI
 void cc1101_strobe(uint8_t cmd)
 {
-    spi_transaction_t t = {
-        .length = 8,
-        .flags = SPI_TRANS_USE_TXDATA
-    };
-    t.tx_data[0] = cmd;
-    spi_device_transmit(cc1101_spi, &t);
+    spi_arbiter_transfer(SPI_DEVICE_CC1101, SPI_PRIO_RADIO, &cmd, NULL, 1,
+                         CC1101_SPI_DEADLINE_US);
 }
 
 // Função auxiliar: Escreve um valor em um registrador do CC1101
 void cc1101_write_reg(uint8_t reg, uint8_t val)
 {
     uint8_t tx_data[2] = {reg, val};
-    spi_transaction_t t = {0};
-    t.length = 8 * 2;
-    t.tx_buffer = tx_data;
-    spi_device_transmit(cc1101_spi, &t);
+    spi_arbiter_transfer(SPI_DEVICE_CC1101, SPI_PRIO_RADIO, tx_data, NULL, 2,
+                         CC1101_SPI_DEADLINE_US);
 }
 
 // Função auxiliar: Lê um valor de um registrador do CC1101
@@ -51,11 +50,8 @@ uint8_t cc1101_read_reg(uint8_t reg)
 {
     uint8_t tx_data[2] = {0x80 | reg, 0};
     uint8_t rx_data[2] = {0};
-    spi_transaction_t t = {0};
-    t.length = 8 * 2;
-    t.tx_buffer = tx_data;
-    t.rx_buffer = rx_data;
-    spi_device_transmit(cc1101_spi, &t);
+    spi_arbiter_transfer(SPI_DEVICE_CC1101, SPI_PRIO_RADIO, tx_data, rx_data, 2,
+                         CC1101_SPI_DEADLINE_US);
     return rx_data[1];
 }
 
@@ -63,14 +59,11 @@ uint8_t cc1101_read_reg(uint8_t reg)
 void cc1101_write_burst(uint8_t reg, const uint8_t *buf, uint8_t len)
 {
     uint8_t addr = 0x40 | reg; // Burst write flag = 0x40
-    spi_transaction_t t = {0};
-    t.length = 8 * (len + 1);
-    uint8_t *data = malloc(len + 1);
+    uint8_t data[256];         // len é uint8_t: cabe sempre na pilha
     data[0] = addr;
     memcpy(&data[1], buf, len);
-    t.tx_buffer = data;
-    spi_device_transmit(cc1101_spi, &t);
-    free(data);
+    spi_arbiter_transfer(SPI_DEVICE_CC1101, SPI_PRIO_RADIO, data, NULL, len + 1,
+                         CC1101_SPI_DEADLINE_US);
 }
 
 // Inicializa CC1101 usando o driver SPI centralizado
@@ -31,6 +31,8 @@ typedef struct {
     int clock_speed_hz;
     int mode;
     int queue_size;
+    transaction_cb_t pre_cb;   // Opcional: chamado antes de cada transação (ISR)
+    transaction_cb_t post_cb;  // Opcional: chamado ao final de cada transação (ISR)
 } spi_device_config_t;
 
 // Declarações das funções
@@ -0,0 +1,109 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef SPI_ARBITER_H
+#define SPI_ARBITER_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "spi.h"
+
+// Tamanho máximo de um bloco de transferência longa. Entre dois blocos o
+// árbitro reavalia a fila, então uma transação de prioridade maior espera no
+// máximo um bloco (~1,6 ms a 40 MHz).
+#define SPI_ARBITER_CHUNK_BYTES  8192
+
+// Número máximo de jobs pendentes no árbitro. Os assíncronos (display) ficam
+// limitados a SPI_ARBITER_MAX_ASYNC, então sobram slots para as transferências
+// síncronas do rádio e do SD mesmo com um flush inteiro na fila.
+#define SPI_ARBITER_MAX_JOBS     24
+#define SPI_ARBITER_MAX_ASYNC    16
+
+// Classes de prioridade (menor valor = mais urgente)
+typedef enum {
+    SPI_PRIO_RADIO = 0,   // CC1101: strobes, FIFO, sensível a latência
+    SPI_PRIO_CONTROL,     // Registradores e comandos curtos
+    SPI_PRIO_STORAGE,     // SD card
+    SPI_PRIO_BULK,        // Display e transferências longas
+    SPI_PRIO_MAX
+} spi_priority_t;
+
+typedef void (*spi_job_done_cb_t)(esp_err_t result, void *arg);
+
+// Função executada com o barramento reservado (ex: um comando completo do SD,
+// que o driver sdspi envia em várias transações)
+typedef esp_err_t (*spi_exec_fn_t)(void *arg);
+
+// Descritor de transação entregue ao árbitro
+typedef struct {
+    spi_device_id_t device;
+    spi_priority_t priority;
+    const uint8_t *tx;            // Pode ser NULL (somente leitura)
+    uint8_t *rx;                  // Pode ser NULL (somente escrita)
+    size_t len;                   // Em bytes
+    uint32_t deadline_us;         // Relativo ao envio; 0 = sem deadline
+    void *user;                   // Repassado em spi_transaction_t.user (pre_cb/post_cb)
+    spi_job_done_cb_t done_cb;    // Opcional, chamado na task do árbitro
+    void *done_arg;
+} spi_job_t;
+
+// Contadores por device
+typedef struct {
+    uint32_t jobs;                // Jobs concluídos
+    uint32_t chunks;              // Blocos transmitidos
+    uint64_t bytes;               // Bytes transferidos
+    uint64_t busy_us;             // Tempo de barramento ocupado (bytes / busy_us = vazão)
+    uint64_t wait_total_us;       // Soma dos tempos entre envio e conclusão
+    uint32_t wait_max_us;         // Pior latência entre envio e conclusão
+    uint32_t deadline_misses;     // Jobs concluídos após o deadline
+    uint32_t preemptions;         // Vezes que um job foi interrompido entre blocos
+    uint32_t inline_jobs;         // Jobs transmitidos direto na task do chamador
+} spi_device_stats_t;
+
+esp_err_t spi_arbiter_init(void);
+
+// Para o árbitro. Novos jobs são recusados a partir daqui; os pendentes
+// terminam com ESP_ERR_INVALID_STATE (done_cb ou retorno da chamada
+// síncrona). Só retorna depois que a task saiu e todos os slots voltaram.
+void spi_arbiter_deinit(void);
+bool spi_arbiter_running(void);
+
+// Enfileira um job; retorna imediatamente. O buffer tx/rx deve permanecer
+// válido até done_cb. ESP_ERR_NO_MEM se os slots assíncronos estiverem
+// ocupados, ESP_ERR_INVALID_STATE com o árbitro parado.
+esp_err_t spi_arbiter_submit(const spi_job_t *job);
+
+// Transfere e aguarda a conclusão. Com o barramento livre e nenhum job de
+// prioridade igual ou maior na fila, transmite direto na task que chamou,
+// sem passar pela task do árbitro; senão entra na fila.
+esp_err_t spi_arbiter_transfer(spi_device_id_t id, spi_priority_t priority,
+                               const uint8_t *tx, uint8_t *rx, size_t len,
+                               uint32_t deadline_us);
+
+// spi_arbiter_transfer com o descritor completo: job->user chega ao
+// pre_cb/post_cb do device (ex: pino DC do display). done_cb é ignorado.
+esp_err_t spi_arbiter_transfer_job(const spi_job_t *job);
+
+// Executa fn(arg) com o barramento reservado, com as mesmas regras de
+// spi_arbiter_transfer. Retorna o resultado de fn.
+esp_err_t spi_arbiter_exec(spi_device_id_t id, spi_priority_t priority,
+                           spi_exec_fn_t fn, void *arg, uint32_t deadline_us);
+
+void spi_arbiter_get_stats(spi_device_id_t id, spi_device_stats_t *stats);
+void spi_arbiter_reset_stats(void);
+
+#endif // SPI_ARBITER_H
@@ -14,6 +14,7 @@
 
 
 #include "spi.h"
+#include "spi_arbiter.h"
 #include "pin_def.h"
 #include "esp_log.h"
 #include <string.h>
@@ -24,6 +25,13 @@
 static spi_device_handle_t device_handles[SPI_DEVICE_MAX] = {NULL};
 static bool bus_initialized = false;
 
+// Classe de prioridade usada por spi_transmit() para cada device
+static const spi_priority_t default_priority[SPI_DEVICE_MAX] = {
+    [SPI_DEVICE_ST7789]  = SPI_PRIO_BULK,
+    [SPI_DEVICE_CC1101]  = SPI_PRIO_RADIO,
+    [SPI_DEVICE_SD_CARD] = SPI_PRIO_STORAGE,
+};
+
 esp_err_t spi_init(void) {
     if (bus_initialized) {
         ESP_LOGW(TAG, "SPI já inicializado");
@@ -47,6 +55,11 @@ esp_err_t spi_init(void) {
 
     bus_initialized = true;
     ESP_LOGI(TAG, "Barramento SPI inicializado");
+
+    ret = spi_arbiter_init();
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Árbitro indisponível, transmissões diretas: %s", esp_err_to_name(ret));
+    }
     return ESP_OK;
 }
 
@@ -71,7 +84,8 @@ esp_err_t spi_add_device(spi_device_id_t id, const spi_device_config_t *config)
         .spics_io_num = config->cs_pin,
         .queue_size = config->queue_size,
         .flags = 0,
-        .pre_cb = NULL,
+        .pre_cb = config->pre_cb,
+        .post_cb = config->post_cb,
     };
 
     esp_err_t ret = spi_bus_add_device(SPI3_HOST, &devcfg, &device_handles[id]);
@@ -96,16 +110,13 @@ esp_err_t spi_transmit(spi_device_id_t id, const uint8_t *data, size_t len) {
         return ESP_ERR_INVALID_ARG;
     }
 
-    spi_transaction_t trans = {
-        .length = len * 8,  // em bits
-        .tx_buffer = data,
-        .rx_buffer = NULL,
-    };
-
-    return spi_device_transmit(device_handles[id], &trans);
+    // Passa pelo árbitro com a prioridade padrão do device (ou direto, se parado)
+    return spi_arbiter_transfer(id, default_priority[id], data, NULL, len, 0);
 }
 
 esp_err_t spi_deinit(void) {
+    spi_arbiter_deinit();
+
     for (int i = 0; i < SPI_DEVICE_MAX; i++) {
         if (device_handles[i] != NULL) {
             spi_bus_remove_device(device_handles[i]);
@@ -0,0 +1,508 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "spi_arbiter.h"
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+#define TAG "SPI_ARB"
+
+#define ARBITER_TASK_STACK      4096    // Jobs exec rodam o driver sdspi nesta task
+#define ARBITER_TASK_PRIO       (configMAX_PRIORITIES - 2)
+#define ARBITER_POLLING_MAX     32      // Até este tamanho usa polling (menor latência)
+
+// Job interno: descritor + estado de execução
+typedef struct arb_job {
+    spi_job_t desc;
+    spi_exec_fn_t exec;           // Job de execução (desc.len = 0)
+    void *exec_arg;
+    size_t offset;                // Bytes já transmitidos
+    int64_t submit_us;
+    int64_t deadline_abs_us;      // INT64_MAX = sem deadline
+    esp_err_t result;
+    bool sync;                    // Chamador aguarda em done_sem e libera o slot
+    SemaphoreHandle_t done_sem;
+    struct arb_job *next;
+} arb_job_t;
+
+static arb_job_t job_pool[SPI_ARBITER_MAX_JOBS];
+static arb_job_t *free_list = NULL;
+static arb_job_t *pending[SPI_PRIO_MAX];     // Uma lista por classe, ordenada por deadline
+static spi_device_stats_t dev_stats[SPI_DEVICE_MAX];   // Protegido por lock
+
+static SemaphoreHandle_t lock = NULL;
+static SemaphoreHandle_t work_sem = NULL;    // Sinaliza novos jobs para a task
+static SemaphoreHandle_t slots_sem = NULL;   // Conta slots livres em job_pool
+static SemaphoreHandle_t async_sem = NULL;   // Conta slots livres para jobs assíncronos
+static SemaphoreHandle_t exit_sem = NULL;    // Dado pela task ao sair
+static TaskHandle_t arbiter_task = NULL;
+static volatile bool running = false;        // Aceitando jobs
+static volatile bool stopping = false;       // deinit em andamento
+static bool bus_claimed = false;             // Um job está no barramento (árbitro ou chamador)
+
+// Insere mantendo a ordem por deadline (EDF). Deadlines iguais ficam em FIFO;
+// um job retomado entre blocos volta à frente dos seus iguais, senão os
+// bytes de um mesmo device sairiam fora de ordem.
+static void insert_pending(arb_job_t *job, bool resume) {
+    arb_job_t **pp = &pending[job->desc.priority];
+    while (*pp && ((*pp)->deadline_abs_us < job->deadline_abs_us ||
+                   (!resume && (*pp)->deadline_abs_us == job->deadline_abs_us))) {
+        pp = &(*pp)->next;
+    }
+    job->next = *pp;
+    *pp = job;
+}
+
+// Retira o job mais urgente: classe de maior prioridade, menor deadline
+static arb_job_t *pop_next(void) {
+    for (int prio = 0; prio < SPI_PRIO_MAX; prio++) {
+        arb_job_t *job = pending[prio];
+        if (job) {
+            pending[prio] = job->next;
+            job->next = NULL;
+            return job;
+        }
+    }
+    return NULL;
+}
+
+static bool pending_up_to(spi_priority_t priority) {
+    for (int prio = 0; prio <= priority; prio++) {
+        if (pending[prio]) return true;
+    }
+    return false;
+}
+
+static arb_job_t *alloc_job(TickType_t timeout) {
+    if (xSemaphoreTake(slots_sem, timeout) != pdTRUE) {
+        return NULL;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    arb_job_t *job = free_list;
+    free_list = job->next;
+    xSemaphoreGive(lock);
+
+    SemaphoreHandle_t sem = job->done_sem;
+    memset(job, 0, sizeof(*job));
+    job->done_sem = sem;
+    return job;
+}
+
+static void free_job(arb_job_t *job) {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    job->next = free_list;
+    free_list = job;
+    xSemaphoreGive(lock);
+    xSemaphoreGive(slots_sem);
+}
+
+// Transmissão direta no device, sem passar pela fila
+static esp_err_t transmit_direct(spi_device_id_t id, const uint8_t *tx, uint8_t *rx,
+                                 size_t len, void *user) {
+    spi_device_handle_t handle = spi_get_handle(id);
+    if (!handle) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    spi_transaction_t t = {
+        .length = len * 8,
+        .tx_buffer = tx,
+        .rx_buffer = rx,
+        .user = user,
+    };
+
+    // Transferências curtas em polling evitam o custo da interrupção;
+    // as longas liberam a CPU enquanto o DMA trabalha.
+    if (len <= ARBITER_POLLING_MAX) {
+        return spi_device_polling_transmit(handle, &t);
+    }
+    return spi_device_transmit(handle, &t);
+}
+
+// Contadores: o caminho direto roda na task do chamador, em paralelo com a
+// task do árbitro, então toda atualização passa pelo lock
+static void account_chunk(spi_device_id_t id, size_t bytes, int64_t busy_us) {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    spi_device_stats_t *st = &dev_stats[id];
+    st->chunks++;
+    st->bytes += bytes;
+    st->busy_us += busy_us;
+    xSemaphoreGive(lock);
+}
+
+// Executa o próximo bloco do job. Só a classe BULK é dividida: nas demais o
+// CS precisa ficar ativo durante toda a transação (ex: burst do CC1101).
+static void run_chunk(arb_job_t *job) {
+    size_t remaining = job->desc.len - job->offset;
+    size_t n = remaining;
+    if (job->desc.priority == SPI_PRIO_BULK && n > SPI_ARBITER_CHUNK_BYTES) {
+        n = SPI_ARBITER_CHUNK_BYTES;
+    }
+
+    int64_t start = esp_timer_get_time();
+    esp_err_t ret;
+    if (job->exec) {
+        ret = job->exec(job->exec_arg);
+    } else {
+        ret = transmit_direct(job->desc.device,
+                              job->desc.tx ? job->desc.tx + job->offset : NULL,
+                              job->desc.rx ? job->desc.rx + job->offset : NULL,
+                              n, job->desc.user);
+    }
+    int64_t end = esp_timer_get_time();
+    account_chunk(job->desc.device, n, end - start);
+
+    job->offset += n;
+    if (ret != ESP_OK) {
+        job->result = ret;
+        job->offset = job->desc.len;  // Aborta o restante
+    }
+}
+
+static void account_job(spi_device_id_t id, int64_t submit_us, int64_t deadline_abs_us) {
+    int64_t now = esp_timer_get_time();
+    uint32_t wait = (uint32_t)(now - submit_us);
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    spi_device_stats_t *st = &dev_stats[id];
+    st->jobs++;
+    st->wait_total_us += wait;
+    if (wait > st->wait_max_us) st->wait_max_us = wait;
+    if (now > deadline_abs_us) st->deadline_misses++;
+    xSemaphoreGive(lock);
+}
+
+// Entrega o resultado: acorda o chamador síncrono ou chama done_cb e libera o slot
+static void finish_job(arb_job_t *job) {
+    if (job->sync) {
+        xSemaphoreGive(job->done_sem);
+        return;
+    }
+    spi_job_done_cb_t cb = job->desc.done_cb;
+    void *arg = job->desc.done_arg;
+    esp_err_t result = job->result;
+    free_job(job);
+    xSemaphoreGive(async_sem);
+    if (cb) {
+        cb(result, arg);
+    }
+}
+
+// Libera o barramento e acorda a task se houver trabalho para ela
+static void release_bus(void) {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    bus_claimed = false;
+    bool wake = !running || pending_up_to(SPI_PRIO_MAX - 1);
+    xSemaphoreGive(lock);
+    if (wake && xTaskGetCurrentTaskHandle() != arbiter_task) {
+        xSemaphoreGive(work_sem);
+    }
+}
+
+static void arbiter_task_fn(void *arg) {
+    arb_job_t *current = NULL;  // Job longo com blocos restantes
+
+    for (;;) {
+        xSemaphoreTake(lock, portMAX_DELAY);
+        arb_job_t *resumed = current;
+        if (current) {
+            insert_pending(current, true);
+            current = NULL;
+        }
+        arb_job_t *job = NULL;
+        if (running && !bus_claimed) {
+            job = pop_next();
+            bus_claimed = job != NULL;
+        }
+        if (resumed && job != resumed) {
+            dev_stats[resumed->desc.device].preemptions++;
+        }
+        bool stop = !running && !bus_claimed;
+        xSemaphoreGive(lock);
+
+        if (stop) {
+            break;
+        }
+        if (!job) {
+            xSemaphoreTake(work_sem, portMAX_DELAY);
+            continue;
+        }
+
+        run_chunk(job);
+        if (job->offset >= job->desc.len) {
+            account_job(job->desc.device, job->submit_us, job->deadline_abs_us);
+            finish_job(job);
+        } else {
+            current = job;
+        }
+        release_bus();
+    }
+
+    // Parando: os jobs que sobraram (inclusive um longo pela metade) terminam
+    // com erro, para que nenhum chamador fique preso em done_sem.
+    for (;;) {
+        xSemaphoreTake(lock, portMAX_DELAY);
+        arb_job_t *job = pop_next();
+        xSemaphoreGive(lock);
+        if (!job) break;
+        job->result = ESP_ERR_INVALID_STATE;
+        finish_job(job);
+    }
+
+    xSemaphoreGive(exit_sem);
+    vTaskDelete(NULL);
+}
+
+esp_err_t spi_arbiter_init(void) {
+    if (running) {
+        return ESP_OK;
+    }
+    if (stopping) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Semáforos são reaproveitados se o árbitro for reiniciado
+    if (!lock) lock = xSemaphoreCreateMutex();
+    if (!work_sem) work_sem = xSemaphoreCreateBinary();
+    if (!exit_sem) exit_sem = xSemaphoreCreateBinary();
+    if (!slots_sem) slots_sem = xSemaphoreCreateCounting(SPI_ARBITER_MAX_JOBS, SPI_ARBITER_MAX_JOBS);
+    if (!async_sem) async_sem = xSemaphoreCreateCounting(SPI_ARBITER_MAX_ASYNC, SPI_ARBITER_MAX_ASYNC);
+    if (!lock || !work_sem || !exit_sem || !slots_sem || !async_sem) {
+        ESP_LOGE(TAG, "Falha ao criar semáforos do árbitro");
+        return ESP_ERR_NO_MEM;
+    }
+
+    // O pool só é montado uma vez: cada alloc_job tem seu free_job, então
+    // ele continua íntegro mesmo com um chamador atrasado de antes do deinit
+    for (int i = 0; i < SPI_ARBITER_MAX_JOBS; i++) {
+        if (!job_pool[i].done_sem) {
+            job_pool[i].done_sem = xSemaphoreCreateBinary();
+        }
+        if (!job_pool[i].done_sem) {
+            return ESP_ERR_NO_MEM;
+        }
+    }
+    if (!free_list && uxSemaphoreGetCount(slots_sem) == SPI_ARBITER_MAX_JOBS) {
+        for (int i = 0; i < SPI_ARBITER_MAX_JOBS; i++) {
+            job_pool[i].next = free_list;
+            free_list = &job_pool[i];
+        }
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    memset(pending, 0, sizeof(pending));
+    memset(dev_stats, 0, sizeof(dev_stats));
+    bus_claimed = false;
+    xSemaphoreGive(lock);
+
+    running = true;
+    if (xTaskCreate(arbiter_task_fn, "spi_arbiter", ARBITER_TASK_STACK, NULL,
+                    ARBITER_TASK_PRIO, &arbiter_task) != pdPASS) {
+        running = false;
+        arbiter_task = NULL;
+        ESP_LOGE(TAG, "Falha ao criar task do árbitro");
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Árbitro SPI iniciado");
+    return ESP_OK;
+}
+
+void spi_arbiter_deinit(void) {
+    if (!lock || xTaskGetCurrentTaskHandle() == arbiter_task) {
+        return;  // Nunca iniciado, ou chamado de um done_cb
+    }
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    if (!running) {
+        xSemaphoreGive(lock);
+        return;
+    }
+    running = false;
+    stopping = true;
+    xSemaphoreGive(lock);
+
+    // A task termina o bloco em andamento, falha os pendentes e sai
+    xSemaphoreGive(work_sem);
+    xSemaphoreTake(exit_sem, portMAX_DELAY);
+    arbiter_task = NULL;
+
+    // Chamadores síncronos acordados com erro ainda devolvem o slot
+    while (uxSemaphoreGetCount(slots_sem) < SPI_ARBITER_MAX_JOBS) {
+        vTaskDelay(1);
+    }
+
+    stopping = false;
+    ESP_LOGI(TAG, "Árbitro SPI parado");
+}
+
+bool spi_arbiter_running(void) {
+    return running;
+}
+
+static esp_err_t enqueue(arb_job_t *job, const spi_job_t *desc, bool sync) {
+    job->desc = *desc;
+    job->sync = sync;
+    job->result = ESP_OK;
+    job->submit_us = esp_timer_get_time();
+    job->deadline_abs_us = desc->deadline_us ? job->submit_us + desc->deadline_us : INT64_MAX;
+
+    xSemaphoreTake(lock, portMAX_DELAY);
+    if (!running) {
+        xSemaphoreGive(lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    insert_pending(job, false);
+    xSemaphoreGive(lock);
+    xSemaphoreGive(work_sem);
+    return ESP_OK;
+}
+
+esp_err_t spi_arbiter_submit(const spi_job_t *job) {
+    if (!job || job->device >= SPI_DEVICE_MAX || job->priority >= SPI_PRIO_MAX || job->len == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (xSemaphoreTake(async_sem, 0) != pdTRUE) {
+        return ESP_ERR_NO_MEM;
+    }
+    arb_job_t *slot = alloc_job(0);
+    if (!slot) {
+        xSemaphoreGive(async_sem);
+        return ESP_ERR_NO_MEM;
+    }
+    esp_err_t ret = enqueue(slot, job, false);
+    if (ret != ESP_OK) {
+        free_job(slot);
+        xSemaphoreGive(async_sem);
+    }
+    return ret;
+}
+
+// Reserva o barramento para o próprio chamador: só com o árbitro ocioso e
+// nada de prioridade igual ou maior esperando, para não furar a fila.
+static bool claim_bus(spi_priority_t priority) {
+    xSemaphoreTake(lock, portMAX_DELAY);
+    bool ok = running && !bus_claimed && !pending_up_to(priority);
+    if (ok) {
+        bus_claimed = true;
+    }
+    xSemaphoreGive(lock);
+    return ok;
+}
+
+// Caminho comum de transfer e exec: direto com o barramento livre, senão pela fila
+static esp_err_t run_sync(const spi_job_t *desc, spi_exec_fn_t exec, void *exec_arg) {
+    // Sem árbitro (ou chamado de dentro de um done_cb): executa direto
+    if (stopping) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!running || xTaskGetCurrentTaskHandle() == arbiter_task) {
+        return exec ? exec(exec_arg)
+                    : transmit_direct(desc->device, desc->tx, desc->rx, desc->len, desc->user);
+    }
+
+    if (claim_bus(desc->priority)) {
+        int64_t start = esp_timer_get_time();
+        esp_err_t ret = exec ? exec(exec_arg)
+                             : transmit_direct(desc->device, desc->tx, desc->rx, desc->len, desc->user);
+        int64_t end = esp_timer_get_time();
+
+        xSemaphoreTake(lock, portMAX_DELAY);
+        dev_stats[desc->device].inline_jobs++;
+        xSemaphoreGive(lock);
+        account_chunk(desc->device, desc->len, end - start);
+        account_job(desc->device, start, desc->deadline_us ? start + desc->deadline_us : INT64_MAX);
+        release_bus();
+        return ret;
+    }
+
+    arb_job_t *slot = alloc_job(portMAX_DELAY);
+    slot->exec = exec;
+    slot->exec_arg = exec_arg;
+    esp_err_t ret = enqueue(slot, desc, true);
+    if (ret == ESP_OK) {
+        xSemaphoreTake(slot->done_sem, portMAX_DELAY);
+        ret = slot->result;
+    }
+    free_job(slot);
+    return ret;
+}
+
+esp_err_t spi_arbiter_transfer(spi_device_id_t id, spi_priority_t priority,
+                               const uint8_t *tx, uint8_t *rx, size_t len,
+                               uint32_t deadline_us) {
+    spi_job_t desc = {
+        .device = id,
+        .priority = priority,
+        .tx = tx,
+        .rx = rx,
+        .len = len,
+        .deadline_us = deadline_us,
+    };
+    return spi_arbiter_transfer_job(&desc);
+}
+
+esp_err_t spi_arbiter_transfer_job(const spi_job_t *job) {
+    if (!job || job->device >= SPI_DEVICE_MAX || job->priority >= SPI_PRIO_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (job->len == 0) {
+        return ESP_OK;
+    }
+
+    spi_job_t desc = *job;
+    desc.done_cb = NULL;
+    desc.done_arg = NULL;
+    return run_sync(&desc, NULL, NULL);
+}
+
+esp_err_t spi_arbiter_exec(spi_device_id_t id, spi_priority_t priority,
+                           spi_exec_fn_t fn, void *arg, uint32_t deadline_us) {
+    if (id >= SPI_DEVICE_MAX || priority >= SPI_PRIO_MAX || !fn) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    spi_job_t desc = {
+        .device = id,
+        .priority = priority,
+        .deadline_us = deadline_us,
+    };
+    return run_sync(&desc, fn, arg);
+}
+
+void spi_arbiter_get_stats(spi_device_id_t id, spi_device_stats_t *stats) {
+    if (id >= SPI_DEVICE_MAX || !stats) return;
+    if (!lock) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+    xSemaphoreTake(lock, portMAX_DELAY);
+    *stats = dev_stats[id];
+    xSemaphoreGive(lock);
+}
+
+void spi_arbiter_reset_stats(void) {
+    if (!lock) return;
+    xSemaphoreTake(lock, portMAX_DELAY);
+    memset(dev_stats, 0, sizeof(dev_stats));
+    xSemaphoreGive(lock);
+}
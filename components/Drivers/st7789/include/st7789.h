@@ -66,6 +66,21 @@
     ((((b) * 249 + 1014) >> 11) & 0x1F)                                  \
 )
 
+// ** Modos de flush do framebuffer **
+typedef enum {
+    ST7789_FLUSH_FULL = 0,   // Envia o framebuffer inteiro a cada flush
+    ST7789_FLUSH_DAMAGE,     // Envia apenas os tiles (16x16) alterados pelas primitivas _fb
+} st7789_flush_mode_t;
+
+// Estatísticas do último flush (e acumuladas) para medir o uso do barramento
+typedef struct {
+    uint32_t bytes_sent;     // Bytes de pixel enviados no último flush
+    uint16_t rects;          // Retângulos (janelas) emitidos no último flush
+    uint16_t dirty_tiles;    // Tiles sujos no último flush
+    uint32_t total_bytes;    // Bytes de pixel enviados desde o boot
+    uint32_t flush_count;    // Número de chamadas a st7789_flush()
+} st7789_flush_stats_t;
+
 // Limite de bytes por transferência SPI (divide envios grandes para DMA)
 #define ST7789_MAX_CHUNK_BYTES 4096
 #define SWAP(a, b) { int16_t t = a; a = b; b = t; }
@@ -144,11 +159,40 @@ void st7789_draw_small_text(int x, int y, const char* text, uint16_t color);
 
 void st7789_reset_dirty_rect(void);
 void st7789_draw_char_fb(int x, int y, char c, uint16_t color, uint16_t bg_color);
+// Com uma região ativa, rola `offset_y` pixels e escreve `text` em (x, y) na
+// faixa exposta; sem região, escreve em (x, y + offset_y). Envio imediato.
 void st7789_scroll_text(int x, int y, int offset_y, const char *text, uint16_t color, uint16_t bg_color);
 
 
-//static void set_addr_window_direct(int x, int y, int w, int h);
 void st7789_flush();
+void st7789_flush_wait(void);   // Bloqueia até o front buffer ser liberado pelo DMA
+bool st7789_flush_busy(void);   // true enquanto um flush assíncrono está em andamento
+void st7789_set_flush_mode(st7789_flush_mode_t mode);
+st7789_flush_mode_t st7789_get_flush_mode(void);
+void st7789_get_flush_stats(st7789_flush_stats_t *stats);
+
+// ** Frame apresentado **
+// Último frame enviado ao painel, estável até o flush seguinte, para leitura
+// fora da task do app (streams remotos). Retorna NULL sem double buffer ou
+// antes do primeiro flush. O flush seguinte espera a liberação por até 250 ms;
+// st7789_frame_release() retorna false se o buffer foi tomado de volta no
+// meio da leitura (os pixels lidos podem estar misturados).
+const uint16_t *st7789_frame_hold(uint32_t *seq);
+bool st7789_frame_release(uint32_t seq);
+
+// ** Rolagem vertical por hardware (VSCRDEF/VSCSAD) **
+// A faixa de linhas [y, y + h) passa a rolar no próprio display: rolar envia
+// só as linhas expostas e o novo endereço de início, em vez da região inteira.
+// O framebuffer continua em coordenadas de tela (st7789_get_framebuffer()
+// devolve a imagem visível) e o flush traduz as linhas ao enviar.
+// Só na rotação 0. As funções de desenho imediato (sem _fb) não são
+// traduzidas: desfaça a região antes de usá-las.
+esp_err_t st7789_scroll_region_set(int y, int h);
+void st7789_scroll_region_reset(void);
+bool st7789_scroll_region_active(void);
+// Rola o conteúdo da região `dy` pixels para cima (dy < 0: para baixo). A
+// faixa exposta é pintada com `fill` e sai no próximo flush junto com o VSCSAD.
+void st7789_scroll_region_scroll(int dy, uint16_t fill);
 void st7789_draw_pixel_fb(int x, int y, uint16_t color);
 void st7789_fill_screen_fb(uint16_t color);
 void st7789_draw_hline_fb(int x, int y, int w, uint16_t color);
@@ -0,0 +1,38 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef ST7789_ASSET_H
+#define ST7789_ASSET_H
+
+#include <stdint.h>
+#include "asset.h"
+#include "st7789.h"
+
+// Desenho de imagens compactadas (asset.h) no framebuffer. As linhas são
+// decodificadas direto no framebuffer, já recortadas pela tela, e a área
+// desenhada é marcada como alterada.
+
+// Imagem colorida (PAL_RLE), opaca
+void st7789_draw_asset_fb(int x, int y, const asset_image_t *img);
+
+// Arte monocromática (MONO_RUNS ou MONO_BITS) transparente: só os pixels de
+// frente mudam, como em st7789_draw_bitmap_fb
+void st7789_draw_asset_mono_fb(int x, int y, const asset_image_t *img, uint16_t color);
+
+// Arte monocromática opaca, como em st7789_draw_bitmap_1bit_fb
+void st7789_draw_asset_mono_opaque_fb(int x, int y, const asset_image_t *img,
+                                      uint16_t fg, uint16_t bg);
+
+#endif // ST7789_ASSET_H
@@ -0,0 +1,62 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef ST7789_TEXT_H
+#define ST7789_TEXT_H
+
+#include <stdint.h>
+#include "font.h"
+#include "st7789.h"
+
+// Texto no framebuffer a partir de qualquer font_t. Os glifos são expandidos
+// uma única vez para linhas RGB565 prontas (por fonte, cor, fundo e escala) e
+// copiados linha a linha para o framebuffer.
+
+typedef struct {
+    uint32_t hits;
+    uint32_t misses;
+    uint32_t evictions;
+    uint32_t uncached;     // Glifos desenhados sem cache (orçamento esgotado)
+    uint32_t bytes;        // Memória ocupada pelos glifos em cache
+} st7789_glyph_cache_stats_t;
+
+// Fonte usada por st7789_draw_char_fb/st7789_draw_text_fb (padrão: font_5x7)
+void st7789_set_font(const font_t *font);
+const font_t *st7789_get_font(void);
+
+// Região de recorte do texto; fora dela nenhum pixel é alterado
+void st7789_set_text_clip(int x, int y, int w, int h);
+void st7789_reset_text_clip(void);
+
+// Desenha com fonte e escala explícitas (fundo opaco, '\n' quebra linha)
+void st7789_draw_char_font_fb(int x, int y, char c, const font_t *font, int scale,
+                              uint16_t color, uint16_t bg_color);
+void st7789_draw_text_font_fb(int x, int y, const char *text, const font_t *font, int scale,
+                              uint16_t color, uint16_t bg_color);
+
+// Medição: avanço horizontal por caractere e entre linhas
+int st7789_font_advance(const font_t *font, int scale);
+int st7789_font_line_height(const font_t *font, int scale);
+
+// Largura da linha mais longa e altura total do bloco de texto
+void st7789_measure_text(const font_t *font, int scale, const char *text, int *w, int *h);
+
+// Quantos caracteres da primeira linha de `text` cabem em max_w pixels
+int st7789_text_fit(const font_t *font, int scale, const char *text, int max_w);
+
+void st7789_glyph_cache_clear(void);
+void st7789_get_glyph_cache_stats(st7789_glyph_cache_stats_t *stats);
+
+#endif // ST7789_TEXT_H
@@ -14,15 +14,19 @@
 
 
 #include "st7789.h"
+#include "st7789_text.h"
 #include <string.h>
 #include <math.h>
+#include <stdlib.h>
 #include "driver/gpio.h"
 #include "esp_heap_caps.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include "esp_log.h"
 #include "backlight.h"
-#include "virtual_display_client.h"
+#include "frame_stream.h"
 #include "spi.h"
+#include "spi_arbiter.h"
 #include "pin_def.h"
 
 // ... resto dos includes ...
@@ -40,13 +44,14 @@
 #define ST7789_CMD_RASET   0x2B  // Row Address Set (definir linha)
 #define ST7789_CMD_RAMWR   0x2C  // Memory Write (escrever memória)
 #define ST7789_CMD_RAMCTRL 0xB0  // RAM Control (controle de RAM)
-#define SPI_MAX_CHUNK_SIZE 32768
+#define ST7789_CMD_VSCRDEF 0x33  // Vertical Scrolling Definition (áreas de rolagem)
+#define ST7789_CMD_VSCSAD  0x37  // Vertical Scroll Start Address
+
+#define ST7789_RAM_ROWS    320   // Linhas da memória do controlador
 
 #define SWAP_BYTES(color) ((((color) >> 8) & 0xFF) | (((color) << 8) & 0xFF00))
 
 static int text_size = 1; // 1x padrão
-static int dirty_x0 = 240, dirty_y0 = 240;
-static int dirty_x1 = 0, dirty_y1 = 0;
 
 static uint16_t *framebuffer;
 
@@ -56,106 +61,80 @@ static uint16_t offset_x = ST7789_X_OFFSET;
 static uint16_t offset_y = ST7789_Y_OFFSET;
 static spi_device_handle_t spi_dev;
 
-// Fonte básica 5x7 (ASCII 32 a 127): cada caractere ocupa 5 bytes (colunas de 7 pixels)
-static const uint8_t font5x7[96][5] = {
-    // [0] = ' ' (espaço, código 32)
-    {0x00, 0x00, 0x00, 0x00, 0x00}, // ' ' (espaço)
-    {0x00, 0x00, 0x5F, 0x00, 0x00}, // '!'
-    {0x00, 0x07, 0x00, 0x07, 0x00}, // '"'
-    {0x14, 0x7F, 0x14, 0x7F, 0x14}, // '#'
-    {0x24, 0x2A, 0x7F, 0x2A, 0x12}, // '$'
-    {0x23, 0x13, 0x08, 0x64, 0x62}, // '%'
-    {0x36, 0x49, 0x56, 0x20, 0x50}, // '&'
-    {0x00, 0x08, 0x07, 0x03, 0x00}, // '''
-    {0x00, 0x1C, 0x22, 0x41, 0x00}, // '('
-    {0x00, 0x41, 0x22, 0x1C, 0x00}, // ')'
-    {0x2A, 0x1C, 0x7F, 0x1C, 0x2A}, // '*'
-    {0x08, 0x08, 0x3E, 0x08, 0x08}, // '+'
-    {0x00, 0x80, 0x70, 0x30, 0x00}, // ','
-    {0x08, 0x08, 0x08, 0x08, 0x08}, // '-'
-    {0x00, 0x00, 0x60, 0x60, 0x00}, // '.'
-    {0x20, 0x10, 0x08, 0x04, 0x02}, // '/'
-    {0x3E, 0x51, 0x49, 0x45, 0x3E}, // '0'
-    {0x00, 0x42, 0x7F, 0x40, 0x00}, // '1'
-    {0x72, 0x49, 0x49, 0x49, 0x46}, // '2'
-    {0x21, 0x41, 0x49, 0x4D, 0x33}, // '3'
-    {0x18, 0x14, 0x12, 0x7F, 0x10}, // '4'
-    {0x27, 0x45, 0x45, 0x45, 0x39}, // '5'
-    {0x3C, 0x4A, 0x49, 0x49, 0x31}, // '6'
-    {0x41, 0x21, 0x11, 0x09, 0x07}, // '7'
-    {0x36, 0x49, 0x49, 0x49, 0x36}, // '8'
-    {0x46, 0x49, 0x49, 0x29, 0x1E}, // '9'
-    {0x00, 0x00, 0x14, 0x00, 0x00}, // ':'
-    {0x00, 0x40, 0x34, 0x00, 0x00}, // ';'
-    {0x00, 0x08, 0x14, 0x22, 0x41}, // '<'
-    {0x14, 0x14, 0x14, 0x14, 0x14}, // '='
-    {0x00, 0x41, 0x22, 0x14, 0x08}, // '>'
-    {0x02, 0x01, 0x59, 0x09, 0x06}, // '?'
-    {0x3E, 0x41, 0x5D, 0x59, 0x4E}, // '@'
-    {0x7C, 0x12, 0x11, 0x12, 0x7C}, // 'A'
-    {0x7F, 0x49, 0x49, 0x49, 0x36}, // 'B'
-    {0x3E, 0x41, 0x41, 0x41, 0x22}, // 'C'
-    {0x7F, 0x41, 0x41, 0x41, 0x3E}, // 'D'
-    {0x7F, 0x49, 0x49, 0x49, 0x41}, // 'E'
-    {0x7F, 0x09, 0x09, 0x09, 0x01}, // 'F'
-    {0x3E, 0x41, 0x41, 0x51, 0x73}, // 'G'
-    {0x7F, 0x08, 0x08, 0x08, 0x7F}, // 'H'
-    {0x00, 0x41, 0x7F, 0x41, 0x00}, // 'I'
-    {0x20, 0x40, 0x41, 0x3F, 0x01}, // 'J'
-    {0x7F, 0x08, 0x14, 0x22, 0x41}, // 'K'
-    {0x7F, 0x40, 0x40, 0x40, 0x40}, // 'L'
-    {0x7F, 0x02, 0x1C, 0x02, 0x7F}, // 'M'
-    {0x7F, 0x04, 0x08, 0x10, 0x7F}, // 'N'
-    {0x3E, 0x41, 0x41, 0x41, 0x3E}, // 'O'
-    {0x7F, 0x09, 0x09, 0x09, 0x06}, // 'P'
-    {0x3E, 0x41, 0x51, 0x21, 0x5E}, // 'Q'
-    {0x7F, 0x09, 0x19, 0x29, 0x46}, // 'R'
-    {0x26, 0x49, 0x49, 0x49, 0x32}, // 'S'
-    {0x03, 0x01, 0x7F, 0x01, 0x03}, // 'T'
-    {0x3F, 0x40, 0x40, 0x40, 0x3F}, // 'U'
-    {0x1F, 0x20, 0x40, 0x20, 0x1F}, // 'V'
-    {0x3F, 0x40, 0x38, 0x40, 0x3F}, // 'W'
-    {0x63, 0x14, 0x08, 0x14, 0x63}, // 'X'
-    {0x03, 0x04, 0x78, 0x04, 0x03}, // 'Y'
-    {0x61, 0x59, 0x49, 0x4D, 0x43}, // 'Z'
-    {0x00, 0x7F, 0x41, 0x41, 0x41}, // '['
-    {0x02, 0x04, 0x08, 0x10, 0x20}, // '\'
-    {0x00, 0x41, 0x41, 0x41, 0x7F}, // ']'
-    {0x04, 0x02, 0x01, 0x02, 0x04}, // '^'
-    {0x40, 0x40, 0x40, 0x40, 0x40}, // '_'
-    {0x00, 0x03, 0x07, 0x08, 0x00}, // '`'
-    {0x20, 0x54, 0x54, 0x78, 0x40}, // 'a'
-    {0x7F, 0x28, 0x44, 0x44, 0x38}, // 'b'
-    {0x38, 0x44, 0x44, 0x44, 0x28}, // 'c'
-    {0x38, 0x44, 0x44, 0x28, 0x7F}, // 'd'
-    {0x38, 0x54, 0x54, 0x54, 0x18}, // 'e'
-    {0x00, 0x08, 0x7E, 0x09, 0x02}, // 'f'
-    {0x18, 0xA4, 0xA4, 0x9C, 0x78}, // 'g'
-    {0x7F, 0x08, 0x04, 0x04, 0x78}, // 'h'
-    {0x00, 0x44, 0x7D, 0x40, 0x00}, // 'i'
-    {0x20, 0x40, 0x40, 0x3D, 0x00}, // 'j'
-    {0x7F, 0x10, 0x28, 0x44, 0x00}, // 'k'
-    {0x00, 0x41, 0x7F, 0x40, 0x00}, // 'l'
-    {0x7C, 0x04, 0x78, 0x04, 0x78}, // 'm'
-    {0x7C, 0x08, 0x04, 0x04, 0x78}, // 'n'
-    {0x38, 0x44, 0x44, 0x44, 0x38}, // 'o'
-    {0xFC, 0x18, 0x24, 0x24, 0x18}, // 'p'
-    {0x18, 0x24, 0x24, 0x18, 0xFC}, // 'q'
-    {0x7C, 0x08, 0x04, 0x04, 0x08}, // 'r'
-    {0x48, 0x54, 0x54, 0x54, 0x24}, // 's'
-    {0x04, 0x04, 0x3F, 0x44, 0x24}, // 't'
-    {0x3C, 0x40, 0x40, 0x20, 0x7C}, // 'u'
-    {0x1C, 0x20, 0x40, 0x20, 0x1C}, // 'v'
-    {0x3C, 0x40, 0x30, 0x40, 0x3C}, // 'w'
-    {0x44, 0x28, 0x10, 0x28, 0x44}, // 'x'
-    {0x4C, 0x90, 0x90, 0x90, 0x7C}, // 'y'
-    {0x44, 0x64, 0x54, 0x4C, 0x44}, // 'z'
-    {0x00, 0x08, 0x36, 0x41, 0x00}, // '{'
-    {0x00, 0x00, 0x77, 0x00, 0x00}, // '|'
-    {0x00, 0x41, 0x36, 0x08, 0x00}, // '}'
-    {0x02, 0x01, 0x02, 0x04, 0x02}  // '~'
-    // (Del 0x7F não representado – pode ser definido como 0x00 se necessário)
-};
+// ** Pipeline de flush assíncrono (double buffer) **
+// O app desenha sempre em `framebuffer` (back buffer). No flush, o back buffer
+// vira front buffer e é drenado por jobs BULK entregues ao árbitro SPI, enquanto
+// o app já pode desenhar no outro buffer. Entre dois blocos o árbitro pode dar o
+// barramento ao CC1101 ou ao SD. O callback de fim de transação devolve o front
+// buffer quando o último bloco sai pelo barramento.
+#define ST7789_FB_SIZE          (ST7789_WIDTH * ST7789_HEIGHT * sizeof(uint16_t))
+#define ST7789_SPI_QUEUE_SIZE   SPI_ARBITER_MAX_ASYNC  // Jobs do flush em voo no árbitro
+#define ST7789_TRANS_COPY_MAX   4       // Comandos e parâmetros curtos são copiados
+#define ST7789_STAGE_BYTES      8192    // Buffer de empacotamento de retângulos parciais
+
+// Flags carregadas em spi_transaction_t.user
+#define ST7789_TRANS_DC_DATA    (1 << 0)  // Nível do pino DC durante a transação
+#define ST7789_TRANS_LAST       (1 << 1)  // Último bloco de um flush
+
+static uint16_t *fb_buffers[2];
+static int fb_back_index = 0;
+static uint8_t trans_pool[ST7789_SPI_QUEUE_SIZE][ST7789_TRANS_COPY_MAX];
+static SemaphoreHandle_t trans_sem;        // Um give por job concluído pelo árbitro
+static uint32_t trans_queued = 0;          // Transações enfileiradas desde o boot
+static uint32_t trans_done = 0;            // Resultados já recolhidos
+static volatile bool flush_busy = false;   // Front buffer ainda em uso pelo DMA
+static uint8_t *stage_buffers[2];
+static uint32_t stage_seq[2];              // trans_queued após o último uso de cada buffer
+static int stage_index = 0;
+
+// ** Frame apresentado (streams remotos) **
+// Depois da troca, o front buffer guarda exatamente o frame que foi ao painel e
+// não muda até o flush seguinte. Os streams leem esse buffer (as duas passadas
+// do codificador veem os mesmos pixels), nunca o back buffer em que o app
+// desenha. O flush seguinte espera a leitura acabar antes de reaproveitá-lo,
+// por no máximo ST7789_PRESENT_WAIT_MS: com um transporte travado o buffer é
+// tomado de volta e o leitor é avisado em st7789_frame_release().
+#define ST7789_PRESENT_WAIT_MS  250
+
+static portMUX_TYPE present_mux = portMUX_INITIALIZER_UNLOCKED;
+static SemaphoreHandle_t present_free;     // Último leitor saiu
+static const uint16_t *present_fb;         // NULL: nenhum frame disponível para leitura
+static uint32_t present_seq;               // Número do frame em present_fb
+static int present_readers;                // Leitores de present_seq ainda não revogados
+static uint32_t present_revoked_seq;       // Último frame tomado de volta durante a leitura
+
+// ** Mapa de danos **
+// A tela é dividida em tiles de 16x16; cada linha de tiles é um bitmask de colunas.
+// As primitivas _fb marcam os tiles tocados e o flush em ST7789_FLUSH_DAMAGE
+// agrupa os tiles em poucos retângulos, cada um enviado com uma única janela.
+#define ST7789_TILE_SHIFT       4
+#define ST7789_TILE_SIZE        (1 << ST7789_TILE_SHIFT)
+#define ST7789_TILES_X          ((ST7789_WIDTH + ST7789_TILE_SIZE - 1) / ST7789_TILE_SIZE)
+#define ST7789_TILES_Y          ((ST7789_HEIGHT + ST7789_TILE_SIZE - 1) / ST7789_TILE_SIZE)
+#define ST7789_MAX_DAMAGE_RECTS 16
+
+_Static_assert(ST7789_TILES_X <= 16, "damage_rows usa 16 bits por linha de tiles");
+
+typedef struct {
+    int x, y, w, h;  // Em pixels
+} damage_rect_t;
+
+static uint16_t damage_rows[ST7789_TILES_Y];   // Tiles pendentes de envio ao display
+static uint16_t written_rows[ST7789_TILES_Y];  // Tiles alterados desde a última troca de buffers
+static st7789_flush_mode_t flush_mode = ST7789_FLUSH_FULL;
+static st7789_flush_stats_t flush_stats;
+
+// ** Rolagem vertical por hardware **
+// O framebuffer fica sempre em coordenadas de tela. Dentro da região, a linha
+// de tela `r` está na linha de memória y + (r - y + offset) % h; o flush faz
+// essa tradução e envia o novo VSCSAD depois dos pixels.
+static struct {
+    bool active;
+    int y, h;
+    int offset;                // Deslocamento atual dentro da região [0, h)
+    bool vscsad_pending;       // VSCSAD ainda não enviado ao display
+} scroll;
+static uint8_t rotation = 0;
 
 // Logo DVD monocromático 48x24 pixels (1 bit por pixel)
 const uint8_t dvd_logo_48x24[] = {0x07,0xff,0xf8,0x03,0xff,0x00,0x0f,0xff,0xfc,0x0f,0xff,0xe0,0x0f,0xff,0xfe,0x0f,0xff,0xf8,0x0f,0xff,0xfe,0x1f,0xff,0xfc,0x0f,0x8f,0xfe,0x3f,0xf1,0xfc,0x1f,0x87,0xff,0x7f,0xf0,0x7e,0x1f,0x87,0xff,0xfd,0xf0,0x7c,0x1f,0x07,0xff,0xfb,0xf0,0xfc,0x1f,0x0f,0xdf,0xfb,0xf1,0xfc,0x3f,0xff,0x8f,0xf3,0xff,0xf8,0x3f,0xff,0x0f,0xe3,0xff,0xf0,0x3f,0xfe,0x0f,0xc7,0xff,0xc0,0x3f,0xf0,0x07,0x87,0xff,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x1f,0x80,0x00,0x00,0x03,0xff,0xff,0xff,0xfc,0x00,0x3f,0xff,0xff,0xff,0xff,0xc0,0x7f,0xff,0xff,0xff,0xff,0xf0,0x7f,0xff,0xe0,0xff,0xff,0xf0,0x3f,0xff,0xff,0xff,0xff,0xe0,0x07,0xff,0xff,0xff,0xff,0x00,0x00,0x0f,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
@@ -184,23 +163,137 @@ const uint8_t image_infravermelho_bits[] = {0xfe,0x00,0x00,0x00,0xff,0x00,0x00,0
 
 
 
+// Callback (ISR): ajusta o pino DC conforme a flag da transação
+static void IRAM_ATTR st7789_spi_pre_cb(spi_transaction_t *t) {
+    gpio_set_level(ST7789_PIN_DC, ((uintptr_t)t->user & ST7789_TRANS_DC_DATA) ? 1 : 0);
+}
+
+// Callback (ISR): ao terminar o último bloco do flush, devolve o front buffer
+static void IRAM_ATTR st7789_spi_post_cb(spi_transaction_t *t) {
+    if ((uintptr_t)t->user & ST7789_TRANS_LAST) {
+        flush_busy = false;
+    }
+}
+
+// Fim de um job do flush (task do árbitro). Os jobs BULK saem em ordem.
+static void st7789_trans_done_cb(esp_err_t result, void *arg) {
+    xSemaphoreGive(trans_sem);
+}
+
+// Recolhe o resultado da transação enfileirada mais antiga
+static void reclaim_trans(void) {
+    xSemaphoreTake(trans_sem, portMAX_DELAY);
+    trans_done++;
+}
+
+// Transmite e aguarda, pelo árbitro. Comandos e parâmetros curtos entram como
+// CONTROL; blocos de pixels como BULK, divididos entre os jobs mais urgentes.
+static esp_err_t transfer_sync(const void *data, size_t len, uint32_t flags) {
+    spi_job_t job = {
+        .device = SPI_DEVICE_ST7789,
+        .priority = len <= ST7789_TRANS_COPY_MAX ? SPI_PRIO_CONTROL : SPI_PRIO_BULK,
+        .tx = data,
+        .len = len,
+        .user = (void *)(uintptr_t)flags,
+    };
+    return spi_arbiter_transfer_job(&job);
+}
+
+// Entrega `len` bytes ao árbitro. Comandos e parâmetros curtos (<= 4 bytes) são
+// copiados para trans_pool, então o chamador não precisa manter o buffer vivo.
+static esp_err_t queue_data(const void *data, size_t len, uint32_t flags) {
+    if (trans_queued - trans_done >= ST7789_SPI_QUEUE_SIZE) {
+        reclaim_trans();
+    }
+
+    const uint8_t *tx = data;
+    if (len <= ST7789_TRANS_COPY_MAX) {
+        uint8_t *copy = trans_pool[trans_queued % ST7789_SPI_QUEUE_SIZE];
+        memcpy(copy, data, len);
+        tx = copy;
+    }
+
+    spi_job_t job = {
+        .device = SPI_DEVICE_ST7789,
+        .priority = SPI_PRIO_BULK,
+        .tx = tx,
+        .len = len,
+        .user = (void *)(uintptr_t)flags,
+        .done_cb = st7789_trans_done_cb,
+    };
+
+    esp_err_t ret;
+    while ((ret = spi_arbiter_submit(&job)) == ESP_ERR_NO_MEM) {
+        // Slots assíncronos ocupados: espera um job nosso sair, ou um tick
+        if (trans_queued != trans_done) {
+            reclaim_trans();
+        } else {
+            vTaskDelay(1);
+        }
+    }
+
+    if (ret == ESP_ERR_INVALID_STATE) {
+        // Sem árbitro: transmissão síncrona (direto no device)
+        ret = transfer_sync(tx, len, flags);
+        trans_done++;
+        trans_queued++;
+        return ret;
+    }
+    if (ret == ESP_OK) {
+        trans_queued++;
+    }
+    return ret;
+}
+
+static void queue_cmd(uint8_t cmd) {
+    queue_data(&cmd, 1, 0);
+}
+
+// Versão enfileirada de set_addr_window: CASET/RASET/RAMWR vão para a fila DMA
+static void queue_addr_window(int x, int y, int w, int h) {
+    uint16_t x0 = x + offset_x;
+    uint16_t y0 = y + offset_y;
+    uint16_t x1 = x0 + w - 1;
+    uint16_t y1 = y0 + h - 1;
+    uint8_t data[4];
+
+    queue_cmd(ST7789_CMD_CASET);
+    data[0] = x0 >> 8; data[1] = x0 & 0xFF;
+    data[2] = x1 >> 8; data[3] = x1 & 0xFF;
+    queue_data(data, 4, ST7789_TRANS_DC_DATA);
+
+    queue_cmd(ST7789_CMD_RASET);
+    data[0] = y0 >> 8; data[1] = y0 & 0xFF;
+    data[2] = y1 >> 8; data[3] = y1 & 0xFF;
+    queue_data(data, 4, ST7789_TRANS_DC_DATA);
+
+    queue_cmd(ST7789_CMD_RAMWR);
+}
+
+// Aguarda o flush em andamento e recolhe todos os jobs entregues ao árbitro.
+// As transações síncronas de send_cmd/send_data não podem se intercalar com eles.
+void st7789_flush_wait(void) {
+    while (trans_done != trans_queued) {
+        reclaim_trans();
+    }
+    flush_busy = false;
+}
+
+bool st7789_flush_busy(void) {
+    return flush_busy;
+}
+
 // Função auxiliar: envia um comando de 8 bits via SPI (DC=0)
 static esp_err_t send_cmd(uint8_t cmd) {
-    spi_transaction_t t = {0};
-    t.length = 8;                    // 8 bits no buffer
-    t.tx_buffer = &cmd;
-    gpio_set_level(ST7789_PIN_DC, 0);
-    return spi_device_polling_transmit(spi_dev, &t);
+    st7789_flush_wait();
+    return transfer_sync(&cmd, 1, 0);    // DC=0 (comando), aplicado no pre_cb
 }
 
 // Função auxiliar: envia dados de comprimento `len` via SPI (DC=1)
 static esp_err_t send_data(const void *data, int len) {
     if (len <= 0) return ESP_OK;
-    spi_transaction_t t = {0};
-    t.length = len * 8;
-    t.tx_buffer = data;
-    gpio_set_level(ST7789_PIN_DC, 1);
-    return spi_device_polling_transmit(spi_dev, &t);
+    st7789_flush_wait();
+    return transfer_sync(data, len, ST7789_TRANS_DC_DATA);
 }
 
 // Função auxiliar: define a janela (regiões CASET/RASET) e prepara para escrita (RAMWR)
@@ -231,28 +324,211 @@ static void set_addr_window(int x, int y, int w, int h) {
     send_cmd(ST7789_CMD_RAMWR);
 }
 
-static void set_addr_window_direct(int x, int y, int w, int h) {
-    uint16_t x0 = x + offset_x;
-    uint16_t y0 = y + offset_y;
-    uint16_t x1 = x0 + w - 1;
-    uint16_t y1 = y0 + h - 1;
-    uint8_t data[4];
+// Marca uma região (em pixels) como alterada no mapa de danos
+static void damage_add(int x, int y, int w, int h) {
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > ST7789_WIDTH) w = ST7789_WIDTH - x;
+    if (y + h > ST7789_HEIGHT) h = ST7789_HEIGHT - y;
+    if (w <= 0 || h <= 0) return;
 
-    send_cmd(ST7789_CMD_CASET);
-    data[0] = x0 >> 8; data[1] = x0 & 0xFF;
-    data[2] = x1 >> 8; data[3] = x1 & 0xFF;
-    send_data(data, 4);
+    int tx0 = x >> ST7789_TILE_SHIFT;
+    int tx1 = (x + w - 1) >> ST7789_TILE_SHIFT;
+    uint16_t mask = (uint16_t)(((1u << (tx1 + 1)) - 1) & ~((1u << tx0) - 1));
 
-    send_cmd(ST7789_CMD_RASET);
-    data[0] = y0 >> 8; data[1] = y0 & 0xFF;
-    data[2] = y1 >> 8; data[3] = y1 & 0xFF;
-    send_data(data, 4);
+    for (int ty = y >> ST7789_TILE_SHIFT; ty <= (y + h - 1) >> ST7789_TILE_SHIFT; ty++) {
+        damage_rows[ty] |= mask;
+        written_rows[ty] |= mask;
+    }
+}
 
-    send_cmd(ST7789_CMD_RAMWR);
+// Agrupa os tiles marcados em retângulos: tiles contíguos na mesma linha viram
+// um trecho, e trechos com as mesmas colunas em linhas seguidas são empilhados.
+// Retorna o número de retângulos, ou -1 se não couberem em `max`.
+static int build_damage_rects(const uint16_t *rows, damage_rect_t *out, int max, int *tiles) {
+    int count = 0;
+    *tiles = 0;
+
+    for (int ty = 0; ty < ST7789_TILES_Y; ty++) {
+        uint32_t bits = rows[ty];
+        int tx = 0;
+        while (bits) {
+            while (!(bits & 1)) { bits >>= 1; tx++; }
+            int start = tx;
+            while (bits & 1) { bits >>= 1; tx++; }
+            *tiles += tx - start;
+
+            int x = start << ST7789_TILE_SHIFT;
+            int y = ty << ST7789_TILE_SHIFT;
+            int w = (tx << ST7789_TILE_SHIFT) - x;
+            if (x + w > ST7789_WIDTH) w = ST7789_WIDTH - x;
+            int h = ST7789_TILE_SIZE;
+            if (y + h > ST7789_HEIGHT) h = ST7789_HEIGHT - y;
+
+            int i;
+            for (i = 0; i < count; i++) {
+                if (out[i].x == x && out[i].w == w && out[i].y + out[i].h == y) {
+                    out[i].h += h;
+                    break;
+                }
+            }
+            if (i < count) continue;
+
+            if (count == max) return -1;
+            out[count++] = (damage_rect_t){ x, y, w, h };
+        }
+    }
+    return count;
+}
+
+// Espera até que o buffer de empacotamento `idx` não esteja mais em uso pelo DMA
+static uint8_t *acquire_stage(int idx) {
+    while ((int32_t)(stage_seq[idx] - trans_done) > 0) {
+        reclaim_trans();
+    }
+    return stage_buffers[idx];
+}
+
+// Enfileira um retângulo do framebuffer `src` com uma única janela de endereço,
+// gravado a partir da linha `dst_y` da memória do display.
+// Retângulos de largura total são contíguos e saem direto do framebuffer, em
+// blocos de SPI_ARBITER_CHUNK_BYTES para que o CC1101 consiga o barramento
+// entre dois blocos; os demais são empacotados linha a linha nos buffers de estágio.
+static size_t queue_rect(const uint16_t *src, const damage_rect_t *r, int dst_y, bool last) {
+    size_t total = (size_t)r->w * r->h * sizeof(uint16_t);
+
+    queue_addr_window(r->x, dst_y, r->w, r->h);
+
+    if (r->w == ST7789_WIDTH || !stage_buffers[0]) {
+        if (r->w != ST7789_WIDTH) {
+            // Sem buffers de estágio: uma transação por linha, ainda na mesma janela
+            for (int row = 0; row < r->h; row++) {
+                bool end = last && row == r->h - 1;
+                queue_data(&src[(r->y + row) * ST7789_WIDTH + r->x], r->w * sizeof(uint16_t),
+                           ST7789_TRANS_DC_DATA | (end ? ST7789_TRANS_LAST : 0));
+            }
+            return total;
+        }
+
+        const uint8_t *ptr = (const uint8_t *)&src[r->y * ST7789_WIDTH];
+        size_t remaining = total;
+        while (remaining > 0) {
+            size_t chunk = (remaining > SPI_ARBITER_CHUNK_BYTES) ? SPI_ARBITER_CHUNK_BYTES : remaining;
+            remaining -= chunk;
+            queue_data(ptr, chunk, ST7789_TRANS_DC_DATA |
+                       ((last && remaining == 0) ? ST7789_TRANS_LAST : 0));
+            ptr += chunk;
+        }
+        return total;
+    }
+
+    size_t row_bytes = r->w * sizeof(uint16_t);
+    int rows_per_stage = ST7789_STAGE_BYTES / row_bytes;
+    int row = 0;
+
+    while (row < r->h) {
+        int n = r->h - row;
+        if (n > rows_per_stage) n = rows_per_stage;
+
+        uint8_t *stage = acquire_stage(stage_index);
+        for (int i = 0; i < n; i++) {
+            memcpy(stage + i * row_bytes, &src[(r->y + row + i) * ST7789_WIDTH + r->x], row_bytes);
+        }
+        row += n;
+
+        queue_data(stage, n * row_bytes, ST7789_TRANS_DC_DATA |
+                   ((last && row == r->h) ? ST7789_TRANS_LAST : 0));
+        stage_seq[stage_index] = trans_queued;
+        stage_index ^= 1;
+    }
+    return total;
+}
+
+// Enfileira um retângulo em coordenadas de tela, dividindo-o onde a região de
+// rolagem quebra a continuidade das linhas de memória (no máximo 4 trechos).
+static size_t queue_rect_mapped(const uint16_t *src, const damage_rect_t *r, bool last) {
+    if (!scroll.active || scroll.offset == 0) {
+        return queue_rect(src, r, r->y, last);
+    }
+
+    int wrap = scroll.y + scroll.h - scroll.offset;   // Primeira linha de tela que volta ao topo
+    int cuts[] = { scroll.y, wrap, scroll.y + scroll.h };
+    size_t total = 0;
+    int y = r->y;
+    int end = r->y + r->h;
+
+    while (y < end) {
+        int next = end;
+        for (int i = 0; i < 3; i++) {
+            if (cuts[i] > y && cuts[i] < next) next = cuts[i];
+        }
+
+        int dst_y = y;
+        if (y >= scroll.y && y < scroll.y + scroll.h) {
+            dst_y = scroll.y + (y - scroll.y + scroll.offset) % scroll.h;
+        }
+        damage_rect_t piece = { r->x, y, r->w, next - y };
+        total += queue_rect(src, &piece, dst_y, last && next == end);
+        y = next;
+    }
+    return total;
+}
+
+// Enfileira o novo início de rolagem. Vai depois dos pixels para que as linhas
+// expostas já estejam na memória quando o display passar a mostrá-las.
+static void queue_scroll_start(bool last) {
+    uint16_t vsp = offset_y + scroll.y + scroll.offset;
+    uint8_t data[2] = { vsp >> 8, vsp & 0xFF };
+
+    queue_cmd(ST7789_CMD_VSCSAD);
+    queue_data(data, 2, ST7789_TRANS_DC_DATA | (last ? ST7789_TRANS_LAST : 0));
+    scroll.vscsad_pending = false;
+}
+
+// Retira o frame apresentado de circulação e espera os leitores saírem
+static void present_reclaim(void) {
+    if (present_free) {
+        xSemaphoreTake(present_free, 0);   // Descarta um aviso antigo
+    }
+
+    portENTER_CRITICAL(&present_mux);
+    present_fb = NULL;
+    bool busy = present_readers > 0;
+    portEXIT_CRITICAL(&present_mux);
+
+    if (busy && present_free && xSemaphoreTake(present_free, pdMS_TO_TICKS(ST7789_PRESENT_WAIT_MS)) != pdTRUE) {
+        // Os leitores atrasados deixam de contar: o flush seguinte não espera por eles
+        portENTER_CRITICAL(&present_mux);
+        if (present_readers > 0) {
+            present_revoked_seq = present_seq;
+            present_readers = 0;
+        }
+        portEXIT_CRITICAL(&present_mux);
+    }
+}
+
+const uint16_t *st7789_frame_hold(uint32_t *seq) {
+    portENTER_CRITICAL(&present_mux);
+    const uint16_t *fb = present_fb;
+    if (fb) {
+        present_readers++;
+        if (seq) *seq = present_seq;
+    }
+    portEXIT_CRITICAL(&present_mux);
+    return fb;
 }
 
+bool st7789_frame_release(uint32_t seq) {
+    portENTER_CRITICAL(&present_mux);
+    bool intact = (int32_t)(seq - present_revoked_seq) > 0;
+    bool last = intact && --present_readers == 0;
+    portEXIT_CRITICAL(&present_mux);
 
-// Em st7789.c
+    if (last && present_free) {
+        xSemaphoreGive(present_free);
+    }
+    return intact;
+}
 
 void st7789_flush() {
     if (!framebuffer) {
@@ -260,26 +536,204 @@ void st7789_flush() {
         return;
     }
 
-    // --- NOVO: Envia o framebuffer para o servidor no PC ---
-    // Esta chamada é o ponto central da nossa funcionalidade de display virtual.
-   // ...
-// Linha 248:
-virtual_display_notify_frame_ready();
-// ...
-    // --- FIM DA MODIFICAÇÃO ---
+    // Garante que o flush anterior terminou antes de reaproveitar o outro buffer
+    st7789_flush_wait();
+
+    damage_rect_t rects[ST7789_MAX_DAMAGE_RECTS];
+    int tiles = ST7789_TILES_X * ST7789_TILES_Y;
+    int count = -1;
+
+    if (flush_mode == ST7789_FLUSH_DAMAGE) {
+        count = build_damage_rects(damage_rows, rects, ST7789_MAX_DAMAGE_RECTS, &tiles);
+        // Com a maior parte da tela suja, um único burst de tela cheia sai mais barato
+        if (count > 1 && tiles * 4 >= ST7789_TILES_X * ST7789_TILES_Y * 3) {
+            count = -1;
+        }
+    }
+    if (count < 0) {
+        rects[0] = (damage_rect_t){ 0, 0, ST7789_WIDTH, ST7789_HEIGHT };
+        count = 1;
+    }
+
+    flush_stats.bytes_sent = 0;
+    flush_stats.rects = 0;
+    flush_stats.dirty_tiles = tiles;
+    flush_stats.flush_count++;
+    memset(damage_rows, 0, sizeof(damage_rows));
+
+    if (flush_mode == ST7789_FLUSH_DAMAGE && tiles == 0 && !scroll.vscsad_pending) {
+        return;  // Nada mudou: nenhum byte no barramento
+    }
+    if (tiles == 0) {
+        count = 0;  // Só o início de rolagem mudou
+    }
+
+    // O back buffer atual passa a ser o front buffer e é enfileirado para DMA
+    uint16_t *front = framebuffer;
+    bool send_scroll = scroll.vscsad_pending;
+    flush_busy = true;
+    for (int i = 0; i < count; i++) {
+        flush_stats.bytes_sent += queue_rect_mapped(front, &rects[i], i == count - 1 && !send_scroll);
+    }
+    if (send_scroll) {
+        queue_scroll_start(true);
+    }
+    flush_stats.rects = count;
+    flush_stats.total_bytes += flush_stats.bytes_sent;
+
+    if (!fb_buffers[1]) {
+        // Sem segundo buffer: modo síncrono, igual ao comportamento antigo
+        st7789_flush_wait();
+        memset(written_rows, 0, sizeof(written_rows));
+        return;
+    }
+
+    // O buffer que vai virar back buffer é o frame apresentado anterior
+    present_reclaim();
+
+    // Troca os buffers. O novo back buffer precisa partir do frame enviado, pois as
+    // telas desenham de forma incremental: ele já contém o frame anterior, então
+    // basta copiar os tiles alterados desde a última troca.
+    fb_back_index ^= 1;
+    framebuffer = fb_buffers[fb_back_index];
+
+    damage_rect_t copies[ST7789_MAX_DAMAGE_RECTS];
+    int copy_tiles;
+    int ncopies = (flush_mode == ST7789_FLUSH_DAMAGE)
+                  ? build_damage_rects(written_rows, copies, ST7789_MAX_DAMAGE_RECTS, &copy_tiles)
+                  : -1;
+    if (ncopies < 0) {
+        memcpy(framebuffer, front, ST7789_FB_SIZE);
+    } else {
+        for (int i = 0; i < ncopies; i++) {
+            for (int row = copies[i].y; row < copies[i].y + copies[i].h; row++) {
+                int off = row * ST7789_WIDTH + copies[i].x;
+                memcpy(&framebuffer[off], &front[off], copies[i].w * sizeof(uint16_t));
+            }
+        }
+    }
+    memset(written_rows, 0, sizeof(written_rows));
 
-    // O código abaixo atualiza a tela física do dispositivo.
-    // Ele não precisa ser alterado.
-    set_addr_window_direct(0, 0, ST7789_WIDTH, ST7789_HEIGHT);
+    portENTER_CRITICAL(&present_mux);
+    present_fb = front;
+    present_seq++;
+    portEXIT_CRITICAL(&present_mux);
 
-    const uint8_t *data_ptr = (const uint8_t *)framebuffer;
-    size_t bytes_to_send = ST7789_WIDTH * ST7789_HEIGHT * sizeof(uint16_t);
+    // Avisa os displays remotos (Wi-Fi, USB), se houver algum conectado
+    frame_stream_notify_all();
+}
+
+void st7789_set_flush_mode(st7789_flush_mode_t mode) {
+    flush_mode = mode;
+}
+
+st7789_flush_mode_t st7789_get_flush_mode(void) {
+    return flush_mode;
+}
+
+void st7789_get_flush_stats(st7789_flush_stats_t *stats) {
+    if (stats) *stats = flush_stats;
+}
+
+// Envia VSCRDEF (áreas fixa superior, rolante e fixa inferior) e VSCSAD
+static void send_scroll_definition(int tfa, int vsa) {
+    int bfa = ST7789_RAM_ROWS - tfa - vsa;
+    uint8_t def[6] = { tfa >> 8, tfa & 0xFF, vsa >> 8, vsa & 0xFF, bfa >> 8, bfa & 0xFF };
+    uint8_t start[2] = { tfa >> 8, tfa & 0xFF };
+
+    send_cmd(ST7789_CMD_VSCRDEF);
+    send_data(def, sizeof(def));
+    send_cmd(ST7789_CMD_VSCSAD);
+    send_data(start, sizeof(start));
+}
+
+static void fb_fill_rows(int y, int h, uint16_t swapped) {
+    uint16_t *dst = &framebuffer[y * ST7789_WIDTH];
+    for (int i = 0; i < h * ST7789_WIDTH; i++) {
+        dst[i] = swapped;
+    }
+}
 
-    while (bytes_to_send > 0) {
-        size_t chunk_size = (bytes_to_send > SPI_MAX_CHUNK_SIZE) ? SPI_MAX_CHUNK_SIZE : bytes_to_send;
-        send_data(data_ptr, chunk_size);
-        data_ptr += chunk_size;
-        bytes_to_send -= chunk_size;
+// Marca apenas written_rows (sincronia entre os dois framebuffers), sem gerar envio
+static void written_add_rows(int y, int h) {
+    for (int ty = y >> ST7789_TILE_SHIFT; ty <= (y + h - 1) >> ST7789_TILE_SHIFT; ty++) {
+        written_rows[ty] = (uint16_t)((1u << ST7789_TILES_X) - 1);
+    }
+}
+
+// Com deslocamento, a memória do display está rotacionada em relação ao
+// framebuffer: ao desfazer a região, ela precisa ser reenviada inteira.
+static void scroll_region_discard(void) {
+    if (scroll.active && scroll.offset != 0) {
+        damage_add(0, scroll.y, ST7789_WIDTH, scroll.h);
+    }
+    scroll.active = false;
+    scroll.offset = 0;
+    scroll.vscsad_pending = false;
+}
+
+esp_err_t st7789_scroll_region_set(int y, int h) {
+    if (y < 0 || h < 2 || y + h > ST7789_HEIGHT) return ESP_ERR_INVALID_ARG;
+    if (rotation != 0) return ESP_ERR_NOT_SUPPORTED;   // MV/MY mudam o eixo de varredura
+    if (!spi_dev) return ESP_ERR_INVALID_STATE;
+
+    scroll_region_discard();
+    send_scroll_definition(offset_y + y, h);
+    scroll.y = y;
+    scroll.h = h;
+    scroll.active = true;
+    return ESP_OK;
+}
+
+void st7789_scroll_region_reset(void) {
+    if (!scroll.active) return;
+    scroll_region_discard();
+    send_scroll_definition(0, ST7789_RAM_ROWS);
+}
+
+bool st7789_scroll_region_active(void) {
+    return scroll.active;
+}
+
+void st7789_scroll_region_scroll(int dy, uint16_t fill) {
+    if (!scroll.active || !framebuffer || dy == 0) return;
+
+    int y = scroll.y;
+    int h = scroll.h;
+    int n = dy > 0 ? dy : -dy;
+    uint16_t swapped = SWAP_BYTES(fill);
+    size_t row_px = ST7789_WIDTH;
+
+    if (n >= h) {
+        // Nada sobrevive: só pinta a região, sem mexer no deslocamento
+        fb_fill_rows(y, h, swapped);
+        damage_add(0, y, ST7789_WIDTH, h);
+        return;
+    }
+
+    // Danos pendentes dentro da região se referem a linhas que vão mudar de
+    // lugar; em vez de deslocar o mapa, a região inteira é reenviada.
+    bool pending = false;
+    for (int ty = y >> ST7789_TILE_SHIFT; ty <= (y + h - 1) >> ST7789_TILE_SHIFT; ty++) {
+        pending |= damage_rows[ty] != 0;
+    }
+
+    if (dy > 0) {
+        memmove(&framebuffer[y * row_px], &framebuffer[(y + n) * row_px], (h - n) * row_px * sizeof(uint16_t));
+        fb_fill_rows(y + h - n, n, swapped);
+        damage_add(0, y + h - n, ST7789_WIDTH, n);
+    } else {
+        memmove(&framebuffer[(y + n) * row_px], &framebuffer[y * row_px], (h - n) * row_px * sizeof(uint16_t));
+        fb_fill_rows(y, n, swapped);
+        damage_add(0, y, ST7789_WIDTH, n);
+    }
+    written_add_rows(y, h);
+
+    scroll.offset = ((scroll.offset + dy) % h + h) % h;
+    scroll.vscsad_pending = true;
+
+    if (pending) {
+        damage_add(0, y, ST7789_WIDTH, h);
     }
 }
 
@@ -356,9 +810,12 @@ static void draw_quarter_circle(int cx, int cy, int r, uint16_t color, int quadr
 }
 
 
-void st7789_set_rotation(uint8_t rotation) {
+void st7789_set_rotation(uint8_t rot) {
     uint8_t madctl = 0;
-    rotation %= 4;
+    rotation = rot % 4;
+
+    // A região de rolagem depende da orientação e dos offsets atuais
+    st7789_scroll_region_reset();
 
     switch (rotation) {
         case 0:
@@ -395,9 +852,20 @@ void st7789_init(void) {
         .cs_pin = ST7789_CS_PIN,
         .clock_speed_hz = 40 * 1000 * 1000,  // 40 MHz
         .mode = 0,
-        .queue_size = 7,
+        .queue_size = 1,                     // Só o árbitro enfileira, um bloco por vez
+        .pre_cb = st7789_spi_pre_cb,
+        .post_cb = st7789_spi_post_cb,
     };
     
+    if (!trans_sem) {
+        trans_sem = xSemaphoreCreateCounting(ST7789_SPI_QUEUE_SIZE, 0);
+        present_free = xSemaphoreCreateBinary();
+        if (!trans_sem || !present_free) {
+            ESP_LOGE(TAG, "Falha ao criar semáforo do flush");
+            return;
+        }
+    }
+
     esp_err_t ret = spi_add_device(SPI_DEVICE_ST7789, &st7789_cfg);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Falha ao adicionar ST7789 no SPI: %s", esp_err_to_name(ret));
@@ -445,15 +913,10 @@ void st7789_init(void) {
     send_cmd(ST7789_CMD_DISPON);  
     vTaskDelay(pdMS_TO_TICKS(255));
 
-    size_t fb_size = ST7789_WIDTH * ST7789_HEIGHT * sizeof(uint16_t);
-    framebuffer = (uint16_t *)heap_caps_malloc(fb_size, MALLOC_CAP_DMA | MALLOC_CAP_32BIT);
+    st7789_enable_framebuffer();
     if (!framebuffer) {
-        ESP_LOGE(TAG, "Falha ao alocar framebuffer!");
         return;
     }
-    ESP_LOGI(TAG, "Framebuffer alocado com sucesso (%d bytes)", fb_size);
-
-    memset(framebuffer, 0, fb_size);
 
     st7789_set_text_size(2);
     st7789_flush();
@@ -462,36 +925,68 @@ void st7789_init(void) {
     ESP_LOGI(TAG, "ST7789 inicializado com sucesso!");
 }
 
-// ✨ OTIMIZADO: Desenha linhas horizontais e verticais de forma muito eficiente.
+// ** Caminho interno de pixels **
+// As primitivas _fb recortam a área e marcam o dano uma única vez por chamada.
+// Dentro delas os pixels são gravados pelos helpers abaixo, que não mexem no
+// mapa de danos. fb_put não verifica limites; fb_put_clip é usado apenas
+// quando a primitiva cruza a borda da tela.
+static inline void fb_put(int x, int y, uint16_t swapped) {
+    framebuffer[y * ST7789_WIDTH + x] = swapped;
+}
 
-void st7789_draw_hline_fb(int x, int y, int w, uint16_t color) {
-    if (y < 0 || y >= ST7789_HEIGHT || w <= 0) return;
+static inline void fb_put_clip(int x, int y, uint16_t swapped) {
+    if ((unsigned)x < ST7789_WIDTH && (unsigned)y < ST7789_HEIGHT) {
+        framebuffer[y * ST7789_WIDTH + x] = swapped;
+    }
+}
+
+#define FB_PUT(inside, x, y, c) \
+    do { if (inside) fb_put((x), (y), (c)); else fb_put_clip((x), (y), (c)); } while (0)
+
+// true se o retângulo está inteiramente dentro da tela
+static inline bool fb_inside(int x, int y, int w, int h) {
+    return x >= 0 && y >= 0 && x + w <= ST7789_WIDTH && y + h <= ST7789_HEIGHT;
+}
+
+// Preenche `n` pixels consecutivos usando escritas de 32 bits
+static inline void fb_fill_span(uint16_t *dst, int n, uint16_t swapped) {
+    if (n > 0 && ((uintptr_t)dst & 2)) {
+        *dst++ = swapped;
+        n--;
+    }
+    uint32_t color32 = ((uint32_t)swapped << 16) | swapped;
+    uint32_t *dst32 = (uint32_t *)dst;
+    for (int i = 0; i < n / 2; i++) {
+        dst32[i] = color32;
+    }
+    if (n & 1) {
+        dst[n - 1] = swapped;
+    }
+}
+
+// Linhas e retângulos recortados, sem marcar dano
+static void fb_hline_raw(int x, int y, int w, uint16_t swapped) {
+    if (y < 0 || y >= ST7789_HEIGHT) return;
     if (x < 0) { w += x; x = 0; }
     if (x + w > ST7789_WIDTH) { w = ST7789_WIDTH - x; }
     if (w <= 0) return;
 
-    uint16_t swapped_color = SWAP_BYTES(color);
-    for (int i = 0; i < w; i++) {
-        framebuffer[y * ST7789_WIDTH + x + i] = swapped_color;
-    }
+    fb_fill_span(&framebuffer[y * ST7789_WIDTH + x], w, swapped);
 }
 
-void st7789_draw_vline_fb(int x, int y, int h, uint16_t color) {
-    if (x < 0 || x >= ST7789_WIDTH || h <= 0) return;
+static void fb_vline_raw(int x, int y, int h, uint16_t swapped) {
+    if (x < 0 || x >= ST7789_WIDTH) return;
     if (y < 0) { h += y; y = 0; }
     if (y + h > ST7789_HEIGHT) { h = ST7789_HEIGHT - y; }
     if (h <= 0) return;
 
-    uint16_t swapped_color = SWAP_BYTES(color);
+    uint16_t *dst = &framebuffer[y * ST7789_WIDTH + x];
     for (int i = 0; i < h; i++) {
-        framebuffer[(y + i) * ST7789_WIDTH + x] = swapped_color;
+        dst[i * ST7789_WIDTH] = swapped;
     }
 }
 
-// ✨ OTIMIZADO: Desenha retângulos preenchidos usando as linhas otimizadas.
-void st7789_fill_rect_fb(int x, int y, int w, int h, uint16_t color) {
-    if (w <= 0 || h <= 0) return;
-    // Clipping
+static void fb_fill_rect_raw(int x, int y, int w, int h, uint16_t swapped) {
     if (x < 0) { w += x; x = 0; }
     if (y < 0) { h += y; y = 0; }
     if (x + w > ST7789_WIDTH) { w = ST7789_WIDTH - x; }
@@ -499,10 +994,31 @@ void st7789_fill_rect_fb(int x, int y, int w, int h, uint16_t color) {
     if (w <= 0 || h <= 0) return;
 
     for (int i = 0; i < h; i++) {
-        st7789_draw_hline_fb(x, y + i, w, color);
+        fb_fill_span(&framebuffer[(y + i) * ST7789_WIDTH + x], w, swapped);
     }
 }
 
+// ✨ OTIMIZADO: Desenha linhas horizontais e verticais de forma muito eficiente.
+
+void st7789_draw_hline_fb(int x, int y, int w, uint16_t color) {
+    if (w <= 0) return;
+    fb_hline_raw(x, y, w, SWAP_BYTES(color));
+    damage_add(x, y, w, 1);
+}
+
+void st7789_draw_vline_fb(int x, int y, int h, uint16_t color) {
+    if (h <= 0) return;
+    fb_vline_raw(x, y, h, SWAP_BYTES(color));
+    damage_add(x, y, 1, h);
+}
+
+// ✨ OTIMIZADO: Desenha retângulos preenchidos com escritas de 32 bits por linha.
+void st7789_fill_rect_fb(int x, int y, int w, int h, uint16_t color) {
+    if (w <= 0 || h <= 0) return;
+    fb_fill_rect_raw(x, y, w, h, SWAP_BYTES(color));
+    damage_add(x, y, w, h);
+}
+
 // ✨ OTIMIZADO: Desenha a borda de um retângulo.
 void st7789_draw_rect_fb(int x, int y, int w, int h, uint16_t color) {
     st7789_draw_hline_fb(x, y, w, color);
@@ -511,42 +1027,15 @@ void st7789_draw_rect_fb(int x, int y, int w, int h, uint16_t color) {
     st7789_draw_vline_fb(x + w - 1, y, h, color);
 }
 
-// ✨ OTIMIZADO: Desenha um caractere no framebuffer.
+// ✨ OTIMIZADO: Desenha um caractere no framebuffer com a fonte atual
+// (st7789_set_font) e a escala de st7789_set_text_size.
 void st7789_draw_char_fb(int x, int y, char c, uint16_t color, uint16_t bg_color) {
-    if ((uint8_t)c < 32 || (uint8_t)c > 127) c = '?';
-    
-    const uint8_t *glyph = font5x7[(uint8_t)c - 32];
-    bool is_opaque = (color != bg_color);
-
-    for (int col = 0; col < 5; col++) {
-        uint8_t column_bits = glyph[col];
-        for (int row = 0; row < 7; row++) {
-            uint16_t pixel_color = (column_bits & (1 << row)) ? color : bg_color;
-            if (is_opaque || pixel_color == color) { // Desenha o pixel se for opaco ou se for a cor do texto
-                if (text_size == 1) {
-                    st7789_draw_pixel_fb(x + col, y + row, pixel_color);
-                } else {
-                    st7789_fill_rect_fb(x + (col * text_size), y + (row * text_size), text_size, text_size, pixel_color);
-                }
-            }
-        }
-    }
+    st7789_draw_char_font_fb(x, y, c, st7789_get_font(), text_size, color, bg_color);
 }
 
-// ✨ OTIMIZADO: Desenha texto no framebuffer.
+// ✨ OTIMIZADO: Desenha texto no framebuffer usando o cache de glifos.
 void st7789_draw_text_fb(int x, int y, const char *text, uint16_t color, uint16_t bg_color) {
-    if (!text) return;
-    int current_x = x;
-    while (*text) {
-        if (*text == '\n') {
-            y += 8 * text_size;
-            current_x = x;
-        } else {
-            st7789_draw_char_fb(current_x, y, *text, color, bg_color);
-            current_x += 6 * text_size;
-        }
-        text++;
-    }
+    st7789_draw_text_font_fb(x, y, text, st7789_get_font(), text_size, color, bg_color);
 }
 
 // ✨ OTIMIZADO: Desenha uma imagem (bitmap RGB565) no framebuffer.
@@ -558,14 +1047,17 @@ void st7789_draw_image_fb(int x, int y, int w, int h, const uint16_t *image) {
     int y_start = y > 0 ? y : 0;
     int x_end = (x + w < ST7789_WIDTH) ? x + w : ST7789_WIDTH;
     int y_end = (y + h < ST7789_HEIGHT) ? y + h : ST7789_HEIGHT;
+    if (x_start >= x_end || y_start >= y_end) return;
 
+    int span = x_end - x_start;
     for (int j = y_start; j < y_end; j++) {
-        for (int i = x_start; i < x_end; i++) {
-            int src_x = i - x;
-            int src_y = j - y;
-            st7789_draw_pixel_fb(i, j, image[src_y * w + src_x]);
+        const uint16_t *src = &image[(j - y) * w + (x_start - x)];
+        uint16_t *dst = &framebuffer[j * ST7789_WIDTH + x_start];
+        for (int i = 0; i < span; i++) {
+            dst[i] = SWAP_BYTES(src[i]);
         }
     }
+    damage_add(x_start, y_start, span, y_end - y_start);
 }
 
 // --- Outras Funções de Desenho (Adaptadas para Framebuffer) ---
@@ -575,8 +1067,14 @@ void st7789_draw_line_fb(int x0, int y0, int x1, int y1, uint16_t color) {
     int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
     int err = dx + dy, e2;
 
+    int bx = x0 < x1 ? x0 : x1;
+    int by = y0 < y1 ? y0 : y1;
+    bool inside = fb_inside(bx, by, dx + 1, -dy + 1);
+    uint16_t swapped = SWAP_BYTES(color);
+    damage_add(bx, by, dx + 1, -dy + 1);
+
     for (;;) {
-        st7789_draw_pixel_fb(x0, y0, color);
+        FB_PUT(inside, x0, y0, swapped);
         if (x0 == x1 && y0 == y1) break;
         e2 = 2 * err;
         if (e2 >= dy) { err += dy; x0 += sx; }
@@ -586,12 +1084,16 @@ void st7789_draw_line_fb(int x0, int y0, int x1, int y1, uint16_t color) {
 
 void st7789_draw_circle_fb(int x0, int y0, int r, uint16_t color) {
     if (r <= 0) return;
+    bool inside = fb_inside(x0 - r, y0 - r, 2 * r + 1, 2 * r + 1);
+    uint16_t swapped = SWAP_BYTES(color);
+    damage_add(x0 - r, y0 - r, 2 * r + 1, 2 * r + 1);
+
     int x = -r, y = 0, err = 2 - 2 * r;
     do {
-        st7789_draw_pixel_fb(x0 - x, y0 + y, color);
-        st7789_draw_pixel_fb(x0 + x, y0 + y, color);
-        st7789_draw_pixel_fb(x0 + x, y0 - y, color);
-        st7789_draw_pixel_fb(x0 - x, y0 - y, color);
+        FB_PUT(inside, x0 - x, y0 + y, swapped);
+        FB_PUT(inside, x0 + x, y0 + y, swapped);
+        FB_PUT(inside, x0 + x, y0 - y, swapped);
+        FB_PUT(inside, x0 - x, y0 - y, swapped);
         r = err;
         if (r <= y) err += ++y * 2 + 1;
         if (r > x || err > y) err += ++x * 2 + 1;
@@ -600,10 +1102,13 @@ void st7789_draw_circle_fb(int x0, int y0, int r, uint16_t color) {
 
 void st7789_fill_circle_fb(int x0, int y0, int r, uint16_t color) {
     if (r <= 0) return;
+    uint16_t swapped = SWAP_BYTES(color);
+    damage_add(x0 - r, y0 - r, 2 * r + 1, 2 * r + 1);
+
     int x = -r, y = 0, err = 2 - 2 * r;
     do {
-        st7789_draw_hline_fb(x0 + x, y0 - y, 2 * (-x) + 1, color);
-        st7789_draw_hline_fb(x0 + x, y0 + y, 2 * (-x) + 1, color);
+        fb_hline_raw(x0 + x, y0 - y, 2 * (-x) + 1, swapped);
+        fb_hline_raw(x0 + x, y0 + y, 2 * (-x) + 1, swapped);
         r = err;
         if (r <= y) err += ++y * 2 + 1;
         if (r > x || err > y) err += ++x * 2 + 1;
@@ -675,7 +1180,7 @@ void st7789_draw_line(int x0, int y0, int x1, int y1, uint16_t color) {
     }
 }
 
-static void draw_quarter_circle_helper_fb(int x, int y, int r, int corner, uint16_t color) {
+static void draw_quarter_circle_helper_fb(int x, int y, int r, int corner, uint16_t swapped, bool inside) {
     int f = 1 - r;
     int ddF_x = 1;
     int ddF_y = -2 * r;
@@ -693,20 +1198,20 @@ static void draw_quarter_circle_helper_fb(int x, int y, int r, int corner, uint1
         f += ddF_x;
 
         if (corner & 0x4) { // Canto superior esquerdo
-            st7789_draw_pixel_fb(x - y_offset, y - x_offset, color);
-            st7789_draw_pixel_fb(x - x_offset, y - y_offset, color);
+            FB_PUT(inside, x - y_offset, y - x_offset, swapped);
+            FB_PUT(inside, x - x_offset, y - y_offset, swapped);
         }
         if (corner & 0x2) { // Canto superior direito
-            st7789_draw_pixel_fb(x + x_offset, y - y_offset, color);
-            st7789_draw_pixel_fb(x + y_offset, y - x_offset, color);
+            FB_PUT(inside, x + x_offset, y - y_offset, swapped);
+            FB_PUT(inside, x + y_offset, y - x_offset, swapped);
         }
         if (corner & 0x8) { // Canto inferior esquerdo
-            st7789_draw_pixel_fb(x - y_offset, y + x_offset, color);
-            st7789_draw_pixel_fb(x - x_offset, y + y_offset, color);
+            FB_PUT(inside, x - y_offset, y + x_offset, swapped);
+            FB_PUT(inside, x - x_offset, y + y_offset, swapped);
         }
         if (corner & 0x1) { // Canto inferior direito
-            st7789_draw_pixel_fb(x + x_offset, y + y_offset, color);
-            st7789_draw_pixel_fb(x + y_offset, y + x_offset, color);
+            FB_PUT(inside, x + x_offset, y + y_offset, swapped);
+            FB_PUT(inside, x + y_offset, y + x_offset, swapped);
         }
     }
 }
@@ -802,16 +1307,13 @@ void st7789_draw_char(int x, int y, char c, uint16_t color) {
         c = ' ';
     }
 
-    // Obtém os dados do caractere na fonte 5x7
-    const uint8_t *glyph = font5x7[(uint8_t)c - 32];
-
-    // Itera por cada coluna do caractere (5 colunas)
-    for (int col = 0; col < 5; col++) {
-        uint8_t column_bits = glyph[col];
+    // Obtém os dados do caractere na fonte 5x7 (uma linha por byte)
+    const uint8_t *glyph = font_glyph(&font_5x7, c);
 
-        // Itera por cada bit da coluna (7 linhas)
-        for (int row = 0; row < 7; row++) {
-            if (column_bits & (1 << row)) {
+    for (int row = 0; row < 7; row++) {
+        uint8_t row_bits = glyph[row];
+        for (int col = 0; col < 5; col++) {
+            if (row_bits & (0x80 >> col)) {
                 st7789_draw_pixel(x + col, y + row, color);
             }
         }
@@ -1133,13 +1635,13 @@ void st7789_draw_char_scaled(int x, int y, char c, uint16_t color) {
         c = '?'; // Substitui caracteres não imprimíveis
     }
 
-    const uint8_t *glyph = font5x7[(uint8_t)c - 32];
+    const uint8_t *glyph = font_glyph(&font_5x7, c);
 
-    for (int col = 0; col < 5; col++) {
-        uint8_t column_bits = glyph[col];
+    for (int row = 0; row < 7; row++) {
+        uint8_t row_bits = glyph[row];
 
-        for (int row = 0; row < 7; row++) {
-            if (column_bits & 0x01) {
+        for (int col = 0; col < 5; col++) {
+            if (row_bits & (0x80 >> col)) {
                 int px = x + (col * text_size);
                 int py = y + (row * text_size);
 
@@ -1149,7 +1651,6 @@ void st7789_draw_char_scaled(int x, int y, char c, uint16_t color) {
                     st7789_draw_rect(px, py, text_size, text_size, color);
                 }
             }
-            column_bits >>= 1;
         }
     }
 }
@@ -1190,51 +1691,68 @@ void st7789_draw_text_centered(int centerX, int y, const char *text, uint16_t co
 static uint16_t *framebuffer = NULL;
 
 void st7789_mark_dirty(int x, int y, int w, int h) {
-    if (x < dirty_x0) dirty_x0 = x;
-    if (y < dirty_y0) dirty_y0 = y;
-    if (x + w > dirty_x1) dirty_x1 = x + w;
-    if (y + h > dirty_y1) dirty_y1 = y + h;
+    damage_add(x, y, w, h);
 }
 
-#define ST7789_SPI_CHUNK_SIZE (4096) // bytes
-
-
+// Envia imediatamente (e de forma síncrona) as regiões marcadas no mapa de danos,
+// independente do modo de flush.
 void st7789_update_dirty(void) {
     if (!framebuffer) return;
-    if (dirty_x1 <= dirty_x0 || dirty_y1 <= dirty_y0) return;
 
-    int w = dirty_x1 - dirty_x0;
-  
-
-    for (int y = dirty_y0; y < dirty_y1; y++) {
-        set_addr_window(dirty_x0, y, dirty_x1 - 1, y);
-
-        const uint8_t *ptr = (const uint8_t *)&framebuffer[y * ST7789_WIDTH + dirty_x0];
-        size_t len = w * sizeof(uint16_t);
-
-        while (len > 0) {
-            size_t chunk = len > ST7789_MAX_CHUNK_BYTES ? ST7789_MAX_CHUNK_BYTES : len;
-            send_data(ptr, chunk);
-            ptr += chunk;
-            len -= chunk;
-        }
+    damage_rect_t rects[ST7789_MAX_DAMAGE_RECTS];
+    int tiles;
+    int count = build_damage_rects(damage_rows, rects, ST7789_MAX_DAMAGE_RECTS, &tiles);
+    if (count == 0 && !scroll.vscsad_pending) return;
+    if (count < 0) {
+        rects[0] = (damage_rect_t){ 0, 0, ST7789_WIDTH, ST7789_HEIGHT };
+        count = 1;
     }
 
-    dirty_x0 = ST7789_WIDTH;
-    dirty_y0 = ST7789_HEIGHT;
-    dirty_x1 = 0;
-    dirty_y1 = 0;
+    st7789_flush_wait();
+    for (int i = 0; i < count; i++) {
+        queue_rect_mapped(framebuffer, &rects[i], false);
+    }
+    if (scroll.vscsad_pending) {
+        queue_scroll_start(false);
+    }
+    st7789_flush_wait();
+    memset(damage_rows, 0, sizeof(damage_rows));
 }
 
 
 
+// Aloca os dois framebuffers DMA. Se não houver memória para o segundo,
+// o driver segue com um único buffer e flush síncrono.
 void st7789_enable_framebuffer(void) {
-    framebuffer = heap_caps_malloc(ST7789_WIDTH * ST7789_HEIGHT * sizeof(uint16_t), MALLOC_CAP_DMA);
-    if (framebuffer) {
-        memset(framebuffer, 0, ST7789_WIDTH * ST7789_HEIGHT * sizeof(uint16_t));
-    } else {
-        ESP_LOGE("ST7789", "Erro ao alocar framebuffer!");
+    if (framebuffer) return;
+
+    for (int i = 0; i < 2; i++) {
+        fb_buffers[i] = heap_caps_malloc(ST7789_FB_SIZE, MALLOC_CAP_DMA | MALLOC_CAP_32BIT);
+        if (!fb_buffers[i]) break;
+        memset(fb_buffers[i], 0, ST7789_FB_SIZE);
+    }
+
+    if (!fb_buffers[0]) {
+        ESP_LOGE(TAG, "Erro ao alocar framebuffer!");
+        return;
     }
+    if (!fb_buffers[1]) {
+        ESP_LOGW(TAG, "Sem memória para o segundo framebuffer, flush síncrono");
+    }
+
+    for (int i = 0; i < 2; i++) {
+        stage_buffers[i] = heap_caps_malloc(ST7789_STAGE_BYTES, MALLOC_CAP_DMA);
+        if (!stage_buffers[i]) {
+            heap_caps_free(stage_buffers[0]);
+            stage_buffers[0] = NULL;
+            break;
+        }
+    }
+
+    fb_back_index = 0;
+    framebuffer = fb_buffers[0];
+    ESP_LOGI(TAG, "Framebuffer alocado com sucesso (%d x %d bytes)",
+             fb_buffers[1] ? 2 : 1, (int)ST7789_FB_SIZE);
 }
 
 uint16_t *st7789_get_framebuffer(void) {
@@ -1252,10 +1770,9 @@ void st7789_draw_pixel_fb(int x, int y, uint16_t color) {
 
     framebuffer[y * ST7789_WIDTH + x] = SWAP_BYTES(color);
 
-    if (x < dirty_x0) dirty_x0 = x;
-    if (y < dirty_y0) dirty_y0 = y;
-    if (x + 1 > dirty_x1) dirty_x1 = x + 1;
-    if (y + 1 > dirty_y1) dirty_y1 = y + 1;
+    uint16_t bit = 1 << (x >> ST7789_TILE_SHIFT);
+    damage_rows[y >> ST7789_TILE_SHIFT] |= bit;
+    written_rows[y >> ST7789_TILE_SHIFT] |= bit;
 }
 
 
@@ -1270,7 +1787,7 @@ void st7789_draw_icon(int x, int y, const uint8_t *icon_bits, uint16_t fg, uint1
     }
 }
 
-static void fill_circle_helper_fb(int16_t x0, int16_t y0, int16_t r, uint8_t corner, int16_t delta, uint16_t color) {
+static void fill_circle_helper_fb(int16_t x0, int16_t y0, int16_t r, uint8_t corner, int16_t delta, uint16_t swapped) {
     int16_t f = 1 - r;
     int16_t ddF_x = 1;
     int16_t ddF_y = -2 * r;
@@ -1288,12 +1805,12 @@ static void fill_circle_helper_fb(int16_t x0, int16_t y0, int16_t r, uint8_t cor
         f += ddF_x;
 
         if (corner & 0x1) { // top left
-            st7789_draw_vline_fb(x0 - y, y0 - x, 2 * x + 1 + delta, color);
-            st7789_draw_vline_fb(x0 - x, y0 - y, 2 * y + 1 + delta, color);
+            fb_vline_raw(x0 - y, y0 - x, 2 * x + 1 + delta, swapped);
+            fb_vline_raw(x0 - x, y0 - y, 2 * y + 1 + delta, swapped);
         }
         if (corner & 0x2) { // top right
-            st7789_draw_vline_fb(x0 + x, y0 - y, 2 * y + 1 + delta, color);
-            st7789_draw_vline_fb(x0 + y, y0 - x, 2 * x + 1 + delta, color);
+            fb_vline_raw(x0 + x, y0 - y, 2 * y + 1 + delta, swapped);
+            fb_vline_raw(x0 + y, y0 - x, 2 * x + 1 + delta, swapped);
         }
     }
 }
@@ -1303,12 +1820,16 @@ void st7789_fill_round_rect_fb(int x, int y, int w, int h, int r, uint16_t color
     if (r > w / 2) r = w / 2;
     if (r > h / 2) r = h / 2;
 
+    uint16_t swapped = SWAP_BYTES(color);
+
     // Retângulo central
-    st7789_fill_rect_fb(x + r, y, w - 2 * r, h, color);
+    fb_fill_rect_raw(x + r, y, w - 2 * r, h, swapped);
 
     // Preenche os cantos
-    fill_circle_helper_fb(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, color);
-    fill_circle_helper_fb(x + r, y + r, r, 1, h - 2 * r - 1, color);
+    fill_circle_helper_fb(x + w - r - 1, y + r, r, 1, h - 2 * r - 1, swapped);
+    fill_circle_helper_fb(x + r, y + r, r, 1, h - 2 * r - 1, swapped);
+
+    damage_add(x, y, w, h);
 }
 
 void st7789_draw_round_rect_fb(int x, int y, int w, int h, int r, uint16_t color) {
@@ -1316,17 +1837,27 @@ void st7789_draw_round_rect_fb(int x, int y, int w, int h, int r, uint16_t color
     if (r > w / 2) r = w / 2;
     if (r > h / 2) r = h / 2;
 
+    uint16_t swapped = SWAP_BYTES(color);
+    bool inside = fb_inside(x, y, w, h);
+
     // Desenha as linhas retas
-    st7789_draw_hline_fb(x + r, y, w - 2 * r, color);         // Topo
-    st7789_draw_hline_fb(x + r, y + h - 1, w - 2 * r, color); // Base
-    st7789_draw_vline_fb(x, y + r, h - 2 * r, color);         // Esquerda
-    st7789_draw_vline_fb(x + w - 1, y + r, h - 2 * r, color); // Direita
+    fb_hline_raw(x + r, y, w - 2 * r, swapped);         // Topo
+    fb_hline_raw(x + r, y + h - 1, w - 2 * r, swapped); // Base
+    fb_vline_raw(x, y + r, h - 2 * r, swapped);         // Esquerda
+    fb_vline_raw(x + w - 1, y + r, h - 2 * r, swapped); // Direita
 
     // Desenha os cantos arredondados
-    draw_quarter_circle_helper_fb(x + r, y + r, r, 4, color);                         // Canto sup-esq 4
-    draw_quarter_circle_helper_fb(x + w - r - 1, y + r, r, 2, color);                 // Canto sup-dir
-    draw_quarter_circle_helper_fb(x + r, y + h - r - 1, r, 8, color);                 // Canto inf-esq
-    draw_quarter_circle_helper_fb(x + w - r - 1, y + h - r - 1, r, 1, color);         // Canto inf-dir 1
+    draw_quarter_circle_helper_fb(x + r, y + r, r, 4, swapped, inside);                   // Canto sup-esq 4
+    draw_quarter_circle_helper_fb(x + w - r - 1, y + r, r, 2, swapped, inside);           // Canto sup-dir
+    draw_quarter_circle_helper_fb(x + r, y + h - r - 1, r, 8, swapped, inside);           // Canto inf-esq
+    draw_quarter_circle_helper_fb(x + w - r - 1, y + h - r - 1, r, 1, swapped, inside);   // Canto inf-dir 1
+
+    // Só a moldura (bordas + arcos dos cantos) muda; o interior fica intacto
+    int t = r + 1;
+    damage_add(x, y, w, t);
+    damage_add(x, y + h - t, w, t);
+    damage_add(x, y, t, h);
+    damage_add(x + w - t, y, t, h);
 }
 
 // ✨ CORRIGIDO: Preenche a tela com a ordem de bytes correta.
@@ -1344,52 +1875,75 @@ void st7789_fill_screen_fb(uint16_t color) {
     if (num_pixels % 2 != 0) {
         framebuffer[num_pixels - 1] = swapped_color;
     }
+    damage_add(0, 0, ST7789_WIDTH, ST7789_HEIGHT);
 }
 
 
+// Recorta um bitmap (w x h) posicionado em (x, y) contra a tela.
+// Retorna false se nada fica visível; senão devolve o intervalo visível em coordenadas do bitmap.
+static bool clip_bitmap(int x, int y, int w, int h, int *i0, int *j0, int *i1, int *j1) {
+    *i0 = x < 0 ? -x : 0;
+    *j0 = y < 0 ? -y : 0;
+    *i1 = (x + w > ST7789_WIDTH) ? ST7789_WIDTH - x : w;
+    *j1 = (y + h > ST7789_HEIGHT) ? ST7789_HEIGHT - y : h;
+    return *i0 < *i1 && *j0 < *j1;
+}
+
 void st7789_draw_bitmap_1bit_fb(int x, int y, const uint8_t *bitmap, int w, int h, uint16_t fg, uint16_t bg) {
-    for (int j = 0; j < h; j++) {
-        for (int i = 0; i < w; i++) {
+    int i0, j0, i1, j1;
+    if (!bitmap || !clip_bitmap(x, y, w, h, &i0, &j0, &i1, &j1)) return;
+
+    uint16_t fg_swapped = SWAP_BYTES(fg);
+    uint16_t bg_swapped = SWAP_BYTES(bg);
+
+    for (int j = j0; j < j1; j++) {
+        uint16_t *dst = &framebuffer[(y + j) * ST7789_WIDTH + x];
+        for (int i = i0; i < i1; i++) {
             int byte_index = (j * w + i) / 8;
             int bit_index = 7 - (i % 8);
             bool pixel = (bitmap[byte_index] >> bit_index) & 0x01;
-            st7789_draw_pixel_fb(x + i, y + j, pixel ? fg : bg);
+            dst[i] = pixel ? fg_swapped : bg_swapped;
         }
     }
+    damage_add(x + i0, y + j0, i1 - i0, j1 - j0);
 }
 
 void st7789_draw_bitmap_fb(int x, int y, const uint8_t *bitmap, int w, int h, uint16_t color) {
+    int i0, j0, i1, j1;
     if (!bitmap || w <= 0 || h <= 0) return;
+    if (!clip_bitmap(x, y, w, h, &i0, &j0, &i1, &j1)) return;
 
     int bytes_per_row = (w + 7) / 8; // Calcula quantos bytes por linha no bitmap
+    uint16_t swapped = SWAP_BYTES(color);
 
-    for (int j = 0; j < h; j++) {
-        for (int i = 0; i < w; i++) {
+    for (int j = j0; j < j1; j++) {
+        const uint8_t *src = &bitmap[j * bytes_per_row];
+        uint16_t *dst = &framebuffer[(y + j) * ST7789_WIDTH + x];
+        for (int i = i0; i < i1; i++) {
             // Verifica se o bit correspondente ao pixel está setado
-            if (bitmap[j * bytes_per_row + i / 8] & (128 >> (i % 8))) {
-                st7789_draw_pixel_fb(x + i, y + j, color);
+            if (src[i / 8] & (128 >> (i % 8))) {
+                dst[i] = swapped;
             }
         }
     }
+    damage_add(x + i0, y + j0, i1 - i0, j1 - j0);
 }
 
 
+// Descarta as regiões pendentes de envio. O controle de tiles alterados entre
+// os dois framebuffers não é afetado.
 void st7789_reset_dirty_rect(void) {
-    dirty_x0 = ST7789_WIDTH;
-    dirty_y0 = ST7789_HEIGHT;
-    dirty_x1 = 0;
-    dirty_y1 = 0;
+    memset(damage_rows, 0, sizeof(damage_rows));
 }
 
 
 
 void st7789_scroll_text(int x, int y, int offset_y, const char *text, uint16_t color, uint16_t bg_color) {
-    st7789_reset_dirty_rect(); 
-    int text_len = strlen(text);
-    for (int i = 0; i < text_len; i++) {
-        st7789_draw_char_fb(x + i * 6 * text_size, y + offset_y, text[i], color, bg_color);  // Assuming 6 pixels width
+    if (scroll.active) {
+        st7789_scroll_region_scroll(offset_y, bg_color);
+    } else {
+        y += offset_y;
     }
-    st7789_mark_dirty(x, y + offset_y, text_len * 6 * text_size, 8 * text_size); // Update dirty rect
+    st7789_draw_text_fb(x, y, text, color, bg_color);
     st7789_update_dirty();
 }
-
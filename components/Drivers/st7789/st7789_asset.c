@@ -0,0 +1,73 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "st7789_asset.h"
+
+#define SWAP_BYTES(color) ((((color) >> 8) & 0xFF) | (((color) << 8) & 0xFF00))
+
+// Parte visível da imagem em coordenadas da imagem: colunas [i0, i1), linhas [j0, j1)
+static bool clip_asset(int x, int y, const asset_image_t *img, int *i0, int *j0, int *i1, int *j1) {
+    *i0 = x < 0 ? -x : 0;
+    *j0 = y < 0 ? -y : 0;
+    *i1 = (x + img->width > ST7789_WIDTH) ? ST7789_WIDTH - x : img->width;
+    *j1 = (y + img->height > ST7789_HEIGHT) ? ST7789_HEIGHT - y : img->height;
+    return *i0 < *i1 && *j0 < *j1;
+}
+
+void st7789_draw_asset_fb(int x, int y, const asset_image_t *img) {
+    uint16_t *fb = st7789_get_framebuffer();
+    int i0, j0, i1, j1;
+    if (!fb || !img || img->format != ASSET_FMT_PAL_RLE) return;
+    if (!clip_asset(x, y, img, &i0, &j0, &i1, &j1)) return;
+
+    // Paleta convertida uma vez para a ordem de bytes do framebuffer
+    uint16_t lut[256];
+    int colors = img->palette_size > 256 ? 256 : img->palette_size;
+    for (int i = 0; i < colors; i++) {
+        lut[i] = SWAP_BYTES(img->palette[i]);
+    }
+
+    for (int j = j0; j < j1; j++) {
+        asset_decode_row(img, j, i0, i1, lut, &fb[(y + j) * ST7789_WIDTH + x + i0]);
+    }
+    st7789_mark_dirty(x + i0, y + j0, i1 - i0, j1 - j0);
+}
+
+void st7789_draw_asset_mono_fb(int x, int y, const asset_image_t *img, uint16_t color) {
+    uint16_t *fb = st7789_get_framebuffer();
+    int i0, j0, i1, j1;
+    if (!fb || !img || img->format == ASSET_FMT_PAL_RLE) return;
+    if (!clip_asset(x, y, img, &i0, &j0, &i1, &j1)) return;
+
+    uint16_t swapped = SWAP_BYTES(color);
+    for (int j = j0; j < j1; j++) {
+        asset_fill_row_fg(img, j, i0, i1, swapped, &fb[(y + j) * ST7789_WIDTH + x + i0]);
+    }
+    st7789_mark_dirty(x + i0, y + j0, i1 - i0, j1 - j0);
+}
+
+void st7789_draw_asset_mono_opaque_fb(int x, int y, const asset_image_t *img,
+                                      uint16_t fg, uint16_t bg) {
+    uint16_t *fb = st7789_get_framebuffer();
+    int i0, j0, i1, j1;
+    if (!fb || !img || img->format == ASSET_FMT_PAL_RLE) return;
+    if (!clip_asset(x, y, img, &i0, &j0, &i1, &j1)) return;
+
+    const uint16_t lut[2] = { SWAP_BYTES(bg), SWAP_BYTES(fg) };
+    for (int j = j0; j < j1; j++) {
+        asset_decode_row(img, j, i0, i1, lut, &fb[(y + j) * ST7789_WIDTH + x + i0]);
+    }
+    st7789_mark_dirty(x + i0, y + j0, i1 - i0, j1 - j0);
+}
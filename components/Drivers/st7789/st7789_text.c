@@ -0,0 +1,294 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "st7789_text.h"
+#include <stdlib.h>
+#include <string.h>
+
+#define SWAP_BYTES(color) ((((color) >> 8) & 0xFF) | (((color) << 8) & 0xFF00))
+
+// Cache associativo: o glifo cai em um conjunto pelo hash e ocupa uma das vias
+#define GLYPH_CACHE_SETS    16
+#define GLYPH_CACHE_WAYS    4
+#define GLYPH_CACHE_BUDGET  (12 * 1024)   // Bytes de pixels somando todas as entradas
+
+typedef struct {
+    const font_t *font;
+    uint16_t fg, bg;          // Já na ordem de bytes do framebuffer
+    uint8_t code;
+    uint8_t scale;
+    uint16_t w;               // Largura escalada (pixels por linha)
+    uint16_t *rows;           // font->height linhas de w pixels
+    uint32_t capacity;        // Pixels alocados em rows
+    uint32_t last_use;
+} glyph_entry_t;
+
+static glyph_entry_t cache[GLYPH_CACHE_SETS][GLYPH_CACHE_WAYS];
+static uint32_t cache_clock;
+static st7789_glyph_cache_stats_t cache_stats;
+
+static const font_t *current_font = &font_5x7;
+
+// Recorte em coordenadas absolutas [x0, x1) x [y0, y1)
+static int clip_x0 = 0, clip_y0 = 0;
+static int clip_x1 = ST7789_WIDTH, clip_y1 = ST7789_HEIGHT;
+
+void st7789_set_font(const font_t *font) {
+    current_font = font ? font : &font_5x7;
+}
+
+const font_t *st7789_get_font(void) {
+    return current_font;
+}
+
+void st7789_set_text_clip(int x, int y, int w, int h) {
+    clip_x0 = x < 0 ? 0 : x;
+    clip_y0 = y < 0 ? 0 : y;
+    clip_x1 = x + w > ST7789_WIDTH ? ST7789_WIDTH : x + w;
+    clip_y1 = y + h > ST7789_HEIGHT ? ST7789_HEIGHT : y + h;
+}
+
+void st7789_reset_text_clip(void) {
+    st7789_set_text_clip(0, 0, ST7789_WIDTH, ST7789_HEIGHT);
+}
+
+// Expande as colunas escaladas [from, to) de uma linha do glifo
+static void expand_row(const uint8_t *bits, int scale, const uint16_t lut[2],
+                       uint16_t *out, int from, int to) {
+    for (int px = from; px < to; px++) {
+        int col = px / scale;
+        *out++ = lut[(bits[col >> 3] >> (7 - (col & 7))) & 1];
+    }
+}
+
+static uint32_t glyph_hash(const font_t *font, uint8_t code, uint16_t fg, uint16_t bg, int scale) {
+    uint32_t h = (uint32_t)(uintptr_t)font >> 2;
+    h = h * 31 + code;
+    h = h * 31 + fg;
+    h = h * 31 + bg;
+    h = h * 31 + (uint32_t)scale;
+    return (h ^ (h >> 7)) & (GLYPH_CACHE_SETS - 1);
+}
+
+// Procura (ou cria) a entrada do glifo. Retorna NULL se não couber no orçamento.
+static glyph_entry_t *glyph_lookup(const font_t *font, const uint8_t *glyph, uint8_t code,
+                                   uint16_t fg, uint16_t bg, int scale) {
+    glyph_entry_t *set = cache[glyph_hash(font, code, fg, bg, scale)];
+    glyph_entry_t *victim = &set[0];
+
+    for (int i = 0; i < GLYPH_CACHE_WAYS; i++) {
+        glyph_entry_t *e = &set[i];
+        if (e->font == font && e->code == code && e->fg == fg && e->bg == bg && e->scale == scale) {
+            e->last_use = ++cache_clock;
+            cache_stats.hits++;
+            return e;
+        }
+        if (!e->font) {
+            victim = e;
+        } else if (victim->font && e->last_use < victim->last_use) {
+            victim = e;
+        }
+    }
+
+    cache_stats.misses++;
+    int w = font->width * scale;
+    uint32_t needed = (uint32_t)w * font->height;
+
+    if (victim->font) {
+        cache_stats.evictions++;
+        victim->font = NULL;
+    }
+    if (victim->capacity < needed) {
+        uint32_t bytes_after = cache_stats.bytes - victim->capacity * 2 + needed * 2;
+        if (w > ST7789_WIDTH || bytes_after > GLYPH_CACHE_BUDGET) {
+            return NULL;
+        }
+        uint16_t *rows = realloc(victim->rows, needed * sizeof(uint16_t));
+        if (!rows) {
+            return NULL;
+        }
+        cache_stats.bytes = bytes_after;
+        victim->rows = rows;
+        victim->capacity = needed;
+    }
+
+    const uint16_t lut[2] = { bg, fg };
+    int rb = font_row_bytes(font);
+    for (int row = 0; row < font->height; row++) {
+        expand_row(&glyph[row * rb], scale, lut, &victim->rows[row * w], 0, w);
+    }
+
+    victim->font = font;
+    victim->code = code;
+    victim->fg = fg;
+    victim->bg = bg;
+    victim->scale = scale;
+    victim->w = w;
+    victim->last_use = ++cache_clock;
+    return victim;
+}
+
+// Desenha um glifo já recortado pela região de texto. Não marca danos.
+static void blit_glyph(uint16_t *fb, int x, int y, char c, const font_t *font, int scale,
+                       uint16_t fg, uint16_t bg) {
+    int w = font->width * scale;
+    int h = font->height * scale;
+    int x0 = x > clip_x0 ? x : clip_x0;
+    int x1 = x + w < clip_x1 ? x + w : clip_x1;
+    int y0 = y > clip_y0 ? y : clip_y0;
+    int y1 = y + h < clip_y1 ? y + h : clip_y1;
+    if (x0 >= x1 || y0 >= y1) return;
+
+    const uint8_t *glyph = font_glyph(font, c);
+    if (!glyph) glyph = font_glyph(font, '?');
+    if (!glyph) return;
+
+    uint8_t code = (uint8_t)c;
+    glyph_entry_t *e = glyph_lookup(font, glyph, code, fg, bg, scale);
+    int span = x1 - x0;
+
+    if (e) {
+        // Cada linha da fonte vira `scale` linhas idênticas no framebuffer
+        for (int py = y0; py < y1; py++) {
+            const uint16_t *src = &e->rows[((py - y) / scale) * w + (x0 - x)];
+            memcpy(&fb[py * ST7789_WIDTH + x0], src, span * sizeof(uint16_t));
+        }
+        return;
+    }
+
+    // Sem espaço no cache: expande só a parte visível de cada linha
+    cache_stats.uncached++;
+    const uint16_t lut[2] = { bg, fg };
+    int rb = font_row_bytes(font);
+    int last_row = -1;
+    uint16_t line[ST7789_WIDTH];
+    for (int py = y0; py < y1; py++) {
+        int row = (py - y) / scale;
+        if (row != last_row) {
+            expand_row(&glyph[row * rb], scale, lut, line, x0 - x, x1 - x);
+            last_row = row;
+        }
+        memcpy(&fb[py * ST7789_WIDTH + x0], line, span * sizeof(uint16_t));
+    }
+}
+
+// Marca como alterada a faixa [x, x1) x [y, y + h) já recortada
+static void mark_clipped(int x, int y, int x1, int h) {
+    int y1 = y + h;
+    if (x < clip_x0) x = clip_x0;
+    if (y < clip_y0) y = clip_y0;
+    if (x1 > clip_x1) x1 = clip_x1;
+    if (y1 > clip_y1) y1 = clip_y1;
+    if (x < x1 && y < y1) {
+        st7789_mark_dirty(x, y, x1 - x, y1 - y);
+    }
+}
+
+void st7789_draw_char_font_fb(int x, int y, char c, const font_t *font, int scale,
+                              uint16_t color, uint16_t bg_color) {
+    uint16_t *fb = st7789_get_framebuffer();
+    if (!fb || !font) return;
+    if (scale < 1) scale = 1;
+
+    blit_glyph(fb, x, y, c, font, scale, SWAP_BYTES(color), SWAP_BYTES(bg_color));
+    mark_clipped(x, y, x + font->width * scale, font->height * scale);
+}
+
+void st7789_draw_text_font_fb(int x, int y, const char *text, const font_t *font, int scale,
+                              uint16_t color, uint16_t bg_color) {
+    uint16_t *fb = st7789_get_framebuffer();
+    if (!fb || !text || !font) return;
+    if (scale < 1) scale = 1;
+
+    uint16_t fg = SWAP_BYTES(color);
+    uint16_t bg = SWAP_BYTES(bg_color);
+    int advance = st7789_font_advance(font, scale);
+    int line_height = st7789_font_line_height(font, scale);
+    int glyph_w = font->width * scale;
+    int glyph_h = font->height * scale;
+    int cur_x = x;
+
+    // Uma marcação de dano por linha de texto
+    for (;; text++) {
+        if (*text == '\n' || *text == '\0') {
+            if (cur_x > x) {
+                mark_clipped(x, y, cur_x - advance + glyph_w, glyph_h);
+            }
+            if (*text == '\0') break;
+            y += line_height;
+            cur_x = x;
+            continue;
+        }
+        if (cur_x < clip_x1 && y < clip_y1) {
+            blit_glyph(fb, cur_x, y, *text, font, scale, fg, bg);
+        }
+        cur_x += advance;
+    }
+}
+
+int st7789_font_advance(const font_t *font, int scale) {
+    return (font->width + font->spacing) * scale;
+}
+
+int st7789_font_line_height(const font_t *font, int scale) {
+    return (font->height + font->spacing) * scale;
+}
+
+void st7789_measure_text(const font_t *font, int scale, const char *text, int *w, int *h) {
+    int max_chars = 0, chars = 0, lines = 0;
+    if (scale < 1) scale = 1;
+
+    if (text && *text) {
+        lines = 1;
+        for (; *text; text++) {
+            if (*text == '\n') {
+                lines++;
+                chars = 0;
+            } else if (++chars > max_chars) {
+                max_chars = chars;
+            }
+        }
+    }
+
+    if (w) *w = max_chars ? max_chars * st7789_font_advance(font, scale) - font->spacing * scale : 0;
+    if (h) *h = lines ? (lines - 1) * st7789_font_line_height(font, scale) + font->height * scale : 0;
+}
+
+int st7789_text_fit(const font_t *font, int scale, const char *text, int max_w) {
+    if (!text) return 0;
+    if (scale < 1) scale = 1;
+
+    int advance = st7789_font_advance(font, scale);
+    int glyph_w = font->width * scale;
+    int n = 0;
+    while (text[n] && text[n] != '\n' && n * advance + glyph_w <= max_w) {
+        n++;
+    }
+    return n;
+}
+
+void st7789_glyph_cache_clear(void) {
+    for (int s = 0; s < GLYPH_CACHE_SETS; s++) {
+        for (int i = 0; i < GLYPH_CACHE_WAYS; i++) {
+            free(cache[s][i].rows);
+        }
+    }
+    memset(cache, 0, sizeof(cache));
+    cache_stats.bytes = 0;
+}
+
+void st7789_get_glyph_cache_stats(st7789_glyph_cache_stats_t *stats) {
+    if (stats) *stats = cache_stats;
+}
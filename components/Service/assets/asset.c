@@ -0,0 +1,150 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "asset.h"
+
+static inline void fill16(uint16_t *dst, uint16_t value, int n) {
+    while (n-- > 0) *dst++ = value;
+}
+
+// Lê um comprimento de sequência MONO_RUNS (255 = continua no próximo byte)
+static inline int read_run(const uint8_t **p) {
+    int n = 0;
+    uint8_t b;
+    do {
+        b = *(*p)++;
+        n += b;
+    } while (b == 255);
+    return n;
+}
+
+static void decode_pal_rle(const uint8_t *p, int x0, int x1, const uint16_t *lut,
+                           uint16_t *dst) {
+    int x = 0;
+    while (x < x1) {
+        uint8_t c = *p++;
+        int n = (c & 0x7F) + 1;
+        int from = x > x0 ? x : x0;
+        int to = x + n < x1 ? x + n : x1;
+
+        if (c & 0x80) {
+            if (from < to) fill16(&dst[from - x0], lut[*p], to - from);
+            p++;
+        } else {
+            for (int i = from; i < to; i++) {
+                dst[i - x0] = lut[p[i - x]];
+            }
+            p += n;
+        }
+        x += n;
+    }
+}
+
+static void decode_mono_runs(const uint8_t *p, int x0, int x1, const uint16_t *lut,
+                             bool opaque, uint16_t *dst) {
+    int x = 0;
+    int fg = 0;
+    while (x < x1) {
+        int n = read_run(&p);
+        if (opaque || fg) {
+            int from = x > x0 ? x : x0;
+            int to = x + n < x1 ? x + n : x1;
+            if (from < to) fill16(&dst[from - x0], lut[fg], to - from);
+        }
+        x += n;
+        fg ^= 1;
+    }
+}
+
+// Quantos bits iguais a `bit` existem a partir de x (limitado a x1). Conta
+// por byte: zeros/uns iniciais de cada byte de uma vez.
+static inline int bits_run(const uint8_t *p, int x, int x1, int bit) {
+    int end = x;
+    while (end < x1) {
+        uint8_t b = p[end >> 3];
+        if (!bit) b = ~b;
+        int shift = end & 7;
+        b = (uint8_t)(b << shift);
+        int ones = (b == 0xFF) ? 8 : __builtin_clz((uint32_t)(uint8_t)~b << 24);
+        end += ones;
+        if (ones < 8 - shift) break;
+    }
+    return (end < x1 ? end : x1) - x;
+}
+
+static void decode_mono_bits(const uint8_t *p, int x0, int x1, const uint16_t *lut,
+                             bool opaque, uint16_t *dst) {
+    int x = x0;
+    while (x < x1) {
+        int bit = (p[x >> 3] >> (7 - (x & 7))) & 1;
+        int n = bits_run(p, x, x1, bit);
+        if (opaque || bit) fill16(&dst[x - x0], lut[bit], n);
+        x += n;
+    }
+}
+
+static inline bool is_mono(const asset_image_t *img) {
+    return img->format == ASSET_FMT_MONO_RUNS || img->format == ASSET_FMT_MONO_BITS;
+}
+
+static const uint8_t *row_data(const asset_image_t *img, int row) {
+    if (img->format == ASSET_FMT_MONO_BITS) {
+        return img->data + (uint32_t)row * ((img->width + 7) / 8);
+    }
+    return img->data + img->rows[row];
+}
+
+void asset_decode_row(const asset_image_t *img, int row, int x0, int x1,
+                      const uint16_t *lut, uint16_t *dst) {
+    if (!img || row < 0 || row >= img->height) return;
+    if (x0 < 0) x0 = 0;
+    if (x1 > img->width) x1 = img->width;
+    if (x0 >= x1) return;
+
+    const uint8_t *p = row_data(img, row);
+    if (img->format == ASSET_FMT_PAL_RLE) {
+        decode_pal_rle(p, x0, x1, lut, dst);
+    } else if (img->format == ASSET_FMT_MONO_RUNS) {
+        decode_mono_runs(p, x0, x1, lut, true, dst);
+    } else if (img->format == ASSET_FMT_MONO_BITS) {
+        decode_mono_bits(p, x0, x1, lut, true, dst);
+    }
+}
+
+void asset_fill_row_fg(const asset_image_t *img, int row, int x0, int x1,
+                       uint16_t color, uint16_t *dst) {
+    if (!img || !is_mono(img) || row < 0 || row >= img->height) return;
+    if (x0 < 0) x0 = 0;
+    if (x1 > img->width) x1 = img->width;
+    if (x0 >= x1) return;
+
+    const uint16_t lut[2] = { 0, color };
+    if (img->format == ASSET_FMT_MONO_RUNS) {
+        decode_mono_runs(row_data(img, row), x0, x1, lut, false, dst);
+    } else {
+        decode_mono_bits(row_data(img, row), x0, x1, lut, false, dst);
+    }
+}
+
+uint32_t asset_size(const asset_image_t *img) {
+    if (!img) return 0;
+    if (img->format == ASSET_FMT_MONO_BITS) {
+        return sizeof(*img) + (uint32_t)img->height * ((img->width + 7) / 8);
+    }
+    return sizeof(*img)
+         + img->palette_size * sizeof(uint16_t)
+         + (img->height + 1) * sizeof(uint16_t)
+         + img->rows[img->height];
+}
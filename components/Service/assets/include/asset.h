@@ -0,0 +1,71 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#pragma once
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Imagens compactadas geradas por tools/asset_packer.py. Cada linha é
+// codificada de forma independente e `rows[r]` aponta o seu início em `data`,
+// então o desenho pode começar em qualquer linha (recorte vertical) sem
+// decodificar as anteriores. A tabela tem height + 1 entradas; a última marca
+// o fim dos dados. O empacotador escolhe entre MONO_RUNS e MONO_BITS o que
+// ocupar menos para cada imagem monocromática.
+//
+// ASSET_FMT_PAL_RLE (ícones coloridos): paleta RGB565 de até 256 cores e, por
+// linha, blocos com um byte de controle:
+//   bit 7 = 1: repete o índice seguinte (c & 0x7F) + 1 vezes
+//   bit 7 = 0: seguem c + 1 índices literais
+//
+// ASSET_FMT_MONO_RUNS (arte monocromática): por linha, comprimentos de
+// sequências alternadas fundo/frente, começando pelo fundo. Um byte 255
+// soma 255 e continua no próximo byte, então sequências longas não exigem
+// largura fixa. A linha termina quando a soma alcança `width`.
+//
+// ASSET_FMT_MONO_BITS (arte com muito detalhe, onde as sequências não
+// compensam): 1 bit por pixel, (width + 7) / 8 bytes por linha, bit mais
+// significativo à esquerda. Sem tabela de linhas (rows = NULL). O desenho
+// ainda é feito por sequências, pulando bytes inteiros de 0x00/0xFF.
+
+typedef enum {
+    ASSET_FMT_PAL_RLE = 1,
+    ASSET_FMT_MONO_RUNS = 2,
+    ASSET_FMT_MONO_BITS = 3,
+} asset_format_t;
+
+typedef struct {
+    uint16_t width;
+    uint16_t height;
+    uint8_t format;            // asset_format_t
+    uint16_t palette_size;     // Entradas em palette (0 para MONO_RUNS)
+    const uint16_t *palette;   // RGB565 na ordem natural (não trocada)
+    const uint16_t *rows;      // Deslocamento de cada linha em data (NULL em MONO_BITS)
+    const uint8_t *data;
+} asset_image_t;
+
+// Expande as colunas [x0, x1) da linha `row` em dst (dst[0] = coluna x0).
+// `lut` traduz os índices: a paleta (já convertida pelo chamador) em
+// PAL_RLE ou { fundo, frente } nos formatos monocromáticos.
+void asset_decode_row(const asset_image_t *img, int row, int x0, int x1,
+                      const uint16_t *lut, uint16_t *dst);
+
+// Monocromático transparente: escreve `color` só nos pixels de frente de
+// [x0, x1), preservando o que já existe em dst.
+void asset_fill_row_fg(const asset_image_t *img, int row, int x0, int x1,
+                       uint16_t color, uint16_t *dst);
+
+// Bytes ocupados em flash (cabeçalho, paleta, tabela de linhas e dados)
+uint32_t asset_size(const asset_image_t *img);
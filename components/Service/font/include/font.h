@@ -15,7 +15,10 @@
 
 #pragma once
 #include <stdint.h>
+#include <stddef.h>
 
+// Cada glifo ocupa `height` linhas de (width + 7) / 8 bytes, com o bit mais
+// significativo do primeiro byte no pixel mais à esquerda.
 typedef struct {
     const uint8_t *bitmap;     // Dados dos glifos (bitmap contíguo)
     uint16_t first_char;       // Primeiro caractere
@@ -25,7 +28,20 @@ typedef struct {
     uint8_t spacing;           // Espaçamento entre caracteres
 } font_t;
 
+// Bytes por linha de glifo
+static inline int font_row_bytes(const font_t *font) {
+    return (font->width + 7) / 8;
+}
+
+// Retorna o bitmap do glifo de `c`, ou NULL se estiver fora da faixa da fonte
+static inline const uint8_t *font_glyph(const font_t *font, char c) {
+    uint8_t code = (uint8_t)c;
+    if (code < font->first_char || code > font->last_char) return NULL;
+    return font->bitmap + (size_t)(code - font->first_char) * font_row_bytes(font) * font->height;
+}
+
 // Fontes disponíveis
+extern const font_t font_5x7;
 extern const font_t font_ubuntu_16;
 extern const font_t font_terminus_24;
 extern const font_t font_arial_32;
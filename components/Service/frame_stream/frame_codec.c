@@ -0,0 +1,231 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "frame_codec.h"
+#include <string.h>
+
+#define TILE_PIXELS     (FRAME_CODEC_TILE * FRAME_CODEC_TILE)
+#define TILE_RAW_BYTES  (TILE_PIXELS * 2)
+
+// Estado de escrita de um pacote: CRC e contagem acumulados a cada trecho
+typedef struct {
+    frame_codec_write_fn write;
+    void *ctx;
+    uint32_t crc;
+    uint32_t bytes;
+} packet_t;
+
+static bool emit(packet_t *pkt, const void *data, size_t len) {
+    pkt->crc = frame_codec_crc32(pkt->crc, data, len);
+    pkt->bytes += len;
+    return pkt->write(pkt->ctx, data, len);
+}
+
+static inline void put_u16(uint8_t *p, uint16_t v) {
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+
+static inline void put_u32(uint8_t *p, uint32_t v) {
+    put_u16(p, v & 0xFFFF);
+    put_u16(p + 2, v >> 16);
+}
+
+uint32_t frame_codec_crc32(uint32_t crc, const void *data, size_t len) {
+    // Tabela de 4 bits: 64 bytes em vez de 1 KB, rápida o bastante para o link
+    static const uint32_t nibble[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+    };
+    const uint8_t *p = data;
+    crc = ~crc;
+    while (len--) {
+        crc ^= *p++;
+        crc = (crc >> 4) ^ nibble[crc & 0x0F];
+        crc = (crc >> 4) ^ nibble[crc & 0x0F];
+    }
+    return ~crc;
+}
+
+void frame_codec_init(frame_codec_t *codec, int width, int height, int keyframe_interval) {
+    memset(codec, 0, sizeof(*codec));
+    codec->width = width;
+    codec->height = height;
+    codec->tiles_x = (width + FRAME_CODEC_TILE - 1) / FRAME_CODEC_TILE;
+    codec->tiles_y = (height + FRAME_CODEC_TILE - 1) / FRAME_CODEC_TILE;
+    if (codec->tiles_x * codec->tiles_y > FRAME_CODEC_MAX_TILES) {
+        codec->tiles_y = FRAME_CODEC_MAX_TILES / codec->tiles_x;
+    }
+    codec->keyframe_interval = keyframe_interval;
+    codec->keyframe_pending = true;
+}
+
+void frame_codec_request_keyframe(frame_codec_t *codec) {
+    codec->keyframe_pending = true;
+}
+
+// Copia o tile para px e devolve o hash de 64 bits (duas vias de 32 bits)
+static uint64_t read_tile(const frame_codec_t *codec, const uint16_t *fb, int x, int y,
+                          int w, int h, uint16_t *px) {
+    uint32_t h1 = 2166136261u;
+    uint32_t h2 = 0x9E3779B9u;
+    for (int row = 0; row < h; row++) {
+        const uint16_t *src = &fb[(y + row) * codec->width + x];
+        for (int i = 0; i < w; i++) {
+            uint16_t v = src[i];
+            *px++ = v;
+            h1 = (h1 ^ v) * 16777619u;
+            h2 = ((h2 ^ v) << 5 | (h2 ^ v) >> 27) * 0x85EBCA6Bu;
+        }
+    }
+    return ((uint64_t)h1 << 32) | h2;
+}
+
+// RLE dos pixels em out. Retorna o tamanho ou 0 se não ficar menor que RAW.
+static size_t rle_tile(const uint16_t *px, int n, uint8_t *out) {
+    size_t limit = (size_t)n * 2;
+    size_t len = 0;
+    int i = 0;
+
+    while (i < n) {
+        int run = 1;
+        while (i + run < n && run < 128 && px[i + run] == px[i]) run++;
+
+        if (run >= 2) {
+            if (len + 3 >= limit) return 0;
+            out[len++] = 0x80 | (run - 1);
+            memcpy(&out[len], &px[i], 2);
+            len += 2;
+            i += run;
+            continue;
+        }
+
+        // Literais até o próximo par de pixels iguais
+        int lit = 1;
+        while (i + lit < n && lit < 128 && px[i + lit] != px[i + lit - 1]) lit++;
+        if (i + lit < n && lit > 1 && px[i + lit] == px[i + lit - 1]) lit--;
+        if (len + 1 + lit * 2 >= limit) return 0;
+        out[len++] = lit - 1;
+        memcpy(&out[len], &px[i], lit * 2);
+        len += lit * 2;
+        i += lit;
+    }
+    return len;
+}
+
+// Monta o registro completo (cabeçalho + dados) de um tile em rec
+static size_t encode_tile(int tx, int ty, const uint16_t *px, int n, uint8_t *rec) {
+    uint8_t *data = rec + FRAME_CODEC_TILE_HDR_SIZE;
+    uint8_t encoding;
+    size_t len;
+
+    int i = 1;
+    while (i < n && px[i] == px[0]) i++;
+    if (i == n) {
+        encoding = FRAME_TILE_FILL;
+        memcpy(data, px, 2);
+        len = 2;
+    } else if ((len = rle_tile(px, n, data)) > 0) {
+        encoding = FRAME_TILE_RLE;
+    } else {
+        encoding = FRAME_TILE_RAW;
+        len = (size_t)n * 2;
+        memcpy(data, px, len);
+    }
+
+    rec[0] = tx;
+    rec[1] = ty;
+    rec[2] = encoding;
+    put_u16(&rec[3], len);
+    return FRAME_CODEC_TILE_HDR_SIZE + len;
+}
+
+int frame_codec_encode(frame_codec_t *codec, const uint16_t *fb,
+                       frame_codec_write_fn write, void *ctx) {
+    if (!codec || !fb || !write) return -1;
+
+    bool key = codec->keyframe_pending ||
+               (codec->keyframe_interval && codec->since_keyframe >= codec->keyframe_interval);
+
+    // 1ª passada: quais tiles mudaram desde o último frame enviado
+    uint8_t changed[FRAME_CODEC_MAX_TILES];
+    uint16_t px[TILE_PIXELS];
+    int count = 0;
+    int t = 0;
+    for (int ty = 0; ty < codec->tiles_y; ty++) {
+        for (int tx = 0; tx < codec->tiles_x; tx++, t++) {
+            int x = tx * FRAME_CODEC_TILE, y = ty * FRAME_CODEC_TILE;
+            int w = codec->width - x < FRAME_CODEC_TILE ? codec->width - x : FRAME_CODEC_TILE;
+            int h = codec->height - y < FRAME_CODEC_TILE ? codec->height - y : FRAME_CODEC_TILE;
+            uint64_t hash = read_tile(codec, fb, x, y, w, h, px);
+            changed[t] = key || hash != codec->tile_hash[t];
+            codec->tile_hash[t] = hash;
+            count += changed[t];
+        }
+    }
+    if (count == 0) return 0;
+
+    packet_t pkt = { .write = write, .ctx = ctx };
+    uint8_t hdr[FRAME_CODEC_HEADER_SIZE] = { 0 };
+    put_u32(&hdr[0], FRAME_CODEC_MAGIC);
+    hdr[4] = FRAME_CODEC_VERSION;
+    hdr[5] = key ? FRAME_CODEC_FLAG_KEYFRAME : 0;
+    hdr[6] = FRAME_CODEC_TILE;
+    put_u16(&hdr[8], codec->width);
+    put_u16(&hdr[10], codec->height);
+    put_u32(&hdr[12], codec->seq++);
+    put_u16(&hdr[16], count);
+    bool ok = emit(&pkt, hdr, sizeof(hdr));
+
+    // 2ª passada: codifica e envia. `fb` não pode mudar entre as passadas (o
+    // frame_stream lê o frame apresentado, retido até o fim): um tile alterado
+    // aqui sairia com o hash de outro conteúdo e ficaria errado no receptor
+    // até o próximo keyframe.
+    uint8_t rec[FRAME_CODEC_TILE_HDR_SIZE + TILE_RAW_BYTES];
+    t = 0;
+    for (int ty = 0; ty < codec->tiles_y && ok; ty++) {
+        for (int tx = 0; tx < codec->tiles_x && ok; tx++, t++) {
+            if (!changed[t]) continue;
+            int x = tx * FRAME_CODEC_TILE, y = ty * FRAME_CODEC_TILE;
+            int w = codec->width - x < FRAME_CODEC_TILE ? codec->width - x : FRAME_CODEC_TILE;
+            int h = codec->height - y < FRAME_CODEC_TILE ? codec->height - y : FRAME_CODEC_TILE;
+            read_tile(codec, fb, x, y, w, h, px);
+            ok = emit(&pkt, rec, encode_tile(tx, ty, px, w * h, rec));
+        }
+    }
+
+    if (ok) {
+        uint8_t trailer[4];
+        put_u32(trailer, pkt.crc);
+        ok = pkt.write(pkt.ctx, trailer, sizeof(trailer));
+        pkt.bytes += sizeof(trailer);
+    }
+
+    if (!ok) {
+        // O receptor ficou com um frame pela metade: só um keyframe o recupera
+        codec->keyframe_pending = true;
+        codec->stats.failed++;
+        return -1;
+    }
+
+    codec->keyframe_pending = false;
+    codec->since_keyframe = key ? 0 : codec->since_keyframe + 1;
+    codec->stats.frames++;
+    codec->stats.keyframes += key;
+    codec->stats.tiles += count;
+    codec->stats.bytes += pkt.bytes;
+    codec->stats.raw_bytes += (uint32_t)codec->width * codec->height * 2;
+    return count;
+}
@@ -0,0 +1,201 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "frame_stream.h"
+#include <string.h>
+#include "esp_timer.h"
+#include "esp_log.h"
+#include "st7789.h"
+
+#define TAG "FRAME_STREAM"
+
+static frame_stream_t *streams = NULL;
+static portMUX_TYPE streams_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static bool flush_tx(frame_stream_t *s) {
+    bool ok = s->tx_len == 0 || s->write(s->ctx, s->tx, s->tx_len);
+    s->tx_len = 0;
+    return ok;
+}
+
+// Escrita do codificador: junta os registros pequenos antes de ir ao transporte
+static bool buffered_write(void *ctx, const void *data, size_t len) {
+    frame_stream_t *s = ctx;
+    const uint8_t *p = data;
+
+    while (len > 0) {
+        size_t room = sizeof(s->tx) - s->tx_len;
+        size_t n = len < room ? len : room;
+        memcpy(&s->tx[s->tx_len], p, n);
+        s->tx_len += n;
+        p += n;
+        len -= n;
+        if (s->tx_len == sizeof(s->tx) && !flush_tx(s)) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Codifica o último frame apresentado ao painel, e não o back buffer em que o
+// app está desenhando: o buffer fica retido até o fim da codificação.
+static esp_err_t send_frame(frame_stream_t *s) {
+    uint32_t seq;
+    const uint16_t *fb = st7789_frame_hold(&seq);
+    if (!fb) return ESP_ERR_INVALID_STATE;
+
+    xSemaphoreTake(s->lock, portMAX_DELAY);
+    s->tx_len = 0;
+    int tiles = frame_codec_encode(&s->codec, fb, buffered_write, s);
+    if (tiles > 0 && !flush_tx(s)) {
+        frame_codec_request_keyframe(&s->codec);
+        s->codec.stats.failed++;
+        tiles = -1;
+    }
+    if (!st7789_frame_release(seq)) {
+        // O flush tomou o buffer de volta no meio da leitura: os hashes e o
+        // que saiu podem misturar dois frames, só um keyframe garante a tela
+        frame_codec_request_keyframe(&s->codec);
+        s->stats.revoked++;
+    }
+    s->last_send_us = esp_timer_get_time();
+
+    if (tiles > 0) {
+        s->stats.sent++;
+    } else if (tiles == 0) {
+        s->stats.unchanged++;
+    }
+    xSemaphoreGive(s->lock);
+
+    if (tiles < 0) {
+        ESP_LOGW(TAG, "%s: falha no transporte, próximo frame será completo", s->name);
+        return ESP_FAIL;
+    }
+    return ESP_OK;
+}
+
+static void stream_task(void *arg) {
+    frame_stream_t *s = arg;
+
+    while (1) {
+        xSemaphoreTake(s->ready, portMAX_DELAY);
+
+        // Limite de FPS: espera o restante do intervalo. Avisos que chegarem
+        // nesse meio tempo são atendidos por este mesmo envio.
+        int64_t wait_us = s->last_send_us + (int64_t)s->min_interval_ms * 1000 - esp_timer_get_time();
+        if (wait_us > 0) {
+            vTaskDelay(pdMS_TO_TICKS(wait_us / 1000) + 1);
+        }
+        if (xSemaphoreTake(s->ready, 0) == pdTRUE) {
+            s->stats.dropped++;
+        }
+
+        if (s->enabled) {
+            send_frame(s);
+        }
+    }
+}
+
+esp_err_t frame_stream_init(frame_stream_t *stream, const char *name,
+                            frame_codec_write_fn write, void *ctx, int max_fps) {
+    if (!stream || !write) return ESP_ERR_INVALID_ARG;
+    if (stream->lock) return ESP_OK;
+
+    memset(stream, 0, sizeof(*stream));
+    stream->name = name;
+    stream->write = write;
+    stream->ctx = ctx;
+    stream->min_interval_ms = 1000 / (max_fps > 0 ? max_fps : FRAME_STREAM_DEFAULT_FPS);
+    frame_codec_init(&stream->codec, ST7789_WIDTH, ST7789_HEIGHT, FRAME_STREAM_KEYFRAME_INTERVAL);
+
+    stream->lock = xSemaphoreCreateMutex();
+    stream->ready = xSemaphoreCreateBinary();
+    if (!stream->lock || !stream->ready) {
+        ESP_LOGE(TAG, "%s: sem memória", name);
+        return ESP_ERR_NO_MEM;
+    }
+
+    portENTER_CRITICAL(&streams_mux);
+    stream->next = streams;
+    streams = stream;
+    portEXIT_CRITICAL(&streams_mux);
+    return ESP_OK;
+}
+
+esp_err_t frame_stream_start(frame_stream_t *stream, uint32_t stack, UBaseType_t prio) {
+    if (!stream || !stream->lock) return ESP_ERR_INVALID_STATE;
+    if (stream->task) return ESP_OK;
+
+    if (xTaskCreate(stream_task, stream->name, stack, stream, prio, &stream->task) != pdPASS) {
+        ESP_LOGE(TAG, "%s: falha ao criar task", stream->name);
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+void frame_stream_set_enabled(frame_stream_t *stream, bool enabled) {
+    if (!stream || !stream->lock) return;
+    if (enabled && !stream->enabled) {
+        frame_stream_reset(stream);
+    }
+    stream->enabled = enabled;
+    if (enabled) {
+        frame_stream_notify(stream);   // O receptor novo recebe a tela atual
+    }
+}
+
+void frame_stream_notify(frame_stream_t *stream) {
+    if (!stream || !stream->ready || !stream->enabled) return;
+    stream->stats.notified++;
+    if (xSemaphoreGive(stream->ready) != pdTRUE) {
+        stream->stats.dropped++;       // Já havia um aviso pendente
+    }
+}
+
+void frame_stream_notify_all(void) {
+    for (frame_stream_t *s = streams; s; s = s->next) {
+        frame_stream_notify(s);
+    }
+}
+
+esp_err_t frame_stream_send(frame_stream_t *stream) {
+    if (!stream || !stream->lock) return ESP_ERR_INVALID_STATE;
+    if (!stream->enabled) return ESP_ERR_INVALID_STATE;
+
+    if (esp_timer_get_time() - stream->last_send_us < (int64_t)stream->min_interval_ms * 1000) {
+        stream->stats.dropped++;
+        return ESP_ERR_INVALID_STATE;
+    }
+    return send_frame(stream);
+}
+
+void frame_stream_reset(frame_stream_t *stream) {
+    if (!stream || !stream->lock) return;
+    xSemaphoreTake(stream->lock, portMAX_DELAY);
+    frame_codec_request_keyframe(&stream->codec);
+    xSemaphoreGive(stream->lock);
+}
+
+void frame_stream_get_stats(frame_stream_t *stream, frame_stream_stats_t *stats) {
+    if (!stream || !stats) return;
+    if (!stream->lock) {
+        memset(stats, 0, sizeof(*stats));
+        return;
+    }
+    xSemaphoreTake(stream->lock, portMAX_DELAY);
+    *stats = stream->stats;
+    stats->codec = stream->codec.stats;
+    xSemaphoreGive(stream->lock);
+}
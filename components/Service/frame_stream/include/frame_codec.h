@@ -0,0 +1,111 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef FRAME_CODEC_H
+#define FRAME_CODEC_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+// Codificação de frames para o display remoto. Código C puro, sem FreeRTOS:
+// o mesmo codificador roda no host contra o decodificador de referência
+// (tools/frame_stream_decoder.py).
+//
+// Em vez de uma cópia do último frame enviado (115 KB que não cabem ao lado
+// dos dois framebuffers), o codificador guarda um hash de 64 bits por tile e
+// envia só os tiles cujo hash mudou, cada um comprimido por RLE de pixels.
+// Keyframes periódicos (todos os tiles) limitam o tempo de recuperação de um
+// receptor que perdeu ou descartou um frame.
+//
+// Formato (little endian), um frame por pacote:
+//
+//   cabeçalho, 20 bytes
+//     u32 magic    FRAME_CODEC_MAGIC ("HBFS")
+//     u8  version  FRAME_CODEC_VERSION
+//     u8  flags    FRAME_CODEC_FLAG_*
+//     u8  tile     lado do tile em pixels
+//     u8  reservado (0)
+//     u16 width, u16 height
+//     u32 seq      número do frame, +1 a cada pacote
+//     u16 tiles    registros de tile que seguem
+//     u16 reservado (0)
+//   registros de tile
+//     u8 tx, u8 ty, u8 encoding, u16 len, len bytes
+//   u32 crc32 (IEEE) de tudo o que veio antes no pacote
+//
+// Os pixels vão na ordem de bytes do framebuffer (RGB565 big endian), linha
+// a linha dentro do tile. Tiles da borda podem ser menores que `tile`.
+//
+// Codificações de tile:
+//   RAW  pixels em sequência
+//   FILL um único pixel que preenche o tile
+//   RLE  blocos com um byte de controle: bit 7 = 1 repete o pixel seguinte
+//        (c & 0x7F) + 1 vezes; bit 7 = 0 seguem c + 1 pixels literais
+
+#define FRAME_CODEC_MAGIC          0x53464248u
+#define FRAME_CODEC_VERSION        1
+#define FRAME_CODEC_TILE           16
+#define FRAME_CODEC_MAX_TILES      256
+#define FRAME_CODEC_HEADER_SIZE    20
+#define FRAME_CODEC_TILE_HDR_SIZE  5
+
+#define FRAME_CODEC_FLAG_KEYFRAME  0x01
+
+typedef enum {
+    FRAME_TILE_RAW = 0,
+    FRAME_TILE_FILL = 1,
+    FRAME_TILE_RLE = 2,
+} frame_tile_encoding_t;
+
+// Escreve len bytes no transporte. Retorna false se o transporte falhou; o
+// frame é abandonado e o próximo sai como keyframe.
+typedef bool (*frame_codec_write_fn)(void *ctx, const void *data, size_t len);
+
+typedef struct {
+    uint32_t frames;           // Pacotes completos
+    uint32_t keyframes;
+    uint32_t tiles;            // Tiles enviados
+    uint32_t bytes;            // Bytes escritos, cabeçalhos incluídos
+    uint32_t raw_bytes;        // Bytes que os mesmos frames ocupariam sem codificação
+    uint32_t failed;           // Frames abandonados por erro do transporte
+} frame_codec_stats_t;
+
+typedef struct {
+    uint16_t width, height;
+    uint8_t tiles_x, tiles_y;
+    uint16_t keyframe_interval;    // Frames entre keyframes (0 = só quando pedido)
+    uint16_t since_keyframe;
+    bool keyframe_pending;
+    uint32_t seq;
+    uint64_t tile_hash[FRAME_CODEC_MAX_TILES];
+    frame_codec_stats_t stats;
+} frame_codec_t;
+
+void frame_codec_init(frame_codec_t *codec, int width, int height, int keyframe_interval);
+
+// O próximo frame sai completo (novo receptor, reconexão)
+void frame_codec_request_keyframe(frame_codec_t *codec);
+
+// Compara o framebuffer com o último frame enviado e escreve um pacote com os
+// tiles alterados. Retorna o número de tiles enviados, 0 se nada mudou (nada é
+// escrito) ou -1 se `write` falhou. `fb` não pode mudar durante a chamada.
+int frame_codec_encode(frame_codec_t *codec, const uint16_t *fb,
+                       frame_codec_write_fn write, void *ctx);
+
+// CRC-32 IEEE incremental (comece com crc = 0)
+uint32_t frame_codec_crc32(uint32_t crc, const void *data, size_t len);
+
+#endif // FRAME_CODEC_H
@@ -0,0 +1,96 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef FRAME_STREAM_H
+#define FRAME_STREAM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "frame_codec.h"
+
+// Envio do framebuffer para um display remoto (Wi-Fi, USB) usando frame_codec.
+// Cada transporte tem o seu stream, com o próprio estado de codificação, e uma
+// task que envia no máximo `max_fps` frames por segundo. Avisos de frame novo
+// que chegam enquanto um envio está em andamento (ou antes do intervalo
+// mínimo) se acumulam em um só: quando o transporte libera, sai o frame mais
+// recente e os intermediários são descartados.
+//
+// O que sai é sempre o último frame apresentado ao painel
+// (st7789_frame_hold), nunca o back buffer em que o app está desenhando.
+
+#define FRAME_STREAM_DEFAULT_FPS          20
+#define FRAME_STREAM_KEYFRAME_INTERVAL    100   // Frames entre keyframes
+#define FRAME_STREAM_TX_BUFFER            1024  // Agrupa os registros em escritas maiores
+
+typedef struct {
+    uint32_t notified;         // Avisos de frame novo
+    uint32_t sent;             // Frames com alterações enviados
+    uint32_t unchanged;        // Avisos sem nenhuma alteração no framebuffer
+    uint32_t dropped;          // Avisos absorvidos por um envio posterior
+    uint32_t revoked;          // Frames tomados de volta pelo flush durante a leitura
+    frame_codec_stats_t codec;
+} frame_stream_stats_t;
+
+typedef struct frame_stream {
+    const char *name;
+    frame_codec_write_fn write;    // Escrita no transporte (pode bloquear)
+    void *ctx;
+    frame_codec_t codec;
+    uint32_t min_interval_ms;
+    int64_t last_send_us;
+    SemaphoreHandle_t lock;        // Codificador e buffer de saída
+    SemaphoreHandle_t ready;       // Binário: vários avisos viram um
+    TaskHandle_t task;
+    volatile bool enabled;         // Há receptor: fora disso os avisos são ignorados
+    frame_stream_stats_t stats;
+    size_t tx_len;
+    uint8_t tx[FRAME_STREAM_TX_BUFFER];
+    struct frame_stream *next;
+} frame_stream_t;
+
+// Prepara o stream e o registra para frame_stream_notify_all(). `max_fps` = 0
+// usa FRAME_STREAM_DEFAULT_FPS. O stream começa desabilitado.
+esp_err_t frame_stream_init(frame_stream_t *stream, const char *name,
+                            frame_codec_write_fn write, void *ctx, int max_fps);
+
+// Cria a task de envio (uma vez). Sem ela o envio é só por frame_stream_send().
+esp_err_t frame_stream_start(frame_stream_t *stream, uint32_t stack, UBaseType_t prio);
+
+// Liga/desliga o envio conforme o transporte tem ou não um receptor. Ao ligar,
+// o primeiro frame sai completo e é enviado sem esperar por um aviso.
+void frame_stream_set_enabled(frame_stream_t *stream, bool enabled);
+
+// Avisa que o framebuffer mudou. Não bloqueia.
+void frame_stream_notify(frame_stream_t *stream);
+
+// Avisa todos os streams registrados (chamado pelo flush do display, depois da
+// troca de buffers)
+void frame_stream_notify_all(void);
+
+// Envia agora, na task chamadora, respeitando o limite de FPS: dentro do
+// intervalo mínimo o frame é descartado e ESP_ERR_INVALID_STATE é retornado,
+// assim como antes do primeiro flush ou sem double buffer.
+esp_err_t frame_stream_send(frame_stream_t *stream);
+
+// Novo receptor (conexão nova): o próximo frame sai completo
+void frame_stream_reset(frame_stream_t *stream);
+
+void frame_stream_get_stats(frame_stream_t *stream, frame_stream_stats_t *stats);
+
+#endif // FRAME_STREAM_H
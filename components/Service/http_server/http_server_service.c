@@ -18,6 +18,7 @@
 #include "esp_http_server.h"
 #include "esp_log.h"
 #include "storage_file.h"
+#include "vfs_assets.h"
 #include <stdbool.h>
 
 static const char *TAG = "HTTP_SERVICE";
@@ -192,6 +193,13 @@ esp_err_t http_service_send_response(httpd_req_t *req, const char *buffer,
 }
 
 esp_err_t http_service_send_file_from_sd(httpd_req_t *req, const char *filepath) {
+    // Páginas gravadas na partição de assets saem direto da flash mapeada,
+    // sem buffer no heap; as demais são lidas do armazenamento
+    vfs_asset_t asset;
+    if (vfs_asset_find(filepath, &asset) == ESP_OK) {
+        return http_service_send_response(req, (const char *)asset.data, asset.size);
+    }
+
     const char *html_content = get_html_buffer(filepath);
     
     if (html_content == NULL) {
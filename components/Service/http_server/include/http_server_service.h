@@ -44,6 +44,8 @@ esp_err_t http_service_query_key_value(const char *data_buffer, const char *key,
 
 // data send
 esp_err_t http_service_send_response(httpd_req_t *req, const char *buffer, ssize_t length);
+// Envia o arquivo da partição de assets (sem cópia) se estiver lá; senão
+// carrega do armazenamento
 esp_err_t http_service_send_file_from_sd(httpd_req_t *req, const char *filepath);
 
 // misc 
@@ -0,0 +1,1552 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Imagens de origem sem compactação. Este arquivo não é compilado: é a
+// entrada de icons.manifest para tools/asset_packer.py, que gera ../icons.c.
+
+#include <stdint.h>
+
+
+
+
+const uint8_t octo_ant[]= {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x0f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x07,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x80,0x07,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xc0,0x03,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xe0,0x01,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xf0,0x01,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xf0,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf8,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0x00,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x7e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x3e,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xe0,0x00,0x00,0x00,0x00,0x1f,0x00,0x3f,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xff,0x80,0x00,0x00,0x00,0x1f,0x80,0x1f,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7b,0xff,0xff,0xff,0xf0,0x00,0x00,0x00,0x1f,0xc0,0x1f,0x80,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0xff,0xff,0xfe,0x00,0x00,0x00,0x0f,0xe0,0x0f,0x80,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xff,0xff,0xff,0x80,0x00,0x00,0x07,0xe0,0x0f,0x80,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xfc,0x00,0x03,0xff,0xe0,0x00,0x00,0x03,0xf0,0x0f,0xc0,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x80,0x00,0x00,0x3f,0xf0,0x00,0x00,0x01,0xf0,0x07,0xc0,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x8f,0x80,0x00,0x00,0x0f,0xff,0xc0,0x00,0x01,0xf8,0x07,0xc0,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x0f,0xc0,0x00,0x00,0x01,0xff,0xf8,0x00,0x00,0xf8,0x07,0xc0,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x07,0xc0,0x00,0x00,0x00,0x7f,0xfc,0x00,0x00,0xfc,0x03,0xe0,0x0f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x03,0xe0,0x00,0x00,0x00,0x3f,0xfe,0x00,0x00,0x7c,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0x83,0xe0,0x00,0x00,0x00,0x0f,0xff,0x00,0x00,0x7e,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xc1,0xf0,0x00,0x00,0x00,0x0f,0xbf,0x00,0x00,0x3e,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xc7,0xc1,0xf0,0x00,0x00,0x00,0x0f,0x8f,0x80,0x00,0x3e,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x87,0xe0,0xf0,0x00,0x00,0x00,0x0f,0x8f,0x80,0x00,0x3e,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x03,0xe0,0xf8,0x00,0x00,0x00,0x0f,0x8f,0x80,0x00,0x3e,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x01,0xf0,0xf8,0x00,0x00,0x00,0x0f,0x8f,0x80,0x00,0x3e,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0x01,0xf0,0x78,0x00,0x00,0x00,0x0f,0x0f,0x80,0x00,0x1f,0x01,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0xf8,0xf8,0x00,0x0f,0x80,0x1f,0x1f,0xc0,0x00,0x1f,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf8,0x00,0xff,0xf8,0x00,0x3f,0xf0,0x1f,0x1f,0xc0,0x00,0x1e,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xf0,0x00,0x7f,0xf8,0x00,0x7f,0xf8,0x1f,0xbf,0xe0,0x00,0x0c,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xe0,0x00,0x7f,0xf0,0x00,0xff,0xfc,0x1f,0xff,0xf0,0x00,0x00,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xe0,0x00,0x3f,0xc0,0x01,0xff,0xfc,0x0f,0xfd,0xf0,0x00,0x00,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x1e,0x00,0x01,0xf0,0x3e,0x07,0xfc,0xf8,0x00,0x00,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x01,0xe3,0xbe,0x01,0xf8,0xf8,0x00,0x00,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x01,0xe7,0xfe,0x00,0x20,0x7c,0x00,0x00,0x01,0xc0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x01,0xef,0xde,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x01,0xef,0xde,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x01,0xef,0xdf,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x01,0xef,0xdf,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x01,0xef,0xdf,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x01,0xef,0xdf,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x01,0xef,0xff,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x01,0xef,0xef,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x30,0x00,0x00,0x00,0x01,0xff,0xef,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x7e,0x00,0x00,0x00,0x01,0xf7,0xef,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xff,0x80,0x00,0x00,0x01,0xf7,0xef,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0xff,0x80,0x00,0x00,0x01,0xf7,0xdf,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0xff,0xc0,0x00,0x00,0x01,0xf3,0x9f,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf1,0xf3,0xe0,0x00,0x00,0x00,0xf0,0x1f,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf1,0xe3,0xe0,0x00,0x00,0x00,0xf8,0x3e,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf1,0xe1,0xe0,0x00,0x00,0x00,0xf8,0x3e,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x01,0xf3,0xe1,0xf0,0x00,0x00,0x00,0x7c,0x3c,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x01,0xf3,0xe1,0xf0,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x03,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xf3,0xe0,0xf0,0x00,0x00,0x00,0x3e,0xfc,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x7f,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xf7,0xc0,0xf0,0x00,0x00,0x00,0x3f,0xf8,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x3f,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xf7,0xc0,0xf8,0x00,0x00,0x00,0x1f,0xf8,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x0f,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x80,0xf8,0x00,0x00,0x00,0x1f,0xf0,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0xff,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x80,0xf8,0x00,0x00,0x00,0x0f,0xe0,0x00,0x00,0x03,0xe0,0x00,0x00,0x03,0xff,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x00,0xf8,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x03,0xe0,0x00,0x00,0x0f,0xff,0xfc,0x7f,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xfe,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xc0,0x00,0x00,0x3f,0xfe,0x1f,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0xfb,0xe0,0x00,0x00,0x00,0x00,0x00,0x03,0xe3,0xc0,0x00,0x00,0x7f,0xe1,0xff,0xfe,0xf8,0x00,0x00,0x00,0x00,0x00,0x03,0xf8,0x00,0xfb,0xf0,0x00,0x00,0x00,0x00,0x00,0x07,0xf3,0xc0,0x00,0x01,0xff,0x07,0xff,0xfd,0xf0,0x00,0x00,0x00,0x00,0x00,0x07,0xf0,0x00,0xfb,0xf8,0x00,0x00,0x00,0x00,0x00,0x0f,0xf3,0xc0,0x00,0x03,0xfc,0x1f,0xff,0xe7,0xf0,0x00,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0xf3,0xfe,0x00,0x00,0x00,0x00,0x00,0x3f,0xe7,0xc0,0x00,0x07,0xf0,0x7f,0xfc,0x1f,0xe0,0x00,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0xf1,0xff,0x80,0x03,0x80,0x60,0x00,0xff,0xc7,0xc0,0x00,0x0f,0xe0,0xff,0xf8,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0xf0,0xff,0xf8,0x3f,0x80,0x7e,0x07,0xff,0x87,0xc0,0x00,0x0f,0xc3,0xfe,0xfb,0xff,0x80,0x00,0x00,0x00,0x00,0x01,0xfe,0x00,0x01,0xf0,0x7f,0xff,0xff,0x00,0x7f,0xff,0xff,0x07,0x80,0x00,0x1f,0x87,0xf8,0xe7,0xfe,0x00,0x00,0x00,0x00,0x00,0x03,0xfc,0x00,0x01,0xf0,0x1f,0xff,0xfc,0x00,0x0f,0xff,0xfe,0x07,0x80,0x00,0x3f,0x0f,0xe0,0x1f,0xf8,0x00,0x00,0x00,0x00,0x00,0x07,0xf0,0x00,0x01,0xe0,0x07,0xff,0xe0,0x00,0x01,0xff,0xf0,0x0f,0x80,0x00,0x3e,0x1f,0xc0,0x3f,0xe0,0x00,0x00,0x00,0x00,0x00,0x1f,0xe0,0x00,0x03,0xe0,0x00,0x38,0x00,0x00,0x00,0x0f,0x00,0x0f,0x80,0x00,0x7c,0x3f,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x7c,0x3f,0xe0,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0xf8,0x7f,0xe7,0xf8,0x00,0x00,0x00,0x00,0x00,0x01,0xfe,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0xf8,0xff,0xef,0xf0,0x00,0x00,0x00,0x00,0x00,0x07,0xf8,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x01,0xf0,0xfb,0xcf,0xf0,0x00,0x00,0x00,0x00,0x00,0x0f,0xf0,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x01,0xf1,0xf3,0xc7,0xe0,0x00,0x00,0x00,0x00,0x00,0x1f,0xc0,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x01,0xe1,0xf3,0xc7,0xc0,0x00,0x00,0x00,0x00,0x00,0x7f,0x80,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x03,0xe1,0xe1,0x87,0xc0,0x00,0x00,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x03,0xe3,0xe0,0x0f,0x80,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x03,0xe3,0xe0,0x0f,0x80,0x00,0x00,0x00,0x00,0x07,0xf8,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0x03,0xc3,0xc0,0x0f,0x00,0x00,0x00,0x00,0x00,0x0f,0xef,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0x07,0xc7,0xcc,0x1f,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x80,0x00,0x00,0xf8,0x00,0x00,0x00,0x01,0xff,0x80,0x00,0x00,0xf0,0x00,0x07,0xc7,0xde,0x7f,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xe0,0x00,0x00,0xf8,0x00,0x00,0x00,0x0f,0xff,0xe0,0x00,0x01,0xf0,0x00,0x07,0xc7,0xfe,0xff,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf0,0x00,0x01,0xf0,0x00,0x00,0x00,0x3f,0xff,0xf0,0x00,0x01,0xf0,0x00,0x07,0xc7,0xbe,0xfe,0x00,0x00,0x00,0x00,0x00,0xfe,0xff,0xf8,0x00,0x03,0xe0,0x00,0x00,0x00,0x7f,0xff,0xf8,0x00,0x03,0xe0,0x00,0x07,0xc7,0xbe,0xfe,0x00,0x00,0x00,0x00,0x01,0xff,0xf8,0xfc,0x00,0x03,0xe0,0x00,0x00,0x00,0x7f,0x81,0xf8,0x00,0x03,0xe0,0x00,0x07,0xc7,0xbe,0x7e,0x00,0x00,0x00,0x00,0x03,0xff,0xf0,0x7e,0x00,0x07,0xc0,0x00,0x00,0x00,0x7c,0x00,0x78,0x00,0x07,0xc0,0x00,0x07,0x87,0xbe,0x1e,0x00,0x00,0x00,0x00,0x07,0xef,0xe0,0x3e,0x00,0x0f,0x80,0x00,0x00,0x00,0x30,0x00,0x38,0x00,0x07,0xc0,0x00,0x07,0x87,0x8c,0x1e,0x00,0x00,0x00,0x00,0x0f,0xcf,0xc0,0x7e,0x00,0x1f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x07,0x87,0x80,0x1e,0x00,0x00,0x00,0x00,0x1f,0x9f,0x80,0xfc,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x07,0x87,0x80,0x1f,0x00,0x00,0x00,0x00,0x3f,0x1f,0x01,0xfc,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x07,0x87,0x80,0x1f,0x00,0x00,0x00,0x00,0x7e,0x1f,0x03,0xff,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x07,0x87,0xc0,0x1f,0x00,0x00,0x00,0x00,0x7c,0x1f,0x83,0xff,0x80,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x07,0xc7,0xdc,0x0f,0x00,0x00,0x00,0x00,0xfc,0x0f,0xe7,0xdf,0xc1,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x07,0xc7,0xde,0x3f,0x80,0x00,0x00,0x01,0xf8,0x07,0xff,0xef,0xe3,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x07,0xc7,0xfe,0x3f,0xc0,0x00,0x00,0x01,0xf0,0x03,0xff,0xf3,0xf7,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x07,0xc7,0xfe,0x3f,0xc0,0x00,0x00,0x03,0xe0,0x01,0xff,0xf9,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x07,0xc3,0xfe,0x3f,0xe0,0x00,0x00,0x03,0xe0,0x00,0x7f,0xfc,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x07,0xc3,0xff,0x1b,0xe0,0x00,0x00,0x07,0xc0,0x00,0x18,0x7e,0x7f,0xbc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x07,0xc3,0xdf,0x01,0xf0,0x00,0x00,0x07,0xc0,0x00,0x00,0x3f,0x3f,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x03,0xc3,0xce,0x01,0xf0,0x00,0x00,0x0f,0x80,0x00,0x00,0x1f,0xbe,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x03,0xc3,0xc0,0x00,0xf8,0x00,0x00,0x0f,0x80,0x00,0x00,0x0f,0xfe,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x03,0xc3,0xc0,0x00,0xf8,0x00,0x00,0x0f,0x80,0x00,0x00,0x07,0xfc,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x07,0xc3,0xc0,0x00,0xf8,0x00,0x00,0x0f,0x00,0x00,0x00,0x03,0xfc,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x07,0xc3,0xc0,0x00,0x78,0x00,0x00,0x1f,0x00,0x00,0x00,0x01,0xf8,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x07,0xc3,0xc0,0x00,0x7c,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0xf8,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x07,0x83,0xdc,0x00,0x7c,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0xf8,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x0f,0x87,0xde,0x00,0x7c,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x0f,0x87,0xfe,0x07,0xfc,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x1f,0x07,0xfc,0x0f,0xfc,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0xf0,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x1f,0x07,0xbe,0x0f,0xfc,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0xf0,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x3e,0x07,0xbe,0x0f,0xfc,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0xf0,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x7e,0x0f,0xbe,0x07,0xfc,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0xf0,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0xfc,0x0f,0x9c,0x07,0xfc,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0xf0,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x01,0xf8,0x0f,0x80,0x00,0x7c,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0xf0,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x03,0xf0,0x1f,0x00,0x00,0x7c,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0xf0,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x07,0xe0,0x1f,0x00,0x00,0x7c,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf1,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x1f,0xe0,0x3e,0x00,0x00,0x78,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf1,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x3f,0x80,0x3e,0x00,0x00,0x78,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf9,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x80,0xff,0x00,0x7c,0x00,0x00,0xf8,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0xfb,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xfe,0x00,0x7c,0x00,0x00,0xf8,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x7b,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xfc,0x00,0xfb,0x80,0x00,0xf0,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x7f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xf0,0x01,0xff,0x80,0x01,0xf0,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x7f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xc0,0x03,0xff,0x80,0x01,0xf0,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x03,0xef,0x80,0x01,0xe0,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xef,0xc0,0x03,0xe0,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xc7,0xc0,0xe3,0xe0,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x83,0x81,0xe7,0xc0,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x0f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x00,0x01,0xf7,0xc0,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x07,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xfe,0x00,0x01,0xff,0x80,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x03,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf8,0x00,0x01,0xff,0x80,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x01,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf6,0x00,0x00,0xff,0x00,0x00,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xdf,0x00,0x00,0x3e,0x00,0x00,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x1f,0x00,0x00,0x7e,0x00,0x00,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xfc,0x3f,0x00,0x01,0xfc,0x00,0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0x00,0x1f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x3f,0x00,0x03,0xf8,0x00,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0x00,0x0f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x07,0xf0,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x03,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x1f,0xe0,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x01,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xc0,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x7f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x1f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfe,0x00,0x00,0x00,0x00,0x00,0x1f,0x80,0x00,0x00,0x00,0x00,0x07,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xf8,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
+
+const uint8_t octo_ant1[]= {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xff,0xff,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xff,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf0,0x00,0x01,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x00,0x00,0x00,0x3f,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x0f,0x80,0x00,0x00,0x07,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x07,0x80,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x07,0xc0,0x00,0x00,0x00,0x7f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x03,0xe0,0x00,0x00,0x00,0x1f,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0x83,0xe0,0x00,0x00,0x00,0x0f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xef,0x81,0xe0,0x00,0x00,0x00,0x0f,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xc7,0xc1,0xf0,0x00,0x00,0x00,0x0f,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x83,0xe0,0xf0,0x00,0x00,0x00,0x0f,0x8f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x03,0xe0,0xf0,0x00,0x00,0x00,0x0f,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x01,0xf0,0xf8,0x00,0x00,0x00,0x0f,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0xf0,0x78,0x00,0x00,0x00,0x0f,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0xf8,0xf8,0x00,0x07,0x00,0x1f,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf0,0x00,0x7f,0xf8,0x00,0x1f,0xe0,0x1f,0x1f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf0,0x00,0x7f,0xf0,0x00,0x7f,0xf8,0x1f,0x9f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xe0,0x00,0x7f,0xe0,0x00,0xff,0xfc,0x1f,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xc0,0x00,0x3f,0x80,0x00,0xff,0xfc,0x0f,0xfd,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x04,0x00,0x01,0xf0,0x3c,0x03,0xfc,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x01,0xe3,0xbe,0x01,0xf8,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x01,0xe7,0xde,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x01,0xe7,0xde,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x01,0xe7,0xde,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x01,0xe7,0xde,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x01,0xe7,0xdf,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x01,0xe7,0xdf,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x01,0xe7,0xcf,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x01,0xe7,0xcf,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x01,0xe7,0xcf,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x01,0xe7,0xcf,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x7e,0x00,0x00,0x00,0x01,0xe7,0xcf,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0xff,0x00,0x00,0x00,0x01,0xe7,0xcf,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xff,0x80,0x00,0x00,0x01,0xf7,0xcf,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf1,0xff,0xc0,0x00,0x00,0x00,0xf0,0x1f,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf1,0xe3,0xc0,0x00,0x00,0x00,0xf0,0x1e,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf1,0xe3,0xe0,0x00,0x00,0x00,0xf8,0x1e,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf1,0xe1,0xe0,0x00,0x00,0x00,0x78,0x3e,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0xf1,0xe1,0xe0,0x00,0x00,0x00,0x7c,0x3c,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0xf3,0xe0,0xf0,0x00,0x00,0x00,0x3c,0x7c,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x03,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xf3,0xc0,0xf0,0x00,0x00,0x00,0x3e,0x78,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x3f,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xe7,0xc0,0xf0,0x00,0x00,0x00,0x1e,0xf8,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x0f,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xe7,0xc0,0xf0,0x00,0x00,0x00,0x1f,0xf0,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x07,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0x80,0x70,0x00,0x00,0x00,0x0f,0xf0,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x7f,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x00,0x78,0x00,0x00,0x00,0x0f,0xe0,0x00,0x00,0x03,0xc0,0x00,0x00,0x01,0xff,0xff,0xef,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x00,0x78,0x00,0x00,0x00,0x07,0x80,0x00,0x00,0x03,0xc0,0x00,0x00,0x0f,0xff,0xf8,0x3f,0xf8,0x00,0x00,0x00,0x00,0x00,0x01,0xfe,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xc0,0x00,0x00,0x1f,0xfc,0x1f,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0x79,0xe0,0x00,0x00,0x00,0x00,0x00,0x01,0xe3,0xc0,0x00,0x00,0x7f,0xc0,0xff,0xfe,0xf8,0x00,0x00,0x00,0x00,0x00,0x01,0xf8,0x00,0x7b,0xf0,0x00,0x00,0x00,0x00,0x00,0x03,0xe3,0xc0,0x00,0x00,0xff,0x07,0xff,0xf9,0xf0,0x00,0x00,0x00,0x00,0x00,0x07,0xf0,0x00,0xf3,0xf8,0x00,0x00,0x00,0x00,0x00,0x0f,0xe3,0xc0,0x00,0x01,0xfc,0x1f,0xff,0xc3,0xe0,0x00,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0xf1,0xfe,0x00,0x00,0x00,0x00,0x00,0x1f,0xe3,0xc0,0x00,0x03,0xf0,0x7f,0xf0,0x0f,0xe0,0x00,0x00,0x00,0x00,0x00,0x1f,0x80,0x00,0xf1,0xff,0x80,0x01,0x00,0x00,0x00,0x7f,0xc7,0xc0,0x00,0x07,0xe0,0xff,0xf8,0x7f,0xc0,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0xf0,0xff,0xf0,0x0f,0x00,0x7c,0x03,0xff,0x87,0x80,0x00,0x0f,0x81,0xfc,0xf1,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0x00,0x00,0xf0,0x3f,0xff,0xfe,0x00,0x3f,0xff,0xff,0x07,0x80,0x00,0x1f,0x07,0xf0,0x67,0xfe,0x00,0x00,0x00,0x00,0x00,0x03,0xf8,0x00,0x01,0xe0,0x1f,0xff,0xf8,0x00,0x0f,0xff,0xfc,0x07,0x80,0x00,0x3e,0x0f,0xe0,0x0f,0xf8,0x00,0x00,0x00,0x00,0x00,0x07,0xf0,0x00,0x01,0xe0,0x03,0xff,0xc0,0x00,0x01,0xff,0xf0,0x0f,0x80,0x00,0x3e,0x0f,0x80,0x3f,0xc0,0x00,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0x01,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x7c,0x1f,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x80,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x78,0x3f,0xe0,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0xf8,0x7f,0xe2,0xf8,0x00,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0xf0,0x7b,0xe7,0xf0,0x00,0x00,0x00,0x00,0x00,0x03,0xf8,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0xf0,0xfb,0xc7,0xe0,0x00,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0xe0,0xf3,0xc7,0xe0,0x00,0x00,0x00,0x00,0x00,0x1f,0xc0,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x01,0xe1,0xf3,0xc7,0xc0,0x00,0x00,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x01,0xe1,0xe0,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0xfe,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x03,0xe3,0xe0,0x07,0x80,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x03,0xc3,0xc0,0x0f,0x80,0x00,0x00,0x00,0x00,0x03,0xf0,0x00,0x00,0x00,0x3c,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x78,0x00,0x03,0xc3,0xc0,0x0f,0x00,0x00,0x00,0x00,0x00,0x07,0xe6,0x00,0x00,0x00,0x7c,0x00,0x00,0x1f,0xc0,0x00,0x00,0x00,0x00,0xf8,0x00,0x03,0xc3,0xc0,0x0f,0x00,0x00,0x00,0x00,0x00,0x1f,0xef,0x80,0x00,0x00,0x78,0x00,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,0xf0,0x00,0x03,0xc7,0xde,0x7f,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xc0,0x00,0x00,0xf0,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x01,0xf0,0x00,0x07,0xc7,0xbe,0x7e,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xe0,0x00,0x01,0xf0,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x01,0xe0,0x00,0x07,0x87,0xbe,0xfe,0x00,0x00,0x00,0x00,0x00,0xfc,0xff,0xf8,0x00,0x01,0xe0,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x01,0xe0,0x00,0x07,0x87,0xbc,0x7e,0x00,0x00,0x00,0x00,0x01,0xff,0xf8,0xfc,0x00,0x03,0xe0,0x00,0x00,0x1f,0xc0,0x00,0x00,0x18,0x03,0xe0,0x00,0x07,0x87,0xbe,0x3e,0x00,0x00,0x00,0x00,0x03,0xff,0xf0,0x7e,0x00,0x07,0xc0,0x00,0x00,0x0f,0xf0,0x00,0x00,0x78,0x03,0xc0,0x00,0x07,0x87,0x9e,0x1e,0x00,0x00,0x00,0x00,0x07,0xef,0xe0,0x3e,0x00,0x0f,0x80,0x00,0x00,0x0e,0xfc,0x00,0x00,0xf8,0x07,0xc0,0x00,0x07,0x87,0x80,0x1e,0x00,0x00,0x00,0x00,0x0f,0xcf,0xc0,0x7c,0x00,0x0f,0x00,0x00,0x00,0x07,0x3f,0x80,0x07,0xe0,0x07,0x80,0x00,0x07,0x87,0x80,0x1e,0x00,0x00,0x00,0x00,0x1f,0x9f,0x80,0x78,0x00,0x1f,0x00,0x00,0x00,0x03,0x8f,0xff,0xff,0xc0,0x07,0x80,0x00,0x07,0x87,0x80,0x1e,0x00,0x00,0x00,0x00,0x1f,0x1f,0x00,0xfc,0x00,0x3e,0x00,0x00,0x00,0x01,0x83,0xff,0xff,0x00,0x0f,0x80,0x00,0x07,0x87,0x80,0x1e,0x00,0x00,0x00,0x00,0x3e,0x1f,0x01,0xfe,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x7f,0xfc,0x00,0x0f,0x00,0x00,0x07,0x87,0x80,0x0f,0x00,0x00,0x00,0x00,0x7c,0x0f,0x83,0xff,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x07,0x87,0x88,0x0f,0x00,0x00,0x00,0x00,0xf8,0x0f,0xc7,0xdf,0xc1,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x07,0x87,0xdc,0x1f,0x80,0x00,0x00,0x00,0xf8,0x07,0xff,0xc7,0xe3,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x07,0x83,0xde,0x3f,0x80,0x00,0x00,0x01,0xf0,0x03,0xff,0xf3,0xf3,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x07,0xc3,0xfc,0x3f,0xc0,0x00,0x00,0x01,0xe0,0x00,0xff,0xf9,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x07,0xc3,0xfe,0x3f,0xe0,0x00,0x00,0x03,0xe0,0x00,0x7c,0xfc,0xff,0xbc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x03,0xc3,0xdf,0x03,0xe0,0x00,0x00,0x03,0xc0,0x00,0x00,0x7e,0x7f,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x03,0xc3,0xdf,0x01,0xf0,0x00,0x00,0x07,0xc0,0x00,0x00,0x3f,0x3f,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x03,0xc3,0xce,0x00,0xf0,0x00,0x00,0x07,0x80,0x00,0x00,0x1f,0x9e,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x03,0xc3,0xc0,0x00,0xf0,0x00,0x00,0x0f,0x80,0x00,0x00,0x0f,0xfe,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x03,0xc3,0xc0,0x00,0xf8,0x00,0x00,0x0f,0x00,0x00,0x00,0x07,0xfc,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x03,0xc3,0xc0,0x00,0x78,0x00,0x00,0x0f,0x00,0x00,0x00,0x03,0xfc,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x07,0xc3,0xc0,0x00,0x78,0x00,0x00,0x0f,0x00,0x00,0x00,0x01,0xf8,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x07,0x83,0xc0,0x00,0x78,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0xf8,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x07,0x83,0xc8,0x00,0x78,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf8,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x0f,0x83,0xdc,0x00,0x7c,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x0f,0x03,0xfc,0x07,0x7c,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x1f,0x07,0xbc,0x07,0xbc,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x1f,0x07,0xbe,0x0f,0xbc,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x3e,0x07,0xbe,0x0f,0xfc,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x7c,0x07,0x9e,0x07,0xfc,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0xf0,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0xfc,0x0f,0x8c,0x03,0xfc,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x01,0xf8,0x0f,0x00,0x00,0x7c,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x03,0xf0,0x0f,0x00,0x00,0x78,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x07,0xe0,0x1f,0x00,0x00,0x78,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x0f,0xc0,0x1e,0x00,0x00,0x78,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf1,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x3f,0x80,0x3e,0x00,0x00,0x78,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf1,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x80,0xff,0x00,0x3c,0x00,0x00,0x78,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xfb,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xfe,0x00,0x7c,0x00,0x00,0xf0,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x7b,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf8,0x00,0xfb,0x80,0x00,0xf0,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x7f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xe0,0x00,0xff,0x80,0x00,0xf0,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x80,0x01,0xff,0x80,0x01,0xf0,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x03,0xef,0x80,0x01,0xe0,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xcf,0x80,0x03,0xe0,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x87,0x80,0xc3,0xc0,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x81,0x01,0xe7,0xc0,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x01,0xe7,0x80,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x07,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0x01,0xff,0x80,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x03,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xf8,0x00,0x01,0xff,0x00,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x01,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf6,0x00,0x00,0xff,0x00,0x00,0x00,0x01,0xe0,0x00,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xcf,0x00,0x00,0x3e,0x00,0x00,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x1f,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xf8,0x1f,0x00,0x00,0xf8,0x00,0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x07,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x07,0xf0,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x03,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xc0,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x80,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x3f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x1f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfc,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x07,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xf8,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
+
+const uint16_t evil[576]= {
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x48B1,0x1025,0x793C,0x1846,0x813D,0x1847,0x40AF,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0801,0x58F5,0x895F,0x2048,0x6919,0x895F,0x1846,0x895F,0x793C,0x1025,0x895F,0x6918,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0802,0x7119,0x895F,0x711A,0x286A,0x895F,0x895F,0x1846,0x895F,0x895F,0x40AE,0x60F5,0x895F,0x793C,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x58F4,0x895F,0x895F,0x40AF,0x60F6,0x895F,0x895F,0x1846,0x895F,0x895F,0x711A,0x306A,0x895F,0x895F,0x7119,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0001,0x1846,0x2048,0x306B,0x0823,0x388D,0x40AE,0x48B0,0x0823,0x48B1,0x40AE,0x40AE,0x0802,0x306B,0x2068,0x1846,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x60F7,0x895F,0x813D,0x711A,0x1024,0x60F7,0x60F6,0x58F5,0x1024,0x58F5,0x60F6,0x60F7,0x2048,0x60F6,0x813D,0x895F,0x793B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0801,0x895F,0x895F,0x895F,0x793C,0x2869,0x895F,0x895F,0x895F,0x1846,0x895F,0x895F,0x895F,0x388E,0x68F7,0x895F,0x895F,0x895F,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x1846,0x895F,0x895F,0x895F,0x6919,0x308C,0x895F,0x895F,0x895F,0x1846,0x895F,0x895F,0x895F,0x48B1,0x58D4,0x895F,0x895F,0x895F,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0801,0x1846,0x1846,0x1846,0x1024,0x0822,0x1846,0x1846,0x1846,0x0001,0x1846,0x1846,0x1846,0x1023,0x1023,0x1846,0x1846,0x1846,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x2047,0x895F,0x895F,0x895F,0x6919,0x388C,0x895F,0x895F,0x895F,0x1846,0x895F,0x895F,0x895F,0x50D2,0x50D3,0x895F,0x895F,0x895F,0x308C,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0802,0x895F,0x895F,0x895F,0x793C,0x2869,0x895F,0x895F,0x895F,0x1846,0x895F,0x40AF,0x306B,0x286A,0x60F6,0x895F,0x895F,0x895F,0x1847,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x6918,0x895F,0x895F,0x895F,0x1846,0x793B,0x793B,0x711A,0x1024,0x7119,0x2048,0x58D4,0x40AE,0x1825,0x40AF,0x713B,0x793D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x1024,0x1846,0x1846,0x1846,0x0801,0x2869,0x286A,0x306B,0x0802,0x308C,0x2869,0x388D,0x895F,0x895F,0x60F6,0x286A,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x68F7,0x895F,0x895F,0x388E,0x60F7,0x895F,0x895F,0x1846,0x895F,0x895F,0x1845,0x895E,0x895F,0x895F,0x895F,0x793C,0x50D2,0x1845,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x1023,0x793C,0x895F,0x6919,0x308C,0x895F,0x895F,0x1846,0x895F,0x895F,0x388D,0x58F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x388D,0x0802,0x0000,
+0x0000,0x0000,0x0000,0x1023,0x7119,0x895F,0x1846,0x793B,0x895F,0x1846,0x895F,0x815E,0x1025,0x2869,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0001,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x50D3,0x1846,0x815E,0x1846,0x895F,0x286A,0x50D3,0x1024,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x2047,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x0802,0x1845,0x0000,0x0000,0x0000,0x48B0,0x895F,0x895F,0x895F,0x895F,0x793B,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x895F,0x895F,0x895F,0x793B,0x895F,0x58D4,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6918,0x895F,0x6918,0x0000,0x58D4,0x895F,0x58D4,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x895F,0x2047,0x0000,0x0000,0x58D4,0x7119,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0801,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+};
+
+const uint16_t controle[576]= {
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x2047,0x2047,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x813D,0x895F,0x895F,0x895F,0x895F,0x813D,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x408E,0x1846,0x0823,0x0823,0x1846,0x408E,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x40AE,0x50D2,0x50D2,0x408E,0x1025,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x793C,0x60F7,0x60F7,0x793C,0x50D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x388E,0x60F6,0x793B,0x815E,0x815E,0x793B,0x60F6,0x388E,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x58F5,0x793C,0x793C,0x58F5,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x0000,0x58F5,0x58F5,0x0000,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x306B,0x6918,0x6918,0x306B,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x306B,0x6918,0x6918,0x306B,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x0000,0x58F5,0x58F5,0x0000,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x58F5,0x793C,0x793C,0x58F5,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x895F,0x60F7,0x60F7,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x388D,0x0000,0x0000,0x388D,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D3,0x895F,0x895F,0x0802,0x48B1,0x48B1,0x0802,0x895F,0x895F,0x50D3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x895F,0x895F,0x2869,0x0802,0x0802,0x2869,0x895F,0x895F,0x48B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x895F,0x895F,0x815E,0x48B0,0x48B0,0x815E,0x895F,0x895F,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x815E,0x895F,0x895F,0x815E,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x2047,0x2047,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+};
+
+
+
+
+const uint16_t learn[576]= {
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0823,0x306B,0x40AF,0x50D2,0x408E,0x2869,0x0001,0x0000,0x0000,0x0001,0x2869,0x408E,0x50D2,0x40AF,0x306B,0x0822,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x308C,0x308C,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0001,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x0001,0x0000,0x0000,
+0x0000,0x388D,0x388D,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x388D,0x388D,0x0000,
+0x0000,0x48B1,0x388D,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x388D,0x48B1,0x0000,
+0x0000,0x48B1,0x388D,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x388D,0x48B1,0x0000,
+0x0000,0x48B1,0x388D,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x388D,0x48B1,0x0000,
+0x0000,0x48B1,0x388D,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x388D,0x48B1,0x0000,
+0x0000,0x48B1,0x388D,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x388D,0x48B1,0x0000,
+0x0000,0x48B1,0x388D,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x388D,0x48B1,0x0000,
+0x0000,0x48B1,0x388D,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x388D,0x48B1,0x0000,
+0x0000,0x48B1,0x388D,0x793C,0x895F,0x793C,0x6918,0x60F5,0x6919,0x813D,0x895F,0x58D4,0x58D4,0x895F,0x813D,0x6919,0x60F5,0x6918,0x793C,0x895F,0x793C,0x388D,0x48B1,0x0000,
+0x0000,0x48B1,0x388D,0x40AF,0x2869,0x308C,0x50D2,0x50D2,0x408E,0x1846,0x2068,0x308C,0x308C,0x2048,0x1825,0x40AF,0x50D3,0x50D2,0x308C,0x2869,0x40AF,0x388D,0x48B1,0x0000,
+0x0000,0x48B1,0x58F5,0x58D4,0x793C,0x48B0,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x306B,0x58F5,0x895E,0x58D4,0x58F5,0x48B1,0x0000,
+0x0000,0x48B1,0x813D,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x40B0,0x815E,0x48B1,0x0000,
+0x0000,0x2047,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x2048,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+};
+
+
+
+
+
+
+const uint16_t deauth[576]= {
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x306A,0x813D,0x6918,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0801,0x6918,0x813D,0x286A,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x895F,0x895F,0x48B1,0x0000,0x0000,0x0000,
+0x0000,0x286A,0x60F7,0x40AF,0x711A,0x895F,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1845,0x895F,0x7119,0x40AE,0x60F7,0x286A,0x0000,
+0x0000,0x813D,0x895F,0x895F,0x895F,0x895F,0x306B,0x0000,0x0000,0x0000,0x0000,0x0801,0x0801,0x0000,0x0000,0x0000,0x0000,0x306B,0x895F,0x895F,0x895F,0x895F,0x813D,0x0000,
+0x0000,0x6918,0x895F,0x895F,0x895F,0x895F,0x815E,0x1023,0x1846,0x58F5,0x815E,0x895F,0x895F,0x815E,0x58F5,0x1846,0x1023,0x815E,0x895F,0x895F,0x895F,0x895F,0x6918,0x0000,
+0x0000,0x0801,0x2869,0x1845,0x306B,0x815E,0x50D3,0x308B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x306B,0x50D3,0x815E,0x306B,0x1845,0x2869,0x0001,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x1846,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1846,0x1847,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B1,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6919,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x711A,0x793B,0x2869,0x306B,0x711A,0x895F,0x895F,0x711A,0x306B,0x2869,0x793B,0x7119,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x308C,0x6918,0x711A,0x1845,0x815E,0x815E,0x1845,0x711A,0x6918,0x308C,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x306B,0x60F7,0x813D,0x2048,0x793B,0x793B,0x2048,0x813D,0x60F7,0x306B,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x793B,0x306B,0x2869,0x50D3,0x50D3,0x50D3,0x50D3,0x2869,0x306B,0x793B,0x308C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x60F6,0x286A,0x286A,0x60F7,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x1846,0x60F7,0x895F,0x895F,0x40B0,0x1024,0x1024,0x48B0,0x895F,0x895F,0x60F7,0x1845,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0801,0x2869,0x1845,0x306B,0x815E,0x793B,0x306B,0x0802,0x793C,0x895F,0x813D,0x813D,0x895F,0x793C,0x0802,0x306B,0x793B,0x815E,0x306B,0x1845,0x2869,0x0801,0x0000,
+0x0000,0x6918,0x895F,0x895F,0x895F,0x895F,0x815E,0x2047,0x0000,0x68F7,0x2048,0x50D3,0x50D3,0x2048,0x60F7,0x0000,0x1847,0x815E,0x895F,0x895F,0x895F,0x895F,0x6918,0x0000,
+0x0000,0x813D,0x895F,0x711A,0x895F,0x895F,0x306B,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x306B,0x895F,0x895F,0x711A,0x895F,0x813D,0x0000,
+0x0000,0x286A,0x48B1,0x40AF,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1845,0x895F,0x895F,0x40AF,0x48D1,0x286A,0x0000,
+0x0000,0x0000,0x0000,0x60F7,0x895F,0x895F,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x895F,0x895F,0x60F7,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x286A,0x815E,0x6918,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0801,0x6918,0x815E,0x286A,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+};
+
+
+
+
+const uint16_t scan[576]= {
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1845,0x388D,0x50D3,0x60F6,0x60F6,0x50D3,0x388D,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x1825,0x6919,0x895F,0x895F,0x895F,0x813D,0x48B0,0x2869,0x2869,0x48B0,0x813D,0x895F,0x895F,0x895F,0x6919,0x1825,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x306A,0x815E,0x895F,0x895F,0x895F,0x6918,0x0802,0x0000,0x0000,0x0000,0x0000,0x0802,0x6918,0x895F,0x895F,0x895F,0x815E,0x286A,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x308C,0x895F,0x895F,0x895F,0x895F,0x813D,0x0802,0x0000,0x0823,0x408E,0x388E,0x0822,0x0000,0x0802,0x813D,0x895F,0x895F,0x895F,0x895F,0x308C,0x0000,0x0000,
+0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B0,0x0000,0x0823,0x793D,0x895F,0x895F,0x793D,0x0822,0x0000,0x48B0,0x895F,0x895F,0x895F,0x895F,0x895F,0x2869,0x0000,
+0x0823,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x2869,0x0000,0x408E,0x895F,0x895F,0x895F,0x895F,0x388E,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x0823,
+0x0823,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x2869,0x0000,0x388E,0x895F,0x895F,0x895F,0x895F,0x408E,0x0000,0x2869,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x0823,
+0x0000,0x2869,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B0,0x0000,0x0802,0x793C,0x895F,0x895F,0x793C,0x0822,0x0000,0x48B0,0x895F,0x895F,0x895F,0x895F,0x895F,0x2869,0x0000,
+0x0000,0x0000,0x308C,0x895F,0x895F,0x895F,0x895F,0x813D,0x0802,0x0000,0x0802,0x388E,0x408E,0x0822,0x0000,0x1023,0x815E,0x895F,0x895F,0x895F,0x895F,0x308B,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x286A,0x815E,0x895F,0x895F,0x895F,0x6918,0x0802,0x0000,0x0000,0x0000,0x0000,0x1023,0x6919,0x895F,0x895F,0x895F,0x815E,0x286A,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x1025,0x6919,0x895F,0x895F,0x895F,0x813D,0x48B0,0x286A,0x2869,0x48B0,0x815E,0x895F,0x895F,0x895F,0x6918,0x1025,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x388D,0x50D3,0x60F5,0x60F5,0x50D3,0x388D,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+};
+
+
+
+const unsigned short sd_front[256]= {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x1024,0x50D2,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x1846,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x306B,0x793C,0x50D2,0x895F,0x48B1,0x815E,0x58D4,0x711A,0x40AF,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x306B,0x6918,0x1023,0x895F,0x0000,0x793C,0x2047,0x58D4,0x40AF,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x308C,0x711A,0x306B,0x895F,0x2048,0x793D,0x388E,0x60F7,0x40AF,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x6919,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x306B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x1846,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x1846,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    
+    
+    
+    const uint16_t blu_main[576]= {
+    
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x306B,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40B0,0x895F,0x793B,0x388D,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F5,0x895F,0x895F,0x895F,0x58F5,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F5,0x895F,0x895F,0x895F,0x895F,0x793B,0x388C,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x1825,0x0000,0x0000,0x0000,0x58F5,0x895F,0x815E,0x711A,0x895F,0x895F,0x895F,0x58F4,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x1024,0x7119,0x813D,0x388D,0x0000,0x0000,0x58F5,0x895F,0x793C,0x2047,0x40AF,0x813D,0x895F,0x895F,0x7119,0x1024,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x1846,0x813D,0x895F,0x815E,0x388D,0x0000,0x58F5,0x895F,0x793C,0x1024,0x0000,0x50D2,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x388E,0x815E,0x895F,0x815E,0x388D,0x58F5,0x895F,0x793C,0x1025,0x308C,0x813D,0x895F,0x815E,0x388E,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x408E,0x815E,0x895F,0x813D,0x793D,0x895F,0x793C,0x48B1,0x813D,0x895F,0x815E,0x408E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x408E,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x408E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AE,0x815E,0x895F,0x895F,0x895F,0x895F,0x815E,0x408E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x815E,0x895F,0x895F,0x895F,0x895F,0x815E,0x408E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x408E,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x408E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x408E,0x815E,0x895F,0x813D,0x793D,0x895F,0x793C,0x48B1,0x813D,0x895F,0x815E,0x408E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x388E,0x815E,0x895F,0x815E,0x388C,0x58F5,0x895F,0x793C,0x1025,0x308C,0x813D,0x895F,0x815E,0x388E,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x1846,0x813D,0x895F,0x815E,0x388C,0x0000,0x58F5,0x895F,0x793C,0x1024,0x0000,0x50D2,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x1024,0x7119,0x793D,0x388D,0x0000,0x0000,0x58F5,0x895F,0x793C,0x2047,0x40AF,0x813D,0x895F,0x895F,0x7119,0x1024,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x1825,0x0000,0x0000,0x0000,0x58F5,0x895F,0x815E,0x711A,0x895F,0x895F,0x895F,0x58F4,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F5,0x895F,0x895F,0x895F,0x895F,0x793B,0x388C,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F5,0x895F,0x895F,0x895F,0x58F5,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40B0,0x895F,0x793B,0x388D,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x306B,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    
+    
+    
+    
+    
+    const uint16_t nfc_main[576]= {
+    
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0801,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x58F5,0x48B1,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D3,0x915F,0x813D,0x2047,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x306B,0x1846,0x0000,0x2048,0x813D,0x895F,0x50D3,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x50D3,0x895F,0x60F5,0x0001,0x0000,0x58D4,0x895F,0x793C,0x1825,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x0000,0x0000,0x50D3,0x895F,0x815E,0x2869,0x0000,0x2869,0x895E,0x895F,0x388E,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x6918,0x306B,0x0000,0x1846,0x793C,0x895F,0x58D4,0x0000,0x0802,0x7119,0x915F,0x60F6,0x0001,
+    0x0000,0x2869,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x7119,0x915F,0x6918,0x0802,0x0000,0x58D4,0x895F,0x793B,0x1024,0x0000,0x50D2,0x895F,0x793B,0x1024,
+    0x0801,0x60F7,0x815E,0x40AF,0x0801,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x2869,0x0000,0x306B,0x895F,0x895F,0x2869,0x0000,0x308C,0x895F,0x815E,0x286A,
+    0x2869,0x815E,0x895F,0x895F,0x58F5,0x1024,0x0000,0x0000,0x0000,0x0000,0x1825,0x793C,0x895F,0x48B1,0x0000,0x1845,0x813D,0x895F,0x40AF,0x0000,0x2047,0x815E,0x895F,0x388D,
+    0x388E,0x895F,0x895F,0x895F,0x895F,0x7119,0x2048,0x0000,0x0000,0x0000,0x0001,0x68F7,0x915F,0x60F7,0x0000,0x0822,0x711A,0x915F,0x50D3,0x0000,0x1025,0x793C,0x895F,0x40AE,
+    0x40AF,0x895F,0x813D,0x60F7,0x895F,0x895F,0x813D,0x388D,0x0001,0x0000,0x0000,0x58D4,0x915F,0x7119,0x0802,0x0001,0x6918,0x915F,0x58F5,0x0000,0x1024,0x793B,0x895F,0x40AF,
+    0x40AF,0x895F,0x793B,0x1825,0x408E,0x813D,0x895F,0x895F,0x50D3,0x0823,0x0000,0x50D3,0x915F,0x711A,0x0802,0x0001,0x6918,0x915F,0x58F5,0x0000,0x1024,0x793B,0x895F,0x40AF,
+    0x388E,0x895F,0x815E,0x2047,0x0000,0x2869,0x711A,0x895F,0x895F,0x6918,0x2047,0x60F6,0x915F,0x6918,0x0001,0x0822,0x711A,0x915F,0x50D3,0x0000,0x1025,0x793C,0x895F,0x40AF,
+    0x2869,0x815E,0x895F,0x48B1,0x0000,0x0000,0x1825,0x60F6,0x895F,0x895F,0x793C,0x813D,0x895F,0x58D4,0x0000,0x1845,0x813D,0x895F,0x40AF,0x0000,0x2047,0x815E,0x895F,0x388E,
+    0x0801,0x60F6,0x793B,0x306B,0x0000,0x0000,0x0000,0x0802,0x48B0,0x815E,0x895F,0x895F,0x895F,0x388C,0x0000,0x306B,0x895F,0x895F,0x2869,0x0000,0x308C,0x895F,0x895F,0x306B,
+    0x0000,0x1846,0x1025,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x793B,0x895F,0x793C,0x1024,0x0000,0x58D4,0x895F,0x793B,0x1024,0x0000,0x50D2,0x895F,0x793C,0x1025,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x6918,0x48B1,0x0000,0x1846,0x793C,0x895F,0x58D4,0x0000,0x0802,0x7119,0x915F,0x60F6,0x0001,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x0823,0x0000,0x50D3,0x895F,0x815E,0x2869,0x0000,0x2869,0x895E,0x895F,0x388E,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x50D3,0x895F,0x60F5,0x0001,0x0000,0x58D4,0x895F,0x793C,0x1825,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x306B,0x1846,0x0000,0x2048,0x813D,0x895F,0x50D3,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D3,0x915F,0x813D,0x2047,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x58F5,0x48B1,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0801,0x0000,0x0000,0x0000
+    };
+    
+    
+    
+    
+    
+    
+    
+    
+    
+    const uint16_t infra_main[576]  = {
+    
+    0x1847,0x388D,0x0801,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x58D4,0x815E,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x58F5,0x895F,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x58D4,0x895F,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x58D4,0x895F,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x58D4,0x895F,0x388C,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x1023,0x0000,
+    0x58D4,0x895F,0x815E,0x6918,0x388C,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x2048,0x0001,0x0802,0x6918,0x60F6,0x0001,
+    0x50D3,0x895F,0x895F,0x895F,0x895F,0x50D3,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x2047,0x0000,0x308C,0x815E,0x286A,0x0001,0x6918,0x793C,0x1025,
+    0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B0,0x0000,0x0000,0x0000,0x1024,0x388D,0x0823,0x0801,0x7119,0x7119,0x0001,0x2869,0x895F,0x48B1,0x0000,0x50D3,0x895F,0x2869,
+    0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x308C,0x895F,0x388D,0x0000,0x60F6,0x813D,0x1025,0x1025,0x813E,0x60F6,0x0000,0x40AE,0x895F,0x388D,
+    0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AE,0x0000,0x0000,0x2048,0x895F,0x50D2,0x0000,0x50D2,0x895F,0x2048,0x0822,0x793C,0x6919,0x0001,0x308C,0x895F,0x40B0,
+    0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x0000,0x0000,0x1846,0x815E,0x58F5,0x0000,0x40B0,0x895F,0x286A,0x0801,0x711A,0x711A,0x0001,0x286A,0x895F,0x48B1,
+    0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x1845,0x815E,0x58F5,0x0000,0x40B0,0x895F,0x286A,0x0801,0x711A,0x711A,0x0801,0x286A,0x895F,0x48D2,
+    0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40B0,0x0000,0x0000,0x2048,0x895F,0x50D3,0x0000,0x48D2,0x895F,0x2048,0x0822,0x793B,0x6919,0x0001,0x306B,0x895F,0x48B0,
+    0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2047,0x0000,0x0000,0x306B,0x895F,0x408E,0x0000,0x60F6,0x815E,0x1845,0x1024,0x813D,0x60F6,0x0000,0x388E,0x895F,0x388E,
+    0x48D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x0000,0x0000,0x0000,0x1024,0x388E,0x1024,0x0001,0x6918,0x711A,0x0802,0x2069,0x895F,0x50D2,0x0000,0x50D2,0x895F,0x286A,
+    0x48D1,0x895F,0x895F,0x895F,0x895F,0x60F7,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x2047,0x0000,0x286A,0x815E,0x306B,0x0000,0x68F7,0x813D,0x1845,
+    0x48B1,0x895F,0x895F,0x793C,0x48B1,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x1847,0x0001,0x0001,0x60F5,0x60F6,0x0001,
+    0x48B1,0x895F,0x48B1,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x0822,0x0000,
+    0x48B1,0x895F,0x306A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x48B1,0x895F,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x48B0,0x895F,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x40B0,0x895F,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x2047,0x50D3,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    
+    
+    
+    
+    
+    
+    
+    const uint16_t rf_main[576] = {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x1024,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x793B,0x793B,0x60F6,0x306B,0x0001,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x40AF,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x308C,0x48B0,0x6919,0x815E,0x58D4,0x0822,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0801,0x58F5,0x895F,0x7119,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x0823,0x0802,0x388E,0x815E,0x58D4,0x0001,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x388E,0x895F,0x895F,0x895F,0x7119,0x1845,0x0000,0x0000,0x0000,0x0000,0x2047,0x793C,0x793B,0x40AE,0x0001,0x388E,0x815E,0x306B,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x1024,0x713B,0x895F,0x895F,0x895F,0x895F,0x7119,0x1845,0x0000,0x0000,0x0000,0x0802,0x306A,0x58D4,0x815E,0x40AE,0x0802,0x6919,0x60F6,0x0001,
+    0x0000,0x0000,0x0000,0x0000,0x308C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x1845,0x0000,0x0000,0x0001,0x1024,0x0801,0x58D4,0x793B,0x0823,0x48B0,0x793B,0x1024,
+    0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x1845,0x0000,0x2047,0x6919,0x1024,0x306A,0x793C,0x1024,0x308C,0x793B,0x1825,
+    0x0000,0x0000,0x0000,0x0801,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x1825,0x0801,0x2047,0x0001,0x0802,0x2047,0x0000,0x0802,0x2047,0x0000,
+    0x0000,0x0000,0x0000,0x0802,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0802,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0001,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x2048,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x1845,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0001,0x6917,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x1845,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0823,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x1845,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x306B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x60F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x1023,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x1846,0x813D,0x895F,0x895F,0x895F,0x793C,0x60F7,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x388E,0x0801,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x48B0,0x895F,0x895F,0x895F,0x895F,0x60F5,0x0802,0x2048,0x48B1,0x60F7,0x711A,0x711A,0x6918,0x58D4,0x388D,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0822,0x711A,0x895F,0x895F,0x895F,0x895F,0x48D1,0x0000,0x0000,0x0000,0x0001,0x0802,0x0802,0x0801,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0001,0x286A,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x1024,0x6918,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x50D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x1024,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    
+    
+    
+    
+    
+const uint16_t wifi_main[576] = {
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x388D,0x48B0,0x58D4,0x58D4,0x48B0,0x388D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x50D2,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x50D2,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0802,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0802,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x2047,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x2047,0x0000,0x0000,
+0x0000,0x2869,0x895E,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x48B1,0x306B,0x2068,0x2048,0x306B,0x48B1,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895E,0x2869,0x0000,
+0x0000,0x793C,0x895F,0x895F,0x895F,0x895F,0x6918,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1847,0x68F7,0x895F,0x895F,0x895F,0x895F,0x793D,0x0000,
+0x0000,0x815E,0x895F,0x895F,0x895F,0x388D,0x0000,0x0000,0x0000,0x0823,0x306B,0x408E,0x408E,0x306B,0x0823,0x0000,0x0000,0x0000,0x388D,0x895F,0x895F,0x895F,0x813D,0x0000,
+0x0000,0x306B,0x793D,0x711A,0x2048,0x0000,0x0000,0x1847,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x2047,0x0000,0x0000,0x2047,0x711A,0x813D,0x306B,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AE,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B1,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x50D3,0x895F,0x895F,0x895F,0x895F,0x58D4,0x388D,0x388D,0x50D3,0x815E,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x2068,0x895F,0x895F,0x711A,0x1024,0x0000,0x0000,0x0000,0x0000,0x1023,0x6919,0x895F,0x895F,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x2068,0x0001,0x0000,0x0802,0x388D,0x388D,0x0802,0x0000,0x0000,0x2869,0x1025,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x793C,0x895F,0x895F,0x793C,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x408E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x815E,0x895F,0x895F,0x815E,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x50D2,0x48D2,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+};
+
+
+
+const uint16_t sd_main[576] = {
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x50D2,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x48B1,0x1847,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x2869,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x68F7,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x50D2,0x793B,0x895F,0x50D3,0x711A,0x895F,0x58D4,0x6918,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x7119,0x0000,0x408E,0x793C,0x0000,0x306B,0x895F,0x0000,0x2048,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x388D,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0000,0x388E,0x793C,0x0000,0x306B,0x895F,0x0000,0x2047,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0000,0x388E,0x793C,0x0000,0x306B,0x895F,0x0000,0x2047,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x58F5,0x895E,0x2047,0x50D3,0x895F,0x2869,0x48B0,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x68F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x2869,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x2869,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x1847,0x48B1,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x48B1,0x1847,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+};
+
+
+
+
+
+    
+    
+    
+    const unsigned short reboot_main[144]  = {
+    
+    
+      0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841,
+      0x0000, 0x0000, 0x0000, 0x0803, 0x68F7, 0x895F, 0x895F, 0x60F6, 0x0801, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x308C, 0xB1BF, 0x50D2, 0x1846, 0x1847, 0x58D4, 0xB1BF, 0x2869, 0x0000, 0x0000,
+      0x0000, 0x1024, 0xB1BF, 0x0802, 0x0000, 0x0000, 0x0000, 0x0000, 0x1024, 0xA19F, 0x48B0, 0x0000,
+      0x0000, 0x58F5, 0x50D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1023, 0x997F, 0x60F7, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1825, 0x0000,
+      0x0000, 0x1023, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x60F7, 0x895F, 0x1023, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x40AF, 0x50D2, 0x0000,
+      0x0000, 0x58D4, 0xA19F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA9BF, 0x1846, 0x0000,
+      0x0000, 0x0000, 0x388E, 0xA9BF, 0x40AF, 0x0802, 0x0802, 0x408E, 0xA99F, 0x40AF, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x1825, 0x791B, 0xA19F, 0xA19F, 0x793B, 0x1846, 0x0000, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020
+    };
+    
+    
+    const unsigned short bat_main[144] = {
+    
+      0x0020, 0x0020, 0x0020, 0x0000, 0x40AF, 0x48D1, 0x48D1, 0x40AE, 0x0000, 0x0020, 0x0020, 0x0841,
+      0x0000, 0x0000, 0x0803, 0x58D5, 0x306B, 0x0000, 0x0000, 0x306B, 0x58D5, 0x0802, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x40AF, 0x2048, 0x50D2, 0x50D3, 0x50D3, 0x50D2, 0x2048, 0x40AF, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x388D, 0x60F6, 0xA19F, 0x997F, 0x997F, 0xA19F, 0x58F5, 0x388D, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x40AF, 0x1023, 0x1825, 0x1825, 0x1825, 0x1825, 0x1024, 0x40AE, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x408F, 0x2048, 0x388E, 0x388D, 0x388D, 0x388E, 0x2049, 0x388E, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x388D, 0x60F6, 0xA19F, 0xA19F, 0xA19F, 0xA19F, 0x58F5, 0x388D, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x408F, 0x1825, 0x2869, 0x2048, 0x2048, 0x2869, 0x1846, 0x408E, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x40AF, 0x1023, 0x1025, 0x1025, 0x1025, 0x1025, 0x1024, 0x40AE, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x388E, 0x60F5, 0xA19F, 0x997F, 0x997F, 0xA19F, 0x58D4, 0x388D, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x308C, 0x48B0, 0x50D3, 0x50D3, 0x50D3, 0x50D3, 0x48B0, 0x306B, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x308A, 0x308B, 0x308B, 0x308B, 0x308B, 0x308A, 0x0000, 0x0000, 0x0020
+    };
+    
+    
+    const unsigned short conf_main[576]  = {
+    
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0801,0x0000,0x0000,0x0000,0x0000,0x0802,0x0000,0x0000,0x0000,0x0000,0x0802,0x0000,0x0000,0x0000,0x0000,0x0801,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x388C,0x60F6,0x0802,0x0000,0x0000,0x2048,0x68F7,0x1024,0x0000,0x0000,0x1024,0x68F7,0x2068,0x0000,0x0000,0x0802,0x60F5,0x388C,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x48B1,0x793C,0x1023,0x0000,0x0000,0x308C,0x815E,0x1846,0x0000,0x0000,0x1846,0x815E,0x308C,0x0000,0x0000,0x1023,0x793C,0x48B1,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x48B0,0x793C,0x1023,0x0000,0x0000,0x308C,0x815E,0x1846,0x0000,0x0000,0x1846,0x815E,0x308C,0x0000,0x0000,0x1023,0x793C,0x48B0,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x48B0,0x793C,0x1023,0x0000,0x0000,0x308C,0x815E,0x1846,0x0000,0x0000,0x1846,0x815E,0x308C,0x0000,0x0000,0x1023,0x793C,0x48B0,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x48B0,0x793C,0x1023,0x0000,0x0000,0x308C,0x815E,0x1846,0x0000,0x0000,0x1846,0x815E,0x308C,0x0000,0x0000,0x1023,0x793C,0x48B0,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x48B0,0x793C,0x1023,0x0000,0x0000,0x308C,0x815E,0x1846,0x0000,0x0000,0x1846,0x815E,0x308C,0x0000,0x0000,0x1023,0x793C,0x48B0,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x48B0,0x793C,0x1023,0x0000,0x0000,0x308C,0x815E,0x1846,0x0000,0x0000,0x1846,0x815E,0x308C,0x0000,0x0000,0x1023,0x793C,0x48B0,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x48B0,0x793C,0x1023,0x0000,0x0000,0x308C,0x815E,0x1846,0x0000,0x0000,0x1846,0x815E,0x308C,0x0000,0x0000,0x1023,0x793C,0x48B0,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x48B0,0x793C,0x0823,0x0000,0x0000,0x308C,0x815E,0x1846,0x0000,0x0000,0x1846,0x815E,0x308C,0x0000,0x0000,0x0823,0x793C,0x48B0,0x0000,0x0000,0x0000,
+    0x0000,0x0001,0x1845,0x50D2,0x793C,0x2048,0x1023,0x1025,0x408E,0x815E,0x286A,0x1024,0x1024,0x286A,0x815E,0x408E,0x1024,0x1023,0x2048,0x793C,0x50D2,0x1846,0x0001,0x0000,
+    0x0000,0x0001,0x408E,0x50D2,0x6918,0x40AF,0x2047,0x308C,0x48B1,0x7119,0x48B0,0x286A,0x2869,0x48B0,0x7119,0x48B1,0x308C,0x2047,0x40AF,0x6918,0x50D2,0x40AE,0x0801,0x0000,
+    0x0000,0x0822,0x50D2,0x60F6,0x60F7,0x58F5,0x286A,0x40AF,0x60F6,0x68F7,0x60F5,0x388C,0x388C,0x60F5,0x68F7,0x60F6,0x40AF,0x286A,0x58F5,0x60F7,0x60F6,0x50D2,0x0822,0x0000,
+    0x0000,0x1024,0x793C,0x895F,0x895F,0x895F,0x40AF,0x6919,0x895F,0x895F,0x915F,0x58D4,0x58D4,0x915F,0x895F,0x895F,0x68F7,0x48B0,0x915F,0x895F,0x895F,0x793C,0x1024,0x0000,
+    0x0000,0x1024,0x793C,0x60F6,0x388D,0x815E,0x40AF,0x6919,0x7119,0x308C,0x813D,0x58D4,0x58D4,0x813D,0x308C,0x7119,0x68F7,0x48B0,0x895E,0x388D,0x60F6,0x793C,0x1024,0x0000,
+    0x0000,0x1024,0x793C,0x6918,0x50D2,0x895E,0x40AF,0x6919,0x793B,0x48B1,0x815E,0x58D4,0x58D4,0x815E,0x48B1,0x793B,0x68F7,0x48B0,0x895F,0x50D2,0x6918,0x793C,0x1024,0x0000,
+    0x0000,0x1024,0x793C,0x895F,0x895F,0x895F,0x40AF,0x6918,0x895F,0x895F,0x895F,0x50D3,0x50D3,0x895F,0x895F,0x895F,0x60F7,0x48B0,0x895F,0x895F,0x895F,0x793C,0x1024,0x0000,
+    0x0000,0x1024,0x793C,0x895F,0x895F,0x895F,0x40AF,0x6919,0x895F,0x895F,0x915F,0x58D4,0x58D4,0x915F,0x895F,0x915F,0x68F7,0x48B0,0x895F,0x895F,0x895F,0x793C,0x1024,0x0000,
+    0x0000,0x1023,0x68F7,0x713B,0x711A,0x711A,0x388D,0x58F4,0x713B,0x711A,0x793B,0x48B0,0x48B0,0x793B,0x711A,0x793B,0x50D3,0x388D,0x713B,0x711A,0x713B,0x68F7,0x1023,0x0000,
+    0x0000,0x0000,0x0822,0x0823,0x0823,0x0823,0x0001,0x0802,0x0823,0x0823,0x0823,0x0801,0x0801,0x0823,0x0823,0x0823,0x0802,0x0001,0x0823,0x0823,0x0823,0x0822,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+const uint16_t Music[576] = {
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x58D4,0x895F,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x6919,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x793D,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x0001,0x2869,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388C,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x1846,0x895F,0x40B0,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0001,0x2047,0x0000,0x48B1,0x895F,0x2048,0x0000,0x0000,
+0x0000,0x0801,0x306B,0x388C,0x388C,0x388C,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x2048,0x895F,0x388D,0x0000,0x711A,0x711A,0x0000,0x0000,
+0x0000,0x68F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x58D4,0x815E,0x0823,0x2869,0x895F,0x2048,0x0000,
+0x0000,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x0802,0x815E,0x48B1,0x0000,0x813D,0x50D2,0x0000,
+0x0000,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x58F5,0x711A,0x0000,0x60F6,0x6918,0x0000,
+0x0000,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x40AF,0x815E,0x0000,0x50D2,0x793B,0x0000,
+0x0000,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x40B0,0x815E,0x0000,0x50D2,0x793B,0x0000,
+0x0000,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x58F5,0x711A,0x0000,0x60F6,0x6918,0x0000,
+0x0000,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x0822,0x815E,0x48B1,0x0000,0x813D,0x48D2,0x0000,
+0x0000,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x58F5,0x815E,0x0823,0x2869,0x895F,0x2048,0x0000,
+0x0000,0x0801,0x306B,0x388C,0x388C,0x388C,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x2048,0x895F,0x388C,0x0000,0x711A,0x711A,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0001,0x2047,0x0000,0x48B1,0x895F,0x2048,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388C,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x1846,0x895F,0x40AF,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x793D,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x0001,0x2869,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x6919,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x58D4,0x895F,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+};
+
+
+const uint16_t inatividade[576] = {
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0823,0x815E,0x895F,0x895F,0x895F,0x6919,0x0000,0x50D3,0x813D,0x895F,0x895F,0x793C,0x60F7,0x388D,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x1025,0x895F,0x895F,0x895F,0x895F,0x793C,0x0000,0x7119,0x895F,0x815E,0x815E,0x895F,0x895F,0x895F,0x815E,0x48B0,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x1025,0x895F,0x895F,0x895F,0x895F,0x793C,0x0000,0x1846,0x0001,0x0000,0x0000,0x0001,0x2869,0x58D4,0x895F,0x895F,0x711A,0x1024,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x1025,0x895F,0x895F,0x895F,0x895F,0x793C,0x0000,0x0000,0x2048,0x6918,0x6918,0x58D4,0x306B,0x0001,0x1024,0x6918,0x895F,0x813D,0x1024,0x0000,0x0000,0x0000,
+0x0000,0x60F6,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x40B0,0x0000,0x895F,0x895F,0x895F,0x895F,0x793C,0x306B,0x0000,0x58F5,0x895F,0x711A,0x0001,0x0000,0x0000,
+0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x388D,0x0823,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x6918,0x895F,0x48B0,0x0000,0x0000,
+0x0000,0x0001,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x60F6,0x6918,0x68F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x306A,0x1025,0x895F,0x815E,0x0823,0x0000,
+0x0000,0x0000,0x1025,0x815E,0x895F,0x895F,0x895F,0x711A,0x0001,0x40AF,0x895F,0x306B,0x306B,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x0001,0x58D4,0x895F,0x388D,0x0000,
+0x0000,0x58D4,0x0823,0x286A,0x895F,0x895F,0x813D,0x1024,0x2048,0x895F,0x895F,0x306B,0x306B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x306B,0x2869,0x895F,0x60F7,0x0000,
+0x0000,0x813D,0x6918,0x0000,0x48B1,0x895F,0x2869,0x1024,0x813D,0x895F,0x6918,0x0823,0x0823,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0801,0x895F,0x793C,0x0000,
+0x0000,0x895F,0x813D,0x0000,0x0000,0x1024,0x0001,0x711A,0x895F,0x895F,0x1825,0x2869,0x2869,0x0823,0x286A,0x286A,0x6918,0x895F,0x895F,0x6918,0x0000,0x815E,0x895F,0x0000,
+0x0000,0x895F,0x815E,0x0000,0x40AE,0x40AF,0x711A,0x895F,0x895F,0x895F,0x1845,0x2869,0x2869,0x0823,0x388C,0x388C,0x6918,0x895F,0x895F,0x6918,0x0000,0x815E,0x895F,0x0000,
+0x0000,0x793C,0x895F,0x0801,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x1825,0x1025,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0801,0x895F,0x793C,0x0000,
+0x0000,0x60F7,0x895F,0x2869,0x306B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x306B,0x2869,0x895F,0x60F7,0x0000,
+0x0000,0x388D,0x895F,0x58D4,0x0001,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x0001,0x58D4,0x895F,0x388D,0x0000,
+0x0000,0x0822,0x815E,0x895F,0x1025,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x286A,0x1025,0x895F,0x815E,0x0822,0x0000,
+0x0000,0x0000,0x48B0,0x895F,0x6918,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0001,0x6918,0x895F,0x48B0,0x0000,0x0000,
+0x0000,0x0000,0x0001,0x711A,0x895F,0x58F5,0x0000,0x286A,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x286A,0x0001,0x58F5,0x895F,0x711A,0x0001,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x1024,0x813D,0x895F,0x6918,0x1025,0x0001,0x306B,0x58D4,0x6918,0x6918,0x58D4,0x306B,0x0001,0x1025,0x6918,0x895F,0x813D,0x1024,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x1024,0x711A,0x895F,0x895F,0x58D4,0x2869,0x0801,0x0000,0x0000,0x0801,0x2869,0x58D4,0x895F,0x895F,0x711A,0x1024,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x48B0,0x815E,0x895F,0x895F,0x895F,0x815E,0x815E,0x895F,0x895F,0x895F,0x815E,0x48B0,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x388D,0x60F6,0x793C,0x895F,0x895F,0x793C,0x60F6,0x388D,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+};
+
+
+
+   
+    
+
+    
+    const unsigned short high_main[144] = {
+    
+    
+      0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0841,
+      0x0000, 0x0000, 0x793D, 0x388E, 0x0000, 0x0000, 0x0000, 0x0000, 0x408E, 0x793C, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x997F, 0x997F, 0x895F, 0x2869, 0x2869, 0x915F, 0x997F, 0x997F, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x711A, 0x915F, 0x895F, 0x917F, 0x917F, 0x895F, 0x915F, 0x7119, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0802, 0x815E, 0x895F, 0x895F, 0x895F, 0x895F, 0x815E, 0x0801, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x997F, 0x895F, 0x895F, 0x6919, 0x6919, 0x895F, 0x895F, 0x997F, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x997F, 0x895F, 0x915F, 0x58D5, 0x58F5, 0x915F, 0x895F, 0x997F, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x1825, 0x813E, 0x895F, 0x915F, 0x915F, 0x895F, 0x813E, 0x1825, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x58F5, 0x917F, 0x895F, 0x917F, 0x917F, 0x895F, 0x917F, 0x58D5, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x997F, 0x917F, 0x997F, 0x388D, 0x388D, 0x997F, 0x917F, 0x997F, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x915F, 0x50B2, 0x0000, 0x0000, 0x0000, 0x0000, 0x50D2, 0x895F, 0x0000, 0x0000,
+      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020
+    };
+    
+    const unsigned short sniffble[576]  = {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0823,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x1024,0x40B0,0x6918,0x793B,0x711A,0x58F5,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x60F7,0x2048,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x2047,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x48B0,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x58D4,0x793B,0x2047,0x0000,0x0000,0x0000,
+    0x0000,0x1023,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x388D,0x0000,0x0000,0x0000,0x0823,0x308C,0x0802,0x0801,0x58F5,0x6919,0x0823,0x0000,0x0000,
+    0x0000,0x40AF,0x895F,0x895F,0x895F,0x793C,0x308C,0x60F6,0x895F,0x895F,0x895F,0x713B,0x1023,0x0000,0x0000,0x1825,0x793B,0x50D3,0x0001,0x1024,0x711A,0x48B0,0x0000,0x0000,
+    0x0001,0x68F7,0x895F,0x895F,0x895F,0x711A,0x0802,0x0822,0x58F5,0x895F,0x895F,0x895F,0x286A,0x0000,0x0823,0x0000,0x2068,0x793C,0x408E,0x0000,0x388D,0x793B,0x1024,0x0000,
+    0x0823,0x711A,0x895F,0x895F,0x815E,0x711A,0x0823,0x2047,0x1023,0x50D3,0x895F,0x895F,0x388D,0x1846,0x6919,0x2869,0x0000,0x40AF,0x793B,0x1024,0x0823,0x713B,0x388D,0x0000,
+    0x0823,0x711A,0x895F,0x6918,0x2869,0x58D4,0x1024,0x58D4,0x1846,0x1845,0x813D,0x895F,0x388D,0x0001,0x50D3,0x711A,0x1023,0x0823,0x793B,0x388D,0x0000,0x58D4,0x58D4,0x0000,
+    0x0823,0x711A,0x895F,0x793C,0x2869,0x0822,0x0001,0x1025,0x1024,0x60F6,0x895F,0x895F,0x388D,0x0000,0x1024,0x793B,0x388D,0x0000,0x58F5,0x58D4,0x0000,0x40AF,0x6919,0x0801,
+    0x0823,0x711A,0x895F,0x895F,0x793C,0x2048,0x0000,0x1024,0x6918,0x895F,0x895F,0x895F,0x388D,0x0000,0x0000,0x60F6,0x50D3,0x0000,0x48B1,0x60F7,0x0000,0x308C,0x711A,0x0823,
+    0x0823,0x711A,0x895F,0x895F,0x793C,0x2048,0x0000,0x1024,0x6918,0x895F,0x895F,0x895F,0x388D,0x0000,0x0000,0x60F6,0x50D2,0x0000,0x48B1,0x60F7,0x0000,0x308C,0x711A,0x0823,
+    0x0823,0x711A,0x895F,0x793C,0x2869,0x0822,0x0001,0x1025,0x1024,0x60F6,0x895F,0x895F,0x388D,0x0000,0x1024,0x793B,0x388C,0x0000,0x58F5,0x58D4,0x0000,0x40AF,0x6918,0x0801,
+    0x0823,0x711A,0x895F,0x6918,0x2869,0x58D4,0x1024,0x58D4,0x1846,0x1845,0x813D,0x895F,0x388D,0x0001,0x58D4,0x711A,0x0823,0x1023,0x793B,0x388C,0x0000,0x58F5,0x58D4,0x0000,
+    0x0823,0x711A,0x895F,0x895F,0x815E,0x711A,0x0823,0x2047,0x1023,0x50D3,0x895F,0x895F,0x388D,0x1846,0x6919,0x2068,0x0000,0x40AF,0x713B,0x1023,0x1023,0x793B,0x388C,0x0000,
+    0x0001,0x68F7,0x895F,0x895F,0x895F,0x711A,0x0802,0x0822,0x58F5,0x895F,0x895F,0x895F,0x286A,0x0000,0x0802,0x0000,0x2869,0x793C,0x388D,0x0000,0x388E,0x793B,0x1024,0x0000,
+    0x0000,0x40AF,0x895F,0x895F,0x895F,0x793C,0x308C,0x60F7,0x895F,0x895F,0x895F,0x713B,0x1023,0x0000,0x0000,0x1846,0x793B,0x50D3,0x0000,0x1024,0x713B,0x40B0,0x0000,0x0000,
+    0x0000,0x1023,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x388D,0x0000,0x0000,0x0000,0x1023,0x308B,0x0001,0x0802,0x60F6,0x6918,0x0823,0x0000,0x0000,
+    0x0000,0x0000,0x2047,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x48B0,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x58F5,0x793B,0x1847,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x1024,0x40B0,0x6918,0x793B,0x711A,0x58F5,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1847,0x60F7,0x2047,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0823,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    
+    
+    const unsigned short dispoble[576]  = {
+    
+    0x0000,0x0000,0x0823,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1024,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x286A,0x711A,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x793B,0x40AF,0x0000,0x0000,0x0000,
+    0x0823,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2047,0x0000,0x0000,
+    0x1846,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x306B,0x0000,0x0000,
+    0x1846,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793B,0x6918,0x68F7,0x68F7,0x68F7,0x68F7,0x68F7,0x68F7,0x68F7,0x6918,0x2869,0x0000,0x0000,
+    0x1846,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x1024,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0000,0x0000,0x0000,
+    0x1846,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x1023,0x408E,0x7119,0x711A,0x711A,0x711A,0x711A,0x711A,0x711A,0x711A,0x6918,0x2869,0x0000,0x0000,
+    0x1846,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x1024,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x915F,0x60F6,0x0000,0x0000,
+    0x1846,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x1024,0x793C,0x895F,0x895F,0x793B,0x40B0,0x306B,0x306B,0x306B,0x306B,0x306B,0x2048,0x0000,0x0000,
+    0x1846,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x915F,0x58D4,0x1024,0x793C,0x895F,0x793C,0x2048,0x1024,0x306A,0x306B,0x306B,0x306B,0x306B,0x306A,0x1024,0x0000,
+    0x1025,0x60F7,0x7119,0x6919,0x6919,0x6919,0x6919,0x6919,0x7119,0x40AF,0x1024,0x793C,0x895F,0x58D4,0x1023,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x0822,
+    0x0000,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0801,0x1024,0x793C,0x895F,0x48B0,0x1846,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1845,
+    0x1024,0x60F6,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6919,0x40AF,0x1024,0x793C,0x895F,0x48B0,0x1846,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793D,0x1846,
+    0x0801,0x60F6,0x917F,0x915F,0x915F,0x915F,0x915F,0x915F,0x917F,0x58D4,0x1024,0x793C,0x895F,0x48B0,0x1846,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793D,0x1846,
+    0x0000,0x1024,0x50D2,0x60F7,0x60F7,0x60F7,0x60F7,0x60F7,0x60F7,0x388E,0x1024,0x793C,0x895F,0x48B0,0x1846,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793D,0x1846,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0823,0x0802,0x1024,0x793C,0x895F,0x48B0,0x1846,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793D,0x1846,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x7119,0x48B0,0x1024,0x793C,0x895F,0x48B0,0x1846,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793D,0x1846,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x915F,0x58D4,0x1024,0x793C,0x895F,0x48B0,0x1846,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x6918,0x915F,0x58D4,0x0001,0x2047,0x2048,0x1024,0x1846,0x793C,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x793B,0x1845,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x813D,0x895F,0x895F,0x58D4,0x0802,0x388D,0x40AF,0x2047,0x0001,0x1846,0x1847,0x1847,0x1847,0x1847,0x1847,0x1847,0x1846,0x0001,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x50D3,0x895F,0x895F,0x895F,0x50D3,0x1024,0x813D,0x917F,0x48B1,0x0823,0x40AF,0x40B0,0x40B0,0x40B0,0x40B0,0x40B0,0x40B0,0x408E,0x0823,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x2869,0x2869,0x2869,0x1845,0x0001,0x50D3,0x815E,0x40B0,0x1846,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x915F,0x813D,0x1825,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x1845,0x0823,0x0802,0x58D4,0x793D,0x793D,0x793D,0x793D,0x793D,0x793D,0x50D3,0x0001,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0801,0x1845,0x1846,0x1846,0x1846,0x1846,0x1825,0x0001,0x0000
+    };
+    
+    
+    
+    
+    
+    
+    
+    const unsigned short sniff_wifi[576] = {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x1024,0x308B,0x2869,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x2869,0x306B,0x1023,0x0000,0x0000,
+    0x0000,0x1024,0x6918,0x895F,0x895F,0x48B1,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48D2,0x895F,0x895F,0x6918,0x1023,0x0000,
+    0x0000,0x308B,0x895F,0x895F,0x895F,0x793B,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x793C,0x895F,0x895F,0x895F,0x306B,0x0000,
+    0x0000,0x2869,0x895F,0x895F,0x895F,0x793B,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x793C,0x895F,0x895F,0x895E,0x2068,0x0000,
+    0x0000,0x0001,0x48B1,0x793B,0x793B,0x815E,0x48B1,0x0001,0x0000,0x1023,0x50D3,0x58F5,0x58F5,0x50D3,0x0823,0x0000,0x0001,0x48D1,0x815E,0x793B,0x793B,0x48B0,0x0001,0x0000,
+    0x0000,0x0000,0x0000,0x1023,0x1023,0x48B1,0x815E,0x48B1,0x1023,0x48B1,0x895F,0x895F,0x895F,0x895F,0x48B0,0x1023,0x48B1,0x815E,0x48B0,0x0823,0x1023,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D3,0x895F,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793B,0x895F,0x50D3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x895F,0x895F,0x895F,0x895F,0x793B,0x60F7,0x60F7,0x793B,0x895F,0x895F,0x895F,0x895F,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x6919,0x308B,0x1825,0x388D,0x388D,0x1025,0x308C,0x7119,0x895F,0x895F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x60F7,0x0823,0x0000,0x308C,0x895F,0x895F,0x306B,0x0000,0x1023,0x6918,0x793C,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x68F7,0x1023,0x0000,0x306B,0x895F,0x895F,0x286A,0x0000,0x1024,0x6918,0x793C,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x711A,0x388C,0x1845,0x388C,0x308C,0x1845,0x388D,0x711A,0x895F,0x895F,0x48B0,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x895F,0x895F,0x895F,0x895F,0x793C,0x6918,0x6918,0x793C,0x895F,0x895F,0x895F,0x895E,0x306A,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x58D4,0x895F,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x895F,0x50D3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x1024,0x1024,0x48D1,0x815E,0x40B0,0x0823,0x48B0,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0823,0x48B1,0x815E,0x48B1,0x1024,0x1024,0x0000,0x0000,0x0000,
+    0x0000,0x0001,0x48D2,0x793C,0x793C,0x815E,0x48B0,0x0000,0x0000,0x1023,0x50D2,0x58D4,0x58D4,0x50D2,0x0823,0x0000,0x0001,0x48B1,0x815E,0x793C,0x793C,0x48B1,0x0001,0x0000,
+    0x0000,0x2869,0x895F,0x895F,0x895F,0x793B,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x793C,0x895F,0x895F,0x895F,0x2869,0x0000,
+    0x0000,0x306B,0x895F,0x895F,0x895F,0x793B,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x793C,0x895F,0x895F,0x895F,0x286A,0x0000,
+    0x0000,0x1023,0x6918,0x895F,0x895E,0x48B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x68F7,0x0823,0x0000,
+    0x0000,0x0000,0x0823,0x306B,0x2068,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x2869,0x306A,0x0823,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    
+    
+    
+    const unsigned short select_wifi[144]  = {
+    0x0000,0x0802,0x40B0,0x48D2,0x48D2,0x48D2,0x48D2,0x48D2,0x48D2,0x50D2,0x50D3,0x308B,
+    0x0822,0x1846,0x308C,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x308C,0x58D4,0x58D4,
+    0x50D2,0x813D,0x793C,0x793C,0x793C,0x793C,0x793C,0x793C,0x793C,0x7119,0x308C,0x50D2,
+    0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x388D,0x50D2,
+    0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x815E,0x813D,0x388D,0x50D2,
+    0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x388D,0x815E,0x813D,0x388D,0x50D2,
+    0x58D4,0x895F,0x60F7,0x6918,0x895F,0x58F5,0x308C,0x793B,0x895F,0x793D,0x388D,0x50D2,
+    0x58D4,0x895F,0x711A,0x308B,0x40AF,0x308C,0x793B,0x895F,0x895F,0x793D,0x388D,0x50D2,
+    0x58D4,0x895F,0x895F,0x711A,0x40AF,0x793B,0x895F,0x895F,0x895F,0x793D,0x388D,0x50D2,
+    0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793D,0x308C,0x48B0,
+    0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0802,
+    0x308B,0x58D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x58D4,0x48B1,0x0822,0x0000
+    };
+    
+    
+    
+    
+    const unsigned short moni_wifi[576]= {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x1025,0x2048,0x2068,0x1846,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x60F6,0x793C,0x895F,0x895F,0x813D,0x6919,0x388E,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0801,0x48D2,0x815E,0x915F,0x895F,0x813D,0x813D,0x895F,0x915F,0x895F,0x60F7,0x1025,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x48D1,0x895F,0x895F,0x60F7,0x306B,0x1825,0x1025,0x2068,0x50D3,0x815E,0x895F,0x6918,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x286A,0x815E,0x895F,0x50D2,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x813D,0x895F,0x48B1,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x60F6,0x915F,0x60F7,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x895F,0x793C,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x1024,0x793C,0x895F,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x2047,0x815E,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6918,0x915F,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x2048,0x895E,0x813D,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6918,0x915F,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x1825,0x813D,0x895F,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x793B,0x895F,0x308C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0001,0x6918,0x915F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x895F,0x813D,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x388D,0x895F,0x815E,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x793B,0x895F,0x50D3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0801,0x60F6,0x895F,0x815E,0x48B1,0x1845,0x0801,0x0001,0x1024,0x388D,0x793B,0x895F,0x895E,0x308C,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x1024,0x60F7,0x895F,0x895F,0x813D,0x6919,0x6918,0x793C,0x895F,0x895F,0x813D,0x895F,0x813D,0x793B,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0822,0x40B0,0x793B,0x895F,0x895F,0x895F,0x895F,0x813D,0x50D3,0x2869,0x793B,0x895F,0x895F,0x793D,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x286A,0x388E,0x40AE,0x306B,0x1825,0x0000,0x0801,0x6918,0x895F,0x895F,0x895F,0x793C,0x2869,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x711A,0x895F,0x895F,0x895F,0x793C,0x2048,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x793B,0x895F,0x895F,0x895F,0x793B,0x2048,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x793B,0x895F,0x895F,0x895F,0x711A,0x1024,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x793C,0x895F,0x895F,0x711A,0x1024,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x793C,0x711A,0x1847,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x1024,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    
+    const unsigned short atack_wifi[576]= {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x2048,0x388D,0x40AF,0x40AF,0x388D,0x2048,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x48D1,0x711A,0x815E,0x895F,0x895F,0x895F,0x895F,0x815E,0x711A,0x48B1,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0802,0x48B0,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x48B0,0x0802,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x1024,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x1023,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0822,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x0802,0x0000,0x0000,
+    0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B0,0x0000,0x0000,
+    0x0000,0x1846,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793D,0x1846,0x0000,
+    0x0000,0x48B0,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40B0,0x0000,
+    0x0001,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x0001,
+    0x1024,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x1023,
+    0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x793C,0x793C,0x793C,0x793C,0x813D,0x895F,0x895F,0x815E,0x793C,0x793C,0x793C,0x793C,0x815E,0x895F,0x895F,0x895F,0x793B,0x1024,
+    0x1023,0x713B,0x895F,0x895F,0x895F,0x68F7,0x1025,0x1024,0x1024,0x1023,0x308B,0x895F,0x895F,0x48B1,0x1023,0x1024,0x1024,0x1024,0x50D2,0x895F,0x895F,0x895F,0x711A,0x0823,
+    0x0001,0x60F7,0x895F,0x895F,0x895F,0x68F7,0x0000,0x0000,0x0000,0x0000,0x2869,0x895F,0x895F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x60F6,0x0001,
+    0x0000,0x40AF,0x895F,0x895F,0x895F,0x815E,0x2869,0x0000,0x0000,0x0001,0x58F5,0x895F,0x895F,0x711A,0x1024,0x0000,0x0000,0x1025,0x713B,0x895F,0x895F,0x895F,0x40AE,0x0000,
+    0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x793B,0x388E,0x286A,0x58D4,0x895F,0x60F7,0x60F7,0x895F,0x6918,0x308B,0x308C,0x6918,0x895F,0x895F,0x895F,0x793C,0x1024,0x0000,
+    0x0000,0x0000,0x40AF,0x895F,0x815E,0x7119,0x895F,0x895F,0x895F,0x895F,0x60F7,0x0802,0x0802,0x60F6,0x895F,0x895F,0x895F,0x895F,0x711A,0x813D,0x895F,0x408E,0x0000,0x0000,
+    0x0000,0x0000,0x0801,0x58D4,0x58F5,0x48B0,0x895F,0x895F,0x895F,0x895F,0x308C,0x2048,0x2068,0x308B,0x815E,0x895F,0x895F,0x895F,0x50D2,0x50D3,0x58D4,0x0001,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0822,0x1024,0x40AF,0x895F,0x895F,0x895F,0x895F,0x813D,0x815E,0x815E,0x813D,0x895F,0x895F,0x895F,0x895F,0x48B1,0x0823,0x0802,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48D2,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48D2,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B1,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x793D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x50D2,0x711A,0x815E,0x895F,0x895F,0x895F,0x895F,0x815E,0x793B,0x58D4,0x2069,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x2048,0x308C,0x40AF,0x40AF,0x388D,0x2869,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    
+    
+    
+    
+    
+    
+    const unsigned short timeout[576] = {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x50D3,0x388E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x408E,0x793C,0x895F,0x793B,0x388E,0x2048,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x1846,0x0802,0x58F5,0x895F,0x895F,0x815E,0x813D,0x815E,0x6919,0x308C,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x286A,0x711A,0x1025,0x0802,0x408E,0x793B,0x58D4,0x1825,0x308B,0x60F7,0x815E,0x58F4,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x50D2,0x1847,0x0001,0x0000,0x0000,0x1024,0x0823,0x0000,0x0000,0x0001,0x388D,0x813D,0x60F6,0x0823,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x2068,0x48B1,0x2068,0x0000,0x0000,0x0000,0x0000,0x1025,0x1025,0x0000,0x0000,0x0000,0x0000,0x286A,0x813D,0x50D2,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x1825,0x793C,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F5,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x40B0,0x813D,0x2048,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x1825,0x308C,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x793B,0x50D3,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0822,0x6918,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x713B,0x0822,0x0000,0x0000,
+    0x0000,0x0000,0x1846,0x813D,0x48B1,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x48B1,0x813D,0x1846,0x0000,0x0000,
+    0x0000,0x0000,0x2047,0x815E,0x815E,0x60F7,0x0802,0x0000,0x0000,0x0000,0x0000,0x58D4,0x793B,0x1025,0x0000,0x0000,0x0000,0x0802,0x60F7,0x815E,0x815E,0x2047,0x0000,0x0000,
+    0x0000,0x0000,0x1846,0x813D,0x58D4,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x793C,0x6918,0x1024,0x0000,0x0000,0x0000,0x2048,0x58D4,0x813D,0x1846,0x0000,0x0000,
+    0x0000,0x0000,0x1023,0x793C,0x48B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x793C,0x6918,0x1024,0x0000,0x0000,0x0000,0x48B0,0x793C,0x1023,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x60F6,0x6919,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x793C,0x6918,0x0823,0x0000,0x0802,0x6919,0x60F6,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x306B,0x815E,0x308C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x60F6,0x1025,0x0000,0x308B,0x815E,0x306B,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0801,0x60F6,0x793B,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x1846,0x793B,0x60F6,0x0801,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x1846,0x793B,0x7119,0x2047,0x0000,0x0000,0x0000,0x1846,0x1845,0x0000,0x0000,0x0000,0x2047,0x7119,0x793B,0x1846,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x711A,0x793C,0x40B0,0x1825,0x0801,0x60F5,0x58F5,0x0801,0x1825,0x40B0,0x793C,0x711A,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x50D3,0x813D,0x813D,0x6918,0x813D,0x813D,0x6918,0x813D,0x813D,0x50D3,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x40AF,0x60F5,0x6918,0x6918,0x60F5,0x40AF,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    
+    const unsigned short brilho[576]= {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308B,0x308B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F4,0x58F4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F4,0x58F4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x286A,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x286A,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x388D,0x813D,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x1847,0x1847,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x813D,0x388D,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x40AF,0x815E,0x388D,0x0000,0x0000,0x1825,0x388C,0x48B0,0x48B1,0x388D,0x1825,0x0000,0x0000,0x388D,0x815E,0x40AF,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x306B,0x0802,0x48B1,0x793C,0x895F,0x895F,0x813D,0x793C,0x793C,0x48B1,0x0822,0x306B,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x58F5,0x895F,0x895F,0x895F,0x895F,0x58F5,0x1024,0x40AF,0x793C,0x58F5,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x2069,0x793C,0x48B1,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x40AF,0x793C,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x388C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x1024,0x793C,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x308B,0x58F4,0x58F4,0x58D4,0x1847,0x48B0,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0001,0x6918,0x48B1,0x1847,0x58D4,0x58F4,0x58F4,0x308B,
+    0x308B,0x58F4,0x58F4,0x58D4,0x1847,0x48B0,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0001,0x6918,0x48B1,0x1847,0x58D4,0x58F4,0x58F4,0x308B,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x388C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x1024,0x793C,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x40AF,0x793C,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x2069,0x793C,0x48B1,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x58F5,0x895F,0x895F,0x895F,0x895F,0x58F5,0x1024,0x40AF,0x793C,0x58F5,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x306B,0x0802,0x48B1,0x793C,0x895F,0x895F,0x813D,0x793C,0x793C,0x48B1,0x0802,0x306B,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x40AF,0x815E,0x388D,0x0000,0x0000,0x1825,0x388C,0x48B0,0x48B1,0x388D,0x1825,0x0000,0x0000,0x388D,0x815E,0x40AF,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x388D,0x813D,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x1847,0x1847,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x813D,0x388D,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x286A,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x286A,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F4,0x58F4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F4,0x58F4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308B,0x308B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    
+    
+    
+    
+    
+    const unsigned short infra1[144] = {
+    0x48B1,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x6918,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x6918,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x0802,
+    0x711A,0x793C,0x40AF,0x0001,0x0000,0x0000,0x0000,0x1024,0x1025,0x306A,0x388C,0x40AF,
+    0x711A,0x895F,0x895F,0x388D,0x0000,0x388C,0x2048,0x58D4,0x286A,0x58F5,0x308B,0x60F5,
+    0x711A,0x895F,0x895F,0x60F7,0x0000,0x50D2,0x388C,0x58D4,0x286A,0x58F5,0x286A,0x60F7,
+    0x711A,0x895F,0x895F,0x60F7,0x0000,0x50D2,0x388C,0x58D4,0x286A,0x58F5,0x286A,0x60F7,
+    0x7119,0x895F,0x895F,0x408E,0x0000,0x388D,0x2048,0x58D4,0x286A,0x58F5,0x306B,0x60F6,
+    0x7119,0x813D,0x48D2,0x0802,0x0000,0x0000,0x0000,0x1024,0x1024,0x286A,0x308B,0x40AF,
+    0x6918,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,
+    0x68F7,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x50D2,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    
+    
+    const unsigned short ar[576] = {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x306B,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x306B,0x0000,
+    0x0802,0x7119,0x915F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x915F,0x915F,0x915F,0x915F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x915F,0x7119,0x0802,
+    0x0823,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793B,0x7119,0x7119,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0823,
+    0x0823,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x388E,0x388E,0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0823,
+    0x0823,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0823,
+    0x0823,0x711A,0x895F,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x895F,0x711A,0x0823,
+    0x0823,0x711A,0x6918,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x6918,0x711A,0x0823,
+    0x0823,0x711A,0x711A,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x711A,0x711A,0x0823,
+    0x0822,0x711A,0x793B,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x793B,0x711A,0x0822,
+    0x0000,0x40AF,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x40AF,0x0000,
+    0x0000,0x0000,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x2068,0x1845,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x1846,0x0000,0x1023,0x58D4,0x1024,0x0000,0x0000,0x308C,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x58F5,0x0823,0x0000,0x0802,0x50D2,0x306B,0x0000,0x1024,0x58F5,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x40AF,0x48B0,0x0001,0x0000,0x1024,0x58F5,0x1024,0x0000,0x40AF,0x48B0,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x58F5,0x1024,0x0000,0x1846,0x40AF,0x0001,0x0000,0x0823,0x58F5,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1845,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1845,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    
+    const unsigned short audio[576] = {
+    000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x2869,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x1825,0x1825,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x2869,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x2869,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x286A,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2869,0x0000,0x0000,
+    0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x895F,0x815E,0x895F,0x895F,0x895F,0x286A,0x286A,0x895F,0x895F,0x895F,0x815E,0x895F,0x895F,0x895F,0x895F,0x48B1,0x0000,0x0000,
+    0x0000,0x0000,0x48B1,0x895F,0x895F,0x711A,0x388C,0x2047,0x306B,0x6918,0x895F,0x286A,0x286A,0x895F,0x6918,0x306B,0x2047,0x388C,0x711A,0x895F,0x895F,0x48B1,0x0000,0x0000,
+    0x0000,0x0000,0x48B1,0x895F,0x793C,0x1846,0x1025,0x308C,0x1846,0x1024,0x7119,0x286A,0x286A,0x7119,0x1024,0x1846,0x308C,0x1025,0x1846,0x793C,0x895F,0x48B1,0x0000,0x0000,
+    0x0000,0x0000,0x48B1,0x915F,0x50D2,0x0823,0x50D3,0x388D,0x50D3,0x1025,0x40AE,0x286A,0x286A,0x40AE,0x1025,0x50D3,0x388D,0x50D3,0x0823,0x50D2,0x915F,0x48B1,0x0000,0x0000,
+    0x0000,0x0000,0x48B1,0x915F,0x40B0,0x1825,0x50D2,0x2048,0x48B1,0x2047,0x308C,0x286A,0x286A,0x308C,0x2047,0x48B1,0x2048,0x50D2,0x1825,0x40B0,0x915F,0x48B1,0x0000,0x0000,
+    0x0000,0x0000,0x48B1,0x915F,0x60F7,0x0802,0x388E,0x50D2,0x40AF,0x0802,0x50D3,0x286A,0x286A,0x50D3,0x0802,0x40AF,0x50D2,0x388E,0x0802,0x60F7,0x915F,0x48B1,0x0000,0x0000,
+    0x0000,0x0000,0x48B1,0x895F,0x895F,0x48B0,0x0823,0x0823,0x0822,0x388D,0x815E,0x286A,0x286A,0x815E,0x388D,0x0822,0x0823,0x0823,0x48B0,0x895F,0x895F,0x48B1,0x0000,0x0000,
+    0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x711A,0x60F6,0x6919,0x895F,0x895F,0x286A,0x286A,0x895F,0x895F,0x6919,0x60F6,0x711A,0x895F,0x895F,0x895F,0x48B1,0x0000,0x0000,
+    0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x711A,0x60F6,0x6919,0x895F,0x895F,0x286A,0x286A,0x895F,0x895F,0x6919,0x60F6,0x711A,0x895F,0x895F,0x895F,0x48B1,0x0000,0x0000,
+    0x0000,0x0000,0x48B1,0x895F,0x895F,0x48B0,0x0823,0x0823,0x0822,0x388D,0x815E,0x286A,0x286A,0x815E,0x388D,0x0822,0x0823,0x0823,0x48B0,0x895F,0x895F,0x48B1,0x0000,0x0000,
+    0x0000,0x0000,0x48B1,0x915F,0x60F7,0x0802,0x388E,0x50D2,0x40AF,0x0802,0x50D3,0x286A,0x286A,0x50D3,0x0802,0x40AF,0x50D2,0x388E,0x0802,0x60F7,0x915F,0x48B1,0x0000,0x0000,
+    0x0000,0x0000,0x48B1,0x915F,0x40B0,0x1825,0x50D2,0x2048,0x48B1,0x2047,0x308C,0x286A,0x286A,0x308C,0x2047,0x48B1,0x2048,0x50D2,0x1825,0x40B0,0x915F,0x48B1,0x0000,0x0000,
+    0x0000,0x0000,0x48B1,0x915F,0x50D2,0x0823,0x50D3,0x388D,0x50D3,0x1025,0x40AE,0x286A,0x286A,0x40AE,0x1025,0x50D3,0x388D,0x50D3,0x0823,0x50D2,0x915F,0x48B1,0x0000,0x0000,
+    0x0000,0x0000,0x48B1,0x895F,0x793C,0x1846,0x1025,0x308C,0x1846,0x1024,0x7119,0x286A,0x286A,0x7119,0x1024,0x1846,0x308C,0x1025,0x1846,0x793C,0x895F,0x48B1,0x0000,0x0000,
+    0x0000,0x0000,0x48B1,0x895F,0x895F,0x711A,0x388C,0x2047,0x306B,0x6918,0x895F,0x286A,0x286A,0x895F,0x6918,0x306B,0x2047,0x388C,0x711A,0x895F,0x895F,0x48B1,0x0000,0x0000,
+    0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x895F,0x815E,0x895F,0x895F,0x895F,0x286A,0x286A,0x895F,0x895F,0x895F,0x815E,0x895F,0x895F,0x895F,0x895F,0x48B1,0x0000,0x0000,
+    0x0000,0x0000,0x2869,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x286A,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2869,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x2869,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x1825,0x1825,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x2869,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    
+    
+    
+    const unsigned short tvs[576] = {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0001,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0001,0x0000,0x0000,
+    0x0000,0x0000,0x40AE,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x40AE,0x0000,0x0000,
+    0x0000,0x0000,0x50D3,0x915F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x915F,0x50D3,0x0000,0x0000,
+    0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,
+    0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x7119,0x388E,0x388D,0x48B0,0x813D,0x58D4,0x711B,0x895F,0x58D4,0x711A,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,
+    0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x711A,0x286A,0x0802,0x40AF,0x813D,0x306A,0x40AF,0x793C,0x1825,0x68F7,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,
+    0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x1846,0x813E,0x895F,0x50D3,0x2047,0x50D2,0x1847,0x813D,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,
+    0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x1846,0x813D,0x895F,0x793B,0x1845,0x1024,0x40AE,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,
+    0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x1846,0x813D,0x895F,0x895F,0x308B,0x0000,0x68F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,
+    0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x408E,0x815E,0x895F,0x895F,0x60F7,0x388C,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,
+    0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,
+    0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,
+    0x0000,0x0000,0x48B0,0x815E,0x813D,0x895F,0x895F,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x895F,0x895F,0x813D,0x815E,0x48B0,0x0000,0x0000,
+    0x0000,0x0000,0x0802,0x1845,0x2869,0x793B,0x40AF,0x1825,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1825,0x48B0,0x793B,0x2068,0x1845,0x0802,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x2047,0x58D4,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x58D4,0x1846,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    const unsigned short readnfc[576] = {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x2869,0x308B,0x306B,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x50D3,0x60F6,0x48B1,0x388C,0x286A,0x306B,0x388E,0x0822,0x0802,0x2048,0x388D,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0001,0x50D2,0x50D3,0x1025,0x0000,0x0000,0x0000,0x2047,0x40B0,0x58F5,0x60F6,0x58F4,0x40AE,0x2869,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0802,0x60F6,0x2048,0x0000,0x0000,0x0000,0x0000,0x0801,0x6918,0x1846,0x0001,0x0000,0x0000,0x0000,0x0000,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x58F5,0x1846,0x0000,0x0000,0x0001,0x0802,0x388E,0x0000,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x40AF,0x2047,0x0001,0x0000,0x0000,0x0000,
+    0x0000,0x2869,0x40AF,0x0000,0x0802,0x1825,0x50D2,0x1024,0x60F7,0x0000,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x50D2,0x40AF,0x60F7,0x1024,0x0000,0x0000,
+    0x0000,0x58F5,0x0802,0x2869,0x1023,0x60F6,0x2047,0x40AF,0x48B0,0x1846,0x50D2,0x1024,0x0000,0x306B,0x58F5,0x388E,0x0000,0x1825,0x48B1,0x0000,0x1846,0x48B0,0x0000,0x0000,
+    0x0000,0x60F6,0x0000,0x306B,0x308C,0x60F5,0x0802,0x58F5,0x306B,0x306A,0x388C,0x2869,0x0000,0x6918,0x0802,0x308B,0x60F5,0x0802,0x813D,0x1024,0x0001,0x58D4,0x0000,0x0000,
+    0x0000,0x60F6,0x0000,0x2869,0x388D,0x58F4,0x0802,0x60F6,0x286A,0x306B,0x1847,0x40AF,0x0000,0x286A,0x50D3,0x0000,0x2047,0x68F7,0x711A,0x1024,0x0000,0x60F6,0x0000,0x0000,
+    0x0000,0x58F5,0x0801,0x388D,0x1024,0x60F7,0x1825,0x48B1,0x40AE,0x2047,0x0001,0x60F7,0x2048,0x408E,0x711A,0x50D2,0x0000,0x1024,0x40B0,0x40AE,0x0000,0x60F6,0x0000,0x0000,
+    0x0000,0x286A,0x388E,0x0000,0x0823,0x286A,0x48B1,0x1846,0x60F6,0x0001,0x0000,0x2048,0x7119,0x286A,0x7119,0x50D3,0x1846,0x0000,0x0000,0x0000,0x0000,0x50D2,0x1024,0x0000,
+    0x0000,0x0000,0x60F6,0x1825,0x0000,0x0000,0x1845,0x0802,0x50D3,0x0000,0x0000,0x0000,0x60F6,0x711A,0x306B,0x48B1,0x40B0,0x0000,0x0000,0x0000,0x0000,0x1846,0x48B1,0x0000,
+    0x0000,0x0000,0x0822,0x60F7,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x58F5,0x40AF,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x68F7,0x0000,
+    0x0000,0x0000,0x0000,0x0801,0x50D3,0x50D2,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x388D,0x50D3,0x0000,0x0000,0x0000,0x408E,0x408E,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x58D4,0x60F6,0x40B0,0x306B,0x2068,0x286A,0x388D,0x50D2,0x60F7,0x40B0,0x0000,0x48B0,0x388E,0x286A,0x58F4,0x48B0,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x306B,0x388D,0x308C,0x2869,0x1024,0x0000,0x0000,0x0000,0x0822,0x388D,0x388C,0x1023,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+const unsigned short raw[576] = {
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1045,0x1025,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1846,0x793C,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1846,0x895F,0x793B,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1846,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1846,0x895F,0x895F,0x895F,0x7119,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1846,0x2048,0x2048,0x2048,0x2048,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x2048,0x2048,0x2048,0x2048,0x2048,0x2048,0x2048,0x2048,0x2048,0x2048,0x2048,0x2048,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x50D3,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x50D3,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x306B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x306B,0x0000,0x0000,
+0x0000,0x0000,0x40AF,0x895F,0x895F,0x58F5,0x58F5,0x60F7,0x895F,0x895F,0x895F,0x60F6,0x813D,0x7119,0x713B,0x793B,0x60F6,0x895F,0x58F5,0x895F,0x895F,0x40AF,0x0000,0x0000,
+0x0000,0x0000,0x40AF,0x895F,0x895F,0x0000,0x40AE,0x1846,0x50D2,0x895F,0x711A,0x0000,0x40AF,0x50D2,0x308C,0x388D,0x0000,0x6919,0x1024,0x895F,0x895F,0x40AF,0x0000,0x0000,
+0x0000,0x0000,0x40AF,0x895F,0x895F,0x0000,0x388C,0x1024,0x58F4,0x895F,0x388D,0x308C,0x0823,0x6919,0x1825,0x1025,0x1845,0x286A,0x308C,0x895F,0x895F,0x40AF,0x0000,0x0000,
+0x0000,0x0000,0x40AF,0x895F,0x895F,0x0000,0x50D2,0x0823,0x793D,0x895E,0x0802,0x0823,0x0000,0x58F5,0x0802,0x1024,0x48D2,0x0000,0x58D4,0x895F,0x895F,0x40AF,0x0000,0x0000,
+0x0000,0x0000,0x40AF,0x895F,0x895F,0x0000,0x895F,0x388D,0x306A,0x58F5,0x2048,0x813D,0x50D2,0x2869,0x2869,0x388D,0x711A,0x0000,0x793C,0x895F,0x895F,0x40AF,0x0000,0x0000,
+0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x286A,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x48B1,0x793C,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x793C,0x48B1,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+};
+
+
+    
+    
+    
+    const unsigned short control[576] = {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x1846,0x0822,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F7,0x60F7,0x0001,0x0000,0x0000,0x0000,0x0000,0x0822,0x1846,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x1024,0x793C,0x50D3,0x0000,0x0000,0x0000,0x0000,0x0802,0x711A,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x50D2,0x793C,0x1025,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0802,0x6918,0x815E,0x2047,0x0000,0x0000,0x0000,0x0802,0x711A,0x711A,0x0802,0x0000,0x0000,0x0000,0x1846,0x813D,0x6918,0x0802,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x306B,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0802,0x711A,0x711A,0x0802,0x0000,0x0000,0x0000,0x50D3,0x895F,0x306B,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0802,0x6918,0x815E,0x2047,0x0000,0x0000,0x0801,0x6918,0x6918,0x0801,0x0000,0x0000,0x1846,0x813D,0x6918,0x0802,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x813D,0x306B,0x0000,0x0000,0x0000,0x1825,0x1825,0x0000,0x0000,0x0000,0x286A,0x813D,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x0001,0x0000,0x0000,0x0001,0x0801,0x0801,0x0001,0x0000,0x0000,0x0000,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1847,0x408E,0x58F4,0x6918,0x711A,0x711A,0x6918,0x58F5,0x408E,0x1847,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0001,0x286A,0x60F6,0x815E,0x895F,0x815E,0x793C,0x713B,0x713B,0x793C,0x815E,0x895F,0x815E,0x60F6,0x286A,0x0001,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x1825,0x58F5,0x895F,0x895F,0x895F,0x895F,0x388D,0x0823,0x0802,0x0802,0x0823,0x388D,0x895F,0x895F,0x895F,0x895F,0x58F5,0x1825,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x2869,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x2869,0x0000,0x0000,0x0000,0x0000,0x2869,0x895F,0x895F,0x895F,0x895F,0x895F,0x793B,0x2869,0x0000,0x0000,
+    0x0000,0x286A,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x2869,0x0000,0x0000,0x0000,0x0000,0x2869,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x286A,0x0000,
+    0x0001,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x2069,0x0000,0x0000,0x0000,0x0000,0x2869,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x0001,
+    0x0000,0x306B,0x813D,0x895F,0x895F,0x895F,0x895F,0x713B,0x388E,0x0802,0x0000,0x0000,0x0000,0x0000,0x0802,0x408E,0x793B,0x895F,0x895F,0x895F,0x895F,0x813D,0x306B,0x0000,
+    0x0000,0x0000,0x308B,0x813D,0x895F,0x895F,0x60F7,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1845,0x68F7,0x895F,0x895F,0x813D,0x308B,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x308B,0x793C,0x58F5,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x58F5,0x793C,0x308B,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x1025,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x1025,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    
+    
+    
+    const unsigned short leitorir[576] = {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x286A,0x1847,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x793C,0x793C,0x6918,0x388C,0x0001,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x1025,0x2048,0x50D2,0x813D,0x58F5,0x0823,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x408E,0x58F5,0x308C,0x0000,0x0000,0x286A,0x50D3,0x308C,0x0823,0x2048,0x793B,0x58F5,0x0001,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x793C,0x60F6,0x813D,0x40AF,0x0000,0x306B,0x60F7,0x793C,0x6919,0x1846,0x2048,0x813D,0x388C,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x895F,0x6918,0x0823,0x388D,0x813D,0x40AF,0x0000,0x0000,0x1845,0x60F7,0x6919,0x0823,0x50D2,0x6918,0x0802,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x793C,0x58F5,0x793B,0x58D4,0x0822,0x388D,0x813D,0x40AF,0x0000,0x0000,0x1845,0x793C,0x308C,0x2048,0x793C,0x1847,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x793B,0x50D3,0x0001,0x2048,0x793C,0x58F4,0x0822,0x388D,0x813D,0x40AF,0x0000,0x0000,0x60F7,0x50D3,0x1025,0x793C,0x286A,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x7119,0x60F7,0x0822,0x0000,0x0000,0x2068,0x793C,0x58F4,0x0822,0x388D,0x813D,0x40AF,0x0000,0x306B,0x286A,0x0001,0x40AF,0x1825,
+    0x0000,0x0000,0x0000,0x0000,0x0802,0x60F6,0x711A,0x1024,0x0000,0x0000,0x0000,0x0000,0x2048,0x793C,0x58F4,0x0822,0x388D,0x813D,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0001,0x50D3,0x793C,0x2047,0x0000,0x0802,0x0822,0x0822,0x0822,0x0001,0x2048,0x793C,0x58F4,0x0822,0x388D,0x813D,0x40AF,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x40AF,0x813D,0x286A,0x0000,0x1023,0x68F7,0x711A,0x711A,0x713B,0x58D4,0x0001,0x2048,0x793C,0x58F4,0x0822,0x388D,0x813D,0x308C,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x308B,0x813D,0x388E,0x0000,0x0822,0x0802,0x50D2,0x895F,0x60F6,0x58F5,0x713B,0x0822,0x0000,0x2068,0x793C,0x58D4,0x0823,0x60F6,0x58F5,0x0000,0x0000,0x0000,
+    0x0000,0x2048,0x793C,0x48B1,0x0000,0x0802,0x68F7,0x40B0,0x0802,0x50D2,0x793B,0x60F6,0x711A,0x0822,0x0000,0x0000,0x2048,0x793B,0x6918,0x793C,0x408E,0x0000,0x0000,0x0000,
+    0x1024,0x7119,0x58F5,0x0801,0x0000,0x1023,0x793C,0x895F,0x40B0,0x0802,0x50D2,0x895F,0x711A,0x0822,0x0000,0x0000,0x0001,0x58F5,0x895F,0x48B0,0x0001,0x0000,0x0000,0x0000,
+    0x286A,0x813D,0x2047,0x0000,0x0000,0x1023,0x793B,0x60F7,0x793C,0x40B0,0x0802,0x50D2,0x68F7,0x0802,0x0000,0x0822,0x50D3,0x793C,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x1025,0x711A,0x58F5,0x0802,0x0000,0x1023,0x793C,0x50D3,0x60F7,0x895F,0x40B0,0x0802,0x1023,0x0000,0x1024,0x60F7,0x793B,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x2048,0x793C,0x58F5,0x0802,0x0802,0x60F7,0x793C,0x793B,0x793C,0x68F7,0x0822,0x0000,0x2047,0x711A,0x7119,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x2048,0x793C,0x58F5,0x0802,0x0802,0x1023,0x1023,0x1023,0x0802,0x0000,0x286A,0x793C,0x60F6,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x2048,0x793C,0x58F5,0x0802,0x0000,0x0000,0x0000,0x0000,0x388E,0x813D,0x50D3,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x2048,0x793C,0x58F5,0x0802,0x0000,0x0801,0x48B1,0x813D,0x40AF,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x793C,0x58F5,0x2047,0x58F5,0x793C,0x308B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x711A,0x813D,0x7119,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x286A,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    
+    
+    
+    
+    const unsigned short saver[144] = {
+    0x0000,0x0801,0x40AF,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x408E,0x0001,0x0000,
+    0x0000,0x1847,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,
+    0x0000,0x2048,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x1847,0x0000,
+    0x0000,0x2048,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x1847,0x0000,
+    0x0000,0x2048,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x1847,0x0000,
+    0x0000,0x2048,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x1847,0x0000,
+    0x0000,0x2048,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x1847,0x0000,
+    0x0000,0x2048,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x1847,0x0000,
+    0x0000,0x2048,0x815E,0x895F,0x895F,0x813D,0x813D,0x895F,0x895F,0x815E,0x1847,0x0000,
+    0x0000,0x2048,0x815E,0x895F,0x793B,0x2048,0x2068,0x793C,0x895F,0x815E,0x1847,0x0000,
+    0x0000,0x2047,0x895F,0x793B,0x2048,0x0000,0x0000,0x2048,0x793B,0x815E,0x1846,0x0000,
+    0x0000,0x0823,0x50D3,0x2068,0x0000,0x0000,0x0000,0x0000,0x2869,0x50D2,0x0822,0x0000
+    };
+    
+    const unsigned short ler_radio[144] = {
+    0x68F7,0x60F7,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x68F7,0x60F7,
+    0x68F7,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x60F7,
+    0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,
+    0x0000,0x0000,0x2047,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x60F6,0x58D4,0x0000,0x0000,0x0001,0x40AF,0x1023,0x0000,0x0000,0x0000,
+    0x286A,0x48B0,0x58D4,0x58F5,0x1825,0x286A,0x306A,0x793C,0x308B,0x1024,0x388D,0x286A,
+    0x286A,0x388D,0x1024,0x408E,0x50D2,0x793B,0x711A,0x48B1,0x50D3,0x50D3,0x48B1,0x286A,
+    0x0000,0x0000,0x0000,0x1846,0x793C,0x50D2,0x58D3,0x0823,0x60F6,0x60F7,0x0001,0x0000,
+    0x0000,0x0000,0x0000,0x0001,0x40AF,0x1024,0x0001,0x0000,0x286A,0x306B,0x0000,0x0000,
+    0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,
+    0x68F7,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x60F7,
+    0x68F7,0x60F7,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x68F7,0x60F7
+    };
+    
+    
+    const unsigned short raw1[144] = {
+    0x58F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,
+    0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,
+    0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,
+    0x895F,0x711A,0x7119,0x895F,0x895F,0x793B,0x895F,0x793C,0x813D,0x793C,0x793C,0x815E,
+    0x815E,0x308C,0x2048,0x6918,0x711A,0x2047,0x711A,0x40AF,0x388D,0x308C,0x388D,0x793D,
+    0x815E,0x286A,0x1846,0x711A,0x48B1,0x1023,0x50D2,0x40B0,0x0823,0x0823,0x308C,0x895E,
+    0x815E,0x308C,0x2869,0x6918,0x306B,0x306B,0x308B,0x50D2,0x2869,0x306B,0x40B0,0x895F,
+    0x895F,0x793B,0x711A,0x793B,0x711A,0x895F,0x711A,0x793C,0x713B,0x793B,0x793C,0x895F,
+    0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,
+    0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,
+    0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,
+    0x58F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4
+    };
+    
+    const unsigned short add[144] = {
+    0x0000,0x0000,0x0000,0x0000,0x1845,0x7119,0x6918,0x1025,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x408E,0x895F,0x895F,0x388D,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x408E,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x388E,0x0000,0x0000,0x0000,0x0000,
+    0x1825,0x388E,0x40AF,0x40AE,0x60F7,0x895F,0x895F,0x60F6,0x40AE,0x40AF,0x388D,0x1025,
+    0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,
+    0x6919,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,
+    0x1825,0x388E,0x40AF,0x40AE,0x60F7,0x895F,0x895F,0x60F6,0x40AE,0x40AF,0x388D,0x1025,
+    0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x388E,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x408E,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x408E,0x895F,0x895F,0x388D,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x1845,0x7119,0x6918,0x1025,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    const unsigned short ana[144] = {
+    0x0000,0x0823,0x48D1,0x793C,0x815E,0x711A,0x388D,0x0001,0x0000,0x0000,0x0000,0x0000,
+    0x0823,0x60F6,0x793B,0x48B1,0x388D,0x58D4,0x813D,0x40AF,0x0000,0x0000,0x0000,0x0000,
+    0x48B1,0x793B,0x388E,0x1023,0x0802,0x1024,0x40AE,0x813D,0x2047,0x0000,0x0000,0x0000,
+    0x793B,0x48B1,0x40AF,0x50D3,0x306B,0x60F7,0x50D2,0x813D,0x40B0,0x0000,0x0000,0x0000,
+    0x813D,0x40AF,0x40AF,0x58D4,0x58D4,0x40B0,0x1024,0x60F7,0x50D2,0x0000,0x0000,0x0000,
+    0x6919,0x793B,0x40B0,0x1024,0x58D4,0x48B0,0x0823,0x793B,0x388E,0x0000,0x0000,0x0000,
+    0x308C,0x813D,0x408E,0x0001,0x1846,0x40AF,0x58D4,0x793C,0x1846,0x0000,0x0000,0x0000,
+    0x0000,0x40AF,0x813D,0x7119,0x60F7,0x793B,0x793C,0x793C,0x68F7,0x1847,0x0000,0x0000,
+    0x0000,0x0000,0x2047,0x48B0,0x50D3,0x388E,0x1825,0x60F6,0x917F,0x711A,0x1846,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x711A,0x915F,0x7119,0x1846,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x711A,0x895F,0x6918,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x711A,0x388D
+    };
+    
+    const unsigned short dector[144] = {
+    0x0000,0x50D3,0x60F6,0x793C,0x6919,0x7119,0x6918,0x711A,0x793B,0x60F7,0x48B1,0x0000,
+    0x0000,0x60F5,0x60F7,0x6918,0x60F5,0x60F6,0x58F5,0x60F6,0x68F7,0x6918,0x50D3,0x0000,
+    0x0000,0x60F6,0x50D2,0x0801,0x0823,0x2048,0x2047,0x0822,0x0802,0x58F4,0x50D3,0x0000,
+    0x0000,0x60F6,0x50D2,0x0000,0x1024,0x308C,0x306B,0x0823,0x0000,0x58D4,0x50D3,0x0000,
+    0x0000,0x60F6,0x48D2,0x0001,0x2869,0x388E,0x388E,0x2069,0x0001,0x58D4,0x50D3,0x0000,
+    0x0000,0x60F6,0x48D1,0x1846,0x388E,0x308C,0x308C,0x408E,0x1825,0x58D4,0x50D3,0x0000,
+    0x0000,0x60F6,0x50D2,0x0000,0x1023,0x2047,0x2047,0x0823,0x0000,0x58D4,0x50D3,0x0000,
+    0x0000,0x60F6,0x50D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x50D3,0x0000,
+    0x0000,0x60F6,0x50D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x50D3,0x0000,
+    0x0000,0x60F6,0x50D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x50D3,0x0000,
+    0x0000,0x60F6,0x50D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x50D3,0x0000,
+    0x0000,0x58D4,0x48B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D3,0x50D2,0x0000
+    };
+    
+    const unsigned short bad[576] = {
+    0x0000,0x0000,0x1024,0x286A,0x40B0,0x58D4,0x60F7,0x6918,0x68F7,0x58F5,0x48B1,0x306B,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x2068,0x50D3,0x793B,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x60F6,0x306A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x68F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x915F,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x6918,0x793B,0x6919,0x815E,0x815E,0x815E,0x895F,0x895F,0x895F,0x895F,0x815E,0x815E,0x713B,0x7119,0x711A,0x0802,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x6918,0x793D,0x2869,0x1846,0x1846,0x2869,0x793C,0x895F,0x815E,0x388D,0x1846,0x1846,0x2047,0x6919,0x711B,0x0802,0x408E,0x6918,0x60F5,0x48D2,0x308C,0x1846,0x0001,0x0000,
+    0x6918,0x895F,0x7119,0x388E,0x308B,0x408E,0x813D,0x895F,0x895F,0x48B1,0x306B,0x388D,0x60F7,0x895F,0x711A,0x0802,0x50D3,0x915F,0x895F,0x895F,0x895F,0x813D,0x60F7,0x306B,
+    0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0802,0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,
+    0x58F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x0801,0x58F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,
+    0x48B1,0x895F,0x895F,0x815E,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x813D,0x895F,0x895F,0x58F5,0x0801,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,
+    0x306B,0x895F,0x895F,0x813D,0x408E,0x50D3,0x713B,0x813D,0x793C,0x60F5,0x388D,0x711A,0x895F,0x895F,0x40AF,0x0823,0x793B,0x895F,0x813D,0x793C,0x793C,0x60F6,0x793B,0x6918,
+    0x1024,0x713B,0x895F,0x895F,0x6919,0x2048,0x1024,0x1025,0x1024,0x1846,0x58F5,0x895F,0x895F,0x815E,0x2047,0x2869,0x895F,0x793B,0x1847,0x1023,0x1023,0x286A,0x813D,0x6918,
+    0x0000,0x40B0,0x895F,0x895F,0x895F,0x813D,0x60F6,0x50D2,0x58F5,0x793C,0x895F,0x895F,0x895F,0x60F5,0x0001,0x50D3,0x895F,0x813D,0x50D2,0x40AF,0x50D2,0x793C,0x895F,0x68F7,
+    0x0000,0x0822,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793B,0x1845,0x2047,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,
+    0x0000,0x0000,0x1024,0x60F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x1847,0x0823,0x6918,0x915F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,
+    0x0000,0x0000,0x0000,0x0801,0x388D,0x711A,0x895F,0x895F,0x895F,0x793C,0x48B0,0x0823,0x1024,0x60F6,0x711A,0x50D2,0x40AF,0x58D4,0x793C,0x895F,0x895F,0x895F,0x895F,0x48B0,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x388D,0x60F6,0x40B0,0x1025,0x0802,0x308C,0x711A,0x50D3,0x1825,0x1825,0x1846,0x1025,0x2047,0x68F7,0x895F,0x895F,0x815E,0x286A,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x60F6,0x895F,0x711A,0x40AF,0x6918,0x813D,0x815E,0x793C,0x58F5,0x40AF,0x813D,0x895F,0x7119,0x0823,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x813E,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x815E,0x895F,0x388D,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x6919,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0801,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x50D2,0x0802,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0801,0x388D,0x7119,0x895F,0x895F,0x815E,0x60F7,0x2869,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x388E,0x58F5,0x306B,0x0801,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    
+    
+    
+    
+    
+    
+    
+    
+    const unsigned short h[144] = {
+      0x895F, 0x91BF, 0xA2BF, 0x899F, 0x893F, 0x895F, 0x895F, 0x893F, 0x899F, 0xA2BF, 0x91BF, 0x895F,
+      0x893F, 0xAB1F, 0xF73F, 0xD59F, 0xA2DF, 0x897F, 0x897F, 0xA2DF, 0xD59F, 0xF73F, 0xAB1F, 0x893F,
+      0x893F, 0xAB5F, 0xFFFF, 0xFFFF, 0xF79F, 0xD57F, 0xD57F, 0xF79F, 0xFFFF, 0xFFFF, 0xAB3F, 0x893F,
+      0x895F, 0x9A1F, 0xDDDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xDDDF, 0x9A1F, 0x895F,
+      0x895F, 0x91DF, 0xCD3F, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xCD1F, 0x91DF, 0x895F,
+      0x893F, 0xAB3F, 0xFFDF, 0xFFFF, 0xFFFF, 0xE63F, 0xE63F, 0xFFFF, 0xFFFF, 0xFFDF, 0xAB3F, 0x893F,
+      0x893F, 0xAB3F, 0xFFDF, 0xFFFF, 0xFFFF, 0xE65F, 0xE65F, 0xFFFF, 0xFFFF, 0xFFDF, 0xAB1F, 0x893F,
+      0x895F, 0x91BF, 0xCCDF, 0xFFBF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBF, 0xCCDF, 0x91BF, 0x895F,
+      0x895F, 0x9A3F, 0xDDFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xDDFF, 0x9A3F, 0x895F,
+      0x893F, 0xAB5F, 0xFFFF, 0xFFFF, 0xF75F, 0xCD3F, 0xCD3F, 0xF77F, 0xFFFF, 0xFFFF, 0xAB3F, 0x893F,
+      0x893F, 0xAAFF, 0xF71F, 0xD55F, 0xA2BF, 0x895F, 0x895F, 0xA2BF, 0xD55F, 0xF71F, 0xAAFF, 0x893F,
+      0x895F, 0x91BF, 0x9A7F, 0x897F, 0x893F, 0x895F, 0x895F, 0x893F, 0x897F, 0x9A7F, 0x919F, 0x895F
+    };
+    
+    const unsigned short apple[576] = {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0801,0x308C,0x50D3,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x60F5,0x895F,0x813D,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D3,0x895F,0x895F,0x60F6,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x813D,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x815E,0x7119,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x286A,0x50D2,0x50D3,0x388D,0x1825,0x1024,0x2869,0x1024,0x2047,0x40B0,0x58D4,0x48B1,0x2869,0x0001,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x1846,0x60F7,0x895F,0x895F,0x895F,0x895F,0x793D,0x60F6,0x50D2,0x6918,0x815E,0x895F,0x895F,0x895F,0x815E,0x58D4,0x0823,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x1024,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x306B,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x408E,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x1023,0x793B,0x895F,0x895F,0x50D2,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x6918,0x915F,0x60F6,0x0001,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x2048,0x815E,0x895F,0x895F,0x2869,0x2047,0x58D4,0x60F7,0x813D,0x895F,0x793C,0x58F5,0x48B1,0x0822,0x50D3,0x895F,0x388C,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x388E,0x0000,0x0000,0x1024,0x6918,0x895F,0x48B1,0x0001,0x0000,0x0001,0x60F7,0x895F,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x286A,0x895F,0x815E,0x68F7,0x793B,0x40AF,0x388E,0x6918,0x813D,0x793B,0x815E,0x50D3,0x388D,0x58D4,0x713B,0x6918,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x2048,0x895E,0x895F,0x388D,0x58F5,0x895F,0x895F,0x895F,0x793B,0x60F6,0x895F,0x895F,0x895F,0x813D,0x306B,0x60F6,0x50D3,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x1024,0x793C,0x895F,0x48D1,0x0822,0x60F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2869,0x1023,0x793B,0x813D,0x2048,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0001,0x60F7,0x895F,0x793B,0x1024,0x286A,0x58F5,0x306B,0x48B0,0x50D2,0x408E,0x388D,0x58F5,0x0001,0x388D,0x895F,0x895F,0x713B,0x286A,0x0001,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x388E,0x895F,0x895F,0x58F5,0x1024,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x2047,0x793B,0x895F,0x895F,0x895F,0x793C,0x1024,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x1024,0x713B,0x895F,0x895F,0x60F7,0x2069,0x0802,0x0000,0x0000,0x0000,0x0822,0x306B,0x713B,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x388D,0x895F,0x895F,0x895F,0x815E,0x7119,0x58F5,0x58D4,0x58F5,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x1846,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0001,0x58F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x915F,0x915F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x388D,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x60F7,0x895F,0x895F,0x895F,0x895F,0x793B,0x7119,0x793C,0x895F,0x895F,0x895F,0x895F,0x48B0,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x48B1,0x68F7,0x58D4,0x306B,0x1023,0x0801,0x1825,0x388E,0x60F5,0x60F7,0x308C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    
+    
+    
+    
+    const unsigned short androi[576]= {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x1825,0x1024,0x2048,0x2048,0x1024,0x1845,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x6919,0x793C,0x895E,0x815E,0x793C,0x6918,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308B,0x793C,0x815E,0x895F,0x895F,0x895F,0x895F,0x815E,0x793C,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x793C,0x793B,0x48B1,0x895F,0x895F,0x895F,0x895F,0x48B1,0x793C,0x793C,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x895F,0x895F,0x813E,0x895F,0x895F,0x895F,0x895F,0x813D,0x895F,0x895F,0x48B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x286A,0x50D3,0x2047,0x40AF,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x408E,0x2048,0x50D3,0x2869,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0801,0x6919,0x917F,0x58F5,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x60F6,0x917F,0x6918,0x0001,0x0000,0x0000,
+    0x0000,0x0000,0x0802,0x711A,0x915F,0x60F6,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x60F7,0x915F,0x6919,0x0001,0x0000,0x0000,
+    0x0000,0x0000,0x0802,0x711A,0x915F,0x60F6,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x60F7,0x915F,0x6919,0x0001,0x0000,0x0000,
+    0x0000,0x0000,0x0802,0x711A,0x915F,0x60F6,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x60F7,0x915F,0x6919,0x0001,0x0000,0x0000,
+    0x0000,0x0000,0x0802,0x711A,0x915F,0x60F6,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x60F7,0x915F,0x6919,0x0001,0x0000,0x0000,
+    0x0000,0x0000,0x0802,0x711A,0x915F,0x60F6,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x60F7,0x915F,0x6919,0x0001,0x0000,0x0000,
+    0x0000,0x0000,0x0001,0x60F5,0x895F,0x48D2,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x50D2,0x895F,0x58D4,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x1024,0x2869,0x1023,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x1023,0x2869,0x1023,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x286A,0x58F5,0x895F,0x815E,0x40AF,0x40AF,0x815E,0x895F,0x58D4,0x286A,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x813D,0x1025,0x1846,0x815E,0x895F,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x813D,0x1825,0x1846,0x815E,0x895F,0x388E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388C,0x895F,0x793C,0x1024,0x1025,0x793C,0x895F,0x308B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x388D,0x2869,0x0000,0x0000,0x286A,0x388C,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    
+    
+    
+    
+    
+    const unsigned short nfc1[144] = {
+    0x0000,0x0000,0x0000,0x0000,0x0001,0x0823,0x0823,0x0001,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x286A,0x60F6,0x713B,0x713B,0x60F6,0x286A,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x48B0,0x895E,0x895F,0x895F,0x895F,0x915F,0x895E,0x48B0,0x0000,0x0000,
+    0x0000,0x286A,0x895E,0x895F,0x895F,0x895F,0x793C,0x6918,0x895F,0x895E,0x286A,0x0000,
+    0x0001,0x60F6,0x895F,0x815E,0x813D,0x50D2,0x60F7,0x388C,0x815E,0x895F,0x60F6,0x0001,
+    0x0823,0x711A,0x895F,0x60F6,0x50D3,0x40AF,0x60F6,0x388D,0x793C,0x895F,0x711A,0x0823,
+    0x0823,0x711A,0x895F,0x60F6,0x50D3,0x40AF,0x58F5,0x388D,0x793C,0x895F,0x711A,0x0823,
+    0x0000,0x60F5,0x895F,0x815E,0x813D,0x50D2,0x60F7,0x388D,0x815E,0x895F,0x60F5,0x0000,
+    0x0000,0x286A,0x815E,0x895F,0x895F,0x895F,0x793C,0x6918,0x895F,0x815E,0x286A,0x0000,
+    0x0000,0x0000,0x40AF,0x815E,0x895F,0x895F,0x895F,0x915F,0x815E,0x40AF,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x2869,0x58F5,0x711A,0x711A,0x58F5,0x2869,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+    
+    
+    const unsigned short save[144] = {
+    0x306B,0x58D4,0x2869,0x286A,0x58D4,0x58D4,0x50D3,0x1825,0x40AF,0x306B,0x0000,0x0000,
+    0x58D4,0x915F,0x408E,0x48B0,0x895F,0x895F,0x815E,0x2068,0x6918,0x793C,0x1846,0x0000,
+    0x58D4,0x895F,0x388E,0x48B0,0x895F,0x895F,0x815E,0x2068,0x68F7,0x915F,0x60F7,0x0823,
+    0x58D4,0x895F,0x388E,0x40AF,0x815E,0x813D,0x793C,0x2048,0x68F7,0x895F,0x895F,0x48B0,
+    0x58D4,0x895F,0x48B0,0x1024,0x2048,0x2048,0x2047,0x1024,0x6919,0x895F,0x895F,0x58D4,
+    0x58D4,0x895F,0x813D,0x6919,0x6919,0x6919,0x6919,0x711A,0x895E,0x895F,0x895F,0x58D4,
+    0x58D4,0x895F,0x895F,0x915F,0x915F,0x915F,0x915F,0x895F,0x895F,0x895F,0x895F,0x58D4,
+    0x58D4,0x895F,0x6918,0x40AF,0x40AF,0x40AF,0x40AF,0x40AF,0x40AF,0x6918,0x895F,0x58D4,
+    0x58D4,0x895F,0x408E,0x2047,0x40B0,0x40B0,0x40B0,0x40B0,0x2047,0x408E,0x895F,0x58D4,
+    0x58D4,0x895F,0x408E,0x2048,0x48B0,0x40B0,0x40B0,0x48B0,0x2048,0x408E,0x895F,0x58D4,
+    0x58D4,0x915F,0x408E,0x2047,0x40AF,0x40AF,0x40AF,0x40AF,0x2047,0x408E,0x915F,0x58D4,
+    0x286A,0x50D3,0x2048,0x2869,0x50D3,0x50D3,0x50D3,0x50D3,0x2869,0x2048,0x50D3,0x286A
+    };
+    
+    
+    const unsigned short savewifi[576]= {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x2047,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0801,0x2047,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x815E,0x308C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388C,0x815E,0x48B1,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x917F,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x915F,0x60F5,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x915F,0x60F5,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x915F,0x60F5,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x915F,0x60F5,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x915F,0x60F5,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x915F,0x60F5,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x915F,0x60F5,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x915F,0x60F5,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x915F,0x60F5,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x915F,0x60F5,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0001,0x60F6,0x915F,0x48B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x915F,0x60F6,0x0001,0x0000,0x0000,0x0000,0x0000,
+    0x0823,0x50D2,0x60F7,0x60F7,0x60F7,0x813D,0x895F,0x793B,0x60F7,0x60F7,0x60F7,0x60F7,0x60F7,0x60F7,0x60F7,0x60F7,0x793B,0x895F,0x813D,0x60F7,0x60F7,0x60F7,0x50D2,0x0822,
+    0x2869,0x895E,0x895F,0x915F,0x915F,0x895F,0x895F,0x895F,0x915F,0x915F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2048,
+    0x2869,0x815E,0x815E,0x50D2,0x40AF,0x793C,0x895F,0x6919,0x40AF,0x58F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2869,
+    0x2869,0x895E,0x793C,0x0823,0x0000,0x60F6,0x915F,0x40AF,0x0000,0x2068,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2069,
+    0x2869,0x815E,0x815E,0x388E,0x306A,0x711A,0x895F,0x60F6,0x2869,0x48B1,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2069,
+    0x2869,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2068,
+    0x1024,0x60F7,0x793C,0x895F,0x895F,0x793D,0x713B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x713B,0x813D,0x895F,0x895F,0x793C,0x60F6,0x1024,
+    0x0000,0x0801,0x48B0,0x895F,0x895F,0x60F6,0x1024,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x1024,0x60F7,0x895F,0x895F,0x388D,0x0001,0x0000,
+    0x0000,0x1023,0x711A,0x815E,0x815E,0x813D,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x813D,0x815E,0x895E,0x60F6,0x0001,0x0000,
+    0x0000,0x0001,0x2047,0x2869,0x2869,0x2048,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x2068,0x2069,0x2869,0x1846,0x0000,0x0000
+    };
+    
+    
+    
+    
+    
+    
+    const unsigned short ble_ative[144] = {
+    0x895F,0x895F,0x895F,0x895F,0x895F,0x9A5F,0x91FF,0x893F,0x895F,0x895F,0x895F,0x895F,
+    0x895F,0x895F,0x895F,0x893F,0x897F,0xDDBF,0xE69F,0xAB3F,0x895F,0x895F,0x895F,0x895F,
+    0x895F,0x895F,0x91DF,0xA2BF,0x919F,0xE63F,0xF75F,0xF71F,0xCCDF,0x91DF,0x895F,0x895F,
+    0x895F,0x893F,0xA2DF,0xEF1F,0xBC3F,0xE65F,0xCCDF,0xD57F,0xFF9F,0xA2BF,0x893F,0x895F,
+    0x895F,0x895F,0x897F,0xBC3F,0xF75F,0xFF9F,0xEEBF,0xF71F,0xBC3F,0x897F,0x895F,0x895F,
+    0x895F,0x895F,0x895F,0x895F,0xBC3F,0xFFDF,0xFFDF,0xBC3F,0x895F,0x895F,0x895F,0x895F,
+    0x895F,0x895F,0x895F,0x895F,0xBC3F,0xFFDF,0xFFDF,0xBC3F,0x895F,0x895F,0x895F,0x895F,
+    0x895F,0x895F,0x897F,0xBC3F,0xF75F,0xFF9F,0xEEBF,0xF71F,0xBC3F,0x897F,0x895F,0x895F,
+    0x895F,0x893F,0xA2DF,0xEF1F,0xBC3F,0xE65F,0xCCDF,0xD57F,0xFF9F,0xA2BF,0x893F,0x895F,
+    0x895F,0x895F,0x91DF,0xA2BF,0x919F,0xE63F,0xF75F,0xF71F,0xCCDF,0x91DF,0x895F,0x895F,
+    0x895F,0x895F,0x895F,0x893F,0x897F,0xDDBF,0xE69F,0xAB3F,0x895F,0x895F,0x895F,0x895F,
+    0x895F,0x895F,0x895F,0x895F,0x895F,0x9A5F,0x91FF,0x893F,0x895F,0x895F,0x895F,0x895F
+    };
+    
+    
+    const unsigned short sd_ative[144] = {
+    0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,
+    0x895F,0x895F,0x895F,0x895F,0xB0F5,0xC0AF,0xC0AF,0xC0AF,0xC0B0,0xA119,0x895F,0x895F,
+    0x895F,0x895F,0x895F,0xC0B0,0xF801,0xF023,0xF023,0xF022,0xF801,0xD86A,0x895F,0x895F,
+    0x895F,0x895F,0xB8D2,0xF800,0xF022,0xB8D2,0xC0B1,0xC0B0,0xD08C,0xE048,0x895F,0x895F,
+    0x895F,0x895F,0xD869,0xF800,0xF801,0xD06B,0xD06B,0xD86A,0xE047,0xD868,0x895F,0x895F,
+    0x895F,0x895F,0xD869,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xD869,0x895F,0x895F,
+    0x895F,0x895F,0xD869,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xD869,0x895F,0x895F,
+    0x895F,0x895F,0xD869,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xD869,0x895F,0x895F,
+    0x895F,0x895F,0xD869,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xD869,0x895F,0x895F,
+    0x895F,0x895F,0xD86A,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xD86A,0x895F,0x895F,
+    0x895F,0x895F,0xA119,0xC0B0,0xC0B0,0xC0B0,0xC0B0,0xC0B0,0xC0B0,0xA119,0x895F,0x895F,
+    0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F
+    };
+    
+    
+    const unsigned short insta[144] = {
+    0x0000,0x0000,0x0823,0x2048,0x286A,0x286A,0x286A,0x286A,0x2048,0x0802,0x0000,0x0000,
+    0x0000,0x2869,0x60F6,0x60F5,0x58D4,0x58D4,0x58D4,0x58D4,0x58F5,0x60F6,0x1847,0x0000,
+    0x0823,0x60F7,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x306A,0x48B0,0x58F5,0x0001,
+    0x2048,0x60F6,0x0001,0x0000,0x2869,0x50D3,0x50D3,0x2869,0x48B1,0x2869,0x60F7,0x1825,
+    0x286A,0x58F5,0x0000,0x286A,0x60F7,0x306B,0x308C,0x68F7,0x2047,0x0001,0x60F5,0x2047,
+    0x286A,0x58D4,0x0000,0x50D3,0x306B,0x0000,0x0000,0x40AF,0x48B1,0x0000,0x58F5,0x2047,
+    0x286A,0x58D4,0x0000,0x50D3,0x388C,0x0000,0x0000,0x40AF,0x48B0,0x0000,0x58F5,0x2047,
+    0x286A,0x58F5,0x0000,0x2048,0x68F7,0x388E,0x40AF,0x60F7,0x1846,0x0001,0x60F6,0x1847,
+    0x2048,0x60F6,0x0001,0x0000,0x2047,0x48B1,0x48B0,0x1846,0x0000,0x0822,0x60F7,0x1025,
+    0x0822,0x60F6,0x308C,0x0802,0x0001,0x0001,0x0001,0x0001,0x0822,0x40AF,0x58D4,0x0001,
+    0x0000,0x2047,0x60F5,0x60F7,0x60F6,0x60F6,0x60F6,0x60F6,0x60F7,0x58D4,0x1825,0x0000,
+    0x0000,0x0000,0x0001,0x1825,0x2047,0x2047,0x2047,0x2047,0x1025,0x0001,0x0000,0x0000
+    };
+    
+    const unsigned short teste[16384] = {
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x1846,0x306B,0x408E,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x388D,0x2048,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0822,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x60F6,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x711A,0x40AF,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1847,0x48B0,0x60F7,0x711A,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x713A,0x6918,0x50D2,0x2869,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x50D2,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x50D2,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x60F6,0x1847,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x58F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x2068,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1845,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x48B0,0x40B0,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0802,0x0000,0x0000,0x0802,0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x308C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x388C,0x308C,0x58D4,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AE,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x1025,0x0000,0x0000,0x0000,0x0000,0x1024,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x40AF,0x0001,0x0000,0x0000,0x0000,0x388D,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793B,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x308C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0801,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x2068,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1847,0x6919,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0801,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0801,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0801,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B1,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x40AF,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0801,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x388E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0801,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2069,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AE,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793B,0x7119,0x793C,0x895F,0x895F,0x895F,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F5,0x895F,0x895F,0x895F,0x793B,0x60F5,0x60F6,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AE,0x60F7,0x0801,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F5,0x48B1,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x40AE,0x1023,0x0802,0x1825,0x58D4,0x895F,0x895F,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x58F5,0x1025,0x0000,0x0000,0x1846,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0802,0x48D2,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x58D4,0x0823,0x0000,0x0000,0x0000,0x0000,0x388C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B1,0x0000,0x0000,0x0000,0x0000,0x0001,0x40AF,0x815E,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x48D2,0x0802,0x0000,0x0000,0x0000,0x0000,0x2048,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x388D,0x0823,0x0801,0x1846,0x58F5,0x895F,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x60F7,0x2047,0x0802,0x0822,0x306B,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x60F7,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x40AF,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x7119,0x813D,0x895F,0x895F,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x813D,0x7119,0x711A,0x895E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x388C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x48B0,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x48B0,0x895E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x68F7,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793D,0x308C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1847,0x6919,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x48B0,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x0802,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x1023,0x0000,0x0000,0x0000,0x308C,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x1024,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x6919,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x40B0,0x388E,0x58F5,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2068,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x1024,0x0000,0x0000,0x0823,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x50D2,0x48B1,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x0801,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813E,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B1,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x40B0,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793D,0x40AF,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x50D3,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x40AF,0x7119,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x713B,0x50D2,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x40AF,0x58F5,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x60F6,0x48D2,0x286A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x1846,0x286A,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x286A,0x2047,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0823,0x1023,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x1023,0x0822,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x2869,0x50D2,0x6918,0x711A,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x711A,0x68F7,0x48B1,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x60F5,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x50D3,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2069,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1847,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0801,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1847,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x58D4,0x388D,0x2869,0x2048,0x2869,0x388E,0x58F5,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813E,0x48B1,0x1025,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x58D4,0x895E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AE,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AE,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793B,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1845,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x1025,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2068,0x895E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x50D2,0x2048,0x0823,0x0001,0x0000,0x0001,0x1023,0x2869,0x58D4,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x713B,0x6918,0x60F6,0x6918,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x408E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x895E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x2069,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x388C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x388D,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x50D2,0x711A,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813E,0x7119,0x40B0,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x2047,0x286A,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x2869,0x1846,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+    };
+
+const uint16_t UART[576]= {
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x40AF,0x58D4,0x50D3,0x388D,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0802,0x48B0,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x58F5,0x48B1,0x1825,0x0000,0x0001,0x2047,0x50D3,0x58D4,0x50D3,0x50D3,0x50D3,0x50D3,0x50D2,0x306B,0x0000,0x0000,
+0x0000,0x58F4,0x1846,0x0802,0x0802,0x0802,0x0823,0x60F7,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x58D4,0x0802,0x0802,0x0802,0x0802,0x48B0,0x2869,0x0000,
+0x0000,0x58F5,0x0000,0x0000,0x0000,0x0000,0x48B0,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x2869,0x0000,0x0000,0x0000,0x1024,0x48B0,0x0000,
+0x0000,0x58F5,0x0000,0x0000,0x0000,0x0000,0x58F5,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x58F5,0x0000,0x0001,0x0000,0x1024,0x48B0,0x0000,
+0x0000,0x58F5,0x0000,0x60F6,0x2068,0x2047,0x388D,0x2048,0x60F7,0x60F6,0x0001,0x60F6,0x2068,0x1023,0x68F7,0x68F7,0x0822,0x58D4,0x2869,0x60F7,0x60F6,0x1025,0x48B0,0x0000,
+0x0000,0x58F5,0x286A,0x50D3,0x2869,0x286A,0x286A,0x48B1,0x1023,0x48D1,0x388E,0x50D3,0x2869,0x306B,0x286A,0x306B,0x2869,0x48B1,0x50D2,0x1024,0x48B1,0x2047,0x48B0,0x0000,
+0x0000,0x58F5,0x0000,0x306B,0x2869,0x2048,0x388C,0x48B0,0x1846,0x58D4,0x0802,0x306B,0x2869,0x286A,0x388C,0x388E,0x2048,0x50D3,0x48B1,0x1846,0x58D4,0x1846,0x48B0,0x0000,
+0x0000,0x58F5,0x1846,0x60F6,0x60F5,0x1845,0x58D4,0x0823,0x58D4,0x388E,0x1846,0x60F6,0x60F5,0x1825,0x50D2,0x48B1,0x0000,0x60F6,0x0823,0x58D4,0x388E,0x1024,0x48B0,0x0000,
+0x0000,0x58F5,0x0000,0x0000,0x0000,0x0000,0x50D3,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308B,0x308C,0x0000,0x0000,0x0000,0x1024,0x48B0,0x0000,
+0x0000,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0802,0x60F6,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x793B,0x308B,0x0000,0x0000,0x0000,0x2869,0x388D,0x0000,
+0x0000,0x2048,0x60F5,0x58F5,0x58F5,0x58F5,0x58F5,0x6918,0x713B,0x308C,0x0001,0x0000,0x0000,0x0802,0x40AF,0x793B,0x2048,0x58F4,0x68F7,0x60F7,0x60F6,0x50D3,0x0001,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x58D4,0x58D4,0x58D4,0x50D2,0x1846,0x0001,0x60F5,0x815E,0x895F,0x895F,0x711A,0x0802,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x895F,0x895F,0x895F,0x895F,0x711A,0x0802,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x895F,0x895F,0x895F,0x895F,0x793C,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x895F,0x895F,0x895F,0x58D4,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x50D3,0x40AF,0x0001,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+};
+
+const uint16_t icon_file[576] = {
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x286A,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x1024,0x6918,0x0801,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x1024,0x895F,0x7119,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x1024,0x895F,0x895F,0x711A,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x1024,0x895F,0x895F,0x895F,0x793B,0x1024,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x0001,0x388C,0x388C,0x388C,0x388C,0x2048,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B1,0x388C,0x388C,0x388C,0x388C,0x388C,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x60F6,0x58F5,0x58F5,0x58F5,0x58F5,0x58F5,0x58F5,0x58F5,0x58F5,0x6918,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x713B,0x0823,0x0802,0x0802,0x0802,0x0802,0x0802,0x0802,0x0802,0x0802,0x1825,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x711A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x711A,0x7119,0x7119,0x7119,0x7119,0x7119,0x7119,0x7119,0x7119,0x793B,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x793C,0x2869,0x2048,0x2048,0x388D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x813D,0x40AF,0x40AE,0x40AE,0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x308C,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+};
+
+
+const uint16_t icon_folder[576] = {
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x1825,0x1846,0x1846,0x1846,0x1846,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0001,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x2869,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x2047,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F5,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x1845,0x1024,0x1024,0x1024,0x1024,0x1024,0x1024,0x1024,0x1024,0x1024,0x1024,0x0823,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x40AF,0x388D,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,
+0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x1024,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x2048,0x0000,
+0x0000,0x286A,0x895F,0x895F,0x895F,0x68F7,0x306B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0001,0x0000,
+0x0000,0x286A,0x895F,0x895F,0x895F,0x408E,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x0000,0x0000,
+0x0000,0x286A,0x895F,0x895F,0x895F,0x1825,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x388D,0x0000,0x0000,
+0x0000,0x286A,0x895F,0x895F,0x793C,0x2047,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1024,0x0000,0x0000,
+0x0000,0x286A,0x895F,0x895F,0x50D2,0x48B0,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
+0x0000,0x286A,0x895F,0x895F,0x2869,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B1,0x0000,0x0000,0x0000,
+0x0000,0x286A,0x895F,0x815E,0x1024,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x2048,0x0000,0x0000,0x0000,
+0x0000,0x2048,0x895F,0x58D4,0x388D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x1846,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x308C,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0001,0x1845,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+};
+
+
+
+
+
+const uint16_t analyzer_main[576] = {
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x408E,0x50D2,0x48B1,0x308C,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x286A,0x895E,0x895F,0x815E,0x58D4,0x40AF,0x48B0,0x68F7,0x895F,0x895F,0x793B,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x1846,0x895E,0x895F,0x58F5,0x0802,0x0000,0x286A,0x2047,0x0000,0x1846,0x713B,0x895F,0x711A,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x6918,0x895F,0x58F4,0x0000,0x0000,0x0000,0x895F,0x60F6,0x0000,0x0000,0x0802,0x793C,0x895F,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x1846,0x895F,0x815E,0x0802,0x1024,0x0823,0x0000,0x895F,0x60F6,0x0000,0x0000,0x0000,0x286A,0x895F,0x793C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x408E,0x895F,0x58D4,0x0000,0x813D,0x6919,0x0000,0x895F,0x60F6,0x0000,0x0000,0x0000,0x0000,0x815E,0x895F,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x50D2,0x895F,0x40AF,0x0000,0x813D,0x6919,0x0000,0x895F,0x60F6,0x0000,0x2048,0x1025,0x0000,0x7119,0x895F,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x48B1,0x895F,0x48B0,0x0000,0x813D,0x6919,0x0000,0x895F,0x60F6,0x0823,0x895F,0x50D3,0x0000,0x711A,0x895F,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x308C,0x895F,0x68F7,0x0000,0x813D,0x6919,0x0000,0x895F,0x60F6,0x0823,0x895F,0x50D3,0x0802,0x895F,0x895F,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0823,0x895F,0x895F,0x1846,0x813D,0x6919,0x0000,0x895F,0x60F6,0x0823,0x895F,0x50D3,0x40AF,0x895F,0x6918,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x50D3,0x895F,0x713B,0x815E,0x6919,0x0000,0x895F,0x60F6,0x0823,0x895F,0x711A,0x895F,0x895F,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0802,0x793B,0x895F,0x895F,0x711A,0x0001,0x895F,0x60F6,0x1024,0x895F,0x895F,0x895F,0x895F,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x1024,0x711A,0x895F,0x895F,0x815E,0x895F,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x40AF,0x793C,0x895F,0x895F,0x895F,0x895F,0x6919,0x286A,0x60F6,0x895F,0x895F,0x895F,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x2048,0x2047,0x0823,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x60F6,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x60F6,0x0001,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x308C,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x308C,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
+0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+};
+
+
+
+
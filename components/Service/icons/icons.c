@@ -13,1538 +13,3163 @@
 // limitations under the License.
 
 
-#include "icons.h"
-#include <stdint.h>
-
-
-
-
-const uint8_t octo_ant[]= {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x30,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x0f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x07,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x80,0x07,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xc0,0x03,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xe0,0x01,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xf0,0x01,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xf0,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf8,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0x00,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x7e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x3e,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xe0,0x00,0x00,0x00,0x00,0x1f,0x00,0x3f,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xff,0x80,0x00,0x00,0x00,0x1f,0x80,0x1f,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7b,0xff,0xff,0xff,0xf0,0x00,0x00,0x00,0x1f,0xc0,0x1f,0x80,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xff,0xff,0xff,0xfe,0x00,0x00,0x00,0x0f,0xe0,0x0f,0x80,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xff,0xff,0xff,0x80,0x00,0x00,0x07,0xe0,0x0f,0x80,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xfc,0x00,0x03,0xff,0xe0,0x00,0x00,0x03,0xf0,0x0f,0xc0,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0x80,0x00,0x00,0x3f,0xf0,0x00,0x00,0x01,0xf0,0x07,0xc0,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x8f,0x80,0x00,0x00,0x0f,0xff,0xc0,0x00,0x01,0xf8,0x07,0xc0,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x0f,0xc0,0x00,0x00,0x01,0xff,0xf8,0x00,0x00,0xf8,0x07,0xc0,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x07,0xc0,0x00,0x00,0x00,0x7f,0xfc,0x00,0x00,0xfc,0x03,0xe0,0x0f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x03,0xe0,0x00,0x00,0x00,0x3f,0xfe,0x00,0x00,0x7c,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0x83,0xe0,0x00,0x00,0x00,0x0f,0xff,0x00,0x00,0x7e,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xc1,0xf0,0x00,0x00,0x00,0x0f,0xbf,0x00,0x00,0x3e,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xc7,0xc1,0xf0,0x00,0x00,0x00,0x0f,0x8f,0x80,0x00,0x3e,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x87,0xe0,0xf0,0x00,0x00,0x00,0x0f,0x8f,0x80,0x00,0x3e,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x03,0xe0,0xf8,0x00,0x00,0x00,0x0f,0x8f,0x80,0x00,0x3e,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x01,0xf0,0xf8,0x00,0x00,0x00,0x0f,0x8f,0x80,0x00,0x3e,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0x01,0xf0,0x78,0x00,0x00,0x00,0x0f,0x0f,0x80,0x00,0x1f,0x01,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0xf8,0xf8,0x00,0x0f,0x80,0x1f,0x1f,0xc0,0x00,0x1f,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf8,0x00,0xff,0xf8,0x00,0x3f,0xf0,0x1f,0x1f,0xc0,0x00,0x1e,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xf0,0x00,0x7f,0xf8,0x00,0x7f,0xf8,0x1f,0xbf,0xe0,0x00,0x0c,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xe0,0x00,0x7f,0xf0,0x00,0xff,0xfc,0x1f,0xff,0xf0,0x00,0x00,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xe0,0x00,0x3f,0xc0,0x01,0xff,0xfc,0x0f,0xfd,0xf0,0x00,0x00,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x1e,0x00,0x01,0xf0,0x3e,0x07,0xfc,0xf8,0x00,0x00,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x01,0xe3,0xbe,0x01,0xf8,0xf8,0x00,0x00,0x03,0xe0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x01,0xe7,0xfe,0x00,0x20,0x7c,0x00,0x00,0x01,0xc0,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x01,0xef,0xde,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x01,0xef,0xde,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x01,0xef,0xdf,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x03,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x01,0xef,0xdf,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x01,0xef,0xdf,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x01,0xef,0xdf,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x01,0xef,0xff,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x01,0xef,0xef,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x30,0x00,0x00,0x00,0x01,0xff,0xef,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x7e,0x00,0x00,0x00,0x01,0xf7,0xef,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xff,0x80,0x00,0x00,0x01,0xf7,0xef,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0xff,0x80,0x00,0x00,0x01,0xf7,0xdf,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf9,0xff,0xc0,0x00,0x00,0x01,0xf3,0x9f,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf1,0xf3,0xe0,0x00,0x00,0x00,0xf0,0x1f,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf1,0xe3,0xe0,0x00,0x00,0x00,0xf8,0x3e,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf1,0xe1,0xe0,0x00,0x00,0x00,0xf8,0x3e,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x01,0xf3,0xe1,0xf0,0x00,0x00,0x00,0x7c,0x3c,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x01,0xf3,0xe1,0xf0,0x00,0x00,0x00,0x7c,0x7c,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x03,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xf3,0xe0,0xf0,0x00,0x00,0x00,0x3e,0xfc,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x7f,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xf7,0xc0,0xf0,0x00,0x00,0x00,0x3f,0xf8,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x3f,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xf7,0xc0,0xf8,0x00,0x00,0x00,0x1f,0xf8,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x0f,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x80,0xf8,0x00,0x00,0x00,0x1f,0xf0,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0xff,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x80,0xf8,0x00,0x00,0x00,0x0f,0xe0,0x00,0x00,0x03,0xe0,0x00,0x00,0x03,0xff,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x00,0xf8,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x03,0xe0,0x00,0x00,0x0f,0xff,0xfc,0x7f,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xfe,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xc0,0x00,0x00,0x3f,0xfe,0x1f,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0xfb,0xe0,0x00,0x00,0x00,0x00,0x00,0x03,0xe3,0xc0,0x00,0x00,0x7f,0xe1,0xff,0xfe,0xf8,0x00,0x00,0x00,0x00,0x00,0x03,0xf8,0x00,0xfb,0xf0,0x00,0x00,0x00,0x00,0x00,0x07,0xf3,0xc0,0x00,0x01,0xff,0x07,0xff,0xfd,0xf0,0x00,0x00,0x00,0x00,0x00,0x07,0xf0,0x00,0xfb,0xf8,0x00,0x00,0x00,0x00,0x00,0x0f,0xf3,0xc0,0x00,0x03,0xfc,0x1f,0xff,0xe7,0xf0,0x00,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0xf3,0xfe,0x00,0x00,0x00,0x00,0x00,0x3f,0xe7,0xc0,0x00,0x07,0xf0,0x7f,0xfc,0x1f,0xe0,0x00,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0xf1,0xff,0x80,0x03,0x80,0x60,0x00,0xff,0xc7,0xc0,0x00,0x0f,0xe0,0xff,0xf8,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0xf0,0xff,0xf8,0x3f,0x80,0x7e,0x07,0xff,0x87,0xc0,0x00,0x0f,0xc3,0xfe,0xfb,0xff,0x80,0x00,0x00,0x00,0x00,0x01,0xfe,0x00,0x01,0xf0,0x7f,0xff,0xff,0x00,0x7f,0xff,0xff,0x07,0x80,0x00,0x1f,0x87,0xf8,0xe7,0xfe,0x00,0x00,0x00,0x00,0x00,0x03,0xfc,0x00,0x01,0xf0,0x1f,0xff,0xfc,0x00,0x0f,0xff,0xfe,0x07,0x80,0x00,0x3f,0x0f,0xe0,0x1f,0xf8,0x00,0x00,0x00,0x00,0x00,0x07,0xf0,0x00,0x01,0xe0,0x07,0xff,0xe0,0x00,0x01,0xff,0xf0,0x0f,0x80,0x00,0x3e,0x1f,0xc0,0x3f,0xe0,0x00,0x00,0x00,0x00,0x00,0x1f,0xe0,0x00,0x03,0xe0,0x00,0x38,0x00,0x00,0x00,0x0f,0x00,0x0f,0x80,0x00,0x7c,0x3f,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x7c,0x3f,0xe0,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0xf8,0x7f,0xe7,0xf8,0x00,0x00,0x00,0x00,0x00,0x01,0xfe,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0xf8,0xff,0xef,0xf0,0x00,0x00,0x00,0x00,0x00,0x07,0xf8,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x01,0xf0,0xfb,0xcf,0xf0,0x00,0x00,0x00,0x00,0x00,0x0f,0xf0,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x01,0xf1,0xf3,0xc7,0xe0,0x00,0x00,0x00,0x00,0x00,0x1f,0xc0,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x01,0xe1,0xf3,0xc7,0xc0,0x00,0x00,0x00,0x00,0x00,0x7f,0x80,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x03,0xe1,0xe1,0x87,0xc0,0x00,0x00,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x03,0xe3,0xe0,0x0f,0x80,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x03,0xe3,0xe0,0x0f,0x80,0x00,0x00,0x00,0x00,0x07,0xf8,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0x03,0xc3,0xc0,0x0f,0x00,0x00,0x00,0x00,0x00,0x0f,0xef,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0x07,0xc7,0xcc,0x1f,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x80,0x00,0x00,0xf8,0x00,0x00,0x00,0x01,0xff,0x80,0x00,0x00,0xf0,0x00,0x07,0xc7,0xde,0x7f,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xe0,0x00,0x00,0xf8,0x00,0x00,0x00,0x0f,0xff,0xe0,0x00,0x01,0xf0,0x00,0x07,0xc7,0xfe,0xff,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xf0,0x00,0x01,0xf0,0x00,0x00,0x00,0x3f,0xff,0xf0,0x00,0x01,0xf0,0x00,0x07,0xc7,0xbe,0xfe,0x00,0x00,0x00,0x00,0x00,0xfe,0xff,0xf8,0x00,0x03,0xe0,0x00,0x00,0x00,0x7f,0xff,0xf8,0x00,0x03,0xe0,0x00,0x07,0xc7,0xbe,0xfe,0x00,0x00,0x00,0x00,0x01,0xff,0xf8,0xfc,0x00,0x03,0xe0,0x00,0x00,0x00,0x7f,0x81,0xf8,0x00,0x03,0xe0,0x00,0x07,0xc7,0xbe,0x7e,0x00,0x00,0x00,0x00,0x03,0xff,0xf0,0x7e,0x00,0x07,0xc0,0x00,0x00,0x00,0x7c,0x00,0x78,0x00,0x07,0xc0,0x00,0x07,0x87,0xbe,0x1e,0x00,0x00,0x00,0x00,0x07,0xef,0xe0,0x3e,0x00,0x0f,0x80,0x00,0x00,0x00,0x30,0x00,0x38,0x00,0x07,0xc0,0x00,0x07,0x87,0x8c,0x1e,0x00,0x00,0x00,0x00,0x0f,0xcf,0xc0,0x7e,0x00,0x1f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x07,0x87,0x80,0x1e,0x00,0x00,0x00,0x00,0x1f,0x9f,0x80,0xfc,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x07,0x87,0x80,0x1f,0x00,0x00,0x00,0x00,0x3f,0x1f,0x01,0xfc,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x07,0x87,0x80,0x1f,0x00,0x00,0x00,0x00,0x7e,0x1f,0x03,0xff,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x07,0x87,0xc0,0x1f,0x00,0x00,0x00,0x00,0x7c,0x1f,0x83,0xff,0x80,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x07,0xc7,0xdc,0x0f,0x00,0x00,0x00,0x00,0xfc,0x0f,0xe7,0xdf,0xc1,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x07,0xc7,0xde,0x3f,0x80,0x00,0x00,0x01,0xf8,0x07,0xff,0xef,0xe3,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x07,0xc7,0xfe,0x3f,0xc0,0x00,0x00,0x01,0xf0,0x03,0xff,0xf3,0xf7,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x07,0xc7,0xfe,0x3f,0xc0,0x00,0x00,0x03,0xe0,0x01,0xff,0xf9,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x07,0xc3,0xfe,0x3f,0xe0,0x00,0x00,0x03,0xe0,0x00,0x7f,0xfc,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x07,0xc3,0xff,0x1b,0xe0,0x00,0x00,0x07,0xc0,0x00,0x18,0x7e,0x7f,0xbc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x07,0xc3,0xdf,0x01,0xf0,0x00,0x00,0x07,0xc0,0x00,0x00,0x3f,0x3f,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x03,0xc3,0xce,0x01,0xf0,0x00,0x00,0x0f,0x80,0x00,0x00,0x1f,0xbe,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x03,0xc3,0xc0,0x00,0xf8,0x00,0x00,0x0f,0x80,0x00,0x00,0x0f,0xfe,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x03,0xc3,0xc0,0x00,0xf8,0x00,0x00,0x0f,0x80,0x00,0x00,0x07,0xfc,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x07,0xc3,0xc0,0x00,0xf8,0x00,0x00,0x0f,0x00,0x00,0x00,0x03,0xfc,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x07,0xc3,0xc0,0x00,0x78,0x00,0x00,0x1f,0x00,0x00,0x00,0x01,0xf8,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x07,0xc3,0xc0,0x00,0x7c,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0xf8,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x07,0x83,0xdc,0x00,0x7c,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0xf8,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x0f,0x87,0xde,0x00,0x7c,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x0f,0x87,0xfe,0x07,0xfc,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x1f,0x07,0xfc,0x0f,0xfc,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0xf0,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x1f,0x07,0xbe,0x0f,0xfc,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0xf0,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x3e,0x07,0xbe,0x0f,0xfc,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0xf0,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x7e,0x0f,0xbe,0x07,0xfc,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0xf0,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0xfc,0x0f,0x9c,0x07,0xfc,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0xf0,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x01,0xf8,0x0f,0x80,0x00,0x7c,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0xf0,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x03,0xf0,0x1f,0x00,0x00,0x7c,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0xf0,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x07,0xe0,0x1f,0x00,0x00,0x7c,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf1,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x1f,0xe0,0x3e,0x00,0x00,0x78,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf1,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x3f,0x80,0x3e,0x00,0x00,0x78,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf9,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x80,0xff,0x00,0x7c,0x00,0x00,0xf8,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0xfb,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xfe,0x00,0x7c,0x00,0x00,0xf8,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x7b,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xfc,0x00,0xfb,0x80,0x00,0xf0,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x7f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xf0,0x01,0xff,0x80,0x01,0xf0,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x7f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xc0,0x03,0xff,0x80,0x01,0xf0,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x03,0xef,0x80,0x01,0xe0,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xef,0xc0,0x03,0xe0,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xc7,0xc0,0xe3,0xe0,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x83,0x81,0xe7,0xc0,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x0f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xff,0x00,0x01,0xf7,0xc0,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x07,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xfe,0x00,0x01,0xff,0x80,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x03,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xf8,0x00,0x01,0xff,0x80,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x01,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf6,0x00,0x00,0xff,0x00,0x00,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xdf,0x00,0x00,0x3e,0x00,0x00,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x1f,0x00,0x00,0x7e,0x00,0x00,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xfc,0x3f,0x00,0x01,0xfc,0x00,0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0x00,0x1f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0x80,0x3f,0x00,0x03,0xf8,0x00,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0x00,0x0f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x07,0xf0,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x03,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0c,0x00,0x1f,0xe0,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x01,0xff,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0xc0,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x7f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x1f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfe,0x00,0x00,0x00,0x00,0x00,0x1f,0x80,0x00,0x00,0x00,0x00,0x07,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xf8,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-
-const uint8_t octo_ant1[]= {0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x39,0xff,0xff,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0xff,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xff,0xff,0xff,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xf0,0x00,0x01,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xff,0x00,0x00,0x00,0x3f,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x0f,0x80,0x00,0x00,0x07,0xff,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x07,0x80,0x00,0x00,0x01,0xff,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x07,0xc0,0x00,0x00,0x00,0x7f,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x03,0xe0,0x00,0x00,0x00,0x1f,0xfe,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0x83,0xe0,0x00,0x00,0x00,0x0f,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xef,0x81,0xe0,0x00,0x00,0x00,0x0f,0x9f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xc7,0xc1,0xf0,0x00,0x00,0x00,0x0f,0x8f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x83,0xe0,0xf0,0x00,0x00,0x00,0x0f,0x8f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x03,0xe0,0xf0,0x00,0x00,0x00,0x0f,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x01,0xf0,0xf8,0x00,0x00,0x00,0x0f,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0xf0,0x78,0x00,0x00,0x00,0x0f,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0xf8,0xf8,0x00,0x07,0x00,0x1f,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf0,0x00,0x7f,0xf8,0x00,0x1f,0xe0,0x1f,0x1f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf0,0x00,0x7f,0xf0,0x00,0x7f,0xf8,0x1f,0x9f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xe0,0x00,0x7f,0xe0,0x00,0xff,0xfc,0x1f,0xff,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xc0,0x00,0x3f,0x80,0x00,0xff,0xfc,0x0f,0xfd,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x04,0x00,0x01,0xf0,0x3c,0x03,0xfc,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x01,0xe3,0xbe,0x01,0xf8,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x01,0xe7,0xde,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x01,0xe7,0xde,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x01,0xe7,0xde,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x01,0xe7,0xde,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x01,0xe7,0xdf,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x01,0xe7,0xdf,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x01,0xe7,0xcf,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x01,0xe7,0xcf,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x01,0xe7,0xcf,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x01,0xe7,0xcf,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x7e,0x00,0x00,0x00,0x01,0xe7,0xcf,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0xff,0x00,0x00,0x00,0x01,0xe7,0xcf,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0xff,0x80,0x00,0x00,0x01,0xf7,0xcf,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf1,0xff,0xc0,0x00,0x00,0x00,0xf0,0x1f,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf1,0xe3,0xc0,0x00,0x00,0x00,0xf0,0x1e,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf1,0xe3,0xe0,0x00,0x00,0x00,0xf8,0x1e,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf1,0xe1,0xe0,0x00,0x00,0x00,0x78,0x3e,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0xf1,0xe1,0xe0,0x00,0x00,0x00,0x7c,0x3c,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0xf3,0xe0,0xf0,0x00,0x00,0x00,0x3c,0x7c,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x03,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xf3,0xc0,0xf0,0x00,0x00,0x00,0x3e,0x78,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x3f,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xe7,0xc0,0xf0,0x00,0x00,0x00,0x1e,0xf8,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x0f,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xe7,0xc0,0xf0,0x00,0x00,0x00,0x1f,0xf0,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x07,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xef,0x80,0x70,0x00,0x00,0x00,0x0f,0xf0,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x7f,0xff,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x00,0x78,0x00,0x00,0x00,0x0f,0xe0,0x00,0x00,0x03,0xc0,0x00,0x00,0x01,0xff,0xff,0xef,0xfc,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x00,0x78,0x00,0x00,0x00,0x07,0x80,0x00,0x00,0x03,0xc0,0x00,0x00,0x0f,0xff,0xf8,0x3f,0xf8,0x00,0x00,0x00,0x00,0x00,0x01,0xfe,0x00,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xc0,0x00,0x00,0x1f,0xfc,0x1f,0xff,0xf8,0x00,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0x79,0xe0,0x00,0x00,0x00,0x00,0x00,0x01,0xe3,0xc0,0x00,0x00,0x7f,0xc0,0xff,0xfe,0xf8,0x00,0x00,0x00,0x00,0x00,0x01,0xf8,0x00,0x7b,0xf0,0x00,0x00,0x00,0x00,0x00,0x03,0xe3,0xc0,0x00,0x00,0xff,0x07,0xff,0xf9,0xf0,0x00,0x00,0x00,0x00,0x00,0x07,0xf0,0x00,0xf3,0xf8,0x00,0x00,0x00,0x00,0x00,0x0f,0xe3,0xc0,0x00,0x01,0xfc,0x1f,0xff,0xc3,0xe0,0x00,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0xf1,0xfe,0x00,0x00,0x00,0x00,0x00,0x1f,0xe3,0xc0,0x00,0x03,0xf0,0x7f,0xf0,0x0f,0xe0,0x00,0x00,0x00,0x00,0x00,0x1f,0x80,0x00,0xf1,0xff,0x80,0x01,0x00,0x00,0x00,0x7f,0xc7,0xc0,0x00,0x07,0xe0,0xff,0xf8,0x7f,0xc0,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0xf0,0xff,0xf0,0x0f,0x00,0x7c,0x03,0xff,0x87,0x80,0x00,0x0f,0x81,0xfc,0xf1,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0xfe,0x00,0x00,0xf0,0x3f,0xff,0xfe,0x00,0x3f,0xff,0xff,0x07,0x80,0x00,0x1f,0x07,0xf0,0x67,0xfe,0x00,0x00,0x00,0x00,0x00,0x03,0xf8,0x00,0x01,0xe0,0x1f,0xff,0xf8,0x00,0x0f,0xff,0xfc,0x07,0x80,0x00,0x3e,0x0f,0xe0,0x0f,0xf8,0x00,0x00,0x00,0x00,0x00,0x07,0xf0,0x00,0x01,0xe0,0x03,0xff,0xc0,0x00,0x01,0xff,0xf0,0x0f,0x80,0x00,0x3e,0x0f,0x80,0x3f,0xc0,0x00,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0x01,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x7c,0x1f,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x80,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x78,0x3f,0xe0,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0xf8,0x7f,0xe2,0xf8,0x00,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0xf0,0x7b,0xe7,0xf0,0x00,0x00,0x00,0x00,0x00,0x03,0xf8,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0xf0,0xfb,0xc7,0xe0,0x00,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0xe0,0xf3,0xc7,0xe0,0x00,0x00,0x00,0x00,0x00,0x1f,0xc0,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x01,0xe1,0xf3,0xc7,0xc0,0x00,0x00,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x01,0xe1,0xe0,0x07,0x80,0x00,0x00,0x00,0x00,0x00,0xfe,0x00,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x03,0xe3,0xe0,0x07,0x80,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x03,0xc3,0xc0,0x0f,0x80,0x00,0x00,0x00,0x00,0x03,0xf0,0x00,0x00,0x00,0x3c,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x78,0x00,0x03,0xc3,0xc0,0x0f,0x00,0x00,0x00,0x00,0x00,0x07,0xe6,0x00,0x00,0x00,0x7c,0x00,0x00,0x1f,0xc0,0x00,0x00,0x00,0x00,0xf8,0x00,0x03,0xc3,0xc0,0x0f,0x00,0x00,0x00,0x00,0x00,0x1f,0xef,0x80,0x00,0x00,0x78,0x00,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,0xf0,0x00,0x03,0xc7,0xde,0x7f,0x00,0x00,0x00,0x00,0x00,0x3f,0xff,0xc0,0x00,0x00,0xf0,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x01,0xf0,0x00,0x07,0xc7,0xbe,0x7e,0x00,0x00,0x00,0x00,0x00,0x7f,0xff,0xe0,0x00,0x01,0xf0,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x01,0xe0,0x00,0x07,0x87,0xbe,0xfe,0x00,0x00,0x00,0x00,0x00,0xfc,0xff,0xf8,0x00,0x01,0xe0,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x01,0xe0,0x00,0x07,0x87,0xbc,0x7e,0x00,0x00,0x00,0x00,0x01,0xff,0xf8,0xfc,0x00,0x03,0xe0,0x00,0x00,0x1f,0xc0,0x00,0x00,0x18,0x03,0xe0,0x00,0x07,0x87,0xbe,0x3e,0x00,0x00,0x00,0x00,0x03,0xff,0xf0,0x7e,0x00,0x07,0xc0,0x00,0x00,0x0f,0xf0,0x00,0x00,0x78,0x03,0xc0,0x00,0x07,0x87,0x9e,0x1e,0x00,0x00,0x00,0x00,0x07,0xef,0xe0,0x3e,0x00,0x0f,0x80,0x00,0x00,0x0e,0xfc,0x00,0x00,0xf8,0x07,0xc0,0x00,0x07,0x87,0x80,0x1e,0x00,0x00,0x00,0x00,0x0f,0xcf,0xc0,0x7c,0x00,0x0f,0x00,0x00,0x00,0x07,0x3f,0x80,0x07,0xe0,0x07,0x80,0x00,0x07,0x87,0x80,0x1e,0x00,0x00,0x00,0x00,0x1f,0x9f,0x80,0x78,0x00,0x1f,0x00,0x00,0x00,0x03,0x8f,0xff,0xff,0xc0,0x07,0x80,0x00,0x07,0x87,0x80,0x1e,0x00,0x00,0x00,0x00,0x1f,0x1f,0x00,0xfc,0x00,0x3e,0x00,0x00,0x00,0x01,0x83,0xff,0xff,0x00,0x0f,0x80,0x00,0x07,0x87,0x80,0x1e,0x00,0x00,0x00,0x00,0x3e,0x1f,0x01,0xfe,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x7f,0xfc,0x00,0x0f,0x00,0x00,0x07,0x87,0x80,0x0f,0x00,0x00,0x00,0x00,0x7c,0x0f,0x83,0xff,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x07,0x87,0x88,0x0f,0x00,0x00,0x00,0x00,0xf8,0x0f,0xc7,0xdf,0xc1,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x07,0x87,0xdc,0x1f,0x80,0x00,0x00,0x00,0xf8,0x07,0xff,0xc7,0xe3,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x07,0x83,0xde,0x3f,0x80,0x00,0x00,0x01,0xf0,0x03,0xff,0xf3,0xf3,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x07,0xc3,0xfc,0x3f,0xc0,0x00,0x00,0x01,0xe0,0x00,0xff,0xf9,0xff,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x00,0x07,0xc3,0xfe,0x3f,0xe0,0x00,0x00,0x03,0xe0,0x00,0x7c,0xfc,0xff,0xbc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x03,0xc3,0xdf,0x03,0xe0,0x00,0x00,0x03,0xc0,0x00,0x00,0x7e,0x7f,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x03,0xc3,0xdf,0x01,0xf0,0x00,0x00,0x07,0xc0,0x00,0x00,0x3f,0x3f,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x03,0xc3,0xce,0x00,0xf0,0x00,0x00,0x07,0x80,0x00,0x00,0x1f,0x9e,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x03,0xc3,0xc0,0x00,0xf0,0x00,0x00,0x0f,0x80,0x00,0x00,0x0f,0xfe,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x03,0xc3,0xc0,0x00,0xf8,0x00,0x00,0x0f,0x00,0x00,0x00,0x07,0xfc,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x03,0xc3,0xc0,0x00,0x78,0x00,0x00,0x0f,0x00,0x00,0x00,0x03,0xfc,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x07,0xc3,0xc0,0x00,0x78,0x00,0x00,0x0f,0x00,0x00,0x00,0x01,0xf8,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x07,0x83,0xc0,0x00,0x78,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0xf8,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x07,0x83,0xc8,0x00,0x78,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf8,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x0f,0x83,0xdc,0x00,0x7c,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x0f,0x03,0xfc,0x07,0x7c,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0x3c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x1f,0x07,0xbc,0x07,0xbc,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x1f,0x07,0xbe,0x0f,0xbc,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x3e,0x07,0xbe,0x0f,0xfc,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x7c,0x07,0x9e,0x07,0xfc,0x00,0x00,0x1e,0x00,0x00,0x00,0x01,0xf0,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0xfc,0x0f,0x8c,0x03,0xfc,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0x78,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x01,0xf8,0x0f,0x00,0x00,0x7c,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x03,0xf0,0x0f,0x00,0x00,0x78,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3c,0x00,0x07,0xe0,0x1f,0x00,0x00,0x78,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf0,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x0f,0xc0,0x1e,0x00,0x00,0x78,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf1,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x3f,0x80,0x3e,0x00,0x00,0x78,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xf1,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x80,0xff,0x00,0x3c,0x00,0x00,0x78,0x00,0x00,0x1e,0x00,0x00,0x00,0x00,0xfb,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xfe,0x00,0x7c,0x00,0x00,0xf0,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x7b,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf8,0x00,0xfb,0x80,0x00,0xf0,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x7f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xff,0xe0,0x00,0xff,0x80,0x00,0xf0,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x3f,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x80,0x01,0xff,0x80,0x01,0xf0,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x03,0xef,0x80,0x01,0xe0,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xcf,0x80,0x03,0xe0,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x87,0x80,0xc3,0xc0,0x00,0x00,0x07,0x80,0x00,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3f,0x81,0x01,0xe7,0xc0,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7e,0x00,0x01,0xe7,0x80,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x07,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0x01,0xff,0x80,0x00,0x00,0x03,0xc0,0x00,0x00,0x00,0x03,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xf8,0x00,0x01,0xff,0x00,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x01,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xff,0xf6,0x00,0x00,0xff,0x00,0x00,0x00,0x01,0xe0,0x00,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0xcf,0x00,0x00,0x3e,0x00,0x00,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0x7f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xff,0x1f,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0xf0,0x00,0x00,0x00,0x00,0x3f,0x80,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xf8,0x1f,0x00,0x00,0xf8,0x00,0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0x00,0x0f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0x78,0x00,0x00,0x00,0x00,0x07,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1e,0x00,0x07,0xf0,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x03,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0xc0,0x00,0x00,0x00,0x00,0x3c,0x00,0x00,0x00,0x00,0x00,0xff,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7f,0x80,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x3f,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xff,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x1f,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xfc,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x07,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0xf8,0x00,0x00,0x00,0x00,0x00,0x0f,0x80,0x00,0x00,0x00,0x00,0x01,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x38,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0x00,0x00,0x00,0x00,0x00,0x00,0x07,0xc0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x03,0xe0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x01,0xf0,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xf8,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0xfc,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x7c,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x3e,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x1f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x0f,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x06,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00,0x00};
-
-const uint16_t evil[576]= {
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x48B1,0x1025,0x793C,0x1846,0x813D,0x1847,0x40AF,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0801,0x58F5,0x895F,0x2048,0x6919,0x895F,0x1846,0x895F,0x793C,0x1025,0x895F,0x6918,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0802,0x7119,0x895F,0x711A,0x286A,0x895F,0x895F,0x1846,0x895F,0x895F,0x40AE,0x60F5,0x895F,0x793C,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x58F4,0x895F,0x895F,0x40AF,0x60F6,0x895F,0x895F,0x1846,0x895F,0x895F,0x711A,0x306A,0x895F,0x895F,0x7119,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0001,0x1846,0x2048,0x306B,0x0823,0x388D,0x40AE,0x48B0,0x0823,0x48B1,0x40AE,0x40AE,0x0802,0x306B,0x2068,0x1846,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x60F7,0x895F,0x813D,0x711A,0x1024,0x60F7,0x60F6,0x58F5,0x1024,0x58F5,0x60F6,0x60F7,0x2048,0x60F6,0x813D,0x895F,0x793B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0801,0x895F,0x895F,0x895F,0x793C,0x2869,0x895F,0x895F,0x895F,0x1846,0x895F,0x895F,0x895F,0x388E,0x68F7,0x895F,0x895F,0x895F,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x1846,0x895F,0x895F,0x895F,0x6919,0x308C,0x895F,0x895F,0x895F,0x1846,0x895F,0x895F,0x895F,0x48B1,0x58D4,0x895F,0x895F,0x895F,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0801,0x1846,0x1846,0x1846,0x1024,0x0822,0x1846,0x1846,0x1846,0x0001,0x1846,0x1846,0x1846,0x1023,0x1023,0x1846,0x1846,0x1846,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x2047,0x895F,0x895F,0x895F,0x6919,0x388C,0x895F,0x895F,0x895F,0x1846,0x895F,0x895F,0x895F,0x50D2,0x50D3,0x895F,0x895F,0x895F,0x308C,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0802,0x895F,0x895F,0x895F,0x793C,0x2869,0x895F,0x895F,0x895F,0x1846,0x895F,0x40AF,0x306B,0x286A,0x60F6,0x895F,0x895F,0x895F,0x1847,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x6918,0x895F,0x895F,0x895F,0x1846,0x793B,0x793B,0x711A,0x1024,0x7119,0x2048,0x58D4,0x40AE,0x1825,0x40AF,0x713B,0x793D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x1024,0x1846,0x1846,0x1846,0x0801,0x2869,0x286A,0x306B,0x0802,0x308C,0x2869,0x388D,0x895F,0x895F,0x60F6,0x286A,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x68F7,0x895F,0x895F,0x388E,0x60F7,0x895F,0x895F,0x1846,0x895F,0x895F,0x1845,0x895E,0x895F,0x895F,0x895F,0x793C,0x50D2,0x1845,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x1023,0x793C,0x895F,0x6919,0x308C,0x895F,0x895F,0x1846,0x895F,0x895F,0x388D,0x58F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x388D,0x0802,0x0000,
-0x0000,0x0000,0x0000,0x1023,0x7119,0x895F,0x1846,0x793B,0x895F,0x1846,0x895F,0x815E,0x1025,0x2869,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0001,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x50D3,0x1846,0x815E,0x1846,0x895F,0x286A,0x50D3,0x1024,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x2047,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x0802,0x1845,0x0000,0x0000,0x0000,0x48B0,0x895F,0x895F,0x895F,0x895F,0x793B,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x895F,0x895F,0x895F,0x793B,0x895F,0x58D4,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6918,0x895F,0x6918,0x0000,0x58D4,0x895F,0x58D4,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x895F,0x2047,0x0000,0x0000,0x58D4,0x7119,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0801,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-const uint16_t controle[576]= {
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x2047,0x2047,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x813D,0x895F,0x895F,0x895F,0x895F,0x813D,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x408E,0x1846,0x0823,0x0823,0x1846,0x408E,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x40AE,0x50D2,0x50D2,0x408E,0x1025,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x793C,0x60F7,0x60F7,0x793C,0x50D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x388E,0x60F6,0x793B,0x815E,0x815E,0x793B,0x60F6,0x388E,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x58F5,0x793C,0x793C,0x58F5,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x0000,0x58F5,0x58F5,0x0000,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x306B,0x6918,0x6918,0x306B,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x306B,0x6918,0x6918,0x306B,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x0000,0x58F5,0x58F5,0x0000,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x58F5,0x793C,0x793C,0x58F5,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x895F,0x60F7,0x60F7,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x388D,0x0000,0x0000,0x388D,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D3,0x895F,0x895F,0x0802,0x48B1,0x48B1,0x0802,0x895F,0x895F,0x50D3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x895F,0x895F,0x2869,0x0802,0x0802,0x2869,0x895F,0x895F,0x48B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x895F,0x895F,0x815E,0x48B0,0x48B0,0x815E,0x895F,0x895F,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x815E,0x895F,0x895F,0x815E,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x2047,0x2047,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-
-
-
-const uint16_t learn[576]= {
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0823,0x306B,0x40AF,0x50D2,0x408E,0x2869,0x0001,0x0000,0x0000,0x0001,0x2869,0x408E,0x50D2,0x40AF,0x306B,0x0822,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x308C,0x308C,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0001,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x0001,0x0000,0x0000,
-0x0000,0x388D,0x388D,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x388D,0x388D,0x0000,
-0x0000,0x48B1,0x388D,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x388D,0x48B1,0x0000,
-0x0000,0x48B1,0x388D,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x388D,0x48B1,0x0000,
-0x0000,0x48B1,0x388D,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x388D,0x48B1,0x0000,
-0x0000,0x48B1,0x388D,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x388D,0x48B1,0x0000,
-0x0000,0x48B1,0x388D,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x388D,0x48B1,0x0000,
-0x0000,0x48B1,0x388D,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x388D,0x48B1,0x0000,
-0x0000,0x48B1,0x388D,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x388D,0x48B1,0x0000,
-0x0000,0x48B1,0x388D,0x793C,0x895F,0x793C,0x6918,0x60F5,0x6919,0x813D,0x895F,0x58D4,0x58D4,0x895F,0x813D,0x6919,0x60F5,0x6918,0x793C,0x895F,0x793C,0x388D,0x48B1,0x0000,
-0x0000,0x48B1,0x388D,0x40AF,0x2869,0x308C,0x50D2,0x50D2,0x408E,0x1846,0x2068,0x308C,0x308C,0x2048,0x1825,0x40AF,0x50D3,0x50D2,0x308C,0x2869,0x40AF,0x388D,0x48B1,0x0000,
-0x0000,0x48B1,0x58F5,0x58D4,0x793C,0x48B0,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x306B,0x58F5,0x895E,0x58D4,0x58F5,0x48B1,0x0000,
-0x0000,0x48B1,0x813D,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x40B0,0x815E,0x48B1,0x0000,
-0x0000,0x2047,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x2048,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-
-
-
-
-
-const uint16_t deauth[576]= {
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x306A,0x813D,0x6918,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0801,0x6918,0x813D,0x286A,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x895F,0x895F,0x48B1,0x0000,0x0000,0x0000,
-0x0000,0x286A,0x60F7,0x40AF,0x711A,0x895F,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1845,0x895F,0x7119,0x40AE,0x60F7,0x286A,0x0000,
-0x0000,0x813D,0x895F,0x895F,0x895F,0x895F,0x306B,0x0000,0x0000,0x0000,0x0000,0x0801,0x0801,0x0000,0x0000,0x0000,0x0000,0x306B,0x895F,0x895F,0x895F,0x895F,0x813D,0x0000,
-0x0000,0x6918,0x895F,0x895F,0x895F,0x895F,0x815E,0x1023,0x1846,0x58F5,0x815E,0x895F,0x895F,0x815E,0x58F5,0x1846,0x1023,0x815E,0x895F,0x895F,0x895F,0x895F,0x6918,0x0000,
-0x0000,0x0801,0x2869,0x1845,0x306B,0x815E,0x50D3,0x308B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x306B,0x50D3,0x815E,0x306B,0x1845,0x2869,0x0001,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x1846,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1846,0x1847,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B1,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x6919,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x711A,0x793B,0x2869,0x306B,0x711A,0x895F,0x895F,0x711A,0x306B,0x2869,0x793B,0x7119,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x308C,0x6918,0x711A,0x1845,0x815E,0x815E,0x1845,0x711A,0x6918,0x308C,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x306B,0x60F7,0x813D,0x2048,0x793B,0x793B,0x2048,0x813D,0x60F7,0x306B,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x793B,0x306B,0x2869,0x50D3,0x50D3,0x50D3,0x50D3,0x2869,0x306B,0x793B,0x308C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x60F6,0x286A,0x286A,0x60F7,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x1846,0x60F7,0x895F,0x895F,0x40B0,0x1024,0x1024,0x48B0,0x895F,0x895F,0x60F7,0x1845,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0801,0x2869,0x1845,0x306B,0x815E,0x793B,0x306B,0x0802,0x793C,0x895F,0x813D,0x813D,0x895F,0x793C,0x0802,0x306B,0x793B,0x815E,0x306B,0x1845,0x2869,0x0801,0x0000,
-0x0000,0x6918,0x895F,0x895F,0x895F,0x895F,0x815E,0x2047,0x0000,0x68F7,0x2048,0x50D3,0x50D3,0x2048,0x60F7,0x0000,0x1847,0x815E,0x895F,0x895F,0x895F,0x895F,0x6918,0x0000,
-0x0000,0x813D,0x895F,0x711A,0x895F,0x895F,0x306B,0x0000,0x0000,0x0001,0x0000,0x0001,0x0001,0x0000,0x0001,0x0000,0x0000,0x306B,0x895F,0x895F,0x711A,0x895F,0x813D,0x0000,
-0x0000,0x286A,0x48B1,0x40AF,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1845,0x895F,0x895F,0x40AF,0x48D1,0x286A,0x0000,
-0x0000,0x0000,0x0000,0x60F7,0x895F,0x895F,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x895F,0x895F,0x60F7,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x286A,0x815E,0x6918,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0801,0x6918,0x815E,0x286A,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-
-
-
-const uint16_t scan[576]= {
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1845,0x388D,0x50D3,0x60F6,0x60F6,0x50D3,0x388D,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x1825,0x6919,0x895F,0x895F,0x895F,0x813D,0x48B0,0x2869,0x2869,0x48B0,0x813D,0x895F,0x895F,0x895F,0x6919,0x1825,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x306A,0x815E,0x895F,0x895F,0x895F,0x6918,0x0802,0x0000,0x0000,0x0000,0x0000,0x0802,0x6918,0x895F,0x895F,0x895F,0x815E,0x286A,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x308C,0x895F,0x895F,0x895F,0x895F,0x813D,0x0802,0x0000,0x0823,0x408E,0x388E,0x0822,0x0000,0x0802,0x813D,0x895F,0x895F,0x895F,0x895F,0x308C,0x0000,0x0000,
-0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B0,0x0000,0x0823,0x793D,0x895F,0x895F,0x793D,0x0822,0x0000,0x48B0,0x895F,0x895F,0x895F,0x895F,0x895F,0x2869,0x0000,
-0x0823,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x2869,0x0000,0x408E,0x895F,0x895F,0x895F,0x895F,0x388E,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x0823,
-0x0823,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x2869,0x0000,0x388E,0x895F,0x895F,0x895F,0x895F,0x408E,0x0000,0x2869,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x0823,
-0x0000,0x2869,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B0,0x0000,0x0802,0x793C,0x895F,0x895F,0x793C,0x0822,0x0000,0x48B0,0x895F,0x895F,0x895F,0x895F,0x895F,0x2869,0x0000,
-0x0000,0x0000,0x308C,0x895F,0x895F,0x895F,0x895F,0x813D,0x0802,0x0000,0x0802,0x388E,0x408E,0x0822,0x0000,0x1023,0x815E,0x895F,0x895F,0x895F,0x895F,0x308B,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x286A,0x815E,0x895F,0x895F,0x895F,0x6918,0x0802,0x0000,0x0000,0x0000,0x0000,0x1023,0x6919,0x895F,0x895F,0x895F,0x815E,0x286A,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x1025,0x6919,0x895F,0x895F,0x895F,0x813D,0x48B0,0x286A,0x2869,0x48B0,0x815E,0x895F,0x895F,0x895F,0x6918,0x1025,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x388D,0x50D3,0x60F5,0x60F5,0x50D3,0x388D,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-
-
-const unsigned short sd_front[256]= {
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x1024,0x50D2,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x1846,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x306B,0x793C,0x50D2,0x895F,0x48B1,0x815E,0x58D4,0x711A,0x40AF,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x306B,0x6918,0x1023,0x895F,0x0000,0x793C,0x2047,0x58D4,0x40AF,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x308C,0x711A,0x306B,0x895F,0x2048,0x793D,0x388E,0x60F7,0x40AF,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x6919,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x306B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x1846,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x1846,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    
-    
-    
-    const uint16_t blu_main[576]= {
-    
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x306B,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40B0,0x895F,0x793B,0x388D,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F5,0x895F,0x895F,0x895F,0x58F5,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F5,0x895F,0x895F,0x895F,0x895F,0x793B,0x388C,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x1825,0x0000,0x0000,0x0000,0x58F5,0x895F,0x815E,0x711A,0x895F,0x895F,0x895F,0x58F4,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x1024,0x7119,0x813D,0x388D,0x0000,0x0000,0x58F5,0x895F,0x793C,0x2047,0x40AF,0x813D,0x895F,0x895F,0x7119,0x1024,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x1846,0x813D,0x895F,0x815E,0x388D,0x0000,0x58F5,0x895F,0x793C,0x1024,0x0000,0x50D2,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x388E,0x815E,0x895F,0x815E,0x388D,0x58F5,0x895F,0x793C,0x1025,0x308C,0x813D,0x895F,0x815E,0x388E,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x408E,0x815E,0x895F,0x813D,0x793D,0x895F,0x793C,0x48B1,0x813D,0x895F,0x815E,0x408E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x408E,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x408E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AE,0x815E,0x895F,0x895F,0x895F,0x895F,0x815E,0x408E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x815E,0x895F,0x895F,0x895F,0x895F,0x815E,0x408E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x408E,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x408E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x408E,0x815E,0x895F,0x813D,0x793D,0x895F,0x793C,0x48B1,0x813D,0x895F,0x815E,0x408E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x388E,0x815E,0x895F,0x815E,0x388C,0x58F5,0x895F,0x793C,0x1025,0x308C,0x813D,0x895F,0x815E,0x388E,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x1846,0x813D,0x895F,0x815E,0x388C,0x0000,0x58F5,0x895F,0x793C,0x1024,0x0000,0x50D2,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x1024,0x7119,0x793D,0x388D,0x0000,0x0000,0x58F5,0x895F,0x793C,0x2047,0x40AF,0x813D,0x895F,0x895F,0x7119,0x1024,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x1825,0x0000,0x0000,0x0000,0x58F5,0x895F,0x815E,0x711A,0x895F,0x895F,0x895F,0x58F4,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F5,0x895F,0x895F,0x895F,0x895F,0x793B,0x388C,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F5,0x895F,0x895F,0x895F,0x58F5,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40B0,0x895F,0x793B,0x388D,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x306B,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    
-    
-    
-    
-    
-    const uint16_t nfc_main[576]= {
-    
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0801,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x58F5,0x48B1,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D3,0x915F,0x813D,0x2047,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x306B,0x1846,0x0000,0x2048,0x813D,0x895F,0x50D3,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x50D3,0x895F,0x60F5,0x0001,0x0000,0x58D4,0x895F,0x793C,0x1825,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x0000,0x0000,0x50D3,0x895F,0x815E,0x2869,0x0000,0x2869,0x895E,0x895F,0x388E,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x6918,0x306B,0x0000,0x1846,0x793C,0x895F,0x58D4,0x0000,0x0802,0x7119,0x915F,0x60F6,0x0001,
-    0x0000,0x2869,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x7119,0x915F,0x6918,0x0802,0x0000,0x58D4,0x895F,0x793B,0x1024,0x0000,0x50D2,0x895F,0x793B,0x1024,
-    0x0801,0x60F7,0x815E,0x40AF,0x0801,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x2869,0x0000,0x306B,0x895F,0x895F,0x2869,0x0000,0x308C,0x895F,0x815E,0x286A,
-    0x2869,0x815E,0x895F,0x895F,0x58F5,0x1024,0x0000,0x0000,0x0000,0x0000,0x1825,0x793C,0x895F,0x48B1,0x0000,0x1845,0x813D,0x895F,0x40AF,0x0000,0x2047,0x815E,0x895F,0x388D,
-    0x388E,0x895F,0x895F,0x895F,0x895F,0x7119,0x2048,0x0000,0x0000,0x0000,0x0001,0x68F7,0x915F,0x60F7,0x0000,0x0822,0x711A,0x915F,0x50D3,0x0000,0x1025,0x793C,0x895F,0x40AE,
-    0x40AF,0x895F,0x813D,0x60F7,0x895F,0x895F,0x813D,0x388D,0x0001,0x0000,0x0000,0x58D4,0x915F,0x7119,0x0802,0x0001,0x6918,0x915F,0x58F5,0x0000,0x1024,0x793B,0x895F,0x40AF,
-    0x40AF,0x895F,0x793B,0x1825,0x408E,0x813D,0x895F,0x895F,0x50D3,0x0823,0x0000,0x50D3,0x915F,0x711A,0x0802,0x0001,0x6918,0x915F,0x58F5,0x0000,0x1024,0x793B,0x895F,0x40AF,
-    0x388E,0x895F,0x815E,0x2047,0x0000,0x2869,0x711A,0x895F,0x895F,0x6918,0x2047,0x60F6,0x915F,0x6918,0x0001,0x0822,0x711A,0x915F,0x50D3,0x0000,0x1025,0x793C,0x895F,0x40AF,
-    0x2869,0x815E,0x895F,0x48B1,0x0000,0x0000,0x1825,0x60F6,0x895F,0x895F,0x793C,0x813D,0x895F,0x58D4,0x0000,0x1845,0x813D,0x895F,0x40AF,0x0000,0x2047,0x815E,0x895F,0x388E,
-    0x0801,0x60F6,0x793B,0x306B,0x0000,0x0000,0x0000,0x0802,0x48B0,0x815E,0x895F,0x895F,0x895F,0x388C,0x0000,0x306B,0x895F,0x895F,0x2869,0x0000,0x308C,0x895F,0x895F,0x306B,
-    0x0000,0x1846,0x1025,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x793B,0x895F,0x793C,0x1024,0x0000,0x58D4,0x895F,0x793B,0x1024,0x0000,0x50D2,0x895F,0x793C,0x1025,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x6918,0x48B1,0x0000,0x1846,0x793C,0x895F,0x58D4,0x0000,0x0802,0x7119,0x915F,0x60F6,0x0001,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x0823,0x0000,0x50D3,0x895F,0x815E,0x2869,0x0000,0x2869,0x895E,0x895F,0x388E,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x50D3,0x895F,0x60F5,0x0001,0x0000,0x58D4,0x895F,0x793C,0x1825,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x306B,0x1846,0x0000,0x2048,0x813D,0x895F,0x50D3,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D3,0x915F,0x813D,0x2047,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x58F5,0x48B1,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0801,0x0000,0x0000,0x0000
-    };
-    
-    
-    
-    
-    
-    
-    
-    
-    
-    const uint16_t infra_main[576]  = {
-    
-    0x1847,0x388D,0x0801,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x58D4,0x815E,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x58F5,0x895F,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x58D4,0x895F,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x58D4,0x895F,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x58D4,0x895F,0x388C,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x1023,0x0000,
-    0x58D4,0x895F,0x815E,0x6918,0x388C,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x2048,0x0001,0x0802,0x6918,0x60F6,0x0001,
-    0x50D3,0x895F,0x895F,0x895F,0x895F,0x50D3,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x2047,0x0000,0x308C,0x815E,0x286A,0x0001,0x6918,0x793C,0x1025,
-    0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B0,0x0000,0x0000,0x0000,0x1024,0x388D,0x0823,0x0801,0x7119,0x7119,0x0001,0x2869,0x895F,0x48B1,0x0000,0x50D3,0x895F,0x2869,
-    0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x308C,0x895F,0x388D,0x0000,0x60F6,0x813D,0x1025,0x1025,0x813E,0x60F6,0x0000,0x40AE,0x895F,0x388D,
-    0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AE,0x0000,0x0000,0x2048,0x895F,0x50D2,0x0000,0x50D2,0x895F,0x2048,0x0822,0x793C,0x6919,0x0001,0x308C,0x895F,0x40B0,
-    0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x0000,0x0000,0x1846,0x815E,0x58F5,0x0000,0x40B0,0x895F,0x286A,0x0801,0x711A,0x711A,0x0001,0x286A,0x895F,0x48B1,
-    0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x1845,0x815E,0x58F5,0x0000,0x40B0,0x895F,0x286A,0x0801,0x711A,0x711A,0x0801,0x286A,0x895F,0x48D2,
-    0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40B0,0x0000,0x0000,0x2048,0x895F,0x50D3,0x0000,0x48D2,0x895F,0x2048,0x0822,0x793B,0x6919,0x0001,0x306B,0x895F,0x48B0,
-    0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2047,0x0000,0x0000,0x306B,0x895F,0x408E,0x0000,0x60F6,0x815E,0x1845,0x1024,0x813D,0x60F6,0x0000,0x388E,0x895F,0x388E,
-    0x48D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x0000,0x0000,0x0000,0x1024,0x388E,0x1024,0x0001,0x6918,0x711A,0x0802,0x2069,0x895F,0x50D2,0x0000,0x50D2,0x895F,0x286A,
-    0x48D1,0x895F,0x895F,0x895F,0x895F,0x60F7,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x2047,0x0000,0x286A,0x815E,0x306B,0x0000,0x68F7,0x813D,0x1845,
-    0x48B1,0x895F,0x895F,0x793C,0x48B1,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x1847,0x0001,0x0001,0x60F5,0x60F6,0x0001,
-    0x48B1,0x895F,0x48B1,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x0822,0x0000,
-    0x48B1,0x895F,0x306A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x48B1,0x895F,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x48B0,0x895F,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x40B0,0x895F,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x2047,0x50D3,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    
-    
-    
-    
-    
-    
-    
-    const uint16_t rf_main[576] = {
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x1024,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x793B,0x793B,0x60F6,0x306B,0x0001,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x40AF,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x308C,0x48B0,0x6919,0x815E,0x58D4,0x0822,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0801,0x58F5,0x895F,0x7119,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x0823,0x0802,0x388E,0x815E,0x58D4,0x0001,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x388E,0x895F,0x895F,0x895F,0x7119,0x1845,0x0000,0x0000,0x0000,0x0000,0x2047,0x793C,0x793B,0x40AE,0x0001,0x388E,0x815E,0x306B,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x1024,0x713B,0x895F,0x895F,0x895F,0x895F,0x7119,0x1845,0x0000,0x0000,0x0000,0x0802,0x306A,0x58D4,0x815E,0x40AE,0x0802,0x6919,0x60F6,0x0001,
-    0x0000,0x0000,0x0000,0x0000,0x308C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x1845,0x0000,0x0000,0x0001,0x1024,0x0801,0x58D4,0x793B,0x0823,0x48B0,0x793B,0x1024,
-    0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x1845,0x0000,0x2047,0x6919,0x1024,0x306A,0x793C,0x1024,0x308C,0x793B,0x1825,
-    0x0000,0x0000,0x0000,0x0801,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x1825,0x0801,0x2047,0x0001,0x0802,0x2047,0x0000,0x0802,0x2047,0x0000,
-    0x0000,0x0000,0x0000,0x0802,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0802,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0001,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x2048,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x1845,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0001,0x6917,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x1845,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0823,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x1845,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x306B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x60F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x1023,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x1846,0x813D,0x895F,0x895F,0x895F,0x793C,0x60F7,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x388E,0x0801,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x48B0,0x895F,0x895F,0x895F,0x895F,0x60F5,0x0802,0x2048,0x48B1,0x60F7,0x711A,0x711A,0x6918,0x58D4,0x388D,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0822,0x711A,0x895F,0x895F,0x895F,0x895F,0x48D1,0x0000,0x0000,0x0000,0x0001,0x0802,0x0802,0x0801,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0001,0x286A,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x1024,0x6918,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x50D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x1024,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    
-    
-    
-    
-    
-const uint16_t wifi_main[576] = {
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x388D,0x48B0,0x58D4,0x58D4,0x48B0,0x388D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x50D2,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x50D2,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0802,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0802,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x2047,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x2047,0x0000,0x0000,
-0x0000,0x2869,0x895E,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x48B1,0x306B,0x2068,0x2048,0x306B,0x48B1,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895E,0x2869,0x0000,
-0x0000,0x793C,0x895F,0x895F,0x895F,0x895F,0x6918,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1847,0x68F7,0x895F,0x895F,0x895F,0x895F,0x793D,0x0000,
-0x0000,0x815E,0x895F,0x895F,0x895F,0x388D,0x0000,0x0000,0x0000,0x0823,0x306B,0x408E,0x408E,0x306B,0x0823,0x0000,0x0000,0x0000,0x388D,0x895F,0x895F,0x895F,0x813D,0x0000,
-0x0000,0x306B,0x793D,0x711A,0x2048,0x0000,0x0000,0x1847,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x2047,0x0000,0x0000,0x2047,0x711A,0x813D,0x306B,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AE,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B1,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x50D3,0x895F,0x895F,0x895F,0x895F,0x58D4,0x388D,0x388D,0x50D3,0x815E,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x2068,0x895F,0x895F,0x711A,0x1024,0x0000,0x0000,0x0000,0x0000,0x1023,0x6919,0x895F,0x895F,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x2068,0x0001,0x0000,0x0802,0x388D,0x388D,0x0802,0x0000,0x0000,0x2869,0x1025,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x793C,0x895F,0x895F,0x793C,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x408E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x815E,0x895F,0x895F,0x815E,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x50D2,0x48D2,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-
-
-const uint16_t sd_main[576] = {
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x50D2,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x48B1,0x1847,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x2869,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x68F7,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x50D2,0x793B,0x895F,0x50D3,0x711A,0x895F,0x58D4,0x6918,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x7119,0x0000,0x408E,0x793C,0x0000,0x306B,0x895F,0x0000,0x2048,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x388D,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0000,0x388E,0x793C,0x0000,0x306B,0x895F,0x0000,0x2047,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0000,0x388E,0x793C,0x0000,0x306B,0x895F,0x0000,0x2047,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x58F5,0x895E,0x2047,0x50D3,0x895F,0x2869,0x48B0,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x68F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x2869,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x2869,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x1847,0x48B1,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x48B1,0x1847,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-
-
-
-
-    
-    
-    
-    const unsigned short reboot_main[144]  = {
-    
-    
-      0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020, 0x0020, 0x0841,
-      0x0000, 0x0000, 0x0000, 0x0803, 0x68F7, 0x895F, 0x895F, 0x60F6, 0x0801, 0x0000, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x308C, 0xB1BF, 0x50D2, 0x1846, 0x1847, 0x58D4, 0xB1BF, 0x2869, 0x0000, 0x0000,
-      0x0000, 0x1024, 0xB1BF, 0x0802, 0x0000, 0x0000, 0x0000, 0x0000, 0x1024, 0xA19F, 0x48B0, 0x0000,
-      0x0000, 0x58F5, 0x50D2, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1023, 0x997F, 0x60F7, 0x0000,
-      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x1825, 0x0000,
-      0x0000, 0x1023, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000,
-      0x0000, 0x60F7, 0x895F, 0x1023, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x40AF, 0x50D2, 0x0000,
-      0x0000, 0x58D4, 0xA19F, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0xA9BF, 0x1846, 0x0000,
-      0x0000, 0x0000, 0x388E, 0xA9BF, 0x40AF, 0x0802, 0x0802, 0x408E, 0xA99F, 0x40AF, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x0000, 0x1825, 0x791B, 0xA19F, 0xA19F, 0x793B, 0x1846, 0x0000, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020
-    };
-    
-    
-    const unsigned short bat_main[144] = {
-    
-      0x0020, 0x0020, 0x0020, 0x0000, 0x40AF, 0x48D1, 0x48D1, 0x40AE, 0x0000, 0x0020, 0x0020, 0x0841,
-      0x0000, 0x0000, 0x0803, 0x58D5, 0x306B, 0x0000, 0x0000, 0x306B, 0x58D5, 0x0802, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x40AF, 0x2048, 0x50D2, 0x50D3, 0x50D3, 0x50D2, 0x2048, 0x40AF, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x388D, 0x60F6, 0xA19F, 0x997F, 0x997F, 0xA19F, 0x58F5, 0x388D, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x40AF, 0x1023, 0x1825, 0x1825, 0x1825, 0x1825, 0x1024, 0x40AE, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x408F, 0x2048, 0x388E, 0x388D, 0x388D, 0x388E, 0x2049, 0x388E, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x388D, 0x60F6, 0xA19F, 0xA19F, 0xA19F, 0xA19F, 0x58F5, 0x388D, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x408F, 0x1825, 0x2869, 0x2048, 0x2048, 0x2869, 0x1846, 0x408E, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x40AF, 0x1023, 0x1025, 0x1025, 0x1025, 0x1025, 0x1024, 0x40AE, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x388E, 0x60F5, 0xA19F, 0x997F, 0x997F, 0xA19F, 0x58D4, 0x388D, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x308C, 0x48B0, 0x50D3, 0x50D3, 0x50D3, 0x50D3, 0x48B0, 0x306B, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x0000, 0x308A, 0x308B, 0x308B, 0x308B, 0x308B, 0x308A, 0x0000, 0x0000, 0x0020
-    };
-    
-    
-    const unsigned short conf_main[576]  = {
-    
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0801,0x0000,0x0000,0x0000,0x0000,0x0802,0x0000,0x0000,0x0000,0x0000,0x0802,0x0000,0x0000,0x0000,0x0000,0x0801,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x388C,0x60F6,0x0802,0x0000,0x0000,0x2048,0x68F7,0x1024,0x0000,0x0000,0x1024,0x68F7,0x2068,0x0000,0x0000,0x0802,0x60F5,0x388C,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x48B1,0x793C,0x1023,0x0000,0x0000,0x308C,0x815E,0x1846,0x0000,0x0000,0x1846,0x815E,0x308C,0x0000,0x0000,0x1023,0x793C,0x48B1,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x48B0,0x793C,0x1023,0x0000,0x0000,0x308C,0x815E,0x1846,0x0000,0x0000,0x1846,0x815E,0x308C,0x0000,0x0000,0x1023,0x793C,0x48B0,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x48B0,0x793C,0x1023,0x0000,0x0000,0x308C,0x815E,0x1846,0x0000,0x0000,0x1846,0x815E,0x308C,0x0000,0x0000,0x1023,0x793C,0x48B0,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x48B0,0x793C,0x1023,0x0000,0x0000,0x308C,0x815E,0x1846,0x0000,0x0000,0x1846,0x815E,0x308C,0x0000,0x0000,0x1023,0x793C,0x48B0,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x48B0,0x793C,0x1023,0x0000,0x0000,0x308C,0x815E,0x1846,0x0000,0x0000,0x1846,0x815E,0x308C,0x0000,0x0000,0x1023,0x793C,0x48B0,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x48B0,0x793C,0x1023,0x0000,0x0000,0x308C,0x815E,0x1846,0x0000,0x0000,0x1846,0x815E,0x308C,0x0000,0x0000,0x1023,0x793C,0x48B0,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x48B0,0x793C,0x1023,0x0000,0x0000,0x308C,0x815E,0x1846,0x0000,0x0000,0x1846,0x815E,0x308C,0x0000,0x0000,0x1023,0x793C,0x48B0,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x48B0,0x793C,0x0823,0x0000,0x0000,0x308C,0x815E,0x1846,0x0000,0x0000,0x1846,0x815E,0x308C,0x0000,0x0000,0x0823,0x793C,0x48B0,0x0000,0x0000,0x0000,
-    0x0000,0x0001,0x1845,0x50D2,0x793C,0x2048,0x1023,0x1025,0x408E,0x815E,0x286A,0x1024,0x1024,0x286A,0x815E,0x408E,0x1024,0x1023,0x2048,0x793C,0x50D2,0x1846,0x0001,0x0000,
-    0x0000,0x0001,0x408E,0x50D2,0x6918,0x40AF,0x2047,0x308C,0x48B1,0x7119,0x48B0,0x286A,0x2869,0x48B0,0x7119,0x48B1,0x308C,0x2047,0x40AF,0x6918,0x50D2,0x40AE,0x0801,0x0000,
-    0x0000,0x0822,0x50D2,0x60F6,0x60F7,0x58F5,0x286A,0x40AF,0x60F6,0x68F7,0x60F5,0x388C,0x388C,0x60F5,0x68F7,0x60F6,0x40AF,0x286A,0x58F5,0x60F7,0x60F6,0x50D2,0x0822,0x0000,
-    0x0000,0x1024,0x793C,0x895F,0x895F,0x895F,0x40AF,0x6919,0x895F,0x895F,0x915F,0x58D4,0x58D4,0x915F,0x895F,0x895F,0x68F7,0x48B0,0x915F,0x895F,0x895F,0x793C,0x1024,0x0000,
-    0x0000,0x1024,0x793C,0x60F6,0x388D,0x815E,0x40AF,0x6919,0x7119,0x308C,0x813D,0x58D4,0x58D4,0x813D,0x308C,0x7119,0x68F7,0x48B0,0x895E,0x388D,0x60F6,0x793C,0x1024,0x0000,
-    0x0000,0x1024,0x793C,0x6918,0x50D2,0x895E,0x40AF,0x6919,0x793B,0x48B1,0x815E,0x58D4,0x58D4,0x815E,0x48B1,0x793B,0x68F7,0x48B0,0x895F,0x50D2,0x6918,0x793C,0x1024,0x0000,
-    0x0000,0x1024,0x793C,0x895F,0x895F,0x895F,0x40AF,0x6918,0x895F,0x895F,0x895F,0x50D3,0x50D3,0x895F,0x895F,0x895F,0x60F7,0x48B0,0x895F,0x895F,0x895F,0x793C,0x1024,0x0000,
-    0x0000,0x1024,0x793C,0x895F,0x895F,0x895F,0x40AF,0x6919,0x895F,0x895F,0x915F,0x58D4,0x58D4,0x915F,0x895F,0x915F,0x68F7,0x48B0,0x895F,0x895F,0x895F,0x793C,0x1024,0x0000,
-    0x0000,0x1023,0x68F7,0x713B,0x711A,0x711A,0x388D,0x58F4,0x713B,0x711A,0x793B,0x48B0,0x48B0,0x793B,0x711A,0x793B,0x50D3,0x388D,0x713B,0x711A,0x713B,0x68F7,0x1023,0x0000,
-    0x0000,0x0000,0x0822,0x0823,0x0823,0x0823,0x0001,0x0802,0x0823,0x0823,0x0823,0x0801,0x0801,0x0823,0x0823,0x0823,0x0802,0x0001,0x0823,0x0823,0x0823,0x0822,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-const uint16_t Music[576] = {
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x58D4,0x895F,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x6919,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x793D,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x0001,0x2869,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388C,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x1846,0x895F,0x40B0,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0001,0x2047,0x0000,0x48B1,0x895F,0x2048,0x0000,0x0000,
-0x0000,0x0801,0x306B,0x388C,0x388C,0x388C,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x2048,0x895F,0x388D,0x0000,0x711A,0x711A,0x0000,0x0000,
-0x0000,0x68F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x58D4,0x815E,0x0823,0x2869,0x895F,0x2048,0x0000,
-0x0000,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x0802,0x815E,0x48B1,0x0000,0x813D,0x50D2,0x0000,
-0x0000,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x58F5,0x711A,0x0000,0x60F6,0x6918,0x0000,
-0x0000,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x40AF,0x815E,0x0000,0x50D2,0x793B,0x0000,
-0x0000,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x40B0,0x815E,0x0000,0x50D2,0x793B,0x0000,
-0x0000,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x58F5,0x711A,0x0000,0x60F6,0x6918,0x0000,
-0x0000,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x0822,0x815E,0x48B1,0x0000,0x813D,0x48D2,0x0000,
-0x0000,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x58F5,0x815E,0x0823,0x2869,0x895F,0x2048,0x0000,
-0x0000,0x0801,0x306B,0x388C,0x388C,0x388C,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x2048,0x895F,0x388C,0x0000,0x711A,0x711A,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0001,0x2047,0x0000,0x48B1,0x895F,0x2048,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388C,0x895F,0x895F,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x1846,0x895F,0x40AF,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x793D,0x895F,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x0001,0x2869,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x6919,0x895F,0x895F,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x58D4,0x895F,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-
-const uint16_t inatividade[576] = {
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0823,0x815E,0x895F,0x895F,0x895F,0x6919,0x0000,0x50D3,0x813D,0x895F,0x895F,0x793C,0x60F7,0x388D,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x1025,0x895F,0x895F,0x895F,0x895F,0x793C,0x0000,0x7119,0x895F,0x815E,0x815E,0x895F,0x895F,0x895F,0x815E,0x48B0,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x1025,0x895F,0x895F,0x895F,0x895F,0x793C,0x0000,0x1846,0x0001,0x0000,0x0000,0x0001,0x2869,0x58D4,0x895F,0x895F,0x711A,0x1024,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x1025,0x895F,0x895F,0x895F,0x895F,0x793C,0x0000,0x0000,0x2048,0x6918,0x6918,0x58D4,0x306B,0x0001,0x1024,0x6918,0x895F,0x813D,0x1024,0x0000,0x0000,0x0000,
-0x0000,0x60F6,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x40B0,0x0000,0x895F,0x895F,0x895F,0x895F,0x793C,0x306B,0x0000,0x58F5,0x895F,0x711A,0x0001,0x0000,0x0000,
-0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x388D,0x0823,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x6918,0x895F,0x48B0,0x0000,0x0000,
-0x0000,0x0001,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x60F6,0x6918,0x68F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x306A,0x1025,0x895F,0x815E,0x0823,0x0000,
-0x0000,0x0000,0x1025,0x815E,0x895F,0x895F,0x895F,0x711A,0x0001,0x40AF,0x895F,0x306B,0x306B,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x0001,0x58D4,0x895F,0x388D,0x0000,
-0x0000,0x58D4,0x0823,0x286A,0x895F,0x895F,0x813D,0x1024,0x2048,0x895F,0x895F,0x306B,0x306B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x306B,0x2869,0x895F,0x60F7,0x0000,
-0x0000,0x813D,0x6918,0x0000,0x48B1,0x895F,0x2869,0x1024,0x813D,0x895F,0x6918,0x0823,0x0823,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0801,0x895F,0x793C,0x0000,
-0x0000,0x895F,0x813D,0x0000,0x0000,0x1024,0x0001,0x711A,0x895F,0x895F,0x1825,0x2869,0x2869,0x0823,0x286A,0x286A,0x6918,0x895F,0x895F,0x6918,0x0000,0x815E,0x895F,0x0000,
-0x0000,0x895F,0x815E,0x0000,0x40AE,0x40AF,0x711A,0x895F,0x895F,0x895F,0x1845,0x2869,0x2869,0x0823,0x388C,0x388C,0x6918,0x895F,0x895F,0x6918,0x0000,0x815E,0x895F,0x0000,
-0x0000,0x793C,0x895F,0x0801,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x1825,0x1025,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0801,0x895F,0x793C,0x0000,
-0x0000,0x60F7,0x895F,0x2869,0x306B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x306B,0x2869,0x895F,0x60F7,0x0000,
-0x0000,0x388D,0x895F,0x58D4,0x0001,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x0001,0x58D4,0x895F,0x388D,0x0000,
-0x0000,0x0822,0x815E,0x895F,0x1025,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x286A,0x1025,0x895F,0x815E,0x0822,0x0000,
-0x0000,0x0000,0x48B0,0x895F,0x6918,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0001,0x6918,0x895F,0x48B0,0x0000,0x0000,
-0x0000,0x0000,0x0001,0x711A,0x895F,0x58F5,0x0000,0x286A,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x286A,0x0001,0x58F5,0x895F,0x711A,0x0001,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x1024,0x813D,0x895F,0x6918,0x1025,0x0001,0x306B,0x58D4,0x6918,0x6918,0x58D4,0x306B,0x0001,0x1025,0x6918,0x895F,0x813D,0x1024,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x1024,0x711A,0x895F,0x895F,0x58D4,0x2869,0x0801,0x0000,0x0000,0x0801,0x2869,0x58D4,0x895F,0x895F,0x711A,0x1024,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x48B0,0x815E,0x895F,0x895F,0x895F,0x815E,0x815E,0x895F,0x895F,0x895F,0x815E,0x48B0,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x388D,0x60F6,0x793C,0x895F,0x895F,0x793C,0x60F6,0x388D,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-
-
-   
-    
-
-    
-    const unsigned short high_main[144] = {
-    
-    
-      0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0020, 0x0020, 0x0020, 0x0000, 0x0000, 0x0020, 0x0841,
-      0x0000, 0x0000, 0x793D, 0x388E, 0x0000, 0x0000, 0x0000, 0x0000, 0x408E, 0x793C, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x997F, 0x997F, 0x895F, 0x2869, 0x2869, 0x915F, 0x997F, 0x997F, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x711A, 0x915F, 0x895F, 0x917F, 0x917F, 0x895F, 0x915F, 0x7119, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x0802, 0x815E, 0x895F, 0x895F, 0x895F, 0x895F, 0x815E, 0x0801, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x997F, 0x895F, 0x895F, 0x6919, 0x6919, 0x895F, 0x895F, 0x997F, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x997F, 0x895F, 0x915F, 0x58D5, 0x58F5, 0x915F, 0x895F, 0x997F, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x1825, 0x813E, 0x895F, 0x915F, 0x915F, 0x895F, 0x813E, 0x1825, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x58F5, 0x917F, 0x895F, 0x917F, 0x917F, 0x895F, 0x917F, 0x58D5, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x997F, 0x917F, 0x997F, 0x388D, 0x388D, 0x997F, 0x917F, 0x997F, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x915F, 0x50B2, 0x0000, 0x0000, 0x0000, 0x0000, 0x50D2, 0x895F, 0x0000, 0x0000,
-      0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0000, 0x0020
-    };
-    
-    const unsigned short sniffble[576]  = {
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0823,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x1024,0x40B0,0x6918,0x793B,0x711A,0x58F5,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x60F7,0x2048,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x2047,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x48B0,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x58D4,0x793B,0x2047,0x0000,0x0000,0x0000,
-    0x0000,0x1023,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x388D,0x0000,0x0000,0x0000,0x0823,0x308C,0x0802,0x0801,0x58F5,0x6919,0x0823,0x0000,0x0000,
-    0x0000,0x40AF,0x895F,0x895F,0x895F,0x793C,0x308C,0x60F6,0x895F,0x895F,0x895F,0x713B,0x1023,0x0000,0x0000,0x1825,0x793B,0x50D3,0x0001,0x1024,0x711A,0x48B0,0x0000,0x0000,
-    0x0001,0x68F7,0x895F,0x895F,0x895F,0x711A,0x0802,0x0822,0x58F5,0x895F,0x895F,0x895F,0x286A,0x0000,0x0823,0x0000,0x2068,0x793C,0x408E,0x0000,0x388D,0x793B,0x1024,0x0000,
-    0x0823,0x711A,0x895F,0x895F,0x815E,0x711A,0x0823,0x2047,0x1023,0x50D3,0x895F,0x895F,0x388D,0x1846,0x6919,0x2869,0x0000,0x40AF,0x793B,0x1024,0x0823,0x713B,0x388D,0x0000,
-    0x0823,0x711A,0x895F,0x6918,0x2869,0x58D4,0x1024,0x58D4,0x1846,0x1845,0x813D,0x895F,0x388D,0x0001,0x50D3,0x711A,0x1023,0x0823,0x793B,0x388D,0x0000,0x58D4,0x58D4,0x0000,
-    0x0823,0x711A,0x895F,0x793C,0x2869,0x0822,0x0001,0x1025,0x1024,0x60F6,0x895F,0x895F,0x388D,0x0000,0x1024,0x793B,0x388D,0x0000,0x58F5,0x58D4,0x0000,0x40AF,0x6919,0x0801,
-    0x0823,0x711A,0x895F,0x895F,0x793C,0x2048,0x0000,0x1024,0x6918,0x895F,0x895F,0x895F,0x388D,0x0000,0x0000,0x60F6,0x50D3,0x0000,0x48B1,0x60F7,0x0000,0x308C,0x711A,0x0823,
-    0x0823,0x711A,0x895F,0x895F,0x793C,0x2048,0x0000,0x1024,0x6918,0x895F,0x895F,0x895F,0x388D,0x0000,0x0000,0x60F6,0x50D2,0x0000,0x48B1,0x60F7,0x0000,0x308C,0x711A,0x0823,
-    0x0823,0x711A,0x895F,0x793C,0x2869,0x0822,0x0001,0x1025,0x1024,0x60F6,0x895F,0x895F,0x388D,0x0000,0x1024,0x793B,0x388C,0x0000,0x58F5,0x58D4,0x0000,0x40AF,0x6918,0x0801,
-    0x0823,0x711A,0x895F,0x6918,0x2869,0x58D4,0x1024,0x58D4,0x1846,0x1845,0x813D,0x895F,0x388D,0x0001,0x58D4,0x711A,0x0823,0x1023,0x793B,0x388C,0x0000,0x58F5,0x58D4,0x0000,
-    0x0823,0x711A,0x895F,0x895F,0x815E,0x711A,0x0823,0x2047,0x1023,0x50D3,0x895F,0x895F,0x388D,0x1846,0x6919,0x2068,0x0000,0x40AF,0x713B,0x1023,0x1023,0x793B,0x388C,0x0000,
-    0x0001,0x68F7,0x895F,0x895F,0x895F,0x711A,0x0802,0x0822,0x58F5,0x895F,0x895F,0x895F,0x286A,0x0000,0x0802,0x0000,0x2869,0x793C,0x388D,0x0000,0x388E,0x793B,0x1024,0x0000,
-    0x0000,0x40AF,0x895F,0x895F,0x895F,0x793C,0x308C,0x60F7,0x895F,0x895F,0x895F,0x713B,0x1023,0x0000,0x0000,0x1846,0x793B,0x50D3,0x0000,0x1024,0x713B,0x40B0,0x0000,0x0000,
-    0x0000,0x1023,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x388D,0x0000,0x0000,0x0000,0x1023,0x308B,0x0001,0x0802,0x60F6,0x6918,0x0823,0x0000,0x0000,
-    0x0000,0x0000,0x2047,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x48B0,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x58F5,0x793B,0x1847,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x1024,0x40B0,0x6918,0x793B,0x711A,0x58F5,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1847,0x60F7,0x2047,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0823,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    
-    
-    const unsigned short dispoble[576]  = {
-    
-    0x0000,0x0000,0x0823,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1024,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x286A,0x711A,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x793B,0x40AF,0x0000,0x0000,0x0000,
-    0x0823,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2047,0x0000,0x0000,
-    0x1846,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x306B,0x0000,0x0000,
-    0x1846,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793B,0x6918,0x68F7,0x68F7,0x68F7,0x68F7,0x68F7,0x68F7,0x68F7,0x6918,0x2869,0x0000,0x0000,
-    0x1846,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x1024,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0000,0x0000,0x0000,
-    0x1846,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x1023,0x408E,0x7119,0x711A,0x711A,0x711A,0x711A,0x711A,0x711A,0x711A,0x6918,0x2869,0x0000,0x0000,
-    0x1846,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x1024,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x915F,0x60F6,0x0000,0x0000,
-    0x1846,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x1024,0x793C,0x895F,0x895F,0x793B,0x40B0,0x306B,0x306B,0x306B,0x306B,0x306B,0x2048,0x0000,0x0000,
-    0x1846,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x915F,0x58D4,0x1024,0x793C,0x895F,0x793C,0x2048,0x1024,0x306A,0x306B,0x306B,0x306B,0x306B,0x306A,0x1024,0x0000,
-    0x1025,0x60F7,0x7119,0x6919,0x6919,0x6919,0x6919,0x6919,0x7119,0x40AF,0x1024,0x793C,0x895F,0x58D4,0x1023,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x0822,
-    0x0000,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0801,0x1024,0x793C,0x895F,0x48B0,0x1846,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1845,
-    0x1024,0x60F6,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6919,0x40AF,0x1024,0x793C,0x895F,0x48B0,0x1846,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793D,0x1846,
-    0x0801,0x60F6,0x917F,0x915F,0x915F,0x915F,0x915F,0x915F,0x917F,0x58D4,0x1024,0x793C,0x895F,0x48B0,0x1846,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793D,0x1846,
-    0x0000,0x1024,0x50D2,0x60F7,0x60F7,0x60F7,0x60F7,0x60F7,0x60F7,0x388E,0x1024,0x793C,0x895F,0x48B0,0x1846,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793D,0x1846,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0823,0x0802,0x1024,0x793C,0x895F,0x48B0,0x1846,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793D,0x1846,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x7119,0x48B0,0x1024,0x793C,0x895F,0x48B0,0x1846,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793D,0x1846,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x915F,0x58D4,0x1024,0x793C,0x895F,0x48B0,0x1846,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x6918,0x915F,0x58D4,0x0001,0x2047,0x2048,0x1024,0x1846,0x793C,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x793B,0x1845,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x813D,0x895F,0x895F,0x58D4,0x0802,0x388D,0x40AF,0x2047,0x0001,0x1846,0x1847,0x1847,0x1847,0x1847,0x1847,0x1847,0x1846,0x0001,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x50D3,0x895F,0x895F,0x895F,0x50D3,0x1024,0x813D,0x917F,0x48B1,0x0823,0x40AF,0x40B0,0x40B0,0x40B0,0x40B0,0x40B0,0x40B0,0x408E,0x0823,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x2869,0x2869,0x2869,0x1845,0x0001,0x50D3,0x815E,0x40B0,0x1846,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x915F,0x813D,0x1825,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x1845,0x0823,0x0802,0x58D4,0x793D,0x793D,0x793D,0x793D,0x793D,0x793D,0x50D3,0x0001,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0801,0x1845,0x1846,0x1846,0x1846,0x1846,0x1825,0x0001,0x0000
-    };
-    
-    
-    
-    
-    
-    
-    
-    const unsigned short sniff_wifi[576] = {
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x1024,0x308B,0x2869,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x2869,0x306B,0x1023,0x0000,0x0000,
-    0x0000,0x1024,0x6918,0x895F,0x895F,0x48B1,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48D2,0x895F,0x895F,0x6918,0x1023,0x0000,
-    0x0000,0x308B,0x895F,0x895F,0x895F,0x793B,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x793C,0x895F,0x895F,0x895F,0x306B,0x0000,
-    0x0000,0x2869,0x895F,0x895F,0x895F,0x793B,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x793C,0x895F,0x895F,0x895E,0x2068,0x0000,
-    0x0000,0x0001,0x48B1,0x793B,0x793B,0x815E,0x48B1,0x0001,0x0000,0x1023,0x50D3,0x58F5,0x58F5,0x50D3,0x0823,0x0000,0x0001,0x48D1,0x815E,0x793B,0x793B,0x48B0,0x0001,0x0000,
-    0x0000,0x0000,0x0000,0x1023,0x1023,0x48B1,0x815E,0x48B1,0x1023,0x48B1,0x895F,0x895F,0x895F,0x895F,0x48B0,0x1023,0x48B1,0x815E,0x48B0,0x0823,0x1023,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D3,0x895F,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793B,0x895F,0x50D3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x895F,0x895F,0x895F,0x895F,0x793B,0x60F7,0x60F7,0x793B,0x895F,0x895F,0x895F,0x895F,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x6919,0x308B,0x1825,0x388D,0x388D,0x1025,0x308C,0x7119,0x895F,0x895F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x60F7,0x0823,0x0000,0x308C,0x895F,0x895F,0x306B,0x0000,0x1023,0x6918,0x793C,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x68F7,0x1023,0x0000,0x306B,0x895F,0x895F,0x286A,0x0000,0x1024,0x6918,0x793C,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x711A,0x388C,0x1845,0x388C,0x308C,0x1845,0x388D,0x711A,0x895F,0x895F,0x48B0,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x895F,0x895F,0x895F,0x895F,0x793C,0x6918,0x6918,0x793C,0x895F,0x895F,0x895F,0x895E,0x306A,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x58D4,0x895F,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x895F,0x50D3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x1024,0x1024,0x48D1,0x815E,0x40B0,0x0823,0x48B0,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0823,0x48B1,0x815E,0x48B1,0x1024,0x1024,0x0000,0x0000,0x0000,
-    0x0000,0x0001,0x48D2,0x793C,0x793C,0x815E,0x48B0,0x0000,0x0000,0x1023,0x50D2,0x58D4,0x58D4,0x50D2,0x0823,0x0000,0x0001,0x48B1,0x815E,0x793C,0x793C,0x48B1,0x0001,0x0000,
-    0x0000,0x2869,0x895F,0x895F,0x895F,0x793B,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x793C,0x895F,0x895F,0x895F,0x2869,0x0000,
-    0x0000,0x306B,0x895F,0x895F,0x895F,0x793B,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x793C,0x895F,0x895F,0x895F,0x286A,0x0000,
-    0x0000,0x1023,0x6918,0x895F,0x895E,0x48B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x68F7,0x0823,0x0000,
-    0x0000,0x0000,0x0823,0x306B,0x2068,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x2869,0x306A,0x0823,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    
-    
-    
-    const unsigned short select_wifi[144]  = {
-    0x0000,0x0802,0x40B0,0x48D2,0x48D2,0x48D2,0x48D2,0x48D2,0x48D2,0x50D2,0x50D3,0x308B,
-    0x0822,0x1846,0x308C,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x308C,0x58D4,0x58D4,
-    0x50D2,0x813D,0x793C,0x793C,0x793C,0x793C,0x793C,0x793C,0x793C,0x7119,0x308C,0x50D2,
-    0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x388D,0x50D2,
-    0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x815E,0x813D,0x388D,0x50D2,
-    0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x388D,0x815E,0x813D,0x388D,0x50D2,
-    0x58D4,0x895F,0x60F7,0x6918,0x895F,0x58F5,0x308C,0x793B,0x895F,0x793D,0x388D,0x50D2,
-    0x58D4,0x895F,0x711A,0x308B,0x40AF,0x308C,0x793B,0x895F,0x895F,0x793D,0x388D,0x50D2,
-    0x58D4,0x895F,0x895F,0x711A,0x40AF,0x793B,0x895F,0x895F,0x895F,0x793D,0x388D,0x50D2,
-    0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793D,0x308C,0x48B0,
-    0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0802,
-    0x308B,0x58D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x58D4,0x48B1,0x0822,0x0000
-    };
-    
-    
-    
-    
-    const unsigned short moni_wifi[576]= {
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x1025,0x2048,0x2068,0x1846,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x60F6,0x793C,0x895F,0x895F,0x813D,0x6919,0x388E,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0801,0x48D2,0x815E,0x915F,0x895F,0x813D,0x813D,0x895F,0x915F,0x895F,0x60F7,0x1025,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x48D1,0x895F,0x895F,0x60F7,0x306B,0x1825,0x1025,0x2068,0x50D3,0x815E,0x895F,0x6918,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x286A,0x815E,0x895F,0x50D2,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x813D,0x895F,0x48B1,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x60F6,0x915F,0x60F7,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x895F,0x793C,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x1024,0x793C,0x895F,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x2047,0x815E,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6918,0x915F,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x2048,0x895E,0x813D,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x6918,0x915F,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x1825,0x813D,0x895F,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x793B,0x895F,0x308C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0001,0x6918,0x915F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x895F,0x813D,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x388D,0x895F,0x815E,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x793B,0x895F,0x50D3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0801,0x60F6,0x895F,0x815E,0x48B1,0x1845,0x0801,0x0001,0x1024,0x388D,0x793B,0x895F,0x895E,0x308C,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x1024,0x60F7,0x895F,0x895F,0x813D,0x6919,0x6918,0x793C,0x895F,0x895F,0x813D,0x895F,0x813D,0x793B,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0822,0x40B0,0x793B,0x895F,0x895F,0x895F,0x895F,0x813D,0x50D3,0x2869,0x793B,0x895F,0x895F,0x793D,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x286A,0x388E,0x40AE,0x306B,0x1825,0x0000,0x0801,0x6918,0x895F,0x895F,0x895F,0x793C,0x2869,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x711A,0x895F,0x895F,0x895F,0x793C,0x2048,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x793B,0x895F,0x895F,0x895F,0x793B,0x2048,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x793B,0x895F,0x895F,0x895F,0x711A,0x1024,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x793C,0x895F,0x895F,0x711A,0x1024,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x793C,0x711A,0x1847,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x1024,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    
-    const unsigned short atack_wifi[576]= {
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x2048,0x388D,0x40AF,0x40AF,0x388D,0x2048,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x48D1,0x711A,0x815E,0x895F,0x895F,0x895F,0x895F,0x815E,0x711A,0x48B1,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0802,0x48B0,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x48B0,0x0802,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x1024,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x1023,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0822,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x0802,0x0000,0x0000,
-    0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B0,0x0000,0x0000,
-    0x0000,0x1846,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793D,0x1846,0x0000,
-    0x0000,0x48B0,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40B0,0x0000,
-    0x0001,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x0001,
-    0x1024,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x1023,
-    0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x793C,0x793C,0x793C,0x793C,0x813D,0x895F,0x895F,0x815E,0x793C,0x793C,0x793C,0x793C,0x815E,0x895F,0x895F,0x895F,0x793B,0x1024,
-    0x1023,0x713B,0x895F,0x895F,0x895F,0x68F7,0x1025,0x1024,0x1024,0x1023,0x308B,0x895F,0x895F,0x48B1,0x1023,0x1024,0x1024,0x1024,0x50D2,0x895F,0x895F,0x895F,0x711A,0x0823,
-    0x0001,0x60F7,0x895F,0x895F,0x895F,0x68F7,0x0000,0x0000,0x0000,0x0000,0x2869,0x895F,0x895F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x60F6,0x0001,
-    0x0000,0x40AF,0x895F,0x895F,0x895F,0x815E,0x2869,0x0000,0x0000,0x0001,0x58F5,0x895F,0x895F,0x711A,0x1024,0x0000,0x0000,0x1025,0x713B,0x895F,0x895F,0x895F,0x40AE,0x0000,
-    0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x793B,0x388E,0x286A,0x58D4,0x895F,0x60F7,0x60F7,0x895F,0x6918,0x308B,0x308C,0x6918,0x895F,0x895F,0x895F,0x793C,0x1024,0x0000,
-    0x0000,0x0000,0x40AF,0x895F,0x815E,0x7119,0x895F,0x895F,0x895F,0x895F,0x60F7,0x0802,0x0802,0x60F6,0x895F,0x895F,0x895F,0x895F,0x711A,0x813D,0x895F,0x408E,0x0000,0x0000,
-    0x0000,0x0000,0x0801,0x58D4,0x58F5,0x48B0,0x895F,0x895F,0x895F,0x895F,0x308C,0x2048,0x2068,0x308B,0x815E,0x895F,0x895F,0x895F,0x50D2,0x50D3,0x58D4,0x0001,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0822,0x1024,0x40AF,0x895F,0x895F,0x895F,0x895F,0x813D,0x815E,0x815E,0x813D,0x895F,0x895F,0x895F,0x895F,0x48B1,0x0823,0x0802,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48D2,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48D2,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B1,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x793D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x50D2,0x711A,0x815E,0x895F,0x895F,0x895F,0x895F,0x815E,0x793B,0x58D4,0x2069,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x2048,0x308C,0x40AF,0x40AF,0x388D,0x2869,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    
-    
-    
-    
-    
-    
-    const unsigned short timeout[576] = {
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x50D3,0x388E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x408E,0x793C,0x895F,0x793B,0x388E,0x2048,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x1846,0x0802,0x58F5,0x895F,0x895F,0x815E,0x813D,0x815E,0x6919,0x308C,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x286A,0x711A,0x1025,0x0802,0x408E,0x793B,0x58D4,0x1825,0x308B,0x60F7,0x815E,0x58F4,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x50D2,0x1847,0x0001,0x0000,0x0000,0x1024,0x0823,0x0000,0x0000,0x0001,0x388D,0x813D,0x60F6,0x0823,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x2068,0x48B1,0x2068,0x0000,0x0000,0x0000,0x0000,0x1025,0x1025,0x0000,0x0000,0x0000,0x0000,0x286A,0x813D,0x50D2,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x1825,0x793C,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F5,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x40B0,0x813D,0x2048,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x1825,0x308C,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x793B,0x50D3,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0822,0x6918,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x713B,0x0822,0x0000,0x0000,
-    0x0000,0x0000,0x1846,0x813D,0x48B1,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x48B1,0x813D,0x1846,0x0000,0x0000,
-    0x0000,0x0000,0x2047,0x815E,0x815E,0x60F7,0x0802,0x0000,0x0000,0x0000,0x0000,0x58D4,0x793B,0x1025,0x0000,0x0000,0x0000,0x0802,0x60F7,0x815E,0x815E,0x2047,0x0000,0x0000,
-    0x0000,0x0000,0x1846,0x813D,0x58D4,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x793C,0x6918,0x1024,0x0000,0x0000,0x0000,0x2048,0x58D4,0x813D,0x1846,0x0000,0x0000,
-    0x0000,0x0000,0x1023,0x793C,0x48B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x793C,0x6918,0x1024,0x0000,0x0000,0x0000,0x48B0,0x793C,0x1023,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x60F6,0x6919,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x793C,0x6918,0x0823,0x0000,0x0802,0x6919,0x60F6,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x306B,0x815E,0x308C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x60F6,0x1025,0x0000,0x308B,0x815E,0x306B,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0801,0x60F6,0x793B,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x1846,0x793B,0x60F6,0x0801,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x1846,0x793B,0x7119,0x2047,0x0000,0x0000,0x0000,0x1846,0x1845,0x0000,0x0000,0x0000,0x2047,0x7119,0x793B,0x1846,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x711A,0x793C,0x40B0,0x1825,0x0801,0x60F5,0x58F5,0x0801,0x1825,0x40B0,0x793C,0x711A,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x50D3,0x813D,0x813D,0x6918,0x813D,0x813D,0x6918,0x813D,0x813D,0x50D3,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x40AF,0x60F5,0x6918,0x6918,0x60F5,0x40AF,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    
-    const unsigned short brilho[576]= {
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308B,0x308B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F4,0x58F4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F4,0x58F4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x286A,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x286A,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x388D,0x813D,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x1847,0x1847,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x813D,0x388D,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x40AF,0x815E,0x388D,0x0000,0x0000,0x1825,0x388C,0x48B0,0x48B1,0x388D,0x1825,0x0000,0x0000,0x388D,0x815E,0x40AF,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x306B,0x0802,0x48B1,0x793C,0x895F,0x895F,0x813D,0x793C,0x793C,0x48B1,0x0822,0x306B,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x58F5,0x895F,0x895F,0x895F,0x895F,0x58F5,0x1024,0x40AF,0x793C,0x58F5,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x2069,0x793C,0x48B1,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x40AF,0x793C,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x388C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x1024,0x793C,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x308B,0x58F4,0x58F4,0x58D4,0x1847,0x48B0,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0001,0x6918,0x48B1,0x1847,0x58D4,0x58F4,0x58F4,0x308B,
-    0x308B,0x58F4,0x58F4,0x58D4,0x1847,0x48B0,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0001,0x6918,0x48B1,0x1847,0x58D4,0x58F4,0x58F4,0x308B,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x388C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x1024,0x793C,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x40AF,0x793C,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x2069,0x793C,0x48B1,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x58F5,0x895F,0x895F,0x895F,0x895F,0x58F5,0x1024,0x40AF,0x793C,0x58F5,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x306B,0x0802,0x48B1,0x793C,0x895F,0x895F,0x813D,0x793C,0x793C,0x48B1,0x0802,0x306B,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x40AF,0x815E,0x388D,0x0000,0x0000,0x1825,0x388C,0x48B0,0x48B1,0x388D,0x1825,0x0000,0x0000,0x388D,0x815E,0x40AF,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x388D,0x813D,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x1847,0x1847,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x813D,0x388D,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x286A,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x286A,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F4,0x58F4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F4,0x58F4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308B,0x308B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    
-    
-    
-    
-    
-    const unsigned short infra1[144] = {
-    0x48B1,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x6918,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x6918,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x0802,
-    0x711A,0x793C,0x40AF,0x0001,0x0000,0x0000,0x0000,0x1024,0x1025,0x306A,0x388C,0x40AF,
-    0x711A,0x895F,0x895F,0x388D,0x0000,0x388C,0x2048,0x58D4,0x286A,0x58F5,0x308B,0x60F5,
-    0x711A,0x895F,0x895F,0x60F7,0x0000,0x50D2,0x388C,0x58D4,0x286A,0x58F5,0x286A,0x60F7,
-    0x711A,0x895F,0x895F,0x60F7,0x0000,0x50D2,0x388C,0x58D4,0x286A,0x58F5,0x286A,0x60F7,
-    0x7119,0x895F,0x895F,0x408E,0x0000,0x388D,0x2048,0x58D4,0x286A,0x58F5,0x306B,0x60F6,
-    0x7119,0x813D,0x48D2,0x0802,0x0000,0x0000,0x0000,0x1024,0x1024,0x286A,0x308B,0x40AF,
-    0x6918,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,
-    0x68F7,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x50D2,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    
-    
-    const unsigned short ar[576] = {
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x306B,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x306B,0x0000,
-    0x0802,0x7119,0x915F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x915F,0x915F,0x915F,0x915F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x915F,0x7119,0x0802,
-    0x0823,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793B,0x7119,0x7119,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0823,
-    0x0823,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x388E,0x388E,0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0823,
-    0x0823,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0823,
-    0x0823,0x711A,0x895F,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x815E,0x895F,0x711A,0x0823,
-    0x0823,0x711A,0x6918,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x388D,0x6918,0x711A,0x0823,
-    0x0823,0x711A,0x711A,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x48B0,0x711A,0x711A,0x0823,
-    0x0822,0x711A,0x793B,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x793B,0x711A,0x0822,
-    0x0000,0x40AF,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x40AF,0x0000,
-    0x0000,0x0000,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x2068,0x1845,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x1846,0x0000,0x1023,0x58D4,0x1024,0x0000,0x0000,0x308C,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x58F5,0x0823,0x0000,0x0802,0x50D2,0x306B,0x0000,0x1024,0x58F5,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x40AF,0x48B0,0x0001,0x0000,0x1024,0x58F5,0x1024,0x0000,0x40AF,0x48B0,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x58F5,0x1024,0x0000,0x1846,0x40AF,0x0001,0x0000,0x0823,0x58F5,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1845,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1845,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    
-    const unsigned short audio[576] = {
-    000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x2869,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x1825,0x1825,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x2869,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x2869,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x286A,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2869,0x0000,0x0000,
-    0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x895F,0x815E,0x895F,0x895F,0x895F,0x286A,0x286A,0x895F,0x895F,0x895F,0x815E,0x895F,0x895F,0x895F,0x895F,0x48B1,0x0000,0x0000,
-    0x0000,0x0000,0x48B1,0x895F,0x895F,0x711A,0x388C,0x2047,0x306B,0x6918,0x895F,0x286A,0x286A,0x895F,0x6918,0x306B,0x2047,0x388C,0x711A,0x895F,0x895F,0x48B1,0x0000,0x0000,
-    0x0000,0x0000,0x48B1,0x895F,0x793C,0x1846,0x1025,0x308C,0x1846,0x1024,0x7119,0x286A,0x286A,0x7119,0x1024,0x1846,0x308C,0x1025,0x1846,0x793C,0x895F,0x48B1,0x0000,0x0000,
-    0x0000,0x0000,0x48B1,0x915F,0x50D2,0x0823,0x50D3,0x388D,0x50D3,0x1025,0x40AE,0x286A,0x286A,0x40AE,0x1025,0x50D3,0x388D,0x50D3,0x0823,0x50D2,0x915F,0x48B1,0x0000,0x0000,
-    0x0000,0x0000,0x48B1,0x915F,0x40B0,0x1825,0x50D2,0x2048,0x48B1,0x2047,0x308C,0x286A,0x286A,0x308C,0x2047,0x48B1,0x2048,0x50D2,0x1825,0x40B0,0x915F,0x48B1,0x0000,0x0000,
-    0x0000,0x0000,0x48B1,0x915F,0x60F7,0x0802,0x388E,0x50D2,0x40AF,0x0802,0x50D3,0x286A,0x286A,0x50D3,0x0802,0x40AF,0x50D2,0x388E,0x0802,0x60F7,0x915F,0x48B1,0x0000,0x0000,
-    0x0000,0x0000,0x48B1,0x895F,0x895F,0x48B0,0x0823,0x0823,0x0822,0x388D,0x815E,0x286A,0x286A,0x815E,0x388D,0x0822,0x0823,0x0823,0x48B0,0x895F,0x895F,0x48B1,0x0000,0x0000,
-    0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x711A,0x60F6,0x6919,0x895F,0x895F,0x286A,0x286A,0x895F,0x895F,0x6919,0x60F6,0x711A,0x895F,0x895F,0x895F,0x48B1,0x0000,0x0000,
-    0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x711A,0x60F6,0x6919,0x895F,0x895F,0x286A,0x286A,0x895F,0x895F,0x6919,0x60F6,0x711A,0x895F,0x895F,0x895F,0x48B1,0x0000,0x0000,
-    0x0000,0x0000,0x48B1,0x895F,0x895F,0x48B0,0x0823,0x0823,0x0822,0x388D,0x815E,0x286A,0x286A,0x815E,0x388D,0x0822,0x0823,0x0823,0x48B0,0x895F,0x895F,0x48B1,0x0000,0x0000,
-    0x0000,0x0000,0x48B1,0x915F,0x60F7,0x0802,0x388E,0x50D2,0x40AF,0x0802,0x50D3,0x286A,0x286A,0x50D3,0x0802,0x40AF,0x50D2,0x388E,0x0802,0x60F7,0x915F,0x48B1,0x0000,0x0000,
-    0x0000,0x0000,0x48B1,0x915F,0x40B0,0x1825,0x50D2,0x2048,0x48B1,0x2047,0x308C,0x286A,0x286A,0x308C,0x2047,0x48B1,0x2048,0x50D2,0x1825,0x40B0,0x915F,0x48B1,0x0000,0x0000,
-    0x0000,0x0000,0x48B1,0x915F,0x50D2,0x0823,0x50D3,0x388D,0x50D3,0x1025,0x40AE,0x286A,0x286A,0x40AE,0x1025,0x50D3,0x388D,0x50D3,0x0823,0x50D2,0x915F,0x48B1,0x0000,0x0000,
-    0x0000,0x0000,0x48B1,0x895F,0x793C,0x1846,0x1025,0x308C,0x1846,0x1024,0x7119,0x286A,0x286A,0x7119,0x1024,0x1846,0x308C,0x1025,0x1846,0x793C,0x895F,0x48B1,0x0000,0x0000,
-    0x0000,0x0000,0x48B1,0x895F,0x895F,0x711A,0x388C,0x2047,0x306B,0x6918,0x895F,0x286A,0x286A,0x895F,0x6918,0x306B,0x2047,0x388C,0x711A,0x895F,0x895F,0x48B1,0x0000,0x0000,
-    0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x895F,0x815E,0x895F,0x895F,0x895F,0x286A,0x286A,0x895F,0x895F,0x895F,0x815E,0x895F,0x895F,0x895F,0x895F,0x48B1,0x0000,0x0000,
-    0x0000,0x0000,0x2869,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x286A,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2869,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x2869,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x1825,0x1825,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x2869,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    
-    
-    
-    const unsigned short tvs[576] = {
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0001,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0001,0x0000,0x0000,
-    0x0000,0x0000,0x40AE,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x40AE,0x0000,0x0000,
-    0x0000,0x0000,0x50D3,0x915F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x915F,0x50D3,0x0000,0x0000,
-    0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,
-    0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x7119,0x388E,0x388D,0x48B0,0x813D,0x58D4,0x711B,0x895F,0x58D4,0x711A,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,
-    0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x711A,0x286A,0x0802,0x40AF,0x813D,0x306A,0x40AF,0x793C,0x1825,0x68F7,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,
-    0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x1846,0x813E,0x895F,0x50D3,0x2047,0x50D2,0x1847,0x813D,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,
-    0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x1846,0x813D,0x895F,0x793B,0x1845,0x1024,0x40AE,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,
-    0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x1846,0x813D,0x895F,0x895F,0x308B,0x0000,0x68F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,
-    0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x408E,0x815E,0x895F,0x895F,0x60F7,0x388C,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,
-    0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,
-    0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,
-    0x0000,0x0000,0x48B0,0x815E,0x813D,0x895F,0x895F,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x895F,0x895F,0x813D,0x815E,0x48B0,0x0000,0x0000,
-    0x0000,0x0000,0x0802,0x1845,0x2869,0x793B,0x40AF,0x1825,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1825,0x48B0,0x793B,0x2068,0x1845,0x0802,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x2047,0x58D4,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x58D4,0x1846,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    const unsigned short readnfc[576] = {
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x2869,0x308B,0x306B,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x50D3,0x60F6,0x48B1,0x388C,0x286A,0x306B,0x388E,0x0822,0x0802,0x2048,0x388D,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0001,0x50D2,0x50D3,0x1025,0x0000,0x0000,0x0000,0x2047,0x40B0,0x58F5,0x60F6,0x58F4,0x40AE,0x2869,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0802,0x60F6,0x2048,0x0000,0x0000,0x0000,0x0000,0x0801,0x6918,0x1846,0x0001,0x0000,0x0000,0x0000,0x0000,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x58F5,0x1846,0x0000,0x0000,0x0001,0x0802,0x388E,0x0000,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x40AF,0x2047,0x0001,0x0000,0x0000,0x0000,
-    0x0000,0x2869,0x40AF,0x0000,0x0802,0x1825,0x50D2,0x1024,0x60F7,0x0000,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x50D2,0x40AF,0x60F7,0x1024,0x0000,0x0000,
-    0x0000,0x58F5,0x0802,0x2869,0x1023,0x60F6,0x2047,0x40AF,0x48B0,0x1846,0x50D2,0x1024,0x0000,0x306B,0x58F5,0x388E,0x0000,0x1825,0x48B1,0x0000,0x1846,0x48B0,0x0000,0x0000,
-    0x0000,0x60F6,0x0000,0x306B,0x308C,0x60F5,0x0802,0x58F5,0x306B,0x306A,0x388C,0x2869,0x0000,0x6918,0x0802,0x308B,0x60F5,0x0802,0x813D,0x1024,0x0001,0x58D4,0x0000,0x0000,
-    0x0000,0x60F6,0x0000,0x2869,0x388D,0x58F4,0x0802,0x60F6,0x286A,0x306B,0x1847,0x40AF,0x0000,0x286A,0x50D3,0x0000,0x2047,0x68F7,0x711A,0x1024,0x0000,0x60F6,0x0000,0x0000,
-    0x0000,0x58F5,0x0801,0x388D,0x1024,0x60F7,0x1825,0x48B1,0x40AE,0x2047,0x0001,0x60F7,0x2048,0x408E,0x711A,0x50D2,0x0000,0x1024,0x40B0,0x40AE,0x0000,0x60F6,0x0000,0x0000,
-    0x0000,0x286A,0x388E,0x0000,0x0823,0x286A,0x48B1,0x1846,0x60F6,0x0001,0x0000,0x2048,0x7119,0x286A,0x7119,0x50D3,0x1846,0x0000,0x0000,0x0000,0x0000,0x50D2,0x1024,0x0000,
-    0x0000,0x0000,0x60F6,0x1825,0x0000,0x0000,0x1845,0x0802,0x50D3,0x0000,0x0000,0x0000,0x60F6,0x711A,0x306B,0x48B1,0x40B0,0x0000,0x0000,0x0000,0x0000,0x1846,0x48B1,0x0000,
-    0x0000,0x0000,0x0822,0x60F7,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x58F5,0x40AF,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x68F7,0x0000,
-    0x0000,0x0000,0x0000,0x0801,0x50D3,0x50D2,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x388D,0x50D3,0x0000,0x0000,0x0000,0x408E,0x408E,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x58D4,0x60F6,0x40B0,0x306B,0x2068,0x286A,0x388D,0x50D2,0x60F7,0x40B0,0x0000,0x48B0,0x388E,0x286A,0x58F4,0x48B0,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x306B,0x388D,0x308C,0x2869,0x1024,0x0000,0x0000,0x0000,0x0822,0x388D,0x388C,0x1023,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-const unsigned short raw[576] = {
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1045,0x1025,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1846,0x793C,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1846,0x895F,0x793B,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1846,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1846,0x895F,0x895F,0x895F,0x7119,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1846,0x2048,0x2048,0x2048,0x2048,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x2048,0x2048,0x2048,0x2048,0x2048,0x2048,0x2048,0x2048,0x2048,0x2048,0x2048,0x2048,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x50D3,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x50D3,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x306B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x306B,0x0000,0x0000,
-0x0000,0x0000,0x40AF,0x895F,0x895F,0x58F5,0x58F5,0x60F7,0x895F,0x895F,0x895F,0x60F6,0x813D,0x7119,0x713B,0x793B,0x60F6,0x895F,0x58F5,0x895F,0x895F,0x40AF,0x0000,0x0000,
-0x0000,0x0000,0x40AF,0x895F,0x895F,0x0000,0x40AE,0x1846,0x50D2,0x895F,0x711A,0x0000,0x40AF,0x50D2,0x308C,0x388D,0x0000,0x6919,0x1024,0x895F,0x895F,0x40AF,0x0000,0x0000,
-0x0000,0x0000,0x40AF,0x895F,0x895F,0x0000,0x388C,0x1024,0x58F4,0x895F,0x388D,0x308C,0x0823,0x6919,0x1825,0x1025,0x1845,0x286A,0x308C,0x895F,0x895F,0x40AF,0x0000,0x0000,
-0x0000,0x0000,0x40AF,0x895F,0x895F,0x0000,0x50D2,0x0823,0x793D,0x895E,0x0802,0x0823,0x0000,0x58F5,0x0802,0x1024,0x48D2,0x0000,0x58D4,0x895F,0x895F,0x40AF,0x0000,0x0000,
-0x0000,0x0000,0x40AF,0x895F,0x895F,0x0000,0x895F,0x388D,0x306A,0x58F5,0x2048,0x813D,0x50D2,0x2869,0x2869,0x388D,0x711A,0x0000,0x793C,0x895F,0x895F,0x40AF,0x0000,0x0000,
-0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x286A,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x48B1,0x793C,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x793C,0x48B1,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-
-    
-    
-    
-    const unsigned short control[576] = {
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x1846,0x0822,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F7,0x60F7,0x0001,0x0000,0x0000,0x0000,0x0000,0x0822,0x1846,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x1024,0x793C,0x50D3,0x0000,0x0000,0x0000,0x0000,0x0802,0x711A,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x50D2,0x793C,0x1025,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0802,0x6918,0x815E,0x2047,0x0000,0x0000,0x0000,0x0802,0x711A,0x711A,0x0802,0x0000,0x0000,0x0000,0x1846,0x813D,0x6918,0x0802,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x306B,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0802,0x711A,0x711A,0x0802,0x0000,0x0000,0x0000,0x50D3,0x895F,0x306B,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0802,0x6918,0x815E,0x2047,0x0000,0x0000,0x0801,0x6918,0x6918,0x0801,0x0000,0x0000,0x1846,0x813D,0x6918,0x0802,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x813D,0x306B,0x0000,0x0000,0x0000,0x1825,0x1825,0x0000,0x0000,0x0000,0x286A,0x813D,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x0001,0x0000,0x0000,0x0001,0x0801,0x0801,0x0001,0x0000,0x0000,0x0000,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1847,0x408E,0x58F4,0x6918,0x711A,0x711A,0x6918,0x58F5,0x408E,0x1847,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0001,0x286A,0x60F6,0x815E,0x895F,0x815E,0x793C,0x713B,0x713B,0x793C,0x815E,0x895F,0x815E,0x60F6,0x286A,0x0001,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x1825,0x58F5,0x895F,0x895F,0x895F,0x895F,0x388D,0x0823,0x0802,0x0802,0x0823,0x388D,0x895F,0x895F,0x895F,0x895F,0x58F5,0x1825,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x2869,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x2869,0x0000,0x0000,0x0000,0x0000,0x2869,0x895F,0x895F,0x895F,0x895F,0x895F,0x793B,0x2869,0x0000,0x0000,
-    0x0000,0x286A,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x2869,0x0000,0x0000,0x0000,0x0000,0x2869,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x286A,0x0000,
-    0x0001,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x2069,0x0000,0x0000,0x0000,0x0000,0x2869,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x0001,
-    0x0000,0x306B,0x813D,0x895F,0x895F,0x895F,0x895F,0x713B,0x388E,0x0802,0x0000,0x0000,0x0000,0x0000,0x0802,0x408E,0x793B,0x895F,0x895F,0x895F,0x895F,0x813D,0x306B,0x0000,
-    0x0000,0x0000,0x308B,0x813D,0x895F,0x895F,0x60F7,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1845,0x68F7,0x895F,0x895F,0x813D,0x308B,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x308B,0x793C,0x58F5,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x58F5,0x793C,0x308B,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x1025,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x1025,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    
-    
-    
-    const unsigned short leitorir[576] = {
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x286A,0x1847,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x793C,0x793C,0x6918,0x388C,0x0001,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x1025,0x2048,0x50D2,0x813D,0x58F5,0x0823,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x408E,0x58F5,0x308C,0x0000,0x0000,0x286A,0x50D3,0x308C,0x0823,0x2048,0x793B,0x58F5,0x0001,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x793C,0x60F6,0x813D,0x40AF,0x0000,0x306B,0x60F7,0x793C,0x6919,0x1846,0x2048,0x813D,0x388C,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x895F,0x6918,0x0823,0x388D,0x813D,0x40AF,0x0000,0x0000,0x1845,0x60F7,0x6919,0x0823,0x50D2,0x6918,0x0802,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x793C,0x58F5,0x793B,0x58D4,0x0822,0x388D,0x813D,0x40AF,0x0000,0x0000,0x1845,0x793C,0x308C,0x2048,0x793C,0x1847,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x793B,0x50D3,0x0001,0x2048,0x793C,0x58F4,0x0822,0x388D,0x813D,0x40AF,0x0000,0x0000,0x60F7,0x50D3,0x1025,0x793C,0x286A,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x7119,0x60F7,0x0822,0x0000,0x0000,0x2068,0x793C,0x58F4,0x0822,0x388D,0x813D,0x40AF,0x0000,0x306B,0x286A,0x0001,0x40AF,0x1825,
-    0x0000,0x0000,0x0000,0x0000,0x0802,0x60F6,0x711A,0x1024,0x0000,0x0000,0x0000,0x0000,0x2048,0x793C,0x58F4,0x0822,0x388D,0x813D,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0001,0x50D3,0x793C,0x2047,0x0000,0x0802,0x0822,0x0822,0x0822,0x0001,0x2048,0x793C,0x58F4,0x0822,0x388D,0x813D,0x40AF,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x40AF,0x813D,0x286A,0x0000,0x1023,0x68F7,0x711A,0x711A,0x713B,0x58D4,0x0001,0x2048,0x793C,0x58F4,0x0822,0x388D,0x813D,0x308C,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x308B,0x813D,0x388E,0x0000,0x0822,0x0802,0x50D2,0x895F,0x60F6,0x58F5,0x713B,0x0822,0x0000,0x2068,0x793C,0x58D4,0x0823,0x60F6,0x58F5,0x0000,0x0000,0x0000,
-    0x0000,0x2048,0x793C,0x48B1,0x0000,0x0802,0x68F7,0x40B0,0x0802,0x50D2,0x793B,0x60F6,0x711A,0x0822,0x0000,0x0000,0x2048,0x793B,0x6918,0x793C,0x408E,0x0000,0x0000,0x0000,
-    0x1024,0x7119,0x58F5,0x0801,0x0000,0x1023,0x793C,0x895F,0x40B0,0x0802,0x50D2,0x895F,0x711A,0x0822,0x0000,0x0000,0x0001,0x58F5,0x895F,0x48B0,0x0001,0x0000,0x0000,0x0000,
-    0x286A,0x813D,0x2047,0x0000,0x0000,0x1023,0x793B,0x60F7,0x793C,0x40B0,0x0802,0x50D2,0x68F7,0x0802,0x0000,0x0822,0x50D3,0x793C,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x1025,0x711A,0x58F5,0x0802,0x0000,0x1023,0x793C,0x50D3,0x60F7,0x895F,0x40B0,0x0802,0x1023,0x0000,0x1024,0x60F7,0x793B,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x2048,0x793C,0x58F5,0x0802,0x0802,0x60F7,0x793C,0x793B,0x793C,0x68F7,0x0822,0x0000,0x2047,0x711A,0x7119,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x2048,0x793C,0x58F5,0x0802,0x0802,0x1023,0x1023,0x1023,0x0802,0x0000,0x286A,0x793C,0x60F6,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x2048,0x793C,0x58F5,0x0802,0x0000,0x0000,0x0000,0x0000,0x388E,0x813D,0x50D3,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x2048,0x793C,0x58F5,0x0802,0x0000,0x0801,0x48B1,0x813D,0x40AF,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x793C,0x58F5,0x2047,0x58F5,0x793C,0x308B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x711A,0x813D,0x7119,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x286A,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    
-    
-    
-    
-    const unsigned short saver[144] = {
-    0x0000,0x0801,0x40AF,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x408E,0x0001,0x0000,
-    0x0000,0x1847,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,
-    0x0000,0x2048,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x1847,0x0000,
-    0x0000,0x2048,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x1847,0x0000,
-    0x0000,0x2048,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x1847,0x0000,
-    0x0000,0x2048,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x1847,0x0000,
-    0x0000,0x2048,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x1847,0x0000,
-    0x0000,0x2048,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x1847,0x0000,
-    0x0000,0x2048,0x815E,0x895F,0x895F,0x813D,0x813D,0x895F,0x895F,0x815E,0x1847,0x0000,
-    0x0000,0x2048,0x815E,0x895F,0x793B,0x2048,0x2068,0x793C,0x895F,0x815E,0x1847,0x0000,
-    0x0000,0x2047,0x895F,0x793B,0x2048,0x0000,0x0000,0x2048,0x793B,0x815E,0x1846,0x0000,
-    0x0000,0x0823,0x50D3,0x2068,0x0000,0x0000,0x0000,0x0000,0x2869,0x50D2,0x0822,0x0000
-    };
-    
-    const unsigned short ler_radio[144] = {
-    0x68F7,0x60F7,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x68F7,0x60F7,
-    0x68F7,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x60F7,
-    0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,
-    0x0000,0x0000,0x2047,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x60F6,0x58D4,0x0000,0x0000,0x0001,0x40AF,0x1023,0x0000,0x0000,0x0000,
-    0x286A,0x48B0,0x58D4,0x58F5,0x1825,0x286A,0x306A,0x793C,0x308B,0x1024,0x388D,0x286A,
-    0x286A,0x388D,0x1024,0x408E,0x50D2,0x793B,0x711A,0x48B1,0x50D3,0x50D3,0x48B1,0x286A,
-    0x0000,0x0000,0x0000,0x1846,0x793C,0x50D2,0x58D3,0x0823,0x60F6,0x60F7,0x0001,0x0000,
-    0x0000,0x0000,0x0000,0x0001,0x40AF,0x1024,0x0001,0x0000,0x286A,0x306B,0x0000,0x0000,
-    0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,
-    0x68F7,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x60F7,
-    0x68F7,0x60F7,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x68F7,0x60F7
-    };
-    
-    
-    const unsigned short raw1[144] = {
-    0x58F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,
-    0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,
-    0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,
-    0x895F,0x711A,0x7119,0x895F,0x895F,0x793B,0x895F,0x793C,0x813D,0x793C,0x793C,0x815E,
-    0x815E,0x308C,0x2048,0x6918,0x711A,0x2047,0x711A,0x40AF,0x388D,0x308C,0x388D,0x793D,
-    0x815E,0x286A,0x1846,0x711A,0x48B1,0x1023,0x50D2,0x40B0,0x0823,0x0823,0x308C,0x895E,
-    0x815E,0x308C,0x2869,0x6918,0x306B,0x306B,0x308B,0x50D2,0x2869,0x306B,0x40B0,0x895F,
-    0x895F,0x793B,0x711A,0x793B,0x711A,0x895F,0x711A,0x793C,0x713B,0x793B,0x793C,0x895F,
-    0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,
-    0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,
-    0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,
-    0x58F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4
-    };
-    
-    const unsigned short add[144] = {
-    0x0000,0x0000,0x0000,0x0000,0x1845,0x7119,0x6918,0x1025,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x408E,0x895F,0x895F,0x388D,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x408E,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x388E,0x0000,0x0000,0x0000,0x0000,
-    0x1825,0x388E,0x40AF,0x40AE,0x60F7,0x895F,0x895F,0x60F6,0x40AE,0x40AF,0x388D,0x1025,
-    0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,
-    0x6919,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,
-    0x1825,0x388E,0x40AF,0x40AE,0x60F7,0x895F,0x895F,0x60F6,0x40AE,0x40AF,0x388D,0x1025,
-    0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x388E,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x408E,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x408E,0x895F,0x895F,0x388D,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x1845,0x7119,0x6918,0x1025,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    const unsigned short ana[144] = {
-    0x0000,0x0823,0x48D1,0x793C,0x815E,0x711A,0x388D,0x0001,0x0000,0x0000,0x0000,0x0000,
-    0x0823,0x60F6,0x793B,0x48B1,0x388D,0x58D4,0x813D,0x40AF,0x0000,0x0000,0x0000,0x0000,
-    0x48B1,0x793B,0x388E,0x1023,0x0802,0x1024,0x40AE,0x813D,0x2047,0x0000,0x0000,0x0000,
-    0x793B,0x48B1,0x40AF,0x50D3,0x306B,0x60F7,0x50D2,0x813D,0x40B0,0x0000,0x0000,0x0000,
-    0x813D,0x40AF,0x40AF,0x58D4,0x58D4,0x40B0,0x1024,0x60F7,0x50D2,0x0000,0x0000,0x0000,
-    0x6919,0x793B,0x40B0,0x1024,0x58D4,0x48B0,0x0823,0x793B,0x388E,0x0000,0x0000,0x0000,
-    0x308C,0x813D,0x408E,0x0001,0x1846,0x40AF,0x58D4,0x793C,0x1846,0x0000,0x0000,0x0000,
-    0x0000,0x40AF,0x813D,0x7119,0x60F7,0x793B,0x793C,0x793C,0x68F7,0x1847,0x0000,0x0000,
-    0x0000,0x0000,0x2047,0x48B0,0x50D3,0x388E,0x1825,0x60F6,0x917F,0x711A,0x1846,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x711A,0x915F,0x7119,0x1846,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x711A,0x895F,0x6918,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x711A,0x388D
-    };
-    
-    const unsigned short dector[144] = {
-    0x0000,0x50D3,0x60F6,0x793C,0x6919,0x7119,0x6918,0x711A,0x793B,0x60F7,0x48B1,0x0000,
-    0x0000,0x60F5,0x60F7,0x6918,0x60F5,0x60F6,0x58F5,0x60F6,0x68F7,0x6918,0x50D3,0x0000,
-    0x0000,0x60F6,0x50D2,0x0801,0x0823,0x2048,0x2047,0x0822,0x0802,0x58F4,0x50D3,0x0000,
-    0x0000,0x60F6,0x50D2,0x0000,0x1024,0x308C,0x306B,0x0823,0x0000,0x58D4,0x50D3,0x0000,
-    0x0000,0x60F6,0x48D2,0x0001,0x2869,0x388E,0x388E,0x2069,0x0001,0x58D4,0x50D3,0x0000,
-    0x0000,0x60F6,0x48D1,0x1846,0x388E,0x308C,0x308C,0x408E,0x1825,0x58D4,0x50D3,0x0000,
-    0x0000,0x60F6,0x50D2,0x0000,0x1023,0x2047,0x2047,0x0823,0x0000,0x58D4,0x50D3,0x0000,
-    0x0000,0x60F6,0x50D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x50D3,0x0000,
-    0x0000,0x60F6,0x50D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x50D3,0x0000,
-    0x0000,0x60F6,0x50D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x50D3,0x0000,
-    0x0000,0x60F6,0x50D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x50D3,0x0000,
-    0x0000,0x58D4,0x48B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D3,0x50D2,0x0000
-    };
-    
-    const unsigned short bad[576] = {
-    0x0000,0x0000,0x1024,0x286A,0x40B0,0x58D4,0x60F7,0x6918,0x68F7,0x58F5,0x48B1,0x306B,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x2068,0x50D3,0x793B,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x60F6,0x306A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x68F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x915F,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x6918,0x793B,0x6919,0x815E,0x815E,0x815E,0x895F,0x895F,0x895F,0x895F,0x815E,0x815E,0x713B,0x7119,0x711A,0x0802,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x6918,0x793D,0x2869,0x1846,0x1846,0x2869,0x793C,0x895F,0x815E,0x388D,0x1846,0x1846,0x2047,0x6919,0x711B,0x0802,0x408E,0x6918,0x60F5,0x48D2,0x308C,0x1846,0x0001,0x0000,
-    0x6918,0x895F,0x7119,0x388E,0x308B,0x408E,0x813D,0x895F,0x895F,0x48B1,0x306B,0x388D,0x60F7,0x895F,0x711A,0x0802,0x50D3,0x915F,0x895F,0x895F,0x895F,0x813D,0x60F7,0x306B,
-    0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0802,0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,
-    0x58F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x0801,0x58F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,
-    0x48B1,0x895F,0x895F,0x815E,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x813D,0x895F,0x895F,0x58F5,0x0801,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,
-    0x306B,0x895F,0x895F,0x813D,0x408E,0x50D3,0x713B,0x813D,0x793C,0x60F5,0x388D,0x711A,0x895F,0x895F,0x40AF,0x0823,0x793B,0x895F,0x813D,0x793C,0x793C,0x60F6,0x793B,0x6918,
-    0x1024,0x713B,0x895F,0x895F,0x6919,0x2048,0x1024,0x1025,0x1024,0x1846,0x58F5,0x895F,0x895F,0x815E,0x2047,0x2869,0x895F,0x793B,0x1847,0x1023,0x1023,0x286A,0x813D,0x6918,
-    0x0000,0x40B0,0x895F,0x895F,0x895F,0x813D,0x60F6,0x50D2,0x58F5,0x793C,0x895F,0x895F,0x895F,0x60F5,0x0001,0x50D3,0x895F,0x813D,0x50D2,0x40AF,0x50D2,0x793C,0x895F,0x68F7,
-    0x0000,0x0822,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793B,0x1845,0x2047,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,
-    0x0000,0x0000,0x1024,0x60F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x1847,0x0823,0x6918,0x915F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,
-    0x0000,0x0000,0x0000,0x0801,0x388D,0x711A,0x895F,0x895F,0x895F,0x793C,0x48B0,0x0823,0x1024,0x60F6,0x711A,0x50D2,0x40AF,0x58D4,0x793C,0x895F,0x895F,0x895F,0x895F,0x48B0,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x388D,0x60F6,0x40B0,0x1025,0x0802,0x308C,0x711A,0x50D3,0x1825,0x1825,0x1846,0x1025,0x2047,0x68F7,0x895F,0x895F,0x815E,0x286A,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x60F6,0x895F,0x711A,0x40AF,0x6918,0x813D,0x815E,0x793C,0x58F5,0x40AF,0x813D,0x895F,0x7119,0x0823,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x813E,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x815E,0x895F,0x388D,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x6919,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0801,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x50D2,0x0802,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0801,0x388D,0x7119,0x895F,0x895F,0x815E,0x60F7,0x2869,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x388E,0x58F5,0x306B,0x0801,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    
-    
-    
-    
-    
-    
-    
-    
-    const unsigned short h[144] = {
-      0x895F, 0x91BF, 0xA2BF, 0x899F, 0x893F, 0x895F, 0x895F, 0x893F, 0x899F, 0xA2BF, 0x91BF, 0x895F,
-      0x893F, 0xAB1F, 0xF73F, 0xD59F, 0xA2DF, 0x897F, 0x897F, 0xA2DF, 0xD59F, 0xF73F, 0xAB1F, 0x893F,
-      0x893F, 0xAB5F, 0xFFFF, 0xFFFF, 0xF79F, 0xD57F, 0xD57F, 0xF79F, 0xFFFF, 0xFFFF, 0xAB3F, 0x893F,
-      0x895F, 0x9A1F, 0xDDDF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xDDDF, 0x9A1F, 0x895F,
-      0x895F, 0x91DF, 0xCD3F, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xCD1F, 0x91DF, 0x895F,
-      0x893F, 0xAB3F, 0xFFDF, 0xFFFF, 0xFFFF, 0xE63F, 0xE63F, 0xFFFF, 0xFFFF, 0xFFDF, 0xAB3F, 0x893F,
-      0x893F, 0xAB3F, 0xFFDF, 0xFFFF, 0xFFFF, 0xE65F, 0xE65F, 0xFFFF, 0xFFFF, 0xFFDF, 0xAB1F, 0x893F,
-      0x895F, 0x91BF, 0xCCDF, 0xFFBF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFBF, 0xCCDF, 0x91BF, 0x895F,
-      0x895F, 0x9A3F, 0xDDFF, 0xFFDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFDF, 0xDDFF, 0x9A3F, 0x895F,
-      0x893F, 0xAB5F, 0xFFFF, 0xFFFF, 0xF75F, 0xCD3F, 0xCD3F, 0xF77F, 0xFFFF, 0xFFFF, 0xAB3F, 0x893F,
-      0x893F, 0xAAFF, 0xF71F, 0xD55F, 0xA2BF, 0x895F, 0x895F, 0xA2BF, 0xD55F, 0xF71F, 0xAAFF, 0x893F,
-      0x895F, 0x91BF, 0x9A7F, 0x897F, 0x893F, 0x895F, 0x895F, 0x893F, 0x897F, 0x9A7F, 0x919F, 0x895F
-    };
-    
-    const unsigned short apple[576] = {
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0801,0x308C,0x50D3,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x60F5,0x895F,0x813D,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D3,0x895F,0x895F,0x60F6,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x813D,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x815E,0x7119,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x286A,0x50D2,0x50D3,0x388D,0x1825,0x1024,0x2869,0x1024,0x2047,0x40B0,0x58D4,0x48B1,0x2869,0x0001,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x1846,0x60F7,0x895F,0x895F,0x895F,0x895F,0x793D,0x60F6,0x50D2,0x6918,0x815E,0x895F,0x895F,0x895F,0x815E,0x58D4,0x0823,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x1024,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x306B,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x408E,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x1023,0x793B,0x895F,0x895F,0x50D2,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x6918,0x915F,0x60F6,0x0001,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x2048,0x815E,0x895F,0x895F,0x2869,0x2047,0x58D4,0x60F7,0x813D,0x895F,0x793C,0x58F5,0x48B1,0x0822,0x50D3,0x895F,0x388C,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x388E,0x0000,0x0000,0x1024,0x6918,0x895F,0x48B1,0x0001,0x0000,0x0001,0x60F7,0x895F,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x286A,0x895F,0x815E,0x68F7,0x793B,0x40AF,0x388E,0x6918,0x813D,0x793B,0x815E,0x50D3,0x388D,0x58D4,0x713B,0x6918,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x2048,0x895E,0x895F,0x388D,0x58F5,0x895F,0x895F,0x895F,0x793B,0x60F6,0x895F,0x895F,0x895F,0x813D,0x306B,0x60F6,0x50D3,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x1024,0x793C,0x895F,0x48D1,0x0822,0x60F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2869,0x1023,0x793B,0x813D,0x2048,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0001,0x60F7,0x895F,0x793B,0x1024,0x286A,0x58F5,0x306B,0x48B0,0x50D2,0x408E,0x388D,0x58F5,0x0001,0x388D,0x895F,0x895F,0x713B,0x286A,0x0001,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x388E,0x895F,0x895F,0x58F5,0x1024,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x2047,0x793B,0x895F,0x895F,0x895F,0x793C,0x1024,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x1024,0x713B,0x895F,0x895F,0x60F7,0x2069,0x0802,0x0000,0x0000,0x0000,0x0822,0x306B,0x713B,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x388D,0x895F,0x895F,0x895F,0x815E,0x7119,0x58F5,0x58D4,0x58F5,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x1846,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0001,0x58F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x915F,0x915F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x388D,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x60F7,0x895F,0x895F,0x895F,0x895F,0x793B,0x7119,0x793C,0x895F,0x895F,0x895F,0x895F,0x48B0,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x48B1,0x68F7,0x58D4,0x306B,0x1023,0x0801,0x1825,0x388E,0x60F5,0x60F7,0x308C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    
-    
-    
-    
-    const unsigned short androi[576]= {
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x1825,0x1024,0x2048,0x2048,0x1024,0x1845,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x6919,0x793C,0x895E,0x815E,0x793C,0x6918,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308B,0x793C,0x815E,0x895F,0x895F,0x895F,0x895F,0x815E,0x793C,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x793C,0x793B,0x48B1,0x895F,0x895F,0x895F,0x895F,0x48B1,0x793C,0x793C,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x895F,0x895F,0x813E,0x895F,0x895F,0x895F,0x895F,0x813D,0x895F,0x895F,0x48B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x813D,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x286A,0x50D3,0x2047,0x40AF,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x58D4,0x408E,0x2048,0x50D3,0x2869,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0801,0x6919,0x917F,0x58F5,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x60F6,0x917F,0x6918,0x0001,0x0000,0x0000,
-    0x0000,0x0000,0x0802,0x711A,0x915F,0x60F6,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x60F7,0x915F,0x6919,0x0001,0x0000,0x0000,
-    0x0000,0x0000,0x0802,0x711A,0x915F,0x60F6,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x60F7,0x915F,0x6919,0x0001,0x0000,0x0000,
-    0x0000,0x0000,0x0802,0x711A,0x915F,0x60F6,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x60F7,0x915F,0x6919,0x0001,0x0000,0x0000,
-    0x0000,0x0000,0x0802,0x711A,0x915F,0x60F6,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x60F7,0x915F,0x6919,0x0001,0x0000,0x0000,
-    0x0000,0x0000,0x0802,0x711A,0x915F,0x60F6,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x60F7,0x915F,0x6919,0x0001,0x0000,0x0000,
-    0x0000,0x0000,0x0001,0x60F5,0x895F,0x48D2,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x50D2,0x895F,0x58D4,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x1024,0x2869,0x1023,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x1023,0x2869,0x1023,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x286A,0x58F5,0x895F,0x815E,0x40AF,0x40AF,0x815E,0x895F,0x58D4,0x286A,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x813D,0x1025,0x1846,0x815E,0x895F,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x813D,0x1825,0x1846,0x815E,0x895F,0x388E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388C,0x895F,0x793C,0x1024,0x1025,0x793C,0x895F,0x308B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x388D,0x2869,0x0000,0x0000,0x286A,0x388C,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    
-    
-    
-    
-    
-    const unsigned short nfc1[144] = {
-    0x0000,0x0000,0x0000,0x0000,0x0001,0x0823,0x0823,0x0001,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x286A,0x60F6,0x713B,0x713B,0x60F6,0x286A,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x48B0,0x895E,0x895F,0x895F,0x895F,0x915F,0x895E,0x48B0,0x0000,0x0000,
-    0x0000,0x286A,0x895E,0x895F,0x895F,0x895F,0x793C,0x6918,0x895F,0x895E,0x286A,0x0000,
-    0x0001,0x60F6,0x895F,0x815E,0x813D,0x50D2,0x60F7,0x388C,0x815E,0x895F,0x60F6,0x0001,
-    0x0823,0x711A,0x895F,0x60F6,0x50D3,0x40AF,0x60F6,0x388D,0x793C,0x895F,0x711A,0x0823,
-    0x0823,0x711A,0x895F,0x60F6,0x50D3,0x40AF,0x58F5,0x388D,0x793C,0x895F,0x711A,0x0823,
-    0x0000,0x60F5,0x895F,0x815E,0x813D,0x50D2,0x60F7,0x388D,0x815E,0x895F,0x60F5,0x0000,
-    0x0000,0x286A,0x815E,0x895F,0x895F,0x895F,0x793C,0x6918,0x895F,0x815E,0x286A,0x0000,
-    0x0000,0x0000,0x40AF,0x815E,0x895F,0x895F,0x895F,0x915F,0x815E,0x40AF,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x2869,0x58F5,0x711A,0x711A,0x58F5,0x2869,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-    
-    
-    const unsigned short save[144] = {
-    0x306B,0x58D4,0x2869,0x286A,0x58D4,0x58D4,0x50D3,0x1825,0x40AF,0x306B,0x0000,0x0000,
-    0x58D4,0x915F,0x408E,0x48B0,0x895F,0x895F,0x815E,0x2068,0x6918,0x793C,0x1846,0x0000,
-    0x58D4,0x895F,0x388E,0x48B0,0x895F,0x895F,0x815E,0x2068,0x68F7,0x915F,0x60F7,0x0823,
-    0x58D4,0x895F,0x388E,0x40AF,0x815E,0x813D,0x793C,0x2048,0x68F7,0x895F,0x895F,0x48B0,
-    0x58D4,0x895F,0x48B0,0x1024,0x2048,0x2048,0x2047,0x1024,0x6919,0x895F,0x895F,0x58D4,
-    0x58D4,0x895F,0x813D,0x6919,0x6919,0x6919,0x6919,0x711A,0x895E,0x895F,0x895F,0x58D4,
-    0x58D4,0x895F,0x895F,0x915F,0x915F,0x915F,0x915F,0x895F,0x895F,0x895F,0x895F,0x58D4,
-    0x58D4,0x895F,0x6918,0x40AF,0x40AF,0x40AF,0x40AF,0x40AF,0x40AF,0x6918,0x895F,0x58D4,
-    0x58D4,0x895F,0x408E,0x2047,0x40B0,0x40B0,0x40B0,0x40B0,0x2047,0x408E,0x895F,0x58D4,
-    0x58D4,0x895F,0x408E,0x2048,0x48B0,0x40B0,0x40B0,0x48B0,0x2048,0x408E,0x895F,0x58D4,
-    0x58D4,0x915F,0x408E,0x2047,0x40AF,0x40AF,0x40AF,0x40AF,0x2047,0x408E,0x915F,0x58D4,
-    0x286A,0x50D3,0x2048,0x2869,0x50D3,0x50D3,0x50D3,0x50D3,0x2869,0x2048,0x50D3,0x286A
-    };
-    
-    
-    const unsigned short savewifi[576]= {
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x2047,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0801,0x2047,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x815E,0x308C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388C,0x815E,0x48B1,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x917F,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x915F,0x60F5,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x915F,0x60F5,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x915F,0x60F5,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x915F,0x60F5,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x915F,0x60F5,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x915F,0x60F5,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x915F,0x60F5,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x915F,0x60F5,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x915F,0x60F5,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x915F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x915F,0x60F5,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0001,0x60F6,0x915F,0x48B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x915F,0x60F6,0x0001,0x0000,0x0000,0x0000,0x0000,
-    0x0823,0x50D2,0x60F7,0x60F7,0x60F7,0x813D,0x895F,0x793B,0x60F7,0x60F7,0x60F7,0x60F7,0x60F7,0x60F7,0x60F7,0x60F7,0x793B,0x895F,0x813D,0x60F7,0x60F7,0x60F7,0x50D2,0x0822,
-    0x2869,0x895E,0x895F,0x915F,0x915F,0x895F,0x895F,0x895F,0x915F,0x915F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2048,
-    0x2869,0x815E,0x815E,0x50D2,0x40AF,0x793C,0x895F,0x6919,0x40AF,0x58F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2869,
-    0x2869,0x895E,0x793C,0x0823,0x0000,0x60F6,0x915F,0x40AF,0x0000,0x2068,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2069,
-    0x2869,0x815E,0x815E,0x388E,0x306A,0x711A,0x895F,0x60F6,0x2869,0x48B1,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2069,
-    0x2869,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2068,
-    0x1024,0x60F7,0x793C,0x895F,0x895F,0x793D,0x713B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x713B,0x813D,0x895F,0x895F,0x793C,0x60F6,0x1024,
-    0x0000,0x0801,0x48B0,0x895F,0x895F,0x60F6,0x1024,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x1024,0x60F7,0x895F,0x895F,0x388D,0x0001,0x0000,
-    0x0000,0x1023,0x711A,0x815E,0x815E,0x813D,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x813D,0x815E,0x895E,0x60F6,0x0001,0x0000,
-    0x0000,0x0001,0x2047,0x2869,0x2869,0x2048,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x2068,0x2069,0x2869,0x1846,0x0000,0x0000
-    };
-    
-    
-    
-    
-    
-    
-    const unsigned short ble_ative[144] = {
-    0x895F,0x895F,0x895F,0x895F,0x895F,0x9A5F,0x91FF,0x893F,0x895F,0x895F,0x895F,0x895F,
-    0x895F,0x895F,0x895F,0x893F,0x897F,0xDDBF,0xE69F,0xAB3F,0x895F,0x895F,0x895F,0x895F,
-    0x895F,0x895F,0x91DF,0xA2BF,0x919F,0xE63F,0xF75F,0xF71F,0xCCDF,0x91DF,0x895F,0x895F,
-    0x895F,0x893F,0xA2DF,0xEF1F,0xBC3F,0xE65F,0xCCDF,0xD57F,0xFF9F,0xA2BF,0x893F,0x895F,
-    0x895F,0x895F,0x897F,0xBC3F,0xF75F,0xFF9F,0xEEBF,0xF71F,0xBC3F,0x897F,0x895F,0x895F,
-    0x895F,0x895F,0x895F,0x895F,0xBC3F,0xFFDF,0xFFDF,0xBC3F,0x895F,0x895F,0x895F,0x895F,
-    0x895F,0x895F,0x895F,0x895F,0xBC3F,0xFFDF,0xFFDF,0xBC3F,0x895F,0x895F,0x895F,0x895F,
-    0x895F,0x895F,0x897F,0xBC3F,0xF75F,0xFF9F,0xEEBF,0xF71F,0xBC3F,0x897F,0x895F,0x895F,
-    0x895F,0x893F,0xA2DF,0xEF1F,0xBC3F,0xE65F,0xCCDF,0xD57F,0xFF9F,0xA2BF,0x893F,0x895F,
-    0x895F,0x895F,0x91DF,0xA2BF,0x919F,0xE63F,0xF75F,0xF71F,0xCCDF,0x91DF,0x895F,0x895F,
-    0x895F,0x895F,0x895F,0x893F,0x897F,0xDDBF,0xE69F,0xAB3F,0x895F,0x895F,0x895F,0x895F,
-    0x895F,0x895F,0x895F,0x895F,0x895F,0x9A5F,0x91FF,0x893F,0x895F,0x895F,0x895F,0x895F
-    };
-    
-    
-    const unsigned short sd_ative[144] = {
-    0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,
-    0x895F,0x895F,0x895F,0x895F,0xB0F5,0xC0AF,0xC0AF,0xC0AF,0xC0B0,0xA119,0x895F,0x895F,
-    0x895F,0x895F,0x895F,0xC0B0,0xF801,0xF023,0xF023,0xF022,0xF801,0xD86A,0x895F,0x895F,
-    0x895F,0x895F,0xB8D2,0xF800,0xF022,0xB8D2,0xC0B1,0xC0B0,0xD08C,0xE048,0x895F,0x895F,
-    0x895F,0x895F,0xD869,0xF800,0xF801,0xD06B,0xD06B,0xD86A,0xE047,0xD868,0x895F,0x895F,
-    0x895F,0x895F,0xD869,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xD869,0x895F,0x895F,
-    0x895F,0x895F,0xD869,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xD869,0x895F,0x895F,
-    0x895F,0x895F,0xD869,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xD869,0x895F,0x895F,
-    0x895F,0x895F,0xD869,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xD869,0x895F,0x895F,
-    0x895F,0x895F,0xD86A,0xF800,0xF800,0xF800,0xF800,0xF800,0xF800,0xD86A,0x895F,0x895F,
-    0x895F,0x895F,0xA119,0xC0B0,0xC0B0,0xC0B0,0xC0B0,0xC0B0,0xC0B0,0xA119,0x895F,0x895F,
-    0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F
-    };
-    
-    
-    const unsigned short insta[144] = {
-    0x0000,0x0000,0x0823,0x2048,0x286A,0x286A,0x286A,0x286A,0x2048,0x0802,0x0000,0x0000,
-    0x0000,0x2869,0x60F6,0x60F5,0x58D4,0x58D4,0x58D4,0x58D4,0x58F5,0x60F6,0x1847,0x0000,
-    0x0823,0x60F7,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x306A,0x48B0,0x58F5,0x0001,
-    0x2048,0x60F6,0x0001,0x0000,0x2869,0x50D3,0x50D3,0x2869,0x48B1,0x2869,0x60F7,0x1825,
-    0x286A,0x58F5,0x0000,0x286A,0x60F7,0x306B,0x308C,0x68F7,0x2047,0x0001,0x60F5,0x2047,
-    0x286A,0x58D4,0x0000,0x50D3,0x306B,0x0000,0x0000,0x40AF,0x48B1,0x0000,0x58F5,0x2047,
-    0x286A,0x58D4,0x0000,0x50D3,0x388C,0x0000,0x0000,0x40AF,0x48B0,0x0000,0x58F5,0x2047,
-    0x286A,0x58F5,0x0000,0x2048,0x68F7,0x388E,0x40AF,0x60F7,0x1846,0x0001,0x60F6,0x1847,
-    0x2048,0x60F6,0x0001,0x0000,0x2047,0x48B1,0x48B0,0x1846,0x0000,0x0822,0x60F7,0x1025,
-    0x0822,0x60F6,0x308C,0x0802,0x0001,0x0001,0x0001,0x0001,0x0822,0x40AF,0x58D4,0x0001,
-    0x0000,0x2047,0x60F5,0x60F7,0x60F6,0x60F6,0x60F6,0x60F6,0x60F7,0x58D4,0x1825,0x0000,
-    0x0000,0x0000,0x0001,0x1825,0x2047,0x2047,0x2047,0x2047,0x1025,0x0001,0x0000,0x0000
-    };
-    
-    const unsigned short teste[16384] = {
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x1846,0x306B,0x408E,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x40AE,0x388D,0x2048,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0822,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x60F6,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x711A,0x40AF,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1847,0x48B0,0x60F7,0x711A,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x713A,0x6918,0x50D2,0x2869,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x50D2,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x50D2,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x60F6,0x1847,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x58F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x2068,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1845,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x48B0,0x40B0,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0802,0x0000,0x0000,0x0802,0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x308C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x388C,0x308C,0x58D4,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AE,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x1025,0x0000,0x0000,0x0000,0x0000,0x1024,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x40AF,0x0001,0x0000,0x0000,0x0000,0x388D,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D2,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F5,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793B,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x308C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0801,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x0001,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x2068,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1847,0x6919,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0801,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0801,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0801,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B1,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x40AF,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0801,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x388E,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0801,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2069,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AE,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793B,0x7119,0x793C,0x895F,0x895F,0x895F,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F5,0x895F,0x895F,0x895F,0x793B,0x60F5,0x60F6,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AE,0x60F7,0x0801,0x0000,0x0000,0x0000,0x0000,0x0000,0x58F5,0x48B1,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x40AE,0x1023,0x0802,0x1825,0x58D4,0x895F,0x895F,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x58F5,0x1025,0x0000,0x0000,0x1846,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0802,0x48D2,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x58D4,0x0823,0x0000,0x0000,0x0000,0x0000,0x388C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B1,0x0000,0x0000,0x0000,0x0000,0x0001,0x40AF,0x815E,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x48D2,0x0802,0x0000,0x0000,0x0000,0x0000,0x2048,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x388D,0x0823,0x0801,0x1846,0x58F5,0x895F,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x60F7,0x2047,0x0802,0x0822,0x306B,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x60F7,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x40AF,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x7119,0x813D,0x895F,0x895F,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x813D,0x7119,0x711A,0x895E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x388C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x48B0,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x48B0,0x895E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x68F7,0x1845,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793D,0x308C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1847,0x6919,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x48B0,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x0802,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x1023,0x0000,0x0000,0x0000,0x308C,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x1024,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x6919,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x40B0,0x388E,0x58F5,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2068,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x1024,0x0000,0x0000,0x0823,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x50D2,0x48B1,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B1,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x0801,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813E,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x388D,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B1,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2048,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x40B0,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793D,0x40AF,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x50D3,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x40AF,0x7119,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x713B,0x50D2,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x40AF,0x58F5,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x6918,0x60F6,0x48D2,0x286A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x1846,0x286A,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x286A,0x2047,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x0823,0x1023,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x0823,0x1023,0x0822,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x2869,0x50D2,0x6918,0x711A,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x793B,0x711A,0x68F7,0x48B1,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x60F5,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x50D3,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2069,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x7119,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1847,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0801,0x60F6,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x1847,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B0,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0822,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x58D4,0x388D,0x2869,0x2048,0x2869,0x388E,0x58F5,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813E,0x48B1,0x1025,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x58D4,0x895E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x2869,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x388D,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AE,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D2,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6919,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AE,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793B,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1845,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x1025,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2068,0x895E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0802,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1825,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x7119,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x50D2,0x2048,0x0823,0x0001,0x0000,0x0001,0x1023,0x2869,0x58D4,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x713B,0x6918,0x60F6,0x6918,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x711A,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1023,0x793B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x60F7,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x408E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x713B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x6918,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x895E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x2069,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x48B0,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x815E,0x388C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x388D,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x306B,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x50D2,0x711A,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813E,0x7119,0x40B0,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x2047,0x286A,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x306B,0x2869,0x1846,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-    0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-    };
-
-const uint16_t UART[576]= {
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x40AF,0x58D4,0x50D3,0x388D,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0802,0x48B0,0x50D3,0x50D3,0x50D3,0x50D3,0x50D3,0x58F5,0x48B1,0x1825,0x0000,0x0001,0x2047,0x50D3,0x58D4,0x50D3,0x50D3,0x50D3,0x50D3,0x50D2,0x306B,0x0000,0x0000,
-0x0000,0x58F4,0x1846,0x0802,0x0802,0x0802,0x0823,0x60F7,0x1846,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x58D4,0x0802,0x0802,0x0802,0x0802,0x48B0,0x2869,0x0000,
-0x0000,0x58F5,0x0000,0x0000,0x0000,0x0000,0x48B0,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x2869,0x0000,0x0000,0x0000,0x1024,0x48B0,0x0000,
-0x0000,0x58F5,0x0000,0x0000,0x0000,0x0000,0x58F5,0x0000,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x58F5,0x0000,0x0001,0x0000,0x1024,0x48B0,0x0000,
-0x0000,0x58F5,0x0000,0x60F6,0x2068,0x2047,0x388D,0x2048,0x60F7,0x60F6,0x0001,0x60F6,0x2068,0x1023,0x68F7,0x68F7,0x0822,0x58D4,0x2869,0x60F7,0x60F6,0x1025,0x48B0,0x0000,
-0x0000,0x58F5,0x286A,0x50D3,0x2869,0x286A,0x286A,0x48B1,0x1023,0x48D1,0x388E,0x50D3,0x2869,0x306B,0x286A,0x306B,0x2869,0x48B1,0x50D2,0x1024,0x48B1,0x2047,0x48B0,0x0000,
-0x0000,0x58F5,0x0000,0x306B,0x2869,0x2048,0x388C,0x48B0,0x1846,0x58D4,0x0802,0x306B,0x2869,0x286A,0x388C,0x388E,0x2048,0x50D3,0x48B1,0x1846,0x58D4,0x1846,0x48B0,0x0000,
-0x0000,0x58F5,0x1846,0x60F6,0x60F5,0x1845,0x58D4,0x0823,0x58D4,0x388E,0x1846,0x60F6,0x60F5,0x1825,0x50D2,0x48B1,0x0000,0x60F6,0x0823,0x58D4,0x388E,0x1024,0x48B0,0x0000,
-0x0000,0x58F5,0x0000,0x0000,0x0000,0x0000,0x50D3,0x1825,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x308B,0x308C,0x0000,0x0000,0x0000,0x1024,0x48B0,0x0000,
-0x0000,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0802,0x60F6,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x793B,0x308B,0x0000,0x0000,0x0000,0x2869,0x388D,0x0000,
-0x0000,0x2048,0x60F5,0x58F5,0x58F5,0x58F5,0x58F5,0x6918,0x713B,0x308C,0x0001,0x0000,0x0000,0x0802,0x40AF,0x793B,0x2048,0x58F4,0x68F7,0x60F7,0x60F6,0x50D3,0x0001,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x58D4,0x58D4,0x58D4,0x50D2,0x1846,0x0001,0x60F5,0x815E,0x895F,0x895F,0x711A,0x0802,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2869,0x895F,0x895F,0x895F,0x895F,0x711A,0x0802,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x895F,0x895F,0x895F,0x895F,0x793C,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x306B,0x895F,0x895F,0x895F,0x58D4,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x2047,0x50D3,0x40AF,0x0001,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-const uint16_t icon_file[576] = {
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x286A,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x1024,0x6918,0x0801,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x1024,0x895F,0x7119,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x1024,0x895F,0x895F,0x711A,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x1024,0x895F,0x895F,0x895F,0x793B,0x1024,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x0001,0x388C,0x388C,0x388C,0x388C,0x2048,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B1,0x388C,0x388C,0x388C,0x388C,0x388C,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x60F6,0x58F5,0x58F5,0x58F5,0x58F5,0x58F5,0x58F5,0x58F5,0x58F5,0x6918,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x713B,0x0823,0x0802,0x0802,0x0802,0x0802,0x0802,0x0802,0x0802,0x0802,0x1825,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x711A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0823,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x711A,0x7119,0x7119,0x7119,0x7119,0x7119,0x7119,0x7119,0x7119,0x793B,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x793C,0x2869,0x2048,0x2048,0x388D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x813D,0x40AF,0x40AE,0x40AE,0x50D3,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0001,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0001,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58D4,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x308C,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x48B1,0x308C,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-
-const uint16_t icon_folder[576] = {
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x1825,0x1846,0x1846,0x1846,0x1846,0x1023,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0001,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x2869,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x58F5,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x793C,0x2047,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F5,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x895F,0x40AF,0x1845,0x1024,0x1024,0x1024,0x1024,0x1024,0x1024,0x1024,0x1024,0x1024,0x1024,0x0823,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x40AF,0x388D,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0822,0x0000,
-0x0000,0x286A,0x895F,0x895F,0x895F,0x895F,0x1024,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x2048,0x0000,
-0x0000,0x286A,0x895F,0x895F,0x895F,0x68F7,0x306B,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x0001,0x0000,
-0x0000,0x286A,0x895F,0x895F,0x895F,0x408E,0x58D4,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F7,0x0000,0x0000,
-0x0000,0x286A,0x895F,0x895F,0x895F,0x1825,0x813D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x388D,0x0000,0x0000,
-0x0000,0x286A,0x895F,0x895F,0x793C,0x2047,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x1024,0x0000,0x0000,
-0x0000,0x286A,0x895F,0x895F,0x50D2,0x48B0,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x713B,0x0000,0x0000,0x0000,
-0x0000,0x286A,0x895F,0x895F,0x2869,0x711A,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x48B1,0x0000,0x0000,0x0000,
-0x0000,0x286A,0x895F,0x815E,0x1024,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x2048,0x0000,0x0000,0x0000,
-0x0000,0x2048,0x895F,0x58D4,0x388D,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x813D,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x1846,0x1025,0x793C,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x308C,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0001,0x1845,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x1846,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
-};
-
-
-
-
-
-const uint16_t analyzer_main[576] = {
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x408E,0x50D2,0x48B1,0x308C,0x0823,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x1846,0x6918,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x50D3,0x0802,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x286A,0x895E,0x895F,0x815E,0x58D4,0x40AF,0x48B0,0x68F7,0x895F,0x895F,0x793B,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x1846,0x895E,0x895F,0x58F5,0x0802,0x0000,0x286A,0x2047,0x0000,0x1846,0x713B,0x895F,0x711A,0x0001,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x6918,0x895F,0x58F4,0x0000,0x0000,0x0000,0x895F,0x60F6,0x0000,0x0000,0x0802,0x793C,0x895F,0x40AF,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x1846,0x895F,0x815E,0x0802,0x1024,0x0823,0x0000,0x895F,0x60F6,0x0000,0x0000,0x0000,0x286A,0x895F,0x793C,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x408E,0x895F,0x58D4,0x0000,0x813D,0x6919,0x0000,0x895F,0x60F6,0x0000,0x0000,0x0000,0x0000,0x815E,0x895F,0x1024,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x50D2,0x895F,0x40AF,0x0000,0x813D,0x6919,0x0000,0x895F,0x60F6,0x0000,0x2048,0x1025,0x0000,0x7119,0x895F,0x2048,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x48B1,0x895F,0x48B0,0x0000,0x813D,0x6919,0x0000,0x895F,0x60F6,0x0823,0x895F,0x50D3,0x0000,0x711A,0x895F,0x2047,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x308C,0x895F,0x68F7,0x0000,0x813D,0x6919,0x0000,0x895F,0x60F6,0x0823,0x895F,0x50D3,0x0802,0x895F,0x895F,0x0822,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0823,0x895F,0x895F,0x1846,0x813D,0x6919,0x0000,0x895F,0x60F6,0x0823,0x895F,0x50D3,0x40AF,0x895F,0x6918,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x50D3,0x895F,0x713B,0x815E,0x6919,0x0000,0x895F,0x60F6,0x0823,0x895F,0x711A,0x895F,0x895F,0x286A,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0802,0x793B,0x895F,0x895F,0x711A,0x0001,0x895F,0x60F6,0x1024,0x895F,0x895F,0x895F,0x895F,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x1024,0x711A,0x895F,0x895F,0x815E,0x895F,0x815E,0x895F,0x895F,0x895F,0x895F,0x895F,0x895F,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0001,0x40AF,0x793C,0x895F,0x895F,0x895F,0x895F,0x6919,0x286A,0x60F6,0x895F,0x895F,0x895F,0x60F6,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x1024,0x2048,0x2047,0x0823,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x60F6,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x60F6,0x0001,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x895F,0x40AF,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x60F6,0x895F,0x895F,0x308C,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x40AF,0x308C,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,
-0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000,0x0000
+// Gerado por tools/asset_packer.py a partir de assets/icons.manifest.
+// Não edite à mão: altere as imagens de origem e rode o empacotador.
+
+#include "asset.h"
+
+// evil: 24x24, 1152 -> 590 bytes
+static const uint16_t evil_palette[] = {
+    0x0000, 0x895F, 0x1846, 0x1024, 0x0802, 0x793C, 0x58D4, 0x0001, 0x2869, 0x306B, 0x60F6, 0x7119,
+    0x793B, 0x0801, 0x286A, 0x308C, 0x388D, 0x40AE, 0x58F5, 0x6918, 0x0823, 0x1023, 0x2048, 0x40AF,
+    0x60F7, 0x6919, 0x711A, 0x1025, 0x1845, 0x2047, 0x48B1, 0x50D3, 0x813D, 0x0822, 0x1847, 0x388E,
+    0x48B0, 0x50D2, 0x68F7, 0x815E, 0x1825, 0x2068, 0x306A, 0x388C, 0x58F4, 0x60F5, 0x713B, 0x793D,
+    0x895E,
+};
+static const uint16_t evil_rows[] = {
+    0, 8, 22, 40, 60, 80, 101, 122, 144, 166, 187, 209,
+    231, 252, 273, 296, 318, 337, 357, 373, 385, 397, 409, 416,
+    422,
+};
+static const uint8_t evil_data[] = {
+    0x87, 0x00, 0x81, 0x07, 0x00, 0x04, 0x8C, 0x00, 0x84, 0x00, 0x08, 0x08, 0x1E, 0x1B, 0x05, 0x02,
+    0x20, 0x22, 0x17, 0x09, 0x89, 0x00, 0x82, 0x00, 0x0C, 0x0D, 0x12, 0x01, 0x16, 0x19, 0x01, 0x02,
+    0x01, 0x05, 0x1B, 0x01, 0x13, 0x14, 0x87, 0x00, 0x81, 0x00, 0x0E, 0x04, 0x0B, 0x01, 0x1A, 0x0E,
+    0x01, 0x01, 0x02, 0x01, 0x01, 0x11, 0x2D, 0x01, 0x05, 0x03, 0x86, 0x00, 0x81, 0x00, 0x0E, 0x2C,
+    0x01, 0x01, 0x17, 0x0A, 0x01, 0x01, 0x02, 0x01, 0x01, 0x1A, 0x2A, 0x01, 0x01, 0x0B, 0x86, 0x00,
+    0x11, 0x00, 0x07, 0x02, 0x16, 0x09, 0x14, 0x10, 0x11, 0x24, 0x14, 0x1E, 0x11, 0x11, 0x04, 0x09,
+    0x29, 0x02, 0x04, 0x85, 0x00, 0x11, 0x00, 0x18, 0x01, 0x20, 0x1A, 0x03, 0x18, 0x0A, 0x12, 0x03,
+    0x12, 0x0A, 0x18, 0x16, 0x0A, 0x20, 0x01, 0x0C, 0x85, 0x00, 0x00, 0x0D, 0x82, 0x01, 0x01, 0x05,
+    0x08, 0x82, 0x01, 0x00, 0x02, 0x82, 0x01, 0x01, 0x23, 0x26, 0x82, 0x01, 0x00, 0x02, 0x84, 0x00,
+    0x00, 0x02, 0x82, 0x01, 0x01, 0x19, 0x0F, 0x82, 0x01, 0x00, 0x02, 0x82, 0x01, 0x01, 0x1E, 0x06,
+    0x82, 0x01, 0x00, 0x09, 0x84, 0x00, 0x00, 0x0D, 0x82, 0x02, 0x01, 0x03, 0x21, 0x82, 0x02, 0x00,
+    0x07, 0x82, 0x02, 0x81, 0x15, 0x82, 0x02, 0x00, 0x21, 0x84, 0x00, 0x00, 0x1D, 0x82, 0x01, 0x01,
+    0x19, 0x2B, 0x82, 0x01, 0x00, 0x02, 0x82, 0x01, 0x01, 0x25, 0x1F, 0x82, 0x01, 0x00, 0x0F, 0x84,
+    0x00, 0x00, 0x04, 0x82, 0x01, 0x01, 0x05, 0x08, 0x82, 0x01, 0x05, 0x02, 0x01, 0x17, 0x09, 0x0E,
+    0x0A, 0x82, 0x01, 0x00, 0x22, 0x84, 0x00, 0x01, 0x00, 0x13, 0x82, 0x01, 0x0C, 0x02, 0x0C, 0x0C,
+    0x1A, 0x03, 0x0B, 0x16, 0x06, 0x11, 0x28, 0x17, 0x2E, 0x2F, 0x85, 0x00, 0x01, 0x00, 0x03, 0x82,
+    0x02, 0x0C, 0x0D, 0x08, 0x0E, 0x09, 0x04, 0x0F, 0x08, 0x10, 0x01, 0x01, 0x0A, 0x0E, 0x03, 0x85,
+    0x00, 0x81, 0x00, 0x0B, 0x26, 0x01, 0x01, 0x23, 0x18, 0x01, 0x01, 0x02, 0x01, 0x01, 0x1C, 0x30,
+    0x82, 0x01, 0x02, 0x05, 0x25, 0x1C, 0x83, 0x00, 0x81, 0x00, 0x0B, 0x15, 0x05, 0x01, 0x19, 0x0F,
+    0x01, 0x01, 0x02, 0x01, 0x01, 0x10, 0x12, 0x85, 0x01, 0x03, 0x0B, 0x10, 0x04, 0x00, 0x82, 0x00,
+    0x0A, 0x15, 0x0B, 0x01, 0x02, 0x0C, 0x01, 0x02, 0x01, 0x27, 0x1B, 0x08, 0x87, 0x01, 0x01, 0x06,
+    0x07, 0x84, 0x00, 0x09, 0x10, 0x1F, 0x02, 0x27, 0x02, 0x01, 0x0E, 0x1F, 0x03, 0x05, 0x84, 0x01,
+    0x03, 0x13, 0x1D, 0x00, 0x00, 0x87, 0x00, 0x02, 0x14, 0x04, 0x1C, 0x82, 0x00, 0x00, 0x24, 0x83,
+    0x01, 0x00, 0x0C, 0x83, 0x00, 0x8D, 0x00, 0x00, 0x03, 0x82, 0x01, 0x02, 0x0C, 0x01, 0x06, 0x82,
+    0x00, 0x8E, 0x00, 0x08, 0x13, 0x01, 0x13, 0x00, 0x06, 0x01, 0x06, 0x00, 0x00, 0x8E, 0x00, 0x08,
+    0x0F, 0x01, 0x1D, 0x00, 0x00, 0x06, 0x0B, 0x00, 0x00, 0x8E, 0x00, 0x01, 0x0D, 0x12, 0x86, 0x00,
+    0x8F, 0x00, 0x00, 0x07, 0x86, 0x00,
+};
+const asset_image_t evil = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 49,
+    .palette = evil_palette,
+    .rows = evil_rows,
+    .data = evil_data,
+};
+
+// controle: 24x24, 1152 -> 435 bytes
+static const uint16_t controle_palette[] = {
+    0x0000, 0x895F, 0x58D4, 0x58F5, 0x50D2, 0x793C, 0x815E, 0x0001, 0x0802, 0x1024, 0x1846, 0x2047,
+    0x306B, 0x40AF, 0x48B0, 0x60F7, 0x6918, 0x408E, 0x0823, 0x1025, 0x2869, 0x286A, 0x388D, 0x388E,
+    0x48B1, 0x50D3, 0x60F6, 0x793B, 0x813D, 0x40AE,
+};
+static const uint16_t controle_rows[] = {
+    0, 9, 21, 34, 45, 56, 66, 81, 91, 106, 121, 131,
+    146, 161, 171, 186, 201, 215, 230, 245, 260, 275, 285, 296,
+    305,
+};
+static const uint8_t controle_data[] = {
+    0x89, 0x00, 0x03, 0x09, 0x0B, 0x0B, 0x09, 0x89, 0x00, 0x87, 0x00, 0x01, 0x0D, 0x1C, 0x83, 0x01,
+    0x01, 0x1C, 0x0D, 0x87, 0x00, 0x87, 0x00, 0x07, 0x15, 0x11, 0x0A, 0x12, 0x12, 0x0A, 0x11, 0x15,
+    0x87, 0x00, 0x88, 0x00, 0x05, 0x13, 0x1D, 0x04, 0x04, 0x11, 0x13, 0x88, 0x00, 0x88, 0x00, 0x05,
+    0x04, 0x05, 0x0F, 0x0F, 0x05, 0x04, 0x88, 0x00, 0x88, 0x00, 0x00, 0x07, 0x83, 0x00, 0x00, 0x07,
+    0x88, 0x00, 0x86, 0x00, 0x09, 0x09, 0x17, 0x1A, 0x1B, 0x06, 0x06, 0x1B, 0x1A, 0x17, 0x09, 0x86,
+    0x00, 0x86, 0x00, 0x00, 0x02, 0x87, 0x01, 0x00, 0x02, 0x86, 0x00, 0x86, 0x00, 0x09, 0x02, 0x01,
+    0x01, 0x03, 0x05, 0x05, 0x03, 0x01, 0x01, 0x02, 0x86, 0x00, 0x86, 0x00, 0x09, 0x02, 0x01, 0x01,
+    0x00, 0x03, 0x03, 0x00, 0x01, 0x01, 0x02, 0x86, 0x00, 0x86, 0x00, 0x00, 0x02, 0x87, 0x01, 0x00,
+    0x02, 0x86, 0x00, 0x86, 0x00, 0x09, 0x02, 0x01, 0x01, 0x0C, 0x10, 0x10, 0x0C, 0x01, 0x01, 0x02,
+    0x86, 0x00, 0x86, 0x00, 0x09, 0x02, 0x01, 0x01, 0x0C, 0x10, 0x10, 0x0C, 0x01, 0x01, 0x02, 0x86,
+    0x00, 0x86, 0x00, 0x00, 0x02, 0x87, 0x01, 0x00, 0x02, 0x86, 0x00, 0x86, 0x00, 0x09, 0x02, 0x01,
+    0x01, 0x00, 0x03, 0x03, 0x00, 0x01, 0x01, 0x02, 0x86, 0x00, 0x86, 0x00, 0x09, 0x02, 0x01, 0x01,
+    0x03, 0x05, 0x05, 0x03, 0x01, 0x01, 0x02, 0x86, 0x00, 0x86, 0x00, 0x00, 0x02, 0x82, 0x01, 0x81,
+    0x0F, 0x82, 0x01, 0x00, 0x02, 0x86, 0x00, 0x86, 0x00, 0x09, 0x02, 0x01, 0x01, 0x16, 0x00, 0x00,
+    0x16, 0x01, 0x01, 0x02, 0x86, 0x00, 0x86, 0x00, 0x09, 0x19, 0x01, 0x01, 0x08, 0x18, 0x18, 0x08,
+    0x01, 0x01, 0x19, 0x86, 0x00, 0x86, 0x00, 0x09, 0x0E, 0x01, 0x01, 0x14, 0x08, 0x08, 0x14, 0x01,
+    0x01, 0x0E, 0x86, 0x00, 0x86, 0x00, 0x09, 0x0A, 0x01, 0x01, 0x06, 0x0E, 0x0E, 0x06, 0x01, 0x01,
+    0x0A, 0x86, 0x00, 0x87, 0x00, 0x00, 0x04, 0x85, 0x01, 0x00, 0x04, 0x87, 0x00, 0x88, 0x00, 0x05,
+    0x0D, 0x06, 0x01, 0x01, 0x06, 0x0D, 0x88, 0x00, 0x89, 0x00, 0x03, 0x07, 0x0B, 0x0B, 0x07, 0x89,
+    0x00,
+};
+const asset_image_t controle = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 30,
+    .palette = controle_palette,
+    .rows = controle_rows,
+    .data = controle_data,
+};
+
+// learn: 24x24, 1152 -> 422 bytes
+static const uint16_t learn_palette[] = {
+    0x0000, 0x895F, 0x388D, 0x793C, 0x48B1, 0x58D4, 0x308C, 0x50D2, 0x40AF, 0x0001, 0x2869, 0x0823,
+    0x306B, 0x408E, 0x58F5, 0x813D, 0x815E, 0x0822, 0x1846, 0x2048, 0x50D3, 0x60F5, 0x6918, 0x6919,
+    0x0802, 0x1825, 0x2047, 0x2068, 0x40B0, 0x48B0, 0x895E,
+};
+static const uint16_t learn_rows[] = {
+    0, 2, 4, 6, 8, 29, 46, 62, 78, 94, 110, 126,
+    142, 158, 174, 190, 215, 240, 259, 272, 282, 284, 286, 288,
+    290,
+};
+static const uint8_t learn_data[] = {
+    0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x83, 0x00, 0x0F, 0x0B, 0x0C, 0x08, 0x07, 0x0D,
+    0x0A, 0x09, 0x00, 0x00, 0x09, 0x0A, 0x0D, 0x07, 0x08, 0x0C, 0x11, 0x83, 0x00, 0x82, 0x00, 0x00,
+    0x14, 0x85, 0x01, 0x03, 0x10, 0x06, 0x06, 0x10, 0x85, 0x01, 0x00, 0x07, 0x82, 0x00, 0x81, 0x00,
+    0x01, 0x09, 0x03, 0x86, 0x01, 0x81, 0x05, 0x86, 0x01, 0x03, 0x03, 0x09, 0x00, 0x00, 0x03, 0x00,
+    0x02, 0x02, 0x03, 0x86, 0x01, 0x81, 0x05, 0x86, 0x01, 0x03, 0x03, 0x02, 0x02, 0x00, 0x03, 0x00,
+    0x04, 0x02, 0x03, 0x86, 0x01, 0x81, 0x05, 0x86, 0x01, 0x03, 0x03, 0x02, 0x04, 0x00, 0x03, 0x00,
+    0x04, 0x02, 0x03, 0x86, 0x01, 0x81, 0x05, 0x86, 0x01, 0x03, 0x03, 0x02, 0x04, 0x00, 0x03, 0x00,
+    0x04, 0x02, 0x03, 0x86, 0x01, 0x81, 0x05, 0x86, 0x01, 0x03, 0x03, 0x02, 0x04, 0x00, 0x03, 0x00,
+    0x04, 0x02, 0x03, 0x86, 0x01, 0x81, 0x05, 0x86, 0x01, 0x03, 0x03, 0x02, 0x04, 0x00, 0x03, 0x00,
+    0x04, 0x02, 0x03, 0x86, 0x01, 0x81, 0x05, 0x86, 0x01, 0x03, 0x03, 0x02, 0x04, 0x00, 0x03, 0x00,
+    0x04, 0x02, 0x03, 0x86, 0x01, 0x81, 0x05, 0x86, 0x01, 0x03, 0x03, 0x02, 0x04, 0x00, 0x03, 0x00,
+    0x04, 0x02, 0x03, 0x86, 0x01, 0x81, 0x05, 0x86, 0x01, 0x03, 0x03, 0x02, 0x04, 0x00, 0x17, 0x00,
+    0x04, 0x02, 0x03, 0x01, 0x03, 0x16, 0x15, 0x17, 0x0F, 0x01, 0x05, 0x05, 0x01, 0x0F, 0x17, 0x15,
+    0x16, 0x03, 0x01, 0x03, 0x02, 0x04, 0x00, 0x17, 0x00, 0x04, 0x02, 0x08, 0x0A, 0x06, 0x07, 0x07,
+    0x0D, 0x12, 0x1B, 0x06, 0x06, 0x13, 0x19, 0x08, 0x14, 0x07, 0x06, 0x0A, 0x08, 0x02, 0x04, 0x00,
+    0x06, 0x00, 0x04, 0x0E, 0x05, 0x03, 0x1D, 0x12, 0x88, 0x00, 0x07, 0x0B, 0x0C, 0x0E, 0x1E, 0x05,
+    0x0E, 0x04, 0x00, 0x03, 0x00, 0x04, 0x0F, 0x02, 0x8E, 0x00, 0x04, 0x0B, 0x1C, 0x10, 0x04, 0x00,
+    0x02, 0x00, 0x1A, 0x18, 0x91, 0x00, 0x02, 0x11, 0x13, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00,
+    0x97, 0x00,
+};
+const asset_image_t learn = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 31,
+    .palette = learn_palette,
+    .rows = learn_rows,
+    .data = learn_data,
+};
+
+// deauth: 24x24, 1152 -> 530 bytes
+static const uint16_t deauth_palette[] = {
+    0x0000, 0x895F, 0x306B, 0x815E, 0x2869, 0x1845, 0x1846, 0x60F7, 0x6918, 0x813D, 0x286A, 0x50D3,
+    0x711A, 0x793B, 0x0001, 0x0801, 0x40AF, 0x48B1, 0x2048, 0x308C, 0x793C, 0x0802, 0x1023, 0x1024,
+    0x1847, 0x50D2, 0x58F5, 0x6919, 0x7119, 0x2047, 0x306A, 0x308B, 0x40AE, 0x40B0, 0x48B0, 0x48D1,
+    0x60F6, 0x68F7,
+};
+static const uint16_t deauth_rows[] = {
+    0, 2, 18, 34, 52, 72, 95, 115, 126, 136, 146, 156,
+    173, 190, 207, 223, 240, 259, 284, 307, 332, 350, 366, 382,
+    384,
+};
+static const uint8_t deauth_data[] = {
+    0x97, 0x00, 0x82, 0x00, 0x03, 0x1E, 0x09, 0x08, 0x0E, 0x89, 0x00, 0x03, 0x0F, 0x08, 0x09, 0x0A,
+    0x82, 0x00, 0x82, 0x00, 0x03, 0x11, 0x01, 0x01, 0x04, 0x89, 0x00, 0x03, 0x04, 0x01, 0x01, 0x11,
+    0x82, 0x00, 0x06, 0x00, 0x0A, 0x07, 0x10, 0x0C, 0x01, 0x05, 0x89, 0x00, 0x06, 0x05, 0x01, 0x1C,
+    0x20, 0x07, 0x0A, 0x00, 0x01, 0x00, 0x09, 0x83, 0x01, 0x00, 0x02, 0x83, 0x00, 0x81, 0x0F, 0x83,
+    0x00, 0x00, 0x02, 0x83, 0x01, 0x01, 0x09, 0x00, 0x01, 0x00, 0x08, 0x83, 0x01, 0x0B, 0x03, 0x16,
+    0x06, 0x1A, 0x03, 0x01, 0x01, 0x03, 0x1A, 0x06, 0x16, 0x03, 0x83, 0x01, 0x01, 0x08, 0x00, 0x07,
+    0x00, 0x0F, 0x04, 0x05, 0x02, 0x03, 0x0B, 0x1F, 0x87, 0x01, 0x07, 0x02, 0x0B, 0x03, 0x02, 0x05,
+    0x04, 0x0E, 0x00, 0x84, 0x00, 0x81, 0x06, 0x89, 0x01, 0x01, 0x06, 0x18, 0x84, 0x00, 0x85, 0x00,
+    0x00, 0x11, 0x89, 0x01, 0x00, 0x11, 0x85, 0x00, 0x85, 0x00, 0x00, 0x1B, 0x89, 0x01, 0x00, 0x1B,
+    0x85, 0x00, 0x85, 0x00, 0x00, 0x14, 0x89, 0x01, 0x00, 0x14, 0x85, 0x00, 0x85, 0x00, 0x0B, 0x0C,
+    0x0D, 0x04, 0x02, 0x0C, 0x01, 0x01, 0x0C, 0x02, 0x04, 0x0D, 0x1C, 0x85, 0x00, 0x85, 0x00, 0x0B,
+    0x10, 0x13, 0x08, 0x0C, 0x05, 0x03, 0x03, 0x05, 0x0C, 0x08, 0x13, 0x10, 0x85, 0x00, 0x85, 0x00,
+    0x0B, 0x06, 0x02, 0x07, 0x09, 0x12, 0x0D, 0x0D, 0x12, 0x09, 0x07, 0x02, 0x06, 0x85, 0x00, 0x85,
+    0x00, 0x03, 0x13, 0x0D, 0x02, 0x04, 0x83, 0x0B, 0x03, 0x04, 0x02, 0x0D, 0x13, 0x85, 0x00, 0x85,
+    0x00, 0x00, 0x19, 0x82, 0x01, 0x03, 0x24, 0x0A, 0x0A, 0x07, 0x82, 0x01, 0x00, 0x19, 0x85, 0x00,
+    0x84, 0x00, 0x81, 0x06, 0x0B, 0x07, 0x01, 0x01, 0x21, 0x17, 0x17, 0x22, 0x01, 0x01, 0x07, 0x05,
+    0x06, 0x84, 0x00, 0x17, 0x00, 0x0F, 0x04, 0x05, 0x02, 0x03, 0x0D, 0x02, 0x15, 0x14, 0x01, 0x09,
+    0x09, 0x01, 0x14, 0x15, 0x02, 0x0D, 0x03, 0x02, 0x05, 0x04, 0x0F, 0x00, 0x01, 0x00, 0x08, 0x83,
+    0x01, 0x0B, 0x03, 0x1D, 0x00, 0x25, 0x12, 0x0B, 0x0B, 0x12, 0x07, 0x00, 0x18, 0x03, 0x83, 0x01,
+    0x01, 0x08, 0x00, 0x17, 0x00, 0x09, 0x01, 0x0C, 0x01, 0x01, 0x02, 0x00, 0x00, 0x0E, 0x00, 0x0E,
+    0x0E, 0x00, 0x0E, 0x00, 0x00, 0x02, 0x01, 0x01, 0x0C, 0x01, 0x09, 0x00, 0x06, 0x00, 0x0A, 0x11,
+    0x10, 0x01, 0x01, 0x05, 0x89, 0x00, 0x06, 0x05, 0x01, 0x01, 0x10, 0x23, 0x0A, 0x00, 0x82, 0x00,
+    0x03, 0x07, 0x01, 0x01, 0x04, 0x89, 0x00, 0x03, 0x04, 0x01, 0x01, 0x07, 0x82, 0x00, 0x82, 0x00,
+    0x03, 0x0A, 0x03, 0x08, 0x0E, 0x89, 0x00, 0x03, 0x0F, 0x08, 0x03, 0x0A, 0x82, 0x00, 0x97, 0x00,
+};
+const asset_image_t deauth = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 38,
+    .palette = deauth_palette,
+    .rows = deauth_rows,
+    .data = deauth_data,
+};
+
+// scan: 24x24, 1152 -> 414 bytes
+static const uint16_t scan_palette[] = {
+    0x0000, 0x895F, 0x815E, 0x2869, 0x0802, 0x48B0, 0x0823, 0x286A, 0x813D, 0x1825, 0x0822, 0x306B,
+    0x388D, 0x388E, 0x408E, 0x50D3, 0x6918, 0x6919, 0x308C, 0x711A, 0x1023, 0x1025, 0x60F5, 0x60F6,
+    0x793C, 0x793D, 0x1845, 0x306A, 0x308B, 0x7119,
+};
+static const uint16_t scan_rows[] = {
+    0, 2, 4, 6, 8, 10, 23, 35, 56, 78, 101, 122,
+    142, 162, 183, 206, 228, 249, 261, 274, 276, 278, 280, 282,
+    284,
+};
+static const uint8_t scan_data[] = {
+    0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x87, 0x00, 0x07, 0x1A, 0x0C, 0x0F,
+    0x17, 0x17, 0x0F, 0x0C, 0x09, 0x87, 0x00, 0x85, 0x00, 0x01, 0x0B, 0x13, 0x87, 0x01, 0x01, 0x13,
+    0x0B, 0x85, 0x00, 0x83, 0x00, 0x01, 0x09, 0x11, 0x82, 0x01, 0x05, 0x08, 0x05, 0x03, 0x03, 0x05,
+    0x08, 0x82, 0x01, 0x01, 0x11, 0x09, 0x83, 0x00, 0x82, 0x00, 0x01, 0x1B, 0x02, 0x82, 0x01, 0x01,
+    0x10, 0x04, 0x83, 0x00, 0x01, 0x04, 0x10, 0x82, 0x01, 0x01, 0x02, 0x07, 0x82, 0x00, 0x81, 0x00,
+    0x00, 0x12, 0x83, 0x01, 0x09, 0x08, 0x04, 0x00, 0x06, 0x0E, 0x0D, 0x0A, 0x00, 0x04, 0x08, 0x83,
+    0x01, 0x02, 0x12, 0x00, 0x00, 0x01, 0x00, 0x07, 0x84, 0x01, 0x09, 0x05, 0x00, 0x06, 0x19, 0x01,
+    0x01, 0x19, 0x0A, 0x00, 0x05, 0x84, 0x01, 0x01, 0x03, 0x00, 0x01, 0x06, 0x02, 0x84, 0x01, 0x02,
+    0x03, 0x00, 0x0E, 0x83, 0x01, 0x02, 0x0D, 0x00, 0x07, 0x84, 0x01, 0x01, 0x02, 0x06, 0x01, 0x06,
+    0x02, 0x84, 0x01, 0x02, 0x03, 0x00, 0x0D, 0x83, 0x01, 0x02, 0x0E, 0x00, 0x03, 0x84, 0x01, 0x01,
+    0x02, 0x06, 0x01, 0x00, 0x03, 0x84, 0x01, 0x09, 0x05, 0x00, 0x04, 0x18, 0x01, 0x01, 0x18, 0x0A,
+    0x00, 0x05, 0x84, 0x01, 0x01, 0x03, 0x00, 0x81, 0x00, 0x00, 0x12, 0x83, 0x01, 0x09, 0x08, 0x04,
+    0x00, 0x04, 0x0D, 0x0E, 0x0A, 0x00, 0x14, 0x02, 0x83, 0x01, 0x02, 0x1C, 0x00, 0x00, 0x82, 0x00,
+    0x01, 0x07, 0x02, 0x82, 0x01, 0x01, 0x10, 0x04, 0x83, 0x00, 0x01, 0x14, 0x11, 0x82, 0x01, 0x01,
+    0x02, 0x07, 0x82, 0x00, 0x83, 0x00, 0x01, 0x15, 0x11, 0x82, 0x01, 0x05, 0x08, 0x05, 0x07, 0x03,
+    0x05, 0x02, 0x82, 0x01, 0x01, 0x10, 0x15, 0x83, 0x00, 0x85, 0x00, 0x01, 0x0B, 0x13, 0x87, 0x01,
+    0x01, 0x1D, 0x0B, 0x85, 0x00, 0x87, 0x00, 0x07, 0x09, 0x0C, 0x0F, 0x16, 0x16, 0x0F, 0x0C, 0x09,
+    0x87, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00,
+};
+const asset_image_t scan = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 30,
+    .palette = scan_palette,
+    .rows = scan_rows,
+    .data = scan_data,
+};
+
+// sd_front: 16x16, 512 -> 239 bytes
+static const uint16_t sd_front_palette[] = {
+    0x0000, 0x895F, 0x40AF, 0x50D3, 0x306B, 0x1846, 0x50D2, 0x58D4, 0x711A, 0x793C, 0x1023, 0x1024,
+    0x2047, 0x2048, 0x308C, 0x388E, 0x48B1, 0x60F7, 0x6918, 0x6919, 0x793D, 0x815E,
+};
+static const uint16_t sd_front_rows[] = {
+    0, 2, 4, 15, 29, 43, 57, 67, 77, 87, 97, 107,
+    117, 127, 137, 139, 141,
+};
+static const uint8_t sd_front_data[] = {
+    0x8F, 0x00, 0x8F, 0x00, 0x83, 0x00, 0x01, 0x0B, 0x06, 0x85, 0x03, 0x00, 0x05, 0x82, 0x00, 0x83,
+    0x00, 0x08, 0x04, 0x09, 0x06, 0x01, 0x10, 0x15, 0x07, 0x08, 0x02, 0x82, 0x00, 0x83, 0x00, 0x08,
+    0x04, 0x12, 0x0A, 0x01, 0x00, 0x09, 0x0C, 0x07, 0x02, 0x82, 0x00, 0x83, 0x00, 0x08, 0x0E, 0x08,
+    0x04, 0x01, 0x0D, 0x14, 0x0F, 0x11, 0x02, 0x82, 0x00, 0x83, 0x00, 0x00, 0x13, 0x86, 0x01, 0x00,
+    0x02, 0x82, 0x00, 0x82, 0x00, 0x00, 0x04, 0x87, 0x01, 0x00, 0x02, 0x82, 0x00, 0x82, 0x00, 0x00,
+    0x02, 0x87, 0x01, 0x00, 0x02, 0x82, 0x00, 0x82, 0x00, 0x00, 0x02, 0x87, 0x01, 0x00, 0x02, 0x82,
+    0x00, 0x82, 0x00, 0x00, 0x02, 0x87, 0x01, 0x00, 0x02, 0x82, 0x00, 0x82, 0x00, 0x00, 0x02, 0x87,
+    0x01, 0x00, 0x02, 0x82, 0x00, 0x82, 0x00, 0x00, 0x02, 0x87, 0x01, 0x00, 0x02, 0x82, 0x00, 0x82,
+    0x00, 0x00, 0x05, 0x87, 0x03, 0x00, 0x05, 0x82, 0x00, 0x8F, 0x00, 0x8F, 0x00,
+};
+const asset_image_t sd_front = {
+    .width = 16,
+    .height = 16,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 22,
+    .palette = sd_front_palette,
+    .rows = sd_front_rows,
+    .data = sd_front_data,
+};
+
+// blu_main: 24x24, 1152 -> 474 bytes
+static const uint16_t blu_main_palette[] = {
+    0x0000, 0x895F, 0x815E, 0x58F5, 0x813D, 0x408E, 0x1024, 0x793C, 0x40AF, 0x1846, 0x388D, 0x0001,
+    0x1825, 0x388C, 0x388E, 0x7119, 0x793B, 0x793D, 0x0822, 0x1025, 0x1845, 0x2047, 0x306B, 0x308C,
+    0x40B0, 0x48B1, 0x50D2, 0x58F4, 0x711A, 0x40AE,
+};
+static const uint16_t blu_main_rows[] = {
+    0, 8, 18, 29, 41, 60, 81, 102, 121, 138, 150, 162,
+    172, 182, 194, 206, 223, 242, 263, 284, 303, 315, 326, 336,
+    344,
+};
+static const uint8_t blu_main_data[] = {
+    0x89, 0x00, 0x02, 0x12, 0x16, 0x09, 0x8A, 0x00, 0x89, 0x00, 0x04, 0x18, 0x01, 0x10, 0x0A, 0x0B,
+    0x88, 0x00, 0x89, 0x00, 0x00, 0x03, 0x82, 0x01, 0x01, 0x03, 0x14, 0x87, 0x00, 0x89, 0x00, 0x00,
+    0x03, 0x83, 0x01, 0x02, 0x10, 0x0D, 0x0B, 0x85, 0x00, 0x84, 0x00, 0x01, 0x06, 0x0C, 0x82, 0x00,
+    0x03, 0x03, 0x01, 0x02, 0x1C, 0x82, 0x01, 0x01, 0x1B, 0x0C, 0x84, 0x00, 0x83, 0x00, 0x0F, 0x06,
+    0x0F, 0x04, 0x0A, 0x00, 0x00, 0x03, 0x01, 0x07, 0x15, 0x08, 0x04, 0x01, 0x01, 0x0F, 0x06, 0x83,
+    0x00, 0x83, 0x00, 0x0F, 0x09, 0x04, 0x01, 0x02, 0x0A, 0x00, 0x03, 0x01, 0x07, 0x06, 0x00, 0x1A,
+    0x01, 0x01, 0x04, 0x09, 0x83, 0x00, 0x84, 0x00, 0x0D, 0x0E, 0x02, 0x01, 0x02, 0x0A, 0x03, 0x01,
+    0x07, 0x13, 0x17, 0x04, 0x01, 0x02, 0x0E, 0x84, 0x00, 0x85, 0x00, 0x0B, 0x05, 0x02, 0x01, 0x04,
+    0x11, 0x01, 0x07, 0x19, 0x04, 0x01, 0x02, 0x05, 0x85, 0x00, 0x86, 0x00, 0x01, 0x05, 0x02, 0x85,
+    0x01, 0x01, 0x02, 0x05, 0x86, 0x00, 0x87, 0x00, 0x01, 0x1D, 0x02, 0x83, 0x01, 0x01, 0x02, 0x05,
+    0x87, 0x00, 0x88, 0x00, 0x00, 0x08, 0x83, 0x01, 0x00, 0x08, 0x88, 0x00, 0x88, 0x00, 0x00, 0x08,
+    0x83, 0x01, 0x00, 0x08, 0x88, 0x00, 0x87, 0x00, 0x01, 0x08, 0x02, 0x83, 0x01, 0x01, 0x02, 0x05,
+    0x87, 0x00, 0x86, 0x00, 0x01, 0x05, 0x02, 0x85, 0x01, 0x01, 0x02, 0x05, 0x86, 0x00, 0x85, 0x00,
+    0x0B, 0x05, 0x02, 0x01, 0x04, 0x11, 0x01, 0x07, 0x19, 0x04, 0x01, 0x02, 0x05, 0x85, 0x00, 0x84,
+    0x00, 0x0D, 0x0E, 0x02, 0x01, 0x02, 0x0D, 0x03, 0x01, 0x07, 0x13, 0x17, 0x04, 0x01, 0x02, 0x0E,
+    0x84, 0x00, 0x83, 0x00, 0x0F, 0x09, 0x04, 0x01, 0x02, 0x0D, 0x00, 0x03, 0x01, 0x07, 0x06, 0x00,
+    0x1A, 0x01, 0x01, 0x04, 0x09, 0x83, 0x00, 0x83, 0x00, 0x0F, 0x06, 0x0F, 0x11, 0x0A, 0x00, 0x00,
+    0x03, 0x01, 0x07, 0x15, 0x08, 0x04, 0x01, 0x01, 0x0F, 0x06, 0x83, 0x00, 0x84, 0x00, 0x01, 0x06,
+    0x0C, 0x82, 0x00, 0x03, 0x03, 0x01, 0x02, 0x1C, 0x82, 0x01, 0x01, 0x1B, 0x0C, 0x84, 0x00, 0x89,
+    0x00, 0x00, 0x03, 0x83, 0x01, 0x02, 0x10, 0x0D, 0x0B, 0x85, 0x00, 0x89, 0x00, 0x00, 0x03, 0x82,
+    0x01, 0x01, 0x03, 0x14, 0x87, 0x00, 0x89, 0x00, 0x04, 0x18, 0x01, 0x10, 0x0A, 0x0B, 0x88, 0x00,
+    0x89, 0x00, 0x02, 0x12, 0x16, 0x09, 0x8A, 0x00,
+};
+const asset_image_t blu_main = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 30,
+    .palette = blu_main_palette,
+    .rows = blu_main_rows,
+    .data = blu_main_data,
+};
+
+// nfc_main: 24x24, 1152 -> 564 bytes
+static const uint16_t nfc_main_palette[] = {
+    0x0000, 0x895F, 0x0001, 0x915F, 0x2869, 0x50D3, 0x793C, 0x813D, 0x815E, 0x40AF, 0x1846, 0x306B,
+    0x58D4, 0x793B, 0x0802, 0x1024, 0x6918, 0x2047, 0x0801, 0x1825, 0x388E, 0x48B1, 0x58F5, 0x60F6,
+    0x7119, 0x1025, 0x711A, 0x0822, 0x0823, 0x2048, 0x60F7, 0x1845, 0x286A, 0x308C, 0x388D, 0x50D2,
+    0x60F5, 0x895E, 0x388C, 0x408E, 0x40AE, 0x48B0, 0x68F7,
+};
+static const uint16_t nfc_main_rows[] = {
+    0, 7, 15, 24, 37, 51, 67, 84, 106, 129, 153, 177,
+    202, 227, 252, 277, 302, 324, 341, 357, 371, 384, 393, 401,
+    408,
+};
+static const uint8_t nfc_main_data[] = {
+    0x92, 0x00, 0x01, 0x02, 0x12, 0x82, 0x00, 0x91, 0x00, 0x02, 0x0A, 0x16, 0x15, 0x82, 0x00, 0x91,
+    0x00, 0x05, 0x05, 0x03, 0x07, 0x11, 0x00, 0x00, 0x8D, 0x00, 0x09, 0x02, 0x0B, 0x0A, 0x00, 0x1D,
+    0x07, 0x01, 0x05, 0x00, 0x00, 0x8C, 0x00, 0x0A, 0x02, 0x05, 0x01, 0x24, 0x02, 0x00, 0x0C, 0x01,
+    0x06, 0x13, 0x00, 0x8A, 0x00, 0x0C, 0x0E, 0x00, 0x00, 0x05, 0x01, 0x08, 0x04, 0x00, 0x04, 0x25,
+    0x01, 0x14, 0x00, 0x89, 0x00, 0x0D, 0x04, 0x10, 0x0B, 0x00, 0x0A, 0x06, 0x01, 0x0C, 0x00, 0x0E,
+    0x18, 0x03, 0x17, 0x02, 0x02, 0x00, 0x04, 0x20, 0x85, 0x00, 0x0E, 0x1B, 0x18, 0x03, 0x10, 0x0E,
+    0x00, 0x0C, 0x01, 0x0D, 0x0F, 0x00, 0x23, 0x01, 0x0D, 0x0F, 0x04, 0x12, 0x1E, 0x08, 0x09, 0x12,
+    0x84, 0x00, 0x0D, 0x09, 0x01, 0x01, 0x04, 0x00, 0x0B, 0x01, 0x01, 0x04, 0x00, 0x21, 0x01, 0x08,
+    0x20, 0x05, 0x04, 0x08, 0x01, 0x01, 0x16, 0x0F, 0x83, 0x00, 0x0D, 0x13, 0x06, 0x01, 0x15, 0x00,
+    0x1F, 0x07, 0x01, 0x09, 0x00, 0x11, 0x08, 0x01, 0x22, 0x00, 0x14, 0x83, 0x01, 0x01, 0x18, 0x1D,
+    0x82, 0x00, 0x0D, 0x02, 0x2A, 0x03, 0x1E, 0x00, 0x1B, 0x1A, 0x03, 0x05, 0x00, 0x19, 0x06, 0x01,
+    0x28, 0x17, 0x09, 0x01, 0x07, 0x1E, 0x01, 0x01, 0x07, 0x22, 0x02, 0x00, 0x00, 0x0C, 0x03, 0x18,
+    0x0E, 0x02, 0x10, 0x03, 0x16, 0x00, 0x0F, 0x0D, 0x01, 0x09, 0x17, 0x09, 0x01, 0x0D, 0x13, 0x27,
+    0x07, 0x01, 0x01, 0x05, 0x1C, 0x00, 0x05, 0x03, 0x1A, 0x0E, 0x02, 0x10, 0x03, 0x16, 0x00, 0x0F,
+    0x0D, 0x01, 0x09, 0x17, 0x14, 0x01, 0x08, 0x11, 0x00, 0x04, 0x1A, 0x01, 0x01, 0x10, 0x11, 0x17,
+    0x03, 0x10, 0x02, 0x1B, 0x1A, 0x03, 0x05, 0x00, 0x19, 0x06, 0x01, 0x09, 0x17, 0x04, 0x08, 0x01,
+    0x15, 0x00, 0x00, 0x13, 0x17, 0x01, 0x01, 0x06, 0x07, 0x01, 0x0C, 0x00, 0x1F, 0x07, 0x01, 0x09,
+    0x00, 0x11, 0x08, 0x01, 0x14, 0x03, 0x12, 0x17, 0x0D, 0x0B, 0x82, 0x00, 0x02, 0x0E, 0x29, 0x08,
+    0x82, 0x01, 0x0A, 0x26, 0x00, 0x0B, 0x01, 0x01, 0x04, 0x00, 0x21, 0x01, 0x01, 0x0B, 0x02, 0x00,
+    0x0A, 0x19, 0x85, 0x00, 0x0E, 0x0B, 0x0D, 0x01, 0x06, 0x0F, 0x00, 0x0C, 0x01, 0x0D, 0x0F, 0x00,
+    0x23, 0x01, 0x06, 0x19, 0x89, 0x00, 0x0D, 0x0A, 0x10, 0x15, 0x00, 0x0A, 0x06, 0x01, 0x0C, 0x00,
+    0x0E, 0x18, 0x03, 0x17, 0x02, 0x8A, 0x00, 0x81, 0x1C, 0x0A, 0x00, 0x05, 0x01, 0x08, 0x04, 0x00,
+    0x04, 0x25, 0x01, 0x14, 0x00, 0x8C, 0x00, 0x0A, 0x02, 0x05, 0x01, 0x24, 0x02, 0x00, 0x0C, 0x01,
+    0x06, 0x13, 0x00, 0x8D, 0x00, 0x09, 0x02, 0x0B, 0x0A, 0x00, 0x1D, 0x07, 0x01, 0x05, 0x00, 0x00,
+    0x91, 0x00, 0x05, 0x05, 0x03, 0x07, 0x11, 0x00, 0x00, 0x91, 0x00, 0x02, 0x0A, 0x16, 0x15, 0x82,
+    0x00, 0x92, 0x00, 0x01, 0x02, 0x12, 0x82, 0x00,
+};
+const asset_image_t nfc_main = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 43,
+    .palette = nfc_main_palette,
+    .rows = nfc_main_rows,
+    .data = nfc_main_data,
+};
+
+// infra_main: 24x24, 1152 -> 502 bytes
+static const uint16_t infra_main_palette[] = {
+    0x0000, 0x895F, 0x0001, 0x50D3, 0x2048, 0x48B1, 0x815E, 0x1024, 0x286A, 0x50D2, 0x2047, 0x306B,
+    0x58D4, 0x60F6, 0x0801, 0x40B0, 0x711A, 0x0802, 0x0822, 0x388D, 0x6918, 0x813D, 0x1025, 0x1845,
+    0x308C, 0x388E, 0x48B0, 0x48D2, 0x58F5, 0x793C, 0x0823, 0x1023, 0x1846, 0x1847, 0x2869, 0x388C,
+    0x40AE, 0x6919, 0x7119, 0x2069, 0x306A, 0x408E, 0x48D1, 0x60F5, 0x60F7, 0x68F7, 0x793B, 0x813E,
+};
+static const uint16_t infra_main_rows[] = {
+    0, 6, 12, 18, 24, 30, 41, 58, 78, 101, 124, 146,
+    168, 190, 212, 235, 258, 278, 295, 306, 312, 318, 324, 330,
+    336,
+};
+static const uint8_t infra_main_data[] = {
+    0x02, 0x21, 0x13, 0x0E, 0x94, 0x00, 0x02, 0x0C, 0x06, 0x0A, 0x94, 0x00, 0x02, 0x1C, 0x01, 0x04,
+    0x94, 0x00, 0x02, 0x0C, 0x01, 0x04, 0x94, 0x00, 0x02, 0x0C, 0x01, 0x04, 0x94, 0x00, 0x03, 0x0C,
+    0x01, 0x23, 0x02, 0x90, 0x00, 0x02, 0x07, 0x1F, 0x00, 0x05, 0x0C, 0x01, 0x06, 0x14, 0x23, 0x02,
+    0x8A, 0x00, 0x06, 0x11, 0x04, 0x02, 0x11, 0x14, 0x0D, 0x02, 0x00, 0x03, 0x83, 0x01, 0x01, 0x03,
+    0x11, 0x86, 0x00, 0x09, 0x04, 0x0A, 0x00, 0x18, 0x06, 0x08, 0x02, 0x14, 0x1D, 0x16, 0x00, 0x03,
+    0x84, 0x01, 0x00, 0x1A, 0x82, 0x00, 0x0D, 0x07, 0x13, 0x1E, 0x0E, 0x26, 0x26, 0x02, 0x22, 0x01,
+    0x05, 0x00, 0x03, 0x01, 0x22, 0x00, 0x03, 0x84, 0x01, 0x11, 0x15, 0x20, 0x00, 0x00, 0x18, 0x01,
+    0x13, 0x00, 0x0D, 0x15, 0x16, 0x16, 0x2F, 0x0D, 0x00, 0x24, 0x01, 0x13, 0x00, 0x03, 0x85, 0x01,
+    0x10, 0x24, 0x00, 0x00, 0x04, 0x01, 0x09, 0x00, 0x09, 0x01, 0x04, 0x12, 0x1D, 0x25, 0x02, 0x18,
+    0x01, 0x0F, 0x00, 0x03, 0x85, 0x01, 0x10, 0x03, 0x00, 0x00, 0x20, 0x06, 0x1C, 0x00, 0x0F, 0x01,
+    0x08, 0x0E, 0x10, 0x10, 0x02, 0x08, 0x01, 0x05, 0x00, 0x09, 0x85, 0x01, 0x10, 0x0C, 0x00, 0x00,
+    0x17, 0x06, 0x1C, 0x00, 0x0F, 0x01, 0x08, 0x0E, 0x10, 0x10, 0x0E, 0x08, 0x01, 0x1B, 0x00, 0x09,
+    0x85, 0x01, 0x10, 0x0F, 0x00, 0x00, 0x04, 0x01, 0x03, 0x00, 0x1B, 0x01, 0x04, 0x12, 0x2E, 0x25,
+    0x02, 0x0B, 0x01, 0x1A, 0x00, 0x09, 0x84, 0x01, 0x11, 0x06, 0x0A, 0x00, 0x00, 0x0B, 0x01, 0x29,
+    0x00, 0x0D, 0x06, 0x17, 0x07, 0x15, 0x0D, 0x00, 0x19, 0x01, 0x19, 0x00, 0x1B, 0x84, 0x01, 0x00,
+    0x03, 0x82, 0x00, 0x0D, 0x07, 0x19, 0x07, 0x02, 0x14, 0x10, 0x11, 0x27, 0x01, 0x09, 0x00, 0x09,
+    0x01, 0x08, 0x00, 0x2A, 0x83, 0x01, 0x01, 0x2C, 0x1F, 0x86, 0x00, 0x81, 0x0A, 0x07, 0x00, 0x08,
+    0x06, 0x0B, 0x00, 0x2D, 0x15, 0x17, 0x05, 0x05, 0x01, 0x01, 0x1D, 0x05, 0x1E, 0x8A, 0x00, 0x06,
+    0x02, 0x21, 0x02, 0x02, 0x2B, 0x0D, 0x02, 0x03, 0x05, 0x01, 0x05, 0x07, 0x90, 0x00, 0x81, 0x12,
+    0x00, 0x00, 0x02, 0x05, 0x01, 0x28, 0x94, 0x00, 0x02, 0x05, 0x01, 0x0B, 0x94, 0x00, 0x02, 0x1A,
+    0x01, 0x0B, 0x94, 0x00, 0x02, 0x0F, 0x01, 0x0B, 0x94, 0x00, 0x02, 0x0A, 0x03, 0x07, 0x94, 0x00,
+};
+const asset_image_t infra_main = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 48,
+    .palette = infra_main_palette,
+    .rows = infra_main_rows,
+    .data = infra_main_data,
+};
+
+// rf_main: 24x24, 1152 -> 499 bytes
+static const uint16_t rf_main_palette[] = {
+    0x0000, 0x895F, 0x1845, 0x0001, 0x0802, 0x1024, 0x1846, 0x6919, 0x7119, 0x813D, 0x2047, 0x0801,
+    0x58D4, 0x711A, 0x793B, 0x815E, 0x0823, 0x1825, 0x388E, 0x306B, 0x308C, 0x48B0, 0x60F6, 0x60F7,
+    0x6918, 0x793C, 0x0822, 0x1023, 0x2048, 0x306A, 0x40AE, 0x40AF, 0x48B1, 0x50D2, 0x58F5, 0x60F5,
+    0x713B, 0x286A, 0x388D, 0x48D1, 0x6917,
+};
+static const uint16_t rf_main_rows[] = {
+    0, 8, 19, 37, 56, 77, 99, 119, 138, 157, 169, 181,
+    193, 204, 216, 228, 240, 250, 261, 280, 300, 318, 329, 338,
+    347,
+};
+static const uint8_t rf_main_data[] = {
+    0x8F, 0x00, 0x02, 0x11, 0x05, 0x03, 0x84, 0x00, 0x8E, 0x00, 0x05, 0x0A, 0x0E, 0x0E, 0x16, 0x13,
+    0x03, 0x82, 0x00, 0x85, 0x00, 0x02, 0x1B, 0x1F, 0x02, 0x85, 0x00, 0x08, 0x04, 0x14, 0x15, 0x07,
+    0x0F, 0x0C, 0x1A, 0x00, 0x00, 0x84, 0x00, 0x04, 0x0B, 0x22, 0x01, 0x08, 0x02, 0x85, 0x00, 0x07,
+    0x05, 0x10, 0x04, 0x12, 0x0F, 0x0C, 0x03, 0x00, 0x84, 0x00, 0x00, 0x12, 0x82, 0x01, 0x01, 0x08,
+    0x02, 0x83, 0x00, 0x08, 0x0A, 0x19, 0x0E, 0x1E, 0x03, 0x12, 0x0F, 0x13, 0x00, 0x83, 0x00, 0x01,
+    0x05, 0x24, 0x83, 0x01, 0x01, 0x08, 0x02, 0x82, 0x00, 0x08, 0x04, 0x1D, 0x0C, 0x0F, 0x1E, 0x04,
+    0x07, 0x16, 0x03, 0x83, 0x00, 0x00, 0x14, 0x85, 0x01, 0x0C, 0x08, 0x02, 0x00, 0x00, 0x03, 0x05,
+    0x0B, 0x0C, 0x0E, 0x10, 0x15, 0x0E, 0x05, 0x83, 0x00, 0x00, 0x0C, 0x86, 0x01, 0x0B, 0x07, 0x02,
+    0x00, 0x0A, 0x07, 0x05, 0x1D, 0x19, 0x05, 0x14, 0x0E, 0x11, 0x82, 0x00, 0x01, 0x0B, 0x18, 0x87,
+    0x01, 0x0A, 0x07, 0x11, 0x0B, 0x0A, 0x03, 0x04, 0x0A, 0x00, 0x04, 0x0A, 0x00, 0x82, 0x00, 0x01,
+    0x04, 0x0D, 0x88, 0x01, 0x01, 0x07, 0x11, 0x87, 0x00, 0x82, 0x00, 0x01, 0x04, 0x0D, 0x89, 0x01,
+    0x01, 0x07, 0x02, 0x86, 0x00, 0x82, 0x00, 0x01, 0x03, 0x17, 0x8A, 0x01, 0x01, 0x07, 0x02, 0x85,
+    0x00, 0x83, 0x00, 0x00, 0x20, 0x8B, 0x01, 0x01, 0x08, 0x02, 0x84, 0x00, 0x83, 0x00, 0x01, 0x1C,
+    0x0F, 0x8B, 0x01, 0x01, 0x08, 0x02, 0x83, 0x00, 0x83, 0x00, 0x01, 0x03, 0x28, 0x8C, 0x01, 0x01,
+    0x08, 0x02, 0x82, 0x00, 0x83, 0x00, 0x01, 0x10, 0x0D, 0x8D, 0x01, 0x03, 0x08, 0x02, 0x00, 0x00,
+    0x83, 0x00, 0x00, 0x13, 0x8F, 0x01, 0x02, 0x1F, 0x00, 0x00, 0x83, 0x00, 0x00, 0x23, 0x8E, 0x01,
+    0x03, 0x22, 0x1B, 0x00, 0x00, 0x82, 0x00, 0x01, 0x06, 0x09, 0x82, 0x01, 0x02, 0x19, 0x17, 0x0F,
+    0x86, 0x01, 0x02, 0x24, 0x12, 0x0B, 0x82, 0x00, 0x82, 0x00, 0x00, 0x15, 0x83, 0x01, 0x0A, 0x23,
+    0x04, 0x1C, 0x20, 0x17, 0x0D, 0x0D, 0x18, 0x0C, 0x26, 0x05, 0x84, 0x00, 0x81, 0x00, 0x01, 0x1A,
+    0x0D, 0x83, 0x01, 0x00, 0x27, 0x82, 0x00, 0x03, 0x03, 0x04, 0x04, 0x0B, 0x87, 0x00, 0x02, 0x03,
+    0x25, 0x21, 0x84, 0x01, 0x01, 0x16, 0x0A, 0x8D, 0x00, 0x01, 0x05, 0x18, 0x86, 0x09, 0x00, 0x21,
+    0x8D, 0x00, 0x01, 0x00, 0x05, 0x86, 0x06, 0x00, 0x10, 0x8D, 0x00,
+};
+const asset_image_t rf_main = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 41,
+    .palette = rf_main_palette,
+    .rows = rf_main_rows,
+    .data = rf_main_data,
+};
+
+// wifi_main: 24x24, 1152 -> 417 bytes
+static const uint16_t wifi_main_palette[] = {
+    0x0000, 0x895F, 0x388D, 0x793C, 0x1024, 0x306B, 0x0802, 0x2047, 0x50D2, 0x711A, 0x2869, 0x58D4,
+    0x815E, 0x0823, 0x2068, 0x408E, 0x48B0, 0x48B1, 0x1025, 0x1846, 0x1847, 0x2048, 0x40AF, 0x50D3,
+    0x6918, 0x793D, 0x813D, 0x895E, 0x0001, 0x1023, 0x1825, 0x308C, 0x40AE, 0x48D2, 0x60F7, 0x68F7,
+    0x6919,
+};
+static const uint16_t wifi_main_rows[] = {
+    0, 2, 4, 6, 19, 33, 45, 57, 78, 96, 121, 143,
+    153, 163, 181, 199, 216, 227, 237, 247, 258, 267, 269, 271,
+    273,
+};
+static const uint8_t wifi_main_data[] = {
+    0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x87, 0x00, 0x07, 0x13, 0x02, 0x10, 0x0B, 0x0B, 0x10, 0x02,
+    0x13, 0x87, 0x00, 0x84, 0x00, 0x02, 0x04, 0x08, 0x03, 0x87, 0x01, 0x02, 0x03, 0x08, 0x04, 0x84,
+    0x00, 0x82, 0x00, 0x01, 0x06, 0x08, 0x8D, 0x01, 0x01, 0x08, 0x06, 0x82, 0x00, 0x81, 0x00, 0x01,
+    0x07, 0x03, 0x8F, 0x01, 0x03, 0x03, 0x07, 0x00, 0x00, 0x02, 0x00, 0x0A, 0x1B, 0x84, 0x01, 0x07,
+    0x09, 0x11, 0x05, 0x0E, 0x15, 0x05, 0x11, 0x09, 0x84, 0x01, 0x02, 0x1B, 0x0A, 0x00, 0x01, 0x00,
+    0x03, 0x83, 0x01, 0x01, 0x18, 0x07, 0x87, 0x00, 0x01, 0x14, 0x23, 0x83, 0x01, 0x01, 0x19, 0x00,
+    0x01, 0x00, 0x0C, 0x82, 0x01, 0x00, 0x02, 0x82, 0x00, 0x05, 0x0D, 0x05, 0x0F, 0x0F, 0x05, 0x0D,
+    0x82, 0x00, 0x00, 0x02, 0x82, 0x01, 0x01, 0x1A, 0x00, 0x08, 0x00, 0x05, 0x19, 0x09, 0x15, 0x00,
+    0x00, 0x14, 0x22, 0x85, 0x01, 0x08, 0x18, 0x07, 0x00, 0x00, 0x07, 0x09, 0x1A, 0x05, 0x00, 0x85,
+    0x00, 0x00, 0x20, 0x89, 0x01, 0x00, 0x11, 0x85, 0x00, 0x84, 0x00, 0x00, 0x1F, 0x8B, 0x01, 0x00,
+    0x02, 0x84, 0x00, 0x84, 0x00, 0x00, 0x17, 0x83, 0x01, 0x04, 0x0B, 0x02, 0x02, 0x17, 0x0C, 0x82,
+    0x01, 0x00, 0x0B, 0x84, 0x00, 0x84, 0x00, 0x04, 0x0E, 0x01, 0x01, 0x09, 0x04, 0x83, 0x00, 0x04,
+    0x1D, 0x24, 0x01, 0x01, 0x0A, 0x84, 0x00, 0x85, 0x00, 0x0B, 0x04, 0x0E, 0x1C, 0x00, 0x06, 0x02,
+    0x02, 0x06, 0x00, 0x00, 0x0A, 0x12, 0x85, 0x00, 0x88, 0x00, 0x05, 0x0D, 0x03, 0x01, 0x01, 0x03,
+    0x06, 0x88, 0x00, 0x88, 0x00, 0x00, 0x16, 0x83, 0x01, 0x00, 0x0F, 0x88, 0x00, 0x88, 0x00, 0x00,
+    0x10, 0x83, 0x01, 0x00, 0x16, 0x88, 0x00, 0x88, 0x00, 0x05, 0x12, 0x0C, 0x01, 0x01, 0x0C, 0x04,
+    0x88, 0x00, 0x89, 0x00, 0x03, 0x1E, 0x08, 0x21, 0x04, 0x89, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97,
+    0x00,
+};
+const asset_image_t wifi_main = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 37,
+    .palette = wifi_main_palette,
+    .rows = wifi_main_rows,
+    .data = wifi_main_data,
+};
+
+// sd_main: 24x24, 1152 -> 408 bytes
+static const uint16_t sd_main_palette[] = {
+    0x895F, 0x0000, 0x713B, 0x50D3, 0x50D2, 0x2869, 0x1847, 0x2047, 0x306B, 0x48B1, 0x793C, 0x388E,
+    0x68F7, 0x6918, 0x6919, 0x1846, 0x2048, 0x388D, 0x408E, 0x48B0, 0x58D4, 0x58F5, 0x60F7, 0x7119,
+    0x711A, 0x793B, 0x813D, 0x895E,
+};
+static const uint16_t sd_main_rows[] = {
+    0, 2, 14, 24, 34, 54, 75, 96, 117, 138, 148, 158,
+    168, 178, 188, 198, 208, 218, 228, 238, 248, 258, 268, 280,
+    282,
+};
+static const uint8_t sd_main_data[] = {
+    0x97, 0x01, 0x87, 0x01, 0x01, 0x05, 0x04, 0x87, 0x03, 0x01, 0x09, 0x06, 0x83, 0x01, 0x86, 0x01,
+    0x00, 0x04, 0x8B, 0x00, 0x00, 0x05, 0x82, 0x01, 0x85, 0x01, 0x00, 0x04, 0x8C, 0x00, 0x00, 0x0C,
+    0x82, 0x01, 0x84, 0x01, 0x00, 0x04, 0x83, 0x00, 0x0A, 0x04, 0x19, 0x00, 0x03, 0x18, 0x00, 0x14,
+    0x0D, 0x00, 0x00, 0x02, 0x82, 0x01, 0x83, 0x01, 0x00, 0x04, 0x83, 0x00, 0x0B, 0x17, 0x01, 0x12,
+    0x0A, 0x01, 0x08, 0x00, 0x01, 0x10, 0x00, 0x00, 0x02, 0x82, 0x01, 0x82, 0x01, 0x00, 0x11, 0x84,
+    0x00, 0x0B, 0x0E, 0x01, 0x0B, 0x0A, 0x01, 0x08, 0x00, 0x01, 0x07, 0x00, 0x00, 0x02, 0x82, 0x01,
+    0x82, 0x01, 0x00, 0x0D, 0x84, 0x00, 0x0B, 0x0E, 0x01, 0x0B, 0x0A, 0x01, 0x08, 0x00, 0x01, 0x07,
+    0x00, 0x00, 0x02, 0x82, 0x01, 0x82, 0x01, 0x00, 0x02, 0x84, 0x00, 0x0B, 0x1A, 0x0F, 0x15, 0x1B,
+    0x07, 0x03, 0x00, 0x05, 0x13, 0x00, 0x00, 0x02, 0x82, 0x01, 0x82, 0x01, 0x00, 0x02, 0x8F, 0x00,
+    0x00, 0x02, 0x82, 0x01, 0x82, 0x01, 0x00, 0x02, 0x8F, 0x00, 0x00, 0x02, 0x82, 0x01, 0x82, 0x01,
+    0x00, 0x02, 0x8F, 0x00, 0x00, 0x02, 0x82, 0x01, 0x82, 0x01, 0x00, 0x02, 0x8F, 0x00, 0x00, 0x02,
+    0x82, 0x01, 0x82, 0x01, 0x00, 0x02, 0x8F, 0x00, 0x00, 0x02, 0x82, 0x01, 0x82, 0x01, 0x00, 0x02,
+    0x8F, 0x00, 0x00, 0x02, 0x82, 0x01, 0x82, 0x01, 0x00, 0x02, 0x8F, 0x00, 0x00, 0x02, 0x82, 0x01,
+    0x82, 0x01, 0x00, 0x02, 0x8F, 0x00, 0x00, 0x02, 0x82, 0x01, 0x82, 0x01, 0x00, 0x02, 0x8F, 0x00,
+    0x00, 0x02, 0x82, 0x01, 0x82, 0x01, 0x00, 0x02, 0x8F, 0x00, 0x00, 0x02, 0x82, 0x01, 0x82, 0x01,
+    0x00, 0x02, 0x8F, 0x00, 0x00, 0x02, 0x82, 0x01, 0x82, 0x01, 0x00, 0x0C, 0x8F, 0x00, 0x00, 0x16,
+    0x82, 0x01, 0x82, 0x01, 0x00, 0x05, 0x8F, 0x00, 0x00, 0x05, 0x82, 0x01, 0x83, 0x01, 0x01, 0x06,
+    0x09, 0x8B, 0x03, 0x01, 0x09, 0x06, 0x83, 0x01, 0x97, 0x01,
+};
+const asset_image_t sd_main = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 28,
+    .palette = sd_main_palette,
+    .rows = sd_main_rows,
+    .data = sd_main_data,
+};
+
+// reboot_main: 12x12, 288 -> 222 bytes
+static const uint16_t reboot_main_palette[] = {
+    0x0000, 0x0020, 0xA19F, 0x0802, 0x1023, 0x1846, 0x40AF, 0x50D2, 0x895F, 0xB1BF, 0x1024, 0x1825,
+    0x58D4, 0x60F7, 0xA9BF, 0x0801, 0x0803, 0x0841, 0x1847, 0x2869, 0x308C, 0x388E, 0x408E, 0x48B0,
+    0x58F5, 0x60F6, 0x68F7, 0x791B, 0x793B, 0x997F, 0xA99F,
+};
+static const uint16_t reboot_main_rows[] = {
+    0, 8, 19, 32, 44, 55, 60, 65, 76, 86, 99, 110,
+    114,
+};
+static const uint8_t reboot_main_data[] = {
+    0x82, 0x01, 0x85, 0x00, 0x81, 0x01, 0x00, 0x11, 0x82, 0x00, 0x05, 0x10, 0x1A, 0x08, 0x08, 0x19,
+    0x0F, 0x82, 0x00, 0x81, 0x00, 0x09, 0x14, 0x09, 0x07, 0x05, 0x12, 0x0C, 0x09, 0x13, 0x00, 0x00,
+    0x03, 0x00, 0x0A, 0x09, 0x03, 0x83, 0x00, 0x03, 0x0A, 0x02, 0x17, 0x00, 0x02, 0x00, 0x18, 0x07,
+    0x84, 0x00, 0x03, 0x04, 0x1D, 0x0D, 0x00, 0x89, 0x00, 0x01, 0x0B, 0x00, 0x01, 0x00, 0x04, 0x89,
+    0x00, 0x03, 0x00, 0x0D, 0x08, 0x04, 0x84, 0x00, 0x02, 0x06, 0x07, 0x00, 0x02, 0x00, 0x0C, 0x02,
+    0x85, 0x00, 0x02, 0x0E, 0x05, 0x00, 0x81, 0x00, 0x09, 0x15, 0x0E, 0x06, 0x03, 0x03, 0x16, 0x1E,
+    0x06, 0x00, 0x00, 0x82, 0x00, 0x05, 0x0B, 0x1B, 0x02, 0x02, 0x1C, 0x05, 0x82, 0x00, 0x8A, 0x00,
+    0x00, 0x01,
+};
+const asset_image_t reboot_main = {
+    .width = 12,
+    .height = 12,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 31,
+    .palette = reboot_main_palette,
+    .rows = reboot_main_rows,
+    .data = reboot_main_data,
+};
+
+// bat_main: 12x12, 288 -> 263 bytes
+static const uint16_t bat_main_palette[] = {
+    0x0000, 0xA19F, 0x388D, 0x0020, 0x50D3, 0x1825, 0x2048, 0x40AF, 0x1025, 0x308B, 0x388E, 0x997F,
+    0x306B, 0x40AE, 0x1023, 0x1024, 0x2869, 0x308A, 0x408F, 0x48B0, 0x48D1, 0x50D2, 0x58D5, 0x58F5,
+    0x60F6, 0x0802, 0x0803, 0x0841, 0x1846, 0x2049, 0x308C, 0x408E, 0x58D4, 0x60F5,
+};
+static const uint16_t bat_main_rows[] = {
+    0, 12, 25, 38, 51, 63, 76, 88, 101, 113, 126, 138,
+    149,
+};
+static const uint8_t bat_main_data[] = {
+    0x82, 0x03, 0x08, 0x00, 0x07, 0x14, 0x14, 0x0D, 0x00, 0x03, 0x03, 0x1B, 0x81, 0x00, 0x09, 0x1A,
+    0x16, 0x0C, 0x00, 0x00, 0x0C, 0x16, 0x19, 0x00, 0x00, 0x81, 0x00, 0x09, 0x07, 0x06, 0x15, 0x04,
+    0x04, 0x15, 0x06, 0x07, 0x00, 0x00, 0x81, 0x00, 0x09, 0x02, 0x18, 0x01, 0x0B, 0x0B, 0x01, 0x17,
+    0x02, 0x00, 0x00, 0x81, 0x00, 0x01, 0x07, 0x0E, 0x83, 0x05, 0x03, 0x0F, 0x0D, 0x00, 0x00, 0x81,
+    0x00, 0x09, 0x12, 0x06, 0x0A, 0x02, 0x02, 0x0A, 0x1D, 0x0A, 0x00, 0x00, 0x81, 0x00, 0x01, 0x02,
+    0x18, 0x83, 0x01, 0x03, 0x17, 0x02, 0x00, 0x00, 0x81, 0x00, 0x09, 0x12, 0x05, 0x10, 0x06, 0x06,
+    0x10, 0x1C, 0x1F, 0x00, 0x00, 0x81, 0x00, 0x01, 0x07, 0x0E, 0x83, 0x08, 0x03, 0x0F, 0x0D, 0x00,
+    0x00, 0x81, 0x00, 0x09, 0x0A, 0x21, 0x01, 0x0B, 0x0B, 0x01, 0x20, 0x02, 0x00, 0x00, 0x81, 0x00,
+    0x01, 0x1E, 0x13, 0x83, 0x04, 0x03, 0x13, 0x0C, 0x00, 0x00, 0x82, 0x00, 0x00, 0x11, 0x83, 0x09,
+    0x03, 0x11, 0x00, 0x00, 0x03,
+};
+const asset_image_t bat_main = {
+    .width = 12,
+    .height = 12,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 34,
+    .palette = bat_main_palette,
+    .rows = bat_main_rows,
+    .data = bat_main_data,
+};
+
+// conf_main: 24x24, 1152 -> 641 bytes
+static const uint16_t conf_main_palette[] = {
+    0x0000, 0x895F, 0x793C, 0x48B0, 0x815E, 0x308C, 0x1023, 0x1846, 0x1024, 0x0823, 0x68F7, 0x40AF,
+    0x50D2, 0x58D4, 0x60F6, 0x0802, 0x48B1, 0x915F, 0x0001, 0x0801, 0x286A, 0x6918, 0x711A, 0x793B,
+    0x0822, 0x388C, 0x388D, 0x6919, 0x7119, 0x713B, 0x2048, 0x408E, 0x50D3, 0x60F5, 0x60F7, 0x2047,
+    0x58F5, 0x813D, 0x895E, 0x1025, 0x1845, 0x2068, 0x2869, 0x40AE, 0x58F4,
+};
+static const uint16_t conf_main_rows[] = {
+    0, 2, 4, 22, 45, 68, 91, 114, 137, 160, 183, 206,
+    229, 254, 279, 304, 329, 354, 379, 403, 428, 453, 477, 479,
+    481,
+};
+static const uint8_t conf_main_data[] = {
+    0x97, 0x00, 0x97, 0x00, 0x83, 0x00, 0x00, 0x13, 0x83, 0x00, 0x00, 0x0F, 0x83, 0x00, 0x00, 0x0F,
+    0x83, 0x00, 0x00, 0x13, 0x83, 0x00, 0x82, 0x00, 0x11, 0x19, 0x0E, 0x0F, 0x00, 0x00, 0x1E, 0x0A,
+    0x08, 0x00, 0x00, 0x08, 0x0A, 0x29, 0x00, 0x00, 0x0F, 0x21, 0x19, 0x82, 0x00, 0x82, 0x00, 0x11,
+    0x10, 0x02, 0x06, 0x00, 0x00, 0x05, 0x04, 0x07, 0x00, 0x00, 0x07, 0x04, 0x05, 0x00, 0x00, 0x06,
+    0x02, 0x10, 0x82, 0x00, 0x82, 0x00, 0x11, 0x03, 0x02, 0x06, 0x00, 0x00, 0x05, 0x04, 0x07, 0x00,
+    0x00, 0x07, 0x04, 0x05, 0x00, 0x00, 0x06, 0x02, 0x03, 0x82, 0x00, 0x82, 0x00, 0x11, 0x03, 0x02,
+    0x06, 0x00, 0x00, 0x05, 0x04, 0x07, 0x00, 0x00, 0x07, 0x04, 0x05, 0x00, 0x00, 0x06, 0x02, 0x03,
+    0x82, 0x00, 0x82, 0x00, 0x11, 0x03, 0x02, 0x06, 0x00, 0x00, 0x05, 0x04, 0x07, 0x00, 0x00, 0x07,
+    0x04, 0x05, 0x00, 0x00, 0x06, 0x02, 0x03, 0x82, 0x00, 0x82, 0x00, 0x11, 0x03, 0x02, 0x06, 0x00,
+    0x00, 0x05, 0x04, 0x07, 0x00, 0x00, 0x07, 0x04, 0x05, 0x00, 0x00, 0x06, 0x02, 0x03, 0x82, 0x00,
+    0x82, 0x00, 0x11, 0x03, 0x02, 0x06, 0x00, 0x00, 0x05, 0x04, 0x07, 0x00, 0x00, 0x07, 0x04, 0x05,
+    0x00, 0x00, 0x06, 0x02, 0x03, 0x82, 0x00, 0x82, 0x00, 0x11, 0x03, 0x02, 0x06, 0x00, 0x00, 0x05,
+    0x04, 0x07, 0x00, 0x00, 0x07, 0x04, 0x05, 0x00, 0x00, 0x06, 0x02, 0x03, 0x82, 0x00, 0x82, 0x00,
+    0x11, 0x03, 0x02, 0x09, 0x00, 0x00, 0x05, 0x04, 0x07, 0x00, 0x00, 0x07, 0x04, 0x05, 0x00, 0x00,
+    0x09, 0x02, 0x03, 0x82, 0x00, 0x17, 0x00, 0x12, 0x28, 0x0C, 0x02, 0x1E, 0x06, 0x27, 0x1F, 0x04,
+    0x14, 0x08, 0x08, 0x14, 0x04, 0x1F, 0x08, 0x06, 0x1E, 0x02, 0x0C, 0x07, 0x12, 0x00, 0x17, 0x00,
+    0x12, 0x1F, 0x0C, 0x15, 0x0B, 0x23, 0x05, 0x10, 0x1C, 0x03, 0x14, 0x2A, 0x03, 0x1C, 0x10, 0x05,
+    0x23, 0x0B, 0x15, 0x0C, 0x2B, 0x13, 0x00, 0x17, 0x00, 0x18, 0x0C, 0x0E, 0x22, 0x24, 0x14, 0x0B,
+    0x0E, 0x0A, 0x21, 0x19, 0x19, 0x21, 0x0A, 0x0E, 0x0B, 0x14, 0x24, 0x22, 0x0E, 0x0C, 0x18, 0x00,
+    0x02, 0x00, 0x08, 0x02, 0x82, 0x01, 0x11, 0x0B, 0x1B, 0x01, 0x01, 0x11, 0x0D, 0x0D, 0x11, 0x01,
+    0x01, 0x0A, 0x03, 0x11, 0x01, 0x01, 0x02, 0x08, 0x00, 0x17, 0x00, 0x08, 0x02, 0x0E, 0x1A, 0x04,
+    0x0B, 0x1B, 0x1C, 0x05, 0x25, 0x0D, 0x0D, 0x25, 0x05, 0x1C, 0x0A, 0x03, 0x26, 0x1A, 0x0E, 0x02,
+    0x08, 0x00, 0x17, 0x00, 0x08, 0x02, 0x15, 0x0C, 0x26, 0x0B, 0x1B, 0x17, 0x10, 0x04, 0x0D, 0x0D,
+    0x04, 0x10, 0x17, 0x0A, 0x03, 0x01, 0x0C, 0x15, 0x02, 0x08, 0x00, 0x02, 0x00, 0x08, 0x02, 0x82,
+    0x01, 0x01, 0x0B, 0x15, 0x82, 0x01, 0x81, 0x20, 0x82, 0x01, 0x01, 0x22, 0x03, 0x82, 0x01, 0x02,
+    0x02, 0x08, 0x00, 0x02, 0x00, 0x08, 0x02, 0x82, 0x01, 0x0B, 0x0B, 0x1B, 0x01, 0x01, 0x11, 0x0D,
+    0x0D, 0x11, 0x01, 0x11, 0x0A, 0x03, 0x82, 0x01, 0x02, 0x02, 0x08, 0x00, 0x17, 0x00, 0x06, 0x0A,
+    0x1D, 0x16, 0x16, 0x1A, 0x2C, 0x1D, 0x16, 0x17, 0x03, 0x03, 0x17, 0x16, 0x17, 0x20, 0x1A, 0x1D,
+    0x16, 0x1D, 0x0A, 0x06, 0x00, 0x81, 0x00, 0x00, 0x18, 0x82, 0x09, 0x01, 0x12, 0x0F, 0x82, 0x09,
+    0x81, 0x13, 0x82, 0x09, 0x01, 0x0F, 0x12, 0x82, 0x09, 0x02, 0x18, 0x00, 0x00, 0x97, 0x00, 0x97,
+    0x00,
+};
+const asset_image_t conf_main = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 45,
+    .palette = conf_main_palette,
+    .rows = conf_main_rows,
+    .data = conf_main_data,
+};
+
+// Music: 24x24, 1152 -> 464 bytes
+static const uint16_t Music_palette[] = {
+    0x0000, 0x895F, 0x1845, 0x388C, 0x0001, 0x813D, 0x2048, 0x711A, 0x815E, 0x0823, 0x58D4, 0x2047,
+    0x2869, 0x48B1, 0x50D2, 0x58F5, 0x0801, 0x1024, 0x1846, 0x306B, 0x40AF, 0x40B0, 0x60F6, 0x6918,
+    0x6919, 0x7119, 0x793B, 0x793D, 0x0802, 0x0822, 0x1023, 0x388D, 0x48D2, 0x60F7, 0x68F7,
+};
+static const uint16_t Music_rows[] = {
+    0, 2, 8, 17, 27, 43, 59, 77, 98, 114, 130, 146,
+    162, 178, 194, 210, 226, 247, 265, 281, 297, 307, 316, 322,
+    324,
+};
+static const uint8_t Music_data[] = {
+    0x97, 0x00, 0x8C, 0x00, 0x00, 0x1E, 0x89, 0x00, 0x8A, 0x00, 0x03, 0x04, 0x0A, 0x01, 0x11, 0x88,
+    0x00, 0x89, 0x00, 0x04, 0x09, 0x18, 0x01, 0x01, 0x02, 0x88, 0x00, 0x88, 0x00, 0x01, 0x0B, 0x1B,
+    0x82, 0x01, 0x00, 0x02, 0x82, 0x00, 0x01, 0x04, 0x0C, 0x83, 0x00, 0x87, 0x00, 0x00, 0x03, 0x84,
+    0x01, 0x00, 0x02, 0x82, 0x00, 0x02, 0x12, 0x01, 0x15, 0x82, 0x00, 0x85, 0x00, 0x01, 0x04, 0x0A,
+    0x85, 0x01, 0x09, 0x02, 0x00, 0x04, 0x0B, 0x00, 0x0D, 0x01, 0x06, 0x00, 0x00, 0x02, 0x00, 0x10,
+    0x13, 0x82, 0x03, 0x00, 0x19, 0x86, 0x01, 0x09, 0x02, 0x00, 0x06, 0x01, 0x1F, 0x00, 0x07, 0x07,
+    0x00, 0x00, 0x01, 0x00, 0x22, 0x8B, 0x01, 0x09, 0x02, 0x00, 0x00, 0x0A, 0x08, 0x09, 0x0C, 0x01,
+    0x06, 0x00, 0x01, 0x00, 0x05, 0x8B, 0x01, 0x09, 0x02, 0x00, 0x00, 0x1C, 0x08, 0x0D, 0x00, 0x05,
+    0x0E, 0x00, 0x01, 0x00, 0x05, 0x8B, 0x01, 0x00, 0x02, 0x82, 0x00, 0x05, 0x0F, 0x07, 0x00, 0x16,
+    0x17, 0x00, 0x01, 0x00, 0x05, 0x8B, 0x01, 0x00, 0x02, 0x82, 0x00, 0x05, 0x14, 0x08, 0x00, 0x0E,
+    0x1A, 0x00, 0x01, 0x00, 0x05, 0x8B, 0x01, 0x00, 0x02, 0x82, 0x00, 0x05, 0x15, 0x08, 0x00, 0x0E,
+    0x1A, 0x00, 0x01, 0x00, 0x05, 0x8B, 0x01, 0x00, 0x02, 0x82, 0x00, 0x05, 0x0F, 0x07, 0x00, 0x16,
+    0x17, 0x00, 0x01, 0x00, 0x05, 0x8B, 0x01, 0x09, 0x02, 0x00, 0x00, 0x1D, 0x08, 0x0D, 0x00, 0x05,
+    0x20, 0x00, 0x01, 0x00, 0x21, 0x8B, 0x01, 0x09, 0x02, 0x00, 0x00, 0x0F, 0x08, 0x09, 0x0C, 0x01,
+    0x06, 0x00, 0x02, 0x00, 0x10, 0x13, 0x82, 0x03, 0x00, 0x19, 0x86, 0x01, 0x09, 0x02, 0x00, 0x06,
+    0x01, 0x03, 0x00, 0x07, 0x07, 0x00, 0x00, 0x85, 0x00, 0x01, 0x04, 0x0A, 0x85, 0x01, 0x09, 0x02,
+    0x00, 0x04, 0x0B, 0x00, 0x0D, 0x01, 0x06, 0x00, 0x00, 0x87, 0x00, 0x00, 0x03, 0x84, 0x01, 0x00,
+    0x02, 0x82, 0x00, 0x02, 0x12, 0x01, 0x14, 0x82, 0x00, 0x88, 0x00, 0x01, 0x0B, 0x1B, 0x82, 0x01,
+    0x00, 0x02, 0x82, 0x00, 0x01, 0x04, 0x0C, 0x83, 0x00, 0x89, 0x00, 0x04, 0x09, 0x18, 0x01, 0x01,
+    0x02, 0x88, 0x00, 0x8A, 0x00, 0x03, 0x04, 0x0A, 0x01, 0x11, 0x88, 0x00, 0x8C, 0x00, 0x00, 0x09,
+    0x89, 0x00, 0x97, 0x00,
+};
+const asset_image_t Music = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 35,
+    .palette = Music_palette,
+    .rows = Music_rows,
+    .data = Music_data,
+};
+
+// inatividade: 24x24, 1152 -> 595 bytes
+static const uint16_t inatividade_palette[] = {
+    0x895F, 0x0000, 0x6918, 0x0001, 0x793C, 0x815E, 0x58D4, 0x2869, 0x306B, 0x711A, 0x1024, 0x1025,
+    0x0823, 0x813D, 0x286A, 0x388D, 0x48B0, 0x0801, 0x40AF, 0x60F6, 0x0822, 0x60F7, 0x58F5, 0x1825,
+    0x2048, 0x388C, 0x7119, 0x1845, 0x1846, 0x306A, 0x40AE, 0x40B0, 0x48B1, 0x50D3, 0x68F7, 0x6919,
+};
+static const uint16_t inatividade_rows[] = {
+    0, 2, 22, 43, 65, 88, 110, 128, 149, 172, 194, 217,
+    242, 267, 288, 302, 318, 334, 352, 374, 397, 418, 436, 451,
+    453,
+};
+static const uint8_t inatividade_data[] = {
+    0x97, 0x01, 0x81, 0x01, 0x01, 0x0C, 0x05, 0x82, 0x00, 0x09, 0x23, 0x01, 0x21, 0x0D, 0x00, 0x00,
+    0x04, 0x15, 0x0F, 0x0C, 0x86, 0x01, 0x81, 0x01, 0x00, 0x0B, 0x83, 0x00, 0x05, 0x04, 0x01, 0x1A,
+    0x00, 0x05, 0x05, 0x82, 0x00, 0x02, 0x05, 0x10, 0x03, 0x84, 0x01, 0x81, 0x01, 0x00, 0x0B, 0x83,
+    0x00, 0x0C, 0x04, 0x01, 0x1C, 0x03, 0x01, 0x01, 0x03, 0x07, 0x06, 0x00, 0x00, 0x09, 0x0A, 0x83,
+    0x01, 0x81, 0x01, 0x00, 0x0B, 0x83, 0x00, 0x0D, 0x04, 0x01, 0x01, 0x18, 0x02, 0x02, 0x06, 0x08,
+    0x03, 0x0A, 0x02, 0x00, 0x0D, 0x0A, 0x82, 0x01, 0x02, 0x01, 0x13, 0x09, 0x84, 0x00, 0x02, 0x1A,
+    0x1F, 0x01, 0x83, 0x00, 0x08, 0x04, 0x08, 0x01, 0x16, 0x00, 0x09, 0x03, 0x01, 0x01, 0x01, 0x01,
+    0x13, 0x86, 0x00, 0x01, 0x0F, 0x0C, 0x85, 0x00, 0x06, 0x12, 0x01, 0x02, 0x00, 0x10, 0x01, 0x01,
+    0x02, 0x01, 0x03, 0x09, 0x84, 0x00, 0x04, 0x06, 0x01, 0x13, 0x02, 0x22, 0x84, 0x00, 0x05, 0x1D,
+    0x0B, 0x00, 0x05, 0x0C, 0x01, 0x81, 0x01, 0x01, 0x0B, 0x05, 0x82, 0x00, 0x05, 0x09, 0x03, 0x12,
+    0x00, 0x08, 0x08, 0x84, 0x00, 0x05, 0x04, 0x03, 0x06, 0x00, 0x0F, 0x01, 0x0C, 0x01, 0x06, 0x0C,
+    0x0E, 0x00, 0x00, 0x0D, 0x0A, 0x18, 0x00, 0x00, 0x08, 0x08, 0x85, 0x00, 0x04, 0x08, 0x07, 0x00,
+    0x15, 0x01, 0x0D, 0x01, 0x0D, 0x02, 0x01, 0x20, 0x00, 0x07, 0x0A, 0x0D, 0x00, 0x02, 0x0C, 0x0C,
+    0x02, 0x84, 0x00, 0x04, 0x06, 0x11, 0x00, 0x04, 0x01, 0x17, 0x01, 0x00, 0x0D, 0x01, 0x01, 0x0A,
+    0x03, 0x09, 0x00, 0x00, 0x17, 0x07, 0x07, 0x0C, 0x0E, 0x0E, 0x02, 0x00, 0x00, 0x02, 0x01, 0x05,
+    0x00, 0x01, 0x06, 0x01, 0x00, 0x05, 0x01, 0x1E, 0x12, 0x09, 0x82, 0x00, 0x0D, 0x1B, 0x07, 0x07,
+    0x0C, 0x19, 0x19, 0x02, 0x00, 0x00, 0x02, 0x01, 0x05, 0x00, 0x01, 0x04, 0x01, 0x04, 0x00, 0x11,
+    0x06, 0x84, 0x00, 0x03, 0x02, 0x17, 0x0B, 0x02, 0x84, 0x00, 0x04, 0x06, 0x11, 0x00, 0x04, 0x01,
+    0x04, 0x01, 0x15, 0x00, 0x07, 0x08, 0x8D, 0x00, 0x04, 0x08, 0x07, 0x00, 0x15, 0x01, 0x05, 0x01,
+    0x0F, 0x00, 0x06, 0x03, 0x04, 0x8B, 0x00, 0x05, 0x04, 0x03, 0x06, 0x00, 0x0F, 0x01, 0x05, 0x01,
+    0x14, 0x05, 0x00, 0x0B, 0x0E, 0x8B, 0x00, 0x05, 0x0E, 0x0B, 0x00, 0x05, 0x14, 0x01, 0x81, 0x01,
+    0x04, 0x10, 0x00, 0x02, 0x01, 0x12, 0x89, 0x00, 0x06, 0x12, 0x03, 0x02, 0x00, 0x10, 0x01, 0x01,
+    0x81, 0x01, 0x06, 0x03, 0x09, 0x00, 0x16, 0x01, 0x0E, 0x04, 0x85, 0x00, 0x08, 0x04, 0x0E, 0x03,
+    0x16, 0x00, 0x09, 0x03, 0x01, 0x01, 0x82, 0x01, 0x11, 0x0A, 0x0D, 0x00, 0x02, 0x0B, 0x03, 0x08,
+    0x06, 0x02, 0x02, 0x06, 0x08, 0x03, 0x0B, 0x02, 0x00, 0x0D, 0x0A, 0x82, 0x01, 0x83, 0x01, 0x0F,
+    0x0A, 0x09, 0x00, 0x00, 0x06, 0x07, 0x11, 0x01, 0x01, 0x11, 0x07, 0x06, 0x00, 0x00, 0x09, 0x0A,
+    0x83, 0x01, 0x84, 0x01, 0x02, 0x03, 0x10, 0x05, 0x82, 0x00, 0x81, 0x05, 0x82, 0x00, 0x02, 0x05,
+    0x10, 0x03, 0x84, 0x01, 0x86, 0x01, 0x09, 0x14, 0x0F, 0x13, 0x04, 0x00, 0x00, 0x04, 0x13, 0x0F,
+    0x14, 0x86, 0x01, 0x97, 0x01,
+};
+const asset_image_t inatividade = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 36,
+    .palette = inatividade_palette,
+    .rows = inatividade_rows,
+    .data = inatividade_data,
+};
+
+// high_main: 12x12, 288 -> 238 bytes
+static const uint16_t high_main_palette[] = {
+    0x0000, 0x895F, 0x997F, 0x0020, 0x915F, 0x917F, 0x1825, 0x2869, 0x388D, 0x58D5, 0x58F5, 0x6919,
+    0x813E, 0x815E, 0x0801, 0x0802, 0x0841, 0x388E, 0x408E, 0x50B2, 0x50D2, 0x7119, 0x711A, 0x793C,
+    0x793D,
+};
+static const uint16_t high_main_rows[] = {
+    0, 11, 23, 36, 49, 61, 74, 87, 100, 113, 126, 138,
+    142,
+};
+static const uint8_t high_main_data[] = {
+    0x81, 0x03, 0x81, 0x00, 0x83, 0x03, 0x81, 0x00, 0x01, 0x03, 0x10, 0x81, 0x00, 0x01, 0x18, 0x11,
+    0x83, 0x00, 0x03, 0x12, 0x17, 0x00, 0x00, 0x81, 0x00, 0x81, 0x02, 0x07, 0x01, 0x07, 0x07, 0x04,
+    0x02, 0x02, 0x00, 0x00, 0x81, 0x00, 0x09, 0x16, 0x04, 0x01, 0x05, 0x05, 0x01, 0x04, 0x15, 0x00,
+    0x00, 0x81, 0x00, 0x01, 0x0F, 0x0D, 0x83, 0x01, 0x03, 0x0D, 0x0E, 0x00, 0x00, 0x81, 0x00, 0x09,
+    0x02, 0x01, 0x01, 0x0B, 0x0B, 0x01, 0x01, 0x02, 0x00, 0x00, 0x81, 0x00, 0x09, 0x02, 0x01, 0x04,
+    0x09, 0x0A, 0x04, 0x01, 0x02, 0x00, 0x00, 0x81, 0x00, 0x09, 0x06, 0x0C, 0x01, 0x04, 0x04, 0x01,
+    0x0C, 0x06, 0x00, 0x00, 0x81, 0x00, 0x09, 0x0A, 0x05, 0x01, 0x05, 0x05, 0x01, 0x05, 0x09, 0x00,
+    0x00, 0x81, 0x00, 0x09, 0x02, 0x05, 0x02, 0x08, 0x08, 0x02, 0x05, 0x02, 0x00, 0x00, 0x81, 0x00,
+    0x01, 0x04, 0x13, 0x83, 0x00, 0x03, 0x14, 0x01, 0x00, 0x00, 0x8A, 0x00, 0x00, 0x03,
+};
+const asset_image_t high_main = {
+    .width = 12,
+    .height = 12,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 25,
+    .palette = high_main_palette,
+    .rows = high_main_rows,
+    .data = high_main_data,
+};
+
+// sniffble: 24x24, 1152 -> 608 bytes
+static const uint16_t sniffble_palette[] = {
+    0x0000, 0x895F, 0x0823, 0x711A, 0x1024, 0x388D, 0x0001, 0x793B, 0x1023, 0x58D4, 0x58F5, 0x2869,
+    0x6918, 0x793C, 0x0802, 0x0822, 0x1846, 0x2047, 0x40AF, 0x50D3, 0x60F6, 0x308C, 0x60F7, 0x713B,
+    0x6919, 0x7119, 0x815E, 0x0801, 0x2048, 0x388C, 0x40B0, 0x48B0, 0x1025, 0x1845, 0x1847, 0x2068,
+    0x286A, 0x48B1, 0x68F7, 0x813D, 0x1825, 0x308B, 0x388E, 0x408E, 0x50D2,
+};
+static const uint16_t sniffble_rows[] = {
+    0, 2, 4, 16, 34, 54, 74, 99, 124, 149, 174, 199,
+    224, 249, 274, 299, 324, 349, 374, 394, 414, 432, 444, 446,
+    448,
+};
+static const uint8_t sniffble_data[] = {
+    0x97, 0x00, 0x97, 0x00, 0x84, 0x00, 0x02, 0x06, 0x02, 0x0F, 0x89, 0x00, 0x00, 0x06, 0x84, 0x00,
+    0x82, 0x00, 0x06, 0x04, 0x1E, 0x0C, 0x07, 0x03, 0x0A, 0x0B, 0x86, 0x00, 0x02, 0x10, 0x16, 0x1C,
+    0x83, 0x00, 0x81, 0x00, 0x01, 0x11, 0x19, 0x84, 0x01, 0x02, 0x1A, 0x1F, 0x06, 0x84, 0x00, 0x03,
+    0x0E, 0x09, 0x07, 0x11, 0x82, 0x00, 0x02, 0x00, 0x08, 0x19, 0x87, 0x01, 0x00, 0x05, 0x82, 0x00,
+    0x08, 0x02, 0x15, 0x0E, 0x1B, 0x0A, 0x18, 0x02, 0x00, 0x00, 0x01, 0x00, 0x12, 0x82, 0x01, 0x02,
+    0x0D, 0x15, 0x14, 0x82, 0x01, 0x0C, 0x17, 0x08, 0x00, 0x00, 0x28, 0x07, 0x13, 0x06, 0x04, 0x03,
+    0x1F, 0x00, 0x00, 0x01, 0x06, 0x26, 0x82, 0x01, 0x03, 0x03, 0x0E, 0x0F, 0x0A, 0x82, 0x01, 0x0B,
+    0x24, 0x00, 0x02, 0x00, 0x23, 0x0D, 0x2B, 0x00, 0x05, 0x07, 0x04, 0x00, 0x17, 0x02, 0x03, 0x01,
+    0x01, 0x1A, 0x03, 0x02, 0x11, 0x08, 0x13, 0x01, 0x01, 0x05, 0x10, 0x18, 0x0B, 0x00, 0x12, 0x07,
+    0x04, 0x02, 0x17, 0x05, 0x00, 0x17, 0x02, 0x03, 0x01, 0x0C, 0x0B, 0x09, 0x04, 0x09, 0x10, 0x21,
+    0x27, 0x01, 0x05, 0x06, 0x13, 0x03, 0x08, 0x02, 0x07, 0x05, 0x00, 0x09, 0x09, 0x00, 0x17, 0x02,
+    0x03, 0x01, 0x0D, 0x0B, 0x0F, 0x06, 0x20, 0x04, 0x14, 0x01, 0x01, 0x05, 0x00, 0x04, 0x07, 0x05,
+    0x00, 0x0A, 0x09, 0x00, 0x12, 0x18, 0x1B, 0x08, 0x02, 0x03, 0x01, 0x01, 0x0D, 0x1C, 0x00, 0x04,
+    0x0C, 0x82, 0x01, 0x0B, 0x05, 0x00, 0x00, 0x14, 0x13, 0x00, 0x25, 0x16, 0x00, 0x15, 0x03, 0x02,
+    0x08, 0x02, 0x03, 0x01, 0x01, 0x0D, 0x1C, 0x00, 0x04, 0x0C, 0x82, 0x01, 0x0B, 0x05, 0x00, 0x00,
+    0x14, 0x2C, 0x00, 0x25, 0x16, 0x00, 0x15, 0x03, 0x02, 0x17, 0x02, 0x03, 0x01, 0x0D, 0x0B, 0x0F,
+    0x06, 0x20, 0x04, 0x14, 0x01, 0x01, 0x05, 0x00, 0x04, 0x07, 0x1D, 0x00, 0x0A, 0x09, 0x00, 0x12,
+    0x0C, 0x1B, 0x17, 0x02, 0x03, 0x01, 0x0C, 0x0B, 0x09, 0x04, 0x09, 0x10, 0x21, 0x27, 0x01, 0x05,
+    0x06, 0x09, 0x03, 0x02, 0x08, 0x07, 0x1D, 0x00, 0x0A, 0x09, 0x00, 0x17, 0x02, 0x03, 0x01, 0x01,
+    0x1A, 0x03, 0x02, 0x11, 0x08, 0x13, 0x01, 0x01, 0x05, 0x10, 0x18, 0x23, 0x00, 0x12, 0x17, 0x08,
+    0x08, 0x07, 0x1D, 0x00, 0x01, 0x06, 0x26, 0x82, 0x01, 0x03, 0x03, 0x0E, 0x0F, 0x0A, 0x82, 0x01,
+    0x0B, 0x24, 0x00, 0x0E, 0x00, 0x0B, 0x0D, 0x05, 0x00, 0x2A, 0x07, 0x04, 0x00, 0x01, 0x00, 0x12,
+    0x82, 0x01, 0x02, 0x0D, 0x15, 0x16, 0x82, 0x01, 0x0C, 0x17, 0x08, 0x00, 0x00, 0x10, 0x07, 0x13,
+    0x00, 0x04, 0x17, 0x1E, 0x00, 0x00, 0x02, 0x00, 0x08, 0x19, 0x87, 0x01, 0x00, 0x05, 0x82, 0x00,
+    0x08, 0x08, 0x29, 0x06, 0x0E, 0x14, 0x0C, 0x02, 0x00, 0x00, 0x81, 0x00, 0x01, 0x11, 0x19, 0x84,
+    0x01, 0x02, 0x1A, 0x1F, 0x06, 0x84, 0x00, 0x03, 0x0E, 0x0A, 0x07, 0x22, 0x82, 0x00, 0x82, 0x00,
+    0x06, 0x04, 0x1E, 0x0C, 0x07, 0x03, 0x0A, 0x0B, 0x86, 0x00, 0x02, 0x22, 0x16, 0x11, 0x83, 0x00,
+    0x84, 0x00, 0x02, 0x06, 0x02, 0x0F, 0x89, 0x00, 0x00, 0x06, 0x84, 0x00, 0x97, 0x00, 0x97, 0x00,
+};
+const asset_image_t sniffble = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 45,
+    .palette = sniffble_palette,
+    .rows = sniffble_rows,
+    .data = sniffble_data,
+};
+
+// dispoble: 24x24, 1152 -> 544 bytes
+static const uint16_t dispoble_palette[] = {
+    0x895F, 0x0000, 0x1846, 0x813D, 0x0823, 0x1024, 0x815E, 0x793C, 0x306B, 0x6918, 0x793D, 0x915F,
+    0x711A, 0x0001, 0x40B0, 0x48B0, 0x58D4, 0x60F7, 0x68F7, 0x1847, 0x50D3, 0x6919, 0x7119, 0x1845,
+    0x2869, 0x40AF, 0x2047, 0x793B, 0x0801, 0x0802, 0x2048, 0x60F6, 0x917F, 0x1023, 0x1025, 0x1825,
+    0x306A, 0x388D, 0x408E, 0x0822, 0x286A, 0x388E, 0x48B1, 0x50D2,
+};
+static const uint16_t dispoble_rows[] = {
+    0, 10, 21, 31, 40, 55, 67, 84, 100, 119, 140, 160,
+    177, 196, 216, 235, 252, 269, 286, 304, 323, 342, 362, 375,
+    386,
+};
+static const uint8_t dispoble_data[] = {
+    0x81, 0x01, 0x00, 0x04, 0x8F, 0x02, 0x00, 0x05, 0x83, 0x01, 0x02, 0x01, 0x28, 0x0C, 0x8F, 0x03,
+    0x01, 0x1B, 0x19, 0x82, 0x01, 0x01, 0x04, 0x0C, 0x91, 0x00, 0x03, 0x06, 0x1A, 0x01, 0x01, 0x01,
+    0x02, 0x03, 0x92, 0x00, 0x02, 0x08, 0x01, 0x01, 0x01, 0x02, 0x03, 0x88, 0x00, 0x01, 0x1B, 0x09,
+    0x86, 0x12, 0x03, 0x09, 0x18, 0x01, 0x01, 0x01, 0x02, 0x03, 0x87, 0x00, 0x01, 0x14, 0x05, 0x88,
+    0x04, 0x82, 0x01, 0x01, 0x02, 0x03, 0x86, 0x00, 0x03, 0x16, 0x21, 0x26, 0x16, 0x86, 0x0C, 0x03,
+    0x09, 0x18, 0x01, 0x01, 0x01, 0x02, 0x03, 0x86, 0x00, 0x02, 0x10, 0x05, 0x07, 0x87, 0x00, 0x03,
+    0x0B, 0x1F, 0x01, 0x01, 0x01, 0x02, 0x03, 0x86, 0x00, 0x06, 0x14, 0x05, 0x07, 0x00, 0x00, 0x1B,
+    0x0E, 0x84, 0x08, 0x02, 0x1E, 0x01, 0x01, 0x01, 0x02, 0x03, 0x85, 0x00, 0x08, 0x0B, 0x10, 0x05,
+    0x07, 0x00, 0x07, 0x1E, 0x05, 0x24, 0x83, 0x08, 0x02, 0x24, 0x05, 0x01, 0x02, 0x22, 0x11, 0x16,
+    0x84, 0x15, 0x07, 0x16, 0x19, 0x05, 0x07, 0x00, 0x10, 0x21, 0x16, 0x85, 0x00, 0x01, 0x09, 0x27,
+    0x00, 0x01, 0x87, 0x04, 0x06, 0x1C, 0x05, 0x07, 0x00, 0x0F, 0x02, 0x06, 0x85, 0x00, 0x01, 0x03,
+    0x17, 0x01, 0x05, 0x1F, 0x85, 0x09, 0x07, 0x15, 0x19, 0x05, 0x07, 0x00, 0x0F, 0x02, 0x06, 0x85,
+    0x00, 0x01, 0x0A, 0x02, 0x02, 0x1C, 0x1F, 0x20, 0x84, 0x0B, 0x07, 0x20, 0x10, 0x05, 0x07, 0x00,
+    0x0F, 0x02, 0x06, 0x85, 0x00, 0x01, 0x0A, 0x02, 0x02, 0x01, 0x05, 0x2B, 0x85, 0x11, 0x06, 0x29,
+    0x05, 0x07, 0x00, 0x0F, 0x02, 0x06, 0x85, 0x00, 0x01, 0x0A, 0x02, 0x86, 0x01, 0x08, 0x0D, 0x04,
+    0x1D, 0x05, 0x07, 0x00, 0x0F, 0x02, 0x06, 0x85, 0x00, 0x01, 0x0A, 0x02, 0x86, 0x01, 0x08, 0x22,
+    0x16, 0x0F, 0x05, 0x07, 0x00, 0x0F, 0x02, 0x06, 0x85, 0x00, 0x01, 0x0A, 0x02, 0x86, 0x01, 0x08,
+    0x25, 0x0B, 0x10, 0x05, 0x07, 0x00, 0x0F, 0x02, 0x06, 0x85, 0x00, 0x01, 0x03, 0x02, 0x85, 0x01,
+    0x09, 0x1A, 0x09, 0x0B, 0x10, 0x0D, 0x1A, 0x1E, 0x05, 0x02, 0x07, 0x85, 0x06, 0x01, 0x1B, 0x17,
+    0x84, 0x01, 0x0A, 0x08, 0x03, 0x00, 0x00, 0x10, 0x1D, 0x25, 0x19, 0x1A, 0x0D, 0x02, 0x85, 0x13,
+    0x01, 0x02, 0x0D, 0x84, 0x01, 0x00, 0x14, 0x82, 0x00, 0x06, 0x14, 0x05, 0x03, 0x20, 0x2A, 0x04,
+    0x19, 0x85, 0x0E, 0x01, 0x26, 0x04, 0x84, 0x01, 0x00, 0x05, 0x82, 0x18, 0x06, 0x17, 0x0D, 0x14,
+    0x06, 0x0E, 0x02, 0x06, 0x84, 0x00, 0x02, 0x0B, 0x03, 0x23, 0x8A, 0x01, 0x04, 0x0D, 0x17, 0x04,
+    0x1D, 0x10, 0x85, 0x0A, 0x01, 0x14, 0x0D, 0x8E, 0x01, 0x01, 0x1C, 0x17, 0x83, 0x02, 0x02, 0x23,
+    0x0D, 0x01,
+};
+const asset_image_t dispoble = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 44,
+    .palette = dispoble_palette,
+    .rows = dispoble_rows,
+    .data = dispoble_data,
+};
+
+// sniff_wifi: 24x24, 1152 -> 548 bytes
+static const uint16_t sniff_wifi_palette[] = {
+    0x0000, 0x895F, 0x0001, 0x1023, 0x48B1, 0x793C, 0x1024, 0x793B, 0x0823, 0x306B, 0x815E, 0x48B0,
+    0x6918, 0x2869, 0x50D3, 0x308C, 0x58F5, 0x711A, 0x1025, 0x308B, 0x388D, 0x58D4, 0x60F7, 0x895E,
+    0x1845, 0x2068, 0x286A, 0x306A, 0x388C, 0x40B0, 0x48D1, 0x48D2, 0x50D2, 0x68F7, 0x1825, 0x40AF,
+    0x60F5, 0x60F6, 0x6919, 0x7119,
+};
+static const uint16_t sniff_wifi_rows[] = {
+    0, 2, 18, 34, 52, 70, 95, 117, 131, 143, 160, 179,
+    198, 217, 236, 254, 266, 281, 303, 328, 346, 364, 380, 396,
+    398,
+};
+static const uint8_t sniff_wifi_data[] = {
+    0x97, 0x00, 0x81, 0x00, 0x03, 0x06, 0x13, 0x0D, 0x02, 0x8B, 0x00, 0x05, 0x02, 0x0D, 0x09, 0x03,
+    0x00, 0x00, 0x05, 0x00, 0x06, 0x0C, 0x01, 0x01, 0x04, 0x8B, 0x00, 0x05, 0x1F, 0x01, 0x01, 0x0C,
+    0x03, 0x00, 0x01, 0x00, 0x13, 0x82, 0x01, 0x01, 0x07, 0x03, 0x89, 0x00, 0x01, 0x06, 0x05, 0x82,
+    0x01, 0x01, 0x09, 0x00, 0x01, 0x00, 0x0D, 0x82, 0x01, 0x01, 0x07, 0x03, 0x89, 0x00, 0x06, 0x06,
+    0x05, 0x01, 0x01, 0x17, 0x19, 0x00, 0x17, 0x00, 0x02, 0x04, 0x07, 0x07, 0x0A, 0x04, 0x02, 0x00,
+    0x03, 0x0E, 0x10, 0x10, 0x0E, 0x08, 0x00, 0x02, 0x1E, 0x0A, 0x07, 0x07, 0x0B, 0x02, 0x00, 0x82,
+    0x00, 0x81, 0x03, 0x04, 0x04, 0x0A, 0x04, 0x03, 0x04, 0x83, 0x01, 0x06, 0x0B, 0x03, 0x04, 0x0A,
+    0x0B, 0x08, 0x03, 0x82, 0x00, 0x85, 0x00, 0x02, 0x0E, 0x01, 0x07, 0x85, 0x01, 0x02, 0x07, 0x01,
+    0x0E, 0x85, 0x00, 0x84, 0x00, 0x01, 0x02, 0x25, 0x89, 0x01, 0x01, 0x10, 0x02, 0x84, 0x00, 0x84,
+    0x00, 0x00, 0x0F, 0x83, 0x01, 0x03, 0x07, 0x16, 0x16, 0x07, 0x83, 0x01, 0x00, 0x09, 0x84, 0x00,
+    0x84, 0x00, 0x0D, 0x04, 0x01, 0x01, 0x26, 0x13, 0x22, 0x14, 0x14, 0x12, 0x0F, 0x27, 0x01, 0x01,
+    0x1D, 0x84, 0x00, 0x84, 0x00, 0x0D, 0x12, 0x05, 0x16, 0x08, 0x00, 0x0F, 0x01, 0x01, 0x09, 0x00,
+    0x03, 0x0C, 0x05, 0x06, 0x84, 0x00, 0x84, 0x00, 0x0D, 0x12, 0x05, 0x21, 0x03, 0x00, 0x09, 0x01,
+    0x01, 0x1A, 0x00, 0x06, 0x0C, 0x05, 0x06, 0x84, 0x00, 0x84, 0x00, 0x0D, 0x04, 0x01, 0x01, 0x11,
+    0x1C, 0x18, 0x1C, 0x0F, 0x18, 0x14, 0x11, 0x01, 0x01, 0x0B, 0x84, 0x00, 0x84, 0x00, 0x00, 0x09,
+    0x83, 0x01, 0x03, 0x05, 0x0C, 0x0C, 0x05, 0x82, 0x01, 0x01, 0x17, 0x1B, 0x84, 0x00, 0x84, 0x00,
+    0x01, 0x02, 0x24, 0x89, 0x01, 0x01, 0x10, 0x02, 0x84, 0x00, 0x84, 0x00, 0x03, 0x02, 0x15, 0x01,
+    0x11, 0x85, 0x01, 0x02, 0x11, 0x01, 0x0E, 0x85, 0x00, 0x82, 0x00, 0x81, 0x06, 0x04, 0x1E, 0x0A,
+    0x1D, 0x08, 0x0B, 0x83, 0x01, 0x06, 0x23, 0x08, 0x04, 0x0A, 0x04, 0x06, 0x06, 0x82, 0x00, 0x17,
+    0x00, 0x02, 0x1F, 0x05, 0x05, 0x0A, 0x0B, 0x00, 0x00, 0x03, 0x20, 0x15, 0x15, 0x20, 0x08, 0x00,
+    0x02, 0x04, 0x0A, 0x05, 0x05, 0x04, 0x02, 0x00, 0x01, 0x00, 0x0D, 0x82, 0x01, 0x01, 0x07, 0x08,
+    0x89, 0x00, 0x01, 0x06, 0x05, 0x82, 0x01, 0x01, 0x0D, 0x00, 0x01, 0x00, 0x09, 0x82, 0x01, 0x01,
+    0x07, 0x03, 0x89, 0x00, 0x01, 0x06, 0x05, 0x82, 0x01, 0x01, 0x1A, 0x00, 0x05, 0x00, 0x03, 0x0C,
+    0x01, 0x17, 0x0B, 0x8B, 0x00, 0x05, 0x04, 0x01, 0x01, 0x21, 0x08, 0x00, 0x81, 0x00, 0x03, 0x08,
+    0x09, 0x19, 0x02, 0x8B, 0x00, 0x05, 0x02, 0x0D, 0x1B, 0x08, 0x00, 0x00, 0x97, 0x00,
+};
+const asset_image_t sniff_wifi = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 40,
+    .palette = sniff_wifi_palette,
+    .rows = sniff_wifi_rows,
+    .data = sniff_wifi_data,
+};
+
+// select_wifi: 12x12, 288 -> 225 bytes
+static const uint16_t select_wifi_palette[] = {
+    0x895F, 0x388D, 0x58D4, 0x50D2, 0x50D3, 0x793C, 0x308C, 0x48D2, 0x813D, 0x793D, 0x308B, 0x793B,
+    0x0000, 0x0802, 0x0822, 0x1846, 0x40AF, 0x58F5, 0x711A, 0x815E, 0x40B0, 0x48B0, 0x48B1, 0x58D3,
+    0x60F7, 0x6918, 0x7119, 0x713B,
+};
+static const uint16_t select_wifi_rows[] = {
+    0, 10, 20, 29, 37, 47, 58, 71, 84, 97, 105, 113,
+    123,
+};
+static const uint8_t select_wifi_data[] = {
+    0x02, 0x0C, 0x0D, 0x14, 0x85, 0x07, 0x02, 0x03, 0x04, 0x0A, 0x02, 0x0E, 0x0F, 0x06, 0x85, 0x01,
+    0x02, 0x06, 0x02, 0x02, 0x01, 0x03, 0x08, 0x86, 0x05, 0x02, 0x1A, 0x06, 0x03, 0x00, 0x02, 0x87,
+    0x00, 0x02, 0x08, 0x01, 0x03, 0x00, 0x02, 0x85, 0x00, 0x04, 0x1B, 0x13, 0x08, 0x01, 0x03, 0x00,
+    0x02, 0x84, 0x00, 0x05, 0x11, 0x01, 0x13, 0x08, 0x01, 0x03, 0x0B, 0x02, 0x00, 0x18, 0x19, 0x00,
+    0x11, 0x06, 0x0B, 0x00, 0x09, 0x01, 0x03, 0x0B, 0x02, 0x00, 0x12, 0x0A, 0x10, 0x06, 0x0B, 0x00,
+    0x00, 0x09, 0x01, 0x03, 0x05, 0x02, 0x00, 0x00, 0x12, 0x10, 0x0B, 0x82, 0x00, 0x02, 0x09, 0x01,
+    0x03, 0x00, 0x02, 0x87, 0x00, 0x02, 0x09, 0x06, 0x15, 0x00, 0x02, 0x87, 0x00, 0x02, 0x08, 0x0F,
+    0x0D, 0x01, 0x0A, 0x17, 0x85, 0x04, 0x03, 0x02, 0x16, 0x0E, 0x0C,
+};
+const asset_image_t select_wifi = {
+    .width = 12,
+    .height = 12,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 28,
+    .palette = select_wifi_palette,
+    .rows = select_wifi_rows,
+    .data = select_wifi_data,
+};
+
+// moni_wifi: 24x24, 1152 -> 487 bytes
+static const uint16_t moni_wifi_palette[] = {
+    0x0000, 0x895F, 0x813D, 0x793B, 0x793C, 0x1024, 0x2048, 0x6918, 0x815E, 0x915F, 0x0001, 0x1025,
+    0x286A, 0x0801, 0x0802, 0x1825, 0x2869, 0x306B, 0x388D, 0x60F7, 0x711A, 0x1846, 0x2047, 0x308C,
+    0x50D3, 0x60F6, 0x0823, 0x1023, 0x1845, 0x2068, 0x388E, 0x40AF, 0x48B1, 0x6919, 0x895E, 0x0822,
+    0x1847, 0x40AE, 0x40B0, 0x48B0, 0x48D1, 0x48D2, 0x50D2, 0x58D4, 0x793D,
+};
+static const uint16_t moni_wifi_rows[] = {
+    0, 2, 13, 27, 44, 62, 79, 95, 110, 125, 140, 155,
+    170, 186, 206, 226, 245, 264, 276, 288, 299, 309, 318, 325,
+    327,
+};
+static const uint8_t moni_wifi_data[] = {
+    0x97, 0x00, 0x85, 0x00, 0x05, 0x0A, 0x0B, 0x06, 0x1D, 0x15, 0x0E, 0x8B, 0x00, 0x84, 0x00, 0x08,
+    0x0C, 0x19, 0x04, 0x01, 0x01, 0x02, 0x21, 0x1E, 0x0E, 0x89, 0x00, 0x82, 0x00, 0x0B, 0x0D, 0x29,
+    0x08, 0x09, 0x01, 0x02, 0x02, 0x01, 0x09, 0x01, 0x13, 0x0B, 0x88, 0x00, 0x82, 0x00, 0x0C, 0x28,
+    0x01, 0x01, 0x13, 0x11, 0x0F, 0x0B, 0x1D, 0x18, 0x08, 0x01, 0x07, 0x1A, 0x87, 0x00, 0x81, 0x00,
+    0x04, 0x0C, 0x08, 0x01, 0x2A, 0x0E, 0x84, 0x00, 0x03, 0x17, 0x02, 0x01, 0x20, 0x87, 0x00, 0x81,
+    0x00, 0x03, 0x19, 0x09, 0x13, 0x0E, 0x86, 0x00, 0x03, 0x27, 0x01, 0x04, 0x05, 0x86, 0x00, 0x04,
+    0x00, 0x05, 0x04, 0x01, 0x11, 0x87, 0x00, 0x03, 0x0B, 0x04, 0x01, 0x11, 0x86, 0x00, 0x04, 0x00,
+    0x16, 0x08, 0x02, 0x15, 0x87, 0x00, 0x03, 0x0A, 0x07, 0x09, 0x1F, 0x86, 0x00, 0x04, 0x00, 0x06,
+    0x22, 0x02, 0x0F, 0x87, 0x00, 0x03, 0x0A, 0x07, 0x09, 0x1F, 0x86, 0x00, 0x04, 0x00, 0x0F, 0x02,
+    0x01, 0x10, 0x87, 0x00, 0x03, 0x1B, 0x03, 0x01, 0x17, 0x86, 0x00, 0x04, 0x00, 0x0A, 0x07, 0x09,
+    0x2B, 0x87, 0x00, 0x03, 0x12, 0x01, 0x02, 0x1C, 0x86, 0x00, 0x81, 0x00, 0x03, 0x12, 0x01, 0x08,
+    0x12, 0x85, 0x00, 0x03, 0x16, 0x03, 0x01, 0x18, 0x87, 0x00, 0x81, 0x00, 0x0E, 0x0D, 0x19, 0x01,
+    0x08, 0x20, 0x1C, 0x0D, 0x0A, 0x05, 0x12, 0x03, 0x01, 0x22, 0x17, 0x1A, 0x86, 0x00, 0x82, 0x00,
+    0x0E, 0x05, 0x13, 0x01, 0x01, 0x02, 0x21, 0x07, 0x04, 0x01, 0x01, 0x02, 0x01, 0x02, 0x03, 0x0C,
+    0x85, 0x00, 0x83, 0x00, 0x02, 0x23, 0x26, 0x03, 0x83, 0x01, 0x07, 0x02, 0x18, 0x10, 0x03, 0x01,
+    0x01, 0x2C, 0x0C, 0x84, 0x00, 0x85, 0x00, 0x08, 0x1B, 0x0C, 0x1E, 0x25, 0x11, 0x0F, 0x00, 0x0D,
+    0x07, 0x82, 0x01, 0x01, 0x04, 0x10, 0x83, 0x00, 0x8D, 0x00, 0x01, 0x15, 0x14, 0x82, 0x01, 0x01,
+    0x04, 0x06, 0x82, 0x00, 0x8E, 0x00, 0x01, 0x16, 0x03, 0x82, 0x01, 0x03, 0x03, 0x06, 0x00, 0x00,
+    0x8F, 0x00, 0x01, 0x06, 0x03, 0x82, 0x01, 0x02, 0x14, 0x05, 0x00, 0x90, 0x00, 0x06, 0x06, 0x04,
+    0x01, 0x01, 0x14, 0x05, 0x00, 0x91, 0x00, 0x05, 0x10, 0x04, 0x14, 0x24, 0x00, 0x00, 0x92, 0x00,
+    0x01, 0x0B, 0x05, 0x82, 0x00, 0x97, 0x00,
+};
+const asset_image_t moni_wifi = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 45,
+    .palette = moni_wifi_palette,
+    .rows = moni_wifi_rows,
+    .data = moni_wifi_data,
+};
+
+// atack_wifi: 24x24, 1152 -> 529 bytes
+static const uint16_t atack_wifi_palette[] = {
+    0x895F, 0x0000, 0x1024, 0x793C, 0x815E, 0x40AF, 0x813D, 0x0001, 0x0802, 0x48B1, 0x60F6, 0x711A,
+    0x0823, 0x1023, 0x2048, 0x48B0, 0x60F7, 0x1025, 0x1846, 0x2869, 0x58D4, 0x793B, 0x308B, 0x308C,
+    0x388D, 0x50D2, 0x6918, 0x713B, 0x0822, 0x40B0, 0x48D2, 0x58F5, 0x68F7, 0x793D, 0x0801, 0x2047,
+    0x2068, 0x2069, 0x286A, 0x388E, 0x408E, 0x40AE, 0x48D1, 0x50D3, 0x7119,
+};
+static const uint16_t atack_wifi_rows[] = {
+    0, 13, 29, 43, 55, 67, 77, 87, 95, 103, 111, 132,
+    157, 180, 205, 230, 253, 277, 298, 308, 318, 328, 340, 356,
+    369,
+};
+static const uint8_t atack_wifi_data[] = {
+    0x87, 0x01, 0x07, 0x0C, 0x0E, 0x18, 0x05, 0x05, 0x18, 0x0E, 0x0C, 0x87, 0x01, 0x85, 0x01, 0x03,
+    0x12, 0x2A, 0x0B, 0x04, 0x83, 0x00, 0x03, 0x04, 0x0B, 0x09, 0x12, 0x85, 0x01, 0x83, 0x01, 0x02,
+    0x08, 0x0F, 0x06, 0x89, 0x00, 0x02, 0x06, 0x0F, 0x08, 0x83, 0x01, 0x82, 0x01, 0x01, 0x02, 0x0A,
+    0x8D, 0x00, 0x01, 0x0A, 0x0D, 0x82, 0x01, 0x81, 0x01, 0x01, 0x1C, 0x0A, 0x8F, 0x00, 0x03, 0x0A,
+    0x08, 0x01, 0x01, 0x81, 0x01, 0x00, 0x09, 0x91, 0x00, 0x02, 0x0F, 0x01, 0x01, 0x02, 0x01, 0x12,
+    0x06, 0x91, 0x00, 0x02, 0x21, 0x12, 0x01, 0x01, 0x01, 0x0F, 0x93, 0x00, 0x01, 0x1D, 0x01, 0x01,
+    0x07, 0x1A, 0x93, 0x00, 0x01, 0x10, 0x07, 0x01, 0x02, 0x15, 0x93, 0x00, 0x01, 0x1B, 0x0D, 0x01,
+    0x11, 0x03, 0x83, 0x00, 0x83, 0x03, 0x03, 0x06, 0x00, 0x00, 0x04, 0x83, 0x03, 0x00, 0x04, 0x82,
+    0x00, 0x01, 0x15, 0x02, 0x01, 0x0D, 0x1B, 0x82, 0x00, 0x09, 0x20, 0x11, 0x02, 0x02, 0x0D, 0x16,
+    0x00, 0x00, 0x09, 0x0D, 0x82, 0x02, 0x00, 0x19, 0x82, 0x00, 0x01, 0x0B, 0x0C, 0x01, 0x07, 0x10,
+    0x82, 0x00, 0x00, 0x20, 0x83, 0x01, 0x03, 0x13, 0x00, 0x00, 0x1D, 0x83, 0x01, 0x00, 0x09, 0x82,
+    0x00, 0x01, 0x0A, 0x07, 0x01, 0x01, 0x05, 0x82, 0x00, 0x0D, 0x04, 0x13, 0x01, 0x01, 0x07, 0x1F,
+    0x00, 0x00, 0x0B, 0x02, 0x01, 0x01, 0x11, 0x1B, 0x82, 0x00, 0x01, 0x29, 0x01, 0x02, 0x01, 0x11,
+    0x03, 0x82, 0x00, 0x0B, 0x15, 0x27, 0x26, 0x14, 0x00, 0x10, 0x10, 0x00, 0x1A, 0x16, 0x17, 0x1A,
+    0x82, 0x00, 0x02, 0x03, 0x02, 0x01, 0x81, 0x01, 0x03, 0x05, 0x00, 0x04, 0x2C, 0x83, 0x00, 0x03,
+    0x10, 0x08, 0x08, 0x0A, 0x83, 0x00, 0x05, 0x0B, 0x06, 0x00, 0x28, 0x01, 0x01, 0x81, 0x01, 0x03,
+    0x22, 0x14, 0x1F, 0x0F, 0x83, 0x00, 0x04, 0x17, 0x0E, 0x24, 0x16, 0x04, 0x82, 0x00, 0x05, 0x19,
+    0x2B, 0x14, 0x07, 0x01, 0x01, 0x82, 0x01, 0x02, 0x1C, 0x02, 0x05, 0x83, 0x00, 0x03, 0x06, 0x04,
+    0x04, 0x06, 0x83, 0x00, 0x02, 0x09, 0x0C, 0x08, 0x82, 0x01, 0x84, 0x01, 0x00, 0x05, 0x8B, 0x00,
+    0x00, 0x1E, 0x84, 0x01, 0x84, 0x01, 0x00, 0x05, 0x8B, 0x00, 0x00, 0x1E, 0x84, 0x01, 0x84, 0x01,
+    0x00, 0x05, 0x8B, 0x00, 0x00, 0x09, 0x84, 0x01, 0x84, 0x01, 0x01, 0x0E, 0x21, 0x89, 0x00, 0x01,
+    0x06, 0x13, 0x84, 0x01, 0x85, 0x01, 0x03, 0x23, 0x19, 0x0B, 0x04, 0x83, 0x00, 0x03, 0x04, 0x15,
+    0x14, 0x25, 0x85, 0x01, 0x87, 0x01, 0x07, 0x0C, 0x0E, 0x17, 0x05, 0x05, 0x18, 0x13, 0x02, 0x87,
+    0x01,
+};
+const asset_image_t atack_wifi = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 45,
+    .palette = atack_wifi_palette,
+    .rows = atack_wifi_rows,
+    .data = atack_wifi_data,
+};
+
+// timeout: 24x24, 1152 -> 535 bytes
+static const uint16_t timeout_palette[] = {
+    0x0000, 0x813D, 0x1846, 0x60F6, 0x793C, 0x815E, 0x0001, 0x0802, 0x6918, 0x793B, 0x1023, 0x2047,
+    0x1024, 0x1025, 0x1825, 0x2048, 0x58D4, 0x0801, 0x50D3, 0x58F5, 0x0823, 0x2869, 0x306B, 0x308C,
+    0x40B0, 0x48B1, 0x50D2, 0x60F5, 0x60F7, 0x6919, 0x711A, 0x895F, 0x0822, 0x2068, 0x286A, 0x308B,
+    0x388D, 0x388E, 0x408E, 0x40AF, 0x48B0, 0x7119, 0x1845, 0x1847, 0x58F4, 0x713B,
+};
+static const uint16_t timeout_rows[] = {
+    0, 2, 4, 12, 24, 41, 60, 80, 98, 116, 134, 152,
+    172, 196, 219, 240, 259, 277, 295, 316, 335, 352, 365, 371,
+    373,
+};
+static const uint8_t timeout_data[] = {
+    0x97, 0x00, 0x97, 0x00, 0x89, 0x00, 0x02, 0x02, 0x12, 0x25, 0x8A, 0x00, 0x88, 0x00, 0x06, 0x26,
+    0x04, 0x1F, 0x09, 0x25, 0x0F, 0x07, 0x87, 0x00, 0x85, 0x00, 0x0B, 0x06, 0x02, 0x07, 0x13, 0x1F,
+    0x1F, 0x05, 0x01, 0x05, 0x1D, 0x17, 0x06, 0x85, 0x00, 0x84, 0x00, 0x0D, 0x06, 0x22, 0x1E, 0x0D,
+    0x07, 0x26, 0x09, 0x10, 0x0E, 0x23, 0x1C, 0x05, 0x2C, 0x0A, 0x84, 0x00, 0x84, 0x00, 0x0E, 0x10,
+    0x1A, 0x2B, 0x06, 0x00, 0x00, 0x0C, 0x14, 0x00, 0x00, 0x06, 0x24, 0x01, 0x03, 0x14, 0x83, 0x00,
+    0x83, 0x00, 0x02, 0x21, 0x19, 0x21, 0x83, 0x00, 0x81, 0x0D, 0x83, 0x00, 0x02, 0x22, 0x01, 0x1A,
+    0x83, 0x00, 0x82, 0x00, 0x02, 0x0E, 0x04, 0x16, 0x84, 0x00, 0x81, 0x13, 0x84, 0x00, 0x02, 0x18,
+    0x01, 0x0F, 0x82, 0x00, 0x82, 0x00, 0x02, 0x0E, 0x17, 0x07, 0x84, 0x00, 0x81, 0x03, 0x84, 0x00,
+    0x02, 0x0A, 0x09, 0x12, 0x82, 0x00, 0x81, 0x00, 0x02, 0x20, 0x08, 0x24, 0x85, 0x00, 0x81, 0x03,
+    0x85, 0x00, 0x04, 0x1A, 0x2D, 0x20, 0x00, 0x00, 0x81, 0x00, 0x03, 0x02, 0x01, 0x19, 0x0A, 0x84,
+    0x00, 0x81, 0x03, 0x84, 0x00, 0x05, 0x0A, 0x19, 0x01, 0x02, 0x00, 0x00, 0x81, 0x00, 0x04, 0x0B,
+    0x05, 0x05, 0x1C, 0x07, 0x83, 0x00, 0x02, 0x10, 0x09, 0x0D, 0x82, 0x00, 0x06, 0x07, 0x1C, 0x05,
+    0x05, 0x0B, 0x00, 0x00, 0x81, 0x00, 0x03, 0x02, 0x01, 0x10, 0x0F, 0x84, 0x00, 0x03, 0x0F, 0x04,
+    0x08, 0x0C, 0x82, 0x00, 0x05, 0x0F, 0x10, 0x01, 0x02, 0x00, 0x00, 0x81, 0x00, 0x02, 0x0A, 0x04,
+    0x28, 0x86, 0x00, 0x03, 0x15, 0x04, 0x08, 0x0C, 0x82, 0x00, 0x04, 0x28, 0x04, 0x0A, 0x00, 0x00,
+    0x82, 0x00, 0x02, 0x03, 0x1D, 0x07, 0x86, 0x00, 0x07, 0x15, 0x04, 0x08, 0x14, 0x00, 0x07, 0x1D,
+    0x03, 0x82, 0x00, 0x82, 0x00, 0x02, 0x16, 0x05, 0x17, 0x87, 0x00, 0x06, 0x15, 0x03, 0x0D, 0x00,
+    0x23, 0x05, 0x16, 0x82, 0x00, 0x82, 0x00, 0x03, 0x11, 0x03, 0x09, 0x02, 0x87, 0x00, 0x05, 0x06,
+    0x00, 0x02, 0x09, 0x03, 0x11, 0x82, 0x00, 0x83, 0x00, 0x03, 0x02, 0x09, 0x29, 0x0B, 0x82, 0x00,
+    0x01, 0x02, 0x2A, 0x82, 0x00, 0x03, 0x0B, 0x29, 0x09, 0x02, 0x83, 0x00, 0x84, 0x00, 0x0D, 0x0B,
+    0x1E, 0x04, 0x18, 0x0E, 0x11, 0x1B, 0x13, 0x11, 0x0E, 0x18, 0x04, 0x1E, 0x0B, 0x84, 0x00, 0x85,
+    0x00, 0x0B, 0x0C, 0x12, 0x01, 0x01, 0x08, 0x01, 0x01, 0x08, 0x01, 0x01, 0x12, 0x0C, 0x85, 0x00,
+    0x87, 0x00, 0x07, 0x02, 0x27, 0x1B, 0x08, 0x08, 0x1B, 0x27, 0x02, 0x87, 0x00, 0x8A, 0x00, 0x81,
+    0x06, 0x8A, 0x00, 0x97, 0x00,
+};
+const asset_image_t timeout = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 46,
+    .palette = timeout_palette,
+    .rows = timeout_rows,
+    .data = timeout_data,
+};
+
+// brilho: 24x24, 1152 -> 474 bytes
+static const uint16_t brilho_palette[] = {
+    0x0000, 0x895F, 0x388D, 0x58D4, 0x58F4, 0x793C, 0x40AF, 0x48B1, 0x1825, 0x1847, 0x308B, 0x58F5,
+    0x813D, 0x0802, 0x1024, 0x286A, 0x306B, 0x388C, 0x48B0, 0x815E, 0x0822, 0x0001, 0x2069, 0x6918,
+};
+static const uint16_t brilho_rows[] = {
+    0, 6, 12, 18, 34, 52, 73, 92, 108, 123, 140, 156,
+    178, 200, 216, 233, 248, 264, 283, 304, 322, 338, 344, 350,
+    356,
+};
+static const uint8_t brilho_data[] = {
+    0x8A, 0x00, 0x81, 0x0A, 0x8A, 0x00, 0x8A, 0x00, 0x81, 0x04, 0x8A, 0x00, 0x8A, 0x00, 0x81, 0x04,
+    0x8A, 0x00, 0x82, 0x00, 0x01, 0x0F, 0x02, 0x85, 0x00, 0x81, 0x03, 0x85, 0x00, 0x01, 0x02, 0x0F,
+    0x82, 0x00, 0x82, 0x00, 0x02, 0x02, 0x0C, 0x06, 0x84, 0x00, 0x81, 0x09, 0x84, 0x00, 0x02, 0x06,
+    0x0C, 0x02, 0x82, 0x00, 0x83, 0x00, 0x0F, 0x06, 0x13, 0x02, 0x00, 0x00, 0x08, 0x11, 0x12, 0x07,
+    0x02, 0x08, 0x00, 0x00, 0x02, 0x13, 0x06, 0x83, 0x00, 0x84, 0x00, 0x0D, 0x02, 0x10, 0x0D, 0x07,
+    0x05, 0x01, 0x01, 0x0C, 0x05, 0x05, 0x07, 0x14, 0x10, 0x02, 0x84, 0x00, 0x85, 0x00, 0x01, 0x14,
+    0x0B, 0x83, 0x01, 0x05, 0x0B, 0x0E, 0x06, 0x05, 0x0B, 0x14, 0x85, 0x00, 0x85, 0x00, 0x00, 0x07,
+    0x84, 0x01, 0x05, 0x03, 0x00, 0x00, 0x16, 0x05, 0x07, 0x85, 0x00, 0x84, 0x00, 0x01, 0x08, 0x05,
+    0x84, 0x01, 0x00, 0x03, 0x82, 0x00, 0x02, 0x06, 0x05, 0x08, 0x84, 0x00, 0x84, 0x00, 0x00, 0x11,
+    0x85, 0x01, 0x00, 0x03, 0x82, 0x00, 0x02, 0x0E, 0x05, 0x02, 0x84, 0x00, 0x05, 0x0A, 0x04, 0x04,
+    0x03, 0x09, 0x12, 0x85, 0x01, 0x00, 0x03, 0x82, 0x00, 0x07, 0x15, 0x17, 0x07, 0x09, 0x03, 0x04,
+    0x04, 0x0A, 0x05, 0x0A, 0x04, 0x04, 0x03, 0x09, 0x12, 0x85, 0x01, 0x00, 0x03, 0x82, 0x00, 0x07,
+    0x15, 0x17, 0x07, 0x09, 0x03, 0x04, 0x04, 0x0A, 0x84, 0x00, 0x00, 0x11, 0x85, 0x01, 0x00, 0x03,
+    0x82, 0x00, 0x02, 0x0E, 0x05, 0x02, 0x84, 0x00, 0x84, 0x00, 0x01, 0x08, 0x05, 0x84, 0x01, 0x00,
+    0x03, 0x82, 0x00, 0x02, 0x06, 0x05, 0x08, 0x84, 0x00, 0x85, 0x00, 0x00, 0x07, 0x84, 0x01, 0x05,
+    0x03, 0x00, 0x00, 0x16, 0x05, 0x07, 0x85, 0x00, 0x85, 0x00, 0x01, 0x0D, 0x0B, 0x83, 0x01, 0x05,
+    0x0B, 0x0E, 0x06, 0x05, 0x0B, 0x0D, 0x85, 0x00, 0x84, 0x00, 0x0D, 0x02, 0x10, 0x0D, 0x07, 0x05,
+    0x01, 0x01, 0x0C, 0x05, 0x05, 0x07, 0x0D, 0x10, 0x02, 0x84, 0x00, 0x83, 0x00, 0x0F, 0x06, 0x13,
+    0x02, 0x00, 0x00, 0x08, 0x11, 0x12, 0x07, 0x02, 0x08, 0x00, 0x00, 0x02, 0x13, 0x06, 0x83, 0x00,
+    0x82, 0x00, 0x02, 0x02, 0x0C, 0x06, 0x84, 0x00, 0x81, 0x09, 0x84, 0x00, 0x02, 0x06, 0x0C, 0x02,
+    0x82, 0x00, 0x82, 0x00, 0x01, 0x0F, 0x02, 0x85, 0x00, 0x81, 0x03, 0x85, 0x00, 0x01, 0x02, 0x0F,
+    0x82, 0x00, 0x8A, 0x00, 0x81, 0x04, 0x8A, 0x00, 0x8A, 0x00, 0x81, 0x04, 0x8A, 0x00, 0x8A, 0x00,
+    0x81, 0x0A, 0x8A, 0x00,
+};
+const asset_image_t brilho = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 24,
+    .palette = brilho_palette,
+    .rows = brilho_rows,
+    .data = brilho_data,
+};
+
+// infra1: 12x12, 288 -> 222 bytes
+static const uint16_t infra1_palette[] = {
+    0x0000, 0x895F, 0x286A, 0x1024, 0x388C, 0x58D4, 0x58F5, 0x60F7, 0x711A, 0x0001, 0x0802, 0x40AF,
+    0x50D2, 0x6918, 0x1846, 0x2048, 0x306B, 0x308B, 0x388D, 0x7119, 0x1025, 0x2047, 0x2869, 0x306A,
+    0x408E, 0x48B1, 0x48D2, 0x60F5, 0x60F6, 0x68F7, 0x793C, 0x813D,
+};
+static const uint16_t infra1_rows[] = {
+    0, 5, 10, 17, 30, 43, 56, 69, 82, 95, 102, 107,
+    112,
+};
+static const uint8_t infra1_data[] = {
+    0x01, 0x19, 0x03, 0x89, 0x00, 0x01, 0x0D, 0x0E, 0x89, 0x00, 0x01, 0x0D, 0x16, 0x87, 0x00, 0x81,
+    0x0A, 0x03, 0x08, 0x1E, 0x0B, 0x09, 0x82, 0x00, 0x04, 0x03, 0x14, 0x17, 0x04, 0x0B, 0x0B, 0x08,
+    0x01, 0x01, 0x12, 0x00, 0x04, 0x0F, 0x05, 0x02, 0x06, 0x11, 0x1B, 0x0B, 0x08, 0x01, 0x01, 0x07,
+    0x00, 0x0C, 0x04, 0x05, 0x02, 0x06, 0x02, 0x07, 0x0B, 0x08, 0x01, 0x01, 0x07, 0x00, 0x0C, 0x04,
+    0x05, 0x02, 0x06, 0x02, 0x07, 0x0B, 0x13, 0x01, 0x01, 0x18, 0x00, 0x12, 0x0F, 0x05, 0x02, 0x06,
+    0x10, 0x1C, 0x03, 0x13, 0x1F, 0x1A, 0x0A, 0x82, 0x00, 0x81, 0x03, 0x02, 0x02, 0x11, 0x0B, 0x01,
+    0x0D, 0x10, 0x87, 0x00, 0x81, 0x09, 0x01, 0x1D, 0x15, 0x89, 0x00, 0x01, 0x0C, 0x0E, 0x89, 0x00,
+};
+const asset_image_t infra1 = {
+    .width = 12,
+    .height = 12,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 32,
+    .palette = infra1_palette,
+    .rows = infra1_rows,
+    .data = infra1_data,
+};
+
+// ar: 24x24, 1152 -> 335 bytes
+static const uint16_t ar_palette[] = {
+    0x0000, 0x895F, 0x58D4, 0x0001, 0x6918, 0x48B0, 0x388D, 0x815E, 0x0823, 0x711A, 0x1024, 0x915F,
+    0x306B, 0x40AF, 0x58F5, 0x7119, 0x793B, 0x0802, 0x1845, 0x1846, 0x0822, 0x308C, 0x388E, 0x50D3,
+    0x1023, 0x2068, 0x50D2,
+};
+static const uint16_t ar_rows[] = {
+    0, 2, 4, 6, 8, 16, 30, 45, 60, 68, 78, 88,
+    98, 108, 116, 127, 142, 158, 175, 191, 203, 205, 207, 209,
+    211,
+};
+static const uint8_t ar_data[] = {
+    0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x01, 0x00, 0x0C, 0x93, 0x02, 0x01, 0x0C, 0x00,
+    0x02, 0x11, 0x0F, 0x0B, 0x86, 0x01, 0x83, 0x0B, 0x86, 0x01, 0x02, 0x0B, 0x0F, 0x11, 0x01, 0x08,
+    0x09, 0x87, 0x01, 0x03, 0x10, 0x0F, 0x0F, 0x10, 0x87, 0x01, 0x01, 0x09, 0x08, 0x01, 0x08, 0x09,
+    0x87, 0x01, 0x03, 0x17, 0x16, 0x16, 0x17, 0x87, 0x01, 0x01, 0x09, 0x08, 0x01, 0x08, 0x09, 0x93,
+    0x01, 0x01, 0x09, 0x08, 0x02, 0x08, 0x09, 0x01, 0x91, 0x07, 0x02, 0x01, 0x09, 0x08, 0x02, 0x08,
+    0x09, 0x04, 0x91, 0x06, 0x02, 0x04, 0x09, 0x08, 0x02, 0x08, 0x09, 0x09, 0x91, 0x05, 0x81, 0x09,
+    0x00, 0x08, 0x02, 0x14, 0x09, 0x10, 0x91, 0x02, 0x02, 0x10, 0x09, 0x14, 0x01, 0x00, 0x0D, 0x93,
+    0x04, 0x01, 0x0D, 0x00, 0x81, 0x00, 0x88, 0x03, 0x01, 0x19, 0x12, 0x88, 0x03, 0x81, 0x00, 0x86,
+    0x00, 0x09, 0x15, 0x13, 0x00, 0x18, 0x02, 0x0A, 0x00, 0x00, 0x15, 0x13, 0x86, 0x00, 0x85, 0x00,
+    0x0A, 0x0A, 0x0E, 0x08, 0x00, 0x11, 0x1A, 0x0C, 0x00, 0x0A, 0x0E, 0x08, 0x86, 0x00, 0x85, 0x00,
+    0x0B, 0x03, 0x0D, 0x05, 0x03, 0x00, 0x0A, 0x0E, 0x0A, 0x00, 0x0D, 0x05, 0x03, 0x85, 0x00, 0x86,
+    0x00, 0x0A, 0x08, 0x0E, 0x0A, 0x00, 0x13, 0x0D, 0x03, 0x00, 0x08, 0x0E, 0x0A, 0x85, 0x00, 0x86,
+    0x00, 0x01, 0x12, 0x0C, 0x85, 0x00, 0x01, 0x12, 0x0C, 0x86, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97,
+    0x00, 0x97, 0x00,
+};
+const asset_image_t ar = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 27,
+    .palette = ar_palette,
+    .rows = ar_rows,
+    .data = ar_data,
+};
+
+// audio: 24x24, 1152 -> 582 bytes
+static const uint16_t audio_palette[] = {
+    0x0000, 0x895F, 0x48B1, 0x286A, 0x0823, 0x50D2, 0x50D3, 0x815E, 0x915F, 0x0802, 0x1025, 0x1825,
+    0x1846, 0x2047, 0x2869, 0x308C, 0x388D, 0x711A, 0x0822, 0x1024, 0x2048, 0x306B, 0x388C, 0x388E,
+    0x40AE, 0x40AF, 0x40B0, 0x48B0, 0x60F6, 0x60F7, 0x6918, 0x6919, 0x7119, 0x793C,
+};
+static const uint16_t audio_rows[] = {
+    0, 2, 8, 23, 38, 60, 84, 108, 132, 156, 180, 204,
+    228, 252, 276, 300, 324, 348, 372, 394, 415, 430, 440, 442,
+    444,
+};
+static const uint8_t audio_data[] = {
+    0x97, 0x00, 0x93, 0x00, 0x00, 0x0E, 0x82, 0x02, 0x83, 0x02, 0x81, 0x0B, 0x86, 0x02, 0x00, 0x0E,
+    0x84, 0x00, 0x01, 0x0E, 0x07, 0x82, 0x01, 0x83, 0x01, 0x81, 0x03, 0x86, 0x01, 0x01, 0x07, 0x0E,
+    0x83, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x07, 0x82, 0x01, 0x81, 0x03, 0x82, 0x01, 0x00, 0x07,
+    0x83, 0x01, 0x00, 0x02, 0x83, 0x00, 0x04, 0x02, 0x01, 0x01, 0x11, 0x16, 0x0E, 0x0D, 0x15, 0x1E,
+    0x01, 0x03, 0x03, 0x01, 0x1E, 0x15, 0x0D, 0x16, 0x11, 0x01, 0x01, 0x02, 0x83, 0x00, 0x04, 0x02,
+    0x01, 0x21, 0x0C, 0x0A, 0x0E, 0x0F, 0x0C, 0x13, 0x20, 0x03, 0x03, 0x20, 0x13, 0x0C, 0x0F, 0x0A,
+    0x0C, 0x21, 0x01, 0x02, 0x83, 0x00, 0x04, 0x02, 0x08, 0x05, 0x04, 0x06, 0x0E, 0x10, 0x06, 0x0A,
+    0x18, 0x03, 0x03, 0x18, 0x0A, 0x06, 0x10, 0x06, 0x04, 0x05, 0x08, 0x02, 0x83, 0x00, 0x04, 0x02,
+    0x08, 0x1A, 0x0B, 0x05, 0x0E, 0x14, 0x02, 0x0D, 0x0F, 0x03, 0x03, 0x0F, 0x0D, 0x02, 0x14, 0x05,
+    0x0B, 0x1A, 0x08, 0x02, 0x83, 0x00, 0x04, 0x02, 0x08, 0x1D, 0x09, 0x17, 0x0E, 0x05, 0x19, 0x09,
+    0x06, 0x03, 0x03, 0x06, 0x09, 0x19, 0x05, 0x17, 0x09, 0x1D, 0x08, 0x02, 0x83, 0x00, 0x04, 0x02,
+    0x01, 0x01, 0x1B, 0x04, 0x0E, 0x04, 0x12, 0x10, 0x07, 0x03, 0x03, 0x07, 0x10, 0x12, 0x04, 0x04,
+    0x1B, 0x01, 0x01, 0x02, 0x83, 0x00, 0x00, 0x02, 0x82, 0x01, 0x00, 0x11, 0x0A, 0x1C, 0x1F, 0x01,
+    0x01, 0x03, 0x03, 0x01, 0x01, 0x1F, 0x1C, 0x11, 0x82, 0x01, 0x00, 0x02, 0x83, 0x00, 0x00, 0x02,
+    0x82, 0x01, 0x00, 0x11, 0x0A, 0x1C, 0x1F, 0x01, 0x01, 0x03, 0x03, 0x01, 0x01, 0x1F, 0x1C, 0x11,
+    0x82, 0x01, 0x00, 0x02, 0x83, 0x00, 0x04, 0x02, 0x01, 0x01, 0x1B, 0x04, 0x0E, 0x04, 0x12, 0x10,
+    0x07, 0x03, 0x03, 0x07, 0x10, 0x12, 0x04, 0x04, 0x1B, 0x01, 0x01, 0x02, 0x83, 0x00, 0x04, 0x02,
+    0x08, 0x1D, 0x09, 0x17, 0x0E, 0x05, 0x19, 0x09, 0x06, 0x03, 0x03, 0x06, 0x09, 0x19, 0x05, 0x17,
+    0x09, 0x1D, 0x08, 0x02, 0x83, 0x00, 0x04, 0x02, 0x08, 0x1A, 0x0B, 0x05, 0x0E, 0x14, 0x02, 0x0D,
+    0x0F, 0x03, 0x03, 0x0F, 0x0D, 0x02, 0x14, 0x05, 0x0B, 0x1A, 0x08, 0x02, 0x83, 0x00, 0x04, 0x02,
+    0x08, 0x05, 0x04, 0x06, 0x0E, 0x10, 0x06, 0x0A, 0x18, 0x03, 0x03, 0x18, 0x0A, 0x06, 0x10, 0x06,
+    0x04, 0x05, 0x08, 0x02, 0x83, 0x00, 0x04, 0x02, 0x01, 0x21, 0x0C, 0x0A, 0x0E, 0x0F, 0x0C, 0x13,
+    0x20, 0x03, 0x03, 0x20, 0x13, 0x0C, 0x0F, 0x0A, 0x0C, 0x21, 0x01, 0x02, 0x83, 0x00, 0x04, 0x02,
+    0x01, 0x01, 0x11, 0x16, 0x0E, 0x0D, 0x15, 0x1E, 0x01, 0x03, 0x03, 0x01, 0x1E, 0x15, 0x0D, 0x16,
+    0x11, 0x01, 0x01, 0x02, 0x83, 0x00, 0x00, 0x02, 0x83, 0x01, 0x00, 0x07, 0x82, 0x01, 0x81, 0x03,
+    0x82, 0x01, 0x00, 0x07, 0x83, 0x01, 0x00, 0x02, 0x83, 0x00, 0x01, 0x0E, 0x07, 0x82, 0x01, 0x83,
+    0x01, 0x81, 0x03, 0x86, 0x01, 0x01, 0x07, 0x0E, 0x84, 0x00, 0x00, 0x0E, 0x82, 0x02, 0x83, 0x02,
+    0x81, 0x0B, 0x86, 0x02, 0x00, 0x0E, 0x89, 0x00, 0x97, 0x00, 0x97, 0x00,
+};
+const asset_image_t audio = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 34,
+    .palette = audio_palette,
+    .rows = audio_rows,
+    .data = audio_data,
+};
+
+// tvs: 24x24, 1152 -> 417 bytes
+static const uint16_t tvs_palette[] = {
+    0x0000, 0x895F, 0x793B, 0x50D2, 0x0823, 0x813D, 0x1846, 0x0802, 0x0001, 0x48B0, 0x58D4, 0x1825,
+    0x1845, 0x40AE, 0x40AF, 0x50D3, 0x60F6, 0x815E, 0x2047, 0x68F7, 0x7119, 0x711A, 0x915F, 0x1024,
+    0x1847, 0x2068, 0x2869, 0x286A, 0x306A, 0x308B, 0x388C, 0x388D, 0x388E, 0x408E, 0x60F7, 0x711B,
+    0x793C, 0x813E,
+};
+static const uint16_t tvs_rows[] = {
+    0, 2, 4, 6, 8, 18, 28, 40, 50, 73, 96, 118,
+    139, 160, 181, 191, 201, 219, 239, 253, 263, 265, 267, 269,
+    271,
+};
+static const uint8_t tvs_data[] = {
+    0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x81, 0x00, 0x00, 0x08, 0x91, 0x04, 0x02, 0x08,
+    0x00, 0x00, 0x81, 0x00, 0x00, 0x0D, 0x91, 0x02, 0x02, 0x0D, 0x00, 0x00, 0x81, 0x00, 0x01, 0x0F,
+    0x16, 0x8F, 0x01, 0x03, 0x16, 0x0F, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x91, 0x01, 0x02, 0x03,
+    0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x83, 0x01, 0x09, 0x14, 0x20, 0x1F, 0x09, 0x05, 0x0A, 0x23,
+    0x01, 0x0A, 0x15, 0x83, 0x01, 0x02, 0x03, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x83, 0x01, 0x09,
+    0x15, 0x1B, 0x07, 0x0E, 0x05, 0x1C, 0x0E, 0x24, 0x0B, 0x13, 0x83, 0x01, 0x02, 0x03, 0x00, 0x00,
+    0x81, 0x00, 0x00, 0x03, 0x84, 0x01, 0x08, 0x10, 0x06, 0x25, 0x01, 0x0F, 0x12, 0x03, 0x18, 0x05,
+    0x83, 0x01, 0x02, 0x03, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x84, 0x01, 0x07, 0x10, 0x06, 0x05,
+    0x01, 0x02, 0x0C, 0x17, 0x0D, 0x84, 0x01, 0x02, 0x03, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x84,
+    0x01, 0x07, 0x10, 0x06, 0x05, 0x01, 0x01, 0x1D, 0x00, 0x13, 0x84, 0x01, 0x02, 0x03, 0x00, 0x00,
+    0x81, 0x00, 0x00, 0x03, 0x84, 0x01, 0x07, 0x14, 0x21, 0x11, 0x01, 0x01, 0x22, 0x1E, 0x05, 0x84,
+    0x01, 0x02, 0x03, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x91, 0x01, 0x02, 0x03, 0x00, 0x00, 0x81,
+    0x00, 0x00, 0x03, 0x91, 0x01, 0x02, 0x03, 0x00, 0x00, 0x81, 0x00, 0x04, 0x09, 0x11, 0x05, 0x01,
+    0x01, 0x89, 0x05, 0x81, 0x01, 0x04, 0x05, 0x11, 0x09, 0x00, 0x00, 0x81, 0x00, 0x05, 0x07, 0x0C,
+    0x1A, 0x02, 0x0E, 0x0B, 0x87, 0x06, 0x07, 0x0B, 0x09, 0x02, 0x19, 0x0C, 0x07, 0x00, 0x00, 0x83,
+    0x00, 0x02, 0x12, 0x0A, 0x07, 0x89, 0x00, 0x02, 0x07, 0x0A, 0x06, 0x83, 0x00, 0x84, 0x00, 0x00,
+    0x08, 0x8B, 0x00, 0x00, 0x08, 0x84, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00,
+};
+const asset_image_t tvs = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 38,
+    .palette = tvs_palette,
+    .rows = tvs_rows,
+    .data = tvs_data,
+};
+
+// readnfc: 24x24, 1152 -> 509 bytes
+static const uint16_t readnfc_palette[] = {
+    0x0000, 0x60F6, 0x1846, 0x0802, 0x306B, 0x1024, 0x286A, 0x50D2, 0x0001, 0x2869, 0x388D, 0x48B1,
+    0x50D3, 0x58F5, 0x40AF, 0x60F7, 0x1825, 0x2047, 0x2048, 0x388E, 0x40B0, 0x48B0, 0x0801, 0x0822,
+    0x1023, 0x388C, 0x408E, 0x40AE, 0x58F4, 0x711A, 0x0823, 0x1025, 0x1845, 0x308B, 0x308C, 0x58D4,
+    0x60F5, 0x68F7, 0x6918, 0x7119, 0x1847, 0x2068, 0x306A, 0x813D,
+};
+static const uint16_t readnfc_rows[] = {
+    0, 2, 4, 6, 8, 18, 36, 56, 75, 96, 118, 143,
+    168, 193, 218, 242, 266, 284, 303, 325, 343, 345, 347, 349,
+    351,
+};
+static const uint8_t readnfc_data[] = {
+    0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x87, 0x00, 0x04, 0x1F, 0x09, 0x21, 0x04, 0x12,
+    0x8A, 0x00, 0x84, 0x00, 0x0C, 0x10, 0x0C, 0x01, 0x0B, 0x19, 0x06, 0x04, 0x13, 0x17, 0x03, 0x12,
+    0x0A, 0x20, 0x85, 0x00, 0x82, 0x00, 0x03, 0x08, 0x07, 0x0C, 0x1F, 0x82, 0x00, 0x07, 0x11, 0x14,
+    0x0D, 0x01, 0x1C, 0x1B, 0x09, 0x01, 0x85, 0x00, 0x81, 0x00, 0x02, 0x03, 0x01, 0x12, 0x83, 0x00,
+    0x03, 0x16, 0x26, 0x02, 0x08, 0x83, 0x00, 0x00, 0x01, 0x85, 0x00, 0x81, 0x00, 0x08, 0x0D, 0x02,
+    0x00, 0x00, 0x08, 0x03, 0x13, 0x00, 0x01, 0x85, 0x00, 0x03, 0x0B, 0x0E, 0x11, 0x08, 0x82, 0x00,
+    0x0A, 0x00, 0x09, 0x0E, 0x00, 0x03, 0x10, 0x07, 0x05, 0x0F, 0x00, 0x01, 0x85, 0x00, 0x06, 0x04,
+    0x07, 0x0E, 0x0F, 0x05, 0x00, 0x00, 0x17, 0x00, 0x0D, 0x03, 0x09, 0x18, 0x01, 0x11, 0x0E, 0x15,
+    0x02, 0x07, 0x05, 0x00, 0x04, 0x0D, 0x13, 0x00, 0x10, 0x0B, 0x00, 0x02, 0x15, 0x00, 0x00, 0x17,
+    0x00, 0x01, 0x00, 0x04, 0x22, 0x24, 0x03, 0x0D, 0x04, 0x2A, 0x19, 0x09, 0x00, 0x26, 0x03, 0x21,
+    0x24, 0x03, 0x2B, 0x05, 0x08, 0x23, 0x00, 0x00, 0x17, 0x00, 0x01, 0x00, 0x09, 0x0A, 0x1C, 0x03,
+    0x01, 0x06, 0x04, 0x28, 0x0E, 0x00, 0x06, 0x0C, 0x00, 0x11, 0x25, 0x1D, 0x05, 0x00, 0x01, 0x00,
+    0x00, 0x17, 0x00, 0x0D, 0x16, 0x0A, 0x05, 0x0F, 0x10, 0x0B, 0x1B, 0x11, 0x08, 0x0F, 0x12, 0x1A,
+    0x1D, 0x07, 0x00, 0x05, 0x14, 0x1B, 0x00, 0x01, 0x00, 0x00, 0x10, 0x00, 0x06, 0x13, 0x00, 0x1E,
+    0x06, 0x0B, 0x02, 0x01, 0x08, 0x00, 0x12, 0x27, 0x06, 0x27, 0x0C, 0x02, 0x83, 0x00, 0x02, 0x07,
+    0x05, 0x00, 0x81, 0x00, 0x06, 0x01, 0x10, 0x00, 0x00, 0x20, 0x03, 0x0C, 0x82, 0x00, 0x04, 0x01,
+    0x1D, 0x04, 0x0B, 0x14, 0x83, 0x00, 0x02, 0x02, 0x0B, 0x00, 0x81, 0x00, 0x02, 0x17, 0x0F, 0x02,
+    0x87, 0x00, 0x03, 0x1E, 0x0D, 0x0E, 0x01, 0x84, 0x00, 0x01, 0x25, 0x00, 0x82, 0x00, 0x03, 0x16,
+    0x0C, 0x07, 0x18, 0x87, 0x00, 0x02, 0x02, 0x0A, 0x0C, 0x82, 0x00, 0x81, 0x1A, 0x00, 0x00, 0x84,
+    0x00, 0x12, 0x02, 0x23, 0x01, 0x14, 0x04, 0x29, 0x06, 0x0A, 0x07, 0x0F, 0x14, 0x00, 0x15, 0x13,
+    0x06, 0x1C, 0x15, 0x00, 0x00, 0x87, 0x00, 0x05, 0x02, 0x04, 0x0A, 0x22, 0x09, 0x05, 0x82, 0x00,
+    0x03, 0x17, 0x0A, 0x19, 0x18, 0x82, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00,
+};
+const asset_image_t readnfc = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 44,
+    .palette = readnfc_palette,
+    .rows = readnfc_rows,
+    .data = readnfc_data,
+};
+
+// raw: 24x24, 1152 -> 428 bytes
+static const uint16_t raw_palette[] = {
+    0x0000, 0x895F, 0x286A, 0x813D, 0x2048, 0x40AF, 0x1846, 0x1024, 0x58F5, 0x0823, 0x388D, 0x50D2,
+    0x793C, 0x0802, 0x308C, 0x1025, 0x2869, 0x306B, 0x48B1, 0x50D3, 0x60F6, 0x6919, 0x7119, 0x711A,
+    0x713B, 0x793B, 0x0822, 0x1045, 0x1825, 0x1845, 0x306A, 0x388C, 0x40AE, 0x48D2, 0x58D4, 0x58F4,
+    0x60F7, 0x793D, 0x895E,
+};
+static const uint16_t raw_rows[] = {
+    0, 2, 8, 17, 27, 38, 50, 63, 75, 81, 87, 93,
+    103, 113, 138, 163, 188, 213, 238, 248, 260, 266, 272, 278,
+    280,
+};
+static const uint8_t raw_data[] = {
+    0x97, 0x00, 0x84, 0x00, 0x87, 0x02, 0x8A, 0x00, 0x84, 0x00, 0x87, 0x01, 0x01, 0x1B, 0x0F, 0x88,
+    0x00, 0x84, 0x00, 0x87, 0x01, 0x02, 0x06, 0x0C, 0x07, 0x87, 0x00, 0x84, 0x00, 0x87, 0x01, 0x03,
+    0x06, 0x01, 0x19, 0x09, 0x86, 0x00, 0x84, 0x00, 0x87, 0x01, 0x04, 0x06, 0x01, 0x01, 0x18, 0x1A,
+    0x85, 0x00, 0x84, 0x00, 0x87, 0x01, 0x00, 0x06, 0x82, 0x01, 0x01, 0x16, 0x0D, 0x84, 0x00, 0x84,
+    0x00, 0x87, 0x01, 0x00, 0x06, 0x83, 0x04, 0x00, 0x07, 0x84, 0x00, 0x84, 0x00, 0x8D, 0x01, 0x84,
+    0x00, 0x84, 0x00, 0x8D, 0x01, 0x84, 0x00, 0x84, 0x00, 0x8D, 0x04, 0x84, 0x00, 0x82, 0x00, 0x00,
+    0x13, 0x8F, 0x03, 0x00, 0x13, 0x82, 0x00, 0x81, 0x00, 0x00, 0x11, 0x91, 0x01, 0x02, 0x11, 0x00,
+    0x00, 0x81, 0x00, 0x05, 0x05, 0x01, 0x01, 0x08, 0x08, 0x24, 0x82, 0x01, 0x0C, 0x14, 0x03, 0x16,
+    0x18, 0x19, 0x14, 0x01, 0x08, 0x01, 0x01, 0x05, 0x00, 0x00, 0x81, 0x00, 0x15, 0x05, 0x01, 0x01,
+    0x00, 0x20, 0x06, 0x0B, 0x01, 0x17, 0x00, 0x05, 0x0B, 0x0E, 0x0A, 0x00, 0x15, 0x07, 0x01, 0x01,
+    0x05, 0x00, 0x00, 0x81, 0x00, 0x15, 0x05, 0x01, 0x01, 0x00, 0x1F, 0x07, 0x23, 0x01, 0x0A, 0x0E,
+    0x09, 0x15, 0x1C, 0x0F, 0x1D, 0x02, 0x0E, 0x01, 0x01, 0x05, 0x00, 0x00, 0x81, 0x00, 0x15, 0x05,
+    0x01, 0x01, 0x00, 0x0B, 0x09, 0x25, 0x26, 0x0D, 0x09, 0x00, 0x08, 0x0D, 0x07, 0x21, 0x00, 0x22,
+    0x01, 0x01, 0x05, 0x00, 0x00, 0x81, 0x00, 0x15, 0x05, 0x01, 0x01, 0x00, 0x01, 0x0A, 0x1E, 0x08,
+    0x04, 0x03, 0x0B, 0x10, 0x10, 0x0A, 0x17, 0x00, 0x0C, 0x01, 0x01, 0x05, 0x00, 0x00, 0x81, 0x00,
+    0x00, 0x02, 0x91, 0x01, 0x02, 0x02, 0x00, 0x00, 0x82, 0x00, 0x01, 0x12, 0x0C, 0x8D, 0x03, 0x01,
+    0x0C, 0x12, 0x82, 0x00, 0x84, 0x00, 0x8D, 0x02, 0x84, 0x00, 0x84, 0x00, 0x8D, 0x01, 0x84, 0x00,
+    0x84, 0x00, 0x8D, 0x02, 0x84, 0x00, 0x97, 0x00,
+};
+const asset_image_t raw = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 39,
+    .palette = raw_palette,
+    .rows = raw_rows,
+    .data = raw_data,
+};
+
+// control: 24x24, 1152 -> 483 bytes
+static const uint16_t control_palette[] = {
+    0x0000, 0x895F, 0x0802, 0x6918, 0x813D, 0x0001, 0x711A, 0x1825, 0x2869, 0x306B, 0x793C, 0x815E,
+    0x286A, 0x58F5, 0x0801, 0x0823, 0x1846, 0x308B, 0x1024, 0x1025, 0x408E, 0x60F7, 0x713B, 0x793B,
+    0x0822, 0x1847, 0x2047, 0x388D, 0x50D3, 0x60F6, 0x1845, 0x2069, 0x388E, 0x50D2, 0x58D4, 0x58F4,
+    0x68F7,
+};
+static const uint16_t control_rows[] = {
+    0, 2, 4, 6, 12, 31, 52, 75, 96, 117, 135, 152,
+    167, 188, 209, 229, 247, 263, 285, 305, 321, 333, 335, 337,
+    339,
+};
+static const uint8_t control_data[] = {
+    0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x8A, 0x00, 0x81, 0x12, 0x8A, 0x00, 0x83, 0x00, 0x01, 0x10,
+    0x18, 0x83, 0x00, 0x03, 0x05, 0x15, 0x15, 0x05, 0x83, 0x00, 0x01, 0x18, 0x10, 0x83, 0x00, 0x82,
+    0x00, 0x02, 0x12, 0x0A, 0x1C, 0x83, 0x00, 0x03, 0x02, 0x06, 0x06, 0x02, 0x83, 0x00, 0x02, 0x21,
+    0x0A, 0x13, 0x82, 0x00, 0x82, 0x00, 0x03, 0x02, 0x03, 0x0B, 0x1A, 0x82, 0x00, 0x03, 0x02, 0x06,
+    0x06, 0x02, 0x82, 0x00, 0x03, 0x10, 0x04, 0x03, 0x02, 0x82, 0x00, 0x83, 0x00, 0x02, 0x09, 0x01,
+    0x22, 0x82, 0x00, 0x03, 0x02, 0x06, 0x06, 0x02, 0x82, 0x00, 0x02, 0x1C, 0x01, 0x09, 0x83, 0x00,
+    0x83, 0x00, 0x0F, 0x02, 0x03, 0x0B, 0x1A, 0x00, 0x00, 0x0E, 0x03, 0x03, 0x0E, 0x00, 0x00, 0x10,
+    0x04, 0x03, 0x02, 0x83, 0x00, 0x84, 0x00, 0x02, 0x09, 0x04, 0x09, 0x82, 0x00, 0x81, 0x07, 0x82,
+    0x00, 0x02, 0x0C, 0x04, 0x09, 0x84, 0x00, 0x85, 0x00, 0x07, 0x07, 0x05, 0x00, 0x00, 0x05, 0x0E,
+    0x0E, 0x05, 0x82, 0x00, 0x00, 0x07, 0x85, 0x00, 0x86, 0x00, 0x09, 0x19, 0x14, 0x23, 0x03, 0x06,
+    0x06, 0x03, 0x0D, 0x14, 0x19, 0x86, 0x00, 0x83, 0x00, 0x0F, 0x05, 0x0C, 0x1D, 0x0B, 0x01, 0x0B,
+    0x0A, 0x16, 0x16, 0x0A, 0x0B, 0x01, 0x0B, 0x1D, 0x0C, 0x05, 0x83, 0x00, 0x82, 0x00, 0x01, 0x07,
+    0x0D, 0x83, 0x01, 0x05, 0x1B, 0x0F, 0x02, 0x02, 0x0F, 0x1B, 0x83, 0x01, 0x01, 0x0D, 0x07, 0x82,
+    0x00, 0x81, 0x00, 0x01, 0x08, 0x17, 0x84, 0x01, 0x00, 0x08, 0x83, 0x00, 0x00, 0x08, 0x84, 0x01,
+    0x03, 0x17, 0x08, 0x00, 0x00, 0x02, 0x00, 0x0C, 0x04, 0x85, 0x01, 0x00, 0x08, 0x83, 0x00, 0x00,
+    0x08, 0x85, 0x01, 0x02, 0x04, 0x0C, 0x00, 0x01, 0x05, 0x03, 0x86, 0x01, 0x00, 0x1F, 0x83, 0x00,
+    0x00, 0x08, 0x86, 0x01, 0x01, 0x03, 0x05, 0x02, 0x00, 0x09, 0x04, 0x83, 0x01, 0x02, 0x16, 0x20,
+    0x02, 0x83, 0x00, 0x02, 0x02, 0x14, 0x17, 0x83, 0x01, 0x02, 0x04, 0x09, 0x00, 0x81, 0x00, 0x05,
+    0x11, 0x04, 0x01, 0x01, 0x15, 0x07, 0x87, 0x00, 0x07, 0x1E, 0x24, 0x01, 0x01, 0x04, 0x11, 0x00,
+    0x00, 0x82, 0x00, 0x03, 0x11, 0x0A, 0x0D, 0x0F, 0x89, 0x00, 0x03, 0x0F, 0x0D, 0x0A, 0x11, 0x82,
+    0x00, 0x83, 0x00, 0x01, 0x13, 0x02, 0x8B, 0x00, 0x01, 0x02, 0x13, 0x83, 0x00, 0x97, 0x00, 0x97,
+    0x00, 0x97, 0x00,
+};
+const asset_image_t control = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 37,
+    .palette = control_palette,
+    .rows = control_rows,
+    .data = control_data,
+};
+
+// leitorir: 24x24, 1152 -> 591 bytes
+static const uint16_t leitorir_palette[] = {
+    0x0000, 0x793C, 0x0802, 0x2048, 0x0822, 0x813D, 0x58F5, 0x0001, 0x40AF, 0x388D, 0x1023, 0x286A,
+    0x60F7, 0x711A, 0x793B, 0x50D3, 0x1024, 0x50D2, 0x60F6, 0x895F, 0x0823, 0x58F4, 0x1025, 0x2047,
+    0x308C, 0x40B0, 0x68F7, 0x6918, 0x7119, 0x1846, 0x58D4, 0x0801, 0x1825, 0x1845, 0x1847, 0x2068,
+    0x2869, 0x306B, 0x308B, 0x388C, 0x388E, 0x408E, 0x48B0, 0x48B1, 0x6919, 0x713B,
+};
+static const uint16_t leitorir_rows[] = {
+    0, 9, 20, 32, 50, 68, 87, 107, 128, 150, 169, 191,
+    214, 238, 262, 286, 308, 329, 349, 368, 384, 399, 411, 421,
+    429,
+};
+static const uint8_t leitorir_data[] = {
+    0x8E, 0x00, 0x03, 0x20, 0x0B, 0x22, 0x02, 0x84, 0x00, 0x8E, 0x00, 0x05, 0x08, 0x01, 0x01, 0x1B,
+    0x27, 0x07, 0x82, 0x00, 0x8E, 0x00, 0x08, 0x07, 0x16, 0x03, 0x11, 0x05, 0x06, 0x14, 0x00, 0x00,
+    0x88, 0x00, 0x0E, 0x07, 0x29, 0x06, 0x18, 0x00, 0x00, 0x0B, 0x0F, 0x18, 0x14, 0x03, 0x0E, 0x06,
+    0x07, 0x00, 0x88, 0x00, 0x0E, 0x2A, 0x01, 0x12, 0x05, 0x08, 0x00, 0x25, 0x0C, 0x01, 0x2C, 0x1D,
+    0x03, 0x05, 0x27, 0x00, 0x87, 0x00, 0x0F, 0x09, 0x13, 0x1B, 0x14, 0x09, 0x05, 0x08, 0x00, 0x00,
+    0x21, 0x0C, 0x2C, 0x14, 0x11, 0x1B, 0x02, 0x86, 0x00, 0x10, 0x24, 0x01, 0x06, 0x0E, 0x1E, 0x04,
+    0x09, 0x05, 0x08, 0x00, 0x00, 0x21, 0x01, 0x18, 0x03, 0x01, 0x22, 0x85, 0x00, 0x11, 0x1D, 0x0E,
+    0x0F, 0x07, 0x03, 0x01, 0x15, 0x04, 0x09, 0x05, 0x08, 0x00, 0x00, 0x0C, 0x0F, 0x16, 0x01, 0x0B,
+    0x84, 0x00, 0x12, 0x10, 0x1C, 0x0C, 0x04, 0x00, 0x00, 0x23, 0x01, 0x15, 0x04, 0x09, 0x05, 0x08,
+    0x00, 0x25, 0x0B, 0x07, 0x08, 0x20, 0x83, 0x00, 0x03, 0x02, 0x12, 0x0D, 0x10, 0x83, 0x00, 0x06,
+    0x03, 0x01, 0x15, 0x04, 0x09, 0x05, 0x08, 0x84, 0x00, 0x82, 0x00, 0x05, 0x07, 0x0F, 0x01, 0x17,
+    0x00, 0x02, 0x82, 0x04, 0x07, 0x07, 0x03, 0x01, 0x15, 0x04, 0x09, 0x05, 0x08, 0x83, 0x00, 0x82,
+    0x00, 0x11, 0x08, 0x05, 0x0B, 0x00, 0x0A, 0x1A, 0x0D, 0x0D, 0x2D, 0x1E, 0x07, 0x03, 0x01, 0x15,
+    0x04, 0x09, 0x05, 0x18, 0x82, 0x00, 0x81, 0x00, 0x12, 0x26, 0x05, 0x28, 0x00, 0x04, 0x02, 0x11,
+    0x13, 0x12, 0x06, 0x2D, 0x04, 0x00, 0x23, 0x01, 0x1E, 0x14, 0x12, 0x06, 0x82, 0x00, 0x14, 0x00,
+    0x03, 0x01, 0x2B, 0x00, 0x02, 0x1A, 0x19, 0x02, 0x11, 0x0E, 0x12, 0x0D, 0x04, 0x00, 0x00, 0x03,
+    0x0E, 0x1B, 0x01, 0x29, 0x82, 0x00, 0x14, 0x10, 0x1C, 0x06, 0x1F, 0x00, 0x0A, 0x01, 0x13, 0x19,
+    0x02, 0x11, 0x13, 0x0D, 0x04, 0x00, 0x00, 0x07, 0x06, 0x13, 0x2A, 0x07, 0x82, 0x00, 0x12, 0x0B,
+    0x05, 0x17, 0x00, 0x00, 0x0A, 0x0E, 0x0C, 0x01, 0x19, 0x02, 0x11, 0x1A, 0x02, 0x00, 0x04, 0x0F,
+    0x01, 0x09, 0x84, 0x00, 0x11, 0x16, 0x0D, 0x06, 0x02, 0x00, 0x0A, 0x01, 0x0F, 0x0C, 0x13, 0x19,
+    0x02, 0x0A, 0x00, 0x10, 0x0C, 0x0E, 0x24, 0x85, 0x00, 0x10, 0x00, 0x03, 0x01, 0x06, 0x02, 0x02,
+    0x0C, 0x01, 0x0E, 0x01, 0x1A, 0x04, 0x00, 0x17, 0x0D, 0x1C, 0x1D, 0x86, 0x00, 0x81, 0x00, 0x04,
+    0x03, 0x01, 0x06, 0x02, 0x02, 0x82, 0x0A, 0x05, 0x02, 0x00, 0x0B, 0x01, 0x12, 0x10, 0x87, 0x00,
+    0x82, 0x00, 0x03, 0x03, 0x01, 0x06, 0x02, 0x83, 0x00, 0x03, 0x28, 0x05, 0x0F, 0x02, 0x88, 0x00,
+    0x83, 0x00, 0x09, 0x03, 0x01, 0x06, 0x02, 0x00, 0x1F, 0x2B, 0x05, 0x08, 0x07, 0x89, 0x00, 0x84,
+    0x00, 0x06, 0x03, 0x01, 0x06, 0x17, 0x06, 0x01, 0x26, 0x8B, 0x00, 0x85, 0x00, 0x04, 0x03, 0x0D,
+    0x05, 0x1C, 0x03, 0x8C, 0x00, 0x86, 0x00, 0x02, 0x16, 0x0B, 0x10, 0x8D, 0x00,
+};
+const asset_image_t leitorir = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 46,
+    .palette = leitorir_palette,
+    .rows = leitorir_rows,
+    .data = leitorir_data,
+};
+
+// saver: 12x12, 288 -> 217 bytes
+static const uint16_t saver_palette[] = {
+    0x895F, 0x0000, 0x815E, 0x2048, 0x1847, 0x50D3, 0x793B, 0x813D, 0x1846, 0x2068, 0x0001, 0x0801,
+    0x0822, 0x0823, 0x2047, 0x2869, 0x408E, 0x40AF, 0x50D2, 0x793C,
+};
+static const uint16_t saver_rows[] = {
+    0, 10, 20, 30, 40, 50, 60, 70, 80, 93, 106, 119,
+    131,
+};
+static const uint8_t saver_data[] = {
+    0x02, 0x01, 0x0B, 0x11, 0x85, 0x05, 0x02, 0x10, 0x0A, 0x01, 0x02, 0x01, 0x04, 0x02, 0x85, 0x00,
+    0x02, 0x07, 0x08, 0x01, 0x02, 0x01, 0x03, 0x02, 0x85, 0x00, 0x02, 0x02, 0x04, 0x01, 0x02, 0x01,
+    0x03, 0x02, 0x85, 0x00, 0x02, 0x02, 0x04, 0x01, 0x02, 0x01, 0x03, 0x02, 0x85, 0x00, 0x02, 0x02,
+    0x04, 0x01, 0x02, 0x01, 0x03, 0x02, 0x85, 0x00, 0x02, 0x02, 0x04, 0x01, 0x02, 0x01, 0x03, 0x02,
+    0x85, 0x00, 0x02, 0x02, 0x04, 0x01, 0x02, 0x01, 0x03, 0x02, 0x85, 0x00, 0x02, 0x02, 0x04, 0x01,
+    0x0B, 0x01, 0x03, 0x02, 0x00, 0x00, 0x07, 0x07, 0x00, 0x00, 0x02, 0x04, 0x01, 0x0B, 0x01, 0x03,
+    0x02, 0x00, 0x06, 0x03, 0x09, 0x13, 0x00, 0x02, 0x04, 0x01, 0x0B, 0x01, 0x0E, 0x00, 0x06, 0x03,
+    0x01, 0x01, 0x03, 0x06, 0x02, 0x08, 0x01, 0x03, 0x01, 0x0D, 0x05, 0x09, 0x83, 0x01, 0x03, 0x0F,
+    0x12, 0x0C, 0x01,
+};
+const asset_image_t saver = {
+    .width = 12,
+    .height = 12,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 20,
+    .palette = saver_palette,
+    .rows = saver_rows,
+    .data = saver_data,
+};
+
+// ler_radio: 12x12, 288 -> 218 bytes
+static const uint16_t ler_radio_palette[] = {
+    0x0000, 0x1825, 0x60F7, 0x2047, 0x286A, 0x68F7, 0x0001, 0x1024, 0x388D, 0x40AF, 0x48B1, 0x50D2,
+    0x50D3, 0x58D4, 0x60F6, 0x793C, 0x0823, 0x1023, 0x1846, 0x306A, 0x306B, 0x308B, 0x408E, 0x48B0,
+    0x58D3, 0x58F5, 0x711A, 0x793B,
+};
+static const uint16_t ler_radio_rows[] = {
+    0, 10, 18, 24, 30, 42, 55, 68, 80, 92, 98, 106,
+    116,
+};
+static const uint8_t ler_radio_data[] = {
+    0x02, 0x05, 0x02, 0x01, 0x85, 0x00, 0x02, 0x01, 0x05, 0x02, 0x01, 0x05, 0x03, 0x87, 0x00, 0x01,
+    0x03, 0x02, 0x00, 0x01, 0x89, 0x00, 0x00, 0x01, 0x81, 0x00, 0x81, 0x03, 0x87, 0x00, 0x81, 0x00,
+    0x06, 0x0E, 0x0D, 0x00, 0x00, 0x06, 0x09, 0x11, 0x82, 0x00, 0x0B, 0x04, 0x17, 0x0D, 0x19, 0x01,
+    0x04, 0x13, 0x0F, 0x15, 0x07, 0x08, 0x04, 0x0B, 0x04, 0x08, 0x07, 0x16, 0x0B, 0x1B, 0x1A, 0x0A,
+    0x0C, 0x0C, 0x0A, 0x04, 0x82, 0x00, 0x08, 0x12, 0x0F, 0x0B, 0x18, 0x10, 0x0E, 0x02, 0x06, 0x00,
+    0x82, 0x00, 0x08, 0x06, 0x09, 0x07, 0x06, 0x00, 0x04, 0x14, 0x00, 0x00, 0x00, 0x01, 0x89, 0x00,
+    0x00, 0x01, 0x01, 0x05, 0x03, 0x87, 0x00, 0x01, 0x03, 0x02, 0x02, 0x05, 0x02, 0x01, 0x85, 0x00,
+    0x02, 0x01, 0x05, 0x02,
+};
+const asset_image_t ler_radio = {
+    .width = 12,
+    .height = 12,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 28,
+    .palette = ler_radio_palette,
+    .rows = ler_radio_rows,
+    .data = ler_radio_data,
+};
+
+// raw1: 12x12, 288 -> 193 bytes
+static const uint16_t raw1_palette[] = {
+    0x895F, 0x711A, 0x815E, 0x793C, 0x308C, 0x793B, 0x306B, 0x0823, 0x2869, 0x388D, 0x40B0, 0x50D2,
+    0x58D4, 0x58F5, 0x6918, 0x1023, 0x1846, 0x2047, 0x2048, 0x286A, 0x308B, 0x40AF, 0x48B1, 0x7119,
+    0x713B, 0x793D, 0x813D, 0x895E,
+};
+static const uint16_t raw1_rows[] = {
+    0, 6, 10, 12, 25, 38, 51, 64, 77, 79, 81, 85,
+    91,
+};
+static const uint8_t raw1_data[] = {
+    0x00, 0x0D, 0x89, 0x00, 0x00, 0x0C, 0x8A, 0x00, 0x00, 0x02, 0x8B, 0x00, 0x0B, 0x00, 0x01, 0x17,
+    0x00, 0x00, 0x05, 0x00, 0x03, 0x1A, 0x03, 0x03, 0x02, 0x0B, 0x02, 0x04, 0x12, 0x0E, 0x01, 0x11,
+    0x01, 0x15, 0x09, 0x04, 0x09, 0x19, 0x0B, 0x02, 0x13, 0x10, 0x01, 0x16, 0x0F, 0x0B, 0x0A, 0x07,
+    0x07, 0x04, 0x1B, 0x0B, 0x02, 0x04, 0x08, 0x0E, 0x06, 0x06, 0x14, 0x0B, 0x08, 0x06, 0x0A, 0x00,
+    0x0B, 0x00, 0x05, 0x01, 0x05, 0x01, 0x00, 0x01, 0x03, 0x18, 0x05, 0x03, 0x00, 0x8B, 0x00, 0x8B,
+    0x00, 0x8A, 0x00, 0x00, 0x02, 0x00, 0x0D, 0x89, 0x00, 0x00, 0x0C,
+};
+const asset_image_t raw1 = {
+    .width = 12,
+    .height = 12,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 28,
+    .palette = raw1_palette,
+    .rows = raw1_rows,
+    .data = raw1_data,
 };
 
+// add: 12x12, 288 -> 186 bytes
+static const uint16_t add_palette[] = {
+    0x0000, 0x895F, 0x40AF, 0x1025, 0x388D, 0x388E, 0x408E, 0x40AE, 0x6918, 0x7119, 0x1825, 0x1845,
+    0x60F6, 0x60F7, 0x6919,
+};
+static const uint16_t add_rows[] = {
+    0, 9, 18, 27, 36, 49, 55, 61, 74, 83, 92, 101,
+    110,
+};
+static const uint8_t add_data[] = {
+    0x83, 0x00, 0x03, 0x0B, 0x09, 0x08, 0x03, 0x83, 0x00, 0x83, 0x00, 0x03, 0x06, 0x01, 0x01, 0x04,
+    0x83, 0x00, 0x83, 0x00, 0x03, 0x02, 0x01, 0x01, 0x06, 0x83, 0x00, 0x83, 0x00, 0x03, 0x02, 0x01,
+    0x01, 0x05, 0x83, 0x00, 0x0B, 0x0A, 0x05, 0x02, 0x07, 0x0D, 0x01, 0x01, 0x0C, 0x07, 0x02, 0x04,
+    0x03, 0x00, 0x09, 0x89, 0x01, 0x00, 0x08, 0x00, 0x0E, 0x89, 0x01, 0x00, 0x08, 0x0B, 0x0A, 0x05,
+    0x02, 0x07, 0x0D, 0x01, 0x01, 0x0C, 0x07, 0x02, 0x04, 0x03, 0x83, 0x00, 0x03, 0x02, 0x01, 0x01,
+    0x05, 0x83, 0x00, 0x83, 0x00, 0x03, 0x02, 0x01, 0x01, 0x06, 0x83, 0x00, 0x83, 0x00, 0x03, 0x06,
+    0x01, 0x01, 0x04, 0x83, 0x00, 0x83, 0x00, 0x03, 0x0B, 0x09, 0x08, 0x03, 0x83, 0x00,
+};
+const asset_image_t add = {
+    .width = 12,
+    .height = 12,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 15,
+    .palette = add_palette,
+    .rows = add_rows,
+    .data = add_data,
+};
 
+// ana: 12x12, 288 -> 253 bytes
+static const uint16_t ana_palette[] = {
+    0x0000, 0x1846, 0x40AF, 0x793B, 0x813D, 0x58D4, 0x711A, 0x793C, 0x0823, 0x1024, 0x388D, 0x388E,
+    0x40B0, 0x48B1, 0x60F7, 0x0001, 0x2047, 0x48B0, 0x50D2, 0x50D3, 0x60F6, 0x7119, 0x0802, 0x1023,
+    0x1825, 0x1847, 0x2048, 0x306B, 0x308C, 0x408E, 0x40AE, 0x48D1, 0x68F7, 0x6918, 0x6919, 0x815E,
+    0x895F, 0x915F, 0x917F,
+};
+static const uint16_t ana_rows[] = {
+    0, 11, 22, 34, 46, 58, 70, 82, 95, 108, 116, 123,
+    129,
+};
+static const uint8_t ana_data[] = {
+    0x07, 0x00, 0x08, 0x1F, 0x07, 0x23, 0x06, 0x0A, 0x0F, 0x83, 0x00, 0x07, 0x08, 0x14, 0x03, 0x0D,
+    0x0A, 0x05, 0x04, 0x02, 0x83, 0x00, 0x08, 0x0D, 0x03, 0x0B, 0x17, 0x16, 0x09, 0x1E, 0x04, 0x10,
+    0x82, 0x00, 0x08, 0x03, 0x0D, 0x02, 0x13, 0x1B, 0x0E, 0x12, 0x04, 0x0C, 0x82, 0x00, 0x08, 0x04,
+    0x02, 0x02, 0x05, 0x05, 0x0C, 0x09, 0x0E, 0x12, 0x82, 0x00, 0x08, 0x22, 0x03, 0x0C, 0x09, 0x05,
+    0x11, 0x08, 0x03, 0x0B, 0x82, 0x00, 0x08, 0x1C, 0x04, 0x1D, 0x0F, 0x01, 0x02, 0x05, 0x07, 0x01,
+    0x82, 0x00, 0x0B, 0x00, 0x02, 0x04, 0x15, 0x0E, 0x03, 0x07, 0x07, 0x20, 0x19, 0x00, 0x00, 0x81,
+    0x00, 0x09, 0x10, 0x11, 0x13, 0x0B, 0x18, 0x14, 0x26, 0x06, 0x01, 0x00, 0x86, 0x00, 0x04, 0x01,
+    0x06, 0x25, 0x15, 0x01, 0x87, 0x00, 0x03, 0x01, 0x06, 0x24, 0x21, 0x88, 0x00, 0x02, 0x1A, 0x06,
+    0x0A,
+};
+const asset_image_t ana = {
+    .width = 12,
+    .height = 12,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 39,
+    .palette = ana_palette,
+    .rows = ana_rows,
+    .data = ana_data,
+};
 
+// dector: 12x12, 288 -> 261 bytes
+static const uint16_t dector_palette[] = {
+    0x0000, 0x50D3, 0x60F6, 0x58D4, 0x50D2, 0x0823, 0x2047, 0x308C, 0x388E, 0x6918, 0x0001, 0x60F5,
+    0x60F7, 0x0801, 0x0802, 0x0822, 0x1023, 0x1024, 0x1825, 0x1846, 0x2048, 0x2069, 0x2869, 0x306B,
+    0x408E, 0x48B0, 0x48B1, 0x48D1, 0x48D2, 0x58F4, 0x58F5, 0x68F7, 0x6919, 0x7119, 0x711A, 0x793B,
+    0x793C,
+};
+static const uint16_t dector_rows[] = {
+    0, 13, 26, 39, 52, 65, 78, 91, 101, 111, 121, 131,
+    141,
+};
+static const uint8_t dector_data[] = {
+    0x0B, 0x00, 0x01, 0x02, 0x24, 0x20, 0x21, 0x09, 0x22, 0x23, 0x0C, 0x1A, 0x00, 0x0B, 0x00, 0x0B,
+    0x0C, 0x09, 0x0B, 0x02, 0x1E, 0x02, 0x1F, 0x09, 0x01, 0x00, 0x0B, 0x00, 0x02, 0x04, 0x0D, 0x05,
+    0x14, 0x06, 0x0F, 0x0E, 0x1D, 0x01, 0x00, 0x0B, 0x00, 0x02, 0x04, 0x00, 0x11, 0x07, 0x17, 0x05,
+    0x00, 0x03, 0x01, 0x00, 0x0B, 0x00, 0x02, 0x1C, 0x0A, 0x16, 0x08, 0x08, 0x15, 0x0A, 0x03, 0x01,
+    0x00, 0x0B, 0x00, 0x02, 0x1B, 0x13, 0x08, 0x07, 0x07, 0x18, 0x12, 0x03, 0x01, 0x00, 0x0B, 0x00,
+    0x02, 0x04, 0x00, 0x10, 0x06, 0x06, 0x05, 0x00, 0x03, 0x01, 0x00, 0x02, 0x00, 0x02, 0x04, 0x85,
+    0x00, 0x02, 0x03, 0x01, 0x00, 0x02, 0x00, 0x02, 0x04, 0x85, 0x00, 0x02, 0x03, 0x01, 0x00, 0x02,
+    0x00, 0x02, 0x04, 0x85, 0x00, 0x02, 0x03, 0x01, 0x00, 0x02, 0x00, 0x02, 0x04, 0x85, 0x00, 0x02,
+    0x03, 0x01, 0x00, 0x02, 0x00, 0x03, 0x19, 0x85, 0x00, 0x02, 0x01, 0x04, 0x00,
+};
+const asset_image_t dector = {
+    .width = 12,
+    .height = 12,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 37,
+    .palette = dector_palette,
+    .rows = dector_rows,
+    .data = dector_data,
+};
 
+// bad: 24x24, 1152 -> 576 bytes
+static const uint16_t bad_palette[] = {
+    0x895F, 0x0000, 0x815E, 0x6918, 0x813D, 0x711A, 0x0802, 0x793C, 0x58F5, 0x1024, 0x1846, 0x388D,
+    0x60F6, 0x60F7, 0x0801, 0x0823, 0x50D3, 0x793B, 0x306B, 0x40AF, 0x50D2, 0x6919, 0x1025, 0x2047,
+    0x2869, 0x58D4, 0x60F5, 0x68F7, 0x7119, 0x0001, 0x1825, 0x286A, 0x408E, 0x40B0, 0x48B1, 0x713B,
+    0x915F, 0x1023, 0x1847, 0x308C, 0x388E, 0x48B0, 0x0822, 0x1845, 0x2048, 0x2068, 0x306A, 0x308B,
+    0x48D2, 0x711B, 0x793D, 0x813E,
+};
+static const uint16_t bad_rows[] = {
+    0, 16, 29, 39, 48, 57, 76, 101, 126, 138, 150, 170,
+    195, 220, 245, 260, 277, 300, 322, 340, 355, 366, 379, 392,
+    402,
+};
+static const uint8_t bad_data[] = {
+    0x81, 0x01, 0x0A, 0x09, 0x1F, 0x21, 0x19, 0x0D, 0x03, 0x1B, 0x08, 0x22, 0x12, 0x1E, 0x8A, 0x01,
+    0x03, 0x2D, 0x10, 0x11, 0x02, 0x87, 0x00, 0x02, 0x07, 0x0C, 0x2E, 0x88, 0x01, 0x00, 0x1B, 0x8B,
+    0x00, 0x02, 0x24, 0x05, 0x06, 0x87, 0x01, 0x00, 0x03, 0x8C, 0x00, 0x01, 0x05, 0x06, 0x87, 0x01,
+    0x00, 0x03, 0x8C, 0x00, 0x01, 0x05, 0x06, 0x87, 0x01, 0x02, 0x03, 0x11, 0x15, 0x82, 0x02, 0x83,
+    0x00, 0x81, 0x02, 0x05, 0x23, 0x1C, 0x05, 0x06, 0x01, 0x1D, 0x85, 0x01, 0x17, 0x03, 0x32, 0x18,
+    0x0A, 0x0A, 0x18, 0x07, 0x00, 0x02, 0x0B, 0x0A, 0x0A, 0x17, 0x15, 0x31, 0x06, 0x20, 0x03, 0x1A,
+    0x30, 0x27, 0x0A, 0x1D, 0x01, 0x11, 0x03, 0x00, 0x1C, 0x28, 0x2F, 0x20, 0x04, 0x00, 0x00, 0x22,
+    0x12, 0x0B, 0x0D, 0x00, 0x05, 0x06, 0x10, 0x24, 0x82, 0x00, 0x02, 0x04, 0x0D, 0x12, 0x00, 0x0D,
+    0x8C, 0x00, 0x02, 0x05, 0x06, 0x10, 0x85, 0x00, 0x00, 0x03, 0x00, 0x08, 0x8C, 0x00, 0x02, 0x03,
+    0x0E, 0x08, 0x85, 0x00, 0x00, 0x03, 0x04, 0x22, 0x00, 0x00, 0x02, 0x04, 0x84, 0x00, 0x06, 0x02,
+    0x04, 0x00, 0x00, 0x08, 0x0E, 0x03, 0x85, 0x00, 0x00, 0x03, 0x17, 0x12, 0x00, 0x00, 0x04, 0x20,
+    0x10, 0x23, 0x04, 0x07, 0x1A, 0x0B, 0x05, 0x00, 0x00, 0x13, 0x0F, 0x11, 0x00, 0x04, 0x07, 0x07,
+    0x0C, 0x11, 0x03, 0x17, 0x09, 0x23, 0x00, 0x00, 0x15, 0x2C, 0x09, 0x16, 0x09, 0x0A, 0x08, 0x00,
+    0x00, 0x02, 0x17, 0x18, 0x00, 0x11, 0x26, 0x25, 0x25, 0x1F, 0x04, 0x03, 0x01, 0x01, 0x21, 0x82,
+    0x00, 0x04, 0x04, 0x0C, 0x14, 0x08, 0x07, 0x82, 0x00, 0x0A, 0x1A, 0x1D, 0x10, 0x00, 0x04, 0x14,
+    0x13, 0x14, 0x07, 0x00, 0x1B, 0x02, 0x01, 0x2A, 0x0D, 0x88, 0x00, 0x03, 0x11, 0x2B, 0x17, 0x04,
+    0x86, 0x00, 0x00, 0x0D, 0x81, 0x01, 0x01, 0x09, 0x1A, 0x86, 0x00, 0x04, 0x15, 0x26, 0x0F, 0x03,
+    0x24, 0x86, 0x00, 0x00, 0x08, 0x82, 0x01, 0x02, 0x0E, 0x0B, 0x05, 0x82, 0x00, 0x09, 0x07, 0x29,
+    0x0F, 0x09, 0x0C, 0x05, 0x14, 0x13, 0x19, 0x07, 0x83, 0x00, 0x00, 0x29, 0x84, 0x01, 0x12, 0x0F,
+    0x0B, 0x0C, 0x21, 0x16, 0x06, 0x27, 0x05, 0x10, 0x1E, 0x1E, 0x0A, 0x16, 0x17, 0x1B, 0x00, 0x00,
+    0x02, 0x1F, 0x88, 0x01, 0x0E, 0x06, 0x0C, 0x00, 0x05, 0x13, 0x03, 0x04, 0x02, 0x07, 0x08, 0x13,
+    0x04, 0x00, 0x1C, 0x0F, 0x89, 0x01, 0x03, 0x19, 0x00, 0x33, 0x02, 0x84, 0x00, 0x81, 0x02, 0x02,
+    0x00, 0x0B, 0x01, 0x89, 0x01, 0x01, 0x09, 0x15, 0x88, 0x00, 0x02, 0x19, 0x0E, 0x01, 0x8A, 0x01,
+    0x01, 0x16, 0x0C, 0x85, 0x00, 0x04, 0x02, 0x14, 0x06, 0x01, 0x01, 0x8B, 0x01, 0x07, 0x0E, 0x0B,
+    0x1C, 0x00, 0x00, 0x02, 0x0D, 0x18, 0x83, 0x01, 0x8D, 0x01, 0x04, 0x0F, 0x28, 0x08, 0x12, 0x0E,
+    0x84, 0x01,
+};
+const asset_image_t bad = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 52,
+    .palette = bad_palette,
+    .rows = bad_rows,
+    .data = bad_data,
+};
+
+// h: 12x12, 288 -> 266 bytes
+static const uint16_t h_palette[] = {
+    0xFFFF, 0x895F, 0x893F, 0xFFDF, 0x91BF, 0xAB3F, 0x897F, 0xA2BF, 0xAB1F, 0xCD3F, 0x899F, 0x91DF,
+    0x9A1F, 0x9A3F, 0x9A7F, 0xA2DF, 0xAAFF, 0xAB5F, 0xCCDF, 0xD55F, 0xD57F, 0xD59F, 0xDDDF, 0xDDFF,
+    0xE63F, 0xE65F, 0xF71F, 0xF73F, 0xF79F, 0xFFBF, 0x919F, 0xCD1F, 0xF75F, 0xF77F,
+};
+static const uint16_t h_rows[] = {
+    0, 13, 26, 39, 51, 63, 76, 89, 101, 113, 126, 139,
+    152,
+};
+static const uint8_t h_data[] = {
+    0x0B, 0x01, 0x04, 0x07, 0x0A, 0x02, 0x01, 0x01, 0x02, 0x0A, 0x07, 0x04, 0x01, 0x0B, 0x02, 0x08,
+    0x1B, 0x15, 0x0F, 0x06, 0x06, 0x0F, 0x15, 0x1B, 0x08, 0x02, 0x0B, 0x02, 0x11, 0x00, 0x00, 0x1C,
+    0x14, 0x14, 0x1C, 0x00, 0x00, 0x05, 0x02, 0x03, 0x01, 0x0C, 0x16, 0x03, 0x83, 0x00, 0x03, 0x03,
+    0x16, 0x0C, 0x01, 0x03, 0x01, 0x0B, 0x09, 0x03, 0x83, 0x00, 0x03, 0x03, 0x1F, 0x0B, 0x01, 0x0B,
+    0x02, 0x05, 0x03, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x03, 0x05, 0x02, 0x0B, 0x02, 0x05, 0x03,
+    0x00, 0x00, 0x19, 0x19, 0x00, 0x00, 0x03, 0x08, 0x02, 0x03, 0x01, 0x04, 0x12, 0x1D, 0x83, 0x00,
+    0x03, 0x1D, 0x12, 0x04, 0x01, 0x03, 0x01, 0x0D, 0x17, 0x03, 0x83, 0x00, 0x03, 0x03, 0x17, 0x0D,
+    0x01, 0x0B, 0x02, 0x11, 0x00, 0x00, 0x20, 0x09, 0x09, 0x21, 0x00, 0x00, 0x05, 0x02, 0x0B, 0x02,
+    0x10, 0x1A, 0x13, 0x07, 0x01, 0x01, 0x07, 0x13, 0x1A, 0x10, 0x02, 0x0B, 0x01, 0x04, 0x0E, 0x06,
+    0x02, 0x01, 0x01, 0x02, 0x06, 0x0E, 0x1E, 0x01,
+};
+const asset_image_t h = {
+    .width = 12,
+    .height = 12,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 34,
+    .palette = h_palette,
+    .rows = h_rows,
+    .data = h_data,
+};
+
+// apple: 24x24, 1152 -> 552 bytes
+static const uint16_t apple_palette[] = {
+    0x0000, 0x895F, 0x1024, 0x0001, 0x815E, 0x2869, 0x58F5, 0x793B, 0x388D, 0x58D4, 0x60F7, 0x306B,
+    0x50D2, 0x50D3, 0x6918, 0x793C, 0x813D, 0x286A, 0x60F6, 0x1023, 0x388E, 0x48B1, 0x7119, 0x713B,
+    0x0802, 0x0822, 0x0823, 0x2047, 0x2048, 0x60F5, 0x915F, 0x0801, 0x1825, 0x1846, 0x308C, 0x408E,
+    0x48B0, 0x68F7, 0x1025, 0x2069, 0x388C, 0x40AF, 0x40B0, 0x48D1, 0x711A, 0x793D, 0x895E,
+};
+static const uint16_t apple_rows[] = {
+    0, 2, 11, 21, 31, 41, 50, 70, 91, 103, 113, 132,
+    154, 176, 198, 220, 240, 265, 287, 309, 329, 344, 361, 378,
+    388,
+};
+static const uint8_t apple_data[] = {
+    0x97, 0x00, 0x8C, 0x00, 0x03, 0x1F, 0x22, 0x0D, 0x02, 0x86, 0x00, 0x8B, 0x00, 0x04, 0x13, 0x1D,
+    0x01, 0x10, 0x02, 0x86, 0x00, 0x8B, 0x00, 0x04, 0x0D, 0x01, 0x01, 0x12, 0x03, 0x86, 0x00, 0x8A,
+    0x00, 0x04, 0x26, 0x0F, 0x01, 0x10, 0x05, 0x87, 0x00, 0x8A, 0x00, 0x03, 0x05, 0x04, 0x16, 0x05,
+    0x88, 0x00, 0x84, 0x00, 0x0E, 0x18, 0x11, 0x0C, 0x0D, 0x08, 0x20, 0x02, 0x05, 0x02, 0x1B, 0x2A,
+    0x09, 0x15, 0x05, 0x03, 0x83, 0x00, 0x83, 0x00, 0x01, 0x21, 0x0A, 0x83, 0x01, 0x04, 0x2D, 0x12,
+    0x0C, 0x0E, 0x04, 0x82, 0x01, 0x02, 0x04, 0x09, 0x1A, 0x82, 0x00, 0x82, 0x00, 0x01, 0x02, 0x16,
+    0x8D, 0x01, 0x01, 0x04, 0x0B, 0x82, 0x00, 0x82, 0x00, 0x00, 0x0C, 0x8E, 0x01, 0x00, 0x23, 0x83,
+    0x00, 0x81, 0x00, 0x05, 0x13, 0x07, 0x01, 0x01, 0x0C, 0x0E, 0x86, 0x01, 0x04, 0x0C, 0x0E, 0x1E,
+    0x12, 0x03, 0x83, 0x00, 0x81, 0x00, 0x10, 0x1C, 0x04, 0x01, 0x01, 0x05, 0x1B, 0x09, 0x0A, 0x10,
+    0x01, 0x0F, 0x06, 0x15, 0x19, 0x0D, 0x01, 0x28, 0x84, 0x00, 0x81, 0x00, 0x00, 0x11, 0x82, 0x01,
+    0x0C, 0x14, 0x00, 0x00, 0x02, 0x0E, 0x01, 0x15, 0x03, 0x00, 0x03, 0x0A, 0x01, 0x05, 0x84, 0x00,
+    0x81, 0x00, 0x10, 0x11, 0x01, 0x04, 0x25, 0x07, 0x29, 0x14, 0x0E, 0x10, 0x07, 0x04, 0x0D, 0x08,
+    0x09, 0x17, 0x0E, 0x0B, 0x84, 0x00, 0x81, 0x00, 0x04, 0x1C, 0x2E, 0x01, 0x08, 0x06, 0x82, 0x01,
+    0x01, 0x07, 0x12, 0x82, 0x01, 0x03, 0x10, 0x0B, 0x12, 0x0D, 0x84, 0x00, 0x81, 0x00, 0x05, 0x02,
+    0x0F, 0x01, 0x2B, 0x19, 0x1D, 0x85, 0x01, 0x05, 0x04, 0x05, 0x13, 0x07, 0x10, 0x1C, 0x83, 0x00,
+    0x81, 0x00, 0x15, 0x03, 0x0A, 0x01, 0x07, 0x02, 0x11, 0x06, 0x0B, 0x24, 0x0C, 0x23, 0x08, 0x06,
+    0x03, 0x08, 0x01, 0x01, 0x17, 0x11, 0x03, 0x00, 0x00, 0x82, 0x00, 0x05, 0x14, 0x01, 0x01, 0x06,
+    0x02, 0x18, 0x84, 0x00, 0x02, 0x1A, 0x1B, 0x07, 0x82, 0x01, 0x03, 0x0F, 0x02, 0x00, 0x00, 0x82,
+    0x00, 0x06, 0x02, 0x17, 0x01, 0x01, 0x0A, 0x27, 0x18, 0x82, 0x00, 0x02, 0x19, 0x0B, 0x17, 0x83,
+    0x01, 0x00, 0x09, 0x82, 0x00, 0x83, 0x00, 0x00, 0x08, 0x82, 0x01, 0x05, 0x04, 0x16, 0x06, 0x09,
+    0x06, 0x2C, 0x84, 0x01, 0x01, 0x0F, 0x21, 0x82, 0x00, 0x83, 0x00, 0x01, 0x03, 0x06, 0x84, 0x01,
+    0x81, 0x1E, 0x85, 0x01, 0x00, 0x08, 0x83, 0x00, 0x84, 0x00, 0x01, 0x02, 0x0A, 0x83, 0x01, 0x02,
+    0x07, 0x16, 0x0F, 0x83, 0x01, 0x00, 0x24, 0x84, 0x00, 0x85, 0x00, 0x0B, 0x1A, 0x15, 0x25, 0x09,
+    0x0B, 0x13, 0x1F, 0x20, 0x14, 0x1D, 0x0A, 0x22, 0x85, 0x00, 0x87, 0x00, 0x00, 0x03, 0x86, 0x00,
+    0x00, 0x03, 0x86, 0x00,
+};
+const asset_image_t apple = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 47,
+    .palette = apple_palette,
+    .rows = apple_rows,
+    .data = apple_data,
+};
+
+// androi: 24x24, 1152 -> 490 bytes
+static const uint16_t androi_palette[] = {
+    0x0000, 0x895F, 0x58D4, 0x813D, 0x60F7, 0x6918, 0x915F, 0x793C, 0x60F6, 0x0001, 0x0802, 0x6919,
+    0x815E, 0x1024, 0x286A, 0x2048, 0x2869, 0x40AF, 0x711A, 0x1023, 0x1825, 0x1846, 0x50D3, 0x1025,
+    0x308B, 0x388C, 0x388D, 0x48B1, 0x48D2, 0x50D2, 0x58F5, 0x917F, 0x0801, 0x0822, 0x0823, 0x1845,
+    0x2047, 0x388E, 0x408E, 0x48B0, 0x60F5, 0x793B, 0x813E, 0x895E,
+};
+static const uint16_t androi_rows[] = {
+    0, 2, 12, 25, 38, 52, 68, 84, 94, 110, 128, 146,
+    164, 182, 200, 218, 235, 251, 261, 278, 291, 304, 317, 330,
+    332,
+};
+static const uint8_t androi_data[] = {
+    0x97, 0x00, 0x87, 0x00, 0x00, 0x0D, 0x85, 0x00, 0x00, 0x0D, 0x87, 0x00, 0x87, 0x00, 0x07, 0x0F,
+    0x14, 0x0D, 0x0F, 0x0F, 0x0D, 0x23, 0x0F, 0x87, 0x00, 0x87, 0x00, 0x07, 0x0E, 0x0B, 0x07, 0x2B,
+    0x0C, 0x07, 0x05, 0x10, 0x87, 0x00, 0x86, 0x00, 0x02, 0x18, 0x07, 0x0C, 0x83, 0x01, 0x02, 0x0C,
+    0x07, 0x0E, 0x86, 0x00, 0x85, 0x00, 0x03, 0x15, 0x07, 0x29, 0x1B, 0x83, 0x01, 0x03, 0x1B, 0x07,
+    0x07, 0x14, 0x85, 0x00, 0x85, 0x00, 0x03, 0x1D, 0x01, 0x01, 0x2A, 0x83, 0x01, 0x03, 0x03, 0x01,
+    0x01, 0x27, 0x85, 0x00, 0x85, 0x00, 0x00, 0x08, 0x89, 0x03, 0x00, 0x02, 0x85, 0x00, 0x82, 0x00,
+    0x03, 0x0E, 0x16, 0x24, 0x11, 0x89, 0x02, 0x03, 0x26, 0x0F, 0x16, 0x10, 0x82, 0x00, 0x81, 0x00,
+    0x04, 0x20, 0x0B, 0x1F, 0x1E, 0x05, 0x89, 0x01, 0x06, 0x04, 0x08, 0x1F, 0x05, 0x09, 0x00, 0x00,
+    0x81, 0x00, 0x04, 0x0A, 0x12, 0x06, 0x08, 0x05, 0x89, 0x01, 0x81, 0x04, 0x04, 0x06, 0x0B, 0x09,
+    0x00, 0x00, 0x81, 0x00, 0x04, 0x0A, 0x12, 0x06, 0x08, 0x05, 0x89, 0x01, 0x81, 0x04, 0x04, 0x06,
+    0x0B, 0x09, 0x00, 0x00, 0x81, 0x00, 0x04, 0x0A, 0x12, 0x06, 0x08, 0x05, 0x89, 0x01, 0x81, 0x04,
+    0x04, 0x06, 0x0B, 0x09, 0x00, 0x00, 0x81, 0x00, 0x04, 0x0A, 0x12, 0x06, 0x08, 0x05, 0x89, 0x01,
+    0x81, 0x04, 0x04, 0x06, 0x0B, 0x09, 0x00, 0x00, 0x81, 0x00, 0x04, 0x0A, 0x12, 0x06, 0x08, 0x05,
+    0x89, 0x01, 0x81, 0x04, 0x04, 0x06, 0x0B, 0x09, 0x00, 0x00, 0x81, 0x00, 0x04, 0x09, 0x28, 0x01,
+    0x1C, 0x05, 0x89, 0x01, 0x03, 0x04, 0x1D, 0x01, 0x02, 0x82, 0x00, 0x82, 0x00, 0x03, 0x0D, 0x10,
+    0x13, 0x05, 0x89, 0x01, 0x03, 0x08, 0x13, 0x10, 0x13, 0x82, 0x00, 0x85, 0x00, 0x00, 0x16, 0x89,
+    0x01, 0x00, 0x1C, 0x85, 0x00, 0x85, 0x00, 0x0B, 0x22, 0x0E, 0x1E, 0x01, 0x0C, 0x11, 0x11, 0x0C,
+    0x01, 0x02, 0x0E, 0x21, 0x85, 0x00, 0x87, 0x00, 0x07, 0x11, 0x01, 0x03, 0x17, 0x15, 0x0C, 0x01,
+    0x1A, 0x87, 0x00, 0x87, 0x00, 0x07, 0x11, 0x01, 0x03, 0x14, 0x15, 0x0C, 0x01, 0x25, 0x87, 0x00,
+    0x87, 0x00, 0x07, 0x19, 0x01, 0x07, 0x0D, 0x17, 0x07, 0x01, 0x18, 0x87, 0x00, 0x87, 0x00, 0x07,
+    0x0A, 0x1A, 0x10, 0x00, 0x00, 0x0E, 0x19, 0x0A, 0x87, 0x00, 0x97, 0x00,
+};
+const asset_image_t androi = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 44,
+    .palette = androi_palette,
+    .rows = androi_rows,
+    .data = androi_data,
+};
+
+// nfc1: 12x12, 288 -> 237 bytes
+static const uint16_t nfc1_palette[] = {
+    0x0000, 0x895F, 0x815E, 0x60F6, 0x0823, 0x286A, 0x711A, 0x0001, 0x40AF, 0x793C, 0x895E, 0x388D,
+    0x58F5, 0x0822, 0x2869, 0x48B0, 0x50D2, 0x50D3, 0x60F5, 0x60F7, 0x6918, 0x713B, 0x813D, 0x915F,
+    0x388C,
+};
+static const uint16_t nfc1_rows[] = {
+    0, 9, 20, 33, 46, 59, 72, 85, 98, 111, 124, 135,
+    141,
+};
+static const uint8_t nfc1_data[] = {
+    0x83, 0x00, 0x03, 0x07, 0x04, 0x04, 0x07, 0x83, 0x00, 0x82, 0x00, 0x05, 0x05, 0x03, 0x15, 0x15,
+    0x03, 0x05, 0x82, 0x00, 0x81, 0x00, 0x01, 0x0F, 0x0A, 0x82, 0x01, 0x04, 0x17, 0x0A, 0x0F, 0x00,
+    0x00, 0x02, 0x00, 0x05, 0x0A, 0x82, 0x01, 0x05, 0x09, 0x14, 0x01, 0x0A, 0x05, 0x00, 0x0B, 0x07,
+    0x03, 0x01, 0x02, 0x16, 0x10, 0x13, 0x18, 0x02, 0x01, 0x03, 0x07, 0x0B, 0x04, 0x06, 0x01, 0x03,
+    0x11, 0x08, 0x03, 0x0B, 0x09, 0x01, 0x06, 0x04, 0x0B, 0x04, 0x06, 0x01, 0x03, 0x11, 0x08, 0x0C,
+    0x0B, 0x09, 0x01, 0x06, 0x04, 0x0B, 0x00, 0x12, 0x01, 0x02, 0x16, 0x10, 0x13, 0x0B, 0x02, 0x01,
+    0x12, 0x00, 0x02, 0x00, 0x05, 0x02, 0x82, 0x01, 0x05, 0x09, 0x14, 0x01, 0x02, 0x05, 0x00, 0x81,
+    0x00, 0x01, 0x08, 0x02, 0x82, 0x01, 0x04, 0x17, 0x02, 0x08, 0x00, 0x00, 0x82, 0x00, 0x05, 0x0E,
+    0x0C, 0x06, 0x06, 0x0C, 0x0E, 0x82, 0x00, 0x84, 0x00, 0x81, 0x0D, 0x84, 0x00,
+};
+const asset_image_t nfc1 = {
+    .width = 12,
+    .height = 12,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 25,
+    .palette = nfc1_palette,
+    .rows = nfc1_rows,
+    .data = nfc1_data,
+};
+
+// save: 12x12, 288 -> 250 bytes
+static const uint16_t save_palette[] = {
+    0x895F, 0x58D4, 0x40AF, 0x915F, 0x2048, 0x408E, 0x50D3, 0x40B0, 0x48B0, 0x2047, 0x6919, 0x0000,
+    0x2869, 0x286A, 0x6918, 0x815E, 0x1024, 0x2068, 0x306B, 0x388E, 0x68F7, 0x793C, 0x813D, 0x0823,
+    0x1825, 0x1846, 0x60F7, 0x711A, 0x895E,
+};
+static const uint16_t save_rows[] = {
+    0, 13, 26, 39, 52, 65, 77, 87, 97, 109, 122, 134,
+    146,
+};
+static const uint8_t save_data[] = {
+    0x0B, 0x12, 0x01, 0x0C, 0x0D, 0x01, 0x01, 0x06, 0x18, 0x02, 0x12, 0x0B, 0x0B, 0x0B, 0x01, 0x03,
+    0x05, 0x08, 0x00, 0x00, 0x0F, 0x11, 0x0E, 0x15, 0x19, 0x0B, 0x0B, 0x01, 0x00, 0x13, 0x08, 0x00,
+    0x00, 0x0F, 0x11, 0x14, 0x03, 0x1A, 0x17, 0x0B, 0x01, 0x00, 0x13, 0x02, 0x0F, 0x16, 0x15, 0x04,
+    0x14, 0x00, 0x00, 0x08, 0x0B, 0x01, 0x00, 0x08, 0x10, 0x04, 0x04, 0x09, 0x10, 0x0A, 0x00, 0x00,
+    0x01, 0x02, 0x01, 0x00, 0x16, 0x83, 0x0A, 0x04, 0x1B, 0x1C, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00,
+    0x00, 0x83, 0x03, 0x83, 0x00, 0x00, 0x01, 0x02, 0x01, 0x00, 0x0E, 0x85, 0x02, 0x02, 0x0E, 0x00,
+    0x01, 0x03, 0x01, 0x00, 0x05, 0x09, 0x83, 0x07, 0x03, 0x09, 0x05, 0x00, 0x01, 0x0B, 0x01, 0x00,
+    0x05, 0x04, 0x08, 0x07, 0x07, 0x08, 0x04, 0x05, 0x00, 0x01, 0x03, 0x01, 0x03, 0x05, 0x09, 0x83,
+    0x02, 0x03, 0x09, 0x05, 0x03, 0x01, 0x03, 0x0D, 0x06, 0x04, 0x0C, 0x83, 0x06, 0x03, 0x0C, 0x04,
+    0x06, 0x0D,
+};
+const asset_image_t save = {
+    .width = 12,
+    .height = 12,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 29,
+    .palette = save_palette,
+    .rows = save_rows,
+    .data = save_data,
+};
+
+// savewifi: 24x24, 1152 -> 510 bytes
+static const uint16_t savewifi_palette[] = {
+    0x0000, 0x895F, 0x915F, 0x60F6, 0x60F7, 0x0823, 0x815E, 0x48B0, 0x793B, 0x2869, 0x40B0, 0x60F5,
+    0x0001, 0x813D, 0x1024, 0x50D2, 0x793C, 0x0822, 0x2047, 0x2068, 0x2069, 0x40AF, 0x48B1, 0x895E,
+    0x0801, 0x2048, 0x711A, 0x713B, 0x1023, 0x1846, 0x286A, 0x306A, 0x308C, 0x388C, 0x388D, 0x388E,
+    0x58F5, 0x6919, 0x793D, 0x917F,
+};
+static const uint16_t savewifi_rows[] = {
+    0, 14, 28, 42, 56, 70, 84, 98, 112, 126, 140, 154,
+    168, 182, 198, 218, 233, 249, 265, 281, 288, 306, 324, 342,
+    360,
+};
+static const uint8_t savewifi_data[] = {
+    0x84, 0x00, 0x02, 0x05, 0x12, 0x0C, 0x87, 0x00, 0x02, 0x18, 0x12, 0x11, 0x84, 0x00, 0x84, 0x00,
+    0x02, 0x0F, 0x06, 0x20, 0x87, 0x00, 0x02, 0x21, 0x06, 0x16, 0x84, 0x00, 0x84, 0x00, 0x02, 0x03,
+    0x02, 0x0A, 0x87, 0x00, 0x02, 0x07, 0x27, 0x03, 0x84, 0x00, 0x84, 0x00, 0x02, 0x03, 0x02, 0x0A,
+    0x87, 0x00, 0x02, 0x07, 0x02, 0x0B, 0x84, 0x00, 0x84, 0x00, 0x02, 0x03, 0x02, 0x0A, 0x87, 0x00,
+    0x02, 0x07, 0x02, 0x0B, 0x84, 0x00, 0x84, 0x00, 0x02, 0x03, 0x02, 0x0A, 0x87, 0x00, 0x02, 0x07,
+    0x02, 0x0B, 0x84, 0x00, 0x84, 0x00, 0x02, 0x03, 0x02, 0x0A, 0x87, 0x00, 0x02, 0x07, 0x02, 0x0B,
+    0x84, 0x00, 0x84, 0x00, 0x02, 0x03, 0x02, 0x0A, 0x87, 0x00, 0x02, 0x07, 0x02, 0x0B, 0x84, 0x00,
+    0x84, 0x00, 0x02, 0x03, 0x02, 0x0A, 0x87, 0x00, 0x02, 0x07, 0x02, 0x0B, 0x84, 0x00, 0x84, 0x00,
+    0x02, 0x03, 0x02, 0x0A, 0x87, 0x00, 0x02, 0x07, 0x02, 0x0B, 0x84, 0x00, 0x84, 0x00, 0x02, 0x03,
+    0x02, 0x0A, 0x87, 0x00, 0x02, 0x07, 0x02, 0x0B, 0x84, 0x00, 0x84, 0x00, 0x02, 0x03, 0x02, 0x0A,
+    0x87, 0x00, 0x02, 0x07, 0x02, 0x0B, 0x84, 0x00, 0x84, 0x00, 0x02, 0x03, 0x02, 0x0A, 0x87, 0x00,
+    0x02, 0x07, 0x02, 0x0B, 0x84, 0x00, 0x83, 0x00, 0x03, 0x0C, 0x03, 0x02, 0x07, 0x87, 0x00, 0x03,
+    0x16, 0x02, 0x03, 0x0C, 0x83, 0x00, 0x01, 0x05, 0x0F, 0x82, 0x04, 0x02, 0x0D, 0x01, 0x08, 0x87,
+    0x04, 0x02, 0x08, 0x01, 0x0D, 0x82, 0x04, 0x01, 0x0F, 0x11, 0x04, 0x09, 0x17, 0x01, 0x02, 0x02,
+    0x82, 0x01, 0x81, 0x02, 0x8B, 0x01, 0x01, 0x06, 0x19, 0x09, 0x09, 0x06, 0x06, 0x0F, 0x15, 0x10,
+    0x01, 0x25, 0x15, 0x24, 0x8B, 0x01, 0x01, 0x06, 0x09, 0x09, 0x09, 0x17, 0x10, 0x05, 0x00, 0x03,
+    0x02, 0x15, 0x00, 0x13, 0x8B, 0x01, 0x01, 0x06, 0x14, 0x09, 0x09, 0x06, 0x06, 0x23, 0x1F, 0x1A,
+    0x01, 0x03, 0x09, 0x16, 0x8B, 0x01, 0x01, 0x06, 0x14, 0x00, 0x09, 0x94, 0x01, 0x01, 0x06, 0x13,
+    0x06, 0x0E, 0x04, 0x10, 0x01, 0x01, 0x26, 0x1B, 0x89, 0x08, 0x06, 0x1B, 0x0D, 0x01, 0x01, 0x10,
+    0x03, 0x0E, 0x06, 0x00, 0x18, 0x07, 0x01, 0x01, 0x03, 0x0E, 0x89, 0x05, 0x06, 0x0E, 0x04, 0x01,
+    0x01, 0x22, 0x0C, 0x00, 0x06, 0x00, 0x1C, 0x1A, 0x06, 0x06, 0x0D, 0x09, 0x89, 0x00, 0x06, 0x1E,
+    0x0D, 0x06, 0x17, 0x03, 0x0C, 0x00, 0x06, 0x00, 0x0C, 0x12, 0x09, 0x09, 0x19, 0x11, 0x89, 0x00,
+    0x06, 0x05, 0x13, 0x14, 0x09, 0x1D, 0x00, 0x00,
+};
+const asset_image_t savewifi = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 40,
+    .palette = savewifi_palette,
+    .rows = savewifi_rows,
+    .data = savewifi_data,
+};
+
+// ble_ative: 12x12, 288 -> 224 bytes
+static const uint16_t ble_ative_palette[] = {
+    0x895F, 0xBC3F, 0x893F, 0x897F, 0x91DF, 0xA2BF, 0xCCDF, 0xF71F, 0xF75F, 0xFF9F, 0xFFDF, 0x919F,
+    0x91FF, 0x9A5F, 0xA2DF, 0xAB3F, 0xD57F, 0xDDBF, 0xE63F, 0xE65F, 0xE69F, 0xEEBF, 0xEF1F,
+};
+static const uint16_t ble_ative_rows[] = {
+    0, 8, 18, 31, 44, 57, 66, 75, 88, 101, 114, 124,
+    132,
+};
+static const uint8_t ble_ative_data[] = {
+    0x84, 0x00, 0x02, 0x0D, 0x0C, 0x02, 0x83, 0x00, 0x82, 0x00, 0x04, 0x02, 0x03, 0x11, 0x14, 0x0F,
+    0x83, 0x00, 0x81, 0x00, 0x09, 0x04, 0x05, 0x0B, 0x12, 0x08, 0x07, 0x06, 0x04, 0x00, 0x00, 0x0B,
+    0x00, 0x02, 0x0E, 0x16, 0x01, 0x13, 0x06, 0x10, 0x09, 0x05, 0x02, 0x00, 0x81, 0x00, 0x09, 0x03,
+    0x01, 0x08, 0x09, 0x15, 0x07, 0x01, 0x03, 0x00, 0x00, 0x83, 0x00, 0x03, 0x01, 0x0A, 0x0A, 0x01,
+    0x83, 0x00, 0x83, 0x00, 0x03, 0x01, 0x0A, 0x0A, 0x01, 0x83, 0x00, 0x81, 0x00, 0x09, 0x03, 0x01,
+    0x08, 0x09, 0x15, 0x07, 0x01, 0x03, 0x00, 0x00, 0x0B, 0x00, 0x02, 0x0E, 0x16, 0x01, 0x13, 0x06,
+    0x10, 0x09, 0x05, 0x02, 0x00, 0x81, 0x00, 0x09, 0x04, 0x05, 0x0B, 0x12, 0x08, 0x07, 0x06, 0x04,
+    0x00, 0x00, 0x82, 0x00, 0x04, 0x02, 0x03, 0x11, 0x14, 0x0F, 0x83, 0x00, 0x84, 0x00, 0x02, 0x0D,
+    0x0C, 0x02, 0x83, 0x00,
+};
+const asset_image_t ble_ative = {
+    .width = 12,
+    .height = 12,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 23,
+    .palette = ble_ative_palette,
+    .rows = ble_ative_rows,
+    .data = ble_ative_data,
+};
+
+// sd_ative: 12x12, 288 -> 195 bytes
+static const uint16_t sd_ative_palette[] = {
+    0x895F, 0xF800, 0xC0B0, 0xD869, 0xD86A, 0xA119, 0xC0AF, 0xF801, 0xB8D2, 0xD06B, 0xF022, 0xF023,
+    0xB0F5, 0xC0B1, 0xD08C, 0xD868, 0xE047, 0xE048,
+};
+static const uint16_t sd_ative_rows[] = {
+    0, 2, 13, 25, 38, 51, 61, 71, 81, 91, 101, 111,
+    113,
+};
+static const uint8_t sd_ative_data[] = {
+    0x8B, 0x00, 0x83, 0x00, 0x00, 0x0C, 0x82, 0x06, 0x03, 0x02, 0x05, 0x00, 0x00, 0x82, 0x00, 0x08,
+    0x02, 0x07, 0x0B, 0x0B, 0x0A, 0x07, 0x04, 0x00, 0x00, 0x81, 0x00, 0x09, 0x08, 0x01, 0x0A, 0x08,
+    0x0D, 0x02, 0x0E, 0x11, 0x00, 0x00, 0x81, 0x00, 0x09, 0x03, 0x01, 0x07, 0x09, 0x09, 0x04, 0x10,
+    0x0F, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x85, 0x01, 0x02, 0x03, 0x00, 0x00, 0x81, 0x00, 0x00,
+    0x03, 0x85, 0x01, 0x02, 0x03, 0x00, 0x00, 0x81, 0x00, 0x00, 0x03, 0x85, 0x01, 0x02, 0x03, 0x00,
+    0x00, 0x81, 0x00, 0x00, 0x03, 0x85, 0x01, 0x02, 0x03, 0x00, 0x00, 0x81, 0x00, 0x00, 0x04, 0x85,
+    0x01, 0x02, 0x04, 0x00, 0x00, 0x81, 0x00, 0x00, 0x05, 0x85, 0x02, 0x02, 0x05, 0x00, 0x00, 0x8B,
+    0x00,
+};
+const asset_image_t sd_ative = {
+    .width = 12,
+    .height = 12,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 18,
+    .palette = sd_ative_palette,
+    .rows = sd_ative_rows,
+    .data = sd_ative_data,
+};
+
+// insta: 12x12, 288 -> 251 bytes
+static const uint16_t insta_palette[] = {
+    0x0000, 0x0001, 0x2047, 0x286A, 0x60F6, 0x58D4, 0x60F7, 0x58F5, 0x2048, 0x2869, 0x40AF, 0x50D3,
+    0x0822, 0x1825, 0x48B0, 0x48B1, 0x60F5, 0x0802, 0x0823, 0x1025, 0x1846, 0x1847, 0x306B, 0x308C,
+    0x68F7, 0x306A, 0x388C, 0x388E,
+};
+static const uint16_t insta_rows[] = {
+    0, 12, 24, 35, 48, 61, 74, 87, 100, 113, 125, 137,
+    149,
+};
+static const uint8_t insta_data[] = {
+    0x81, 0x00, 0x01, 0x12, 0x08, 0x83, 0x03, 0x03, 0x08, 0x11, 0x00, 0x00, 0x03, 0x00, 0x09, 0x04,
+    0x10, 0x83, 0x05, 0x03, 0x07, 0x04, 0x15, 0x00, 0x02, 0x12, 0x06, 0x03, 0x84, 0x00, 0x03, 0x19,
+    0x0E, 0x07, 0x01, 0x0B, 0x08, 0x04, 0x01, 0x00, 0x09, 0x0B, 0x0B, 0x09, 0x0F, 0x09, 0x06, 0x0D,
+    0x0B, 0x03, 0x07, 0x00, 0x03, 0x06, 0x16, 0x17, 0x18, 0x02, 0x01, 0x10, 0x02, 0x0B, 0x03, 0x05,
+    0x00, 0x0B, 0x16, 0x00, 0x00, 0x0A, 0x0F, 0x00, 0x07, 0x02, 0x0B, 0x03, 0x05, 0x00, 0x0B, 0x1A,
+    0x00, 0x00, 0x0A, 0x0E, 0x00, 0x07, 0x02, 0x0B, 0x03, 0x07, 0x00, 0x08, 0x18, 0x1B, 0x0A, 0x06,
+    0x14, 0x01, 0x04, 0x15, 0x0B, 0x08, 0x04, 0x01, 0x00, 0x02, 0x0F, 0x0E, 0x14, 0x00, 0x0C, 0x06,
+    0x13, 0x03, 0x0C, 0x04, 0x17, 0x11, 0x83, 0x01, 0x03, 0x0C, 0x0A, 0x05, 0x01, 0x03, 0x00, 0x02,
+    0x10, 0x06, 0x83, 0x04, 0x03, 0x06, 0x05, 0x0D, 0x00, 0x81, 0x00, 0x01, 0x01, 0x0D, 0x83, 0x02,
+    0x03, 0x13, 0x01, 0x00, 0x00,
+};
+const asset_image_t insta = {
+    .width = 12,
+    .height = 12,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 28,
+    .palette = insta_palette,
+    .rows = insta_rows,
+    .data = insta_data,
+};
+
+// teste: 128x128, 32768 -> 2685 bytes
+static const uint16_t teste_palette[] = {
+    0x0000, 0x895F, 0x0001, 0x793B, 0x0823, 0x793C, 0x813D, 0x0802, 0x306B, 0x6918, 0x1846, 0x286A,
+    0x58F5, 0x0822, 0x7119, 0x1025, 0x815E, 0x60F6, 0x40AE, 0x713B, 0x711A, 0x6919, 0x1024, 0x58D4,
+    0x60F7, 0x1023, 0x2869, 0x50D2, 0x308C, 0x40AF, 0x2048, 0x0801, 0x388D, 0x48B1, 0x2047, 0x48B0,
+    0x1847, 0x50D3, 0x388C, 0x40B0, 0x895E, 0x1825, 0x1845, 0x2068, 0x2069, 0x388E, 0x48D2, 0x813E,
+    0x408E, 0x60F5, 0x68F7, 0x793D, 0x713A,
+};
+static const uint16_t teste_rows[] = {
+    0, 2, 4, 6, 8, 10, 12, 14, 16, 18, 20, 22,
+    24, 26, 28, 30, 32, 56, 86, 111, 133, 154, 181, 210,
+    247, 288, 328, 368, 408, 447, 487, 526, 565, 602, 664, 731,
+    798, 865, 926, 963, 1002, 1042, 1082, 1121, 1160, 1199, 1239, 1279,
+    1317, 1346, 1373, 1394, 1415, 1436, 1457, 1481, 1508, 1535, 1541, 1543,
+    1545, 1547, 1549, 1551, 1553, 1555, 1557, 1559, 1561, 1563, 1565, 1567,
+    1581, 1598, 1612, 1624, 1636, 1647, 1658, 1668, 1680, 1696, 1720, 1744,
+    1766, 1788, 1808, 1830, 1850, 1871, 1893, 1915, 1937, 1959, 1979, 2000,
+    2021, 2043, 2065, 2087, 2113, 2134, 2146, 2158, 2170, 2181, 2191, 2203,
+    2215, 2226, 2239, 2255, 2269, 2271, 2273, 2275, 2277, 2279, 2281, 2283,
+    2285, 2287, 2289, 2291, 2293, 2295, 2297, 2299, 2301,
+};
+static const uint8_t teste_data[] = {
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0x94, 0x00, 0x03, 0x02, 0x0A, 0x08, 0x30, 0x94, 0x12, 0x02, 0x20, 0x1E, 0x0D, 0x9F, 0x00, 0x01,
+    0x02, 0x0D, 0x94, 0x04, 0x00, 0x02, 0x96, 0x00, 0x93, 0x00, 0x02, 0x0B, 0x11, 0x06, 0x97, 0x01,
+    0x03, 0x10, 0x14, 0x1D, 0x19, 0x9B, 0x00, 0x03, 0x24, 0x23, 0x18, 0x14, 0x93, 0x03, 0x04, 0x34,
+    0x09, 0x1B, 0x1A, 0x02, 0x93, 0x00, 0x91, 0x00, 0x02, 0x0D, 0x1B, 0x10, 0x9C, 0x01, 0x01, 0x15,
+    0x1E, 0x98, 0x00, 0x02, 0x19, 0x1B, 0x06, 0x99, 0x01, 0x02, 0x10, 0x11, 0x24, 0x92, 0x00, 0x90,
+    0x00, 0x01, 0x07, 0x0C, 0x9F, 0x01, 0x01, 0x05, 0x2B, 0x96, 0x00, 0x01, 0x2A, 0x09, 0x9D, 0x01,
+    0x01, 0x05, 0x0B, 0x91, 0x00, 0x90, 0x00, 0x00, 0x21, 0xA1, 0x01, 0x01, 0x14, 0x16, 0x94, 0x00,
+    0x01, 0x04, 0x09, 0x9F, 0x01, 0x01, 0x05, 0x22, 0x90, 0x00, 0x8F, 0x00, 0x01, 0x1E, 0x10, 0xA2,
+    0x01, 0x00, 0x1B, 0x94, 0x00, 0x00, 0x21, 0x8E, 0x01, 0x03, 0x09, 0x23, 0x27, 0x09, 0x8E, 0x01,
+    0x01, 0x09, 0x07, 0x8F, 0x00, 0x8F, 0x00, 0x00, 0x17, 0xA3, 0x01, 0x01, 0x05, 0x29, 0x92, 0x00,
+    0x01, 0x0A, 0x05, 0x8D, 0x01, 0x05, 0x17, 0x07, 0x00, 0x00, 0x07, 0x25, 0x8E, 0x01, 0x00, 0x1C,
+    0x8F, 0x00, 0x8E, 0x00, 0x01, 0x19, 0x03, 0x8F, 0x01, 0x04, 0x11, 0x26, 0x1C, 0x17, 0x10, 0x8F,
+    0x01, 0x00, 0x20, 0x92, 0x00, 0x00, 0x12, 0x8D, 0x01, 0x01, 0x05, 0x0F, 0x83, 0x00, 0x01, 0x16,
+    0x05, 0x8D, 0x01, 0x00, 0x11, 0x8F, 0x00, 0x8E, 0x00, 0x01, 0x22, 0x10, 0x8D, 0x01, 0x02, 0x10,
+    0x1D, 0x02, 0x82, 0x00, 0x01, 0x20, 0x06, 0x8E, 0x01, 0x00, 0x1B, 0x92, 0x00, 0x00, 0x0C, 0x8D,
+    0x01, 0x01, 0x09, 0x02, 0x83, 0x00, 0x01, 0x02, 0x09, 0x8D, 0x01, 0x01, 0x03, 0x19, 0x8E, 0x00,
+    0x8E, 0x00, 0x00, 0x0B, 0x8D, 0x01, 0x01, 0x05, 0x1C, 0x85, 0x00, 0x01, 0x1A, 0x03, 0x8D, 0x01,
+    0x00, 0x0C, 0x91, 0x00, 0x01, 0x1F, 0x09, 0x8D, 0x01, 0x01, 0x09, 0x02, 0x83, 0x00, 0x01, 0x02,
+    0x18, 0x8D, 0x01, 0x01, 0x06, 0x2A, 0x8E, 0x00, 0x8E, 0x00, 0x00, 0x0B, 0x8C, 0x01, 0x01, 0x14,
+    0x2B, 0x87, 0x00, 0x01, 0x24, 0x15, 0x8C, 0x01, 0x00, 0x0C, 0x91, 0x00, 0x01, 0x07, 0x0E, 0x8D,
+    0x01, 0x01, 0x15, 0x1F, 0x83, 0x00, 0x01, 0x02, 0x18, 0x8D, 0x01, 0x01, 0x06, 0x0A, 0x8E, 0x00,
+    0x8E, 0x00, 0x00, 0x0B, 0x8B, 0x01, 0x01, 0x09, 0x0A, 0x89, 0x00, 0x01, 0x16, 0x11, 0x8B, 0x01,
+    0x00, 0x0C, 0x91, 0x00, 0x01, 0x07, 0x0E, 0x8D, 0x01, 0x01, 0x15, 0x1F, 0x83, 0x00, 0x01, 0x02,
+    0x18, 0x8D, 0x01, 0x01, 0x06, 0x0A, 0x8E, 0x00, 0x8E, 0x00, 0x00, 0x0B, 0x8A, 0x01, 0x01, 0x0C,
+    0x19, 0x8B, 0x00, 0x01, 0x0D, 0x1B, 0x8A, 0x01, 0x00, 0x0C, 0x91, 0x00, 0x01, 0x07, 0x0E, 0x8D,
+    0x01, 0x01, 0x15, 0x1F, 0x84, 0x00, 0x00, 0x11, 0x8D, 0x01, 0x01, 0x06, 0x0A, 0x8E, 0x00, 0x8E,
+    0x00, 0x00, 0x0B, 0x89, 0x01, 0x01, 0x21, 0x07, 0x8D, 0x00, 0x02, 0x02, 0x1D, 0x10, 0x88, 0x01,
+    0x00, 0x0C, 0x91, 0x00, 0x01, 0x07, 0x0E, 0x8D, 0x01, 0x01, 0x15, 0x1F, 0x84, 0x00, 0x00, 0x11,
+    0x8D, 0x01, 0x01, 0x06, 0x0A, 0x8E, 0x00, 0x8E, 0x00, 0x00, 0x0B, 0x87, 0x01, 0x01, 0x06, 0x2D,
+    0x91, 0x00, 0x01, 0x1C, 0x05, 0x87, 0x01, 0x00, 0x0C, 0x91, 0x00, 0x01, 0x07, 0x0E, 0x8D, 0x01,
+    0x01, 0x15, 0x1F, 0x84, 0x00, 0x00, 0x11, 0x8D, 0x01, 0x01, 0x06, 0x0A, 0x8E, 0x00, 0x8E, 0x00,
+    0x00, 0x0B, 0x86, 0x01, 0x01, 0x05, 0x08, 0x93, 0x00, 0x01, 0x2C, 0x03, 0x86, 0x01, 0x00, 0x0C,
+    0x91, 0x00, 0x01, 0x07, 0x0E, 0x8D, 0x01, 0x01, 0x14, 0x07, 0x84, 0x00, 0x00, 0x11, 0x8D, 0x01,
+    0x01, 0x06, 0x0A, 0x8E, 0x00, 0x8E, 0x00, 0x00, 0x0B, 0x86, 0x01, 0x00, 0x12, 0x95, 0x00, 0x00,
+    0x1C, 0x86, 0x01, 0x00, 0x0C, 0x91, 0x00, 0x01, 0x07, 0x0E, 0x8D, 0x01, 0x01, 0x14, 0x07, 0x84,
+    0x00, 0x00, 0x11, 0x8D, 0x01, 0x01, 0x06, 0x0A, 0x8E, 0x00, 0x8E, 0x00, 0x00, 0x0B, 0x85, 0x01,
+    0x01, 0x06, 0x0A, 0x86, 0x00, 0x01, 0x0A, 0x02, 0x84, 0x00, 0x01, 0x0A, 0x02, 0x85, 0x00, 0x01,
+    0x19, 0x03, 0x85, 0x01, 0x00, 0x0C, 0x91, 0x00, 0x01, 0x07, 0x0E, 0x87, 0x01, 0x02, 0x03, 0x0E,
+    0x05, 0x82, 0x01, 0x01, 0x14, 0x07, 0x84, 0x00, 0x00, 0x0C, 0x82, 0x01, 0x03, 0x03, 0x31, 0x11,
+    0x05, 0x86, 0x01, 0x01, 0x06, 0x0A, 0x8E, 0x00, 0x8E, 0x00, 0x00, 0x0B, 0x85, 0x01, 0x01, 0x06,
+    0x0A, 0x85, 0x00, 0x02, 0x12, 0x18, 0x1F, 0x84, 0x00, 0x02, 0x0C, 0x21, 0x02, 0x84, 0x00, 0x01,
+    0x16, 0x05, 0x85, 0x01, 0x00, 0x0C, 0x91, 0x00, 0x01, 0x07, 0x0E, 0x85, 0x01, 0x09, 0x10, 0x12,
+    0x19, 0x07, 0x29, 0x17, 0x01, 0x01, 0x14, 0x07, 0x84, 0x00, 0x08, 0x17, 0x01, 0x01, 0x0C, 0x0F,
+    0x00, 0x00, 0x0A, 0x09, 0x85, 0x01, 0x01, 0x06, 0x0A, 0x8E, 0x00, 0x8E, 0x00, 0x00, 0x0B, 0x86,
+    0x01, 0x00, 0x1D, 0x83, 0x00, 0x04, 0x07, 0x2E, 0x01, 0x15, 0x02, 0x84, 0x00, 0x03, 0x11, 0x01,
+    0x17, 0x04, 0x83, 0x00, 0x00, 0x26, 0x86, 0x01, 0x00, 0x0C, 0x91, 0x00, 0x01, 0x07, 0x0E, 0x85,
+    0x01, 0x00, 0x21, 0x83, 0x00, 0x04, 0x02, 0x1D, 0x10, 0x14, 0x07, 0x84, 0x00, 0x03, 0x17, 0x01,
+    0x2E, 0x07, 0x83, 0x00, 0x01, 0x1E, 0x10, 0x84, 0x01, 0x01, 0x06, 0x0A, 0x8E, 0x00, 0x8E, 0x00,
+    0x00, 0x0B, 0x86, 0x01, 0x09, 0x06, 0x20, 0x04, 0x1F, 0x0A, 0x0C, 0x01, 0x01, 0x15, 0x02, 0x84,
+    0x00, 0x08, 0x11, 0x01, 0x01, 0x18, 0x22, 0x07, 0x0D, 0x08, 0x05, 0x86, 0x01, 0x00, 0x0C, 0x91,
+    0x00, 0x01, 0x07, 0x0E, 0x84, 0x01, 0x01, 0x10, 0x1E, 0x85, 0x00, 0x02, 0x1C, 0x18, 0x0D, 0x84,
+    0x00, 0x02, 0x1B, 0x1D, 0x02, 0x84, 0x00, 0x01, 0x07, 0x14, 0x84, 0x01, 0x01, 0x06, 0x0A, 0x8E,
+    0x00, 0x8E, 0x00, 0x00, 0x0B, 0x88, 0x01, 0x02, 0x13, 0x0E, 0x06, 0x82, 0x01, 0x01, 0x15, 0x02,
+    0x84, 0x00, 0x00, 0x11, 0x82, 0x01, 0x03, 0x06, 0x0E, 0x14, 0x28, 0x87, 0x01, 0x00, 0x0C, 0x91,
+    0x00, 0x01, 0x07, 0x0E, 0x84, 0x01, 0x01, 0x10, 0x1E, 0x86, 0x00, 0x01, 0x0F, 0x02, 0x84, 0x00,
+    0x00, 0x16, 0x86, 0x00, 0x01, 0x04, 0x13, 0x84, 0x01, 0x01, 0x06, 0x0A, 0x8E, 0x00, 0x8E, 0x00,
+    0x00, 0x0B, 0x8E, 0x01, 0x01, 0x15, 0x02, 0x84, 0x00, 0x00, 0x11, 0x8E, 0x01, 0x00, 0x0C, 0x91,
+    0x00, 0x01, 0x07, 0x0E, 0x85, 0x01, 0x00, 0x23, 0x95, 0x00, 0x00, 0x1C, 0x85, 0x01, 0x01, 0x06,
+    0x0A, 0x8E, 0x00, 0x8E, 0x00, 0x00, 0x0B, 0x8E, 0x01, 0x01, 0x15, 0x02, 0x84, 0x00, 0x00, 0x11,
+    0x8E, 0x01, 0x00, 0x0C, 0x91, 0x00, 0x01, 0x07, 0x0E, 0x85, 0x01, 0x01, 0x06, 0x26, 0x93, 0x00,
+    0x01, 0x08, 0x05, 0x85, 0x01, 0x01, 0x06, 0x0A, 0x8E, 0x00, 0x8E, 0x00, 0x00, 0x0B, 0x8E, 0x01,
+    0x01, 0x15, 0x02, 0x84, 0x00, 0x00, 0x11, 0x8E, 0x01, 0x00, 0x0C, 0x91, 0x00, 0x01, 0x07, 0x0E,
+    0x86, 0x01, 0x02, 0x10, 0x23, 0x02, 0x90, 0x00, 0x01, 0x20, 0x06, 0x86, 0x01, 0x01, 0x06, 0x0A,
+    0x8E, 0x00, 0x8E, 0x00, 0x00, 0x0B, 0x8E, 0x01, 0x01, 0x15, 0x02, 0x84, 0x00, 0x00, 0x11, 0x8E,
+    0x01, 0x00, 0x0C, 0x91, 0x00, 0x01, 0x07, 0x0E, 0x88, 0x01, 0x01, 0x17, 0x04, 0x8D, 0x00, 0x02,
+    0x02, 0x23, 0x28, 0x87, 0x01, 0x01, 0x06, 0x0A, 0x8E, 0x00, 0x8E, 0x00, 0x00, 0x0B, 0x8E, 0x01,
+    0x01, 0x15, 0x02, 0x84, 0x00, 0x00, 0x11, 0x8E, 0x01, 0x00, 0x0C, 0x91, 0x00, 0x01, 0x07, 0x0E,
+    0x89, 0x01, 0x01, 0x32, 0x2A, 0x8B, 0x00, 0x01, 0x04, 0x17, 0x89, 0x01, 0x01, 0x06, 0x0A, 0x8E,
+    0x00, 0x8E, 0x00, 0x00, 0x0B, 0x8E, 0x01, 0x01, 0x15, 0x02, 0x84, 0x00, 0x00, 0x11, 0x8E, 0x01,
+    0x00, 0x0C, 0x91, 0x00, 0x01, 0x07, 0x0E, 0x8A, 0x01, 0x01, 0x14, 0x1A, 0x89, 0x00, 0x01, 0x16,
+    0x11, 0x8A, 0x01, 0x01, 0x06, 0x0A, 0x8E, 0x00, 0x8E, 0x00, 0x00, 0x0B, 0x8E, 0x01, 0x01, 0x15,
+    0x02, 0x84, 0x00, 0x00, 0x11, 0x8E, 0x01, 0x00, 0x0C, 0x91, 0x00, 0x01, 0x07, 0x0E, 0x8B, 0x01,
+    0x01, 0x33, 0x1C, 0x87, 0x00, 0x01, 0x24, 0x15, 0x8B, 0x01, 0x01, 0x06, 0x0A, 0x8E, 0x00, 0x8E,
+    0x00, 0x00, 0x0B, 0x8E, 0x01, 0x01, 0x15, 0x02, 0x84, 0x00, 0x00, 0x11, 0x8E, 0x01, 0x00, 0x0C,
+    0x91, 0x00, 0x01, 0x07, 0x0E, 0x8C, 0x01, 0x02, 0x10, 0x23, 0x02, 0x84, 0x00, 0x01, 0x1A, 0x03,
+    0x8C, 0x01, 0x01, 0x06, 0x0A, 0x8E, 0x00, 0x8E, 0x00, 0x00, 0x0B, 0x8E, 0x01, 0x01, 0x0E, 0x07,
+    0x83, 0x00, 0x01, 0x02, 0x18, 0x8E, 0x01, 0x00, 0x0C, 0x91, 0x00, 0x01, 0x07, 0x0E, 0x8E, 0x01,
+    0x01, 0x17, 0x19, 0x82, 0x00, 0x01, 0x1C, 0x06, 0x8D, 0x01, 0x01, 0x06, 0x0A, 0x8E, 0x00, 0x8E,
+    0x00, 0x00, 0x0B, 0x8E, 0x01, 0x01, 0x06, 0x0A, 0x83, 0x00, 0x01, 0x16, 0x03, 0x8E, 0x01, 0x00,
+    0x0C, 0x91, 0x00, 0x01, 0x07, 0x15, 0x8F, 0x01, 0x04, 0x0E, 0x27, 0x2D, 0x0C, 0x10, 0x8E, 0x01,
+    0x01, 0x06, 0x0A, 0x8E, 0x00, 0x8E, 0x00, 0x00, 0x2B, 0x8F, 0x01, 0x05, 0x11, 0x16, 0x00, 0x00,
+    0x04, 0x17, 0x8F, 0x01, 0x00, 0x17, 0x91, 0x00, 0x01, 0x02, 0x18, 0xA3, 0x01, 0x01, 0x05, 0x16,
+    0x8E, 0x00, 0x8E, 0x00, 0x01, 0x0F, 0x05, 0x8F, 0x01, 0x03, 0x14, 0x1B, 0x21, 0x0E, 0x90, 0x01,
+    0x00, 0x1D, 0x92, 0x00, 0x00, 0x21, 0xA3, 0x01, 0x01, 0x09, 0x1F, 0x8E, 0x00, 0x8E, 0x00, 0x01,
+    0x02, 0x18, 0xA3, 0x01, 0x01, 0x10, 0x1E, 0x92, 0x00, 0x01, 0x1A, 0x10, 0xA2, 0x01, 0x00, 0x27,
+    0x8F, 0x00, 0x8F, 0x00, 0x00, 0x26, 0xA3, 0x01, 0x01, 0x18, 0x02, 0x92, 0x00, 0x01, 0x02, 0x11,
+    0xA1, 0x01, 0x01, 0x05, 0x29, 0x8F, 0x00, 0x8F, 0x00, 0x01, 0x07, 0x18, 0xA1, 0x01, 0x01, 0x2F,
+    0x1A, 0x94, 0x00, 0x01, 0x22, 0x05, 0xA0, 0x01, 0x00, 0x20, 0x90, 0x00, 0x90, 0x00, 0x01, 0x0A,
+    0x03, 0xA0, 0x01, 0x00, 0x1D, 0x96, 0x00, 0x01, 0x1C, 0x06, 0x9E, 0x01, 0x01, 0x21, 0x02, 0x90,
+    0x00, 0x91, 0x00, 0x01, 0x1E, 0x14, 0x9D, 0x01, 0x02, 0x10, 0x27, 0x02, 0x97, 0x00, 0x01, 0x0B,
+    0x14, 0x9B, 0x01, 0x02, 0x33, 0x1D, 0x02, 0x91, 0x00, 0x92, 0x00, 0x02, 0x16, 0x25, 0x06, 0x9A,
+    0x01, 0x01, 0x09, 0x0B, 0x9A, 0x00, 0x03, 0x16, 0x1D, 0x0E, 0x06, 0x95, 0x01, 0x03, 0x10, 0x13,
+    0x1B, 0x0A, 0x93, 0x00, 0x94, 0x00, 0x02, 0x0A, 0x1D, 0x0C, 0x95, 0x09, 0x03, 0x11, 0x2E, 0x0B,
+    0x07, 0x9D, 0x00, 0x02, 0x07, 0x0A, 0x0B, 0x93, 0x08, 0x02, 0x0B, 0x22, 0x19, 0x95, 0x00, 0x97,
+    0x00, 0x95, 0x02, 0xD1, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xB3,
+    0x00, 0x02, 0x02, 0x04, 0x19, 0x91, 0x04, 0x02, 0x19, 0x0D, 0x02, 0xB3, 0x00, 0xB0, 0x00, 0x04,
+    0x02, 0x1A, 0x1B, 0x09, 0x14, 0x93, 0x03, 0x03, 0x14, 0x32, 0x21, 0x22, 0xB1, 0x00, 0xAF, 0x00,
+    0x02, 0x0A, 0x31, 0x10, 0x99, 0x01, 0x02, 0x06, 0x25, 0x16, 0xAF, 0x00, 0xAE, 0x00, 0x01, 0x2C,
+    0x03, 0x9D, 0x01, 0x01, 0x0E, 0x0A, 0xAE, 0x00, 0xAD, 0x00, 0x01, 0x24, 0x03, 0x9F, 0x01, 0x01,
+    0x15, 0x16, 0xAD, 0x00, 0xAC, 0x00, 0x01, 0x1F, 0x11, 0xA1, 0x01, 0x00, 0x25, 0xAD, 0x00, 0xAC,
+    0x00, 0x00, 0x0B, 0xA2, 0x01, 0x01, 0x06, 0x24, 0xAC, 0x00, 0xAC, 0x00, 0x00, 0x17, 0xA3, 0x01,
+    0x00, 0x23, 0xAC, 0x00, 0xAB, 0x00, 0x01, 0x0D, 0x14, 0xA3, 0x01, 0x01, 0x18, 0x02, 0xAB, 0x00,
+    0xAB, 0x00, 0x01, 0x16, 0x05, 0x91, 0x01, 0x00, 0x10, 0x90, 0x01, 0x01, 0x14, 0x07, 0xAB, 0x00,
+    0xAB, 0x00, 0x01, 0x0F, 0x05, 0x8D, 0x01, 0x08, 0x05, 0x17, 0x20, 0x1A, 0x1E, 0x1A, 0x2D, 0x0C,
+    0x06, 0x8C, 0x01, 0x01, 0x13, 0x0D, 0xAB, 0x00, 0xAB, 0x00, 0x01, 0x0F, 0x05, 0x8B, 0x01, 0x02,
+    0x2F, 0x21, 0x0F, 0x86, 0x00, 0x02, 0x0A, 0x17, 0x28, 0x8A, 0x01, 0x01, 0x13, 0x0D, 0xAB, 0x00,
+    0xAB, 0x00, 0x01, 0x0F, 0x05, 0x8A, 0x01, 0x01, 0x05, 0x0B, 0x8A, 0x00, 0x01, 0x20, 0x06, 0x89,
+    0x01, 0x01, 0x13, 0x0D, 0xAB, 0x00, 0xAB, 0x00, 0x01, 0x0F, 0x05, 0x89, 0x01, 0x01, 0x06, 0x1A,
+    0x8C, 0x00, 0x01, 0x20, 0x10, 0x88, 0x01, 0x01, 0x13, 0x0D, 0xAB, 0x00, 0xAB, 0x00, 0x01, 0x0F,
+    0x05, 0x89, 0x01, 0x00, 0x12, 0x8E, 0x00, 0x00, 0x1B, 0x88, 0x01, 0x01, 0x13, 0x0D, 0xAB, 0x00,
+    0xAB, 0x00, 0x01, 0x0F, 0x05, 0x88, 0x01, 0x01, 0x15, 0x0D, 0x8E, 0x00, 0x01, 0x0F, 0x05, 0x87,
+    0x01, 0x01, 0x13, 0x0D, 0xAB, 0x00, 0xAB, 0x00, 0x01, 0x0F, 0x05, 0x88, 0x01, 0x00, 0x12, 0x90,
+    0x00, 0x00, 0x25, 0x87, 0x01, 0x01, 0x13, 0x0D, 0xAB, 0x00, 0xAB, 0x00, 0x01, 0x0F, 0x05, 0x87,
+    0x01, 0x01, 0x10, 0x22, 0x90, 0x00, 0x00, 0x08, 0x87, 0x01, 0x01, 0x13, 0x0D, 0xAB, 0x00, 0xAB,
+    0x00, 0x01, 0x0F, 0x05, 0x87, 0x01, 0x01, 0x03, 0x19, 0x90, 0x00, 0x01, 0x0A, 0x10, 0x86, 0x01,
+    0x01, 0x13, 0x0D, 0xAB, 0x00, 0xAB, 0x00, 0x01, 0x0F, 0x05, 0x87, 0x01, 0x01, 0x14, 0x07, 0x90,
+    0x00, 0x01, 0x0F, 0x05, 0x86, 0x01, 0x01, 0x13, 0x0D, 0xAB, 0x00, 0xAB, 0x00, 0x01, 0x0F, 0x05,
+    0x87, 0x01, 0x01, 0x14, 0x0D, 0x90, 0x00, 0x01, 0x2A, 0x06, 0x86, 0x01, 0x01, 0x13, 0x0D, 0xAB,
+    0x00, 0xAB, 0x00, 0x01, 0x0F, 0x05, 0x87, 0x01, 0x01, 0x05, 0x0F, 0x90, 0x00, 0x01, 0x2B, 0x28,
+    0x86, 0x01, 0x01, 0x13, 0x0D, 0xAB, 0x00, 0xAB, 0x00, 0x01, 0x0F, 0x05, 0x88, 0x01, 0x00, 0x08,
+    0x90, 0x00, 0x00, 0x1D, 0x87, 0x01, 0x01, 0x13, 0x0D, 0xAB, 0x00, 0xAB, 0x00, 0x01, 0x0F, 0x05,
+    0x88, 0x01, 0x00, 0x17, 0x8F, 0x00, 0x01, 0x07, 0x09, 0x87, 0x01, 0x01, 0x13, 0x0D, 0xAB, 0x00,
+    0xAB, 0x00, 0x01, 0x0F, 0x05, 0x88, 0x01, 0x01, 0x06, 0x1E, 0x8E, 0x00, 0x00, 0x1C, 0x88, 0x01,
+    0x01, 0x13, 0x0D, 0xAB, 0x00, 0xAB, 0x00, 0x01, 0x0F, 0x05, 0x89, 0x01, 0x01, 0x09, 0x04, 0x8C,
+    0x00, 0x01, 0x29, 0x14, 0x88, 0x01, 0x01, 0x13, 0x0D, 0xAB, 0x00, 0xAB, 0x00, 0x01, 0x0F, 0x05,
+    0x8A, 0x01, 0x01, 0x0C, 0x04, 0x8A, 0x00, 0x01, 0x16, 0x09, 0x89, 0x01, 0x01, 0x13, 0x0D, 0xAB,
+    0x00, 0xAB, 0x00, 0x01, 0x0F, 0x05, 0x8B, 0x01, 0x01, 0x18, 0x22, 0x88, 0x00, 0x01, 0x1A, 0x0E,
+    0x8A, 0x01, 0x01, 0x13, 0x0D, 0xAB, 0x00, 0xAB, 0x00, 0x01, 0x0F, 0x05, 0x8C, 0x01, 0x0A, 0x06,
+    0x1B, 0x1E, 0x04, 0x02, 0x00, 0x02, 0x19, 0x1A, 0x17, 0x10, 0x8B, 0x01, 0x01, 0x13, 0x0D, 0xAB,
+    0x00, 0xAB, 0x00, 0x01, 0x0F, 0x05, 0x8E, 0x01, 0x05, 0x10, 0x13, 0x09, 0x11, 0x09, 0x03, 0x8E,
+    0x01, 0x01, 0x13, 0x0D, 0xAB, 0x00, 0xAB, 0x00, 0x01, 0x0F, 0x05, 0xA3, 0x01, 0x01, 0x13, 0x0D,
+    0xAB, 0x00, 0xAB, 0x00, 0x01, 0x0F, 0x05, 0xA3, 0x01, 0x01, 0x14, 0x07, 0xAB, 0x00, 0xAB, 0x00,
+    0x01, 0x19, 0x03, 0xA3, 0x01, 0x01, 0x09, 0x02, 0xAB, 0x00, 0xAB, 0x00, 0x01, 0x02, 0x18, 0xA3,
+    0x01, 0x00, 0x25, 0xAC, 0x00, 0xAC, 0x00, 0x00, 0x30, 0xA3, 0x01, 0x00, 0x0B, 0xAC, 0x00, 0xAC,
+    0x00, 0x01, 0x16, 0x13, 0xA1, 0x01, 0x01, 0x09, 0x07, 0xAC, 0x00, 0xAD, 0x00, 0x01, 0x1C, 0x28,
+    0x9F, 0x01, 0x01, 0x06, 0x2C, 0xAD, 0x00, 0xAE, 0x00, 0x00, 0x23, 0x9E, 0x01, 0x01, 0x10, 0x26,
+    0xAE, 0x00, 0xAE, 0x00, 0x02, 0x02, 0x20, 0x05, 0x9B, 0x01, 0x01, 0x13, 0x08, 0xAF, 0x00, 0xB0,
+    0x00, 0x03, 0x0A, 0x1B, 0x14, 0x10, 0x95, 0x01, 0x03, 0x2F, 0x0E, 0x27, 0x16, 0xB0, 0x00, 0xB2,
+    0x00, 0x02, 0x04, 0x22, 0x0B, 0x93, 0x08, 0x02, 0x1A, 0x0A, 0x07, 0xB2, 0x00, 0xFF, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF,
+    0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+};
+const asset_image_t teste = {
+    .width = 128,
+    .height = 128,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 53,
+    .palette = teste_palette,
+    .rows = teste_rows,
+    .data = teste_data,
+};
+
+// UART: 24x24, 1152 -> 486 bytes
+static const uint16_t UART_palette[] = {
+    0x0000, 0x895F, 0x50D3, 0x58F5, 0x0802, 0x58D4, 0x2869, 0x48B0, 0x60F6, 0x0001, 0x1846, 0x306B,
+    0x1024, 0x2048, 0x48B1, 0x286A, 0x0823, 0x2047, 0x388E, 0x40AF, 0x50D2, 0x60F5, 0x60F7, 0x1825,
+    0x388D, 0x68F7, 0x1023, 0x2068, 0x308B, 0x308C, 0x388C, 0x58F4, 0x711A, 0x793B, 0x0822, 0x1025,
+    0x1845, 0x48D1, 0x6918, 0x713B, 0x793C, 0x815E,
+};
+static const uint16_t UART_rows[] = {
+    0, 2, 4, 6, 17, 39, 60, 79, 99, 124, 149, 174,
+    199, 218, 239, 263, 281, 291, 300, 309, 318, 326, 328, 330,
+    332,
+};
+static const uint8_t UART_data[] = {
+    0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x88, 0x00, 0x05, 0x0C, 0x13, 0x05, 0x02, 0x18, 0x04, 0x88,
+    0x00, 0x02, 0x00, 0x04, 0x07, 0x84, 0x02, 0x07, 0x03, 0x0E, 0x17, 0x00, 0x09, 0x11, 0x02, 0x05,
+    0x83, 0x02, 0x03, 0x14, 0x0B, 0x00, 0x00, 0x02, 0x00, 0x1F, 0x0A, 0x82, 0x04, 0x02, 0x10, 0x16,
+    0x0A, 0x85, 0x00, 0x01, 0x0B, 0x05, 0x83, 0x04, 0x02, 0x07, 0x06, 0x00, 0x01, 0x00, 0x03, 0x83,
+    0x00, 0x01, 0x07, 0x0D, 0x87, 0x00, 0x01, 0x13, 0x06, 0x82, 0x00, 0x02, 0x0C, 0x07, 0x00, 0x01,
+    0x00, 0x03, 0x83, 0x00, 0x02, 0x03, 0x00, 0x09, 0x86, 0x00, 0x07, 0x09, 0x03, 0x00, 0x09, 0x00,
+    0x0C, 0x07, 0x00, 0x17, 0x00, 0x03, 0x00, 0x08, 0x1B, 0x11, 0x18, 0x0D, 0x16, 0x08, 0x09, 0x08,
+    0x1B, 0x1A, 0x19, 0x19, 0x22, 0x05, 0x06, 0x16, 0x08, 0x23, 0x07, 0x00, 0x17, 0x00, 0x03, 0x0F,
+    0x02, 0x06, 0x0F, 0x0F, 0x0E, 0x1A, 0x25, 0x12, 0x02, 0x06, 0x0B, 0x0F, 0x0B, 0x06, 0x0E, 0x14,
+    0x0C, 0x0E, 0x11, 0x07, 0x00, 0x17, 0x00, 0x03, 0x00, 0x0B, 0x06, 0x0D, 0x1E, 0x07, 0x0A, 0x05,
+    0x04, 0x0B, 0x06, 0x0F, 0x1E, 0x12, 0x0D, 0x02, 0x0E, 0x0A, 0x05, 0x0A, 0x07, 0x00, 0x17, 0x00,
+    0x03, 0x0A, 0x08, 0x15, 0x24, 0x05, 0x10, 0x05, 0x12, 0x0A, 0x08, 0x15, 0x17, 0x14, 0x0E, 0x00,
+    0x08, 0x10, 0x05, 0x12, 0x0C, 0x07, 0x00, 0x01, 0x00, 0x03, 0x83, 0x00, 0x01, 0x02, 0x17, 0x87,
+    0x00, 0x01, 0x1C, 0x1D, 0x82, 0x00, 0x02, 0x0C, 0x07, 0x00, 0x01, 0x00, 0x08, 0x83, 0x00, 0x02,
+    0x04, 0x08, 0x10, 0x85, 0x00, 0x02, 0x0A, 0x21, 0x1C, 0x82, 0x00, 0x02, 0x06, 0x18, 0x00, 0x02,
+    0x00, 0x0D, 0x15, 0x83, 0x03, 0x10, 0x26, 0x27, 0x1D, 0x09, 0x00, 0x00, 0x04, 0x13, 0x21, 0x0D,
+    0x1F, 0x19, 0x16, 0x08, 0x02, 0x09, 0x00, 0x88, 0x00, 0x00, 0x06, 0x82, 0x05, 0x0A, 0x14, 0x0A,
+    0x09, 0x15, 0x29, 0x01, 0x01, 0x20, 0x04, 0x00, 0x00, 0x8F, 0x00, 0x00, 0x06, 0x83, 0x01, 0x02,
+    0x20, 0x04, 0x00, 0x8F, 0x00, 0x00, 0x0C, 0x84, 0x01, 0x01, 0x03, 0x00, 0x90, 0x00, 0x00, 0x0B,
+    0x83, 0x01, 0x01, 0x28, 0x00, 0x91, 0x00, 0x00, 0x0B, 0x82, 0x01, 0x01, 0x05, 0x00, 0x92, 0x00,
+    0x04, 0x11, 0x02, 0x13, 0x09, 0x00, 0x97, 0x00, 0x97, 0x00, 0x97, 0x00,
+};
+const asset_image_t UART = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 42,
+    .palette = UART_palette,
+    .rows = UART_rows,
+    .data = UART_data,
+};
+
+// icon_file: 24x24, 1152 -> 415 bytes
+static const uint16_t icon_file_palette[] = {
+    0x895F, 0x0000, 0x0001, 0x48B1, 0x0802, 0x388C, 0x7119, 0x58F5, 0x1024, 0x50D3, 0x0823, 0x2048,
+    0x308C, 0x58D4, 0x711A, 0x40AE, 0x60F6, 0x6918, 0x793B, 0x0801, 0x1825, 0x2869, 0x286A, 0x388D,
+    0x40AF, 0x713B, 0x793C, 0x813D,
+};
+static const uint16_t icon_file_rows[] = {
+    0, 2, 13, 26, 38, 53, 69, 84, 96, 106, 124, 142,
+    152, 162, 179, 197, 207, 224, 241, 251, 261, 267, 277, 287,
+    289,
+};
+static const uint8_t icon_file_data[] = {
+    0x97, 0x01, 0x84, 0x01, 0x00, 0x0C, 0x86, 0x03, 0x01, 0x16, 0x02, 0x88, 0x01, 0x83, 0x01, 0x00,
+    0x0D, 0x87, 0x00, 0x03, 0x09, 0x08, 0x11, 0x13, 0x86, 0x01, 0x83, 0x01, 0x88, 0x00, 0x04, 0x09,
+    0x08, 0x00, 0x06, 0x04, 0x85, 0x01, 0x82, 0x01, 0x00, 0x02, 0x88, 0x00, 0x05, 0x09, 0x08, 0x00,
+    0x00, 0x0E, 0x0A, 0x84, 0x01, 0x82, 0x01, 0x00, 0x02, 0x88, 0x00, 0x01, 0x09, 0x08, 0x82, 0x00,
+    0x01, 0x12, 0x08, 0x83, 0x01, 0x82, 0x01, 0x00, 0x02, 0x88, 0x00, 0x01, 0x10, 0x02, 0x83, 0x05,
+    0x00, 0x0B, 0x83, 0x01, 0x82, 0x01, 0x00, 0x02, 0x89, 0x00, 0x00, 0x03, 0x84, 0x05, 0x83, 0x01,
+    0x82, 0x01, 0x00, 0x02, 0x8F, 0x00, 0x00, 0x02, 0x82, 0x01, 0x82, 0x01, 0x00, 0x02, 0x82, 0x00,
+    0x00, 0x10, 0x87, 0x07, 0x00, 0x11, 0x82, 0x00, 0x00, 0x02, 0x82, 0x01, 0x82, 0x01, 0x04, 0x02,
+    0x00, 0x00, 0x19, 0x0A, 0x87, 0x04, 0x00, 0x14, 0x82, 0x00, 0x00, 0x02, 0x82, 0x01, 0x82, 0x01,
+    0x00, 0x02, 0x8F, 0x00, 0x00, 0x02, 0x82, 0x01, 0x82, 0x01, 0x00, 0x02, 0x8F, 0x00, 0x00, 0x02,
+    0x82, 0x01, 0x82, 0x01, 0x03, 0x02, 0x00, 0x00, 0x0E, 0x88, 0x01, 0x00, 0x0A, 0x82, 0x00, 0x00,
+    0x02, 0x82, 0x01, 0x82, 0x01, 0x00, 0x02, 0x82, 0x00, 0x00, 0x0E, 0x87, 0x06, 0x00, 0x12, 0x82,
+    0x00, 0x00, 0x02, 0x82, 0x01, 0x82, 0x01, 0x00, 0x02, 0x8F, 0x00, 0x00, 0x02, 0x82, 0x01, 0x82,
+    0x01, 0x07, 0x02, 0x00, 0x00, 0x1A, 0x15, 0x0B, 0x0B, 0x17, 0x88, 0x00, 0x00, 0x02, 0x82, 0x01,
+    0x82, 0x01, 0x07, 0x02, 0x00, 0x00, 0x1B, 0x18, 0x0F, 0x0F, 0x09, 0x88, 0x00, 0x00, 0x02, 0x82,
+    0x01, 0x82, 0x01, 0x00, 0x02, 0x8F, 0x00, 0x00, 0x02, 0x82, 0x01, 0x82, 0x01, 0x00, 0x02, 0x8F,
+    0x00, 0x00, 0x02, 0x82, 0x01, 0x83, 0x01, 0x8F, 0x00, 0x83, 0x01, 0x83, 0x01, 0x00, 0x0D, 0x8D,
+    0x00, 0x00, 0x0D, 0x83, 0x01, 0x84, 0x01, 0x00, 0x0C, 0x8B, 0x03, 0x00, 0x0C, 0x84, 0x01, 0x97,
+    0x01,
+};
+const asset_image_t icon_file = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 28,
+    .palette = icon_file_palette,
+    .rows = icon_file_rows,
+    .data = icon_file_data,
+};
+
+// icon_folder: 24x24, 1152 -> 368 bytes
+static const uint16_t icon_folder_palette[] = {
+    0x0000, 0x895F, 0x1846, 0x1024, 0x286A, 0x0001, 0x2048, 0x388D, 0x793C, 0x1825, 0x1845, 0x2047,
+    0x2869, 0x40AF, 0x58D4, 0x60F7, 0x711A, 0x713B, 0x813D, 0x815E, 0x0802, 0x0822, 0x0823, 0x1023,
+    0x1025, 0x306B, 0x308C, 0x408E, 0x48B0, 0x48B1, 0x50D2, 0x58F5, 0x60F5, 0x68F7,
+};
+static const uint16_t icon_folder_rows[] = {
+    0, 2, 4, 6, 16, 27, 37, 47, 56, 70, 85, 97,
+    110, 124, 138, 151, 164, 177, 189, 201, 213, 224, 226, 228,
+    230,
+};
+static const uint8_t icon_folder_data[] = {
+    0x97, 0x00, 0x97, 0x00, 0x97, 0x00, 0x82, 0x00, 0x00, 0x09, 0x83, 0x02, 0x00, 0x17, 0x8E, 0x00,
+    0x02, 0x00, 0x05, 0x10, 0x85, 0x01, 0x01, 0x0F, 0x05, 0x8C, 0x00, 0x01, 0x00, 0x0C, 0x87, 0x01,
+    0x01, 0x1F, 0x05, 0x8B, 0x00, 0x01, 0x00, 0x04, 0x8F, 0x01, 0x01, 0x08, 0x0B, 0x83, 0x00, 0x01,
+    0x00, 0x04, 0x90, 0x01, 0x00, 0x20, 0x83, 0x00, 0x01, 0x00, 0x04, 0x84, 0x01, 0x01, 0x0D, 0x0A,
+    0x89, 0x03, 0x00, 0x16, 0x83, 0x00, 0x01, 0x00, 0x04, 0x83, 0x01, 0x02, 0x0D, 0x07, 0x13, 0x8B,
+    0x01, 0x02, 0x11, 0x15, 0x00, 0x01, 0x00, 0x04, 0x83, 0x01, 0x00, 0x03, 0x8E, 0x01, 0x01, 0x06,
+    0x00, 0x01, 0x00, 0x04, 0x82, 0x01, 0x01, 0x21, 0x19, 0x8E, 0x01, 0x01, 0x05, 0x00, 0x01, 0x00,
+    0x04, 0x82, 0x01, 0x01, 0x1B, 0x0E, 0x8D, 0x01, 0x02, 0x0F, 0x00, 0x00, 0x01, 0x00, 0x04, 0x82,
+    0x01, 0x01, 0x09, 0x12, 0x8D, 0x01, 0x02, 0x07, 0x00, 0x00, 0x05, 0x00, 0x04, 0x01, 0x01, 0x08,
+    0x0B, 0x8E, 0x01, 0x02, 0x03, 0x00, 0x00, 0x05, 0x00, 0x04, 0x01, 0x01, 0x1E, 0x1C, 0x8D, 0x01,
+    0x00, 0x11, 0x82, 0x00, 0x05, 0x00, 0x04, 0x01, 0x01, 0x0C, 0x10, 0x8D, 0x01, 0x00, 0x1D, 0x82,
+    0x00, 0x04, 0x00, 0x04, 0x01, 0x13, 0x03, 0x8E, 0x01, 0x00, 0x06, 0x82, 0x00, 0x04, 0x00, 0x06,
+    0x01, 0x0E, 0x07, 0x8D, 0x01, 0x00, 0x12, 0x83, 0x00, 0x81, 0x00, 0x02, 0x02, 0x18, 0x08, 0x8D,
+    0x01, 0x00, 0x1A, 0x83, 0x00, 0x81, 0x00, 0x01, 0x05, 0x0A, 0x8D, 0x02, 0x00, 0x14, 0x84, 0x00,
+    0x97, 0x00, 0x97, 0x00, 0x97, 0x00,
+};
+const asset_image_t icon_folder = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 34,
+    .palette = icon_folder_palette,
+    .rows = icon_folder_rows,
+    .data = icon_folder_data,
+};
+
+// analyzer_main: 24x24, 1152 -> 472 bytes
+static const uint16_t analyzer_main_palette[] = {
+    0x0000, 0x895F, 0x60F6, 0x0823, 0x40AF, 0x6919, 0x0802, 0x1024, 0x1846, 0x815E, 0x286A, 0x50D3,
+    0x711A, 0x813D, 0x0001, 0x308C, 0x2047, 0x2048, 0x6918, 0x793C, 0x408E, 0x48B0, 0x48B1, 0x50D2,
+    0x58D4, 0x68F7, 0x713B, 0x793B, 0x895E, 0x0822, 0x1025, 0x58F4, 0x58F5, 0x7119,
+};
+static const uint16_t analyzer_main_rows[] = {
+    0, 2, 4, 15, 27, 44, 63, 82, 102, 122, 143, 164,
+    185, 205, 224, 242, 258, 276, 293, 304, 314, 323, 330, 332,
+    334,
+};
+static const uint8_t analyzer_main_data[] = {
+    0x97, 0x00, 0x97, 0x00, 0x86, 0x00, 0x05, 0x08, 0x14, 0x17, 0x16, 0x0F, 0x03, 0x8A, 0x00, 0x84,
+    0x00, 0x01, 0x08, 0x12, 0x85, 0x01, 0x01, 0x0B, 0x06, 0x88, 0x00, 0x83, 0x00, 0x0B, 0x0A, 0x1C,
+    0x01, 0x09, 0x18, 0x04, 0x15, 0x19, 0x01, 0x01, 0x1B, 0x07, 0x87, 0x00, 0x82, 0x00, 0x0D, 0x08,
+    0x1C, 0x01, 0x20, 0x06, 0x00, 0x0A, 0x10, 0x00, 0x08, 0x1A, 0x01, 0x0C, 0x0E, 0x86, 0x00, 0x82,
+    0x00, 0x02, 0x12, 0x01, 0x1F, 0x82, 0x00, 0x07, 0x01, 0x02, 0x00, 0x00, 0x06, 0x13, 0x01, 0x04,
+    0x86, 0x00, 0x81, 0x00, 0x08, 0x08, 0x01, 0x09, 0x06, 0x07, 0x03, 0x00, 0x01, 0x02, 0x82, 0x00,
+    0x02, 0x0A, 0x01, 0x13, 0x86, 0x00, 0x81, 0x00, 0x08, 0x14, 0x01, 0x18, 0x00, 0x0D, 0x05, 0x00,
+    0x01, 0x02, 0x83, 0x00, 0x02, 0x09, 0x01, 0x07, 0x85, 0x00, 0x81, 0x00, 0x0F, 0x17, 0x01, 0x04,
+    0x00, 0x0D, 0x05, 0x00, 0x01, 0x02, 0x00, 0x11, 0x1E, 0x00, 0x21, 0x01, 0x11, 0x85, 0x00, 0x81,
+    0x00, 0x0F, 0x16, 0x01, 0x15, 0x00, 0x0D, 0x05, 0x00, 0x01, 0x02, 0x03, 0x01, 0x0B, 0x00, 0x0C,
+    0x01, 0x10, 0x85, 0x00, 0x81, 0x00, 0x0F, 0x0F, 0x01, 0x19, 0x00, 0x0D, 0x05, 0x00, 0x01, 0x02,
+    0x03, 0x01, 0x0B, 0x06, 0x01, 0x01, 0x1D, 0x85, 0x00, 0x81, 0x00, 0x0E, 0x03, 0x01, 0x01, 0x08,
+    0x0D, 0x05, 0x00, 0x01, 0x02, 0x03, 0x01, 0x0B, 0x04, 0x01, 0x12, 0x86, 0x00, 0x82, 0x00, 0x0D,
+    0x0B, 0x01, 0x1A, 0x09, 0x05, 0x00, 0x01, 0x02, 0x03, 0x01, 0x0C, 0x01, 0x01, 0x0A, 0x86, 0x00,
+    0x82, 0x00, 0x08, 0x06, 0x1B, 0x01, 0x01, 0x0C, 0x0E, 0x01, 0x02, 0x07, 0x83, 0x01, 0x00, 0x02,
+    0x86, 0x00, 0x83, 0x00, 0x06, 0x07, 0x0C, 0x01, 0x01, 0x09, 0x01, 0x09, 0x85, 0x01, 0x00, 0x02,
+    0x85, 0x00, 0x84, 0x00, 0x02, 0x0E, 0x04, 0x13, 0x83, 0x01, 0x02, 0x05, 0x0A, 0x02, 0x82, 0x01,
+    0x00, 0x02, 0x84, 0x00, 0x87, 0x00, 0x03, 0x07, 0x11, 0x10, 0x03, 0x82, 0x00, 0x00, 0x02, 0x82,
+    0x01, 0x00, 0x02, 0x83, 0x00, 0x8F, 0x00, 0x00, 0x02, 0x82, 0x01, 0x03, 0x02, 0x0E, 0x00, 0x00,
+    0x90, 0x00, 0x00, 0x02, 0x82, 0x01, 0x02, 0x04, 0x00, 0x00, 0x91, 0x00, 0x05, 0x02, 0x01, 0x01,
+    0x0F, 0x00, 0x00, 0x92, 0x00, 0x01, 0x04, 0x0F, 0x82, 0x00, 0x97, 0x00, 0x97, 0x00,
+};
+const asset_image_t analyzer_main = {
+    .width = 24,
+    .height = 24,
+    .format = ASSET_FMT_PAL_RLE,
+    .palette_size = 34,
+    .palette = analyzer_main_palette,
+    .rows = analyzer_main_rows,
+    .data = analyzer_main_data,
+};
+
+// octo_ant: 200x179, 4475 -> 2435 bytes
+static const uint16_t octo_ant_rows[] = {
+    0, 1, 4, 7, 10, 13, 16, 19, 22, 25, 28, 31,
+    34, 37, 40, 43, 46, 49, 54, 59, 64, 69, 74, 79,
+    84, 89, 94, 99, 104, 109, 116, 125, 134, 145, 154, 163,
+    174, 185, 198, 211, 224, 237, 250, 265, 282, 299, 316, 333,
+    350, 369, 386, 403, 416, 431, 448, 465, 480, 493, 506, 519,
+    530, 541, 552, 561, 572, 583, 596, 609, 622, 635, 648, 661,
+    676, 691, 706, 721, 734, 747, 758, 769, 782, 793, 810, 827,
+    844, 861, 882, 905, 924, 941, 958, 975, 988, 1001, 1014, 1029,
+    1044, 1059, 1074, 1087, 1100, 1113, 1130, 1147, 1162, 1179, 1198, 1219,
+    1240, 1263, 1280, 1297, 1314, 1331, 1350, 1371, 1388, 1405, 1420, 1437,
+    1458, 1477, 1494, 1509, 1524, 1539, 1554, 1571, 1588, 1603, 1618, 1635,
+    1652, 1669, 1686, 1701, 1716, 1731, 1746, 1761, 1776, 1789, 1804, 1815,
+    1826, 1839, 1850, 1863, 1876, 1887, 1896, 1905, 1916, 1927, 1938, 1949,
+    1960, 1969, 1978, 1985, 1992, 1999, 2006, 2013, 2020, 2023, 2026, 2029,
+    2032, 2035, 2038, 2041, 2044, 2047, 2050, 2051, 2052, 2053, 2054, 2055,
+};
+static const uint8_t octo_ant_data[] = {
+    0xC8, 0x9A, 0x02, 0x2C, 0x99, 0x05, 0x2A, 0x99, 0x06, 0x29, 0x99, 0x07, 0x28, 0x9A, 0x07, 0x27,
+    0x9B, 0x07, 0x26, 0x9C, 0x06, 0x26, 0x9D, 0x06, 0x25, 0x9E, 0x06, 0x24, 0x9E, 0x07, 0x23, 0x9F,
+    0x06, 0x23, 0xA0, 0x06, 0x22, 0xA1, 0x06, 0x21, 0xA2, 0x06, 0x20, 0xA2, 0x06, 0x20, 0xA3, 0x06,
+    0x1F, 0x92, 0x05, 0x0D, 0x05, 0x1F, 0x92, 0x06, 0x0C, 0x06, 0x1E, 0x92, 0x06, 0x0D, 0x06, 0x1D,
+    0x93, 0x06, 0x0C, 0x06, 0x1D, 0x94, 0x06, 0x0C, 0x06, 0x1C, 0x95, 0x06, 0x0C, 0x05, 0x1C, 0x95,
+    0x07, 0x0B, 0x06, 0x1B, 0x96, 0x06, 0x0C, 0x05, 0x1B, 0x97, 0x06, 0x0B, 0x05, 0x1B, 0x98, 0x06,
+    0x0A, 0x06, 0x1A, 0x99, 0x05, 0x0B, 0x05, 0x1A, 0x99, 0x06, 0x0A, 0x06, 0x19, 0x8B, 0x04, 0x0B,
+    0x05, 0x0B, 0x05, 0x19, 0x5A, 0x09, 0x28, 0x05, 0x0A, 0x06, 0x0A, 0x05, 0x19, 0x52, 0x17, 0x22,
+    0x06, 0x0A, 0x05, 0x0A, 0x06, 0x18, 0x49, 0x04, 0x01, 0x1E, 0x1F, 0x07, 0x09, 0x06, 0x0A, 0x05,
+    0x18, 0x46, 0x29, 0x1D, 0x07, 0x09, 0x05, 0x0A, 0x05, 0x18, 0x45, 0x2C, 0x1C, 0x06, 0x09, 0x05,
+    0x0A, 0x05, 0x18, 0x43, 0x13, 0x10, 0x0D, 0x1B, 0x06, 0x08, 0x06, 0x0A, 0x05, 0x17, 0x42, 0x0F,
+    0x19, 0x0A, 0x1B, 0x05, 0x09, 0x05, 0x0A, 0x05, 0x17, 0x42, 0x07, 0x03, 0x05, 0x1B, 0x0E, 0x15,
+    0x06, 0x08, 0x05, 0x0A, 0x05, 0x17, 0x41, 0x06, 0x05, 0x06, 0x1D, 0x0E, 0x13, 0x05, 0x08, 0x05,
+    0x0A, 0x05, 0x17, 0x40, 0x08, 0x05, 0x05, 0x1F, 0x0D, 0x12, 0x06, 0x08, 0x05, 0x09, 0x06, 0x16,
+    0x3F, 0x09, 0x06, 0x05, 0x1F, 0x0D, 0x12, 0x05, 0x08, 0x05, 0x0A, 0x05, 0x16, 0x3E, 0x0B, 0x05,
+    0x05, 0x21, 0x0C, 0x11, 0x06, 0x07, 0x05, 0x0A, 0x05, 0x16, 0x3D, 0x0D, 0x05, 0x05, 0x20, 0x05,
+    0x01, 0x06, 0x12, 0x05, 0x07, 0x05, 0x0A, 0x05, 0x16, 0x3C, 0x06, 0x03, 0x05, 0x05, 0x05, 0x20,
+    0x05, 0x03, 0x05, 0x11, 0x05, 0x07, 0x05, 0x0A, 0x05, 0x16, 0x3B, 0x06, 0x04, 0x06, 0x05, 0x04,
+    0x20, 0x05, 0x03, 0x05, 0x11, 0x05, 0x07, 0x05, 0x0A, 0x05, 0x16, 0x3A, 0x06, 0x06, 0x05, 0x05,
+    0x05, 0x1F, 0x05, 0x03, 0x05, 0x11, 0x05, 0x07, 0x05, 0x0A, 0x05, 0x16, 0x39, 0x06, 0x08, 0x05,
+    0x04, 0x05, 0x1F, 0x05, 0x03, 0x05, 0x11, 0x05, 0x07, 0x05, 0x0A, 0x05, 0x16, 0x38, 0x06, 0x09,
+    0x05, 0x05, 0x04, 0x1F, 0x04, 0x04, 0x05, 0x12, 0x05, 0x07, 0x04, 0x0A, 0x05, 0x16, 0x38, 0x05,
+    0x0B, 0x05, 0x03, 0x05, 0x0F, 0x05, 0x0A, 0x05, 0x03, 0x07, 0x11, 0x05, 0x06, 0x05, 0x0A, 0x05,
+    0x16, 0x37, 0x06, 0x0B, 0x0D, 0x0D, 0x0A, 0x07, 0x05, 0x03, 0x07, 0x11, 0x04, 0x07, 0x05, 0x0A,
+    0x05, 0x16, 0x36, 0x06, 0x0D, 0x0C, 0x0C, 0x0C, 0x06, 0x06, 0x01, 0x09, 0x11, 0x02, 0x08, 0x05,
+    0x0A, 0x05, 0x16, 0x36, 0x05, 0x0E, 0x0B, 0x0C, 0x0E, 0x05, 0x11, 0x1A, 0x05, 0x0A, 0x05, 0x16,
+    0x35, 0x06, 0x0F, 0x08, 0x0D, 0x0F, 0x06, 0x0A, 0x01, 0x05, 0x1A, 0x05, 0x0A, 0x05, 0x16, 0x35,
+    0x05, 0x11, 0x04, 0x10, 0x05, 0x06, 0x05, 0x06, 0x09, 0x02, 0x05, 0x19, 0x05, 0x0A, 0x05, 0x16,
+    0x34, 0x05, 0x26, 0x04, 0x03, 0x03, 0x01, 0x05, 0x08, 0x06, 0x03, 0x05, 0x19, 0x05, 0x0A, 0x05,
+    0x16, 0x34, 0x05, 0x26, 0x04, 0x02, 0x0A, 0x0B, 0x01, 0x06, 0x05, 0x19, 0x03, 0x0B, 0x05, 0x16,
+    0x33, 0x05, 0x27, 0x04, 0x01, 0x06, 0x01, 0x04, 0x12, 0x05, 0x27, 0x05, 0x16, 0x33, 0x05, 0x27,
+    0x04, 0x01, 0x06, 0x01, 0x04, 0x13, 0x05, 0x26, 0x05, 0x16, 0x33, 0x05, 0x27, 0x04, 0x01, 0x06,
+    0x01, 0x05, 0x12, 0x05, 0x27, 0x03, 0x17, 0x32, 0x05, 0x28, 0x04, 0x01, 0x06, 0x01, 0x05, 0x13,
+    0x05, 0x40, 0x32, 0x05, 0x28, 0x04, 0x01, 0x06, 0x01, 0x05, 0x13, 0x05, 0x40, 0x32, 0x04, 0x29,
+    0x04, 0x01, 0x06, 0x01, 0x05, 0x14, 0x04, 0x40, 0x31, 0x05, 0x29, 0x04, 0x01, 0x0C, 0x14, 0x05,
+    0x3F, 0x31, 0x05, 0x29, 0x04, 0x01, 0x07, 0x01, 0x04, 0x14, 0x05, 0x3F, 0x31, 0x05, 0x04, 0x02,
+    0x23, 0x0C, 0x01, 0x04, 0x15, 0x04, 0x3F, 0x31, 0x04, 0x04, 0x06, 0x20, 0x05, 0x01, 0x06, 0x01,
+    0x04, 0x15, 0x05, 0x3E, 0x30, 0x05, 0x03, 0x09, 0x1E, 0x05, 0x01, 0x06, 0x01, 0x04, 0x15, 0x05,
+    0x3E, 0x30, 0x05, 0x02, 0x0A, 0x1E, 0x05, 0x01, 0x05, 0x01, 0x05, 0x15, 0x05, 0x3E, 0x30, 0x05,
+    0x02, 0x0B, 0x1D, 0x05, 0x02, 0x03, 0x02, 0x05, 0x15, 0x05, 0x3E, 0x30, 0x04, 0x03, 0x05, 0x02,
+    0x05, 0x1D, 0x04, 0x07, 0x05, 0x16, 0x04, 0x3E, 0x30, 0x04, 0x03, 0x04, 0x03, 0x05, 0x1D, 0x05,
+    0x05, 0x05, 0x17, 0x04, 0x3E, 0x30, 0x04, 0x03, 0x04, 0x04, 0x04, 0x1D, 0x05, 0x05, 0x05, 0x17,
+    0x04, 0x38, 0x03, 0x03, 0x2F, 0x05, 0x02, 0x05, 0x04, 0x05, 0x1D, 0x05, 0x04, 0x04, 0x18, 0x05,
+    0x36, 0x05, 0x02, 0x2F, 0x05, 0x02, 0x05, 0x04, 0x05, 0x1D, 0x05, 0x03, 0x05, 0x18, 0x05, 0x33,
+    0x08, 0x02, 0x2F, 0x05, 0x02, 0x05, 0x05, 0x04, 0x1E, 0x05, 0x01, 0x06, 0x18, 0x05, 0x2E, 0x0D,
+    0x02, 0x2F, 0x05, 0x01, 0x05, 0x06, 0x04, 0x1E, 0x0B, 0x19, 0x05, 0x27, 0x14, 0x02, 0x2F, 0x05,
+    0x01, 0x05, 0x06, 0x05, 0x1E, 0x0A, 0x19, 0x05, 0x21, 0x1A, 0x02, 0x2F, 0x0A, 0x07, 0x05, 0x1E,
+    0x09, 0x1A, 0x05, 0x1D, 0x1E, 0x02, 0x2F, 0x0A, 0x07, 0x05, 0x1F, 0x07, 0x1B, 0x05, 0x1B, 0x20,
+    0x02, 0x2F, 0x09, 0x08, 0x05, 0x20, 0x05, 0x1C, 0x05, 0x19, 0x12, 0x03, 0x0D, 0x02, 0x2F, 0x08,
+    0x09, 0x05, 0x41, 0x04, 0x18, 0x0D, 0x04, 0x12, 0x03, 0x2F, 0x07, 0x0A, 0x05, 0x01, 0x05, 0x33,
+    0x05, 0x03, 0x04, 0x17, 0x0A, 0x04, 0x10, 0x01, 0x05, 0x03, 0x2E, 0x07, 0x0B, 0x05, 0x01, 0x06,
+    0x31, 0x07, 0x02, 0x04, 0x15, 0x09, 0x05, 0x11, 0x01, 0x05, 0x04, 0x2D, 0x07, 0x0C, 0x05, 0x01,
+    0x07, 0x2F, 0x08, 0x02, 0x04, 0x14, 0x08, 0x05, 0x10, 0x02, 0x07, 0x04, 0x2C, 0x07, 0x0D, 0x04,
+    0x02, 0x09, 0x2B, 0x09, 0x02, 0x05, 0x13, 0x07, 0x05, 0x0D, 0x05, 0x08, 0x05, 0x2A, 0x08, 0x0E,
+    0x04, 0x03, 0x0A, 0x0D, 0x03, 0x08, 0x02, 0x0D, 0x0A, 0x03, 0x05, 0x12, 0x07, 0x05, 0x0D, 0x03,
+    0x0A, 0x06, 0x29, 0x07, 0x10, 0x04, 0x04, 0x0D, 0x05, 0x07, 0x08, 0x06, 0x06, 0x0C, 0x04, 0x05,
+    0x12, 0x06, 0x04, 0x09, 0x01, 0x05, 0x01, 0x0B, 0x07, 0x27, 0x08, 0x10, 0x05, 0x05, 0x17, 0x09,
+    0x17, 0x05, 0x04, 0x12, 0x06, 0x04, 0x08, 0x03, 0x03, 0x02, 0x0A, 0x09, 0x26, 0x08, 0x11, 0x05,
+    0x07, 0x13, 0x0E, 0x13, 0x06, 0x04, 0x11, 0x06, 0x04, 0x07, 0x08, 0x0A, 0x0B, 0x25, 0x07, 0x13,
+    0x04, 0x0A, 0x0E, 0x14, 0x0D, 0x08, 0x05, 0x11, 0x05, 0x04, 0x07, 0x08, 0x09, 0x0D, 0x23, 0x08,
+    0x13, 0x05, 0x0F, 0x03, 0x1F, 0x04, 0x0C, 0x05, 0x10, 0x05, 0x04, 0x06, 0x09, 0x07, 0x10, 0x22,
+    0x08, 0x14, 0x05, 0x41, 0x04, 0x11, 0x05, 0x04, 0x09, 0x05, 0x07, 0x11, 0x20, 0x08, 0x16, 0x04,
+    0x41, 0x05, 0x10, 0x05, 0x04, 0x0A, 0x02, 0x08, 0x13, 0x1F, 0x08, 0x16, 0x05, 0x41, 0x05, 0x10,
+    0x05, 0x03, 0x0B, 0x01, 0x08, 0x14, 0x1D, 0x08, 0x18, 0x05, 0x41, 0x05, 0x0F, 0x05, 0x04, 0x05,
+    0x01, 0x04, 0x02, 0x08, 0x14, 0x1C, 0x08, 0x18, 0x05, 0x41, 0x05, 0x10, 0x05, 0x03, 0x05, 0x02,
+    0x04, 0x03, 0x06, 0x15, 0x1B, 0x07, 0x1A, 0x05, 0x41, 0x05, 0x10, 0x04, 0x04, 0x05, 0x02, 0x04,
+    0x03, 0x05, 0x16, 0x19, 0x08, 0x1A, 0x05, 0x42, 0x05, 0x0F, 0x05, 0x04, 0x04, 0x04, 0x02, 0x04,
+    0x05, 0x16, 0x18, 0x08, 0x1B, 0x05, 0x41, 0x05, 0x10, 0x05, 0x03, 0x05, 0x09, 0x05, 0x17, 0x17,
+    0x07, 0x1C, 0x05, 0x42, 0x05, 0x10, 0x05, 0x03, 0x05, 0x09, 0x05, 0x17, 0x15, 0x08, 0x1D, 0x05,
+    0x41, 0x05, 0x11, 0x04, 0x04, 0x04, 0x0A, 0x04, 0x18, 0x14, 0x07, 0x01, 0x04, 0x19, 0x05, 0x42,
+    0x05, 0x10, 0x05, 0x03, 0x05, 0x02, 0x02, 0x05, 0x05, 0x18, 0x13, 0x0E, 0x17, 0x05, 0x22, 0x0A,
+    0x17, 0x04, 0x11, 0x05, 0x03, 0x05, 0x01, 0x04, 0x02, 0x07, 0x18, 0x12, 0x11, 0x15, 0x05, 0x1F,
+    0x0F, 0x14, 0x05, 0x11, 0x05, 0x03, 0x0A, 0x01, 0x08, 0x18, 0x11, 0x13, 0x13, 0x05, 0x1E, 0x12,
+    0x13, 0x05, 0x11, 0x05, 0x03, 0x04, 0x01, 0x05, 0x01, 0x07, 0x19, 0x10, 0x07, 0x01, 0x0D, 0x11,
+    0x05, 0x1E, 0x14, 0x11, 0x05, 0x12, 0x05, 0x03, 0x04, 0x01, 0x05, 0x01, 0x07, 0x19, 0x0F, 0x0E,
+    0x03, 0x06, 0x10, 0x05, 0x1E, 0x08, 0x06, 0x06, 0x11, 0x05, 0x12, 0x05, 0x03, 0x04, 0x01, 0x05,
+    0x02, 0x06, 0x19, 0x0E, 0x0E, 0x05, 0x06, 0x0E, 0x05, 0x1F, 0x05, 0x0B, 0x04, 0x10, 0x05, 0x13,
+    0x04, 0x04, 0x04, 0x01, 0x05, 0x04, 0x04, 0x19, 0x0D, 0x06, 0x01, 0x07, 0x07, 0x05, 0x0D, 0x05,
+    0x21, 0x02, 0x0E, 0x03, 0x10, 0x05, 0x13, 0x04, 0x04, 0x04, 0x03, 0x02, 0x05, 0x04, 0x19, 0x0C,
+    0x06, 0x02, 0x06, 0x07, 0x06, 0x0C, 0x06, 0x44, 0x05, 0x13, 0x04, 0x04, 0x04, 0x0A, 0x04, 0x19,
+    0x0B, 0x06, 0x02, 0x06, 0x07, 0x06, 0x0D, 0x05, 0x44, 0x05, 0x14, 0x04, 0x04, 0x04, 0x0A, 0x05,
+    0x18, 0x0A, 0x06, 0x03, 0x05, 0x07, 0x07, 0x0C, 0x05, 0x45, 0x05, 0x14, 0x04, 0x04, 0x04, 0x0A,
+    0x05, 0x18, 0x09, 0x06, 0x04, 0x05, 0x06, 0x0A, 0x09, 0x05, 0x46, 0x04, 0x15, 0x04, 0x04, 0x05,
+    0x09, 0x05, 0x18, 0x09, 0x05, 0x05, 0x06, 0x05, 0x0B, 0x07, 0x06, 0x45, 0x05, 0x15, 0x05, 0x03,
+    0x05, 0x01, 0x03, 0x06, 0x04, 0x18, 0x08, 0x06, 0x06, 0x07, 0x02, 0x05, 0x01, 0x07, 0x05, 0x07,
+    0x45, 0x05, 0x15, 0x05, 0x03, 0x05, 0x01, 0x04, 0x03, 0x07, 0x17, 0x07, 0x06, 0x08, 0x0E, 0x01,
+    0x07, 0x03, 0x08, 0x45, 0x05, 0x15, 0x05, 0x03, 0x0A, 0x03, 0x08, 0x16, 0x07, 0x05, 0x0A, 0x0E,
+    0x02, 0x06, 0x01, 0x09, 0x45, 0x04, 0x16, 0x05, 0x03, 0x0A, 0x03, 0x08, 0x16, 0x06, 0x05, 0x0C,
+    0x0E, 0x02, 0x0F, 0x44, 0x05, 0x16, 0x05, 0x04, 0x09, 0x03, 0x09, 0x15, 0x06, 0x05, 0x0E, 0x0D,
+    0x02, 0x0E, 0x44, 0x05, 0x16, 0x05, 0x04, 0x0A, 0x03, 0x02, 0x01, 0x05, 0x15, 0x05, 0x05, 0x11,
+    0x02, 0x04, 0x06, 0x02, 0x08, 0x01, 0x04, 0x44, 0x05, 0x16, 0x05, 0x04, 0x04, 0x01, 0x05, 0x07,
+    0x05, 0x14, 0x05, 0x05, 0x18, 0x06, 0x02, 0x06, 0x02, 0x04, 0x44, 0x04, 0x18, 0x04, 0x04, 0x04,
+    0x02, 0x03, 0x08, 0x05, 0x14, 0x04, 0x05, 0x1A, 0x06, 0x01, 0x05, 0x03, 0x04, 0x43, 0x05, 0x18,
+    0x04, 0x04, 0x04, 0x0E, 0x05, 0x13, 0x04, 0x05, 0x1B, 0x0B, 0x03, 0x04, 0x43, 0x05, 0x18, 0x04,
+    0x04, 0x04, 0x0E, 0x05, 0x13, 0x04, 0x05, 0x1C, 0x09, 0x04, 0x04, 0x43, 0x05, 0x17, 0x05, 0x04,
+    0x04, 0x0E, 0x05, 0x13, 0x04, 0x04, 0x1E, 0x08, 0x04, 0x04, 0x43, 0x05, 0x17, 0x05, 0x04, 0x04,
+    0x0F, 0x04, 0x13, 0x03, 0x05, 0x1F, 0x06, 0x05, 0x04, 0x43, 0x05, 0x17, 0x05, 0x04, 0x04, 0x0F,
+    0x05, 0x12, 0x03, 0x05, 0x20, 0x05, 0x05, 0x04, 0x43, 0x04, 0x18, 0x04, 0x05, 0x04, 0x01, 0x03,
+    0x0B, 0x05, 0x12, 0x03, 0x05, 0x20, 0x05, 0x05, 0x04, 0x43, 0x04, 0x17, 0x05, 0x04, 0x05, 0x01,
+    0x04, 0x0A, 0x05, 0x12, 0x03, 0x04, 0x21, 0x04, 0x06, 0x04, 0x43, 0x04, 0x17, 0x05, 0x04, 0x0A,
+    0x06, 0x09, 0x12, 0x03, 0x04, 0x21, 0x04, 0x05, 0x05, 0x43, 0x04, 0x16, 0x05, 0x05, 0x09, 0x06,
+    0x0A, 0x12, 0x03, 0x04, 0x20, 0x05, 0x05, 0x05, 0x43, 0x04, 0x16, 0x05, 0x05, 0x04, 0x01, 0x05,
+    0x05, 0x0A, 0x12, 0x03, 0x04, 0x20, 0x05, 0x05, 0x05, 0x43, 0x04, 0x15, 0x05, 0x06, 0x04, 0x01,
+    0x05, 0x05, 0x0A, 0x12, 0x03, 0x04, 0x20, 0x05, 0x05, 0x04, 0x44, 0x05, 0x13, 0x06, 0x05, 0x05,
+    0x01, 0x05, 0x06, 0x09, 0x12, 0x03, 0x04, 0x20, 0x05, 0x05, 0x04, 0x44, 0x05, 0x12, 0x06, 0x06,
+    0x05, 0x02, 0x03, 0x07, 0x09, 0x12, 0x03, 0x04, 0x20, 0x05, 0x04, 0x05, 0x44, 0x05, 0x11, 0x06,
+    0x07, 0x05, 0x10, 0x05, 0x12, 0x03, 0x04, 0x20, 0x05, 0x04, 0x05, 0x45, 0x04, 0x10, 0x06, 0x07,
+    0x05, 0x11, 0x05, 0x12, 0x03, 0x04, 0x20, 0x05, 0x04, 0x05, 0x45, 0x05, 0x0E, 0x06, 0x08, 0x05,
+    0x11, 0x05, 0x12, 0x03, 0x04, 0x21, 0x04, 0x03, 0x05, 0x46, 0x05, 0x0C, 0x08, 0x07, 0x05, 0x12,
+    0x04, 0x13, 0x03, 0x04, 0x21, 0x04, 0x03, 0x05, 0x47, 0x05, 0x0A, 0x07, 0x09, 0x05, 0x12, 0x04,
+    0x13, 0x03, 0x04, 0x21, 0x05, 0x02, 0x05, 0x47, 0x06, 0x07, 0x08, 0x09, 0x05, 0x12, 0x05, 0x13,
+    0x03, 0x05, 0x20, 0x05, 0x01, 0x05, 0x49, 0x13, 0x0A, 0x05, 0x12, 0x05, 0x13, 0x03, 0x05, 0x21,
+    0x04, 0x01, 0x05, 0x4A, 0x11, 0x0A, 0x05, 0x01, 0x03, 0x0F, 0x04, 0x14, 0x03, 0x05, 0x21, 0x09,
+    0x4C, 0x0E, 0x0B, 0x0A, 0x0E, 0x05, 0x14, 0x04, 0x04, 0x21, 0x09, 0x4D, 0x0B, 0x0C, 0x0B, 0x0E,
+    0x05, 0x14, 0x04, 0x05, 0x21, 0x07, 0x50, 0x06, 0x0F, 0x05, 0x01, 0x05, 0x0E, 0x04, 0x15, 0x04,
+    0x05, 0x21, 0x07, 0x63, 0x07, 0x01, 0x06, 0x0C, 0x05, 0x15, 0x04, 0x05, 0x22, 0x05, 0x63, 0x07,
+    0x03, 0x05, 0x06, 0x03, 0x03, 0x05, 0x15, 0x05, 0x04, 0x23, 0x05, 0x61, 0x07, 0x05, 0x03, 0x06,
+    0x04, 0x02, 0x05, 0x16, 0x05, 0x05, 0x22, 0x06, 0x5E, 0x08, 0x0F, 0x05, 0x01, 0x05, 0x16, 0x05,
+    0x05, 0x23, 0x06, 0x5B, 0x09, 0x10, 0x0A, 0x17, 0x06, 0x05, 0x23, 0x06, 0x57, 0x0A, 0x12, 0x0A,
+    0x17, 0x06, 0x05, 0x24, 0x06, 0x50, 0x0F, 0x01, 0x02, 0x11, 0x08, 0x18, 0x07, 0x05, 0x24, 0x07,
+    0x4D, 0x0E, 0x01, 0x05, 0x12, 0x05, 0x19, 0x07, 0x05, 0x25, 0x07, 0x4C, 0x0C, 0x03, 0x05, 0x11,
+    0x06, 0x19, 0x07, 0x05, 0x26, 0x08, 0x4A, 0x0A, 0x04, 0x06, 0x0F, 0x07, 0x1A, 0x08, 0x05, 0x26,
+    0x08, 0x4B, 0x03, 0x09, 0x06, 0x0E, 0x07, 0x1B, 0x08, 0x06, 0x26, 0x09, 0x56, 0x04, 0x0E, 0x07,
+    0x1C, 0x09, 0x05, 0x28, 0x09, 0x55, 0x02, 0x0D, 0x08, 0x1D, 0x0A, 0x05, 0x28, 0x0A, 0x60, 0x09,
+    0x1E, 0x0A, 0x05, 0x2A, 0x0A, 0x5B, 0x0A, 0x20, 0x0B, 0x05, 0x2B, 0x0A, 0x58, 0x0A, 0x21, 0x0B,
+    0x06, 0x2C, 0x09, 0x56, 0x09, 0x23, 0x0C, 0x05, 0x2E, 0x07, 0x56, 0x07, 0x25, 0x0D, 0x05, 0x2F,
+    0x05, 0x57, 0x03, 0x28, 0x0D, 0x06, 0xB5, 0x0E, 0x05, 0xB5, 0x0F, 0x05, 0xB4, 0x0F, 0x06, 0xB3,
+    0x10, 0x06, 0xB2, 0x11, 0x06, 0xB1, 0x12, 0x06, 0xB0, 0x13, 0x05, 0xB0, 0x13, 0x05, 0xB0, 0x14,
+    0x03, 0xB1, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8,
+};
+const asset_image_t octo_ant = {
+    .width = 200,
+    .height = 179,
+    .format = ASSET_FMT_MONO_RUNS,
+    .palette_size = 0,
+    .palette = NULL,
+    .rows = octo_ant_rows,
+    .data = octo_ant_data,
+};
+
+// octo_ant1: 200x179, 4475 -> 2229 bytes
+static const uint16_t octo_ant1_rows[] = {
+    0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11,
+    12, 13, 14, 15, 16, 17, 18, 19, 20, 21, 22, 23,
+    24, 25, 26, 27, 28, 29, 30, 31, 34, 39, 42, 45,
+    50, 55, 62, 69, 76, 83, 90, 101, 112, 123, 134, 145,
+    156, 169, 180, 191, 200, 211, 224, 237, 248, 259, 270, 281,
+    292, 303, 314, 325, 336, 347, 360, 373, 386, 397, 410, 423,
+    438, 453, 468, 483, 498, 511, 524, 537, 550, 561, 578, 595,
+    612, 629, 648, 671, 690, 707, 724, 737, 750, 765, 780, 795,
+    810, 825, 838, 851, 864, 879, 896, 915, 932, 949, 968, 989,
+    1010, 1033, 1056, 1077, 1098, 1117, 1136, 1157, 1176, 1193, 1208, 1229,
+    1248, 1267, 1284, 1299, 1314, 1329, 1344, 1361, 1378, 1395, 1414, 1433,
+    1450, 1467, 1484, 1499, 1514, 1529, 1544, 1559, 1574, 1587, 1602, 1613,
+    1624, 1637, 1648, 1661, 1674, 1685, 1694, 1703, 1714, 1725, 1736, 1747,
+    1756, 1765, 1772, 1779, 1786, 1793, 1800, 1807, 1814, 1817, 1820, 1823,
+    1826, 1829, 1832, 1835, 1838, 1841, 1844, 1845, 1846, 1847, 1848, 1849,
+};
+static const uint8_t octo_ant1_data[] = {
+    0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8,
+    0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8, 0x53,
+    0x15, 0x60, 0x4A, 0x03, 0x02, 0x1C, 0x5D, 0x47, 0x27, 0x5A, 0x45, 0x2B, 0x58, 0x44, 0x10, 0x13,
+    0x0B, 0x56, 0x43, 0x0D, 0x1A, 0x0A, 0x54, 0x42, 0x06, 0x04, 0x05, 0x1C, 0x0D, 0x4E, 0x42, 0x05,
+    0x06, 0x04, 0x1E, 0x0D, 0x4C, 0x41, 0x06, 0x06, 0x05, 0x1F, 0x0D, 0x4A, 0x3F, 0x09, 0x06, 0x05,
+    0x20, 0x0C, 0x49, 0x3E, 0x0B, 0x05, 0x05, 0x21, 0x0C, 0x48, 0x3D, 0x06, 0x01, 0x05, 0x06, 0x04,
+    0x21, 0x05, 0x02, 0x05, 0x48, 0x3C, 0x06, 0x03, 0x05, 0x05, 0x05, 0x20, 0x05, 0x03, 0x04, 0x48,
+    0x3B, 0x06, 0x05, 0x05, 0x05, 0x04, 0x20, 0x05, 0x03, 0x05, 0x47, 0x3A, 0x06, 0x06, 0x05, 0x05,
+    0x04, 0x20, 0x04, 0x04, 0x05, 0x47, 0x3A, 0x05, 0x08, 0x05, 0x04, 0x05, 0x1F, 0x04, 0x04, 0x04,
+    0x48, 0x39, 0x05, 0x0A, 0x04, 0x05, 0x04, 0x1F, 0x04, 0x04, 0x05, 0x47, 0x38, 0x05, 0x0B, 0x05,
+    0x03, 0x05, 0x10, 0x03, 0x0B, 0x05, 0x04, 0x05, 0x47, 0x37, 0x05, 0x0D, 0x0C, 0x0E, 0x08, 0x08,
+    0x05, 0x03, 0x07, 0x46, 0x37, 0x05, 0x0D, 0x0B, 0x0D, 0x0C, 0x06, 0x06, 0x02, 0x08, 0x45, 0x36,
+    0x05, 0x0E, 0x0A, 0x0D, 0x0E, 0x05, 0x10, 0x45, 0x36, 0x04, 0x10, 0x07, 0x0F, 0x0E, 0x06, 0x0A,
+    0x01, 0x05, 0x44, 0x35, 0x05, 0x13, 0x01, 0x11, 0x05, 0x06, 0x04, 0x08, 0x08, 0x02, 0x05, 0x43,
+    0x35, 0x04, 0x26, 0x04, 0x03, 0x03, 0x01, 0x05, 0x08, 0x06, 0x04, 0x04, 0x43, 0x34, 0x05, 0x26,
+    0x04, 0x02, 0x05, 0x01, 0x04, 0x12, 0x05, 0x42, 0x34, 0x04, 0x27, 0x04, 0x02, 0x05, 0x01, 0x04,
+    0x13, 0x04, 0x42, 0x33, 0x05, 0x27, 0x04, 0x02, 0x05, 0x01, 0x04, 0x13, 0x05, 0x41, 0x33, 0x04,
+    0x28, 0x04, 0x02, 0x05, 0x01, 0x04, 0x14, 0x04, 0x41, 0x33, 0x04, 0x28, 0x04, 0x02, 0x05, 0x01,
+    0x05, 0x13, 0x05, 0x40, 0x32, 0x05, 0x28, 0x04, 0x02, 0x05, 0x01, 0x05, 0x14, 0x04, 0x40, 0x32,
+    0x04, 0x29, 0x04, 0x02, 0x05, 0x02, 0x04, 0x14, 0x04, 0x40, 0x32, 0x04, 0x29, 0x04, 0x02, 0x05,
+    0x02, 0x04, 0x14, 0x05, 0x3F, 0x31, 0x05, 0x29, 0x04, 0x02, 0x05, 0x02, 0x04, 0x15, 0x04, 0x3F,
+    0x31, 0x04, 0x2A, 0x04, 0x02, 0x05, 0x02, 0x04, 0x15, 0x04, 0x3F, 0x31, 0x04, 0x04, 0x06, 0x20,
+    0x04, 0x02, 0x05, 0x02, 0x04, 0x15, 0x04, 0x3F, 0x31, 0x04, 0x03, 0x08, 0x1F, 0x04, 0x02, 0x05,
+    0x02, 0x04, 0x15, 0x05, 0x3E, 0x30, 0x05, 0x03, 0x09, 0x1E, 0x05, 0x01, 0x05, 0x02, 0x04, 0x16,
+    0x04, 0x3E, 0x30, 0x04, 0x03, 0x0B, 0x1E, 0x04, 0x07, 0x05, 0x16, 0x04, 0x3E, 0x30, 0x04, 0x03,
+    0x04, 0x03, 0x04, 0x1E, 0x04, 0x07, 0x04, 0x17, 0x04, 0x3E, 0x30, 0x04, 0x03, 0x04, 0x03, 0x05,
+    0x1D, 0x05, 0x06, 0x04, 0x17, 0x04, 0x3E, 0x30, 0x04, 0x03, 0x04, 0x04, 0x04, 0x1E, 0x04, 0x05,
+    0x05, 0x17, 0x04, 0x38, 0x03, 0x03, 0x30, 0x04, 0x03, 0x04, 0x04, 0x04, 0x1E, 0x05, 0x04, 0x04,
+    0x18, 0x04, 0x37, 0x05, 0x02, 0x30, 0x04, 0x02, 0x05, 0x05, 0x04, 0x1E, 0x04, 0x03, 0x05, 0x18,
+    0x04, 0x34, 0x08, 0x02, 0x2F, 0x05, 0x02, 0x04, 0x06, 0x04, 0x1E, 0x05, 0x02, 0x04, 0x19, 0x04,
+    0x30, 0x0C, 0x02, 0x2F, 0x04, 0x02, 0x05, 0x06, 0x04, 0x1F, 0x04, 0x01, 0x05, 0x19, 0x04, 0x2A,
+    0x12, 0x02, 0x2F, 0x04, 0x02, 0x05, 0x06, 0x04, 0x1F, 0x09, 0x1A, 0x04, 0x23, 0x19, 0x02, 0x2F,
+    0x04, 0x01, 0x05, 0x08, 0x03, 0x20, 0x08, 0x1A, 0x04, 0x1F, 0x1D, 0x02, 0x2F, 0x09, 0x09, 0x04,
+    0x1F, 0x07, 0x1B, 0x04, 0x1D, 0x14, 0x01, 0x0A, 0x02, 0x2F, 0x09, 0x09, 0x04, 0x20, 0x04, 0x1D,
+    0x04, 0x1A, 0x11, 0x05, 0x0B, 0x03, 0x2F, 0x08, 0x0A, 0x04, 0x41, 0x04, 0x19, 0x0B, 0x05, 0x12,
+    0x03, 0x2F, 0x07, 0x0B, 0x04, 0x02, 0x04, 0x34, 0x04, 0x03, 0x04, 0x17, 0x09, 0x06, 0x0F, 0x01,
+    0x05, 0x03, 0x2F, 0x06, 0x0C, 0x04, 0x01, 0x06, 0x32, 0x05, 0x03, 0x04, 0x16, 0x08, 0x05, 0x10,
+    0x02, 0x05, 0x04, 0x2D, 0x07, 0x0C, 0x04, 0x02, 0x07, 0x2F, 0x07, 0x03, 0x04, 0x15, 0x07, 0x05,
+    0x0F, 0x04, 0x05, 0x05, 0x2C, 0x07, 0x0D, 0x04, 0x03, 0x08, 0x2C, 0x08, 0x03, 0x04, 0x14, 0x06,
+    0x05, 0x0B, 0x08, 0x07, 0x05, 0x2B, 0x06, 0x0F, 0x04, 0x03, 0x0A, 0x0E, 0x01, 0x19, 0x09, 0x03,
+    0x05, 0x13, 0x06, 0x05, 0x0D, 0x04, 0x09, 0x06, 0x29, 0x07, 0x10, 0x04, 0x04, 0x0C, 0x08, 0x04,
+    0x09, 0x05, 0x08, 0x0B, 0x04, 0x04, 0x13, 0x05, 0x06, 0x07, 0x02, 0x04, 0x03, 0x09, 0x08, 0x28,
+    0x07, 0x11, 0x04, 0x06, 0x15, 0x0B, 0x16, 0x05, 0x04, 0x12, 0x05, 0x05, 0x07, 0x05, 0x02, 0x02,
+    0x0A, 0x09, 0x26, 0x07, 0x12, 0x04, 0x08, 0x12, 0x0F, 0x12, 0x07, 0x04, 0x11, 0x05, 0x05, 0x07,
+    0x09, 0x09, 0x0B, 0x25, 0x07, 0x13, 0x04, 0x0B, 0x0C, 0x15, 0x0D, 0x08, 0x05, 0x11, 0x05, 0x05,
+    0x05, 0x09, 0x08, 0x0E, 0x24, 0x07, 0x14, 0x04, 0x41, 0x04, 0x11, 0x05, 0x05, 0x05, 0x09, 0x07,
+    0x10, 0x22, 0x07, 0x15, 0x04, 0x42, 0x04, 0x11, 0x04, 0x05, 0x09, 0x06, 0x05, 0x12, 0x21, 0x07,
+    0x16, 0x04, 0x42, 0x04, 0x10, 0x05, 0x04, 0x0A, 0x03, 0x01, 0x01, 0x05, 0x13, 0x1F, 0x07, 0x18,
+    0x04, 0x41, 0x05, 0x10, 0x04, 0x05, 0x04, 0x01, 0x05, 0x02, 0x07, 0x14, 0x1E, 0x07, 0x18, 0x04,
+    0x42, 0x04, 0x11, 0x04, 0x04, 0x05, 0x01, 0x04, 0x03, 0x06, 0x15, 0x1C, 0x07, 0x1A, 0x04, 0x42,
+    0x04, 0x10, 0x04, 0x05, 0x04, 0x02, 0x04, 0x03, 0x06, 0x15, 0x1B, 0x07, 0x1A, 0x04, 0x42, 0x05,
+    0x10, 0x04, 0x04, 0x05, 0x02, 0x04, 0x03, 0x05, 0x16, 0x1A, 0x07, 0x1B, 0x04, 0x42, 0x04, 0x11,
+    0x04, 0x04, 0x04, 0x0A, 0x04, 0x17, 0x18, 0x07, 0x1C, 0x04, 0x43, 0x04, 0x10, 0x05, 0x03, 0x05,
+    0x0A, 0x04, 0x17, 0x17, 0x07, 0x1C, 0x05, 0x42, 0x04, 0x11, 0x04, 0x04, 0x04, 0x0A, 0x05, 0x17,
+    0x16, 0x06, 0x1E, 0x04, 0x16, 0x05, 0x28, 0x04, 0x11, 0x04, 0x04, 0x04, 0x0A, 0x04, 0x18, 0x15,
+    0x06, 0x02, 0x02, 0x1A, 0x05, 0x15, 0x07, 0x26, 0x05, 0x11, 0x04, 0x04, 0x04, 0x0A, 0x04, 0x18,
+    0x13, 0x08, 0x01, 0x05, 0x18, 0x04, 0x15, 0x08, 0x26, 0x04, 0x12, 0x04, 0x03, 0x05, 0x01, 0x04,
+    0x02, 0x07, 0x18, 0x12, 0x10, 0x16, 0x04, 0x16, 0x04, 0x29, 0x05, 0x11, 0x05, 0x03, 0x04, 0x01,
+    0x05, 0x02, 0x06, 0x19, 0x11, 0x12, 0x14, 0x05, 0x16, 0x05, 0x28, 0x04, 0x12, 0x04, 0x04, 0x04,
+    0x01, 0x05, 0x01, 0x07, 0x19, 0x10, 0x06, 0x02, 0x0D, 0x12, 0x04, 0x18, 0x05, 0x27, 0x04, 0x12,
+    0x04, 0x04, 0x04, 0x01, 0x04, 0x03, 0x06, 0x19, 0x0F, 0x0E, 0x03, 0x06, 0x10, 0x05, 0x18, 0x07,
+    0x19, 0x02, 0x09, 0x05, 0x12, 0x04, 0x04, 0x04, 0x01, 0x05, 0x03, 0x05, 0x19, 0x0E, 0x0E, 0x05,
+    0x06, 0x0E, 0x05, 0x1A, 0x08, 0x15, 0x04, 0x09, 0x04, 0x13, 0x04, 0x04, 0x04, 0x02, 0x04, 0x04,
+    0x04, 0x19, 0x0D, 0x06, 0x01, 0x07, 0x07, 0x05, 0x0D, 0x05, 0x1B, 0x03, 0x01, 0x06, 0x12, 0x05,
+    0x08, 0x05, 0x13, 0x04, 0x04, 0x04, 0x0A, 0x04, 0x19, 0x0C, 0x06, 0x02, 0x06, 0x07, 0x05, 0x0E,
+    0x04, 0x1D, 0x03, 0x02, 0x07, 0x0C, 0x06, 0x0A, 0x04, 0x14, 0x04, 0x04, 0x04, 0x0A, 0x04, 0x19,
+    0x0B, 0x06, 0x02, 0x06, 0x08, 0x04, 0x0E, 0x05, 0x1E, 0x03, 0x03, 0x16, 0x0B, 0x04, 0x14, 0x04,
+    0x04, 0x04, 0x0A, 0x04, 0x19, 0x0B, 0x05, 0x03, 0x05, 0x08, 0x06, 0x0C, 0x05, 0x20, 0x02, 0x05,
+    0x12, 0x0C, 0x05, 0x14, 0x04, 0x04, 0x04, 0x0A, 0x04, 0x19, 0x0A, 0x05, 0x04, 0x05, 0x07, 0x08,
+    0x0A, 0x05, 0x2B, 0x0D, 0x0E, 0x04, 0x15, 0x04, 0x04, 0x04, 0x0B, 0x04, 0x18, 0x09, 0x05, 0x06,
+    0x05, 0x05, 0x0A, 0x08, 0x05, 0x47, 0x04, 0x15, 0x04, 0x04, 0x04, 0x03, 0x01, 0x07, 0x04, 0x18,
+    0x08, 0x05, 0x07, 0x06, 0x03, 0x05, 0x01, 0x07, 0x05, 0x06, 0x46, 0x05, 0x15, 0x04, 0x04, 0x05,
+    0x01, 0x03, 0x05, 0x06, 0x17, 0x08, 0x05, 0x08, 0x0D, 0x03, 0x06, 0x03, 0x07, 0x46, 0x04, 0x16,
+    0x04, 0x05, 0x04, 0x01, 0x04, 0x03, 0x07, 0x17, 0x07, 0x05, 0x0A, 0x0E, 0x02, 0x06, 0x02, 0x08,
+    0x45, 0x04, 0x16, 0x05, 0x04, 0x08, 0x04, 0x08, 0x16, 0x07, 0x04, 0x0D, 0x0D, 0x02, 0x0F, 0x45,
+    0x04, 0x16, 0x05, 0x04, 0x09, 0x03, 0x09, 0x15, 0x06, 0x05, 0x0E, 0x05, 0x02, 0x06, 0x02, 0x09,
+    0x01, 0x04, 0x44, 0x05, 0x17, 0x04, 0x04, 0x04, 0x01, 0x05, 0x06, 0x05, 0x15, 0x06, 0x04, 0x17,
+    0x06, 0x02, 0x07, 0x02, 0x04, 0x44, 0x04, 0x18, 0x04, 0x04, 0x04, 0x01, 0x05, 0x07, 0x05, 0x14,
+    0x05, 0x05, 0x18, 0x06, 0x02, 0x06, 0x02, 0x04, 0x44, 0x04, 0x18, 0x04, 0x04, 0x04, 0x02, 0x03,
+    0x09, 0x04, 0x14, 0x05, 0x04, 0x1A, 0x06, 0x02, 0x04, 0x03, 0x04, 0x44, 0x04, 0x18, 0x04, 0x04,
+    0x04, 0x0E, 0x04, 0x14, 0x04, 0x05, 0x1B, 0x0B, 0x03, 0x04, 0x44, 0x04, 0x18, 0x04, 0x04, 0x04,
+    0x0E, 0x05, 0x13, 0x04, 0x04, 0x1D, 0x09, 0x04, 0x04, 0x43, 0x05, 0x18, 0x04, 0x04, 0x04, 0x0F,
+    0x04, 0x13, 0x04, 0x04, 0x1E, 0x08, 0x04, 0x04, 0x43, 0x04, 0x18, 0x05, 0x04, 0x04, 0x0F, 0x04,
+    0x13, 0x04, 0x04, 0x1F, 0x06, 0x05, 0x04, 0x43, 0x04, 0x18, 0x04, 0x05, 0x04, 0x0F, 0x04, 0x13,
+    0x03, 0x05, 0x20, 0x05, 0x05, 0x04, 0x43, 0x04, 0x18, 0x04, 0x05, 0x04, 0x02, 0x01, 0x0C, 0x04,
+    0x13, 0x03, 0x04, 0x21, 0x05, 0x05, 0x04, 0x43, 0x04, 0x17, 0x05, 0x05, 0x04, 0x01, 0x03, 0x0B,
+    0x05, 0x12, 0x03, 0x04, 0x21, 0x04, 0x06, 0x04, 0x43, 0x04, 0x17, 0x04, 0x06, 0x08, 0x07, 0x03,
+    0x01, 0x05, 0x12, 0x03, 0x04, 0x21, 0x04, 0x06, 0x04, 0x43, 0x04, 0x16, 0x05, 0x05, 0x04, 0x01,
+    0x04, 0x07, 0x04, 0x01, 0x04, 0x12, 0x03, 0x04, 0x21, 0x04, 0x05, 0x05, 0x43, 0x04, 0x16, 0x05,
+    0x05, 0x04, 0x01, 0x05, 0x05, 0x05, 0x01, 0x04, 0x12, 0x03, 0x04, 0x21, 0x04, 0x05, 0x04, 0x44,
+    0x04, 0x15, 0x05, 0x06, 0x04, 0x01, 0x05, 0x05, 0x0A, 0x12, 0x03, 0x04, 0x21, 0x04, 0x05, 0x04,
+    0x44, 0x04, 0x14, 0x05, 0x07, 0x04, 0x02, 0x04, 0x06, 0x09, 0x12, 0x03, 0x04, 0x20, 0x05, 0x05,
+    0x04, 0x44, 0x04, 0x13, 0x06, 0x06, 0x05, 0x03, 0x02, 0x08, 0x08, 0x12, 0x03, 0x04, 0x21, 0x04,
+    0x05, 0x04, 0x45, 0x04, 0x11, 0x06, 0x07, 0x04, 0x11, 0x05, 0x12, 0x03, 0x04, 0x21, 0x04, 0x04,
+    0x05, 0x45, 0x04, 0x10, 0x06, 0x08, 0x04, 0x11, 0x04, 0x13, 0x03, 0x04, 0x21, 0x04, 0x04, 0x04,
+    0x46, 0x04, 0x0F, 0x06, 0x08, 0x05, 0x11, 0x04, 0x13, 0x03, 0x04, 0x21, 0x04, 0x04, 0x04, 0x46,
+    0x05, 0x0D, 0x06, 0x09, 0x04, 0x12, 0x04, 0x13, 0x03, 0x04, 0x21, 0x04, 0x03, 0x05, 0x47, 0x05,
+    0x0A, 0x07, 0x09, 0x05, 0x12, 0x04, 0x13, 0x03, 0x04, 0x21, 0x04, 0x03, 0x04, 0x48, 0x06, 0x07,
+    0x08, 0x0A, 0x04, 0x13, 0x04, 0x13, 0x03, 0x04, 0x21, 0x05, 0x01, 0x05, 0x49, 0x13, 0x0A, 0x05,
+    0x12, 0x04, 0x14, 0x03, 0x05, 0x21, 0x04, 0x01, 0x04, 0x4B, 0x10, 0x0B, 0x05, 0x01, 0x03, 0x0F,
+    0x04, 0x14, 0x04, 0x04, 0x21, 0x09, 0x4C, 0x0D, 0x0D, 0x09, 0x0F, 0x04, 0x14, 0x04, 0x04, 0x22,
+    0x08, 0x4D, 0x0A, 0x0E, 0x0A, 0x0E, 0x05, 0x14, 0x04, 0x04, 0x22, 0x07, 0x51, 0x03, 0x11, 0x05,
+    0x01, 0x05, 0x0E, 0x04, 0x15, 0x04, 0x05, 0x22, 0x05, 0x65, 0x05, 0x02, 0x05, 0x0D, 0x05, 0x15,
+    0x05, 0x04, 0x22, 0x05, 0x64, 0x05, 0x04, 0x04, 0x07, 0x02, 0x04, 0x04, 0x16, 0x05, 0x04, 0x23,
+    0x05, 0x61, 0x07, 0x06, 0x01, 0x07, 0x04, 0x02, 0x05, 0x16, 0x05, 0x05, 0x23, 0x05, 0x5F, 0x06,
+    0x10, 0x04, 0x02, 0x04, 0x17, 0x06, 0x04, 0x23, 0x06, 0x5C, 0x07, 0x11, 0x0A, 0x17, 0x06, 0x04,
+    0x24, 0x06, 0x58, 0x09, 0x12, 0x09, 0x18, 0x06, 0x05, 0x24, 0x06, 0x50, 0x0F, 0x01, 0x02, 0x11,
+    0x08, 0x18, 0x07, 0x04, 0x25, 0x06, 0x4E, 0x0E, 0x02, 0x04, 0x12, 0x05, 0x19, 0x07, 0x05, 0x25,
+    0x07, 0x4C, 0x0C, 0x03, 0x05, 0x11, 0x05, 0x1A, 0x08, 0x04, 0x26, 0x07, 0x4B, 0x09, 0x06, 0x05,
+    0x10, 0x05, 0x1B, 0x08, 0x05, 0x27, 0x07, 0x58, 0x04, 0x10, 0x05, 0x1C, 0x09, 0x04, 0x28, 0x07,
+    0x57, 0x04, 0x0E, 0x07, 0x1C, 0x09, 0x05, 0x28, 0x08, 0x65, 0x07, 0x1E, 0x0A, 0x04, 0x2A, 0x08,
+    0x61, 0x08, 0x1F, 0x0A, 0x05, 0x2B, 0x09, 0x5C, 0x09, 0x20, 0x0B, 0x05, 0x2B, 0x0A, 0x58, 0x09,
+    0x22, 0x0C, 0x04, 0x2D, 0x09, 0x56, 0x09, 0x23, 0x0C, 0x05, 0x2E, 0x07, 0x57, 0x05, 0x26, 0x0D,
+    0x05, 0x30, 0x03, 0x58, 0x03, 0x28, 0x0D, 0x05, 0xB6, 0x0E, 0x05, 0xB5, 0x0F, 0x05, 0xB4, 0x10,
+    0x05, 0xB3, 0x10, 0x06, 0xB2, 0x11, 0x05, 0xB2, 0x12, 0x05, 0xB1, 0x13, 0x05, 0xB0, 0x14, 0x04,
+    0xB0, 0x15, 0x02, 0xB1, 0xC8, 0xC8, 0xC8, 0xC8, 0xC8,
+};
+const asset_image_t octo_ant1 = {
+    .width = 200,
+    .height = 179,
+    .format = ASSET_FMT_MONO_RUNS,
+    .palette_size = 0,
+    .palette = NULL,
+    .rows = octo_ant1_rows,
+    .data = octo_ant1_data,
+};
+
+// home_wifi: 19x16, 48 -> 68 bytes
+static const uint8_t home_wifi_data[] = {
+    0x01, 0xF0, 0x00, 0x07, 0xFC, 0x00, 0x1E, 0x0F, 0x00, 0x39, 0xF3, 0x80, 0x77, 0xFD, 0xC0, 0xEF,
+    0x1E, 0xE0, 0x5C, 0xE7, 0x40, 0x3B, 0xFB, 0x80, 0x17, 0x1D, 0x00, 0x0E, 0xEE, 0x00, 0x05, 0xF4,
+    0x00, 0x03, 0xB8, 0x00, 0x01, 0x50, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+};
+const asset_image_t home_wifi = {
+    .width = 19,
+    .height = 16,
+    .format = ASSET_FMT_MONO_BITS,
+    .palette_size = 0,
+    .palette = NULL,
+    .rows = NULL,
+    .data = home_wifi_data,
+};
+
+// home_battery: 24x16, 48 -> 68 bytes
+static const uint8_t home_battery_data[] = {
+    0x00, 0x02, 0x00, 0x0F, 0xE4, 0xFE, 0x10, 0x0C, 0x01, 0x10, 0x08, 0x01, 0x70, 0x18, 0x01, 0x80,
+    0x30, 0x01, 0x80, 0x3F, 0x81, 0x80, 0x7F, 0x01, 0x80, 0x03, 0x01, 0x80, 0x06, 0x01, 0x70, 0x04,
+    0x01, 0x10, 0x0C, 0x01, 0x10, 0x08, 0x01, 0x0F, 0xD3, 0xFE, 0x00, 0x10, 0x00, 0x00, 0x00, 0x00,
+};
+const asset_image_t home_battery = {
+    .width = 24,
+    .height = 16,
+    .format = ASSET_FMT_MONO_BITS,
+    .palette_size = 0,
+    .palette = NULL,
+    .rows = NULL,
+    .data = home_battery_data,
+};
+
+// home_sd: 11x8, 16 -> 36 bytes
+static const uint8_t home_sd_data[] = {
+    0xFF, 0xE0, 0xFF, 0x20, 0xFF, 0xE0, 0xFF, 0x20, 0xFF, 0xE0, 0xFF, 0x20, 0xFF, 0xE0, 0xE6, 0x00,
+};
+const asset_image_t home_sd = {
+    .width = 11,
+    .height = 8,
+    .format = ASSET_FMT_MONO_BITS,
+    .palette_size = 0,
+    .palette = NULL,
+    .rows = NULL,
+    .data = home_sd_data,
+};
+
+// home_mhz: 25x11, 44 -> 64 bytes
+static const uint8_t home_mhz_data[] = {
+    0xC3, 0x61, 0x80, 0x00, 0xE7, 0x61, 0x80, 0x00, 0xFF, 0x61, 0x80, 0x00, 0xFF, 0x61, 0xBF, 0x80,
+    0xDB, 0x7F, 0xBF, 0x80, 0xDB, 0x7F, 0x83, 0x00, 0xDB, 0x61, 0x86, 0x00, 0xC3, 0x61, 0x8C, 0x00,
+    0xC3, 0x61, 0x98, 0x00, 0xC3, 0x61, 0xBF, 0x80, 0xC3, 0x61, 0xBF, 0x80,
+};
+const asset_image_t home_mhz = {
+    .width = 25,
+    .height = 11,
+    .format = ASSET_FMT_MONO_BITS,
+    .palette_size = 0,
+    .palette = NULL,
+    .rows = NULL,
+    .data = home_mhz_data,
+};
+
+// home_octo: 240x210, 6300 -> 6320 bytes
+static const uint8_t home_octo_data[] = {
+    0x00, 0x00, 0x63, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x00, 0x61, 0x80, 0x03, 0x00, 0x03, 0x18, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x80, 0x00,
+    0x63, 0x00, 0x00, 0x06, 0x0C, 0x00, 0x00, 0x61, 0x80, 0x03, 0x00, 0x03, 0x18, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0xE0, 0x00, 0x63, 0x00,
+    0x00, 0x06, 0x0C, 0x00, 0x00, 0x61, 0x80, 0x03, 0x00, 0x03, 0x18, 0x00, 0x0F, 0xC0, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0xF8, 0x00, 0x63, 0x00, 0x00, 0x0E,
+    0x0C, 0x00, 0x00, 0x61, 0x80, 0x03, 0x00, 0x03, 0x18, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xC0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x7C, 0x00, 0x63, 0x00, 0x00, 0x0E, 0x1C, 0x00,
+    0x00, 0x61, 0x80, 0x03, 0x00, 0x03, 0x18, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x03, 0x03, 0x00, 0x1E, 0x00, 0x63, 0x00, 0x00, 0x0C, 0x1C, 0x00, 0x00, 0x61,
+    0x80, 0x07, 0x00, 0x03, 0x18, 0x00, 0x18, 0x1F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0xC0, 0x03, 0x03, 0x00, 0x0E, 0x00, 0x63, 0x00, 0x00, 0x1C, 0x18, 0x00, 0x00, 0x61, 0x80, 0x07,
+    0x00, 0x03, 0x18, 0x00, 0x38, 0x00, 0x00, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFE, 0x03,
+    0x03, 0x00, 0x07, 0x00, 0x63, 0x00, 0x00, 0x18, 0x18, 0x00, 0x00, 0x71, 0x80, 0x06, 0x00, 0x07,
+    0x38, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xFF, 0xFF, 0xFF, 0x83, 0x03, 0x00,
+    0x03, 0x80, 0x63, 0x00, 0x00, 0x38, 0x38, 0x00, 0x00, 0x71, 0x80, 0x06, 0x00, 0x07, 0x38, 0x00,
+    0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xBF, 0xC3, 0x03, 0x00, 0x01, 0x80,
+    0x63, 0x00, 0x00, 0x30, 0x38, 0x00, 0x00, 0x71, 0x80, 0x0E, 0x00, 0x07, 0x38, 0x00, 0x38, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF3, 0x03, 0x00, 0x01, 0xC0, 0x63, 0x00,
+    0x00, 0x70, 0x30, 0x00, 0x00, 0x71, 0x80, 0x0C, 0x00, 0x06, 0x30, 0x00, 0x39, 0xFF, 0xFF, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x7B, 0x03, 0x00, 0x00, 0xC0, 0x63, 0x00, 0x00, 0xE0,
+    0x70, 0x00, 0x00, 0x71, 0xC0, 0x0C, 0x00, 0x06, 0x30, 0x00, 0x39, 0xFF, 0xFF, 0xFF, 0xFF, 0xF8,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x3B, 0x03, 0x00, 0x00, 0xC0, 0x63, 0x00, 0x01, 0xC0, 0xE0, 0x00,
+    0x00, 0x71, 0xC0, 0x1C, 0x00, 0x06, 0x30, 0x00, 0x39, 0xDF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x00, 0x00, 0x07, 0x1B, 0x03, 0x00, 0x00, 0xE0, 0x63, 0x00, 0x07, 0x80, 0xE0, 0x00, 0x00, 0x31,
+    0xC0, 0x1C, 0x00, 0x06, 0x30, 0x00, 0x39, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x87, 0x1B, 0x03, 0x00, 0x00, 0xE0, 0x63, 0x00, 0x0F, 0x01, 0xC0, 0x00, 0x00, 0x30, 0xC0, 0x18,
+    0x00, 0x0E, 0x70, 0x00, 0x39, 0xC0, 0x00, 0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xFF, 0xC7, 0x1B,
+    0x03, 0x00, 0x00, 0x60, 0x63, 0x00, 0x3E, 0x03, 0x80, 0x00, 0x00, 0x30, 0xC0, 0x18, 0x00, 0x0C,
+    0x70, 0x00, 0x39, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xC7, 0x1B, 0x03, 0x00,
+    0x00, 0x60, 0x63, 0x00, 0x7C, 0x07, 0x00, 0x00, 0x00, 0x38, 0xC0, 0x38, 0x00, 0x0C, 0x60, 0x00,
+    0x39, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC7, 0x1B, 0x03, 0x00, 0x00, 0x70,
+    0x63, 0x01, 0xF0, 0x1E, 0x00, 0x00, 0x00, 0x38, 0xE0, 0x38, 0x00, 0x1C, 0x60, 0x00, 0x39, 0xC0,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC7, 0x1B, 0x03, 0x00, 0x00, 0x70, 0x63, 0x07,
+    0xE0, 0x3C, 0x00, 0x00, 0x00, 0x18, 0x60, 0x30, 0x00, 0x1C, 0xE0, 0x00, 0x39, 0xCF, 0xE7, 0xF8,
+    0x00, 0x00, 0x7C, 0x00, 0x00, 0x01, 0xC7, 0x1B, 0x03, 0x00, 0x00, 0x70, 0x63, 0x3F, 0x80, 0xF8,
+    0x00, 0x00, 0x00, 0x18, 0x70, 0x30, 0x00, 0x18, 0xE0, 0x00, 0x39, 0xC7, 0xE7, 0xFF, 0xF0, 0x01,
+    0xFF, 0x80, 0x00, 0x01, 0xC7, 0x1B, 0x83, 0x00, 0x00, 0x38, 0x63, 0xFE, 0x03, 0xF0, 0x00, 0x00,
+    0x00, 0x1C, 0x70, 0x30, 0x00, 0x38, 0xC0, 0x00, 0x39, 0xC7, 0xE7, 0xFF, 0xF8, 0x07, 0xFF, 0xC0,
+    0x00, 0x01, 0xC7, 0x1B, 0x83, 0x00, 0x00, 0x38, 0x6F, 0xF8, 0x0F, 0xC0, 0x00, 0x00, 0x00, 0x1C,
+    0x38, 0x30, 0x00, 0x71, 0xC0, 0x00, 0x39, 0xC0, 0x00, 0x07, 0xF0, 0x0F, 0x81, 0xE0, 0x7F, 0x01,
+    0xC7, 0x1B, 0x83, 0x00, 0x80, 0x1C, 0xFF, 0xC0, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x38, 0x70,
+    0x00, 0x71, 0xC0, 0x00, 0x39, 0xC0, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x70, 0x7F, 0xF1, 0xC7, 0x1B,
+    0x87, 0x00, 0xFC, 0x7F, 0xFF, 0x07, 0xFC, 0x00, 0x03, 0xFF, 0xE0, 0x0E, 0x1C, 0x70, 0x00, 0xE3,
+    0x80, 0x00, 0x39, 0xC0, 0x00, 0x00, 0x00, 0x38, 0x00, 0x38, 0x7F, 0xF1, 0xC7, 0x19, 0x87, 0x00,
+    0xFF, 0xFF, 0xFB, 0xFF, 0xF0, 0x01, 0xFF, 0xFF, 0xF8, 0x06, 0x0E, 0x70, 0x01, 0xC3, 0x80, 0x00,
+    0x39, 0xC0, 0x00, 0x00, 0x00, 0x38, 0x00, 0x1C, 0x01, 0xE1, 0xC7, 0x39, 0x87, 0x00, 0x7F, 0xFF,
+    0xFF, 0xFF, 0x80, 0x7F, 0xFF, 0xFF, 0xFC, 0x07, 0x0F, 0x70, 0x03, 0xC7, 0x00, 0x00, 0x39, 0xC7,
+    0xFF, 0x80, 0x00, 0x70, 0x00, 0x1C, 0x00, 0x01, 0xC7, 0x19, 0xC7, 0x00, 0x01, 0x00, 0x7F, 0xF8,
+    0x0F, 0xFF, 0xF1, 0xFF, 0xFC, 0x03, 0x07, 0xF0, 0x0F, 0x8F, 0x00, 0x00, 0x39, 0xC7, 0xFF, 0xFB,
+    0x00, 0x60, 0x00, 0x0E, 0x00, 0x01, 0xC7, 0x19, 0xC6, 0x00, 0x00, 0x00, 0x63, 0x03, 0xFF, 0xFC,
+    0x3F, 0xFF, 0x1C, 0x03, 0x81, 0xF8, 0x3E, 0x0E, 0x00, 0x00, 0x39, 0xC7, 0xFF, 0xFB, 0x00, 0xE0,
+    0x00, 0x0E, 0x00, 0x01, 0xC7, 0x38, 0xC6, 0x00, 0x00, 0x00, 0x63, 0x7F, 0xFF, 0x07, 0xFF, 0xE0,
+    0x1C, 0x01, 0xC0, 0xFF, 0xFC, 0x1C, 0x00, 0x00, 0x39, 0xC0, 0x00, 0x72, 0x00, 0xE0, 0x00, 0x06,
+    0x00, 0x01, 0xC7, 0x38, 0xE6, 0x00, 0x00, 0x00, 0x6F, 0xFF, 0xE0, 0xFF, 0xFC, 0x00, 0x1C, 0x00,
+    0xE0, 0x7F, 0xF0, 0x38, 0x00, 0x00, 0x39, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x06, 0x1F, 0xF1,
+    0xC7, 0x38, 0x66, 0x01, 0x00, 0x01, 0xFF, 0xF8, 0x3F, 0xFF, 0x80, 0x00, 0x1C, 0x00, 0x70, 0x77,
+    0x80, 0xF0, 0x00, 0x00, 0x39, 0xC0, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x07, 0x1F, 0xF1, 0xC7, 0x38,
+    0x76, 0x03, 0x00, 0x3F, 0xFF, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x1C, 0x00, 0x7C, 0x70, 0x01, 0xE0,
+    0x00, 0x00, 0x39, 0xC0, 0x00, 0x00, 0x00, 0xC3, 0x00, 0x07, 0x0F, 0xF1, 0xC7, 0x38, 0x3E, 0x07,
+    0x03, 0xFF, 0xE0, 0xFF, 0xFC, 0x00, 0x00, 0x03, 0x1C, 0x00, 0x1F, 0x70, 0x07, 0xC0, 0x00, 0x00,
+    0x39, 0xC7, 0xF9, 0xC0, 0x00, 0xC7, 0x83, 0xC7, 0x00, 0x01, 0xC7, 0x38, 0x1E, 0x1F, 0x07, 0xFC,
+    0x1F, 0xFF, 0x80, 0x00, 0x00, 0x7F, 0x1C, 0x00, 0x0F, 0xF0, 0x3F, 0x80, 0x00, 0x00, 0x39, 0xCF,
+    0xFB, 0xFF, 0xE0, 0xCF, 0xC7, 0xE7, 0x00, 0x01, 0xC7, 0x38, 0x0F, 0xFE, 0x0F, 0xC3, 0xFF, 0xF0,
+    0x00, 0x00, 0x1F, 0xFF, 0x1C, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x00, 0x00, 0x39, 0xC7, 0xFB, 0xFF,
+    0xE0, 0xDF, 0xCF, 0xE7, 0x00, 0x01, 0xC7, 0x38, 0x0F, 0xF8, 0x0E, 0x3F, 0xFE, 0x00, 0x00, 0x01,
+    0xFF, 0xFB, 0x1C, 0x00, 0x01, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x39, 0xC0, 0x00, 0xFF, 0xE0, 0xDF,
+    0xCF, 0xF7, 0x00, 0x01, 0xC7, 0x38, 0x0E, 0xC0, 0x0E, 0x3F, 0xC0, 0x00, 0x00, 0x7F, 0xFF, 0x03,
+    0x1C, 0x00, 0x00, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x39, 0xC0, 0x00, 0x00, 0x00, 0xDF, 0xCF, 0xF7,
+    0x0F, 0x01, 0xC7, 0x38, 0x0E, 0x00, 0x0E, 0x38, 0x00, 0x00, 0x0F, 0xFF, 0xE0, 0x03, 0x1C, 0x00,
+    0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x39, 0xC0, 0x00, 0x00, 0x00, 0xFF, 0xCF, 0xE6, 0x1F, 0xF1,
+    0xC7, 0x38, 0x0E, 0x00, 0x0E, 0x30, 0x00, 0x01, 0xFF, 0xFC, 0x00, 0x03, 0x1C, 0x00, 0x00, 0x60,
+    0x00, 0x00, 0x00, 0x00, 0x39, 0xC0, 0x00, 0x00, 0x00, 0xEF, 0x8F, 0xEE, 0x1F, 0xF1, 0xC7, 0x38,
+    0x0C, 0x00, 0x0E, 0x30, 0x00, 0x3F, 0xFF, 0x80, 0x00, 0x03, 0x18, 0x00, 0x00, 0x60, 0x00, 0x00,
+    0x00, 0x00, 0x39, 0xC7, 0xE0, 0x00, 0x00, 0x67, 0x77, 0xEE, 0x01, 0xF1, 0xC7, 0x38, 0x0C, 0x00,
+    0x0E, 0x30, 0x07, 0xFF, 0xF0, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00,
+    0x39, 0xCF, 0xFF, 0xFF, 0x00, 0x70, 0x73, 0x8C, 0x00, 0x01, 0xC7, 0x38, 0x0C, 0x00, 0x0E, 0x30,
+    0xFF, 0xFE, 0x00, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0x60, 0x00, 0x00, 0x00, 0x00, 0x39, 0xC7,
+    0xFF, 0xFF, 0xF0, 0x30, 0x70, 0x1C, 0x00, 0x01, 0xC7, 0x38, 0x0C, 0x00, 0x0E, 0x31, 0xFF, 0xC0,
+    0x00, 0x00, 0x00, 0x03, 0x18, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x39, 0xC0, 0x3F, 0xFF,
+    0xF0, 0x30, 0xF0, 0x18, 0x00, 0x01, 0xC7, 0x38, 0x0C, 0x00, 0x0E, 0x31, 0xF8, 0x00, 0x01, 0xE0,
+    0x00, 0x03, 0x18, 0x00, 0x00, 0xE0, 0x00, 0x01, 0xFF, 0xF8, 0x39, 0xC0, 0x00, 0x00, 0xF0, 0x30,
+    0xF0, 0x38, 0x70, 0x01, 0xC7, 0x38, 0x0C, 0x00, 0x0C, 0x31, 0x80, 0x00, 0x07, 0xF8, 0x00, 0x03,
+    0x18, 0x00, 0x00, 0xC0, 0x00, 0x0F, 0xFF, 0xFF, 0x39, 0xC0, 0x00, 0x00, 0x00, 0x30, 0xF8, 0x30,
+    0xFF, 0xF1, 0xC6, 0x38, 0x0C, 0x00, 0x0C, 0x31, 0x80, 0x00, 0x1F, 0xFC, 0x00, 0x03, 0x18, 0x00,
+    0x00, 0xC0, 0x00, 0x3F, 0xFF, 0xFF, 0xF9, 0xC0, 0x00, 0x00, 0x00, 0x30, 0xB0, 0x30, 0xFF, 0xF5,
+    0xC6, 0x38, 0x0C, 0x00, 0x0C, 0x31, 0x80, 0x00, 0x1F, 0xFE, 0x00, 0x03, 0x18, 0x00, 0x01, 0xC0,
+    0x00, 0xFF, 0x00, 0x0F, 0xF9, 0xC7, 0x00, 0x00, 0x00, 0x30, 0x00, 0x30, 0x0F, 0xF1, 0xC6, 0x38,
+    0x0C, 0x00, 0x0C, 0x31, 0x80, 0x00, 0x3C, 0x1E, 0x00, 0x03, 0x18, 0x00, 0x01, 0x80, 0x03, 0xF8,
+    0x00, 0x01, 0xFD, 0xC7, 0xFF, 0xE0, 0x00, 0x32, 0x00, 0x30, 0x00, 0x01, 0xC6, 0x38, 0x0C, 0x00,
+    0x0C, 0x31, 0x80, 0x00, 0x78, 0x0F, 0x00, 0x03, 0x18, 0x00, 0x03, 0x80, 0x07, 0xC0, 0x00, 0x00,
+    0x3F, 0xC7, 0xFF, 0xEF, 0xFC, 0x37, 0x62, 0x30, 0x00, 0x01, 0xC6, 0x38, 0x0C, 0x00, 0x0C, 0x31,
+    0x80, 0x00, 0x70, 0x07, 0x00, 0x03, 0x18, 0x00, 0x03, 0x80, 0x0F, 0x80, 0x00, 0x00, 0x0F, 0xC0,
+    0xFF, 0xEF, 0xFC, 0x3F, 0x77, 0x70, 0x00, 0x01, 0xC6, 0x38, 0x0C, 0x00, 0x0C, 0x31, 0x80, 0x00,
+    0xF0, 0x07, 0x80, 0x03, 0x18, 0x00, 0x07, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x07, 0xC0, 0x00, 0x07,
+    0xFC, 0x1F, 0xFF, 0xF0, 0x00, 0x01, 0xC6, 0x38, 0x0E, 0x00, 0x0C, 0x31, 0x80, 0x00, 0xE0, 0x03,
+    0x80, 0x03, 0x18, 0x00, 0x07, 0x00, 0x7C, 0x00, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x0B,
+    0xFF, 0xE1, 0xFF, 0xE1, 0xC6, 0x38, 0x0E, 0x00, 0x0C, 0x31, 0x80, 0x00, 0xE0, 0x03, 0x80, 0x03,
+    0x18, 0x00, 0x0E, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x9D, 0xC1,
+    0xFF, 0xF1, 0xC6, 0x38, 0x0E, 0x00, 0x0C, 0x31, 0x80, 0x00, 0xE0, 0x03, 0x80, 0x03, 0x18, 0x00,
+    0x0E, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xF1,
+    0xC6, 0x38, 0x06, 0x00, 0x0C, 0x31, 0x80, 0x00, 0xE0, 0x03, 0x80, 0x03, 0x18, 0x00, 0x1C, 0x03,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC6, 0x38,
+    0x06, 0x00, 0x0C, 0x31, 0x80, 0x00, 0xE0, 0x03, 0x80, 0x03, 0x18, 0x00, 0x38, 0x07, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x1E, 0x1F, 0xFF, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC6, 0x38, 0x06, 0x00,
+    0x0C, 0x31, 0x80, 0x00, 0xE0, 0x03, 0x80, 0x03, 0x18, 0x00, 0x38, 0x0F, 0x03, 0xF0, 0x00, 0x00,
+    0x00, 0x0F, 0x1F, 0xFF, 0xFF, 0xCF, 0xE0, 0x00, 0x00, 0x01, 0xC6, 0x38, 0x07, 0x00, 0x0C, 0x31,
+    0x80, 0x00, 0xE0, 0x07, 0xE0, 0x03, 0x18, 0x00, 0x70, 0x0E, 0x1F, 0xFE, 0x00, 0x00, 0x00, 0x07,
+    0x80, 0x7F, 0xFF, 0xFF, 0xFF, 0xFE, 0x00, 0x01, 0xC6, 0x38, 0x07, 0x00, 0xFC, 0x31, 0x80, 0x00,
+    0xE0, 0xFF, 0xE0, 0x03, 0x18, 0x01, 0xE0, 0x1C, 0x7F, 0xFF, 0x80, 0x00, 0x00, 0x03, 0x80, 0x00,
+    0x07, 0xCF, 0xFF, 0xFF, 0xF7, 0x81, 0xC6, 0x38, 0x03, 0x00, 0xFC, 0x31, 0x80, 0x00, 0xCF, 0xFF,
+    0xE0, 0x03, 0x18, 0x03, 0xC0, 0x39, 0xFF, 0xFF, 0xE0, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00,
+    0x7F, 0xFF, 0xF7, 0xF1, 0xC6, 0x38, 0x03, 0x80, 0xEC, 0x31, 0x80, 0x01, 0xFF, 0xF8, 0x60, 0x03,
+    0x18, 0x0F, 0x80, 0x3B, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07,
+    0xF7, 0xF1, 0xC6, 0x38, 0x03, 0x80, 0x0C, 0x31, 0x80, 0x07, 0xFF, 0x80, 0x60, 0x03, 0x1F, 0xFF,
+    0x00, 0x77, 0xFC, 0x00, 0xFC, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xE1,
+    0xC6, 0x3F, 0xF9, 0xC0, 0x0C, 0x31, 0x80, 0x07, 0xF0, 0x00, 0x60, 0x03, 0x1F, 0xFC, 0x00, 0xEF,
+    0xF0, 0x00, 0x3E, 0x00, 0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC6, 0x3F,
+    0xFF, 0xC0, 0x0C, 0x31, 0x80, 0x07, 0x00, 0x00, 0x60, 0x03, 0x1B, 0xF0, 0x00, 0xFF, 0xE0, 0x00,
+    0x0F, 0x00, 0x00, 0x00, 0x7F, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC6, 0x33, 0xFF, 0xFF,
+    0x0C, 0x31, 0x80, 0x07, 0x00, 0x00, 0x60, 0x03, 0x18, 0x00, 0x01, 0xDF, 0xC0, 0x00, 0x07, 0xC0,
+    0x00, 0x00, 0x3F, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x00, 0x01, 0xC6, 0x38, 0x07, 0xFF, 0x0C, 0x31,
+    0x80, 0x07, 0x00, 0xC0, 0x60, 0x03, 0x18, 0x00, 0x01, 0xBF, 0x80, 0x1C, 0x01, 0xE0, 0x00, 0x00,
+    0x3C, 0xFF, 0xFF, 0xFF, 0xFF, 0xC0, 0x00, 0x01, 0xC6, 0x30, 0x00, 0x77, 0x0C, 0x31, 0x80, 0x07,
+    0x03, 0xE0, 0x60, 0x03, 0x18, 0x00, 0x03, 0xFF, 0x00, 0x7E, 0x00, 0xF0, 0x00, 0x00, 0x1C, 0x00,
+    0x1F, 0xFF, 0xFF, 0xFF, 0xF0, 0x01, 0xC6, 0x30, 0x00, 0x70, 0x0C, 0x31, 0x80, 0x07, 0x03, 0xE0,
+    0x60, 0x03, 0x18, 0x00, 0x03, 0x7E, 0x00, 0xFF, 0x00, 0x78, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x03,
+    0xFF, 0xFF, 0xFF, 0xFF, 0xC6, 0x38, 0x00, 0x38, 0x0C, 0x31, 0x80, 0x07, 0x03, 0xF0, 0x60, 0x03,
+    0x18, 0x00, 0x07, 0xFC, 0x00, 0xE7, 0x00, 0x38, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x3F,
+    0xFF, 0xFF, 0xC6, 0x30, 0x00, 0x1C, 0x0C, 0x31, 0x80, 0x07, 0x07, 0xE0, 0x60, 0x03, 0x18, 0x00,
+    0x07, 0xFC, 0x01, 0xC3, 0x80, 0x1C, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xFF,
+    0xC6, 0x30, 0x00, 0x0E, 0x0C, 0x31, 0x80, 0x07, 0x03, 0xE0, 0x60, 0x03, 0x18, 0x00, 0x06, 0xF8,
+    0x01, 0xFB, 0x80, 0x0E, 0x00, 0x00, 0x07, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x86, 0x30,
+    0x00, 0x07, 0x0C, 0x31, 0x80, 0x07, 0x03, 0xE0, 0x60, 0x07, 0x18, 0x00, 0x0F, 0xF8, 0x01, 0xBB,
+    0x80, 0x0F, 0x00, 0x00, 0x07, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x06, 0x30, 0x00, 0x03,
+    0x0C, 0x31, 0x80, 0x07, 0x01, 0xC0, 0x60, 0x07, 0x18, 0x00, 0x0D, 0xF0, 0x03, 0xFB, 0x80, 0x07,
+    0x00, 0x00, 0x03, 0xFF, 0xFF, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x06, 0x70, 0x00, 0x01, 0x0C, 0x31,
+    0x80, 0x07, 0x01, 0xC0, 0x60, 0x07, 0x18, 0x00, 0x0F, 0xF0, 0x03, 0xFB, 0x80, 0x03, 0x80, 0x00,
+    0x03, 0x80, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0x06, 0xF0, 0x00, 0x00, 0x0C, 0x31, 0x80, 0x07,
+    0x03, 0xE0, 0x70, 0x07, 0x18, 0x00, 0x1F, 0xE0, 0x03, 0x7B, 0x80, 0x01, 0xC0, 0x00, 0x03, 0x80,
+    0x01, 0x9F, 0xFF, 0xFF, 0xFF, 0x00, 0x07, 0xE0, 0x00, 0x00, 0x0C, 0x31, 0x80, 0x07, 0x03, 0xE0,
+    0x60, 0x07, 0x18, 0x00, 0x1F, 0xE0, 0x03, 0x7B, 0x80, 0x01, 0xC0, 0x00, 0x01, 0xC0, 0x01, 0x80,
+    0x0F, 0xFF, 0xFF, 0xFF, 0x87, 0xC0, 0x00, 0x00, 0x0C, 0x31, 0x80, 0x06, 0x03, 0xE0, 0x70, 0x07,
+    0x18, 0x00, 0x1B, 0xC0, 0x03, 0x73, 0x80, 0x00, 0xE0, 0x00, 0x01, 0xC0, 0x01, 0x80, 0x0E, 0x01,
+    0xFF, 0xFF, 0xFF, 0x80, 0x00, 0x00, 0x0C, 0x31, 0x80, 0x06, 0x03, 0xC0, 0x70, 0x07, 0x18, 0x00,
+    0x1B, 0xC0, 0x03, 0x73, 0x00, 0x00, 0xF0, 0x00, 0x01, 0xC0, 0x3F, 0x80, 0x0E, 0x00, 0x00, 0x7F,
+    0xFF, 0x00, 0x00, 0x00, 0x0C, 0x31, 0x80, 0x06, 0x00, 0x10, 0xF0, 0x07, 0x38, 0x00, 0x3F, 0xC0,
+    0x03, 0x77, 0x00, 0x00, 0x70, 0x00, 0x00, 0xC0, 0xFF, 0x80, 0x0F, 0xC0, 0x00, 0x00, 0x3C, 0x00,
+    0x00, 0x00, 0x0C, 0x31, 0x80, 0x06, 0x00, 0x07, 0xE0, 0x07, 0x38, 0x00, 0x3F, 0x80, 0x03, 0x87,
+    0x00, 0x00, 0x38, 0x00, 0x00, 0xE1, 0xFF, 0x80, 0x0F, 0xF0, 0x7C, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0C, 0x31, 0x80, 0x06, 0x00, 0x3F, 0xE0, 0x07, 0x38, 0x00, 0xFF, 0x80, 0x03, 0x8E, 0x00, 0x00,
+    0x38, 0x00, 0x00, 0xE1, 0xC1, 0xFF, 0x0F, 0xF8, 0x7F, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x0C, 0x31,
+    0x80, 0x07, 0x01, 0xFF, 0x00, 0x07, 0x38, 0x07, 0xF7, 0x80, 0x01, 0xDE, 0x00, 0x00, 0x1C, 0x00,
+    0x00, 0xE3, 0x81, 0xFF, 0xFE, 0x7C, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x00, 0x0C, 0x31, 0x80, 0x06,
+    0x1F, 0xF8, 0x00, 0x0F, 0x38, 0x1F, 0xF7, 0x00, 0x01, 0xFC, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x63,
+    0x80, 0xFF, 0xFE, 0x0E, 0x63, 0xFF, 0xFF, 0xC0, 0x00, 0x00, 0x0C, 0x31, 0x80, 0x06, 0xFF, 0xC0,
+    0x00, 0x7F, 0x38, 0xFF, 0x37, 0x00, 0x00, 0xF8, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x63, 0xC0, 0x00,
+    0xFC, 0x06, 0x60, 0x03, 0xFF, 0xFF, 0x80, 0x00, 0x0C, 0x31, 0x80, 0x07, 0xFE, 0x00, 0x03, 0xFE,
+    0x3F, 0xF8, 0x37, 0x00, 0x00, 0x20, 0x00, 0x00, 0x0E, 0x00, 0x00, 0x71, 0xF0, 0x00, 0x00, 0x0E,
+    0x60, 0x00, 0x07, 0xFF, 0xFE, 0x00, 0x0C, 0x31, 0x80, 0x07, 0xF0, 0x00, 0x1F, 0xF0, 0x3F, 0xC0,
+    0x37, 0x00, 0x00, 0x00, 0x00, 0x00, 0x06, 0x00, 0x00, 0x70, 0xFE, 0x00, 0x00, 0x1E, 0xE0, 0x00,
+    0x00, 0x3F, 0xFF, 0xFC, 0x0C, 0x31, 0x80, 0x07, 0x00, 0x00, 0xFF, 0x80, 0x3F, 0x00, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x00, 0x70, 0x7F, 0xF8, 0x01, 0xFC, 0xE3, 0xC0, 0x00, 0x00,
+    0x7F, 0xFF, 0x0C, 0x31, 0x80, 0x00, 0x00, 0x07, 0xFC, 0x00, 0x38, 0x00, 0x7E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x07, 0x00, 0x00, 0x7C, 0x0F, 0xFF, 0xFF, 0xF0, 0xE7, 0xFF, 0x00, 0x00, 0x01, 0xFF,
+    0x0C, 0x31, 0x80, 0x00, 0x00, 0x1F, 0xE0, 0x00, 0x78, 0x00, 0x7F, 0xFF, 0x00, 0x03, 0x00, 0x00,
+    0x03, 0x00, 0x00, 0x7F, 0x81, 0xFF, 0xFF, 0xE0, 0xE7, 0xFF, 0xFC, 0x00, 0x00, 0x07, 0x0C, 0x31,
+    0x80, 0x00, 0x00, 0xFF, 0x00, 0x03, 0xF8, 0x00, 0x7F, 0xFF, 0xFF, 0x03, 0x80, 0x00, 0x03, 0x80,
+    0x00, 0x3F, 0xE0, 0x03, 0xFE, 0x00, 0xE6, 0x7F, 0xFF, 0xF0, 0x00, 0x00, 0x0C, 0x31, 0x80, 0x00,
+    0x07, 0xF8, 0x00, 0x1F, 0xE0, 0x00, 0x7E, 0xFF, 0xFF, 0x03, 0xFF, 0xFF, 0x03, 0x80, 0x00, 0x3F,
+    0xF8, 0x00, 0x00, 0x00, 0xC6, 0x00, 0xFF, 0xFF, 0xC0, 0x00, 0x0C, 0x31, 0x80, 0x00, 0x3F, 0xE0,
+    0x00, 0xFF, 0x00, 0x00, 0x7E, 0xCF, 0xFF, 0x03, 0xFF, 0xFF, 0xC1, 0x80, 0x00, 0x3F, 0xFC, 0x00,
+    0x00, 0x00, 0xC6, 0x00, 0x03, 0xFF, 0xFF, 0x80, 0x0C, 0x31, 0x80, 0x01, 0xFF, 0x00, 0x07, 0xFC,
+    0x00, 0x00, 0x7E, 0xCF, 0xF7, 0x03, 0xFF, 0xFF, 0xE1, 0xC0, 0x00, 0x3F, 0xBF, 0x00, 0x00, 0x00,
+    0xC6, 0x00, 0x00, 0x0F, 0xFF, 0xFE, 0x0C, 0x31, 0x80, 0x0F, 0xF8, 0x00, 0x3F, 0xE0, 0x00, 0x00,
+    0x7C, 0xC7, 0xF7, 0x03, 0x8F, 0xEF, 0xE1, 0xC0, 0x00, 0x3F, 0x8F, 0x80, 0x00, 0x00, 0xC6, 0x00,
+    0x00, 0x00, 0x3F, 0xFF, 0x0C, 0x31, 0x80, 0x7F, 0xC0, 0x00, 0xFF, 0x00, 0x00, 0x00, 0x3C, 0xE7,
+    0xE6, 0x03, 0x8F, 0xE0, 0xC1, 0xC0, 0x00, 0x7F, 0x83, 0xF8, 0x00, 0x00, 0xCE, 0x30, 0x00, 0x00,
+    0x00, 0xFF, 0x0C, 0x31, 0x83, 0xFE, 0x00, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x3C, 0xE7, 0xEE, 0x01,
+    0x8F, 0xE0, 0xC1, 0xC0, 0x00, 0x7F, 0x81, 0xFF, 0xF0, 0x00, 0xCE, 0x7F, 0x80, 0x00, 0x00, 0x03,
+    0x0C, 0x31, 0x9F, 0xF0, 0x00, 0x3F, 0xC0, 0x00, 0x00, 0x00, 0x3C, 0x71, 0xCE, 0x01, 0xCF, 0xC1,
+    0xC0, 0xC0, 0x00, 0x7F, 0x00, 0xFF, 0xFF, 0xC0, 0xCE, 0x7F, 0xFE, 0x00, 0x00, 0x00, 0x0C, 0x31,
+    0xFF, 0x80, 0x01, 0xFF, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x70, 0x1C, 0x01, 0xC7, 0x81, 0xC0, 0xC0,
+    0x00, 0x7F, 0x00, 0x73, 0xFF, 0xFE, 0xCE, 0x1F, 0xFF, 0xE0, 0x00, 0x00, 0x0C, 0x31, 0xFC, 0x00,
+    0x0F, 0xF8, 0x1F, 0xC0, 0x00, 0x00, 0x3C, 0x3C, 0x3C, 0x00, 0xE0, 0x03, 0x80, 0xC0, 0x00, 0x7F,
+    0x00, 0x70, 0x0F, 0xFF, 0xCC, 0x00, 0x7F, 0xF3, 0x80, 0x00, 0x0C, 0x31, 0xE0, 0x00, 0x7F, 0xB0,
+    0x7F, 0xF0, 0x00, 0x00, 0x3C, 0x3F, 0xF8, 0x00, 0xF0, 0x07, 0x80, 0xC0, 0x00, 0x7F, 0x00, 0x30,
+    0x00, 0x1F, 0xCC, 0x00, 0x03, 0xF3, 0xFC, 0x00, 0x0C, 0x30, 0x00, 0x03, 0xFE, 0x31, 0xFF, 0xF8,
+    0x00, 0x00, 0x3C, 0x0F, 0xF0, 0x00, 0x78, 0x0F, 0x00, 0xC0, 0x00, 0x7F, 0x00, 0x38, 0x00, 0x01,
+    0xCC, 0x00, 0x00, 0x03, 0xFF, 0xE0, 0x0C, 0x30, 0x00, 0x1F, 0xF0, 0x3F, 0xE0, 0x7C, 0x00, 0x00,
+    0x1C, 0x07, 0xC0, 0x00, 0x3F, 0xFE, 0x00, 0xC0, 0x00, 0x7F, 0x00, 0x3F, 0x80, 0x01, 0x8C, 0x60,
+    0x00, 0x00, 0x7F, 0xF8, 0x0E, 0x30, 0x00, 0xFF, 0x80, 0x3F, 0x80, 0x1E, 0x00, 0x00, 0x1C, 0x00,
+    0x00, 0x00, 0x1F, 0xFC, 0x00, 0xC0, 0x00, 0xFF, 0x00, 0x3F, 0xFE, 0x01, 0x8C, 0xFF, 0x00, 0x00,
+    0x03, 0xF8, 0x0F, 0x30, 0x07, 0xFD, 0x80, 0x3F, 0x00, 0x0F, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
+    0x0F, 0xF8, 0x00, 0xC0, 0x00, 0xFF, 0x00, 0x1F, 0xFF, 0xE1, 0x8C, 0xFF, 0xF0, 0x00, 0x00, 0x18,
+    0x07, 0xB0, 0x1F, 0xE7, 0x80, 0x3E, 0x00, 0x07, 0x80, 0x00, 0x1C, 0x00, 0x00, 0x00, 0x01, 0xC0,
+    0x00, 0xC0, 0x00, 0xFF, 0x00, 0x18, 0x3F, 0xFF, 0x8C, 0x3F, 0xF3, 0xC0, 0x00, 0x00, 0x03, 0xF0,
+    0xFF, 0x1F, 0x81, 0xFC, 0x00, 0x03, 0xC0, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0,
+    0x01, 0xFE, 0x00, 0x18, 0x06, 0xFF, 0x8C, 0x01, 0xF7, 0xE0, 0x00, 0x00, 0x01, 0xF7, 0xFC, 0x3F,
+    0x8F, 0xF8, 0x00, 0x01, 0xC0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xC0, 0x01, 0xFE,
+    0x00, 0x18, 0x06, 0xEF, 0x9C, 0x00, 0x03, 0xE3, 0xE0, 0x00, 0x03, 0xFF, 0xC0, 0x79, 0xBF, 0xF8,
+    0x00, 0x00, 0xE0, 0x00, 0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC0, 0x01, 0xFE, 0x00, 0x18,
+    0x06, 0xE1, 0x9C, 0x00, 0x00, 0x47, 0xFF, 0x00, 0x1F, 0xFF, 0xC0, 0xF3, 0xFE, 0x30, 0x00, 0x00,
+    0x70, 0x00, 0x0E, 0x00, 0x03, 0xE0, 0x00, 0x00, 0x01, 0xC0, 0x03, 0xFE, 0x00, 0x38, 0x06, 0xE3,
+    0x9C, 0x40, 0x00, 0x01, 0xFF, 0xF0, 0x7F, 0x39, 0xC1, 0xC3, 0xF0, 0x71, 0xE0, 0x00, 0x70, 0x00,
+    0x0E, 0x00, 0x0F, 0xFC, 0x00, 0x00, 0x01, 0xC0, 0x03, 0xFE, 0x00, 0x38, 0x06, 0xE3, 0x98, 0xFE,
+    0x00, 0x00, 0x1F, 0xF0, 0xFC, 0x39, 0xC3, 0x81, 0x80, 0x77, 0xF8, 0x00, 0x38, 0x00, 0x3E, 0x00,
+    0x1F, 0xFE, 0x00, 0x00, 0x01, 0xC0, 0x07, 0xFE, 0x00, 0x38, 0x06, 0xE3, 0x98, 0xFF, 0x60, 0x00,
+    0x00, 0xF0, 0xF0, 0x38, 0xC3, 0x80, 0x00, 0x7F, 0xFE, 0x00, 0x1C, 0x00, 0xFE, 0x00, 0x3F, 0x7F,
+    0x00, 0x00, 0x01, 0x80, 0x07, 0xFE, 0x00, 0x38, 0x06, 0xE3, 0x98, 0x3F, 0x7F, 0x00, 0x00, 0x00,
+    0xC0, 0x38, 0xC3, 0x80, 0x00, 0x7F, 0xFF, 0x00, 0x1C, 0x01, 0xF7, 0x00, 0x3C, 0x07, 0x80, 0x00,
+    0x01, 0x80, 0x0F, 0xFE, 0x00, 0x38, 0x06, 0xE3, 0x18, 0x02, 0x7F, 0xC0, 0x00, 0x00, 0x00, 0x38,
+    0xE3, 0x80, 0x00, 0xFF, 0x07, 0x00, 0x0E, 0x07, 0xC7, 0x00, 0x10, 0x03, 0xC0, 0x00, 0x03, 0x80,
+    0x0F, 0xFE, 0x00, 0x30, 0x06, 0xE3, 0x18, 0x00, 0x1F, 0xC7, 0xC0, 0x00, 0x00, 0x30, 0xE1, 0xE0,
+    0x0F, 0xFC, 0x03, 0x80, 0x0F, 0x1F, 0x87, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x03, 0x80, 0x1F, 0xFC,
+    0x00, 0x30, 0x0E, 0xE3, 0x18, 0x00, 0x00, 0xC7, 0xFC, 0x00, 0x00, 0x30, 0x60, 0xFF, 0xFF, 0xE0,
+    0x01, 0xC0, 0x07, 0xFE, 0x07, 0x00, 0x00, 0x00, 0x80, 0x00, 0x03, 0x00, 0x3F, 0xFC, 0x00, 0x70,
+    0x0E, 0xE3, 0x18, 0xC0, 0x00, 0x07, 0xFF, 0xC0, 0x00, 0x70, 0x70, 0x7F, 0xFF, 0x00, 0x01, 0xC0,
+    0x03, 0xF8, 0x03, 0x00, 0x00, 0x00, 0x00, 0x00, 0x03, 0x00, 0x7F, 0xFC, 0x00, 0x70, 0x0E, 0xE3,
+    0x19, 0xFC, 0x00, 0x00, 0x7F, 0xF0, 0x00, 0x70, 0x70, 0x1F, 0xE0, 0x00, 0x00, 0xE0, 0x01, 0xE0,
+    0x0F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0x7F, 0xFC, 0x00, 0x70, 0x0E, 0xE3, 0x39, 0xFF,
+    0xE0, 0x00, 0x03, 0xF0, 0x00, 0x60, 0x38, 0x00, 0x00, 0x00, 0x00, 0xE0, 0x00, 0xF8, 0x7F, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x07, 0x00, 0xFF, 0xFC, 0x00, 0x70, 0x0C, 0xE3, 0x38, 0x7F, 0xFE, 0x00,
+    0x00, 0x20, 0x00, 0xE0, 0x3C, 0x00, 0x00, 0x00, 0x00, 0x60, 0x00, 0x7F, 0xFF, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x06, 0x01, 0xFF, 0xFC, 0x00, 0x60, 0x0C, 0xE3, 0x38, 0x03, 0xFF, 0x80, 0x00, 0x00,
+    0x01, 0xC0, 0x1E, 0x00, 0x1F, 0xE0, 0x00, 0x70, 0x00, 0x1F, 0xFB, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x0E, 0x03, 0xFF, 0xFC, 0x00, 0x60, 0x0C, 0xC7, 0x30, 0x00, 0x3F, 0xCE, 0x00, 0x00, 0x03, 0xC0,
+    0x0F, 0x81, 0xFF, 0xFC, 0x00, 0x70, 0x00, 0x07, 0xC7, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x07,
+    0xFF, 0xFC, 0x00, 0xE0, 0x0C, 0xC7, 0x30, 0x00, 0x03, 0x8F, 0xE0, 0x00, 0x07, 0x80, 0x07, 0xFF,
+    0xFF, 0xFF, 0x00, 0x38, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0F, 0xFF, 0xF8,
+    0x00, 0xE0, 0x1C, 0xC7, 0x31, 0x80, 0x00, 0x0F, 0xF7, 0x00, 0x0F, 0x00, 0x03, 0xFF, 0xE0, 0x1F,
+    0xC0, 0x78, 0x00, 0x00, 0x07, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x0E, 0xFF, 0xF8, 0x00, 0xE0,
+    0x19, 0xC7, 0x33, 0xF8, 0x00, 0x01, 0xE7, 0xE0, 0x3E, 0x00, 0x00, 0xFE, 0x00, 0x03, 0xF3, 0xF8,
+    0x00, 0x00, 0x06, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x7F, 0xF8, 0x00, 0xE0, 0x19, 0xC6,
+    0x31, 0xFF, 0x80, 0x00, 0x07, 0xE0, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFC, 0x00, 0x00,
+    0x0E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x38, 0x00, 0x1F, 0xF8, 0x00, 0xC0, 0x39, 0x86, 0x30, 0x7F,
+    0xFC, 0x00, 0x00, 0xE0, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0x9C, 0x00, 0x00, 0x0E, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x70, 0x00, 0x0F, 0xF8, 0x00, 0xC0, 0x33, 0x86, 0x30, 0x07, 0xFF, 0x80,
+    0x00, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFE, 0x0E, 0x00, 0x00, 0x1C, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x70, 0x00, 0x0F, 0xF8, 0x01, 0xC0, 0x73, 0x86, 0x70, 0x00, 0x7F, 0x8C, 0x00, 0x00,
+    0xC0, 0x00, 0x00, 0x00, 0x00, 0x03, 0xFF, 0x06, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x60, 0x00, 0x07, 0xF8, 0x01, 0xC0, 0xE3, 0x06, 0x70, 0x00, 0x07, 0x9F, 0xC0, 0x00, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xE7, 0x1F, 0x00, 0x00, 0x78, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x03, 0xF8, 0x01, 0xC3, 0xC7, 0x06, 0x70, 0x00, 0x00, 0x1F, 0xFC, 0x00, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x3F, 0x83, 0xBF, 0x80, 0x00, 0xF0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF0,
+    0x01, 0xFF, 0xCE, 0x06, 0x78, 0x00, 0x00, 0x03, 0xFF, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x00, 0xFE,
+    0x01, 0xFF, 0xC0, 0x03, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x01, 0xFF,
+    0x0E, 0x06, 0x7F, 0x80, 0x00, 0x00, 0x3F, 0xC0, 0x80, 0x00, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF1,
+    0xC0, 0x1F, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x78, 0x01, 0xFC, 0x1C, 0x0E,
+    0x3F, 0xF8, 0x00, 0x00, 0x03, 0xC0, 0xC0, 0x00, 0x00, 0x00, 0x0F, 0xC0, 0x0F, 0xC0, 0xF7, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3C, 0x03, 0x80, 0x78, 0x0E, 0x07, 0xFF,
+    0x00, 0x00, 0x00, 0x00, 0xC0, 0x00, 0x00, 0x00, 0x3F, 0x00, 0x3F, 0x80, 0x7F, 0xFC, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1C, 0x03, 0x80, 0xF0, 0x0C, 0x00, 0x7F, 0xF0, 0x00,
+    0x00, 0x01, 0xF0, 0x01, 0xF8, 0x00, 0xFC, 0x00, 0xFF, 0x81, 0xFF, 0xE0, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x0E, 0x03, 0xFF, 0xE0, 0x0F, 0xC0, 0x07, 0xFF, 0x00, 0x00, 0x01,
+    0xFF, 0xFF, 0xFE, 0x03, 0xF0, 0x03, 0xF3, 0x07, 0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0x03, 0xFF, 0xC0, 0x07, 0xF8, 0x00, 0xFF, 0xF0, 0x00, 0x01, 0x3F, 0xFF,
+    0xFF, 0x8F, 0xC0, 0x0F, 0xC7, 0x1F, 0x80, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0x40,
+    0x00, 0x07, 0x83, 0xFF, 0x00, 0x0F, 0xFF, 0x80, 0x0F, 0xFE, 0x00, 0x01, 0x0F, 0xFE, 0x0F, 0xFF,
+    0x00, 0x3F, 0x0E, 0x3E, 0x00, 0x00, 0x00, 0x18, 0x00, 0x00, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x03,
+    0x83, 0x00, 0x00, 0x1E, 0x3F, 0xF0, 0x00, 0xFF, 0xE0, 0x01, 0x00, 0x00, 0x01, 0xFC, 0x00, 0xFC,
+    0x1E, 0x78, 0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0xFC, 0x00, 0x01, 0xC7, 0x00,
+    0x00, 0x7C, 0x07, 0xFE, 0x00, 0x1F, 0xFC, 0x01, 0x00, 0x00, 0x03, 0xF0, 0x03, 0xF0, 0x3C, 0xF0,
+    0x00, 0x00, 0x00, 0x38, 0x00, 0x00, 0x00, 0x00, 0x00, 0x3E, 0x00, 0x01, 0xC7, 0x00, 0x01, 0xF0,
+    0x00, 0x7F, 0xE0, 0x01, 0xFF, 0xC1, 0x00, 0x00, 0x0F, 0xF0, 0x0F, 0xC1, 0xF9, 0xE0, 0x00, 0x00,
+    0x00, 0x70, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x00, 0x00, 0xE7, 0x00, 0x03, 0xE0, 0x80, 0x0F,
+    0xFE, 0x00, 0x1F, 0xFF, 0x00, 0x00, 0x3F, 0x38, 0x3F, 0x07, 0xE1, 0xC0, 0x00, 0x00, 0x00, 0x70,
+    0x00, 0x00, 0x00, 0x01, 0x80, 0x07, 0x80, 0x00, 0xE7, 0x00, 0x07, 0x83, 0xF0, 0x00, 0xFF, 0xC0,
+    0x01, 0xFF, 0x00, 0x00, 0xFC, 0x1C, 0xFE, 0x0F, 0xC3, 0x80, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x00,
+    0x00, 0x01, 0x80, 0x03, 0xC0, 0x00, 0x77, 0x00, 0x1F, 0x0F, 0xFE, 0x00, 0x1F, 0xFC, 0x00, 0x3F,
+    0x00, 0x03, 0xF0, 0x1D, 0xF0, 0x3E, 0x07, 0x80, 0x00, 0x00, 0x01, 0xC0, 0x00, 0x00, 0x00, 0x01,
+    0xC0, 0x01, 0xE0, 0x00, 0x76, 0x00, 0x3C, 0x0F, 0x7F, 0xC0, 0x01, 0xFF, 0x80, 0x03, 0x00, 0x0F,
+    0xC0, 0x0F, 0xFC, 0x78, 0x07, 0x00, 0x00, 0x00, 0x03, 0xC0, 0x00, 0x0C, 0x00, 0x01, 0xC0, 0x00,
+    0xF0, 0x00, 0x3E, 0x00, 0xF8, 0x1C, 0x0F, 0xF8, 0x00, 0x3F, 0xF8, 0x00, 0x00, 0x3F, 0x00, 0x1F,
+    0xFF, 0xF0, 0x0E, 0x00, 0x00, 0x00, 0x03, 0x80, 0x00, 0x1E, 0x00, 0x00, 0xE0, 0x00, 0x70, 0x00,
+    0x3E, 0x01, 0xF0, 0x3C, 0x01, 0xFE, 0x00, 0x03, 0xFF, 0x00, 0x00, 0xFC, 0x00, 0x7E, 0x1F, 0xE0,
+    0x0E, 0x00, 0x00, 0x00, 0x0F, 0x80, 0x00, 0x1E, 0x00, 0x00, 0x70, 0x00, 0x78, 0x00, 0x3E, 0x07,
+    0xC0, 0x7F, 0x80, 0x3F, 0xC0, 0x00, 0x7F, 0xF0, 0x03, 0xF0, 0x01, 0xF8, 0x03, 0xFC, 0x0C, 0x00,
+    0x00, 0x00, 0x1F, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x70, 0x00, 0x78, 0x00, 0x1E, 0x0F, 0x80, 0xEF,
+    0xF0, 0x07, 0xF8, 0x00, 0x07, 0xFE, 0x0F, 0xC0, 0x07, 0xE0, 0x00, 0x7F, 0x9C, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0x00, 0x3F, 0x00, 0x00, 0x38, 0x00, 0x7C, 0x00, 0x1E, 0x1E, 0x00, 0x43, 0xFC, 0x00,
+    0xFF, 0x00, 0x00, 0xFF, 0x3F, 0x00, 0x1F, 0x80, 0x00, 0x0F, 0xDC, 0x00, 0x00, 0xFF, 0xFE, 0x00,
+    0x00, 0x7F, 0x80, 0x00, 0x38, 0x00, 0x7C, 0x00, 0x1C, 0x3C, 0x00, 0x00, 0x7F, 0x80, 0x3F, 0xE0,
+    0x00, 0x0F, 0xFC, 0x00, 0x7E, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x00, 0x7F,
+    0x80, 0x00, 0x38, 0x00, 0x7C, 0x00, 0x1C, 0x3F, 0x80, 0x00, 0x0F, 0xF0, 0x07, 0xFC, 0x00, 0x01,
+    0xF0, 0x01, 0xF8, 0x00, 0x00, 0x03, 0xF8, 0x00, 0xFF, 0xFF, 0xFC, 0x00, 0x00, 0xFF, 0xC0, 0x00,
+    0x1C, 0x00, 0x7C, 0x00, 0x1C, 0x3F, 0xE0, 0x00, 0x03, 0xFC, 0x00, 0xFF, 0x80, 0x00, 0xC0, 0x07,
+    0xE0, 0x00, 0x00, 0x0F, 0xF8, 0x01, 0xFF, 0xFF, 0xF8, 0x00, 0x00, 0xFF, 0xC0, 0x00, 0x1C, 0x00,
+    0x7C, 0x00, 0x1C, 0x3B, 0xF8, 0x00, 0x00, 0x7F, 0x80, 0x1F, 0xF0, 0x00, 0x00, 0x1F, 0x80, 0x00,
+    0x00, 0x3F, 0xB0, 0x03, 0xE1, 0xFF, 0xF8, 0x00, 0x01, 0xFF, 0xE0, 0x00, 0x0E, 0x00, 0x78, 0x00,
+    0x1C, 0x38, 0x7F, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0xFE, 0x00, 0x00, 0x7E, 0x00, 0x00, 0x00, 0xFE,
+    0x30, 0x07, 0x83, 0xFF, 0xF0, 0x00, 0x03, 0xFF, 0xE0, 0x00, 0x0E, 0x00, 0x78, 0x00, 0x1C, 0x38,
+    0x1F, 0xC0, 0x00, 0x03, 0xFC, 0x00, 0x7F, 0x00, 0x01, 0xF8, 0x00, 0x00, 0x01, 0xF8, 0x70, 0x0F,
+    0xFB, 0xFF, 0xF0, 0x00, 0x07, 0xFF, 0xF0, 0x00, 0x0E, 0x00, 0xF0, 0x00, 0x1C, 0x38, 0x07, 0xF0,
+    0x00, 0x00, 0x7F, 0x80, 0x1F, 0x01, 0x03, 0xE0, 0x00, 0x00, 0x07, 0xE0, 0xF0, 0x0F, 0xFF, 0xFF,
+    0xF0, 0x00, 0x0F, 0xFF, 0xF0, 0x00, 0x0E, 0x03, 0xE0, 0x00, 0x1C, 0x3E, 0x00, 0xFC, 0x00, 0x00,
+    0x0F, 0xF0, 0x0F, 0x03, 0x0F, 0xC0, 0x00, 0x00, 0x1F, 0x83, 0xF0, 0x1C, 0x3F, 0xFF, 0xE0, 0x00,
+    0x1F, 0xFF, 0xF0, 0x00, 0x06, 0x0F, 0xC0, 0x00, 0x1C, 0x1F, 0x80, 0x3F, 0x80, 0x00, 0x03, 0xFC,
+    0x1E, 0x07, 0x3F, 0x00, 0x00, 0x00, 0x3E, 0x07, 0xF0, 0x1C, 0x07, 0xFF, 0xE0, 0x00, 0x7F, 0xFF,
+    0xF8, 0x00, 0x07, 0x1F, 0x80, 0x00, 0x1C, 0x07, 0xE0, 0x0F, 0xE0, 0x00, 0x00, 0x7F, 0xBC, 0x07,
+    0xFC, 0x00, 0x00, 0x00, 0xFC, 0x1F, 0xF0, 0x3F, 0x00, 0xFF, 0xC0, 0x01, 0xFF, 0xFF, 0xF8, 0x00,
+    0x07, 0x7E, 0x00, 0x00, 0x18, 0x01, 0xF8, 0x03, 0xF8, 0x00, 0x00, 0x1F, 0xF8, 0x0E, 0xF0, 0x00,
+    0x00, 0x01, 0xF0, 0x7F, 0xF0, 0x3F, 0xC0, 0x3F, 0xE0, 0x07, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xF8,
+    0x00, 0x00, 0x38, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0x00, 0x03, 0xF0, 0x1C, 0xC0, 0x00, 0x00, 0x07,
+    0xC0, 0xF9, 0xF0, 0x77, 0xF8, 0x07, 0xFC, 0x0F, 0xFF, 0xFF, 0xF8, 0x00, 0x07, 0xE0, 0x00, 0x00,
+    0x38, 0x00, 0x1F, 0x80, 0x1F, 0xC0, 0x00, 0x00, 0x60, 0x38, 0x00, 0x00, 0x00, 0x1F, 0x83, 0xE0,
+    0x70, 0x61, 0xFF, 0x00, 0xFF, 0x9F, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0xC0, 0x00, 0x00, 0x70, 0x00,
+    0x1F, 0xE0, 0x07, 0xF0, 0x00, 0x00, 0x00, 0x70, 0x00, 0x00, 0x00, 0x3E, 0x0F, 0xF0, 0xF8, 0xE3,
+    0xFF, 0xC0, 0x1F, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x07, 0x80, 0x00, 0x00, 0x70, 0x00, 0x19, 0xFC,
+    0x01, 0xFE, 0x00, 0x00, 0x00, 0xF0, 0x00, 0x00, 0x00, 0xF8, 0x1F, 0xFD, 0xFF, 0xFF, 0x87, 0xF8,
+    0x03, 0xFF, 0xFF, 0xFF, 0xFC, 0x00, 0x0F, 0x00, 0x00, 0x00, 0xE0, 0x00, 0x18, 0xFF, 0x00, 0x3F,
+    0x80, 0x00, 0x01, 0xE1, 0x00, 0x00, 0x01, 0xF0, 0x7C, 0x7F, 0xDF, 0xFF, 0x13, 0xFF, 0x00, 0x7F,
+    0xFF, 0xFF, 0xFC, 0x00, 0x0E, 0x00, 0x00, 0x01, 0xE0, 0x00, 0x18, 0xDF, 0xC0, 0x0F, 0xE0, 0x00,
+    0x03, 0xC1, 0x00, 0x00, 0x01, 0xE0, 0x78, 0x0F, 0xEF, 0x9F, 0xEF, 0x3F, 0xE0, 0x0F, 0xFF, 0xFF,
+    0xFC, 0x00, 0x1C, 0x00, 0x00, 0x03, 0xE0, 0x00, 0x18, 0xC3, 0xF0, 0x01, 0xFC, 0x00, 0x03, 0x83,
+    0x00, 0x00, 0x01, 0xF8, 0x7F, 0x3F, 0xFE, 0x43, 0xFE, 0x07, 0xF8, 0x01, 0xFF, 0xFF, 0xFC, 0x00,
+    0x38, 0x00, 0x00, 0x07, 0xE0, 0x00, 0x18, 0xC0, 0xFE, 0x00, 0x7F, 0x00, 0x07, 0x07, 0x00, 0x00,
+    0x01, 0xFE, 0x1F, 0xF8, 0xFF, 0x07, 0xFF, 0x0F, 0xFF, 0x00, 0x3F, 0xFF, 0xFC, 0x00, 0x38, 0x00,
+    0x00, 0x1F, 0xE0, 0x00, 0x18, 0xC0, 0x3F, 0x80, 0x1F, 0xC0, 0x0E, 0x0F, 0x00, 0x00, 0x01, 0x9F,
+    0x87, 0xF0, 0x7F, 0xDE, 0x3F, 0xFE, 0x1F, 0xE0, 0x07, 0xFF, 0xFC, 0x00, 0x30, 0x00, 0x00, 0xFE,
+    0xC0, 0x00, 0x18, 0xC0, 0x0F, 0xE0, 0x07, 0xF8, 0x1C, 0x1E, 0x00, 0x00, 0x01, 0x87, 0xE0, 0xFC,
+    0xF7, 0xFC, 0x0F, 0xF8, 0x0F, 0xFC, 0x01, 0xFF, 0xF8, 0x00, 0x70, 0x00, 0x1F, 0xFC, 0xC0, 0x00,
+    0x18, 0xC0, 0x03, 0xF8, 0x00, 0xFE, 0x38, 0x3C, 0x00, 0x00, 0x01, 0x81, 0xF8, 0x3F, 0xC1, 0xFE,
+    0x3F, 0xFE, 0x1E, 0xFF, 0x00, 0x3F, 0xF8, 0x00, 0x70, 0x01, 0xFF, 0xF8, 0xC0, 0x00, 0x18, 0xC0,
+    0x00, 0xFE, 0x00, 0x3F, 0xF0, 0x38, 0x00, 0x00, 0x01, 0x80, 0x7F, 0x0F, 0xE0, 0x3F, 0xF8, 0x3F,
+    0xFC, 0x1F, 0xE0, 0x0F, 0xF8, 0x00, 0x60, 0x0F, 0xFF, 0xF8, 0xC0, 0x00, 0x18, 0xC0, 0x00, 0x3F,
+    0x80, 0x07, 0xF0, 0x70, 0x00, 0x00, 0x01, 0xE0, 0x1F, 0xC3, 0xF8, 0x0F, 0xF0, 0x1F, 0xF0, 0x7F,
+    0xF8, 0x1E, 0xFF, 0x00, 0xE0, 0x1F, 0xFF, 0xF8, 0xC0, 0x00, 0x18, 0xC0, 0x00, 0xFF, 0xE0, 0x01,
+    0xE0, 0xE0, 0x00, 0x00, 0x01, 0xF8, 0x07, 0xF0, 0xFE, 0x03, 0xF8, 0x3D, 0xFC, 0xF0, 0xFC, 0x3F,
+    0x1F, 0xE0, 0xE0, 0x3E, 0x1F, 0xF8, 0xC0, 0x00, 0x18, 0xC0, 0x01, 0xE1, 0xF8, 0x00, 0x61, 0xC0,
+    0x00, 0x00, 0x00, 0x7E, 0x01, 0xFC, 0x3F, 0xC0, 0xFF, 0xF8, 0x7F, 0xE0, 0x3C, 0x77, 0x07, 0xFC,
+    0xE0, 0x7F, 0x0F, 0xF8, 0xC0, 0x00, 0x18, 0xC0, 0x03, 0xC0, 0x7F, 0x00, 0x63, 0xC0, 0x00, 0x00,
+    0x00, 0x1F, 0x80, 0x7F, 0x07, 0xF0, 0x1F, 0xE0, 0xFF, 0xE0, 0x70, 0xF7, 0x00, 0xFF, 0xE0, 0xFF,
+    0x8F, 0xF8, 0xC0, 0x00, 0x18, 0xC0, 0x03, 0x80, 0x1F, 0xC0, 0x63, 0x80, 0x00, 0x00, 0x00, 0x07,
+    0xE0, 0x1F, 0xC1, 0xFC, 0x07, 0xF1, 0xE3, 0xFC, 0xE1, 0xC7, 0x00, 0x1F, 0xE0, 0xFF, 0xCF, 0xF0,
+    0xC0, 0x00, 0x18, 0xC0, 0x07, 0x00, 0x07, 0xF0, 0x67, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x03,
+    0xF0, 0x7F, 0x1F, 0xFF, 0xC0, 0xFF, 0xC3, 0x87, 0x00, 0x07, 0xE1, 0xFF, 0xCF, 0xF0, 0xC0, 0x00,
+    0x18, 0xC0, 0x0E, 0x00, 0x00, 0xFC, 0x6E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xFC, 0x1F,
+    0xFC, 0x3F, 0x80, 0x1F, 0x87, 0x0E, 0x00, 0x03, 0xE1, 0xFF, 0xCF, 0xF0, 0xC0, 0x00, 0x18, 0xC0,
+    0x0E, 0x00, 0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x03, 0xF8, 0x1F,
+    0xF0, 0x0F, 0x0E, 0x1E, 0x00, 0x07, 0xF3, 0xFF, 0x9F, 0xF1, 0xC0, 0x00, 0x18, 0xC0, 0x0C, 0x00,
+    0x00, 0x7F, 0xFC, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x0F, 0xC0, 0xFE, 0x3D, 0xFC, 0x1E,
+    0x1C, 0x3C, 0x00, 0x0F, 0x7F, 0x7F, 0x1F, 0xF1, 0xC0, 0x00, 0x18, 0xC0, 0x1C, 0x00, 0x00, 0x73,
+    0xF8, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x03, 0xF0, 0x3F, 0xF8, 0x7F, 0x3C, 0x38, 0x78,
+    0x00, 0x0E, 0xBF, 0x0E, 0x3F, 0xE1, 0x80, 0x00, 0x18, 0xC0, 0x1C, 0x00, 0x00, 0x71, 0xF0, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0xFE, 0x0F, 0xE0, 0x3F, 0xF8, 0x70, 0xF0, 0x00, 0x1D,
+    0xFC, 0x0E, 0x3F, 0xE3, 0x80, 0x00, 0x18, 0xC0, 0x18, 0x00, 0x00, 0x71, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x1F, 0x80, 0x3F, 0x81, 0xFC, 0xF3, 0xF0, 0xE1, 0xE0, 0x00, 0x39, 0xF4, 0x1C,
+    0x7F, 0xE3, 0x80, 0x00, 0x18, 0xC0, 0x18, 0x00, 0x00, 0x71, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x07, 0xE0, 0x0F, 0xE0, 0x7F, 0xE1, 0xC1, 0xC3, 0xC0, 0x00, 0x78, 0xEF, 0xB8, 0xFF, 0xE7,
+    0x00, 0x00, 0x18, 0xC0, 0x1C, 0x00, 0x00, 0x71, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01,
+    0xF8, 0x03, 0xF8, 0x1F, 0xC7, 0x87, 0x87, 0x80, 0x00, 0x76, 0x0F, 0xB8, 0xE7, 0xFF, 0x00, 0x00,
+    0x18, 0xC0, 0x1C, 0x00, 0x00, 0x71, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00,
+    0xFE, 0x07, 0xFF, 0x0F, 0x0F, 0x00, 0x00, 0xEF, 0x83, 0x71, 0xC0, 0xFF, 0x00, 0x00, 0x18, 0xC0,
+    0x0C, 0x00, 0x00, 0x71, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x1F, 0x81,
+    0xFE, 0x1E, 0x1E, 0x00, 0x01, 0xCF, 0xB8, 0xE3, 0x80, 0x1F, 0xE0, 0x00, 0x18, 0xC0, 0x0E, 0x00,
+    0x00, 0x71, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xE0, 0x07, 0xE0, 0x3C, 0x3C,
+    0x3C, 0x00, 0x01, 0xC3, 0xBE, 0xE3, 0x80, 0x07, 0xF8, 0x00, 0x18, 0xC0, 0x0F, 0x00, 0x00, 0x71,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xF8, 0x01, 0xF8, 0x08, 0x78, 0x78, 0x00,
+    0x03, 0xF0, 0x3F, 0xC7, 0x00, 0x00, 0xFF, 0x00, 0x18, 0xC0, 0x07, 0x80, 0x00, 0x71, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7E, 0x00, 0x7F, 0x00, 0xF0, 0xF0, 0x00, 0x01, 0xFE,
+    0x0F, 0x8E, 0x00, 0x00, 0x1F, 0xC0, 0x18, 0xC0, 0x03, 0xE0, 0x00, 0x71, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0x80, 0x1F, 0xC1, 0xE1, 0xE0, 0x00, 0x01, 0xFF, 0xC3, 0x8E,
+    0x00, 0x00, 0x07, 0xF8, 0x18, 0xC0, 0x00, 0xF0, 0x00, 0x71, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x07, 0xE0, 0x07, 0xF3, 0xC3, 0xC0, 0x00, 0x01, 0x8F, 0xF7, 0x1C, 0x00, 0x00,
+    0x00, 0xFE, 0x18, 0xC0, 0x00, 0x78, 0x00, 0x71, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xF8, 0x01, 0xFF, 0x87, 0x80, 0x00, 0x01, 0x83, 0xFE, 0x38, 0x00, 0x00, 0x00, 0x3F,
+    0xD8, 0xC0, 0x00, 0x1C, 0x00, 0x71, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0x00, 0x3F, 0x0F, 0x00, 0x00, 0x01, 0xC0, 0x7E, 0x38, 0x00, 0x00, 0x00, 0x07, 0xF8, 0xC0,
+    0x00, 0x0E, 0x00, 0x71, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xC0,
+    0x0E, 0x1E, 0x00, 0x00, 0x01, 0xF8, 0x00, 0x70, 0x00, 0x00, 0x00, 0x01, 0xFE, 0xC0, 0x00, 0x07,
+    0x00, 0x71, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x0E, 0x3C,
+    0x00, 0x00, 0x00, 0xFE, 0x00, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x00, 0x07, 0x00, 0x71,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFC, 0x0E, 0x78, 0x00, 0x00,
+    0x00, 0x3F, 0xE1, 0xE0, 0x00, 0x00, 0x00, 0x00, 0x07, 0xF0, 0x00, 0x03, 0x00, 0x71, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x7F, 0x0E, 0xF0, 0x00, 0x00, 0x00, 0x07,
+    0xFF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x01, 0xFE, 0x00, 0x03, 0x00, 0x71, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x1F, 0xCE, 0xE0, 0x00, 0x00, 0x00, 0x00, 0xFF, 0x80,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x3F, 0xC0, 0x03, 0x00, 0x71, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x07, 0xEF, 0xC0, 0x00, 0x00, 0x00, 0x00, 0x1E, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x0F, 0xF0, 0x03, 0x00, 0x71, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x01, 0xFF, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x01, 0xFE, 0x03, 0x00, 0x71, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x7F, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x7F, 0x83, 0x00, 0x71, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x1E, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x0F, 0xC7,
+    0x00, 0x71, 0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x01, 0xC7, 0x00, 0x71,
+    0x80, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x71, 0x80, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xCE, 0x00, 0x71, 0x80, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xDC, 0x00, 0x71, 0x80, 0x00,
+};
+const asset_image_t home_octo = {
+    .width = 240,
+    .height = 210,
+    .format = ASSET_FMT_MONO_BITS,
+    .palette_size = 0,
+    .palette = NULL,
+    .rows = NULL,
+    .data = home_octo_data,
+};
@@ -16,32 +16,45 @@
 #ifndef ICONS_H
 #define ICONS_H
 
-#include <stdint.h>
-
-// Ícones 24x24 em RGB565 (16-bit)
-extern const uint16_t wifi_main[];
-extern const uint16_t blu_main[];
-extern const uint16_t nfc_main[];
-extern const uint16_t infra_main[];
-extern const uint16_t rf_main[];
-extern const uint16_t sd_main[];
-extern const uint16_t brilho[];
-extern const uint16_t bad[];
-extern const uint16_t Music[];
-extern const uint16_t inatividade[];
-extern const uint16_t conf_main[];
-extern const uint8_t octo_ant[];
-extern const uint8_t octo_ant1[];
-extern const uint16_t scan[];
-extern const uint16_t deauth[];
-extern const uint16_t evil[];
-extern const uint16_t learn[];
-extern const uint16_t controle[];
-extern const uint16_t raw[];
-extern const uint16_t UART[];
-extern const uint16_t icon_file[];
-extern const uint16_t icon_folder[];
-extern const uint16_t analyzer_main[];
+#include "asset.h"
+
+// Imagens compactadas geradas em icons.c por tools/asset_packer.py a partir
+// de assets/icons.manifest. Desenhe com st7789_draw_asset_fb (ícones) e
+// st7789_draw_asset_mono_fb (arte monocromática).
+
+// Ícones 24x24 (PAL_RLE)
+extern const asset_image_t wifi_main;
+extern const asset_image_t blu_main;
+extern const asset_image_t nfc_main;
+extern const asset_image_t infra_main;
+extern const asset_image_t rf_main;
+extern const asset_image_t sd_main;
+extern const asset_image_t brilho;
+extern const asset_image_t bad;
+extern const asset_image_t Music;
+extern const asset_image_t inatividade;
+extern const asset_image_t conf_main;
+extern const asset_image_t scan;
+extern const asset_image_t deauth;
+extern const asset_image_t evil;
+extern const asset_image_t learn;
+extern const asset_image_t controle;
+extern const asset_image_t raw;
+extern const asset_image_t UART;
+extern const asset_image_t icon_file;
+extern const asset_image_t icon_folder;
+extern const asset_image_t analyzer_main;
+
+// Animação de busca do Wi-Fi, 200x179
+extern const asset_image_t octo_ant;
+extern const asset_image_t octo_ant1;
+
+// Tela inicial
+extern const asset_image_t home_wifi;
+extern const asset_image_t home_battery;
+extern const asset_image_t home_sd;
+extern const asset_image_t home_mhz;
+extern const asset_image_t home_octo;
 
 #define ICON_WIDTH  24
 #define ICON_HEIGHT 24
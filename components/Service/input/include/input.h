@@ -0,0 +1,71 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef INPUT_H
+#define INPUT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "input_fsm.h"
+
+// Serviço de entrada: as bordas dos botões são capturadas por interrupção,
+// passam pela máquina de debounce (input_fsm) em uma task própria e viram
+// eventos em uma fila única consumida pela tela ativa.
+
+#define INPUT_WAIT_FOREVER UINT32_MAX
+
+typedef enum {
+    INPUT_BTN_UP = 0,
+    INPUT_BTN_DOWN,
+    INPUT_BTN_LEFT,
+    INPUT_BTN_RIGHT,
+    INPUT_BTN_OK,
+    INPUT_BTN_BACK,
+    INPUT_BTN_COUNT
+} input_button_t;
+
+typedef struct {
+    input_button_t button;
+    input_event_type_t type;
+    uint16_t repeat;               // Contador de repetição (INPUT_EVENT_REPEAT)
+    uint32_t time_ms;              // Instante da borda/prazo que gerou o evento
+} input_event_t;
+
+typedef struct {
+    uint32_t edges;                // Bordas recebidas da ISR
+    uint32_t events;               // Eventos publicados
+    uint32_t dropped;              // Eventos perdidos com a fila cheia
+} input_stats_t;
+
+// Configura os pinos e inicia a task. Pode ser chamada mais de uma vez;
+// input_wait_event() também inicializa sob demanda.
+esp_err_t input_init(void);
+
+// Espera o próximo evento. Retorna false se o tempo esgotar.
+bool input_wait_event(input_event_t *event, uint32_t timeout_ms);
+
+// Descarta eventos pendentes (ao entrar em uma tela nova)
+void input_flush(void);
+
+// Estado já filtrado pelo debounce
+bool input_is_pressed(input_button_t button);
+
+// Pino GPIO do botão (BTN_* de pin_def.h)
+int input_button_gpio(input_button_t button);
+
+void input_get_stats(input_stats_t *stats);
+
+#endif // INPUT_H
@@ -0,0 +1,82 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef INPUT_FSM_H
+#define INPUT_FSM_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+// Máquina de estados de um botão: debounce, pressão longa e repetição.
+// Código C puro, sem FreeRTOS nem drivers: o tempo (em ms) e o nível do pino
+// são passados pelo chamador, então a mesma lógica roda com um relógio falso
+// no host.
+//
+// O debounce é "ansioso": a primeira borda já gera o evento e abre uma janela
+// de bloqueio em que as demais bordas são tratadas como trepidação. No fim da
+// janela o nível real é conferido; se mudou, o novo estado é confirmado. Assim
+// um toque mais curto que a janela não se perde e não há latência de debounce.
+
+#define INPUT_FSM_NO_DEADLINE UINT32_MAX
+
+typedef enum {
+    INPUT_EVENT_PRESS = 0,
+    INPUT_EVENT_RELEASE,
+    INPUT_EVENT_LONG_PRESS,
+    INPUT_EVENT_REPEAT
+} input_event_type_t;
+
+typedef struct {
+    uint16_t debounce_ms;
+    uint16_t long_press_ms;        // 0 = sem pressão longa
+    uint16_t repeat_delay_ms;      // 0 = sem repetição
+    uint16_t repeat_interval_ms;
+} input_timing_t;
+
+typedef struct {
+    input_event_type_t type;
+    uint16_t repeat;               // Repetições desde o PRESS (só em REPEAT)
+    uint32_t time_ms;
+} input_fsm_event_t;
+
+typedef struct {
+    const input_timing_t *timing;
+    bool pressed;                  // Estado confirmado
+    bool locked;                   // Dentro da janela de debounce
+    bool edge_pending;             // Borda ainda não processada
+    bool held;                     // Pressionado com PRESS emitido: arma longa/repetição
+    bool long_sent;
+    uint16_t repeat_count;
+    uint32_t lock_until;
+    uint32_t edge_time;
+    uint32_t pressed_at;
+    uint32_t next_repeat;
+} input_fsm_t;
+
+void input_fsm_init(input_fsm_t *fsm, const input_timing_t *timing, bool pressed);
+
+// Registra uma borda vista pela interrupção no instante now_ms
+void input_fsm_edge(input_fsm_t *fsm, uint32_t now_ms);
+
+// Avança a máquina até now_ms. `pressed` é o nível atual do pino já
+// convertido para "pressionado". Gera no máximo um evento por chamada:
+// chame em laço enquanto retornar true.
+bool input_fsm_poll(input_fsm_t *fsm, uint32_t now_ms, bool pressed, input_fsm_event_t *event);
+
+// Milissegundos até a próxima chamada necessária de input_fsm_poll()
+// (0 = já vencido, INPUT_FSM_NO_DEADLINE = só na próxima borda)
+uint32_t input_fsm_next_deadline(const input_fsm_t *fsm, uint32_t now_ms);
+
+#endif // INPUT_FSM_H
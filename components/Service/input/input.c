@@ -0,0 +1,234 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "input.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "driver/gpio.h"
+#include "esp_timer.h"
+#include "esp_attr.h"
+#include "esp_log.h"
+#include "pin_def.h"
+
+#define TAG "INPUT"
+
+#define INPUT_TASK_STACK    3072
+#define INPUT_TASK_PRIO     10
+#define EDGE_QUEUE_LEN      32
+#define EVENT_QUEUE_LEN     16
+
+typedef struct {
+    uint8_t button;
+    uint32_t time_ms;
+} edge_t;
+
+// Direcionais repetem ao segurar; OK e Voltar geram pressão longa
+static const input_timing_t nav_timing = {
+    .debounce_ms = 30,
+    .long_press_ms = 0,
+    .repeat_delay_ms = 400,
+    .repeat_interval_ms = 120,
+};
+
+static const input_timing_t action_timing = {
+    .debounce_ms = 30,
+    .long_press_ms = 800,
+    .repeat_delay_ms = 0,
+    .repeat_interval_ms = 0,
+};
+
+static const struct {
+    gpio_num_t gpio;
+    const input_timing_t *timing;
+} buttons[INPUT_BTN_COUNT] = {
+    [INPUT_BTN_UP]    = { BTN_UP,    &nav_timing },
+    [INPUT_BTN_DOWN]  = { BTN_DOWN,  &nav_timing },
+    [INPUT_BTN_LEFT]  = { BTN_LEFT,  &nav_timing },
+    [INPUT_BTN_RIGHT] = { BTN_RIGHT, &nav_timing },
+    [INPUT_BTN_OK]    = { BTN_OK,    &action_timing },
+    [INPUT_BTN_BACK]  = { BTN_BACK,  &action_timing },
+};
+
+static QueueHandle_t edge_queue = NULL;
+static QueueHandle_t event_queue = NULL;
+static TaskHandle_t input_task_handle = NULL;
+static input_fsm_t fsm[INPUT_BTN_COUNT];
+static input_stats_t stats;
+
+static inline uint32_t now_ms(void) {
+    return (uint32_t)(esp_timer_get_time() / 1000);
+}
+
+// Botões com pull-up: nível baixo = pressionado
+static inline bool gpio_pressed(input_button_t button) {
+    return gpio_get_level(buttons[button].gpio) == 0;
+}
+
+static void IRAM_ATTR button_isr(void *arg) {
+    edge_t edge = {
+        .button = (uint8_t)(uintptr_t)arg,
+        .time_ms = (uint32_t)(esp_timer_get_time() / 1000),
+    };
+    BaseType_t woken = pdFALSE;
+    xQueueSendFromISR(edge_queue, &edge, &woken);
+    if (woken) {
+        portYIELD_FROM_ISR();
+    }
+}
+
+static void publish(input_button_t button, const input_fsm_event_t *e) {
+    input_event_t event = {
+        .button = button,
+        .type = e->type,
+        .repeat = e->repeat,
+        .time_ms = e->time_ms,
+    };
+    // Fila cheia: ninguém está consumindo, o evento novo é descartado
+    if (xQueueSend(event_queue, &event, 0) == pdTRUE) {
+        stats.events++;
+    } else {
+        stats.dropped++;
+    }
+}
+
+// Dorme até a próxima borda ou o prazo mais próximo entre os botões
+static void input_task(void *arg) {
+    while (1) {
+        uint32_t now = now_ms();
+        uint32_t wait = INPUT_FSM_NO_DEADLINE;
+        for (int i = 0; i < INPUT_BTN_COUNT; i++) {
+            uint32_t d = input_fsm_next_deadline(&fsm[i], now);
+            if (d < wait) wait = d;
+        }
+
+        TickType_t ticks = portMAX_DELAY;
+        if (wait != INPUT_FSM_NO_DEADLINE) {
+            // Arredonda para cima para não acordar antes do prazo
+            ticks = (wait + portTICK_PERIOD_MS - 1) / portTICK_PERIOD_MS;
+        }
+
+        edge_t edge;
+        if (xQueueReceive(edge_queue, &edge, ticks) == pdTRUE) {
+            do {
+                stats.edges++;
+                input_fsm_edge(&fsm[edge.button], edge.time_ms);
+            } while (xQueueReceive(edge_queue, &edge, 0) == pdTRUE);
+        }
+
+        now = now_ms();
+        for (int i = 0; i < INPUT_BTN_COUNT; i++) {
+            input_fsm_event_t e;
+            while (input_fsm_poll(&fsm[i], now, gpio_pressed(i), &e)) {
+                publish(i, &e);
+            }
+        }
+    }
+}
+
+// Desfaz uma inicialização que falhou: a próxima chamada recomeça do zero
+static void input_release(bool handlers_added) {
+    if (handlers_added) {
+        // A ISR usa edge_queue: sai antes da fila
+        for (int i = 0; i < INPUT_BTN_COUNT; i++) {
+            gpio_isr_handler_remove(buttons[i].gpio);
+        }
+    }
+    if (edge_queue) {
+        vQueueDelete(edge_queue);
+        edge_queue = NULL;
+    }
+    if (event_queue) {
+        vQueueDelete(event_queue);
+        event_queue = NULL;
+    }
+}
+
+esp_err_t input_init(void) {
+    if (input_task_handle) {
+        return ESP_OK;
+    }
+
+    edge_queue = xQueueCreate(EDGE_QUEUE_LEN, sizeof(edge_t));
+    event_queue = xQueueCreate(EVENT_QUEUE_LEN, sizeof(input_event_t));
+    if (!edge_queue || !event_queue) {
+        input_release(false);
+        return ESP_ERR_NO_MEM;
+    }
+
+    uint64_t mask = 0;
+    for (int i = 0; i < INPUT_BTN_COUNT; i++) {
+        mask |= 1ULL << buttons[i].gpio;
+    }
+    gpio_config_t io_conf = {
+        .intr_type = GPIO_INTR_ANYEDGE,
+        .mode = GPIO_MODE_INPUT,
+        .pin_bit_mask = mask,
+        .pull_up_en = GPIO_PULLUP_ENABLE,
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+    };
+    esp_err_t ret = gpio_config(&io_conf);
+    if (ret != ESP_OK) {
+        input_release(false);
+        return ret;
+    }
+
+    // O serviço de ISR pode já ter sido instalado por outro módulo
+    ret = gpio_install_isr_service(0);
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+        ESP_LOGE(TAG, "Falha ao instalar serviço de ISR: %s", esp_err_to_name(ret));
+        input_release(false);
+        return ret;
+    }
+
+    for (int i = 0; i < INPUT_BTN_COUNT; i++) {
+        input_fsm_init(&fsm[i], buttons[i].timing, gpio_pressed(i));
+        gpio_isr_handler_add(buttons[i].gpio, button_isr, (void *)(uintptr_t)i);
+    }
+
+    if (xTaskCreate(input_task, "input_task", INPUT_TASK_STACK, NULL, INPUT_TASK_PRIO, &input_task_handle) != pdPASS) {
+        ESP_LOGE(TAG, "Falha ao criar task de entrada");
+        input_task_handle = NULL;
+        input_release(true);
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+bool input_wait_event(input_event_t *event, uint32_t timeout_ms) {
+    if (input_init() != ESP_OK) return false;
+    TickType_t ticks = timeout_ms == INPUT_WAIT_FOREVER ? portMAX_DELAY : pdMS_TO_TICKS(timeout_ms);
+    return xQueueReceive(event_queue, event, ticks) == pdTRUE;
+}
+
+void input_flush(void) {
+    if (event_queue) {
+        xQueueReset(event_queue);
+    }
+}
+
+bool input_is_pressed(input_button_t button) {
+    if (button >= INPUT_BTN_COUNT) return false;
+    return fsm[button].pressed;
+}
+
+int input_button_gpio(input_button_t button) {
+    if (button >= INPUT_BTN_COUNT) return -1;
+    return buttons[button].gpio;
+}
+
+void input_get_stats(input_stats_t *out) {
+    if (out) *out = stats;
+}
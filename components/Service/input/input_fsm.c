@@ -0,0 +1,124 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "input_fsm.h"
+#include <string.h>
+
+// Comparação de tempo tolerante ao estouro do contador de 32 bits
+static bool time_reached(uint32_t now, uint32_t deadline) {
+    return (int32_t)(now - deadline) >= 0;
+}
+
+void input_fsm_init(input_fsm_t *fsm, const input_timing_t *timing, bool pressed) {
+    memset(fsm, 0, sizeof(*fsm));
+    fsm->timing = timing;
+    fsm->pressed = pressed;
+}
+
+void input_fsm_edge(input_fsm_t *fsm, uint32_t now_ms) {
+    if (fsm->edge_pending) return;
+    if (fsm->locked && !time_reached(now_ms, fsm->lock_until)) return;   // Trepidação
+    fsm->edge_pending = true;
+    fsm->edge_time = now_ms;
+}
+
+// Confirma o novo estado e abre a janela de debounce a partir de `when`
+static void commit(input_fsm_t *fsm, bool pressed, uint32_t when, input_fsm_event_t *event) {
+    fsm->pressed = pressed;
+    fsm->held = pressed;
+    fsm->locked = true;
+    fsm->lock_until = when + fsm->timing->debounce_ms;
+
+    event->type = pressed ? INPUT_EVENT_PRESS : INPUT_EVENT_RELEASE;
+    event->repeat = 0;
+    event->time_ms = when;
+
+    if (pressed) {
+        fsm->pressed_at = when;
+        fsm->long_sent = fsm->timing->long_press_ms == 0;
+        fsm->repeat_count = 0;
+        fsm->next_repeat = when + fsm->timing->repeat_delay_ms;
+    }
+}
+
+bool input_fsm_poll(input_fsm_t *fsm, uint32_t now_ms, bool pressed, input_fsm_event_t *event) {
+    const input_timing_t *t = fsm->timing;
+
+    if (fsm->locked && time_reached(now_ms, fsm->lock_until)) {
+        fsm->locked = false;
+        // O nível mudou durante a janela e ficou estável: confirma agora
+        if (!fsm->edge_pending && pressed != fsm->pressed) {
+            commit(fsm, pressed, now_ms, event);
+            return true;
+        }
+    }
+
+    if (fsm->edge_pending && !fsm->locked) {
+        fsm->edge_pending = false;
+        // A borda sempre inverte o estado confirmado, mesmo que o pino já
+        // tenha voltado: é o que preserva toques curtos
+        commit(fsm, !fsm->pressed, fsm->edge_time, event);
+        return true;
+    }
+
+    if (!fsm->held) return false;
+
+    if (!fsm->long_sent && time_reached(now_ms, fsm->pressed_at + t->long_press_ms)) {
+        fsm->long_sent = true;
+        event->type = INPUT_EVENT_LONG_PRESS;
+        event->repeat = 0;
+        event->time_ms = fsm->pressed_at + t->long_press_ms;
+        return true;
+    }
+
+    if (t->repeat_delay_ms && fsm->repeat_count < UINT16_MAX && time_reached(now_ms, fsm->next_repeat)) {
+        event->type = INPUT_EVENT_REPEAT;
+        event->repeat = ++fsm->repeat_count;
+        event->time_ms = fsm->next_repeat;
+        fsm->next_repeat += t->repeat_interval_ms;
+        // Se a task atrasou, não despeja uma rajada de repetições
+        if (time_reached(now_ms, fsm->next_repeat)) {
+            fsm->next_repeat = now_ms + t->repeat_interval_ms;
+        }
+        return true;
+    }
+
+    return false;
+}
+
+static uint32_t until(uint32_t now, uint32_t deadline) {
+    return time_reached(now, deadline) ? 0 : deadline - now;
+}
+
+uint32_t input_fsm_next_deadline(const input_fsm_t *fsm, uint32_t now_ms) {
+    const input_timing_t *t = fsm->timing;
+    uint32_t next = INPUT_FSM_NO_DEADLINE;
+
+    if (fsm->edge_pending && !fsm->locked) return 0;
+    if (fsm->locked) {
+        next = until(now_ms, fsm->lock_until);
+    }
+    if (fsm->held) {
+        if (!fsm->long_sent) {
+            uint32_t d = until(now_ms, fsm->pressed_at + t->long_press_ms);
+            if (d < next) next = d;
+        }
+        if (t->repeat_delay_ms) {
+            uint32_t d = until(now_ms, fsm->next_repeat);
+            if (d < next) next = d;
+        }
+    }
+    return next;
+}
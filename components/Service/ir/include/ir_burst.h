@@ -18,51 +18,105 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+// Transmissão em burst de todos os sinais de um diretório (ou de uma lista
+// de arquivos), pelo serviço de TX. Os arquivos são lidos um a um, direto do
+// readdir, e cada sinal é preparado (lido em sequência numa passada só pelo
+// arquivo, convertido e, se raw, já codificado em símbolos do RMT) enquanto
+// o anterior está no ar. Como o sinal seguinte já está na fila do serviço
+// quando o atual termina, os sinais saem colados, separados só pelo silêncio
+// gerado pelo próprio RMT:
+//   parsed  o período de repetição do protocolo (ir_tx.h)
+//   raw     gap_us
+//
+// O progresso chega ao handler na task que chamou ir_burst_run(), e cada
+// evento é um ponto de cancelamento: o handler retorna false para parar. Os
+// sinais que já estavam na fila ainda saem (no máximo
+// IR_BURST_PIPELINE_DEPTH) e também geram evento.
+
+#define IR_BURST_PIPELINE_DEPTH     2       // Sinais entregues ao TX (um no ar, um pronto)
+#define IR_BURST_DEFAULT_GAP_US     20000   // Silêncio após um sinal raw
+
 /**
  * @brief Configuração de burst IR
  */
 typedef struct {
-    uint32_t delay_between_files_ms;  ///< Delay entre cada arquivo (ms)
-    uint32_t repeat_each_file;        ///< Quantas vezes repetir cada arquivo
-    uint32_t delay_between_repeats_ms;///< Delay entre repetições do mesmo arquivo (ms)
-    bool stop_on_error;               ///< Parar se houver erro (false = continuar)
+    const char *dir;        ///< Diretório dos arquivos .ir (NULL = IR_STORAGE_BASE_PATH)
+    uint8_t repeats;        ///< Parsed: quadros além do primeiro (até IR_TX_MAX_REPEATS)
+    uint32_t gap_us;        ///< Raw: silêncio após o sinal (0 = IR_BURST_DEFAULT_GAP_US)
+    bool stop_on_error;     ///< Parar na primeira falha de transmissão
 } ir_burst_config_t;
 
 /**
- * @brief Transmite todos os arquivos .ir encontrados no cartão SD
- *
- * @param config Configuração do burst (NULL = usa padrões)
- * @return int Número de arquivos transmitidos com sucesso
+ * @brief Contadores do burst
  */
-int ir_burst_send_all_files(const ir_burst_config_t *config);
+typedef struct {
+    uint32_t files;             ///< Arquivos abertos
+    uint32_t sent;              ///< Sinais transmitidos
+    uint32_t failed;            ///< Falhas de transmissão
+    uint32_t skipped;           ///< Sinais ou arquivos que não puderam ser preparados
+    int64_t elapsed_us;         ///< Do primeiro envio ao fim do último
+    uint64_t air_us;            ///< Tempo no ar dos sinais transmitidos (quadros e silêncios)
+    float signals_per_s;        ///< Obtido: sent / elapsed_us
+    float air_signals_per_s;    ///< Teórico: sent / air_us
+    bool cancelled;
+} ir_burst_stats_t;
+
+typedef enum {
+    IR_BURST_EVENT_FILE,        ///< Arquivo aberto
+    IR_BURST_EVENT_SENT,        ///< Sinal terminou de sair (result)
+    IR_BURST_EVENT_SKIPPED,     ///< Sinal ou arquivo não preparado (result)
+    IR_BURST_EVENT_DONE,        ///< Fim do burst (o retorno é ignorado)
+} ir_burst_event_type_t;
 
 /**
- * @brief Transmite lista específica de arquivos
+ * @brief Evento de progresso
+ */
+typedef struct {
+    ir_burst_event_type_t type;
+    const char *file;               ///< Arquivo, sem extensão
+    const char *signal;             ///< Nome do sinal (NULL em FILE e DONE)
+    esp_err_t result;
+    const ir_burst_stats_t *stats;  ///< Contadores até aqui
+} ir_burst_event_t;
+
+/**
+ * @brief Handler de progresso
  *
- * @param filenames Array de nomes de arquivos (sem extensão .ir)
- * @param count Número de arquivos no array
- * @param config Configuração do burst (NULL = usa padrões)
- * @return int Número de arquivos transmitidos com sucesso
+ * @return false para cancelar o burst
  */
-int ir_burst_send_file_list(const char **filenames, uint32_t count,
-                            const ir_burst_config_t *config);
+typedef bool (*ir_burst_handler_t)(const ir_burst_event_t *event, void *ctx);
 
 /**
- * @brief Para transmissão em progresso (se estiver rodando em outra task)
+ * @brief Transmite todos os sinais dos arquivos .ir de config->dir
+ *
+ * @param config Configuração (NULL = padrões)
+ * @param handler Progresso e cancelamento (NULL = sem eventos)
+ * @param ctx Repassado ao handler
+ * @param stats Contadores finais (opcional)
+ * @return ESP_OK (também se cancelado), ESP_ERR_NOT_FOUND se o diretório
+ *         não abrir, ESP_ERR_NO_MEM, o erro do serviço de TX ou, com
+ *         stop_on_error, o erro da falha
  */
-void ir_burst_stop(void);
+esp_err_t ir_burst_run(const ir_burst_config_t *config, ir_burst_handler_t handler,
+                       void *ctx, ir_burst_stats_t *stats);
 
 /**
- * @brief Verifica se burst está em execução
+ * @brief Transmite todos os sinais de uma lista de arquivos
  *
- * @return true se burst está ativo
+ * @param filenames Nomes dos arquivos (sem extensão .ir), em config->dir
+ * @param count Número de arquivos
+ * @return Como ir_burst_run; ESP_ERR_INVALID_ARG com lista vazia
  */
-bool ir_burst_is_running(void);
+esp_err_t ir_burst_run_files(const char **filenames, size_t count,
+                             const ir_burst_config_t *config, ir_burst_handler_t handler,
+                             void *ctx, ir_burst_stats_t *stats);
 
 #ifdef __cplusplus
 }
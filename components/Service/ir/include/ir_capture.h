@@ -0,0 +1,133 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef IR_CAPTURE_H
+#define IR_CAPTURE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "driver/rmt_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Captura contínua do receptor IR. O RMT entrega a recepção em partes
+// (recepção parcial) e o callback as concatena num de dois buffers grandes;
+// a captura termina quando o sinal fica parado por idle_us. Nesse momento o
+// buffer cheio vai para a fila de capturas prontas e o callback já rearma a
+// recepção no outro buffer, então quadros colados (repetições enquanto a
+// tecla está pressionada) não se perdem.
+//
+// Quem consome recebe o buffer com ir_capture_wait() e o devolve com
+// ir_capture_release(). Enquanto ele não for devolvido só há um buffer
+// livre: se a captura seguinte terminar antes disso ela é descartada e
+// contada em ir_capture_dropped().
+
+#define IR_CAPTURE_MAX_SYMBOLS      512     // Por captura (1024 tempos no formato raw)
+#define IR_CAPTURE_DEFAULT_IDLE_US  20000   // Silêncio que encerra uma captura
+#define IR_CAPTURE_MAX_IDLE_US      32000   // Limite do RMT: 15 bits de ticks a 1 MHz
+#define IR_CAPTURE_RAW_FREQUENCY    38000   // O receptor não mede a portadora
+
+/**
+ * @brief Configuração da captura
+ */
+typedef struct {
+    uint32_t idle_us;   ///< Silêncio que encerra a captura (0 = padrão, até IR_CAPTURE_MAX_IDLE_US)
+} ir_capture_config_t;
+
+/**
+ * @brief Captura completa
+ *
+ * Os símbolos pertencem ao motor e valem até ir_capture_release().
+ */
+typedef struct {
+    const rmt_symbol_word_t *symbols;
+    size_t num_symbols;
+    int64_t start_us;   ///< esp_timer no início da primeira marca
+    int64_t end_us;     ///< esp_timer no fim do último pulso
+    uint32_t seq;       ///< Ordem desde ir_capture_start(), contando descartadas
+    bool truncated;     ///< Passou de IR_CAPTURE_MAX_SYMBOLS
+    uint8_t buffer;     ///< Buffer de origem (uso interno)
+} ir_capture_t;
+
+/**
+ * @brief Cria o canal RMT de RX e começa a capturar
+ *
+ * @param config Configuração (NULL = padrão)
+ * @return ESP_OK, ESP_ERR_INVALID_STATE se já estiver capturando,
+ *         ESP_ERR_INVALID_ARG, ESP_ERR_NO_MEM ou o erro do driver RMT
+ */
+esp_err_t ir_capture_start(const ir_capture_config_t *config);
+
+/**
+ * @brief Para a captura e libera o canal
+ *
+ * Capturas prontas e não consumidas são descartadas.
+ *
+ * @return ESP_OK, ESP_ERR_INVALID_STATE se não estiver capturando
+ */
+esp_err_t ir_capture_stop(void);
+
+bool ir_capture_is_running(void);
+
+/**
+ * @brief Aguarda a próxima captura completa
+ *
+ * @param capture Captura recebida
+ * @param timeout_ms Timeout em milissegundos
+ * @return ESP_OK, ESP_ERR_TIMEOUT ou ESP_ERR_INVALID_STATE
+ */
+esp_err_t ir_capture_wait(ir_capture_t *capture, uint32_t timeout_ms);
+
+/**
+ * @brief Devolve o buffer de uma captura ao motor
+ */
+void ir_capture_release(const ir_capture_t *capture);
+
+/**
+ * @brief Capturas descartadas desde ir_capture_start() (buffer não devolvido a tempo)
+ */
+uint32_t ir_capture_dropped(void);
+
+/**
+ * @brief Converte a captura em tempos alternados marca/espaço (us)
+ *
+ * Níveis iguais consecutivos são somados; começa e termina numa marca,
+ * como no formato raw do Flipper.
+ *
+ * @param capture Captura
+ * @param timings Tempos de saída
+ * @param max_timings Capacidade de timings
+ * @return Número de tempos (0 se não couber)
+ */
+size_t ir_capture_timings(const ir_capture_t *capture, uint32_t *timings, size_t max_timings);
+
+/**
+ * @brief Salva a captura como sinal raw (ir_save_raw)
+ *
+ * @param capture Captura
+ * @param filename Nome do arquivo (sem extensão .ir)
+ * @return true em sucesso
+ */
+bool ir_capture_save_raw(const ir_capture_t *capture, const char *filename);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // IR_CAPTURE_H
@@ -77,11 +77,24 @@ esp_err_t ir_tx_send_sony(ir_context_t *ctx, uint16_t address, uint8_t command,
 /**
  * @brief Envia código IR a partir de arquivo
  *
+ * Usa o serviço de TX (ir_tx.h), iniciado no primeiro envio.
+ *
  * @param filename Nome do arquivo (sem extensão .ir)
  * @return true em sucesso
  */
 bool ir_tx_send_from_file(const char* filename);
 
+/**
+ * @brief Envia um sinal pelo nome, de um arquivo com vários sinais
+ *
+ * Sinais raw são transmitidos com a portadora e o duty cycle do arquivo.
+ *
+ * @param filename Nome do arquivo (sem extensão .ir)
+ * @param name Nome do sinal (linha "name:")
+ * @return true em sucesso
+ */
+bool ir_tx_send_signal(const char* filename, const char* name);
+
 /**
  * @brief Reseta o estado do toggle bit do RC6
  */
@@ -112,22 +125,26 @@ bool ir_rx_wait_for_data(ir_context_t *ctx, rmt_rx_done_event_data_t *rx_data, u
 /**
  * @brief Recebe e salva sinal IR em arquivo
  *
+ * Decodifica NEC, Samsung32, SIRC, RC5 e RC6 (ir_decoder.h) e salva o
+ * primeiro quadro reconhecido. Usa a captura contínua (ir_capture.h):
+ * capturas sem quadro reconhecido são ignoradas até o timeout.
+ *
  * @param filename Nome do arquivo (sem extensão)
  * @param timeout_ms Timeout em milissegundos
- * @return true em sucesso
+ * @return true se um quadro foi reconhecido e salvo
  */
 bool ir_receive(const char* filename, uint32_t timeout_ms);
 
-// ========== Parsers ==========
-
-/**
- * @brief Parse de frame NEC
- */
-void parse_nec_frame(rmt_symbol_word_t *symbols, size_t num_symbols, const char* filename);
-
 /**
- * @brief Parse de frame RC6
+ * @brief Recebe e salva sinal IR sem decodificar (type: raw)
+ *
+ * Para controles de ar-condicionado e outros protocolos não suportados:
+ * salva a primeira captura completa (até IR_CAPTURE_MAX_SYMBOLS símbolos).
+ *
+ * @param filename Nome do arquivo (sem extensão)
+ * @param timeout_ms Timeout em milissegundos
+ * @return true se uma captura foi salva
  */
-void parse_rc6_frame(rmt_symbol_word_t *symbols, size_t num_symbols, const char* filename);
+bool ir_receive_raw(const char* filename, uint32_t timeout_ms);
 
 #endif // IR_COMMON_H
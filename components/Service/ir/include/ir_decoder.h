@@ -0,0 +1,126 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef IR_DECODER_H
+#define IR_DECODER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "driver/rmt_types.h"
+#include "ir_encoder.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Decodificação multiprotocolo. A captura é convertida em pulsos (marca ou
+// espaço, em us, com níveis iguais consecutivos somados) e cada pulso é
+// entregue a todos os decoders ao mesmo tempo, numa única passada. Cada
+// protocolo é uma máquina de estados sem alocação que aceita, rejeita ou
+// conclui um quadro; o primeiro a concluir vence.
+//
+// Um quadro só começa numa marca depois de silêncio (início da captura ou
+// espaço >= IR_DECODE_IDLE_US) e só termina quando esse silêncio volta, o
+// que evita reconhecer pedaços de um protocolo no meio de outro.
+
+#define IR_DECODE_IDLE_US       5000    // Silêncio entre quadros (SIRC 20 bits: 5,4 ms)
+#define IR_DECODE_TOLERANCE     4       // Pulsos: +/- 1/4 do valor nominal...
+#define IR_DECODE_SLACK_US      50      // ...mais uma folga fixa
+
+/**
+ * @brief Quadro decodificado
+ */
+typedef struct {
+    ir_protocol_t protocol;
+    uint32_t address;
+    uint32_t command;
+    uint8_t toggle;     ///< RC5/RC6; 0xFF nos demais
+    uint8_t bits;       ///< SIRC: 12, 15 ou 20; 0xFF nos demais
+    bool repeat;        ///< Código de repetição NEC ou quadro igual ao anterior
+} ir_decode_result_t;
+
+typedef enum {
+    IR_DECODE_MORE,     ///< Pulso aceito, quadro incompleto
+    IR_DECODE_DONE,     ///< Quadro completo em result
+    IR_DECODE_FAIL,     ///< Pulso não pertence ao protocolo
+} ir_decode_status_t;
+
+/**
+ * @brief Estado de um decoder (zerado no início de cada quadro)
+ */
+typedef struct {
+    uint8_t step;       ///< Posição na máquina de estados
+    uint8_t count;      ///< Bits recebidos
+    uint8_t phase;      ///< Manchester: meio bit atual (0 ou 1)
+    uint8_t fill;       ///< Manchester: unidades T no meio bit atual
+    bool level;         ///< Manchester: nível do primeiro meio bit
+    uint32_t data;
+} ir_decoder_state_t;
+
+/**
+ * @brief Decoder de um protocolo
+ *
+ * feed() recebe um pulso por vez, alternando marca e espaço; o espaço final
+ * tem pelo menos IR_DECODE_IDLE_US.
+ */
+typedef struct {
+    ir_protocol_t protocol;
+    ir_decode_status_t (*feed)(ir_decoder_state_t *state, bool mark, uint32_t duration_us,
+                               ir_decode_result_t *result);
+} ir_decoder_t;
+
+/**
+ * @brief Decodifica uma captura do RMT RX (1 tick = 1 us)
+ *
+ * @param symbols Símbolos recebidos
+ * @param num_symbols Quantidade de símbolos
+ * @param results Quadros decodificados, na ordem da captura
+ * @param max_results Capacidade de results
+ * @return Número de quadros decodificados
+ */
+size_t ir_decode(const rmt_symbol_word_t *symbols, size_t num_symbols,
+                 ir_decode_result_t *results, size_t max_results);
+
+// ========== Auxiliares para os decoders ==========
+
+/**
+ * @brief Duração dentro da tolerância do valor nominal
+ */
+bool ir_decode_match(uint32_t duration_us, uint32_t spec_us);
+
+/**
+ * @brief Duração em unidades T (Manchester)
+ *
+ * @return 1..max_units, ou 0 se não for múltiplo de T dentro de +/- 0,4 T
+ */
+uint8_t ir_decode_units(uint32_t duration_us, uint32_t unit_us, uint8_t max_units);
+
+/**
+ * @brief Entrega uma unidade T a um decoder Manchester
+ *
+ * Cada bit tem dois meios bits de width unidades, com níveis opostos; o
+ * bit vale 1 quando o primeiro meio bit é marca (RC6; o RC5 inverte).
+ *
+ * @return 1 quando um bit foi completado (em state->data), 0 se falta
+ *         unidade, -1 se a sequência não é Manchester válida
+ */
+int ir_decode_manchester(ir_decoder_state_t *state, bool mark, uint8_t width);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // IR_DECODER_H
@@ -33,6 +33,7 @@ typedef enum {
     IR_PROTOCOL_RC5,
     IR_PROTOCOL_SAMSUNG32,
     IR_PROTOCOL_SIRC,
+    IR_PROTOCOL_COUNT,  ///< Número de protocolos (não é um protocolo)
 } ir_protocol_t;
 
 /**
@@ -0,0 +1,193 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef IR_LIBRARY_H
+#define IR_LIBRARY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "ir_storage.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Bibliotecas .ir no formato do Flipper: vários sinais com nome por arquivo,
+// parsed ou raw. Cada arquivo é lido uma vez e vira um índice compacto em RAM
+// (posição de cada sinal no arquivo, campos parsed e nome numa tabela hash),
+// então achar um botão pelo nome não relê o arquivo. O índice é refeito se o
+// tamanho ou a data do arquivo mudarem por fora.
+//
+// Alterações mexem só no sinal envolvido:
+//   append   escreve o bloco novo no fim do arquivo
+//   delete   trunca o arquivo se o sinal é o último; senão cobre o bloco com
+//            linhas de '#' do mesmo tamanho (comentários, ignorados por
+//            qualquer leitor)
+//   rename   nome do mesmo tamanho é trocado no lugar; senão o sinal é
+//            copiado com o nome novo para o fim e o bloco antigo é coberto
+// ir_library_compact() reescreve o arquivo sem as linhas cobertas.
+//
+// Endereço e comando seguem o formato do Flipper ("07 00 00 00", bytes em
+// little-endian) e são convertidos para os valores que os encoders usam
+// (ir_code_t): no NEC e no Samsung32 o Flipper guarda só o byte útil e o
+// encoder espera os 16 bits transmitidos. Arquivos antigos, com um número
+// hexadecimal único ("00000007"), são lidos sem conversão.
+
+#define IR_LIBRARY_NAME_MAX     32      // Nome do sinal, com o '\0'
+#define IR_LIBRARY_MAX_SIGNALS  512     // Por arquivo
+#define IR_LIBRARY_MAX_TIMINGS  1024    // Sinal raw (limite do Flipper)
+#define IR_LIBRARY_CACHE_FILES  4       // Índices mantidos em RAM
+
+typedef enum {
+    IR_SIGNAL_PARSED,
+    IR_SIGNAL_RAW,
+} ir_signal_type_t;
+
+/**
+ * @brief Sinal de uma biblioteca
+ */
+typedef struct {
+    char name[IR_LIBRARY_NAME_MAX];
+    ir_signal_type_t type;
+    ir_code_t code;         ///< Parsed: protocolo como no arquivo, valores dos encoders
+    uint32_t frequency;     ///< Raw: portadora em Hz
+    float duty_cycle;       ///< Raw
+    size_t num_timings;     ///< Raw: tempos em data
+} ir_signal_t;
+
+/**
+ * @brief Contadores do cache de índices
+ */
+typedef struct {
+    uint32_t hits;          ///< Consultas atendidas por um índice já em RAM
+    uint32_t builds;        ///< Índices montados lendo o arquivo
+    uint32_t rebuilds;      ///< Arquivos alterados por fora (índice refeito)
+} ir_library_stats_t;
+
+/* ============================================================================
+ * CONSULTA
+ * ============================================================================ */
+
+/**
+ * @brief Número de sinais no arquivo
+ *
+ * @return ESP_OK, ESP_ERR_NOT_FOUND se o arquivo não existe,
+ *         ESP_ERR_INVALID_RESPONSE se não é um arquivo IR
+ */
+esp_err_t ir_library_count(const char *path, size_t *count);
+
+/**
+ * @brief Sinal pela posição no arquivo (0 = primeiro)
+ */
+esp_err_t ir_library_get(const char *path, size_t index, ir_signal_t *signal);
+
+/**
+ * @brief Sinal pelo nome (o primeiro, se houver repetidos)
+ *
+ * @return ESP_OK, ESP_ERR_NOT_FOUND ou o erro de leitura do arquivo
+ */
+esp_err_t ir_library_find(const char *path, const char *name, ir_signal_t *signal);
+
+/**
+ * @brief Lê os tempos de um sinal raw (us, alternando marca e espaço)
+ *
+ * @param count Tempos lidos
+ * @return ESP_OK, ESP_ERR_NOT_FOUND, ESP_ERR_INVALID_ARG se o sinal não é
+ *         raw, ESP_ERR_INVALID_SIZE se não couber em max_timings
+ */
+esp_err_t ir_library_read_raw(const char *path, const char *name,
+                              uint32_t *timings, size_t max_timings, size_t *count);
+
+/* ============================================================================
+ * LEITURA EM SEQUÊNCIA
+ * ============================================================================ */
+
+// Percorre o arquivo uma vez, do início ao fim, sem passar pelo índice: para
+// quem usa todos os sinais em ordem (burst), que pelo índice abriria o
+// arquivo de novo a cada sinal raw. O cursor tem o próprio FILE e não usa o
+// lock da biblioteca; alterações no arquivo durante a leitura não são vistas.
+
+typedef struct ir_library_cursor ir_library_cursor_t;
+
+/**
+ * @brief Abre o arquivo e confere o cabeçalho
+ *
+ * @return ESP_OK, ESP_ERR_NOT_FOUND se o arquivo não existe,
+ *         ESP_ERR_INVALID_RESPONSE se não é um arquivo IR, ESP_ERR_NO_MEM
+ */
+esp_err_t ir_library_cursor_open(const char *path, ir_library_cursor_t **cursor);
+
+/**
+ * @brief Próximo sinal, na ordem do arquivo
+ *
+ * @param timings Recebe os tempos de um sinal raw (NULL = só num_timings)
+ * @return ESP_OK, ESP_ERR_NOT_FOUND no fim do arquivo,
+ *         ESP_ERR_INVALID_SIZE se os tempos não couberem em max_timings
+ *         (signal vem preenchido e o cursor segue no próximo sinal),
+ *         ESP_FAIL em erro de leitura
+ */
+esp_err_t ir_library_cursor_next(ir_library_cursor_t *cursor, ir_signal_t *signal,
+                                 uint32_t *timings, size_t max_timings);
+
+void ir_library_cursor_close(ir_library_cursor_t *cursor);
+
+/* ============================================================================
+ * ALTERAÇÃO
+ * ============================================================================ */
+
+/**
+ * @brief Acrescenta um sinal no fim do arquivo (criado se não existir)
+ *
+ * @param signal Sinal; para raw usa frequency, duty_cycle e num_timings
+ * @param timings Tempos do sinal raw (NULL para parsed)
+ * @return ESP_OK, ESP_ERR_INVALID_STATE se o nome já existe,
+ *         ESP_ERR_NOT_SUPPORTED se os valores não cabem no formato do
+ *         protocolo, ESP_ERR_NO_MEM acima de IR_LIBRARY_MAX_SIGNALS
+ */
+esp_err_t ir_library_append(const char *path, const ir_signal_t *signal, const uint32_t *timings);
+
+/**
+ * @brief Renomeia um sinal
+ *
+ * @return ESP_OK, ESP_ERR_NOT_FOUND, ESP_ERR_INVALID_STATE se new_name já existe
+ */
+esp_err_t ir_library_rename(const char *path, const char *name, const char *new_name);
+
+/**
+ * @brief Remove um sinal
+ *
+ * @return ESP_OK, ESP_ERR_NOT_FOUND
+ */
+esp_err_t ir_library_delete(const char *path, const char *name);
+
+/**
+ * @brief Reescreve o arquivo sem os blocos cobertos por delete e rename
+ */
+esp_err_t ir_library_compact(const char *path);
+
+/**
+ * @brief Descarta o índice de um arquivo reescrito por outro caminho
+ */
+void ir_library_invalidate(const char *path);
+
+void ir_library_get_stats(ir_library_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // IR_LIBRARY_H
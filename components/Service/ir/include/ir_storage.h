@@ -18,6 +18,7 @@
 
 #include <stdint.h>
 #include <stdbool.h>
+#include <stddef.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -73,7 +74,20 @@ bool ir_save_full(const char* protocol, uint32_t command, uint32_t address,
                   uint8_t toggle, uint8_t bits, const char* filename);
 
 /**
- * @brief Carrega código IR de arquivo
+ * @brief Salva sinal IR sem protocolo (type: raw)
+ *
+ * @param filename Nome do arquivo (sem extensão .ir)
+ * @param frequency Portadora em Hz
+ * @param timings Tempos alternados marca/espaço em us, começando numa marca
+ * @param count Quantidade de tempos
+ * @return true em sucesso
+ */
+bool ir_save_raw(const char* filename, uint32_t frequency, const uint32_t* timings, size_t count);
+
+/**
+ * @brief Carrega código IR de arquivo (o primeiro sinal, se houver vários)
+ *
+ * Lê pelo índice de ir_library.h: o arquivo só é relido se mudar.
  *
  * @param filename Nome do arquivo (sem extensão .ir)
  * @param code Ponteiro para estrutura onde salvar os dados
@@ -81,6 +95,16 @@ bool ir_save_full(const char* protocol, uint32_t command, uint32_t address,
  */
 bool ir_load(const char* filename, ir_code_t* code);
 
+/**
+ * @brief Carrega um sinal parsed pelo nome, de um arquivo com vários sinais
+ *
+ * @param filename Nome do arquivo (sem extensão .ir)
+ * @param name Nome do sinal (linha "name:")
+ * @param code Ponteiro para estrutura onde salvar os dados
+ * @return true em sucesso
+ */
+bool ir_load_signal(const char* filename, const char* name, ir_code_t* code);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,192 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef IR_TX_H
+#define IR_TX_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "ir_encoder.h"
+#include "ir_storage.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Serviço de transmissão IR. Uma task dona do canal RMT de TX atende os
+// pedidos de uma fila: o canal e os encoders de cada protocolo são criados
+// uma vez e reaproveitados, então um envio custa só a transmissão. O fim de
+// cada quadro vem do callback de TX done do RMT, sem delays fixos.
+//
+// Repetições seguem o período de cada protocolo (início a início), com o
+// silêncio entre quadros gerado pelo próprio RMT:
+//   NEC        108 ms, repetições com o código curto de repetição
+//   Samsung32  108 ms, quadro completo
+//   RC5        113,8 ms (64 bits), mesmo toggle em todas as repetições
+//   RC6        106,6 ms (240 T), mesmo toggle em todas as repetições
+//   SIRC       45 ms, no mínimo 3 quadros por envio
+// O silêncio também segue o último quadro, então envios seguidos respeitam
+// o mesmo espaçamento.
+//
+// Sinais raw vão já convertidos em símbolos do RMT (ir_tx_raw_encode) e são
+// transmitidos pelo encoder de cópia, com a portadora do sinal e o silêncio
+// pedido depois do quadro.
+
+#define IR_TX_QUEUE_LEN         4       // Pedidos aguardando a task
+#define IR_TX_MAX_REPEATS       32      // Repetições por pedido
+#define IR_TX_TOGGLE_AUTO       0xFF    // RC5/RC6: alterna a cada envio
+#define IR_TX_MAX_GAP_US        262000  // Silêncio após um quadro raw (4 x 2 x 32767 ticks)
+#define IR_TX_MIN_FREQUENCY     10000   // Portadora de um quadro raw
+#define IR_TX_MAX_FREQUENCY     56000
+
+/**
+ * @brief Código a transmitir
+ */
+typedef struct {
+    ir_protocol_t protocol;
+    uint32_t address;
+    uint32_t command;
+    uint8_t toggle;     ///< RC5/RC6: 0, 1 ou IR_TX_TOGGLE_AUTO
+    uint8_t bits;       ///< SIRC: 12, 15 ou 20 (0xFF = 12)
+} ir_tx_code_t;
+
+/**
+ * @brief Quadro raw já convertido em símbolos do RMT
+ *
+ * Os símbolos pertencem a quem enfileira e devem continuar válidos até o
+ * fim da transmissão.
+ */
+typedef struct {
+    const rmt_symbol_word_t *symbols;
+    size_t num_symbols;
+    uint32_t frequency;     ///< Portadora em Hz
+    float duty_cycle;       ///< 0 = 0,33
+    uint32_t gap_us;        ///< Silêncio após o quadro (no mínimo 5 ms, até IR_TX_MAX_GAP_US)
+} ir_tx_raw_t;
+
+/**
+ * @brief Fim de um envio enfileirado
+ *
+ * Chamado pela task de TX depois do silêncio que segue o último quadro;
+ * não deve bloquear.
+ */
+typedef void (*ir_tx_done_cb_t)(esp_err_t result, void *arg);
+
+/**
+ * @brief Cria o canal RMT e inicia a task de transmissão
+ *
+ * @return ESP_OK (também se já estiver rodando), ESP_ERR_NO_MEM ou o erro
+ *         do driver RMT
+ */
+esp_err_t ir_tx_service_start(void);
+
+/**
+ * @brief Termina os envios pendentes, libera canal e encoders e para a task
+ *
+ * @return ESP_OK, ESP_ERR_INVALID_STATE se não estiver rodando
+ */
+esp_err_t ir_tx_service_stop(void);
+
+bool ir_tx_service_is_running(void);
+
+/**
+ * @brief Transmite e aguarda o fim (incluindo o silêncio após o último quadro)
+ *
+ * @param code Código
+ * @param repeats Quadros além do primeiro (até IR_TX_MAX_REPEATS)
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, ESP_ERR_NOT_SUPPORTED (protocolo),
+ *         ESP_ERR_INVALID_STATE se o serviço não estiver rodando,
+ *         ESP_ERR_TIMEOUT se o RMT não concluir, ou o erro do driver RMT
+ */
+esp_err_t ir_tx_send(const ir_tx_code_t *code, uint8_t repeats);
+
+/**
+ * @brief Enfileira a transmissão e retorna sem aguardar
+ *
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, ESP_ERR_INVALID_STATE,
+ *         ESP_ERR_TIMEOUT se a fila continuar cheia por timeout_ms
+ */
+esp_err_t ir_tx_post(const ir_tx_code_t *code, uint8_t repeats, uint32_t timeout_ms);
+
+/**
+ * @brief Enfileira a transmissão e avisa o fim por done(result, arg)
+ *
+ * @param done Aviso de fim (NULL = como ir_tx_post)
+ * @return Como ir_tx_post; se não for ESP_OK, done não é chamado
+ */
+esp_err_t ir_tx_post_notify(const ir_tx_code_t *code, uint8_t repeats, uint32_t timeout_ms,
+                            ir_tx_done_cb_t done, void *arg);
+
+/**
+ * @brief Transmite um quadro raw e aguarda o fim (incluindo o silêncio)
+ *
+ * @return ESP_OK, ESP_ERR_INVALID_ARG (símbolos, portadora ou silêncio),
+ *         ESP_ERR_INVALID_STATE, ESP_ERR_TIMEOUT ou o erro do driver RMT
+ */
+esp_err_t ir_tx_send_raw(const ir_tx_raw_t *raw);
+
+/**
+ * @brief Enfileira um quadro raw e avisa o fim por done(result, arg)
+ *
+ * @return Como ir_tx_post_notify
+ */
+esp_err_t ir_tx_post_raw(const ir_tx_raw_t *raw, uint32_t timeout_ms,
+                         ir_tx_done_cb_t done, void *arg);
+
+/**
+ * @brief Converte tempos raw (us, marca e espaço alternados, começando numa
+ *        marca) em símbolos do RMT
+ *
+ * Tempos acima de 32767 ticks ocupam mais de um meio símbolo.
+ *
+ * @return Número de símbolos (0 se algum tempo for zero ou não couber em
+ *         max_symbols)
+ */
+size_t ir_tx_raw_encode(const uint32_t *timings, size_t count,
+                        rmt_symbol_word_t *symbols, size_t max_symbols);
+
+/**
+ * @brief Converte um código lido de arquivo (ir_load) para transmissão
+ *
+ * @return ESP_OK, ESP_ERR_INVALID_ARG, ESP_ERR_NOT_SUPPORTED (protocolo)
+ */
+esp_err_t ir_tx_code_from_file(const ir_code_t *stored, ir_tx_code_t *code);
+
+/**
+ * @brief Duração de um quadro do protocolo, em microssegundos
+ *
+ * Soma exata dos símbolos gerados pelo encoder (incluindo o espaço final),
+ * usada para completar o período de repetição.
+ */
+uint32_t ir_tx_frame_us(const ir_tx_code_t *code);
+
+/**
+ * @brief Tempo no ar de um envio: quadros, repetições e silêncios, como
+ *        gerados pelo RMT
+ */
+uint32_t ir_tx_air_us(const ir_tx_code_t *code, uint8_t repeats);
+
+/**
+ * @brief Tempo no ar de um quadro raw, incluindo o silêncio depois dele
+ */
+uint32_t ir_tx_raw_air_us(const ir_tx_raw_t *raw);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // IR_TX_H
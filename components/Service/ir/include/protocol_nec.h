@@ -18,6 +18,7 @@
 
 #include "driver/rmt_encoder.h"
 #include <stdint.h>
+#include "ir_decoder.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -45,6 +46,11 @@ typedef struct {
 
 #define EXAMPLE_IR_NEC_DECODE_MARGIN 200  ///< Margem de erro para decodificação (us)
 
+/**
+ * @brief Decoder NEC (quadro e código de repetição)
+ */
+extern const ir_decoder_t ir_nec_decoder;
+
 #ifdef __cplusplus
 }
 #endif
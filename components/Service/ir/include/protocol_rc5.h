@@ -18,6 +18,7 @@
 
 #include "driver/rmt_encoder.h"
 #include <stdint.h>
+#include "ir_decoder.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -41,6 +42,11 @@ typedef struct {
 
 #define EXAMPLE_IR_RC5_DECODE_MARGIN  200  ///< Margem de erro para decodificação (us)
 
+/**
+ * @brief Decoder RC5 (e RC5X, com o bit 6 do comando no segundo start bit)
+ */
+extern const ir_decoder_t ir_rc5_decoder;
+
 #ifdef __cplusplus
 }
 #endif
@@ -19,6 +19,7 @@
 #include "driver/rmt_encoder.h"
 #include "esp_err.h"
 #include <stdint.h>
+#include "ir_decoder.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -47,6 +48,11 @@ typedef struct {
 
 #define EXAMPLE_IR_RC6_DECODE_MARGIN  200  ///< Margem de erro para decodificação (us)
 
+/**
+ * @brief Decoder RC6 modo 0
+ */
+extern const ir_decoder_t ir_rc6_decoder;
+
 #ifdef __cplusplus
 }
 #endif
@@ -18,6 +18,7 @@
 
 #include "driver/rmt_encoder.h"
 #include <stdint.h>
+#include "ir_decoder.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -42,6 +43,11 @@ typedef struct {
 
 #define EXAMPLE_IR_SAMSUNG32_DECODE_MARGIN 200  ///< Margem de erro para decodificação (us)
 
+/**
+ * @brief Decoder Samsung32
+ */
+extern const ir_decoder_t ir_samsung32_decoder;
+
 #ifdef __cplusplus
 }
 #endif
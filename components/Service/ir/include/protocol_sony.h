@@ -18,6 +18,7 @@
 
 #include "driver/rmt_encoder.h"
 #include <stdint.h>
+#include "ir_decoder.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -42,6 +43,11 @@ typedef struct {
 
 #define EXAMPLE_IR_SONY_DECODE_MARGIN 200  ///< Margem de erro para decodificação (us)
 
+/**
+ * @brief Decoder Sony SIRC (12, 15 ou 20 bits)
+ */
+extern const ir_decoder_t ir_sony_decoder;
+
 #ifdef __cplusplus
 }
 #endif
@@ -14,247 +14,415 @@
 
 
 #include "ir_burst.h"
-#include "ir_common.h"
+#include "ir_tx.h"
+#include "ir_library.h"
 #include "ir_storage.h"
 #include "esp_log.h"
+#include "esp_timer.h"
 #include "freertos/FreeRTOS.h"
-#include "freertos/task.h"
+#include "freertos/queue.h"
 #include <dirent.h>
 #include <errno.h>
+#include <inttypes.h>
+#include <stdlib.h>
 #include <string.h>
 
 static const char *TAG = "ir_burst";
-static bool g_burst_running = false;
-static bool g_burst_stop_requested = false;
 
-// Configuração padrão
+#define IR_BURST_SLOT_SYMBOLS       (IR_LIBRARY_MAX_TIMINGS / 2 + 32)  // Folga para tempos partidos
+#define IR_BURST_POST_TIMEOUT_MS    1000
+#define IR_BURST_PATH_MAX           300
+#define IR_BURST_FILE_MAX           64
+
+typedef struct burst burst_t;
+
+// Sinal entregue ao TX: os campos valem até o aviso de fim
+typedef struct {
+    burst_t *burst;
+    uint8_t index;
+    bool busy;
+    bool is_raw;
+    char file[IR_BURST_FILE_MAX];
+    char name[IR_LIBRARY_NAME_MAX];
+    ir_tx_code_t code;
+    ir_tx_raw_t raw;
+    rmt_symbol_word_t *symbols;
+    uint32_t air_us;
+} burst_slot_t;
+
+// Aviso de fim, da task de TX para a task do burst
+typedef struct {
+    uint8_t slot;
+    esp_err_t result;
+    int64_t end_us;
+} burst_done_t;
+
+struct burst {
+    ir_burst_config_t config;
+    ir_burst_handler_t handler;
+    void *ctx;
+    ir_burst_stats_t stats;
+    QueueHandle_t done;
+    burst_slot_t slots[IR_BURST_PIPELINE_DEPTH];
+    int in_flight;
+    uint32_t *timings;          // Leitura dos sinais raw
+    int64_t start_us;
+    esp_err_t error;            // Falha que parou o burst (stop_on_error)
+    bool cancel;
+
+    // Origem dos arquivos: diretório ou lista
+    DIR *dir;
+    const char **list;
+    size_t count;
+    size_t pos;
+};
+
 static const ir_burst_config_t DEFAULT_CONFIG = {
-    .delay_between_files_ms = 500,
-    .repeat_each_file = 1,
-    .delay_between_repeats_ms = 200,
-    .stop_on_error = false
+    .dir = IR_STORAGE_BASE_PATH,
+    .repeats = 0,
+    .gap_us = IR_BURST_DEFAULT_GAP_US,
+    .stop_on_error = false,
 };
 
-void ir_burst_stop(void) {
-    g_burst_stop_requested = true;
-    ESP_LOGW(TAG, "Stop requested");
-}
+/* ============================================================================
+ * EVENTOS
+ * ============================================================================ */
 
-bool ir_burst_is_running(void) {
-    return g_burst_running;
+static void update_rates(ir_burst_stats_t *stats)
+{
+    stats->signals_per_s = (stats->elapsed_us > 0) ? stats->sent * 1e6f / stats->elapsed_us : 0;
+    stats->air_signals_per_s = (stats->air_us > 0) ? stats->sent * 1e6f / stats->air_us : 0;
 }
 
-int ir_burst_send_all_files(const ir_burst_config_t *config) {
-    if (!config) {
-        config = &DEFAULT_CONFIG;
+// Cada evento é um ponto de cancelamento
+static void emit(burst_t *b, ir_burst_event_type_t type, const char *file, const char *signal,
+                 esp_err_t result)
+{
+    update_rates(&b->stats);
+    if (!b->handler) {
+        return;
     }
 
-    ESP_LOGI(TAG, "=== Iniciando transmissão em burst ===");
-    ESP_LOGI(TAG, "Delay entre arquivos: %lu ms", config->delay_between_files_ms);
-    ESP_LOGI(TAG, "Repetições por arquivo: %lu", config->repeat_each_file);
-    ESP_LOGI(TAG, "Delay entre repetições: %lu ms", config->delay_between_repeats_ms);
-    ESP_LOGI(TAG, "Parar em erro: %s", config->stop_on_error ? "SIM" : "NÃO");
-
-    g_burst_running = true;
-    g_burst_stop_requested = false;
-
-    // Abre o diretório de arquivos IR
-    DIR *dir = opendir(IR_STORAGE_BASE_PATH);
-    if (!dir) {
-        ESP_LOGE(TAG, "Falha ao abrir diretório: %s (errno=%d: %s)", 
-                 IR_STORAGE_BASE_PATH, errno, strerror(errno));
-        g_burst_running = false;
-        return 0;
+    ir_burst_event_t event = {
+        .type = type,
+        .file = file,
+        .signal = signal,
+        .result = result,
+        .stats = &b->stats,
+    };
+    if (!b->handler(&event, b->ctx) && type != IR_BURST_EVENT_DONE && !b->cancel) {
+        ESP_LOGW(TAG, "Burst cancelado");
+        b->cancel = true;
+        b->stats.cancelled = true;
     }
-    
-    ESP_LOGI(TAG, "Diretório aberto com sucesso: %s", IR_STORAGE_BASE_PATH);
+}
 
-    // Primeira passagem: contar arquivos .ir
-    struct dirent *entry;
-    int total_files = 0;
-    
-    while ((entry = readdir(dir)) != NULL) {
-        // Ignora "." e ".."
-        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
-            continue;
+/* ============================================================================
+ * PIPELINE
+ * ============================================================================ */
+
+// Task de TX: só repassa o resultado, o evento sai na task do burst
+static void on_tx_done(esp_err_t result, void *arg)
+{
+    burst_slot_t *slot = arg;
+    burst_done_t done = {
+        .slot = slot->index,
+        .result = result,
+        .end_us = esp_timer_get_time(),
+    };
+    xQueueSend(slot->burst->done, &done, 0);
+}
+
+// Trata um aviso de fim; false se nenhum chegou em wait
+static bool collect(burst_t *b, TickType_t wait)
+{
+    burst_done_t done;
+    if (xQueueReceive(b->done, &done, wait) != pdTRUE) {
+        return false;
+    }
+
+    burst_slot_t *slot = &b->slots[done.slot];
+    slot->busy = false;
+    b->in_flight--;
+    b->stats.elapsed_us = done.end_us - b->start_us;
+
+    if (done.result == ESP_OK) {
+        b->stats.sent++;
+        b->stats.air_us += slot->air_us;
+    } else {
+        b->stats.failed++;
+        ESP_LOGE(TAG, "Falha ao transmitir %s/%s: %s", slot->file, slot->name, esp_err_to_name(done.result));
+        if (b->config.stop_on_error && !b->cancel) {
+            ESP_LOGE(TAG, "Parando devido a erro (stop_on_error=true)");
+            b->error = done.result;
+            b->cancel = true;
         }
-        
-        size_t len = strlen(entry->d_name);
-        // Verifica extensão .ir ou .IR (FAT retorna em maiúsculas)
-        if (len > 3) {
-            const char *ext = entry->d_name + len - 3;
-            if (strcasecmp(ext, ".ir") == 0) {
-                total_files++;
-            }
+    }
+
+    emit(b, IR_BURST_EVENT_SENT, slot->file, slot->name, done.result);
+    return true;
+}
+
+static burst_slot_t *free_slot(burst_t *b)
+{
+    for (int i = 0; i < IR_BURST_PIPELINE_DEPTH; i++) {
+        if (!b->slots[i].busy) {
+            return &b->slots[i];
         }
     }
-    
-    ESP_LOGI(TAG, "Encontrados %d arquivos .ir", total_files);
-    
-    if (total_files == 0) {
-        ESP_LOGW(TAG, "Nenhum arquivo .ir encontrado!");
-        closedir(dir);
-        g_burst_running = false;
-        return 0;
+    return NULL;
+}
+
+// Deixa o sinal lido pronto para o TX (raw já em símbolos, de b->timings)
+static esp_err_t prepare(burst_t *b, burst_slot_t *slot, const ir_signal_t *signal)
+{
+    if (signal->type == IR_SIGNAL_PARSED) {
+        slot->is_raw = false;
+        esp_err_t ret = ir_tx_code_from_file(&signal->code, &slot->code);
+        slot->air_us = (ret == ESP_OK) ? ir_tx_air_us(&slot->code, b->config.repeats) : 0;
+        return ret;
+    }
+
+    size_t num_symbols = ir_tx_raw_encode(b->timings, signal->num_timings, slot->symbols,
+                                          IR_BURST_SLOT_SYMBOLS);
+    if (num_symbols == 0) {
+        return ESP_ERR_INVALID_SIZE;
     }
 
-    // Volta ao início do diretório
-    rewinddir(dir);
+    slot->is_raw = true;
+    slot->raw = (ir_tx_raw_t) {
+        .symbols = slot->symbols,
+        .num_symbols = num_symbols,
+        .frequency = signal->frequency,
+        .duty_cycle = signal->duty_cycle,
+        .gap_us = b->config.gap_us,
+    };
+    slot->air_us = ir_tx_raw_air_us(&slot->raw);
+    return ESP_OK;
+}
 
-    int success_count = 0;
-    int fail_count = 0;
-    int current_file = 0;
+static esp_err_t post(burst_t *b, burst_slot_t *slot)
+{
+    if (slot->is_raw) {
+        return ir_tx_post_raw(&slot->raw, IR_BURST_POST_TIMEOUT_MS, on_tx_done, slot);
+    }
+    return ir_tx_post_notify(&slot->code, b->config.repeats, IR_BURST_POST_TIMEOUT_MS,
+                             on_tx_done, slot);
+}
 
-    // Segunda passagem: transmitir arquivos
-    ESP_LOGI(TAG, "Iniciando segunda passagem...");
-    while ((entry = readdir(dir)) != NULL && !g_burst_stop_requested) {
-        ESP_LOGD(TAG, "Lendo entrada: %s", entry->d_name);
-        
-        // Ignora "." e ".."
-        if (strcmp(entry->d_name, ".") == 0 || strcmp(entry->d_name, "..") == 0) {
-            continue;
+// Próximo arquivo da lista ou do diretório, lido entrada a entrada
+static bool next_file(burst_t *b, char *path, char *file)
+{
+    if (b->list) {
+        if (b->pos >= b->count) {
+            return false;
         }
+        const char *name = b->list[b->pos++];
+        snprintf(path, IR_BURST_PATH_MAX, "%s/%s.ir", b->config.dir, name);
+        snprintf(file, IR_BURST_FILE_MAX, "%s", name);
+        return true;
+    }
 
+    struct dirent *entry;
+    while ((entry = readdir(b->dir)) != NULL) {
+        // Extensão .ir ou .IR (FAT retorna em maiúsculas); exclui "." e ".."
         size_t len = strlen(entry->d_name);
-        if (len <= 3) {
-            ESP_LOGD(TAG, "Ignorando (len <= 3): %s", entry->d_name);
-            continue;
-        }
-        
-        // Verifica extensão .ir ou .IR (case-insensitive)
-        const char *ext = entry->d_name + len - 3;
-        if (strcasecmp(ext, ".ir") != 0) {
-            ESP_LOGD(TAG, "Ignorando (não .ir): %s", entry->d_name);
+        if (len <= 3 || strcasecmp(entry->d_name + len - 3, ".ir") != 0) {
             continue;
         }
+        snprintf(path, IR_BURST_PATH_MAX, "%s/%s", b->config.dir, entry->d_name);
+        snprintf(file, IR_BURST_FILE_MAX, "%.*s", (int)(len - 3), entry->d_name);
+        return true;
+    }
+    return false;
+}
 
-        current_file++;
-        ESP_LOGI(TAG, "Arquivo .ir encontrado na 2ª passagem: %s", entry->d_name);
-
-        // Remove a extensão .ir do nome
-        char filename[256];
-        strncpy(filename, entry->d_name, len - 3);
-        filename[len - 3] = '\0';
-
-        ESP_LOGI(TAG, "[%d/%d] Transmitindo: %s", current_file, total_files, filename);
+// Os sinais saem na ordem do arquivo, lido uma vez só pelo cursor
+static void send_file(burst_t *b, const char *path, const char *file)
+{
+    ir_library_cursor_t *cursor;
+    esp_err_t ret = ir_library_cursor_open(path, &cursor);
+    if (ret != ESP_OK) {
+        b->stats.skipped++;
+        ESP_LOGW(TAG, "Arquivo ignorado: %s (%s)", file, esp_err_to_name(ret));
+        emit(b, IR_BURST_EVENT_SKIPPED, file, NULL, ret);
+        return;
+    }
 
-        // Repete o arquivo N vezes
-        bool file_success = true;
-        for (uint32_t rep = 0; rep < config->repeat_each_file && !g_burst_stop_requested; rep++) {
-            if (config->repeat_each_file > 1) {
-                ESP_LOGI(TAG, "  Repetição %lu/%lu", rep + 1, config->repeat_each_file);
-            }
+    b->stats.files++;
+    emit(b, IR_BURST_EVENT_FILE, file, NULL, ESP_OK);
 
-            bool tx_result = ir_tx_send_from_file(filename);
-            
-            if (tx_result) {
-                ESP_LOGI(TAG, "  ✅ Transmitido com sucesso");
-            } else {
-                ESP_LOGE(TAG, "  ❌ Falha na transmissão");
-                file_success = false;
-                
-                if (config->stop_on_error) {
-                    ESP_LOGE(TAG, "Parando devido a erro (stop_on_error=true)");
-                    closedir(dir);
-                    g_burst_running = false;
-                    return success_count;
-                }
-            }
+    while (!b->cancel) {
+        // Avisos que já chegaram saem antes de ler o próximo sinal
+        while (collect(b, 0)) {
+        }
 
-            // Delay entre repetições (exceto na última)
-            if (rep < config->repeat_each_file - 1) {
-                vTaskDelay(pdMS_TO_TICKS(config->delay_between_repeats_ms));
+        // Lido enquanto o pipeline ainda está cheio
+        ir_signal_t signal;
+        ret = ir_library_cursor_next(cursor, &signal, b->timings, IR_LIBRARY_MAX_TIMINGS);
+        if (ret == ESP_ERR_NOT_FOUND) {
+            break;
+        }
+        if (ret != ESP_OK) {
+            b->stats.skipped++;
+            ESP_LOGW(TAG, "Sinal ignorado: %s/%s (%s)", file, signal.name, esp_err_to_name(ret));
+            emit(b, IR_BURST_EVENT_SKIPPED, file, signal.name, ret);
+            if (ret == ESP_ERR_INVALID_SIZE) {
+                continue;
             }
+            break;
         }
 
-        if (file_success) {
-            success_count++;
-        } else {
-            fail_count++;
+        // Pipeline cheio: aguarda o sinal no ar terminar
+        burst_slot_t *slot;
+        while (!b->cancel && (slot = free_slot(b)) == NULL) {
+            collect(b, portMAX_DELAY);
         }
-
-        // Delay entre arquivos (exceto no último)
-        if (current_file < total_files && !g_burst_stop_requested) {
-            vTaskDelay(pdMS_TO_TICKS(config->delay_between_files_ms));
+        if (b->cancel) {
+            break;
         }
-    }
 
-    closedir(dir);
+        snprintf(slot->file, sizeof(slot->file), "%s", file);
+        snprintf(slot->name, sizeof(slot->name), "%s", signal.name);
+        ret = prepare(b, slot, &signal);
+        if (ret == ESP_OK) {
+            ret = post(b, slot);
+        }
+        if (ret != ESP_OK) {
+            b->stats.skipped++;
+            ESP_LOGW(TAG, "Sinal ignorado: %s/%s (%s)", file, slot->name, esp_err_to_name(ret));
+            emit(b, IR_BURST_EVENT_SKIPPED, file, slot->name, ret);
+            continue;
+        }
 
-    if (g_burst_stop_requested) {
-        ESP_LOGW(TAG, "=== Burst INTERROMPIDO pelo usuário ===");
-    } else {
-        ESP_LOGI(TAG, "=== Burst CONCLUÍDO ===");
+        if (b->start_us == 0) {
+            b->start_us = esp_timer_get_time();
+        }
+        slot->busy = true;
+        b->in_flight++;
     }
-    
-    ESP_LOGI(TAG, "Arquivos processados: %d", current_file);
-    ESP_LOGI(TAG, "Sucessos: %d", success_count);
-    ESP_LOGI(TAG, "Falhas: %d", fail_count);
 
-    g_burst_running = false;
-    return success_count;
+    ir_library_cursor_close(cursor);
 }
 
-int ir_burst_send_file_list(const char **filenames, uint32_t count,
-                            const ir_burst_config_t *config) {
-    if (!filenames || count == 0) {
-        ESP_LOGE(TAG, "Lista de arquivos inválida");
-        return 0;
+/* ============================================================================
+ * API
+ * ============================================================================ */
+
+static void burst_free(burst_t *b)
+{
+    if (b->dir) {
+        closedir(b->dir);
+    }
+    if (b->done) {
+        vQueueDelete(b->done);
+    }
+    for (int i = 0; i < IR_BURST_PIPELINE_DEPTH; i++) {
+        free(b->slots[i].symbols);
     }
+    free(b->timings);
+    free(b);
+}
 
+static esp_err_t burst(const char **filenames, size_t count, const ir_burst_config_t *config,
+                       ir_burst_handler_t handler, void *ctx, ir_burst_stats_t *stats)
+{
     if (!config) {
         config = &DEFAULT_CONFIG;
     }
+    if (config->repeats > IR_TX_MAX_REPEATS || config->gap_us > IR_TX_MAX_GAP_US) {
+        return ESP_ERR_INVALID_ARG;
+    }
 
-    ESP_LOGI(TAG, "=== Transmitindo lista de %lu arquivos ===", count);
+    burst_t *b = calloc(1, sizeof(burst_t));
+    if (!b) {
+        return ESP_ERR_NO_MEM;
+    }
+    b->config = *config;
+    if (!b->config.dir) b->config.dir = IR_STORAGE_BASE_PATH;
+    if (!b->config.gap_us) b->config.gap_us = IR_BURST_DEFAULT_GAP_US;
+    b->handler = handler;
+    b->ctx = ctx;
+    b->list = filenames;
+    b->count = count;
+
+    b->done = xQueueCreate(IR_BURST_PIPELINE_DEPTH, sizeof(burst_done_t));
+    b->timings = malloc(IR_LIBRARY_MAX_TIMINGS * sizeof(uint32_t));
+    bool ok = b->done && b->timings;
+    for (int i = 0; i < IR_BURST_PIPELINE_DEPTH; i++) {
+        b->slots[i].burst = b;
+        b->slots[i].index = i;
+        b->slots[i].symbols = malloc(IR_BURST_SLOT_SYMBOLS * sizeof(rmt_symbol_word_t));
+        ok = ok && b->slots[i].symbols;
+    }
+    if (!ok) {
+        ESP_LOGE(TAG, "Sem memória para o burst");
+        burst_free(b);
+        return ESP_ERR_NO_MEM;
+    }
 
-    g_burst_running = true;
-    g_burst_stop_requested = false;
+    esp_err_t ret = ir_tx_service_start();
+    if (ret != ESP_OK) {
+        burst_free(b);
+        return ret;
+    }
 
-    int success_count = 0;
-    int fail_count = 0;
+    if (!filenames) {
+        b->dir = opendir(b->config.dir);
+        if (!b->dir) {
+            ESP_LOGE(TAG, "Falha ao abrir diretório: %s (errno=%d: %s)",
+                     b->config.dir, errno, strerror(errno));
+            burst_free(b);
+            return ESP_ERR_NOT_FOUND;
+        }
+    }
 
-    for (uint32_t i = 0; i < count && !g_burst_stop_requested; i++) {
-        ESP_LOGI(TAG, "[%lu/%lu] Transmitindo: %s", i + 1, count, filenames[i]);
+    ESP_LOGI(TAG, "=== Iniciando transmissão em burst: %s ===", b->config.dir);
 
-        bool file_success = true;
-        for (uint32_t rep = 0; rep < config->repeat_each_file && !g_burst_stop_requested; rep++) {
-            if (config->repeat_each_file > 1) {
-                ESP_LOGI(TAG, "  Repetição %lu/%lu", rep + 1, config->repeat_each_file);
-            }
+    char path[IR_BURST_PATH_MAX];
+    char file[IR_BURST_FILE_MAX];
+    while (!b->cancel && next_file(b, path, file)) {
+        send_file(b, path, file);
+    }
 
-            bool tx_result = ir_tx_send_from_file(filenames[i]);
-            
-            if (!tx_result) {
-                ESP_LOGE(TAG, "  ❌ Falha na transmissão");
-                file_success = false;
-                
-                if (config->stop_on_error) {
-                    ESP_LOGE(TAG, "Parando devido a erro");
-                    g_burst_running = false;
-                    return success_count;
-                }
-            }
+    // Sinais já entregues ao TX saem mesmo após o cancelamento
+    while (b->in_flight > 0) {
+        collect(b, portMAX_DELAY);
+    }
 
-            if (rep < config->repeat_each_file - 1) {
-                vTaskDelay(pdMS_TO_TICKS(config->delay_between_repeats_ms));
-            }
-        }
+    emit(b, IR_BURST_EVENT_DONE, NULL, NULL, b->error);
 
-        if (file_success) {
-            success_count++;
-        } else {
-            fail_count++;
-        }
+    const ir_burst_stats_t *s = &b->stats;
+    ESP_LOGI(TAG, "=== Burst %s: %" PRIu32 " arquivos, %" PRIu32 " sinais, %" PRIu32 " falhas, "
+             "%" PRIu32 " ignorados ===",
+             s->cancelled ? "CANCELADO" : "CONCLUÍDO", s->files, s->sent, s->failed, s->skipped);
+    if (s->sent > 0) {
+        ESP_LOGI(TAG, "%.1f sinais/s em %" PRId64 " ms; no ar %" PRIu64 " ms (%.1f sinais/s, %.0f%% do tempo)",
+                 s->signals_per_s, s->elapsed_us / 1000, s->air_us / 1000, s->air_signals_per_s,
+                 (s->elapsed_us > 0) ? 100.0f * s->air_us / s->elapsed_us : 0);
+    }
 
-        if (i < count - 1 && !g_burst_stop_requested) {
-            vTaskDelay(pdMS_TO_TICKS(config->delay_between_files_ms));
-        }
+    if (stats) {
+        *stats = b->stats;
     }
+    ret = b->error;
+    burst_free(b);
+    return ret;
+}
 
-    ESP_LOGI(TAG, "=== Transmissão concluída ===");
-    ESP_LOGI(TAG, "Sucessos: %d / Falhas: %d", success_count, fail_count);
+esp_err_t ir_burst_run(const ir_burst_config_t *config, ir_burst_handler_t handler,
+                       void *ctx, ir_burst_stats_t *stats)
+{
+    return burst(NULL, 0, config, handler, ctx, stats);
+}
 
-    g_burst_running = false;
-    return success_count;
+esp_err_t ir_burst_run_files(const char **filenames, size_t count,
+                             const ir_burst_config_t *config, ir_burst_handler_t handler,
+                             void *ctx, ir_burst_stats_t *stats)
+{
+    if (!filenames || count == 0) {
+        ESP_LOGE(TAG, "Lista de arquivos inválida");
+        return ESP_ERR_INVALID_ARG;
+    }
+    return burst(filenames, count, config, handler, ctx, stats);
 }
@@ -0,0 +1,320 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "ir_capture.h"
+#include "ir_common.h"
+#include "ir_storage.h"
+#include "esp_timer.h"
+#include <inttypes.h>
+#include <stdlib.h>
+#include <string.h>
+
+static const char *TAG = "ir_capture";
+
+#define IR_CAPTURE_MEM_SYMBOLS      96      // Memória do canal (2 blocos, ping-pong do RMT)
+#define IR_CAPTURE_CHUNK_SYMBOLS    128     // Buffer da recepção parcial
+#define IR_CAPTURE_FILTER_NS        1250    // Glitches mais curtos são ignorados
+
+static rmt_channel_handle_t s_channel = NULL;
+static QueueHandle_t s_ready = NULL;            // Capturas completas (ir_capture_t)
+static rmt_receive_config_t s_rx_config;
+static uint32_t s_idle_us;
+static volatile bool s_running = false;
+
+// Buffers: o driver escreve em s_chunk e o callback copia para s_buf[s_fill]
+static rmt_symbol_word_t s_chunk[IR_CAPTURE_CHUNK_SYMBOLS];
+static rmt_symbol_word_t s_buf[2][IR_CAPTURE_MAX_SYMBOLS];
+static volatile bool s_busy[2];                 // Entregue e ainda não devolvido
+
+// Captura em andamento (só o callback acessa)
+static uint8_t s_fill;
+static size_t s_len;
+static uint32_t s_total_us;
+static bool s_truncated;
+static uint32_t s_seq;
+static volatile uint32_t s_dropped;
+
+/* ============================================================================
+ * CALLBACK DE RECEPÇÃO
+ * ============================================================================ */
+
+static void append(const rmt_symbol_word_t *symbols, size_t num_symbols)
+{
+    size_t room = IR_CAPTURE_MAX_SYMBOLS - s_len;
+    if (num_symbols > room) {
+        num_symbols = room;
+        s_truncated = true;
+    }
+
+    memcpy(&s_buf[s_fill][s_len], symbols, num_symbols * sizeof(rmt_symbol_word_t));
+    s_len += num_symbols;
+    for (size_t i = 0; i < num_symbols; i++) {
+        s_total_us += symbols[i].duration0 + symbols[i].duration1;
+    }
+}
+
+// Chamado a cada parte recebida; a última parte fecha a captura
+static bool on_recv_done(rmt_channel_handle_t channel, const rmt_rx_done_event_data_t *edata, void *user_data)
+{
+    BaseType_t high_task_wakeup = pdFALSE;
+
+    append(edata->received_symbols, edata->num_symbols);
+    if (!edata->flags.is_last) {
+        return false;
+    }
+
+    if (s_len > 0) {
+        // O fim do sinal foi idle_us antes deste evento
+        int64_t end_us = esp_timer_get_time() - s_idle_us;
+        ir_capture_t capture = {
+            .symbols = s_buf[s_fill],
+            .num_symbols = s_len,
+            .start_us = end_us - s_total_us,
+            .end_us = end_us,
+            .seq = s_seq++,
+            .truncated = s_truncated,
+            .buffer = s_fill,
+        };
+
+        // Só troca de buffer se o outro já foi devolvido
+        uint8_t next = s_fill ^ 1;
+        if (!s_busy[next]) {
+            s_busy[s_fill] = true;
+            xQueueSendFromISR(s_ready, &capture, &high_task_wakeup);
+            s_fill = next;
+        } else {
+            s_dropped++;
+        }
+    }
+
+    s_len = 0;
+    s_total_us = 0;
+    s_truncated = false;
+
+    // Rearma na hora: o próximo quadro pode começar logo após o silêncio
+    if (s_running) {
+        rmt_receive(channel, s_chunk, sizeof(s_chunk), &s_rx_config);
+    }
+    return high_task_wakeup == pdTRUE;
+}
+
+/* ============================================================================
+ * API
+ * ============================================================================ */
+
+static void channel_close(void)
+{
+    if (s_channel) {
+        rmt_disable(s_channel);
+        rmt_del_channel(s_channel);
+        s_channel = NULL;
+    }
+}
+
+esp_err_t ir_capture_start(const ir_capture_config_t *config)
+{
+    if (s_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    uint32_t idle_us = (config && config->idle_us) ? config->idle_us : IR_CAPTURE_DEFAULT_IDLE_US;
+    if (idle_us > IR_CAPTURE_MAX_IDLE_US) {
+        ESP_LOGE(TAG, "Silêncio de %" PRIu32 " us acima do limite de %u us", idle_us, IR_CAPTURE_MAX_IDLE_US);
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    // Fila reaproveitada se a captura for reiniciada
+    if (!s_ready) s_ready = xQueueCreate(2, sizeof(ir_capture_t));
+    if (!s_ready) {
+        ESP_LOGE(TAG, "Falha ao criar fila de capturas");
+        return ESP_ERR_NO_MEM;
+    }
+    xQueueReset(s_ready);
+
+    s_idle_us = idle_us;
+    s_fill = 0;
+    s_len = 0;
+    s_total_us = 0;
+    s_truncated = false;
+    s_seq = 0;
+    s_dropped = 0;
+    s_busy[0] = false;
+    s_busy[1] = false;
+
+    s_rx_config = (rmt_receive_config_t) {
+        .signal_range_min_ns = IR_CAPTURE_FILTER_NS,
+        .signal_range_max_ns = idle_us * 1000,
+        .flags.en_partial_rx = true,
+    };
+
+    rmt_rx_channel_config_t rx_channel_cfg = {
+        .clk_src = RMT_CLK_SRC_DEFAULT,
+        .resolution_hz = EXAMPLE_IR_RESOLUTION_HZ,
+        .mem_block_symbols = IR_CAPTURE_MEM_SYMBOLS,
+        .gpio_num = EXAMPLE_IR_RX_GPIO_NUM,
+    };
+
+    esp_err_t ret = rmt_new_rx_channel(&rx_channel_cfg, &s_channel);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Falha ao criar canal RX: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    rmt_rx_event_callbacks_t cbs = {
+        .on_recv_done = on_recv_done,
+    };
+    ret = rmt_rx_register_event_callbacks(s_channel, &cbs, NULL);
+    if (ret == ESP_OK) {
+        ret = rmt_enable(s_channel);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Falha ao habilitar canal RX: %s", esp_err_to_name(ret));
+        rmt_del_channel(s_channel);
+        s_channel = NULL;
+        return ret;
+    }
+
+    s_running = true;
+    ret = rmt_receive(s_channel, s_chunk, sizeof(s_chunk), &s_rx_config);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Falha ao iniciar recepção: %s", esp_err_to_name(ret));
+        s_running = false;
+        channel_close();
+        return ret;
+    }
+
+    ESP_LOGI(TAG, "Captura iniciada (silêncio de %" PRIu32 " us)", idle_us);
+    return ESP_OK;
+}
+
+esp_err_t ir_capture_stop(void)
+{
+    if (!s_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    // Sem s_running o callback não rearma; rmt_disable interrompe a recepção
+    s_running = false;
+    channel_close();
+    xQueueReset(s_ready);
+
+    if (s_dropped) {
+        ESP_LOGW(TAG, "%" PRIu32 " capturas descartadas", s_dropped);
+    }
+    ESP_LOGI(TAG, "Captura parada");
+    return ESP_OK;
+}
+
+bool ir_capture_is_running(void)
+{
+    return s_running;
+}
+
+esp_err_t ir_capture_wait(ir_capture_t *capture, uint32_t timeout_ms)
+{
+    if (!capture) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_running) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    if (xQueueReceive(s_ready, capture, pdMS_TO_TICKS(timeout_ms)) != pdPASS) {
+        return ESP_ERR_TIMEOUT;
+    }
+    return ESP_OK;
+}
+
+void ir_capture_release(const ir_capture_t *capture)
+{
+    if (capture && capture->buffer < 2) {
+        s_busy[capture->buffer] = false;
+    }
+}
+
+uint32_t ir_capture_dropped(void)
+{
+    return s_dropped;
+}
+
+/* ============================================================================
+ * FORMATO RAW
+ * ============================================================================ */
+
+size_t ir_capture_timings(const ir_capture_t *capture, uint32_t *timings, size_t max_timings)
+{
+    if (!capture || !capture->symbols || capture->num_symbols == 0 || !timings) {
+        return 0;
+    }
+
+    // O receptor pode ser ativo em 0 ou em 1: a captura começa numa marca
+    unsigned mark_level = capture->symbols[0].level0;
+    bool mark = true;
+    uint32_t duration = 0;
+    size_t count = 0;
+
+    for (size_t i = 0; i < capture->num_symbols; i++) {
+        unsigned levels[2] = { capture->symbols[i].level0, capture->symbols[i].level1 };
+        uint32_t durations[2] = { capture->symbols[i].duration0, capture->symbols[i].duration1 };
+
+        for (int h = 0; h < 2; h++) {
+            if (durations[h] == 0) {
+                goto out;       // Marcador de fim do RMT
+            }
+            bool half_mark = (levels[h] == mark_level);
+            if (half_mark != mark && duration > 0) {
+                if (count >= max_timings) {
+                    return 0;
+                }
+                timings[count++] = duration;
+                duration = 0;
+            }
+            mark = half_mark;
+            duration += durations[h];
+        }
+    }
+
+out:
+    // O espaço final é o silêncio que encerrou a captura
+    if (duration > 0 && mark) {
+        if (count >= max_timings) {
+            return 0;
+        }
+        timings[count++] = duration;
+    }
+    return count;
+}
+
+bool ir_capture_save_raw(const ir_capture_t *capture, const char *filename)
+{
+    if (!capture || !filename) {
+        ESP_LOGE(TAG, "Parâmetros inválidos");
+        return false;
+    }
+
+    size_t max_timings = 2 * capture->num_symbols;
+    uint32_t *timings = malloc(max_timings * sizeof(uint32_t));
+    if (!timings) {
+        ESP_LOGE(TAG, "Sem memória para %u tempos", (unsigned)max_timings);
+        return false;
+    }
+
+    size_t count = ir_capture_timings(capture, timings, max_timings);
+    bool ok = (count > 0) &&
+              ir_save_raw(filename, IR_CAPTURE_RAW_FREQUENCY, timings, count);
+
+    free(timings);
+    return ok;
+}
@@ -14,7 +14,6 @@
 
 
 #include "ir_common.h"
-#include "ir_storage.h"
 #include "protocol_nec.h"
 #include "protocol_rc6.h"
 #include "protocol_rc5.h"
@@ -24,145 +23,6 @@
 
 static const char *TAG = "ir_tx";
 
-// Estados globais de toggle
-static uint8_t g_rc6_toggle_state = 0;
-static uint8_t g_rc5_toggle_state = 0;
-
-bool ir_tx_send_from_file(const char* filename) {
-    ESP_LOGI(TAG, "=== INÍCIO ir_tx_send_from_file ===");
-    ESP_LOGI(TAG, "Filename: %s", filename);
-    
-    ir_context_t ir_ctx = {0};
-    
-    // Carrega o código do arquivo
-    ir_code_t ir_code;
-    ESP_LOGI(TAG, "Carregando arquivo...");
-    if (!ir_load(filename, &ir_code)) {
-        ESP_LOGE(TAG, "❌ Falha ao carregar código do arquivo: %s", filename);
-        return false;
-    }
-
-    ESP_LOGI(TAG, "✅ Arquivo carregado:");
-    ESP_LOGI(TAG, "  Protocol: %s", ir_code.protocol);
-    ESP_LOGI(TAG, "  Address: 0x%08lX", ir_code.address);
-    ESP_LOGI(TAG, "  Command: 0x%08lX", ir_code.command);
-    ESP_LOGI(TAG, "  Toggle: %d (0xFF=auto)", ir_code.toggle);
-    if (ir_code.bits != 0xFF) {
-        ESP_LOGI(TAG, "  Bits: %d", ir_code.bits);
-    }
-
-    // Inicializa TX
-    ESP_LOGI(TAG, "Inicializando TX...");
-    esp_err_t ret = ir_tx_init(&ir_ctx);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "❌ Failed to initialize TX: %s", esp_err_to_name(ret));
-        return false;
-    }
-    ESP_LOGI(TAG, "✅ TX inicializado");
-
-    // Cria encoder apropriado baseado no protocolo
-    ir_encoder_config_t enc_cfg = {0};
-    
-    ESP_LOGI(TAG, "Identificando protocolo: %s", ir_code.protocol);
-    
-    if (strcmp(ir_code.protocol, "NEC") == 0) {
-        ESP_LOGI(TAG, "Configurando encoder NEC");
-        enc_cfg.protocol = IR_PROTOCOL_NEC;
-        enc_cfg.config.nec.resolution = EXAMPLE_IR_RESOLUTION_HZ;
-    }
-    else if (strcmp(ir_code.protocol, "RC6") == 0) {
-        ESP_LOGI(TAG, "Configurando encoder RC6");
-        enc_cfg.protocol = IR_PROTOCOL_RC6;
-        enc_cfg.config.rc6.resolution = EXAMPLE_IR_RESOLUTION_HZ;
-    }
-    else if (strcmp(ir_code.protocol, "RC5") == 0) {
-        ESP_LOGI(TAG, "Configurando encoder RC5");
-        enc_cfg.protocol = IR_PROTOCOL_RC5;
-        enc_cfg.config.rc5.resolution = EXAMPLE_IR_RESOLUTION_HZ;
-    }
-    else if (strcmp(ir_code.protocol, "Samsung32") == 0) {
-        ESP_LOGI(TAG, "Configurando encoder Samsung32");
-        enc_cfg.protocol = IR_PROTOCOL_SAMSUNG32;
-        enc_cfg.config.samsung32.resolution = EXAMPLE_IR_RESOLUTION_HZ;
-    }
-    else if (strcmp(ir_code.protocol, "SIRC") == 0 || strcmp(ir_code.protocol, "Sony") == 0) {
-        ESP_LOGI(TAG, "Configurando encoder Sony SIRC");
-        enc_cfg.protocol = IR_PROTOCOL_SIRC;
-        enc_cfg.config.sony.resolution = EXAMPLE_IR_RESOLUTION_HZ;
-    }
-    else {
-        ESP_LOGE(TAG, "❌ Protocolo não suportado: %s", ir_code.protocol);
-        ir_tx_deinit(&ir_ctx);
-        return false;
-    }
-
-    ESP_LOGI(TAG, "Criando encoder (protocol=%d)...", enc_cfg.protocol);
-    ret = rmt_new_ir_encoder(&enc_cfg, &ir_ctx.encoder);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "❌ Failed to create encoder: %s", esp_err_to_name(ret));
-        ir_tx_deinit(&ir_ctx);
-        return false;
-    }
-    ESP_LOGI(TAG, "✅ Encoder criado");
-
-    // Transmite baseado no protocolo
-    ret = ESP_FAIL;
-    
-    if (strcmp(ir_code.protocol, "NEC") == 0) {
-        ESP_LOGI(TAG, "Transmitindo NEC: addr=0x%04X, cmd=0x%04X", 
-                 (uint16_t)ir_code.address, (uint16_t)ir_code.command);
-        ret = ir_tx_send_nec(&ir_ctx, (uint16_t)ir_code.address, (uint16_t)ir_code.command);
-    }
-    else if (strcmp(ir_code.protocol, "RC6") == 0) {
-        uint8_t toggle = (ir_code.toggle != 0xFF) ? ir_code.toggle : g_rc6_toggle_state;
-        ESP_LOGI(TAG, "Transmitindo RC6: addr=0x%02X, cmd=0x%02X, toggle=%d", 
-                 (uint8_t)ir_code.address, (uint8_t)ir_code.command, toggle);
-        ret = ir_tx_send_rc6(&ir_ctx, (uint8_t)ir_code.address, (uint8_t)ir_code.command, toggle);
-        
-        if (ir_code.toggle == 0xFF) {
-            g_rc6_toggle_state = !g_rc6_toggle_state;
-            ESP_LOGD(TAG, "Toggle RC6 alternado para: %d", g_rc6_toggle_state);
-        }
-    }
-    else if (strcmp(ir_code.protocol, "RC5") == 0) {
-        uint8_t toggle = (ir_code.toggle != 0xFF) ? ir_code.toggle : g_rc5_toggle_state;
-        ESP_LOGI(TAG, "Transmitindo RC5: addr=0x%02X, cmd=0x%02X, toggle=%d", 
-                 (uint8_t)ir_code.address, (uint8_t)ir_code.command, toggle);
-        ret = ir_tx_send_rc5(&ir_ctx, (uint8_t)ir_code.address, (uint8_t)ir_code.command, toggle);
-        
-        if (ir_code.toggle == 0xFF) {
-            g_rc5_toggle_state = !g_rc5_toggle_state;
-            ESP_LOGD(TAG, "Toggle RC5 alternado para: %d", g_rc5_toggle_state);
-        }
-    }
-    else if (strcmp(ir_code.protocol, "Samsung32") == 0) {
-        // Samsung32 usa os 32 bits completos (address e command combinados)
-        uint32_t data = ((ir_code.address & 0xFFFF) << 16) | (ir_code.command & 0xFFFF);
-        ESP_LOGI(TAG, "Transmitindo Samsung32: data=0x%08lX", data);
-        ret = ir_tx_send_samsung32(&ir_ctx, data);
-    }
-    else if (strcmp(ir_code.protocol, "SIRC") == 0 || strcmp(ir_code.protocol, "Sony") == 0) {
-        uint8_t bits = (ir_code.bits != 0xFF) ? ir_code.bits : 12;  // Default 12 bits
-        ESP_LOGI(TAG, "Transmitindo Sony SIRC-%d: addr=0x%04X, cmd=0x%02X", 
-                 bits, (uint16_t)ir_code.address, (uint8_t)ir_code.command);
-        ret = ir_tx_send_sony(&ir_ctx, (uint16_t)ir_code.address, (uint8_t)ir_code.command, bits);
-    }
-
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "❌ Falha ao transmitir código IR: %s", esp_err_to_name(ret));
-        ir_tx_deinit(&ir_ctx);
-        return false;
-    }
-
-    ESP_LOGI(TAG, "✅ Código IR transmitido com sucesso!");
-
-    vTaskDelay(pdMS_TO_TICKS(100));
-    ir_tx_deinit(&ir_ctx);
-
-    ESP_LOGI(TAG, "=== FIM ir_tx_send_from_file ===\n");
-    return true;
-}
-
 // ========== Funções de inicialização ==========
 
 esp_err_t ir_tx_init(ir_context_t *ctx)
@@ -391,13 +251,3 @@ esp_err_t ir_tx_send_sony(ir_context_t *ctx, uint16_t address, uint8_t command,
     
     return ret;
 }
-
-void ir_tx_reset_rc6_toggle(void) {
-    g_rc6_toggle_state = 0;
-    ESP_LOGI(TAG, "RC6 toggle state reset to 0");
-}
-
-void ir_tx_reset_rc5_toggle(void) {
-    g_rc5_toggle_state = 0;
-    ESP_LOGI(TAG, "RC5 toggle state reset to 0");
-}
@@ -0,0 +1,205 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "ir_decoder.h"
+#include "protocol_nec.h"
+#include "protocol_rc6.h"
+#include "protocol_rc5.h"
+#include "protocol_samsung32.h"
+#include "protocol_sony.h"
+#include <string.h>
+
+// Decoders registrados. Em empate no mesmo pulso vence o primeiro.
+static const ir_decoder_t *const DECODERS[] = {
+    &ir_nec_decoder,
+    &ir_samsung32_decoder,
+    &ir_sony_decoder,
+    &ir_rc6_decoder,
+    &ir_rc5_decoder,
+};
+
+#define NUM_DECODERS    (sizeof(DECODERS) / sizeof(DECODERS[0]))
+
+typedef struct {
+    ir_decoder_state_t state[NUM_DECODERS];
+    bool active[NUM_DECODERS];
+    bool idle;                      // Último espaço foi silêncio entre quadros
+    ir_decode_result_t *results;
+    size_t max_results;
+    size_t count;
+} pipeline_t;
+
+// ========== Auxiliares para os decoders ==========
+
+bool ir_decode_match(uint32_t duration_us, uint32_t spec_us)
+{
+    uint32_t margin = spec_us / IR_DECODE_TOLERANCE + IR_DECODE_SLACK_US;
+    return duration_us + margin >= spec_us && duration_us <= spec_us + margin;
+}
+
+uint8_t ir_decode_units(uint32_t duration_us, uint32_t unit_us, uint8_t max_units)
+{
+    uint32_t units = (duration_us + unit_us / 2) / unit_us;
+    if (units == 0 || units > max_units) {
+        return 0;
+    }
+
+    uint32_t nominal = units * unit_us;
+    uint32_t error = (duration_us > nominal) ? duration_us - nominal : nominal - duration_us;
+    return (error * 5 <= unit_us * 2) ? units : 0;
+}
+
+int ir_decode_manchester(ir_decoder_state_t *state, bool mark, uint8_t width)
+{
+    if (state->phase == 0) {
+        if (state->fill == 0) {
+            state->level = mark;
+        } else if (mark != state->level) {
+            return -1;
+        }
+        if (++state->fill == width) {
+            state->phase = 1;
+            state->fill = 0;
+        }
+        return 0;
+    }
+
+    if (mark == state->level) {
+        return -1;
+    }
+    if (++state->fill < width) {
+        return 0;
+    }
+
+    state->data = (state->data << 1) | (state->level ? 1 : 0);
+    state->count++;
+    state->phase = 0;
+    state->fill = 0;
+    return 1;
+}
+
+// ========== Pipeline ==========
+
+static void emit(pipeline_t *p, const ir_decode_result_t *result)
+{
+    if (p->count >= p->max_results) {
+        return;
+    }
+
+    ir_decode_result_t *out = &p->results[p->count];
+    *out = *result;
+
+    // Repetição NEC herda o último quadro NEC; demais protocolos repetem o
+    // quadro inteiro enquanto a tecla estiver pressionada
+    const ir_decode_result_t *prev = NULL;
+    for (size_t i = p->count; i > 0; i--) {
+        if (p->results[i - 1].protocol == out->protocol) {
+            prev = &p->results[i - 1];
+            break;
+        }
+    }
+    if (out->repeat) {
+        out->address = prev ? prev->address : 0;
+        out->command = prev ? prev->command : 0;
+    } else if (prev && prev == &p->results[p->count - 1] &&
+               prev->address == out->address && prev->command == out->command &&
+               prev->toggle == out->toggle && prev->bits == out->bits) {
+        out->repeat = true;
+    }
+    p->count++;
+}
+
+static void feed_pulse(pipeline_t *p, bool mark, uint32_t duration_us)
+{
+    bool done = false;
+    ir_decode_result_t result;
+
+    for (size_t i = 0; i < NUM_DECODERS; i++) {
+        if (!p->active[i]) {
+            if (!mark || !p->idle) {
+                continue;
+            }
+            memset(&p->state[i], 0, sizeof(p->state[i]));
+            p->active[i] = true;
+        }
+
+        ir_decode_status_t status = DECODERS[i]->feed(&p->state[i], mark, duration_us, &result);
+        if (status == IR_DECODE_FAIL) {
+            p->active[i] = false;
+        } else if (status == IR_DECODE_DONE && !done) {
+            result.protocol = DECODERS[i]->protocol;
+            emit(p, &result);
+            done = true;
+        }
+    }
+
+    if (done) {
+        memset(p->active, 0, sizeof(p->active));
+    }
+    if (!mark) {
+        p->idle = duration_us >= IR_DECODE_IDLE_US;
+    }
+}
+
+size_t ir_decode(const rmt_symbol_word_t *symbols, size_t num_symbols,
+                 ir_decode_result_t *results, size_t max_results)
+{
+    if (!symbols || num_symbols == 0 || !results || max_results == 0) {
+        return 0;
+    }
+
+    pipeline_t p = {
+        .idle = true,
+        .results = results,
+        .max_results = max_results,
+    };
+
+    // O receptor pode ser ativo em 0 ou em 1: a captura começa numa marca
+    unsigned mark_level = symbols[0].level0;
+    bool mark = true;
+    uint32_t duration = 0;
+
+    for (size_t i = 0; i < num_symbols; i++) {
+        unsigned levels[2] = { symbols[i].level0, symbols[i].level1 };
+        uint32_t durations[2] = { symbols[i].duration0, symbols[i].duration1 };
+        bool end = false;
+
+        for (int h = 0; h < 2; h++) {
+            if (durations[h] == 0) {
+                end = true;     // Marcador de fim do RMT
+                break;
+            }
+            bool half_mark = (levels[h] == mark_level);
+            if (half_mark != mark && duration > 0) {
+                feed_pulse(&p, mark, duration);
+                duration = 0;
+            }
+            mark = half_mark;
+            duration += durations[h];
+        }
+        if (end) {
+            break;
+        }
+    }
+
+    // Silêncio depois da captura fecha o último quadro
+    if (duration > 0 && mark) {
+        feed_pulse(&p, true, duration);
+        duration = 0;
+    }
+    feed_pulse(&p, false, duration + IR_DECODE_IDLE_US);
+
+    return p.count;
+}
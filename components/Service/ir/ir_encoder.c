@@ -20,6 +20,7 @@
 #include "protocol_samsung32.h"
 #include "protocol_sony.h"
 #include "esp_log.h"
+#include <inttypes.h>
 #include <string.h>
 
 static const char *TAG = "ir_encoder";
@@ -37,7 +38,7 @@ esp_err_t rmt_new_ir_encoder(const ir_encoder_config_t *cfg, rmt_encoder_handle_
     
     switch (cfg->protocol) {
         case IR_PROTOCOL_NEC:
-            ESP_LOGI(TAG, "Creating NEC encoder with resolution=%lu", cfg->config.nec.resolution);
+            ESP_LOGI(TAG, "Creating NEC encoder with resolution=%" PRIu32, cfg->config.nec.resolution);
             ret = rmt_new_ir_nec_encoder(&cfg->config.nec, ret_encoder);
             if (ret == ESP_OK) {
                 ESP_LOGI(TAG, "✅ NEC encoder created successfully");
@@ -47,7 +48,7 @@ esp_err_t rmt_new_ir_encoder(const ir_encoder_config_t *cfg, rmt_encoder_handle_
             break;
             
         case IR_PROTOCOL_RC6:
-            ESP_LOGI(TAG, "Creating RC6 encoder with resolution=%lu", cfg->config.rc6.resolution);
+            ESP_LOGI(TAG, "Creating RC6 encoder with resolution=%" PRIu32, cfg->config.rc6.resolution);
             ret = rmt_new_ir_rc6_encoder(&cfg->config.rc6, ret_encoder);
             if (ret == ESP_OK) {
                 ESP_LOGI(TAG, "✅ RC6 encoder created successfully");
@@ -57,7 +58,7 @@ esp_err_t rmt_new_ir_encoder(const ir_encoder_config_t *cfg, rmt_encoder_handle_
             break;
             
         case IR_PROTOCOL_RC5:
-            ESP_LOGI(TAG, "Creating RC5 encoder with resolution=%lu", cfg->config.rc5.resolution);
+            ESP_LOGI(TAG, "Creating RC5 encoder with resolution=%" PRIu32, cfg->config.rc5.resolution);
             ret = rmt_new_ir_rc5_encoder(&cfg->config.rc5, ret_encoder);
             if (ret == ESP_OK) {
                 ESP_LOGI(TAG, "✅ RC5 encoder created successfully");
@@ -67,7 +68,7 @@ esp_err_t rmt_new_ir_encoder(const ir_encoder_config_t *cfg, rmt_encoder_handle_
             break;
             
         case IR_PROTOCOL_SAMSUNG32:
-            ESP_LOGI(TAG, "Creating Samsung32 encoder with resolution=%lu", cfg->config.samsung32.resolution);
+            ESP_LOGI(TAG, "Creating Samsung32 encoder with resolution=%" PRIu32, cfg->config.samsung32.resolution);
             ret = rmt_new_ir_samsung32_encoder(&cfg->config.samsung32, ret_encoder);
             if (ret == ESP_OK) {
                 ESP_LOGI(TAG, "✅ Samsung32 encoder created successfully");
@@ -77,7 +78,7 @@ esp_err_t rmt_new_ir_encoder(const ir_encoder_config_t *cfg, rmt_encoder_handle_
             break;
             
         case IR_PROTOCOL_SIRC:
-            ESP_LOGI(TAG, "Creating Sony SIRC encoder with resolution=%lu", cfg->config.sony.resolution);
+            ESP_LOGI(TAG, "Creating Sony SIRC encoder with resolution=%" PRIu32, cfg->config.sony.resolution);
             ret = rmt_new_ir_sony_encoder(&cfg->config.sony, ret_encoder);
             if (ret == ESP_OK) {
                 ESP_LOGI(TAG, "✅ Sony SIRC encoder created successfully");
@@ -0,0 +1,1394 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "ir_library.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include <sys/stat.h>
+
+static const char *TAG = "IR_LIBRARY";
+
+#define IR_LIBRARY_PATH_MAX     128
+#define IR_LIBRARY_LINE_MAX     128     // Prefixo guardado de cada linha (data: vai além)
+#define IR_LIBRARY_COPY_CHUNK   256
+#define IR_LIBRARY_POOL_MAX     0xFFFF  // Offsets de 16 bits
+#define IR_LIBRARY_NO_TYPE      0xFF
+
+#define IR_LIBRARY_HEADER       "Filetype: IR signals file\nVersion: 1\n"
+#define IR_LIBRARY_SEPARATOR    "# \n"  // O Flipper escreve antes de cada sinal
+
+/**
+ * @brief Sinal no índice (o texto fica no pool de strings)
+ */
+typedef struct {
+    uint32_t offset;        // Início do bloco (linha separadora, se houver)
+    uint32_t body;          // Da linha "name:" ao fim da última linha chave: valor
+    uint32_t address;
+    uint32_t command;
+    uint32_t frequency;
+    float duty_cycle;
+    uint16_t name;          // Offset no pool
+    uint16_t protocol;      // Offset no pool (parsed)
+    uint16_t timings;       // Tempos em data (raw)
+    uint16_t next;          // Próximo no bucket: índice + 1 (0 = fim)
+    uint8_t sep;            // Tamanho da linha separadora
+    uint8_t type;
+    uint8_t toggle;
+    uint8_t bits;
+} entry_t;
+
+typedef struct {
+    char path[IR_LIBRARY_PATH_MAX];
+    bool valid;
+    off_t size;             // Arquivo de onde o índice saiu
+    time_t mtime;
+    uint32_t last_use;
+    entry_t *entries;       // Na ordem do arquivo
+    uint16_t count;
+    uint16_t capacity;
+    char *pool;
+    uint32_t pool_len;
+    uint32_t pool_cap;
+    uint16_t *buckets;      // Índice + 1 do primeiro sinal de cada bucket
+    uint16_t num_buckets;
+} ir_index_t;
+
+static ir_index_t s_cache[IR_LIBRARY_CACHE_FILES];
+static uint32_t s_clock = 0;
+static ir_library_stats_t s_stats;
+static SemaphoreHandle_t s_lock = NULL;
+
+/* ============================================================================
+ * LEITURA DE LINHAS
+ * ============================================================================ */
+
+typedef struct {
+    FILE *f;
+    char buf[IR_LIBRARY_COPY_CHUNK];
+    size_t len;
+    size_t pos;
+    uint32_t offset;        // Posição no arquivo do próximo caractere
+} reader_t;
+
+typedef struct {
+    uint32_t start;
+    uint32_t length;        // Com o '\n'
+    uint16_t tokens;        // Palavras na linha inteira
+    char text[IR_LIBRARY_LINE_MAX];     // Prefixo sem '\r', '\n' e espaços finais
+} line_t;
+
+static void reader_init(reader_t *r, FILE *f, uint32_t offset)
+{
+    r->f = f;
+    r->len = 0;
+    r->pos = 0;
+    r->offset = offset;
+}
+
+static int reader_getc(reader_t *r)
+{
+    if (r->pos == r->len) {
+        r->len = fread(r->buf, 1, sizeof(r->buf), r->f);
+        r->pos = 0;
+        if (r->len == 0) {
+            return EOF;
+        }
+    }
+    r->offset++;
+    return (unsigned char)r->buf[r->pos++];
+}
+
+static bool reader_line(reader_t *r, line_t *line)
+{
+    size_t n = 0;
+    bool in_token = false;
+    int c;
+
+    line->start = r->offset;
+    line->tokens = 0;
+    while ((c = reader_getc(r)) != EOF && c != '\n') {
+        if (c == ' ' || c == '\t' || c == '\r') {
+            in_token = false;
+        } else if (!in_token) {
+            in_token = true;
+            if (line->tokens < UINT16_MAX) {
+                line->tokens++;
+            }
+        }
+        if (c != '\r' && n < sizeof(line->text) - 1) {
+            line->text[n++] = (char)c;
+        }
+    }
+    while (n > 0 && line->text[n - 1] == ' ') {
+        n--;
+    }
+    line->text[n] = '\0';
+    line->length = r->offset - line->start;
+    return line->length > 0;
+}
+
+// Valor de "key: valor", ou NULL se a linha é de outra chave
+static const char *value_of(const char *text, const char *key)
+{
+    size_t len = strlen(key);
+    if (strncmp(text, key, len) != 0 || text[len] != ':') {
+        return NULL;
+    }
+    text += len + 1;
+    while (*text == ' ') {
+        text++;
+    }
+    return text;
+}
+
+// "#" seguido só de espaços: separador entre sinais
+static bool is_separator(const char *text)
+{
+    if (text[0] != '#') {
+        return false;
+    }
+    return text[1 + strspn(text + 1, " ")] == '\0';
+}
+
+/* ============================================================================
+ * VALORES
+ * ============================================================================ */
+
+// "07 00 00 00" (Flipper, little-endian) ou "00000007" (formato antigo)
+static uint32_t parse_hex(const char *value, bool *bytes)
+{
+    char *end;
+    uint32_t out = strtoul(value, &end, 16);
+    *bytes = (*end == ' ');
+    if (!*bytes) {
+        return out;
+    }
+
+    out &= 0xFF;
+    for (int shift = 8; shift < 32 && *end == ' '; shift += 8) {
+        const char *p = end + 1;
+        uint32_t byte = strtoul(p, &end, 16);
+        if (end == p) {
+            break;
+        }
+        out |= (byte & 0xFF) << shift;
+    }
+    return out;
+}
+
+// Byte seguido do seu inverso, como o NEC e o Samsung32 transmitem
+static uint32_t with_inverse(uint32_t value)
+{
+    value &= 0xFF;
+    return value | ((~value & 0xFF) << 8);
+}
+
+// Flipper -> valores dos encoders
+static void values_from_flipper(const char *protocol, uint32_t *address, uint32_t *command)
+{
+    if (strcmp(protocol, "NEC") == 0) {
+        *address = with_inverse(*address);
+        *command = with_inverse(*command);
+    } else if (strcmp(protocol, "Samsung32") == 0) {
+        // O encoder Samsung32 transmite primeiro os 16 bits de command
+        uint32_t custom = *address & 0xFF;
+        *address = with_inverse(*command);
+        *command = custom | (custom << 8);
+    }
+}
+
+// Valores dos encoders -> Flipper; false se não têm representação
+static bool values_to_flipper(char *protocol, size_t size, uint32_t *address, uint32_t *command)
+{
+    if (strcmp(protocol, "NEC") == 0) {
+        if (*address == with_inverse(*address) && *command == with_inverse(*command)) {
+            *address &= 0xFF;
+            *command &= 0xFF;
+        } else {
+            snprintf(protocol, size, "NECext");     // 16 bits sem inverso
+        }
+    } else if (strcmp(protocol, "Samsung32") == 0) {
+        uint32_t custom = *command & 0xFF;
+        if (*command != (custom | (custom << 8)) || *address != with_inverse(*address)) {
+            return false;
+        }
+        *command = *address & 0xFF;
+        *address = custom;
+    }
+    return true;
+}
+
+/* ============================================================================
+ * ÍNDICE
+ * ============================================================================ */
+
+static uint32_t hash_name(const char *name)
+{
+    uint32_t hash = 2166136261u;    // FNV-1a
+    while (*name) {
+        hash = (hash ^ (uint8_t)*name++) * 16777619u;
+    }
+    return hash;
+}
+
+static void index_clear(ir_index_t *idx)
+{
+    free(idx->entries);
+    free(idx->pool);
+    free(idx->buckets);
+    memset(idx, 0, sizeof(*idx));
+}
+
+static int pool_add(ir_index_t *idx, const char *str)
+{
+    size_t len = strlen(str) + 1;
+    if (idx->pool_len + len > IR_LIBRARY_POOL_MAX) {
+        return -1;
+    }
+    if (idx->pool_len + len > idx->pool_cap) {
+        uint32_t cap = idx->pool_cap ? idx->pool_cap * 2 : 512;
+        while (cap < idx->pool_len + len) {
+            cap *= 2;
+        }
+        char *pool = realloc(idx->pool, cap);
+        if (!pool) {
+            return -1;
+        }
+        idx->pool = pool;
+        idx->pool_cap = cap;
+    }
+    memcpy(idx->pool + idx->pool_len, str, len);
+    idx->pool_len += len;
+    return (int)(idx->pool_len - len);
+}
+
+static const char *entry_name(const ir_index_t *idx, const entry_t *e)
+{
+    return idx->pool + e->name;
+}
+
+// Encadeia de trás para frente: em nomes repetidos o primeiro do arquivo vence
+static esp_err_t index_rehash(ir_index_t *idx)
+{
+    uint16_t num_buckets = 16;
+    while (num_buckets < idx->count) {
+        num_buckets *= 2;
+    }
+    if (num_buckets != idx->num_buckets) {
+        uint16_t *buckets = realloc(idx->buckets, num_buckets * sizeof(uint16_t));
+        if (!buckets) {
+            return ESP_ERR_NO_MEM;
+        }
+        idx->buckets = buckets;
+        idx->num_buckets = num_buckets;
+    }
+    memset(idx->buckets, 0, idx->num_buckets * sizeof(uint16_t));
+
+    for (int i = idx->count - 1; i >= 0; i--) {
+        uint32_t b = hash_name(entry_name(idx, &idx->entries[i])) & (idx->num_buckets - 1);
+        idx->entries[i].next = idx->buckets[b];
+        idx->buckets[b] = i + 1;
+    }
+    return ESP_OK;
+}
+
+static int index_find(const ir_index_t *idx, const char *name)
+{
+    if (idx->count == 0) {
+        return -1;
+    }
+    uint32_t b = hash_name(name) & (idx->num_buckets - 1);
+    for (uint16_t i = idx->buckets[b]; i != 0; i = idx->entries[i - 1].next) {
+        if (strcmp(entry_name(idx, &idx->entries[i - 1]), name) == 0) {
+            return i - 1;
+        }
+    }
+    return -1;
+}
+
+static esp_err_t index_push(ir_index_t *idx, const entry_t *e)
+{
+    if (idx->count >= IR_LIBRARY_MAX_SIGNALS) {
+        return ESP_ERR_NO_MEM;
+    }
+    if (idx->count == idx->capacity) {
+        uint16_t capacity = idx->capacity ? idx->capacity * 2 : 16;
+        entry_t *entries = realloc(idx->entries, capacity * sizeof(entry_t));
+        if (!entries) {
+            return ESP_ERR_NO_MEM;
+        }
+        idx->entries = entries;
+        idx->capacity = capacity;
+    }
+    idx->entries[idx->count++] = *e;
+    return ESP_OK;
+}
+
+static void index_remove(ir_index_t *idx, int i)
+{
+    memmove(&idx->entries[i], &idx->entries[i + 1], (idx->count - i - 1) * sizeof(entry_t));
+    idx->count--;
+}
+
+typedef struct {
+    entry_t entry;
+    bool open;
+    bool bytes;             // address/command no formato do Flipper
+    char name[IR_LIBRARY_NAME_MAX];
+    char protocol[sizeof(((ir_code_t *)0)->protocol)];
+} block_t;
+
+static void block_open(block_t *b, const char *name)
+{
+    memset(b, 0, sizeof(*b));
+    b->open = true;
+    b->entry.type = IR_LIBRARY_NO_TYPE;
+    b->entry.toggle = 0xFF;
+    b->entry.bits = 0xFF;
+    snprintf(b->name, sizeof(b->name), "%s", name);
+}
+
+// Fecha o bloco: false se o sinal está incompleto; senão converte os valores
+static bool block_finish(const char *path, block_t *b)
+{
+    entry_t *e = &b->entry;
+    b->open = false;
+
+    if (e->type == IR_SIGNAL_PARSED && b->protocol[0] == '\0') {
+        e->type = IR_LIBRARY_NO_TYPE;
+    }
+    if (e->type == IR_SIGNAL_RAW && e->timings == 0) {
+        e->type = IR_LIBRARY_NO_TYPE;
+    }
+    if (e->type == IR_LIBRARY_NO_TYPE || b->name[0] == '\0') {
+        ESP_LOGW(TAG, "Sinal incompleto ignorado em %s (offset %" PRIu32 ")", path, e->offset);
+        return false;
+    }
+
+    if (e->type == IR_SIGNAL_PARSED && b->bytes) {
+        values_from_flipper(b->protocol, &e->address, &e->command);
+    }
+    return true;
+}
+
+static esp_err_t block_commit(ir_index_t *idx, block_t *b)
+{
+    entry_t *e = &b->entry;
+    if (!block_finish(idx->path, b)) {
+        return ESP_OK;
+    }
+
+    int name = pool_add(idx, b->name);
+    if (name < 0) {
+        return ESP_ERR_NO_MEM;
+    }
+    e->name = name;
+
+    if (e->type == IR_SIGNAL_PARSED) {
+        // Protocolos costumam se repetir em sequência
+        const entry_t *prev = idx->count ? &idx->entries[idx->count - 1] : NULL;
+        if (prev && prev->type == IR_SIGNAL_PARSED &&
+            strcmp(idx->pool + prev->protocol, b->protocol) == 0) {
+            e->protocol = prev->protocol;
+        } else {
+            int protocol = pool_add(idx, b->protocol);
+            if (protocol < 0) {
+                return ESP_ERR_NO_MEM;
+            }
+            e->protocol = protocol;
+        }
+    }
+    return index_push(idx, e);
+}
+
+static void block_line(block_t *b, const line_t *line)
+{
+    entry_t *e = &b->entry;
+    const char *v;
+
+    if ((v = value_of(line->text, "type"))) {
+        e->type = (strcmp(v, "parsed") == 0) ? IR_SIGNAL_PARSED :
+                  (strcmp(v, "raw") == 0) ? IR_SIGNAL_RAW : IR_LIBRARY_NO_TYPE;
+    } else if ((v = value_of(line->text, "protocol"))) {
+        snprintf(b->protocol, sizeof(b->protocol), "%s", v);
+    } else if ((v = value_of(line->text, "address"))) {
+        e->address = parse_hex(v, &b->bytes);
+    } else if ((v = value_of(line->text, "command"))) {
+        e->command = parse_hex(v, &b->bytes);
+    } else if ((v = value_of(line->text, "toggle"))) {
+        e->toggle = (uint8_t)strtoul(v, NULL, 16);
+    } else if ((v = value_of(line->text, "bits"))) {
+        e->bits = (uint8_t)strtoul(v, NULL, 10);
+    } else if ((v = value_of(line->text, "frequency"))) {
+        e->frequency = strtoul(v, NULL, 10);
+    } else if ((v = value_of(line->text, "duty_cycle"))) {
+        e->duty_cycle = strtof(v, NULL);
+    } else if (value_of(line->text, "data")) {
+        uint32_t timings = e->timings + line->tokens - 1;
+        e->timings = (timings > UINT16_MAX) ? UINT16_MAX : timings;
+    }
+}
+
+// Linhas em branco e o "Filetype:" do início
+static esp_err_t read_header(reader_t *r)
+{
+    line_t line;
+    while (reader_line(r, &line)) {
+        if (line.text[0] == '\0') {
+            continue;
+        }
+        const char *v = value_of(line.text, "Filetype");
+        if (!v || (strcmp(v, "IR signals file") != 0 && strcmp(v, "IR library file") != 0)) {
+            break;
+        }
+        return ESP_OK;
+    }
+    return ESP_ERR_INVALID_RESPONSE;
+}
+
+static esp_err_t index_build(ir_index_t *idx)
+{
+    FILE *f = fopen(idx->path, "r");
+    if (!f) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    reader_t r;
+    reader_init(&r, f, 0);
+    line_t line;
+    block_t b = { .open = false };
+    uint32_t sep_start = 0;
+    bool after_sep = false;
+    esp_err_t ret = read_header(&r);
+
+    while (ret == ESP_OK && reader_line(&r, &line)) {
+        const char *name = value_of(line.text, "name");
+        if (name) {
+            if (b.open) {
+                ret = block_commit(idx, &b);
+            }
+            block_open(&b, name);
+            b.entry.offset = after_sep ? sep_start : line.start;
+            b.entry.sep = after_sep ? line.start - sep_start : 0;
+            b.entry.body = line.length;
+        } else if (b.open && line.text[0] != '#' && line.text[0] != '\0') {
+            block_line(&b, &line);
+            b.entry.body = line.start + line.length - b.entry.offset - b.entry.sep;
+        }
+
+        after_sep = is_separator(line.text);
+        sep_start = line.start;
+    }
+
+    if (ret == ESP_OK && b.open) {
+        ret = block_commit(idx, &b);
+    }
+    if (ret == ESP_OK && ferror(f)) {
+        ret = ESP_FAIL;
+    }
+    fclose(f);
+
+    if (ret == ESP_OK) {
+        ret = index_rehash(idx);
+    }
+    if (ret == ESP_ERR_INVALID_RESPONSE) {
+        ESP_LOGE(TAG, "Não é um arquivo IR: %s", idx->path);
+    }
+    return ret;
+}
+
+static void index_stamp(ir_index_t *idx)
+{
+    struct stat st;
+    if (stat(idx->path, &st) == 0) {
+        idx->size = st.st_size;
+        idx->mtime = st.st_mtime;
+    } else {
+        idx->valid = false;
+    }
+}
+
+static ir_index_t *cache_lookup(const char *path)
+{
+    for (int i = 0; i < IR_LIBRARY_CACHE_FILES; i++) {
+        if (s_cache[i].path[0] && strcmp(s_cache[i].path, path) == 0) {
+            return &s_cache[i];
+        }
+    }
+    return NULL;
+}
+
+// Índice atual do arquivo, montado se preciso (com o lock)
+static esp_err_t index_open(const char *path, ir_index_t **out)
+{
+    if (strlen(path) >= IR_LIBRARY_PATH_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    ir_index_t *idx = cache_lookup(path);
+    struct stat st;
+    if (stat(path, &st) != 0) {
+        if (idx) {
+            index_clear(idx);
+        }
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    if (idx && idx->valid && idx->size == st.st_size && idx->mtime == st.st_mtime) {
+        s_stats.hits++;
+        idx->last_use = ++s_clock;
+        *out = idx;
+        return ESP_OK;
+    }
+
+    if (idx) {
+        if (idx->valid) {
+            s_stats.rebuilds++;
+        }
+    } else {
+        idx = &s_cache[0];
+        for (int i = 1; i < IR_LIBRARY_CACHE_FILES; i++) {
+            if (s_cache[i].last_use < idx->last_use) {
+                idx = &s_cache[i];
+            }
+        }
+    }
+
+    index_clear(idx);
+    snprintf(idx->path, sizeof(idx->path), "%s", path);
+    esp_err_t ret = index_build(idx);
+    if (ret != ESP_OK) {
+        index_clear(idx);
+        return ret;
+    }
+
+    idx->valid = true;
+    idx->size = st.st_size;
+    idx->mtime = st.st_mtime;
+    idx->last_use = ++s_clock;
+    s_stats.builds++;
+    *out = idx;
+    return ESP_OK;
+}
+
+static bool lock(void)
+{
+    if (!s_lock) {
+        s_lock = xSemaphoreCreateMutex();
+        if (!s_lock) {
+            return false;
+        }
+    }
+    xSemaphoreTake(s_lock, portMAX_DELAY);
+    return true;
+}
+
+static void unlock(void)
+{
+    xSemaphoreGive(s_lock);
+}
+
+static void entry_to_signal(const ir_index_t *idx, const entry_t *e, ir_signal_t *signal)
+{
+    memset(signal, 0, sizeof(*signal));
+    snprintf(signal->name, sizeof(signal->name), "%s", entry_name(idx, e));
+    signal->type = (ir_signal_type_t)e->type;
+    signal->code.toggle = e->toggle;
+    signal->code.bits = e->bits;
+    if (e->type == IR_SIGNAL_PARSED) {
+        snprintf(signal->code.protocol, sizeof(signal->code.protocol), "%s", idx->pool + e->protocol);
+        signal->code.address = e->address;
+        signal->code.command = e->command;
+    } else {
+        signal->frequency = e->frequency;
+        signal->duty_cycle = e->duty_cycle;
+        signal->num_timings = e->timings;
+    }
+}
+
+/* ============================================================================
+ * CONSULTA
+ * ============================================================================ */
+
+esp_err_t ir_library_count(const char *path, size_t *count)
+{
+    if (!path || !count) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!lock()) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    ir_index_t *idx;
+    esp_err_t ret = index_open(path, &idx);
+    if (ret == ESP_OK) {
+        *count = idx->count;
+    }
+    unlock();
+    return ret;
+}
+
+esp_err_t ir_library_get(const char *path, size_t index, ir_signal_t *signal)
+{
+    if (!path || !signal) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!lock()) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    ir_index_t *idx;
+    esp_err_t ret = index_open(path, &idx);
+    if (ret == ESP_OK) {
+        if (index < idx->count) {
+            entry_to_signal(idx, &idx->entries[index], signal);
+        } else {
+            ret = ESP_ERR_NOT_FOUND;
+        }
+    }
+    unlock();
+    return ret;
+}
+
+esp_err_t ir_library_find(const char *path, const char *name, ir_signal_t *signal)
+{
+    if (!path || !name || !signal) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!lock()) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    ir_index_t *idx;
+    esp_err_t ret = index_open(path, &idx);
+    if (ret == ESP_OK) {
+        int i = index_find(idx, name);
+        if (i >= 0) {
+            entry_to_signal(idx, &idx->entries[i], signal);
+        } else {
+            ret = ESP_ERR_NOT_FOUND;
+        }
+    }
+    unlock();
+    return ret;
+}
+
+// Números de uma linha "data:" a partir do ':'
+static esp_err_t parse_timings(reader_t *r, uint32_t *timings, size_t max_timings, size_t *count)
+{
+    int c;
+    while ((c = reader_getc(r)) != EOF && c != ':' && c != '\n') {
+    }
+
+    uint32_t value = 0;
+    bool digits = false;
+    do {
+        c = reader_getc(r);
+        if (c >= '0' && c <= '9') {
+            value = value * 10 + (c - '0');
+            digits = true;
+            continue;
+        }
+        if (digits) {
+            if (*count >= max_timings) {
+                return ESP_ERR_INVALID_SIZE;
+            }
+            timings[(*count)++] = value;
+            value = 0;
+            digits = false;
+        }
+    } while (c != EOF && c != '\n');
+    return ESP_OK;
+}
+
+esp_err_t ir_library_read_raw(const char *path, const char *name,
+                              uint32_t *timings, size_t max_timings, size_t *count)
+{
+    if (!path || !name || !timings || !count) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!lock()) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    ir_index_t *idx;
+    esp_err_t ret = index_open(path, &idx);
+    int i = (ret == ESP_OK) ? index_find(idx, name) : -1;
+    if (ret == ESP_OK && i < 0) {
+        ret = ESP_ERR_NOT_FOUND;
+    }
+    if (ret == ESP_OK && idx->entries[i].type != IR_SIGNAL_RAW) {
+        ret = ESP_ERR_INVALID_ARG;
+    }
+
+    FILE *f = NULL;
+    if (ret == ESP_OK) {
+        f = fopen(path, "r");
+        ret = f ? ESP_OK : ESP_ERR_NOT_FOUND;
+    }
+
+    if (ret == ESP_OK) {
+        const entry_t *e = &idx->entries[i];
+        uint32_t start = e->offset + e->sep;
+        uint32_t end = start + e->body;
+        reader_t r;
+        line_t line;
+
+        *count = 0;
+        fseek(f, start, SEEK_SET);
+        reader_init(&r, f, start);
+        while (ret == ESP_OK && r.offset < end && reader_line(&r, &line)) {
+            if (value_of(line.text, "data")) {
+                // A linha inteira pode ter milhares de caracteres: relê direto
+                fseek(f, line.start, SEEK_SET);
+                reader_init(&r, f, line.start);
+                ret = parse_timings(&r, timings, max_timings, count);
+            }
+        }
+        fclose(f);
+    }
+
+    unlock();
+    return ret;
+}
+
+/* ============================================================================
+ * LEITURA EM SEQUÊNCIA
+ * ============================================================================ */
+
+struct ir_library_cursor {
+    FILE *f;
+    reader_t r;
+    block_t b;              // Sinal aberto pela última linha "name:"
+    size_t timings;         // Tempos do sinal aberto já lidos
+    esp_err_t error;        // Tempos além de max_timings no sinal aberto
+    char path[IR_LIBRARY_PATH_MAX];
+};
+
+esp_err_t ir_library_cursor_open(const char *path, ir_library_cursor_t **cursor)
+{
+    if (!path || !cursor || strlen(path) >= IR_LIBRARY_PATH_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    ir_library_cursor_t *c = calloc(1, sizeof(*c));
+    if (!c) {
+        return ESP_ERR_NO_MEM;
+    }
+    c->f = fopen(path, "r");
+    if (!c->f) {
+        free(c);
+        return ESP_ERR_NOT_FOUND;
+    }
+    snprintf(c->path, sizeof(c->path), "%s", path);
+    reader_init(&c->r, c->f, 0);
+
+    esp_err_t ret = read_header(&c->r);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Não é um arquivo IR: %s", path);
+        ir_library_cursor_close(c);
+        return ret;
+    }
+    *cursor = c;
+    return ESP_OK;
+}
+
+static void block_to_signal(const block_t *b, size_t timings, ir_signal_t *signal)
+{
+    const entry_t *e = &b->entry;
+    memset(signal, 0, sizeof(*signal));
+    snprintf(signal->name, sizeof(signal->name), "%s", b->name);
+    signal->type = (ir_signal_type_t)e->type;
+    signal->code.toggle = e->toggle;
+    signal->code.bits = e->bits;
+    if (e->type == IR_SIGNAL_PARSED) {
+        snprintf(signal->code.protocol, sizeof(signal->code.protocol), "%s", b->protocol);
+        signal->code.address = e->address;
+        signal->code.command = e->command;
+    } else {
+        signal->frequency = e->frequency;
+        signal->duty_cycle = e->duty_cycle;
+        signal->num_timings = timings;
+    }
+}
+
+// Um sinal termina na linha "name:" do seguinte ou no fim do arquivo
+esp_err_t ir_library_cursor_next(ir_library_cursor_t *c, ir_signal_t *signal,
+                                 uint32_t *timings, size_t max_timings)
+{
+    if (!c || !signal) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    line_t line;
+    for (;;) {
+        bool more = reader_line(&c->r, &line);
+        const char *name = more ? value_of(line.text, "name") : NULL;
+
+        if (!more || name) {
+            block_t done = c->b;
+            size_t count = timings ? c->timings : c->b.entry.timings;
+            esp_err_t ret = c->error;
+            c->b.open = false;
+            c->timings = 0;
+            c->error = ESP_OK;
+            if (name) {
+                block_open(&c->b, name);
+                c->b.entry.offset = line.start;
+            }
+            if (done.open && block_finish(c->path, &done)) {
+                block_to_signal(&done, count, signal);
+                return ret;
+            }
+            if (!more) {
+                return ferror(c->f) ? ESP_FAIL : ESP_ERR_NOT_FOUND;
+            }
+            continue;
+        }
+
+        if (!c->b.open || line.text[0] == '#' || line.text[0] == '\0') {
+            continue;
+        }
+        block_line(&c->b, &line);
+
+        if (timings && c->error == ESP_OK && value_of(line.text, "data")) {
+            // A linha inteira pode ter milhares de caracteres: relê direto
+            fseek(c->f, line.start, SEEK_SET);
+            reader_init(&c->r, c->f, line.start);
+            c->error = parse_timings(&c->r, timings, max_timings, &c->timings);
+            if (c->error != ESP_OK) {
+                int ch;
+                while ((ch = reader_getc(&c->r)) != EOF && ch != '\n') {
+                }
+            }
+        }
+    }
+}
+
+void ir_library_cursor_close(ir_library_cursor_t *cursor)
+{
+    if (cursor) {
+        fclose(cursor->f);
+        free(cursor);
+    }
+}
+
+/* ============================================================================
+ * ALTERAÇÃO
+ * ============================================================================ */
+
+static bool name_valid(const char *name)
+{
+    size_t len = name ? strlen(name) : 0;
+    return len > 0 && len < IR_LIBRARY_NAME_MAX && !strpbrk(name, "\r\n");
+}
+
+// Cobre [start, start + len) com '#', mantendo as quebras de linha
+static esp_err_t cover(FILE *f, uint32_t start, uint32_t len)
+{
+    char buf[IR_LIBRARY_COPY_CHUNK];
+
+    while (len > 0) {
+        size_t n = (len < sizeof(buf)) ? len : sizeof(buf);
+        if (fseek(f, start, SEEK_SET) != 0 || fread(buf, 1, n, f) != n) {
+            return ESP_FAIL;
+        }
+        for (size_t i = 0; i < n; i++) {
+            if (buf[i] != '\n' && buf[i] != '\r') {
+                buf[i] = '#';
+            }
+        }
+        if (fseek(f, start, SEEK_SET) != 0 || fwrite(buf, 1, n, f) != n) {
+            return ESP_FAIL;
+        }
+        start += n;
+        len -= n;
+    }
+    return ESP_OK;
+}
+
+// Retira o sinal do arquivo: trunca se é o último bloco, senão cobre
+static esp_err_t remove_block(ir_index_t *idx, int i)
+{
+    const entry_t *e = &idx->entries[i];
+    uint32_t end = e->offset + e->sep + e->body;
+    esp_err_t ret;
+
+    if (end == (uint32_t)idx->size) {
+        ret = (truncate(idx->path, e->offset) == 0) ? ESP_OK : ESP_FAIL;
+    } else {
+        FILE *f = fopen(idx->path, "r+");
+        if (!f) {
+            return ESP_FAIL;
+        }
+        ret = cover(f, e->offset, e->sep + e->body);
+        if (fclose(f) != 0) {
+            ret = ESP_FAIL;
+        }
+    }
+
+    if (ret == ESP_OK) {
+        index_remove(idx, i);
+        ret = index_rehash(idx);
+    }
+    return ret;
+}
+
+// Grava "# \nname: ...\n" + corpo no fim do arquivo e indexa o sinal
+static esp_err_t append_block(ir_index_t *idx, entry_t *e, const char *name,
+                              esp_err_t (*write_body)(FILE *f, const void *arg), const void *arg)
+{
+    bool newline = false;
+    FILE *f = fopen(idx->path, "r");
+    if (f && idx->size > 0 && fseek(f, -1, SEEK_END) == 0) {
+        newline = (fgetc(f) != '\n');
+    }
+    if (f) {
+        fclose(f);
+    }
+
+    f = fopen(idx->path, "a");
+    if (!f) {
+        return ESP_FAIL;
+    }
+
+    uint32_t offset = idx->size + (newline ? 1 : 0);
+    if (newline) {
+        fputc('\n', f);
+    }
+    fputs(IR_LIBRARY_SEPARATOR, f);
+    fprintf(f, "name: %s\n", name);
+    esp_err_t ret = write_body(f, arg);
+    long end = ftell(f);
+    if (ferror(f)) {
+        ret = ESP_FAIL;
+    }
+    if (fclose(f) != 0) {
+        ret = ESP_FAIL;
+    }
+    if (ret != ESP_OK) {
+        idx->valid = false;     // Bloco pela metade: relê na próxima consulta
+        return ret;
+    }
+
+    int name_off = pool_add(idx, name);
+    if (name_off < 0) {
+        idx->valid = false;
+        return ESP_ERR_NO_MEM;
+    }
+    e->name = name_off;
+    e->offset = offset;
+    e->sep = strlen(IR_LIBRARY_SEPARATOR);
+    e->body = (end > 0) ? end - offset - e->sep : 0;
+    if (end <= 0) {
+        idx->valid = false;
+    }
+
+    ret = index_push(idx, e);
+    if (ret == ESP_OK) {
+        ret = index_rehash(idx);
+    }
+    if (ret != ESP_OK) {
+        idx->valid = false;
+    }
+    return ret;
+}
+
+typedef struct {
+    const ir_signal_t *signal;
+    const uint32_t *timings;
+    const char *protocol;
+    uint32_t address;
+    uint32_t command;
+} signal_body_t;
+
+static esp_err_t write_signal(FILE *f, const void *arg)
+{
+    const signal_body_t *s = arg;
+
+    if (s->signal->type == IR_SIGNAL_RAW) {
+        fprintf(f, "type: raw\n");
+        fprintf(f, "frequency: %" PRIu32 "\n", s->signal->frequency);
+        fprintf(f, "duty_cycle: %f\n", s->signal->duty_cycle);
+        fprintf(f, "data:");
+        for (size_t i = 0; i < s->signal->num_timings; i++) {
+            fprintf(f, " %" PRIu32, s->timings[i]);
+        }
+        fprintf(f, "\n");
+        return ESP_OK;
+    }
+
+    fprintf(f, "type: parsed\n");
+    fprintf(f, "protocol: %s\n", s->protocol);
+    fprintf(f, "address: %02" PRIX32 " %02" PRIX32 " %02" PRIX32 " %02" PRIX32 "\n",
+            s->address & 0xFF, (s->address >> 8) & 0xFF,
+            (s->address >> 16) & 0xFF, s->address >> 24);
+    fprintf(f, "command: %02" PRIX32 " %02" PRIX32 " %02" PRIX32 " %02" PRIX32 "\n",
+            s->command & 0xFF, (s->command >> 8) & 0xFF,
+            (s->command >> 16) & 0xFF, s->command >> 24);
+
+    // Extensões deste firmware (o Flipper ignora chaves que não conhece)
+    if (s->signal->code.toggle != 0xFF) {
+        fprintf(f, "toggle: %02X\n", s->signal->code.toggle);
+    }
+    if (s->signal->code.bits != 0xFF) {
+        fprintf(f, "bits: %d\n", s->signal->code.bits);
+    }
+    return ESP_OK;
+}
+
+static esp_err_t create_file(const char *path)
+{
+    FILE *f = fopen(path, "w");
+    if (!f) {
+        ESP_LOGE(TAG, "Falha ao criar arquivo: %s", path);
+        return ESP_FAIL;
+    }
+    fputs(IR_LIBRARY_HEADER, f);
+    return (fclose(f) == 0) ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t ir_library_append(const char *path, const ir_signal_t *signal, const uint32_t *timings)
+{
+    if (!path || !signal || !name_valid(signal->name)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (signal->type == IR_SIGNAL_RAW &&
+        (!timings || signal->num_timings == 0 || signal->num_timings > IR_LIBRARY_MAX_TIMINGS)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (signal->type == IR_SIGNAL_PARSED &&
+        (signal->code.protocol[0] == '\0' || strpbrk(signal->code.protocol, "\r\n"))) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    entry_t e = {
+        .type = signal->type,
+        .toggle = 0xFF,
+        .bits = 0xFF,
+    };
+    char protocol[sizeof(signal->code.protocol)];
+    signal_body_t body = {
+        .signal = signal,
+        .timings = timings,
+        .protocol = protocol,
+    };
+
+    if (signal->type == IR_SIGNAL_PARSED) {
+        snprintf(protocol, sizeof(protocol), "%s", signal->code.protocol);
+        body.address = signal->code.address;
+        body.command = signal->code.command;
+        if (!values_to_flipper(protocol, sizeof(protocol), &body.address, &body.command)) {
+            ESP_LOGE(TAG, "%s: valores 0x%08" PRIX32 "/0x%08" PRIX32 " sem representação no formato do Flipper",
+                     protocol, signal->code.address, signal->code.command);
+            return ESP_ERR_NOT_SUPPORTED;
+        }
+        e.address = signal->code.address;
+        e.command = signal->code.command;
+        e.toggle = signal->code.toggle;
+        e.bits = signal->code.bits;
+    } else {
+        e.frequency = signal->frequency;
+        e.duty_cycle = signal->duty_cycle;
+        e.timings = signal->num_timings;
+    }
+
+    if (!lock()) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    ir_index_t *idx;
+    esp_err_t ret = index_open(path, &idx);
+    if (ret == ESP_ERR_NOT_FOUND) {
+        ret = create_file(path);
+        if (ret == ESP_OK) {
+            ret = index_open(path, &idx);
+        }
+    }
+
+    if (ret == ESP_OK && index_find(idx, signal->name) >= 0) {
+        ret = ESP_ERR_INVALID_STATE;
+    }
+    if (ret == ESP_OK && idx->count >= IR_LIBRARY_MAX_SIGNALS) {
+        ret = ESP_ERR_NO_MEM;
+    }
+    if (ret == ESP_OK && signal->type == IR_SIGNAL_PARSED) {
+        int protocol_off = pool_add(idx, protocol);
+        ret = (protocol_off < 0) ? ESP_ERR_NO_MEM : ESP_OK;
+        e.protocol = protocol_off;     // O nome gravado (NEC pode virar NECext)
+    }
+    if (ret == ESP_OK) {
+        ret = append_block(idx, &e, signal->name, write_signal, &body);
+        index_stamp(idx);
+    }
+
+    unlock();
+    return ret;
+}
+
+typedef struct {
+    const char *data;
+    size_t len;
+} copy_body_t;
+
+static esp_err_t write_copy(FILE *f, const void *arg)
+{
+    const copy_body_t *c = arg;
+    return (fwrite(c->data, 1, c->len, f) == c->len) ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t ir_library_rename(const char *path, const char *name, const char *new_name)
+{
+    if (!path || !name || !name_valid(new_name)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!lock()) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    ir_index_t *idx;
+    esp_err_t ret = index_open(path, &idx);
+    int i = (ret == ESP_OK) ? index_find(idx, name) : -1;
+    if (ret == ESP_OK && i < 0) {
+        ret = ESP_ERR_NOT_FOUND;
+    }
+    if (ret == ESP_OK && strcmp(name, new_name) != 0 && index_find(idx, new_name) >= 0) {
+        ret = ESP_ERR_INVALID_STATE;
+    }
+    if (ret != ESP_OK || strcmp(name, new_name) == 0) {
+        unlock();
+        return ret;
+    }
+
+    entry_t e = idx->entries[i];
+    uint32_t start = e.offset + e.sep;
+    FILE *f = fopen(path, "r+");
+    if (!f) {
+        unlock();
+        return ESP_FAIL;
+    }
+
+    reader_t r;
+    line_t line;
+    fseek(f, start, SEEK_SET);
+    reader_init(&r, f, start);
+    reader_line(&r, &line);
+    const char *old = value_of(line.text, "name");
+    uint32_t value = old ? start + (old - line.text) : 0;
+
+    if (old && strcmp(old, name) == 0 && strlen(new_name) == strlen(name)) {
+        // Mesmo tamanho: troca no lugar
+        if (fseek(f, value, SEEK_SET) != 0 || fwrite(new_name, 1, strlen(new_name), f) != strlen(new_name)) {
+            ret = ESP_FAIL;
+        }
+        if (fclose(f) != 0) {
+            ret = ESP_FAIL;
+        }
+        if (ret == ESP_OK) {
+            int name_off = pool_add(idx, new_name);
+            if (name_off < 0) {
+                idx->valid = false;
+            } else {
+                idx->entries[i].name = name_off;
+                ret = index_rehash(idx);
+            }
+        }
+    } else {
+        // Copia o resto do bloco com o nome novo para o fim e cobre o antigo
+        uint32_t rest = e.body - line.length;
+        char *data = malloc(rest ? rest : 1);
+        if (!data) {
+            ret = ESP_ERR_NO_MEM;
+        } else if (fseek(f, start + line.length, SEEK_SET) != 0 || fread(data, 1, rest, f) != rest) {
+            ret = ESP_FAIL;
+        }
+        fclose(f);
+
+        if (ret == ESP_OK) {
+            copy_body_t copy = {
+                .data = data,
+                .len = rest,
+            };
+            ret = append_block(idx, &e, new_name, write_copy, &copy);
+            index_stamp(idx);
+        }
+        if (ret == ESP_OK) {
+            ret = remove_block(idx, i);
+        }
+        free(data);
+    }
+
+    if (ret != ESP_OK) {
+        idx->valid = false;
+    }
+    index_stamp(idx);
+    unlock();
+    return ret;
+}
+
+esp_err_t ir_library_delete(const char *path, const char *name)
+{
+    if (!path || !name) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!lock()) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    ir_index_t *idx;
+    esp_err_t ret = index_open(path, &idx);
+    int i = (ret == ESP_OK) ? index_find(idx, name) : -1;
+    if (ret == ESP_OK && i < 0) {
+        ret = ESP_ERR_NOT_FOUND;
+    }
+    if (ret == ESP_OK) {
+        ret = remove_block(idx, i);
+        if (ret != ESP_OK) {
+            idx->valid = false;
+        }
+        index_stamp(idx);
+    }
+
+    unlock();
+    return ret;
+}
+
+// Copia src em dst sem as linhas só de '#' (blocos cobertos)
+static esp_err_t copy_uncovered(FILE *src, FILE *dst)
+{
+    reader_t r;
+    reader_init(&r, src, 0);
+    uint32_t hashes = 0;    // '#' iniciais ainda não escritos
+    bool covered = true;    // Linha até aqui só tem '#'
+    bool cr = false;
+    int c;
+
+    while ((c = reader_getc(&r)) != EOF) {
+        if (c == '\n') {
+            if (!covered || hashes < 2) {
+                while (hashes--) {
+                    fputc('#', dst);
+                }
+                if (cr) {
+                    fputc('\r', dst);
+                }
+                fputc('\n', dst);
+            }
+            hashes = 0;
+            covered = true;
+            cr = false;
+        } else if (covered && c == '#' && !cr) {
+            hashes++;
+        } else if (covered && c == '\r' && !cr) {
+            cr = true;
+        } else {
+            if (covered) {
+                while (hashes) {
+                    fputc('#', dst);
+                    hashes--;
+                }
+                if (cr) {
+                    fputc('\r', dst);
+                }
+                covered = false;
+                cr = false;
+            }
+            fputc(c, dst);
+        }
+    }
+
+    // Última linha sem '\n'
+    if (!covered || hashes < 2) {
+        while (hashes--) {
+            fputc('#', dst);
+        }
+        if (cr) {
+            fputc('\r', dst);
+        }
+    }
+    return (ferror(src) || ferror(dst)) ? ESP_FAIL : ESP_OK;
+}
+
+esp_err_t ir_library_compact(const char *path)
+{
+    if (!path || strlen(path) + 5 > IR_LIBRARY_PATH_MAX) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!lock()) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    char tmp[IR_LIBRARY_PATH_MAX];
+    snprintf(tmp, sizeof(tmp), "%s.tmp", path);
+
+    esp_err_t ret = ESP_OK;
+    FILE *src = fopen(path, "r");
+    FILE *dst = src ? fopen(tmp, "w") : NULL;
+    if (!src) {
+        ret = ESP_ERR_NOT_FOUND;
+    } else if (!dst) {
+        ret = ESP_FAIL;
+    } else {
+        ret = copy_uncovered(src, dst);
+    }
+    if (src) {
+        fclose(src);
+    }
+    if (dst && fclose(dst) != 0) {
+        ret = ESP_FAIL;
+    }
+
+    // O FAT não renomeia por cima de um arquivo existente
+    if (ret == ESP_OK && (remove(path) != 0 || rename(tmp, path) != 0)) {
+        ESP_LOGE(TAG, "Falha ao substituir %s", path);
+        ret = ESP_FAIL;
+    }
+    if (ret != ESP_OK && dst) {
+        remove(tmp);
+    }
+
+    ir_index_t *idx = cache_lookup(path);
+    if (idx) {
+        index_clear(idx);
+    }
+    unlock();
+    return ret;
+}
+
+void ir_library_invalidate(const char *path)
+{
+    if (!path || !lock()) {
+        return;
+    }
+    ir_index_t *idx = cache_lookup(path);
+    if (idx) {
+        index_clear(idx);
+    }
+    unlock();
+}
+
+void ir_library_get_stats(ir_library_stats_t *stats)
+{
+    if (stats && lock()) {
+        *stats = s_stats;
+        unlock();
+    }
+}
@@ -14,9 +14,15 @@
 
 
 #include "ir_common.h"
+#include "ir_decoder.h"
+#include "ir_storage.h"
+#include "ir_capture.h"
 
 static const char *TAG = "RX";
 
+#define IR_RX_MAX_FRAMES    8   // Quadros decodificados por captura
+#define IR_RX_MIN_RAW_SYMBOLS 4 // Capturas menores são ruído
+
 // Buffer estático para recepção
 static rmt_symbol_word_t raw_symbols[64];
 
@@ -153,37 +159,89 @@ bool ir_rx_wait_for_data(ir_context_t *ctx, rmt_rx_done_event_data_t *rx_data, u
     return false;  // timeout
 }
 
-//FUNÇÃO PRINCIPAL
-bool ir_receive(const char* filename, uint32_t timeout_ms) {
+// Salva o primeiro quadro completo da captura
+static bool save_first_frame(const rmt_symbol_word_t *symbols, size_t num_symbols, const char *filename)
+{
+    ir_decode_result_t frames[IR_RX_MAX_FRAMES];
+    size_t count = ir_decode(symbols, num_symbols, frames, IR_RX_MAX_FRAMES);
+
+    for (size_t i = 0; i < count; i++) {
+        const ir_decode_result_t *frame = &frames[i];
+
+        // Código de repetição NEC não traz endereço nem comando
+        if (frame->repeat && frame->protocol == IR_PROTOCOL_NEC) {
+            continue;
+        }
+
+        ESP_LOGI(TAG, "%s: addr=0x%08lX, cmd=0x%08lX (%u quadros na captura)",
+                 ir_protocol_to_string(frame->protocol), frame->address, frame->command,
+                 (unsigned)count);
 
+        // Toggle fica automático: repetir o valor capturado faria o aparelho
+        // ignorar envios seguidos
+        return ir_save_full(ir_protocol_to_string(frame->protocol), frame->command, frame->address,
+                            0xFF, frame->bits, filename);
+    }
+
+    ESP_LOGD(TAG, "Nenhum quadro reconhecido em %u símbolos", (unsigned)num_symbols);
+    return false;
+}
+
+// Captura até salvar um sinal ou esgotar o timeout; capturas sem quadro
+// reconhecido (ruído, protocolo desconhecido) não encerram a espera
+static bool receive(const char *filename, uint32_t timeout_ms, bool raw)
+{
     if (!filename) {
         ESP_LOGE(TAG, "Nome do arquivo inválido");
         return false;
     }
-    
-    ir_context_t ir_ctx = {0};
 
-    esp_err_t ret = ir_rx_init(&ir_ctx);
+    esp_err_t ret = ir_capture_start(NULL);
     if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to initialize RX: %s", esp_err_to_name(ret));
+        ESP_LOGE(TAG, "Failed to start capture: %s", esp_err_to_name(ret));
         return false;
     }
 
     ESP_LOGI(TAG, "Aguardando sinal IR... (timeout: %lu ms)", timeout_ms);
-    
-    ir_rx_start_receive(&ir_ctx);
-    rmt_rx_done_event_data_t rx_data;
+
+    TickType_t start = xTaskGetTickCount();
+    TickType_t limit = pdMS_TO_TICKS(timeout_ms);
     bool success = false;
 
-    if (ir_rx_wait_for_data(&ir_ctx, &rx_data, timeout_ms)) {
-        parse_nec_frame(rx_data.received_symbols, rx_data.num_symbols, filename);
-        success = true;
-    } else {
-        ESP_LOGW(TAG, "Timeout - nenhum sinal recebido");
+    while (!success) {
+        TickType_t elapsed = xTaskGetTickCount() - start;
+        if (elapsed >= limit) {
+            ESP_LOGW(TAG, "Timeout - nenhum sinal reconhecido");
+            break;
+        }
+
+        ir_capture_t capture;
+        if (ir_capture_wait(&capture, (limit - elapsed) * portTICK_PERIOD_MS) != ESP_OK) {
+            continue;
+        }
+
+        ESP_LOGI(TAG, "Captura #%lu: %u símbolos, %lld us%s", capture.seq,
+                 (unsigned)capture.num_symbols, capture.end_us - capture.start_us,
+                 capture.truncated ? " (truncada)" : "");
+
+        if (raw) {
+            success = capture.num_symbols >= IR_RX_MIN_RAW_SYMBOLS &&
+                      ir_capture_save_raw(&capture, filename);
+        } else {
+            success = save_first_frame(capture.symbols, capture.num_symbols, filename);
+        }
+        ir_capture_release(&capture);
     }
 
-    // Desalocar canal RX
-    ir_rx_deinit(&ir_ctx);
-    
+    ir_capture_stop();
     return success;
 }
+
+//FUNÇÃO PRINCIPAL
+bool ir_receive(const char* filename, uint32_t timeout_ms) {
+    return receive(filename, timeout_ms, false);
+}
+
+bool ir_receive_raw(const char* filename, uint32_t timeout_ms) {
+    return receive(filename, timeout_ms, true);
+}
@@ -14,6 +14,8 @@
 
 
 #include "ir_storage.h"
+#include "ir_library.h"
+#include <inttypes.h>
 #include <stdio.h>
 #include <string.h>
 #include "esp_log.h"
@@ -51,8 +53,8 @@ bool ir_save_full(const char* protocol, uint32_t command, uint32_t address,
     fprintf(f, "name: %s\n", filename);
     fprintf(f, "type: parsed\n");
     fprintf(f, "protocol: %s\n", protocol);
-    fprintf(f, "address: %08lX\n", address);
-    fprintf(f, "command: %08lX\n", command);
+    fprintf(f, "address: %08" PRIX32 "\n", address);
+    fprintf(f, "command: %08" PRIX32 "\n", command);
     
     // Adiciona toggle apenas se for válido (para RC6 e RC5)
     if (toggle != 0xFF) {
@@ -65,27 +67,28 @@ bool ir_save_full(const char* protocol, uint32_t command, uint32_t address,
     }
     
     fclose(f);
+    ir_library_invalidate(filepath);
     
     // Log informativo
     if (toggle != 0xFF && bits != 0xFF) {
-        ESP_LOGI(TAG, "Código IR salvo: %s -> %s (0x%08lX, 0x%08lX, toggle=%d, bits=%d)",
+        ESP_LOGI(TAG, "Código IR salvo: %s -> %s (0x%08" PRIX32 ", 0x%08" PRIX32 ", toggle=%d, bits=%d)",
                  filename, protocol, address, command, toggle, bits);
     } else if (toggle != 0xFF) {
-        ESP_LOGI(TAG, "Código IR salvo: %s -> %s (0x%08lX, 0x%08lX, toggle=%d)",
+        ESP_LOGI(TAG, "Código IR salvo: %s -> %s (0x%08" PRIX32 ", 0x%08" PRIX32 ", toggle=%d)",
                  filename, protocol, address, command, toggle);
     } else if (bits != 0xFF) {
-        ESP_LOGI(TAG, "Código IR salvo: %s -> %s (0x%08lX, 0x%08lX, bits=%d)",
+        ESP_LOGI(TAG, "Código IR salvo: %s -> %s (0x%08" PRIX32 ", 0x%08" PRIX32 ", bits=%d)",
                  filename, protocol, address, command, bits);
     } else {
-        ESP_LOGI(TAG, "Código IR salvo: %s -> %s (0x%08lX, 0x%08lX)",
+        ESP_LOGI(TAG, "Código IR salvo: %s -> %s (0x%08" PRIX32 ", 0x%08" PRIX32 ")",
                  filename, protocol, address, command);
     }
     
     return true;
 }
 
-bool ir_load(const char* filename, ir_code_t* code) {
-    if (!filename || !code) {
+bool ir_save_raw(const char* filename, uint32_t frequency, const uint32_t* timings, size_t count) {
+    if (!filename || !timings || count == 0) {
         ESP_LOGE(TAG, "Parâmetros inválidos");
         return false;
     }
@@ -93,58 +96,89 @@ bool ir_load(const char* filename, ir_code_t* code) {
     char filepath[256];
     snprintf(filepath, sizeof(filepath), "/sdcard/%s.ir", filename);
     
-    FILE* f = fopen(filepath, "r");
+    FILE* f = fopen(filepath, "w");
     if (!f) {
-        ESP_LOGE(TAG, "Falha ao abrir arquivo: %s", filepath);
+        ESP_LOGE(TAG, "Falha ao criar arquivo: %s", filepath);
         return false;
     }
     
-    char line[256];
-    memset(code, 0, sizeof(ir_code_t));
-    code->toggle = 0xFF;  // Valor padrão (não presente/auto)
-    code->bits = 0xFF;    // Valor padrão (não presente)
-    
-    while (fgets(line, sizeof(line), f)) {
-        // Remove newline
-        line[strcspn(line, "\r\n")] = 0;
-        
-        if (strncmp(line, "protocol:", 9) == 0) {
-            sscanf(line, "protocol: %31s", code->protocol);
-        }
-        else if (strncmp(line, "address:", 8) == 0) {
-            sscanf(line, "address: %lX", &code->address);
-        }
-        else if (strncmp(line, "command:", 8) == 0) {
-            sscanf(line, "command: %lX", &code->command);
-        }
-        else if (strncmp(line, "toggle:", 7) == 0) {
-            unsigned int toggle_val;
-            sscanf(line, "toggle: %X", &toggle_val);
-            code->toggle = (uint8_t)toggle_val;
-        }
-        else if (strncmp(line, "bits:", 5) == 0) {
-            unsigned int bits_val;
-            sscanf(line, "bits: %u", &bits_val);
-            code->bits = (uint8_t)bits_val;
-        }
+    // Header padrão Flipper Zero
+    fprintf(f, "Filetype: IR signals file\n");
+    fprintf(f, "Version: 1\n");
+    fprintf(f, "#\n");
+    fprintf(f, "name: %s\n", filename);
+    fprintf(f, "type: raw\n");
+    fprintf(f, "frequency: %" PRIu32 "\n", frequency);
+    fprintf(f, "duty_cycle: 0.330000\n");
+    fprintf(f, "data:");
+    for (size_t i = 0; i < count; i++) {
+        fprintf(f, " %" PRIu32, timings[i]);
     }
+    fprintf(f, "\n");
     
+    bool ok = !ferror(f);
     fclose(f);
+    ir_library_invalidate(filepath);
+    
+    if (ok) {
+        ESP_LOGI(TAG, "Sinal raw salvo: %s (%u tempos, %" PRIu32 " Hz)", filename, (unsigned)count, frequency);
+    } else {
+        ESP_LOGE(TAG, "Falha ao gravar arquivo: %s", filepath);
+    }
+    return ok;
+}
+
+static bool load_signal(const char* filename, const char* name, ir_code_t* code) {
+    if (!filename || !code) {
+        ESP_LOGE(TAG, "Parâmetros inválidos");
+        return false;
+    }
+    
+    char filepath[256];
+    snprintf(filepath, sizeof(filepath), "/sdcard/%s.ir", filename);
+    
+    // O índice da biblioteca evita reler o arquivo a cada envio
+    ir_signal_t signal;
+    esp_err_t ret = name ? ir_library_find(filepath, name, &signal)
+                         : ir_library_get(filepath, 0, &signal);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Falha ao carregar %s%s%s: %s", filepath, name ? " -> " : "",
+                 name ? name : "", esp_err_to_name(ret));
+        return false;
+    }
+    if (signal.type != IR_SIGNAL_PARSED) {
+        ESP_LOGE(TAG, "Sinal raw não cabe em ir_code_t: %s -> %s", filepath, signal.name);
+        return false;
+    }
+    
+    *code = signal.code;
     
     // Log informativo
     if (code->toggle != 0xFF && code->bits != 0xFF) {
-        ESP_LOGI(TAG, "Código IR carregado: %s -> %s (0x%08lX, 0x%08lX, toggle=%d, bits=%d)",
+        ESP_LOGI(TAG, "Código IR carregado: %s -> %s (0x%08" PRIX32 ", 0x%08" PRIX32 ", toggle=%d, bits=%d)",
                  filename, code->protocol, code->address, code->command, code->toggle, code->bits);
     } else if (code->toggle != 0xFF) {
-        ESP_LOGI(TAG, "Código IR carregado: %s -> %s (0x%08lX, 0x%08lX, toggle=%d)",
+        ESP_LOGI(TAG, "Código IR carregado: %s -> %s (0x%08" PRIX32 ", 0x%08" PRIX32 ", toggle=%d)",
                  filename, code->protocol, code->address, code->command, code->toggle);
     } else if (code->bits != 0xFF) {
-        ESP_LOGI(TAG, "Código IR carregado: %s -> %s (0x%08lX, 0x%08lX, bits=%d)",
+        ESP_LOGI(TAG, "Código IR carregado: %s -> %s (0x%08" PRIX32 ", 0x%08" PRIX32 ", bits=%d)",
                  filename, code->protocol, code->address, code->command, code->bits);
     } else {
-        ESP_LOGI(TAG, "Código IR carregado: %s -> %s (0x%08lX, 0x%08lX)",
+        ESP_LOGI(TAG, "Código IR carregado: %s -> %s (0x%08" PRIX32 ", 0x%08" PRIX32 ")",
                  filename, code->protocol, code->address, code->command);
     }
     
     return true;
 }
+
+bool ir_load(const char* filename, ir_code_t* code) {
+    return load_signal(filename, NULL, code);
+}
+
+bool ir_load_signal(const char* filename, const char* name, ir_code_t* code) {
+    if (!name) {
+        ESP_LOGE(TAG, "Parâmetros inválidos");
+        return false;
+    }
+    return load_signal(filename, name, code);
+}
@@ -13,119 +13,281 @@
 // limitations under the License.
 
 
+#include "ir_tx.h"
 #include "ir_common.h"
-#include "ir_storage.h"
 #include "protocol_nec.h"
 #include "protocol_rc6.h"
-
+#include "protocol_rc5.h"
+#include "protocol_samsung32.h"
+#include "protocol_sony.h"
+#include "ir_library.h"
+#include "freertos/semphr.h"
+#include <inttypes.h>
+#include <stdlib.h>
 #include <string.h>
 
 static const char *TAG = "ir_tx";
 
-// Estado global do toggle para RC6
+#define IR_TX_TASK_STACK        3072
+#define IR_TX_TASK_PRIO         5
+#define IR_TX_GAP_SYMBOLS       4       // Silêncio de até 4 x 2 x 32767 ticks
+#define IR_TX_MIN_GAP_US        5000    // Piso do silêncio (SIRC 20 bits: 5,4 ms)
+#define IR_TX_DONE_MARGIN_MS    100     // Folga na espera pelo TX done
+#define IR_TX_MAX_TRANS         (2 * (IR_TX_MAX_REPEATS + 3))  // Quadros + silêncios por pedido
+#define IR_TX_DUTY_CYCLE        0.33f
+#define IR_TX_RAW_GAP_US        20000   // Após um sinal raw de arquivo (o silêncio que encerra uma captura)
+#define IR_TX_MAX_DURATION      0x7FFF  // Meio símbolo do RMT (15 bits)
+#define NEC_REPEAT_US           (NEC_REPEAT_CODE_DURATION_0 + NEC_REPEAT_CODE_DURATION_1 + \
+                                 NEC_PAYLOAD_ZERO_DURATION_0)
+
+#define US_TO_TICKS(us)         ((uint32_t)((uint64_t)(us) * EXAMPLE_IR_RESOLUTION_HZ / 1000000))
+
+// Período de repetição (início a início) e portadora de cada protocolo
+typedef struct {
+    uint32_t period_us;
+    uint32_t carrier_hz;
+    uint8_t min_frames;
+} ir_tx_timing_t;
+
+static const ir_tx_timing_t TIMINGS[IR_PROTOCOL_COUNT] = {
+    [IR_PROTOCOL_NEC]       = { 108000, 38000, 1 },
+    [IR_PROTOCOL_RC6]       = { 240 * RC6_PAYLOAD_ZERO_DURATION_0, 36000, 1 },
+    [IR_PROTOCOL_RC5]       = { 128 * RC5_BIT_DURATION, 36000, 1 },
+    [IR_PROTOCOL_SAMSUNG32] = { 108000, 38000, 1 },
+    [IR_PROTOCOL_SIRC]      = { 45000, 40000, 3 },
+};
+
+// Outros nomes de protocolo aceitos nos arquivos
+static const struct {
+    const char *name;
+    ir_protocol_t protocol;
+    uint8_t bits;
+} ALIASES[] = {
+    { "Sony",   IR_PROTOCOL_SIRC, 0xFF },
+    { "NECext", IR_PROTOCOL_NEC,  0xFF },
+    { "SIRC15", IR_PROTOCOL_SIRC, 15 },
+    { "SIRC20", IR_PROTOCOL_SIRC, 20 },
+};
+
+typedef union {
+    ir_nec_scan_code_t nec;
+    ir_rc6_scan_code_t rc6;
+    ir_rc5_scan_code_t rc5;
+    ir_samsung32_scan_code_t samsung32;
+    ir_sony_scan_code_t sony;
+} ir_scan_code_t;
+
+typedef struct {
+    ir_tx_code_t code;
+    ir_tx_raw_t raw;
+    uint8_t repeats;
+    bool is_raw;        // Quadro em raw em vez de code
+    bool sync;          // Chamador aguarda em s_sync_done
+    bool stop;          // Encerra a task
+    ir_tx_done_cb_t done;
+    void *arg;
+} ir_tx_request_t;
+
+static QueueHandle_t s_queue = NULL;
+static SemaphoreHandle_t s_tx_done = NULL;      // Um give por transação concluída (ISR)
+static SemaphoreHandle_t s_sync_lock = NULL;    // Um envio síncrono por vez
+static SemaphoreHandle_t s_sync_done = NULL;
+static SemaphoreHandle_t s_stopped = NULL;
+static esp_err_t s_sync_result;
+static TaskHandle_t s_task = NULL;
+static volatile bool s_running = false;
+
+// Estado da task (só ela acessa)
+static rmt_channel_handle_t s_channel = NULL;
+static rmt_encoder_handle_t s_encoders[IR_PROTOCOL_COUNT];     // Criados no primeiro uso
+static rmt_encoder_handle_t s_copy_encoder = NULL;             // Silêncios, repetição NEC e quadros raw
+static uint32_t s_carrier_hz = 0;
+static float s_carrier_duty = 0;
+static rmt_symbol_word_t s_gap_frame[IR_TX_GAP_SYMBOLS];
+static rmt_symbol_word_t s_gap_repeat[IR_TX_GAP_SYMBOLS];
+static rmt_symbol_word_t s_nec_repeat[2];
+
+// Estados globais de toggle (modo IR_TX_TOGGLE_AUTO)
 static uint8_t g_rc6_toggle_state = 0;
+static uint8_t g_rc5_toggle_state = 0;
 
-bool ir_tx_send_from_file(const char* filename) {
-    ESP_LOGI(TAG, "=== INÍCIO ir_tx_send_from_file ===");
-    ESP_LOGI(TAG, "Filename: %s", filename);
-    
-    ir_context_t ir_ctx = {0};
-    
-    // Carrega o código do arquivo primeiro para saber o protocolo
-    ir_code_t ir_code;
-    ESP_LOGI(TAG, "Carregando arquivo...");
-    if (!ir_load(filename, &ir_code)) {
-        ESP_LOGE(TAG, "❌ Falha ao carregar código do arquivo: %s", filename);
-        return false;
+/* ============================================================================
+ * TIMING
+ * ============================================================================ */
+
+// Soma dos pares marca/espaço de n bits (LSB primeiro)
+static uint32_t bits_us(uint32_t value, int n, uint32_t base, uint32_t zero, uint32_t one)
+{
+    uint32_t us = 0;
+    for (int i = 0; i < n; i++) {
+        us += base + (((value >> i) & 1) ? one : zero);
     }
+    return us;
+}
 
-    ESP_LOGI(TAG, "✅ Arquivo carregado:");
-    ESP_LOGI(TAG, "  Protocol: %s", ir_code.protocol);
-    ESP_LOGI(TAG, "  Address: 0x%08lX", ir_code.address);
-    ESP_LOGI(TAG, "  Command: 0x%08lX", ir_code.command);
-    ESP_LOGI(TAG, "  Toggle: %d (0xFF=auto)", ir_code.toggle);
+static uint8_t sony_bits(const ir_tx_code_t *code)
+{
+    return (code->bits != 0xFF) ? code->bits : 12;
+}
 
-    // Inicializa TX
-    ESP_LOGI(TAG, "Inicializando TX...");
-    esp_err_t ret = ir_tx_init(&ir_ctx);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "❌ Failed to initialize TX: %s", esp_err_to_name(ret));
-        return false;
+uint32_t ir_tx_frame_us(const ir_tx_code_t *code)
+{
+    if (!code) {
+        return 0;
     }
-    ESP_LOGI(TAG, "✅ TX inicializado");
-
-    // Cria encoder apropriado baseado no protocolo
-    ir_encoder_config_t enc_cfg = {0};
-    
-    ESP_LOGI(TAG, "Identificando protocolo: %s", ir_code.protocol);
-    
-    if (strcmp(ir_code.protocol, "NEC") == 0) {
-        ESP_LOGI(TAG, "Configurando encoder NEC");
-        enc_cfg.protocol = IR_PROTOCOL_NEC;
-        enc_cfg.config.nec.resolution = EXAMPLE_IR_RESOLUTION_HZ;
-    }
-    else if (strcmp(ir_code.protocol, "RC6") == 0) {
-        ESP_LOGI(TAG, "Configurando encoder RC6");
-        enc_cfg.protocol = IR_PROTOCOL_RC6;
-        enc_cfg.config.rc6.resolution = EXAMPLE_IR_RESOLUTION_HZ;
-    }
-    else {
-        ESP_LOGE(TAG, "❌ Protocolo não suportado: %s", ir_code.protocol);
-        ir_tx_deinit(&ir_ctx);
-        return false;
+
+    switch (code->protocol) {
+    case IR_PROTOCOL_NEC:
+        return NEC_LEADING_CODE_DURATION_0 + NEC_LEADING_CODE_DURATION_1 +
+               bits_us(code->address & 0xFFFF, 16, NEC_PAYLOAD_ZERO_DURATION_0,
+                       NEC_PAYLOAD_ZERO_DURATION_1, NEC_PAYLOAD_ONE_DURATION_1) +
+               bits_us(code->command & 0xFFFF, 16, NEC_PAYLOAD_ZERO_DURATION_0,
+                       NEC_PAYLOAD_ZERO_DURATION_1, NEC_PAYLOAD_ONE_DURATION_1) +
+               NEC_PAYLOAD_ZERO_DURATION_0;
+
+    case IR_PROTOCOL_SAMSUNG32: {
+        uint32_t data = ((code->address & 0xFFFF) << 16) | (code->command & 0xFFFF);
+        return SAMSUNG32_LEADING_CODE_DURATION_0 + SAMSUNG32_LEADING_CODE_DURATION_1 +
+               bits_us(data, 32, SAMSUNG32_PAYLOAD_ZERO_DURATION_0,
+                       SAMSUNG32_PAYLOAD_ZERO_DURATION_1, SAMSUNG32_PAYLOAD_ONE_DURATION_1) +
+               SAMSUNG32_PAYLOAD_ZERO_DURATION_0;
     }
 
-    ESP_LOGI(TAG, "Criando encoder (protocol=%d)...", enc_cfg.protocol);
-    ret = rmt_new_ir_encoder(&enc_cfg, &ir_ctx.encoder);
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "❌ Failed to create encoder: %s", esp_err_to_name(ret));
-        ir_tx_deinit(&ir_ctx);
-        return false;
+    case IR_PROTOCOL_RC5:
+        // 14 bits Manchester + espaço final
+        return 14 * 2 * RC5_BIT_DURATION + RC5_BIT_DURATION;
+
+    case IR_PROTOCOL_RC6:
+        // Cabeçalho, start bit, 20 bits (toggle com largura dupla) e espaço final
+        return RC6_LEADING_CODE_DURATION_0 + RC6_LEADING_CODE_DURATION_1 +
+               2 * RC6_PAYLOAD_ZERO_DURATION_0 + 19 * 2 * RC6_PAYLOAD_ZERO_DURATION_0 +
+               2 * 2 * RC6_PAYLOAD_ZERO_DURATION_0 + RC6_PAYLOAD_ZERO_DURATION_0;
+
+    case IR_PROTOCOL_SIRC: {
+        uint32_t frame = (code->command & 0x7F) | ((code->address & 0xFFFF) << 7);
+        return SONY_LEADING_CODE_DURATION + SONY_BIT_PERIOD +
+               bits_us(frame, sony_bits(code), SONY_BIT_PERIOD,
+                       SONY_PAYLOAD_ZERO_DURATION, SONY_PAYLOAD_ONE_DURATION) +
+               SONY_BIT_PERIOD;
     }
-    ESP_LOGI(TAG, "✅ Encoder criado");
-
-    // Transmite baseado no protocolo
-    ret = ESP_FAIL;
-    
-    if (strcmp(ir_code.protocol, "NEC") == 0) {
-        ESP_LOGI(TAG, "Transmitindo NEC: addr=0x%04X, cmd=0x%04X", 
-                 (uint16_t)ir_code.address, (uint16_t)ir_code.command);
-        ret = ir_tx_send_nec(&ir_ctx, (uint16_t)ir_code.address, (uint16_t)ir_code.command);
-    }
-    else if (strcmp(ir_code.protocol, "RC6") == 0) {
-        // Para RC6, usa o toggle salvo no arquivo (ou alterna automaticamente)
-        uint8_t toggle = (ir_code.toggle != 0xFF) ? ir_code.toggle : g_rc6_toggle_state;
-        ESP_LOGI(TAG, "Transmitindo RC6: addr=0x%02X, cmd=0x%02X, toggle=%d", 
-                 (uint8_t)ir_code.address, (uint8_t)ir_code.command, toggle);
-        ret = ir_tx_send_rc6(&ir_ctx, (uint8_t)ir_code.address, (uint8_t)ir_code.command, toggle);
-        
-        // Alterna o toggle para próxima transmissão
-        if (ir_code.toggle == 0xFF) {
-            g_rc6_toggle_state = !g_rc6_toggle_state;
-            ESP_LOGD(TAG, "Toggle alternado para: %d", g_rc6_toggle_state);
-        }
+
+    default:
+        return 0;
     }
+}
 
-    if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "❌ Falha ao transmitir código IR: %s", esp_err_to_name(ret));
-        ir_tx_deinit(&ir_ctx);
-        return false;
+// Silêncio que completa o período depois de um quadro de frame_us
+static uint32_t gap_us(uint32_t period_us, uint32_t frame_us)
+{
+    return (period_us > frame_us + IR_TX_MIN_GAP_US) ? period_us - frame_us : IR_TX_MIN_GAP_US;
+}
+
+static int frame_count(const ir_tx_timing_t *timing, uint8_t repeats)
+{
+    int frames = 1 + repeats;
+    return (frames < timing->min_frames) ? timing->min_frames : frames;
+}
+
+// Silêncio (nível 0) que completa o período depois de um quadro de frame_us
+static size_t make_gap(uint32_t period_us, uint32_t frame_us, rmt_symbol_word_t *out)
+{
+    uint32_t ticks = US_TO_TICKS(gap_us(period_us, frame_us));
+    size_t n = 0;
+
+    while (ticks > 0 && n < IR_TX_GAP_SYMBOLS) {
+        uint32_t d0 = (ticks > 0x7FFF) ? 0x7FFF : ticks;
+        ticks -= d0;
+        uint32_t d1 = (ticks > 0x7FFF) ? 0x7FFF : ticks;
+        ticks -= d1;
+        out[n++] = (rmt_symbol_word_t) {
+            .level0 = 0,
+            .duration0 = d0,
+            .level1 = 0,
+            .duration1 = d1,
+        };
     }
+    return n;
+}
 
-    ESP_LOGI(TAG, "✅ Código IR transmitido com sucesso!");
+uint32_t ir_tx_air_us(const ir_tx_code_t *code, uint8_t repeats)
+{
+    if (!code || code->protocol >= IR_PROTOCOL_COUNT) {
+        return 0;
+    }
 
-    vTaskDelay(pdMS_TO_TICKS(100));
-    ir_tx_deinit(&ir_ctx);
+    const ir_tx_timing_t *timing = &TIMINGS[code->protocol];
+    uint32_t frame_us = ir_tx_frame_us(code);
+    uint32_t repeat_us = (code->protocol == IR_PROTOCOL_NEC) ? NEC_REPEAT_US : frame_us;
+    int frames = frame_count(timing, repeats);
 
-    ESP_LOGI(TAG, "=== FIM ir_tx_send_from_file ===\n");
-    return true;
+    return frame_us + gap_us(timing->period_us, frame_us) +
+           (frames - 1) * (repeat_us + gap_us(timing->period_us, repeat_us));
+}
+
+uint32_t ir_tx_raw_air_us(const ir_tx_raw_t *raw)
+{
+    if (!raw || !raw->symbols) {
+        return 0;
+    }
+
+    uint32_t ticks = 0;
+    for (size_t i = 0; i < raw->num_symbols; i++) {
+        ticks += raw->symbols[i].duration0 + raw->symbols[i].duration1;
+    }
+    return (uint32_t)((uint64_t)ticks * 1000000 / EXAMPLE_IR_RESOLUTION_HZ) + gap_us(raw->gap_us, 0);
+}
+
+size_t ir_tx_raw_encode(const uint32_t *timings, size_t count,
+                        rmt_symbol_word_t *symbols, size_t max_symbols)
+{
+    if (!timings || !symbols) {
+        return 0;
+    }
+
+    // Meios símbolos em sequência: tempos longos viram vários do mesmo nível
+    size_t half = 0;
+    for (size_t i = 0; i < count; i++) {
+        uint32_t ticks = US_TO_TICKS(timings[i]);
+        unsigned level = (i % 2 == 0);      // Marca nos índices pares
+        if (ticks == 0) {
+            return 0;
+        }
+
+        while (ticks > 0) {
+            uint32_t d = (ticks > IR_TX_MAX_DURATION) ? IR_TX_MAX_DURATION : ticks;
+            ticks -= d;
+            if (half / 2 >= max_symbols) {
+                return 0;
+            }
+            rmt_symbol_word_t *sym = &symbols[half / 2];
+            if (half % 2 == 0) {
+                sym->level0 = level;
+                sym->duration0 = d;
+                sym->level1 = 0;
+                sym->duration1 = 0;     // Fim do quadro se não houver outro meio
+            } else {
+                sym->level1 = level;
+                sym->duration1 = d;
+            }
+            half++;
+        }
+    }
+    return (half + 1) / 2;
+}
+
+/* ============================================================================
+ * CANAL E ENCODERS
+ * ============================================================================ */
+
+static bool on_tx_done(rmt_channel_handle_t channel, const rmt_tx_done_event_data_t *edata, void *user_data)
+{
+    BaseType_t high_task_wakeup = pdFALSE;
+    xSemaphoreGiveFromISR(s_tx_done, &high_task_wakeup);
+    return high_task_wakeup == pdTRUE;
 }
 
-esp_err_t ir_tx_init(ir_context_t *ctx)
+static esp_err_t channel_open(void)
 {
-    esp_err_t ret = ESP_OK;
-    
-    ESP_LOGI(TAG, "create RMT TX channel");
     rmt_tx_channel_config_t tx_channel_cfg = {
         .clk_src = RMT_CLK_SRC_DEFAULT,
         .resolution_hz = EXAMPLE_IR_RESOLUTION_HZ,
@@ -133,133 +295,630 @@ esp_err_t ir_tx_init(ir_context_t *ctx)
         .trans_queue_depth = 4,
         .gpio_num = EXAMPLE_IR_TX_GPIO_NUM,
     };
-    
-    ret = rmt_new_tx_channel(&tx_channel_cfg, &ctx->tx_channel);
+
+    esp_err_t ret = rmt_new_tx_channel(&tx_channel_cfg, &s_channel);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Failed to create TX channel: %s", esp_err_to_name(ret));
         return ret;
     }
 
-    ESP_LOGI(TAG, "modulate carrier to TX channel");
-    rmt_carrier_config_t carrier_cfg = {
-        .duty_cycle = 0.33,
-        .frequency_hz = 38000,
+    rmt_tx_event_callbacks_t cbs = {
+        .on_trans_done = on_tx_done,
     };
-    ret = rmt_apply_carrier(ctx->tx_channel, &carrier_cfg);
+    rmt_copy_encoder_config_t copy_cfg = {};
+
+    ret = rmt_tx_register_event_callbacks(s_channel, &cbs, NULL);
+    if (ret == ESP_OK) {
+        ret = rmt_new_copy_encoder(&copy_cfg, &s_copy_encoder);
+    }
+    if (ret == ESP_OK) {
+        ret = rmt_enable(s_channel);
+    }
     if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to apply carrier: %s", esp_err_to_name(ret));
+        ESP_LOGE(TAG, "Failed to set up TX channel: %s", esp_err_to_name(ret));
+        if (s_copy_encoder) {
+            rmt_del_encoder(s_copy_encoder);
+            s_copy_encoder = NULL;
+        }
+        rmt_del_channel(s_channel);
+        s_channel = NULL;
         return ret;
     }
 
-    ESP_LOGI(TAG, "enable RMT TX channel");
-    ret = rmt_enable(ctx->tx_channel);
+    s_carrier_hz = 0;
+    return ESP_OK;
+}
+
+static void channel_close(void)
+{
+    for (int p = 0; p < IR_PROTOCOL_COUNT; p++) {
+        if (s_encoders[p]) {
+            rmt_del_encoder(s_encoders[p]);
+            s_encoders[p] = NULL;
+        }
+    }
+    if (s_copy_encoder) {
+        rmt_del_encoder(s_copy_encoder);
+        s_copy_encoder = NULL;
+    }
+    if (s_channel) {
+        rmt_disable(s_channel);
+        rmt_del_channel(s_channel);
+        s_channel = NULL;
+    }
+}
+
+static esp_err_t get_encoder(ir_protocol_t protocol, rmt_encoder_handle_t *encoder)
+{
+    if (s_encoders[protocol]) {
+        *encoder = s_encoders[protocol];
+        return ESP_OK;
+    }
+
+    ir_encoder_config_t enc_cfg = {
+        .protocol = protocol,
+    };
+    switch (protocol) {
+    case IR_PROTOCOL_NEC:       enc_cfg.config.nec.resolution = EXAMPLE_IR_RESOLUTION_HZ; break;
+    case IR_PROTOCOL_RC6:       enc_cfg.config.rc6.resolution = EXAMPLE_IR_RESOLUTION_HZ; break;
+    case IR_PROTOCOL_RC5:       enc_cfg.config.rc5.resolution = EXAMPLE_IR_RESOLUTION_HZ; break;
+    case IR_PROTOCOL_SAMSUNG32: enc_cfg.config.samsung32.resolution = EXAMPLE_IR_RESOLUTION_HZ; break;
+    case IR_PROTOCOL_SIRC:      enc_cfg.config.sony.resolution = EXAMPLE_IR_RESOLUTION_HZ; break;
+    default:                    return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    esp_err_t ret = rmt_new_ir_encoder(&enc_cfg, &s_encoders[protocol]);
     if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to enable TX channel: %s", esp_err_to_name(ret));
         return ret;
     }
+    *encoder = s_encoders[protocol];
+    return ESP_OK;
+}
+
+static esp_err_t set_carrier(uint32_t frequency_hz, float duty_cycle)
+{
+    if (s_carrier_hz == frequency_hz && s_carrier_duty == duty_cycle) {
+        return ESP_OK;
+    }
 
-    ESP_LOGI(TAG, "TX module initialized successfully");
+    rmt_carrier_config_t carrier_cfg = {
+        .duty_cycle = duty_cycle,
+        .frequency_hz = frequency_hz,
+    };
+    esp_err_t ret = rmt_apply_carrier(s_channel, &carrier_cfg);
+    if (ret == ESP_OK) {
+        s_carrier_hz = frequency_hz;
+        s_carrier_duty = duty_cycle;
+    }
     return ret;
 }
 
-esp_err_t ir_tx_deinit(ir_context_t *ctx)
+/* ============================================================================
+ * TRANSMISSÃO
+ * ============================================================================ */
+
+static size_t make_scan_code(const ir_tx_code_t *code, ir_scan_code_t *scan)
 {
-    if (!ctx) {
-        ESP_LOGE(TAG, "Invalid context");
-        return ESP_ERR_INVALID_ARG;
+    memset(scan, 0, sizeof(*scan));
+
+    switch (code->protocol) {
+    case IR_PROTOCOL_NEC:
+        scan->nec.address = (uint16_t)code->address;
+        scan->nec.command = (uint16_t)code->command;
+        return sizeof(scan->nec);
+    case IR_PROTOCOL_RC6:
+        scan->rc6.address = (uint8_t)code->address;
+        scan->rc6.command = (uint8_t)code->command;
+        scan->rc6.toggle = code->toggle & 0x1;
+        return sizeof(scan->rc6);
+    case IR_PROTOCOL_RC5:
+        scan->rc5.address = code->address & 0x1F;
+        scan->rc5.command = code->command & 0x3F;
+        scan->rc5.toggle = code->toggle & 0x1;
+        return sizeof(scan->rc5);
+    case IR_PROTOCOL_SAMSUNG32:
+        // Samsung32 usa os 32 bits completos (address e command combinados)
+        scan->samsung32.data = ((code->address & 0xFFFF) << 16) | (code->command & 0xFFFF);
+        return sizeof(scan->samsung32);
+    case IR_PROTOCOL_SIRC:
+        scan->sony.address = (uint16_t)code->address;
+        scan->sony.command = code->command & 0x7F;
+        scan->sony.bits = sony_bits(code);
+        return sizeof(scan->sony);
+    default:
+        return 0;
+    }
+}
+
+// Resolve o toggle automático: o mesmo valor vale para todas as repetições
+static void resolve_toggle(ir_tx_code_t *code)
+{
+    uint8_t *state = NULL;
+    if (code->protocol == IR_PROTOCOL_RC6) {
+        state = &g_rc6_toggle_state;
+    } else if (code->protocol == IR_PROTOCOL_RC5) {
+        state = &g_rc5_toggle_state;
     }
 
-    esp_err_t ret = ESP_OK;
+    if (state && code->toggle == IR_TX_TOGGLE_AUTO) {
+        code->toggle = *state;
+        *state = !*state;
+    }
+}
 
-    if (ctx->encoder) {
-        ESP_LOGI(TAG, "Deleting IR encoder");
-        esp_err_t del_enc_ret = rmt_del_encoder(ctx->encoder);
-        if (del_enc_ret != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to delete encoder: %s", esp_err_to_name(del_enc_ret));
-            ret = del_enc_ret;
+// Descarta TX done de um pedido anterior que excedeu o timeout
+static void drain_done(void)
+{
+    while (xSemaphoreTake(s_tx_done, 0) == pdTRUE) {
+    }
+}
+
+// Uma espera por transação enfileirada, limitada a span_us cada
+static esp_err_t wait_done(int queued, uint32_t span_us, esp_err_t ret)
+{
+    TickType_t wait = pdMS_TO_TICKS(span_us / 1000 + IR_TX_DONE_MARGIN_MS);
+    for (int i = 0; i < queued; i++) {
+        if (xSemaphoreTake(s_tx_done, wait) != pdTRUE) {
+            ESP_LOGE(TAG, "TX done timeout");
+            return ESP_ERR_TIMEOUT;
         }
-        ctx->encoder = NULL;
     }
 
-    if (ctx->tx_channel) {
-        ESP_LOGI(TAG, "Disabling RMT TX channel");
-        esp_err_t disable_ret = rmt_disable(ctx->tx_channel);
-        if (disable_ret != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to disable TX channel: %s", esp_err_to_name(disable_ret));
-            ret = disable_ret;
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to transmit: %s", esp_err_to_name(ret));
+    }
+    return ret;
+}
+
+static esp_err_t transmit(const ir_tx_request_t *req)
+{
+    ir_tx_code_t code = req->code;
+    const ir_tx_timing_t *timing = &TIMINGS[code.protocol];
+    rmt_encoder_handle_t encoder;
+
+    esp_err_t ret = get_encoder(code.protocol, &encoder);
+    if (ret == ESP_OK) {
+        ret = set_carrier(timing->carrier_hz, IR_TX_DUTY_CYCLE);
+    }
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    resolve_toggle(&code);
+
+    // Payload e silêncios ficam vivos até o último TX done
+    ir_scan_code_t scan;
+    size_t scan_size = make_scan_code(&code, &scan);
+    size_t gap_frame = make_gap(timing->period_us, ir_tx_frame_us(&code), s_gap_frame);
+    size_t gap_repeat = 0;
+    if (code.protocol == IR_PROTOCOL_NEC) {
+        gap_repeat = make_gap(timing->period_us, NEC_REPEAT_US, s_gap_repeat);
+    }
+
+    int frames = frame_count(timing, req->repeats);
+    drain_done();
+
+    rmt_transmit_config_t transmit_config = {
+        .loop_count = 0,
+    };
+    int queued = 0;
+
+    for (int f = 0; f < frames && ret == ESP_OK; f++) {
+        const rmt_symbol_word_t *gap = s_gap_frame;
+        size_t gap_count = gap_frame;
+
+        if (f > 0 && code.protocol == IR_PROTOCOL_NEC) {
+            ret = rmt_transmit(s_channel, s_copy_encoder, s_nec_repeat, sizeof(s_nec_repeat),
+                               &transmit_config);
+            gap = s_gap_repeat;
+            gap_count = gap_repeat;
+        } else {
+            ret = rmt_transmit(s_channel, encoder, &scan, scan_size, &transmit_config);
         }
+        if (ret != ESP_OK) {
+            break;
+        }
+        queued++;
 
-        ESP_LOGI(TAG, "Deleting RMT TX channel");
-        esp_err_t del_ret = rmt_del_channel(ctx->tx_channel);
-        if (del_ret != ESP_OK) {
-            ESP_LOGE(TAG, "Failed to delete TX channel: %s", esp_err_to_name(del_ret));
-            ret = del_ret;
+        ret = rmt_transmit(s_channel, s_copy_encoder, gap, gap_count * sizeof(rmt_symbol_word_t),
+                           &transmit_config);
+        if (ret == ESP_OK) {
+            queued++;
         }
-        ctx->tx_channel = NULL;
     }
 
+    return wait_done(queued, timing->period_us, ret);
+}
+
+static esp_err_t transmit_raw(const ir_tx_raw_t *raw)
+{
+    float duty = (raw->duty_cycle > 0) ? raw->duty_cycle : IR_TX_DUTY_CYCLE;
+    esp_err_t ret = set_carrier(raw->frequency, duty);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    size_t gap = make_gap(raw->gap_us, 0, s_gap_frame);
+    drain_done();
+
+    rmt_transmit_config_t transmit_config = {
+        .loop_count = 0,
+    };
+    int queued = 0;
+
+    ret = rmt_transmit(s_channel, s_copy_encoder, raw->symbols,
+                       raw->num_symbols * sizeof(rmt_symbol_word_t), &transmit_config);
     if (ret == ESP_OK) {
-        ESP_LOGI(TAG, "TX module deinitialized successfully");
+        queued++;
+        ret = rmt_transmit(s_channel, s_copy_encoder, s_gap_frame,
+                           gap * sizeof(rmt_symbol_word_t), &transmit_config);
+    }
+    if (ret == ESP_OK) {
+        queued++;
     }
 
-    return ret;
+    return wait_done(queued, ir_tx_raw_air_us(raw), ret);
 }
 
-esp_err_t ir_tx_send_nec(ir_context_t *ctx, uint16_t address, uint16_t command)
+static void finish(const ir_tx_request_t *req, esp_err_t ret)
 {
-    if (!ctx || !ctx->tx_channel || !ctx->encoder) {
-        ESP_LOGE(TAG, "TX not initialized");
-        return ESP_ERR_INVALID_STATE;
+    if (req->done) {
+        req->done(ret, req->arg);
     }
+    if (req->sync) {
+        s_sync_result = ret;
+        xSemaphoreGive(s_sync_done);
+    }
+}
+
+static void tx_task(void *arg)
+{
+    ir_tx_request_t req;
+
+    while (xQueueReceive(s_queue, &req, portMAX_DELAY) == pdTRUE && !req.stop) {
+        finish(&req, req.is_raw ? transmit_raw(&req.raw) : transmit(&req));
+    }
+
+    channel_close();
 
-    const ir_nec_scan_code_t scan_code = {
-        .address = address,
-        .command = command,
+    // Pedidos enfileirados depois do stop não são transmitidos
+    while (xQueueReceive(s_queue, &req, 0) == pdTRUE) {
+        finish(&req, ESP_ERR_INVALID_STATE);
+    }
+
+    s_task = NULL;
+    xSemaphoreGive(s_stopped);
+    vTaskDelete(NULL);
+}
+
+/* ============================================================================
+ * API
+ * ============================================================================ */
+
+esp_err_t ir_tx_service_start(void)
+{
+    if (s_running) {
+        return ESP_OK;
+    }
+
+    // Fila e semáforos são reaproveitados se o serviço for reiniciado
+    if (!s_queue) s_queue = xQueueCreate(IR_TX_QUEUE_LEN, sizeof(ir_tx_request_t));
+    if (!s_tx_done) s_tx_done = xSemaphoreCreateCounting(IR_TX_MAX_TRANS, 0);
+    if (!s_sync_lock) s_sync_lock = xSemaphoreCreateMutex();
+    if (!s_sync_done) s_sync_done = xSemaphoreCreateBinary();
+    if (!s_stopped) s_stopped = xSemaphoreCreateBinary();
+    if (!s_queue || !s_tx_done || !s_sync_lock || !s_sync_done || !s_stopped) {
+        ESP_LOGE(TAG, "Falha ao criar fila/semáforos de TX");
+        return ESP_ERR_NO_MEM;
+    }
+
+    s_nec_repeat[0] = (rmt_symbol_word_t) {
+        .level0 = 1,
+        .duration0 = US_TO_TICKS(NEC_REPEAT_CODE_DURATION_0),
+        .level1 = 0,
+        .duration1 = US_TO_TICKS(NEC_REPEAT_CODE_DURATION_1),
     };
-    
-    rmt_transmit_config_t transmit_config = { 
-        .loop_count = 0 
+    s_nec_repeat[1] = (rmt_symbol_word_t) {
+        .level0 = 1,
+        .duration0 = US_TO_TICKS(NEC_PAYLOAD_ZERO_DURATION_0),
+        .level1 = 0,
+        .duration1 = 0,
     };
-    
-    esp_err_t ret = rmt_transmit(ctx->tx_channel, ctx->encoder, &scan_code, sizeof(scan_code), &transmit_config);
+
+    esp_err_t ret = channel_open();
     if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to transmit: %s", esp_err_to_name(ret));
-    } else {
-        ESP_LOGI(TAG, "Sent NEC code - Address: 0x%04X, Command: 0x%04X", address, command);
+        return ret;
     }
-    
-    return ret;
+
+    s_running = true;
+    if (xTaskCreate(tx_task, "ir_tx", IR_TX_TASK_STACK, NULL, IR_TX_TASK_PRIO, &s_task) != pdPASS) {
+        s_running = false;
+        channel_close();
+        ESP_LOGE(TAG, "Falha ao criar task de TX");
+        return ESP_ERR_NO_MEM;
+    }
+
+    ESP_LOGI(TAG, "Serviço de TX IR iniciado");
+    return ESP_OK;
 }
 
-esp_err_t ir_tx_send_rc6(ir_context_t *ctx, uint8_t address, uint8_t command, uint8_t toggle)
+esp_err_t ir_tx_service_stop(void)
 {
-    if (!ctx || !ctx->tx_channel || !ctx->encoder) {
-        ESP_LOGE(TAG, "TX not initialized");
+    if (!s_running) {
         return ESP_ERR_INVALID_STATE;
     }
+    s_running = false;
 
-    const ir_rc6_scan_code_t scan_code = {
-        .address = address,
-        .command = command,
-        .toggle = toggle & 0x1,
+    ir_tx_request_t req = {
+        .stop = true,
     };
-    
-    rmt_transmit_config_t transmit_config = { 
-        .loop_count = 0 
+    xQueueSend(s_queue, &req, portMAX_DELAY);
+    xSemaphoreTake(s_stopped, portMAX_DELAY);
+
+    ESP_LOGI(TAG, "Serviço de TX IR parado");
+    return ESP_OK;
+}
+
+bool ir_tx_service_is_running(void)
+{
+    return s_running;
+}
+
+static esp_err_t check_code(const ir_tx_code_t *code, uint8_t repeats)
+{
+    if (!code || repeats > IR_TX_MAX_REPEATS) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (code->protocol >= IR_PROTOCOL_COUNT) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    if ((code->protocol == IR_PROTOCOL_RC5 || code->protocol == IR_PROTOCOL_RC6) &&
+        code->toggle > 1 && code->toggle != IR_TX_TOGGLE_AUTO) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (code->protocol == IR_PROTOCOL_SIRC) {
+        uint8_t bits = sony_bits(code);
+        if (bits != 12 && bits != 15 && bits != 20) {
+            return ESP_ERR_INVALID_ARG;
+        }
+    }
+    return s_running ? ESP_OK : ESP_ERR_INVALID_STATE;
+}
+
+static esp_err_t check_raw(const ir_tx_raw_t *raw)
+{
+    if (!raw || !raw->symbols || raw->num_symbols == 0 ||
+        raw->frequency < IR_TX_MIN_FREQUENCY || raw->frequency > IR_TX_MAX_FREQUENCY ||
+        raw->duty_cycle < 0 || raw->duty_cycle > 1 || raw->gap_us > IR_TX_MAX_GAP_US) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    return s_running ? ESP_OK : ESP_ERR_INVALID_STATE;
+}
+
+static esp_err_t send_sync(ir_tx_request_t *req)
+{
+    req->sync = true;
+
+    xSemaphoreTake(s_sync_lock, portMAX_DELAY);
+    xQueueSend(s_queue, req, portMAX_DELAY);
+    xSemaphoreTake(s_sync_done, portMAX_DELAY);
+    esp_err_t ret = s_sync_result;
+    xSemaphoreGive(s_sync_lock);
+
+    return ret;
+}
+
+static esp_err_t post(const ir_tx_request_t *req, uint32_t timeout_ms)
+{
+    if (xQueueSend(s_queue, req, pdMS_TO_TICKS(timeout_ms)) != pdTRUE) {
+        return ESP_ERR_TIMEOUT;
+    }
+    return ESP_OK;
+}
+
+esp_err_t ir_tx_send(const ir_tx_code_t *code, uint8_t repeats)
+{
+    esp_err_t ret = check_code(code, repeats);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    ir_tx_request_t req = {
+        .code = *code,
+        .repeats = repeats,
     };
-    
-    esp_err_t ret = rmt_transmit(ctx->tx_channel, ctx->encoder, &scan_code, sizeof(scan_code), &transmit_config);
+    return send_sync(&req);
+}
+
+esp_err_t ir_tx_post(const ir_tx_code_t *code, uint8_t repeats, uint32_t timeout_ms)
+{
+    return ir_tx_post_notify(code, repeats, timeout_ms, NULL, NULL);
+}
+
+esp_err_t ir_tx_post_notify(const ir_tx_code_t *code, uint8_t repeats, uint32_t timeout_ms,
+                            ir_tx_done_cb_t done, void *arg)
+{
+    esp_err_t ret = check_code(code, repeats);
     if (ret != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to transmit: %s", esp_err_to_name(ret));
-    } else {
-        ESP_LOGI(TAG, "Sent RC6 code - Address: 0x%02X, Command: 0x%02X, Toggle: %d", 
-                 address, command, toggle);
+        return ret;
     }
-    
-    return ret;
+
+    ir_tx_request_t req = {
+        .code = *code,
+        .repeats = repeats,
+        .done = done,
+        .arg = arg,
+    };
+    return post(&req, timeout_ms);
+}
+
+esp_err_t ir_tx_send_raw(const ir_tx_raw_t *raw)
+{
+    esp_err_t ret = check_raw(raw);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    ir_tx_request_t req = {
+        .raw = *raw,
+        .is_raw = true,
+    };
+    return send_sync(&req);
+}
+
+esp_err_t ir_tx_post_raw(const ir_tx_raw_t *raw, uint32_t timeout_ms,
+                         ir_tx_done_cb_t done, void *arg)
+{
+    esp_err_t ret = check_raw(raw);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    ir_tx_request_t req = {
+        .raw = *raw,
+        .is_raw = true,
+        .done = done,
+        .arg = arg,
+    };
+    return post(&req, timeout_ms);
+}
+
+esp_err_t ir_tx_code_from_file(const ir_code_t *stored, ir_tx_code_t *code)
+{
+    if (!stored || !code) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    int protocol = 0;
+    while (protocol < IR_PROTOCOL_COUNT &&
+           strcmp(stored->protocol, ir_protocol_to_string((ir_protocol_t)protocol)) != 0) {
+        protocol++;
+    }
+
+    // Nomes do Flipper: NECext é o NEC com os 16 bits sem inverso, e o
+    // tamanho do SIRC vem no nome
+    uint8_t bits = stored->bits;
+    if (protocol == IR_PROTOCOL_COUNT) {
+        for (size_t i = 0; i < sizeof(ALIASES) / sizeof(ALIASES[0]); i++) {
+            if (strcmp(stored->protocol, ALIASES[i].name) == 0) {
+                protocol = ALIASES[i].protocol;
+                if (bits == 0xFF) {
+                    bits = ALIASES[i].bits;
+                }
+                break;
+            }
+        }
+    }
+    if (protocol == IR_PROTOCOL_COUNT) {
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+
+    code->protocol = (ir_protocol_t)protocol;
+    code->address = stored->address;
+    code->command = stored->command;
+    code->toggle = (stored->toggle == 0xFF) ? IR_TX_TOGGLE_AUTO : (stored->toggle & 0x1);
+    code->bits = bits;
+    return ESP_OK;
+}
+
+/* ============================================================================
+ * ENVIO A PARTIR DE ARQUIVO
+ * ============================================================================ */
+
+static bool send_stored(const ir_code_t *ir_code)
+{
+    ir_tx_code_t code;
+    if (ir_tx_code_from_file(ir_code, &code) != ESP_OK) {
+        ESP_LOGE(TAG, "Protocolo não suportado: %s", ir_code->protocol);
+        return false;
+    }
+
+    // O serviço fica no ar depois do primeiro envio: os seguintes não
+    // recriam canal nem encoder
+    esp_err_t ret = ir_tx_service_start();
+    if (ret == ESP_OK) {
+        ret = ir_tx_send(&code, 0);
+    }
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Falha ao transmitir código IR: %s", esp_err_to_name(ret));
+        return false;
+    }
+
+    ESP_LOGI(TAG, "Transmitido %s: addr=0x%08" PRIX32 ", cmd=0x%08" PRIX32,
+             ir_code->protocol, ir_code->address, ir_code->command);
+    return true;
+}
+
+bool ir_tx_send_from_file(const char* filename) {
+    ir_code_t ir_code;
+    if (!ir_load(filename, &ir_code)) {
+        ESP_LOGE(TAG, "Falha ao carregar código do arquivo: %s", filename);
+        return false;
+    }
+    return send_stored(&ir_code);
+}
+
+static bool send_raw_signal(const char *filepath, const ir_signal_t *signal)
+{
+    uint32_t *timings = malloc(IR_LIBRARY_MAX_TIMINGS * sizeof(uint32_t));
+    rmt_symbol_word_t *symbols = malloc(IR_LIBRARY_MAX_TIMINGS * sizeof(rmt_symbol_word_t));
+    size_t count = 0;
+    esp_err_t ret = ESP_ERR_NO_MEM;
+
+    if (timings && symbols) {
+        ret = ir_library_read_raw(filepath, signal->name, timings, IR_LIBRARY_MAX_TIMINGS, &count);
+    }
+    if (ret == ESP_OK) {
+        ir_tx_raw_t raw = {
+            .symbols = symbols,
+            .num_symbols = ir_tx_raw_encode(timings, count, symbols, IR_LIBRARY_MAX_TIMINGS),
+            .frequency = signal->frequency,
+            .duty_cycle = signal->duty_cycle,
+            .gap_us = IR_TX_RAW_GAP_US,
+        };
+        ret = ir_tx_service_start();
+        if (ret == ESP_OK) {
+            ret = ir_tx_send_raw(&raw);
+        }
+    }
+
+    free(timings);
+    free(symbols);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Falha ao transmitir sinal raw %s: %s", signal->name, esp_err_to_name(ret));
+        return false;
+    }
+
+    ESP_LOGI(TAG, "Transmitido raw %s: %u tempos a %" PRIu32 " Hz", signal->name, (unsigned)count, signal->frequency);
+    return true;
+}
+
+bool ir_tx_send_signal(const char* filename, const char* name) {
+    if (!filename || !name) {
+        ESP_LOGE(TAG, "Parâmetros inválidos");
+        return false;
+    }
+
+    char filepath[128];
+    snprintf(filepath, sizeof(filepath), IR_STORAGE_BASE_PATH "/%s.ir", filename);
+
+    ir_signal_t signal;
+    if (ir_library_find(filepath, name, &signal) != ESP_OK) {
+        ESP_LOGE(TAG, "Falha ao carregar sinal %s de %s", name, filename);
+        return false;
+    }
+    if (signal.type == IR_SIGNAL_RAW) {
+        return send_raw_signal(filepath, &signal);
+    }
+    return send_stored(&signal.code);
 }
 
 void ir_tx_reset_rc6_toggle(void) {
     g_rc6_toggle_state = 0;
     ESP_LOGI(TAG, "RC6 toggle state reset to 0");
 }
+
+void ir_tx_reset_rc5_toggle(void) {
+    g_rc5_toggle_state = 0;
+    ESP_LOGI(TAG, "RC5 toggle state reset to 0");
+}
@@ -16,7 +16,6 @@
 #include "esp_check.h"
 #include "ir_encoder.h"  
 #include "protocol_nec.h"
-#include "ir_storage.h"
 
 static const char *TAG = "nec_encoder";
 
@@ -29,12 +28,6 @@ typedef struct {
     int state;
 } rmt_ir_nec_encoder_t;
 
-/**
- * @brief Saving NEC decode results
- */
-static uint16_t s_nec_code_address;
-static uint16_t s_nec_code_command;
-
 static size_t rmt_encode_ir_nec(rmt_encoder_t *encoder, rmt_channel_handle_t channel, const void *primary_data, size_t data_size, rmt_encode_state_t *ret_state)
 {
     rmt_ir_nec_encoder_t *nec_encoder = __containerof(encoder, rmt_ir_nec_encoder_t, base);
@@ -136,7 +129,7 @@ esp_err_t rmt_new_ir_nec_encoder(const ir_nec_encoder_config_t *config, rmt_enco
         .level0 = 1,
         .duration0 = 560 * config->resolution / 1000000,
         .level1 = 0,
-        .duration1 = 0x7FFF,
+        .duration1 = 0,  // Fim do quadro: o silêncio até o próximo é do ir_tx
     };
 
     rmt_bytes_encoder_config_t bytes_encoder_config = {
@@ -170,99 +163,75 @@ err:
     return ret;
 }
 
-static inline bool nec_check_in_range(uint32_t signal_duration, uint32_t spec_duration)
-{
-    return (signal_duration < (spec_duration + EXAMPLE_IR_NEC_DECODE_MARGIN)) &&
-           (signal_duration > (spec_duration - EXAMPLE_IR_NEC_DECODE_MARGIN));
-}
-
-static bool nec_parse_logic0(rmt_symbol_word_t *rmt_nec_symbols)
-{
-    return nec_check_in_range(rmt_nec_symbols->duration0, NEC_PAYLOAD_ZERO_DURATION_0) &&
-           nec_check_in_range(rmt_nec_symbols->duration1, NEC_PAYLOAD_ZERO_DURATION_1);
-}
-
-static bool nec_parse_logic1(rmt_symbol_word_t *rmt_nec_symbols)
-{
-    return nec_check_in_range(rmt_nec_symbols->duration0, NEC_PAYLOAD_ONE_DURATION_0) &&
-           nec_check_in_range(rmt_nec_symbols->duration1, NEC_PAYLOAD_ONE_DURATION_1);
-}
+// ========== Decoder ==========
 
-static bool nec_parse_frame(rmt_symbol_word_t *rmt_nec_symbols)
+static ir_decode_status_t nec_feed(ir_decoder_state_t *state, bool mark, uint32_t duration_us,
+                                   ir_decode_result_t *result)
 {
-    rmt_symbol_word_t *cur = rmt_nec_symbols;
-    uint16_t address = 0;
-    uint16_t command = 0;
-    bool valid_leading_code = nec_check_in_range(cur->duration0, NEC_LEADING_CODE_DURATION_0) &&
-                              nec_check_in_range(cur->duration1, NEC_LEADING_CODE_DURATION_1);
-    if (!valid_leading_code) {
-        return false;
-    }
-    cur++;
-    for (int i = 0; i < 16; i++) {
-        if (nec_parse_logic1(cur)) {
-            address |= 1 << i;
-        } else if (nec_parse_logic0(cur)) {
-            address &= ~(1 << i);
-        } else {
-            return false;
+    switch (state->step) {
+    case 0: // leading mark
+        if (mark && ir_decode_match(duration_us, NEC_LEADING_CODE_DURATION_0)) {
+            state->step = 1;
+            return IR_DECODE_MORE;
         }
-        cur++;
-    }
-    for (int i = 0; i < 16; i++) {
-        if (nec_parse_logic1(cur)) {
-            command |= 1 << i;
-        } else if (nec_parse_logic0(cur)) {
-            command &= ~(1 << i);
-        } else {
-            return false;
+        break;
+    case 1: // leading space: frame or repeat code
+        if (ir_decode_match(duration_us, NEC_LEADING_CODE_DURATION_1)) {
+            state->step = 2;
+            return IR_DECODE_MORE;
         }
-        cur++;
-    }
-    s_nec_code_address = address;
-    s_nec_code_command = command;
-    return true;
-}
-
-static bool nec_parse_frame_repeat(rmt_symbol_word_t *rmt_nec_symbols)
-{
-    return nec_check_in_range(rmt_nec_symbols->duration0, NEC_REPEAT_CODE_DURATION_0) &&
-           nec_check_in_range(rmt_nec_symbols->duration1, NEC_REPEAT_CODE_DURATION_1);
-}
-
-void parse_nec_frame(rmt_symbol_word_t *rmt_nec_symbols, size_t symbol_num, const char* filename)
-{
-    printf("NEC frame start---\r\n");
-    for (size_t i = 0; i < symbol_num; i++) {
-        printf("{%d:%d},{%d:%d}\r\n",
-               rmt_nec_symbols[i].level0, rmt_nec_symbols[i].duration0,
-               rmt_nec_symbols[i].level1, rmt_nec_symbols[i].duration1);
-    }
-    printf("---NEC frame end: ");
-    switch (symbol_num) {
-    case 34:
-        if (nec_parse_frame(rmt_nec_symbols)) {
-            printf("Address=%04X, Command=%04X\r\n\r\n",
-                   s_nec_code_address, s_nec_code_command);
+        if (ir_decode_match(duration_us, NEC_REPEAT_CODE_DURATION_1)) {
+            state->step = 5;
+            return IR_DECODE_MORE;
         }
-
-        if (ir_save("NEC", s_nec_code_command, s_nec_code_address, filename)) {
-            ESP_LOGI(TAG, "Código salvo: %s.ir (Protocol=NEC, Address=0x%04X, Command=0x%04X)", 
-                        filename, s_nec_code_address, s_nec_code_command);
-        } else {
-            ESP_LOGE(TAG, "Falha ao salvar código IR");
+        break;
+    case 2: // mark of each bit, then the ending mark
+        if (ir_decode_match(duration_us, NEC_PAYLOAD_ZERO_DURATION_0)) {
+            state->step = (state->count < 32) ? 3 : 4;
+            return IR_DECODE_MORE;
+        }
+        break;
+    case 3: // the space carries the bit, LSB first
+        if (ir_decode_match(duration_us, NEC_PAYLOAD_ONE_DURATION_1)) {
+            state->data |= 1UL << state->count;
+        } else if (!ir_decode_match(duration_us, NEC_PAYLOAD_ZERO_DURATION_1)) {
+            break;
+        }
+        state->count++;
+        state->step = 2;
+        return IR_DECODE_MORE;
+    case 4: // silence after the frame
+        if (duration_us >= IR_DECODE_IDLE_US) {
+            *result = (ir_decode_result_t) {
+                .address = state->data & 0xFFFF,
+                .command = state->data >> 16,
+                .toggle = 0xFF,
+                .bits = 0xFF,
+            };
+            return IR_DECODE_DONE;
         }
-
         break;
-    case 2:
-        if (nec_parse_frame_repeat(rmt_nec_symbols)) {
-            printf("Address=%04X, Command=%04X, repeat\r\n\r\n",
-                   s_nec_code_address, s_nec_code_command);
+    case 5: // ending mark of the repeat code
+        if (ir_decode_match(duration_us, NEC_PAYLOAD_ZERO_DURATION_0)) {
+            state->step = 6;
+            return IR_DECODE_MORE;
         }
         break;
-    default:
-        printf("Unknown NEC frame\r\n\r\n");
+    case 6: // silence after the repeat code
+        if (duration_us >= IR_DECODE_IDLE_US) {
+            *result = (ir_decode_result_t) {
+                .toggle = 0xFF,
+                .bits = 0xFF,
+                .repeat = true,
+            };
+            return IR_DECODE_DONE;
+        }
         break;
     }
+    return IR_DECODE_FAIL;
 }
 
+const ir_decoder_t ir_nec_decoder = {
+    .protocol = IR_PROTOCOL_NEC,
+    .feed = nec_feed,
+};
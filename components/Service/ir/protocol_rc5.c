@@ -23,10 +23,12 @@ static const char *TAG = "rc5_encoder";
 // Timings RC5 em microsegundos
 #define RC5_UNIT                 889    // Unidade base (Manchester)
 
+#define RC5_MAX_SYMBOLS           30    // Símbolos do maior quadro
+
 typedef struct {
     rmt_encoder_t base;
     rmt_encoder_t *copy_encoder;
-    rmt_symbol_word_t *symbols;
+    rmt_symbol_word_t symbols[RC5_MAX_SYMBOLS];  // Quadro atual (o encoder é reaproveitado)
     size_t num_symbols;
     size_t current_symbol;
     uint32_t resolution;
@@ -43,23 +45,13 @@ static void build_rc5_symbols(rmt_ir_rc5_encoder_t *encoder, const ir_rc5_scan_c
     
     // Construir frame: 2 start bits + 1 toggle + 5 address + 6 command = 14 bits
     uint16_t frame = 0;
-    frame |= (0x3 << 11);  // 2 start bits (sempre 11)
-    frame |= ((scan_code->toggle & 0x1) << 10);
+    frame |= (0x3 << 12);  // 2 start bits (sempre 11)
+    frame |= ((scan_code->toggle & 0x1) << 11);
     frame |= ((scan_code->address & 0x1F) << 6);
     frame |= (scan_code->command & 0x3F);
     
-    ESP_LOGI(TAG, "Building RC5 frame: 0x%04X (addr=0x%02X, cmd=0x%02X, toggle=%d)",
-             frame, scan_code->address, scan_code->command, scan_code->toggle);
-    
-    // Aloca símbolos (14 bits * 2 transições cada = 28 símbolos máximo)
-    encoder->symbols = malloc(sizeof(rmt_symbol_word_t) * 30);
-    if (!encoder->symbols) {
-        ESP_LOGE(TAG, "Failed to allocate symbols");
-        return;
-    }
-    
     // Manchester encoding: bit 1 = space->mark, bit 0 = mark->space
-    for (int i = 12; i >= 0; i--) {  // 13 bits (2 start + 1 toggle + 5 addr + 6 cmd)
+    for (int i = 13; i >= 0; i--) {  // 14 bits (2 start + 1 toggle + 5 addr + 6 cmd)
         bool bit = (frame >> i) & 1;
         
         if (bit) {
@@ -90,7 +82,6 @@ static void build_rc5_symbols(rmt_ir_rc5_encoder_t *encoder, const ir_rc5_scan_c
     };
     
     encoder->num_symbols = idx;
-    ESP_LOGI(TAG, "Built %zu symbols", encoder->num_symbols);
 }
 
 static size_t rmt_encode_ir_rc5(rmt_encoder_t *encoder, rmt_channel_handle_t channel,
@@ -139,9 +130,6 @@ out:
 static esp_err_t rmt_del_ir_rc5_encoder(rmt_encoder_t *encoder) {
     rmt_ir_rc5_encoder_t *rc5_encoder = __containerof(encoder, rmt_ir_rc5_encoder_t, base);
     
-    if (rc5_encoder->symbols) {
-        free(rc5_encoder->symbols);
-    }
     if (rc5_encoder->copy_encoder) {
         rmt_del_encoder(rc5_encoder->copy_encoder);
     }
@@ -155,11 +143,6 @@ static esp_err_t rmt_ir_rc5_encoder_reset(rmt_encoder_t *encoder) {
     rc5_encoder->state = 0;
     rc5_encoder->current_symbol = 0;
     
-    if (rc5_encoder->symbols) {
-        free(rc5_encoder->symbols);
-        rc5_encoder->symbols = NULL;
-    }
-    
     return ESP_OK;
 }
 
@@ -177,7 +160,6 @@ esp_err_t rmt_new_ir_rc5_encoder(const ir_rc5_encoder_config_t *config,
     rc5_encoder->base.del = rmt_del_ir_rc5_encoder;
     rc5_encoder->base.reset = rmt_ir_rc5_encoder_reset;
     rc5_encoder->resolution = config->resolution;
-    rc5_encoder->symbols = NULL;
     rc5_encoder->num_symbols = 0;
     rc5_encoder->current_symbol = 0;
     rc5_encoder->state = 0;
@@ -199,3 +181,56 @@ err:
     }
     return ret;
 }
+
+// ========== Decoder ==========
+
+#define RC5_FRAME_BITS  14
+
+static ir_decode_status_t rc5_feed(ir_decoder_state_t *state, bool mark, uint32_t duration_us,
+                                   ir_decode_result_t *result)
+{
+    if (state->step == 0) {
+        // O primeiro start bit (1) começa com um espaço que se perde no silêncio
+        ir_decode_manchester(state, false, 1);
+        state->step = 1;
+    }
+
+    if (!mark && duration_us >= IR_DECODE_IDLE_US) {
+        // Um bit 0 no fim termina em espaço, que se confunde com o silêncio
+        if (state->phase == 1 && state->level) {
+            ir_decode_manchester(state, false, 1);
+        }
+        if (state->phase != 0 || state->fill != 0 || state->count != RC5_FRAME_BITS) {
+            return IR_DECODE_FAIL;
+        }
+
+        // Manchester do RC5: 1 = espaço -> marca
+        uint32_t frame = ~state->data & 0x3FFF;
+        if (!(frame & (1 << 13))) {
+            return IR_DECODE_FAIL;
+        }
+        *result = (ir_decode_result_t) {
+            .address = (frame >> 6) & 0x1F,
+            .command = (frame & 0x3F) | ((frame & (1 << 12)) ? 0 : 0x40),
+            .toggle = (frame >> 11) & 0x1,
+            .bits = 0xFF,
+        };
+        return IR_DECODE_DONE;
+    }
+
+    uint8_t units = ir_decode_units(duration_us, RC5_BIT_DURATION, 2);
+    if (units == 0) {
+        return IR_DECODE_FAIL;
+    }
+    for (uint8_t i = 0; i < units; i++) {
+        if (ir_decode_manchester(state, mark, 1) < 0 || state->count > RC5_FRAME_BITS) {
+            return IR_DECODE_FAIL;
+        }
+    }
+    return IR_DECODE_MORE;
+}
+
+const ir_decoder_t ir_rc5_decoder = {
+    .protocol = IR_PROTOCOL_RC5,
+    .feed = rc5_feed,
+};
@@ -25,10 +25,12 @@ static const char *TAG = "rc6_encoder";
 #define RC6_HEADER_MARK         2666   // 6T
 #define RC6_HEADER_SPACE         889   // 2T
 
+#define RC6_MAX_SYMBOLS           50    // Símbolos do maior quadro
+
 typedef struct {
     rmt_encoder_t base;
     rmt_encoder_t *copy_encoder;
-    rmt_symbol_word_t *symbols;
+    rmt_symbol_word_t symbols[RC6_MAX_SYMBOLS];  // Quadro atual (o encoder é reaproveitado)
     size_t num_symbols;
     size_t current_symbol;
     uint32_t resolution;
@@ -50,16 +52,6 @@ static void build_rc6_symbols(rmt_ir_rc6_encoder_t *encoder, const ir_rc6_scan_c
     frame |= ((uint32_t)scan_code->address << 8);
     frame |= scan_code->command;
     
-    ESP_LOGI(TAG, "Building RC6 frame: 0x%05lX (addr=0x%02X, cmd=0x%02X, toggle=%d)",
-             frame, scan_code->address, scan_code->command, scan_code->toggle);
-    
-    // Aloca array de símbolos (header + start + 20 bits data * 2 + margem)
-    encoder->symbols = malloc(sizeof(rmt_symbol_word_t) * 50);
-    if (!encoder->symbols) {
-        ESP_LOGE(TAG, "Failed to allocate symbols");
-        return;
-    }
-    
     // Header: 6T mark + 2T space
     encoder->symbols[idx++] = (rmt_symbol_word_t) {
         .level0 = 1,
@@ -111,7 +103,6 @@ static void build_rc6_symbols(rmt_ir_rc6_encoder_t *encoder, const ir_rc6_scan_c
     };
     
     encoder->num_symbols = idx;
-    ESP_LOGI(TAG, "Built %zu symbols", encoder->num_symbols);
 }
 
 static size_t rmt_encode_ir_rc6(rmt_encoder_t *encoder, rmt_channel_handle_t channel,
@@ -163,9 +154,6 @@ out:
 static esp_err_t rmt_del_ir_rc6_encoder(rmt_encoder_t *encoder) {
     rmt_ir_rc6_encoder_t *rc6_encoder = __containerof(encoder, rmt_ir_rc6_encoder_t, base);
     
-    if (rc6_encoder->symbols) {
-        free(rc6_encoder->symbols);
-    }
     if (rc6_encoder->copy_encoder) {
         rmt_del_encoder(rc6_encoder->copy_encoder);
     }
@@ -179,11 +167,6 @@ static esp_err_t rmt_ir_rc6_encoder_reset(rmt_encoder_t *encoder) {
     rc6_encoder->state = 0;
     rc6_encoder->current_symbol = 0;
     
-    if (rc6_encoder->symbols) {
-        free(rc6_encoder->symbols);
-        rc6_encoder->symbols = NULL;
-    }
-    
     return ESP_OK;
 }
 
@@ -201,7 +184,6 @@ esp_err_t rmt_new_ir_rc6_encoder(const ir_rc6_encoder_config_t *config,
     rc6_encoder->base.del = rmt_del_ir_rc6_encoder;
     rc6_encoder->base.reset = rmt_ir_rc6_encoder_reset;
     rc6_encoder->resolution = config->resolution;
-    rc6_encoder->symbols = NULL;
     rc6_encoder->num_symbols = 0;
     rc6_encoder->current_symbol = 0;
     rc6_encoder->state = 0;
@@ -223,3 +205,73 @@ err:
     }
     return ret;
 }
+
+// ========== Decoder ==========
+
+#define RC6_FRAME_BITS  21      // Start + modo (3) + toggle + endereço (8) + comando (8)
+#define RC6_TOGGLE_BIT  4       // Índice do toggle, com meio bit de 2T
+
+static uint8_t rc6_width(const ir_decoder_state_t *state)
+{
+    return (state->count == RC6_TOGGLE_BIT) ? 2 : 1;
+}
+
+static ir_decode_status_t rc6_feed(ir_decoder_state_t *state, bool mark, uint32_t duration_us,
+                                   ir_decode_result_t *result)
+{
+    switch (state->step) {
+    case 0: // Cabeçalho: marca de 6T...
+        if (mark && ir_decode_match(duration_us, RC6_LEADING_CODE_DURATION_0)) {
+            state->step = 1;
+            return IR_DECODE_MORE;
+        }
+        return IR_DECODE_FAIL;
+    case 1: // ...e espaço de 2T
+        if (ir_decode_match(duration_us, RC6_LEADING_CODE_DURATION_1)) {
+            state->step = 2;
+            return IR_DECODE_MORE;
+        }
+        return IR_DECODE_FAIL;
+    }
+
+    if (!mark && duration_us >= IR_DECODE_IDLE_US) {
+        // Um bit 1 no fim termina em espaço, que se confunde com o silêncio
+        if (state->phase == 1 && state->level) {
+            while (ir_decode_manchester(state, false, rc6_width(state)) == 0) {
+            }
+        }
+        if (state->phase != 0 || state->fill != 0 || state->count != RC6_FRAME_BITS) {
+            return IR_DECODE_FAIL;
+        }
+
+        // Só o modo 0 (start bit 1, modo 000)
+        if ((state->data >> 17) != 0x8) {
+            return IR_DECODE_FAIL;
+        }
+        *result = (ir_decode_result_t) {
+            .address = (state->data >> 8) & 0xFF,
+            .command = state->data & 0xFF,
+            .toggle = (state->data >> 16) & 0x1,
+            .bits = 0xFF,
+        };
+        return IR_DECODE_DONE;
+    }
+
+    // Pulsos de até 3T: meio bit de 1T colado ao meio bit de 2T do toggle
+    uint8_t units = ir_decode_units(duration_us, RC6_PAYLOAD_ZERO_DURATION_0, 3);
+    if (units == 0) {
+        return IR_DECODE_FAIL;
+    }
+    for (uint8_t i = 0; i < units; i++) {
+        if (ir_decode_manchester(state, mark, rc6_width(state)) < 0 ||
+            state->count > RC6_FRAME_BITS) {
+            return IR_DECODE_FAIL;
+        }
+    }
+    return IR_DECODE_MORE;
+}
+
+const ir_decoder_t ir_rc6_decoder = {
+    .protocol = IR_PROTOCOL_RC6,
+    .feed = rc6_feed,
+};
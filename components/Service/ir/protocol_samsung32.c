@@ -21,8 +21,8 @@
 static const char *TAG = "samsung32_encoder";
 
 // Timings Samsung32 em microsegundos
-#define SAMSUNG32_LEADING_MARK    4500
-#define SAMSUNG32_LEADING_SPACE   4500
+#define SAMSUNG32_LEADING_MARK    4500ULL  // ULL: 4500 * 1 MHz estoura 32 bits
+#define SAMSUNG32_LEADING_SPACE   4500ULL
 #define SAMSUNG32_BIT_MARK         560
 #define SAMSUNG32_BIT_ZERO_SPACE   560
 #define SAMSUNG32_BIT_ONE_SPACE   1690
@@ -139,7 +139,7 @@ esp_err_t rmt_new_ir_samsung32_encoder(const ir_samsung32_encoder_config_t *conf
         .level0 = 1,
         .duration0 = SAMSUNG32_ENDING_MARK * config->resolution / 1000000,
         .level1 = 0,
-        .duration1 = 0x7FFF,
+        .duration1 = 0,  // Fim do quadro: o silêncio até o próximo é do ir_tx
     };
 
     // Bytes encoder para os 32 bits de dados
@@ -177,3 +177,56 @@ err:
     }
     return ret;
 }
+
+// ========== Decoder ==========
+
+static ir_decode_status_t samsung32_feed(ir_decoder_state_t *state, bool mark, uint32_t duration_us,
+                                         ir_decode_result_t *result)
+{
+    switch (state->step) {
+    case 0: // Marca inicial
+        if (mark && ir_decode_match(duration_us, SAMSUNG32_LEADING_MARK)) {
+            state->step = 1;
+            return IR_DECODE_MORE;
+        }
+        break;
+    case 1: // Espaço inicial
+        if (ir_decode_match(duration_us, SAMSUNG32_LEADING_SPACE)) {
+            state->step = 2;
+            return IR_DECODE_MORE;
+        }
+        break;
+    case 2: // Marca de cada bit e a marca final
+        if (ir_decode_match(duration_us, SAMSUNG32_BIT_MARK)) {
+            state->step = (state->count < 32) ? 3 : 4;
+            return IR_DECODE_MORE;
+        }
+        break;
+    case 3: // O espaço define o bit (LSB primeiro)
+        if (ir_decode_match(duration_us, SAMSUNG32_BIT_ONE_SPACE)) {
+            state->data |= 1UL << state->count;
+        } else if (!ir_decode_match(duration_us, SAMSUNG32_BIT_ZERO_SPACE)) {
+            break;
+        }
+        state->count++;
+        state->step = 2;
+        return IR_DECODE_MORE;
+    case 4: // Silêncio depois do quadro
+        if (duration_us >= IR_DECODE_IDLE_US) {
+            *result = (ir_decode_result_t) {
+                .address = state->data >> 16,
+                .command = state->data & 0xFFFF,
+                .toggle = 0xFF,
+                .bits = 0xFF,
+            };
+            return IR_DECODE_DONE;
+        }
+        break;
+    }
+    return IR_DECODE_FAIL;
+}
+
+const ir_decoder_t ir_samsung32_decoder = {
+    .protocol = IR_PROTOCOL_SAMSUNG32,
+    .feed = samsung32_feed,
+};
@@ -26,10 +26,12 @@ static const char *TAG = "sony_encoder";
 #define SONY_ZERO_MARK       600
 #define SONY_SPACE           600
 
+#define SONY_MAX_SYMBOLS      50    // Símbolos do maior quadro
+
 typedef struct {
     rmt_encoder_t base;
     rmt_encoder_t *copy_encoder;
-    rmt_symbol_word_t *symbols;
+    rmt_symbol_word_t symbols[SONY_MAX_SYMBOLS];  // Quadro atual (o encoder é reaproveitado)
     size_t num_symbols;
     size_t current_symbol;
     uint32_t resolution;
@@ -50,16 +52,6 @@ static void build_sony_symbols(rmt_ir_sony_encoder_t *encoder, const ir_sony_sca
     frame |= (scan_code->command & 0x7F);  // 7 bits de comando
     frame |= ((uint32_t)scan_code->address << 7);
     
-    ESP_LOGI(TAG, "Building Sony-%d frame: 0x%05lX (addr=0x%04X, cmd=0x%02X)",
-             scan_code->bits, frame, scan_code->address, scan_code->command);
-    
-    // Aloca símbolos (header + bits * 2 + margem)
-    encoder->symbols = malloc(sizeof(rmt_symbol_word_t) * 50);
-    if (!encoder->symbols) {
-        ESP_LOGE(TAG, "Failed to allocate symbols");
-        return;
-    }
-    
     // Header (start bit)
     encoder->symbols[idx++] = (rmt_symbol_word_t) {
         .level0 = 1,
@@ -100,7 +92,6 @@ static void build_sony_symbols(rmt_ir_sony_encoder_t *encoder, const ir_sony_sca
     };
     
     encoder->num_symbols = idx;
-    ESP_LOGI(TAG, "Built %zu symbols", encoder->num_symbols);
 }
 
 static size_t rmt_encode_ir_sony(rmt_encoder_t *encoder, rmt_channel_handle_t channel,
@@ -149,9 +140,6 @@ out:
 static esp_err_t rmt_del_ir_sony_encoder(rmt_encoder_t *encoder) {
     rmt_ir_sony_encoder_t *sony_encoder = __containerof(encoder, rmt_ir_sony_encoder_t, base);
     
-    if (sony_encoder->symbols) {
-        free(sony_encoder->symbols);
-    }
     if (sony_encoder->copy_encoder) {
         rmt_del_encoder(sony_encoder->copy_encoder);
     }
@@ -165,11 +153,6 @@ static esp_err_t rmt_ir_sony_encoder_reset(rmt_encoder_t *encoder) {
     sony_encoder->state = 0;
     sony_encoder->current_symbol = 0;
     
-    if (sony_encoder->symbols) {
-        free(sony_encoder->symbols);
-        sony_encoder->symbols = NULL;
-    }
-    
     return ESP_OK;
 }
 
@@ -187,7 +170,6 @@ esp_err_t rmt_new_ir_sony_encoder(const ir_sony_encoder_config_t *config,
     sony_encoder->base.del = rmt_del_ir_sony_encoder;
     sony_encoder->base.reset = rmt_ir_sony_encoder_reset;
     sony_encoder->resolution = config->resolution;
-    sony_encoder->symbols = NULL;
     sony_encoder->num_symbols = 0;
     sony_encoder->current_symbol = 0;
     sony_encoder->state = 0;
@@ -209,3 +191,51 @@ err:
     }
     return ret;
 }
+
+// ========== Decoder ==========
+
+static ir_decode_status_t sony_feed(ir_decoder_state_t *state, bool mark, uint32_t duration_us,
+                                    ir_decode_result_t *result)
+{
+    switch (state->step) {
+    case 0: // Marca inicial
+        if (mark && ir_decode_match(duration_us, SONY_LEADING_CODE_DURATION)) {
+            state->step = 1;
+            return IR_DECODE_MORE;
+        }
+        break;
+    case 1: // Espaço antes de cada bit, ou o silêncio depois do último
+        if (duration_us >= IR_DECODE_IDLE_US) {
+            if (state->count != 12 && state->count != 15 && state->count != 20) {
+                break;
+            }
+            *result = (ir_decode_result_t) {
+                .address = state->data >> 7,
+                .command = state->data & 0x7F,
+                .toggle = 0xFF,
+                .bits = state->count,
+            };
+            return IR_DECODE_DONE;
+        }
+        if (ir_decode_match(duration_us, SONY_BIT_PERIOD) && state->count < 20) {
+            state->step = 2;
+            return IR_DECODE_MORE;
+        }
+        break;
+    case 2: // A marca define o bit (LSB primeiro)
+        if (ir_decode_match(duration_us, SONY_PAYLOAD_ONE_DURATION)) {
+            state->data |= 1UL << state->count;
+        } else if (!ir_decode_match(duration_us, SONY_PAYLOAD_ZERO_DURATION)) {
+            break;
+        }
+        state->count++;
+        state->step = 1;
+        return IR_DECODE_MORE;
+    }
+    return IR_DECODE_FAIL;
+}
+
+const ir_decoder_t ir_sony_decoder = {
+    .protocol = IR_PROTOCOL_SIRC,
+    .feed = sony_feed,
+};
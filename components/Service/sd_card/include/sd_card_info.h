@@ -14,6 +14,10 @@
 extern "C" {
 #endif
 
+/* Tipos de cartão (sd_card_info_t.card_type) */
+#define SD_CARD_TYPE_SDSC       0
+#define SD_CARD_TYPE_SDHC       1       // SDHC ou SDXC
+
 /**
  * @brief Informações do cartão SD
  */
@@ -23,7 +27,7 @@ typedef struct {
     uint32_t sector_size;
     uint32_t num_sectors;
     uint32_t speed_khz;
-    uint8_t card_type;
+    uint8_t card_type;          // SD_CARD_TYPE_*
     bool is_mounted;
 } sd_card_info_t;
 
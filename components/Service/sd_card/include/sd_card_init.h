@@ -1,6 +1,11 @@
 /**
  * @file sd_card_init.h
  * @brief Funções de inicialização e controle do cartão SD
+ *
+ * As APIs sd_card_*.h são mantidas por compatibilidade: cada função chama a
+ * storage API (storage.h) com o caminho dentro de SD_MOUNT_POINT, então o
+ * cartão precisa estar habilitado em vfs_config.h (VFS_USE_SD_CARD). Os
+ * códigos de erro são os da storage API.
  */
 
 #ifndef SD_CARD_INIT_H
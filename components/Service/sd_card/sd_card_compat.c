@@ -0,0 +1,754 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file sd_card_compat.c
+ * @brief API sd_* legada sobre a storage API
+ *
+ * As funções sd_* eram uma segunda implementação (POSIX/FATFS direto) das
+ * mesmas operações da storage API. Agora só colocam o caminho dentro do
+ * ponto de montagem do cartão e chamam storage_*, que passa pelo vfs_core:
+ * mesmo cache, mesmos índices, mesma semântica de linhas e os mesmos
+ * códigos de erro (ver storage.h). Código novo deve usar storage.h.
+ */
+
+#include "sd_card_init.h"
+#include "sd_card_info.h"
+#include "sd_card_file.h"
+#include "sd_card_dir.h"
+#include "sd_card_read.h"
+#include "sd_card_write.h"
+#include "storage.h"
+#include "vfs_config.h"
+#include "vfs_core.h"
+#ifdef VFS_USE_SD_CARD
+#include "vfs_sdcard.h"
+#endif
+#include "esp_log.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+
+static const char *TAG = "sd_compat";
+
+#define SD_PATH_MAX     256
+#define SD_TEXT_MAX     512     // Texto de sd_write/append_formatted, como na storage API
+
+/* ============================================================================
+ * CAMINHOS
+ * ============================================================================ */
+
+// "/sdcard/x", "sdcard/x", "/x" e "x" viram "/sdcard/x"
+static esp_err_t sd_path(const char *path, char *out, size_t size)
+{
+    if (!sd_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!path) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    const char *mount = SD_MOUNT_POINT;
+    size_t len = strlen(mount);
+
+    if (strncmp(path, mount, len) == 0 && (path[len] == '/' || path[len] == '\0')) {
+        snprintf(out, size, "%s", path);
+    } else if (strncmp(path, mount + 1, len - 1) == 0 &&
+               (path[len - 1] == '/' || path[len - 1] == '\0')) {
+        snprintf(out, size, "/%s", path);
+    } else if (path[0] == '/') {
+        snprintf(out, size, "%s%s", mount, path);
+    } else {
+        snprintf(out, size, "%s/%s", mount, path);
+    }
+    return ESP_OK;
+}
+
+/* ============================================================================
+ * INICIALIZAÇÃO
+ * ============================================================================ */
+
+esp_err_t sd_init(void)
+{
+#ifdef VFS_USE_SD_CARD
+    // storage_init() monta todos os backends de vfs_config.h, o cartão junto
+    if (!storage_is_mounted()) {
+        esp_err_t ret = storage_init();
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+    if (vfs_sdcard_is_mounted()) {
+        return ESP_OK;
+    }
+    return vfs_sdcard_init();
+#else
+    ESP_LOGE(TAG, "Cartão SD desabilitado (VFS_USE_SD_CARD em vfs_config.h)");
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+esp_err_t sd_init_custom(uint8_t max_files, bool format_if_failed)
+{
+    ESP_LOGW(TAG, "max_files e format_if_failed vêm de vfs_config.h (VFS_SD_*)");
+    return sd_init();
+}
+
+esp_err_t sd_init_custom_pins(int mosi, int miso, int clk, int cs)
+{
+    ESP_LOGW(TAG, "Pinos customizados não suportados com driver SPI centralizado");
+    ESP_LOGW(TAG, "Usando pinos padrão definidos em pin_def.h");
+    return sd_init();
+}
+
+esp_err_t sd_deinit(void)
+{
+#ifdef VFS_USE_SD_CARD
+    // Só o cartão: a flash continua montada para o resto da storage API
+    return vfs_sdcard_deinit();
+#else
+    return ESP_ERR_INVALID_STATE;
+#endif
+}
+
+bool sd_is_mounted(void)
+{
+#ifdef VFS_USE_SD_CARD
+    return storage_is_mounted() && vfs_sdcard_is_mounted();
+#else
+    return false;
+#endif
+}
+
+esp_err_t sd_remount(void)
+{
+#ifdef VFS_USE_SD_CARD
+    if (vfs_sdcard_is_mounted()) {
+        esp_err_t ret = vfs_sdcard_deinit();
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    }
+#endif
+    return sd_init();
+}
+
+esp_err_t sd_reset_bus(void)
+{
+    ESP_LOGW(TAG, "Reset de barramento não suportado com driver SPI compartilhado");
+    ESP_LOGI(TAG, "Use sd_remount() para remontar o cartão");
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+esp_err_t sd_check_health(void)
+{
+    if (!sd_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+#ifdef VFS_USE_SD_CARD
+    // Um cartão que não responde é desmontado aqui (ver vfs_sdcard_check)
+    if (!vfs_sdcard_check()) {
+        ESP_LOGE(TAG, "Cartão não responde");
+        return ESP_FAIL;
+    }
+#endif
+    return ESP_OK;
+}
+
+/* ============================================================================
+ * INFORMAÇÕES
+ * ============================================================================ */
+
+esp_err_t sd_get_card_info(sd_card_info_t *info)
+{
+    if (!sd_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!info) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+#ifdef VFS_USE_SD_CARD
+    vfs_sdcard_info_t card;
+    esp_err_t ret = vfs_sdcard_get_info(&card);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    memset(info, 0, sizeof(*info));
+    strncpy(info->name, card.name, sizeof(info->name) - 1);
+    info->capacity_mb = card.capacity_bytes / (1024 * 1024);
+    info->sector_size = card.sector_size;
+    info->num_sectors = card.sector_count;
+    info->speed_khz = card.freq_khz;
+    info->card_type = card.is_sdhc ? SD_CARD_TYPE_SDHC : SD_CARD_TYPE_SDSC;
+    info->is_mounted = true;
+    return ESP_OK;
+#else
+    return ESP_ERR_NOT_SUPPORTED;
+#endif
+}
+
+void sd_print_card_info(void)
+{
+#ifdef VFS_USE_SD_CARD
+    vfs_sdcard_print_info();
+#else
+    ESP_LOGE(TAG, "SD não montado");
+#endif
+}
+
+esp_err_t sd_get_fs_stats(sd_fs_stats_t *stats)
+{
+    if (!sd_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    vfs_statvfs_t st;
+    esp_err_t ret = vfs_statvfs(SD_MOUNT_POINT, &st);
+    if (ret == ESP_OK) {
+        stats->total_bytes = st.total_bytes;
+        stats->free_bytes = st.free_bytes;
+        stats->used_bytes = st.used_bytes;
+    }
+    return ret;
+}
+
+esp_err_t sd_get_free_space(uint64_t *free_bytes)
+{
+    if (!free_bytes) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    sd_fs_stats_t stats;
+    esp_err_t ret = sd_get_fs_stats(&stats);
+    if (ret == ESP_OK) {
+        *free_bytes = stats.free_bytes;
+    }
+    return ret;
+}
+
+esp_err_t sd_get_total_space(uint64_t *total_bytes)
+{
+    if (!total_bytes) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    sd_fs_stats_t stats;
+    esp_err_t ret = sd_get_fs_stats(&stats);
+    if (ret == ESP_OK) {
+        *total_bytes = stats.total_bytes;
+    }
+    return ret;
+}
+
+esp_err_t sd_get_used_space(uint64_t *used_bytes)
+{
+    if (!used_bytes) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    sd_fs_stats_t stats;
+    esp_err_t ret = sd_get_fs_stats(&stats);
+    if (ret == ESP_OK) {
+        *used_bytes = stats.used_bytes;
+    }
+    return ret;
+}
+
+esp_err_t sd_get_usage_percent(float *percentage)
+{
+    if (!percentage) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    sd_fs_stats_t stats;
+    esp_err_t ret = sd_get_fs_stats(&stats);
+    if (ret == ESP_OK) {
+        *percentage = stats.total_bytes > 0 ?
+            ((float)stats.used_bytes / stats.total_bytes) * 100.0f : 0.0f;
+    }
+    return ret;
+}
+
+esp_err_t sd_get_card_name(char *name, size_t size)
+{
+    if (!name || size == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    sd_card_info_t info;
+    esp_err_t ret = sd_get_card_info(&info);
+    if (ret == ESP_OK) {
+        strncpy(name, info.name, size - 1);
+        name[size - 1] = '\0';
+    }
+    return ret;
+}
+
+esp_err_t sd_get_capacity(uint32_t *capacity_mb)
+{
+    if (!capacity_mb) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    sd_card_info_t info;
+    esp_err_t ret = sd_get_card_info(&info);
+    if (ret == ESP_OK) {
+        *capacity_mb = info.capacity_mb;
+    }
+    return ret;
+}
+
+esp_err_t sd_get_speed(uint32_t *speed_khz)
+{
+    if (!speed_khz) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    sd_card_info_t info;
+    esp_err_t ret = sd_get_card_info(&info);
+    if (ret == ESP_OK) {
+        *speed_khz = info.speed_khz;
+    }
+    return ret;
+}
+
+esp_err_t sd_get_card_type(uint8_t *type)
+{
+    if (!type) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    sd_card_info_t info;
+    esp_err_t ret = sd_get_card_info(&info);
+    if (ret == ESP_OK) {
+        *type = info.card_type;
+    }
+    return ret;
+}
+
+esp_err_t sd_get_card_type_name(char *type_name, size_t size)
+{
+    if (!type_name || size == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    uint8_t type;
+    esp_err_t ret = sd_get_card_type(&type);
+    if (ret == ESP_OK) {
+        snprintf(type_name, size, "%s", type == SD_CARD_TYPE_SDHC ? "SDHC/SDXC" : "SDSC");
+    }
+    return ret;
+}
+
+/* ============================================================================
+ * ARQUIVOS
+ * ============================================================================ */
+
+bool sd_file_exists(const char *path)
+{
+    char full[SD_PATH_MAX];
+    return sd_path(path, full, sizeof(full)) == ESP_OK && storage_file_exists(full);
+}
+
+esp_err_t sd_file_delete(const char *path)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_file_delete(full) : ret;
+}
+
+esp_err_t sd_file_rename(const char *old_path, const char *new_path)
+{
+    char from[SD_PATH_MAX], to[SD_PATH_MAX];
+    esp_err_t ret = sd_path(old_path, from, sizeof(from));
+    if (ret == ESP_OK) ret = sd_path(new_path, to, sizeof(to));
+    return (ret == ESP_OK) ? storage_file_rename(from, to) : ret;
+}
+
+esp_err_t sd_file_copy(const char *src_path, const char *dst_path)
+{
+    char from[SD_PATH_MAX], to[SD_PATH_MAX];
+    esp_err_t ret = sd_path(src_path, from, sizeof(from));
+    if (ret == ESP_OK) ret = sd_path(dst_path, to, sizeof(to));
+    return (ret == ESP_OK) ? storage_file_copy(from, to) : ret;
+}
+
+esp_err_t sd_file_move(const char *src_path, const char *dst_path)
+{
+    char from[SD_PATH_MAX], to[SD_PATH_MAX];
+    esp_err_t ret = sd_path(src_path, from, sizeof(from));
+    if (ret == ESP_OK) ret = sd_path(dst_path, to, sizeof(to));
+    return (ret == ESP_OK) ? storage_file_move(from, to) : ret;
+}
+
+esp_err_t sd_file_get_size(const char *path, size_t *size)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_file_get_size(full, size) : ret;
+}
+
+esp_err_t sd_file_get_info(const char *path, sd_file_info_t *info)
+{
+    if (!info) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    storage_file_info_t st;
+    ret = storage_file_get_info(full, &st);
+    if (ret == ESP_OK) {
+        memset(info, 0, sizeof(*info));
+        strncpy(info->path, st.path, sizeof(info->path) - 1);
+        info->size = st.size;
+        info->modified_time = st.modified_time;
+        info->is_directory = st.is_directory;
+    }
+    return ret;
+}
+
+esp_err_t sd_file_truncate(const char *path, size_t size)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_file_truncate(full, size) : ret;
+}
+
+esp_err_t sd_file_is_empty(const char *path, bool *is_empty)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_file_is_empty(full, is_empty) : ret;
+}
+
+esp_err_t sd_file_compare(const char *path1, const char *path2, bool *are_equal)
+{
+    char a[SD_PATH_MAX], b[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path1, a, sizeof(a));
+    if (ret == ESP_OK) ret = sd_path(path2, b, sizeof(b));
+    return (ret == ESP_OK) ? storage_file_compare(a, b, are_equal) : ret;
+}
+
+esp_err_t sd_file_clear(const char *path)
+{
+    return sd_file_truncate(path, 0);
+}
+
+esp_err_t sd_file_get_extension(const char *path, char *extension, size_t size)
+{
+    return storage_file_get_extension(path, extension, size);
+}
+
+/* ============================================================================
+ * DIRETÓRIOS
+ * ============================================================================ */
+
+esp_err_t sd_dir_create(const char *path)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    // Como antes: diretório que já existe não é erro
+    ret = storage_dir_create(full);
+    return (ret != ESP_OK && storage_dir_exists(full)) ? ESP_OK : ret;
+}
+
+esp_err_t sd_dir_remove_recursive(const char *path)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_dir_remove_recursive(full) : ret;
+}
+
+bool sd_dir_exists(const char *path)
+{
+    char full[SD_PATH_MAX];
+    return sd_path(path, full, sizeof(full)) == ESP_OK && storage_dir_exists(full);
+}
+
+esp_err_t sd_dir_list(const char *path, sd_dir_callback_t callback, void *user_data)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_dir_list(full, callback, user_data) : ret;
+}
+
+esp_err_t sd_dir_count(const char *path, uint32_t *file_count, uint32_t *dir_count)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_dir_count(full, file_count, dir_count) : ret;
+}
+
+esp_err_t sd_dir_copy_recursive(const char *src, const char *dst)
+{
+    char from[SD_PATH_MAX], to[SD_PATH_MAX];
+    esp_err_t ret = sd_path(src, from, sizeof(from));
+    if (ret == ESP_OK) ret = sd_path(dst, to, sizeof(to));
+    return (ret == ESP_OK) ? storage_dir_copy_recursive(from, to) : ret;
+}
+
+esp_err_t sd_dir_get_size(const char *path, uint64_t *total_size)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_dir_get_size(full, total_size) : ret;
+}
+
+/* ============================================================================
+ * LEITURA
+ * ============================================================================ */
+
+esp_err_t sd_read_string(const char *path, char *buffer, size_t buffer_size)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_read_string(full, buffer, buffer_size) : ret;
+}
+
+esp_err_t sd_read_binary(const char *path, void *buffer, size_t size, size_t *bytes_read)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_read_binary(full, buffer, size, bytes_read) : ret;
+}
+
+esp_err_t sd_read_line(const char *path, char *buffer, size_t buffer_size, uint32_t line_number)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_read_line(full, buffer, buffer_size, line_number) : ret;
+}
+
+esp_err_t sd_read_lines(const char *path, sd_line_callback_t callback, void *user_data)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_read_lines(full, callback, user_data) : ret;
+}
+
+esp_err_t sd_count_lines(const char *path, uint32_t *line_count)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_count_lines(full, line_count) : ret;
+}
+
+esp_err_t sd_read_chunk(const char *path, size_t offset, void *buffer, size_t size, size_t *bytes_read)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_read_chunk(full, offset, buffer, size, bytes_read) : ret;
+}
+
+esp_err_t sd_read_first_line(const char *path, char *buffer, size_t buffer_size)
+{
+    return sd_read_line(path, buffer, buffer_size, 1);
+}
+
+esp_err_t sd_read_last_line(const char *path, char *buffer, size_t buffer_size)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_read_last_line(full, buffer, buffer_size) : ret;
+}
+
+esp_err_t sd_read_int(const char *path, int32_t *value)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_read_int(full, value) : ret;
+}
+
+esp_err_t sd_read_float(const char *path, float *value)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_read_float(full, value) : ret;
+}
+
+esp_err_t sd_read_bytes(const char *path, uint8_t *bytes, size_t max_count, size_t *count)
+{
+    return sd_read_binary(path, bytes, max_count, count);
+}
+
+esp_err_t sd_read_byte(const char *path, uint8_t *byte)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_read_byte(full, byte) : ret;
+}
+
+esp_err_t sd_file_contains(const char *path, const char *search, bool *found)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_file_contains(full, search, found) : ret;
+}
+
+esp_err_t sd_count_occurrences(const char *path, const char *search, uint32_t *count)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_count_occurrences(full, search, count) : ret;
+}
+
+/* ============================================================================
+ * ESCRITA
+ * ============================================================================ */
+
+esp_err_t sd_write_string(const char *path, const char *data)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_write_string(full, data) : ret;
+}
+
+esp_err_t sd_append_string(const char *path, const char *data)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_append_string(full, data) : ret;
+}
+
+esp_err_t sd_write_binary(const char *path, const void *data, size_t size)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_write_binary(full, data, size) : ret;
+}
+
+esp_err_t sd_append_binary(const char *path, const void *data, size_t size)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_append_binary(full, data, size) : ret;
+}
+
+esp_err_t sd_write_line(const char *path, const char *line)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_write_line(full, line) : ret;
+}
+
+esp_err_t sd_append_line(const char *path, const char *line)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_append_line(full, line) : ret;
+}
+
+esp_err_t sd_write_formatted(const char *path, const char *format, ...)
+{
+    if (!format) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    char text[SD_TEXT_MAX];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    if (len < 0) {
+        return ESP_FAIL;
+    }
+
+    return storage_write_string(full, text);
+}
+
+esp_err_t sd_append_formatted(const char *path, const char *format, ...)
+{
+    if (!format) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    char text[SD_TEXT_MAX];
+    va_list args;
+    va_start(args, format);
+    int len = vsnprintf(text, sizeof(text), format, args);
+    va_end(args);
+    if (len < 0) {
+        return ESP_FAIL;
+    }
+
+    return storage_append_string(full, text);
+}
+
+esp_err_t sd_write_buffer(const char *path, const void *buffer, size_t size)
+{
+    return sd_write_binary(path, buffer, size);
+}
+
+esp_err_t sd_write_bytes(const char *path, const uint8_t *bytes, size_t count)
+{
+    return sd_write_binary(path, bytes, count);
+}
+
+esp_err_t sd_write_byte(const char *path, uint8_t byte)
+{
+    return sd_write_binary(path, &byte, 1);
+}
+
+esp_err_t sd_write_int(const char *path, int32_t value)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_write_int(full, value) : ret;
+}
+
+esp_err_t sd_write_float(const char *path, float value)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_write_float(full, value) : ret;
+}
+
+esp_err_t sd_write_csv_row(const char *path, const char **columns, size_t num_columns)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_write_csv_row(full, columns, num_columns) : ret;
+}
+
+esp_err_t sd_append_csv_row(const char *path, const char **columns, size_t num_columns)
+{
+    char full[SD_PATH_MAX];
+    esp_err_t ret = sd_path(path, full, sizeof(full));
+    return (ret == ESP_OK) ? storage_append_csv_row(full, columns, num_columns) : ret;
+}
@@ -0,0 +1,50 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file storage.h
+ * @brief Storage API - one interface for every mounted backend
+ *
+ * All file access goes through vfs_core, whichever backend holds the file:
+ * flash (LittleFS/SPIFFS), SD card or RAM disk. Paths starting with a mount
+ * point (/littlefs/..., /sdcard/..., /ram/...) reach that backend; any other
+ * path is taken relative to the primary one (VFS_MOUNT_POINT). The legacy
+ * sd_card_*.h functions are thin wrappers over this API.
+ *
+ * Every esp_err_t function follows the same contract, on every backend:
+ * - ESP_OK                 success
+ * - ESP_ERR_INVALID_STATE  storage not mounted, or the path is on a mount
+ *                          point whose backend is down (card removed)
+ * - ESP_ERR_INVALID_ARG    NULL or out-of-range argument
+ * - ESP_ERR_NOT_FOUND      file or directory does not exist (or, for line
+ *                          reads, the file has fewer lines)
+ * - ESP_ERR_NO_MEM         out of memory
+ * - ESP_FAIL               I/O error from the backend
+ *
+ * Line reads share one numbering: lines end with '\n', a last line without
+ * one also counts, numbers start at 1, and a line longer than
+ * VFS_LINEINDEX_LINE_MAX - 1 chars is cut, never split over two lines.
+ */
+
+#ifndef STORAGE_H
+#define STORAGE_H
+
+#include "storage_init.h"
+#include "storage_info.h"
+#include "storage_file.h"
+#include "storage_dir.h"
+#include "storage_read.h"
+#include "storage_write.h"
+
+#endif // STORAGE_H
@@ -37,6 +37,29 @@ extern "C" {
  */
 typedef void (*storage_dir_callback_t)(const char *name, bool is_dir, void *user_data);
 
+/**
+ * @brief Listing order
+ */
+typedef enum {
+    STORAGE_SORT_NONE = 0,          // Filesystem order
+    STORAGE_SORT_NAME,              // Case-insensitive
+    STORAGE_SORT_SIZE,
+    STORAGE_SORT_MTIME,
+} storage_sort_t;
+
+#define STORAGE_SORT_DESC           0x01    // Reverse order
+#define STORAGE_SORT_DIRS_FIRST     0x02    // Directories before files
+
+/**
+ * @brief Directory entry returned by storage_dir_list_page()
+ */
+typedef struct {
+    char name[64];
+    size_t size;
+    time_t modified_time;
+    bool is_directory;
+} storage_dir_entry_t;
+
 // Directory creation/removal
 esp_err_t storage_dir_create(const char *path);
 esp_err_t storage_dir_remove(const char *path);
@@ -50,7 +73,37 @@ esp_err_t storage_dir_is_empty(const char *path, bool *empty);
 esp_err_t storage_dir_list(const char *path, storage_dir_callback_t callback, void *user_data);
 esp_err_t storage_dir_count(const char *path, uint32_t *file_count, uint32_t *dir_count);
 
+/**
+ * @brief List a directory in the given order
+ *
+ * Listings are cached (see vfs_dirindex.h): listing the same directory
+ * again does not read the filesystem unless something in it changed.
+ */
+esp_err_t storage_dir_list_sorted(const char *path, storage_sort_t sort, int flags,
+                                  storage_dir_callback_t callback, void *user_data);
+
+/**
+ * @brief Read one page of a sorted directory listing
+ * @param offset Index of the first entry, in sorted order
+ * @param entries Output array with room for @p max entries
+ * @param count Entries stored
+ * @param total Entries in the directory (can be NULL)
+ */
+esp_err_t storage_dir_list_page(const char *path, storage_sort_t sort, int flags,
+                                size_t offset, storage_dir_entry_t *entries, size_t max,
+                                size_t *count, size_t *total);
+
 // Directory operations
+
+/**
+ * @brief Copy a directory tree, across mounts too (/sdcard/... to /littlefs/...)
+ *
+ * Existing files in @p dst are overwritten; up to 8 levels of subdirectories.
+ *
+ * @return ESP_OK, ESP_ERR_NOT_FOUND if @p src does not exist,
+ *         ESP_ERR_INVALID_ARG if @p dst is inside @p src,
+ *         ESP_ERR_INVALID_SIZE if a path gets too long or the tree too deep
+ */
 esp_err_t storage_dir_copy_recursive(const char *src, const char *dst);
 esp_err_t storage_dir_get_size(const char *path, uint64_t *total_size);
 
@@ -61,6 +61,11 @@ esp_err_t storage_read_binary(const char *path, void *buffer, size_t size, size_
 
 /* ============================================================================
  * LINE READ
+ *
+ * Line numbers, counts and ranges go through a line offset index (see
+ * vfs_lineindex.h): the file is scanned once, appended bytes are scanned
+ * when the file grows, and reading line K seeks close to it instead of
+ * reading every line before it. A last line without '\n' counts as a line.
  * ============================================================================ */
 
 /**
@@ -100,6 +105,10 @@ esp_err_t storage_read_last_line(const char *path, char *buffer, size_t buffer_s
 
 /**
  * @brief Process all lines with callback
+ *
+ * One call per line, numbered as storage_read_line() numbers them; a line
+ * longer than VFS_LINEINDEX_LINE_MAX - 1 chars is passed cut short.
+ *
  * @param path File path
  * @param callback Callback function
  * @param user_data User data
@@ -115,6 +124,29 @@ esp_err_t storage_read_lines(const char *path, storage_line_callback_t callback,
  */
 esp_err_t storage_count_lines(const char *path, uint32_t *line_count);
 
+/**
+ * @brief Process lines first_line .. first_line + count - 1
+ * @param path File path
+ * @param first_line First line (starts at 1)
+ * @param count Lines wanted (fewer are passed at the end of the file)
+ * @param callback Callback function
+ * @param user_data User data
+ * @return ESP_OK on success, ESP_ERR_NOT_FOUND if first_line is past the end
+ */
+esp_err_t storage_read_line_range(const char *path, uint32_t first_line, uint32_t count,
+                                  storage_line_callback_t callback, void *user_data);
+
+/**
+ * @brief Process the last lines of a file, oldest first
+ * @param path File path
+ * @param count Lines wanted
+ * @param callback Callback function
+ * @param user_data User data
+ * @return ESP_OK on success, ESP_ERR_NOT_FOUND if the file is empty
+ */
+esp_err_t storage_read_tail(const char *path, uint32_t count,
+                            storage_line_callback_t callback, void *user_data);
+
 /* ============================================================================
  * CHUNK READ
  * ============================================================================ */
@@ -192,6 +192,33 @@ esp_err_t storage_write_csv_row(const char *path, const char **columns, size_t n
  */
 esp_err_t storage_append_csv_row(const char *path, const char **columns, size_t num_columns);
 
+/* ============================================================================
+ * WRITE-BACK
+ * ============================================================================ */
+
+/*
+ * When the write-back service runs (VFS_USE_WRITEBACK or vfs_writeback_start()),
+ * the storage_append_* functions return as soon as the data is queued in RAM
+ * and a background task writes it in large chunks. Overwriting, deleting,
+ * renaming or truncating a file through this API writes its queued appends
+ * first. Without the service both functions below return ESP_OK at once.
+ */
+
+/**
+ * @brief Write out the appends still queued for a file
+ * @param path File path, NULL for every file
+ * @return ESP_OK on success, ESP_FAIL if a queued write failed
+ * @note Call before reading a file that is being appended to
+ */
+esp_err_t storage_flush(const char *path);
+
+/**
+ * @brief Flush, then commit the file so it survives a reset
+ * @param path File path, NULL for every file
+ * @return ESP_OK on success
+ */
+esp_err_t storage_sync(const char *path);
+
 #ifdef __cplusplus
 }
 #endif
@@ -21,29 +21,88 @@
 #include "storage_dir.h"
 #include "storage_info.h"
 #include "storage_init.h"
+#include "storage_internal.h"
 #include "vfs_config.h"
 #include "vfs_core.h"
+#include "vfs_writeback.h"
+#include "vfs_dirindex.h"
+#include "vfs_lineindex.h"
 #include "esp_log.h"
+#include <stdio.h>
 #include <string.h>
 #include <inttypes.h>
 
 static const char *TAG = "storage";
 
+#define COPY_MAX_DEPTH  8   // Subdirectory levels copied by storage_dir_copy_recursive
+
 /* ============================================================================
- * HELPER: Resolve Path
+ * HELPERS (shared with storage_read.c and storage_write.c)
  * ============================================================================ */
 
-static void resolve_path(const char *path, char *full_path, size_t size)
+// Mount points of the enabled backends, mounted or not
+static const char *const s_mount_points[] = {
+#ifdef VFS_USE_LITTLEFS
+    VFS_LITTLEFS_MOUNT_POINT,
+#endif
+#ifdef VFS_USE_SPIFFS
+    VFS_SPIFFS_MOUNT_POINT,
+#endif
+#ifdef VFS_USE_SD_CARD
+    VFS_SD_MOUNT_POINT,
+#endif
+#ifdef VFS_USE_RAMFS
+    VFS_RAMFS_MOUNT_POINT,
+#endif
+};
+
+static bool on_mount_point(const char *path, const char *mount_point)
 {
-    if (strncmp(path, VFS_MOUNT_POINT, strlen(VFS_MOUNT_POINT)) == 0) {
-        snprintf(full_path, size, "%s", path);
-    } else if (path[0] == '/') {
-        snprintf(full_path, size, "%s%s", VFS_MOUNT_POINT, path);
-    } else {
+    size_t len = strlen(mount_point);
+    return strncmp(path, mount_point, len) == 0 && (path[len] == '\0' || path[len] == '/');
+}
+
+bool storage_resolve_path(const char *path, char *full_path, size_t size)
+{
+    if (path[0] != '/') {
         snprintf(full_path, size, "%s/%s", VFS_MOUNT_POINT, path);
+        return true;
+    }
+
+    // Already on a mount (/littlefs/..., /sdcard/..., /ram/...)
+    if (vfs_get_backend(path)) {
+        snprintf(full_path, size, "%s", path);
+        return true;
+    }
+
+    // A backend's mount point while it is down: the file is not on the
+    // primary mount, so don't quietly put it there
+    for (size_t i = 0; i < sizeof(s_mount_points) / sizeof(s_mount_points[0]); i++) {
+        if (on_mount_point(path, s_mount_points[i])) {
+            ESP_LOGW(TAG, "%s is not mounted", s_mount_points[i]);
+            return false;
+        }
+    }
+
+    snprintf(full_path, size, "%s%s", VFS_MOUNT_POINT, path);
+    return true;
+}
+
+void storage_flush_pending(const char *full_path)
+{
+    if (vfs_writeback_is_running()) {
+        vfs_writeback_flush(full_path, UINT32_MAX);
     }
 }
 
+esp_err_t storage_status(esp_err_t ret, const char *full_path)
+{
+    if (ret == ESP_FAIL && !vfs_exists(full_path)) {
+        return ESP_ERR_NOT_FOUND;
+    }
+    return ret;
+}
+
 /* ============================================================================
  * FILE OPERATIONS
  * ============================================================================ */
@@ -52,8 +111,9 @@ bool storage_file_exists(const char *path)
 {
     if (!storage_is_mounted() || !path) return false;
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) return false;
+    storage_flush_pending(full_path);
     return vfs_exists(full_path);
 }
 
@@ -71,17 +131,24 @@ esp_err_t storage_file_is_empty(const char *path, bool *empty)
 
 esp_err_t storage_file_get_info(const char *path, storage_file_info_t *info)
 {
-    if (!storage_is_mounted() || !path || !info) {
+    if (!storage_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (!path || !info) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    storage_flush_pending(full_path);
     
     vfs_stat_t st;
     esp_err_t ret = vfs_stat(full_path, &st);
     if (ret != ESP_OK) {
-        return ret;
+        return storage_status(ret, full_path);
     }
     
     strncpy(info->path, full_path, sizeof(info->path) - 1);
@@ -97,11 +164,20 @@ esp_err_t storage_file_get_info(const char *path, storage_file_info_t *info)
 
 esp_err_t storage_file_get_size(const char *path, size_t *size)
 {
-    if (!size) return ESP_ERR_INVALID_ARG;
+    if (!storage_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
-    return vfs_get_size(full_path, size);
+    if (!path || !size) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    storage_flush_pending(full_path);
+    return storage_status(vfs_get_size(full_path, size), full_path);
 }
 
 esp_err_t storage_file_get_extension(const char *path, char *ext, size_t size)
@@ -123,68 +199,129 @@ esp_err_t storage_file_get_extension(const char *path, char *ext, size_t size)
 
 esp_err_t storage_file_delete(const char *path)
 {
-    if (!storage_is_mounted() || !path) {
+    if (!storage_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (!path) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
     
+    vfs_writeback_close(full_path);     // Nothing queued may land after the delete
+    vfs_lineindex_forget(full_path);
     esp_err_t ret = vfs_unlink(full_path);
     if (ret == ESP_OK) {
         ESP_LOGI(TAG, "File deleted: %s", full_path);
     }
-    return ret;
+    return storage_status(ret, full_path);
 }
 
 esp_err_t storage_file_rename(const char *old_path, const char *new_path)
 {
-    if (!storage_is_mounted() || !old_path || !new_path) {
+    if (!storage_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (!old_path || !new_path) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    char old_full[256], new_full[256];
-    resolve_path(old_path, old_full, sizeof(old_full));
-    resolve_path(new_path, new_full, sizeof(new_full));
+    char old_full[STORAGE_PATH_MAX], new_full[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(old_path, old_full, sizeof(old_full))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!storage_resolve_path(new_path, new_full, sizeof(new_full))) {
+        return ESP_ERR_INVALID_STATE;
+    }
     
+    vfs_writeback_close(old_full);
+    vfs_writeback_close(new_full);
+    vfs_lineindex_forget(old_full);
+    vfs_lineindex_forget(new_full);
     esp_err_t ret = vfs_rename(old_full, new_full);
     if (ret == ESP_OK) {
         ESP_LOGI(TAG, "Renamed: %s -> %s", old_full, new_full);
     }
-    return ret;
+    return storage_status(ret, old_full);
 }
 
 esp_err_t storage_file_copy(const char *src, const char *dst)
 {
-    if (!storage_is_mounted() || !src || !dst) {
+    if (!storage_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (!src || !dst) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    char src_full[256], dst_full[256];
-    resolve_path(src, src_full, sizeof(src_full));
-    resolve_path(dst, dst_full, sizeof(dst_full));
+    char src_full[STORAGE_PATH_MAX], dst_full[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(src, src_full, sizeof(src_full))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!storage_resolve_path(dst, dst_full, sizeof(dst_full))) {
+        return ESP_ERR_INVALID_STATE;
+    }
     
+    vfs_writeback_flush(src_full, UINT32_MAX);
+    vfs_writeback_close(dst_full);
     esp_err_t ret = vfs_copy_file(src_full, dst_full);
     if (ret == ESP_OK) {
         ESP_LOGI(TAG, "Copied: %s -> %s", src_full, dst_full);
     }
-    return ret;
+    return storage_status(ret, src_full);
 }
 
 esp_err_t storage_file_move(const char *src, const char *dst)
 {
-    return storage_file_rename(src, dst);
+    if (!storage_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (!src || !dst) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    char src_full[STORAGE_PATH_MAX], dst_full[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(src, src_full, sizeof(src_full))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!storage_resolve_path(dst, dst_full, sizeof(dst_full))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    vfs_writeback_close(src_full);
+    vfs_writeback_close(dst_full);
+    vfs_lineindex_forget(src_full);
+    vfs_lineindex_forget(dst_full);
+    esp_err_t ret = vfs_move_file(src_full, dst_full);
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "Moved: %s -> %s", src_full, dst_full);
+    }
+    return storage_status(ret, src_full);
 }
 
 esp_err_t storage_file_truncate(const char *path, size_t size)
 {
-    if (!storage_is_mounted() || !path) {
+    if (!storage_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (!path) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
-    return vfs_truncate(full_path, size);
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    vfs_writeback_close(full_path);
+    return storage_status(vfs_truncate(full_path, size), full_path);
 }
 
 esp_err_t storage_file_clear(const char *path)
@@ -198,16 +335,23 @@ esp_err_t storage_file_compare(const char *path1, const char *path2, bool *equal
     *equal = false;
     
     size_t s1, s2;
-    if (storage_file_get_size(path1, &s1) != ESP_OK ||
-        storage_file_get_size(path2, &s2) != ESP_OK) {
-        return ESP_FAIL;
+    esp_err_t ret = storage_file_get_size(path1, &s1);
+    if (ret == ESP_OK) {
+        ret = storage_file_get_size(path2, &s2);
+    }
+    if (ret != ESP_OK) {
+        return ret;
     }
     
     if (s1 != s2) return ESP_OK;
     
-    char full1[256], full2[256];
-    resolve_path(path1, full1, sizeof(full1));
-    resolve_path(path2, full2, sizeof(full2));
+    char full1[STORAGE_PATH_MAX], full2[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path1, full1, sizeof(full1))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!storage_resolve_path(path2, full2, sizeof(full2))) {
+        return ESP_ERR_INVALID_STATE;
+    }
     
     vfs_fd_t fd1 = vfs_open(full1, VFS_O_RDONLY, 0);
     vfs_fd_t fd2 = vfs_open(full2, VFS_O_RDONLY, 0);
@@ -244,12 +388,18 @@ esp_err_t storage_file_compare(const char *path1, const char *path2, bool *equal
 
 esp_err_t storage_dir_create(const char *path)
 {
-    if (!storage_is_mounted() || !path) {
+    if (!storage_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (!path) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
     
     esp_err_t ret = vfs_mkdir(full_path, 0755);
     if (ret == ESP_OK) {
@@ -260,24 +410,36 @@ esp_err_t storage_dir_create(const char *path)
 
 esp_err_t storage_dir_remove(const char *path)
 {
-    if (!storage_is_mounted() || !path) {
+    if (!storage_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (!path) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
-    return vfs_rmdir(full_path);
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    return storage_status(vfs_rmdir(full_path), full_path);
 }
 
 esp_err_t storage_dir_remove_recursive(const char *path)
 {
-    if (!storage_is_mounted() || !path) {
+    if (!storage_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (!path) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
-    return vfs_rmdir_recursive(full_path);
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    return storage_status(vfs_rmdir_recursive(full_path), full_path);
 }
 
 bool storage_dir_exists(const char *path)
@@ -303,67 +465,254 @@ esp_err_t storage_dir_is_empty(const char *path, bool *empty)
 
 esp_err_t storage_dir_list(const char *path, storage_dir_callback_t callback, void *user_data)
 {
-    if (!storage_is_mounted() || !path || !callback) {
+    if (!storage_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (!path || !callback) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
     
+    // Filesystem order needs no index: one pass straight from the backend
     vfs_dir_t dir = vfs_opendir(full_path);
     if (!dir) {
-        return ESP_FAIL;
+        return storage_status(ESP_FAIL, full_path);
     }
     
     vfs_stat_t entry;
     while (vfs_readdir(dir, &entry) == ESP_OK) {
-        callback(entry.name, (entry.type == VFS_TYPE_DIR), user_data);
+        if (!vfs_lineindex_is_sidecar(entry.name)) {
+            callback(entry.name, (entry.type == VFS_TYPE_DIR), user_data);
+        }
     }
     
     vfs_closedir(dir);
     return ESP_OK;
 }
 
+esp_err_t storage_dir_list_sorted(const char *path, storage_sort_t sort, int flags,
+                                  storage_dir_callback_t callback, void *user_data)
+{
+    if (sort == STORAGE_SORT_NONE && flags == 0) {
+        return storage_dir_list(path, callback, user_data);
+    }
+    if (!storage_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (!path || !callback) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    // A few entries at a time from the directory index; no lock is held
+    // while the callback runs
+    vfs_stat_t page[8];
+    size_t offset = 0, count = 0, total = 0;
+    
+    do {
+        esp_err_t ret = vfs_dirindex_list(full_path, (vfs_dirindex_sort_t)sort, flags,
+                                          offset, page, 8, &count, &total);
+        if (ret != ESP_OK) {
+            return storage_status(ret, full_path);
+        }
+        for (size_t i = 0; i < count; i++) {
+            callback(page[i].name, (page[i].type == VFS_TYPE_DIR), user_data);
+        }
+        offset += count;
+    } while (count > 0 && offset < total);
+    
+    return ESP_OK;
+}
+
+esp_err_t storage_dir_list_page(const char *path, storage_sort_t sort, int flags,
+                                size_t offset, storage_dir_entry_t *entries, size_t max,
+                                size_t *count, size_t *total)
+{
+    if (!storage_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (!path || !entries || !count) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    *count = 0;
+    vfs_stat_t page[8];
+    
+    // The caller's array is filled in steps of the local page
+    while (*count < max) {
+        size_t want = max - *count;
+        size_t got = 0, all = 0;
+        
+        esp_err_t ret = vfs_dirindex_list(full_path, (vfs_dirindex_sort_t)sort, flags,
+                                          offset + *count, page, (want < 8) ? want : 8,
+                                          &got, &all);
+        if (ret != ESP_OK) {
+            return storage_status(ret, full_path);
+        }
+        if (total) {
+            *total = all;
+        }
+        
+        for (size_t i = 0; i < got; i++) {
+            storage_dir_entry_t *e = &entries[*count + i];
+            strncpy(e->name, page[i].name, sizeof(e->name) - 1);
+            e->name[sizeof(e->name) - 1] = '\0';
+            e->size = page[i].size;
+            e->modified_time = page[i].mtime;
+            e->is_directory = (page[i].type == VFS_TYPE_DIR);
+        }
+        *count += got;
+        
+        if (got == 0 || offset + *count >= all) {
+            break;
+        }
+    }
+    return ESP_OK;
+}
+
 esp_err_t storage_dir_count(const char *path, uint32_t *file_count, uint32_t *dir_count)
 {
-    if (!storage_is_mounted() || !path || !file_count || !dir_count) {
+    if (!storage_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (!path || !file_count || !dir_count) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    return storage_status(vfs_dirindex_count(full_path, file_count, dir_count), full_path);
+}
+
+// src and dst are STORAGE_PATH_MAX buffers shared by every level: each one
+// appends "/name" for the entry it handles and cuts it off again, so a level
+// costs one directory handle and one entry on the stack
+static esp_err_t copy_tree(char *src, char *dst, int depth)
+{
+    vfs_stat_t st;
+    if (vfs_stat(dst, &st) != ESP_OK) {
+        esp_err_t ret = vfs_mkdir(dst, 0755);
+        if (ret != ESP_OK) {
+            return ret;
+        }
+    } else if (st.type != VFS_TYPE_DIR) {
+        return ESP_ERR_INVALID_STATE;
+    }
     
-    vfs_dir_t dir = vfs_opendir(full_path);
+    vfs_dir_t dir = vfs_opendir(src);
     if (!dir) {
-        return ESP_FAIL;
+        return storage_status(ESP_FAIL, src);
     }
     
-    *file_count = 0;
-    *dir_count = 0;
-    
+    size_t src_len = strlen(src), dst_len = strlen(dst);
+    esp_err_t ret = ESP_OK;
     vfs_stat_t entry;
-    while (vfs_readdir(dir, &entry) == ESP_OK) {
+    
+    while (ret == ESP_OK && vfs_readdir(dir, &entry) == ESP_OK) {
+        size_t name_len = strlen(entry.name);
+        if (src_len + name_len + 2 > STORAGE_PATH_MAX ||
+            dst_len + name_len + 2 > STORAGE_PATH_MAX) {
+            ret = ESP_ERR_INVALID_SIZE;
+            break;
+        }
+        snprintf(src + src_len, STORAGE_PATH_MAX - src_len, "/%s", entry.name);
+        snprintf(dst + dst_len, STORAGE_PATH_MAX - dst_len, "/%s", entry.name);
+        
         if (entry.type == VFS_TYPE_DIR) {
-            (*dir_count)++;
+            ret = (depth < COPY_MAX_DEPTH) ? copy_tree(src, dst, depth + 1) : ESP_ERR_INVALID_SIZE;
         } else {
-            (*file_count)++;
+            vfs_writeback_flush(src, UINT32_MAX);
+            vfs_writeback_close(dst);
+            ret = vfs_copy_file(src, dst);
         }
+        
+        src[src_len] = '\0';
+        dst[dst_len] = '\0';
     }
     
     vfs_closedir(dir);
-    return ESP_OK;
+    return ret;
 }
 
 esp_err_t storage_dir_copy_recursive(const char *src, const char *dst)
 {
-    ESP_LOGW(TAG, "storage_dir_copy_recursive not fully implemented");
-    return ESP_ERR_NOT_SUPPORTED;
+    if (!storage_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (!src || !dst) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    char src_full[STORAGE_PATH_MAX], dst_full[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(src, src_full, sizeof(src_full))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (!storage_resolve_path(dst, dst_full, sizeof(dst_full))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    // A copy into its own subtree would keep finding what it just created
+    size_t src_len = strlen(src_full);
+    if (strncmp(dst_full, src_full, src_len) == 0 &&
+        (dst_full[src_len] == '/' || dst_full[src_len] == '\0')) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    vfs_stat_t st;
+    esp_err_t ret = vfs_stat(src_full, &st);
+    if (ret != ESP_OK) {
+        return storage_status(ret, src_full);
+    }
+    if (st.type != VFS_TYPE_DIR) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    ret = copy_tree(src_full, dst_full, 1);
+    if (ret == ESP_OK) {
+        ESP_LOGI(TAG, "Directory copied: %s -> %s", src_full, dst_full);
+    } else {
+        ESP_LOGE(TAG, "Directory copy failed: %s -> %s (%s)", src_full, dst_full, esp_err_to_name(ret));
+    }
+    return ret;
 }
 
 esp_err_t storage_dir_get_size(const char *path, uint64_t *total_size)
 {
-    ESP_LOGW(TAG, "storage_dir_get_size not fully implemented");
-    return ESP_ERR_NOT_SUPPORTED;
+    if (!storage_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    if (!path || !total_size) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    // Cached per directory until something under it changes
+    return storage_status(vfs_dirindex_tree_size(full_path, total_size, NULL), full_path);
 }
 
 /* ============================================================================
@@ -425,18 +774,21 @@ void storage_print_info_detailed(void)
 
 esp_err_t storage_get_free_space(uint64_t *free_bytes)
 {
+    if (!storage_is_mounted()) return ESP_ERR_INVALID_STATE;
     if (!free_bytes) return ESP_ERR_INVALID_ARG;
     return vfs_get_free_space(VFS_MOUNT_POINT, free_bytes);
 }
 
 esp_err_t storage_get_total_space(uint64_t *total_bytes)
 {
+    if (!storage_is_mounted()) return ESP_ERR_INVALID_STATE;
     if (!total_bytes) return ESP_ERR_INVALID_ARG;
     return vfs_get_total_space(VFS_MOUNT_POINT, total_bytes);
 }
 
 esp_err_t storage_get_used_space(uint64_t *used_bytes)
 {
+    if (!storage_is_mounted()) return ESP_ERR_INVALID_STATE;
     if (!used_bytes) return ESP_ERR_INVALID_ARG;
     
     vfs_statvfs_t stat;
@@ -449,6 +801,7 @@ esp_err_t storage_get_used_space(uint64_t *used_bytes)
 
 esp_err_t storage_get_usage_percent(float *percentage)
 {
+    if (!storage_is_mounted()) return ESP_ERR_INVALID_STATE;
     if (!percentage) return ESP_ERR_INVALID_ARG;
     return vfs_get_usage_percent(VFS_MOUNT_POINT, percentage);
 }
@@ -15,8 +15,18 @@
 #include "storage_init.h"
 #include "vfs_config.h"
 #include "vfs_core.h"
+#include "vfs_writeback.h"
+#include "vfs_assets.h"
 #include "esp_log.h"
 
+#if defined(VFS_USE_SD_CARD) && VFS_SD_POLL_MS > 0
+#include "vfs_sdcard.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#define STORAGE_SD_POLL
+#endif
+
 static const char *TAG = "storage";
 
 extern esp_err_t vfs_init_auto(void);
@@ -26,6 +36,57 @@ extern void vfs_print_info(void);
 
 static bool s_initialized = false;
 
+#ifdef STORAGE_SD_POLL
+#define SD_POLL_TASK_STACK  3072
+#define SD_POLL_TASK_PRIO   2
+
+static TaskHandle_t s_sd_poll_task = NULL;
+static SemaphoreHandle_t s_sd_poll_exit = NULL;
+static volatile bool s_sd_poll_stop = false;
+
+// The slot has no card-detect line: ask the card every VFS_SD_POLL_MS so a
+// pulled card is unmounted before writes meant for it go anywhere else
+static void sd_poll_task(void *arg)
+{
+    while (!s_sd_poll_stop) {
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(VFS_SD_POLL_MS));
+        if (!s_sd_poll_stop && vfs_sdcard_is_mounted()) {
+            vfs_sdcard_check();
+        }
+    }
+    xSemaphoreGive(s_sd_poll_exit);
+    vTaskDelete(NULL);
+}
+
+static void sd_poll_start(void)
+{
+    if (!s_sd_poll_exit) {
+        s_sd_poll_exit = xSemaphoreCreateBinary();
+        if (!s_sd_poll_exit) {
+            ESP_LOGW(TAG, "SD card poll unavailable, hot-unplug goes unnoticed");
+            return;
+        }
+    }
+    s_sd_poll_stop = false;
+    if (xTaskCreate(sd_poll_task, "sd_poll", SD_POLL_TASK_STACK, NULL,
+                    SD_POLL_TASK_PRIO, &s_sd_poll_task) != pdPASS) {
+        s_sd_poll_task = NULL;
+        ESP_LOGW(TAG, "SD card poll unavailable, hot-unplug goes unnoticed");
+    }
+}
+
+static void sd_poll_stop(void)
+{
+    if (!s_sd_poll_task) {
+        return;
+    }
+    s_sd_poll_stop = true;
+    xTaskNotifyGive(s_sd_poll_task);
+    xSemaphoreTake(s_sd_poll_exit, portMAX_DELAY);
+    s_sd_poll_task = NULL;
+}
+#endif
+
 esp_err_t storage_init(void)
 {
     if (s_initialized) {
@@ -39,6 +100,20 @@ esp_err_t storage_init(void)
     if (ret == ESP_OK) {
         s_initialized = true;
         ESP_LOGI(TAG, "Storage ready at %s", VFS_MOUNT_POINT);
+#ifdef VFS_USE_WRITEBACK
+        if (vfs_writeback_start(NULL) != ESP_OK) {
+            ESP_LOGW(TAG, "Write-back unavailable, appends go straight to the backend");
+        }
+#endif
+#ifdef STORAGE_SD_POLL
+        sd_poll_start();
+#endif
+#ifdef VFS_USE_ASSETS
+        // Stays mapped across storage_deinit(): pointers handed out remain valid
+        if (!vfs_assets_is_mounted() && vfs_assets_mount(NULL) != ESP_OK) {
+            ESP_LOGW(TAG, "Asset partition unavailable");
+        }
+#endif
     } else {
         ESP_LOGE(TAG, "Initialization failed: %s", esp_err_to_name(ret));
     }
@@ -60,10 +135,22 @@ esp_err_t storage_deinit(void)
     
     ESP_LOGI(TAG, "Deinitializing storage");
     
+    if (vfs_writeback_is_running()) {
+        vfs_writeback_stop();
+    }
+#ifdef STORAGE_SD_POLL
+    sd_poll_stop();
+#endif
+    
     esp_err_t ret = vfs_deinit_auto();
     if (ret == ESP_OK) {
         s_initialized = false;
     }
+#ifdef STORAGE_SD_POLL
+    else {
+        sd_poll_start();
+    }
+#endif
     
     return ret;
 }
@@ -0,0 +1,56 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file storage_internal.h
+ * @brief Helpers shared by the storage API sources (not a public header)
+ */
+
+#ifndef STORAGE_INTERNAL_H
+#define STORAGE_INTERNAL_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+#define STORAGE_PATH_MAX    256
+
+/**
+ * @brief Turn a storage API path into a VFS path
+ *
+ * Paths already on a mount (/littlefs/..., /sdcard/..., /ram/...) are kept;
+ * anything else is taken relative to the primary mount point.
+ *
+ * @return false if @p path names a configured mount point that is not
+ *         mounted right now (card pulled): callers fail with
+ *         ESP_ERR_INVALID_STATE instead of landing on the primary mount
+ */
+bool storage_resolve_path(const char *path, char *full_path, size_t size);
+
+/**
+ * @brief Map a VFS result to the storage API error contract (see storage.h)
+ *
+ * The backends report a missing file as a plain ESP_FAIL; this tells it
+ * apart from an I/O error by checking whether @p full_path exists.
+ */
+esp_err_t storage_status(esp_err_t ret, const char *full_path);
+
+/**
+ * @brief Write the appends still queued for @p full_path (write-back service)
+ *
+ * Called before every read, so a read sees all appends made before it.
+ */
+void storage_flush_pending(const char *full_path);
+
+#endif // STORAGE_INTERNAL_H
@@ -19,24 +19,43 @@
 
 #include "storage_read.h"
 #include "storage_init.h"
+#include "storage_internal.h"
 #include "vfs_config.h"
 #include "vfs_core.h"
+#include "vfs_stream.h"
+#include "vfs_lineindex.h"
 #include "esp_log.h"
 #include <string.h>
 #include <stdlib.h>
 
 static const char *TAG = "storage_read";
-#define MAX_LINE_LEN 512
+#define MAX_LINE_LEN VFS_LINEINDEX_LINE_MAX
 
-static void resolve_path(const char *path, char *full_path, size_t size)
+// Like vfs_stream_gets(), but the part of a line that does not fit is
+// skipped instead of being returned by the next call
+static ssize_t read_whole_line(vfs_stream_t *s, char *buf, size_t size)
 {
-    if (strncmp(path, VFS_MOUNT_POINT, strlen(VFS_MOUNT_POINT)) == 0) {
-        snprintf(full_path, size, "%s", path);
-    } else if (path[0] == '/') {
-        snprintf(full_path, size, "%s%s", VFS_MOUNT_POINT, path);
-    } else {
-        snprintf(full_path, size, "%s/%s", VFS_MOUNT_POINT, path);
+    size_t stored = 0;
+    bool any = false;
+    const uint8_t *data;
+    ssize_t len;
+    
+    while ((len = vfs_stream_peek(s, &data)) > 0) {
+        any = true;
+        const uint8_t *hit = memchr(data, '\n', len);
+        size_t n = hit ? (size_t)(hit - data) : (size_t)len;
+        
+        if (stored < size - 1) {
+            size_t copy = (n < size - 1 - stored) ? n : size - 1 - stored;
+            memcpy(&buf[stored], data, copy);
+            stored += copy;
+        }
+        vfs_stream_consume(s, hit ? n + 1 : n);
+        if (hit) break;
     }
+    
+    buf[stored] = '\0';
+    return any ? (ssize_t)stored : -1;
 }
 
 /* ============================================================================
@@ -54,8 +73,11 @@ esp_err_t storage_read_string(const char *path, char *buffer, size_t buffer_size
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    storage_flush_pending(full_path);
     
     size_t bytes_read;
     esp_err_t ret = vfs_read_file(full_path, buffer, buffer_size - 1, &bytes_read);
@@ -67,7 +89,7 @@ esp_err_t storage_read_string(const char *path, char *buffer, size_t buffer_size
         ESP_LOGE(TAG, "Failed to read: %s", full_path);
     }
     
-    return ret;
+    return storage_status(ret, full_path);
 }
 
 /* ============================================================================
@@ -85,8 +107,11 @@ esp_err_t storage_read_binary(const char *path, void *buffer, size_t size, size_
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    storage_flush_pending(full_path);
     
     esp_err_t ret = vfs_read_file(full_path, buffer, size, bytes_read);
     
@@ -96,13 +121,46 @@ esp_err_t storage_read_binary(const char *path, void *buffer, size_t size, size_
         ESP_LOGE(TAG, "Failed to read binary: %s", full_path);
     }
     
-    return ret;
+    return storage_status(ret, full_path);
 }
 
 /* ============================================================================
  * LINE READ
  * ============================================================================ */
 
+typedef struct {
+    char *buffer;
+    size_t size;
+    bool found;
+} line_copy_t;
+
+static void copy_line(const char *line, uint32_t number, void *user_data)
+{
+    line_copy_t *copy = user_data;
+    strncpy(copy->buffer, line, copy->size - 1);
+    copy->buffer[copy->size - 1] = '\0';
+    copy->found = true;
+}
+
+// Keeps the last non-empty line of a range
+static void copy_non_empty(const char *line, uint32_t number, void *user_data)
+{
+    if (line[0] != '\0') {
+        copy_line(line, number, user_data);
+    }
+}
+
+typedef struct {
+    storage_line_callback_t callback;
+    void *user_data;
+} line_forward_t;
+
+static void forward_line(const char *line, uint32_t number, void *user_data)
+{
+    line_forward_t *fwd = user_data;
+    fwd->callback(line, fwd->user_data);
+}
+
 esp_err_t storage_read_line(const char *path, char *buffer, size_t buffer_size, uint32_t line_number)
 {
     if (!storage_is_mounted()) {
@@ -113,41 +171,19 @@ esp_err_t storage_read_line(const char *path, char *buffer, size_t buffer_size,
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
-    
-    vfs_fd_t fd = vfs_open(full_path, VFS_O_RDONLY, 0);
-    if (fd == VFS_INVALID_FD) {
-        ESP_LOGE(TAG, "Failed to open: %s", full_path);
-        return ESP_FAIL;
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
     }
+    storage_flush_pending(full_path);
     
-    uint32_t current_line = 0;
-    char line_buf[MAX_LINE_LEN];
-    size_t pos = 0;
-    char c;
-    esp_err_t ret = ESP_ERR_NOT_FOUND;
-    
-    while (vfs_read(fd, &c, 1) == 1) {
-        if (c == '\n' || pos >= MAX_LINE_LEN - 1) {
-            line_buf[pos] = '\0';
-            current_line++;
-            
-            if (current_line == line_number) {
-                strncpy(buffer, line_buf, buffer_size - 1);
-                buffer[buffer_size - 1] = '\0';
-                ret = ESP_OK;
-                break;
-            }
-            
-            pos = 0;
-        } else {
-            line_buf[pos++] = c;
-        }
+    // Seek through the line index instead of reading every line before it
+    line_copy_t copy = { .buffer = buffer, .size = buffer_size };
+    esp_err_t ret = vfs_lineindex_read(full_path, line_number, 1, copy_line, &copy);
+    if (ret == ESP_FAIL) {
+        ESP_LOGE(TAG, "Failed to read: %s", full_path);
     }
-    
-    vfs_close(fd);
-    return ret;
+    return storage_status(ret, full_path);
 }
 
 esp_err_t storage_read_first_line(const char *path, char *buffer, size_t buffer_size)
@@ -165,46 +201,73 @@ esp_err_t storage_read_last_line(const char *path, char *buffer, size_t buffer_s
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    storage_flush_pending(full_path);
     
-    vfs_fd_t fd = vfs_open(full_path, VFS_O_RDONLY, 0);
-    if (fd == VFS_INVALID_FD) {
-        return ESP_FAIL;
+    uint32_t total;
+    esp_err_t ret = vfs_lineindex_count(full_path, &total);
+    if (ret != ESP_OK) {
+        return storage_status(ret, full_path);
     }
     
-    char last_line[MAX_LINE_LEN] = {0};
-    char current_line[MAX_LINE_LEN];
-    size_t pos = 0;
-    char c;
-    
-    while (vfs_read(fd, &c, 1) == 1) {
-        if (c == '\n' || pos >= MAX_LINE_LEN - 1) {
-            current_line[pos] = '\0';
-            if (pos > 0) {
-                strncpy(last_line, current_line, sizeof(last_line) - 1);
-            }
-            pos = 0;
-        } else {
-            current_line[pos++] = c;
+    // Last non-empty line: walk back from the end a few lines at a time
+    line_copy_t copy = { .buffer = buffer, .size = buffer_size };
+    while (total > 0 && !copy.found) {
+        uint32_t first = (total > 8) ? total - 7 : 1;
+        ret = vfs_lineindex_read(full_path, first, total - first + 1, copy_non_empty, &copy);
+        if (ret != ESP_OK) {
+            return ret;
         }
+        total = first - 1;
     }
     
-    if (pos > 0) {
-        current_line[pos] = '\0';
-        strncpy(last_line, current_line, sizeof(last_line) - 1);
+    return copy.found ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+esp_err_t storage_read_line_range(const char *path, uint32_t first_line, uint32_t count,
+                                  storage_line_callback_t callback, void *user_data)
+{
+    if (!storage_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
     }
     
-    vfs_close(fd);
+    if (!path || !callback || first_line == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
     
-    if (last_line[0] == '\0') {
-        return ESP_ERR_NOT_FOUND;
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
     }
+    storage_flush_pending(full_path);
     
-    strncpy(buffer, last_line, buffer_size - 1);
-    buffer[buffer_size - 1] = '\0';
+    line_forward_t fwd = { .callback = callback, .user_data = user_data };
+    return storage_status(vfs_lineindex_read(full_path, first_line, count, forward_line, &fwd),
+                          full_path);
+}
+
+esp_err_t storage_read_tail(const char *path, uint32_t count,
+                            storage_line_callback_t callback, void *user_data)
+{
+    if (!storage_is_mounted()) {
+        return ESP_ERR_INVALID_STATE;
+    }
     
-    return ESP_OK;
+    if (!path || !callback) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    storage_flush_pending(full_path);
+    
+    line_forward_t fwd = { .callback = callback, .user_data = user_data };
+    return storage_status(vfs_lineindex_tail(full_path, count, forward_line, &fwd), full_path);
 }
 
 esp_err_t storage_read_lines(const char *path, storage_line_callback_t callback, void *user_data)
@@ -217,35 +280,28 @@ esp_err_t storage_read_lines(const char *path, storage_line_callback_t callback,
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    storage_flush_pending(full_path);
     
-    vfs_fd_t fd = vfs_open(full_path, VFS_O_RDONLY, 0);
-    if (fd == VFS_INVALID_FD) {
-        return ESP_FAIL;
+    vfs_stream_t stream;
+    if (vfs_stream_open(&stream, full_path) != ESP_OK) {
+        return storage_status(ESP_FAIL, full_path);
     }
     
     char line[MAX_LINE_LEN];
-    size_t pos = 0;
-    char c;
-    
-    while (vfs_read(fd, &c, 1) == 1) {
-        if (c == '\n' || pos >= MAX_LINE_LEN - 1) {
-            line[pos] = '\0';
-            callback(line, user_data);
-            pos = 0;
-        } else {
-            line[pos++] = c;
-        }
-    }
     
-    if (pos > 0) {
-        line[pos] = '\0';
+    // One callback per line, as numbered by storage_read_line(): a longer
+    // line is cut, not split over several calls
+    while (read_whole_line(&stream, line, sizeof(line)) >= 0) {
         callback(line, user_data);
     }
     
-    vfs_close(fd);
-    return ESP_OK;
+    esp_err_t ret = vfs_stream_error(&stream) ? ESP_FAIL : ESP_OK;
+    vfs_stream_close(&stream);
+    return ret;
 }
 
 esp_err_t storage_count_lines(const char *path, uint32_t *line_count)
@@ -258,25 +314,14 @@ esp_err_t storage_count_lines(const char *path, uint32_t *line_count)
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
-    
-    vfs_fd_t fd = vfs_open(full_path, VFS_O_RDONLY, 0);
-    if (fd == VFS_INVALID_FD) {
-        return ESP_FAIL;
-    }
-    
-    *line_count = 0;
-    char c;
-    
-    while (vfs_read(fd, &c, 1) == 1) {
-        if (c == '\n') {
-            (*line_count)++;
-        }
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
     }
+    storage_flush_pending(full_path);
     
-    vfs_close(fd);
-    return ESP_OK;
+    // Only the bytes appended since the last call are scanned
+    return storage_status(vfs_lineindex_count(full_path, line_count), full_path);
 }
 
 /* ============================================================================
@@ -293,12 +338,15 @@ esp_err_t storage_read_chunk(const char *path, size_t offset, void *buffer, size
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    storage_flush_pending(full_path);
     
     vfs_fd_t fd = vfs_open(full_path, VFS_O_RDONLY, 0);
     if (fd == VFS_INVALID_FD) {
-        return ESP_FAIL;
+        return storage_status(ESP_FAIL, full_path);
     }
     
     if (vfs_lseek(fd, offset, VFS_SEEK_SET) < 0) {
@@ -377,38 +425,34 @@ esp_err_t storage_file_contains(const char *path, const char *search, bool *foun
         return ESP_ERR_INVALID_STATE;
     }
     
-    if (!path || !search || !found) {
+    if (!path || !search || !search[0] || !found) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    storage_flush_pending(full_path);
     
-    vfs_fd_t fd = vfs_open(full_path, VFS_O_RDONLY, 0);
-    if (fd == VFS_INVALID_FD) {
-        return ESP_FAIL;
+    vfs_stream_t stream;
+    if (vfs_stream_open(&stream, full_path) != ESP_OK) {
+        return storage_status(ESP_FAIL, full_path);
     }
     
     *found = false;
     char line[MAX_LINE_LEN];
-    size_t pos = 0;
-    char c;
-    
-    while (vfs_read(fd, &c, 1) == 1) {
-        if (c == '\n' || pos >= MAX_LINE_LEN - 1) {
-            line[pos] = '\0';
-            if (strstr(line, search) != NULL) {
-                *found = true;
-                break;
-            }
-            pos = 0;
-        } else {
-            line[pos++] = c;
+    
+    while (vfs_stream_gets(&stream, line, sizeof(line)) >= 0) {
+        if (strstr(line, search) != NULL) {
+            *found = true;
+            break;
         }
     }
     
-    vfs_close(fd);
-    return ESP_OK;
+    esp_err_t ret = vfs_stream_error(&stream) ? ESP_FAIL : ESP_OK;
+    vfs_stream_close(&stream);
+    return ret;
 }
 
 esp_err_t storage_count_occurrences(const char *path, const char *search, uint32_t *count)
@@ -417,39 +461,34 @@ esp_err_t storage_count_occurrences(const char *path, const char *search, uint32
         return ESP_ERR_INVALID_STATE;
     }
     
-    if (!path || !search || !count) {
+    if (!path || !search || !search[0] || !count) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    storage_flush_pending(full_path);
     
-    vfs_fd_t fd = vfs_open(full_path, VFS_O_RDONLY, 0);
-    if (fd == VFS_INVALID_FD) {
-        return ESP_FAIL;
+    vfs_stream_t stream;
+    if (vfs_stream_open(&stream, full_path) != ESP_OK) {
+        return storage_status(ESP_FAIL, full_path);
     }
     
     *count = 0;
+    size_t search_len = strlen(search);
     char line[MAX_LINE_LEN];
-    size_t pos = 0;
-    char c;
-    
-    while (vfs_read(fd, &c, 1) == 1) {
-        if (c == '\n' || pos >= MAX_LINE_LEN - 1) {
-            line[pos] = '\0';
-            
-            char *p = line;
-            while ((p = strstr(p, search)) != NULL) {
-                (*count)++;
-                p += strlen(search);
-            }
-            
-            pos = 0;
-        } else {
-            line[pos++] = c;
+    
+    while (vfs_stream_gets(&stream, line, sizeof(line)) >= 0) {
+        const char *p = line;
+        while ((p = strstr(p, search)) != NULL) {
+            (*count)++;
+            p += search_len;
         }
     }
     
-    vfs_close(fd);
-    return ESP_OK;
+    esp_err_t ret = vfs_stream_error(&stream) ? ESP_FAIL : ESP_OK;
+    vfs_stream_close(&stream);
+    return ret;
 }
\ No newline at end of file
@@ -19,8 +19,10 @@
 
 #include "storage_write.h"
 #include "storage_init.h"
+#include "storage_internal.h"
 #include "vfs_config.h"
 #include "vfs_core.h"
+#include "vfs_writeback.h"
 #include "esp_log.h"
 #include <string.h>
 #include <stdarg.h>
@@ -29,15 +31,21 @@
 
 static const char *TAG = "storage_write";
 
-static void resolve_path(const char *path, char *full_path, size_t size)
+// Appends go through the write-back service when it is running. When it has
+// no stream free for this file nothing of it is queued, so writing directly
+// keeps the order; a record too big for its buffer is written after what
+// is still queued.
+static esp_err_t append_data(const char *full_path, const void *data, size_t size)
 {
-    if (strncmp(path, VFS_MOUNT_POINT, strlen(VFS_MOUNT_POINT)) == 0) {
-        snprintf(full_path, size, "%s", path);
-    } else if (path[0] == '/') {
-        snprintf(full_path, size, "%s%s", VFS_MOUNT_POINT, path);
-    } else {
-        snprintf(full_path, size, "%s/%s", VFS_MOUNT_POINT, path);
+    if (vfs_writeback_is_running()) {
+        esp_err_t ret = vfs_writeback_append(full_path, data, size, VFS_WRITEBACK_TIMEOUT_MS);
+        if (ret == ESP_ERR_INVALID_SIZE) {
+            vfs_writeback_close(full_path);
+        } else if (ret != ESP_ERR_NO_MEM) {
+            return ret;
+        }
     }
+    return vfs_append_file(full_path, data, size);
 }
 
 /* ============================================================================
@@ -55,10 +63,13 @@ esp_err_t storage_write_string(const char *path, const char *data)
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
     
     size_t len = strlen(data);
+    vfs_writeback_close(full_path);     // Queued appends land before the overwrite
     esp_err_t ret = vfs_write_file(full_path, data, len);
     
     if (ret == ESP_OK) {
@@ -81,14 +92,16 @@ esp_err_t storage_append_string(const char *path, const char *data)
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
     
     size_t len = strlen(data);
-    esp_err_t ret = vfs_append_file(full_path, data, len);
+    esp_err_t ret = append_data(full_path, data, len);
     
     if (ret == ESP_OK) {
-        ESP_LOGI(TAG, "String appended: %s (%zu bytes)", full_path, len);
+        ESP_LOGD(TAG, "String appended: %s (%zu bytes)", full_path, len);
     } else {
         ESP_LOGE(TAG, "Failed to append: %s", full_path);
     }
@@ -111,9 +124,12 @@ esp_err_t storage_write_binary(const char *path, const void *data, size_t size)
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
     
+    vfs_writeback_close(full_path);
     esp_err_t ret = vfs_write_file(full_path, data, size);
     
     if (ret == ESP_OK) {
@@ -136,13 +152,15 @@ esp_err_t storage_append_binary(const char *path, const void *data, size_t size)
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
     
-    esp_err_t ret = vfs_append_file(full_path, data, size);
+    esp_err_t ret = append_data(full_path, data, size);
     
     if (ret == ESP_OK) {
-        ESP_LOGI(TAG, "Binary appended: %s (%zu bytes)", full_path, size);
+        ESP_LOGD(TAG, "Binary appended: %s (%zu bytes)", full_path, size);
     } else {
         ESP_LOGE(TAG, "Failed to append binary: %s", full_path);
     }
@@ -192,9 +210,12 @@ esp_err_t storage_write_formatted(const char *path, const char *format, ...)
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
     
+    vfs_writeback_close(full_path);
     vfs_fd_t fd = vfs_open(full_path, VFS_O_WRONLY | VFS_O_CREAT | VFS_O_TRUNC, 0644);
     if (fd == VFS_INVALID_FD) {
         ESP_LOGE(TAG, "Failed to open: %s", full_path);
@@ -207,6 +228,14 @@ esp_err_t storage_write_formatted(const char *path, const char *format, ...)
     int len = vsnprintf(buffer, sizeof(buffer), format, args);
     va_end(args);
     
+    if (len < 0) {
+        vfs_close(fd);
+        return ESP_FAIL;
+    }
+    if ((size_t)len >= sizeof(buffer)) {
+        len = sizeof(buffer) - 1;
+    }
+    
     ssize_t written = vfs_write(fd, buffer, len);
     vfs_close(fd);
     
@@ -229,13 +258,9 @@ esp_err_t storage_append_formatted(const char *path, const char *format, ...)
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
-    
-    vfs_fd_t fd = vfs_open(full_path, VFS_O_WRONLY | VFS_O_CREAT | VFS_O_APPEND, 0644);
-    if (fd == VFS_INVALID_FD) {
-        ESP_LOGE(TAG, "Failed to open: %s", full_path);
-        return ESP_FAIL;
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
     }
     
     char buffer[512];
@@ -244,15 +269,20 @@ esp_err_t storage_append_formatted(const char *path, const char *format, ...)
     int len = vsnprintf(buffer, sizeof(buffer), format, args);
     va_end(args);
     
-    ssize_t written = vfs_write(fd, buffer, len);
-    vfs_close(fd);
+    if (len < 0) {
+        return ESP_FAIL;
+    }
+    if ((size_t)len >= sizeof(buffer)) {
+        len = sizeof(buffer) - 1;
+    }
     
-    if (written != len) {
+    esp_err_t ret = append_data(full_path, buffer, len);
+    if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Incomplete formatted append");
-        return ESP_FAIL;
+        return ret;
     }
     
-    ESP_LOGI(TAG, "Formatted appended: %s", full_path);
+    ESP_LOGD(TAG, "Formatted appended: %s", full_path);
     return ESP_OK;
 }
 
@@ -299,9 +329,12 @@ esp_err_t storage_write_csv_row(const char *path, const char **columns, size_t n
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
     
+    vfs_writeback_close(full_path);
     vfs_fd_t fd = vfs_open(full_path, VFS_O_WRONLY | VFS_O_CREAT | VFS_O_TRUNC, 0644);
     if (fd == VFS_INVALID_FD) {
         return ESP_FAIL;
@@ -330,9 +363,29 @@ esp_err_t storage_append_csv_row(const char *path, const char **columns, size_t
         return ESP_ERR_INVALID_ARG;
     }
     
-    char full_path[256];
-    resolve_path(path, full_path, sizeof(full_path));
+    char full_path[STORAGE_PATH_MAX];
+    if (!storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    // The row is assembled first so it is appended in one piece
+    char row[512];
+    size_t len = 0;
+    for (size_t i = 0; i < num_columns && len < sizeof(row); i++) {
+        len += snprintf(&row[len], sizeof(row) - len, "%s%c",
+                        columns[i], (i < num_columns - 1) ? ',' : '\n');
+    }
     
+    if (len < sizeof(row)) {
+        esp_err_t ret = append_data(full_path, row, len);
+        if (ret == ESP_OK) {
+            ESP_LOGD(TAG, "CSV appended: %s", full_path);
+        }
+        return ret;
+    }
+    
+    // Longer rows are written column by column
+    vfs_writeback_close(full_path);
     vfs_fd_t fd = vfs_open(full_path, VFS_O_WRONLY | VFS_O_CREAT | VFS_O_APPEND, 0644);
     if (fd == VFS_INVALID_FD) {
         return ESP_FAIL;
@@ -347,6 +400,40 @@ esp_err_t storage_append_csv_row(const char *path, const char **columns, size_t
     vfs_write(fd, "\n", 1);
     
     vfs_close(fd);
-    ESP_LOGI(TAG, "CSV appended: %s", full_path);
+    ESP_LOGD(TAG, "CSV appended: %s", full_path);
     return ESP_OK;
-}
\ No newline at end of file
+}
+
+/* ============================================================================
+ * WRITE-BACK
+ * ============================================================================ */
+
+esp_err_t storage_flush(const char *path)
+{
+    if (!vfs_writeback_is_running()) {
+        return ESP_OK;
+    }
+    
+    char full_path[STORAGE_PATH_MAX];
+    if (path && !storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    esp_err_t ret = vfs_writeback_flush(path ? full_path : NULL, UINT32_MAX);
+    return (ret == ESP_ERR_NOT_FOUND) ? ESP_OK : ret;
+}
+
+esp_err_t storage_sync(const char *path)
+{
+    if (!vfs_writeback_is_running()) {
+        return ESP_OK;
+    }
+    
+    char full_path[STORAGE_PATH_MAX];
+    if (path && !storage_resolve_path(path, full_path, sizeof(full_path))) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    esp_err_t ret = vfs_writeback_sync(path ? full_path : NULL, UINT32_MAX);
+    return (ret == ESP_ERR_NOT_FOUND) ? ESP_OK : ret;
+}
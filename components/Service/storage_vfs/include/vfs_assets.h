@@ -0,0 +1,129 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file vfs_assets.h
+ * @brief Read-only assets mapped straight from a flash partition
+ *
+ * Web pages, IR libraries, icon packs and other resources that never change
+ * at runtime can live in a dedicated data partition holding an image built
+ * by tools/asset_image.py. The image is mapped into the address space with
+ * esp_partition_mmap(), and a lookup by path returns a pointer to the file
+ * bytes in flash: no heap buffer, no copy, no file descriptor. Consumers
+ * parse or send the data in place.
+ *
+ * Partition table entry (any free data subtype, size to fit the image):
+ *
+ *     assets,  data, 0x40,  ,  1M
+ *
+ * Flashing the image:
+ *
+ *     tools/asset_image.py <dir> -o build/assets.bin
+ *     parttool.py write_partition --partition-name assets --input build/assets.bin
+ *
+ * Paths are the ones relative to the packed directory ("www/index.html");
+ * a leading '/' is ignored. Every file is 4-byte aligned and followed by a
+ * '\0' that is not counted in its size, so text assets can be used as C
+ * strings.
+ *
+ * The mapping is built once by vfs_assets_mount() and never changes until
+ * vfs_assets_unmount(), so lookups take no lock. Pointers stay valid until
+ * the unmount.
+ *
+ * The host tests (test/host) emulate esp_partition over a regular image
+ * file, so consumers can be exercised without hardware.
+ */
+
+#ifndef VFS_ASSETS_H
+#define VFS_ASSETS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "vfs_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** A file inside the asset image */
+typedef struct {
+    const char *path;           // Path inside the image (no leading '/')
+    const uint8_t *data;        // Mapped bytes, followed by '\0'
+    size_t size;
+} vfs_asset_t;
+
+/* ============================================================================
+ * MOUNT
+ * ============================================================================ */
+
+/**
+ * @brief Map the asset image and check its index
+ *
+ * @param source Partition label, NULL for VFS_ASSETS_PARTITION_LABEL
+ * @return ESP_OK,
+ *         ESP_ERR_INVALID_STATE if already mounted,
+ *         ESP_ERR_NOT_FOUND if the partition does not exist,
+ *         ESP_ERR_INVALID_VERSION if it holds no valid asset image,
+ *         ESP_FAIL if it cannot be mapped
+ */
+esp_err_t vfs_assets_mount(const char *source);
+
+/**
+ * @brief Release the mapping; every pointer handed out becomes invalid
+ * @return ESP_OK, ESP_ERR_INVALID_STATE if not mounted
+ */
+esp_err_t vfs_assets_unmount(void);
+
+bool vfs_assets_is_mounted(void);
+
+/* ============================================================================
+ * LOOKUP
+ * ============================================================================ */
+
+/**
+ * @brief Find a file by path (binary search over the sorted index)
+ * @return ESP_OK, ESP_ERR_NOT_FOUND,
+ *         ESP_ERR_INVALID_ARG for NULL arguments,
+ *         ESP_ERR_INVALID_STATE if not mounted
+ */
+esp_err_t vfs_asset_find(const char *path, vfs_asset_t *asset);
+
+/** @brief Number of files in the image (0 if not mounted) */
+uint32_t vfs_assets_count(void);
+
+/**
+ * @brief File at position @p index, in path order (for listings)
+ * @return ESP_OK, ESP_ERR_NOT_FOUND past the last file,
+ *         ESP_ERR_INVALID_ARG, ESP_ERR_INVALID_STATE
+ */
+esp_err_t vfs_asset_at(uint32_t index, vfs_asset_t *asset);
+
+/**
+ * @brief Bytes [offset, offset + len) of an asset, clamped to its end
+ *
+ * For consumers that walk a large asset piece by piece (chunked HTTP
+ * responses, parsers with a fixed window) without tracking pointers.
+ *
+ * @return Bytes available at *window (0 at or past the end)
+ */
+size_t vfs_asset_window(const vfs_asset_t *asset, size_t offset, size_t len,
+                        const uint8_t **window);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // VFS_ASSETS_H
@@ -0,0 +1,101 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file vfs_cache.h
+ * @brief Block cache between vfs_core and the backends
+ *
+ * Reads are served from fixed-size blocks (VFS_CACHE_BLOCK_SIZE) kept in a
+ * small LRU shared by every mount. Blocks belong to a file (by path), so all
+ * descriptors of the same file share them and survive close/reopen: on open
+ * the cached blocks are kept only if the backend fstat() still reports the
+ * same size and mtime.
+ *
+ * Each descriptor tracks its own position. When reads continue where the
+ * previous one stopped, a miss also fetches the following blocks in the same
+ * backend call, with a window that doubles up to VFS_CACHE_READAHEAD_MAX.
+ * Reads of several blocks at once skip the cache and go straight to the
+ * backend.
+ *
+ * Writes go through to the backend immediately (no dirty blocks) and drop
+ * the cached blocks they touch, plus the file's last block. Truncate, unlink
+ * and rename drop every block of the file. Changes made outside the VFS
+ * (plain fopen on the same mount) are only noticed on the next open.
+ *
+ * The cache has its own lock, held only while blocks and counters change,
+ * never across a backend call: a miss claims a slot, reads into it with the
+ * lock released and links it afterwards, and writes invalidate once the
+ * backend returns. A fill that overlapped a write of the same file serves
+ * its own read but is not linked. Descriptors on different files therefore
+ * never wait for each other's I/O. Calls on one descriptor must still be
+ * serialized by the caller (vfs_core holds the descriptor lock).
+ */
+
+#ifndef VFS_CACHE_H
+#define VFS_CACHE_H
+
+#include "vfs_core.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Per-descriptor cache state (embedded in the vfs_core fd table) */
+typedef struct {
+    const vfs_backend_ops_t *ops;
+    vfs_fd_t native_fd;
+    vfs_cache_stats_t *stats;
+    int node;               // Cached file, -1 = pass-through
+    int hint;               // Slot of the last block used (byte-by-byte reads)
+    off_t pos;              // Logical position, -1 = unknown (after O_APPEND write)
+    off_t native_pos;       // Backend position, -1 = unknown
+    off_t seq_next;         // Where a sequential read would continue
+    uint8_t window;         // Current readahead window in blocks
+    bool append;
+} vfs_cache_file_t;
+
+/** @brief Create the cache lock; until then every descriptor is pass-through */
+esp_err_t vfs_cache_init(void);
+
+/**
+ * @brief Start caching an open backend descriptor
+ * @param flags VFS_O_* flags used to open the file
+ * @param stats Counters of the mount that owns the file
+ * @param cacheable false = pass-through (VFS_BACKEND_FLAG_NO_CACHE)
+ */
+void vfs_cache_attach(vfs_cache_file_t *f, const char *path, const vfs_backend_ops_t *ops,
+                      vfs_fd_t native_fd, int flags, vfs_cache_stats_t *stats, bool cacheable);
+
+/** @brief Release the descriptor; the file's blocks stay cached */
+void vfs_cache_detach(vfs_cache_file_t *f);
+
+ssize_t vfs_cache_read(vfs_cache_file_t *f, void *buf, size_t size);
+ssize_t vfs_cache_write(vfs_cache_file_t *f, const void *buf, size_t size);
+off_t vfs_cache_lseek(vfs_cache_file_t *f, off_t offset, int whence);
+
+/** @brief Drop every cached block of a file (truncate, unlink, rename) */
+void vfs_cache_invalidate_path(const char *path, vfs_cache_stats_t *stats);
+
+/** @brief Forget every file under a mount point (backend unregistered) */
+void vfs_cache_forget_mount(const char *mount_point);
+
+/** @brief Consistent copy of a mount's counters (updated under the cache lock) */
+void vfs_cache_get_stats(const vfs_cache_stats_t *stats, vfs_cache_stats_t *out);
+void vfs_cache_reset_stats(vfs_cache_stats_t *stats);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // VFS_CACHE_H
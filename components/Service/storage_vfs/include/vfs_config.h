@@ -14,7 +14,7 @@
 
 /**
  * @file vfs_config.h
- * @brief VFS backend configuration (edit only one line)
+ * @brief VFS backend configuration
  */
 
 #ifndef VFS_CONFIG_H
@@ -25,63 +25,161 @@ extern "C" {
 #endif
 
 /* ============================================================================
- * SELECT YOUR BACKEND (uncomment only ONE line)
+ * SELECT YOUR BACKENDS (any combination, each one gets its own mount point)
+ *
+ * The first enabled line is the primary backend: relative paths of the
+ * storage API resolve against its mount point (VFS_MOUNT_POINT).
  * ============================================================================ */
 
-// #define VFS_USE_SD_CARD
-// #define VFS_USE_SPIFFS
 #define VFS_USE_LITTLEFS     // Active backend
+// #define VFS_USE_SPIFFS
+// #define VFS_USE_SD_CARD
 // #define VFS_USE_RAMFS
 
 /* ============================================================================
  * BACKEND CONFIGURATION
  * ============================================================================ */
 
-#ifdef VFS_USE_SD_CARD
-    #define VFS_MOUNT_POINT     "/sdcard"
-    #define VFS_MAX_FILES       10
-    #define VFS_FORMAT_ON_FAIL  false
-    #define VFS_BACKEND_NAME    "SD Card"
+#ifdef VFS_USE_LITTLEFS
+    #define VFS_LITTLEFS_MOUNT_POINT        "/littlefs"
+    #define VFS_LITTLEFS_MAX_FILES          10
+    #define VFS_LITTLEFS_FORMAT_ON_FAIL     true
+    #define VFS_LITTLEFS_PARTITION_LABEL    "storage"
 #endif
 
 #ifdef VFS_USE_SPIFFS
-    #define VFS_MOUNT_POINT     "/spiffs"
-    #define VFS_MAX_FILES       10
-    #define VFS_FORMAT_ON_FAIL  true
-    #define VFS_PARTITION_LABEL "storage"
-    #define VFS_BACKEND_NAME    "SPIFFS"
+    #define VFS_SPIFFS_MOUNT_POINT          "/spiffs"
+    #define VFS_SPIFFS_MAX_FILES            10
+    #define VFS_SPIFFS_FORMAT_ON_FAIL       true
+    #define VFS_SPIFFS_PARTITION_LABEL      "storage"   // Must differ from LittleFS if both are on
 #endif
 
-#ifdef VFS_USE_LITTLEFS
-    #define VFS_MOUNT_POINT     "/littlefs"
-    #define VFS_MAX_FILES       10
-    #define VFS_FORMAT_ON_FAIL  true
-    #define VFS_PARTITION_LABEL "storage"
-    #define VFS_BACKEND_NAME    "LittleFS"
+#ifdef VFS_USE_SD_CARD
+    #define VFS_SD_MOUNT_POINT              "/sdcard"
+    #define VFS_SD_MAX_FILES                10
+    #define VFS_SD_FORMAT_ON_FAIL           false
+    #ifndef VFS_SD_POLL_MS
+    #define VFS_SD_POLL_MS                  1000    // Hot-unplug check by the storage service, 0 = off
+    #endif
 #endif
 
 #ifdef VFS_USE_RAMFS
-    #define VFS_MOUNT_POINT     "/ram"
-    #define VFS_MAX_FILES       10
-    #define VFS_RAMFS_SIZE      (512 * 1024)  // 512KB
+    #define VFS_RAMFS_MOUNT_POINT           "/ram"
+    #define VFS_RAMFS_MAX_FILES             10
+    #define VFS_RAMFS_SIZE                  (512 * 1024)  // 512KB
+#endif
+
+/* ============================================================================
+ * PRIMARY BACKEND
+ * ============================================================================ */
+
+#if defined(VFS_USE_LITTLEFS)
+    #define VFS_MOUNT_POINT     VFS_LITTLEFS_MOUNT_POINT
+    #define VFS_MAX_FILES       VFS_LITTLEFS_MAX_FILES
+    #define VFS_BACKEND_NAME    "LittleFS"
+#elif defined(VFS_USE_SPIFFS)
+    #define VFS_MOUNT_POINT     VFS_SPIFFS_MOUNT_POINT
+    #define VFS_MAX_FILES       VFS_SPIFFS_MAX_FILES
+    #define VFS_BACKEND_NAME    "SPIFFS"
+#elif defined(VFS_USE_SD_CARD)
+    #define VFS_MOUNT_POINT     VFS_SD_MOUNT_POINT
+    #define VFS_MAX_FILES       VFS_SD_MAX_FILES
+    #define VFS_BACKEND_NAME    "SD Card"
+#elif defined(VFS_USE_RAMFS)
+    #define VFS_MOUNT_POINT     VFS_RAMFS_MOUNT_POINT
+    #define VFS_MAX_FILES       VFS_RAMFS_MAX_FILES
     #define VFS_BACKEND_NAME    "RAM Disk"
 #endif
 
+/* ============================================================================
+ * BLOCK CACHE (see vfs_cache.h)
+ * ============================================================================ */
+
+#ifndef VFS_CACHE_BLOCKS
+    #define VFS_CACHE_BLOCKS        16      // Shared by all mounts, 0 disables the cache
+#endif
+#define VFS_CACHE_BLOCK_SIZE        512     // Bytes per block (power of two)
+#define VFS_CACHE_READAHEAD_MAX     4       // Max blocks fetched ahead of a sequential read
+#define VFS_CACHE_FILES             8       // Files whose blocks can be cached at once
+
+/* ============================================================================
+ * WRITE-BACK APPENDS (see vfs_writeback.h)
+ * ============================================================================ */
+
+// #define VFS_USE_WRITEBACK                // storage_init() starts the write-back task
+
+#ifndef VFS_WRITEBACK_BUDGET
+    #define VFS_WRITEBACK_BUDGET    (16 * 1024)     // Bytes buffered for all files together
+#endif
+#define VFS_WRITEBACK_CHUNK         (4 * VFS_CACHE_BLOCK_SIZE)  // Bytes per backend write
+#define VFS_WRITEBACK_STREAMS       4       // Files kept open for appending
+#define VFS_WRITEBACK_FLUSH_MS      1000    // Partial chunks older than this are written
+#define VFS_WRITEBACK_IDLE_MS       5000    // Idle files are closed (and committed) after this
+#define VFS_WRITEBACK_TIMEOUT_MS    500     // Longest an append waits for buffer space
+
+/* ============================================================================
+ * DIRECTORY INDEX (see vfs_dirindex.h)
+ * ============================================================================ */
+
+#ifndef VFS_DIRINDEX_BUDGET
+    #define VFS_DIRINDEX_BUDGET     (16 * 1024)     // Bytes for cached listings, 0 disables caching
+#endif
+#define VFS_DIRINDEX_DIRS           4       // Directory listings kept at once
+#define VFS_DIRINDEX_TOTALS         4       // Recursive size totals kept at once
+#define VFS_DIRINDEX_MAX_ENTRIES    1024    // Entries read from one directory
+#define VFS_DIRINDEX_MAX_DEPTH      8       // Subdirectory levels counted by tree sizes
+
+/* ============================================================================
+ * LINE INDEX (see vfs_lineindex.h)
+ * ============================================================================ */
+
+#define VFS_LINEINDEX_FILES         2       // Text files indexed in RAM at once
+#define VFS_LINEINDEX_STRIDE        32      // Initial lines between two offsets kept
+#define VFS_LINEINDEX_MAX_MARKS     1024    // Offsets per file (4 bytes each); the stride doubles past it
+#ifndef VFS_LINEINDEX_SIDECAR_MIN
+    #define VFS_LINEINDEX_SIDECAR_MIN   (64 * 1024)     // Files this big keep their index in a sidecar, 0 = never
+#endif
+#define VFS_LINEINDEX_SIDECAR_EXT   ".lix"
+
+/* ============================================================================
+ * ASSET PARTITION (see vfs_assets.h)
+ * ============================================================================ */
+
+// #define VFS_USE_ASSETS                   // storage_init() maps the asset partition
+
+#define VFS_ASSETS_PARTITION_LABEL  "assets"
+
 /* ============================================================================
  * VALIDATION
  * ============================================================================ */
 
-#define VFS_BACKEND_COUNT ( \
-    (defined(VFS_USE_SD_CARD) ? 1 : 0) + \
-    (defined(VFS_USE_SPIFFS) ? 1 : 0) + \
-    (defined(VFS_USE_LITTLEFS) ? 1 : 0) + \
-    (defined(VFS_USE_RAMFS) ? 1 : 0) \
-)
+// `defined` can't appear in a macro expansion, so each backend gets its own term
+#ifdef VFS_USE_SD_CARD
+    #define VFS_BACKEND_COUNT_SD_CARD   1
+#else
+    #define VFS_BACKEND_COUNT_SD_CARD   0
+#endif
+#ifdef VFS_USE_SPIFFS
+    #define VFS_BACKEND_COUNT_SPIFFS    1
+#else
+    #define VFS_BACKEND_COUNT_SPIFFS    0
+#endif
+#ifdef VFS_USE_LITTLEFS
+    #define VFS_BACKEND_COUNT_LITTLEFS  1
+#else
+    #define VFS_BACKEND_COUNT_LITTLEFS  0
+#endif
+#ifdef VFS_USE_RAMFS
+    #define VFS_BACKEND_COUNT_RAMFS     1
+#else
+    #define VFS_BACKEND_COUNT_RAMFS     0
+#endif
+
+#define VFS_BACKEND_COUNT (VFS_BACKEND_COUNT_SD_CARD + VFS_BACKEND_COUNT_SPIFFS + \
+                           VFS_BACKEND_COUNT_LITTLEFS + VFS_BACKEND_COUNT_RAMFS)
 
 #if VFS_BACKEND_COUNT == 0
-    #error "No VFS backend selected! Uncomment one option in vfs_config.h"
-#elif VFS_BACKEND_COUNT > 1
-    #error "Multiple VFS backends selected! Only one must be active in vfs_config.h"
+    #error "No VFS backend selected! Uncomment at least one option in vfs_config.h"
 #endif
 
 #ifdef __cplusplus
@@ -24,6 +24,7 @@
 #include <stdbool.h>
 #include <stddef.h>
 #include <time.h>
+#include <sys/types.h>
 #include "esp_err.h"
 
 #ifdef __cplusplus
@@ -36,7 +37,7 @@ extern "C" {
 
 #define VFS_MAX_PATH        256
 #define VFS_MAX_NAME        64
-#define VFS_MAX_BACKENDS    4
+#define VFS_MAX_BACKENDS    8
 #define VFS_INVALID_FD      -1
 
 /** Supported backend types */
@@ -72,7 +73,10 @@ typedef enum {
     VFS_TYPE_DIR  = 2,
 } vfs_entry_type_t;
 
-/** File descriptor */
+/**
+ * File descriptor. Opaque: it carries a generation, so a descriptor that was
+ * closed keeps failing even after its slot is handed out again.
+ */
 typedef int vfs_fd_t;
 
 /** File or directory information */
@@ -96,6 +100,16 @@ typedef struct {
     uint32_t free_blocks;
 } vfs_statvfs_t;
 
+/** Block cache counters, kept per mount (see vfs_cache.h) */
+typedef struct {
+    uint32_t hits;              // Block lookups served from the cache
+    uint32_t misses;            // Block lookups that went to the backend
+    uint32_t readahead;         // Blocks fetched ahead of a sequential read
+    uint32_t bypass;            // Large reads sent straight to the backend
+    uint32_t invalidations;     // Blocks dropped by write/truncate/unlink/rename
+    uint32_t backend_reads;     // read() calls issued to the backend
+} vfs_cache_stats_t;
+
 /** Directory handle */
 typedef struct vfs_dir_s* vfs_dir_t;
 
@@ -133,19 +147,41 @@ typedef struct vfs_backend_ops_s {
     esp_err_t (*statvfs)(vfs_statvfs_t *stat);
 } vfs_backend_ops_t;
 
+/** Backend flags */
+#define VFS_BACKEND_FLAG_NO_CACHE   0x01    // Data already in RAM: skip the block cache
+
 /** Backend configuration */
 typedef struct {
     vfs_backend_type_t type;
     const char *mount_point;
     const vfs_backend_ops_t *ops;
     void *private_data;
+    uint32_t flags;             // VFS_BACKEND_FLAG_*
 } vfs_backend_config_t;
 
 /* ============================================================================
  * BACKEND MANAGEMENT API
  * ============================================================================ */
 
+/**
+ * @brief Mount a backend at config->mount_point
+ *
+ * Backends can be mounted and removed at any time and side by side. A path
+ * goes to the longest mount point that matches whole components, so
+ * "/sdcard" serves "/sdcard/a" but not "/sdcard2/a".
+ *
+ * @return ESP_OK, ESP_ERR_INVALID_STATE if the mount point is taken,
+ *         ESP_ERR_NO_MEM if VFS_MAX_BACKENDS are mounted
+ */
 esp_err_t vfs_register_backend(const vfs_backend_config_t *config);
+
+/**
+ * @brief Remove a mount (card pulled, partition unmounted)
+ *
+ * Files and directories still open on it are closed in the backend and
+ * their handles go stale: later calls on them fail, and vfs_close() /
+ * vfs_closedir() just release them with ESP_ERR_INVALID_STATE.
+ */
 esp_err_t vfs_unregister_backend(const char *mount_point);
 const vfs_backend_config_t* vfs_get_backend(const char *path);
 size_t vfs_list_backends(const vfs_backend_config_t **backends, size_t max_count);
@@ -154,6 +190,9 @@ size_t vfs_list_backends(const vfs_backend_config_t **backends, size_t max_count
  * FILE OPERATIONS API
  * ============================================================================ */
 
+// Safe from any task. Calls on the same descriptor run one at a time; calls
+// on different descriptors only wait for each other inside the block cache.
+
 vfs_fd_t vfs_open(const char *path, int flags, int mode);
 ssize_t vfs_read(vfs_fd_t fd, void *buf, size_t size);
 ssize_t vfs_write(vfs_fd_t fd, const void *buf, size_t size);
@@ -193,6 +232,13 @@ esp_err_t vfs_get_free_space(const char *path, uint64_t *free_bytes);
 esp_err_t vfs_get_total_space(const char *path, uint64_t *total_bytes);
 esp_err_t vfs_get_usage_percent(const char *path, float *percentage);
 
+/**
+ * @brief Block cache counters of the mount that serves @p path
+ * @return ESP_OK, or ESP_ERR_NOT_FOUND if no backend serves the path
+ */
+esp_err_t vfs_get_cache_stats(const char *path, vfs_cache_stats_t *stats);
+void vfs_reset_cache_stats(const char *path);
+
 /* ============================================================================
  * HIGH-LEVEL HELPERS
  * ============================================================================ */
@@ -201,6 +247,14 @@ esp_err_t vfs_read_file(const char *path, void *buf, size_t size, size_t *bytes_
 esp_err_t vfs_write_file(const char *path, const void *buf, size_t size);
 esp_err_t vfs_append_file(const char *path, const void *buf, size_t size);
 esp_err_t vfs_copy_file(const char *src, const char *dst);
+
+/**
+ * @brief Move a file, also between mounts
+ *
+ * Same mount: vfs_rename(). Different mounts (vfs_rename() refuses those):
+ * copy, then delete the source once the copy is complete.
+ */
+esp_err_t vfs_move_file(const char *src, const char *dst);
 esp_err_t vfs_get_size(const char *path, size_t *size);
 
 #ifdef __cplusplus
@@ -0,0 +1,140 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file vfs_dirindex.h
+ * @brief Cached directory listings with sorted, paged queries
+ *
+ * The first query on a directory reads it once (name, type, size, mtime of
+ * every entry) and keeps the listing in RAM; later queries are served from
+ * memory, so a file browser can redraw or scroll without touching the card.
+ * Up to VFS_DIRINDEX_DIRS listings are kept, least recently used first out,
+ * within VFS_DIRINDEX_BUDGET bytes. A directory too big for the budget is
+ * still listed, just read again on every query.
+ *
+ * Listings can be sorted by name (case-insensitive), size or mtime, and
+ * read a page at a time. The sort order is computed once and kept with the
+ * listing until another order is asked for.
+ *
+ * Recursive size totals (vfs_dirindex_tree_size()) are cached apart, for
+ * VFS_DIRINDEX_TOTALS directories.
+ *
+ * vfs_core drops the affected listings and totals on every change it makes:
+ * create, unlink, rename, truncate, mkdir, rmdir, mount/unmount, and the
+ * close or fsync of a descriptor that was written to. Sizes of files still
+ * open for writing are therefore updated when they are closed or synced.
+ * Changes made outside the VFS (plain fopen on the same mount) are not
+ * seen until one of those events hits the same directory.
+ */
+
+#ifndef VFS_DIRINDEX_H
+#define VFS_DIRINDEX_H
+
+#include "vfs_core.h"
+#include "vfs_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Sort key for vfs_dirindex_list() */
+typedef enum {
+    VFS_DIRINDEX_SORT_NONE = 0,     // Backend order
+    VFS_DIRINDEX_SORT_NAME,
+    VFS_DIRINDEX_SORT_SIZE,
+    VFS_DIRINDEX_SORT_MTIME,
+} vfs_dirindex_sort_t;
+
+/** Sort flags */
+#define VFS_DIRINDEX_DESC           0x01    // Largest / newest / Z first
+#define VFS_DIRINDEX_DIRS_FIRST     0x02    // Directories before files
+
+/** Cache counters */
+typedef struct {
+    uint32_t hits;              // Queries served from a cached listing
+    uint32_t scans;             // Directories read from the backend
+    uint32_t uncached;          // Scans too big for the budget (not kept)
+    uint32_t invalidations;     // Listings and totals dropped by changes
+    uint32_t total_hits;        // Tree sizes served from the cache
+    size_t bytes_used;
+} vfs_dirindex_stats_t;
+
+/* ============================================================================
+ * QUERIES
+ * ============================================================================ */
+
+/**
+ * @brief Read a page of a directory listing
+ *
+ * @param path Full VFS path of the directory
+ * @param sort Sort key
+ * @param flags VFS_DIRINDEX_DESC / VFS_DIRINDEX_DIRS_FIRST
+ * @param offset First entry to return, in sorted order
+ * @param entries Output array (name, type, size, mtime, ctime filled)
+ * @param max Room in @p entries
+ * @param count Entries stored (can be NULL)
+ * @param total Entries in the whole directory (can be NULL)
+ * @return ESP_OK, ESP_FAIL if the directory cannot be opened,
+ *         ESP_ERR_NO_MEM if the listing does not fit in RAM
+ */
+esp_err_t vfs_dirindex_list(const char *path, vfs_dirindex_sort_t sort, int flags,
+                            size_t offset, vfs_stat_t *entries, size_t max,
+                            size_t *count, size_t *total);
+
+/**
+ * @brief Count the files and subdirectories of a directory (not recursive)
+ */
+esp_err_t vfs_dirindex_count(const char *path, uint32_t *file_count, uint32_t *dir_count);
+
+/**
+ * @brief Total size of the files in a directory and all its subdirectories
+ *
+ * Subdirectories deeper than VFS_DIRINDEX_MAX_DEPTH are not counted.
+ *
+ * @param path Full VFS path of the directory
+ * @param total_size Sum of the file sizes, in bytes
+ * @param file_count Files counted (can be NULL)
+ */
+esp_err_t vfs_dirindex_tree_size(const char *path, uint64_t *total_size, uint32_t *file_count);
+
+/* ============================================================================
+ * INVALIDATION (called by vfs_core)
+ * ============================================================================ */
+
+/** @brief Create the lock (vfs_core, on the first mount) */
+esp_err_t vfs_dirindex_init(void);
+
+/**
+ * @brief Something at @p path changed
+ *
+ * Drops the listing of its parent directory, the listings of @p path and
+ * everything under it, and the totals of every directory that contains it.
+ */
+void vfs_dirindex_invalidate(const char *path);
+
+/** @brief Drop every listing and total */
+void vfs_dirindex_clear(void);
+
+/* ============================================================================
+ * STATISTICS
+ * ============================================================================ */
+
+esp_err_t vfs_dirindex_get_stats(vfs_dirindex_stats_t *stats);
+void vfs_dirindex_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // VFS_DIRINDEX_H
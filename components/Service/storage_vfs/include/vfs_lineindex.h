@@ -0,0 +1,139 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file vfs_lineindex.h
+ * @brief Line offset index for random access into text files
+ *
+ * The index keeps the byte offset of every Nth line of a file (N starts at
+ * VFS_LINEINDEX_STRIDE and doubles whenever VFS_LINEINDEX_MAX_MARKS would be
+ * exceeded). Reading line K is then one seek to the nearest offset at or
+ * before it plus a forward read of fewer than N lines, instead of a scan
+ * from the start of the file.
+ *
+ * The file is scanned once; when it has grown since (a log being appended
+ * to), only the new bytes are scanned. Before every use the index checks
+ * that the file still starts and, at the indexed length, ends with the
+ * bytes it was built from, and rebuilds itself if not, so files truncated
+ * or rewritten behind its back are detected.
+ *
+ * Up to VFS_LINEINDEX_FILES indexes are kept in RAM. An index covering at
+ * least VFS_LINEINDEX_SIDECAR_MIN bytes is saved next to its file (same
+ * name plus VFS_LINEINDEX_SIDECAR_EXT) when it leaves RAM, and loaded from
+ * there the next time, so large logs are not rescanned after a reset.
+ * Sidecars are left out of directory listings and size totals (see
+ * vfs_lineindex_is_sidecar()); only the raw vfs_readdir() returns them.
+ *
+ * Lines end with '\n'; a last line without one also counts. Line numbers
+ * start at 1.
+ */
+
+#ifndef VFS_LINEINDEX_H
+#define VFS_LINEINDEX_H
+
+#include "vfs_core.h"
+#include "vfs_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define VFS_LINEINDEX_LINE_MAX  512     // Longer lines reach the callback cut short
+
+/**
+ * @brief Line callback
+ * @param line Line without '\n', NUL-terminated, cut to VFS_LINEINDEX_LINE_MAX - 1 chars
+ * @param number Line number (starts at 1)
+ * @param user_data User data
+ */
+typedef void (*vfs_lineindex_callback_t)(const char *line, uint32_t number, void *user_data);
+
+/** Index counters */
+typedef struct {
+    uint32_t hits;              // Queries answered from an index already current
+    uint32_t builds;            // Indexes built from byte zero
+    uint32_t extends;           // Indexes extended over appended bytes
+    uint32_t rebuilds;          // Indexes found stale (file rewritten)
+    uint32_t sidecar_loads;
+    uint32_t sidecar_saves;
+    uint64_t scanned_bytes;     // Bytes read to build and extend indexes
+} vfs_lineindex_stats_t;
+
+/* ============================================================================
+ * QUERIES
+ * ============================================================================ */
+
+/**
+ * @brief Number of lines in a file
+ * @return ESP_OK, ESP_FAIL if the file cannot be read
+ */
+esp_err_t vfs_lineindex_count(const char *path, uint32_t *lines);
+
+/**
+ * @brief Byte offset where a line starts
+ * @return ESP_OK, ESP_ERR_NOT_FOUND if the file has fewer lines
+ */
+esp_err_t vfs_lineindex_locate(const char *path, uint32_t line, size_t *offset);
+
+/**
+ * @brief Read lines @p first .. @p first + @p count - 1
+ *
+ * The callback runs with no lock held and may use the VFS.
+ *
+ * @return ESP_OK (lines past the end are simply not reported),
+ *         ESP_ERR_NOT_FOUND if @p first is past the last line,
+ *         ESP_FAIL on a read error
+ */
+esp_err_t vfs_lineindex_read(const char *path, uint32_t first, uint32_t count,
+                             vfs_lineindex_callback_t callback, void *user_data);
+
+/**
+ * @brief Read the last @p count lines, oldest first
+ * @return ESP_OK, ESP_ERR_NOT_FOUND if the file is empty
+ */
+esp_err_t vfs_lineindex_tail(const char *path, uint32_t count,
+                             vfs_lineindex_callback_t callback, void *user_data);
+
+/* ============================================================================
+ * MAINTENANCE
+ * ============================================================================ */
+
+/** @brief Create the lock (vfs_core, on the first mount) */
+esp_err_t vfs_lineindex_init(void);
+
+/** @brief Write the sidecar of @p path now (whatever its size) */
+esp_err_t vfs_lineindex_save(const char *path);
+
+/**
+ * @brief Drop the index of @p path from RAM and delete its sidecar
+ *
+ * For files being deleted or renamed; a rewritten file is detected anyway.
+ */
+void vfs_lineindex_forget(const char *path);
+
+/**
+ * @brief Whether @p name (an entry name or a path) is a line index sidecar
+ *
+ * Listings skip these so they never show up next to the user's files.
+ */
+bool vfs_lineindex_is_sidecar(const char *name);
+
+esp_err_t vfs_lineindex_get_stats(vfs_lineindex_stats_t *stats);
+void vfs_lineindex_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // VFS_LINEINDEX_H
@@ -0,0 +1,120 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file vfs_ramfs.h
+ * @brief RAM filesystem backend interface
+ *
+ * Files and directories kept in heap memory, lost on reboot. Meant as a fast
+ * scratch area (captures that are persisted to flash/SD later) and as a
+ * hardware-free backend for the rest of the VFS stack.
+ *
+ * File data is stored in VFS_RAMFS_CHUNK_SIZE chunks allocated on demand,
+ * so files grow without reallocating and holes left by lseek/truncate
+ * take no memory. The size cap counts allocated chunks. Chunks can come
+ * from PSRAM when the board has it, with internal RAM as the fallback.
+ *
+ * RAMFS is mounted by vfs_init_auto() when VFS_USE_RAMFS is set, and can
+ * also be mounted on demand with vfs_ramfs_init() without it.
+ */
+#ifndef VFS_RAMFS_H
+#define VFS_RAMFS_H
+
+#include "vfs_config.h"
+#include "esp_err.h"
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* ============================================================================
+ * DEFAULTS
+ * ============================================================================ */
+
+#ifndef VFS_RAMFS_MOUNT_POINT
+#define VFS_RAMFS_MOUNT_POINT       "/ram"     // Also set by vfs_config.h (VFS_USE_RAMFS)
+#endif
+#define VFS_RAMFS_DEFAULT_SIZE      (64 * 1024)
+#define VFS_RAMFS_MAX_NODES         64          // Files + directories
+#define VFS_RAMFS_MAX_OPEN          8
+#define VFS_RAMFS_CHUNK_SIZE        1024
+
+/** RAMFS configuration (zero fields take the defaults above) */
+typedef struct {
+    const char *mount_point;
+    size_t size;                // Cap for file data, in bytes
+    uint16_t max_nodes;
+    uint8_t max_open;
+    bool use_psram;             // Prefer PSRAM for file data when available
+} vfs_ramfs_config_t;
+
+/* ============================================================================
+ * PUBLIC API
+ * ============================================================================ */
+
+/**
+ * @brief Create an empty RAM filesystem and register it in the VFS
+ * @param config Configuration, NULL for the defaults
+ * @return ESP_OK on success, ESP_ERR_NO_MEM if the tables cannot be allocated
+ */
+esp_err_t vfs_ramfs_init(const vfs_ramfs_config_t *config);
+
+/**
+ * @brief Unregister and free every file
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if not mounted
+ */
+esp_err_t vfs_ramfs_deinit(void);
+
+/**
+ * @brief Check if RAMFS is mounted
+ * @return true if mounted, false otherwise
+ */
+bool vfs_ramfs_is_mounted(void);
+
+/**
+ * @brief Print RAMFS information
+ */
+void vfs_ramfs_print_info(void);
+
+/**
+ * @brief Delete every file and directory
+ * @return ESP_OK on success, ESP_ERR_INVALID_STATE if files are open
+ * @warning Erases all data
+ */
+esp_err_t vfs_ramfs_format(void);
+
+/* ============================================================================
+ * REGISTRATION FUNCTIONS (used by vfs_auto.c)
+ * ============================================================================ */
+
+/**
+ * @brief Register RAMFS with the vfs_config.h settings (VFS_USE_RAMFS)
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t vfs_register_ramfs_backend(void);
+
+/**
+ * @brief Unregister RAMFS backend from VFS
+ * @return ESP_OK on success, error code otherwise
+ */
+esp_err_t vfs_unregister_ramfs_backend(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // VFS_RAMFS_H
@@ -21,11 +21,23 @@
 
 #include "esp_err.h"
 #include <stdbool.h>
+#include <stdint.h>
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** Card identification, read when the card was mounted */
+typedef struct {
+    char name[8];               // Product name from the CID register
+    uint64_t capacity_bytes;
+    uint32_t sector_size;
+    uint32_t sector_count;
+    uint32_t freq_khz;          // Bus clock actually in use
+    uint32_t ocr;               // Operating conditions register
+    bool is_sdhc;               // SDHC/SDXC (block addressed), else SDSC
+} vfs_sdcard_info_t;
+
 /* ============================================================================
  * PUBLIC API
  * ============================================================================ */
@@ -48,6 +60,24 @@ esp_err_t vfs_sdcard_deinit(void);
  */
 bool vfs_sdcard_is_mounted(void);
 
+/**
+ * @brief Check that the mounted card still answers
+ * @return true if mounted and present, false otherwise
+ *
+ * The slot has no card-detect line, so a removed card is only noticed
+ * when it stops answering. storage_init() starts a task that calls this
+ * every VFS_SD_POLL_MS; call it directly after an I/O error. A missing
+ * card is unmounted, descriptors still open on it fail from then on, and
+ * vfs_sdcard_init() mounts it again once reinserted.
+ */
+bool vfs_sdcard_check(void);
+
+/**
+ * @brief Get the mounted card's identification
+ * @return ESP_OK, ESP_ERR_INVALID_STATE if no card is mounted
+ */
+esp_err_t vfs_sdcard_get_info(vfs_sdcard_info_t *info);
+
 /**
  * @brief Print SD card information
  */
@@ -0,0 +1,116 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file vfs_stream.h
+ * @brief Buffered read stream on top of the VFS (getc/ungetc/gets)
+ *
+ * The stream refills its buffer one cache block at a time, aligned to the
+ * block grid, so every refill is a single block lookup in vfs_cache. The
+ * cache's sequential readahead turns those refills into a few large backend
+ * reads. Line and delimiter searches run with memchr() over the buffer.
+ *
+ * The stream lives on the caller's stack (or inside another struct) and
+ * owns its descriptor until vfs_stream_close().
+ */
+
+#ifndef VFS_STREAM_H
+#define VFS_STREAM_H
+
+#include "vfs_core.h"
+#include "vfs_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define VFS_STREAM_BUFFER_SIZE  VFS_CACHE_BLOCK_SIZE
+#define VFS_STREAM_EOF          (-1)
+
+typedef struct {
+    vfs_fd_t fd;
+    size_t pos;             // Next byte in buf
+    size_t len;             // End of the valid bytes in buf
+    bool eof;
+    bool error;
+    uint8_t buf[1 + VFS_STREAM_BUFFER_SIZE];   // buf[0]: room for ungetc() after a refill
+} vfs_stream_t;
+
+/**
+ * @brief Open a file for buffered reading
+ * @return ESP_OK, or ESP_FAIL if the file cannot be opened
+ */
+esp_err_t vfs_stream_open(vfs_stream_t *s, const char *path);
+
+/**
+ * @brief Continue reading at @p offset
+ *
+ * The next refill starts at the block containing @p offset, so a seek costs
+ * one block lookup like any other refill.
+ *
+ * @return ESP_OK, or ESP_FAIL if the backend cannot seek
+ */
+esp_err_t vfs_stream_seek(vfs_stream_t *s, size_t offset);
+
+/** @brief Close the descriptor */
+esp_err_t vfs_stream_close(vfs_stream_t *s);
+
+/** @brief Next byte (0-255) or VFS_STREAM_EOF */
+int vfs_stream_getc(vfs_stream_t *s);
+
+/**
+ * @brief Push one byte back; the next getc() returns it
+ *
+ * One byte is always accepted after a read; a second one in a row may not be.
+ *
+ * @return The byte, or VFS_STREAM_EOF if it could not be pushed back
+ */
+int vfs_stream_ungetc(vfs_stream_t *s, int c);
+
+/**
+ * @brief Read up to a delimiter
+ *
+ * Copies bytes into @p dst until @p delim, @p size - 1 bytes or the end of
+ * the file, and NUL-terminates. The delimiter is consumed but not stored. A
+ * segment longer than the buffer comes back in pieces of @p size - 1 bytes.
+ *
+ * @return Bytes stored (0 for an empty segment), or -1 at end of file
+ */
+ssize_t vfs_stream_read_until(vfs_stream_t *s, int delim, char *dst, size_t size);
+
+/** @brief Read one line without '\n' (see vfs_stream_read_until) */
+ssize_t vfs_stream_gets(vfs_stream_t *s, char *dst, size_t size);
+
+/** @brief Read up to @p size bytes. @return Bytes read, 0 at end of file, -1 on error */
+ssize_t vfs_stream_read(vfs_stream_t *s, void *dst, size_t size);
+
+/**
+ * @brief Zero-copy access to the buffered bytes
+ *
+ * Refills the buffer when it is empty. The bytes stay valid until the next
+ * call on the stream; use vfs_stream_consume() to advance past them.
+ *
+ * @return Bytes available at *data, 0 at end of file, -1 on error
+ */
+ssize_t vfs_stream_peek(vfs_stream_t *s, const uint8_t **data);
+void vfs_stream_consume(vfs_stream_t *s, size_t n);
+
+/** @brief true after a failed backend read */
+static inline bool vfs_stream_error(const vfs_stream_t *s) { return s->error; }
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // VFS_STREAM_H
@@ -0,0 +1,163 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file vfs_writeback.h
+ * @brief Write-back appends for high-rate logging
+ *
+ * Appends are copied into RAM and written by a background task, so the
+ * caller never waits for open/close or for a slow card. Each file being
+ * appended to keeps one descriptor open (up to VFS_WRITEBACK_STREAMS files)
+ * and its data is queued in VFS_WRITEBACK_CHUNK chunks taken from a fixed
+ * pool of VFS_WRITEBACK_BUDGET bytes. The task writes whole chunks, one
+ * backend call each, at offsets aligned to the chunk size; a partial chunk is
+ * written once it is older than VFS_WRITEBACK_FLUSH_MS or on a flush.
+ *
+ * When the pool is full an append blocks until the task frees enough chunks
+ * (backpressure), up to its timeout. A record is queued whole or not at
+ * all, so a timeout never leaves half a record in the file.
+ *
+ * Queued data is not visible to readers until it is flushed, and backends
+ * such as LittleFS only commit it on sync or close: call
+ * vfs_writeback_flush() before reading a file that is being appended to,
+ * and vfs_writeback_sync() or vfs_writeback_close() at the points where the
+ * data must survive a reset. Files left idle for VFS_WRITEBACK_IDLE_MS are
+ * closed by the task.
+ *
+ * A failed background write drops the file's queued data and is reported
+ * by the next append, flush or close of that file.
+ */
+
+#ifndef VFS_WRITEBACK_H
+#define VFS_WRITEBACK_H
+
+#include "vfs_core.h"
+#include "vfs_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/** Write-back configuration (zero fields take the vfs_config.h values) */
+typedef struct {
+    size_t budget;              // Bytes of RAM for queued data
+    uint32_t flush_ms;          // Age at which a partial chunk is written
+    uint32_t idle_ms;           // Idle time before a file is closed
+    uint8_t task_priority;      // Default: 3
+    uint32_t task_stack;        // Default: 3072
+} vfs_writeback_config_t;
+
+/** Queue and latency counters */
+typedef struct {
+    size_t queued_bytes;        // Waiting to be written now
+    size_t max_queued_bytes;
+    uint32_t queued_chunks;     // Queue depth now, in chunks
+    uint32_t max_queued_chunks;
+    uint32_t total_chunks;      // Pool size
+    uint32_t open_streams;
+    uint64_t appended_bytes;    // Accepted by vfs_writeback_append()
+    uint64_t written_bytes;     // Written to the backends
+    uint32_t backend_writes;
+    uint32_t stalls;            // Appends that waited for buffer space
+    uint32_t timeouts;          // Appends that gave up waiting
+    uint32_t max_stall_us;      // Longest wait of an append
+    uint32_t max_write_us;      // Slowest backend write
+    uint32_t errors;            // Failed backend writes
+    uint64_t dropped_bytes;     // Queued data lost to those failures
+} vfs_writeback_stats_t;
+
+/* ============================================================================
+ * SERVICE
+ * ============================================================================ */
+
+/**
+ * @brief Allocate the chunk pool and start the write-back task
+ * @param config Configuration, NULL for the defaults
+ * @return ESP_OK, ESP_ERR_INVALID_STATE if already running, ESP_ERR_NO_MEM
+ */
+esp_err_t vfs_writeback_start(const vfs_writeback_config_t *config);
+
+/**
+ * @brief Write everything queued, close every file and stop the task
+ * @return ESP_OK, ESP_ERR_INVALID_STATE if not running
+ */
+esp_err_t vfs_writeback_stop(void);
+
+/** @brief true between vfs_writeback_start() and vfs_writeback_stop() */
+bool vfs_writeback_is_running(void);
+
+/* ============================================================================
+ * APPEND AND FLUSH
+ * ============================================================================ */
+
+/**
+ * @brief Queue data to be appended to a file
+ *
+ * The file is opened (and created) on the first append.
+ *
+ * @param path Full VFS path
+ * @param timeout_ms Longest wait for buffer space
+ * @return ESP_OK when queued,
+ *         ESP_ERR_TIMEOUT if the buffer stayed full (nothing queued),
+ *         ESP_ERR_INVALID_SIZE if @p size is over the budget minus one chunk,
+ *         ESP_ERR_NO_MEM if every stream is busy with another file
+ *         (append directly instead: nothing is queued for this one),
+ *         ESP_FAIL if the file cannot be opened or an earlier background
+ *         write to it failed,
+ *         ESP_ERR_INVALID_STATE if the service is not running
+ */
+esp_err_t vfs_writeback_append(const char *path, const void *data, size_t size, uint32_t timeout_ms);
+
+/**
+ * @brief Wait until the data queued so far has been written
+ *
+ * Appends made while waiting are not waited for.
+ *
+ * @param path Full VFS path, NULL for every file
+ * @return ESP_OK, ESP_ERR_TIMEOUT, ESP_FAIL if a write failed,
+ *         ESP_ERR_NOT_FOUND if nothing is open for @p path
+ */
+esp_err_t vfs_writeback_flush(const char *path, uint32_t timeout_ms);
+
+/**
+ * @brief Flush, then commit the file on the backend (fsync)
+ * @param path Full VFS path, NULL for every file
+ */
+esp_err_t vfs_writeback_sync(const char *path, uint32_t timeout_ms);
+
+/**
+ * @brief Flush and close a file
+ *
+ * Needed before truncating, deleting or renaming a file that is appended
+ * to through this service.
+ *
+ * @return ESP_OK, ESP_FAIL if a write failed, ESP_ERR_NOT_FOUND if the file
+ *         is not open here
+ */
+esp_err_t vfs_writeback_close(const char *path);
+
+/* ============================================================================
+ * STATISTICS
+ * ============================================================================ */
+
+esp_err_t vfs_writeback_get_stats(vfs_writeback_stats_t *stats);
+
+/** @brief Reset the maxima and totals (current depth is kept) */
+void vfs_writeback_reset_stats(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // VFS_WRITEBACK_H
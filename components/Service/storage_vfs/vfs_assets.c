@@ -0,0 +1,285 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file vfs_assets.c
+ * @brief Mapped asset image implementation
+ *
+ * Image layout (little-endian, written by tools/asset_image.py):
+ *
+ *     header      as_header_t
+ *     index       count x as_entry_t, sorted by path (strcmp order)
+ *     names       NUL-terminated paths
+ *     data        files, each 4-byte aligned and followed by '\0'
+ *
+ * The whole index is checked once at mount time, so lookups can trust it.
+ * Mount and unmount are meant for startup and shutdown; they are not
+ * synchronized with lookups.
+ */
+
+#include "vfs_assets.h"
+#include "esp_log.h"
+#include "esp_partition.h"
+#include <string.h>
+#include <inttypes.h>
+
+static const char *TAG = "vfs_assets";
+
+#define ASSETS_MAGIC    0x31414248      // "HBA1"
+
+typedef struct {
+    uint32_t magic;
+    uint32_t count;
+    uint32_t image_size;        // Bytes used in the partition
+    uint32_t data_start;        // End of index and names
+    uint32_t index_hash;        // FNV-1a of [sizeof(as_header_t), data_start)
+} as_header_t;
+
+typedef struct {
+    uint32_t name;              // Offset of the path
+    uint32_t offset;            // Offset of the data
+    uint32_t size;
+} as_entry_t;
+
+static const uint8_t *s_base = NULL;
+static uint32_t s_size = 0;
+static uint32_t s_count = 0;
+static const as_entry_t *s_index = NULL;
+
+static esp_partition_mmap_handle_t s_map;
+
+/* ============================================================================
+ * HELPER FUNCTIONS
+ * ============================================================================ */
+
+static uint32_t fnv1a(const uint8_t *data, size_t len)
+{
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ data[i]) * 16777619u;
+    }
+    return h;
+}
+
+// Check everything lookups rely on: bounds, terminators and path order
+static bool image_valid(const uint8_t *base, size_t mapped)
+{
+    const as_header_t *hdr = (const as_header_t *)base;
+
+    if (mapped < sizeof(as_header_t) || hdr->magic != ASSETS_MAGIC ||
+        hdr->image_size > mapped || hdr->data_start < sizeof(as_header_t) ||
+        hdr->data_start > hdr->image_size ||
+        hdr->count > (hdr->data_start - sizeof(as_header_t)) / sizeof(as_entry_t)) {
+        return false;
+    }
+
+    uint32_t names = sizeof(as_header_t) + hdr->count * sizeof(as_entry_t);
+    if (fnv1a(base + sizeof(as_header_t), hdr->data_start - sizeof(as_header_t)) != hdr->index_hash) {
+        ESP_LOGE(TAG, "Index checksum mismatch");
+        return false;
+    }
+
+    const as_entry_t *index = (const as_entry_t *)(base + sizeof(as_header_t));
+    const char *prev = NULL;
+
+    for (uint32_t i = 0; i < hdr->count; i++) {
+        const as_entry_t *e = &index[i];
+        const char *name = (const char *)base + e->name;
+
+        if (e->name < names || e->name >= hdr->data_start ||
+            !memchr(name, '\0', hdr->data_start - e->name)) {
+            return false;
+        }
+        if (e->offset < hdr->data_start || e->offset >= hdr->image_size || e->offset % 4 != 0 ||
+            e->size >= hdr->image_size - e->offset || base[e->offset + e->size] != '\0') {
+            return false;
+        }
+        if (prev && strcmp(prev, name) >= 0) {
+            return false;
+        }
+        prev = name;
+    }
+    return true;
+}
+
+static void fill(const as_entry_t *e, vfs_asset_t *asset)
+{
+    asset->path = (const char *)s_base + e->name;
+    asset->data = s_base + e->offset;
+    asset->size = e->size;
+}
+
+/* ============================================================================
+ * MAPPING
+ * ============================================================================ */
+
+static esp_err_t map_image(const char *source, const uint8_t **base, size_t *mapped)
+{
+    if (!source) {
+        source = VFS_ASSETS_PARTITION_LABEL;
+    }
+
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA,
+                                                           ESP_PARTITION_SUBTYPE_ANY, source);
+    if (!part) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    // Map only the bytes the image uses: MMU pages are shared with the code
+    as_header_t hdr;
+    if (esp_partition_read(part, 0, &hdr, sizeof(hdr)) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    if (hdr.magic != ASSETS_MAGIC || hdr.image_size < sizeof(hdr) || hdr.image_size > part->size) {
+        return ESP_ERR_INVALID_VERSION;
+    }
+
+    const void *ptr;
+    esp_err_t ret = esp_partition_mmap(part, 0, hdr.image_size, ESP_PARTITION_MMAP_DATA, &ptr, &s_map);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "mmap failed: %s", esp_err_to_name(ret));
+        return ESP_FAIL;
+    }
+
+    *base = ptr;
+    *mapped = hdr.image_size;
+    return ESP_OK;
+}
+
+static void unmap_image(void)
+{
+    esp_partition_munmap(s_map);
+}
+
+/* ============================================================================
+ * MOUNT
+ * ============================================================================ */
+
+esp_err_t vfs_assets_mount(const char *source)
+{
+    if (s_base) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    const uint8_t *base;
+    size_t mapped;
+    esp_err_t ret = map_image(source, &base, &mapped);
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "No asset image in %s: %s",
+                 source ? source : "default source", esp_err_to_name(ret));
+        return ret;
+    }
+
+    s_base = base;
+    if (!image_valid(base, mapped)) {
+        ESP_LOGE(TAG, "Invalid asset image");
+        unmap_image();
+        s_base = NULL;
+        return ESP_ERR_INVALID_VERSION;
+    }
+
+    const as_header_t *hdr = (const as_header_t *)base;
+    s_size = hdr->image_size;
+    s_count = hdr->count;
+    s_index = (const as_entry_t *)(base + sizeof(as_header_t));
+
+    ESP_LOGI(TAG, "Mapped %" PRIu32 " assets (%" PRIu32 " bytes)", s_count, s_size);
+    return ESP_OK;
+}
+
+esp_err_t vfs_assets_unmount(void)
+{
+    if (!s_base) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    unmap_image();
+    s_base = NULL;
+    s_index = NULL;
+    s_size = 0;
+    s_count = 0;
+    return ESP_OK;
+}
+
+bool vfs_assets_is_mounted(void)
+{
+    return s_base != NULL;
+}
+
+/* ============================================================================
+ * LOOKUP
+ * ============================================================================ */
+
+esp_err_t vfs_asset_find(const char *path, vfs_asset_t *asset)
+{
+    if (!path || !asset) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_base) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    while (*path == '/') {
+        path++;
+    }
+
+    uint32_t lo = 0;
+    uint32_t hi = s_count;
+    while (lo < hi) {
+        uint32_t mid = lo + (hi - lo) / 2;
+        int cmp = strcmp(path, (const char *)s_base + s_index[mid].name);
+        if (cmp == 0) {
+            fill(&s_index[mid], asset);
+            return ESP_OK;
+        }
+        if (cmp < 0) {
+            hi = mid;
+        } else {
+            lo = mid + 1;
+        }
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+uint32_t vfs_assets_count(void)
+{
+    return s_count;
+}
+
+esp_err_t vfs_asset_at(uint32_t index, vfs_asset_t *asset)
+{
+    if (!asset) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_base) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    if (index >= s_count) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    fill(&s_index[index], asset);
+    return ESP_OK;
+}
+
+size_t vfs_asset_window(const vfs_asset_t *asset, size_t offset, size_t len,
+                        const uint8_t **window)
+{
+    if (!asset || !window || offset >= asset->size) {
+        return 0;
+    }
+
+    *window = asset->data + offset;
+    return (len < asset->size - offset) ? len : asset->size - offset;
+}
@@ -21,11 +21,10 @@
 #include "vfs_core.h"
 #include "esp_log.h"
 #include <inttypes.h>
+#include <string.h>
 
 static const char *TAG = "vfs_auto";
 
-static bool s_backend_mounted = false;
-
 /* ============================================================================
  * BACKEND DECLARATIONS
  * ============================================================================ */
@@ -33,7 +32,6 @@ static bool s_backend_mounted = false;
 #ifdef VFS_USE_SD_CARD
 extern esp_err_t vfs_register_sd_backend(void);
 extern esp_err_t vfs_unregister_sd_backend(void);
-extern bool vfs_sdcard_is_mounted(void);
 #endif
 
 #ifdef VFS_USE_SPIFFS
@@ -44,7 +42,6 @@ extern esp_err_t vfs_unregister_spiffs_backend(void);
 #ifdef VFS_USE_LITTLEFS
 extern esp_err_t vfs_register_littlefs_backend(void);
 extern esp_err_t vfs_unregister_littlefs_backend(void);
-extern bool vfs_littlefs_is_mounted(void);
 #endif
 
 #ifdef VFS_USE_RAMFS
@@ -52,50 +49,85 @@ extern esp_err_t vfs_register_ramfs_backend(void);
 extern esp_err_t vfs_unregister_ramfs_backend(void);
 #endif
 
+typedef struct {
+    const char *name;
+    const char *mount_point;
+    esp_err_t (*register_fn)(void);
+    esp_err_t (*unregister_fn)(void);
+    bool mounted;
+} auto_backend_t;
+
+// Same order as vfs_config.h: the first entry is the primary backend
+static auto_backend_t s_backends[] = {
+#ifdef VFS_USE_LITTLEFS
+    { "LittleFS", VFS_LITTLEFS_MOUNT_POINT, vfs_register_littlefs_backend, vfs_unregister_littlefs_backend, false },
+#endif
+#ifdef VFS_USE_SPIFFS
+    { "SPIFFS", VFS_SPIFFS_MOUNT_POINT, vfs_register_spiffs_backend, vfs_unregister_spiffs_backend, false },
+#endif
+#ifdef VFS_USE_SD_CARD
+    { "SD Card", VFS_SD_MOUNT_POINT, vfs_register_sd_backend, vfs_unregister_sd_backend, false },
+#endif
+#ifdef VFS_USE_RAMFS
+    { "RAM Disk", VFS_RAMFS_MOUNT_POINT, vfs_register_ramfs_backend, vfs_unregister_ramfs_backend, false },
+#endif
+};
+
+#define BACKEND_COUNT (sizeof(s_backends) / sizeof(s_backends[0]))
+
+/* ============================================================================
+ * HELPER FUNCTIONS
+ * ============================================================================ */
+
+// Still registered in the core (a removed SD card unregisters itself)
+static bool is_registered(const auto_backend_t *b)
+{
+    const vfs_backend_config_t *config = vfs_get_backend(b->mount_point);
+    return b->mounted && config && strcmp(config->mount_point, b->mount_point) == 0;
+}
+
+static void print_space(const char *mount_point)
+{
+    vfs_statvfs_t stat;
+    if (vfs_statvfs(mount_point, &stat) == ESP_OK) {
+        ESP_LOGI(TAG, "Total: %" PRIu64 " KB", stat.total_bytes / 1024);
+        ESP_LOGI(TAG, "Free: %" PRIu64 " KB", stat.free_bytes / 1024);
+        ESP_LOGI(TAG, "Used: %" PRIu64 " KB", stat.used_bytes / 1024);
+        
+        float usage = stat.total_bytes > 0 ?
+            ((float)stat.used_bytes / stat.total_bytes) * 100.0f : 0.0f;
+        ESP_LOGI(TAG, "Usage: %.1f%%", usage);
+    }
+}
+
 /* ============================================================================
  * UNIFIED API
  * ============================================================================ */
 
 esp_err_t vfs_init_auto(void)
 {
-    ESP_LOGI(TAG, "Initializing backend: %s", VFS_BACKEND_NAME);
-    ESP_LOGI(TAG, "Mount point: %s", VFS_MOUNT_POINT);
-    
     esp_err_t ret = ESP_FAIL;
     
-    #ifdef VFS_USE_SD_CARD
-        ret = vfs_register_sd_backend();
-        if (ret == ESP_OK) {
-            s_backend_mounted = true;
-        }
-    #endif
-    
-    #ifdef VFS_USE_SPIFFS
-        ret = vfs_register_spiffs_backend();
-        if (ret == ESP_OK) {
-            s_backend_mounted = true;
+    for (size_t i = 0; i < BACKEND_COUNT; i++) {
+        auto_backend_t *b = &s_backends[i];
+        ESP_LOGI(TAG, "Initializing backend: %s", b->name);
+        ESP_LOGI(TAG, "Mount point: %s", b->mount_point);
+        
+        esp_err_t err = b->register_fn();
+        b->mounted = (err == ESP_OK);
+        
+        if (err == ESP_OK) {
+            ESP_LOGI(TAG, "Backend %s initialized successfully", b->name);
+        } else if (i == 0) {
+            ESP_LOGE(TAG, "Failed to initialize backend %s", b->name);
+        } else {
+            // Secondary mounts are optional (no card in the slot)
+            ESP_LOGW(TAG, "Backend %s not available: %s", b->name, esp_err_to_name(err));
         }
-    #endif
-    
-    #ifdef VFS_USE_LITTLEFS
-        ret = vfs_register_littlefs_backend();
-        if (ret == ESP_OK) {
-            s_backend_mounted = true;
-        }
-    #endif
-    
-    #ifdef VFS_USE_RAMFS
-        ret = vfs_register_ramfs_backend();
-        if (ret == ESP_OK) {
-            s_backend_mounted = true;
+        
+        if (i == 0) {
+            ret = err;
         }
-    #endif
-    
-    if (ret == ESP_OK) {
-        ESP_LOGI(TAG, "Backend %s initialized successfully", VFS_BACKEND_NAME);
-    } else {
-        ESP_LOGE(TAG, "Failed to initialize backend %s", VFS_BACKEND_NAME);
-        s_backend_mounted = false;
     }
     
     return ret;
@@ -103,28 +135,21 @@ esp_err_t vfs_init_auto(void)
 
 esp_err_t vfs_deinit_auto(void)
 {
-    ESP_LOGI(TAG, "Deinitializing backend: %s", VFS_BACKEND_NAME);
-    
-    esp_err_t ret = ESP_FAIL;
-    
-    #ifdef VFS_USE_SD_CARD
-        ret = vfs_unregister_sd_backend();
-    #endif
-    
-    #ifdef VFS_USE_SPIFFS
-        ret = vfs_unregister_spiffs_backend();
-    #endif
-    
-    #ifdef VFS_USE_LITTLEFS
-        ret = vfs_unregister_littlefs_backend();
-    #endif
-    
-    #ifdef VFS_USE_RAMFS
-        ret = vfs_unregister_ramfs_backend();
-    #endif
-    
-    if (ret == ESP_OK) {
-        s_backend_mounted = false;
+    esp_err_t ret = ESP_OK;
+    
+    for (size_t i = BACKEND_COUNT; i-- > 0;) {
+        auto_backend_t *b = &s_backends[i];
+        if (!b->mounted) continue;
+        
+        ESP_LOGI(TAG, "Deinitializing backend: %s", b->name);
+        
+        // ESP_ERR_INVALID_STATE: already unmounted on its own (card removed)
+        esp_err_t err = b->unregister_fn();
+        if (err == ESP_OK || err == ESP_ERR_INVALID_STATE) {
+            b->mounted = false;
+        } else if (ret == ESP_OK) {
+            ret = err;
+        }
     }
     
     return ret;
@@ -142,23 +167,7 @@ const char* vfs_get_backend_name(void)
 
 bool vfs_is_mounted_auto(void)
 {
-    #ifdef VFS_USE_SD_CARD
-        return s_backend_mounted && vfs_sdcard_is_mounted();
-    #endif
-    
-    #ifdef VFS_USE_SPIFFS
-        return s_backend_mounted;
-    #endif
-    
-    #ifdef VFS_USE_LITTLEFS
-        return s_backend_mounted && vfs_littlefs_is_mounted();
-    #endif
-    
-    #ifdef VFS_USE_RAMFS
-        return s_backend_mounted;
-    #endif
-    
-    return false;
+    return is_registered(&s_backends[0]);
 }
 
 void vfs_print_info(void)
@@ -170,17 +179,17 @@ void vfs_print_info(void)
     ESP_LOGI(TAG, "Status: %s", vfs_is_mounted_auto() ? "Mounted" : "Unmounted");
     
     if (vfs_is_mounted_auto()) {
-        vfs_statvfs_t stat;
-        if (vfs_statvfs(VFS_MOUNT_POINT, &stat) == ESP_OK) {
-            ESP_LOGI(TAG, "Total: %" PRIu64 " KB", stat.total_bytes / 1024);
-            ESP_LOGI(TAG, "Free: %" PRIu64 " KB", stat.free_bytes / 1024);
-            ESP_LOGI(TAG, "Used: %" PRIu64 " KB", stat.used_bytes / 1024);
-            
-            float usage = stat.total_bytes > 0 ?
-                ((float)stat.used_bytes / stat.total_bytes) * 100.0f : 0.0f;
-            ESP_LOGI(TAG, "Usage: %.1f%%", usage);
+        print_space(VFS_MOUNT_POINT);
+    }
+    
+    for (size_t i = 1; i < BACKEND_COUNT; i++) {
+        const auto_backend_t *b = &s_backends[i];
+        bool mounted = is_registered(b);
+        ESP_LOGI(TAG, "%s at %s: %s", b->name, b->mount_point, mounted ? "Mounted" : "Unmounted");
+        if (mounted) {
+            print_space(b->mount_point);
         }
     }
     
     ESP_LOGI(TAG, "==============================");
-}
\ No newline at end of file
+}
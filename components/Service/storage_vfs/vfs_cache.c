@@ -0,0 +1,611 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file vfs_cache.c
+ * @brief Block cache with sequential readahead
+ */
+
+#include "vfs_cache.h"
+#include "vfs_config.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <string.h>
+
+#define BLOCK_SIZE      VFS_CACHE_BLOCK_SIZE
+#define BYPASS_SIZE     (2 * BLOCK_SIZE)    // Reads this large skip the cache
+
+#if VFS_CACHE_BLOCKS > 0
+#define CACHE_SLOTS     VFS_CACHE_BLOCKS
+#else
+#define CACHE_SLOTS     1
+#endif
+
+// Readahead never takes more than half of the cache
+#if VFS_CACHE_READAHEAD_MAX < CACHE_SLOTS / 2
+#define READAHEAD_MAX   VFS_CACHE_READAHEAD_MAX
+#else
+#define READAHEAD_MAX   (CACHE_SLOTS / 2)
+#endif
+
+#define FILL_NO_SLOT    (-2)                // fill(): every slot is claimed by other fills
+
+typedef struct {
+    int16_t node;           // Owner file, -1 = free
+    bool busy;              // Claimed by a fill in progress, skipped by eviction
+    uint16_t len;           // Valid bytes, < BLOCK_SIZE only in the last block of the file
+    uint32_t index;         // Block number inside the file
+    uint32_t used;          // LRU stamp
+} cache_slot_t;
+
+typedef struct {
+    char path[VFS_MAX_PATH];    // Empty = free
+    uint32_t hash;
+    uint16_t refs;              // Open descriptors
+    uint16_t blocks;            // Slots holding this file
+    uint32_t gen;               // Bumped when blocks are dropped: older fills are not linked
+    bool stamp_valid;           // size/mtime describe the cached blocks
+    size_t size;
+    time_t mtime;
+    uint32_t used;
+} cache_node_t;
+
+static struct {
+    bool ready;
+    SemaphoreHandle_t lock;     // Slots, nodes and mount counters; never held across a backend call
+    bool scratch_busy;          // A readahead fill owns the scratch buffer
+    uint32_t clock;
+    cache_slot_t slots[CACHE_SLOTS];
+    cache_node_t nodes[VFS_CACHE_FILES];
+    uint8_t data[CACHE_SLOTS][BLOCK_SIZE];
+    uint8_t scratch[(READAHEAD_MAX + 1) * BLOCK_SIZE];
+} s_cache;
+
+#define LOCK()      do { if (s_cache.lock) xSemaphoreTake(s_cache.lock, portMAX_DELAY); } while (0)
+#define UNLOCK()    do { if (s_cache.lock) xSemaphoreGive(s_cache.lock); } while (0)
+
+/* ============================================================================
+ * HELPER FUNCTIONS
+ * ============================================================================ */
+
+static uint32_t path_hash(const char *path)
+{
+    uint32_t h = 2166136261u;
+    while (*path) {
+        h = (h ^ (uint8_t)*path++) * 16777619u;
+    }
+    return h;
+}
+
+static void drop_slot(int slot, vfs_cache_stats_t *stats)
+{
+    cache_slot_t *s = &s_cache.slots[slot];
+    if (s->node < 0) return;
+    s_cache.nodes[s->node].blocks--;
+    s->node = -1;
+    if (stats) stats->invalidations++;
+}
+
+static void drop_node_blocks(int node, vfs_cache_stats_t *stats)
+{
+    s_cache.nodes[node].gen++;
+    for (int i = 0; i < CACHE_SLOTS && s_cache.nodes[node].blocks > 0; i++) {
+        if (s_cache.slots[i].node == node) {
+            drop_slot(i, stats);
+        }
+    }
+}
+
+static int find_node(const char *path)
+{
+    uint32_t hash = path_hash(path);
+    for (int i = 0; i < VFS_CACHE_FILES; i++) {
+        cache_node_t *n = &s_cache.nodes[i];
+        if (n->path[0] && n->hash == hash && strcmp(n->path, path) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// Free node, or the least recently opened one without open descriptors
+static int alloc_node(const char *path)
+{
+    int best = -1;
+    for (int i = 0; i < VFS_CACHE_FILES; i++) {
+        cache_node_t *n = &s_cache.nodes[i];
+        if (!n->path[0]) {
+            best = i;
+            break;
+        }
+        if (n->refs == 0 && (best < 0 || n->used < s_cache.nodes[best].used)) {
+            best = i;
+        }
+    }
+    if (best < 0) return -1;
+
+    drop_node_blocks(best, NULL);
+    cache_node_t *n = &s_cache.nodes[best];
+    memset(n, 0, sizeof(*n));
+    strncpy(n->path, path, VFS_MAX_PATH - 1);
+    n->hash = path_hash(n->path);
+    return best;
+}
+
+static int find_slot(int node, uint32_t index, int hint)
+{
+    const cache_slot_t *s = &s_cache.slots[hint];
+    if (s->node == node && s->index == index) return hint;
+
+    if (s_cache.nodes[node].blocks == 0) return -1;
+    for (int i = 0; i < CACHE_SLOTS; i++) {
+        s = &s_cache.slots[i];
+        if (s->node == node && s->index == index) return i;
+    }
+    return -1;
+}
+
+// Free slot, or the least recently used one (evicted). -1 if every slot is
+// claimed by a fill in progress.
+static int alloc_slot(void)
+{
+    int best = -1;
+    for (int i = 0; i < CACHE_SLOTS; i++) {
+        const cache_slot_t *s = &s_cache.slots[i];
+        if (s->busy) continue;
+        if (s->node < 0) {
+            best = i;
+            break;
+        }
+        if (best < 0 || s->used < s_cache.slots[best].used) {
+            best = i;
+        }
+    }
+    if (best >= 0) {
+        drop_slot(best, NULL);
+    }
+    return best;
+}
+
+static void fill_slot(int slot, int node, uint32_t index, const uint8_t *data, size_t len)
+{
+    cache_slot_t *s = &s_cache.slots[slot];
+    if (data != s_cache.data[slot]) {
+        memcpy(s_cache.data[slot], data, len);
+    }
+    s->node = node;
+    s->busy = false;
+    s->index = index;
+    s->len = len;
+    s->used = ++s_cache.clock;
+    s_cache.nodes[node].blocks++;
+}
+
+// Position is unknown after an O_APPEND write: ask the backend once
+static off_t current_pos(vfs_cache_file_t *f)
+{
+    if (f->pos < 0) {
+        f->pos = f->ops->lseek(f->native_fd, 0, VFS_SEEK_CUR);
+        f->native_pos = f->pos;
+    }
+    return f->pos;
+}
+
+static bool seek_native(vfs_cache_file_t *f, off_t pos)
+{
+    if (f->native_pos == pos) return true;
+    if (f->ops->lseek(f->native_fd, pos, VFS_SEEK_SET) != pos) {
+        f->native_pos = -1;
+        return false;
+    }
+    f->native_pos = pos;
+    return true;
+}
+
+// One backend call, made without the lock. A short read marks the end of
+// the file, as on any POSIX regular file.
+static ssize_t backend_read(vfs_cache_file_t *f, void *buf, size_t size)
+{
+    ssize_t n = f->ops->read(f->native_fd, buf, size);
+    f->native_pos = n < 0 ? -1 : f->native_pos + n;
+    return n;
+}
+
+// Reads block `index` plus up to `ahead` following blocks that are not
+// cached yet, all in one backend call. Called with the lock held, which is
+// dropped around the backend call: the slot is claimed first and linked to
+// the file afterwards, so descriptors on other files never wait for this
+// I/O. If the file was written meanwhile nothing is linked and the slot
+// comes back still busy, for the caller to copy from and release.
+// Returns the slot of `index`, -1 on error or FILL_NO_SLOT.
+static int fill(vfs_cache_file_t *f, uint32_t index, int ahead)
+{
+    cache_node_t *n = &s_cache.nodes[f->node];
+    int extra = 0;
+    // One readahead at a time owns the scratch buffer, the others read one block
+    while (!s_cache.scratch_busy && extra < ahead &&
+           find_slot(f->node, index + 1 + extra, f->hint) < 0) {
+        extra++;
+    }
+
+    int slot = alloc_slot();
+    if (slot < 0) return FILL_NO_SLOT;
+    cache_slot_t *s = &s_cache.slots[slot];
+    s->busy = true;
+    uint8_t *dst = s_cache.data[slot];
+    if (extra > 0) {
+        s_cache.scratch_busy = true;
+        dst = s_cache.scratch;
+    }
+    uint32_t gen = n->gen;
+    f->stats->backend_reads++;
+
+    UNLOCK();
+    ssize_t got = -1;
+    if (seek_native(f, (off_t)index * BLOCK_SIZE)) {
+        got = backend_read(f, dst, (size_t)(extra + 1) * BLOCK_SIZE);
+    }
+    LOCK();
+
+    if (got < 0) {
+        s->busy = false;
+        if (extra > 0) {
+            s_cache.scratch_busy = false;
+        }
+        return -1;
+    }
+    size_t len = got < BLOCK_SIZE ? (size_t)got : BLOCK_SIZE;
+    if (dst != s_cache.data[slot]) {
+        memcpy(s_cache.data[slot], dst, len);
+    }
+    s->len = len;
+
+    if (n->gen == gen) {
+        int cached = find_slot(f->node, index, f->hint);
+        if (cached >= 0) {
+            s->busy = false;            // Another descriptor linked it first
+            slot = cached;
+        } else {
+            fill_slot(slot, f->node, index, s_cache.data[slot], len);
+        }
+
+        // The slot being returned must survive the evictions below
+        s_cache.slots[slot].busy = true;
+        for (int b = 1; b <= extra && len == BLOCK_SIZE; b++) {
+            ssize_t left = got - (ssize_t)b * BLOCK_SIZE;
+            if (left <= 0) break;       // Past the end of the file
+            len = left < BLOCK_SIZE ? (size_t)left : BLOCK_SIZE;
+            if (find_slot(f->node, index + b, slot) >= 0) continue;
+
+            int ra = alloc_slot();
+            if (ra < 0) break;
+            fill_slot(ra, f->node, index + b, &s_cache.scratch[b * BLOCK_SIZE], len);
+            f->stats->readahead++;
+        }
+        s_cache.slots[slot].busy = false;
+    }
+
+    if (extra > 0) {
+        s_cache.scratch_busy = false;
+    }
+    return slot;
+}
+
+// Every slot is being filled by other descriptors: straight to the backend
+static ssize_t read_around(vfs_cache_file_t *f, off_t pos, void *buf, size_t size)
+{
+    f->stats->backend_reads++;
+    f->stats->bypass++;
+    UNLOCK();
+    ssize_t n = seek_native(f, pos) ? backend_read(f, buf, size) : -1;
+    LOCK();
+    return n;
+}
+
+// Blocks overlapping a write, plus the last block of the file (a write may
+// extend it or leave a gap after it). start < 0 = O_APPEND, offset unknown.
+static void invalidate_range(int node, off_t start, size_t len, vfs_cache_stats_t *stats)
+{
+    cache_node_t *n = &s_cache.nodes[node];
+    n->stamp_valid = false;
+    n->gen++;
+
+    for (int i = 0; i < CACHE_SLOTS && n->blocks > 0; i++) {
+        const cache_slot_t *s = &s_cache.slots[i];
+        if (s->node != node) continue;
+
+        off_t block_start = (off_t)s->index * BLOCK_SIZE;
+        bool overlaps = start >= 0 && block_start < start + (off_t)len &&
+                        start < block_start + BLOCK_SIZE;
+        if (overlaps || s->len < BLOCK_SIZE) {
+            drop_slot(i, stats);
+        }
+    }
+}
+
+/* ============================================================================
+ * DESCRIPTORS
+ * ============================================================================ */
+
+esp_err_t vfs_cache_init(void)
+{
+    if (s_cache.ready) return ESP_OK;
+
+    s_cache.lock = xSemaphoreCreateMutex();
+    if (!s_cache.lock) return ESP_ERR_NO_MEM;
+    for (int i = 0; i < CACHE_SLOTS; i++) {
+        s_cache.slots[i].node = -1;
+    }
+    s_cache.ready = true;
+    return ESP_OK;
+}
+
+void vfs_cache_attach(vfs_cache_file_t *f, const char *path, const vfs_backend_ops_t *ops,
+                      vfs_fd_t native_fd, int flags, vfs_cache_stats_t *stats, bool cacheable)
+{
+    memset(f, 0, sizeof(*f));
+    f->ops = ops;
+    f->native_fd = native_fd;
+    f->stats = stats;
+    f->node = -1;
+    f->append = (flags & VFS_O_APPEND) != 0;
+
+    if (VFS_CACHE_BLOCKS == 0 || !s_cache.ready || !cacheable || !ops->read || !ops->lseek) return;
+
+    // Backend call first, the stamp is compared under the lock
+    vfs_stat_t st;
+    bool stamped = ops->fstat && ops->fstat(native_fd, &st) == ESP_OK;
+
+    LOCK();
+    int node = find_node(path);
+    if (node < 0) {
+        node = alloc_node(path);
+    }
+    if (node >= 0) {
+        // Blocks from a previous open are kept only if the file did not change
+        cache_node_t *n = &s_cache.nodes[node];
+        bool unchanged = stamped && n->stamp_valid && st.size == n->size && st.mtime == n->mtime;
+        if (stamped) {
+            n->size = st.size;
+            n->mtime = st.mtime;
+        }
+        n->stamp_valid = stamped;
+        if (!unchanged || (flags & VFS_O_TRUNC)) {
+            drop_node_blocks(node, NULL);
+        }
+
+        n->refs++;
+        n->used = ++s_cache.clock;
+        f->node = node;
+    }
+    // else every cached file is open: pass-through
+    UNLOCK();
+}
+
+void vfs_cache_detach(vfs_cache_file_t *f)
+{
+    if (f->node < 0) return;
+
+    LOCK();
+    if (s_cache.nodes[f->node].refs > 0) {
+        s_cache.nodes[f->node].refs--;
+    }
+    UNLOCK();
+    f->node = -1;
+}
+
+ssize_t vfs_cache_read(vfs_cache_file_t *f, void *buf, size_t size)
+{
+    if (!f->ops->read) return -1;
+    if (f->node < 0) {
+        return f->ops->read(f->native_fd, buf, size);
+    }
+
+    off_t pos = current_pos(f);
+    if (pos < 0) return -1;
+
+    if (size >= BYPASS_SIZE) {
+        if (!seek_native(f, pos)) return -1;
+        ssize_t n = backend_read(f, buf, size);
+        if (n > 0) {
+            f->pos += n;
+        }
+        f->seq_next = f->pos;
+        LOCK();
+        f->stats->backend_reads++;
+        f->stats->bypass++;
+        UNLOCK();
+        return n;
+    }
+
+    bool sequential = pos == f->seq_next;
+    if (!sequential) {
+        f->window = 0;
+    }
+
+    uint8_t *out = buf;
+    size_t done = 0;
+    bool failed = false;
+    LOCK();
+    while (done < size) {
+        uint32_t index = pos / BLOCK_SIZE;
+        size_t off = pos % BLOCK_SIZE;
+
+        int slot = find_slot(f->node, index, f->hint);
+        if (slot >= 0) {
+            f->stats->hits++;
+            s_cache.slots[slot].used = ++s_cache.clock;
+        } else {
+            f->stats->misses++;
+            int ahead = 0;
+            if (sequential) {
+                f->window = f->window ? f->window * 2 : 1;
+                if (f->window > READAHEAD_MAX) f->window = READAHEAD_MAX;
+                ahead = f->window;
+            }
+            slot = fill(f, index, ahead);
+            if (slot == FILL_NO_SLOT) {
+                ssize_t n = read_around(f, pos, &out[done], size - done);
+                if (n > 0) {
+                    done += n;
+                    pos += n;
+                }
+                failed = n < 0 && done == 0;
+                break;
+            }
+            if (slot < 0) {
+                failed = done == 0;
+                break;
+            }
+        }
+        f->hint = slot;
+
+        cache_slot_t *s = &s_cache.slots[slot];
+        size_t n = 0;
+        if (off < s->len) {
+            n = s->len - off;
+            if (n > size - done) n = size - done;
+            memcpy(&out[done], &s_cache.data[slot][off], n);
+            done += n;
+            pos += n;
+        }
+        bool eof = off >= s->len || (s->len < BLOCK_SIZE && off + n == s->len);
+        s->busy = false;                // Unlinked fill (file written meanwhile): release it
+        if (eof) break;
+    }
+    UNLOCK();
+
+    if (failed) return -1;
+    f->pos = pos;
+    f->seq_next = pos;
+    return done;
+}
+
+ssize_t vfs_cache_write(vfs_cache_file_t *f, const void *buf, size_t size)
+{
+    if (!f->ops->write) return -1;
+    if (f->node < 0) {
+        return f->ops->write(f->native_fd, buf, size);
+    }
+
+    off_t start = -1;
+    if (!f->append) {
+        start = current_pos(f);
+        if (start < 0 || !seek_native(f, start)) return -1;
+    }
+
+    ssize_t n = f->ops->write(f->native_fd, buf, size);
+    if (n < 0 || f->append) {
+        f->native_pos = -1;
+        if (f->append) f->pos = -1;
+    } else {
+        f->pos = start + n;
+        f->native_pos = f->pos;
+    }
+
+    // After the write: a fill that read the old bytes meanwhile is dropped
+    // here or, if it has not linked yet, sees the new generation
+    if (n > 0) {
+        LOCK();
+        invalidate_range(f->node, start, n, f->stats);
+        UNLOCK();
+    }
+    return n;
+}
+
+off_t vfs_cache_lseek(vfs_cache_file_t *f, off_t offset, int whence)
+{
+    if (!f->ops->lseek) return -1;
+    if (f->node < 0) {
+        return f->ops->lseek(f->native_fd, offset, whence);
+    }
+
+    off_t to;
+    switch (whence) {
+        case VFS_SEEK_SET:
+            to = offset;
+            break;
+        case VFS_SEEK_CUR:
+            to = current_pos(f);
+            if (to < 0) return -1;
+            to += offset;
+            break;
+        case VFS_SEEK_END:
+            // Only the backend knows the size
+            to = f->ops->lseek(f->native_fd, offset, VFS_SEEK_END);
+            f->native_pos = to;
+            break;
+        default:
+            return -1;
+    }
+    if (to < 0) return -1;
+
+    f->pos = to;
+    return to;
+}
+
+/* ============================================================================
+ * INVALIDATION
+ * ============================================================================ */
+
+void vfs_cache_invalidate_path(const char *path, vfs_cache_stats_t *stats)
+{
+    if (!s_cache.ready || !path) return;
+
+    LOCK();
+    int node = find_node(path);
+    if (node >= 0) {
+        drop_node_blocks(node, stats);
+        s_cache.nodes[node].stamp_valid = false;
+    }
+    UNLOCK();
+}
+
+void vfs_cache_forget_mount(const char *mount_point)
+{
+    if (!s_cache.ready || !mount_point) return;
+
+    size_t len = strlen(mount_point);
+    LOCK();
+    for (int i = 0; i < VFS_CACHE_FILES; i++) {
+        cache_node_t *n = &s_cache.nodes[i];
+        if (!n->path[0] || strncmp(n->path, mount_point, len) != 0) continue;
+        if (n->path[len] != '/' && n->path[len] != '\0') continue;
+
+        drop_node_blocks(i, NULL);
+        n->stamp_valid = false;
+        if (n->refs == 0) {
+            n->path[0] = '\0';
+        }
+    }
+    UNLOCK();
+}
+
+/* ============================================================================
+ * STATISTICS
+ * ============================================================================ */
+
+void vfs_cache_get_stats(const vfs_cache_stats_t *stats, vfs_cache_stats_t *out)
+{
+    LOCK();
+    *out = *stats;
+    UNLOCK();
+}
+
+void vfs_cache_reset_stats(vfs_cache_stats_t *stats)
+{
+    LOCK();
+    memset(stats, 0, sizeof(*stats));
+    UNLOCK();
+}
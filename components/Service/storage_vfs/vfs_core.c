@@ -18,85 +18,293 @@
  */
 
 #include "vfs_core.h"
+#include "vfs_config.h"
+#include "vfs_cache.h"
+#include "vfs_dirindex.h"
+#include "vfs_lineindex.h"
 #include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
 #include <string.h>
 #include <stdlib.h>
 #include <fcntl.h>
 
 static const char *TAG = "vfs_core";
 
+#define VFS_COPY_CHUNK  (4 * VFS_CACHE_BLOCK_SIZE)
+
+typedef struct {
+    bool in_use;
+    vfs_backend_config_t config;
+    vfs_cache_stats_t cache_stats;
+} vfs_mount_t;
+
 typedef struct {
     bool in_use;
+    uint16_t generation;            // Part of the public fd, bumped on close
+    int16_t next_free;              // Free list link
+    SemaphoreHandle_t lock;         // Serializes calls on this descriptor
     vfs_fd_t native_fd;
-    const vfs_backend_config_t *backend;
+    vfs_mount_t *mount;             // NULL once the mount is removed
     char path[VFS_MAX_PATH];
     int flags;
+    bool written;                   // Size changed: listings dropped on close/fsync
+    vfs_cache_file_t cache;
 } vfs_file_descriptor_t;
 
 struct vfs_dir_s {
     vfs_dir_t native_dir;
-    const vfs_backend_config_t *backend;
+    vfs_mount_t *mount;             // NULL once the mount is removed
     char path[VFS_MAX_PATH];
+    struct vfs_dir_s *next;         // Open directory list
 };
 
-static struct {
-    vfs_backend_config_t backends[VFS_MAX_BACKENDS];
-    size_t count;
-} s_vfs_backends = {0};
+static vfs_mount_t s_mounts[VFS_MAX_BACKENDS] = {0};
+
+// Mount point trie: one node per path component, node 0 is "/"
+#define MOUNT_TRIE_NODES (VFS_MAX_BACKENDS * 4)
+
+typedef struct {
+    char name[VFS_MAX_NAME];
+    int8_t child;
+    int8_t sibling;
+    int8_t mount;                   // Index in s_mounts, -1 = none
+} mount_node_t;
+
+static mount_node_t s_trie[MOUNT_TRIE_NODES];
+static int s_trie_count = 0;
+
+// A public fd is (generation << FD_INDEX_BITS) | slot, so a closed fd stays
+// invalid after its slot is reused
+#define MAX_OPEN_FILES  32
+#define FD_INDEX_BITS   8
+#define FD_INDEX_MASK   ((1 << FD_INDEX_BITS) - 1)
+#define FD_GEN_MASK     0x7FFF
 
-#define MAX_OPEN_FILES 32
 static vfs_file_descriptor_t s_fd_table[MAX_OPEN_FILES] = {0};
+static int s_free_head = -1;
+static struct vfs_dir_s *s_open_dirs = NULL;
+
+// Lock order: descriptor -> mount -> cache (inside vfs_cache.c) -> fd table.
+// Backend calls on a descriptor hold only its lock, so I/O on different
+// files never contends; the block cache drops its lock around backend I/O.
+static SemaphoreHandle_t s_mount_lock = NULL;   // Mount table, trie, open directories
+static SemaphoreHandle_t s_fd_lock = NULL;      // Free list and slot state, never held across I/O
+
+#define LOCK(l)     do { if (l) xSemaphoreTake(l, portMAX_DELAY); } while (0)
+#define UNLOCK(l)   do { if (l) xSemaphoreGive(l); } while (0)
+#define MOUNT_LOCK()        LOCK(s_mount_lock)
+#define MOUNT_UNLOCK()      UNLOCK(s_mount_lock)
+#define FD_TABLE_LOCK()     LOCK(s_fd_lock)
+#define FD_TABLE_UNLOCK()   UNLOCK(s_fd_lock)
 
 /* ============================================================================
  * HELPER FUNCTIONS
  * ============================================================================ */
 
-static const vfs_backend_config_t* find_backend_by_mount(const char *path)
+static int trie_child(int node, const char *name, size_t len)
 {
-    if (!path) return NULL;
-    
-    const vfs_backend_config_t *best_match = NULL;
-    size_t best_len = 0;
+    for (int c = s_trie[node].child; c >= 0; c = s_trie[c].sibling) {
+        if (strncmp(s_trie[c].name, name, len) == 0 && s_trie[c].name[len] == '\0') {
+            return c;
+        }
+    }
+    return -1;
+}
+
+static esp_err_t trie_insert(const char *mount_point, int mount)
+{
+    int node = 0;
+    const char *p = mount_point;
     
-    for (size_t i = 0; i < s_vfs_backends.count; i++) {
-        const char *mount = s_vfs_backends.backends[i].mount_point;
-        size_t mount_len = strlen(mount);
+    while (*p) {
+        while (*p == '/') p++;
+        if (!*p) break;
         
-        if (strncmp(path, mount, mount_len) == 0) {
-            if (mount_len > best_len) {
-                best_match = &s_vfs_backends.backends[i];
-                best_len = mount_len;
+        size_t len = strcspn(p, "/");
+        if (len >= VFS_MAX_NAME) {
+            return ESP_ERR_INVALID_ARG;
+        }
+        
+        int next = trie_child(node, p, len);
+        if (next < 0) {
+            if (s_trie_count >= MOUNT_TRIE_NODES) {
+                return ESP_ERR_NO_MEM;
             }
+            next = s_trie_count++;
+            memcpy(s_trie[next].name, p, len);
+            s_trie[next].name[len] = '\0';
+            s_trie[next].child = -1;
+            s_trie[next].mount = -1;
+            s_trie[next].sibling = s_trie[node].child;
+            s_trie[node].child = next;
         }
+        node = next;
+        p += len;
     }
     
-    return best_match;
+    if (s_trie[node].mount >= 0) {
+        return ESP_ERR_INVALID_STATE;   // Same mount point, maybe spelled differently
+    }
+    s_trie[node].mount = mount;
+    return ESP_OK;
 }
 
-static int alloc_fd(void)
+static void trie_rebuild(void)
 {
+    s_trie_count = 1;
+    s_trie[0] = (mount_node_t){ .child = -1, .sibling = -1, .mount = -1 };
+    
+    for (int i = 0; i < VFS_MAX_BACKENDS; i++) {
+        if (s_mounts[i].in_use) {
+            trie_insert(s_mounts[i].config.mount_point, i);
+        }
+    }
+}
+
+// Longest mount point that matches whole path components ("/sdcard" does
+// not serve "/sdcard2")
+static vfs_mount_t* find_mount(const char *path)
+{
+    if (!path || s_trie_count == 0) return NULL;
+    
+    int node = 0;
+    int best = s_trie[0].mount;
+    
+    while (*path) {
+        while (*path == '/') path++;
+        if (!*path) break;
+        
+        size_t len = strcspn(path, "/");
+        node = trie_child(node, path, len);
+        if (node < 0) break;
+        if (s_trie[node].mount >= 0) {
+            best = s_trie[node].mount;
+        }
+        path += len;
+    }
+    
+    return best >= 0 ? &s_mounts[best] : NULL;
+}
+
+// Ops of the mount serving path. The tables are static in the backends,
+// so they stay valid after the lock is released.
+static const vfs_backend_ops_t* find_ops(const char *path)
+{
+    MOUNT_LOCK();
+    vfs_mount_t *mount = find_mount(path);
+    const vfs_backend_ops_t *ops = mount ? mount->config.ops : NULL;
+    MOUNT_UNLOCK();
+    return ops;
+}
+
+static esp_err_t init_locks(void)
+{
+    if (s_fd_lock) return ESP_OK;
+    
+    s_mount_lock = xSemaphoreCreateMutex();
+    s_fd_lock = xSemaphoreCreateMutex();
+    if (!s_mount_lock || !s_fd_lock || vfs_cache_init() != ESP_OK ||
+        vfs_dirindex_init() != ESP_OK || vfs_lineindex_init() != ESP_OK) {
+        return ESP_ERR_NO_MEM;
+    }
+    
     for (int i = 0; i < MAX_OPEN_FILES; i++) {
-        if (!s_fd_table[i].in_use) {
-            s_fd_table[i].in_use = true;
-            return i;
+        s_fd_table[i].generation = 1;
+        s_fd_table[i].next_free = (i + 1 < MAX_OPEN_FILES) ? i + 1 : -1;
+    }
+    s_free_head = 0;
+    return ESP_OK;
+}
+
+// Pop a slot from the free list; -1 if none
+static int alloc_fd(void)
+{
+    FD_TABLE_LOCK();
+    int index = s_free_head;
+    if (index >= 0) {
+        vfs_file_descriptor_t *vfd = &s_fd_table[index];
+        if (!vfd->lock) {
+            vfd->lock = xSemaphoreCreateMutex();   // Kept for the next user of the slot
+        }
+        if (vfd->lock) {
+            s_free_head = vfd->next_free;
+            vfd->in_use = true;
+            vfd->mount = NULL;
+        } else {
+            index = -1;
         }
     }
-    return VFS_INVALID_FD;
+    FD_TABLE_UNLOCK();
+    return index;
+}
+
+// Push the slot back; the new generation invalidates copies of the old fd
+static void free_fd(int index)
+{
+    vfs_file_descriptor_t *vfd = &s_fd_table[index];
+    
+    FD_TABLE_LOCK();
+    vfd->in_use = false;
+    vfd->mount = NULL;
+    vfd->generation = (vfd->generation + 1) & FD_GEN_MASK;
+    if (vfd->generation == 0) {
+        vfd->generation = 1;
+    }
+    vfd->next_free = s_free_head;
+    s_free_head = index;
+    FD_TABLE_UNLOCK();
 }
 
-static void free_fd(int fd)
+// Lock the descriptor behind fd. NULL if it was closed or never existed.
+static vfs_file_descriptor_t* acquire_fd(vfs_fd_t fd)
 {
-    if (fd >= 0 && fd < MAX_OPEN_FILES) {
-        memset(&s_fd_table[fd], 0, sizeof(vfs_file_descriptor_t));
+    int index = fd & FD_INDEX_MASK;
+    int generation = fd >> FD_INDEX_BITS;
+    if (fd < 0 || index >= MAX_OPEN_FILES || generation > FD_GEN_MASK) {
+        return NULL;
+    }
+    
+    vfs_file_descriptor_t *vfd = &s_fd_table[index];
+    FD_TABLE_LOCK();
+    SemaphoreHandle_t lock = vfd->lock;
+    FD_TABLE_UNLOCK();
+    if (!lock) {
+        return NULL;
+    }
+    
+    xSemaphoreTake(lock, portMAX_DELAY);
+    FD_TABLE_LOCK();
+    bool valid = vfd->in_use && vfd->generation == generation;
+    FD_TABLE_UNLOCK();
+    
+    if (!valid) {
+        xSemaphoreGive(lock);
+        return NULL;
     }
+    return vfd;
 }
 
-static vfs_file_descriptor_t* get_fd(int fd)
+static void release_fd(vfs_file_descriptor_t *vfd)
 {
-    if (fd < 0 || fd >= MAX_OPEN_FILES || !s_fd_table[fd].in_use) {
+    xSemaphoreGive(vfd->lock);
+}
+
+// Descriptor whose mount is still there, locked
+static vfs_file_descriptor_t* acquire_live_fd(vfs_fd_t fd)
+{
+    vfs_file_descriptor_t *vfd = acquire_fd(fd);
+    if (!vfd) {
+        ESP_LOGE(TAG, "Invalid FD: %d", fd);
+        return NULL;
+    }
+    if (!vfd->mount) {
+        ESP_LOGW(TAG, "FD %d: %s was unmounted", fd, vfd->path);
+        release_fd(vfd);
         return NULL;
     }
-    return &s_fd_table[fd];
+    return vfd;
 }
 
 static int vfs_flags_to_posix(int vfs_flags)
@@ -125,28 +333,50 @@ static int vfs_flags_to_posix(int vfs_flags)
 
 esp_err_t vfs_register_backend(const vfs_backend_config_t *config)
 {
-    if (!config || !config->mount_point || !config->ops) {
+    if (!config || !config->mount_point || config->mount_point[0] != '/' || !config->ops) {
         ESP_LOGE(TAG, "Invalid configuration");
         return ESP_ERR_INVALID_ARG;
     }
     
-    if (s_vfs_backends.count >= VFS_MAX_BACKENDS) {
-        ESP_LOGE(TAG, "Backend limit reached");
+    if (init_locks() != ESP_OK) {
         return ESP_ERR_NO_MEM;
     }
     
-    for (size_t i = 0; i < s_vfs_backends.count; i++) {
-        if (strcmp(s_vfs_backends.backends[i].mount_point, config->mount_point) == 0) {
-            ESP_LOGW(TAG, "Mount point already registered: %s", config->mount_point);
-            return ESP_ERR_INVALID_STATE;
+    MOUNT_LOCK();
+    if (s_trie_count == 0) {
+        trie_rebuild();
+    }
+    
+    int slot = -1;
+    for (int i = 0; i < VFS_MAX_BACKENDS; i++) {
+        if (!s_mounts[i].in_use) {
+            slot = i;
+            break;
         }
     }
     
-    memcpy(&s_vfs_backends.backends[s_vfs_backends.count], config, sizeof(vfs_backend_config_t));
-    s_vfs_backends.count++;
+    esp_err_t ret = ESP_ERR_NO_MEM;
+    if (slot >= 0) {
+        ret = trie_insert(config->mount_point, slot);
+        if (ret == ESP_OK) {
+            s_mounts[slot].in_use = true;
+            s_mounts[slot].config = *config;
+            memset(&s_mounts[slot].cache_stats, 0, sizeof(vfs_cache_stats_t));
+        } else {
+            trie_rebuild();     // Drop nodes created before the failure
+        }
+    }
+    MOUNT_UNLOCK();
     
-    ESP_LOGI(TAG, "Backend registered: %s (type: %d)", config->mount_point, config->type);
-    return ESP_OK;
+    if (ret == ESP_ERR_INVALID_STATE) {
+        ESP_LOGW(TAG, "Mount point already registered: %s", config->mount_point);
+    } else if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Backend limit reached");
+    } else {
+        vfs_dirindex_invalidate(config->mount_point);
+        ESP_LOGI(TAG, "Backend registered: %s (type: %d)", config->mount_point, config->type);
+    }
+    return ret;
 }
 
 esp_err_t vfs_unregister_backend(const char *mount_point)
@@ -155,35 +385,106 @@ esp_err_t vfs_unregister_backend(const char *mount_point)
         return ESP_ERR_INVALID_ARG;
     }
     
-    for (size_t i = 0; i < s_vfs_backends.count; i++) {
-        if (strcmp(s_vfs_backends.backends[i].mount_point, mount_point) == 0) {
-            for (size_t j = i; j < s_vfs_backends.count - 1; j++) {
-                s_vfs_backends.backends[j] = s_vfs_backends.backends[j + 1];
+    // Out of the trie first: no new opens, the slot stays reserved
+    MOUNT_LOCK();
+    vfs_mount_t *mount = NULL;
+    for (int i = 0; i < VFS_MAX_BACKENDS; i++) {
+        if (s_mounts[i].in_use && strcmp(s_mounts[i].config.mount_point, mount_point) == 0) {
+            mount = &s_mounts[i];
+            break;
+        }
+    }
+    if (mount) {
+        for (int i = 0; i < s_trie_count; i++) {
+            if (s_trie[i].mount == mount - s_mounts) {
+                s_trie[i].mount = -1;
+            }
+        }
+    }
+    MOUNT_UNLOCK();
+    
+    if (!mount) {
+        ESP_LOGW(TAG, "Backend not found: %s", mount_point);
+        return ESP_ERR_NOT_FOUND;
+    }
+    
+    // Close what is still open on the mount; the handles go stale and
+    // fail from now on instead of reaching a backend that is gone. Each
+    // descriptor lock waits for a call in progress on it.
+    const vfs_backend_ops_t *ops = mount->config.ops;
+    int stale = 0;
+    
+    for (int i = 0; i < MAX_OPEN_FILES; i++) {
+        vfs_file_descriptor_t *vfd = &s_fd_table[i];
+        FD_TABLE_LOCK();
+        bool match = vfd->in_use && vfd->mount == mount;
+        FD_TABLE_UNLOCK();
+        if (!match) continue;
+        
+        xSemaphoreTake(vfd->lock, portMAX_DELAY);
+        FD_TABLE_LOCK();
+        match = vfd->in_use && vfd->mount == mount;     // Not closed meanwhile
+        FD_TABLE_UNLOCK();
+        
+        if (match) {
+            vfs_cache_detach(&vfd->cache);
+            if (ops->close) {
+                ops->close(vfd->native_fd);
+            }
+            FD_TABLE_LOCK();
+            vfd->mount = NULL;
+            FD_TABLE_UNLOCK();
+            stale++;
+        }
+        xSemaphoreGive(vfd->lock);
+    }
+    
+    MOUNT_LOCK();
+    for (struct vfs_dir_s *dir = s_open_dirs; dir; dir = dir->next) {
+        if (dir->mount == mount) {
+            if (ops->closedir) {
+                ops->closedir(dir->native_dir);
             }
-            s_vfs_backends.count--;
-            
-            ESP_LOGI(TAG, "Backend unregistered: %s", mount_point);
-            return ESP_OK;
+            dir->mount = NULL;
+            stale++;
         }
     }
     
-    ESP_LOGW(TAG, "Backend not found: %s", mount_point);
-    return ESP_ERR_NOT_FOUND;
+    vfs_cache_forget_mount(mount_point);
+    
+    memset(mount, 0, sizeof(*mount));
+    trie_rebuild();
+    MOUNT_UNLOCK();
+    
+    vfs_dirindex_invalidate(mount_point);
+    
+    if (stale > 0) {
+        ESP_LOGW(TAG, "%d open handle(s) on %s invalidated", stale, mount_point);
+    }
+    ESP_LOGI(TAG, "Backend unregistered: %s", mount_point);
+    return ESP_OK;
 }
 
 const vfs_backend_config_t* vfs_get_backend(const char *path)
 {
-    return find_backend_by_mount(path);
+    MOUNT_LOCK();
+    vfs_mount_t *mount = find_mount(path);
+    MOUNT_UNLOCK();
+    return mount ? &mount->config : NULL;
 }
 
 size_t vfs_list_backends(const vfs_backend_config_t **backends, size_t max_count)
 {
     if (!backends) return 0;
     
-    size_t count = s_vfs_backends.count < max_count ? s_vfs_backends.count : max_count;
-    for (size_t i = 0; i < count; i++) {
-        backends[i] = &s_vfs_backends.backends[i];
+    size_t count = 0;
+    MOUNT_LOCK();
+    for (int i = 0; i < VFS_MAX_BACKENDS && count < max_count; i++) {
+        if (s_mounts[i].in_use) {
+            backends[count++] = &s_mounts[i].config;
+        }
     }
+    MOUNT_UNLOCK();
     
     return count;
 }
@@ -199,98 +500,163 @@ vfs_fd_t vfs_open(const char *path, int flags, int mode)
         return VFS_INVALID_FD;
     }
     
-    const vfs_backend_config_t *backend = find_backend_by_mount(path);
-    if (!backend || !backend->ops || !backend->ops->open) {
-        ESP_LOGE(TAG, "Backend not found for: %s", path);
+    int index = alloc_fd();
+    if (index < 0) {
+        ESP_LOGE(TAG, "No file descriptors available");
         return VFS_INVALID_FD;
     }
     
-    int fd = alloc_fd();
-    if (fd == VFS_INVALID_FD) {
-        ESP_LOGE(TAG, "No file descriptors available");
+    // The slot is not published yet, its lock is free. Holding it pins the
+    // mount without the mount lock: an unregister waits for the open to
+    // finish and then closes the new descriptor like any other.
+    vfs_file_descriptor_t *vfd = &s_fd_table[index];
+    xSemaphoreTake(vfd->lock, portMAX_DELAY);
+    
+    MOUNT_LOCK();
+    vfs_mount_t *mount = find_mount(path);
+    if (mount && mount->config.ops->open) {
+        FD_TABLE_LOCK();
+        vfd->mount = mount;
+        FD_TABLE_UNLOCK();
+    } else {
+        mount = NULL;
+    }
+    MOUNT_UNLOCK();
+    
+    if (!mount) {
+        free_fd(index);
+        release_fd(vfd);
+        ESP_LOGE(TAG, "Backend not found for: %s", path);
         return VFS_INVALID_FD;
     }
     
+    const vfs_backend_config_t *backend = &mount->config;
     int posix_flags = vfs_flags_to_posix(flags);
     vfs_fd_t native_fd = backend->ops->open(path, posix_flags, mode);
     
     if (native_fd == VFS_INVALID_FD) {
+        free_fd(index);
+        release_fd(vfd);
         ESP_LOGE(TAG, "Failed to open: %s", path);
-        free_fd(fd);
         return VFS_INVALID_FD;
     }
     
-    s_fd_table[fd].native_fd = native_fd;
-    s_fd_table[fd].backend = backend;
-    s_fd_table[fd].flags = flags;
-    strncpy(s_fd_table[fd].path, path, VFS_MAX_PATH - 1);
-    s_fd_table[fd].path[VFS_MAX_PATH - 1] = '\0';
+    vfd->native_fd = native_fd;
+    vfd->flags = flags;
+    vfd->written = false;
+    strncpy(vfd->path, path, VFS_MAX_PATH - 1);
+    vfd->path[VFS_MAX_PATH - 1] = '\0';
+    
+    vfs_cache_attach(&vfd->cache, vfd->path, backend->ops, native_fd,
+                     flags, &mount->cache_stats,
+                     !(backend->flags & VFS_BACKEND_FLAG_NO_CACHE));
+    
+    FD_TABLE_LOCK();
+    vfs_fd_t fd = (vfd->generation << FD_INDEX_BITS) | index;
+    FD_TABLE_UNLOCK();
+    release_fd(vfd);
     
+    if (flags & (VFS_O_CREAT | VFS_O_TRUNC)) {
+        vfs_dirindex_invalidate(path);
+    }
     return fd;
 }
 
 ssize_t vfs_read(vfs_fd_t fd, void *buf, size_t size)
 {
-    vfs_file_descriptor_t *vfd = get_fd(fd);
-    if (!vfd || !vfd->backend->ops->read) {
-        ESP_LOGE(TAG, "Invalid FD: %d", fd);
+    vfs_file_descriptor_t *vfd = acquire_live_fd(fd);
+    if (!vfd) {
         return -1;
     }
     
-    return vfd->backend->ops->read(vfd->native_fd, buf, size);
+    ssize_t ret = vfs_cache_read(&vfd->cache, buf, size);
+    
+    release_fd(vfd);
+    return ret;
 }
 
 ssize_t vfs_write(vfs_fd_t fd, const void *buf, size_t size)
 {
-    vfs_file_descriptor_t *vfd = get_fd(fd);
-    if (!vfd || !vfd->backend->ops->write) {
-        ESP_LOGE(TAG, "Invalid FD: %d", fd);
+    vfs_file_descriptor_t *vfd = acquire_live_fd(fd);
+    if (!vfd) {
         return -1;
     }
     
-    return vfd->backend->ops->write(vfd->native_fd, buf, size);
+    ssize_t ret = vfs_cache_write(&vfd->cache, buf, size);
+    if (ret > 0) {
+        vfd->written = true;
+    }
+    
+    release_fd(vfd);
+    return ret;
 }
 
 off_t vfs_lseek(vfs_fd_t fd, off_t offset, int whence)
 {
-    vfs_file_descriptor_t *vfd = get_fd(fd);
-    if (!vfd || !vfd->backend->ops->lseek) {
-        ESP_LOGE(TAG, "Invalid FD: %d", fd);
+    vfs_file_descriptor_t *vfd = acquire_live_fd(fd);
+    if (!vfd) {
         return -1;
     }
     
-    return vfd->backend->ops->lseek(vfd->native_fd, offset, whence);
+    off_t ret = vfs_cache_lseek(&vfd->cache, offset, whence);
+    
+    release_fd(vfd);
+    return ret;
 }
 
 esp_err_t vfs_close(vfs_fd_t fd)
 {
-    vfs_file_descriptor_t *vfd = get_fd(fd);
+    vfs_file_descriptor_t *vfd = acquire_fd(fd);
     if (!vfd) {
         ESP_LOGE(TAG, "Invalid FD: %d", fd);
         return ESP_ERR_INVALID_ARG;
     }
     
-    esp_err_t ret = ESP_OK;
-    if (vfd->backend->ops->close) {
-        ret = vfd->backend->ops->close(vfd->native_fd);
+    // The slot can be reused as soon as it is freed
+    char changed[VFS_MAX_PATH] = "";
+    if (vfd->written) {
+        strcpy(changed, vfd->path);
     }
     
-    free_fd(fd);
+    // A stale descriptor was already closed in the backend by the unmount
+    esp_err_t ret = ESP_ERR_INVALID_STATE;
+    if (vfd->mount) {
+        vfs_cache_detach(&vfd->cache);
+        
+        ret = ESP_OK;
+        if (vfd->mount->config.ops->close) {
+            ret = vfd->mount->config.ops->close(vfd->native_fd);
+        }
+    }
+    
+    free_fd(vfd - s_fd_table);
+    release_fd(vfd);
+    
+    if (changed[0]) {
+        vfs_dirindex_invalidate(changed);
+    }
     return ret;
 }
 
 esp_err_t vfs_fsync(vfs_fd_t fd)
 {
-    vfs_file_descriptor_t *vfd = get_fd(fd);
+    vfs_file_descriptor_t *vfd = acquire_fd(fd);
     if (!vfd) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    if (vfd->backend->ops->fsync) {
-        return vfd->backend->ops->fsync(vfd->native_fd);
+    esp_err_t ret = ESP_ERR_INVALID_STATE;
+    if (vfd->mount) {
+        ret = vfd->mount->config.ops->fsync ?
+            vfd->mount->config.ops->fsync(vfd->native_fd) : ESP_OK;
+    }
+    if (vfd->written) {
+        vfd->written = false;
+        vfs_dirindex_invalidate(vfd->path);
     }
     
-    return ESP_OK;
+    release_fd(vfd);
+    return ret;
 }
 
 /* ============================================================================
@@ -303,13 +669,13 @@ esp_err_t vfs_stat(const char *path, vfs_stat_t *st)
         return ESP_ERR_INVALID_ARG;
     }
     
-    const vfs_backend_config_t *backend = find_backend_by_mount(path);
-    if (!backend || !backend->ops->stat) {
+    const vfs_backend_ops_t *ops = find_ops(path);
+    if (!ops || !ops->stat) {
         ESP_LOGE(TAG, "Backend not found: %s", path);
         return ESP_ERR_NOT_FOUND;
     }
     
-    return backend->ops->stat(path, st);
+    return ops->stat(path, st);
 }
 
 esp_err_t vfs_fstat(vfs_fd_t fd, vfs_stat_t *st)
@@ -318,12 +684,19 @@ esp_err_t vfs_fstat(vfs_fd_t fd, vfs_stat_t *st)
         return ESP_ERR_INVALID_ARG;
     }
     
-    vfs_file_descriptor_t *vfd = get_fd(fd);
-    if (!vfd || !vfd->backend->ops->fstat) {
+    vfs_file_descriptor_t *vfd = acquire_fd(fd);
+    if (!vfd) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    return vfd->backend->ops->fstat(vfd->native_fd, st);
+    esp_err_t ret = ESP_ERR_INVALID_STATE;
+    if (vfd->mount) {
+        ret = vfd->mount->config.ops->fstat ?
+            vfd->mount->config.ops->fstat(vfd->native_fd, st) : ESP_ERR_INVALID_ARG;
+    }
+    
+    release_fd(vfd);
+    return ret;
 }
 
 esp_err_t vfs_rename(const char *old_path, const char *new_path)
@@ -332,12 +705,30 @@ esp_err_t vfs_rename(const char *old_path, const char *new_path)
         return ESP_ERR_INVALID_ARG;
     }
     
-    const vfs_backend_config_t *backend = find_backend_by_mount(old_path);
-    if (!backend || !backend->ops->rename) {
+    MOUNT_LOCK();
+    vfs_mount_t *mount = find_mount(old_path);
+    if (!mount || !mount->config.ops->rename) {
+        MOUNT_UNLOCK();
+        return ESP_ERR_NOT_SUPPORTED;
+    }
+    
+    if (find_mount(new_path) != mount) {
+        MOUNT_UNLOCK();
+        ESP_LOGE(TAG, "Rename across mounts, use vfs_move_file: %s -> %s", old_path, new_path);
         return ESP_ERR_NOT_SUPPORTED;
     }
     
-    return backend->ops->rename(old_path, new_path);
+    // Invalidated after the call: fills that raced it see the new generation
+    esp_err_t ret = mount->config.ops->rename(old_path, new_path);
+    vfs_cache_invalidate_path(old_path, &mount->cache_stats);
+    vfs_cache_invalidate_path(new_path, &mount->cache_stats);
+    MOUNT_UNLOCK();
+    
+    if (ret == ESP_OK) {
+        vfs_dirindex_invalidate(old_path);
+        vfs_dirindex_invalidate(new_path);
+    }
+    return ret;
 }
 
 esp_err_t vfs_unlink(const char *path)
@@ -346,12 +737,19 @@ esp_err_t vfs_unlink(const char *path)
         return ESP_ERR_INVALID_ARG;
     }
     
-    const vfs_backend_config_t *backend = find_backend_by_mount(path);
-    if (!backend || !backend->ops->unlink) {
-        return ESP_ERR_NOT_SUPPORTED;
+    MOUNT_LOCK();
+    vfs_mount_t *mount = find_mount(path);
+    esp_err_t ret = ESP_ERR_NOT_SUPPORTED;
+    if (mount && mount->config.ops->unlink) {
+        ret = mount->config.ops->unlink(path);
+        vfs_cache_invalidate_path(path, &mount->cache_stats);
     }
+    MOUNT_UNLOCK();
     
-    return backend->ops->unlink(path);
+    if (ret == ESP_OK) {
+        vfs_dirindex_invalidate(path);
+    }
+    return ret;
 }
 
 esp_err_t vfs_truncate(const char *path, off_t length)
@@ -360,12 +758,19 @@ esp_err_t vfs_truncate(const char *path, off_t length)
         return ESP_ERR_INVALID_ARG;
     }
     
-    const vfs_backend_config_t *backend = find_backend_by_mount(path);
-    if (!backend || !backend->ops->truncate) {
-        return ESP_ERR_NOT_SUPPORTED;
+    MOUNT_LOCK();
+    vfs_mount_t *mount = find_mount(path);
+    esp_err_t ret = ESP_ERR_NOT_SUPPORTED;
+    if (mount && mount->config.ops->truncate) {
+        ret = mount->config.ops->truncate(path, length);
+        vfs_cache_invalidate_path(path, &mount->cache_stats);
     }
+    MOUNT_UNLOCK();
     
-    return backend->ops->truncate(path, length);
+    if (ret == ESP_OK) {
+        vfs_dirindex_invalidate(path);
+    }
+    return ret;
 }
 
 bool vfs_exists(const char *path)
@@ -384,12 +789,16 @@ esp_err_t vfs_mkdir(const char *path, int mode)
         return ESP_ERR_INVALID_ARG;
     }
     
-    const vfs_backend_config_t *backend = find_backend_by_mount(path);
-    if (!backend || !backend->ops->mkdir) {
+    const vfs_backend_ops_t *ops = find_ops(path);
+    if (!ops || !ops->mkdir) {
         return ESP_ERR_NOT_SUPPORTED;
     }
     
-    return backend->ops->mkdir(path, mode);
+    esp_err_t ret = ops->mkdir(path, mode);
+    if (ret == ESP_OK) {
+        vfs_dirindex_invalidate(path);
+    }
+    return ret;
 }
 
 esp_err_t vfs_rmdir(const char *path)
@@ -398,12 +807,16 @@ esp_err_t vfs_rmdir(const char *path)
         return ESP_ERR_INVALID_ARG;
     }
     
-    const vfs_backend_config_t *backend = find_backend_by_mount(path);
-    if (!backend || !backend->ops->rmdir) {
+    const vfs_backend_ops_t *ops = find_ops(path);
+    if (!ops || !ops->rmdir) {
         return ESP_ERR_NOT_SUPPORTED;
     }
     
-    return backend->ops->rmdir(path);
+    esp_err_t ret = ops->rmdir(path);
+    if (ret == ESP_OK) {
+        vfs_dirindex_invalidate(path);
+    }
+    return ret;
 }
 
 esp_err_t vfs_rmdir_recursive(const char *path)
@@ -435,38 +848,51 @@ vfs_dir_t vfs_opendir(const char *path)
         return NULL;
     }
     
-    const vfs_backend_config_t *backend = find_backend_by_mount(path);
-    if (!backend || !backend->ops->opendir) {
-        ESP_LOGE(TAG, "Backend does not support opendir: %s", path);
+    struct vfs_dir_s *dir = malloc(sizeof(struct vfs_dir_s));
+    if (!dir) {
         return NULL;
     }
     
-    vfs_dir_t native_dir = backend->ops->opendir(path);
-    if (!native_dir) {
+    MOUNT_LOCK();
+    vfs_mount_t *mount = find_mount(path);
+    if (!mount || !mount->config.ops->opendir) {
+        MOUNT_UNLOCK();
+        ESP_LOGE(TAG, "Backend does not support opendir: %s", path);
+        free(dir);
         return NULL;
     }
     
-    struct vfs_dir_s *dir = malloc(sizeof(struct vfs_dir_s));
-    if (!dir) {
-        backend->ops->closedir(native_dir);
+    dir->native_dir = mount->config.ops->opendir(path);
+    if (!dir->native_dir) {
+        MOUNT_UNLOCK();
+        free(dir);
         return NULL;
     }
     
-    dir->native_dir = native_dir;
-    dir->backend = backend;
+    dir->mount = mount;
     strncpy(dir->path, path, VFS_MAX_PATH - 1);
     dir->path[VFS_MAX_PATH - 1] = '\0';
+    dir->next = s_open_dirs;
+    s_open_dirs = dir;
+    MOUNT_UNLOCK();
     
     return dir;
 }
 
 esp_err_t vfs_readdir(vfs_dir_t dir, vfs_stat_t *entry)
 {
-    if (!dir || !entry || !dir->backend->ops->readdir) {
+    if (!dir || !entry) {
         return ESP_ERR_INVALID_ARG;
     }
     
-    return dir->backend->ops->readdir(dir->native_dir, entry);
+    MOUNT_LOCK();
+    esp_err_t ret = ESP_ERR_INVALID_STATE;
+    if (dir->mount) {
+        ret = dir->mount->config.ops->readdir ?
+            dir->mount->config.ops->readdir(dir->native_dir, entry) : ESP_ERR_INVALID_ARG;
+    }
+    MOUNT_UNLOCK();
+    return ret;
 }
 
 esp_err_t vfs_closedir(vfs_dir_t dir)
@@ -475,10 +901,22 @@ esp_err_t vfs_closedir(vfs_dir_t dir)
         return ESP_ERR_INVALID_ARG;
     }
     
-    esp_err_t ret = ESP_OK;
-    if (dir->backend->ops->closedir) {
-        ret = dir->backend->ops->closedir(dir->native_dir);
+    MOUNT_LOCK();
+    for (struct vfs_dir_s **p = &s_open_dirs; *p; p = &(*p)->next) {
+        if (*p == dir) {
+            *p = dir->next;
+            break;
+        }
+    }
+    
+    esp_err_t ret = ESP_ERR_INVALID_STATE;
+    if (dir->mount) {
+        ret = ESP_OK;
+        if (dir->mount->config.ops->closedir) {
+            ret = dir->mount->config.ops->closedir(dir->native_dir);
+        }
     }
+    MOUNT_UNLOCK();
     
     free(dir);
     return ret;
@@ -497,7 +935,9 @@ esp_err_t vfs_list_dir(const char *path, vfs_dir_callback_t callback, void *user
     
     vfs_stat_t entry;
     while (vfs_readdir(dir, &entry) == ESP_OK) {
-        callback(&entry, user_data);
+        if (!vfs_lineindex_is_sidecar(entry.name)) {
+            callback(&entry, user_data);
+        }
     }
     
     return vfs_closedir(dir);
@@ -513,12 +953,12 @@ esp_err_t vfs_statvfs(const char *path, vfs_statvfs_t *stat)
         return ESP_ERR_INVALID_ARG;
     }
     
-    const vfs_backend_config_t *backend = find_backend_by_mount(path);
-    if (!backend || !backend->ops->statvfs) {
+    const vfs_backend_ops_t *ops = find_ops(path);
+    if (!ops || !ops->statvfs) {
         return ESP_ERR_NOT_SUPPORTED;
     }
     
-    return backend->ops->statvfs(stat);
+    return ops->statvfs(stat);
 }
 
 esp_err_t vfs_get_free_space(const char *path, uint64_t *free_bytes)
@@ -564,6 +1004,31 @@ esp_err_t vfs_get_usage_percent(const char *path, float *percentage)
     return ret;
 }
 
+esp_err_t vfs_get_cache_stats(const char *path, vfs_cache_stats_t *stats)
+{
+    if (!path || !stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    MOUNT_LOCK();
+    vfs_mount_t *mount = find_mount(path);
+    if (mount) {
+        vfs_cache_get_stats(&mount->cache_stats, stats);
+    }
+    MOUNT_UNLOCK();
+    return mount ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+void vfs_reset_cache_stats(const char *path)
+{
+    MOUNT_LOCK();
+    vfs_mount_t *mount = find_mount(path);
+    if (mount) {
+        vfs_cache_reset_stats(&mount->cache_stats);
+    }
+    MOUNT_UNLOCK();
+}
+
 /* ============================================================================
  * HIGH-LEVEL HELPERS
  * ============================================================================ */
@@ -644,20 +1109,59 @@ esp_err_t vfs_copy_file(const char *src, const char *dst)
         return ESP_FAIL;
     }
     
-    uint8_t buffer[512];
+    // Several cache blocks per read: goes straight to the backend instead of
+    // filling the cache with data that is read once
+    uint8_t *buffer = malloc(VFS_COPY_CHUNK);
+    if (!buffer) {
+        vfs_close(fd_src);
+        vfs_close(fd_dst);
+        vfs_unlink(dst);
+        return ESP_ERR_NO_MEM;
+    }
+    
     ssize_t read_bytes;
     esp_err_t ret = ESP_OK;
     
-    while ((read_bytes = vfs_read(fd_src, buffer, sizeof(buffer))) > 0) {
+    while ((read_bytes = vfs_read(fd_src, buffer, VFS_COPY_CHUNK)) > 0) {
         if (vfs_write(fd_dst, buffer, read_bytes) != read_bytes) {
             ret = ESP_FAIL;
             break;
         }
     }
+    if (read_bytes < 0) {
+        ret = ESP_FAIL;
+    }
     
+    free(buffer);
     vfs_close(fd_src);
-    vfs_close(fd_dst);
+    if (vfs_close(fd_dst) != ESP_OK) {
+        ret = ESP_FAIL;
+    }
+    
+    if (ret != ESP_OK) {
+        vfs_unlink(dst);    // No half-copied file left behind
+    }
+    return ret;
+}
+
+esp_err_t vfs_move_file(const char *src, const char *dst)
+{
+    if (!src || !dst) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    
+    MOUNT_LOCK();
+    bool same_mount = find_mount(src) == find_mount(dst);
+    MOUNT_UNLOCK();
+    
+    if (same_mount) {
+        return vfs_rename(src, dst);
+    }
     
+    esp_err_t ret = vfs_copy_file(src, dst);
+    if (ret == ESP_OK) {
+        ret = vfs_unlink(src);
+    }
     return ret;
 }
 
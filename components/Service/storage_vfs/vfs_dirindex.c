@@ -0,0 +1,689 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file vfs_dirindex.c
+ * @brief Directory listing cache implementation
+ *
+ * The lock is never held while calling into vfs_core, and vfs_core calls
+ * vfs_dirindex_invalidate() with or without its own locks held, so this
+ * lock always comes last. A scan runs unlocked; its result is only kept if
+ * no invalidation happened in the meantime.
+ */
+
+#include "vfs_dirindex.h"
+#include "vfs_lineindex.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <string.h>
+#include <strings.h>
+#include <stdlib.h>
+
+static const char *TAG = "vfs_dirindex";
+
+#define ENTRY_HIDDEN    0x01
+#define ENTRY_READONLY  0x02
+
+typedef struct {
+    size_t size;
+    time_t mtime;
+    time_t ctime;
+    uint32_t name;                  // Offset in the name pool
+    uint8_t type;
+    uint8_t flags;
+} di_entry_t;
+
+typedef struct {
+    di_entry_t *entries;
+    char *names;
+    uint16_t *order;                // Sorted indexes, NULL = backend order
+    uint16_t count;
+    uint8_t order_sort;
+    uint8_t order_flags;
+    uint32_t files;
+    uint32_t dirs;
+    size_t bytes;                   // Heap held by this listing
+} di_listing_t;
+
+typedef struct {
+    bool in_use;
+    uint32_t last_used;
+    char path[VFS_MAX_PATH];
+    di_listing_t list;
+} di_dir_t;
+
+typedef struct {
+    bool in_use;
+    uint32_t last_used;
+    char path[VFS_MAX_PATH];
+    uint64_t size;
+    uint32_t files;
+} di_total_t;
+
+static SemaphoreHandle_t s_lock = NULL;
+static di_dir_t s_dirs[VFS_DIRINDEX_DIRS];
+static di_total_t s_totals[VFS_DIRINDEX_TOTALS];
+static size_t s_bytes = 0;
+static uint32_t s_tick = 0;         // LRU clock
+static uint32_t s_seq = 0;          // Bumped by every invalidation
+static vfs_dirindex_stats_t s_stats;
+
+// qsort() has no context argument; only used with the lock held
+static const di_listing_t *s_sort_list;
+static vfs_dirindex_sort_t s_sort_key;
+static int s_sort_flags;
+
+#define LOCK()      xSemaphoreTake(s_lock, portMAX_DELAY)
+#define UNLOCK()    xSemaphoreGive(s_lock)
+
+/* ============================================================================
+ * HELPER FUNCTIONS
+ * ============================================================================ */
+
+// Collapse repeated slashes and drop the trailing one ("/a//b/" -> "/a/b")
+static void normalize(const char *path, char *out)
+{
+    size_t n = 0;
+    for (const char *p = path; *p && n < VFS_MAX_PATH - 1; p++) {
+        if (*p == '/' && n > 0 && out[n - 1] == '/') continue;
+        out[n++] = *p;
+    }
+    if (n > 1 && out[n - 1] == '/') n--;
+    out[n] = '\0';
+}
+
+// true if path is dir itself or something under it
+static bool path_within(const char *path, const char *dir)
+{
+    size_t len = strlen(dir);
+    if (len == 1 && dir[0] == '/') {
+        return true;
+    }
+    return strncmp(path, dir, len) == 0 && (path[len] == '\0' || path[len] == '/');
+}
+
+static void free_listing(di_listing_t *l)
+{
+    free(l->entries);
+    free(l->names);
+    free(l->order);
+    memset(l, 0, sizeof(*l));
+}
+
+static void drop_dir(di_dir_t *d)
+{
+    s_bytes -= d->list.bytes;
+    free_listing(&d->list);
+    d->in_use = false;
+    s_stats.invalidations++;
+}
+
+static di_dir_t *find_dir(const char *path)
+{
+    for (int i = 0; i < VFS_DIRINDEX_DIRS; i++) {
+        if (s_dirs[i].in_use && strcmp(s_dirs[i].path, path) == 0) {
+            return &s_dirs[i];
+        }
+    }
+    return NULL;
+}
+
+static di_total_t *find_total(const char *path)
+{
+    for (int i = 0; i < VFS_DIRINDEX_TOTALS; i++) {
+        if (s_totals[i].in_use && strcmp(s_totals[i].path, path) == 0) {
+            return &s_totals[i];
+        }
+    }
+    return NULL;
+}
+
+// Least recently used listing other than keep; NULL if none
+static di_dir_t *lru_dir(const di_dir_t *keep)
+{
+    di_dir_t *lru = NULL;
+    for (int i = 0; i < VFS_DIRINDEX_DIRS; i++) {
+        di_dir_t *d = &s_dirs[i];
+        if (d->in_use && d != keep && (!lru || d->last_used < lru->last_used)) {
+            lru = d;
+        }
+    }
+    return lru;
+}
+
+// Evict listings until the budget holds (keep stays even if it alone is over)
+static void trim(const di_dir_t *keep)
+{
+    while (s_bytes > VFS_DIRINDEX_BUDGET) {
+        di_dir_t *victim = lru_dir(keep);
+        if (!victim) break;
+        drop_dir(victim);
+    }
+}
+
+// Read a whole directory. Called without the lock.
+static esp_err_t scan(const char *path, di_listing_t *l)
+{
+    memset(l, 0, sizeof(*l));
+
+    vfs_dir_t dir = vfs_opendir(path);
+    if (!dir) {
+        return ESP_FAIL;
+    }
+
+    size_t cap = 0, names_cap = 0, names_len = 0;
+    esp_err_t ret = ESP_OK;
+    vfs_stat_t st;
+
+    while (vfs_readdir(dir, &st) == ESP_OK) {
+        if (strcmp(st.name, ".") == 0 || strcmp(st.name, "..") == 0 ||
+            vfs_lineindex_is_sidecar(st.name)) {
+            continue;
+        }
+        if (l->count == VFS_DIRINDEX_MAX_ENTRIES) {
+            ESP_LOGW(TAG, "%s: more than %d entries, listing the first ones",
+                     path, VFS_DIRINDEX_MAX_ENTRIES);
+            break;
+        }
+
+        size_t len = strlen(st.name) + 1;
+        if (l->count == cap) {
+            cap = cap ? cap * 2 : 16;
+            di_entry_t *grown = realloc(l->entries, cap * sizeof(di_entry_t));
+            if (!grown) {
+                ret = ESP_ERR_NO_MEM;
+                break;
+            }
+            l->entries = grown;
+        }
+        if (names_len + len > names_cap) {
+            names_cap = (names_len + len) * 2;
+            char *grown = realloc(l->names, names_cap);
+            if (!grown) {
+                ret = ESP_ERR_NO_MEM;
+                break;
+            }
+            l->names = grown;
+        }
+
+        di_entry_t *e = &l->entries[l->count++];
+        memcpy(&l->names[names_len], st.name, len);
+        e->name = names_len;
+        e->size = st.size;
+        e->mtime = st.mtime;
+        e->ctime = st.ctime;
+        e->type = st.type;
+        e->flags = (st.is_hidden ? ENTRY_HIDDEN : 0) | (st.is_readonly ? ENTRY_READONLY : 0);
+        names_len += len;
+
+        if (st.type == VFS_TYPE_DIR) {
+            l->dirs++;
+        } else {
+            l->files++;
+        }
+    }
+    vfs_closedir(dir);
+
+    if (ret != ESP_OK) {
+        free_listing(l);
+        return ret;
+    }
+
+    // Give back the slack before the listing is kept
+    if (l->count > 0) {
+        di_entry_t *e = realloc(l->entries, l->count * sizeof(di_entry_t));
+        char *n = realloc(l->names, names_len);
+        if (e) l->entries = e;
+        if (n) l->names = n;
+    }
+    l->bytes = l->count * sizeof(di_entry_t) + names_len;
+    return ESP_OK;
+}
+
+static int compare(const void *a, const void *b)
+{
+    uint16_t ia = *(const uint16_t *)a, ib = *(const uint16_t *)b;
+    const di_entry_t *x = &s_sort_list->entries[ia];
+    const di_entry_t *y = &s_sort_list->entries[ib];
+
+    if ((s_sort_flags & VFS_DIRINDEX_DIRS_FIRST) && x->type != y->type) {
+        return (x->type == VFS_TYPE_DIR) ? -1 : 1;
+    }
+
+    int r = 0;
+    switch (s_sort_key) {
+        case VFS_DIRINDEX_SORT_SIZE:
+            r = (x->size > y->size) - (x->size < y->size);
+            break;
+        case VFS_DIRINDEX_SORT_MTIME:
+            r = (x->mtime > y->mtime) - (x->mtime < y->mtime);
+            break;
+        case VFS_DIRINDEX_SORT_NONE:
+            r = (ia > ib) - (ia < ib);
+            break;
+        default:
+            break;
+    }
+    if (r == 0) {
+        const char *nx = &s_sort_list->names[x->name];
+        const char *ny = &s_sort_list->names[y->name];
+        r = strcasecmp(nx, ny);
+        if (r == 0) r = strcmp(nx, ny);
+    }
+    return (s_sort_flags & VFS_DIRINDEX_DESC) ? -r : r;
+}
+
+// Build the sorted index for this order if the listing does not have it yet
+static esp_err_t ensure_order(di_listing_t *l, vfs_dirindex_sort_t sort, int flags)
+{
+    if (sort == VFS_DIRINDEX_SORT_NONE && flags == 0) {
+        return ESP_OK;      // Plain backend order, no index needed
+    }
+    if (l->order && l->order_sort == sort && l->order_flags == flags) {
+        return ESP_OK;
+    }
+    if (l->count == 0) {
+        return ESP_OK;
+    }
+
+    if (!l->order) {
+        l->order = malloc(l->count * sizeof(uint16_t));
+        if (!l->order) {
+            return ESP_ERR_NO_MEM;
+        }
+        l->bytes += l->count * sizeof(uint16_t);
+    }
+    for (uint16_t i = 0; i < l->count; i++) {
+        l->order[i] = i;
+    }
+
+    s_sort_list = l;
+    s_sort_key = sort;
+    s_sort_flags = flags;
+    qsort(l->order, l->count, sizeof(uint16_t), compare);
+
+    l->order_sort = sort;
+    l->order_flags = flags;
+    return ESP_OK;
+}
+
+// Keep a scanned listing. Returns false if it does not fit (caller frees it).
+static bool install(const char *path, di_listing_t *l)
+{
+    if (l->bytes > VFS_DIRINDEX_BUDGET) {
+        s_stats.uncached++;
+        return false;
+    }
+
+    di_dir_t *slot = NULL;
+    for (int i = 0; i < VFS_DIRINDEX_DIRS && !slot; i++) {
+        if (!s_dirs[i].in_use) slot = &s_dirs[i];
+    }
+    if (!slot) {
+        slot = lru_dir(NULL);
+        drop_dir(slot);
+        s_stats.invalidations--;    // Eviction, not a change
+    }
+
+    slot->in_use = true;
+    slot->last_used = ++s_tick;
+    strcpy(slot->path, path);
+    slot->list = *l;
+    s_bytes += l->bytes;
+    trim(slot);
+    return true;
+}
+
+typedef esp_err_t (*di_query_fn_t)(di_listing_t *l, bool cached, void *arg);
+
+// Run fn on the listing of path, cached or freshly read. fn runs with the lock held.
+static esp_err_t query(const char *path, di_query_fn_t fn, void *arg)
+{
+    if (!s_lock) {
+        return ESP_ERR_INVALID_STATE;   // Nothing mounted yet
+    }
+
+    char key[VFS_MAX_PATH];
+    normalize(path, key);
+
+    LOCK();
+    di_dir_t *d = find_dir(key);
+    if (d) {
+        s_stats.hits++;
+        d->last_used = ++s_tick;
+        size_t before = d->list.bytes;
+        esp_err_t ret = fn(&d->list, true, arg);
+        s_bytes += d->list.bytes - before;     // A new sort index
+        trim(d);
+        UNLOCK();
+        return ret;
+    }
+    uint32_t seq = s_seq;
+    UNLOCK();
+
+    di_listing_t l;
+    esp_err_t ret = scan(key, &l);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    LOCK();
+    s_stats.scans++;
+    ret = fn(&l, false, arg);
+    // A change during the scan may have been missed: answer, but do not keep it
+    if (!(VFS_DIRINDEX_BUDGET > 0 && seq == s_seq && !find_dir(key) && install(key, &l))) {
+        free_listing(&l);
+    }
+    UNLOCK();
+    return ret;
+}
+
+/* ============================================================================
+ * QUERIES
+ * ============================================================================ */
+
+typedef struct {
+    vfs_dirindex_sort_t sort;
+    int flags;
+    size_t offset;
+    vfs_stat_t *entries;
+    size_t max;
+    size_t *count;
+    size_t *total;
+} list_args_t;
+
+static esp_err_t list_fn(di_listing_t *l, bool cached, void *arg)
+{
+    list_args_t *a = arg;
+
+    esp_err_t ret = ensure_order(l, a->sort, a->flags);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    bool ordered = !(a->sort == VFS_DIRINDEX_SORT_NONE && a->flags == 0);
+
+    size_t n = 0;
+    for (size_t k = a->offset; k < l->count && n < a->max; k++, n++) {
+        const di_entry_t *e = &l->entries[ordered ? l->order[k] : k];
+        vfs_stat_t *st = &a->entries[n];
+
+        strncpy(st->name, &l->names[e->name], VFS_MAX_NAME - 1);
+        st->name[VFS_MAX_NAME - 1] = '\0';
+        st->type = e->type;
+        st->size = e->size;
+        st->mtime = e->mtime;
+        st->ctime = e->ctime;
+        st->is_hidden = e->flags & ENTRY_HIDDEN;
+        st->is_readonly = e->flags & ENTRY_READONLY;
+    }
+
+    if (a->count) *a->count = n;
+    if (a->total) *a->total = l->count;
+    return ESP_OK;
+}
+
+esp_err_t vfs_dirindex_list(const char *path, vfs_dirindex_sort_t sort, int flags,
+                            size_t offset, vfs_stat_t *entries, size_t max,
+                            size_t *count, size_t *total)
+{
+    if (!path || (!entries && max > 0) || sort > VFS_DIRINDEX_SORT_MTIME) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    list_args_t args = {
+        .sort = sort,
+        .flags = flags & (VFS_DIRINDEX_DESC | VFS_DIRINDEX_DIRS_FIRST),
+        .offset = offset,
+        .entries = entries,
+        .max = max,
+        .count = count,
+        .total = total,
+    };
+    return query(path, list_fn, &args);
+}
+
+typedef struct {
+    uint32_t *files;
+    uint32_t *dirs;
+} count_args_t;
+
+static esp_err_t count_fn(di_listing_t *l, bool cached, void *arg)
+{
+    count_args_t *a = arg;
+    *a->files = l->files;
+    *a->dirs = l->dirs;
+    return ESP_OK;
+}
+
+esp_err_t vfs_dirindex_count(const char *path, uint32_t *file_count, uint32_t *dir_count)
+{
+    if (!path || !file_count || !dir_count) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    count_args_t args = { .files = file_count, .dirs = dir_count };
+    return query(path, count_fn, &args);
+}
+
+// Add up path (a VFS_MAX_PATH buffer, extended in place for subdirectories)
+static esp_err_t walk(char *path, int depth, uint64_t *size, uint32_t *files)
+{
+    if (depth > 0) {
+        LOCK();
+        di_total_t *t = find_total(path);
+        if (t) {
+            s_stats.total_hits++;
+            *size += t->size;
+            *files += t->files;
+        }
+        UNLOCK();
+        if (t) {
+            return ESP_OK;
+        }
+    }
+
+    vfs_dir_t dir = vfs_opendir(path);
+    if (!dir) {
+        return ESP_FAIL;
+    }
+
+    size_t len = strlen(path);
+    vfs_stat_t st;
+
+    while (vfs_readdir(dir, &st) == ESP_OK) {
+        if (st.type != VFS_TYPE_DIR) {
+            if (vfs_lineindex_is_sidecar(st.name)) {
+                continue;
+            }
+            *size += st.size;
+            (*files)++;
+            continue;
+        }
+        if (strcmp(st.name, ".") == 0 || strcmp(st.name, "..") == 0 ||
+            depth + 1 > VFS_DIRINDEX_MAX_DEPTH) {
+            continue;
+        }
+        if (len + 1 + strlen(st.name) >= VFS_MAX_PATH) {
+            continue;
+        }
+
+        snprintf(&path[len], VFS_MAX_PATH - len, "%s%s", (len == 1) ? "" : "/", st.name);
+        walk(path, depth + 1, size, files);     // An unreadable subdirectory counts as empty
+        path[len] = '\0';
+    }
+
+    vfs_closedir(dir);
+    return ESP_OK;
+}
+
+esp_err_t vfs_dirindex_tree_size(const char *path, uint64_t *total_size, uint32_t *file_count)
+{
+    if (!path || !total_size) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    char key[VFS_MAX_PATH];
+    normalize(path, key);
+
+    LOCK();
+    di_total_t *t = find_total(key);
+    if (t) {
+        s_stats.total_hits++;
+        t->last_used = ++s_tick;
+        *total_size = t->size;
+        if (file_count) *file_count = t->files;
+        UNLOCK();
+        return ESP_OK;
+    }
+    uint32_t seq = s_seq;
+    UNLOCK();
+
+    char buf[VFS_MAX_PATH];
+    strcpy(buf, key);
+    uint64_t size = 0;
+    uint32_t files = 0;
+
+    esp_err_t ret = walk(buf, 0, &size, &files);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    LOCK();
+    if (seq == s_seq && !find_total(key)) {
+        di_total_t *slot = NULL;
+        for (int i = 0; i < VFS_DIRINDEX_TOTALS; i++) {
+            di_total_t *c = &s_totals[i];
+            if (!c->in_use) {
+                slot = c;
+                break;
+            }
+            if (!slot || c->last_used < slot->last_used) {
+                slot = c;
+            }
+        }
+        slot->in_use = true;
+        slot->last_used = ++s_tick;
+        strcpy(slot->path, key);
+        slot->size = size;
+        slot->files = files;
+    }
+    UNLOCK();
+
+    *total_size = size;
+    if (file_count) *file_count = files;
+    return ESP_OK;
+}
+
+/* ============================================================================
+ * INVALIDATION
+ * ============================================================================ */
+
+esp_err_t vfs_dirindex_init(void)
+{
+    if (!s_lock) {
+        s_lock = xSemaphoreCreateMutex();
+    }
+    return s_lock ? ESP_OK : ESP_ERR_NO_MEM;
+}
+
+void vfs_dirindex_invalidate(const char *path)
+{
+    if (!s_lock || !path) {
+        return;
+    }
+
+    char key[VFS_MAX_PATH];
+    normalize(path, key);
+
+    // Parent directory: everything before the last slash ("/" for "/a")
+    char parent[VFS_MAX_PATH];
+    strcpy(parent, key);
+    char *slash = strrchr(parent, '/');
+    if (slash) {
+        slash[slash == parent ? 1 : 0] = '\0';
+    }
+
+    LOCK();
+    s_seq++;
+    for (int i = 0; i < VFS_DIRINDEX_DIRS; i++) {
+        di_dir_t *d = &s_dirs[i];
+        if (d->in_use && (strcmp(d->path, parent) == 0 || path_within(d->path, key))) {
+            drop_dir(d);
+        }
+    }
+    for (int i = 0; i < VFS_DIRINDEX_TOTALS; i++) {
+        di_total_t *t = &s_totals[i];
+        if (t->in_use && (path_within(key, t->path) || path_within(t->path, key))) {
+            t->in_use = false;
+            s_stats.invalidations++;
+        }
+    }
+    UNLOCK();
+}
+
+void vfs_dirindex_clear(void)
+{
+    if (!s_lock) {
+        return;
+    }
+
+    LOCK();
+    s_seq++;
+    for (int i = 0; i < VFS_DIRINDEX_DIRS; i++) {
+        if (s_dirs[i].in_use) {
+            drop_dir(&s_dirs[i]);
+        }
+    }
+    for (int i = 0; i < VFS_DIRINDEX_TOTALS; i++) {
+        s_totals[i].in_use = false;
+    }
+    UNLOCK();
+}
+
+/* ============================================================================
+ * STATISTICS
+ * ============================================================================ */
+
+esp_err_t vfs_dirindex_get_stats(vfs_dirindex_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_lock) {
+        memset(stats, 0, sizeof(*stats));
+        return ESP_OK;
+    }
+
+    LOCK();
+    *stats = s_stats;
+    stats->bytes_used = s_bytes;
+    UNLOCK();
+    return ESP_OK;
+}
+
+void vfs_dirindex_reset_stats(void)
+{
+    if (!s_lock) {
+        return;
+    }
+
+    LOCK();
+    memset(&s_stats, 0, sizeof(s_stats));
+    UNLOCK();
+}
@@ -0,0 +1,680 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file vfs_lineindex.c
+ * @brief Line offset index implementation
+ *
+ * One lock serializes index updates, including the file I/O they need. It
+ * is taken before any vfs_core lock and vfs_core never calls back in here.
+ * Lines are read with the lock released.
+ */
+
+#include "vfs_lineindex.h"
+#include "vfs_stream.h"
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+static const char *TAG = "vfs_lineindex";
+
+#define FINGERPRINT_LEN     32                  // Bytes hashed at each end
+#define SIDECAR_MAGIC       0x3158494C          // "LIX1"
+
+typedef struct {
+    bool in_use;
+    bool dirty;                 // Changed since loaded or saved
+    uint32_t last_used;
+    char path[VFS_MAX_PATH];
+    uint32_t stride;            // Lines between two marks
+    uint32_t *marks;            // marks[k]: offset of line k * stride + 1
+    uint32_t mark_count;
+    uint32_t mark_cap;
+    uint32_t newlines;          // '\n' in [0, scanned)
+    uint32_t scanned;           // Bytes indexed
+    uint32_t tail_start;        // Offset after the last '\n'
+    uint32_t head_hash;         // First bytes of the file
+    uint32_t tail_hash;         // Bytes just before scanned
+} li_index_t;
+
+// Sidecar layout: this header, then mark_count offsets
+typedef struct {
+    uint32_t magic;
+    uint32_t stride;
+    uint32_t mark_count;
+    uint32_t newlines;
+    uint32_t scanned;
+    uint32_t tail_start;
+    uint32_t head_hash;
+    uint32_t tail_hash;
+} li_header_t;
+
+static SemaphoreHandle_t s_lock = NULL;
+static li_index_t s_index[VFS_LINEINDEX_FILES];
+static uint32_t s_tick = 0;
+static vfs_lineindex_stats_t s_stats;
+
+#define LOCK()      xSemaphoreTake(s_lock, portMAX_DELAY)
+#define UNLOCK()    xSemaphoreGive(s_lock)
+
+/* ============================================================================
+ * HELPER FUNCTIONS
+ * ============================================================================ */
+
+static uint32_t fnv1a(const uint8_t *data, size_t len)
+{
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) {
+        h = (h ^ data[i]) * 16777619u;
+    }
+    return h;
+}
+
+// Hash the first bytes of the file and the ones just before end
+static esp_err_t fingerprint(vfs_fd_t fd, uint32_t end, uint32_t *head, uint32_t *tail)
+{
+    uint8_t buf[FINGERPRINT_LEN];
+    size_t len = (end < FINGERPRINT_LEN) ? end : FINGERPRINT_LEN;
+
+    if (vfs_lseek(fd, 0, VFS_SEEK_SET) < 0 || vfs_read(fd, buf, len) != (ssize_t)len) {
+        return ESP_FAIL;
+    }
+    *head = fnv1a(buf, len);
+
+    if (vfs_lseek(fd, end - len, VFS_SEEK_SET) < 0 || vfs_read(fd, buf, len) != (ssize_t)len) {
+        return ESP_FAIL;
+    }
+    *tail = fnv1a(buf, len);
+    return ESP_OK;
+}
+
+static void sidecar_path(const char *path, char *out)
+{
+    snprintf(out, VFS_MAX_PATH, "%s%s", path, VFS_LINEINDEX_SIDECAR_EXT);
+}
+
+static void reset(li_index_t *idx)
+{
+    idx->stride = VFS_LINEINDEX_STRIDE;
+    idx->mark_count = 1;
+    idx->marks[0] = 0;
+    idx->newlines = 0;
+    idx->scanned = 0;
+    idx->tail_start = 0;
+    idx->head_hash = idx->tail_hash = 0;
+    idx->dirty = true;
+}
+
+static uint32_t total_lines(const li_index_t *idx)
+{
+    return idx->newlines + (idx->scanned > idx->tail_start ? 1 : 0);
+}
+
+// Record that a line starts at offset (line number newlines + 1)
+static esp_err_t add_line_start(li_index_t *idx, uint32_t offset)
+{
+    if (idx->newlines % idx->stride != 0) {
+        return ESP_OK;
+    }
+
+    if (idx->mark_count == VFS_LINEINDEX_MAX_MARKS) {
+        // Full: keep every other mark and double the stride
+        for (uint32_t k = 1; 2 * k < idx->mark_count; k++) {
+            idx->marks[k] = idx->marks[2 * k];
+        }
+        idx->mark_count = (idx->mark_count + 1) / 2;
+        idx->stride *= 2;
+        if (idx->newlines % idx->stride != 0) {
+            return ESP_OK;
+        }
+    }
+
+    if (idx->mark_count == idx->mark_cap) {
+        uint32_t cap = idx->mark_cap * 2;
+        if (cap > VFS_LINEINDEX_MAX_MARKS) cap = VFS_LINEINDEX_MAX_MARKS;
+        uint32_t *grown = realloc(idx->marks, cap * sizeof(uint32_t));
+        if (!grown) {
+            return ESP_ERR_NO_MEM;
+        }
+        idx->marks = grown;
+        idx->mark_cap = cap;
+    }
+    idx->marks[idx->mark_count++] = offset;
+    return ESP_OK;
+}
+
+// Index the bytes from idx->scanned to the end of the file
+static esp_err_t extend(li_index_t *idx, const char *path)
+{
+    vfs_stream_t stream;
+    if (vfs_stream_open(&stream, path) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    if (vfs_stream_seek(&stream, idx->scanned) != ESP_OK) {
+        vfs_stream_close(&stream);
+        return ESP_FAIL;
+    }
+
+    uint32_t start = idx->scanned;
+    esp_err_t ret = ESP_OK;
+    const uint8_t *data;
+    ssize_t len;
+
+    while (ret == ESP_OK && (len = vfs_stream_peek(&stream, &data)) > 0) {
+        const uint8_t *p = data;
+        const uint8_t *end = data + len;
+
+        while ((p = memchr(p, '\n', end - p)) != NULL) {
+            p++;
+            idx->newlines++;
+            idx->tail_start = idx->scanned + (p - data);
+            ret = add_line_start(idx, idx->tail_start);
+            if (ret != ESP_OK) break;
+        }
+        idx->scanned += len;
+        vfs_stream_consume(&stream, len);
+    }
+    if (vfs_stream_error(&stream)) {
+        ret = ESP_FAIL;
+    }
+    vfs_stream_close(&stream);
+
+    s_stats.scanned_bytes += idx->scanned - start;
+    if (idx->scanned != start) {
+        idx->dirty = true;
+    }
+    return ret;
+}
+
+static esp_err_t sidecar_save(li_index_t *idx)
+{
+    char side[VFS_MAX_PATH];
+    sidecar_path(idx->path, side);
+
+    li_header_t h = {
+        .magic = SIDECAR_MAGIC,
+        .stride = idx->stride,
+        .mark_count = idx->mark_count,
+        .newlines = idx->newlines,
+        .scanned = idx->scanned,
+        .tail_start = idx->tail_start,
+        .head_hash = idx->head_hash,
+        .tail_hash = idx->tail_hash,
+    };
+
+    vfs_fd_t fd = vfs_open(side, VFS_O_WRONLY | VFS_O_CREAT | VFS_O_TRUNC, 0644);
+    if (fd == VFS_INVALID_FD) {
+        return ESP_FAIL;
+    }
+    size_t marks = idx->mark_count * sizeof(uint32_t);
+    bool ok = vfs_write(fd, &h, sizeof(h)) == sizeof(h) &&
+              vfs_write(fd, idx->marks, marks) == (ssize_t)marks;
+    vfs_close(fd);
+
+    if (!ok) {
+        vfs_unlink(side);   // Never leave a half-written sidecar
+        return ESP_FAIL;
+    }
+    idx->dirty = false;
+    s_stats.sidecar_saves++;
+    ESP_LOGD(TAG, "Saved %s (%" PRIu32 " lines)", side, total_lines(idx));
+    return ESP_OK;
+}
+
+// Fill a fresh index from the sidecar; ESP_ERR_NOT_FOUND if there is none
+static esp_err_t sidecar_load(li_index_t *idx)
+{
+    char side[VFS_MAX_PATH];
+    sidecar_path(idx->path, side);
+
+    vfs_stat_t st;
+    if (vfs_stat(side, &st) != ESP_OK) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    vfs_fd_t fd = vfs_open(side, VFS_O_RDONLY, 0);
+    if (fd == VFS_INVALID_FD) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    li_header_t h;
+    esp_err_t ret = ESP_FAIL;
+    if (vfs_read(fd, &h, sizeof(h)) == sizeof(h) && h.magic == SIDECAR_MAGIC &&
+        h.mark_count >= 1 && h.mark_count <= VFS_LINEINDEX_MAX_MARKS && h.stride > 0) {
+        uint32_t *marks = realloc(idx->marks, h.mark_count * sizeof(uint32_t));
+        if (marks) {
+            idx->marks = marks;
+            idx->mark_cap = h.mark_count;
+            size_t bytes = h.mark_count * sizeof(uint32_t);
+            if (vfs_read(fd, idx->marks, bytes) == (ssize_t)bytes) {
+                ret = ESP_OK;
+            }
+        }
+    }
+    vfs_close(fd);
+
+    if (ret != ESP_OK) {
+        ESP_LOGW(TAG, "Ignoring damaged sidecar %s", side);
+        return ret;
+    }
+
+    idx->stride = h.stride;
+    idx->mark_count = h.mark_count;
+    idx->newlines = h.newlines;
+    idx->scanned = h.scanned;
+    idx->tail_start = h.tail_start;
+    idx->head_hash = h.head_hash;
+    idx->tail_hash = h.tail_hash;
+    idx->dirty = false;
+    s_stats.sidecar_loads++;
+    return ESP_OK;
+}
+
+static bool sidecar_wanted(const li_index_t *idx)
+{
+    return VFS_LINEINDEX_SIDECAR_MIN > 0 && idx->scanned >= VFS_LINEINDEX_SIDECAR_MIN;
+}
+
+static void drop(li_index_t *idx, bool save)
+{
+    if (save && idx->dirty && sidecar_wanted(idx)) {
+        sidecar_save(idx);
+    }
+    free(idx->marks);
+    memset(idx, 0, sizeof(*idx));
+}
+
+// Index of path, from RAM, from its sidecar or empty (LRU slot reused)
+static li_index_t *get_index(const char *path)
+{
+    li_index_t *slot = NULL;
+    for (int i = 0; i < VFS_LINEINDEX_FILES; i++) {
+        li_index_t *idx = &s_index[i];
+        if (idx->in_use && strcmp(idx->path, path) == 0) {
+            idx->last_used = ++s_tick;
+            return idx;
+        }
+        if (!slot || (slot->in_use && (!idx->in_use || idx->last_used < slot->last_used))) {
+            slot = idx;
+        }
+    }
+
+    if (slot->in_use) {
+        drop(slot, true);
+    }
+
+    slot->marks = malloc(16 * sizeof(uint32_t));
+    if (!slot->marks) {
+        return NULL;
+    }
+    slot->mark_cap = 16;
+    slot->in_use = true;
+    slot->last_used = ++s_tick;
+    strncpy(slot->path, path, VFS_MAX_PATH - 1);
+
+    if (sidecar_load(slot) != ESP_OK) {
+        reset(slot);
+    }
+    return slot;
+}
+
+// Bring the index up to date with the file
+static esp_err_t refresh(li_index_t *idx)
+{
+    vfs_stat_t st;
+    if (vfs_stat(idx->path, &st) != ESP_OK) {
+        return ESP_FAIL;
+    }
+
+    bool stale = st.size < idx->scanned;
+    if (!stale && idx->scanned > 0) {
+        vfs_fd_t fd = vfs_open(idx->path, VFS_O_RDONLY, 0);
+        if (fd == VFS_INVALID_FD) {
+            return ESP_FAIL;
+        }
+        uint32_t head, tail;
+        stale = fingerprint(fd, idx->scanned, &head, &tail) != ESP_OK ||
+                head != idx->head_hash || tail != idx->tail_hash;
+        vfs_close(fd);
+    }
+
+    if (stale) {
+        ESP_LOGD(TAG, "%s changed, rebuilding", idx->path);
+        s_stats.rebuilds++;
+        reset(idx);
+    } else if (st.size == idx->scanned) {
+        s_stats.hits++;
+        return ESP_OK;
+    }
+
+    if (idx->scanned == 0) {
+        s_stats.builds++;
+    } else {
+        s_stats.extends++;
+    }
+
+    uint32_t before = idx->scanned;
+    esp_err_t ret = extend(idx, idx->path);
+    if (ret != ESP_OK) {
+        reset(idx);     // Half an index is worse than none
+        return ret;
+    }
+
+    if (idx->scanned > 0) {
+        vfs_fd_t fd = vfs_open(idx->path, VFS_O_RDONLY, 0);
+        if (fd == VFS_INVALID_FD ||
+            fingerprint(fd, idx->scanned, &idx->head_hash, &idx->tail_hash) != ESP_OK) {
+            ret = ESP_FAIL;
+        }
+        if (fd != VFS_INVALID_FD) {
+            vfs_close(fd);
+        }
+    }
+
+    // A long scan is worth keeping across resets right away
+    if (ret == ESP_OK && sidecar_wanted(idx) && idx->scanned - before >= VFS_LINEINDEX_SIDECAR_MIN) {
+        sidecar_save(idx);
+    }
+    return ret;
+}
+
+/**
+ * Where reading starts: the first line wanted (first, or the last tail lines
+ * when tail > 0), the mark at or before it and the lines to skip after it.
+ */
+typedef struct {
+    uint32_t total;
+    uint32_t line;
+    uint32_t offset;
+    uint32_t skip;
+} li_pos_t;
+
+static esp_err_t prepare(const char *path, uint32_t first, uint32_t tail, li_pos_t *pos)
+{
+    if (!s_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    LOCK();
+    li_index_t *idx = get_index(path);
+    esp_err_t ret = idx ? refresh(idx) : ESP_ERR_NO_MEM;
+    if (ret == ESP_OK) {
+        pos->total = total_lines(idx);
+        pos->line = first;
+        if (tail > 0) {
+            pos->line = (pos->total > tail) ? pos->total - tail + 1 : 1;
+        }
+
+        if (pos->line == 0 || pos->line > pos->total) {
+            ret = ESP_ERR_NOT_FOUND;
+        } else {
+            uint32_t k = (pos->line - 1) / idx->stride;
+            pos->offset = idx->marks[k];
+            pos->skip = (pos->line - 1) - k * idx->stride;
+        }
+    } else if (idx) {
+        drop(idx, false);
+    }
+    UNLOCK();
+    return ret;
+}
+
+// Copy the next line into buf (cut to size - 1), consuming it whole. -1 at end.
+// offset (optional) is advanced by the bytes consumed.
+static ssize_t next_line(vfs_stream_t *s, char *buf, size_t size, uint32_t *offset)
+{
+    size_t stored = 0;
+    bool any = false;
+    const uint8_t *data;
+    ssize_t len;
+
+    while ((len = vfs_stream_peek(s, &data)) > 0) {
+        any = true;
+        const uint8_t *hit = memchr(data, '\n', len);
+        size_t n = hit ? (size_t)(hit - data) : (size_t)len;
+
+        if (buf && stored < size - 1) {
+            size_t copy = (n < size - 1 - stored) ? n : size - 1 - stored;
+            memcpy(&buf[stored], data, copy);
+            stored += copy;
+        }
+        vfs_stream_consume(s, hit ? n + 1 : n);
+        if (offset) {
+            *offset += hit ? n + 1 : n;
+        }
+        if (hit) break;
+    }
+
+    if (buf) {
+        buf[stored] = '\0';
+    }
+    return any ? (ssize_t)stored : -1;
+}
+
+/* ============================================================================
+ * QUERIES
+ * ============================================================================ */
+
+esp_err_t vfs_lineindex_count(const char *path, uint32_t *lines)
+{
+    if (!path || !lines) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    li_pos_t pos;
+    esp_err_t ret = prepare(path, 1, 0, &pos);
+    if (ret == ESP_ERR_NOT_FOUND) {
+        *lines = 0;     // Empty file
+        return ESP_OK;
+    }
+    if (ret == ESP_OK) {
+        *lines = pos.total;
+    }
+    return ret;
+}
+
+esp_err_t vfs_lineindex_locate(const char *path, uint32_t line, size_t *offset)
+{
+    if (!path || !offset || line == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    li_pos_t pos;
+    esp_err_t ret = prepare(path, line, 0, &pos);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    if (pos.skip == 0) {
+        *offset = pos.offset;
+        return ESP_OK;
+    }
+
+    vfs_stream_t stream;
+    if (vfs_stream_open(&stream, path) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    vfs_stream_seek(&stream, pos.offset);
+    uint32_t at = pos.offset;
+    for (uint32_t i = 0; i < pos.skip; i++) {
+        next_line(&stream, NULL, 0, &at);
+    }
+    ret = vfs_stream_error(&stream) ? ESP_FAIL : ESP_OK;
+    vfs_stream_close(&stream);
+
+    if (ret == ESP_OK) {
+        *offset = at;
+    }
+    return ret;
+}
+
+static esp_err_t read_from(const char *path, const li_pos_t *pos, uint32_t count,
+                           vfs_lineindex_callback_t callback, void *user_data)
+{
+    vfs_stream_t stream;
+    if (vfs_stream_open(&stream, path) != ESP_OK) {
+        return ESP_FAIL;
+    }
+    vfs_stream_seek(&stream, pos->offset);
+
+    for (uint32_t i = 0; i < pos->skip; i++) {
+        next_line(&stream, NULL, 0, NULL);
+    }
+
+    // Stop at the total seen by the index; lines appended since are left out
+    uint32_t last = pos->line + count - 1;
+    if (last < pos->line || last > pos->total) {
+        last = pos->total;
+    }
+
+    char line[VFS_LINEINDEX_LINE_MAX];
+    for (uint32_t n = pos->line; n <= last; n++) {
+        if (next_line(&stream, line, sizeof(line), NULL) < 0) {
+            break;
+        }
+        callback(line, n, user_data);
+    }
+
+    esp_err_t ret = vfs_stream_error(&stream) ? ESP_FAIL : ESP_OK;
+    vfs_stream_close(&stream);
+    return ret;
+}
+
+esp_err_t vfs_lineindex_read(const char *path, uint32_t first, uint32_t count,
+                             vfs_lineindex_callback_t callback, void *user_data)
+{
+    if (!path || !callback || first == 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (count == 0) {
+        return ESP_OK;
+    }
+
+    li_pos_t pos;
+    esp_err_t ret = prepare(path, first, 0, &pos);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    return read_from(path, &pos, count, callback, user_data);
+}
+
+esp_err_t vfs_lineindex_tail(const char *path, uint32_t count,
+                             vfs_lineindex_callback_t callback, void *user_data)
+{
+    if (!path || !callback) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (count == 0) {
+        return ESP_OK;
+    }
+
+    li_pos_t pos;
+    esp_err_t ret = prepare(path, 0, count, &pos);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+    return read_from(path, &pos, count, callback, user_data);
+}
+
+/* ============================================================================
+ * MAINTENANCE
+ * ============================================================================ */
+
+esp_err_t vfs_lineindex_init(void)
+{
+    if (!s_lock) {
+        s_lock = xSemaphoreCreateMutex();
+    }
+    return s_lock ? ESP_OK : ESP_ERR_NO_MEM;
+}
+
+esp_err_t vfs_lineindex_save(const char *path)
+{
+    if (!path) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    LOCK();
+    li_index_t *idx = get_index(path);
+    esp_err_t ret = idx ? refresh(idx) : ESP_ERR_NO_MEM;
+    if (ret == ESP_OK) {
+        ret = sidecar_save(idx);
+    } else if (idx) {
+        drop(idx, false);
+    }
+    UNLOCK();
+    return ret;
+}
+
+void vfs_lineindex_forget(const char *path)
+{
+    if (!path || !s_lock) {
+        return;
+    }
+
+    LOCK();
+    for (int i = 0; i < VFS_LINEINDEX_FILES; i++) {
+        if (s_index[i].in_use && strcmp(s_index[i].path, path) == 0) {
+            drop(&s_index[i], false);
+        }
+    }
+
+    char side[VFS_MAX_PATH];
+    sidecar_path(path, side);
+    vfs_stat_t st;
+    if (vfs_stat(side, &st) == ESP_OK) {
+        vfs_unlink(side);
+    }
+    UNLOCK();
+}
+
+bool vfs_lineindex_is_sidecar(const char *name)
+{
+    size_t len = name ? strlen(name) : 0;
+    size_t ext = sizeof(VFS_LINEINDEX_SIDECAR_EXT) - 1;
+    return len > ext && strcmp(name + len - ext, VFS_LINEINDEX_SIDECAR_EXT) == 0;
+}
+
+esp_err_t vfs_lineindex_get_stats(vfs_lineindex_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_lock) {
+        memset(stats, 0, sizeof(*stats));
+        return ESP_OK;
+    }
+
+    LOCK();
+    *stats = s_stats;
+    UNLOCK();
+    return ESP_OK;
+}
+
+void vfs_lineindex_reset_stats(void)
+{
+    if (!s_lock) {
+        return;
+    }
+
+    LOCK();
+    memset(&s_stats, 0, sizeof(s_stats));
+    UNLOCK();
+}
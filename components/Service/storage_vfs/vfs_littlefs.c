@@ -26,6 +26,8 @@
 #include <unistd.h>
 #include <sys/stat.h>
 #include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
 #include <string.h>
 
 #ifdef VFS_USE_LITTLEFS
@@ -139,32 +141,70 @@ static esp_err_t littlefs_rmdir(const char *path)
     return (rmdir(path) == 0) ? ESP_OK : ESP_FAIL;
 }
 
+// readdir() has no size or dates, so the directory path is kept to stat() each entry
+typedef struct {
+    DIR *dir;
+    size_t path_len;
+    char path[VFS_MAX_PATH];
+} littlefs_dir_t;
+
 static vfs_dir_t littlefs_opendir(const char *path)
 {
-    return (vfs_dir_t)opendir(path);
+    littlefs_dir_t *d = malloc(sizeof(littlefs_dir_t));
+    if (!d) {
+        return NULL;
+    }
+    
+    d->dir = opendir(path);
+    if (!d->dir) {
+        free(d);
+        return NULL;
+    }
+    
+    size_t len = strlen(path);
+    bool slash = (len > 0 && path[len - 1] == '/');
+    d->path_len = snprintf(d->path, sizeof(d->path), "%s%s", path, slash ? "" : "/");
+    return (vfs_dir_t)d;
 }
 
 static esp_err_t littlefs_readdir(vfs_dir_t dir, vfs_stat_t *entry)
 {
-    DIR *d = (DIR *)dir;
-    struct dirent *ent = readdir(d);
+    littlefs_dir_t *d = (littlefs_dir_t *)dir;
+    struct dirent *ent = readdir(d->dir);
     
     if (!ent) {
-        return ESP_ERR_NOT_FOUND;
+        return ESP_ERR_NOT_FOUND;  // End of directory
     }
     
     strncpy(entry->name, ent->d_name, VFS_MAX_NAME - 1);
     entry->name[VFS_MAX_NAME - 1] = '\0';
     entry->type = (ent->d_type == DT_DIR) ? VFS_TYPE_DIR : VFS_TYPE_FILE;
     entry->size = 0;
+    entry->mtime = 0;
+    entry->ctime = 0;
+    entry->is_hidden = false;
+    entry->is_readonly = false;
+    
+    struct stat native_stat;
+    if (d->path_len < sizeof(d->path) - 1) {
+        strncpy(&d->path[d->path_len], ent->d_name, sizeof(d->path) - d->path_len - 1);
+        d->path[sizeof(d->path) - 1] = '\0';
+        if (stat(d->path, &native_stat) == 0) {
+            entry->size = native_stat.st_size;
+            entry->mtime = native_stat.st_mtime;
+            entry->ctime = native_stat.st_ctime;
+        }
+    }
     
     return ESP_OK;
 }
 
 static esp_err_t littlefs_closedir(vfs_dir_t dir)
 {
-    DIR *d = (DIR *)dir;
-    return (closedir(d) == 0) ? ESP_OK : ESP_FAIL;
+    littlefs_dir_t *d = (littlefs_dir_t *)dir;
+    int ret = closedir(d->dir);
+    free(d);
+    return (ret == 0) ? ESP_OK : ESP_FAIL;
 }
 
 static esp_err_t littlefs_statvfs(vfs_statvfs_t *stat)
@@ -174,7 +214,7 @@ static esp_err_t littlefs_statvfs(vfs_statvfs_t *stat)
     }
     
     size_t total, used;
-    esp_err_t ret = esp_littlefs_info(VFS_PARTITION_LABEL, &total, &used);
+    esp_err_t ret = esp_littlefs_info(VFS_LITTLEFS_PARTITION_LABEL, &total, &used);
     
     if (ret == ESP_OK) {
         stat->total_bytes = total;
@@ -236,13 +276,13 @@ esp_err_t vfs_littlefs_init(void)
     }
     
     ESP_LOGI(TAG, "Initializing LittleFS");
-    ESP_LOGI(TAG, "Partition: %s", VFS_PARTITION_LABEL);
-    ESP_LOGI(TAG, "Mount point: %s", VFS_MOUNT_POINT);
+    ESP_LOGI(TAG, "Partition: %s", VFS_LITTLEFS_PARTITION_LABEL);
+    ESP_LOGI(TAG, "Mount point: %s", VFS_LITTLEFS_MOUNT_POINT);
     
     esp_vfs_littlefs_conf_t conf = {
-        .base_path = VFS_MOUNT_POINT,
-        .partition_label = VFS_PARTITION_LABEL,
-        .format_if_mount_failed = VFS_FORMAT_ON_FAIL,
+        .base_path = VFS_LITTLEFS_MOUNT_POINT,
+        .partition_label = VFS_LITTLEFS_PARTITION_LABEL,
+        .format_if_mount_failed = VFS_LITTLEFS_FORMAT_ON_FAIL,
         .dont_mount = false,
     };
     
@@ -261,12 +301,12 @@ esp_err_t vfs_littlefs_init(void)
     s_littlefs.mounted = true;
     
     // Fetch partition info
-    esp_littlefs_info(VFS_PARTITION_LABEL, &s_littlefs.total_bytes, &s_littlefs.used_bytes);
+    esp_littlefs_info(VFS_LITTLEFS_PARTITION_LABEL, &s_littlefs.total_bytes, &s_littlefs.used_bytes);
     
     // Register in VFS core
     vfs_backend_config_t backend_config = {
         .type = VFS_BACKEND_LITTLEFS,
-        .mount_point = VFS_MOUNT_POINT,
+        .mount_point = VFS_LITTLEFS_MOUNT_POINT,
         .ops = &s_littlefs_ops,
         .private_data = &s_littlefs,
     };
@@ -279,10 +319,10 @@ esp_err_t vfs_littlefs_init(void)
     }
     
     ESP_LOGI(TAG, "LittleFS mounted");
-    ESP_LOGI(TAG, "Partition: %s", VFS_PARTITION_LABEL);
-    ESP_LOGI(TAG, "Capacity: %u KB", s_littlefs.total_bytes / 1024);
-    ESP_LOGI(TAG, "Used: %u KB", s_littlefs.used_bytes / 1024);
-    ESP_LOGI(TAG, "Free: %u KB", (s_littlefs.total_bytes - s_littlefs.used_bytes) / 1024);
+    ESP_LOGI(TAG, "Partition: %s", VFS_LITTLEFS_PARTITION_LABEL);
+    ESP_LOGI(TAG, "Capacity: %zu KB", s_littlefs.total_bytes / 1024);
+    ESP_LOGI(TAG, "Used: %zu KB", s_littlefs.used_bytes / 1024);
+    ESP_LOGI(TAG, "Free: %zu KB", (s_littlefs.total_bytes - s_littlefs.used_bytes) / 1024);
     
     return ESP_OK;
 }
@@ -297,9 +337,9 @@ esp_err_t vfs_littlefs_deinit(void)
     ESP_LOGI(TAG, "Unmounting LittleFS");
     
     // Unregister from VFS core first
-    vfs_unregister_backend(VFS_MOUNT_POINT);
+    vfs_unregister_backend(VFS_LITTLEFS_MOUNT_POINT);
     
-    esp_err_t ret = esp_vfs_littlefs_unregister(VFS_PARTITION_LABEL);
+    esp_err_t ret = esp_vfs_littlefs_unregister(VFS_LITTLEFS_PARTITION_LABEL);
     
     if (ret == ESP_OK) {
         s_littlefs.mounted = false;
@@ -346,18 +386,18 @@ void vfs_littlefs_print_info(void)
     }
     
     ESP_LOGI(TAG, "LittleFS info:");
-    ESP_LOGI(TAG, "Mount point: %s", VFS_MOUNT_POINT);
-    ESP_LOGI(TAG, "Partition: %s", VFS_PARTITION_LABEL);
+    ESP_LOGI(TAG, "Mount point: %s", VFS_LITTLEFS_MOUNT_POINT);
+    ESP_LOGI(TAG, "Partition: %s", VFS_LITTLEFS_PARTITION_LABEL);
     
     size_t total, used;
-    if (esp_littlefs_info(VFS_PARTITION_LABEL, &total, &used) == ESP_OK) {
+    if (esp_littlefs_info(VFS_LITTLEFS_PARTITION_LABEL, &total, &used) == ESP_OK) {
         float percent = total > 0 ? ((float)used / total) * 100.0f : 0.0f;
         
-        ESP_LOGI(TAG, "Total: %u KB (%.2f MB)", 
+        ESP_LOGI(TAG, "Total: %zu KB (%.2f MB)", 
                  total / 1024, (float)total / (1024 * 1024));
-        ESP_LOGI(TAG, "Used: %u KB (%.2f MB)", 
+        ESP_LOGI(TAG, "Used: %zu KB (%.2f MB)", 
                  used / 1024, (float)used / (1024 * 1024));
-        ESP_LOGI(TAG, "Free: %u KB (%.2f MB)", 
+        ESP_LOGI(TAG, "Free: %zu KB (%.2f MB)", 
                  (total - used) / 1024, (float)(total - used) / (1024 * 1024));
         ESP_LOGI(TAG, "Usage: %.1f%%", percent);
     }
@@ -378,7 +418,7 @@ esp_err_t vfs_littlefs_format(void)
     }
     
     // Format partition
-    ret = esp_littlefs_format(VFS_PARTITION_LABEL);
+    ret = esp_littlefs_format(VFS_LITTLEFS_PARTITION_LABEL);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Failed to format LittleFS: %s", esp_err_to_name(ret));
         return ret;
@@ -0,0 +1,861 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file vfs_ramfs.c
+ * @brief VFS backend for a RAM filesystem
+ */
+
+#include "vfs_core.h"
+#include "vfs_config.h"
+#include "vfs_ramfs.h"
+#include "esp_log.h"
+#include "esp_heap_caps.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include <fcntl.h>
+#include <errno.h>
+#include <string.h>
+#include <stdlib.h>
+#include <time.h>
+
+static const char *TAG = "vfs_ramfs";
+
+#define ROOT_NODE   0
+#define CHUNK       VFS_RAMFS_CHUNK_SIZE
+
+typedef struct {
+    bool in_use;
+    bool unlinked;              // Removed from the tree, freed on last close
+    vfs_entry_type_t type;
+    int16_t parent;
+    uint16_t open_count;
+    char name[VFS_MAX_NAME];
+    size_t size;
+    uint8_t **chunks;           // NULL entries read as zeros
+    uint32_t chunk_count;       // Entries in chunks[]
+    time_t mtime;
+    time_t ctime;
+} ramfs_node_t;
+
+typedef struct {
+    bool in_use;
+    int16_t node;
+    int flags;
+    off_t pos;
+} ramfs_fd_t;
+
+typedef struct {
+    int16_t node;
+    uint16_t next;              // Next node table index to scan
+} ramfs_dir_t;
+
+// Backend state
+static struct {
+    bool mounted;
+    char mount_point[VFS_MAX_NAME];
+    size_t mount_len;
+    size_t capacity;
+    size_t used;                // Allocated chunk bytes
+    uint32_t data_caps;         // heap_caps for file data
+    uint16_t max_nodes;
+    uint8_t max_open;
+    ramfs_node_t *nodes;
+    ramfs_fd_t *fds;
+    SemaphoreHandle_t lock;
+} s_ramfs = {0};
+
+#define RAMFS_LOCK()    xSemaphoreTake(s_ramfs.lock, portMAX_DELAY)
+#define RAMFS_UNLOCK()  xSemaphoreGive(s_ramfs.lock)
+
+/* ============================================================================
+ * HELPER FUNCTIONS
+ * ============================================================================ */
+
+static time_t now(void)
+{
+    return time(NULL);
+}
+
+// Look up `path` (full VFS path). Returns the node or -1. With `parent` and
+// `leaf`, also reports the directory that holds (or would hold) the last
+// component and its name; *parent is -1 if an intermediate directory is
+// missing.
+static int resolve(const char *path, int *parent, const char **leaf)
+{
+    if (strncmp(path, s_ramfs.mount_point, s_ramfs.mount_len) != 0) {
+        if (parent) *parent = -1;
+        return -1;
+    }
+    path += s_ramfs.mount_len;
+
+    int dir = ROOT_NODE;
+    int node = ROOT_NODE;
+    if (parent) *parent = -1;
+    if (leaf) *leaf = "";
+
+    while (*path) {
+        while (*path == '/') path++;
+        if (!*path) break;
+
+        const char *end = strchr(path, '/');
+        size_t len = end ? (size_t)(end - path) : strlen(path);
+        if (len >= VFS_MAX_NAME) return -1;
+
+        if (node < 0 || s_ramfs.nodes[node].type != VFS_TYPE_DIR) {
+            if (parent) *parent = -1;   // Intermediate component missing or a file
+            return -1;
+        }
+        dir = node;
+        if (parent) *parent = dir;
+        if (leaf) *leaf = path;
+
+        node = -1;
+        for (int i = 0; i < s_ramfs.max_nodes; i++) {
+            const ramfs_node_t *n = &s_ramfs.nodes[i];
+            if (n->in_use && !n->unlinked && i != ROOT_NODE && n->parent == dir &&
+                strncmp(n->name, path, len) == 0 && n->name[len] == '\0') {
+                node = i;
+                break;
+            }
+        }
+        path += len;
+    }
+    return node;
+}
+
+// Name of the last component (resolve() leaves it followed by '/' or '\0')
+static void copy_leaf(char *dst, const char *leaf)
+{
+    size_t len = strcspn(leaf, "/");
+    memcpy(dst, leaf, len);
+    dst[len] = '\0';
+}
+
+static int alloc_node(int parent, const char *leaf, vfs_entry_type_t type)
+{
+    for (int i = 0; i < s_ramfs.max_nodes; i++) {
+        ramfs_node_t *n = &s_ramfs.nodes[i];
+        if (n->in_use) continue;
+
+        memset(n, 0, sizeof(*n));
+        n->in_use = true;
+        n->type = type;
+        n->parent = parent;
+        copy_leaf(n->name, leaf);
+        n->mtime = n->ctime = now();
+        s_ramfs.nodes[parent].mtime = n->mtime;
+        return i;
+    }
+    return -1;
+}
+
+static bool dir_is_empty(int dir)
+{
+    for (int i = 0; i < s_ramfs.max_nodes; i++) {
+        const ramfs_node_t *n = &s_ramfs.nodes[i];
+        if (n->in_use && !n->unlinked && i != ROOT_NODE && n->parent == dir) {
+            return false;
+        }
+    }
+    return true;
+}
+
+// Free chunks from index `first` on
+static void free_chunks(ramfs_node_t *n, uint32_t first)
+{
+    for (uint32_t c = first; c < n->chunk_count; c++) {
+        if (n->chunks[c]) {
+            heap_caps_free(n->chunks[c]);
+            n->chunks[c] = NULL;
+            s_ramfs.used -= CHUNK;
+        }
+    }
+}
+
+static void free_node(int node)
+{
+    ramfs_node_t *n = &s_ramfs.nodes[node];
+    free_chunks(n, 0);
+    free(n->chunks);
+    memset(n, 0, sizeof(*n));
+}
+
+// Unlink: the data lives until the last descriptor is closed
+static void remove_node(int node)
+{
+    ramfs_node_t *n = &s_ramfs.nodes[node];
+    s_ramfs.nodes[n->parent].mtime = now();
+    if (n->open_count > 0) {
+        n->unlinked = true;
+    } else {
+        free_node(node);
+    }
+}
+
+static uint8_t* get_chunk(ramfs_node_t *n, uint32_t index)
+{
+    if (index >= n->chunk_count) {
+        uint32_t count = n->chunk_count ? n->chunk_count : 4;
+        while (count <= index) count *= 2;
+        uint8_t **chunks = realloc(n->chunks, count * sizeof(uint8_t *));
+        if (!chunks) return NULL;
+        memset(&chunks[n->chunk_count], 0, (count - n->chunk_count) * sizeof(uint8_t *));
+        n->chunks = chunks;
+        n->chunk_count = count;
+    }
+
+    if (!n->chunks[index]) {
+        if (s_ramfs.used + CHUNK > s_ramfs.capacity) return NULL;
+
+        uint8_t *chunk = heap_caps_calloc(1, CHUNK, s_ramfs.data_caps);
+        if (!chunk && s_ramfs.data_caps != MALLOC_CAP_8BIT) {
+            chunk = heap_caps_calloc(1, CHUNK, MALLOC_CAP_8BIT);
+        }
+        if (!chunk) return NULL;
+        n->chunks[index] = chunk;
+        s_ramfs.used += CHUNK;
+    }
+    return n->chunks[index];
+}
+
+// Shrink keeps the bytes past the end zeroed, so a later extension reads 0
+static void set_size(ramfs_node_t *n, size_t length)
+{
+    if (length < n->size) {
+        uint32_t keep = (length + CHUNK - 1) / CHUNK;
+        free_chunks(n, keep);
+        if (length % CHUNK && keep - 1 < n->chunk_count && n->chunks[keep - 1]) {
+            memset(&n->chunks[keep - 1][length % CHUNK], 0, CHUNK - length % CHUNK);
+        }
+    }
+    n->size = length;
+    n->mtime = now();
+}
+
+static ramfs_fd_t* get_fd(vfs_fd_t fd)
+{
+    if (fd < 0 || fd >= s_ramfs.max_open || !s_ramfs.fds[fd].in_use) {
+        return NULL;
+    }
+    return &s_ramfs.fds[fd];
+}
+
+static void fill_stat(int node, vfs_stat_t *st)
+{
+    const ramfs_node_t *n = &s_ramfs.nodes[node];
+    strncpy(st->name, n->name, VFS_MAX_NAME - 1);
+    st->name[VFS_MAX_NAME - 1] = '\0';
+    st->type = n->type;
+    st->size = n->type == VFS_TYPE_FILE ? n->size : 0;
+    st->mtime = n->mtime;
+    st->ctime = n->ctime;
+    st->is_hidden = n->name[0] == '.';
+    st->is_readonly = false;
+}
+
+/* ============================================================================
+ * BACKEND OPERATIONS IMPLEMENTATION
+ * ============================================================================ */
+
+static vfs_fd_t ramfs_open(const char *path, int flags, int mode)
+{
+    (void)mode;
+    RAMFS_LOCK();
+
+    int parent;
+    const char *leaf;
+    int node = resolve(path, &parent, &leaf);
+    vfs_fd_t fd = VFS_INVALID_FD;
+
+    if (node >= 0 && (flags & O_CREAT) && (flags & O_EXCL)) {
+        errno = EEXIST;
+        goto out;
+    }
+    if (node < 0) {
+        if (!(flags & O_CREAT) || parent < 0 || !*leaf) {
+            errno = ENOENT;
+            goto out;
+        }
+        node = alloc_node(parent, leaf, VFS_TYPE_FILE);
+        if (node < 0) {
+            errno = ENOSPC;
+            goto out;
+        }
+    }
+    if (s_ramfs.nodes[node].type != VFS_TYPE_FILE) {
+        errno = EISDIR;
+        goto out;
+    }
+
+    for (int i = 0; i < s_ramfs.max_open; i++) {
+        if (!s_ramfs.fds[i].in_use) {
+            fd = i;
+            break;
+        }
+    }
+    if (fd == VFS_INVALID_FD) {
+        errno = EMFILE;
+        goto out;
+    }
+
+    if ((flags & O_TRUNC) && (flags & O_ACCMODE) != O_RDONLY) {
+        set_size(&s_ramfs.nodes[node], 0);
+    }
+    s_ramfs.fds[fd] = (ramfs_fd_t){ .in_use = true, .node = node, .flags = flags, .pos = 0 };
+    s_ramfs.nodes[node].open_count++;
+
+out:
+    RAMFS_UNLOCK();
+    return fd;
+}
+
+static ssize_t ramfs_read(vfs_fd_t fd, void *buf, size_t size)
+{
+    RAMFS_LOCK();
+    ramfs_fd_t *f = get_fd(fd);
+    if (!f || (f->flags & O_ACCMODE) == O_WRONLY) {
+        RAMFS_UNLOCK();
+        errno = EBADF;
+        return -1;
+    }
+
+    const ramfs_node_t *n = &s_ramfs.nodes[f->node];
+    uint8_t *out = buf;
+    size_t done = 0;
+    while (done < size && (size_t)f->pos < n->size) {
+        uint32_t index = f->pos / CHUNK;
+        size_t off = f->pos % CHUNK;
+        size_t len = CHUNK - off;
+        if (len > size - done) len = size - done;
+        if (len > n->size - f->pos) len = n->size - f->pos;
+
+        if (index < n->chunk_count && n->chunks[index]) {
+            memcpy(&out[done], &n->chunks[index][off], len);
+        } else {
+            memset(&out[done], 0, len);     // Hole
+        }
+        done += len;
+        f->pos += len;
+    }
+
+    RAMFS_UNLOCK();
+    return done;
+}
+
+static ssize_t ramfs_write(vfs_fd_t fd, const void *buf, size_t size)
+{
+    RAMFS_LOCK();
+    ramfs_fd_t *f = get_fd(fd);
+    if (!f || (f->flags & O_ACCMODE) == O_RDONLY) {
+        RAMFS_UNLOCK();
+        errno = EBADF;
+        return -1;
+    }
+
+    ramfs_node_t *n = &s_ramfs.nodes[f->node];
+    if (f->flags & O_APPEND) {
+        f->pos = n->size;
+    }
+
+    const uint8_t *in = buf;
+    size_t done = 0;
+    while (done < size) {
+        uint32_t index = f->pos / CHUNK;
+        size_t off = f->pos % CHUNK;
+        size_t len = CHUNK - off;
+        if (len > size - done) len = size - done;
+
+        uint8_t *chunk = get_chunk(n, index);
+        if (!chunk) break;
+        memcpy(&chunk[off], &in[done], len);
+        done += len;
+        f->pos += len;
+    }
+
+    if (done > 0) {
+        if ((size_t)f->pos > n->size) n->size = f->pos;
+        n->mtime = now();
+    }
+    RAMFS_UNLOCK();
+
+    if (done == 0 && size > 0) {
+        errno = ENOSPC;
+        return -1;
+    }
+    return done;
+}
+
+static off_t ramfs_lseek(vfs_fd_t fd, off_t offset, int whence)
+{
+    RAMFS_LOCK();
+    ramfs_fd_t *f = get_fd(fd);
+    off_t pos = -1;
+
+    if (f) {
+        switch (whence) {
+            case SEEK_SET: pos = offset; break;
+            case SEEK_CUR: pos = f->pos + offset; break;
+            case SEEK_END: pos = (off_t)s_ramfs.nodes[f->node].size + offset; break;
+            default: break;
+        }
+        if (pos >= 0) {
+            f->pos = pos;
+        } else {
+            pos = -1;
+        }
+    }
+
+    RAMFS_UNLOCK();
+    if (pos < 0) errno = EINVAL;
+    return pos;
+}
+
+static esp_err_t ramfs_close(vfs_fd_t fd)
+{
+    RAMFS_LOCK();
+    ramfs_fd_t *f = get_fd(fd);
+    if (!f) {
+        RAMFS_UNLOCK();
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    ramfs_node_t *n = &s_ramfs.nodes[f->node];
+    if (--n->open_count == 0 && n->unlinked) {
+        free_node(f->node);
+    }
+    memset(f, 0, sizeof(*f));
+
+    RAMFS_UNLOCK();
+    return ESP_OK;
+}
+
+static esp_err_t ramfs_fsync(vfs_fd_t fd)
+{
+    return get_fd(fd) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+static esp_err_t ramfs_stat(const char *path, vfs_stat_t *st)
+{
+    RAMFS_LOCK();
+    int node = resolve(path, NULL, NULL);
+    if (node >= 0) {
+        fill_stat(node, st);
+    }
+    RAMFS_UNLOCK();
+    return node >= 0 ? ESP_OK : ESP_FAIL;
+}
+
+static esp_err_t ramfs_fstat(vfs_fd_t fd, vfs_stat_t *st)
+{
+    RAMFS_LOCK();
+    ramfs_fd_t *f = get_fd(fd);
+    if (f) {
+        fill_stat(f->node, st);
+    }
+    RAMFS_UNLOCK();
+    return f ? ESP_OK : ESP_FAIL;
+}
+
+static esp_err_t ramfs_rename(const char *old_path, const char *new_path)
+{
+    RAMFS_LOCK();
+    esp_err_t ret = ESP_FAIL;
+
+    int node = resolve(old_path, NULL, NULL);
+    int parent;
+    const char *leaf;
+    int target = resolve(new_path, &parent, &leaf);
+
+    if (node <= ROOT_NODE || parent < 0 || !*leaf) goto out;
+    if (target == node) {
+        ret = ESP_OK;
+        goto out;
+    }
+
+    // A directory cannot move below itself
+    for (int d = parent; d != ROOT_NODE; d = s_ramfs.nodes[d].parent) {
+        if (d == node) goto out;
+    }
+
+    // POSIX: replace a file by a file, or an empty directory by a directory
+    if (target >= 0) {
+        const ramfs_node_t *t = &s_ramfs.nodes[target];
+        if (t->type != s_ramfs.nodes[node].type) goto out;
+        if (t->type == VFS_TYPE_DIR && !dir_is_empty(target)) goto out;
+        remove_node(target);
+    }
+
+    ramfs_node_t *n = &s_ramfs.nodes[node];
+    s_ramfs.nodes[n->parent].mtime = now();
+    n->parent = parent;
+    copy_leaf(n->name, leaf);
+    s_ramfs.nodes[parent].mtime = now();
+    ret = ESP_OK;
+
+out:
+    RAMFS_UNLOCK();
+    return ret;
+}
+
+static esp_err_t ramfs_unlink(const char *path)
+{
+    RAMFS_LOCK();
+    int node = resolve(path, NULL, NULL);
+    bool ok = node > ROOT_NODE && s_ramfs.nodes[node].type == VFS_TYPE_FILE;
+    if (ok) {
+        remove_node(node);
+    }
+    RAMFS_UNLOCK();
+    return ok ? ESP_OK : ESP_FAIL;
+}
+
+static esp_err_t ramfs_truncate(const char *path, off_t length)
+{
+    if (length < 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    RAMFS_LOCK();
+    int node = resolve(path, NULL, NULL);
+    bool ok = node >= 0 && s_ramfs.nodes[node].type == VFS_TYPE_FILE;
+    if (ok) {
+        set_size(&s_ramfs.nodes[node], length);
+    }
+    RAMFS_UNLOCK();
+    return ok ? ESP_OK : ESP_FAIL;
+}
+
+static esp_err_t ramfs_mkdir(const char *path, int mode)
+{
+    (void)mode;
+    RAMFS_LOCK();
+
+    int parent;
+    const char *leaf;
+    int node = resolve(path, &parent, &leaf);
+    esp_err_t ret = ESP_FAIL;
+    if (node < 0 && parent >= 0 && *leaf) {
+        ret = alloc_node(parent, leaf, VFS_TYPE_DIR) >= 0 ? ESP_OK : ESP_ERR_NO_MEM;
+    }
+
+    RAMFS_UNLOCK();
+    return ret;
+}
+
+static esp_err_t ramfs_rmdir(const char *path)
+{
+    RAMFS_LOCK();
+    int node = resolve(path, NULL, NULL);
+    bool ok = node > ROOT_NODE && s_ramfs.nodes[node].type == VFS_TYPE_DIR && dir_is_empty(node);
+    if (ok) {
+        remove_node(node);
+    }
+    RAMFS_UNLOCK();
+    return ok ? ESP_OK : ESP_FAIL;
+}
+
+static vfs_dir_t ramfs_opendir(const char *path)
+{
+    RAMFS_LOCK();
+    int node = resolve(path, NULL, NULL);
+    ramfs_dir_t *dir = NULL;
+    if (node >= 0 && s_ramfs.nodes[node].type == VFS_TYPE_DIR) {
+        dir = calloc(1, sizeof(ramfs_dir_t));
+        if (dir) {
+            dir->node = node;
+        }
+    }
+    RAMFS_UNLOCK();
+    return (vfs_dir_t)dir;
+}
+
+static esp_err_t ramfs_readdir(vfs_dir_t dir, vfs_stat_t *entry)
+{
+    ramfs_dir_t *d = (ramfs_dir_t *)dir;
+    esp_err_t ret = ESP_ERR_NOT_FOUND;   // End of directory
+
+    RAMFS_LOCK();
+    while (d->next < s_ramfs.max_nodes) {
+        int i = d->next++;
+        const ramfs_node_t *n = &s_ramfs.nodes[i];
+        if (n->in_use && !n->unlinked && i != ROOT_NODE && n->parent == d->node) {
+            fill_stat(i, entry);
+            ret = ESP_OK;
+            break;
+        }
+    }
+    RAMFS_UNLOCK();
+    return ret;
+}
+
+static esp_err_t ramfs_closedir(vfs_dir_t dir)
+{
+    free(dir);
+    return ESP_OK;
+}
+
+static esp_err_t ramfs_statvfs(vfs_statvfs_t *stat)
+{
+    if (!s_ramfs.mounted) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    RAMFS_LOCK();
+    stat->total_bytes = s_ramfs.capacity;
+    stat->used_bytes = s_ramfs.used;
+    stat->free_bytes = s_ramfs.capacity - s_ramfs.used;
+    stat->block_size = CHUNK;
+    stat->total_blocks = s_ramfs.capacity / CHUNK;
+    stat->free_blocks = (s_ramfs.capacity - s_ramfs.used) / CHUNK;
+    RAMFS_UNLOCK();
+
+    return ESP_OK;
+}
+
+static bool ramfs_is_mounted(void)
+{
+    return s_ramfs.mounted;
+}
+
+/* ============================================================================
+ * BACKEND OPERATIONS TABLE
+ * ============================================================================ */
+
+static const vfs_backend_ops_t s_ramfs_ops = {
+    .init = NULL,
+    .deinit = NULL,
+    .is_mounted = ramfs_is_mounted,
+
+    .open = ramfs_open,
+    .read = ramfs_read,
+    .write = ramfs_write,
+    .lseek = ramfs_lseek,
+    .close = ramfs_close,
+    .fsync = ramfs_fsync,
+
+    .stat = ramfs_stat,
+    .fstat = ramfs_fstat,
+    .rename = ramfs_rename,
+    .unlink = ramfs_unlink,
+    .truncate = ramfs_truncate,
+
+    .mkdir = ramfs_mkdir,
+    .rmdir = ramfs_rmdir,
+    .opendir = ramfs_opendir,
+    .readdir = ramfs_readdir,
+    .closedir = ramfs_closedir,
+
+    .statvfs = ramfs_statvfs,
+};
+
+/* ============================================================================
+ * INITIALIZATION
+ * ============================================================================ */
+
+static void release_tables(void)
+{
+    if (s_ramfs.nodes) {
+        for (int i = 0; i < s_ramfs.max_nodes; i++) {
+            if (s_ramfs.nodes[i].in_use) {
+                free_node(i);
+            }
+        }
+    }
+    free(s_ramfs.nodes);
+    free(s_ramfs.fds);
+    if (s_ramfs.lock) {
+        vSemaphoreDelete(s_ramfs.lock);
+    }
+    memset(&s_ramfs, 0, sizeof(s_ramfs));
+}
+
+esp_err_t vfs_ramfs_init(const vfs_ramfs_config_t *config)
+{
+    if (s_ramfs.mounted) {
+        ESP_LOGW(TAG, "RAMFS already mounted");
+        return ESP_OK;
+    }
+
+    vfs_ramfs_config_t cfg = config ? *config : (vfs_ramfs_config_t){0};
+    if (!cfg.mount_point) cfg.mount_point = VFS_RAMFS_MOUNT_POINT;
+    if (!cfg.size) cfg.size = VFS_RAMFS_DEFAULT_SIZE;
+    if (!cfg.max_nodes) cfg.max_nodes = VFS_RAMFS_MAX_NODES;
+    if (!cfg.max_open) cfg.max_open = VFS_RAMFS_MAX_OPEN;
+
+    if (strlen(cfg.mount_point) >= VFS_MAX_NAME || cfg.max_nodes < 2) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    strcpy(s_ramfs.mount_point, cfg.mount_point);
+    s_ramfs.mount_len = strlen(cfg.mount_point);
+    s_ramfs.capacity = cfg.size;
+    s_ramfs.max_nodes = cfg.max_nodes;
+    s_ramfs.max_open = cfg.max_open;
+    s_ramfs.data_caps = MALLOC_CAP_8BIT;
+
+    if (cfg.use_psram) {
+        if (heap_caps_get_free_size(MALLOC_CAP_SPIRAM) > 0) {
+            s_ramfs.data_caps = MALLOC_CAP_SPIRAM | MALLOC_CAP_8BIT;
+        } else {
+            ESP_LOGW(TAG, "No PSRAM available, using internal RAM");
+        }
+    }
+
+    s_ramfs.nodes = calloc(cfg.max_nodes, sizeof(ramfs_node_t));
+    s_ramfs.fds = calloc(cfg.max_open, sizeof(ramfs_fd_t));
+    s_ramfs.lock = xSemaphoreCreateMutex();
+    if (!s_ramfs.nodes || !s_ramfs.fds || !s_ramfs.lock) {
+        ESP_LOGE(TAG, "Out of memory");
+        release_tables();
+        return ESP_ERR_NO_MEM;
+    }
+
+    ramfs_node_t *root = &s_ramfs.nodes[ROOT_NODE];
+    root->in_use = true;
+    root->type = VFS_TYPE_DIR;
+    root->mtime = root->ctime = now();
+    s_ramfs.mounted = true;
+
+    // Register in VFS core
+    vfs_backend_config_t backend_config = {
+        .type = VFS_BACKEND_RAMFS,
+        .mount_point = s_ramfs.mount_point,
+        .ops = &s_ramfs_ops,
+        .private_data = &s_ramfs,
+        .flags = VFS_BACKEND_FLAG_NO_CACHE,
+    };
+
+    esp_err_t ret = vfs_register_backend(&backend_config);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "Failed to register RAMFS backend in VFS core");
+        release_tables();
+        return ret;
+    }
+
+    ESP_LOGI(TAG, "RAMFS mounted at %s", s_ramfs.mount_point);
+    ESP_LOGI(TAG, "Capacity: %u KB (%s)", (unsigned)(s_ramfs.capacity / 1024),
+             (s_ramfs.data_caps & MALLOC_CAP_SPIRAM) ? "PSRAM" : "internal RAM");
+
+    return ESP_OK;
+}
+
+esp_err_t vfs_ramfs_deinit(void)
+{
+    if (!s_ramfs.mounted) {
+        ESP_LOGW(TAG, "RAMFS is not mounted");
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    ESP_LOGI(TAG, "Unmounting RAMFS");
+
+    // Unregister from VFS core first
+    vfs_unregister_backend(s_ramfs.mount_point);
+    release_tables();
+
+    ESP_LOGI(TAG, "RAMFS unmounted");
+    return ESP_OK;
+}
+
+bool vfs_ramfs_is_mounted(void)
+{
+    return s_ramfs.mounted;
+}
+
+/* ============================================================================
+ * REGISTRATION HELPERS
+ * ============================================================================ */
+
+esp_err_t vfs_register_ramfs_backend(void)
+{
+    ESP_LOGI(TAG, "Registering RAMFS backend");
+
+#ifdef VFS_USE_RAMFS
+    vfs_ramfs_config_t config = {
+        .mount_point = VFS_RAMFS_MOUNT_POINT,
+        .size = VFS_RAMFS_SIZE,
+        .max_open = VFS_RAMFS_MAX_FILES,
+        .use_psram = true,
+    };
+    return vfs_ramfs_init(&config);
+#else
+    return vfs_ramfs_init(NULL);
+#endif
+}
+
+esp_err_t vfs_unregister_ramfs_backend(void)
+{
+    ESP_LOGI(TAG, "Unregistering RAMFS backend");
+    return vfs_ramfs_deinit();
+}
+
+/* ============================================================================
+ * AUXILIARY FUNCTIONS
+ * ============================================================================ */
+
+void vfs_ramfs_print_info(void)
+{
+    if (!s_ramfs.mounted) {
+        ESP_LOGW(TAG, "RAMFS is not mounted");
+        return;
+    }
+
+    RAMFS_LOCK();
+    int files = 0, dirs = 0;
+    for (int i = 1; i < s_ramfs.max_nodes; i++) {
+        const ramfs_node_t *n = &s_ramfs.nodes[i];
+        if (!n->in_use || n->unlinked) continue;
+        if (n->type == VFS_TYPE_DIR) {
+            dirs++;
+        } else {
+            files++;
+        }
+    }
+    size_t used = s_ramfs.used;
+    RAMFS_UNLOCK();
+
+    ESP_LOGI(TAG, "RAMFS info:");
+    ESP_LOGI(TAG, "Mount point: %s", s_ramfs.mount_point);
+    ESP_LOGI(TAG, "Memory: %s", (s_ramfs.data_caps & MALLOC_CAP_SPIRAM) ? "PSRAM" : "internal RAM");
+    ESP_LOGI(TAG, "Total: %u KB", (unsigned)(s_ramfs.capacity / 1024));
+    ESP_LOGI(TAG, "Used: %u KB", (unsigned)(used / 1024));
+    ESP_LOGI(TAG, "Files: %d, directories: %d (max %u nodes)", files, dirs, s_ramfs.max_nodes);
+}
+
+esp_err_t vfs_ramfs_format(void)
+{
+    if (!s_ramfs.mounted) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    RAMFS_LOCK();
+    for (int i = 0; i < s_ramfs.max_open; i++) {
+        if (s_ramfs.fds[i].in_use) {
+            RAMFS_UNLOCK();
+            ESP_LOGE(TAG, "Cannot format: files are open");
+            return ESP_ERR_INVALID_STATE;
+        }
+    }
+
+    ESP_LOGW(TAG, "Formatting RAMFS");
+    for (int i = 1; i < s_ramfs.max_nodes; i++) {
+        if (s_ramfs.nodes[i].in_use) {
+            free_node(i);
+        }
+    }
+    s_ramfs.nodes[ROOT_NODE].mtime = now();
+    RAMFS_UNLOCK();
+
+    return ESP_OK;
+}
@@ -21,6 +21,7 @@
 #include "vfs_config.h"
 #include "pin_def.h"
 #include "spi.h"
+#include "spi_arbiter.h"
 #include "esp_vfs_fat.h"
 #include "sdmmc_cmd.h"
 #include "driver/sdspi_host.h"
@@ -29,10 +30,15 @@
 #include "esp_log.h"
 #include "freertos/FreeRTOS.h"
 #include "freertos/task.h"
+#include "freertos/semphr.h"
 #include <fcntl.h>
+#include <inttypes.h>
 #include <unistd.h>
 #include <sys/stat.h>
 #include <dirent.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
 #include "vfs_sdcard.h"
 
 #ifdef VFS_USE_SD_CARD
@@ -44,6 +50,7 @@ static struct {
     bool mounted;
     sdmmc_card_t *card;
     bool we_initialized_bus;
+    SemaphoreHandle_t lock;     // Mount, unmount and check: the storage poll task races callers
 } s_sdcard = {0};
 
 /* ============================================================================
@@ -148,15 +155,36 @@ static esp_err_t sdcard_rmdir(const char *path)
     return (rmdir(path) == 0) ? ESP_OK : ESP_FAIL;
 }
 
+// readdir() has no size or dates, so the directory path is kept to stat() each entry
+typedef struct {
+    DIR *dir;
+    size_t path_len;
+    char path[VFS_MAX_PATH];
+} sdcard_dir_t;
+
 static vfs_dir_t sdcard_opendir(const char *path)
 {
-    return (vfs_dir_t)opendir(path);
+    sdcard_dir_t *d = malloc(sizeof(sdcard_dir_t));
+    if (!d) {
+        return NULL;
+    }
+    
+    d->dir = opendir(path);
+    if (!d->dir) {
+        free(d);
+        return NULL;
+    }
+    
+    size_t len = strlen(path);
+    bool slash = (len > 0 && path[len - 1] == '/');
+    d->path_len = snprintf(d->path, sizeof(d->path), "%s%s", path, slash ? "" : "/");
+    return (vfs_dir_t)d;
 }
 
 static esp_err_t sdcard_readdir(vfs_dir_t dir, vfs_stat_t *entry)
 {
-    DIR *d = (DIR *)dir;
-    struct dirent *ent = readdir(d);
+    sdcard_dir_t *d = (sdcard_dir_t *)dir;
+    struct dirent *ent = readdir(d->dir);
     
     if (!ent) {
         return ESP_ERR_NOT_FOUND;  // End of directory
@@ -165,15 +193,32 @@ static esp_err_t sdcard_readdir(vfs_dir_t dir, vfs_stat_t *entry)
     strncpy(entry->name, ent->d_name, VFS_MAX_NAME - 1);
     entry->name[VFS_MAX_NAME - 1] = '\0';
     entry->type = (ent->d_type == DT_DIR) ? VFS_TYPE_DIR : VFS_TYPE_FILE;
-    entry->size = 0;  // readdir does not provide size
+    entry->size = 0;
+    entry->mtime = 0;
+    entry->ctime = 0;
+    entry->is_hidden = false;
+    entry->is_readonly = false;
+    
+    struct stat native_stat;
+    if (d->path_len < sizeof(d->path) - 1) {
+        strncpy(&d->path[d->path_len], ent->d_name, sizeof(d->path) - d->path_len - 1);
+        d->path[sizeof(d->path) - 1] = '\0';
+        if (stat(d->path, &native_stat) == 0) {
+            entry->size = native_stat.st_size;
+            entry->mtime = native_stat.st_mtime;
+            entry->ctime = native_stat.st_ctime;
+        }
+    }
     
     return ESP_OK;
 }
 
 static esp_err_t sdcard_closedir(vfs_dir_t dir)
 {
-    DIR *d = (DIR *)dir;
-    return (closedir(d) == 0) ? ESP_OK : ESP_FAIL;
+    sdcard_dir_t *d = (sdcard_dir_t *)dir;
+    int ret = closedir(d->dir);
+    free(d);
+    return (ret == 0) ? ESP_OK : ESP_FAIL;
 }
 
 static esp_err_t sdcard_statvfs(vfs_statvfs_t *stat)
@@ -241,11 +286,57 @@ static const vfs_backend_ops_t s_sdcard_ops = {
     .statvfs = sdcard_statvfs,
 };
 
+/* ============================================================================
+ * SPI ARBITER HOOK
+ * ============================================================================ */
+
+// The card shares SPI3 with the display and the CC1101. Every SD command
+// (including multi-block transfers) runs as one STORAGE job of the SPI
+// arbiter, so the radio can take the bus between two commands and display
+// flush blocks wait behind the card instead of interleaving with it.
+
+typedef struct {
+    int slot;
+    sdmmc_command_t *cmd;
+} sdcard_cmd_ctx_t;
+
+static esp_err_t sdcard_exec_cmd(void *arg)
+{
+    sdcard_cmd_ctx_t *ctx = arg;
+    return sdspi_host_do_transaction(ctx->slot, ctx->cmd);
+}
+
+static esp_err_t sdcard_do_transaction(int slot, sdmmc_command_t *cmd)
+{
+    sdcard_cmd_ctx_t ctx = { .slot = slot, .cmd = cmd };
+    return spi_arbiter_exec(SPI_DEVICE_SD_CARD, SPI_PRIO_STORAGE, sdcard_exec_cmd, &ctx, 0);
+}
+
 /* ============================================================================
  * INITIALIZATION
  * ============================================================================ */
 
-esp_err_t vfs_sdcard_init(void)
+static esp_err_t sdcard_unmount(void);
+
+static bool sdcard_lock(void)
+{
+    // First taken by vfs_sdcard_init() at boot, before the poll task exists
+    if (!s_sdcard.lock) {
+        s_sdcard.lock = xSemaphoreCreateMutex();
+        if (!s_sdcard.lock) {
+            return false;
+        }
+    }
+    xSemaphoreTake(s_sdcard.lock, portMAX_DELAY);
+    return true;
+}
+
+static void sdcard_unlock(void)
+{
+    xSemaphoreGive(s_sdcard.lock);
+}
+
+static esp_err_t sdcard_mount(void)
 {
     if (s_sdcard.mounted) {
         ESP_LOGW(TAG, "SD card already mounted");
@@ -305,20 +396,21 @@ esp_err_t vfs_sdcard_init(void)
     sdmmc_host_t host = SDSPI_HOST_DEFAULT();
     host.slot = SPI3_HOST;
     host.max_freq_khz = SDMMC_FREQ_DEFAULT;
+    host.do_transaction = sdcard_do_transaction;
     
     sdspi_device_config_t slot_config = SDSPI_DEVICE_CONFIG_DEFAULT();
     slot_config.gpio_cs = SD_CARD_CS_PIN;
     slot_config.host_id = SPI3_HOST;
     
     esp_vfs_fat_sdmmc_mount_config_t mount_config = {
-        .format_if_mount_failed = VFS_FORMAT_ON_FAIL,
-        .max_files = VFS_MAX_FILES,
+        .format_if_mount_failed = VFS_SD_FORMAT_ON_FAIL,
+        .max_files = VFS_SD_MAX_FILES,
         .allocation_unit_size = 16 * 1024,
     };
     
     ESP_LOGI(TAG, "Mounting FAT filesystem");
     ret = esp_vfs_fat_sdspi_mount(
-        VFS_MOUNT_POINT,
+        VFS_SD_MOUNT_POINT,
         &host,
         &slot_config,
         &mount_config,
@@ -341,7 +433,7 @@ esp_err_t vfs_sdcard_init(void)
     // Register backend in VFS core
     vfs_backend_config_t backend_config = {
         .type = VFS_BACKEND_SD_FAT,
-        .mount_point = VFS_MOUNT_POINT,
+        .mount_point = VFS_SD_MOUNT_POINT,
         .ops = &s_sdcard_ops,
         .private_data = &s_sdcard,
     };
@@ -349,7 +441,7 @@ esp_err_t vfs_sdcard_init(void)
     ret = vfs_register_backend(&backend_config);
     if (ret != ESP_OK) {
         ESP_LOGE(TAG, "Failed to register SD card backend in VFS core");
-        vfs_sdcard_deinit();
+        sdcard_unmount();
         return ret;
     }
     
@@ -357,7 +449,7 @@ esp_err_t vfs_sdcard_init(void)
     ESP_LOGI(TAG, "Name: %s", s_sdcard.card->cid.name);
     ESP_LOGI(TAG, "Type: %s", 
              s_sdcard.card->ocr & SD_OCR_SDHC_CAP ? "SDHC/SDXC" : "SDSC");
-    ESP_LOGI(TAG, "Capacity: %llu MB", 
+    ESP_LOGI(TAG, "Capacity: %" PRIu64 " MB", 
              ((uint64_t)s_sdcard.card->csd.capacity) * s_sdcard.card->csd.sector_size / (1024 * 1024));
     ESP_LOGI(TAG, "Frequency: %.2f MHz", 
              s_sdcard.card->real_freq_khz / 1000.0f);
@@ -365,7 +457,7 @@ esp_err_t vfs_sdcard_init(void)
     return ESP_OK;
 }
 
-esp_err_t vfs_sdcard_deinit(void)
+static esp_err_t sdcard_unmount(void)
 {
     if (!s_sdcard.mounted) {
         ESP_LOGW(TAG, "SD card is not mounted");
@@ -375,9 +467,9 @@ esp_err_t vfs_sdcard_deinit(void)
     ESP_LOGI(TAG, "Unmounting SD card");
     
     // Unregister from VFS core first
-    vfs_unregister_backend(VFS_MOUNT_POINT);
+    vfs_unregister_backend(VFS_SD_MOUNT_POINT);
     
-    esp_err_t ret = esp_vfs_fat_sdcard_unmount(VFS_MOUNT_POINT, s_sdcard.card);
+    esp_err_t ret = esp_vfs_fat_sdcard_unmount(VFS_SD_MOUNT_POINT, s_sdcard.card);
     
     if (ret == ESP_OK) {
         s_sdcard.mounted = false;
@@ -396,11 +488,47 @@ esp_err_t vfs_sdcard_deinit(void)
     return ret;
 }
 
+esp_err_t vfs_sdcard_init(void)
+{
+    if (!sdcard_lock()) {
+        return ESP_ERR_NO_MEM;
+    }
+    esp_err_t ret = sdcard_mount();
+    sdcard_unlock();
+    return ret;
+}
+
+esp_err_t vfs_sdcard_deinit(void)
+{
+    if (!sdcard_lock()) {
+        return ESP_ERR_NO_MEM;
+    }
+    esp_err_t ret = sdcard_unmount();
+    sdcard_unlock();
+    return ret;
+}
+
 bool vfs_sdcard_is_mounted(void)
 {
     return s_sdcard.mounted;
 }
 
+bool vfs_sdcard_check(void)
+{
+    if (!s_sdcard.mounted || !sdcard_lock()) {
+        return false;
+    }
+    
+    bool present = s_sdcard.mounted && sdmmc_get_status(s_sdcard.card) == ESP_OK;
+    if (!present && s_sdcard.mounted) {
+        // Card removed: drop the mount so open files fail instead of touching the bus
+        ESP_LOGW(TAG, "SD card not responding, unmounting");
+        sdcard_unmount();
+    }
+    sdcard_unlock();
+    return present;
+}
+
 /* ============================================================================
  * REGISTRATION HELPERS
  * ============================================================================ */
@@ -421,6 +549,27 @@ esp_err_t vfs_unregister_sd_backend(void)
  * AUXILIARY FUNCTIONS
  * ============================================================================ */
 
+esp_err_t vfs_sdcard_get_info(vfs_sdcard_info_t *info)
+{
+    if (!info) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_sdcard.mounted || !s_sdcard.card) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    
+    const sdmmc_card_t *card = s_sdcard.card;
+    memset(info, 0, sizeof(*info));
+    strncpy(info->name, card->cid.name, sizeof(info->name) - 1);
+    info->capacity_bytes = (uint64_t)card->csd.capacity * card->csd.sector_size;
+    info->sector_size = card->csd.sector_size;
+    info->sector_count = card->csd.capacity;
+    info->freq_khz = card->real_freq_khz;
+    info->ocr = card->ocr;
+    info->is_sdhc = (card->ocr & SD_OCR_SDHC_CAP) != 0;
+    return ESP_OK;
+}
+
 void vfs_sdcard_print_info(void)
 {
     if (!s_sdcard.mounted) {
@@ -429,22 +578,22 @@ void vfs_sdcard_print_info(void)
     }
     
     ESP_LOGI(TAG, "SD card info");
-    ESP_LOGI(TAG, "Mount point: %s", VFS_MOUNT_POINT);
+    ESP_LOGI(TAG, "Mount point: %s", VFS_SD_MOUNT_POINT);
     ESP_LOGI(TAG, "Name: %s", s_sdcard.card->cid.name);
     ESP_LOGI(TAG, "Type: %s", 
              s_sdcard.card->ocr & SD_OCR_SDHC_CAP ? "SDHC/SDXC" : "SDSC");
     ESP_LOGI(TAG, "Speed: %.2f MHz", 
              s_sdcard.card->real_freq_khz / 1000.0f);
-    ESP_LOGI(TAG, "Capacity: %llu MB", 
+    ESP_LOGI(TAG, "Capacity: %" PRIu64 " MB", 
              ((uint64_t)s_sdcard.card->csd.capacity) * s_sdcard.card->csd.sector_size / (1024 * 1024));
     
     vfs_statvfs_t stat;
-    if (vfs_get_total_space(VFS_MOUNT_POINT, &stat.total_bytes) == ESP_OK &&
-        vfs_get_free_space(VFS_MOUNT_POINT, &stat.free_bytes) == ESP_OK) {
+    if (vfs_get_total_space(VFS_SD_MOUNT_POINT, &stat.total_bytes) == ESP_OK &&
+        vfs_get_free_space(VFS_SD_MOUNT_POINT, &stat.free_bytes) == ESP_OK) {
         stat.used_bytes = stat.total_bytes - stat.free_bytes;
         float percent = stat.total_bytes > 0 ? 
             ((float)stat.used_bytes / stat.total_bytes) * 100.0f : 0.0f;
-        ESP_LOGI(TAG, "Used: %llu MB / %llu MB (%.1f%%)", 
+        ESP_LOGI(TAG, "Used: %" PRIu64 " MB / %" PRIu64 " MB (%.1f%%)", 
                  stat.used_bytes / (1024 * 1024),
                  stat.total_bytes / (1024 * 1024),
                  percent);
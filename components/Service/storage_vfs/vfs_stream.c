@@ -0,0 +1,188 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file vfs_stream.c
+ * @brief Buffered read stream implementation
+ */
+
+#include "vfs_stream.h"
+#include <string.h>
+
+/* ============================================================================
+ * HELPER FUNCTIONS
+ * ============================================================================ */
+
+// Refill an empty buffer. Returns the bytes available (0 = end, -1 = error).
+static ssize_t refill(vfs_stream_t *s)
+{
+    if (s->pos < s->len) return s->len - s->pos;
+    if (s->eof || s->error) return s->error ? -1 : 0;
+
+    ssize_t n = vfs_read(s->fd, &s->buf[1], VFS_STREAM_BUFFER_SIZE);
+    if (n < 0) {
+        s->error = true;
+        return -1;
+    }
+    if (n == 0) {
+        s->eof = true;
+    }
+    s->pos = 1;
+    s->len = 1 + n;
+    return n;
+}
+
+/* ============================================================================
+ * PUBLIC API
+ * ============================================================================ */
+
+esp_err_t vfs_stream_open(vfs_stream_t *s, const char *path)
+{
+    if (!s || !path) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    s->fd = vfs_open(path, VFS_O_RDONLY, 0);
+    s->pos = s->len = 1;
+    s->eof = false;
+    s->error = false;
+
+    return (s->fd == VFS_INVALID_FD) ? ESP_FAIL : ESP_OK;
+}
+
+esp_err_t vfs_stream_seek(vfs_stream_t *s, size_t offset)
+{
+    if (!s || s->fd == VFS_INVALID_FD) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    size_t block = offset & ~(size_t)(VFS_STREAM_BUFFER_SIZE - 1);
+    s->pos = s->len = 1;
+    s->eof = false;
+    s->error = false;
+
+    if (vfs_lseek(s->fd, block, VFS_SEEK_SET) < 0) {
+        s->error = true;
+        return ESP_FAIL;
+    }
+    if (offset > block && refill(s) > 0) {
+        vfs_stream_consume(s, offset - block);
+    }
+    return s->error ? ESP_FAIL : ESP_OK;
+}
+
+esp_err_t vfs_stream_close(vfs_stream_t *s)
+{
+    if (!s || s->fd == VFS_INVALID_FD) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    esp_err_t ret = vfs_close(s->fd);
+    s->fd = VFS_INVALID_FD;
+    return ret;
+}
+
+int vfs_stream_getc(vfs_stream_t *s)
+{
+    if (s->pos == s->len && refill(s) <= 0) {
+        return VFS_STREAM_EOF;
+    }
+    return s->buf[s->pos++];
+}
+
+int vfs_stream_ungetc(vfs_stream_t *s, int c)
+{
+    if (c == VFS_STREAM_EOF || s->pos == 0) {
+        return VFS_STREAM_EOF;
+    }
+    s->buf[--s->pos] = (uint8_t)c;
+    return (uint8_t)c;
+}
+
+ssize_t vfs_stream_read_until(vfs_stream_t *s, int delim, char *dst, size_t size)
+{
+    if (!dst || size < 2) {
+        return -1;
+    }
+
+    size_t stored = 0;
+    bool any = false;
+
+    while (stored < size - 1) {
+        ssize_t avail = refill(s);
+        if (avail <= 0) break;
+        any = true;
+
+        const uint8_t *start = &s->buf[s->pos];
+        size_t room = size - 1 - stored;
+        size_t scan = (size_t)avail < room ? (size_t)avail : room;
+        const uint8_t *hit = memchr(start, delim, scan);
+
+        size_t n = hit ? (size_t)(hit - start) : scan;
+        memcpy(&dst[stored], start, n);
+        stored += n;
+        s->pos += n;
+
+        if (hit) {
+            s->pos++;   // Consume the delimiter
+            break;
+        }
+    }
+
+    // A segment that exactly fills dst still owns its delimiter
+    if (stored == size - 1 && refill(s) > 0 && s->buf[s->pos] == (uint8_t)delim) {
+        s->pos++;
+    }
+
+    dst[stored] = '\0';
+    return any ? (ssize_t)stored : -1;
+}
+
+ssize_t vfs_stream_gets(vfs_stream_t *s, char *dst, size_t size)
+{
+    return vfs_stream_read_until(s, '\n', dst, size);
+}
+
+ssize_t vfs_stream_read(vfs_stream_t *s, void *dst, size_t size)
+{
+    uint8_t *out = dst;
+    size_t done = 0;
+
+    while (done < size) {
+        ssize_t avail = refill(s);
+        if (avail < 0) return done ? (ssize_t)done : -1;
+        if (avail == 0) break;
+
+        size_t n = (size_t)avail < size - done ? (size_t)avail : size - done;
+        memcpy(&out[done], &s->buf[s->pos], n);
+        s->pos += n;
+        done += n;
+    }
+    return done;
+}
+
+ssize_t vfs_stream_peek(vfs_stream_t *s, const uint8_t **data)
+{
+    ssize_t avail = refill(s);
+    if (data) {
+        *data = &s->buf[s->pos];
+    }
+    return avail;
+}
+
+void vfs_stream_consume(vfs_stream_t *s, size_t n)
+{
+    size_t avail = s->len - s->pos;
+    s->pos += n < avail ? n : avail;
+}
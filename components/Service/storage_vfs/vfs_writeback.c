@@ -0,0 +1,814 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file vfs_writeback.c
+ * @brief Write-back append service implementation
+ */
+
+#include "vfs_writeback.h"
+#include "esp_log.h"
+#include "esp_timer.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+#include "freertos/task.h"
+#include <string.h>
+#include <stdlib.h>
+#include <inttypes.h>
+
+static const char *TAG = "vfs_writeback";
+
+#define WB_DEFAULT_PRIORITY     3
+#define WB_DEFAULT_STACK        3072
+
+#define WB_EVT_WORK             (1 << 0)   // Something may be ready to write
+#define WB_EVT_PROGRESS         (1 << 1)   // A chunk was freed or a file closed
+#define WB_EVT_STOPPED          (1 << 2)   // The task has exited
+
+typedef struct {
+    uint8_t *data;
+    uint16_t len;
+    uint16_t cap;                   // Ends the chunk on a VFS_WRITEBACK_CHUNK boundary of the file
+    int16_t next;                   // Queue or free list link
+} wb_chunk_t;
+
+typedef struct {
+    bool in_use;
+    bool busy;                      // The task is writing one of its chunks
+    bool failed;                    // A write failed, reported on the next call
+    uint8_t pinned;                 // Callers in sync/close, keeps the descriptor open
+    vfs_fd_t fd;
+    char path[VFS_MAX_PATH];
+    int16_t head;                   // Queued chunks, oldest first
+    int16_t tail;
+    off_t end;                      // File size once everything queued is written
+    uint64_t queued_total;          // Bytes ever queued
+    uint64_t done_total;            // Bytes written or dropped
+    uint64_t flush_to;              // Write partial chunks until done_total gets here
+    int64_t tail_since_us;          // First byte of the tail chunk
+    int64_t last_used_us;
+} wb_stream_t;
+
+static SemaphoreHandle_t s_lock = NULL;
+static EventGroupHandle_t s_events = NULL;
+static TaskHandle_t s_task = NULL;
+static bool s_running = false;
+static bool s_stopping = false;
+static vfs_writeback_config_t s_config;
+
+static uint8_t *s_pool = NULL;
+static wb_chunk_t *s_chunks = NULL;
+static int s_chunk_count = 0;
+static int s_free_head = -1;
+static int s_free_count = 0;
+static int s_waiters = 0;           // Appends blocked on a full pool
+static int s_next_stream = 0;       // Round-robin start for the task
+
+static wb_stream_t s_streams[VFS_WRITEBACK_STREAMS];
+static vfs_writeback_stats_t s_stats;
+
+#define LOCK()      xSemaphoreTake(s_lock, portMAX_DELAY)
+#define UNLOCK()    xSemaphoreGive(s_lock)
+
+/* ============================================================================
+ * HELPER FUNCTIONS
+ * ============================================================================ */
+
+static inline uint64_t pending(const wb_stream_t *st)
+{
+    return st->queued_total - st->done_total;
+}
+
+static inline bool stream_idle(const wb_stream_t *st)
+{
+    return !st->busy && st->pinned == 0 && pending(st) == 0;
+}
+
+static wb_stream_t *find_stream(const char *path)
+{
+    for (int i = 0; i < VFS_WRITEBACK_STREAMS; i++) {
+        if (s_streams[i].in_use && strcmp(s_streams[i].path, path) == 0) {
+            return &s_streams[i];
+        }
+    }
+    return NULL;
+}
+
+static void free_chunk(int i)
+{
+    s_chunks[i].next = s_free_head;
+    s_free_head = i;
+    s_free_count++;
+}
+
+static int take_chunk(void)
+{
+    int i = s_free_head;
+    s_free_head = s_chunks[i].next;
+    s_free_count--;
+
+    uint32_t used = s_chunk_count - s_free_count;
+    if (used > s_stats.max_queued_chunks) {
+        s_stats.max_queued_chunks = used;
+    }
+    return i;
+}
+
+// Release the slot and return its descriptor (VFS_INVALID_FD if already closed)
+static vfs_fd_t release_stream(wb_stream_t *st)
+{
+    vfs_fd_t fd = st->fd;
+    st->in_use = false;
+    st->fd = VFS_INVALID_FD;
+    s_stats.open_streams--;
+    return fd;
+}
+
+// Chunks needed to queue size more bytes
+static int chunks_needed(const wb_stream_t *st, size_t size)
+{
+    size_t room = 0;
+    if (st && st->tail >= 0) {
+        room = s_chunks[st->tail].cap - s_chunks[st->tail].len;
+    }
+    if (size <= room) {
+        return 0;
+    }
+
+    off_t end = (st ? st->end : 0) + room;
+    size -= room;
+
+    int need = 0;
+    while (size > 0) {
+        size_t cap = VFS_WRITEBACK_CHUNK - (end % VFS_WRITEBACK_CHUNK);
+        size_t n = size < cap ? size : cap;
+        size -= n;
+        end += n;
+        need++;
+    }
+    return need;
+}
+
+static void queue_bytes(wb_stream_t *st, const uint8_t *p, size_t size, int64_t now)
+{
+    while (size > 0) {
+        wb_chunk_t *c = (st->tail >= 0) ? &s_chunks[st->tail] : NULL;
+
+        if (!c || c->len == c->cap) {
+            int i = take_chunk();
+            c = &s_chunks[i];
+            c->len = 0;
+            c->cap = VFS_WRITEBACK_CHUNK - (st->end % VFS_WRITEBACK_CHUNK);
+            c->next = -1;
+
+            if (st->tail >= 0) {
+                s_chunks[st->tail].next = i;
+            } else {
+                st->head = i;
+            }
+            st->tail = i;
+            st->tail_since_us = now;
+        }
+
+        size_t n = c->cap - c->len;
+        if (n > size) n = size;
+
+        memcpy(&c->data[c->len], p, n);
+        c->len += n;
+        st->end += n;
+        st->queued_total += n;
+        p += n;
+        size -= n;
+    }
+}
+
+// Drop every queued chunk after a failed write
+static void drop_queue(wb_stream_t *st)
+{
+    while (st->head >= 0) {
+        int i = st->head;
+        st->head = s_chunks[i].next;
+        s_stats.dropped_bytes += s_chunks[i].len;
+        st->done_total += s_chunks[i].len;
+        s_stats.queued_bytes -= s_chunks[i].len;
+        free_chunk(i);
+    }
+    st->tail = -1;
+}
+
+// Find the stream of a file, opening it if needed (evicts an idle file when full)
+static esp_err_t get_stream(const char *path, wb_stream_t **out)
+{
+    wb_stream_t *st = find_stream(path);
+    if (st) {
+        *out = st;
+        return ESP_OK;
+    }
+
+    if (strlen(path) >= VFS_MAX_PATH) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    wb_stream_t *victim = NULL;
+    for (int i = 0; i < VFS_WRITEBACK_STREAMS; i++) {
+        wb_stream_t *s = &s_streams[i];
+        if (!s->in_use) {
+            st = s;
+            break;
+        }
+        if (stream_idle(s) && (!victim || s->last_used_us < victim->last_used_us)) {
+            victim = s;
+        }
+    }
+
+    if (!st) {
+        if (!victim) {
+            return ESP_ERR_NO_MEM;
+        }
+        vfs_fd_t old = release_stream(victim);
+        if (old != VFS_INVALID_FD) {
+            vfs_close(old);
+        }
+        st = victim;
+    }
+
+    vfs_fd_t fd = vfs_open(path, VFS_O_WRONLY | VFS_O_CREAT | VFS_O_APPEND, 0644);
+    if (fd == VFS_INVALID_FD) {
+        ESP_LOGE(TAG, "Failed to open: %s", path);
+        return ESP_FAIL;
+    }
+
+    vfs_stat_t info;
+    memset(st, 0, sizeof(*st));
+    st->in_use = true;
+    st->fd = fd;
+    strcpy(st->path, path);
+    st->head = st->tail = -1;
+    st->end = (vfs_fstat(fd, &info) == ESP_OK) ? (off_t)info.size : 0;
+    st->last_used_us = esp_timer_get_time();
+    s_stats.open_streams++;
+
+    *out = st;
+    return ESP_OK;
+}
+
+// A failed stream is reported once, then forgotten so the next append reopens the file
+static esp_err_t take_failure(wb_stream_t *st)
+{
+    if (!st->failed) {
+        return ESP_OK;
+    }
+    if (!st->busy && st->pinned == 0) {
+        release_stream(st);     // Descriptor already closed by the task
+    }
+    return ESP_FAIL;
+}
+
+// Sleep until the task makes progress. Called and returns with the lock held.
+static bool wait_progress(int64_t deadline_us)
+{
+    int64_t left = deadline_us - esp_timer_get_time();
+    if (left <= 0) {
+        return false;
+    }
+
+    TickType_t ticks = (deadline_us == INT64_MAX) ? portMAX_DELAY
+                                                  : pdMS_TO_TICKS((left + 999) / 1000) + 1;
+
+    xEventGroupClearBits(s_events, WB_EVT_PROGRESS);
+    UNLOCK();
+    xEventGroupSetBits(s_events, WB_EVT_WORK);
+    xEventGroupWaitBits(s_events, WB_EVT_PROGRESS, pdFALSE, pdFALSE, ticks);
+    LOCK();
+    return true;
+}
+
+static int64_t deadline_from(uint32_t timeout_ms)
+{
+    if (timeout_ms == UINT32_MAX) {
+        return INT64_MAX;
+    }
+    return esp_timer_get_time() + (int64_t)timeout_ms * 1000;
+}
+
+// Wait until the data queued so far for path (NULL = all) is written. Lock held.
+static esp_err_t drain_locked(const char *path, int64_t deadline_us)
+{
+    bool target[VFS_WRITEBACK_STREAMS] = {0};
+    bool found = false;
+
+    for (int i = 0; i < VFS_WRITEBACK_STREAMS; i++) {
+        wb_stream_t *st = &s_streams[i];
+        if (st->in_use && (!path || strcmp(st->path, path) == 0)) {
+            st->flush_to = st->queued_total;
+            target[i] = true;
+            found = true;
+        }
+    }
+    if (!found) {
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    for (;;) {
+        bool done = true;
+        for (int i = 0; i < VFS_WRITEBACK_STREAMS && done; i++) {
+            wb_stream_t *st = &s_streams[i];
+            if (target[i] && st->in_use && st->done_total < st->flush_to) {
+                done = false;
+            }
+        }
+        if (done) {
+            return ESP_OK;
+        }
+        if (!wait_progress(deadline_us)) {
+            return ESP_ERR_TIMEOUT;
+        }
+    }
+}
+
+/* ============================================================================
+ * BACKGROUND TASK
+ * ============================================================================ */
+
+static bool chunk_ready(const wb_stream_t *st, int64_t now)
+{
+    const wb_chunk_t *c = &s_chunks[st->head];
+
+    return st->head != st->tail || c->len == c->cap ||
+           s_waiters > 0 || s_stopping ||
+           st->done_total < st->flush_to ||
+           now - st->tail_since_us >= (int64_t)s_config.flush_ms * 1000;
+}
+
+// Write the next ready chunk. Returns false when there was nothing to write.
+static bool write_one(void)
+{
+    LOCK();
+
+    int64_t now = esp_timer_get_time();
+    wb_stream_t *st = NULL;
+
+    for (int n = 0; n < VFS_WRITEBACK_STREAMS; n++) {
+        wb_stream_t *s = &s_streams[(s_next_stream + n) % VFS_WRITEBACK_STREAMS];
+        if (s->in_use && !s->busy && s->head >= 0 && chunk_ready(s, now)) {
+            st = s;
+            s_next_stream = (s_next_stream + n + 1) % VFS_WRITEBACK_STREAMS;
+            break;
+        }
+    }
+    if (!st) {
+        UNLOCK();
+        return false;
+    }
+
+    // Detach the chunk: new appends start a fresh one instead of touching it
+    int i = st->head;
+    wb_chunk_t *c = &s_chunks[i];
+    st->head = c->next;
+    if (st->tail == i) {
+        st->tail = -1;
+    }
+    st->busy = true;
+    vfs_fd_t fd = st->fd;
+    UNLOCK();
+
+    int64_t start = esp_timer_get_time();
+    ssize_t written = vfs_write(fd, c->data, c->len);
+    int64_t end = esp_timer_get_time();
+
+    LOCK();
+    uint32_t took = (uint32_t)(end - start);
+    if (took > s_stats.max_write_us) {
+        s_stats.max_write_us = took;
+    }
+    s_stats.backend_writes++;
+    s_stats.queued_bytes -= c->len;
+    st->done_total += c->len;
+
+    if (written == (ssize_t)c->len) {
+        s_stats.written_bytes += c->len;
+    } else {
+        ESP_LOGE(TAG, "Write failed: %s, dropping %" PRIu64 " queued bytes",
+                 st->path, pending(st) + c->len);
+        s_stats.errors++;
+        s_stats.dropped_bytes += c->len;
+        drop_queue(st);
+        vfs_close(st->fd);
+        st->fd = VFS_INVALID_FD;
+        st->failed = true;
+    }
+
+    free_chunk(i);
+    st->busy = false;
+    st->last_used_us = end;
+    UNLOCK();
+
+    xEventGroupSetBits(s_events, WB_EVT_PROGRESS);
+    return true;
+}
+
+// Close files with nothing queued that were not used for a while
+static void close_idle(void)
+{
+    int64_t now = esp_timer_get_time();
+
+    for (int i = 0; i < VFS_WRITEBACK_STREAMS; i++) {
+        LOCK();
+        wb_stream_t *st = &s_streams[i];
+        vfs_fd_t fd = VFS_INVALID_FD;
+
+        if (st->in_use && !st->failed && stream_idle(st) &&
+            now - st->last_used_us >= (int64_t)s_config.idle_ms * 1000) {
+            fd = release_stream(st);
+        }
+        UNLOCK();
+
+        if (fd != VFS_INVALID_FD) {
+            if (vfs_close(fd) != ESP_OK) {
+                ESP_LOGW(TAG, "Close failed: descriptor %d", fd);
+            }
+            xEventGroupSetBits(s_events, WB_EVT_PROGRESS);
+        }
+    }
+}
+
+static void writeback_task(void *arg)
+{
+    uint32_t poll_ms = s_config.flush_ms / 4;
+    if (poll_ms < 10) poll_ms = 10;
+
+    for (;;) {
+        xEventGroupWaitBits(s_events, WB_EVT_WORK, pdTRUE, pdFALSE, pdMS_TO_TICKS(poll_ms));
+
+        while (write_one()) {
+        }
+        close_idle();
+
+        LOCK();
+        bool stop = s_stopping && s_stats.queued_bytes == 0;
+        UNLOCK();
+        if (stop) {
+            break;
+        }
+    }
+
+    xEventGroupSetBits(s_events, WB_EVT_STOPPED);
+    vTaskDelete(NULL);
+}
+
+/* ============================================================================
+ * SERVICE
+ * ============================================================================ */
+
+esp_err_t vfs_writeback_start(const vfs_writeback_config_t *config)
+{
+    if (!s_lock) {
+        s_lock = xSemaphoreCreateMutex();
+        s_events = xEventGroupCreate();
+        if (!s_lock || !s_events) {
+            return ESP_ERR_NO_MEM;      // Kept for the next start
+        }
+    }
+
+    LOCK();
+    if (s_running || s_task) {
+        UNLOCK();
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    vfs_writeback_config_t cfg = config ? *config : (vfs_writeback_config_t){0};
+    if (cfg.budget == 0) cfg.budget = VFS_WRITEBACK_BUDGET;
+    if (cfg.flush_ms == 0) cfg.flush_ms = VFS_WRITEBACK_FLUSH_MS;
+    if (cfg.idle_ms == 0) cfg.idle_ms = VFS_WRITEBACK_IDLE_MS;
+    if (cfg.task_priority == 0) cfg.task_priority = WB_DEFAULT_PRIORITY;
+    if (cfg.task_stack == 0) cfg.task_stack = WB_DEFAULT_STACK;
+
+    int count = cfg.budget / VFS_WRITEBACK_CHUNK;
+    if (count < 2) count = 2;
+
+    s_pool = malloc((size_t)count * VFS_WRITEBACK_CHUNK);
+    s_chunks = calloc(count, sizeof(wb_chunk_t));
+    if (!s_pool || !s_chunks) {
+        free(s_pool);
+        free(s_chunks);
+        s_pool = NULL;
+        s_chunks = NULL;
+        UNLOCK();
+        return ESP_ERR_NO_MEM;
+    }
+
+    s_chunk_count = count;
+    s_free_head = -1;
+    s_free_count = 0;
+    for (int i = count - 1; i >= 0; i--) {
+        s_chunks[i].data = &s_pool[(size_t)i * VFS_WRITEBACK_CHUNK];
+        free_chunk(i);
+    }
+
+    memset(s_streams, 0, sizeof(s_streams));
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.total_chunks = count;
+    s_config = cfg;
+    s_waiters = 0;
+    s_stopping = false;
+
+    xEventGroupClearBits(s_events, WB_EVT_WORK | WB_EVT_PROGRESS | WB_EVT_STOPPED);
+    if (xTaskCreate(writeback_task, "vfs_writeback", cfg.task_stack, NULL,
+                    cfg.task_priority, &s_task) != pdPASS) {
+        free(s_pool);
+        free(s_chunks);
+        s_pool = NULL;
+        s_chunks = NULL;
+        s_task = NULL;
+        UNLOCK();
+        return ESP_ERR_NO_MEM;
+    }
+
+    s_running = true;
+    UNLOCK();
+
+    ESP_LOGI(TAG, "Started: %d x %d byte chunks, %d files", count, VFS_WRITEBACK_CHUNK,
+             VFS_WRITEBACK_STREAMS);
+    return ESP_OK;
+}
+
+esp_err_t vfs_writeback_stop(void)
+{
+    if (!s_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    LOCK();
+    if (!s_running) {
+        UNLOCK();
+        return ESP_ERR_INVALID_STATE;
+    }
+    s_running = false;          // New appends are refused from here on
+    s_stopping = true;
+    UNLOCK();
+
+    xEventGroupSetBits(s_events, WB_EVT_WORK);
+    xEventGroupWaitBits(s_events, WB_EVT_STOPPED, pdTRUE, pdFALSE, portMAX_DELAY);
+
+    LOCK();
+    s_task = NULL;
+    for (int i = 0; i < VFS_WRITEBACK_STREAMS; i++) {
+        wb_stream_t *st = &s_streams[i];
+        if (st->in_use) {
+            vfs_fd_t fd = release_stream(st);
+            if (fd != VFS_INVALID_FD) {
+                vfs_close(fd);
+            }
+        }
+    }
+    free(s_pool);
+    free(s_chunks);
+    s_pool = NULL;
+    s_chunks = NULL;
+    s_chunk_count = 0;
+    s_free_head = -1;
+    s_free_count = 0;
+    s_stopping = false;
+    UNLOCK();
+
+    xEventGroupSetBits(s_events, WB_EVT_PROGRESS);     // Wake appends still waiting
+    ESP_LOGI(TAG, "Stopped");
+    return ESP_OK;
+}
+
+bool vfs_writeback_is_running(void)
+{
+    return s_running;
+}
+
+/* ============================================================================
+ * APPEND AND FLUSH
+ * ============================================================================ */
+
+esp_err_t vfs_writeback_append(const char *path, const void *data, size_t size, uint32_t timeout_ms)
+{
+    if (!path || (!data && size > 0)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    int64_t start = esp_timer_get_time();
+    int64_t deadline = deadline_from(timeout_ms);
+    bool stalled = false;
+    esp_err_t ret;
+
+    LOCK();
+    for (;;) {
+        if (!s_running) {
+            ret = ESP_ERR_INVALID_STATE;
+            break;
+        }
+        if (size > (size_t)(s_chunk_count - 1) * VFS_WRITEBACK_CHUNK) {
+            ret = ESP_ERR_INVALID_SIZE;
+            break;
+        }
+
+        // Looked up again after every wait: the file may have been closed meanwhile
+        wb_stream_t *st;
+        ret = get_stream(path, &st);
+        if (ret != ESP_OK) {
+            break;
+        }
+        ret = take_failure(st);
+        if (ret != ESP_OK) {
+            break;
+        }
+
+        if (chunks_needed(st, size) <= s_free_count) {
+            int64_t now = esp_timer_get_time();
+
+            queue_bytes(st, data, size, now);
+            st->last_used_us = now;
+            s_stats.appended_bytes += size;
+            s_stats.queued_bytes += size;
+            if (s_stats.queued_bytes > s_stats.max_queued_bytes) {
+                s_stats.max_queued_bytes = s_stats.queued_bytes;
+            }
+
+            // Wake the task when a chunk fills; partial ones wait for their age
+            if (st->head != st->tail || s_chunks[st->tail].len == s_chunks[st->tail].cap) {
+                xEventGroupSetBits(s_events, WB_EVT_WORK);
+            }
+            break;
+        }
+
+        if (!stalled) {
+            stalled = true;
+            s_stats.stalls++;
+        }
+
+        s_waiters++;
+        bool in_time = wait_progress(deadline);
+        s_waiters--;
+
+        if (!in_time) {
+            s_stats.timeouts++;
+            ret = ESP_ERR_TIMEOUT;
+            break;
+        }
+    }
+
+    if (stalled) {
+        uint32_t waited = (uint32_t)(esp_timer_get_time() - start);
+        if (waited > s_stats.max_stall_us) {
+            s_stats.max_stall_us = waited;
+        }
+    }
+    UNLOCK();
+
+    return ret;
+}
+
+esp_err_t vfs_writeback_flush(const char *path, uint32_t timeout_ms)
+{
+    if (!s_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    LOCK();
+    if (!s_running) {
+        UNLOCK();
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    esp_err_t ret = drain_locked(path, deadline_from(timeout_ms));
+
+    for (int i = 0; i < VFS_WRITEBACK_STREAMS; i++) {
+        wb_stream_t *st = &s_streams[i];
+        if (st->in_use && (!path || strcmp(st->path, path) == 0) &&
+            take_failure(st) != ESP_OK && ret == ESP_OK) {
+            ret = ESP_FAIL;
+        }
+    }
+    UNLOCK();
+
+    return ret;
+}
+
+esp_err_t vfs_writeback_sync(const char *path, uint32_t timeout_ms)
+{
+    esp_err_t ret = vfs_writeback_flush(path, timeout_ms);
+    if (ret != ESP_OK) {
+        return ret;
+    }
+
+    for (int i = 0; i < VFS_WRITEBACK_STREAMS; i++) {
+        LOCK();
+        wb_stream_t *st = &s_streams[i];
+        vfs_fd_t fd = VFS_INVALID_FD;
+
+        if (st->in_use && st->fd != VFS_INVALID_FD && (!path || strcmp(st->path, path) == 0)) {
+            fd = st->fd;
+            st->pinned++;       // Not closed as idle while the commit runs
+        }
+        UNLOCK();
+
+        if (fd == VFS_INVALID_FD) {
+            continue;
+        }
+
+        esp_err_t err = vfs_fsync(fd);
+
+        LOCK();
+        st->pinned--;
+        UNLOCK();
+
+        if (err != ESP_OK && ret == ESP_OK) {
+            ESP_LOGE(TAG, "Sync failed: %s", st->path);
+            ret = err;
+        }
+    }
+
+    return ret;
+}
+
+esp_err_t vfs_writeback_close(const char *path)
+{
+    if (!path) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    LOCK();
+    wb_stream_t *st = find_stream(path);
+    if (!st) {
+        UNLOCK();
+        return ESP_ERR_NOT_FOUND;
+    }
+
+    st->pinned++;
+    drain_locked(path, INT64_MAX);
+    st->pinned--;
+
+    // Another close() of the same file still waiting releases it instead
+    esp_err_t ret = st->failed ? ESP_FAIL : ESP_OK;
+    vfs_fd_t fd = VFS_INVALID_FD;
+    if (st->pinned == 0) {
+        fd = release_stream(st);
+    }
+    UNLOCK();
+
+    if (fd != VFS_INVALID_FD && vfs_close(fd) != ESP_OK) {
+        ret = ESP_FAIL;
+    }
+    xEventGroupSetBits(s_events, WB_EVT_PROGRESS);
+    return ret;
+}
+
+/* ============================================================================
+ * STATISTICS
+ * ============================================================================ */
+
+esp_err_t vfs_writeback_get_stats(vfs_writeback_stats_t *stats)
+{
+    if (!stats) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    if (!s_lock) {
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    LOCK();
+    *stats = s_stats;
+    stats->queued_chunks = s_chunk_count - s_free_count;
+    UNLOCK();
+    return ESP_OK;
+}
+
+void vfs_writeback_reset_stats(void)
+{
+    if (!s_lock) {
+        return;
+    }
+
+    LOCK();
+    vfs_writeback_stats_t keep = s_stats;
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_stats.queued_bytes = keep.queued_bytes;
+    s_stats.max_queued_bytes = keep.queued_bytes;
+    s_stats.total_chunks = keep.total_chunks;
+    s_stats.open_streams = keep.open_streams;
+    s_stats.max_queued_chunks = s_chunk_count - s_free_count;
+    UNLOCK();
+}
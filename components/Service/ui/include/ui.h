@@ -0,0 +1,216 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#ifndef UI_H
+#define UI_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "font.h"
+#include "asset.h"
+
+// Camada de widgets retidos. Cada tela é uma lista de widgets com limites
+// fixos; quando o modelo de um widget muda ele se marca como inválido e a
+// task de UI redesenha apenas os widgets inválidos, enviando ao display só
+// as regiões alteradas. Tela parada = nenhum tráfego SPI.
+//
+// Os widgets são alocados pelo chamador (normalmente estáticos ou na pilha
+// da tela) e todos os setters podem ser chamados de qualquer task.
+
+typedef struct ui_widget ui_widget_t;
+
+// Desenha o widget. Deve pintar todo o retângulo (x, y, w, h).
+typedef void (*ui_draw_fn_t)(ui_widget_t *widget);
+
+struct ui_widget {
+    int16_t x, y, w, h;
+    ui_draw_fn_t draw;
+    uint16_t bg;               // Cor usada para apagar o widget quando oculto
+    bool visible;
+    bool invalid;
+    bool partial;              // Só as partes marcadas pelo próprio widget mudaram
+    ui_widget_t *next;         // Próximo widget da tela (ordem de desenho)
+};
+
+typedef struct {
+    ui_widget_t *first;
+    ui_widget_t *last;
+    uint16_t bg;
+    bool needs_clear;          // Pinta o fundo inteiro antes do próximo desenho
+} ui_screen_t;
+
+typedef struct {
+    uint32_t frames;           // Flushes feitos pela task de UI
+    uint32_t widgets_drawn;
+    uint32_t wakeups;          // Vezes que a task acordou
+} ui_stats_t;
+
+// ---------------- Núcleo ----------------
+
+esp_err_t ui_init(void);
+
+void ui_screen_init(ui_screen_t *screen, uint16_t bg);
+void ui_screen_add(ui_screen_t *screen, ui_widget_t *widget);
+
+// Torna a tela ativa e agenda um redesenho completo
+void ui_screen_show(ui_screen_t *screen);
+
+// Desativa a tela atual. Ao retornar a task de UI não toca mais no
+// framebuffer, então a tela chamadora pode desenhar no modo imediato.
+void ui_screen_hide(void);
+
+// Widget genérico com função de desenho própria (decoração, elementos fixos)
+void ui_widget_init(ui_widget_t *widget, int x, int y, int w, int h, ui_draw_fn_t draw, uint16_t bg);
+void ui_invalidate(ui_widget_t *widget);
+
+// Para widgets que sabem redesenhar só uma parte (linhas da lista, células da
+// grade): o widget guarda o que mudou e o desenho consulta `partial`. Um
+// ui_invalidate() pendente prevalece e força o desenho completo.
+void ui_invalidate_partial(ui_widget_t *widget);
+void ui_set_visible(ui_widget_t *widget, bool visible);
+
+// Agrupa várias alterações em um único redesenho
+void ui_lock(void);
+void ui_unlock(void);
+
+void ui_get_stats(ui_stats_t *stats);
+
+// ---------------- Label ----------------
+
+#define UI_LABEL_MAX_TEXT 48
+
+typedef enum {
+    UI_ALIGN_LEFT = 0,
+    UI_ALIGN_CENTER,
+    UI_ALIGN_RIGHT
+} ui_align_t;
+
+typedef struct {
+    ui_widget_t base;
+    char text[UI_LABEL_MAX_TEXT];
+    const font_t *font;
+    uint8_t scale;
+    ui_align_t align;
+    uint16_t fg;
+} ui_label_t;
+
+void ui_label_init(ui_label_t *label, int x, int y, int w, int h, const char *text,
+                   uint16_t fg, uint16_t bg);
+void ui_label_set_text(ui_label_t *label, const char *text);
+void ui_label_set_textf(ui_label_t *label, const char *fmt, ...)
+    __attribute__((format(printf, 2, 3)));
+void ui_label_set_color(ui_label_t *label, uint16_t fg, uint16_t bg);
+void ui_label_set_font(ui_label_t *label, const font_t *font, int scale);
+void ui_label_set_align(ui_label_t *label, ui_align_t align);
+
+// ---------------- Barra de progresso ----------------
+
+typedef struct {
+    ui_widget_t base;
+    uint8_t value;             // 0 a 100
+    uint8_t radius;            // 0 = retângulo reto
+    uint8_t margin;            // Espaço entre a borda e a barra
+    uint16_t fg;
+    uint16_t border;           // Igual a bg = sem borda
+} ui_progress_t;
+
+void ui_progress_init(ui_progress_t *bar, int x, int y, int w, int h,
+                      uint16_t fg, uint16_t border, uint16_t bg);
+void ui_progress_set_style(ui_progress_t *bar, int radius, int margin);
+void ui_progress_set_value(ui_progress_t *bar, int value);
+void ui_progress_set_color(ui_progress_t *bar, uint16_t fg);
+
+// ---------------- Gráfico ----------------
+
+#define UI_GRAPH_MAX_POINTS 240
+
+typedef struct {
+    ui_widget_t base;
+    int16_t samples[UI_GRAPH_MAX_POINTS];   // Buffer circular
+    uint16_t capacity;         // Pontos distribuídos na largura do gráfico
+    uint16_t head;             // Índice da amostra mais antiga
+    int16_t min, max;          // Faixa do eixo Y
+    int16_t grid_step;         // 0 = sem grade
+    bool axis_labels;          // Valores da grade no canto esquerdo
+    uint16_t fg, grid, border;
+} ui_graph_t;
+
+void ui_graph_init(ui_graph_t *graph, int x, int y, int w, int h, int capacity,
+                   int min, int max, uint16_t fg, uint16_t bg);
+void ui_graph_set_grid(ui_graph_t *graph, int step, uint16_t grid, uint16_t border, bool axis_labels);
+void ui_graph_push(ui_graph_t *graph, int value);
+void ui_graph_clear(ui_graph_t *graph, int value);
+
+// ---------------- Lista ----------------
+
+#define UI_LIST_MAX_ROWS      32    // Linhas visíveis simultaneamente
+#define UI_LIST_SCROLLBAR_W   6
+
+typedef struct ui_list ui_list_t;
+
+// Desenha o conteúdo de um item; o fundo da linha já foi pintado
+typedef void (*ui_list_draw_item_fn_t)(ui_list_t *list, int index, int x, int y,
+                                       int w, int h, bool selected);
+
+struct ui_list {
+    ui_widget_t base;
+    int count;
+    int selected;
+    int top;                   // Primeiro item visível
+    int16_t row_h;
+    const char *const *labels; // Usado pelo desenho padrão
+    ui_list_draw_item_fn_t draw_item;
+    void *user;
+    uint16_t fg, sel_fg, sel_bg;
+    bool scrollbar;
+    uint32_t dirty_rows;       // Linhas visíveis a redesenhar (bit = linha)
+};
+
+void ui_list_init(ui_list_t *list, int x, int y, int w, int h, int row_h,
+                  uint16_t fg, uint16_t bg, uint16_t sel_fg, uint16_t sel_bg);
+void ui_list_set_items(ui_list_t *list, const char *const *labels, int count);
+void ui_list_set_drawer(ui_list_t *list, ui_list_draw_item_fn_t draw_item, void *user);
+void ui_list_set_scrollbar(ui_list_t *list, bool enabled);
+void ui_list_set_selected(ui_list_t *list, int index);
+void ui_list_move(ui_list_t *list, int delta);   // Com volta ao início/fim
+int ui_list_visible_rows(const ui_list_t *list);
+
+// ---------------- Grade de ícones ----------------
+
+typedef struct {
+    const asset_image_t *icon; // icon_size x icon_size
+    const char *label;
+} ui_icon_item_t;
+
+typedef struct {
+    ui_widget_t base;
+    const ui_icon_item_t *items;
+    int count;
+    int cols;
+    int16_t cell_w, cell_h;
+    int16_t icon_size;
+    int selected;
+    uint16_t fg, sel;
+    uint32_t dirty_cells;      // Células a redesenhar (bit = célula)
+} ui_icon_grid_t;
+
+void ui_icon_grid_init(ui_icon_grid_t *grid, int x, int y, int cols, int cell_w, int cell_h,
+                       int icon_size, const ui_icon_item_t *items, int count,
+                       uint16_t fg, uint16_t sel, uint16_t bg);
+void ui_icon_grid_set_selected(ui_icon_grid_t *grid, int index);
+void ui_icon_grid_move(ui_icon_grid_t *grid, int dx, int dy);
+
+#endif // UI_H
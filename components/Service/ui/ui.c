@@ -0,0 +1,209 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "ui.h"
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_log.h"
+#include "st7789.h"
+
+#define TAG "UI"
+
+#define UI_TASK_STACK   4096
+#define UI_TASK_PRIO    5
+
+static SemaphoreHandle_t ui_mutex = NULL;
+static TaskHandle_t ui_task_handle = NULL;
+static ui_screen_t *active_screen = NULL;
+static int lock_depth = 0;
+static bool pending = false;       // Há algo inválido aguardando a task
+static ui_stats_t stats;
+
+// Acorda a task de UI. Deve ser chamada com o mutex tomado.
+static void request_redraw(void) {
+    if (lock_depth > 1) {
+        pending = true;            // ui_unlock() externo acorda a task
+        return;
+    }
+    pending = false;
+    if (ui_task_handle) {
+        xTaskNotifyGive(ui_task_handle);
+    }
+}
+
+void ui_lock(void) {
+    xSemaphoreTakeRecursive(ui_mutex, portMAX_DELAY);
+    lock_depth++;
+}
+
+void ui_unlock(void) {
+    if (--lock_depth == 0 && pending) {
+        pending = false;
+        if (ui_task_handle) {
+            xTaskNotifyGive(ui_task_handle);
+        }
+    }
+    xSemaphoreGiveRecursive(ui_mutex);
+}
+
+// Redesenha os widgets inválidos da tela ativa e envia só as regiões alteradas
+static void ui_task(void *arg) {
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        stats.wakeups++;
+
+        ui_lock();
+        ui_screen_t *screen = active_screen;
+        int drawn = 0;
+
+        if (screen) {
+            if (screen->needs_clear) {
+                st7789_fill_screen_fb(screen->bg);
+                screen->needs_clear = false;
+                drawn++;
+            }
+            for (ui_widget_t *w = screen->first; w; w = w->next) {
+                if (!w->invalid) continue;
+                if (w->visible) {
+                    w->draw(w);
+                } else {
+                    st7789_fill_rect_fb(w->x, w->y, w->w, w->h, w->bg);
+                }
+                w->invalid = false;
+                w->partial = false;
+                drawn++;
+            }
+        }
+
+        // O flush fica dentro do lock: ui_screen_hide() só retorna depois dele
+        if (drawn) {
+            st7789_flush();
+            stats.frames++;
+            stats.widgets_drawn += drawn;
+        }
+        ui_unlock();
+    }
+}
+
+esp_err_t ui_init(void) {
+    if (ui_task_handle) {
+        return ESP_OK;
+    }
+
+    ui_mutex = xSemaphoreCreateRecursiveMutex();
+    if (!ui_mutex) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    // Sem redesenho completo a cada quadro, o envio por danos é o que
+    // garante tráfego zero em telas paradas.
+    st7789_set_flush_mode(ST7789_FLUSH_DAMAGE);
+
+    if (xTaskCreate(ui_task, "ui_task", UI_TASK_STACK, NULL, UI_TASK_PRIO, &ui_task_handle) != pdPASS) {
+        ESP_LOGE(TAG, "Falha ao criar task de UI");
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+void ui_screen_init(ui_screen_t *screen, uint16_t bg) {
+    memset(screen, 0, sizeof(*screen));
+    screen->bg = bg;
+}
+
+void ui_screen_add(ui_screen_t *screen, ui_widget_t *widget) {
+    widget->next = NULL;
+    if (screen->last) {
+        screen->last->next = widget;
+    } else {
+        screen->first = widget;
+    }
+    screen->last = widget;
+}
+
+void ui_screen_show(ui_screen_t *screen) {
+    if (ui_init() != ESP_OK) return;
+
+    ui_lock();
+    active_screen = screen;
+    screen->needs_clear = true;
+    for (ui_widget_t *w = screen->first; w; w = w->next) {
+        w->invalid = true;
+        w->partial = false;
+    }
+    request_redraw();
+    ui_unlock();
+}
+
+void ui_screen_hide(void) {
+    if (!ui_mutex) return;
+
+    ui_lock();
+    active_screen = NULL;
+    pending = false;
+    ui_unlock();
+}
+
+void ui_widget_init(ui_widget_t *widget, int x, int y, int w, int h, ui_draw_fn_t draw, uint16_t bg) {
+    memset(widget, 0, sizeof(*widget));
+    widget->x = x;
+    widget->y = y;
+    widget->w = w;
+    widget->h = h;
+    widget->draw = draw;
+    widget->bg = bg;
+    widget->visible = true;
+    widget->invalid = true;
+}
+
+void ui_invalidate(ui_widget_t *widget) {
+    if (!ui_mutex) {
+        // Antes de ui_init() não há task: só marca
+        widget->invalid = true;
+        widget->partial = false;
+        return;
+    }
+    ui_lock();
+    widget->invalid = true;
+    widget->partial = false;
+    request_redraw();
+    ui_unlock();
+}
+
+void ui_invalidate_partial(ui_widget_t *widget) {
+    if (!ui_mutex) {
+        widget->invalid = true;
+        return;
+    }
+    ui_lock();
+    if (!widget->invalid) {
+        widget->invalid = true;
+        widget->partial = true;
+    }
+    request_redraw();
+    ui_unlock();
+}
+
+void ui_set_visible(ui_widget_t *widget, bool visible) {
+    if (widget->visible == visible) return;
+    widget->visible = visible;
+    ui_invalidate(widget);
+}
+
+void ui_get_stats(ui_stats_t *out) {
+    if (out) *out = stats;
+}
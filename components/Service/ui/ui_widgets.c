@@ -0,0 +1,474 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include "ui.h"
+#include <stdio.h>
+#include <stdarg.h>
+#include <string.h>
+#include "st7789.h"
+#include "st7789_text.h"
+#include "st7789_asset.h"
+
+// ---------------- Label ----------------
+
+static void label_draw(ui_widget_t *w) {
+    ui_label_t *label = (ui_label_t *)w;
+    st7789_fill_rect_fb(w->x, w->y, w->w, w->h, w->bg);
+
+    int text_w, text_h;
+    st7789_measure_text(label->font, label->scale, label->text, &text_w, &text_h);
+
+    int tx = w->x;
+    if (label->align == UI_ALIGN_CENTER) tx += (w->w - text_w) / 2;
+    else if (label->align == UI_ALIGN_RIGHT) tx += w->w - text_w;
+    int ty = w->y + (w->h - text_h) / 2;
+
+    st7789_set_text_clip(w->x, w->y, w->w, w->h);
+    st7789_draw_text_font_fb(tx, ty, label->text, label->font, label->scale, label->fg, w->bg);
+    st7789_reset_text_clip();
+}
+
+void ui_label_init(ui_label_t *label, int x, int y, int w, int h, const char *text,
+                   uint16_t fg, uint16_t bg) {
+    memset(label, 0, sizeof(*label));
+    ui_widget_init(&label->base, x, y, w, h, label_draw, bg);
+    label->font = &font_5x7;
+    label->scale = 1;
+    label->fg = fg;
+    if (text) {
+        strncpy(label->text, text, UI_LABEL_MAX_TEXT - 1);
+    }
+}
+
+void ui_label_set_text(ui_label_t *label, const char *text) {
+    if (!text) text = "";
+    ui_lock();
+    if (strncmp(label->text, text, UI_LABEL_MAX_TEXT - 1) != 0) {
+        strncpy(label->text, text, UI_LABEL_MAX_TEXT - 1);
+        label->text[UI_LABEL_MAX_TEXT - 1] = '\0';
+        ui_invalidate(&label->base);
+    }
+    ui_unlock();
+}
+
+void ui_label_set_textf(ui_label_t *label, const char *fmt, ...) {
+    char buffer[UI_LABEL_MAX_TEXT];
+    va_list args;
+    va_start(args, fmt);
+    vsnprintf(buffer, sizeof(buffer), fmt, args);
+    va_end(args);
+    ui_label_set_text(label, buffer);
+}
+
+void ui_label_set_color(ui_label_t *label, uint16_t fg, uint16_t bg) {
+    ui_lock();
+    if (label->fg != fg || label->base.bg != bg) {
+        label->fg = fg;
+        label->base.bg = bg;
+        ui_invalidate(&label->base);
+    }
+    ui_unlock();
+}
+
+void ui_label_set_font(ui_label_t *label, const font_t *font, int scale) {
+    ui_lock();
+    label->font = font ? font : &font_5x7;
+    label->scale = scale < 1 ? 1 : scale;
+    ui_invalidate(&label->base);
+    ui_unlock();
+}
+
+void ui_label_set_align(ui_label_t *label, ui_align_t align) {
+    ui_lock();
+    if (label->align != align) {
+        label->align = align;
+        ui_invalidate(&label->base);
+    }
+    ui_unlock();
+}
+
+// ---------------- Barra de progresso ----------------
+
+static void progress_draw(ui_widget_t *w) {
+    ui_progress_t *bar = (ui_progress_t *)w;
+    st7789_fill_rect_fb(w->x, w->y, w->w, w->h, w->bg);
+
+    if (bar->border != w->bg) {
+        if (bar->radius) st7789_draw_round_rect_fb(w->x, w->y, w->w, w->h, bar->radius, bar->border);
+        else st7789_draw_rect_fb(w->x, w->y, w->w, w->h, bar->border);
+    }
+
+    int inner_w = w->w - bar->margin * 2;
+    int fill_w = inner_w * bar->value / 100;
+    if (fill_w <= 0) return;
+
+    int inner_h = w->h - bar->margin * 2;
+    int r = bar->radius / 2;
+    if (r * 2 > fill_w) r = fill_w / 2;
+    if (r) st7789_fill_round_rect_fb(w->x + bar->margin, w->y + bar->margin, fill_w, inner_h, r, bar->fg);
+    else st7789_fill_rect_fb(w->x + bar->margin, w->y + bar->margin, fill_w, inner_h, bar->fg);
+}
+
+void ui_progress_init(ui_progress_t *bar, int x, int y, int w, int h,
+                      uint16_t fg, uint16_t border, uint16_t bg) {
+    memset(bar, 0, sizeof(*bar));
+    ui_widget_init(&bar->base, x, y, w, h, progress_draw, bg);
+    bar->fg = fg;
+    bar->border = border;
+    bar->margin = border != bg ? 2 : 0;
+}
+
+void ui_progress_set_style(ui_progress_t *bar, int radius, int margin) {
+    ui_lock();
+    bar->radius = radius;
+    bar->margin = margin;
+    ui_invalidate(&bar->base);
+    ui_unlock();
+}
+
+void ui_progress_set_value(ui_progress_t *bar, int value) {
+    if (value < 0) value = 0;
+    if (value > 100) value = 100;
+    ui_lock();
+    if (bar->value != value) {
+        bar->value = value;
+        ui_invalidate(&bar->base);
+    }
+    ui_unlock();
+}
+
+void ui_progress_set_color(ui_progress_t *bar, uint16_t fg) {
+    ui_lock();
+    if (bar->fg != fg) {
+        bar->fg = fg;
+        ui_invalidate(&bar->base);
+    }
+    ui_unlock();
+}
+
+// ---------------- Gráfico ----------------
+
+static int graph_map_y(const ui_graph_t *g, int value) {
+    int bottom = g->base.y + g->base.h - 1;
+    if (value < g->min) value = g->min;
+    if (value > g->max) value = g->max;
+    return bottom - (value - g->min) * (g->base.h - 1) / (g->max - g->min);
+}
+
+static void graph_draw(ui_widget_t *w) {
+    ui_graph_t *g = (ui_graph_t *)w;
+    st7789_fill_rect_fb(w->x, w->y, w->w, w->h, w->bg);
+
+    if (g->grid_step > 0) {
+        for (int v = g->max - g->grid_step; v > g->min; v -= g->grid_step) {
+            int gy = graph_map_y(g, v);
+            st7789_draw_hline_fb(w->x, gy, w->w, g->grid);
+            if (g->axis_labels) {
+                char text[8];
+                snprintf(text, sizeof(text), "%d", v);
+                st7789_draw_text_font_fb(w->x + 2, gy - 8, text, &font_5x7, 1, g->grid, w->bg);
+            }
+        }
+    }
+    if (g->border != w->bg) {
+        st7789_draw_rect_fb(w->x, w->y, w->w, w->h, g->border);
+    }
+
+    int prev_x = 0, prev_y = 0;
+    for (int i = 0; i < g->capacity; i++) {
+        int value = g->samples[(g->head + i) % g->capacity];
+        int px = w->x + (g->capacity > 1 ? i * (w->w - 1) / (g->capacity - 1) : 0);
+        int py = graph_map_y(g, value);
+        if (i > 0) {
+            st7789_draw_line_fb(prev_x, prev_y, px, py, g->fg);
+        }
+        prev_x = px;
+        prev_y = py;
+    }
+}
+
+void ui_graph_init(ui_graph_t *graph, int x, int y, int w, int h, int capacity,
+                   int min, int max, uint16_t fg, uint16_t bg) {
+    memset(graph, 0, sizeof(*graph));
+    ui_widget_init(&graph->base, x, y, w, h, graph_draw, bg);
+    if (capacity < 1) capacity = 1;
+    if (capacity > UI_GRAPH_MAX_POINTS) capacity = UI_GRAPH_MAX_POINTS;
+    if (max <= min) max = min + 1;
+    graph->capacity = capacity;
+    graph->min = min;
+    graph->max = max;
+    graph->fg = fg;
+    graph->grid = bg;
+    graph->border = bg;
+    for (int i = 0; i < capacity; i++) {
+        graph->samples[i] = min;
+    }
+}
+
+void ui_graph_set_grid(ui_graph_t *graph, int step, uint16_t grid, uint16_t border, bool axis_labels) {
+    ui_lock();
+    graph->grid_step = step;
+    graph->grid = grid;
+    graph->border = border;
+    graph->axis_labels = axis_labels;
+    ui_invalidate(&graph->base);
+    ui_unlock();
+}
+
+// Substitui a amostra mais antiga pela nova (o gráfico rola para a esquerda)
+void ui_graph_push(ui_graph_t *graph, int value) {
+    ui_lock();
+    graph->samples[graph->head] = value;
+    graph->head = (graph->head + 1) % graph->capacity;
+    ui_invalidate(&graph->base);
+    ui_unlock();
+}
+
+void ui_graph_clear(ui_graph_t *graph, int value) {
+    ui_lock();
+    for (int i = 0; i < graph->capacity; i++) {
+        graph->samples[i] = value;
+    }
+    graph->head = 0;
+    ui_invalidate(&graph->base);
+    ui_unlock();
+}
+
+// ---------------- Lista ----------------
+
+int ui_list_visible_rows(const ui_list_t *list) {
+    int rows = list->base.h / list->row_h;
+    if (rows > UI_LIST_MAX_ROWS) rows = UI_LIST_MAX_ROWS;
+    return rows < 1 ? 1 : rows;
+}
+
+static void list_default_item(ui_list_t *list, int index, int x, int y, int w, int h, bool selected) {
+    const char *text = list->labels ? list->labels[index] : NULL;
+    if (!text) return;
+
+    int text_h = st7789_font_line_height(st7789_get_font(), 1);
+    st7789_set_text_clip(x, y, w, h);
+    st7789_draw_text_font_fb(x + 4, y + (h - text_h) / 2 + 1, text, st7789_get_font(), 1,
+                             selected ? list->sel_fg : list->fg,
+                             selected ? list->sel_bg : list->base.bg);
+    st7789_reset_text_clip();
+}
+
+// Trilho pontilhado com o cursor arredondado proporcional à posição
+static void list_draw_scrollbar(ui_list_t *list, int rows) {
+    ui_widget_t *w = &list->base;
+    int bar_x = w->x + w->w - UI_LIST_SCROLLBAR_W;
+    st7789_fill_rect_fb(bar_x, w->y, UI_LIST_SCROLLBAR_W, w->h, w->bg);
+    if (list->count <= rows) return;
+
+    for (int y = w->y; y < w->y + w->h; y += 5) {
+        st7789_draw_pixel_fb(bar_x + UI_LIST_SCROLLBAR_W / 2, y, ST7789_COLOR_GRAY);
+    }
+
+    int thumb_h = w->h * rows / list->count;
+    if (thumb_h < 6) thumb_h = 6;
+    int travel = w->h - thumb_h;
+    int thumb_y = w->y + travel * list->top / (list->count - rows);
+    st7789_fill_round_rect_fb(bar_x, thumb_y, UI_LIST_SCROLLBAR_W, thumb_h, 3, list->sel_bg);
+}
+
+static void list_draw(ui_widget_t *w) {
+    ui_list_t *list = (ui_list_t *)w;
+    int rows = ui_list_visible_rows(list);
+    int item_w = w->w - (list->scrollbar ? UI_LIST_SCROLLBAR_W : 0);
+    uint32_t dirty = w->partial ? list->dirty_rows : 0xFFFFFFFFu;
+
+    if (!w->partial) {
+        // Sobra abaixo da última linha inteira
+        int used = rows * list->row_h;
+        if (used < w->h) st7789_fill_rect_fb(w->x, w->y + used, item_w, w->h - used, w->bg);
+        if (list->scrollbar) list_draw_scrollbar(list, rows);
+    }
+
+    for (int row = 0; row < rows; row++) {
+        if (!(dirty & (1u << row))) continue;
+        int index = list->top + row;
+        int ry = w->y + row * list->row_h;
+        bool selected = index == list->selected;
+
+        st7789_fill_rect_fb(w->x, ry, item_w, list->row_h,
+                            selected && list->draw_item == list_default_item ? list->sel_bg : w->bg);
+        if (index < list->count) {
+            list->draw_item(list, index, w->x, ry, item_w, list->row_h, selected);
+        }
+    }
+
+    list->dirty_rows = 0;
+}
+
+void ui_list_init(ui_list_t *list, int x, int y, int w, int h, int row_h,
+                  uint16_t fg, uint16_t bg, uint16_t sel_fg, uint16_t sel_bg) {
+    memset(list, 0, sizeof(*list));
+    ui_widget_init(&list->base, x, y, w, h, list_draw, bg);
+    list->row_h = row_h > 0 ? row_h : 10;
+    list->fg = fg;
+    list->sel_fg = sel_fg;
+    list->sel_bg = sel_bg;
+    list->draw_item = list_default_item;
+}
+
+void ui_list_set_items(ui_list_t *list, const char *const *labels, int count) {
+    ui_lock();
+    list->labels = labels;
+    list->count = count < 0 ? 0 : count;
+    list->top = 0;
+    list->selected = 0;
+    list->dirty_rows = 0;
+    ui_invalidate(&list->base);
+    ui_unlock();
+}
+
+// Com um desenhador próprio o fundo da linha é sempre bg; o item selecionado
+// fica a cargo do desenhador.
+void ui_list_set_drawer(ui_list_t *list, ui_list_draw_item_fn_t draw_item, void *user) {
+    ui_lock();
+    list->draw_item = draw_item ? draw_item : list_default_item;
+    list->user = user;
+    ui_invalidate(&list->base);
+    ui_unlock();
+}
+
+void ui_list_set_scrollbar(ui_list_t *list, bool enabled) {
+    ui_lock();
+    list->scrollbar = enabled;
+    ui_invalidate(&list->base);
+    ui_unlock();
+}
+
+void ui_list_set_selected(ui_list_t *list, int index) {
+    ui_lock();
+    if (list->count == 0 || index < 0 || index >= list->count || index == list->selected) {
+        ui_unlock();
+        return;
+    }
+
+    int rows = ui_list_visible_rows(list);
+    int old_row = list->selected - list->top;
+    list->selected = index;
+
+    int top = list->top;
+    if (index < top) top = index;
+    else if (index >= top + rows) top = index - rows + 1;
+
+    if (top != list->top) {
+        list->top = top;
+        ui_invalidate(&list->base);
+    } else {
+        // Só as duas linhas afetadas
+        if (old_row >= 0 && old_row < rows) list->dirty_rows |= 1u << old_row;
+        list->dirty_rows |= 1u << (index - top);
+        ui_invalidate_partial(&list->base);
+    }
+    ui_unlock();
+}
+
+void ui_list_move(ui_list_t *list, int delta) {
+    if (list->count == 0) return;
+    ui_lock();
+    int index = ((list->selected + delta) % list->count + list->count) % list->count;
+    ui_list_set_selected(list, index);
+    ui_unlock();
+}
+
+// ---------------- Grade de ícones ----------------
+
+static void icon_grid_cell_rect(const ui_icon_grid_t *grid, int index, int *cx, int *cy) {
+    *cx = grid->base.x + (index % grid->cols) * grid->cell_w;
+    *cy = grid->base.y + (index / grid->cols) * grid->cell_h;
+}
+
+static void icon_grid_draw_cell(ui_icon_grid_t *grid, int index) {
+    int cx, cy;
+    icon_grid_cell_rect(grid, index, &cx, &cy);
+    st7789_fill_rect_fb(cx, cy, grid->cell_w, grid->cell_h, grid->base.bg);
+    if (index >= grid->count) return;
+
+    const ui_icon_item_t *item = &grid->items[index];
+    int ix = cx + (grid->cell_w - grid->icon_size) / 2;
+    int iy = cy + 4;
+    if (item->icon) {
+        st7789_draw_asset_fb(ix, iy, item->icon);
+    }
+    if (index == grid->selected) {
+        st7789_draw_round_rect_fb(cx + 1, cy + 1, grid->cell_w - 2, grid->cell_h - 2, 6, grid->sel);
+    }
+    if (item->label) {
+        int text_w;
+        st7789_measure_text(&font_5x7, 1, item->label, &text_w, NULL);
+        st7789_set_text_clip(cx + 2, cy, grid->cell_w - 4, grid->cell_h);
+        st7789_draw_text_font_fb(cx + (grid->cell_w - text_w) / 2, iy + grid->icon_size + 4,
+                                 item->label, &font_5x7, 1, grid->fg, grid->base.bg);
+        st7789_reset_text_clip();
+    }
+}
+
+static void icon_grid_draw(ui_widget_t *w) {
+    ui_icon_grid_t *grid = (ui_icon_grid_t *)w;
+    int rows = w->h / grid->cell_h;
+    int cells = rows * grid->cols;
+
+    for (int i = 0; i < cells; i++) {
+        if (!w->partial || (i < 32 && (grid->dirty_cells & (1u << i)))) {
+            icon_grid_draw_cell(grid, i);
+        }
+    }
+    grid->dirty_cells = 0;
+}
+
+void ui_icon_grid_init(ui_icon_grid_t *grid, int x, int y, int cols, int cell_w, int cell_h,
+                       int icon_size, const ui_icon_item_t *items, int count,
+                       uint16_t fg, uint16_t sel, uint16_t bg) {
+    memset(grid, 0, sizeof(*grid));
+    if (cols < 1) cols = 1;
+    int rows = (count + cols - 1) / cols;
+    ui_widget_init(&grid->base, x, y, cols * cell_w, (rows ? rows : 1) * cell_h, icon_grid_draw, bg);
+    grid->items = items;
+    grid->count = count;
+    grid->cols = cols;
+    grid->cell_w = cell_w;
+    grid->cell_h = cell_h;
+    grid->icon_size = icon_size;
+    grid->fg = fg;
+    grid->sel = sel;
+}
+
+void ui_icon_grid_set_selected(ui_icon_grid_t *grid, int index) {
+    ui_lock();
+    if (index >= 0 && index < grid->count && index != grid->selected) {
+        int old = grid->selected;
+        grid->selected = index;
+        if (old < 32 && index < 32) {
+            grid->dirty_cells |= (1u << old) | (1u << index);
+            ui_invalidate_partial(&grid->base);
+        } else {
+            ui_invalidate(&grid->base);
+        }
+    }
+    ui_unlock();
+}
+
+void ui_icon_grid_move(ui_icon_grid_t *grid, int dx, int dy) {
+    if (grid->count == 0) return;
+    ui_lock();
+    int index = grid->selected + dx + dy * grid->cols;
+    index = (index % grid->count + grid->count) % grid->count;
+    ui_icon_grid_set_selected(grid, index);
+    ui_unlock();
+}
@@ -1,12 +1,23 @@
 #ifndef USB_STREAM_H
 #define USB_STREAM_H
 
+#include "esp_err.h"
+
+#define USB_STREAM_MAX_FPS 15   // Limite de frames por segundo enviados
+
 /**
- * @brief Envia o conteúdo completo do framebuffer do ST7789 pela porta USB CDC.
- * * Esta função obtém o ponteiro para o framebuffer, escreve seus bytes brutos
- * para a saída padrão (stdout), que deve ser configurada para USB CDC no menuconfig,
- * e força o envio dos dados.
+ * @brief Envia o framebuffer do ST7789 pela porta USB CDC.
+ * * Os frames vão no formato de frame_codec.h: só os tiles alterados desde o
+ * último envio, comprimidos, escritos na saída padrão (stdout), que deve ser
+ * configurada para USB CDC no menuconfig. Chamadas acima de USB_STREAM_MAX_FPS
+ * são descartadas.
  */
 void send_framebuffer_over_usb(void);
 
-#endif // USB_STREAM_H
\ No newline at end of file
+/**
+ * @brief Envia automaticamente a cada flush do display, por uma task própria,
+ * em vez de depender de chamadas a send_framebuffer_over_usb().
+ */
+esp_err_t usb_stream_start(void);
+
+#endif // USB_STREAM_H
@@ -2,21 +2,43 @@
 #include "freertos/FreeRTOS.h"
 #include <stdio.h>
 #include "st7789.h"
+#include "frame_stream.h"
+#include "usb_stream.h"
 
 static const char *TAG = "USB_STREAM";
 
-// Esta é a nossa nova função de envio
+static frame_stream_t s_stream;
+
+// Escreve direto na saída padrão (stdout), que deve ser a porta USB CDC.
+// Os logs dividem a mesma saída; o decodificador se ressincroniza pelo
+// magic e pelo CRC de cada pacote.
+static bool stdout_write(void *ctx, const void *data, size_t len) {
+    bool ok = fwrite(data, 1, len, stdout) == len;
+    fflush(stdout); // Garante que os dados sejam enviados imediatamente
+    return ok;
+}
+
+static esp_err_t usb_stream_init(void) {
+    esp_err_t err = frame_stream_init(&s_stream, TAG, stdout_write, NULL, USB_STREAM_MAX_FPS);
+    if (err == ESP_OK && !s_stream.enabled) {
+        frame_stream_set_enabled(&s_stream, true);
+    }
+    return err;
+}
+
+esp_err_t usb_stream_start(void) {
+    esp_err_t err = usb_stream_init();
+    if (err != ESP_OK) return err;
+    return frame_stream_start(&s_stream, 4096, 3);
+}
+
 void send_framebuffer_over_usb() {
-    uint16_t* fb = st7789_get_framebuffer();
-    if (fb == NULL) {
+    if (st7789_get_framebuffer() == NULL) {
         // Não faz nada se o framebuffer não estiver pronto
         return;
     }
+    if (usb_stream_init() != ESP_OK) return;
 
-    size_t framebuffer_size = ST7789_WIDTH * ST7789_HEIGHT * sizeof(uint16_t);
-    
-    // Escreve os bytes brutos do framebuffer diretamente para a saída padrão (stdout),
-    // que agora é a nossa porta USB CDC.
-    fwrite(fb, 1, framebuffer_size, stdout);
-    fflush(stdout); // Garante que os dados sejam enviados imediatamente
-}
\ No newline at end of file
+    // Chamadas acima do limite de FPS são descartadas: a próxima leva o frame mais recente
+    frame_stream_send(&s_stream);
+}
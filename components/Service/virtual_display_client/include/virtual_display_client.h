@@ -11,6 +11,7 @@
 #define WIFI_PASS_VIRTUAL_DISPLAY      "2008bitc"  // Senha para o cliente conectar
 #define SERVER_IP_ADDR_VIRTUAL_DISPLAY "192.168.0.13" // Endereço IP do servidor do display virtual
 #define SERVER_PORT_VIRTUAL_DISPLAY    1337      // Porta do servidor do display virtual
+#define VIRTUAL_DISPLAY_MAX_FPS        20        // Limite de frames por segundo enviados
 // =========================================================================
 
 #ifdef __cplusplus
@@ -25,7 +26,8 @@ void virtual_display_start_frame_sending(void);
 
 /**
  * @brief Notifica que um novo frame está pronto para ser enviado.
- * Deve ser chamada sempre que o framebuffer for atualizado.
+ * Deve ser chamada sempre que o framebuffer for atualizado. Os frames vão
+ * no formato de frame_codec.h (só os tiles alterados, comprimidos).
  */
 void virtual_display_notify_frame_ready(void);
 
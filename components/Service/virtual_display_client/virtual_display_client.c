@@ -10,6 +10,7 @@
 #include "lwip/sockets.h"
 #include "lwip/sys.h" // Para timeouts
 #include "st7789.h"
+#include "frame_stream.h"
 #include "virtual_display_client.h" // Incluir o próprio cabeçalho
 
 static const char *TAG = "VIRTUAL_DISPLAY";
@@ -19,12 +20,17 @@ static int sock = -1; // Socket global
 void connect_to_server_task(void *pvParameters);
 static TaskHandle_t reconnect_task_handle = NULL;
 
-// Semáforo para sinalizar que um novo frame está pronto
-static xSemaphoreHandle s_frame_ready_semaphore = NULL; 
-static TaskHandle_t s_frame_sender_task_handle = NULL; // Handle para a tarefa de envio de frames
+// Frames codificados por delta (frame_codec.h). A task do stream junta os
+// avisos de frame pronto e limita o envio a VIRTUAL_DISPLAY_MAX_FPS.
+static frame_stream_t s_stream;
 
-// Protótipo da tarefa de envio de frames
-static void frame_sender_task(void *pvParameters);
+static void close_socket(void) {
+    frame_stream_set_enabled(&s_stream, false);
+    if (sock >= 0) {
+        close(sock);
+        sock = -1;
+    }
+}
 
 // Função que lida com os eventos do Wi-Fi (agora pública e renomeada)
 void virtual_display_wifi_event_handler(void* arg, esp_event_base_t event_base,
@@ -33,10 +39,7 @@ void virtual_display_wifi_event_handler(void* arg, esp_event_base_t event_base,
         esp_wifi_connect();
     } else if (event_base == WIFI_EVENT && event_id == WIFI_EVENT_STA_DISCONNECTED) {
         ESP_LOGI(TAG, "Reconectando ao Wi-Fi...");
-        if (sock >= 0) {
-            close(sock);
-            sock = -1;
-        }
+        close_socket();
         // Se a tarefa de reconexão estiver ativa, pare-a antes de tentar conectar novamente.
         if (reconnect_task_handle != NULL) {
             vTaskDelete(reconnect_task_handle);
@@ -91,10 +94,11 @@ ESP_LOGI(TAG, "Socket criado, conectando a %s:%d", SERVER_IP_ADDR_VIRTUAL_DISPLA
             vTaskDelay(pdMS_TO_TICKS(5000)); // Espera 5s antes de tentar de novo
         } else {
             ESP_LOGI(TAG, "Conectado com sucesso ao servidor!");
-            // Inicia a tarefa de envio de frames APENAS UMA VEZ após a conexão bem-sucedida
-            if (s_frame_sender_task_handle == NULL) { 
-                xTaskCreate(frame_sender_task, "frame_sender", 4096, NULL, 4, &s_frame_sender_task_handle);
-            }
+            // A task de envio é criada uma única vez; a cada conexão o stream
+            // recomeça por um frame completo.
+            virtual_display_start_frame_sending();
+            frame_stream_start(&s_stream, 4096, 4);
+            frame_stream_set_enabled(&s_stream, true);
             break; // Sai do loop de tentativas de conexão
         }
     }
@@ -103,73 +107,50 @@ ESP_LOGI(TAG, "Socket criado, conectando a %s:%d", SERVER_IP_ADDR_VIRTUAL_DISPLA
 }
 
 
-// Função para enviar o framebuffer via socket (AGORA CHAMADA PELA TAREFA DEDICADA)
-void send_framebuffer_to_server() {
-    if (sock < 0) {
-        // Se não estiver conectado e não houver uma tarefa de reconexão rodando, cria uma.
-        if (reconnect_task_handle == NULL) {
-             xTaskCreate(connect_to_server_task, "reconnect_task", 4096, NULL, 5, &reconnect_task_handle);
-        }
-        return; // Não envia se não houver socket
-    }
+// Escrita do stream no socket. Uma falha fecha a conexão: o frame em curso
+// fica pela metade no servidor, então a retomada é por um frame completo na
+// próxima conexão.
+static bool socket_write(void *ctx, const void *data, size_t len) {
+    const uint8_t *ptr = data;
 
-    uint16_t* fb = st7789_get_framebuffer();
-    if (fb == NULL) {
-        ESP_LOGE(TAG, "Framebuffer é nulo, não é possível enviar.");
-        return;
-    }
-
-    int bytes_a_enviar = ST7789_WIDTH * ST7789_HEIGHT * 2;
-    int bytes_enviados_total = 0;
-
-    // Loop para garantir que todos os bytes sejam enviados
-    while (bytes_enviados_total < bytes_a_enviar) {
-        int bytes_enviados = send(sock, (uint8_t*)fb + bytes_enviados_total, bytes_a_enviar - bytes_enviados_total, 0);
+    while (len > 0) {
+        int s = sock;
+        if (s < 0) return false;
 
+        int bytes_enviados = send(s, ptr, len, 0);
         if (bytes_enviados < 0) {
-            // Um erro ocorreu. Verificamos se é um erro de "tente novamente" ou um erro real.
-            if (errno == EAGAIN || errno == EWOULDBLOCK) {
-                ESP_LOGW(TAG, "Socket buffer cheio. Tentando novamente em breve.");
-                vTaskDelay(pdMS_TO_TICKS(50)); // Pequena pausa para o buffer de rede esvaziar
-                continue; // Tenta enviar o mesmo pedaço novamente
-            }
-            
+            // Com SO_SNDTIMEO, EAGAIN significa 5 s sem o servidor consumir nada
             ESP_LOGE(TAG, "Erro ao enviar dados: errno %d. Fechando socket.", errno);
-            close(sock);
-            sock = -1; // Sinaliza que a conexão foi perdida
-            // Tenta reconectar em uma nova tarefa para não bloquear a frame_sender_task.
+            close_socket();
             if (reconnect_task_handle == NULL) {
                 xTaskCreate(connect_to_server_task, "reconnect_task", 4096, NULL, 5, &reconnect_task_handle);
             }
-            return; // Sai da função de envio
+            return false;
         }
-        
-        bytes_enviados_total += bytes_enviados;
+        ptr += bytes_enviados;
+        len -= bytes_enviados;
     }
+    return true;
 }
 
-// NOVA TAREFA DEDICADA PARA ENVIAR FRAMES
-static void frame_sender_task(void *pvParameters) {
-    while (1) {
-        // Espera indefinidamente por um sinal de que um novo frame está pronto
-        if (xSemaphoreTake(s_frame_ready_semaphore, portMAX_DELAY) == pdTRUE) {
-            send_framebuffer_to_server(); // Chama a função de envio, que pode bloquear esta tarefa, mas não a principal
-            
-            // Opcional: Adicione um pequeno atraso aqui para controlar o FPS de envio
-            // Por exemplo, para enviar no máximo 30 frames por segundo (aprox. 33ms por frame)
-            // vTaskDelay(pdMS_TO_TICKS(33)); 
+// Envia o frame atual na task chamadora (fora da task do stream)
+void send_framebuffer_to_server() {
+    if (sock < 0) {
+        // Se não estiver conectado e não houver uma tarefa de reconexão rodando, cria uma.
+        if (reconnect_task_handle == NULL) {
+             xTaskCreate(connect_to_server_task, "reconnect_task", 4096, NULL, 5, &reconnect_task_handle);
         }
+        return; // Não envia se não houver socket
     }
+    frame_stream_send(&s_stream);
 }
 
-// Inicializa o semáforo (chamar uma vez na inicialização do Wi-Fi)
+// Prepara o stream (chamar uma vez na inicialização do Wi-Fi)
 void virtual_display_start_frame_sending(void) {
-    if (s_frame_ready_semaphore == NULL) {
-        s_frame_ready_semaphore = xSemaphoreCreateBinary();
-        if (s_frame_ready_semaphore == NULL) {
-            ESP_LOGE(TAG, "Falha ao criar o semáforo de frame pronto.");
-            return;
-        }
+    if (frame_stream_init(&s_stream, "frame_sender", socket_write, NULL,
+                          VIRTUAL_DISPLAY_MAX_FPS) != ESP_OK) {
+        ESP_LOGE(TAG, "Falha ao preparar o stream de frames.");
+        return;
     }
     // A tarefa de envio de frames será criada em connect_to_server_task quando a conexão for estabelecida.
     // Isso garante que a tarefa só inicie após termos um IP.
@@ -177,10 +158,6 @@ void virtual_display_start_frame_sending(void) {
 
 // Notifica a tarefa de envio de frames que um novo frame está pronto
 void virtual_display_notify_frame_ready(void) {
-    if (s_frame_ready_semaphore != NULL) {
-        // Libera o semáforo para a tarefa de envio de frames
-        // xSemaphoreGiveFromISR pode ser usado se for chamado de uma ISR (interrupção)
-        // Mas para chamadas de tarefas normais, xSemaphoreGive é suficiente
-        xSemaphoreGive(s_frame_ready_semaphore);
-    }
+    // Sem conexão o aviso é ignorado; avisos seguidos viram um só envio
+    frame_stream_notify(&s_stream);
 }
\ No newline at end of file
@@ -0,0 +1,318 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Stream de frames com o app desenhando enquanto a task do stream codifica.
+// Um receptor decodifica os pacotes; cada imagem resultante tem que ser um
+// frame que de fato foi ao painel (nada de tiles de um frame pela metade), e
+// no fim o receptor tem que mostrar o último frame.
+
+#include <pthread.h>
+#include <string.h>
+#include <stdlib.h>
+#include "st7789.h"
+#include "spi.h"
+#include "backlight.h"
+#include "frame_stream.h"
+#include "frame_codec.h"
+#include "fake_spi.h"
+#include "host_test.h"
+
+#define W               ST7789_WIDTH
+#define H               ST7789_HEIGHT
+#define MAX_FRAMES      1024
+
+void backlight_init(void) {
+}
+
+static int64_t now_us(void) {
+    return host_test_now_us();
+}
+
+static void sleep_us(int64_t us) {
+    struct timespec ts = { .tv_sec = us / 1000000, .tv_nsec = (us % 1000000) * 1000 };
+    nanosleep(&ts, NULL);
+}
+
+// ========== FRAMES APRESENTADOS ==========
+
+static pthread_mutex_t frames_lock = PTHREAD_MUTEX_INITIALIZER;
+static uint32_t frames[MAX_FRAMES];
+static int frame_count;
+
+static uint32_t image_crc(const uint16_t *img) {
+    return frame_codec_crc32(0, img, W * H * sizeof(uint16_t));
+}
+
+// Chamado antes do flush: o conteúdo do back buffer é o frame que vai ao painel
+static void present(void) {
+    uint32_t crc = image_crc(st7789_get_framebuffer());
+    pthread_mutex_lock(&frames_lock);
+    if (frame_count < MAX_FRAMES) frames[frame_count++] = crc;
+    pthread_mutex_unlock(&frames_lock);
+    st7789_flush();
+}
+
+static bool was_presented(uint32_t crc) {
+    pthread_mutex_lock(&frames_lock);
+    bool found = false;
+    for (int i = frame_count - 1; i >= 0 && !found; i--) {
+        found = frames[i] == crc;
+    }
+    pthread_mutex_unlock(&frames_lock);
+    return found;
+}
+
+// ========== RECEPTOR ==========
+
+static struct {
+    pthread_mutex_t lock;
+    uint8_t *buf;
+    size_t len, cap;
+    uint16_t img[W * H];
+    int packets;
+    int keyframes;
+    int bad;                    // Pacotes malformados ou com CRC errado
+    int torn;                   // Imagens que não são nenhum frame apresentado
+    bool check;                 // Confere cada imagem com os frames apresentados
+    int64_t delay_us;           // Latência de cada escrita do transporte
+    volatile int64_t stall_us;  // Trava a próxima escrita (uma vez)
+} rx = { .lock = PTHREAD_MUTEX_INITIALIZER };
+
+static uint16_t rd16(const uint8_t *p) {
+    return p[0] | (p[1] << 8);
+}
+
+static uint32_t rd32(const uint8_t *p) {
+    return rd16(p) | ((uint32_t)rd16(p + 2) << 16);
+}
+
+static bool apply_tile(const uint8_t *rec) {
+    int tx = rec[0], ty = rec[1], enc = rec[2], len = rd16(&rec[3]);
+    const uint8_t *data = rec + FRAME_CODEC_TILE_HDR_SIZE;
+    uint16_t px[FRAME_CODEC_TILE * FRAME_CODEC_TILE];
+    int n = FRAME_CODEC_TILE * FRAME_CODEC_TILE;
+
+    if (tx >= W / FRAME_CODEC_TILE || ty >= H / FRAME_CODEC_TILE) return false;
+    if (enc == FRAME_TILE_FILL) {
+        uint16_t v;
+        memcpy(&v, data, 2);
+        for (int i = 0; i < n; i++) px[i] = v;
+    } else if (enc == FRAME_TILE_RAW) {
+        if (len != n * 2) return false;
+        memcpy(px, data, len);
+    } else if (enc == FRAME_TILE_RLE) {
+        int i = 0, at = 0;
+        while (at < len && i < n) {
+            uint8_t c = data[at++];
+            int count = (c & 0x7F) + 1;
+            if (i + count > n) return false;
+            if (c & 0x80) {
+                uint16_t v;
+                memcpy(&v, &data[at], 2);
+                at += 2;
+                while (count--) px[i++] = v;
+            } else {
+                memcpy(&px[i], &data[at], count * 2);
+                at += count * 2;
+                i += count;
+            }
+        }
+        if (i != n) return false;
+    } else {
+        return false;
+    }
+
+    for (int row = 0; row < FRAME_CODEC_TILE; row++) {
+        memcpy(&rx.img[(ty * FRAME_CODEC_TILE + row) * W + tx * FRAME_CODEC_TILE],
+               &px[row * FRAME_CODEC_TILE], FRAME_CODEC_TILE * 2);
+    }
+    return true;
+}
+
+// Consome os pacotes completos do buffer
+static void parse_packets(void) {
+    while (rx.len >= FRAME_CODEC_HEADER_SIZE) {
+        if (rd32(rx.buf) != FRAME_CODEC_MAGIC) {
+            rx.bad++;
+            rx.len = 0;
+            return;
+        }
+        int count = rd16(&rx.buf[16]);
+        size_t off = FRAME_CODEC_HEADER_SIZE;
+        for (int i = 0; i < count; i++) {
+            if (off + FRAME_CODEC_TILE_HDR_SIZE > rx.len) return;
+            off += FRAME_CODEC_TILE_HDR_SIZE + rd16(&rx.buf[off + 3]);
+        }
+        if (off + 4 > rx.len) return;
+
+        if (frame_codec_crc32(0, rx.buf, off) != rd32(&rx.buf[off])) {
+            rx.bad++;
+        } else {
+            size_t at = FRAME_CODEC_HEADER_SIZE;
+            for (int i = 0; i < count; i++) {
+                if (!apply_tile(&rx.buf[at])) rx.bad++;
+                at += FRAME_CODEC_TILE_HDR_SIZE + rd16(&rx.buf[at + 3]);
+            }
+            rx.packets++;
+            rx.keyframes += (rx.buf[5] & FRAME_CODEC_FLAG_KEYFRAME) != 0;
+            if (rx.check && !was_presented(image_crc(rx.img))) rx.torn++;
+        }
+        off += 4;
+        memmove(rx.buf, rx.buf + off, rx.len - off);
+        rx.len -= off;
+    }
+}
+
+static bool rx_write(void *ctx, const void *data, size_t len) {
+    (void)ctx;
+    int64_t stall = rx.stall_us;
+    if (stall) {
+        rx.stall_us = 0;
+        sleep_us(stall);
+    }
+    if (rx.delay_us) sleep_us(rx.delay_us);
+
+    pthread_mutex_lock(&rx.lock);
+    if (rx.len + len > rx.cap) {
+        rx.cap = (rx.len + len) * 2;
+        rx.buf = realloc(rx.buf, rx.cap);
+    }
+    memcpy(rx.buf + rx.len, data, len);
+    rx.len += len;
+    parse_packets();
+    pthread_mutex_unlock(&rx.lock);
+    return true;
+}
+
+static uint32_t rx_crc(void) {
+    pthread_mutex_lock(&rx.lock);
+    uint32_t crc = image_crc(rx.img);
+    pthread_mutex_unlock(&rx.lock);
+    return crc;
+}
+
+// Espera o receptor chegar ao último frame apresentado
+static bool rx_settle(int timeout_ms) {
+    uint32_t want = frames[frame_count - 1];
+    int64_t limit = now_us() + timeout_ms * 1000LL;
+    while (now_us() < limit) {
+        if (rx_crc() == want) return true;
+        sleep_us(1000);
+    }
+    return false;
+}
+
+// ========== APP ==========
+
+// Frame `k`: os mesmos tiles são apagados e redesenhados a cada frame, e o
+// conteúdo final se repete a cada 3 frames. Um leitor que pegasse o estado
+// intermediário (tile apagado) guardaria o hash do conteúdo final e nunca
+// mais reenviaria o tile.
+static void draw_frame(int k) {
+    static const char *labels[] = { "Sub-GHz", "Infrared", "Bad USB" };
+    for (int row = 0; row < 6; row++) {
+        int y = 16 + row * 32;
+        st7789_fill_rect_fb(0, y, W, 32, ST7789_COLOR_BLACK);
+        st7789_draw_text_fb(8, y + 8, labels[(k + row) % 3], ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
+    }
+    st7789_fill_rect_fb((k * 7) % (W - 16), 216, 16, 16, ST7789_COLOR565(k * 13, 200, 90));
+}
+
+static frame_stream_t stream;
+
+static void test_no_torn_frames(void) {
+    host_test_section("sem frames misturados");
+    rx.check = true;
+    rx.delay_us = 50;
+    frame_stream_set_enabled(&stream, true);
+
+    for (int k = 0; k < 150; k++) {
+        draw_frame(k);
+        present();
+        if (k % 10 == 0) sleep_us(2000);
+    }
+    st7789_flush_wait();
+
+    CHECK(rx_settle(5000));
+    frame_stream_stats_t st;
+    frame_stream_get_stats(&stream, &st);
+    pthread_mutex_lock(&rx.lock);
+    CHECK(rx.packets > 10);
+    CHECK_EQ(rx.bad, 0);
+    // Só um frame tomado de volta pelo flush (máquina sobrecarregada) pode
+    // chegar misturado, e o keyframe seguinte o corrige
+    CHECK(rx.torn <= (int)st.revoked);
+    pthread_mutex_unlock(&rx.lock);
+    CHECK(st.sent > 10);
+}
+
+// Sem frame apresentado (antes do primeiro flush não há o que enviar)
+static void test_send_before_flush(void) {
+    host_test_section("envio antes do primeiro flush");
+    static frame_stream_t early;
+    CHECK_OK(frame_stream_init(&early, "early", rx_write, NULL, 1000));
+    frame_stream_set_enabled(&early, true);
+    CHECK_EQ(frame_stream_send(&early), ESP_ERR_INVALID_STATE);
+    frame_stream_set_enabled(&early, false);
+}
+
+// Transporte travado no meio de um frame: o flush não espera mais que o
+// limite, e o stream se recupera com um keyframe
+static void test_stalled_transport(void) {
+    host_test_section("transporte travado");
+    rx.check = false;
+    rx.delay_us = 0;
+    int keyframes = rx.keyframes;
+    frame_stream_stats_t st;
+    frame_stream_get_stats(&stream, &st);
+    uint32_t revoked = st.revoked;
+
+    draw_frame(1000);
+    rx.stall_us = 1000000;
+    present();
+    sleep_us(20000);             // O stream pega o frame e trava na primeira escrita
+
+    int64_t worst = 0;
+    for (int k = 1001; k < 1010; k++) {
+        draw_frame(k);
+        int64_t t0 = now_us();
+        present();
+        int64_t dt = now_us() - t0;
+        if (dt > worst) worst = dt;
+    }
+    st7789_flush_wait();
+    CHECK(worst < 700000);
+
+    CHECK(rx_settle(5000));
+    frame_stream_get_stats(&stream, &st);
+    CHECK(st.revoked > revoked);
+    CHECK(rx.keyframes > keyframes);
+    CHECK_EQ(rx.bad, 0);
+}
+
+int main(void) {
+    CHECK_OK(spi_init());
+    test_send_before_flush();
+    st7789_init();
+    st7789_set_flush_mode(ST7789_FLUSH_DAMAGE);
+    CHECK(st7789_get_framebuffer() != NULL);
+    frames[frame_count++] = image_crc(st7789_get_framebuffer());   // Flush do init
+
+    CHECK_OK(frame_stream_init(&stream, "test", rx_write, NULL, 1000));
+    CHECK_OK(frame_stream_start(&stream, 4096, 3));
+    test_no_torn_frames();
+    test_stalled_transport();
+    return host_test_finish("test_frame_stream");
+}
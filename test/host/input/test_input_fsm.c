@@ -0,0 +1,312 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Máquina de estados dos botões (input_fsm) com relógio falso: trepidação,
+// toque curto, pressão longa, ritmo da repetição e estouro do contador de
+// milissegundos de 32 bits. Cada cenário roda duas vezes, uma com o relógio
+// longe do estouro e outra começando pouco antes dele, e os instantes são
+// conferidos relativos ao início.
+
+#include <stdint.h>
+#include "input_fsm.h"
+#include "host_test.h"
+
+#define MAX_EVENTS  64
+#define WRAP_BASE   (UINT32_MAX - 100)      // Estoura no meio de cada cenário
+
+// Os tempos de input.c
+static const input_timing_t nav = {
+    .debounce_ms = 30,
+    .long_press_ms = 0,
+    .repeat_delay_ms = 400,
+    .repeat_interval_ms = 120,
+};
+
+static const input_timing_t action = {
+    .debounce_ms = 30,
+    .long_press_ms = 800,
+    .repeat_delay_ms = 0,
+    .repeat_interval_ms = 0,
+};
+
+// Botão simulado: nível do pino, relógio e eventos coletados
+typedef struct {
+    input_fsm_t fsm;
+    uint32_t base;
+    uint32_t now;
+    bool level;                     // true = pressionado
+    input_fsm_event_t events[MAX_EVENTS];
+    int count;
+} sim_t;
+
+static void sim_init(sim_t *s, const input_timing_t *timing, uint32_t base) {
+    memset(s, 0, sizeof(*s));
+    s->base = base;
+    s->now = base;
+    input_fsm_init(&s->fsm, timing, false);
+}
+
+static void sim_poll(sim_t *s) {
+    input_fsm_event_t e;
+    int burst = 0;
+    while (input_fsm_poll(&s->fsm, s->now, s->level, &e)) {
+        if (s->count < MAX_EVENTS) s->events[s->count++] = e;
+        if (++burst == 8) {
+            // Com um relógio parado a máquina tem que se esgotar
+            host_check_failed(__FILE__, __LINE__, "poll em laço", "8 eventos no mesmo instante");
+            break;
+        }
+    }
+}
+
+// Avança o relógio até base + t, chamando poll a cada milissegundo
+static void sim_run(sim_t *s, uint32_t t) {
+    uint32_t to = s->base + t;
+    while (s->now != to) {
+        s->now++;
+        sim_poll(s);
+    }
+}
+
+// Como a task: dorme até o prazo que a máquina pede (ou até base + t)
+static int sim_run_deadlines(sim_t *s, uint32_t t) {
+    uint32_t to = s->base + t;
+    int wakeups = 0;
+    while (s->now != to) {
+        uint32_t wait = input_fsm_next_deadline(&s->fsm, s->now);
+        uint32_t left = to - s->now;
+        s->now += wait < left ? (wait ? wait : 1) : left;
+        sim_poll(s);
+        wakeups++;
+    }
+    return wakeups;
+}
+
+// Borda vista pela ISR em base + t, com o pino indo para `level`
+static void sim_edge(sim_t *s, uint32_t t, bool level) {
+    sim_run(s, t);
+    s->level = level;
+    input_fsm_edge(&s->fsm, s->now);
+}
+
+// Trepidação: a borda e as repiques seguintes, alternando o nível, até
+// terminar estável em `level`
+static void sim_bounce(sim_t *s, uint32_t t, bool level, const uint32_t *offsets, int n) {
+    sim_edge(s, t, level);
+    for (int i = 0; i < n; i++) {
+        sim_edge(s, t + offsets[i], (i % 2) ? level : !level);
+    }
+    s->level = level;
+}
+
+static void check_event(const sim_t *s, int i, input_event_type_t type, uint32_t t, uint16_t repeat) {
+    CHECK(i < s->count);
+    if (i >= s->count) return;
+    CHECK_EQ(s->events[i].type, type);
+    CHECK_EQ((uint32_t)(s->events[i].time_ms - s->base), t);
+    CHECK_EQ(s->events[i].repeat, repeat);
+}
+
+// ========== CENÁRIOS ==========
+
+// Contato que trepida 5 ms na descida e na subida: um PRESS e um RELEASE
+static void bounce(uint32_t base) {
+    static const uint32_t press_bounce[] = { 1, 2, 4, 5, 9, 12 };
+    static const uint32_t release_bounce[] = { 2, 3, 7, 11 };
+    sim_t s;
+    sim_init(&s, &action, base);
+
+    sim_bounce(&s, 100, true, press_bounce, 6);
+    sim_run(&s, 300);
+    CHECK(s.fsm.pressed);
+    sim_bounce(&s, 300, false, release_bounce, 4);
+    sim_run(&s, 500);
+
+    CHECK_EQ(s.count, 2);
+    check_event(&s, 0, INPUT_EVENT_PRESS, 100, 0);      // Sem latência de debounce
+    check_event(&s, 1, INPUT_EVENT_RELEASE, 300, 0);
+    CHECK(!s.fsm.pressed);
+}
+
+// Trepidação que termina no nível oposto ao da primeira borda: o estado
+// real é confirmado no fim da janela
+static void bounce_settles_back(uint32_t base) {
+    static const uint32_t offsets[] = { 3, 6 };
+    sim_t s;
+    sim_init(&s, &action, base);
+
+    sim_bounce(&s, 50, true, offsets, 2);
+    s.level = false;                    // Ruído: o botão nem chegou a ser apertado
+    sim_run(&s, 200);
+
+    CHECK_EQ(s.count, 2);
+    check_event(&s, 0, INPUT_EVENT_PRESS, 50, 0);
+    check_event(&s, 1, INPUT_EVENT_RELEASE, 80, 0);    // Fim da janela de 30 ms
+    CHECK(!s.fsm.pressed);
+}
+
+// Toque mais curto que a janela de debounce não se perde
+static void tap_shorter_than_debounce(uint32_t base) {
+    sim_t s;
+    sim_init(&s, &nav, base);
+
+    sim_edge(&s, 10, true);
+    sim_edge(&s, 18, false);            // Dentro da janela: ignorada como trepidação
+    sim_run(&s, 100);
+
+    CHECK_EQ(s.count, 2);
+    check_event(&s, 0, INPUT_EVENT_PRESS, 10, 0);
+    check_event(&s, 1, INPUT_EVENT_RELEASE, 40, 0);
+}
+
+// Pressão curta em OK: PRESS e RELEASE, sem LONG_PRESS
+static void short_press(uint32_t base) {
+    sim_t s;
+    sim_init(&s, &action, base);
+
+    sim_edge(&s, 20, true);
+    sim_edge(&s, 20 + 799, false);      // 1 ms antes da pressão longa
+    sim_run(&s, 2000);
+
+    CHECK_EQ(s.count, 2);
+    check_event(&s, 0, INPUT_EVENT_PRESS, 20, 0);
+    check_event(&s, 1, INPUT_EVENT_RELEASE, 819, 0);
+}
+
+// Pressão longa: um único LONG_PRESS no instante exato, nenhuma repetição
+static void long_press(uint32_t base) {
+    sim_t s;
+    sim_init(&s, &action, base);
+
+    sim_edge(&s, 20, true);
+    sim_run(&s, 819);
+    CHECK_EQ(s.count, 1);
+    sim_run(&s, 820);
+    CHECK_EQ(s.count, 2);
+    sim_run(&s, 3000);
+    sim_edge(&s, 3000, false);
+    sim_run(&s, 3100);
+
+    CHECK_EQ(s.count, 3);
+    check_event(&s, 0, INPUT_EVENT_PRESS, 20, 0);
+    check_event(&s, 1, INPUT_EVENT_LONG_PRESS, 820, 0);
+    check_event(&s, 2, INPUT_EVENT_RELEASE, 3000, 0);
+
+    // Apertar de novo arma outra pressão longa
+    sim_edge(&s, 3200, true);
+    sim_run(&s, 4100);
+    CHECK_EQ(s.count, 5);
+    check_event(&s, 4, INPUT_EVENT_LONG_PRESS, 4000, 0);
+}
+
+// Direcional segurado: primeira repetição em 400 ms, depois a cada 120 ms
+static void repeat_pacing(uint32_t base) {
+    sim_t s;
+    sim_init(&s, &nav, base);
+
+    sim_edge(&s, 0, true);
+    sim_run(&s, 1000);
+    sim_edge(&s, 1000, false);
+    sim_run(&s, 1500);
+
+    // PRESS, repetições em 400, 520, 640, 760, 880, 1000 e RELEASE
+    CHECK_EQ(s.count, 8);
+    check_event(&s, 0, INPUT_EVENT_PRESS, 0, 0);
+    for (int i = 1; i <= 6; i++) {
+        check_event(&s, i, INPUT_EVENT_REPEAT, 400 + 120 * (i - 1), i);
+    }
+    check_event(&s, 7, INPUT_EVENT_RELEASE, 1000, 0);
+
+    // Nada de repetição depois de soltar
+    sim_run(&s, 3000);
+    CHECK_EQ(s.count, 8);
+}
+
+// Task atrasada: uma repetição só, e o ritmo recomeça a partir do atraso
+static void repeat_late_poll(uint32_t base) {
+    sim_t s;
+    sim_init(&s, &nav, base);
+
+    sim_edge(&s, 0, true);
+    sim_run(&s, 400);
+    CHECK_EQ(s.count, 2);
+
+    s.now = base + 2000;                // 1,6 s sem rodar
+    sim_poll(&s);
+    CHECK_EQ(s.count, 3);
+    check_event(&s, 2, INPUT_EVENT_REPEAT, 520, 2);     // Sem rajada das perdidas
+    sim_run(&s, 2119);
+    CHECK_EQ(s.count, 3);
+    sim_run(&s, 2120);
+    CHECK_EQ(s.count, 4);
+    check_event(&s, 3, INPUT_EVENT_REPEAT, 2120, 3);
+}
+
+// A task dorme até o prazo pedido: mesmos eventos, poucas voltas
+static void deadlines(uint32_t base) {
+    sim_t s;
+    sim_init(&s, &nav, base);
+
+    CHECK_EQ(input_fsm_next_deadline(&s.fsm, s.now), INPUT_FSM_NO_DEADLINE);
+    sim_edge(&s, 5, true);
+    CHECK_EQ(input_fsm_next_deadline(&s.fsm, s.now), 0);
+    sim_poll(&s);
+    CHECK_EQ(input_fsm_next_deadline(&s.fsm, s.now), 30);      // Janela de debounce
+
+    int wakeups = sim_run_deadlines(&s, 1000);
+    CHECK_EQ(s.count, 6);               // PRESS + repetições em 405..885
+    check_event(&s, 5, INPUT_EVENT_REPEAT, 885, 5);
+    CHECK(wakeups <= 8);
+    CHECK_EQ(input_fsm_next_deadline(&s.fsm, s.now), 5);       // Próxima em 1005
+
+    s.level = false;
+    input_fsm_edge(&s.fsm, s.now);
+    sim_poll(&s);
+    check_event(&s, 6, INPUT_EVENT_RELEASE, 1000, 0);
+    sim_run_deadlines(&s, 1100);
+    CHECK_EQ(input_fsm_next_deadline(&s.fsm, s.now), INPUT_FSM_NO_DEADLINE);
+    CHECK_EQ(s.count, 7);
+}
+
+// ========== EXECUÇÃO ==========
+
+typedef void (*scenario_t)(uint32_t base);
+
+static const struct {
+    const char *name;
+    scenario_t run;
+} scenarios[] = {
+    { "trepidação", bounce },
+    { "trepidação volta ao nível", bounce_settles_back },
+    { "toque mais curto que o debounce", tap_shorter_than_debounce },
+    { "pressão curta", short_press },
+    { "pressão longa", long_press },
+    { "ritmo da repetição", repeat_pacing },
+    { "repetição com a task atrasada", repeat_late_poll },
+    { "prazos", deadlines },
+};
+
+int main(void) {
+    char name[96];
+    for (size_t i = 0; i < sizeof(scenarios) / sizeof(scenarios[0]); i++) {
+        host_test_section(scenarios[i].name);
+        scenarios[i].run(1000);
+        snprintf(name, sizeof(name), "%s (estouro do relógio)", scenarios[i].name);
+        host_test_section(name);
+        scenarios[i].run(WRAP_BASE);
+    }
+    return host_test_finish("test_input_fsm");
+}
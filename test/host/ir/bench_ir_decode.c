@@ -0,0 +1,80 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Vazão do ir_decode em quadros por segundo, sobre as capturas do corpus de
+// regressão (ir_corpus.h): por protocolo e com o corpus inteiro, que inclui
+// ruído e quadros truncados. Cada passada confere a contagem de quadros, para
+// o número não vir de um decoder que desistiu cedo.
+
+#include <string.h>
+#include "ir_decoder.h"
+#include "ir_corpus.h"
+#include "host_test.h"
+
+#define RUN_US          300000      // Tempo de cada medida
+#define ALL_PROTOCOLS   IR_PROTOCOL_COUNT
+
+static ir_corpus_t corpus;
+
+// Capturas só com quadros do protocolo (ALL_PROTOCOLS = todas)
+static bool selected(const ir_corpus_capture_t *c, int protocol) {
+    if (protocol == ALL_PROTOCOLS) return true;
+    if (c->num_frames == 0) return false;
+    for (size_t i = 0; i < c->num_frames; i++) {
+        if (c->frames[i].protocol != (ir_protocol_t)protocol) return false;
+    }
+    return true;
+}
+
+static void measure(int protocol) {
+    ir_decode_result_t results[IR_CORPUS_MAX_FRAMES];
+    uint64_t frames = 0, symbols = 0, captures = 0, passes = 0;
+    int bad = 0;
+
+    int64_t t0 = host_test_now_us(), elapsed;
+    do {
+        for (size_t i = 0; i < corpus.count; i++) {
+            const ir_corpus_capture_t *c = &corpus.captures[i];
+            if (!selected(c, protocol)) continue;
+            size_t n = ir_decode(c->symbols, c->num_symbols, results, IR_CORPUS_MAX_FRAMES);
+            bad += n != c->num_frames;
+            frames += n;
+            symbols += c->num_symbols;
+            captures++;
+        }
+        passes++;
+        elapsed = host_test_now_us() - t0;
+    } while (elapsed < RUN_US);
+
+    double s = elapsed / 1e6;
+    printf("%-10s %6llu capturas/passada %9.0f quadros/s %6.2f us/quadro %10.0f símbolos/s\n",
+           protocol == ALL_PROTOCOLS ? "corpus" : ir_protocol_to_string(protocol),
+           (unsigned long long)(captures / passes), frames / s,
+           frames ? elapsed / (double)frames : 0, symbols / s);
+    CHECK_EQ(bad, 0);
+    CHECK(frames > 0);
+}
+
+int main(void) {
+    host_test_section("quadros por segundo");
+    CHECK(ir_corpus_load(IR_CORPUS_PATH, &corpus));
+    if (corpus.count > 0) {
+        for (int p = 0; p < IR_PROTOCOL_COUNT; p++) measure(p);
+        measure(ALL_PROTOCOLS);
+    }
+    ir_corpus_free(&corpus);
+    return host_test_finish("bench_ir_decode");
+}
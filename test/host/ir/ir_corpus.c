@@ -0,0 +1,407 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "ir_corpus.h"
+#include "ir_tx.h"
+#include "fake_rmt.h"
+
+#define MAX_PULSES          4096
+#define RMT_MAX_DURATION    32767       // 15 bits por meio símbolo
+#define NOISE_MAX_US        280         // Abaixo da menor unidade (RC6: 444 - 25% - 50)
+
+// ========== QUADROS ==========
+
+bool ir_corpus_same_frame(const ir_decode_result_t *got, const ir_decode_result_t *want,
+                          char *why, size_t size) {
+    if (got->protocol == want->protocol && got->address == want->address &&
+        got->command == want->command && got->toggle == want->toggle &&
+        got->bits == want->bits && got->repeat == want->repeat) {
+        return true;
+    }
+    snprintf(why, size, "%s %lX/%lX t%u b%u r%d, esperado %s %lX/%lX t%u b%u r%d",
+             ir_protocol_to_string(got->protocol), (unsigned long)got->address,
+             (unsigned long)got->command, got->toggle, got->bits, got->repeat,
+             ir_protocol_to_string(want->protocol), (unsigned long)want->address,
+             (unsigned long)want->command, want->toggle, want->bits, want->repeat);
+    return false;
+}
+
+static bool parse_protocol(const char *name, ir_protocol_t *protocol) {
+    for (int p = 0; p < IR_PROTOCOL_COUNT; p++) {
+        if (strcmp(name, ir_protocol_to_string(p)) == 0) {
+            *protocol = p;
+            return true;
+        }
+    }
+    return false;
+}
+
+// ========== LEITURA ==========
+
+static bool parse_symbols(char *text, ir_corpus_capture_t *c, size_t *cap) {
+    for (char *tok = strtok(text, " \t\r\n"); tok; tok = strtok(NULL, " \t\r\n")) {
+        unsigned l0, d0, l1, d1;
+        if (sscanf(tok, "%u:%u/%u:%u", &l0, &d0, &l1, &d1) != 4 ||
+            l0 > 1 || l1 > 1 || d0 > RMT_MAX_DURATION || d1 > RMT_MAX_DURATION) {
+            return false;
+        }
+        if (c->num_symbols == *cap) {
+            *cap = *cap ? *cap * 2 : 64;
+            c->symbols = realloc(c->symbols, *cap * sizeof(rmt_symbol_word_t));
+        }
+        c->symbols[c->num_symbols++] = (rmt_symbol_word_t) {
+            .level0 = l0, .duration0 = d0, .level1 = l1, .duration1 = d1,
+        };
+    }
+    return true;
+}
+
+bool ir_corpus_load(const char *path, ir_corpus_t *corpus) {
+    memset(corpus, 0, sizeof(*corpus));
+    FILE *f = fopen(path, "r");
+    if (!f) {
+        printf("corpus: não abriu %s\n", path);
+        return false;
+    }
+
+    char line[1024];
+    size_t cap = 0, symbol_cap = 0;
+    ir_corpus_capture_t *c = NULL;
+    bool ok = true;
+    for (int n = 1; ok && fgets(line, sizeof(line), f); n++) {
+        char name[16];
+        unsigned idle, jitter, level, toggle, bits, repeat;
+        unsigned long address, command;
+        int at = 0;
+
+        if (line[0] == '#' || line[0] == '\n') continue;
+        if (sscanf(line, "capture %u %u %u", &idle, &jitter, &level) == 3) {
+            if (corpus->count == cap) {
+                cap = cap ? cap * 2 : 64;
+                corpus->captures = realloc(corpus->captures, cap * sizeof(ir_corpus_capture_t));
+            }
+            c = &corpus->captures[corpus->count++];
+            *c = (ir_corpus_capture_t) {
+                .idle_us = idle, .jitter_us = jitter, .mark_level = level & 1, .line = n,
+            };
+            symbol_cap = 0;
+        } else if (c && sscanf(line, "frame %15s %lx %lx %u %u %u", name, &address, &command,
+                               &toggle, &bits, &repeat) == 6) {
+            ir_decode_result_t *r = &c->frames[c->num_frames];
+            ok = c->num_frames < IR_CORPUS_MAX_FRAMES && parse_protocol(name, &r->protocol);
+            r->address = address;
+            r->command = command;
+            r->toggle = toggle;
+            r->bits = bits;
+            r->repeat = repeat != 0;
+            c->num_frames++;
+            corpus->frames++;
+        } else if (c && sscanf(line, "symbols %n", &at) == 0 && at > 0) {
+            size_t before = c->num_symbols;
+            ok = parse_symbols(line + at, c, &symbol_cap);
+            corpus->symbols += c->num_symbols - before;
+        } else {
+            ok = false;
+        }
+        if (!ok) printf("corpus: %s:%d malformada\n", path, n);
+    }
+    fclose(f);
+
+    if (ok && corpus->count == 0) {
+        printf("corpus: %s vazio\n", path);
+        ok = false;
+    }
+    if (!ok) ir_corpus_free(corpus);
+    return ok;
+}
+
+void ir_corpus_free(ir_corpus_t *corpus) {
+    for (size_t i = 0; i < corpus->count; i++) free(corpus->captures[i].symbols);
+    free(corpus->captures);
+    memset(corpus, 0, sizeof(*corpus));
+}
+
+// ========== GERAÇÃO ==========
+
+typedef struct {
+    bool mark;
+    uint32_t us;
+} pulse_t;
+
+static pulse_t pulses[MAX_PULSES];
+static size_t num_pulses;
+static size_t frame_pulse[IR_CORPUS_MAX_FRAMES + 1];   // Primeiro pulso de cada quadro
+static ir_decode_result_t sent[IR_CORPUS_MAX_FRAMES];   // Quadros como foram enviados
+static size_t num_sent;
+
+static uint32_t rng;
+
+static uint32_t below(uint32_t n) {
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return n ? rng % n : 0;
+}
+
+static void add_pulse(bool mark, uint32_t us) {
+    if (us == 0) return;
+    if (num_pulses > 0 && pulses[num_pulses - 1].mark == mark) {
+        pulses[num_pulses - 1].us += us;
+    } else if (num_pulses < MAX_PULSES) {
+        pulses[num_pulses++] = (pulse_t) { mark, us };
+    }
+}
+
+// Envia pelo ir_tx e recolhe o que saiu do RMT: uma transação de quadro e
+// uma de silêncio por quadro
+static bool transmit(const ir_tx_code_t *code, int repeats) {
+    fake_rmt_reset();
+    if (ir_tx_send(code, repeats) != ESP_OK) return false;
+
+    num_pulses = 0;
+    num_sent = fake_rmt_trans_count() / 2;
+    if (num_sent == 0 || num_sent > IR_CORPUS_MAX_FRAMES) return false;
+
+    fake_rmt_trans_t t;
+    for (size_t i = 0; fake_rmt_get_trans(i, &t); i++) {
+        if (i % 2 == 0) frame_pulse[i / 2] = num_pulses;
+        rmt_symbol_word_t s;
+        for (size_t k = 0; k < t.count && fake_rmt_get_symbols(t.first + k, &s, 1) == 1; k++) {
+            add_pulse(s.level0, s.duration0);
+            add_pulse(s.level1, s.duration1);
+        }
+    }
+    frame_pulse[num_sent] = num_pulses;
+
+    // O que o decoder tem que ver em cada quadro, pelo código enviado
+    for (size_t f = 0; f < num_sent; f++) {
+        ir_decode_result_t *r = &sent[f];
+        *r = (ir_decode_result_t) {
+            .protocol = code->protocol,
+            .address = code->address,
+            .command = code->command,
+            .toggle = 0xFF,
+            .bits = 0xFF,
+            .repeat = f > 0 && code->protocol == IR_PROTOCOL_NEC,
+        };
+        if (code->protocol == IR_PROTOCOL_RC5 || code->protocol == IR_PROTOCOL_RC6) {
+            r->toggle = code->toggle;
+        } else if (code->protocol == IR_PROTOCOL_SIRC) {
+            r->bits = code->bits;
+        }
+    }
+    return true;
+}
+
+// Quadros de uma captura como o pipeline do ir_decode os entrega: a
+// repetição NEC herda endereço e comando do quadro NEC anterior da mesma
+// captura, e um quadro igual ao anterior é marcado como repetição
+static size_t expect(size_t first, size_t last, ir_decode_result_t *out) {
+    size_t n = 0;
+    for (size_t f = first; f < last; f++, n++) {
+        out[n] = sent[f];
+        const ir_decode_result_t *prev = n > 0 ? &out[n - 1] : NULL;
+        if (out[n].repeat) {
+            out[n].address = prev ? prev->address : 0;
+            out[n].command = prev ? prev->command : 0;
+        } else if (prev && prev->address == out[n].address && prev->command == out[n].command &&
+                   prev->toggle == out[n].toggle && prev->bits == out[n].bits) {
+            out[n].repeat = true;
+        }
+    }
+    return n;
+}
+
+// Grava os pulsos [first, last) como o RX os capturaria
+static void write_capture(FILE *f, size_t first, size_t last, uint32_t idle_us, uint32_t jitter_us,
+                          unsigned mark_level, const ir_decode_result_t *frames, size_t num_frames) {
+    fprintf(f, "capture %u %u %u\n", (unsigned)idle_us, (unsigned)jitter_us, mark_level);
+    for (size_t i = 0; i < num_frames; i++) {
+        fprintf(f, "frame %s %lX %lX %u %u %d\n", ir_protocol_to_string(frames[i].protocol),
+                (unsigned long)frames[i].address, (unsigned long)frames[i].command,
+                frames[i].toggle, frames[i].bits, frames[i].repeat);
+    }
+
+    // O receptor só vê a primeira borda: um espaço no início (RC5 começa
+    // com um bit 1, espaço e marca) some no repouso
+    while (first < last && !pulses[first].mark) first++;
+
+    // O receptor atrasa a borda de descida: a marca cresce e o espaço
+    // seguinte encolhe o mesmo tanto
+    uint32_t halves[2 * MAX_PULSES];
+    unsigned levels[2 * MAX_PULSES];
+    size_t n = 0;
+    uint32_t stolen = 0;
+    for (size_t i = first; i < last; i++) {
+        uint32_t us = pulses[i].us;
+        if (pulses[i].mark) {
+            stolen = below(jitter_us + 1);
+            us += stolen;
+        } else {
+            us -= stolen < us ? stolen : 0;
+            stolen = 0;
+        }
+        unsigned level = pulses[i].mark ? mark_level : !mark_level;
+        while (us > 0 && n < 2 * MAX_PULSES) {
+            uint32_t part = us > RMT_MAX_DURATION ? RMT_MAX_DURATION : us;
+            halves[n] = part;
+            levels[n++] = level;
+            us -= part;
+        }
+    }
+    // Marcador de fim: duração 0 no nível de repouso
+    halves[n] = 0;
+    levels[n++] = !mark_level;
+    if (n % 2) {
+        halves[n] = 0;
+        levels[n++] = !mark_level;
+    }
+
+    for (size_t i = 0; i < n; i += 2) {
+        fprintf(f, "%s%u:%u/%u:%u", i % 16 == 0 ? "symbols " : " ",
+                levels[i], (unsigned)halves[i], levels[i + 1], (unsigned)halves[i + 1]);
+        if (i % 16 == 14 || i + 2 >= n) fputc('\n', f);
+    }
+}
+
+// Corta a sequência onde o silêncio chega a idle_us (0 = sem corte); o
+// silêncio depois do último quadro não entra em nenhuma captura
+static int write_sequence(FILE *f, uint32_t idle_us, uint32_t jitter_us, unsigned mark_level) {
+    int captures = 0;
+    size_t start = 0, first_frame = 0;
+    for (size_t f_end = 1; f_end <= num_sent; f_end++) {
+        size_t gap = frame_pulse[f_end] - 1;           // Silêncio depois do quadro
+        if (f_end < num_sent && (idle_us == 0 || pulses[gap].us < idle_us)) continue;
+
+        ir_decode_result_t frames[IR_CORPUS_MAX_FRAMES];
+        size_t n = expect(first_frame, f_end, frames);
+        write_capture(f, start, gap, idle_us, jitter_us, mark_level, frames, n);
+        captures++;
+        start = gap + 1;
+        first_frame = f_end;
+    }
+    return captures;
+}
+
+// Código com os campos cortados ao que o protocolo transmite
+static ir_tx_code_t make_code(ir_protocol_t protocol, uint32_t address, uint32_t command,
+                              uint8_t toggle, uint8_t bits) {
+    ir_tx_code_t code = {
+        .protocol = protocol,
+        .address = address & 0xFFFF,
+        .command = command & 0xFFFF,
+        .toggle = 0,
+        .bits = 0xFF,
+    };
+    switch (protocol) {
+    case IR_PROTOCOL_RC5:
+        code.address &= 0x1F;
+        code.command &= 0x3F;
+        code.toggle = toggle & 1;
+        break;
+    case IR_PROTOCOL_RC6:
+        code.address &= 0xFF;
+        code.command &= 0xFF;
+        code.toggle = toggle & 1;
+        break;
+    case IR_PROTOCOL_SIRC:
+        code.bits = bits;
+        code.command &= 0x7F;
+        code.address &= (1u << (bits - 7)) - 1;
+        break;
+    default:
+        break;
+    }
+    return code;
+}
+
+// Sorteios um por vez: a ordem de avaliação dos argumentos não é definida
+static ir_tx_code_t random_code(ir_protocol_t protocol) {
+    static const uint8_t sirc_bits[] = { 12, 15, 20 };
+    uint32_t address = below(0x10000);
+    uint32_t command = below(0x10000);
+    uint8_t toggle = below(2);
+    uint8_t bits = sirc_bits[below(3)];
+    return make_code(protocol, address, command, toggle, bits);
+}
+
+// Começo de um quadro (até metade dos pulsos): nenhum protocolo pode
+// aceitar, nem o SIRC de 12 bits num de 20 cortado
+static bool write_truncated(FILE *f, ir_protocol_t protocol) {
+    ir_tx_code_t code = random_code(protocol);
+    if (!transmit(&code, 0)) return false;
+    size_t last = 1 + below((frame_pulse[1] - 1) / 2);
+    uint32_t jitter = below(151);
+    write_capture(f, 0, last, 20000, jitter, below(2), NULL, 0);
+    return true;
+}
+
+// Pulsos mais curtos que a menor unidade de qualquer protocolo
+static void write_noise(FILE *f) {
+    num_pulses = 0;
+    for (uint32_t i = 0, n = 4 + below(40); i < n; i++) {
+        add_pulse(i % 2 == 0, 60 + below(NOISE_MAX_US - 60));
+    }
+    write_capture(f, 0, num_pulses, 20000, 0, below(2), NULL, 0);
+}
+
+bool ir_corpus_generate(const char *path, uint32_t seed) {
+    static const uint32_t idles[] = { 12000, 20000, 32000, 0 };
+    static const uint32_t jitters[] = { 0, 50, 100, 150 };
+    FILE *f = fopen(path, "w");
+    if (!f) return false;
+
+    rng = seed ? seed : 1;
+    fprintf(f, "# Corpus de regressão do ir_decode (formato em test/host/ir/ir_corpus.h).\n"
+               "# Gerado com test_ir_decode --generate, semente 0x%X. Não editar à mão.\n",
+            (unsigned)seed);
+
+    bool ok = true;
+    int captures = 0;
+    for (int p = 0; p < IR_PROTOCOL_COUNT && ok; p++) {
+        fprintf(f, "\n# %s\n", ir_protocol_to_string(p));
+        for (int i = 0; i < 16 && ok; i++) {
+            ir_tx_code_t code;
+            uint32_t idle, jitter;
+            if (i < 2) {
+                // Extremos: tudo 0 e tudo 1, com o pior jitter e sem cortes
+                uint32_t fill = i ? 0xFFFFFFFF : 0;
+                code = make_code(p, fill, fill, i, i ? 20 : 12);
+                idle = 0;
+                jitter = 150;
+            } else {
+                code = random_code(p);
+                idle = idles[below(4)];
+                jitter = jitters[below(4)];
+            }
+            ok = transmit(&code, below(4));
+            if (ok) captures += write_sequence(f, idle, jitter, below(2));
+        }
+
+        fprintf(f, "\n# %s truncado\n", ir_protocol_to_string(p));
+        for (int i = 0; i < 4 && ok; i++, captures++) ok = write_truncated(f, p);
+    }
+
+    fprintf(f, "\n# Ruído\n");
+    for (int i = 0; i < 10; i++, captures++) write_noise(f);
+
+    fclose(f);
+    printf("corpus: %d capturas em %s\n", captures, path);
+    return ok;
+}
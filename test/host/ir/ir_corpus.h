@@ -0,0 +1,75 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Corpus de regressão do ir_decode: capturas do RMT RX gravadas em texto
+// (corpus/ir_decode.txt), cada uma com os quadros que ela tem que dar.
+//
+// O corpus é gerado uma vez, com semente fixa, a partir dos encoders de
+// protocolo (ir_tx sobre o RMT simulado) e fica versionado: uma mudança nos
+// encoders não muda o que o decoder tem que aceitar. Os quadros esperados
+// vêm do código enviado, nunca do decoder. Cada captura imita o receptor:
+// ativo em 0 ou em 1, marcas esticadas e espaços encurtados pelo jitter,
+// cortada onde o silêncio passa de idle_us e terminada pelo marcador de
+// duração 0 do RMT. Também há capturas que não podem dar quadro nenhum
+// (quadros truncados e ruído).
+//
+// Formato, uma linha por item:
+//   capture <idle_us, 0 = sequência inteira> <jitter_us> <nível da marca>
+//   frame <protocolo> <endereço> <comando> <toggle> <bits> <repeat>
+//   symbols <nível>:<duração>/<nível>:<duração> ...    (um símbolo por item)
+// Linhas com '#' são comentários.
+
+#ifndef IR_CORPUS_H
+#define IR_CORPUS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "ir_decoder.h"
+
+#define IR_CORPUS_SEED          0x1D5EED
+#define IR_CORPUS_MAX_FRAMES    8
+
+typedef struct {
+    uint32_t idle_us;
+    uint32_t jitter_us;
+    unsigned mark_level;
+    ir_decode_result_t frames[IR_CORPUS_MAX_FRAMES];
+    size_t num_frames;
+    rmt_symbol_word_t *symbols;
+    size_t num_symbols;
+    int line;                   // No arquivo, para as mensagens
+} ir_corpus_capture_t;
+
+typedef struct {
+    ir_corpus_capture_t *captures;
+    size_t count;
+    size_t frames;
+    size_t symbols;
+} ir_corpus_t;
+
+// false (com a linha do erro em stdout) se o arquivo não abrir ou estiver malformado
+bool ir_corpus_load(const char *path, ir_corpus_t *corpus);
+void ir_corpus_free(ir_corpus_t *corpus);
+
+// Regrava o corpus; usa ir_tx (o serviço tem que estar rodando)
+bool ir_corpus_generate(const char *path, uint32_t seed);
+
+// Igualdade de quadros, com a diferença em `why` quando não são iguais
+bool ir_corpus_same_frame(const ir_decode_result_t *got, const ir_decode_result_t *want,
+                          char *why, size_t size);
+
+#endif // IR_CORPUS_H
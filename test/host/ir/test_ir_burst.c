@@ -0,0 +1,360 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Burst (ir_burst.c) sobre o RMT simulado: vários arquivos .ir no cartão
+// falso, com sinais parsed, raw e alguns que não podem sair. Confere a ordem
+// dos eventos e dos sinais no RMT, os contadores sent/failed/skipped, o
+// cancelamento pelo handler, o stop_on_error com o TX done perdido e o
+// relatório de sinais por segundo contra o tempo no ar. Cada arquivo é lido
+// uma vez pelo cursor, sem montar o índice da biblioteca.
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "ir_burst.h"
+#include "ir_library.h"
+#include "ir_storage.h"
+#include "ir_tx.h"
+#include "fake_rmt.h"
+#include "fake_fs.h"
+#include "host_test.h"
+
+#define DIR             IR_STORAGE_BASE_PATH "/burst"
+#define HEADER          "Filetype: IR signals file\nVersion: 1\n"
+#define MAX_EVENTS      64
+
+// ========== ARQUIVOS ==========
+
+static void write_file(const char *path, const char *text) {
+    char host[512];
+    CHECK(fake_fs_host_path(path, host, sizeof(host)));
+    FILE *f = fopen(host, "wb");
+    CHECK(f != NULL);
+    if (f == NULL) return;
+    fputs(text, f);
+    fclose(f);
+}
+
+static void write_library(void) {
+    char dir[512];
+    CHECK(fake_fs_host_path(IR_STORAGE_BASE_PATH, dir, sizeof(dir)));
+    mkdir(dir, 0755);
+    CHECK(fake_fs_host_path(DIR, dir, sizeof(dir)));
+    mkdir(dir, 0755);
+
+    write_file(DIR "/tv.ir", HEADER
+               "# \nname: Power\ntype: parsed\nprotocol: NEC\naddress: 07 00 00 00\ncommand: 02 00 00 00\n"
+               "# \nname: Vol_up\ntype: parsed\nprotocol: NEC\naddress: 07 00 00 00\ncommand: 07 00 00 00\n"
+               "# \nname: Menu\ntype: parsed\nprotocol: RC6\naddress: 00 00 00 00\ncommand: 54 00 00 00\n");
+    write_file(DIR "/ac.ir", HEADER
+               "# \nname: On\ntype: raw\nfrequency: 38000\nduty_cycle: 0.330000\n"
+               "data: 3500 1700 430 1300 430 430 430 1300 430\n"
+               "# \nname: Off\ntype: raw\nfrequency: 56000\nduty_cycle: 0.330000\n"
+               "data: 3500 1700 430 430 430 430 430\n");
+    // Kaseikyo sem encoder e raw com portadora fora da faixa do TX
+    write_file(DIR "/mix.ir", HEADER
+               "# \nname: Eject\ntype: parsed\nprotocol: Kaseikyo\naddress: 41 54 32 00\ncommand: 1B 00 00 00\n"
+               "# \nname: Input\ntype: parsed\nprotocol: SIRC15\naddress: 1A 00 00 00\ncommand: 25 00 00 00\n"
+               "# \nname: Low\ntype: raw\nfrequency: 1000\nduty_cycle: 0.330000\ndata: 900 450 900\n");
+    write_file(DIR "/junk.ir", "hello\nname: x\n");
+    write_file(DIR "/notes.txt", HEADER "# \nname: X\ntype: parsed\nprotocol: NEC\naddress: 01 00 00 00\ncommand: 01 00 00 00\n");
+}
+
+// Sinais que saem de tv, ac e mix, na ordem, com a portadora de cada um e as
+// transações no RMT sem repetições (quadro e silêncio; o SIRC sai três vezes)
+static const char *const SENT_ORDER[] = { "tv/Power", "tv/Vol_up", "tv/Menu", "ac/On", "ac/Off", "mix/Input" };
+static const uint32_t SENT_CARRIER[] = { 38000, 38000, 36000, 38000, 56000, 40000 };
+static const size_t SENT_TRANS[] = { 2, 2, 2, 2, 2, 6 };
+#define NUM_SENT (sizeof(SENT_ORDER) / sizeof(SENT_ORDER[0]))
+
+// ========== EVENTOS ==========
+
+typedef struct {
+    ir_burst_event_type_t type;
+    char what[96];              // "arquivo/sinal" ou "arquivo"
+    esp_err_t result;
+    uint32_t sent;
+} event_t;
+
+static struct {
+    event_t list[MAX_EVENTS];
+    int count;
+    const char *cancel_at;      // Retorna false no evento com este `what`
+} rec;
+
+static bool record(const ir_burst_event_t *event, void *ctx) {
+    CHECK(ctx == &rec);
+    CHECK(event->stats != NULL);
+    if (rec.count >= MAX_EVENTS) return true;
+    event_t *e = &rec.list[rec.count++];
+    e->type = event->type;
+    e->result = event->result;
+    e->sent = event->stats->sent;
+    if (event->signal) snprintf(e->what, sizeof(e->what), "%s/%s", event->file, event->signal);
+    else snprintf(e->what, sizeof(e->what), "%s", event->file ? event->file : "");
+    return !(rec.cancel_at && strcmp(e->what, rec.cancel_at) == 0);
+}
+
+static void rec_reset(const char *cancel_at) {
+    memset(&rec, 0, sizeof(rec));
+    rec.cancel_at = cancel_at;
+}
+
+static int find_event(ir_burst_event_type_t type, const char *what) {
+    for (int i = 0; i < rec.count; i++) {
+        if (rec.list[i].type == type && strcmp(rec.list[i].what, what) == 0) return i;
+    }
+    return -1;
+}
+
+// Eventos de um tipo, na ordem, separados por ','
+static void events_of(ir_burst_event_type_t type, char *out, size_t size) {
+    size_t n = 0;
+    out[0] = '\0';
+    for (int i = 0; i < rec.count && n < size; i++) {
+        if (rec.list[i].type != type) continue;
+        n += snprintf(out + n, size - n, "%s%s", n ? "," : "", rec.list[i].what);
+    }
+}
+
+// DONE uma vez só, no fim; cada sinal depois do FILE do seu arquivo
+static void check_sequence(esp_err_t result) {
+    int done = 0;
+    for (int i = 0; i < rec.count; i++) {
+        const event_t *e = &rec.list[i];
+        if (e->type == IR_BURST_EVENT_DONE) {
+            done++;
+            CHECK_EQ(i, rec.count - 1);
+            CHECK_EQ(e->result, result);
+            continue;
+        }
+        const char *slash = strchr(e->what, '/');
+        if (slash) {
+            char file[96];
+            snprintf(file, sizeof(file), "%.*s", (int)(slash - e->what), e->what);
+            int at = find_event(IR_BURST_EVENT_FILE, file);
+            CHECK(at >= 0 && at < i);
+        }
+    }
+    CHECK_EQ(done, 1);
+}
+
+// Cada sinal de SENT_ORDER ocupa as suas transações, com a sua portadora
+static void check_rmt(void) {
+    size_t first = 0;
+    for (size_t i = 0; i < NUM_SENT; i++) {
+        bool same = true;
+        for (size_t k = first; k < first + SENT_TRANS[i]; k++) {
+            fake_rmt_trans_t t;
+            same = same && fake_rmt_get_trans(k, &t) && t.carrier_hz == SENT_CARRIER[i];
+        }
+        host_checks++;
+        if (!same) host_check_failed(__FILE__, __LINE__, "portadora", SENT_ORDER[i]);
+        first += SENT_TRANS[i];
+    }
+    CHECK_EQ(fake_rmt_trans_count(), first);
+}
+
+// ========== CENÁRIOS ==========
+
+static void test_order(void) {
+    host_test_section("ordem e contadores");
+    static const char *files[] = { "tv", "junk", "ac", "mix", "none" };
+    ir_burst_config_t config = { .dir = DIR };
+    ir_burst_stats_t stats;
+    char got[512];
+
+    ir_library_stats_t before, after;
+    ir_library_get_stats(&before);
+    fake_rmt_reset();
+    rec_reset(NULL);
+    CHECK_OK(ir_burst_run_files(files, 5, &config, record, &rec, &stats));
+    ir_library_get_stats(&after);
+
+    CHECK_EQ(stats.files, 3);
+    CHECK_EQ(stats.sent, NUM_SENT);
+    CHECK_EQ(stats.failed, 0);
+    CHECK_EQ(stats.skipped, 4);
+    CHECK(!stats.cancelled);
+    // Cursor: nenhum índice montado nem consultado
+    CHECK_EQ(after.builds, before.builds);
+    CHECK_EQ(after.hits, before.hits);
+
+    check_sequence(ESP_OK);
+    events_of(IR_BURST_EVENT_FILE, got, sizeof(got));
+    CHECK_STR(got, "tv,ac,mix");
+    events_of(IR_BURST_EVENT_SENT, got, sizeof(got));
+    CHECK_STR(got, "tv/Power,tv/Vol_up,tv/Menu,ac/On,ac/Off,mix/Input");
+    events_of(IR_BURST_EVENT_SKIPPED, got, sizeof(got));
+    CHECK_STR(got, "junk,mix/Eject,mix/Low,none");
+    CHECK_EQ(rec.list[find_event(IR_BURST_EVENT_SKIPPED, "junk")].result, ESP_ERR_INVALID_RESPONSE);
+    CHECK_EQ(rec.list[find_event(IR_BURST_EVENT_SKIPPED, "mix/Eject")].result, ESP_ERR_NOT_SUPPORTED);
+    CHECK_EQ(rec.list[find_event(IR_BURST_EVENT_SKIPPED, "mix/Low")].result, ESP_ERR_INVALID_ARG);
+    CHECK_EQ(rec.list[find_event(IR_BURST_EVENT_SKIPPED, "none")].result, ESP_ERR_NOT_FOUND);
+
+    // Contadores a cada SENT: um a mais que o anterior
+    uint32_t sent = 0;
+    for (int i = 0; i < rec.count; i++) {
+        if (rec.list[i].type != IR_BURST_EVENT_SENT) continue;
+        CHECK_EQ(rec.list[i].result, ESP_OK);
+        CHECK_EQ(rec.list[i].sent, ++sent);
+    }
+
+    // No RMT, na mesma ordem; o tempo no ar é o que o relógio simulado andou
+    check_rmt();
+    CHECK_EQ(stats.air_us, fake_rmt_clock_us());
+}
+
+static void test_dir(void) {
+    host_test_section("diretório");
+    ir_burst_config_t config = { .dir = DIR, .repeats = 2 };
+    ir_burst_stats_t stats;
+
+    fake_rmt_reset();
+    rec_reset(NULL);
+    CHECK_OK(ir_burst_run(&config, record, &rec, &stats));
+    // notes.txt fica de fora; junk.ir, Eject e Low são ignorados
+    CHECK_EQ(stats.files, 3);
+    CHECK_EQ(stats.sent, NUM_SENT);
+    CHECK_EQ(stats.skipped, 3);
+    CHECK_EQ(stats.air_us, fake_rmt_clock_us());
+    check_sequence(ESP_OK);
+
+    // Sem handler, mesmos contadores
+    fake_rmt_reset();
+    CHECK_OK(ir_burst_run(&config, NULL, NULL, &stats));
+    CHECK_EQ(stats.sent, NUM_SENT);
+
+    config.dir = IR_STORAGE_BASE_PATH "/nope";
+    CHECK_EQ(ir_burst_run(&config, NULL, NULL, NULL), ESP_ERR_NOT_FOUND);
+    config.dir = DIR;
+    config.repeats = IR_TX_MAX_REPEATS + 1;
+    CHECK_EQ(ir_burst_run(&config, NULL, NULL, NULL), ESP_ERR_INVALID_ARG);
+    CHECK_EQ(ir_burst_run_files(NULL, 1, NULL, NULL, NULL, NULL), ESP_ERR_INVALID_ARG);
+}
+
+static void test_cancel(void) {
+    host_test_section("cancelamento pelo handler");
+    static const char *files[] = { "tv", "ac", "mix" };
+    ir_burst_config_t config = { .dir = DIR };
+    ir_burst_stats_t stats;
+    char got[512];
+
+    // Cancela ao abrir ac: os sinais de tv já entregues ao TX ainda saem
+    fake_rmt_reset();
+    rec_reset("ac");
+    CHECK_OK(ir_burst_run_files(files, 3, &config, record, &rec, &stats));
+    CHECK(stats.cancelled);
+    CHECK_EQ(stats.files, 2);
+    CHECK_EQ(stats.sent, 3);
+    CHECK_EQ(stats.failed, 0);
+    CHECK_EQ(stats.skipped, 0);
+    check_sequence(ESP_OK);
+    events_of(IR_BURST_EVENT_FILE, got, sizeof(got));
+    CHECK_STR(got, "tv,ac");
+    events_of(IR_BURST_EVENT_SENT, got, sizeof(got));
+    CHECK_STR(got, "tv/Power,tv/Vol_up,tv/Menu");
+    CHECK_EQ(fake_rmt_trans_count(), 3 * 2);
+
+    // No primeiro sinal: o que já estava no pipeline sai, e nada mais
+    fake_rmt_reset();
+    rec_reset("tv/Power");
+    CHECK_OK(ir_burst_run_files(files, 3, &config, record, &rec, &stats));
+    CHECK(stats.cancelled);
+    CHECK(stats.sent >= 1 && stats.sent <= IR_BURST_PIPELINE_DEPTH);
+    CHECK_EQ(fake_rmt_trans_count(), 2 * stats.sent);
+    CHECK_EQ(find_event(IR_BURST_EVENT_FILE, "ac"), -1);
+    check_sequence(ESP_OK);
+}
+
+static void test_errors(void) {
+    host_test_section("falhas de transmissão");
+    static const char *files[] = { "tv", "ac" };
+    ir_burst_config_t config = { .dir = DIR };
+    ir_burst_stats_t stats;
+    char got[512];
+
+    // Sem TX done todo envio expira; sem stop_on_error o burst segue
+    fake_rmt_reset();
+    fake_rmt_drop_done(true);
+    rec_reset(NULL);
+    CHECK_OK(ir_burst_run_files(files, 1, &config, record, &rec, &stats));
+    CHECK_EQ(stats.sent, 0);
+    CHECK_EQ(stats.failed, 3);
+    CHECK_EQ(stats.air_us, 0);
+    CHECK(!stats.cancelled);
+    check_sequence(ESP_OK);
+    CHECK_EQ(rec.list[find_event(IR_BURST_EVENT_SENT, "tv/Menu")].result, ESP_ERR_TIMEOUT);
+
+    // stop_on_error: para na primeira falha; o sinal seguinte já estava no
+    // pipeline e também falha, o resto não sai
+    config.stop_on_error = true;
+    fake_rmt_reset();
+    rec_reset(NULL);
+    CHECK_EQ(ir_burst_run_files(files, 2, &config, record, &rec, &stats), ESP_ERR_TIMEOUT);
+    CHECK_EQ(stats.sent, 0);
+    CHECK_EQ(stats.failed, IR_BURST_PIPELINE_DEPTH);
+    CHECK_EQ(stats.files, 1);
+    check_sequence(ESP_ERR_TIMEOUT);
+    events_of(IR_BURST_EVENT_SENT, got, sizeof(got));
+    CHECK_STR(got, "tv/Power,tv/Vol_up");
+    fake_rmt_drop_done(false);
+
+    // Com os TX done de volta, o mesmo burst sai inteiro
+    fake_rmt_reset();
+    CHECK_OK(ir_burst_run_files(files, 2, &config, NULL, NULL, &stats));
+    CHECK_EQ(stats.sent, 5);
+    CHECK_EQ(stats.failed, 0);
+}
+
+static void test_report(void) {
+    host_test_section("sinais por segundo");
+    static const char *files[] = { "tv" };
+    ir_burst_config_t config = { .dir = DIR, .repeats = 1 };
+    ir_burst_stats_t stats;
+
+    // Tempo no ar passando de verdade: com o pipeline os sinais saem colados
+    // e o obtido fica perto do teórico
+    fake_rmt_reset();
+    fake_rmt_set_realtime(1.0);
+    CHECK_OK(ir_burst_run_files(files, 1, &config, NULL, NULL, &stats));
+    fake_rmt_set_realtime(0);
+
+    CHECK_EQ(stats.sent, 3);
+    CHECK_EQ(stats.air_us, fake_rmt_clock_us());
+    double air = stats.sent * 1e6 / stats.air_us;
+    double got = stats.sent * 1e6 / stats.elapsed_us;
+    CHECK(stats.air_signals_per_s > air * 0.999 && stats.air_signals_per_s < air * 1.001);
+    CHECK(stats.signals_per_s > got * 0.999 && stats.signals_per_s < got * 1.001);
+    CHECK(stats.signals_per_s <= stats.air_signals_per_s * 1.02);
+    CHECK(stats.signals_per_s >= stats.air_signals_per_s * 0.5);
+    printf("%u sinais: %.1f sinais/s obtidos, %.1f no ar (%.0f%%)\n", (unsigned)stats.sent,
+           stats.signals_per_s, stats.air_signals_per_s, 100.0 * stats.air_us / stats.elapsed_us);
+}
+
+int main(void) {
+    fake_fs_set_root(host_test_tmpdir());
+    write_library();
+
+    test_order();
+    test_dir();
+    test_cancel();
+    test_errors();
+    test_report();
+
+    ir_tx_service_stop();
+    return host_test_finish("test_ir_burst");
+}
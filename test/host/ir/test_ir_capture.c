@@ -0,0 +1,340 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Motor de captura (ir_capture.c) sobre o RX do RMT simulado. Os sinais são
+// os que o ir_tx manda para o RMT, invertidos como na saída de um receptor
+// ativo em 0, e tocados em tempo real na entrada enquanto o teste consome as
+// capturas como o ir_rx. Repetições coladas têm que chegar todas, cada uma
+// na sua captura, decodificáveis e com o instante certo; quadros longos
+// passam por várias recepções parciais e saem inteiros, também no formato
+// raw do Flipper.
+
+#include <pthread.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "ir_capture.h"
+#include "ir_decoder.h"
+#include "ir_library.h"
+#include "ir_storage.h"
+#include "ir_tx.h"
+#include "fake_rmt.h"
+#include "fake_fs.h"
+#include "host_test.h"
+
+#define MAX_LEVELS      8192
+#define MAX_FRAMES      (IR_TX_MAX_REPEATS + 1)
+#define TAIL_US         50000       // Silêncio depois do sinal
+#define TIME_SLACK_US   10000       // Atraso aceitável do callback no host
+
+// ========== SINAIS ==========
+
+typedef struct {
+    fake_rmt_level_t levels[MAX_LEVELS];
+    size_t count;
+    int64_t frame_us[MAX_FRAMES];   // Início de cada quadro no sinal
+    size_t frames;
+} signal_t;
+
+static void add(signal_t *s, uint8_t level, uint32_t us) {
+    if (us == 0) return;
+    if (s->count > 0 && s->levels[s->count - 1].level == level) {
+        s->levels[s->count - 1].us += us;
+    } else if (s->count < MAX_LEVELS) {
+        s->levels[s->count++] = (fake_rmt_level_t) { level, us };
+    }
+}
+
+// O que o ir_tx transmite, na saída do receptor (marca = 0)
+static void from_tx(signal_t *s, const ir_tx_code_t *code, int repeats) {
+    memset(s, 0, sizeof(*s));
+    fake_rmt_set_realtime(0);
+    fake_rmt_reset();
+    CHECK_OK(ir_tx_send(code, repeats));
+
+    fake_rmt_trans_t t;
+    for (size_t i = 0; fake_rmt_get_trans(i, &t); i++) {
+        if (i % 2 == 0 && s->frames < MAX_FRAMES) s->frame_us[s->frames++] = t.start_us;
+        rmt_symbol_word_t sym;
+        for (size_t k = 0; k < t.count && fake_rmt_get_symbols(t.first + k, &sym, 1) == 1; k++) {
+            add(s, !sym.level0, sym.duration0);
+            add(s, !sym.level1, sym.duration1);
+        }
+    }
+    add(s, 1, TAIL_US);
+}
+
+// Quadro longo como o de um ar-condicionado: líder e `bytes` bytes
+static void long_frame(signal_t *s, int bytes, uint32_t *timings, size_t *num_timings) {
+    memset(s, 0, sizeof(*s));
+    size_t n = 0;
+    timings[n++] = 3400;
+    timings[n++] = 1700;
+    for (int i = 0; i < bytes * 8; i++) {
+        timings[n++] = 430;
+        timings[n++] = ((i * 7 + i / 5) % 3 == 0) ? 1290 : 430;
+    }
+    timings[n++] = 430;
+    for (size_t i = 0; i < n; i++) add(s, i % 2, timings[i]);
+    add(s, 1, TAIL_US);
+    *num_timings = n;
+}
+
+// ========== TOCADOR ==========
+
+static pthread_t player;
+static const signal_t *playing;
+
+static void *play_thread(void *arg) {
+    fake_rmt_rx_play(playing->levels, playing->count);
+    return NULL;
+}
+
+static void play_async(const signal_t *s, double realtime) {
+    fake_rmt_set_realtime(realtime);
+    playing = s;
+    pthread_create(&player, NULL, play_thread, NULL);
+}
+
+static void play_join(void) {
+    pthread_join(player, NULL);
+    fake_rmt_set_realtime(0);
+}
+
+static bool same_code(const ir_decode_result_t *r, const ir_tx_code_t *code) {
+    return r->protocol == code->protocol && r->address == code->address &&
+           r->command == code->command &&
+           (r->toggle == 0xFF || r->toggle == code->toggle) &&
+           (r->bits == 0xFF || r->bits == code->bits);
+}
+
+// ========== TESTES ==========
+
+static void test_state(void) {
+    host_test_section("estado");
+    ir_capture_t capture;
+    ir_capture_config_t too_long = { .idle_us = IR_CAPTURE_MAX_IDLE_US + 1 };
+    CHECK_EQ(ir_capture_wait(&capture, 0), ESP_ERR_INVALID_STATE);
+    CHECK_EQ(ir_capture_stop(), ESP_ERR_INVALID_STATE);
+    CHECK_EQ(ir_capture_start(&too_long), ESP_ERR_INVALID_ARG);
+    CHECK_OK(ir_capture_start(NULL));
+    CHECK_EQ(ir_capture_start(NULL), ESP_ERR_INVALID_STATE);
+    CHECK_EQ(ir_capture_wait(&capture, 10), ESP_ERR_TIMEOUT);
+    CHECK_OK(ir_capture_stop());
+}
+
+// Cada quadro na sua captura, consumidas enquanto o sinal toca: nenhuma
+// descartada, na ordem, decodificável e com o instante do quadro
+static void check_back_to_back(const ir_tx_code_t *code, int repeats) {
+    static signal_t s;
+    from_tx(&s, code, repeats);
+    const char *name = ir_protocol_to_string(code->protocol);
+
+    CHECK_OK(ir_capture_start(NULL));
+    play_async(&s, 1.0);
+
+    int64_t start_us[MAX_FRAMES];
+    size_t got = 0;
+    int bad = 0;
+    ir_capture_t capture;
+    while (got < s.frames && ir_capture_wait(&capture, 500) == ESP_OK) {
+        ir_decode_result_t r[4];
+        size_t n = ir_decode(capture.symbols, capture.num_symbols, r, 4);
+        bool repeat_code = got > 0 && code->protocol == IR_PROTOCOL_NEC;
+        bool ok = capture.seq == got && !capture.truncated && n == 1 &&
+                  (repeat_code ? r[0].repeat : same_code(&r[0], code) && !r[0].repeat);
+        if (!ok) {
+            printf("%s: captura %zu (seq %u, %zu símbolos) deu %zu quadros\n",
+                   name, got, (unsigned)capture.seq, capture.num_symbols, n);
+        }
+        bad += !ok;
+        start_us[got++] = capture.start_us;
+        ir_capture_release(&capture);
+    }
+    play_join();
+
+    int64_t worst = 0;
+    for (size_t i = 1; i < got; i++) {
+        int64_t err = (start_us[i] - start_us[0]) - (s.frame_us[i] - s.frame_us[0]);
+        if (err < 0) err = -err;
+        if (err > worst) worst = err;
+    }
+    printf("%-10s %2zu/%zu quadros, %u descartados, erro de instante até %lld us\n",
+           name, got, s.frames, (unsigned)ir_capture_dropped(), (long long)worst);
+    CHECK_EQ(got, s.frames);
+    CHECK_EQ(bad, 0);
+    CHECK_EQ(ir_capture_dropped(), 0);
+    CHECK(worst < TIME_SLACK_US);
+    CHECK_OK(ir_capture_stop());
+}
+
+static void test_back_to_back(void) {
+    host_test_section("repetições coladas");
+    // SIRC: 45 ms por quadro e só uns 24 ms de silêncio, pouco acima do
+    // limiar padrão de 20 ms: o rearme e a troca de buffer têm que ser na hora
+    ir_tx_code_t sirc = { .protocol = IR_PROTOCOL_SIRC, .address = 0x01, .command = 0x15, .bits = 12 };
+    ir_tx_code_t nec = { .protocol = IR_PROTOCOL_NEC, .address = 0x04, .command = 0x08 };
+    ir_tx_code_t rc5 = { .protocol = IR_PROTOCOL_RC5, .address = 0x05, .command = 0x35, .toggle = 1 };
+    ir_tx_code_t rc6 = { .protocol = IR_PROTOCOL_RC6, .address = 0x00, .command = 0x0C, .toggle = 0 };
+    ir_tx_code_t samsung = { .protocol = IR_PROTOCOL_SAMSUNG32, .address = 0x0707, .command = 0x02FD };
+    check_back_to_back(&sirc, 11);
+    check_back_to_back(&nec, 5);
+    check_back_to_back(&rc5, 4);
+    check_back_to_back(&rc6, 3);
+    check_back_to_back(&samsung, 3);
+}
+
+// Com a captura anterior ainda com o consumidor, as seguintes são
+// descartadas e contadas, e seq mostra o buraco
+static void test_slow_consumer(void) {
+    host_test_section("consumidor atrasado");
+    static signal_t s;
+    ir_tx_code_t code = { .protocol = IR_PROTOCOL_SIRC, .address = 0x01, .command = 0x12, .bits = 12 };
+    from_tx(&s, &code, 4);
+
+    CHECK_OK(ir_capture_start(NULL));
+    play_async(&s, 0);
+    play_join();
+
+    ir_capture_t first, next;
+    CHECK_OK(ir_capture_wait(&first, 100));
+    CHECK_EQ(first.seq, 0);
+    CHECK_EQ(ir_capture_dropped(), s.frames - 1);
+    CHECK_EQ(ir_capture_wait(&next, 10), ESP_ERR_TIMEOUT);
+
+    ir_capture_release(&first);
+    play_async(&s, 0);
+    play_join();
+    CHECK_OK(ir_capture_wait(&next, 100));
+    CHECK_EQ(next.seq, s.frames);
+    ir_capture_release(&next);
+    CHECK_OK(ir_capture_stop());
+}
+
+// Quadro maior que o buffer da recepção: várias recepções parciais numa
+// captura, igual ao sinal tempo a tempo, e o mesmo no arquivo raw
+static void test_long_frame(void) {
+    host_test_section("quadro longo");
+    static signal_t s;
+    static uint32_t sent[IR_LIBRARY_MAX_TIMINGS], got[IR_LIBRARY_MAX_TIMINGS];
+    size_t num_sent, num_got;
+    long_frame(&s, 28, sent, &num_sent);
+
+    CHECK_OK(ir_capture_start(NULL));
+    play_async(&s, 0);
+    play_join();
+
+    ir_capture_t capture;
+    CHECK_OK(ir_capture_wait(&capture, 100));
+    CHECK(!capture.truncated);
+    int64_t air_us = 0;
+    for (size_t i = 0; i < num_sent; i++) air_us += sent[i];
+    CHECK_EQ(capture.end_us - capture.start_us, air_us);
+    num_got = ir_capture_timings(&capture, got, IR_LIBRARY_MAX_TIMINGS);
+    CHECK_EQ(num_got, num_sent);
+    CHECK(memcmp(got, sent, num_sent * sizeof(uint32_t)) == 0);
+
+    // Formato raw do Flipper
+    char dir[256];
+    fake_fs_set_root(host_test_tmpdir());
+    CHECK(fake_fs_host_path(IR_STORAGE_BASE_PATH, dir, sizeof(dir)));
+    mkdir(dir, 0755);
+    CHECK(ir_capture_save_raw(&capture, "ac"));
+    ir_capture_release(&capture);
+
+    ir_signal_t signal;
+    memset(got, 0, sizeof(got));
+    CHECK_OK(ir_library_find(IR_STORAGE_BASE_PATH "/ac.ir", "ac", &signal));
+    CHECK_EQ(signal.type, IR_SIGNAL_RAW);
+    CHECK_EQ(signal.frequency, IR_CAPTURE_RAW_FREQUENCY);
+    CHECK_OK(ir_library_read_raw(IR_STORAGE_BASE_PATH "/ac.ir", "ac", got, IR_LIBRARY_MAX_TIMINGS, &num_got));
+    CHECK_EQ(num_got, num_sent);
+    CHECK(memcmp(got, sent, num_sent * sizeof(uint32_t)) == 0);
+    CHECK_OK(ir_capture_stop());
+}
+
+// Acima de IR_CAPTURE_MAX_SYMBOLS a captura sai cortada e marcada, e a
+// seguinte volta ao normal
+static void test_truncated(void) {
+    host_test_section("captura truncada");
+    static signal_t s;
+    static uint32_t timings[4 * IR_CAPTURE_MAX_SYMBOLS];
+    size_t n;
+    long_frame(&s, IR_CAPTURE_MAX_SYMBOLS / 8 + 8, timings, &n);
+
+    CHECK_OK(ir_capture_start(NULL));
+    play_async(&s, 0);
+    play_join();
+    ir_capture_t capture;
+    CHECK_OK(ir_capture_wait(&capture, 100));
+    CHECK(capture.truncated);
+    CHECK_EQ(capture.num_symbols, IR_CAPTURE_MAX_SYMBOLS);
+    ir_capture_release(&capture);
+
+    long_frame(&s, 4, timings, &n);
+    play_async(&s, 0);
+    play_join();
+    CHECK_OK(ir_capture_wait(&capture, 100));
+    CHECK(!capture.truncated);
+    CHECK_EQ(capture.seq, 1);
+    ir_capture_release(&capture);
+    CHECK_OK(ir_capture_stop());
+}
+
+// Limiar acima do silêncio entre quadros: a sequência vira uma captura, e
+// o decoder marca as repetições
+static void test_idle(void) {
+    host_test_section("silêncio configurável");
+    static signal_t s;
+    ir_tx_code_t code = { .protocol = IR_PROTOCOL_SIRC, .address = 0x01, .command = 0x15, .bits = 12 };
+    from_tx(&s, &code, 3);
+
+    ir_capture_config_t config = { .idle_us = 30000 };
+    CHECK_OK(ir_capture_start(&config));
+    play_async(&s, 0);
+    play_join();
+
+    ir_capture_t capture;
+    ir_decode_result_t r[8];
+    CHECK_OK(ir_capture_wait(&capture, 100));
+    size_t n = ir_decode(capture.symbols, capture.num_symbols, r, 8);
+    CHECK_EQ(n, s.frames);
+    for (size_t i = 0; i < n; i++) {
+        CHECK(same_code(&r[i], &code));
+        CHECK_EQ(r[i].repeat, i > 0);
+    }
+    ir_capture_release(&capture);
+    CHECK_EQ(ir_capture_wait(&capture, 10), ESP_ERR_TIMEOUT);
+    CHECK_OK(ir_capture_stop());
+}
+
+int main(void) {
+    CHECK_OK(ir_tx_service_start());
+    test_state();
+    test_back_to_back();
+    test_slow_consumer();
+    test_long_frame();
+    test_truncated();
+    test_idle();
+    CHECK_OK(ir_tx_service_stop());
+
+    // Nenhuma borda chegou com a recepção desarmada, e nada ficou aberto
+    fake_rmt_counters_t c;
+    fake_rmt_get_counters(&c);
+    CHECK_EQ(c.rx_missed, 0);
+    CHECK_EQ(c.channels, 0);
+    CHECK_EQ(c.misuse, 0);
+    return host_test_finish("test_ir_capture");
+}
@@ -0,0 +1,125 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// ir_decode contra o corpus de regressão (corpus/ir_decode.txt, ver
+// ir_corpus.h): cada captura tem que dar exatamente os quadros registrados,
+// com protocolo, endereço, comando, toggle, bits e repetição, e as capturas
+// de ruído e de quadros truncados não podem dar nenhum.
+//
+// Para regravar o corpus (só quando o formato das capturas mudar; mudar o
+// corpus junto com o decoder esconde regressões):
+//   test_ir_decode --generate test/host/ir/corpus/ir_decode.txt
+
+#include <string.h>
+#include "ir_decoder.h"
+#include "ir_tx.h"
+#include "ir_corpus.h"
+#include "host_test.h"
+
+static ir_corpus_t corpus;
+
+static bool check_capture(const ir_corpus_capture_t *c, size_t max_results) {
+    ir_decode_result_t got[IR_CORPUS_MAX_FRAMES * 2];
+    size_t want = c->num_frames < max_results ? c->num_frames : max_results;
+    size_t n = ir_decode(c->symbols, c->num_symbols, got, max_results);
+    if (n != want) {
+        printf("linha %d: %zu quadros, esperado %zu\n", c->line, n, want);
+        return false;
+    }
+    for (size_t i = 0; i < n; i++) {
+        char why[160];
+        if (!ir_corpus_same_frame(&got[i], &c->frames[i], why, sizeof(why))) {
+            printf("linha %d, quadro %zu: %s\n", c->line, i, why);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void test_corpus(void) {
+    host_test_section("corpus");
+    CHECK(ir_corpus_load(IR_CORPUS_PATH, &corpus));
+
+    int frames[IR_PROTOCOL_COUNT] = { 0 };
+    int repeats = 0, empty = 0, whole = 0, active_high = 0, bad = 0;
+    for (size_t i = 0; i < corpus.count; i++) {
+        const ir_corpus_capture_t *c = &corpus.captures[i];
+        bad += !check_capture(c, IR_CORPUS_MAX_FRAMES * 2);
+        empty += c->num_frames == 0;
+        whole += c->idle_us == 0;
+        active_high += c->mark_level == 1;
+        for (size_t k = 0; k < c->num_frames; k++) {
+            frames[c->frames[k].protocol]++;
+            repeats += c->frames[k].repeat;
+        }
+    }
+
+    printf("%zu capturas, %zu símbolos, %zu quadros (%d repetições), %d sem quadro\n",
+           corpus.count, corpus.symbols, corpus.frames, repeats, empty);
+    for (int p = 0; p < IR_PROTOCOL_COUNT; p++) {
+        printf("  %-10s %d quadros\n", ir_protocol_to_string(p), frames[p]);
+    }
+    CHECK_EQ(bad, 0);
+
+    // Um corpus regravado errado não pode passar por falta de casos
+    for (int p = 0; p < IR_PROTOCOL_COUNT; p++) CHECK(frames[p] >= 16);
+    CHECK(repeats > 0);
+    CHECK(empty > 0);
+    CHECK(whole > 0);
+    CHECK(active_high > 0 && active_high < (int)corpus.count);
+}
+
+// Com menos espaço que quadros, os primeiros saem iguais
+static void test_max_results(void) {
+    host_test_section("limite de resultados");
+    int checked = 0, bad = 0;
+    for (size_t i = 0; i < corpus.count; i++) {
+        const ir_corpus_capture_t *c = &corpus.captures[i];
+        if (c->num_frames < 2) continue;
+        bad += !check_capture(c, 1);
+        bad += !check_capture(c, c->num_frames - 1);
+        checked++;
+    }
+    CHECK(checked > 0);
+    CHECK_EQ(bad, 0);
+}
+
+static void test_invalid(void) {
+    host_test_section("argumentos");
+    ir_decode_result_t r;
+    const ir_corpus_capture_t *c = &corpus.captures[0];
+    CHECK_EQ(ir_decode(NULL, 10, &r, 1), 0);
+    CHECK_EQ(ir_decode(c->symbols, 0, &r, 1), 0);
+    CHECK_EQ(ir_decode(c->symbols, c->num_symbols, NULL, 1), 0);
+    CHECK_EQ(ir_decode(c->symbols, c->num_symbols, &r, 0), 0);
+}
+
+int main(int argc, char **argv) {
+    if (argc == 3 && strcmp(argv[1], "--generate") == 0) {
+        CHECK_OK(ir_tx_service_start());
+        CHECK(ir_corpus_generate(argv[2], IR_CORPUS_SEED));
+        CHECK_OK(ir_tx_service_stop());
+        return host_test_finish("test_ir_decode --generate");
+    }
+
+    test_corpus();
+    if (corpus.count > 0) {
+        test_max_results();
+        test_invalid();
+    }
+    ir_corpus_free(&corpus);
+    return host_test_finish("test_ir_decode");
+}
@@ -0,0 +1,532 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Bibliotecas .ir com vários sinais no formato do Flipper (ir_library.c).
+// A referência é um arquivo como o Flipper grava, com os protocolos que ele
+// usa e um sinal raw; lido sinal a sinal e regravado com ir_library_append,
+// tem que sair idêntico, byte a byte. Delete, rename e compactação são
+// conferidos contra o arquivo esperado inteiro, não só pelo que o índice
+// devolve.
+
+#include <stdlib.h>
+#include <sys/stat.h>
+#include "ir_library.h"
+#include "ir_storage.h"
+#include "ir_tx.h"
+#include "fake_fs.h"
+#include "host_test.h"
+
+#define LIB         IR_STORAGE_BASE_PATH "/tv.ir"
+#define COPY        IR_STORAGE_BASE_PATH "/copy.ir"
+#define EXPECTED    IR_STORAGE_BASE_PATH "/expected.ir"
+#define CRLF_LIB    IR_STORAGE_BASE_PATH "/crlf.ir"
+#define BIG_LIB     IR_STORAGE_BASE_PATH "/big.ir"
+#define BIG_COUNT   400
+#define RAW_COUNT   300
+#define HEADER      "Filetype: IR signals file\nVersion: 1\n"
+
+// ========== REFERÊNCIA ==========
+
+enum { POWER, VOL_UP, MUTE, CH_NEXT, INPUT, EJECT, AC_ON, MENU, NUM_SIGNALS };
+
+static const char *PARSED[NUM_SIGNALS] = {
+    [POWER]   = "# \nname: Power\ntype: parsed\nprotocol: NEC\naddress: 07 00 00 00\ncommand: 02 00 00 00\n",
+    [VOL_UP]  = "# \nname: Vol_up\ntype: parsed\nprotocol: NECext\naddress: 00 7F 00 00\ncommand: 15 EA 00 00\n",
+    [MUTE]    = "# \nname: Mute\ntype: parsed\nprotocol: Samsung32\naddress: 07 00 00 00\ncommand: 0F 00 00 00\n",
+    [CH_NEXT] = "# \nname: Ch_next\ntype: parsed\nprotocol: RC5\naddress: 00 00 00 00\ncommand: 20 00 00 00\n",
+    [INPUT]   = "# \nname: Input\ntype: parsed\nprotocol: SIRC15\naddress: 1A 00 00 00\ncommand: 25 00 00 00\n",
+    [EJECT]   = "# \nname: Eject\ntype: parsed\nprotocol: Kaseikyo\naddress: 41 54 32 00\ncommand: 1B 00 00 00\n",
+    [MENU]    = "# \nname: Menu\ntype: parsed\nprotocol: RC6\naddress: 00 00 00 00\ncommand: 54 00 00 00\n",
+};
+
+static uint32_t raw_timings[RAW_COUNT];
+static char raw_block[8192];
+
+// Sinal raw de ar-condicionado: líder e bits de tamanho fixo pseudoaleatórios
+static void build_raw(void) {
+    uint32_t x = 0x1D5EED;
+    int n = snprintf(raw_block, sizeof(raw_block),
+                     "# \nname: AC_on\ntype: raw\nfrequency: 38000\nduty_cycle: 0.330000\ndata:");
+    for (int i = 0; i < RAW_COUNT; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+        if (i < 2) raw_timings[i] = i == 0 ? 3500 : 1700;
+        else raw_timings[i] = (i % 2 == 0 || (x & 1) == 0) ? 430 : 1300;
+        n += snprintf(raw_block + n, sizeof(raw_block) - n, " %lu", (unsigned long)raw_timings[i]);
+    }
+    snprintf(raw_block + n, sizeof(raw_block) - n, "\n");
+}
+
+static const char *block(int i) {
+    return i == AC_ON ? raw_block : PARSED[i];
+}
+
+// Arquivo com os sinais em `order`; `renames` troca nomes (pares de/para)
+static char *build_library(const int *order, int count, const char *const *renames, int num_renames) {
+    size_t size = sizeof(HEADER);
+    for (int k = 0; k < count; k++) size += strlen(block(order[k])) + 32;
+    char *out = malloc(size);
+    strcpy(out, HEADER);
+    for (int k = 0; k < count; k++) {
+        const char *b = block(order[k]);
+        for (int r = 0; r < num_renames; r++) {
+            char from[48];
+            snprintf(from, sizeof(from), "name: %s\n", renames[2 * r]);
+            const char *at = strstr(b, from);
+            if (at == NULL) continue;
+            strncat(out, b, at - b);
+            strcat(out, "name: ");
+            strcat(out, renames[2 * r + 1]);
+            strcat(out, "\n");
+            b = at + strlen(from);
+        }
+        strcat(out, b);
+    }
+    return out;
+}
+
+// ========== ARQUIVOS ==========
+
+static char *read_file(const char *path, size_t *len) {
+    char host[512];
+    *len = 0;
+    if (!fake_fs_host_path(path, host, sizeof(host))) return NULL;
+    FILE *f = fopen(host, "rb");
+    if (f == NULL) return NULL;
+    fseek(f, 0, SEEK_END);
+    long size = ftell(f);
+    fseek(f, 0, SEEK_SET);
+    char *data = malloc(size + 1);
+    *len = fread(data, 1, size, f);
+    data[*len] = '\0';
+    fclose(f);
+    return data;
+}
+
+static void write_file(const char *path, const char *text) {
+    char host[512];
+    CHECK(fake_fs_host_path(path, host, sizeof(host)));
+    FILE *f = fopen(host, "wb");
+    CHECK(f != NULL);
+    if (f == NULL) return;
+    fputs(text, f);
+    fclose(f);
+}
+
+static size_t file_size(const char *path) {
+    size_t len;
+    free(read_file(path, &len));
+    return len;
+}
+
+static bool same_text(const char *path, const char *expected, const char *what) {
+    size_t len, want = strlen(expected);
+    char *data = read_file(path, &len);
+    bool same = data != NULL && len == want && memcmp(data, expected, len) == 0;
+    if (!same && data != NULL) {
+        size_t i = 0;
+        while (i < len && i < want && data[i] == expected[i]) i++;
+        size_t from = i > 20 ? i - 20 : 0;
+        printf("%s: difere no byte %zu (%zu/%zu bytes): \"%.40s\" esperado \"%.40s\"\n",
+               what, i, len, want, data + from, expected + from);
+    }
+    free(data);
+    return same;
+}
+
+static void remove_file(const char *path) {
+    char host[512];
+    if (fake_fs_host_path(path, host, sizeof(host))) remove(host);
+}
+
+// ========== TESTES ==========
+
+static void test_read(void) {
+    host_test_section("leitura");
+    static const int all[] = { POWER, VOL_UP, MUTE, CH_NEXT, INPUT, EJECT, AC_ON, MENU };
+    char *ref = build_library(all, NUM_SIGNALS, NULL, 0);
+    write_file(LIB, ref);
+    free(ref);
+
+    size_t count = 0;
+    CHECK_OK(ir_library_count(LIB, &count));
+    CHECK_EQ(count, NUM_SIGNALS);
+
+    // Endereço e comando do Flipper são bytes little-endian; NEC e Samsung32
+    // viram os 16 bits do encoder, com o inverso
+    ir_signal_t s;
+    CHECK_OK(ir_library_find(LIB, "Power", &s));
+    CHECK_EQ(s.type, IR_SIGNAL_PARSED);
+    CHECK_STR(s.code.protocol, "NEC");
+    CHECK_EQ(s.code.address, 0xF807);
+    CHECK_EQ(s.code.command, 0xFD02);
+    CHECK_OK(ir_library_find(LIB, "Vol_up", &s));
+    CHECK_EQ(s.code.address, 0x7F00);
+    CHECK_EQ(s.code.command, 0xEA15);
+    CHECK_OK(ir_library_find(LIB, "Mute", &s));
+    CHECK_EQ(s.code.address, 0xF00F);
+    CHECK_EQ(s.code.command, 0x0707);
+    CHECK_OK(ir_library_find(LIB, "Eject", &s));
+    CHECK_EQ(s.code.address, 0x00325441);
+    CHECK_OK(ir_library_find(LIB, "AC_on", &s));
+    CHECK_EQ(s.type, IR_SIGNAL_RAW);
+    CHECK_EQ(s.num_timings, RAW_COUNT);
+    CHECK_EQ(s.frequency, 38000);
+    CHECK(s.duty_cycle > 0.329f && s.duty_cycle < 0.331f);
+    CHECK_EQ(ir_library_find(LIB, "Nope", &s), ESP_ERR_NOT_FOUND);
+
+    static uint32_t timings[IR_LIBRARY_MAX_TIMINGS];
+    size_t n = 0;
+    CHECK_OK(ir_library_read_raw(LIB, "AC_on", timings, IR_LIBRARY_MAX_TIMINGS, &n));
+    CHECK_EQ(n, RAW_COUNT);
+    CHECK(memcmp(timings, raw_timings, sizeof(raw_timings)) == 0);
+    CHECK_EQ(ir_library_read_raw(LIB, "AC_on", timings, 100, &n), ESP_ERR_INVALID_SIZE);
+    CHECK_EQ(ir_library_read_raw(LIB, "Power", timings, 100, &n), ESP_ERR_INVALID_ARG);
+
+    // Nomes de protocolo do Flipper no TX
+    ir_tx_code_t code;
+    CHECK_OK(ir_library_find(LIB, "Vol_up", &s));
+    CHECK_OK(ir_tx_code_from_file(&s.code, &code));
+    CHECK_EQ(code.protocol, IR_PROTOCOL_NEC);
+    CHECK_EQ(code.address, 0x7F00);
+    CHECK_OK(ir_library_find(LIB, "Input", &s));
+    CHECK_OK(ir_tx_code_from_file(&s.code, &code));
+    CHECK_EQ(code.protocol, IR_PROTOCOL_SIRC);
+    CHECK_EQ(code.bits, 15);
+    CHECK_EQ(code.address, 0x1A);
+    CHECK_EQ(code.command, 0x25);
+    CHECK_OK(ir_library_find(LIB, "Eject", &s));
+    CHECK_EQ(ir_tx_code_from_file(&s.code, &code), ESP_ERR_NOT_SUPPORTED);
+}
+
+// Cursor: os sinais do índice, na mesma ordem, lendo o arquivo uma vez
+static void test_cursor(void) {
+    host_test_section("cursor");
+    static uint32_t timings[IR_LIBRARY_MAX_TIMINGS];
+    static ir_signal_t walked[NUM_SIGNALS + 1];
+    ir_library_cursor_t *cur;
+    ir_signal_t s;
+    size_t count = 0, n = 0;
+    esp_err_t ret;
+
+    ir_library_invalidate(LIB);
+    ir_library_stats_t before, after;
+    ir_library_get_stats(&before);
+    CHECK_OK(ir_library_cursor_open(LIB, &cur));
+    while ((ret = ir_library_cursor_next(cur, &s, timings, IR_LIBRARY_MAX_TIMINGS)) == ESP_OK) {
+        if (n < NUM_SIGNALS + 1) walked[n] = s;
+        if (s.type == IR_SIGNAL_RAW) {
+            CHECK_EQ(s.num_timings, RAW_COUNT);
+            CHECK(memcmp(timings, raw_timings, sizeof(raw_timings)) == 0);
+        }
+        n++;
+    }
+    CHECK_EQ(ret, ESP_ERR_NOT_FOUND);
+    CHECK_EQ(ir_library_cursor_next(cur, &s, timings, IR_LIBRARY_MAX_TIMINGS), ESP_ERR_NOT_FOUND);
+    ir_library_cursor_close(cur);
+    ir_library_get_stats(&after);
+    CHECK_EQ(after.builds, before.builds);
+    CHECK_EQ(after.hits, before.hits);
+
+    CHECK_OK(ir_library_count(LIB, &count));
+    CHECK_EQ(n, count);
+    for (size_t i = 0; i < n && i < count && i < NUM_SIGNALS; i++) {
+        CHECK_OK(ir_library_get(LIB, i, &s));
+        CHECK(memcmp(&walked[i], &s, sizeof(ir_signal_t)) == 0);
+    }
+
+    // Raw que não cabe: o sinal vem com o erro e o cursor segue
+    CHECK_OK(ir_library_cursor_open(LIB, &cur));
+    n = 0;
+    int too_big = 0;
+    while ((ret = ir_library_cursor_next(cur, &s, timings, 100)) != ESP_ERR_NOT_FOUND) {
+        if (ret == ESP_ERR_INVALID_SIZE) {
+            CHECK_STR(s.name, "AC_on");
+            too_big++;
+        } else {
+            CHECK_OK(ret);
+        }
+        n++;
+    }
+    ir_library_cursor_close(cur);
+    CHECK_EQ(too_big, 1);
+    CHECK_EQ(n, count);
+
+    // Sem buffer de tempos: só a contagem
+    CHECK_OK(ir_library_cursor_open(LIB, &cur));
+    while (ir_library_cursor_next(cur, &s, NULL, 0) == ESP_OK) {
+        if (s.type == IR_SIGNAL_RAW) CHECK_EQ(s.num_timings, RAW_COUNT);
+    }
+    ir_library_cursor_close(cur);
+
+    // Linhas em branco, comentários, CRLF e um bloco incompleto, como no índice
+    write_file(COPY,
+               "\nFiletype: IR library file\r\nVersion: 1\r\n"
+               "# comentário\r\nname: Half\r\ntype: parsed\r\n"
+               "# \r\nname: A\r\ntype: parsed\r\nprotocol: NEC\r\n\r\naddress: 04 00 00 00\r\ncommand: 08 00 00 00\r\n"
+               "#\r\nname: B\r\ntype: raw\r\nfrequency: 36000\r\nduty_cycle: 0.5\r\ndata: 900 450 900\r\ndata: 450\r\n");
+    CHECK_OK(ir_library_cursor_open(COPY, &cur));
+    CHECK_OK(ir_library_cursor_next(cur, &s, timings, IR_LIBRARY_MAX_TIMINGS));
+    CHECK_STR(s.name, "A");
+    CHECK_EQ(s.code.address, 0xFB04);
+    CHECK_EQ(s.code.command, 0xF708);
+    CHECK_OK(ir_library_cursor_next(cur, &s, timings, IR_LIBRARY_MAX_TIMINGS));
+    CHECK_STR(s.name, "B");
+    CHECK_EQ(s.frequency, 36000);
+    CHECK_EQ(s.num_timings, 4);
+    CHECK(timings[0] == 900 && timings[1] == 450 && timings[2] == 900 && timings[3] == 450);
+    CHECK_EQ(ir_library_cursor_next(cur, &s, timings, IR_LIBRARY_MAX_TIMINGS), ESP_ERR_NOT_FOUND);
+    ir_library_cursor_close(cur);
+    remove_file(COPY);
+
+    write_file(IR_STORAGE_BASE_PATH "/junk.ir", "hello\nname: x\n");
+    CHECK_EQ(ir_library_cursor_open(IR_STORAGE_BASE_PATH "/junk.ir", &cur), ESP_ERR_INVALID_RESPONSE);
+    CHECK_EQ(ir_library_cursor_open(IR_STORAGE_BASE_PATH "/none.ir", &cur), ESP_ERR_NOT_FOUND);
+}
+
+static void test_round_trip(void) {
+    host_test_section("ida e volta");
+    static uint32_t timings[IR_LIBRARY_MAX_TIMINGS];
+    ir_signal_t s;
+    size_t count = 0, n = 0;
+
+    remove_file(COPY);
+    CHECK_OK(ir_library_count(LIB, &count));
+    for (size_t i = 0; i < count; i++) {
+        CHECK_OK(ir_library_get(LIB, i, &s));
+        if (s.type == IR_SIGNAL_RAW) CHECK_OK(ir_library_read_raw(LIB, s.name, timings, IR_LIBRARY_MAX_TIMINGS, &n));
+        CHECK_OK(ir_library_append(COPY, &s, s.type == IR_SIGNAL_RAW ? timings : NULL));
+    }
+    size_t ref_len;
+    char *ref = read_file(LIB, &ref_len);
+    CHECK(ref != NULL && same_text(COPY, ref, "regravado"));
+    free(ref);
+    CHECK_EQ(ir_library_append(COPY, &s, NULL), ESP_ERR_INVALID_STATE);     // Nome repetido
+
+    // Índice montado uma vez; consultas não releem o arquivo
+    ir_library_stats_t before, after;
+    ir_library_get_stats(&before);
+    for (int k = 0; k < 1000; k++) CHECK_OK(ir_library_find(LIB, "Menu", &s));
+    ir_library_get_stats(&after);
+    CHECK_EQ(after.builds, before.builds);
+    CHECK_EQ(after.hits - before.hits, 1000);
+}
+
+static void test_edit(void) {
+    host_test_section("edição");
+    static uint32_t timings[IR_LIBRARY_MAX_TIMINGS];
+    ir_signal_t s;
+    size_t count = 0, n = 0;
+    size_t size = file_size(LIB);
+
+    // Delete no meio: o bloco vira comentário do mesmo tamanho
+    CHECK_OK(ir_library_delete(LIB, "Mute"));
+    CHECK_EQ(file_size(LIB), size);
+    CHECK_EQ(ir_library_find(LIB, "Mute", &s), ESP_ERR_NOT_FOUND);
+    CHECK_OK(ir_library_count(LIB, &count));
+    CHECK_EQ(count, NUM_SIGNALS - 1);
+    CHECK_OK(ir_library_read_raw(LIB, "AC_on", timings, IR_LIBRARY_MAX_TIMINGS, &n));
+    CHECK_EQ(n, RAW_COUNT);
+    CHECK(memcmp(timings, raw_timings, sizeof(raw_timings)) == 0);
+    ir_library_invalidate(LIB);
+    CHECK_OK(ir_library_count(LIB, &count));
+    CHECK_EQ(count, NUM_SIGNALS - 1);
+    CHECK_OK(ir_library_find(LIB, "Menu", &s));
+    CHECK_EQ(s.code.command, 0x54);
+
+    // Delete do último: o arquivo encolhe exatamente o bloco
+    CHECK_OK(ir_library_delete(LIB, "Menu"));
+    size -= strlen(PARSED[MENU]);
+    CHECK_EQ(file_size(LIB), size);
+
+    // Rename do mesmo tamanho: no lugar
+    CHECK_OK(ir_library_rename(LIB, "Input", "Sourc"));
+    CHECK_EQ(file_size(LIB), size);
+    CHECK_OK(ir_library_find(LIB, "Sourc", &s));
+    CHECK_EQ(s.code.command, 0x25);
+    CHECK_EQ(ir_library_find(LIB, "Input", &s), ESP_ERR_NOT_FOUND);
+
+    // Rename de outro tamanho: o sinal vai para o fim
+    CHECK_OK(ir_library_count(LIB, &count));
+    CHECK_OK(ir_library_rename(LIB, "Power", "Power_toggle"));
+    CHECK_OK(ir_library_get(LIB, count - 1, &s));
+    CHECK_STR(s.name, "Power_toggle");
+    CHECK_EQ(s.code.address, 0xF807);
+    CHECK_EQ(ir_library_rename(LIB, "Vol_up", "AC_on"), ESP_ERR_INVALID_STATE);
+    CHECK_EQ(ir_library_rename(LIB, "Nope", "X"), ESP_ERR_NOT_FOUND);
+
+    // O índice mantido em RAM é o mesmo que sai de reler o arquivo
+    static ir_signal_t kept[NUM_SIGNALS], parsed[NUM_SIGNALS];
+    size_t num_kept = 0, num_parsed = 0;
+    CHECK_OK(ir_library_count(LIB, &num_kept));
+    for (size_t i = 0; i < num_kept && i < NUM_SIGNALS; i++) CHECK_OK(ir_library_get(LIB, i, &kept[i]));
+    ir_library_invalidate(LIB);
+    CHECK_OK(ir_library_count(LIB, &num_parsed));
+    CHECK_EQ(num_parsed, num_kept);
+    for (size_t i = 0; i < num_parsed && i < NUM_SIGNALS; i++) {
+        CHECK_OK(ir_library_get(LIB, i, &parsed[i]));
+        CHECK(memcmp(&kept[i], &parsed[i], sizeof(ir_signal_t)) == 0);
+    }
+
+    // Compactado, é o arquivo que o Flipper gravaria com a ordem e os nomes finais
+    CHECK_OK(ir_library_compact(LIB));
+    static const int order[] = { VOL_UP, CH_NEXT, INPUT, EJECT, AC_ON, POWER };
+    static const char *const renames[] = { "Input", "Sourc", "Power", "Power_toggle" };
+    char *expected = build_library(order, 6, renames, 2);
+    CHECK(same_text(LIB, expected, "compactado"));
+    free(expected);
+    CHECK_OK(ir_library_count(LIB, &count));
+    CHECK_EQ(count, 6);
+    CHECK_OK(ir_library_read_raw(LIB, "AC_on", timings, IR_LIBRARY_MAX_TIMINGS, &n));
+    CHECK(memcmp(timings, raw_timings, sizeof(raw_timings)) == 0);
+}
+
+static void test_append(void) {
+    host_test_section("append");
+    ir_signal_t s;
+
+    // NEC sem o inverso só existe no Flipper como NECext
+    ir_signal_t odd = {
+        .name = "Odd", .type = IR_SIGNAL_PARSED,
+        .code = { .protocol = "NEC", .address = 0x1234, .command = 0xFD02, .toggle = 0xFF, .bits = 0xFF },
+    };
+    CHECK_OK(ir_library_append(LIB, &odd, NULL));
+    CHECK_OK(ir_library_find(LIB, "Odd", &s));
+    CHECK_STR(s.code.protocol, "NECext");
+    CHECK_EQ(s.code.address, 0x1234);
+    CHECK_EQ(s.code.command, 0xFD02);
+
+    // Samsung32 sem o endereço repetido não tem representação
+    ir_signal_t bad = {
+        .name = "Bad", .type = IR_SIGNAL_PARSED,
+        .code = { .protocol = "Samsung32", .address = 0x1234, .command = 0x0707, .toggle = 0xFF, .bits = 0xFF },
+    };
+    CHECK_EQ(ir_library_append(LIB, &bad, NULL), ESP_ERR_NOT_SUPPORTED);
+
+    ir_signal_t sam = {
+        .name = "SamOk", .type = IR_SIGNAL_PARSED,
+        .code = { .protocol = "Samsung32", .address = 0xF00F, .command = 0x0707, .toggle = 0xFF, .bits = 0xFF },
+    };
+    size_t size = file_size(LIB);
+    CHECK_OK(ir_library_append(LIB, &sam, NULL));
+    size_t len;
+    char *data = read_file(LIB, &len);
+    static const char sam_block[] =
+        "# \nname: SamOk\ntype: parsed\nprotocol: Samsung32\naddress: 07 00 00 00\ncommand: 0F 00 00 00\n";
+    CHECK_EQ(len, size + strlen(sam_block));
+    CHECK(data != NULL && len >= size && strcmp(data + size, sam_block) == 0);
+    free(data);
+    ir_library_invalidate(LIB);
+    CHECK_OK(ir_library_find(LIB, "SamOk", &s));
+    CHECK_EQ(s.code.address, 0xF00F);
+    CHECK_EQ(s.code.command, 0x0707);
+
+    // Arquivo trocado por fora: o índice é refeito
+    ir_library_stats_t before, after;
+    ir_library_get_stats(&before);
+    write_file(LIB, HEADER "# \nname: Only\ntype: parsed\nprotocol: RC6\naddress: 01 00 00 00\ncommand: 02 00 00 00\n");
+    size_t count = 0;
+    CHECK_OK(ir_library_count(LIB, &count));
+    CHECK_EQ(count, 1);
+    ir_library_get_stats(&after);
+    CHECK_EQ(after.rebuilds, before.rebuilds + 1);
+}
+
+static void test_other_files(void) {
+    host_test_section("outros arquivos");
+    ir_code_t code;
+
+    // Gravados pelo ir_storage antigo
+    CHECK(ir_save_full("NEC", 0xFD02, 0xF807, 0xFF, 0xFF, "legacy"));
+    CHECK(ir_load("legacy", &code));
+    CHECK_STR(code.protocol, "NEC");
+    CHECK_EQ(code.address, 0xF807);
+    CHECK_EQ(code.command, 0xFD02);
+    CHECK(ir_save_full("SIRC", 0x25, 0x1A, 0xFF, 15, "legacy"));
+    CHECK(ir_load("legacy", &code));
+    CHECK_STR(code.protocol, "SIRC");
+    CHECK_EQ(code.bits, 15);
+    CHECK_EQ(code.address, 0x1A);
+
+    // CRLF e cabeçalho "IR library file" continuam assim depois de compactar
+    write_file(CRLF_LIB,
+               "Filetype: IR library file\r\nVersion: 1\r\n"
+               "# \r\nname: A\r\ntype: parsed\r\nprotocol: RC5\r\naddress: 01 00 00 00\r\ncommand: 0C 00 00 00\r\n"
+               "# \r\nname: B\r\ntype: parsed\r\nprotocol: NEC\r\naddress: 04 00 00 00\r\ncommand: 08 00 00 00\r\n");
+    CHECK(ir_load_signal("crlf", "B", &code));
+    CHECK_EQ(code.address, 0xFB04);
+    CHECK_EQ(code.command, 0xF708);
+    CHECK_OK(ir_library_delete(CRLF_LIB, "A"));
+    CHECK_OK(ir_library_compact(CRLF_LIB));
+    CHECK(same_text(CRLF_LIB,
+                    "Filetype: IR library file\r\nVersion: 1\r\n"
+                    "# \r\nname: B\r\ntype: parsed\r\nprotocol: NEC\r\naddress: 04 00 00 00\r\ncommand: 08 00 00 00\r\n",
+                    "CRLF compactado"));
+
+    size_t count;
+    write_file(IR_STORAGE_BASE_PATH "/junk.ir", "hello\nname: x\n");
+    CHECK_EQ(ir_library_count(IR_STORAGE_BASE_PATH "/junk.ir", &count), ESP_ERR_INVALID_RESPONSE);
+    CHECK_EQ(ir_library_count(IR_STORAGE_BASE_PATH "/none.ir", &count), ESP_ERR_NOT_FOUND);
+}
+
+static void test_big(void) {
+    host_test_section("biblioteca grande");
+    remove_file(BIG_LIB);
+    for (int i = 0; i < BIG_COUNT; i++) {
+        ir_signal_t b = {
+            .type = IR_SIGNAL_PARSED,
+            .code = { .protocol = "RC6", .address = i & 0xFF, .command = (i * 7) & 0xFF, .toggle = 0xFF, .bits = 0xFF },
+        };
+        snprintf(b.name, sizeof(b.name), "Btn_%d", i);
+        CHECK_OK(ir_library_append(BIG_LIB, &b, NULL));
+    }
+
+    ir_library_invalidate(BIG_LIB);
+    ir_library_stats_t before, after;
+    ir_library_get_stats(&before);
+    int found = 0;
+    for (int k = 0; k < 20000; k++) {
+        char name[32];
+        ir_signal_t s;
+        int i = (k * 37) % BIG_COUNT;
+        snprintf(name, sizeof(name), "Btn_%d", i);
+        if (ir_library_find(BIG_LIB, name, &s) == ESP_OK && s.code.command == (uint32_t)((i * 7) & 0xFF)) found++;
+    }
+    ir_library_get_stats(&after);
+    CHECK_EQ(found, 20000);
+    CHECK_EQ(after.builds - before.builds, 1);
+    size_t count = 0;
+    CHECK_OK(ir_library_count(BIG_LIB, &count));
+    CHECK_EQ(count, BIG_COUNT);
+}
+
+int main(void) {
+    char dir[256];
+    fake_fs_set_root(host_test_tmpdir());
+    CHECK(fake_fs_host_path(IR_STORAGE_BASE_PATH, dir, sizeof(dir)));
+    mkdir(dir, 0755);
+    build_raw();
+
+    test_read();
+    test_cursor();
+    test_round_trip();
+    test_edit();
+    test_append();
+    test_other_files();
+    test_big();
+    return host_test_finish("test_ir_library");
+}
@@ -0,0 +1,499 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Serviço de TX de IR (ir_tx.c) sobre o RMT simulado. Para cada protocolo a
+// forma de onda que sai do RMT (quadros e silêncios, tick a tick) é
+// comparada com a montada aqui a partir da especificação do protocolo, e o
+// início de cada quadro com o período de repetição. Também confere que canal
+// e encoders são criados uma vez só, o toggle automático, quadros raw, a fila
+// assíncrona com o tempo no ar passando de verdade e o TX done perdido.
+
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include "ir_tx.h"
+#include "ir_common.h"
+#include "ir_storage.h"
+#include "fake_rmt.h"
+#include "fake_fs.h"
+#include "host_test.h"
+
+#define WAVE_MAX        4096
+
+static const uint32_t PERIOD_US[IR_PROTOCOL_COUNT] = {
+    [IR_PROTOCOL_NEC]       = 108000,
+    [IR_PROTOCOL_RC6]       = 240 * 444,
+    [IR_PROTOCOL_RC5]       = 128 * 889,
+    [IR_PROTOCOL_SAMSUNG32] = 108000,
+    [IR_PROTOCOL_SIRC]      = 45000,
+};
+
+static const uint32_t CARRIER_HZ[IR_PROTOCOL_COUNT] = {
+    [IR_PROTOCOL_NEC]       = 38000,
+    [IR_PROTOCOL_RC6]       = 36000,
+    [IR_PROTOCOL_RC5]       = 36000,
+    [IR_PROTOCOL_SAMSUNG32] = 38000,
+    [IR_PROTOCOL_SIRC]      = 40000,
+};
+
+// ========== FORMA DE ONDA ==========
+
+// Trechos de nível constante; trechos vizinhos de mesmo nível se juntam
+typedef struct {
+    uint8_t level[WAVE_MAX];
+    uint32_t us[WAVE_MAX];
+    size_t count;
+    uint64_t total_us;
+} wave_t;
+
+static void add(wave_t *w, int level, uint32_t us) {
+    if (us == 0) return;
+    w->total_us += us;
+    if (w->count > 0 && w->level[w->count - 1] == level) {
+        w->us[w->count - 1] += us;
+    } else if (w->count < WAVE_MAX) {
+        w->level[w->count] = level;
+        w->us[w->count++] = us;
+    }
+}
+
+static void pad_to(wave_t *w, uint64_t until_us) {
+    if (until_us > w->total_us) add(w, 0, until_us - w->total_us);
+}
+
+// Manchester: `first` é o nível da primeira metade de um bit 1
+static void manchester(wave_t *w, bool one, int first, uint32_t half_us) {
+    int level = one ? first : !first;
+    add(w, level, half_us);
+    add(w, !level, half_us);
+}
+
+// Um quadro, como descrito pelo protocolo (1 tick = 1 us)
+static void spec_frame(wave_t *w, const ir_tx_code_t *c) {
+    switch (c->protocol) {
+    case IR_PROTOCOL_NEC:
+        add(w, 1, 9000);
+        add(w, 0, 4500);
+        for (int i = 0; i < 32; i++) {
+            uint32_t word = i < 16 ? c->address : c->command;
+            bool one = (word >> (i % 16)) & 1;
+            add(w, 1, 560);
+            add(w, 0, one ? 1690 : 560);
+        }
+        add(w, 1, 560);
+        break;
+
+    case IR_PROTOCOL_SAMSUNG32: {
+        uint32_t data = ((c->address & 0xFFFF) << 16) | (c->command & 0xFFFF);
+        add(w, 1, 4500);
+        add(w, 0, 4500);
+        for (int i = 0; i < 32; i++) {
+            add(w, 1, 560);
+            add(w, 0, ((data >> i) & 1) ? 1690 : 560);
+        }
+        add(w, 1, 560);
+        break;
+    }
+
+    case IR_PROTOCOL_RC5: {
+        // Dois start bits, toggle, 5 de endereço e 6 de comando, MSB
+        // primeiro; bit 1 = espaço e marca
+        uint32_t frame = (0x3 << 12) | ((c->toggle & 1) << 11) |
+                         ((c->address & 0x1F) << 6) | (c->command & 0x3F);
+        for (int i = 13; i >= 0; i--) manchester(w, (frame >> i) & 1, 0, 889);
+        add(w, 0, 889);
+        break;
+    }
+
+    case IR_PROTOCOL_RC6: {
+        // Líder, start bit, modo 000, toggle (meio bit de 2T = 888 us), 8 de
+        // endereço e 8 de comando, MSB primeiro; bit 1 = marca e espaço
+        uint32_t frame = ((c->toggle & 1) << 16) | ((c->address & 0xFF) << 8) | (c->command & 0xFF);
+        add(w, 1, 2666);
+        add(w, 0, 889);
+        manchester(w, true, 1, 444);
+        for (int i = 19; i >= 0; i--) manchester(w, (frame >> i) & 1, 1, i == 16 ? 2 * 444 : 444);
+        add(w, 0, 444);
+        break;
+    }
+
+    case IR_PROTOCOL_SIRC: {
+        // Comando (7 bits) e endereço, LSB primeiro, pela largura da marca
+        int bits = c->bits == 0xFF ? 12 : c->bits;
+        uint32_t frame = (c->command & 0x7F) | (c->address << 7);
+        add(w, 1, 2400);
+        add(w, 0, 600);
+        for (int i = 0; i < bits; i++) {
+            add(w, 1, ((frame >> i) & 1) ? 1200 : 600);
+            add(w, 0, 600);
+        }
+        add(w, 0, 600);
+        break;
+    }
+
+    default:
+        break;
+    }
+}
+
+static int spec_frames(const ir_tx_code_t *c, int repeats) {
+    return (c->protocol == IR_PROTOCOL_SIRC && repeats < 2) ? 3 : repeats + 1;
+}
+
+// O envio inteiro: cada quadro começa um período depois do anterior, e o
+// silêncio que completa o período também segue o último
+static void spec_send(wave_t *w, const ir_tx_code_t *c, int repeats) {
+    memset(w, 0, sizeof(*w));
+    uint32_t period = PERIOD_US[c->protocol];
+    for (int f = 0; f < spec_frames(c, repeats); f++) {
+        if (f > 0 && c->protocol == IR_PROTOCOL_NEC) {
+            add(w, 1, 9000);            // Código de repetição
+            add(w, 0, 2250);
+            add(w, 1, 560);
+        } else {
+            spec_frame(w, c);
+        }
+        pad_to(w, (uint64_t)(f + 1) * period);
+    }
+}
+
+static void wave_add_symbols(wave_t *w, size_t first, size_t count) {
+    static rmt_symbol_word_t symbols[WAVE_MAX];
+    size_t n = fake_rmt_get_symbols(first, symbols, count < WAVE_MAX ? count : WAVE_MAX);
+    for (size_t i = 0; i < n; i++) {
+        add(w, symbols[i].level0, symbols[i].duration0);
+        add(w, symbols[i].level1, symbols[i].duration1);
+    }
+}
+
+// Tudo o que saiu do RMT desde o último fake_rmt_reset()
+static void rmt_wave(wave_t *w) {
+    memset(w, 0, sizeof(*w));
+    fake_rmt_trans_t t;
+    for (size_t i = 0; fake_rmt_get_trans(i, &t); i++) wave_add_symbols(w, t.first, t.count);
+}
+
+static bool same_wave(const wave_t *a, const wave_t *b, const char *what) {
+    if (a->count == b->count && a->total_us == b->total_us &&
+        memcmp(a->level, b->level, a->count) == 0 &&
+        memcmp(a->us, b->us, a->count * sizeof(uint32_t)) == 0) {
+        return true;
+    }
+    size_t i = 0;
+    while (i < a->count && i < b->count && a->level[i] == b->level[i] && a->us[i] == b->us[i]) i++;
+    printf("%s: difere no trecho %zu (%s %u us, esperado %s %u us), total %llu/%llu us\n",
+           what, i, i < a->count && a->level[i] ? "marca" : "espaço", i < a->count ? a->us[i] : 0,
+           i < b->count && b->level[i] ? "marca" : "espaço", i < b->count ? b->us[i] : 0,
+           (unsigned long long)a->total_us, (unsigned long long)b->total_us);
+    return false;
+}
+
+// ========== TESTES ==========
+
+static void test_state(void) {
+    host_test_section("estado");
+    ir_tx_code_t code = { .protocol = IR_PROTOCOL_NEC };
+    CHECK_EQ(ir_tx_send(&code, 0), ESP_ERR_INVALID_STATE);
+    CHECK_EQ(ir_tx_service_stop(), ESP_ERR_INVALID_STATE);
+    CHECK_OK(ir_tx_service_start());
+    CHECK_OK(ir_tx_service_start());
+    CHECK(ir_tx_service_is_running());
+
+    fake_rmt_counters_t c;
+    fake_rmt_get_counters(&c);
+    CHECK_EQ(c.channels, 1);
+}
+
+static bool check_send(const ir_tx_code_t *code, int repeats) {
+    static wave_t got, want;
+    char what[96];
+    snprintf(what, sizeof(what), "%s %X/%X x%d", ir_protocol_to_string(code->protocol),
+             code->address, code->command, repeats);
+
+    fake_rmt_reset();
+    if (ir_tx_send(code, repeats) != ESP_OK) {
+        printf("%s: falhou\n", what);
+        return false;
+    }
+    rmt_wave(&got);
+    spec_send(&want, code, repeats);
+    if (!same_wave(&got, &want, what)) return false;
+
+    // Transações: quadro e silêncio, cada quadro no início do seu período
+    int frames = spec_frames(code, repeats);
+    if (fake_rmt_trans_count() != (size_t)(2 * frames) ||
+        want.total_us != ir_tx_air_us(code, repeats)) {
+        printf("%s: %zu transações, tempo no ar %u us\n", what, fake_rmt_trans_count(),
+               ir_tx_air_us(code, repeats));
+        return false;
+    }
+    for (int f = 0; f < frames; f++) {
+        fake_rmt_trans_t frame, gap;
+        fake_rmt_get_trans(2 * f, &frame);
+        fake_rmt_get_trans(2 * f + 1, &gap);
+        if (frame.start_us != (int64_t)f * PERIOD_US[code->protocol] ||
+            frame.carrier_hz != CARRIER_HZ[code->protocol] ||
+            (f == 0 && frame.end_us - frame.start_us != ir_tx_frame_us(code)) ||
+            gap.end_us != (int64_t)(f + 1) * PERIOD_US[code->protocol]) {
+            printf("%s: quadro %d em %lld us, portadora %u Hz\n", what, f,
+                   (long long)frame.start_us, frame.carrier_hz);
+            return false;
+        }
+    }
+    return true;
+}
+
+static void test_exact_timing(void) {
+    host_test_section("tempos exatos");
+    static const uint32_t values[] = { 0, 1, 0x1F, 0x55, 0xAA, 0x7F, 0xFFFF, 0x1234, 0xBEEF, 0xFFFFFFFF };
+    static const uint8_t repeats[] = { 0, 1, 5, IR_TX_MAX_REPEATS };
+    static const uint8_t sirc_bits[] = { 12, 15, 20, 0xFF };
+    const int n = sizeof(values) / sizeof(values[0]);
+    int sends = 0, bad = 0;
+
+    for (int p = 0; p < IR_PROTOCOL_COUNT; p++) {
+        for (int i = 0; i < n; i++) {
+            ir_tx_code_t code = {
+                .protocol = p,
+                .address = values[i] & 0xFFFF,
+                .command = values[n - 1 - i] & 0xFFFF,
+                .toggle = i & 1,
+                .bits = 0xFF,
+            };
+            if (p == IR_PROTOCOL_SIRC) {
+                code.bits = sirc_bits[i % 4];
+                code.command &= 0x7F;
+                code.address &= code.bits == 20 ? 0x1FFF : code.bits == 15 ? 0xFF : 0x1F;
+            }
+            for (size_t r = 0; r < sizeof(repeats); r++) {
+                bad += !check_send(&code, repeats[r]);
+                sends++;
+            }
+        }
+    }
+    printf("%d envios conferidos tick a tick\n", sends);
+    CHECK_EQ(bad, 0);
+}
+
+// Canal e encoders criados uma vez; a portadora só é reaplicada quando muda
+static void test_pooling(void) {
+    host_test_section("canal e encoders reaproveitados");
+    fake_rmt_counters_t before, after;
+    fake_rmt_get_counters(&before);
+    ir_tx_code_t nec = { .protocol = IR_PROTOCOL_NEC, .address = 0x04, .command = 0x08 };
+    for (int i = 0; i < 50; i++) CHECK_OK(ir_tx_send(&nec, 0));
+    fake_rmt_get_counters(&after);
+    CHECK_EQ(after.channels_created, 1);
+    CHECK_EQ(after.encoders_created, before.encoders_created);
+    CHECK(after.carrier_changes - before.carrier_changes <= 1);
+    CHECK_EQ(after.misuse, 0);
+}
+
+static void test_toggle(void) {
+    host_test_section("toggle automático");
+    static wave_t got, want;
+    ir_tx_reset_rc5_toggle();
+    ir_tx_reset_rc6_toggle();
+    for (int p = IR_PROTOCOL_RC6; p <= IR_PROTOCOL_RC5; p++) {
+        for (int i = 0; i < 4; i++) {
+            ir_tx_code_t code = { .protocol = p, .address = 3, .command = 7, .toggle = IR_TX_TOGGLE_AUTO };
+            fake_rmt_reset();
+            CHECK_OK(ir_tx_send(&code, 2));
+            // Alterna a cada envio, igual em todas as repetições de um envio
+            code.toggle = i & 1;
+            rmt_wave(&got);
+            spec_send(&want, &code, 2);
+            CHECK(same_wave(&got, &want, ir_protocol_to_string(p)));
+        }
+    }
+}
+
+static void test_raw(void) {
+    host_test_section("raw");
+    static wave_t got, want;
+    // Tempos acima de 32767 ticks ocupam mais de um meio símbolo
+    uint32_t timings[] = { 3400, 1700, 420, 1300, 420, 40000, 420, 70000, 9000 };
+    size_t count = sizeof(timings) / sizeof(timings[0]);
+    rmt_symbol_word_t symbols[16];
+    size_t n = ir_tx_raw_encode(timings, count, symbols, 16);
+    CHECK(n > count / 2);
+
+    ir_tx_raw_t raw = {
+        .symbols = symbols,
+        .num_symbols = n,
+        .frequency = 38000,
+        .duty_cycle = 0.5f,
+        .gap_us = 30000,
+    };
+    fake_rmt_reset();
+    CHECK_OK(ir_tx_send_raw(&raw));
+    rmt_wave(&got);
+    memset(&want, 0, sizeof(want));
+    for (size_t i = 0; i < count; i++) add(&want, !(i & 1), timings[i]);
+    add(&want, 0, 30000);
+    CHECK(same_wave(&got, &want, "raw"));
+    CHECK_EQ(got.total_us, ir_tx_raw_air_us(&raw));
+
+    fake_rmt_trans_t t;
+    CHECK(fake_rmt_get_trans(0, &t));
+    CHECK_EQ(t.carrier_hz, 38000);
+    CHECK(t.duty_cycle == 0.5f);
+
+    uint32_t zero[] = { 500, 0, 500 };
+    CHECK_EQ(ir_tx_raw_encode(zero, 3, symbols, 16), 0);
+    CHECK_EQ(ir_tx_raw_encode(timings, count, symbols, 2), 0);
+    raw.frequency = 1000;
+    CHECK_EQ(ir_tx_send_raw(&raw), ESP_ERR_INVALID_ARG);
+}
+
+static void test_invalid(void) {
+    host_test_section("argumentos");
+    ir_tx_code_t code = { .protocol = IR_PROTOCOL_COUNT };
+    CHECK_EQ(ir_tx_send(&code, 0), ESP_ERR_NOT_SUPPORTED);
+    code.protocol = IR_PROTOCOL_RC5;
+    CHECK_EQ(ir_tx_send(&code, IR_TX_MAX_REPEATS + 1), ESP_ERR_INVALID_ARG);
+    code.toggle = 2;
+    CHECK_EQ(ir_tx_send(&code, 0), ESP_ERR_INVALID_ARG);
+    code = (ir_tx_code_t) { .protocol = IR_PROTOCOL_SIRC, .bits = 13 };
+    CHECK_EQ(ir_tx_send(&code, 0), ESP_ERR_INVALID_ARG);
+    CHECK_EQ(ir_tx_send(NULL, 0), ESP_ERR_INVALID_ARG);
+}
+
+// ========== FILA ==========
+
+static int done_order[16];
+static int done_count;
+
+static void on_done(esp_err_t result, void *arg) {
+    if (result == ESP_OK && done_count < 16) done_order[done_count++] = (int)(intptr_t)arg;
+}
+
+// Com o tempo no ar passando de verdade: os pedidos saem em ordem, e dentro
+// de um envio a linha não para (o próximo quadro já está na fila do RMT)
+static void test_queue(void) {
+    host_test_section("fila com tempo real");
+    fake_rmt_reset();
+    fake_rmt_set_realtime(1.0);
+    done_count = 0;
+
+    int64_t t0 = host_test_now_us();
+    for (int i = 0; i < 6; i++) {
+        ir_tx_code_t code = { .protocol = IR_PROTOCOL_SIRC, .address = 1, .command = i, .bits = 12 };
+        CHECK_OK(ir_tx_post_notify(&code, 0, 1000, on_done, (void *)(intptr_t)i));
+    }
+    int64_t post_us = host_test_now_us() - t0;
+    ir_tx_code_t last = { .protocol = IR_PROTOCOL_NEC, .command = 9 };
+    CHECK_OK(ir_tx_send(&last, 2));
+    int64_t total_us = host_test_now_us() - t0;
+    fake_rmt_set_realtime(0);
+
+    CHECK_EQ(done_count, 6);
+    for (int i = 0; i < done_count; i++) CHECK_EQ(done_order[i], i);
+
+    // 6 envios SIRC de 3 quadros, depois 3 quadros NEC
+    CHECK_EQ(fake_rmt_trans_count(), 6 * 6 + 6);
+    int underruns = 0;
+    fake_rmt_trans_t t;
+    for (size_t i = 0; fake_rmt_get_trans(i, &t); i++) {
+        bool request_start = (i < 36) ? i % 6 == 0 : (i - 36) == 0;
+        underruns += t.underrun && !request_start;
+    }
+    uint64_t air_us = 6 * 3 * 45000 + 3 * 108000;
+    printf("fila: posts em %lld us, %lld us para %llu us no ar\n",
+           (long long)post_us, (long long)total_us, (unsigned long long)air_us);
+    CHECK_EQ(underruns, 0);
+    CHECK(total_us >= (int64_t)air_us);
+    CHECK(total_us < (int64_t)air_us + 300000);
+}
+
+// TX done que não chega: timeout, e o serviço segue funcionando
+static void test_lost_done(void) {
+    host_test_section("TX done perdido");
+    ir_tx_code_t code = { .protocol = IR_PROTOCOL_SAMSUNG32, .address = 0x0707, .command = 0x02FD };
+    fake_rmt_reset();
+    fake_rmt_drop_done(true);
+    CHECK_EQ(ir_tx_send(&code, 0), ESP_ERR_TIMEOUT);
+    fake_rmt_drop_done(false);
+    CHECK(check_send(&code, 1));
+}
+
+// ========== ARQUIVOS ==========
+
+static void test_files(void) {
+    host_test_section("arquivos");
+    static wave_t got, want;
+    char dir[256];
+    fake_fs_set_root(host_test_tmpdir());
+    CHECK(fake_fs_host_path(IR_STORAGE_BASE_PATH, dir, sizeof(dir)));
+    mkdir(dir, 0755);
+
+    CHECK(ir_save_full("SIRC15", 0x15, 0x3A, 0xFF, 15, "tv"));
+    fake_rmt_reset();
+    CHECK(ir_tx_send_from_file("tv"));
+    ir_tx_code_t code = { .protocol = IR_PROTOCOL_SIRC, .address = 0x3A, .command = 0x15, .bits = 15 };
+    rmt_wave(&got);
+    spec_send(&want, &code, 0);
+    CHECK(same_wave(&got, &want, "SIRC15 do arquivo"));
+
+    uint32_t timings[] = { 9000, 4500, 560, 560, 560, 1690, 560 };
+    CHECK(ir_save_raw("ac", 38000, timings, 7));
+    fake_rmt_reset();
+    CHECK(ir_tx_send_signal("ac", "ac"));       // Raw só pelo nome do sinal
+    rmt_wave(&got);
+    memset(&want, 0, sizeof(want));
+    for (int i = 0; i < 7; i++) add(&want, !(i & 1), timings[i]);
+    add(&want, 0, 20000);                       // IR_TX_RAW_GAP_US
+    CHECK(same_wave(&got, &want, "raw do arquivo"));
+    fake_rmt_trans_t t;
+    CHECK(fake_rmt_get_trans(0, &t));
+    CHECK_EQ(t.carrier_hz, 38000);
+
+    CHECK(!ir_tx_send_from_file("missing"));
+}
+
+static void test_stop(void) {
+    host_test_section("parada");
+    fake_rmt_counters_t c;
+    CHECK_OK(ir_tx_service_stop());
+    CHECK(!ir_tx_service_is_running());
+    fake_rmt_get_counters(&c);
+    CHECK_EQ(c.channels, 0);
+    CHECK_EQ(c.encoders, 0);
+    CHECK_EQ(c.misuse, 0);
+
+    ir_tx_code_t code = { .protocol = IR_PROTOCOL_NEC };
+    CHECK_EQ(ir_tx_send(&code, 0), ESP_ERR_INVALID_STATE);
+    CHECK(ir_tx_send_from_file("tv"));          // Inicia o serviço de novo
+    CHECK(ir_tx_service_is_running());
+    CHECK_OK(ir_tx_service_stop());
+    fake_rmt_get_counters(&c);
+    CHECK_EQ(c.channels, 0);
+    CHECK_EQ(c.encoders, 0);
+}
+
+int main(void) {
+    test_state();
+    test_exact_timing();
+    test_pooling();
+    test_toggle();
+    test_raw();
+    test_invalid();
+    test_queue();
+    test_lost_done();
+    test_files();
+    test_stop();
+    return host_test_finish("test_ir_tx");
+}
@@ -0,0 +1,230 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Custo das primitivas _fb numa tela de menu de referência, com e sem os
+// caminhos rápidos (recorte único por primitiva, linhas retas por hline/vline,
+// dano marcado uma vez e texto pelo cache de glifos). A referência é a versão
+// anterior em legacy_fb/st7789_fb.c. A tela é dividida em quatro classes
+// (preenchimento, linha, retângulo e texto), cada uma medida em separado;
+// a razão antiga/nova de tempo no host faz as vezes da redução de ciclos.
+// Antes de medir, as duas versões têm que compor a mesma imagem.
+
+#include <string.h>
+#include <stdlib.h>
+#include "st7789.h"
+#include "spi.h"
+#include "host_test.h"
+
+#define RUN_US          300000      // Tempo de cada medida
+#define FB_BYTES        (ST7789_WIDTH * ST7789_HEIGHT * 2)
+
+#define C_BG            0x0000
+#define C_BAR           0x18E3
+#define C_PANEL         0x2104
+#define C_SELECT        0x04BF
+#define C_FRAME         0x7BEF
+#define C_LINE          0x4208
+#define C_TEXT          0xFFFF
+#define C_ACCENT        0xFD20
+
+#define ITEMS           7
+#define ITEM_Y0         40
+#define ITEM_H          24
+#define SELECTED        2
+
+// Versão anterior (legacy_fb/st7789_fb.c)
+void legacy_st7789_fb_bind(int size);
+void legacy_st7789_draw_hline_fb(int x, int y, int w, uint16_t color);
+void legacy_st7789_draw_vline_fb(int x, int y, int h, uint16_t color);
+void legacy_st7789_fill_rect_fb(int x, int y, int w, int h, uint16_t color);
+void legacy_st7789_draw_rect_fb(int x, int y, int w, int h, uint16_t color);
+void legacy_st7789_draw_line_fb(int x0, int y0, int x1, int y1, uint16_t color);
+void legacy_st7789_draw_text_fb(int x, int y, const char *text, uint16_t color, uint16_t bg_color);
+
+// Dependências do driver fora do escopo do teste
+void frame_stream_notify_all(void) {
+}
+
+void backlight_init(void) {
+}
+
+static const char *const items[ITEMS] = {
+    "Infravermelho", "Wi-Fi", "Bluetooth", "Sub-GHz", "Arquivos", "Ajustes", "Sobre",
+};
+
+static bool legacy;
+
+static void set_text_size(int size) {
+    if (legacy) legacy_st7789_fb_bind(size);
+    else st7789_set_text_size(size);
+}
+
+static void hline(int x, int y, int w, uint16_t c) {
+    if (legacy) legacy_st7789_draw_hline_fb(x, y, w, c);
+    else st7789_draw_hline_fb(x, y, w, c);
+}
+
+static void vline(int x, int y, int h, uint16_t c) {
+    if (legacy) legacy_st7789_draw_vline_fb(x, y, h, c);
+    else st7789_draw_vline_fb(x, y, h, c);
+}
+
+static void fill_rect(int x, int y, int w, int h, uint16_t c) {
+    if (legacy) legacy_st7789_fill_rect_fb(x, y, w, h, c);
+    else st7789_fill_rect_fb(x, y, w, h, c);
+}
+
+static void draw_rect(int x, int y, int w, int h, uint16_t c) {
+    if (legacy) legacy_st7789_draw_rect_fb(x, y, w, h, c);
+    else st7789_draw_rect_fb(x, y, w, h, c);
+}
+
+static void draw_line(int x0, int y0, int x1, int y1, uint16_t c) {
+    if (legacy) legacy_st7789_draw_line_fb(x0, y0, x1, y1, c);
+    else st7789_draw_line_fb(x0, y0, x1, y1, c);
+}
+
+static void draw_text(int x, int y, const char *s, uint16_t fg, uint16_t bg) {
+    if (legacy) legacy_st7789_draw_text_fb(x, y, s, fg, bg);
+    else st7789_draw_text_fb(x, y, s, fg, bg);
+}
+
+// ========== TELA DE REFERÊNCIA ==========
+
+static void layer_fill(void) {
+    fill_rect(0, 0, ST7789_WIDTH, ST7789_HEIGHT, C_BG);
+    fill_rect(0, 0, ST7789_WIDTH, 20, C_BAR);                                    // Barra de status
+    fill_rect(4, ITEM_Y0 - 4, ST7789_WIDTH - 16, ITEMS * ITEM_H + 8, C_PANEL);    // Painel da lista
+    fill_rect(6, ITEM_Y0 + SELECTED * ITEM_H, ST7789_WIDTH - 20, ITEM_H, C_SELECT);
+    fill_rect(ST7789_WIDTH - 9, ITEM_Y0 + 20, 6, 40, C_ACCENT);                    // Cursor da rolagem
+    fill_rect(0, ST7789_HEIGHT - 20, ST7789_WIDTH, 20, C_BAR);                   // Rodapé
+}
+
+static void layer_line(void) {
+    for (int i = 1; i < ITEMS; i++) {
+        hline(8, ITEM_Y0 + i * ITEM_H, ST7789_WIDTH - 24, C_LINE);
+    }
+    vline(ST7789_WIDTH - 6, ITEM_Y0 - 4, ITEMS * ITEM_H + 8, C_LINE);           // Trilho da rolagem
+    hline(0, 20, ST7789_WIDTH, C_FRAME);
+    hline(0, ST7789_HEIGHT - 21, ST7789_WIDTH, C_FRAME);
+    for (int i = 0; i < ITEMS; i++) {                                            // Chevrons
+        int x = ST7789_WIDTH - 26, y = ITEM_Y0 + i * ITEM_H + 7;
+        draw_line(x, y, x + 5, y + 5, C_TEXT);
+        draw_line(x + 5, y + 5, x, y + 10, C_TEXT);
+    }
+    draw_line(0, 0, ST7789_WIDTH - 1, ST7789_HEIGHT - 1, C_LINE);                // Diagonais longas
+    draw_line(ST7789_WIDTH - 1, 0, 0, ST7789_HEIGHT - 1, C_LINE);
+}
+
+static void layer_rect(void) {
+    draw_rect(0, 0, ST7789_WIDTH, ST7789_HEIGHT, C_FRAME);                       // Moldura da tela
+    draw_rect(4, ITEM_Y0 - 4, ST7789_WIDTH - 16, ITEMS * ITEM_H + 8, C_FRAME);
+    for (int i = 0; i < ITEMS; i++) {
+        draw_rect(10, ITEM_Y0 + i * ITEM_H + 4, 16, 16, i == SELECTED ? C_TEXT : C_FRAME);
+    }
+    draw_rect(ST7789_WIDTH - 10, ITEM_Y0 + 19, 8, 42, C_TEXT);
+}
+
+static void layer_text(void) {
+    set_text_size(2);
+    draw_text(60, 2, "MENU", C_TEXT, C_BAR);
+    set_text_size(1);
+    draw_text(ST7789_WIDTH - 34, 6, "12:34", C_TEXT, C_BAR);
+    for (int i = 0; i < ITEMS; i++) {
+        uint16_t bg = i == SELECTED ? C_SELECT : C_PANEL;
+        draw_text(32, ITEM_Y0 + i * ITEM_H + 8, items[i], C_TEXT, bg);
+    }
+    draw_text(6, ST7789_HEIGHT - 14, "OK: abrir   <: voltar", C_ACCENT, C_ACCENT);   // Transparente
+    draw_text(6, ITEM_Y0 + ITEMS * ITEM_H + 6, "v1.4\n7 itens", C_TEXT, C_BG);
+}
+
+typedef struct {
+    const char *name;
+    void (*draw)(void);
+} layer_t;
+
+static const layer_t layers[] = {
+    { "fill", layer_fill },
+    { "line", layer_line },
+    { "rect", layer_rect },
+    { "text", layer_text },
+};
+
+#define NUM_LAYERS (sizeof(layers) / sizeof(layers[0]))
+
+static void draw_screen(void) {
+    for (size_t i = 0; i < NUM_LAYERS; i++) layers[i].draw();
+}
+
+// ns por chamada da camada
+static double measure(const layer_t *layer) {
+    uint64_t passes = 0;
+    int64_t t0 = host_test_now_us(), elapsed;
+    do {
+        layer->draw();
+        passes++;
+        elapsed = host_test_now_us() - t0;
+    } while (elapsed < RUN_US);
+    return elapsed * 1000.0 / passes;
+}
+
+// ========== CENÁRIOS ==========
+
+static void same_image(void) {
+    host_test_section("mesma imagem");
+    uint16_t *fb = st7789_get_framebuffer();
+    uint8_t *ref = malloc(FB_BYTES);
+    CHECK(ref != NULL);
+    if (!ref) return;
+
+    legacy = true;
+    draw_screen();
+    memcpy(ref, fb, FB_BYTES);
+    legacy = false;
+    memset(fb, 0xA5, FB_BYTES);
+    draw_screen();
+    CHECK(memcmp(ref, fb, FB_BYTES) == 0);
+    free(ref);
+}
+
+static void cost_per_class(void) {
+    host_test_section("custo por classe");
+    double total_old = 0, total_new = 0;
+
+    printf("%-6s %12s %12s %8s\n", "classe", "antiga ns", "nova ns", "razão");
+    for (size_t i = 0; i < NUM_LAYERS; i++) {
+        legacy = true;
+        double t_old = measure(&layers[i]);
+        legacy = false;
+        double t_new = measure(&layers[i]);
+        total_old += t_old;
+        total_new += t_new;
+        printf("%-6s %12.0f %12.0f %7.2fx\n", layers[i].name, t_old, t_new, t_old / t_new);
+        CHECK(t_new > 0);
+    }
+    printf("%-6s %12.0f %12.0f %7.2fx\n", "tela", total_old, total_new, total_old / total_new);
+}
+
+int main(void) {
+    spi_init();
+    st7789_init();
+    legacy_st7789_fb_bind(1);
+
+    same_image();
+    cost_per_class();
+
+    return host_test_finish("bench_st7789_fb");
+}
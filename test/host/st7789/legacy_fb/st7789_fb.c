@@ -0,0 +1,141 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Primitivas _fb do st7789.c de antes do recorte único por primitiva, como
+// referência para bench_st7789_fb: linhas e texto gravam cada pixel por
+// st7789_draw_pixel_fb (limites e mapa de danos a cada pixel) e os
+// preenchimentos gravam 16 bits por vez, marcando o dano linha a linha.
+//
+// Fora do driver, o framebuffer e o dano vêm da API pública, e o glifo é lido
+// de font_5x7 (a tabela font5x7 por colunas não existe mais). O trabalho por
+// pixel é o mesmo da versão original.
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include "st7789.h"
+#include "font.h"
+
+#define SWAP_BYTES(color) ((((color) >> 8) & 0xFF) | (((color) << 8) & 0xFF00))
+#define damage_add st7789_mark_dirty
+
+static uint16_t *framebuffer;
+static int text_size = 1;
+
+// Chamar depois de st7789_enable_framebuffer() e a cada troca de escala
+void legacy_st7789_fb_bind(int size) {
+    framebuffer = st7789_get_framebuffer();
+    text_size = size < 1 ? 1 : size;
+}
+
+void legacy_st7789_draw_hline_fb(int x, int y, int w, uint16_t color) {
+    if (y < 0 || y >= ST7789_HEIGHT || w <= 0) return;
+    if (x < 0) { w += x; x = 0; }
+    if (x + w > ST7789_WIDTH) { w = ST7789_WIDTH - x; }
+    if (w <= 0) return;
+
+    uint16_t swapped_color = SWAP_BYTES(color);
+    for (int i = 0; i < w; i++) {
+        framebuffer[y * ST7789_WIDTH + x + i] = swapped_color;
+    }
+    damage_add(x, y, w, 1);
+}
+
+void legacy_st7789_draw_vline_fb(int x, int y, int h, uint16_t color) {
+    if (x < 0 || x >= ST7789_WIDTH || h <= 0) return;
+    if (y < 0) { h += y; y = 0; }
+    if (y + h > ST7789_HEIGHT) { h = ST7789_HEIGHT - y; }
+    if (h <= 0) return;
+
+    uint16_t swapped_color = SWAP_BYTES(color);
+    for (int i = 0; i < h; i++) {
+        framebuffer[(y + i) * ST7789_WIDTH + x] = swapped_color;
+    }
+    damage_add(x, y, 1, h);
+}
+
+void legacy_st7789_fill_rect_fb(int x, int y, int w, int h, uint16_t color) {
+    if (w <= 0 || h <= 0) return;
+    // Clipping
+    if (x < 0) { w += x; x = 0; }
+    if (y < 0) { h += y; y = 0; }
+    if (x + w > ST7789_WIDTH) { w = ST7789_WIDTH - x; }
+    if (y + h > ST7789_HEIGHT) { h = ST7789_HEIGHT - y; }
+    if (w <= 0 || h <= 0) return;
+
+    for (int i = 0; i < h; i++) {
+        legacy_st7789_draw_hline_fb(x, y + i, w, color);
+    }
+}
+
+void legacy_st7789_draw_rect_fb(int x, int y, int w, int h, uint16_t color) {
+    legacy_st7789_draw_hline_fb(x, y, w, color);
+    legacy_st7789_draw_hline_fb(x, y + h - 1, w, color);
+    legacy_st7789_draw_vline_fb(x, y, h, color);
+    legacy_st7789_draw_vline_fb(x + w - 1, y, h, color);
+}
+
+void legacy_st7789_draw_char_fb(int x, int y, char c, uint16_t color, uint16_t bg_color) {
+    if ((uint8_t)c < 32 || (uint8_t)c > 127) c = '?';
+
+    const font_t *font = &font_5x7;
+    const uint8_t *glyph = font_glyph(font, c);
+    if (!glyph) glyph = font_glyph(font, '?');
+    int row_bytes = font_row_bytes(font);
+    bool is_opaque = (color != bg_color);
+
+    for (int col = 0; col < font->width; col++) {
+        for (int row = 0; row < font->height; row++) {
+            bool on = glyph[row * row_bytes + col / 8] & (0x80 >> (col % 8));
+            uint16_t pixel_color = on ? color : bg_color;
+            if (is_opaque || pixel_color == color) { // Desenha o pixel se for opaco ou se for a cor do texto
+                if (text_size == 1) {
+                    st7789_draw_pixel_fb(x + col, y + row, pixel_color);
+                } else {
+                    legacy_st7789_fill_rect_fb(x + (col * text_size), y + (row * text_size), text_size, text_size, pixel_color);
+                }
+            }
+        }
+    }
+}
+
+void legacy_st7789_draw_text_fb(int x, int y, const char *text, uint16_t color, uint16_t bg_color) {
+    if (!text) return;
+    int current_x = x;
+    while (*text) {
+        if (*text == '\n') {
+            y += 8 * text_size;
+            current_x = x;
+        } else {
+            legacy_st7789_draw_char_fb(current_x, y, *text, color, bg_color);
+            current_x += 6 * text_size;
+        }
+        text++;
+    }
+}
+
+void legacy_st7789_draw_line_fb(int x0, int y0, int x1, int y1, uint16_t color) {
+    int dx = abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+    int dy = -abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy, e2;
+
+    for (;;) {
+        st7789_draw_pixel_fb(x0, y0, color);
+        if (x0 == x1 && y0 == y1) break;
+        e2 = 2 * err;
+        if (e2 >= dy) { err += dy; x0 += sx; }
+        if (e2 <= dx) { err += dx; y0 += sy; }
+    }
+}
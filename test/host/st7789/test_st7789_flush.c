@@ -0,0 +1,442 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Flush do ST7789 sobre o barramento simulado. Um modelo do painel decodifica
+// CASET/RASET/RAMWR/VSCRDEF/VSCSAD a partir do pino DC e mantém a memória do
+// controlador; depois de cada flush a imagem visível tem que bater com o
+// framebuffer. Cobre o mapa de danos, o anel de transações entregues ao
+// árbitro (com o barramento atrasado em relação ao app) e a rolagem.
+
+#include <string.h>
+#include <stdlib.h>
+#include "st7789.h"
+#include "spi.h"
+#include "spi_arbiter.h"
+#include "pin_def.h"
+#include "backlight.h"
+#include "frame_stream.h"
+#include "driver/gpio.h"
+#include "freertos/task.h"
+#include "fake_spi.h"
+#include "host_test.h"
+
+#define RAM_ROWS        320
+#define ROW_BYTES       (ST7789_WIDTH * 2)
+#define FB_BYTES        (ST7789_WIDTH * ST7789_HEIGHT * 2)
+#define TILE            16
+
+// Dependências do driver fora do escopo do teste
+static int notify_count;
+
+void frame_stream_notify_all(void) {
+    notify_count++;
+}
+
+void backlight_init(void) {
+}
+
+// ========== MODELO DO PAINEL ==========
+
+static struct {
+    uint8_t ram[RAM_ROWS][ROW_BYTES];
+    uint8_t cmd;
+    uint8_t param[8];
+    int nparam;
+    int xs, xe, ys, ye;
+    int x, y;                   // Próximo pixel do RAMWR
+    int phase;                  // Byte dentro do pixel
+    uint8_t hi;
+    int tfa, vsa, vsp;          // Rolagem vertical
+    int ramwr_count;
+    int caset_count;
+    long pixel_bytes;
+    int errors;                 // Bytes fora de qualquer comando conhecido
+} panel;
+
+static void panel_reset(void) {
+    memset(&panel, 0, sizeof(panel));
+    panel.xe = ST7789_WIDTH - 1;
+    panel.ye = RAM_ROWS - 1;
+    panel.vsa = RAM_ROWS;
+}
+
+static int be16(const uint8_t *p) {
+    return (p[0] << 8) | p[1];
+}
+
+static void panel_param(uint8_t b) {
+    if (panel.nparam < (int)sizeof(panel.param)) {
+        panel.param[panel.nparam] = b;
+    }
+    panel.nparam++;
+
+    switch (panel.cmd) {
+        case 0x2A:  // CASET
+            if (panel.nparam == 4) {
+                panel.xs = be16(&panel.param[0]);
+                panel.xe = be16(&panel.param[2]);
+            }
+            break;
+        case 0x2B:  // RASET
+            if (panel.nparam == 4) {
+                panel.ys = be16(&panel.param[0]);
+                panel.ye = be16(&panel.param[2]);
+            }
+            break;
+        case 0x33:  // VSCRDEF
+            if (panel.nparam == 6) {
+                panel.tfa = be16(&panel.param[0]);
+                panel.vsa = be16(&panel.param[2]);
+            }
+            break;
+        case 0x37:  // VSCSAD
+            if (panel.nparam == 2) {
+                panel.vsp = be16(&panel.param[0]);
+            }
+            break;
+        case 0x2C:  // RAMWR
+            if (panel.phase == 0) {
+                panel.hi = b;
+                panel.phase = 1;
+                break;
+            }
+            panel.phase = 0;
+            if (panel.y <= panel.ye && panel.y < RAM_ROWS && panel.x < ST7789_WIDTH) {
+                panel.ram[panel.y][panel.x * 2] = panel.hi;
+                panel.ram[panel.y][panel.x * 2 + 1] = b;
+            } else {
+                panel.errors++;
+            }
+            panel.pixel_bytes += 2;
+            if (++panel.x > panel.xe) {
+                panel.x = panel.xs;
+                panel.y++;
+            }
+            break;
+        case 0x3A: case 0x36:  // COLMOD, MADCTL
+            break;
+        default:
+            panel.errors++;
+            break;
+    }
+}
+
+static void panel_sink(int cs, const spi_transaction_t *t, void *ctx) {
+    (void)ctx;
+    if (cs != ST7789_CS_PIN) return;
+
+    const uint8_t *p = (t->flags & SPI_TRANS_USE_TXDATA) ? t->tx_data : t->tx_buffer;
+    size_t len = t->length / 8;
+    if (!p) return;
+
+    if (gpio_get_level(ST7789_PIN_DC) == 0) {
+        for (size_t i = 0; i < len; i++) {
+            panel.cmd = p[i];
+            panel.nparam = 0;
+            if (panel.cmd == 0x2C) {
+                panel.x = panel.xs;
+                panel.y = panel.ys;
+                panel.phase = 0;
+                panel.ramwr_count++;
+            } else if (panel.cmd == 0x2A) {
+                panel.caset_count++;
+            }
+        }
+        return;
+    }
+    for (size_t i = 0; i < len; i++) {
+        panel_param(p[i]);
+    }
+}
+
+// Linha de memória mostrada na linha de tela `row`
+static int panel_scan_row(int row) {
+    if (row >= panel.tfa && row < panel.tfa + panel.vsa) {
+        return panel.tfa + (row - panel.tfa + panel.vsp - panel.tfa) % panel.vsa;
+    }
+    return row;
+}
+
+// Linhas de tela em que o painel difere do framebuffer
+static int panel_diff_rows(const uint16_t *fb) {
+    int bad = 0;
+    for (int row = 0; row < ST7789_HEIGHT; row++) {
+        if (memcmp(panel.ram[panel_scan_row(row)], &fb[row * ST7789_WIDTH], ROW_BYTES) != 0) {
+            bad++;
+        }
+    }
+    return bad;
+}
+
+static void flush_and_wait(void) {
+    st7789_flush();
+    st7789_flush_wait();
+}
+
+// Pixels de tela enviados desde `from`, sem contar comandos e parâmetros
+static size_t pixel_events(size_t from, size_t *events) {
+    fake_spi_event_t ev;
+    size_t bytes = 0;
+    *events = 0;
+    for (size_t i = from; fake_spi_get_event(i, &ev); i++) {
+        if (ev.cs == ST7789_CS_PIN) {
+            (*events)++;
+            if (ev.len > 4) bytes += ev.len;
+        }
+    }
+    return bytes;
+}
+
+// ========== TESTES ==========
+
+static void test_full_flush(void) {
+    host_test_section("flush completo");
+    st7789_set_flush_mode(ST7789_FLUSH_FULL);
+    st7789_fill_screen_fb(ST7789_COLOR_BLUE);
+    st7789_fill_rect_fb(10, 20, 100, 50, ST7789_COLOR_YELLOW);
+    st7789_draw_text_fb(4, 200, "HighBoy", ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
+    int notified = notify_count;
+    flush_and_wait();
+
+    st7789_flush_stats_t st;
+    st7789_get_flush_stats(&st);
+    CHECK_EQ(st.bytes_sent, FB_BYTES);
+    CHECK_EQ(st.rects, 1);
+    CHECK_EQ(notify_count, notified + 1);
+    CHECK_EQ(panel_diff_rows(st7789_get_framebuffer()), 0);
+    CHECK_EQ(panel.errors, 0);
+}
+
+static void test_damage_rects(void) {
+    host_test_section("retângulos de dano");
+    st7789_set_flush_mode(ST7789_FLUSH_DAMAGE);
+    flush_and_wait();
+
+    // Um tile só
+    size_t from = fake_spi_event_count();
+    int ramwr = panel.ramwr_count;
+    st7789_fill_rect_fb(20, 20, 10, 10, ST7789_COLOR_RED);
+    flush_and_wait();
+    st7789_flush_stats_t st;
+    st7789_get_flush_stats(&st);
+    CHECK_EQ(st.dirty_tiles, 1);
+    CHECK_EQ(st.rects, 1);
+    CHECK_EQ(st.bytes_sent, TILE * TILE * 2);
+    CHECK_EQ(panel.ramwr_count, ramwr + 1);
+    CHECK_EQ(panel.xs, 16);
+    CHECK_EQ(panel.xe, 31);
+    CHECK_EQ(panel.ys, 16);
+    CHECK_EQ(panel.ye, 31);
+    size_t events;
+    CHECK_EQ(pixel_events(from, &events), TILE * TILE * 2);
+    CHECK_EQ(panel_diff_rows(st7789_get_framebuffer()), 0);
+
+    // Tiles empilhados com as mesmas colunas viram um retângulo
+    ramwr = panel.ramwr_count;
+    st7789_draw_vline_fb(100, 30, 60, ST7789_COLOR_GREEN);
+    flush_and_wait();
+    st7789_get_flush_stats(&st);
+    CHECK_EQ(st.rects, 1);
+    CHECK_EQ(st.dirty_tiles, 5);
+    CHECK_EQ(st.bytes_sent, TILE * 5 * TILE * 2);
+    CHECK_EQ(panel.ramwr_count, ramwr + 1);
+    CHECK_EQ(panel_diff_rows(st7789_get_framebuffer()), 0);
+
+    // Nada mudou: nenhum byte no barramento
+    from = fake_spi_event_count();
+    flush_and_wait();
+    st7789_get_flush_stats(&st);
+    CHECK_EQ(st.bytes_sent, 0);
+    CHECK_EQ(fake_spi_event_count(), from);
+
+    // Mais retângulos do que o limite: tela cheia
+    for (int ty = 0; ty < 15; ty++) {
+        st7789_draw_pixel_fb(ty * TILE, ty * TILE, ST7789_COLOR_WHITE);
+        st7789_draw_pixel_fb((ty + 7) % 15 * TILE, ty * TILE, ST7789_COLOR_WHITE);
+    }
+    flush_and_wait();
+    st7789_get_flush_stats(&st);
+    CHECK_EQ(st.rects, 1);
+    CHECK_EQ(st.bytes_sent, FB_BYTES);
+    CHECK_EQ(panel_diff_rows(st7789_get_framebuffer()), 0);
+    CHECK_EQ(panel.errors, 0);
+}
+
+// O app desenha de forma incremental no back buffer: depois da troca, ele
+// precisa conter o frame anterior, ou um tile fica errado na tela.
+static void test_double_buffer_sync(void) {
+    host_test_section("sincronia entre os buffers");
+    st7789_set_flush_mode(ST7789_FLUSH_DAMAGE);
+    for (int frame = 0; frame < 6; frame++) {
+        st7789_fill_rect_fb(frame * 30, frame * 25, 40, 40, ST7789_COLOR565(frame * 40, 80, 200));
+        st7789_flush();
+    }
+    st7789_flush_wait();
+    CHECK_EQ(panel_diff_rows(st7789_get_framebuffer()), 0);
+}
+
+// Com o barramento atrasado, vários flushes ficam em voo no árbitro: o anel
+// de transações não pode perder nem reordenar jobs, e os parâmetros curtos
+// (montados na pilha) precisam ter sido copiados.
+static void test_transaction_ring(void) {
+    host_test_section("anel de transações");
+    fake_spi_set_realtime(0.25);
+    st7789_set_flush_mode(ST7789_FLUSH_DAMAGE);
+    srand(1234);
+
+    size_t from = fake_spi_event_count();
+    long sent = 0;
+    for (int frame = 0; frame < 40; frame++) {
+        for (int k = 0; k < 6; k++) {
+            int x = rand() % ST7789_WIDTH;
+            int y = rand() % ST7789_HEIGHT;
+            st7789_fill_rect_fb(x, y, 1 + rand() % 60, 1 + rand() % 60, (uint16_t)rand());
+        }
+        st7789_flush();
+        st7789_flush_stats_t st;
+        st7789_get_flush_stats(&st);
+        sent += st.bytes_sent;
+    }
+    st7789_flush_wait();
+    fake_spi_set_realtime(0);
+
+    size_t events;
+    CHECK_EQ(pixel_events(from, &events), sent);
+    CHECK_EQ(panel_diff_rows(st7789_get_framebuffer()), 0);
+    CHECK_EQ(panel.errors, 0);
+    CHECK_EQ(fake_spi_misuse_count(), 0);
+
+    // Os jobs do flush rodam na task do árbitro, não na do app
+    fake_spi_event_t ev;
+    int from_app = 0;
+    for (size_t i = from; fake_spi_get_event(i, &ev); i++) {
+        if (ev.cs == ST7789_CS_PIN && ev.task == xTaskGetCurrentTaskHandle()) from_app++;
+    }
+    CHECK_EQ(from_app, 0);
+}
+
+// Desenho imediato logo após um flush assíncrono: o comando só sai depois
+// do último bloco do frame, senão o frame sobrescreveria o pixel.
+static void test_immediate_after_flush(void) {
+    host_test_section("desenho imediato após flush");
+    fake_spi_set_realtime(0.25);
+    st7789_set_flush_mode(ST7789_FLUSH_FULL);
+    st7789_fill_screen_fb(ST7789_COLOR_BLACK);
+    st7789_flush();
+    CHECK(st7789_flush_busy());
+    st7789_draw_pixel(5, 5, ST7789_COLOR_GREEN);
+    fake_spi_set_realtime(0);
+
+    CHECK(!st7789_flush_busy());
+    // st7789_draw_pixel manda o byte menos significativo primeiro
+    CHECK_EQ(panel.ram[5][10], ST7789_COLOR_GREEN & 0xFF);
+    CHECK_EQ(panel.ram[5][11], ST7789_COLOR_GREEN >> 8);
+    CHECK_EQ(be16(&panel.ram[5][12]), ST7789_COLOR_BLACK);
+
+    // O próximo flush do tile devolve ao painel o conteúdo do framebuffer
+    st7789_draw_pixel_fb(5, 5, ST7789_COLOR_BLACK);
+    flush_and_wait();
+    CHECK_EQ(panel_diff_rows(st7789_get_framebuffer()), 0);
+}
+
+static void test_scroll_region(void) {
+    host_test_section("rolagem por hardware");
+    st7789_set_flush_mode(ST7789_FLUSH_DAMAGE);
+    st7789_fill_screen_fb(ST7789_COLOR_BLACK);
+    for (int i = 0; i < 10; i++) {
+        char line[16];
+        snprintf(line, sizeof(line), "linha %d", i);
+        st7789_draw_text_fb(4, 40 + i * 16, line, ST7789_COLOR_WHITE, ST7789_COLOR_BLACK);
+    }
+    flush_and_wait();
+    CHECK_OK(st7789_scroll_region_set(32, 176));
+    CHECK_EQ(panel.tfa, 32);
+    CHECK_EQ(panel.vsa, 176);
+
+    for (int i = 0; i < 12; i++) {
+        st7789_scroll_region_scroll(16, ST7789_COLOR_BLACK);
+        char line[16];
+        snprintf(line, sizeof(line), "nova %d", i);
+        st7789_draw_text_fb(4, 32 + 176 - 16, line, ST7789_COLOR_CYAN, ST7789_COLOR_BLACK);
+        flush_and_wait();
+
+        // Só a faixa exposta sai pelo barramento
+        st7789_flush_stats_t st;
+        st7789_get_flush_stats(&st);
+        CHECK(st.bytes_sent <= 2 * TILE * ROW_BYTES);
+        CHECK_EQ(panel_diff_rows(st7789_get_framebuffer()), 0);
+    }
+
+    st7789_scroll_region_scroll(-40, ST7789_COLOR_RED);
+    flush_and_wait();
+    CHECK_EQ(panel_diff_rows(st7789_get_framebuffer()), 0);
+
+    st7789_scroll_region_reset();
+    flush_and_wait();
+    CHECK_EQ(panel.vsp, 0);
+    CHECK_EQ(panel_diff_rows(st7789_get_framebuffer()), 0);
+    CHECK_EQ(panel.errors, 0);
+}
+
+// Sem árbitro o flush cai para transmissões síncronas no device
+static void test_without_arbiter(void) {
+    host_test_section("flush sem árbitro");
+    spi_arbiter_deinit();
+    size_t from = fake_spi_event_count();
+    st7789_set_flush_mode(ST7789_FLUSH_DAMAGE);
+    st7789_fill_rect_fb(60, 60, 70, 30, ST7789_COLOR_MAGENTA);
+    flush_and_wait();
+    CHECK_EQ(panel_diff_rows(st7789_get_framebuffer()), 0);
+
+    fake_spi_event_t ev;
+    int inline_events = 0, total = 0;
+    for (size_t i = from; fake_spi_get_event(i, &ev); i++) {
+        total++;
+        if (ev.task == xTaskGetCurrentTaskHandle()) inline_events++;
+    }
+    CHECK(total > 0);
+    CHECK_EQ(inline_events, total);
+    CHECK_OK(spi_arbiter_init());
+}
+
+// Tudo o que o display põe no barramento passa pelo árbitro, inclusive os
+// comandos síncronos (init, desenho imediato): um bloco contado por transação
+static void check_all_through_arbiter(void) {
+    spi_device_stats_t st;
+    spi_arbiter_get_stats(SPI_DEVICE_ST7789, &st);
+    CHECK_EQ(st.chunks, fake_spi_event_count());
+    CHECK(st.inline_jobs > 0);
+}
+
+int main(void) {
+    panel_reset();
+    fake_spi_set_sink(panel_sink, NULL);
+    CHECK_OK(spi_init());
+    st7789_init();
+    CHECK(st7789_get_framebuffer() != NULL);
+    st7789_flush_wait();
+    CHECK_EQ(panel_diff_rows(st7789_get_framebuffer()), 0);
+    check_all_through_arbiter();
+
+    test_full_flush();
+    test_damage_rects();
+    test_double_buffer_sync();
+    test_transaction_ring();
+    test_immediate_after_flush();
+    check_all_through_arbiter();
+    test_scroll_region();
+    test_without_arbiter();
+    return host_test_finish("test_st7789_flush");
+}
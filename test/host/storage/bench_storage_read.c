@@ -0,0 +1,202 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Funções de linha e de busca da storage API: a versão atual (vfs_stream)
+// contra a antiga, de um vfs_read por byte (legacy_storage_read/). Um log de
+// 1 MB fica no backend em memória instrumentado, montado no lugar da
+// partição LittleFS; cada função roda nas duas versões, com e sem o cache de
+// blocos, e o relatório compara as chamadas que chegam ao backend e o tempo.
+// Os resultados das duas versões têm que ser iguais.
+
+#include <stdio.h>
+#include <string.h>
+#include "storage.h"
+#include "vfs_core.h"
+#include "vfs_config.h"
+#include "spi.h"
+#include "fake_fs.h"
+#include "mem_backend.h"
+#include "host_test.h"
+
+#define LOG_LINES       20000
+#define LOG_PATH        VFS_MOUNT_POINT "/log.txt"
+
+esp_err_t legacy_storage_read_line(const char *path, char *buffer, size_t buffer_size, uint32_t line_number);
+esp_err_t legacy_storage_read_last_line(const char *path, char *buffer, size_t buffer_size);
+esp_err_t legacy_storage_read_lines(const char *path, storage_line_callback_t callback, void *user_data);
+esp_err_t legacy_storage_count_lines(const char *path, uint32_t *line_count);
+esp_err_t legacy_storage_file_contains(const char *path, const char *search, bool *found);
+esp_err_t legacy_storage_count_occurrences(const char *path, const char *search, uint32_t *count);
+
+static void put_log(void) {
+    static char text[LOG_LINES * 64];
+    size_t len = 0;
+    for (int i = 0; i < LOG_LINES; i++) {
+        len += snprintf(text + len, sizeof(text) - len,
+                        "%06d I (%d) WIFI: evento de log numero %d status=ok\n", i, i * 7, i);
+    }
+    CHECK_OK(mem_backend_put(LOG_PATH, text, len));
+    printf("log: %d linhas, %zu bytes\n", LOG_LINES, len);
+}
+
+// ========== CARGAS ==========
+
+// Cada carga devolve um hash do resultado, para comparar as versões
+typedef uint64_t (*workload_fn_t)(bool legacy);
+
+static uint64_t mix(uint64_t h, const char *s) {
+    while (*s) h = (h ^ (uint8_t)*s++) * 1099511628211ull;
+    return (h ^ '|') * 1099511628211ull;
+}
+
+static uint64_t count_lines(bool legacy) {
+    uint32_t n = 0;
+    CHECK_OK(legacy ? legacy_storage_count_lines("log.txt", &n) : storage_count_lines("log.txt", &n));
+    CHECK_EQ(n, LOG_LINES);
+    return n;
+}
+
+static void hash_line(const char *line, void *arg) {
+    uint64_t *h = arg;
+    *h = mix(*h, line);
+}
+
+static uint64_t read_lines(bool legacy) {
+    uint64_t h = 14695981039346656037ull;
+    CHECK_OK(legacy ? legacy_storage_read_lines("log.txt", hash_line, &h)
+                    : storage_read_lines("log.txt", hash_line, &h));
+    return h;
+}
+
+static uint64_t read_line(bool legacy) {
+    static const uint32_t lines[] = { 1, 5000, 10000, 15000, LOG_LINES };
+    uint64_t h = 14695981039346656037ull;
+    char buf[128];
+    for (size_t i = 0; i < sizeof(lines) / sizeof(lines[0]); i++) {
+        CHECK_OK(legacy ? legacy_storage_read_line("log.txt", buf, sizeof(buf), lines[i])
+                        : storage_read_line("log.txt", buf, sizeof(buf), lines[i]));
+        h = mix(h, buf);
+    }
+    return h;
+}
+
+static uint64_t read_last_line(bool legacy) {
+    char buf[128];
+    CHECK_OK(legacy ? legacy_storage_read_last_line("log.txt", buf, sizeof(buf))
+                    : storage_read_last_line("log.txt", buf, sizeof(buf)));
+    return mix(0, buf);
+}
+
+static uint64_t file_contains(bool legacy) {
+    bool found = true;
+    CHECK_OK(legacy ? legacy_storage_file_contains("log.txt", "status=erro", &found)
+                    : storage_file_contains("log.txt", "status=erro", &found));
+    CHECK(!found);
+    return found;
+}
+
+static uint64_t count_occurrences(bool legacy) {
+    uint32_t n = 0;
+    CHECK_OK(legacy ? legacy_storage_count_occurrences("log.txt", "numero 1", &n)
+                    : storage_count_occurrences("log.txt", "numero 1", &n));
+    return n;
+}
+
+static const struct {
+    const char *name;
+    workload_fn_t fn;
+} workloads[] = {
+    { "count_lines", count_lines },
+    { "read_lines", read_lines },
+    { "read_line x5", read_line },
+    { "read_last_line", read_last_line },
+    { "file_contains", file_contains },
+    { "count_occurrences", count_occurrences },
+};
+#define WORKLOADS (sizeof(workloads) / sizeof(workloads[0]))
+
+// ========== MEDIÇÃO ==========
+
+typedef struct {
+    unsigned calls;             // Todas as chamadas ao backend
+    unsigned reads;
+    int64_t us;
+    uint64_t result;
+} run_t;
+
+static unsigned total_calls(const mem_backend_calls_t *c) {
+    return c->open + c->close + c->read + c->write + c->lseek + c->fsync + c->stat +
+           c->fstat + c->rename + c->unlink + c->truncate + c->mkdir + c->rmdir +
+           c->opendir + c->readdir;
+}
+
+static run_t measure(workload_fn_t fn, bool legacy) {
+    mem_backend_calls_t c;
+    run_t r;
+    mem_backend_reset_calls();
+    int64_t t0 = host_test_now_us();
+    r.result = fn(legacy);
+    r.us = host_test_now_us() - t0;
+    mem_backend_get_calls(&c);
+    r.calls = total_calls(&c);
+    r.reads = c.read;
+    return r;
+}
+
+static void run_config(bool cached) {
+    host_test_section(cached ? "com cache de blocos" : "sem cache de blocos");
+    vfs_unregister_backend(VFS_MOUNT_POINT);
+    CHECK_OK(mem_backend_mount(VFS_MOUNT_POINT, cached ? 0 : VFS_BACKEND_FLAG_NO_CACHE));
+    // O índice de linhas de uma configuração não vale para a outra
+    vfs_unlink(LOG_PATH VFS_LINEINDEX_SIDECAR_EXT);
+
+    printf("\n%s:\n", cached ? "com cache de blocos" : "sem cache de blocos");
+    printf("  %-18s %12s %12s %10s %10s\n", "", "chamadas", "(antes)", "ms", "(antes)");
+    int64_t old_us = 0, new_us = 0;
+    for (size_t i = 0; i < WORKLOADS; i++) {
+        run_t old = measure(workloads[i].fn, true);
+        run_t cur = measure(workloads[i].fn, false);
+        printf("  %-18s %12u %12u %10.1f %10.1f\n", workloads[i].name,
+               cur.calls, old.calls, cur.us / 1000.0, old.us / 1000.0);
+
+        CHECK_EQ(cur.result, old.result);
+        // Com o cache as duas versões leem o arquivo em blocos (a atual pode
+        // fazer uma leitura a mais no fim do arquivo, e chamadas a mais
+        // gravando o índice de linhas); sem ele, a antiga faz uma por byte
+        CHECK(cur.reads <= old.reads + 1);
+        if (!cached) CHECK(cur.reads * 100 < old.reads);
+        old_us += old.us;
+        new_us += cur.us;
+    }
+    printf("  %-18s %12s %12s %10.1f %10.1f\n", "total", "", "", new_us / 1000.0, old_us / 1000.0);
+    CHECK(new_us * 2 < old_us);
+}
+
+int main(void) {
+    CHECK_OK(spi_init());
+    fake_fs_set_root(host_test_tmpdir());
+    CHECK_OK(storage_init());
+    vfs_unregister_backend(VFS_MOUNT_POINT);
+    CHECK_OK(mem_backend_mount(VFS_MOUNT_POINT, 0));
+    put_log();
+
+    run_config(true);
+    run_config(false);
+
+    CHECK_OK(mem_backend_unmount());
+    CHECK_OK(storage_deinit());
+    return host_test_finish("bench_storage_read");
+}
@@ -0,0 +1,98 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Implementação antiga do sd_card (POSIX/FATFS direto), como estava antes de
+// virar o sd_card_compat.c: os .c deste diretório são cópias sem alteração e
+// servem de referência para test_sd_compat. Este cabeçalho é incluído antes
+// de cada um (e de sd_scenario.c, na versão antiga) para que as funções
+// ganhem o prefixo legacy_ e convivam com as do shim no mesmo executável.
+
+#ifndef LEGACY_SD_NAMES_H
+#define LEGACY_SD_NAMES_H
+
+#include <stdlib.h>     // atoi/atof em sd_card_read.c (no IDF vinha de outro cabeçalho)
+
+#define sd_append_binary             legacy_sd_append_binary
+#define sd_append_csv_row            legacy_sd_append_csv_row
+#define sd_append_formatted          legacy_sd_append_formatted
+#define sd_append_line               legacy_sd_append_line
+#define sd_append_string             legacy_sd_append_string
+#define sd_check_health              legacy_sd_check_health
+#define sd_count_lines               legacy_sd_count_lines
+#define sd_count_occurrences         legacy_sd_count_occurrences
+#define sd_deinit                    legacy_sd_deinit
+#define sd_dir_copy_recursive        legacy_sd_dir_copy_recursive
+#define sd_dir_count                 legacy_sd_dir_count
+#define sd_dir_create                legacy_sd_dir_create
+#define sd_dir_exists                legacy_sd_dir_exists
+#define sd_dir_get_size              legacy_sd_dir_get_size
+#define sd_dir_list                  legacy_sd_dir_list
+#define sd_dir_remove_recursive      legacy_sd_dir_remove_recursive
+#define sd_file_clear                legacy_sd_file_clear
+#define sd_file_compare              legacy_sd_file_compare
+#define sd_file_contains             legacy_sd_file_contains
+#define sd_file_copy                 legacy_sd_file_copy
+#define sd_file_delete               legacy_sd_file_delete
+#define sd_file_exists               legacy_sd_file_exists
+#define sd_file_get_extension        legacy_sd_file_get_extension
+#define sd_file_get_info             legacy_sd_file_get_info
+#define sd_file_get_size             legacy_sd_file_get_size
+#define sd_file_is_empty             legacy_sd_file_is_empty
+#define sd_file_move                 legacy_sd_file_move
+#define sd_file_rename               legacy_sd_file_rename
+#define sd_file_truncate             legacy_sd_file_truncate
+#define sd_get_capacity              legacy_sd_get_capacity
+#define sd_get_card_handle           legacy_sd_get_card_handle
+#define sd_get_card_info             legacy_sd_get_card_info
+#define sd_get_card_name             legacy_sd_get_card_name
+#define sd_get_card_type             legacy_sd_get_card_type
+#define sd_get_card_type_name        legacy_sd_get_card_type_name
+#define sd_get_free_space            legacy_sd_get_free_space
+#define sd_get_fs_stats              legacy_sd_get_fs_stats
+#define sd_get_speed                 legacy_sd_get_speed
+#define sd_get_total_space           legacy_sd_get_total_space
+#define sd_get_usage_percent         legacy_sd_get_usage_percent
+#define sd_get_used_space            legacy_sd_get_used_space
+#define sd_init                      legacy_sd_init
+#define sd_init_custom               legacy_sd_init_custom
+#define sd_init_custom_pins          legacy_sd_init_custom_pins
+#define sd_is_mounted                legacy_sd_is_mounted
+#define sd_print_card_info           legacy_sd_print_card_info
+#define sd_read_binary               legacy_sd_read_binary
+#define sd_read_byte                 legacy_sd_read_byte
+#define sd_read_bytes                legacy_sd_read_bytes
+#define sd_read_chunk                legacy_sd_read_chunk
+#define sd_read_first_line           legacy_sd_read_first_line
+#define sd_read_float                legacy_sd_read_float
+#define sd_read_int                  legacy_sd_read_int
+#define sd_read_last_line            legacy_sd_read_last_line
+#define sd_read_line                 legacy_sd_read_line
+#define sd_read_lines                legacy_sd_read_lines
+#define sd_read_string               legacy_sd_read_string
+#define sd_remount                   legacy_sd_remount
+#define sd_reset_bus                 legacy_sd_reset_bus
+#define sd_write_binary              legacy_sd_write_binary
+#define sd_write_buffer              legacy_sd_write_buffer
+#define sd_write_byte                legacy_sd_write_byte
+#define sd_write_bytes               legacy_sd_write_bytes
+#define sd_write_csv_row             legacy_sd_write_csv_row
+#define sd_write_float               legacy_sd_write_float
+#define sd_write_formatted           legacy_sd_write_formatted
+#define sd_write_int                 legacy_sd_write_int
+#define sd_write_line                legacy_sd_write_line
+#define sd_write_string              legacy_sd_write_string
+#define sd_scenario_run              legacy_sd_scenario_run
+
+#endif // LEGACY_SD_NAMES_H
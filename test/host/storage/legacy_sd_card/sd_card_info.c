@@ -18,6 +18,7 @@
 #include "esp_vfs_fat.h"
 #include "sdmmc_cmd.h"
 #include "ff.h"
+#include <inttypes.h>
 #include <string.h>
 
 static const char *TAG = "sd_info";
@@ -59,10 +60,10 @@ void sd_print_card_info(void)
     if (sd_get_card_info(&info) == ESP_OK) {
         ESP_LOGI(TAG, "========== Info SD ==========");
         ESP_LOGI(TAG, "Nome: %s", info.name);
-        ESP_LOGI(TAG, "Capacidade: %lu MB", info.capacity_mb);
-        ESP_LOGI(TAG, "Tamanho setor: %lu bytes", info.sector_size);
-        ESP_LOGI(TAG, "Num setores: %lu", info.num_sectors);
-        ESP_LOGI(TAG, "Velocidade: %lu kHz", info.speed_khz);
+        ESP_LOGI(TAG, "Capacidade: %" PRIu32 " MB", info.capacity_mb);
+        ESP_LOGI(TAG, "Tamanho setor: %" PRIu32 " bytes", info.sector_size);
+        ESP_LOGI(TAG, "Num setores: %" PRIu32, info.num_sectors);
+        ESP_LOGI(TAG, "Velocidade: %" PRIu32 " kHz", info.speed_khz);
         ESP_LOGI(TAG, "Status: %s", info.is_mounted ? "Montado" : "Desmontado");
         ESP_LOGI(TAG, "============================");
     }
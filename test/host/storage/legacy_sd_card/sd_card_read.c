@@ -15,6 +15,7 @@
 #include "sd_card_read.h"
 #include "sd_card_init.h"
 #include "esp_log.h"
+#include <inttypes.h>
 #include <stdio.h>
 #include <string.h>
 
@@ -52,7 +53,7 @@ esp_err_t sd_read_string(const char *path, char *buffer, size_t buffer_size)
     buffer[read_size] = '\0';
     fclose(f);
 
-    ESP_LOGD(TAG, "Lido: %s (%d bytes)", full_path, read_size);
+    ESP_LOGD(TAG, "Lido: %s (%zu bytes)", full_path, read_size);
     return ESP_OK;
 }
 
@@ -78,7 +79,7 @@ esp_err_t sd_read_binary(const char *path, void *buffer, size_t size, size_t *by
         *bytes_read = read;
     }
 
-    ESP_LOGD(TAG, "Binário lido: %s (%d bytes)", full_path, read);
+    ESP_LOGD(TAG, "Binário lido: %s (%zu bytes)", full_path, read);
     return ESP_OK;
 }
 
@@ -104,13 +105,13 @@ esp_err_t sd_read_line(const char *path, char *buffer, size_t buffer_size, uint3
             char *pos = strchr(buffer, '\n');
             if (pos) *pos = '\0';
             fclose(f);
-            ESP_LOGD(TAG, "Linha %lu lida", line_number);
+            ESP_LOGD(TAG, "Linha %" PRIu32 " lida", line_number);
             return ESP_OK;
         }
     }
 
     fclose(f);
-    ESP_LOGW(TAG, "Linha %lu não encontrada", line_number);
+    ESP_LOGW(TAG, "Linha %" PRIu32 " não encontrada", line_number);
     return ESP_ERR_NOT_FOUND;
 }
 
@@ -163,7 +164,7 @@ esp_err_t sd_count_lines(const char *path, uint32_t *line_count)
     }
 
     fclose(f);
-    ESP_LOGD(TAG, "Contagem: %lu linhas", *line_count);
+    ESP_LOGD(TAG, "Contagem: %" PRIu32 " linhas", *line_count);
     return ESP_OK;
 }
 
@@ -195,7 +196,7 @@ esp_err_t sd_read_chunk(const char *path, size_t offset, void *buffer, size_t si
         *bytes_read = read;
     }
 
-    ESP_LOGD(TAG, "Chunk lido: offset=%d, size=%d", offset, read);
+    ESP_LOGD(TAG, "Chunk lido: offset=%zu, size=%zu", offset, read);
     return ESP_OK;
 }
 
@@ -342,6 +343,6 @@ esp_err_t sd_count_occurrences(const char *path, const char *search, uint32_t *c
     }
 
     fclose(f);
-    ESP_LOGD(TAG, "Ocorrências de '%s': %lu", search, *count);
+    ESP_LOGD(TAG, "Ocorrências de '%s': %" PRIu32, search, *count);
     return ESP_OK;
 }
@@ -59,7 +59,7 @@ esp_err_t sd_write_string(const char *path, const char *data)
         return ESP_FAIL;
     }
 
-    ESP_LOGD(TAG, "Escrito: %s (%d bytes)", full_path, written);
+    ESP_LOGD(TAG, "Escrito: %s (%zu bytes)", full_path, written);
     return ESP_OK;
 }
 
@@ -87,7 +87,7 @@ esp_err_t sd_append_string(const char *path, const char *data)
         return ESP_FAIL;
     }
 
-    ESP_LOGD(TAG, "Anexado: %s (%d bytes)", full_path, written);
+    ESP_LOGD(TAG, "Anexado: %s (%zu bytes)", full_path, written);
     return ESP_OK;
 }
 
@@ -114,7 +114,7 @@ esp_err_t sd_write_binary(const char *path, const void *data, size_t size)
         return ESP_FAIL;
     }
 
-    ESP_LOGD(TAG, "Binário escrito: %s (%d bytes)", full_path, written);
+    ESP_LOGD(TAG, "Binário escrito: %s (%zu bytes)", full_path, written);
     return ESP_OK;
 }
 
@@ -141,7 +141,7 @@ esp_err_t sd_append_binary(const char *path, const void *data, size_t size)
         return ESP_FAIL;
     }
 
-    ESP_LOGD(TAG, "Binário anexado: %s (%d bytes)", full_path, written);
+    ESP_LOGD(TAG, "Binário anexado: %s (%zu bytes)", full_path, written);
     return ESP_OK;
 }
 
@@ -0,0 +1,40 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// storage_read.c de antes do vfs_stream (um vfs_read por byte nas funções de
+// linha e de busca), sem alteração, como referência para
+// bench_storage_read. Este cabeçalho é incluído antes dele para que as
+// funções ganhem o prefixo legacy_ e convivam com as atuais.
+
+#ifndef LEGACY_READ_NAMES_H
+#define LEGACY_READ_NAMES_H
+
+#define storage_count_lines          legacy_storage_count_lines
+#define storage_count_occurrences    legacy_storage_count_occurrences
+#define storage_file_contains        legacy_storage_file_contains
+#define storage_read_binary          legacy_storage_read_binary
+#define storage_read_byte            legacy_storage_read_byte
+#define storage_read_bytes           legacy_storage_read_bytes
+#define storage_read_chunk           legacy_storage_read_chunk
+#define storage_read_first_line      legacy_storage_read_first_line
+#define storage_read_float           legacy_storage_read_float
+#define storage_read_int             legacy_storage_read_int
+#define storage_read_last_line       legacy_storage_read_last_line
+#define storage_read_line            legacy_storage_read_line
+#define storage_read_lines           legacy_storage_read_lines
+#define storage_read_string          legacy_storage_read_string
+
+#endif // LEGACY_READ_NAMES_H
@@ -0,0 +1,520 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+#include <pthread.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <time.h>
+#include "mem_backend.h"
+
+typedef struct {
+    bool used;
+    bool linked;                // false = apagado, ainda aberto
+    bool is_dir;
+    char path[VFS_MAX_PATH];
+    uint8_t *data;
+    size_t len, cap;
+    time_t mtime;
+    int refs;
+} mem_node_t;
+
+typedef struct {
+    bool used;
+    int node;
+    off_t pos;
+    int flags;
+} mem_fd_t;
+
+struct vfs_dir_s {
+    char path[VFS_MAX_PATH];
+    int next;
+};
+
+static struct {
+    pthread_mutex_t lock;
+    char mount_point[VFS_MAX_NAME];
+    mem_node_t nodes[MEM_BACKEND_MAX_NODES];
+    mem_fd_t fds[MEM_BACKEND_MAX_OPEN];
+    mem_backend_calls_t calls;
+    uint32_t call_us, per_kb_us;
+    uint32_t spike_us;
+    unsigned spike_every;
+    unsigned fail_writes;
+    mem_backend_write_t writes[MEM_BACKEND_MAX_WRITES];
+    time_t clock;               // mtime que sempre avança
+} s_mem = { .lock = PTHREAD_MUTEX_INITIALIZER, .clock = 1000 };
+
+// Chamada do VFS: conta e ocupa o "barramento" pelo tempo simulado
+static void bus(unsigned *counter, size_t bytes) {
+    (*counter)++;
+    uint64_t us = s_mem.call_us + (uint64_t)s_mem.per_kb_us * bytes / 1024;
+    if (counter == &s_mem.calls.write && s_mem.spike_every && *counter % s_mem.spike_every == 0) {
+        us += s_mem.spike_us;
+    }
+    if (us) {
+        struct timespec ts = { .tv_sec = us / 1000000, .tv_nsec = (us % 1000000) * 1000 };
+        nanosleep(&ts, NULL);
+    }
+}
+
+#define ENTER(counter, bytes) do {                                          \
+        pthread_mutex_lock(&s_mem.lock);                                    \
+        bus(&s_mem.calls.counter, (bytes));                                 \
+    } while (0)
+#define LEAVE() pthread_mutex_unlock(&s_mem.lock)
+
+static int find(const char *path) {
+    for (int i = 0; i < MEM_BACKEND_MAX_NODES; i++) {
+        const mem_node_t *n = &s_mem.nodes[i];
+        if (n->used && n->linked && strcmp(n->path, path) == 0) return i;
+    }
+    return -1;
+}
+
+// Diretório pai existe (a raiz da montagem sempre existe)
+static bool parent_exists(const char *path) {
+    char parent[VFS_MAX_PATH];
+    snprintf(parent, sizeof(parent), "%s", path);
+    char *slash = strrchr(parent, '/');
+    if (!slash || slash == parent) return false;
+    *slash = '\0';
+    if (strcmp(parent, s_mem.mount_point) == 0) return true;
+    int i = find(parent);
+    return i >= 0 && s_mem.nodes[i].is_dir;
+}
+
+static int create(const char *path, bool is_dir) {
+    if (strlen(path) >= VFS_MAX_PATH || !parent_exists(path)) return -1;
+    for (int i = 0; i < MEM_BACKEND_MAX_NODES; i++) {
+        mem_node_t *n = &s_mem.nodes[i];
+        if (n->used) continue;
+        memset(n, 0, sizeof(*n));
+        n->used = n->linked = true;
+        n->is_dir = is_dir;
+        strcpy(n->path, path);
+        n->mtime = ++s_mem.clock;
+        return i;
+    }
+    return -1;
+}
+
+static void release(int node) {
+    mem_node_t *n = &s_mem.nodes[node];
+    if (n->linked || n->refs > 0) return;
+    free(n->data);
+    memset(n, 0, sizeof(*n));
+}
+
+static bool resize(mem_node_t *n, size_t len) {
+    if (len > n->cap) {
+        size_t cap = len * 2 + 256;
+        uint8_t *data = realloc(n->data, cap);
+        if (!data) return false;
+        n->data = data;
+        n->cap = cap;
+    }
+    if (len > n->len) memset(n->data + n->len, 0, len - n->len);
+    n->len = len;
+    n->mtime = ++s_mem.clock;
+    return true;
+}
+
+static mem_fd_t *get_fd(vfs_fd_t fd) {
+    if (fd < 0 || fd >= MEM_BACKEND_MAX_OPEN || !s_mem.fds[fd].used) return NULL;
+    return &s_mem.fds[fd];
+}
+
+static void fill_stat(const mem_node_t *n, vfs_stat_t *st) {
+    memset(st, 0, sizeof(*st));
+    const char *name = strrchr(n->path, '/');
+    strncpy(st->name, name ? name + 1 : n->path, sizeof(st->name) - 1);
+    st->type = n->is_dir ? VFS_TYPE_DIR : VFS_TYPE_FILE;
+    st->size = n->is_dir ? 0 : n->len;
+    st->mtime = st->ctime = n->mtime;
+    st->is_hidden = st->name[0] == '.';
+}
+
+/* ==== Operações ==== */
+
+static vfs_fd_t mem_open(const char *path, int flags, int mode) {
+    (void)mode;
+    ENTER(open, 0);
+    vfs_fd_t fd = VFS_INVALID_FD;
+    int node = find(path);
+    if (node >= 0 && (flags & O_CREAT) && (flags & O_EXCL)) goto out;
+    if (node < 0 && (!(flags & O_CREAT) || (node = create(path, false)) < 0)) goto out;
+    if (s_mem.nodes[node].is_dir) goto out;
+
+    for (int i = 0; i < MEM_BACKEND_MAX_OPEN; i++) {
+        if (!s_mem.fds[i].used) {
+            s_mem.fds[i] = (mem_fd_t){ .used = true, .node = node, .flags = flags };
+            mem_node_t *n = &s_mem.nodes[node];
+            n->refs++;
+            if (flags & O_TRUNC) {
+                n->len = 0;
+                n->mtime = ++s_mem.clock;
+            }
+            fd = i;
+            break;
+        }
+    }
+out:
+    LEAVE();
+    return fd;
+}
+
+static ssize_t mem_read(vfs_fd_t fd, void *buf, size_t size) {
+    ENTER(read, size);
+    ssize_t n = -1;
+    mem_fd_t *f = get_fd(fd);
+    if (f) {
+        const mem_node_t *node = &s_mem.nodes[f->node];
+        size_t left = (size_t)f->pos < node->len ? node->len - f->pos : 0;
+        n = size < left ? size : left;
+        if (n > 0) memcpy(buf, node->data + f->pos, n);
+        f->pos += n;
+        s_mem.calls.bytes_read += n;
+    }
+    LEAVE();
+    return n;
+}
+
+static ssize_t mem_write(vfs_fd_t fd, const void *buf, size_t size) {
+    ENTER(write, size);
+    ssize_t n = -1;
+    mem_fd_t *f = get_fd(fd);
+    if (f && s_mem.fail_writes) {
+        s_mem.fail_writes--;
+        f = NULL;
+    }
+    if (f) {
+        mem_node_t *node = &s_mem.nodes[f->node];
+        if (f->flags & O_APPEND) f->pos = node->len;
+        unsigned w = s_mem.calls.write - 1;
+        if (w < MEM_BACKEND_MAX_WRITES) {
+            s_mem.writes[w] = (mem_backend_write_t){ .offset = f->pos, .size = size };
+        }
+        size_t end = f->pos + size;
+        if (end <= node->len || resize(node, end)) {
+            if (size) memcpy(node->data + f->pos, buf, size);
+            node->mtime = ++s_mem.clock;
+            f->pos = end;
+            n = size;
+            s_mem.calls.bytes_written += size;
+        }
+    }
+    LEAVE();
+    return n;
+}
+
+static off_t mem_lseek(vfs_fd_t fd, off_t offset, int whence) {
+    ENTER(lseek, 0);
+    off_t to = -1;
+    mem_fd_t *f = get_fd(fd);
+    if (f) {
+        off_t base = whence == VFS_SEEK_SET ? 0 :
+                     whence == VFS_SEEK_CUR ? f->pos : (off_t)s_mem.nodes[f->node].len;
+        if (base + offset >= 0) to = f->pos = base + offset;
+    }
+    LEAVE();
+    return to;
+}
+
+static esp_err_t mem_close(vfs_fd_t fd) {
+    pthread_mutex_lock(&s_mem.lock);
+    esp_err_t ret = ESP_ERR_INVALID_ARG;
+    mem_fd_t *f = get_fd(fd);
+    if (f) {
+        s_mem.calls.close++;
+        s_mem.nodes[f->node].refs--;
+        release(f->node);
+        f->used = false;
+        ret = ESP_OK;
+    }
+    LEAVE();
+    return ret;
+}
+
+static esp_err_t mem_fsync(vfs_fd_t fd) {
+    ENTER(fsync, 0);
+    esp_err_t ret = get_fd(fd) ? ESP_OK : ESP_ERR_INVALID_ARG;
+    LEAVE();
+    return ret;
+}
+
+static esp_err_t mem_stat(const char *path, vfs_stat_t *st) {
+    ENTER(stat, 0);
+    int node = find(path);
+    if (node >= 0) fill_stat(&s_mem.nodes[node], st);
+    LEAVE();
+    return node >= 0 ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+static esp_err_t mem_fstat(vfs_fd_t fd, vfs_stat_t *st) {
+    ENTER(fstat, 0);
+    mem_fd_t *f = get_fd(fd);
+    if (f) fill_stat(&s_mem.nodes[f->node], st);
+    LEAVE();
+    return f ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+static esp_err_t mem_rename(const char *old_path, const char *new_path) {
+    ENTER(rename, 0);
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    int node = find(old_path);
+    if (node >= 0 && parent_exists(new_path) && strlen(new_path) < VFS_MAX_PATH) {
+        int target = find(new_path);
+        if (target >= 0 && target != node) {
+            s_mem.nodes[target].linked = false;
+            release(target);
+        }
+        strcpy(s_mem.nodes[node].path, new_path);
+        s_mem.nodes[node].mtime = ++s_mem.clock;
+        ret = ESP_OK;
+    }
+    LEAVE();
+    return ret;
+}
+
+static esp_err_t mem_unlink(const char *path) {
+    ENTER(unlink, 0);
+    int node = find(path);
+    if (node >= 0 && !s_mem.nodes[node].is_dir) {
+        s_mem.nodes[node].linked = false;
+        release(node);
+    }
+    LEAVE();
+    return node >= 0 ? ESP_OK : ESP_ERR_NOT_FOUND;
+}
+
+static esp_err_t mem_truncate(const char *path, off_t length) {
+    ENTER(truncate, 0);
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    int node = find(path);
+    if (node >= 0 && length >= 0) {
+        mem_node_t *n = &s_mem.nodes[node];
+        if ((size_t)length <= n->len) {
+            n->len = length;
+            n->mtime = ++s_mem.clock;
+            ret = ESP_OK;
+        } else {
+            ret = resize(n, length) ? ESP_OK : ESP_ERR_NO_MEM;
+        }
+    }
+    LEAVE();
+    return ret;
+}
+
+static esp_err_t mem_mkdir(const char *path, int mode) {
+    (void)mode;
+    ENTER(mkdir, 0);
+    esp_err_t ret = find(path) >= 0 ? ESP_ERR_INVALID_STATE :
+                    create(path, true) >= 0 ? ESP_OK : ESP_FAIL;
+    LEAVE();
+    return ret;
+}
+
+static esp_err_t mem_rmdir(const char *path) {
+    ENTER(rmdir, 0);
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    int node = find(path);
+    if (node >= 0 && s_mem.nodes[node].is_dir) {
+        size_t len = strlen(path);
+        ret = ESP_OK;
+        for (int i = 0; i < MEM_BACKEND_MAX_NODES && ret == ESP_OK; i++) {
+            const mem_node_t *n = &s_mem.nodes[i];
+            if (n->used && n->linked && strncmp(n->path, path, len) == 0 && n->path[len] == '/') {
+                ret = ESP_ERR_INVALID_STATE;    // Não está vazio
+            }
+        }
+        if (ret == ESP_OK) {
+            s_mem.nodes[node].linked = false;
+            release(node);
+        }
+    }
+    LEAVE();
+    return ret;
+}
+
+static vfs_dir_t mem_opendir(const char *path) {
+    ENTER(opendir, 0);
+    vfs_dir_t dir = NULL;
+    int node = find(path);
+    if (strcmp(path, s_mem.mount_point) == 0 || (node >= 0 && s_mem.nodes[node].is_dir)) {
+        dir = calloc(1, sizeof(*dir));
+        if (dir) snprintf(dir->path, sizeof(dir->path), "%s", path);
+    }
+    LEAVE();
+    return dir;
+}
+
+static esp_err_t mem_readdir(vfs_dir_t dir, vfs_stat_t *entry) {
+    ENTER(readdir, 0);
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    size_t len = strlen(dir->path);
+    while (dir->next < MEM_BACKEND_MAX_NODES && ret != ESP_OK) {
+        const mem_node_t *n = &s_mem.nodes[dir->next++];
+        if (n->used && n->linked && strncmp(n->path, dir->path, len) == 0 &&
+            n->path[len] == '/' && !strchr(n->path + len + 1, '/')) {
+            fill_stat(n, entry);
+            ret = ESP_OK;
+        }
+    }
+    LEAVE();
+    return ret;
+}
+
+static esp_err_t mem_closedir(vfs_dir_t dir) {
+    free(dir);
+    return ESP_OK;
+}
+
+static esp_err_t mem_statvfs(vfs_statvfs_t *stat) {
+    pthread_mutex_lock(&s_mem.lock);
+    uint64_t used = 0;
+    for (int i = 0; i < MEM_BACKEND_MAX_NODES; i++) {
+        if (s_mem.nodes[i].used) used += s_mem.nodes[i].len;
+    }
+    LEAVE();
+    memset(stat, 0, sizeof(*stat));
+    stat->total_bytes = 64ull << 20;
+    stat->used_bytes = used;
+    stat->free_bytes = stat->total_bytes - used;
+    stat->block_size = 512;
+    return ESP_OK;
+}
+
+static const vfs_backend_ops_t s_mem_ops = {
+    .open = mem_open, .read = mem_read, .write = mem_write, .lseek = mem_lseek,
+    .close = mem_close, .fsync = mem_fsync,
+    .stat = mem_stat, .fstat = mem_fstat, .rename = mem_rename,
+    .unlink = mem_unlink, .truncate = mem_truncate,
+    .mkdir = mem_mkdir, .rmdir = mem_rmdir,
+    .opendir = mem_opendir, .readdir = mem_readdir, .closedir = mem_closedir,
+    .statvfs = mem_statvfs,
+};
+
+/* ==== Controle ==== */
+
+esp_err_t mem_backend_mount(const char *mount_point, uint32_t flags) {
+    snprintf(s_mem.mount_point, sizeof(s_mem.mount_point), "%s", mount_point);
+    return vfs_register_backend(&(vfs_backend_config_t){
+        .type = VFS_BACKEND_RAMFS,
+        .mount_point = s_mem.mount_point,
+        .ops = &s_mem_ops,
+        .flags = flags,
+    });
+}
+
+esp_err_t mem_backend_unmount(void) {
+    esp_err_t ret = vfs_unregister_backend(s_mem.mount_point);
+    pthread_mutex_lock(&s_mem.lock);
+    for (int i = 0; i < MEM_BACKEND_MAX_NODES; i++) {
+        free(s_mem.nodes[i].data);
+    }
+    memset(s_mem.nodes, 0, sizeof(s_mem.nodes));
+    memset(s_mem.fds, 0, sizeof(s_mem.fds));
+    LEAVE();
+    return ret;
+}
+
+void mem_backend_get_calls(mem_backend_calls_t *calls) {
+    pthread_mutex_lock(&s_mem.lock);
+    *calls = s_mem.calls;
+    LEAVE();
+}
+
+void mem_backend_reset_calls(void) {
+    pthread_mutex_lock(&s_mem.lock);
+    memset(&s_mem.calls, 0, sizeof(s_mem.calls));
+    LEAVE();
+}
+
+void mem_backend_set_latency(uint32_t call_us, uint32_t per_kb_us) {
+    pthread_mutex_lock(&s_mem.lock);
+    s_mem.call_us = call_us;
+    s_mem.per_kb_us = per_kb_us;
+    LEAVE();
+}
+
+void mem_backend_set_spikes(uint32_t spike_us, unsigned every) {
+    pthread_mutex_lock(&s_mem.lock);
+    s_mem.spike_us = spike_us;
+    s_mem.spike_every = every;
+    LEAVE();
+}
+
+void mem_backend_fail_writes(unsigned count) {
+    pthread_mutex_lock(&s_mem.lock);
+    s_mem.fail_writes = count;
+    LEAVE();
+}
+
+size_t mem_backend_get_writes(mem_backend_write_t *out, size_t max) {
+    pthread_mutex_lock(&s_mem.lock);
+    size_t n = s_mem.calls.write < MEM_BACKEND_MAX_WRITES ? s_mem.calls.write : MEM_BACKEND_MAX_WRITES;
+    if (n > max) n = max;
+    memcpy(out, s_mem.writes, n * sizeof(out[0]));
+    LEAVE();
+    return n;
+}
+
+esp_err_t mem_backend_put(const char *path, const void *data, size_t len) {
+    pthread_mutex_lock(&s_mem.lock);
+    int node = find(path);
+    if (node < 0) node = create(path, false);
+    esp_err_t ret = ESP_ERR_NO_MEM;
+    if (node >= 0) {
+        s_mem.nodes[node].len = 0;
+        if (resize(&s_mem.nodes[node], len)) {
+            if (len) memcpy(s_mem.nodes[node].data, data, len);
+            ret = ESP_OK;
+        }
+    }
+    LEAVE();
+    return ret;
+}
+
+esp_err_t mem_backend_patch(const char *path, size_t offset, const void *data, size_t len) {
+    pthread_mutex_lock(&s_mem.lock);
+    int node = find(path);
+    esp_err_t ret = ESP_ERR_NOT_FOUND;
+    if (node >= 0) {
+        mem_node_t *n = &s_mem.nodes[node];
+        ret = ESP_ERR_NO_MEM;
+        if (offset + len <= n->len || resize(n, offset + len)) {
+            memcpy(n->data + offset, data, len);
+            n->mtime = ++s_mem.clock;
+            ret = ESP_OK;
+        }
+    }
+    LEAVE();
+    return ret;
+}
+
+bool mem_backend_get(const char *path, void *buf, size_t size, size_t *len) {
+    pthread_mutex_lock(&s_mem.lock);
+    int node = find(path);
+    if (node >= 0) {
+        const mem_node_t *n = &s_mem.nodes[node];
+        if (n->len && size) memcpy(buf, n->data, n->len < size ? n->len : size);
+        if (len) *len = n->len;
+    }
+    LEAVE();
+    return node >= 0;
+}
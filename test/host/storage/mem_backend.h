@@ -0,0 +1,72 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Backend em memória instrumentado para os testes do vfs_core: conta as
+// chamadas que chegam do VFS e pode simular a latência de um cartão SD
+// (cada chamada ocupa o "barramento" pelo tempo configurado). Os arquivos
+// também podem ser lidos e alterados por fora do VFS, como faria um fopen
+// direto na mesma montagem.
+
+#ifndef MEM_BACKEND_H
+#define MEM_BACKEND_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "vfs_core.h"
+
+#define MEM_BACKEND_MAX_NODES   64      // Arquivos + diretórios
+#define MEM_BACKEND_MAX_OPEN    32
+
+typedef struct {
+    unsigned open, close, read, write, lseek, fsync;
+    unsigned stat, fstat, rename, unlink, truncate;
+    unsigned mkdir, rmdir, opendir, readdir;
+    uint64_t bytes_read, bytes_written;
+} mem_backend_calls_t;
+
+// Registra no VFS; flags = VFS_BACKEND_FLAG_*
+esp_err_t mem_backend_mount(const char *mount_point, uint32_t flags);
+esp_err_t mem_backend_unmount(void);
+
+void mem_backend_get_calls(mem_backend_calls_t *calls);
+void mem_backend_reset_calls(void);
+
+// Cada chamada leva call_us, mais per_kb_us por KB transferido
+void mem_backend_set_latency(uint32_t call_us, uint32_t per_kb_us);
+
+// Pico de latência: uma a cada `every` escritas leva spike_us a mais (0 = sem)
+void mem_backend_set_spikes(uint32_t spike_us, unsigned every);
+
+// As próximas `count` escritas falham
+void mem_backend_fail_writes(unsigned count);
+
+// Escritas desde o último mem_backend_reset_calls() (até MEM_BACKEND_MAX_WRITES)
+#define MEM_BACKEND_MAX_WRITES  8192
+
+typedef struct {
+    off_t offset;
+    size_t size;
+} mem_backend_write_t;
+
+size_t mem_backend_get_writes(mem_backend_write_t *out, size_t max);
+
+// Acesso direto, sem passar pelo VFS (nem pelos contadores)
+esp_err_t mem_backend_put(const char *path, const void *data, size_t len);
+esp_err_t mem_backend_patch(const char *path, size_t offset, const void *data, size_t len);
+bool mem_backend_get(const char *path, void *buf, size_t size, size_t *len);
+
+#endif // MEM_BACKEND_H
@@ -0,0 +1,322 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Compilado duas vezes: direto (shim) e com legacy_sd_names.h (antigo). Os
+// caminhos usam a forma "/x", que todos os módulos antigos aceitavam.
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdarg.h>
+#include "sd_card_init.h"
+#include "sd_card_info.h"
+#include "sd_card_file.h"
+#include "sd_card_dir.h"
+#include "sd_card_read.h"
+#include "sd_card_write.h"
+#include "sd_scenario.h"
+
+static sd_trace_t *trace;
+
+// Um passo: "<nome>: ok <valores>" ou "<nome>: erro"; o código fica em err[]
+static void step(const char *name, esp_err_t rc, const char *fmt, ...) {
+    if (trace->count >= SD_TRACE_STEPS) return;
+    char *line = trace->line[trace->count];
+    int n = snprintf(line, SD_TRACE_LINE, "%s: %s", name, rc == ESP_OK ? "ok" : "erro");
+    if (rc == ESP_OK && fmt && n < SD_TRACE_LINE) {
+        line[n++] = ' ';
+        va_list ap;
+        va_start(ap, fmt);
+        vsnprintf(line + n, SD_TRACE_LINE - n, fmt, ap);
+        va_end(ap);
+    }
+    trace->err[trace->count++] = rc;
+}
+
+// Texto com quebras visíveis no registro
+static const char *shown(const char *s) {
+    static char out[SD_TRACE_LINE];
+    size_t j = 0;
+    for (size_t i = 0; s[i] && j < sizeof(out) - 3; i++) {
+        if (s[i] == '\n') {
+            out[j++] = '\\';
+            out[j++] = 'n';
+        } else {
+            out[j++] = s[i];
+        }
+    }
+    out[j] = '\0';
+    return out;
+}
+
+typedef struct {
+    int count;
+    char text[SD_TRACE_LINE];
+} collect_t;
+
+static void on_line(const char *line, void *arg) {
+    collect_t *c = arg;
+    size_t len = strlen(c->text);
+    snprintf(c->text + len, sizeof(c->text) - len, "%s%s", c->count ? "|" : "", line);
+    c->count++;
+}
+
+// Nomes em ordem alfabética: a ordem do readdir não é parte do contrato
+static char names[16][64];
+static int name_count;
+
+static void on_entry(const char *name, bool is_dir, void *arg) {
+    (void)arg;
+    if (name_count < 16) {
+        snprintf(names[name_count++], sizeof(names[0]), "%s%s", name, is_dir ? "/" : "");
+    }
+}
+
+static int cmp_names(const void *a, const void *b) {
+    return strcmp(a, b);
+}
+
+static const char *listed(void) {
+    static char out[SD_TRACE_LINE];
+    qsort(names, name_count, sizeof(names[0]), cmp_names);
+    out[0] = '\0';
+    for (int i = 0; i < name_count; i++) {
+        size_t len = strlen(out);
+        snprintf(out + len, sizeof(out) - len, "%s%s", i ? " " : "", names[i]);
+    }
+    name_count = 0;
+    return out;
+}
+
+static void text_files(void) {
+    char buf[256];
+    size_t size;
+    uint32_t n;
+    bool b;
+    esp_err_t rc;
+
+    step("dir_create /ct", sd_dir_create("/ct"), NULL);
+    step("write_string", sd_write_string("/ct/a.txt", "alpha\nbeta\n"), NULL);
+    step("append_line", sd_append_line("/ct/a.txt", "gamma"), NULL);
+    step("append_formatted", sd_append_formatted("/ct/a.txt", "%s=%d\n", "delta", 4), NULL);
+    step("append_string", sd_append_string("/ct/a.txt", "tail"), NULL);
+
+    rc = sd_read_string("/ct/a.txt", buf, sizeof(buf));
+    step("read_string", rc, "%s", shown(buf));
+    rc = sd_read_string("/ct/a.txt", buf, 8);
+    step("read_string curto", rc, "%s", shown(buf));
+    rc = sd_file_get_size("/ct/a.txt", &size);
+    step("get_size", rc, "%zu", size);
+    rc = sd_count_lines("/ct/a.txt", &n);
+    step("count_lines", rc, "%lu", (unsigned long)n);
+    for (uint32_t line = 1; line <= 6; line++) {
+        char name[32];
+        snprintf(name, sizeof(name), "read_line %lu", (unsigned long)line);
+        rc = sd_read_line("/ct/a.txt", buf, sizeof(buf), line);
+        step(name, rc, "%s", buf);
+    }
+    rc = sd_read_first_line("/ct/a.txt", buf, sizeof(buf));
+    step("read_first_line", rc, "%s", buf);
+    rc = sd_read_last_line("/ct/a.txt", buf, sizeof(buf));
+    step("read_last_line", rc, "%s", buf);
+
+    collect_t c = { 0 };
+    rc = sd_read_lines("/ct/a.txt", on_line, &c);
+    step("read_lines", rc, "%d %s", c.count, c.text);
+
+    memset(buf, 0, sizeof(buf));
+    rc = sd_read_chunk("/ct/a.txt", 6, buf, 4, &size);
+    step("read_chunk", rc, "%zu %.4s", size, buf);
+    rc = sd_read_chunk("/ct/a.txt", 30, buf, 16, &size);
+    step("read_chunk fim", rc, "%zu %.*s", size, (int)size, buf);
+    rc = sd_read_binary("/ct/a.txt", buf, 5, &size);
+    step("read_binary", rc, "%zu %.5s", size, buf);
+
+    rc = sd_file_contains("/ct/a.txt", "gam", &b);
+    step("contains sim", rc, "%d", b);
+    rc = sd_file_contains("/ct/a.txt", "zeta", &b);
+    step("contains não", rc, "%d", b);
+    rc = sd_count_occurrences("/ct/a.txt", "a", &n);
+    step("count_occurrences", rc, "%lu", (unsigned long)n);
+
+    step("write_line", sd_write_line("/ct/w.txt", "only"), NULL);
+    rc = sd_read_string("/ct/w.txt", buf, sizeof(buf));
+    step("read write_line", rc, "%s", shown(buf));
+    step("write_formatted", sd_write_formatted("/ct/w.txt", "%05d|%s", 42, "x"), NULL);
+    rc = sd_read_string("/ct/w.txt", buf, sizeof(buf));
+    step("read write_formatted", rc, "%s", shown(buf));
+
+    const char *row1[] = { "id", "name", "value" };
+    const char *row2[] = { "1", "foo", "3.5" };
+    step("write_csv_row", sd_write_csv_row("/ct/t.csv", row1, 3), NULL);
+    step("append_csv_row", sd_append_csv_row("/ct/t.csv", row2, 3), NULL);
+    rc = sd_read_string("/ct/t.csv", buf, sizeof(buf));
+    step("read csv", rc, "%s", shown(buf));
+}
+
+static void values(void) {
+    int32_t i;
+    float f;
+    uint8_t byte, bytes[8];
+    size_t count;
+    char buf[64];
+    esp_err_t rc;
+
+    step("write_int", sd_write_int("/ct/i.txt", -1234), NULL);
+    rc = sd_read_int("/ct/i.txt", &i);
+    step("read_int", rc, "%ld", (long)i);
+    rc = sd_read_string("/ct/i.txt", buf, sizeof(buf));
+    step("int em texto", rc, "%s", shown(buf));
+
+    step("write_float", sd_write_float("/ct/f.txt", 2.5f), NULL);
+    rc = sd_read_float("/ct/f.txt", &f);
+    step("read_float", rc, "%.3f", f);
+    rc = sd_read_string("/ct/f.txt", buf, sizeof(buf));
+    step("float em texto", rc, "%s", shown(buf));
+
+    step("write_byte", sd_write_byte("/ct/b.bin", 0xA5), NULL);
+    rc = sd_read_byte("/ct/b.bin", &byte);
+    step("read_byte", rc, "%02x", byte);
+
+    const uint8_t data[] = { 1, 2, 0, 4, 5 };
+    step("write_bytes", sd_write_bytes("/ct/b.bin", data, sizeof(data)), NULL);
+    step("append_binary", sd_append_binary("/ct/b.bin", data, 2), NULL);
+    rc = sd_read_bytes("/ct/b.bin", bytes, sizeof(bytes), &count);
+    step("read_bytes", rc, "%zu %02x%02x%02x%02x%02x%02x%02x", count,
+         bytes[0], bytes[1], bytes[2], bytes[3], bytes[4], bytes[5], bytes[6]);
+    rc = sd_read_bytes("/ct/b.bin", bytes, 3, &count);
+    step("read_bytes curto", rc, "%zu", count);
+    step("write_buffer", sd_write_buffer("/ct/b.bin", data, 3), NULL);
+    step("write_binary", sd_write_binary("/ct/c.bin", data, 4), NULL);
+    rc = sd_read_binary("/ct/b.bin", bytes, sizeof(bytes), &count);
+    step("read_binary", rc, "%zu", count);
+}
+
+static void file_ops(void) {
+    size_t size;
+    bool b;
+    char buf[64];
+    sd_file_info_t info;
+    esp_err_t rc;
+
+    step("exists a", sd_file_exists("/ct/a.txt") ? ESP_OK : ESP_FAIL, NULL);
+    step("exists nada", sd_file_exists("/ct/none.txt") ? ESP_OK : ESP_FAIL, NULL);
+    step("copy", sd_file_copy("/ct/a.txt", "/ct/copy.txt"), NULL);
+    rc = sd_file_compare("/ct/a.txt", "/ct/copy.txt", &b);
+    step("compare igual", rc, "%d", b);
+    rc = sd_file_compare("/ct/a.txt", "/ct/w.txt", &b);
+    step("compare diferente", rc, "%d", b);
+    step("rename", sd_file_rename("/ct/copy.txt", "/ct/renamed.txt"), NULL);
+    step("exists antigo", sd_file_exists("/ct/copy.txt") ? ESP_OK : ESP_FAIL, NULL);
+    step("truncate", sd_file_truncate("/ct/renamed.txt", 5), NULL);
+    rc = sd_read_string("/ct/renamed.txt", buf, sizeof(buf));
+    step("read truncado", rc, "%s", shown(buf));
+    rc = sd_file_is_empty("/ct/renamed.txt", &b);
+    step("is_empty não", rc, "%d", b);
+    step("clear", sd_file_clear("/ct/renamed.txt"), NULL);
+    rc = sd_file_is_empty("/ct/renamed.txt", &b);
+    step("is_empty sim", rc, "%d", b);
+    step("move", sd_file_move("/ct/renamed.txt", "/ct/moved.txt"), NULL);
+    rc = sd_file_get_size("/ct/moved.txt", &size);
+    step("size movido", rc, "%zu", size);
+
+    memset(&info, 0, sizeof(info));
+    rc = sd_file_get_info("/ct/a.txt", &info);
+    step("get_info", rc, "%zu %d %s", info.size, info.is_directory, info.path);
+    rc = sd_file_get_extension("/ct/t.csv", buf, sizeof(buf));
+    step("get_extension", rc, "%s", buf);
+    rc = sd_file_get_extension("/ct/noext", buf, sizeof(buf));
+    step("get_extension sem", rc, "%s", buf);
+    step("delete", sd_file_delete("/ct/moved.txt"), NULL);
+
+    // Arquivo que não existe: só o sucesso/erro é comparado
+    step("read_string nada", sd_read_string("/ct/none.txt", buf, sizeof(buf)), NULL);
+    step("get_size nada", sd_file_get_size("/ct/none.txt", &size), NULL);
+    step("delete nada", sd_file_delete("/ct/none.txt"), NULL);
+    step("copy nada", sd_file_copy("/ct/none.txt", "/ct/x.txt"), NULL);
+    step("rename nada", sd_file_rename("/ct/none.txt", "/ct/x.txt"), NULL);
+    step("read_line nada", sd_read_line("/ct/none.txt", buf, sizeof(buf), 1), NULL);
+    step("exists x", sd_file_exists("/ct/x.txt") ? ESP_OK : ESP_FAIL, NULL);
+}
+
+static void dirs(void) {
+    uint32_t files, dirs;
+    uint64_t total;
+    esp_err_t rc;
+
+    step("dir_create t", sd_dir_create("/ct/t"), NULL);
+    step("dir_create t/s", sd_dir_create("/ct/t/s"), NULL);
+    step("dir_create de novo", sd_dir_create("/ct/t/s"), NULL);
+    step("write t/r", sd_write_string("/ct/t/r.txt", "root file"), NULL);
+    step("write t/s/deep", sd_write_string("/ct/t/s/deep.txt", "deep\n"), NULL);
+    step("dir_exists", sd_dir_exists("/ct/t/s") ? ESP_OK : ESP_FAIL, NULL);
+    step("dir_exists arquivo", sd_dir_exists("/ct/t/r.txt") ? ESP_OK : ESP_FAIL, NULL);
+
+    rc = sd_dir_list("/ct/t", on_entry, NULL);
+    step("dir_list", rc, "%s", listed());
+    rc = sd_dir_count("/ct/t", &files, &dirs);
+    step("dir_count", rc, "%lu %lu", (unsigned long)files, (unsigned long)dirs);
+    rc = sd_dir_get_size("/ct/t", &total);
+    step("dir_get_size", rc, "%llu", (unsigned long long)total);
+
+    step("copy_recursive", sd_dir_copy_recursive("/ct/t", "/ct/t2"), NULL);
+    rc = sd_dir_list("/ct/t2/s", on_entry, NULL);
+    step("dir_list cópia", rc, "%s", listed());
+    rc = sd_dir_get_size("/ct/t2", &total);
+    step("dir_get_size cópia", rc, "%llu", (unsigned long long)total);
+    step("remove_recursive", sd_dir_remove_recursive("/ct/t2"), NULL);
+    step("dir_exists removido", sd_dir_exists("/ct/t2") ? ESP_OK : ESP_FAIL, NULL);
+    step("dir_list nada", sd_dir_list("/ct/none", on_entry, NULL), NULL);
+    name_count = 0;
+
+    rc = sd_dir_list("/ct", on_entry, NULL);
+    step("dir_list ct", rc, "%s", listed());
+}
+
+static void card(void) {
+    sd_card_info_t info;
+    sd_fs_stats_t stats;
+    uint64_t bytes;
+    uint32_t value;
+    char name[16];
+    esp_err_t rc;
+
+    step("is_mounted", sd_is_mounted() ? ESP_OK : ESP_FAIL, NULL);
+    rc = sd_get_card_info(&info);
+    step("card_info", rc, "%s %lu %lu %lu %d", info.name, (unsigned long)info.capacity_mb,
+         (unsigned long)info.sector_size, (unsigned long)info.num_sectors, info.is_mounted);
+    rc = sd_get_card_name(name, sizeof(name));
+    step("card_name", rc, "%s", name);
+    rc = sd_get_capacity(&value);
+    step("capacity", rc, "%lu", (unsigned long)value);
+    rc = sd_get_fs_stats(&stats);
+    step("fs_stats", rc, "%llu %llu %llu", (unsigned long long)stats.total_bytes,
+         (unsigned long long)stats.used_bytes, (unsigned long long)stats.free_bytes);
+    rc = sd_get_free_space(&bytes);
+    step("free_space", rc, "%llu", (unsigned long long)bytes);
+    rc = sd_get_total_space(&bytes);
+    step("total_space", rc, "%llu", (unsigned long long)bytes);
+    step("check_health", sd_check_health(), NULL);
+}
+
+void sd_scenario_run(sd_trace_t *t) {
+    trace = t;
+    trace->count = 0;
+    text_files();
+    values();
+    file_ops();
+    dirs();
+    card();
+}
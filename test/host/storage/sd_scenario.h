@@ -0,0 +1,38 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Roteiro de chamadas sd_* para test_sd_compat. O mesmo sd_scenario.c é
+// compilado contra a implementação antiga (legacy_sd_card/) e contra o shim;
+// cada passo vira uma linha do registro (resultado e valores lidos), e os
+// dois registros têm que bater.
+
+#ifndef SD_SCENARIO_H
+#define SD_SCENARIO_H
+
+#include "esp_err.h"
+
+#define SD_TRACE_STEPS      256
+#define SD_TRACE_LINE       160
+
+typedef struct {
+    char line[SD_TRACE_STEPS][SD_TRACE_LINE];
+    esp_err_t err[SD_TRACE_STEPS];      // Código devolvido em cada passo
+    int count;
+} sd_trace_t;
+
+// Roda o roteiro no cartão já montado; os arquivos ficam em /ct
+void sd_scenario_run(sd_trace_t *trace);
+
+#endif // SD_SCENARIO_H
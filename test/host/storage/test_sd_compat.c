@@ -0,0 +1,187 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// O sd_card_compat.c contra a implementação antiga do sd_card
+// (legacy_sd_card/): o mesmo roteiro de chamadas sd_* roda nas duas, cada uma
+// com o seu cartão simulado, e tem que dar os mesmos resultados e deixar os
+// mesmos arquivos no cartão.
+//
+// O que mudou de propósito fica fora do roteiro e é verificado à parte:
+//   - os códigos de erro são os da storage API (o antigo devolvia ESP_FAIL
+//     para quase tudo); o roteiro só compara sucesso/erro
+//   - card_type era o byte baixo do OCR, agora é SD_CARD_TYPE_*
+//   - com o cartão desmontado todas as funções devolvem ESP_ERR_INVALID_STATE
+//     (o antigo variava entre INVALID_ARG e INVALID_STATE)
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include "sd_card_init.h"
+#include "sd_card_info.h"
+#include "sd_card_read.h"
+#include "sd_card_write.h"
+#include "sd_scenario.h"
+#include "storage.h"
+#include "spi.h"
+#include "fake_fs.h"
+#include "host_test.h"
+
+// Implementação antiga (legacy_sd_names.h)
+esp_err_t legacy_sd_init(void);
+esp_err_t legacy_sd_deinit(void);
+bool legacy_sd_is_mounted(void);
+esp_err_t legacy_sd_get_card_type(uint8_t *type);
+esp_err_t legacy_sd_read_string(const char *path, char *buffer, size_t buffer_size);
+void legacy_sd_scenario_run(sd_trace_t *trace);
+
+static sd_trace_t old_trace, shim_trace;
+static uint8_t old_card_type;
+static char old_root[300], shim_root[300];
+
+// ========== REGISTROS ==========
+
+static void compare_traces(void) {
+    host_test_section("roteiro");
+    CHECK(old_trace.count > 90);
+    CHECK_EQ(shim_trace.count, old_trace.count);
+
+    int codes = 0;
+    for (int i = 0; i < old_trace.count && i < shim_trace.count; i++) {
+        host_checks++;
+        if (strcmp(old_trace.line[i], shim_trace.line[i]) != 0) {
+            char detail[2 * SD_TRACE_LINE + 32];
+            snprintf(detail, sizeof(detail), "antigo \"%s\", shim \"%s\"",
+                     old_trace.line[i], shim_trace.line[i]);
+            host_check_failed(__FILE__, __LINE__, "passo do roteiro", detail);
+        } else if (old_trace.err[i] != shim_trace.err[i]) {
+            printf("   código mudou em \"%s\": %s -> %s\n", old_trace.line[i],
+                   esp_err_to_name(old_trace.err[i]), esp_err_to_name(shim_trace.err[i]));
+            codes++;
+        }
+    }
+    printf("   %d passos iguais, %d com outro código de erro\n", old_trace.count, codes);
+}
+
+// ========== ARQUIVOS ==========
+
+static bool same_file(const char *a, const char *b) {
+    FILE *fa = fopen(a, "rb"), *fb = fopen(b, "rb");
+    bool same = fa && fb;
+    while (same) {
+        int ca = fgetc(fa), cb = fgetc(fb);
+        same = ca == cb;
+        if (ca == EOF) break;
+    }
+    if (fa) fclose(fa);
+    if (fb) fclose(fb);
+    return same;
+}
+
+// Entradas de `a` que não existem (ou diferem) em `b`
+static int tree_diff(const char *a, const char *b) {
+    DIR *dir = opendir(a);
+    if (!dir) return 1;
+    int diff = 0;
+    struct dirent *ent;
+    while ((ent = readdir(dir)) != NULL) {
+        if (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0) continue;
+        char pa[600], pb[600];
+        snprintf(pa, sizeof(pa), "%s/%s", a, ent->d_name);
+        snprintf(pb, sizeof(pb), "%s/%s", b, ent->d_name);
+        struct stat sa, sb;
+        if (stat(pa, &sa) != 0 || stat(pb, &sb) != 0 || S_ISDIR(sa.st_mode) != S_ISDIR(sb.st_mode)) {
+            printf("   só em %s: %s\n", a, ent->d_name);
+            diff++;
+        } else if (S_ISDIR(sa.st_mode)) {
+            diff += tree_diff(pa, pb);
+        } else if (!same_file(pa, pb)) {
+            printf("   conteúdo diferente: %s\n", pb);
+            diff++;
+        }
+    }
+    closedir(dir);
+    return diff;
+}
+
+static void compare_cards(void) {
+    host_test_section("arquivos no cartão");
+    char a[320], b[320];
+    snprintf(a, sizeof(a), "%s/sdcard/ct", old_root);
+    snprintf(b, sizeof(b), "%s/sdcard/ct", shim_root);
+    CHECK_EQ(tree_diff(a, b), 0);
+    CHECK_EQ(tree_diff(b, a), 0);
+}
+
+// ========== MUDANÇAS INTENCIONAIS ==========
+
+static void intended_changes(void) {
+    host_test_section("mudanças intencionais");
+    uint8_t type;
+    char buf[32];
+
+    // O antigo devolvia o byte baixo do OCR: um SDHC aparecia como 0 (SDSC)
+    CHECK_EQ(old_card_type, 0);
+    CHECK_OK(sd_get_card_type(&type));
+    CHECK_EQ(type, SD_CARD_TYPE_SDHC);
+    CHECK_OK(sd_get_card_type_name(buf, sizeof(buf)));
+    CHECK_STR(buf, "SDHC/SDXC");
+
+    // Arquivo que não existe (o antigo devolvia ESP_FAIL)
+    CHECK_EQ(sd_read_string("/ct/none.txt", buf, sizeof(buf)), ESP_ERR_NOT_FOUND);
+
+    // Cartão desmontado: a flash continua montada e o cartão responde
+    // INVALID_STATE (o antigo, desmontado, respondia INVALID_ARG)
+    CHECK_EQ(legacy_sd_read_string("/ct/a.txt", buf, sizeof(buf)), ESP_ERR_INVALID_ARG);
+    CHECK_OK(sd_deinit());
+    CHECK(!sd_is_mounted());
+    CHECK(storage_is_mounted());
+    CHECK_EQ(sd_read_string("/ct/a.txt", buf, sizeof(buf)), ESP_ERR_INVALID_STATE);
+    CHECK_EQ(sd_write_string("/ct/a.txt", "x"), ESP_ERR_INVALID_STATE);
+    CHECK_EQ(sd_get_card_type(&type), ESP_ERR_INVALID_STATE);
+    CHECK_OK(sd_remount());
+    CHECK(sd_is_mounted());
+    CHECK_OK(sd_read_string("/ct/i.txt", buf, sizeof(buf)));
+    CHECK_STR(buf, "-1234");
+}
+
+int main(void) {
+    CHECK_OK(spi_init());
+    snprintf(old_root, sizeof(old_root), "%s/legacy", host_test_tmpdir());
+    snprintf(shim_root, sizeof(shim_root), "%s/shim", host_test_tmpdir());
+
+    host_test_section("implementação antiga");
+    fake_fs_set_root(old_root);
+    CHECK_OK(legacy_sd_init());
+    legacy_sd_scenario_run(&old_trace);
+    CHECK_OK(legacy_sd_get_card_type(&old_card_type));
+    CHECK_OK(legacy_sd_deinit());
+    CHECK(!legacy_sd_is_mounted());
+
+    host_test_section("shim");
+    fake_fs_set_root(shim_root);
+    CHECK_OK(sd_init());
+    shim_trace.count = 0;
+    sd_scenario_run(&shim_trace);
+
+    compare_traces();
+    compare_cards();
+    intended_changes();
+
+    CHECK_OK(storage_deinit());
+    CHECK(!sd_is_mounted());
+    return host_test_finish("test_sd_compat");
+}
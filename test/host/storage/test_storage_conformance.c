@@ -0,0 +1,394 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Conformidade da storage API: a mesma bateria de operações roda em cada
+// backend montado por storage_init() (LittleFS em /littlefs, cartão SD em
+// /sdcard e RAMFS em /ram), e o resultado tem que ser o mesmo em todos. Os
+// backends são os do firmware (vfs_littlefs.c, vfs_sdcard.c, vfs_ramfs.c);
+// a partição e o cartão são diretórios do host (fake_fs.h).
+
+#include <stdio.h>
+#include <string.h>
+#include <stdlib.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include "storage.h"
+#include "vfs_core.h"
+#include "vfs_config.h"
+#include "vfs_lineindex.h"
+#include "vfs_sdcard.h"
+#include "spi.h"
+#include "fake_fs.h"
+#include "host_test.h"
+
+typedef struct {
+    int count;
+    char last[600];
+    size_t maxlen;
+} lines_t;
+
+static void on_line(const char *line, void *arg) {
+    lines_t *c = arg;
+    c->count++;
+    snprintf(c->last, sizeof(c->last), "%s", line);
+    if (strlen(line) > c->maxlen) c->maxlen = strlen(line);
+}
+
+typedef struct {
+    int files, dirs;
+} entries_t;
+
+static void on_entry(const char *name, bool is_dir, void *arg) {
+    entries_t *c = arg;
+    (void)name;
+    if (is_dir) c->dirs++;
+    else c->files++;
+}
+
+static char paths[8][256];
+
+// Caminho `rel` dentro de `root`, guardado em paths[i]
+static const char *at(int i, const char *root, const char *rel) {
+    snprintf(paths[i], sizeof(paths[i]), "%s/%s", root, rel);
+    return paths[i];
+}
+
+// O arquivo está na imagem (diretório do host) do backend?
+static bool in_image(const char *path) {
+    char host[600];
+    struct stat st;
+    return fake_fs_host_path(path, host, sizeof(host)) && stat(host, &st) == 0;
+}
+
+// ========== BATERIA ==========
+
+static void text_files(const char *root) {
+    char buf[1024];
+    size_t size;
+    uint32_t n;
+    bool b;
+    lines_t lines;
+    int32_t value;
+    const char *a = at(0, root, "a.txt");
+
+    CHECK_OK(storage_write_string(a, "l1\nl2\n"));
+    CHECK_OK(storage_append_line(a, "l3"));
+    CHECK_OK(storage_read_string(a, buf, sizeof(buf)));
+    CHECK_STR(buf, "l1\nl2\nl3\n");
+    CHECK_OK(storage_file_get_size(a, &size));
+    CHECK_EQ(size, 9);
+    CHECK_OK(storage_count_lines(a, &n));
+    CHECK_EQ(n, 3);
+    CHECK_OK(storage_read_line(a, buf, sizeof(buf), 2));
+    CHECK_STR(buf, "l2");
+    CHECK_EQ(storage_read_line(a, buf, sizeof(buf), 9), ESP_ERR_NOT_FOUND);
+    CHECK_OK(storage_read_last_line(a, buf, sizeof(buf)));
+    CHECK_STR(buf, "l3");
+
+    memset(&lines, 0, sizeof(lines));
+    CHECK_OK(storage_read_tail(a, 2, on_line, &lines));
+    CHECK_EQ(lines.count, 2);
+    CHECK_STR(lines.last, "l3");
+    memset(&lines, 0, sizeof(lines));
+    CHECK_OK(storage_read_line_range(a, 2, 5, on_line, &lines));
+    CHECK_EQ(lines.count, 2);
+    memset(&lines, 0, sizeof(lines));
+    CHECK_OK(storage_read_lines(a, on_line, &lines));
+    CHECK_EQ(lines.count, 3);
+
+    CHECK_OK(storage_read_chunk(a, 3, buf, 2, &size));
+    CHECK_EQ(size, 2);
+    CHECK_EQ(memcmp(buf, "l2", 2), 0);
+    CHECK_OK(storage_file_contains(a, "l2", &b));
+    CHECK(b);
+    CHECK_OK(storage_count_occurrences(a, "l", &n));
+    CHECK_EQ(n, 3);
+    CHECK_OK(storage_write_int(at(1, root, "i.txt"), -42));
+    CHECK_OK(storage_read_int(paths[1], &value));
+    CHECK_EQ(value, -42);
+    CHECK_EQ(in_image(a), strcmp(root, VFS_RAMFS_MOUNT_POINT "/ct") != 0);  // RAMFS não tem imagem
+
+    // Linha maior que o buffer de linha: read_lines e read_line numeram igual
+    char longl[1500];
+    memset(longl, 'x', 1400);
+    longl[1400] = '\0';
+    const char *l = at(2, root, "long.txt");
+    CHECK_OK(storage_write_line(l, "first"));
+    CHECK_OK(storage_append_string(l, longl));
+    CHECK_OK(storage_append_string(l, "\nlast\n"));
+    CHECK_OK(storage_count_lines(l, &n));
+    CHECK_EQ(n, 3);
+    memset(&lines, 0, sizeof(lines));
+    CHECK_OK(storage_read_lines(l, on_line, &lines));
+    CHECK_EQ(lines.count, 3);
+    CHECK_STR(lines.last, "last");
+    CHECK_EQ(lines.maxlen, VFS_LINEINDEX_LINE_MAX - 1);
+    CHECK_OK(storage_read_line(l, buf, sizeof(buf), 3));
+    CHECK_STR(buf, "last");
+}
+
+static void file_ops(const char *root, const char *other) {
+    size_t size;
+    bool b;
+    storage_file_info_t info;
+    const char *a = at(0, root, "a.txt");
+
+    CHECK_OK(storage_file_copy(a, at(3, root, "b.txt")));
+    CHECK_OK(storage_file_compare(a, paths[3], &b));
+    CHECK(b);
+    CHECK_OK(storage_file_rename(paths[3], at(4, root, "c.txt")));
+    CHECK(!storage_file_exists(paths[3]));
+    CHECK(storage_file_exists(paths[4]));
+    CHECK_OK(storage_file_truncate(paths[4], 2));
+    CHECK_OK(storage_file_get_size(paths[4], &size));
+    CHECK_EQ(size, 2);
+    CHECK_OK(storage_file_compare(a, paths[4], &b));
+    CHECK(!b);
+    CHECK_OK(storage_file_clear(paths[4]));
+    CHECK_OK(storage_file_is_empty(paths[4], &b));
+    CHECK(b);
+
+    // Entre montagens: cópia e apagamento
+    CHECK_OK(storage_file_move(paths[4], at(5, other, "moved.txt")));
+    CHECK(!storage_file_exists(paths[4]));
+    CHECK(storage_file_exists(paths[5]));
+    CHECK_OK(storage_file_delete(paths[5]));
+
+    CHECK_OK(storage_file_get_info(a, &info));
+    CHECK_EQ(info.size, 9);
+    CHECK(!info.is_directory);
+    CHECK_STR(info.path, a);
+}
+
+// Arquivo que não existe: o mesmo código em todas as funções
+static void missing(const char *root) {
+    char buf[64];
+    size_t size;
+    uint32_t n, f, d;
+    bool b;
+    lines_t lines;
+    entries_t entries;
+    storage_file_info_t info;
+    const char *m = at(6, root, "nope.txt");
+    const char *x = at(7, root, "x.txt");
+
+    CHECK(!storage_file_exists(m));
+    CHECK_EQ(storage_read_string(m, buf, sizeof(buf)), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(storage_read_binary(m, buf, 4, &size), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(storage_file_get_size(m, &size), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(storage_file_get_info(m, &info), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(storage_file_delete(m), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(storage_file_rename(m, x), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(storage_file_copy(m, x), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(storage_file_move(m, x), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(storage_file_truncate(m, 0), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(storage_file_compare(m, paths[0], &b), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(storage_read_line(m, buf, sizeof(buf), 1), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(storage_read_last_line(m, buf, sizeof(buf)), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(storage_count_lines(m, &n), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(storage_read_lines(m, on_line, &lines), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(storage_read_tail(m, 2, on_line, &lines), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(storage_read_chunk(m, 0, buf, 4, &size), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(storage_file_contains(m, "a", &b), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(storage_dir_list(m, on_entry, &entries), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(storage_dir_count(m, &f, &d), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(storage_dir_remove(m), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(storage_dir_copy_recursive(m, x), ESP_ERR_NOT_FOUND);
+    CHECK(!storage_file_exists(x));
+}
+
+static void bad_args(const char *root) {
+    char buf[64];
+    size_t size;
+
+    CHECK_EQ(storage_read_string(NULL, buf, sizeof(buf)), ESP_ERR_INVALID_ARG);
+    CHECK_EQ(storage_file_get_size(NULL, &size), ESP_ERR_INVALID_ARG);
+    CHECK_EQ(storage_file_get_size(paths[0], NULL), ESP_ERR_INVALID_ARG);
+    CHECK_EQ(storage_file_delete(NULL), ESP_ERR_INVALID_ARG);
+    CHECK_EQ(storage_read_line(paths[0], buf, sizeof(buf), 0), ESP_ERR_INVALID_ARG);
+    CHECK_EQ(storage_dir_copy_recursive(root, at(7, root, "sub/inner")), ESP_ERR_INVALID_ARG);
+    CHECK_EQ(storage_dir_copy_recursive(paths[0], at(7, root, "z")), ESP_ERR_INVALID_ARG);
+}
+
+// Árvores copiadas dentro da montagem e para outra
+static void trees(const char *root, const char *other) {
+    char buf[64];
+    uint32_t f, d;
+    uint64_t total;
+    bool b;
+    entries_t entries;
+
+    CHECK_OK(storage_dir_create(at(1, root, "t")));
+    CHECK_OK(storage_dir_create(at(1, root, "t/s1")));
+    CHECK_OK(storage_dir_create(at(1, root, "t/s1/s2")));
+    CHECK_OK(storage_write_string(at(1, root, "t/r.txt"), "root file"));
+    CHECK_OK(storage_write_string(at(1, root, "t/s1/a.bin"), "aaaa"));
+    CHECK_OK(storage_write_string(at(1, root, "t/s1/s2/deep.txt"), "deep\n"));
+
+    // Sidecar do índice de linhas: fica fora das listagens e dos totais
+    CHECK_OK(vfs_lineindex_save(at(5, root, "t/r.txt")));
+    CHECK(vfs_exists(at(6, root, "t/r.txt" VFS_LINEINDEX_SIDECAR_EXT)));
+    memset(&entries, 0, sizeof(entries));
+    CHECK_OK(storage_dir_list(at(1, root, "t"), on_entry, &entries));
+    CHECK_EQ(entries.files, 1);
+    CHECK_EQ(entries.dirs, 1);
+    storage_dir_entry_t page[4];
+    size_t count, all;
+    CHECK_OK(storage_dir_list_page(paths[1], STORAGE_SORT_NAME, 0, 0, page, 4, &count, &all));
+    CHECK_EQ(count, 2);
+    CHECK_EQ(all, 2);
+
+    CHECK_OK(storage_dir_count(at(1, root, "t"), &f, &d));
+    CHECK_EQ(f, 1);
+    CHECK_EQ(d, 1);
+    CHECK_OK(storage_dir_get_size(paths[1], &total));
+    CHECK_EQ(total, 9 + 4 + 5);
+    memset(&entries, 0, sizeof(entries));
+    CHECK_OK(storage_dir_list_sorted(paths[1], STORAGE_SORT_NAME, STORAGE_SORT_DIRS_FIRST,
+                                     on_entry, &entries));
+    CHECK_EQ(entries.files, 1);
+    CHECK_EQ(entries.dirs, 1);
+
+    CHECK_OK(storage_dir_copy_recursive(paths[1], at(2, root, "t2")));
+    CHECK_OK(storage_dir_get_size(paths[2], &total));
+    CHECK_EQ(total, 18);
+    CHECK_OK(storage_read_string(at(3, root, "t2/s1/s2/deep.txt"), buf, sizeof(buf)));
+    CHECK_STR(buf, "deep\n");
+
+    CHECK_OK(storage_dir_copy_recursive(paths[1], at(2, other, "x_t")));
+    CHECK_OK(storage_dir_get_size(paths[2], &total));
+    CHECK_EQ(total, 18);
+    CHECK_OK(storage_file_compare(at(3, root, "t/s1/a.bin"), at(4, other, "x_t/s1/a.bin"), &b));
+    CHECK(b);
+    CHECK_OK(storage_dir_copy_recursive(paths[1], paths[2]));     // Por cima: sobrescreve
+    CHECK_OK(storage_dir_remove_recursive(paths[2]));
+    CHECK(!storage_dir_exists(paths[2]));
+    CHECK_OK(storage_dir_is_empty(at(1, root, "t/s1/s2"), &b));
+    CHECK(!b);
+}
+
+static void suite(const char *root, const char *other) {
+    char name[64];
+    snprintf(name, sizeof(name), "bateria em %s", root);
+    host_test_section(name);
+
+    storage_dir_remove_recursive(root);
+    CHECK_OK(storage_dir_create(root));
+    CHECK(storage_dir_exists(root));
+    text_files(root);
+    file_ops(root, other);
+    missing(root);
+    bad_args(root);
+    trees(root, other);
+}
+
+// ========== MONTAGEM ==========
+
+static void unmounted(void) {
+    host_test_section("desmontado");
+    char buf[64];
+    size_t size;
+    uint64_t bytes;
+
+    CHECK_EQ(storage_read_string("a.txt", buf, sizeof(buf)), ESP_ERR_INVALID_STATE);
+    CHECK_EQ(storage_file_get_size("a.txt", &size), ESP_ERR_INVALID_STATE);
+    CHECK_EQ(storage_file_delete("a.txt"), ESP_ERR_INVALID_STATE);
+    CHECK_EQ(storage_dir_create("d"), ESP_ERR_INVALID_STATE);
+    CHECK_EQ(storage_get_free_space(&bytes), ESP_ERR_INVALID_STATE);
+}
+
+static void relative_paths(void) {
+    host_test_section("caminhos relativos");
+    CHECK_OK(storage_write_string("rel.txt", "r"));
+    CHECK(storage_file_exists(VFS_LITTLEFS_MOUNT_POINT "/rel.txt"));
+    CHECK(in_image(VFS_LITTLEFS_MOUNT_POINT "/rel.txt"));
+    CHECK_OK(storage_file_delete("/rel.txt"));
+    CHECK(!storage_file_exists(VFS_LITTLEFS_MOUNT_POINT "/rel.txt"));
+}
+
+static void space(void) {
+    host_test_section("espaço");
+    vfs_statvfs_t st;
+    uint64_t bytes;
+
+    CHECK_OK(storage_get_total_space(&bytes));
+    CHECK_EQ(bytes, FAKE_FS_LITTLEFS_BYTES);
+    CHECK_OK(vfs_statvfs(VFS_SD_MOUNT_POINT, &st));
+    CHECK_EQ(st.total_bytes, (uint64_t)FAKE_FS_CARD_SECTORS * 512);
+    CHECK(st.free_bytes > 0 && st.free_bytes < st.total_bytes);
+    CHECK_OK(vfs_statvfs(VFS_RAMFS_MOUNT_POINT, &st));
+    CHECK_EQ(st.total_bytes, VFS_RAMFS_SIZE);
+}
+
+// Cartão tirado do slot: a checagem desmonta só o cartão
+static void card_removed(void) {
+    host_test_section("cartão removido");
+    char buf[64];
+
+    CHECK(fake_fs_card_commands() > 0);         // Comandos passaram pelo gancho do árbitro
+    CHECK(vfs_sdcard_check());
+    fake_fs_set_card_present(false);
+    // Ninguém chama vfs_sdcard_check: a tarefa do serviço percebe sozinha
+    uint64_t deadline = host_test_now_us() + 2000000;
+    while (vfs_sdcard_is_mounted() && host_test_now_us() < deadline) {
+        usleep(5000);
+    }
+    CHECK(!vfs_sdcard_is_mounted());
+    CHECK(!vfs_sdcard_check());
+    // Sem a montagem, "/sdcard/..." falha: nada cai na flash por engano
+    CHECK_EQ(storage_read_string(VFS_SD_MOUNT_POINT "/ct/a.txt", buf, sizeof(buf)),
+             ESP_ERR_INVALID_STATE);
+    CHECK_EQ(storage_write_string(VFS_SD_MOUNT_POINT "/ct/new.txt", "x"), ESP_ERR_INVALID_STATE);
+    CHECK_EQ(storage_dir_create(VFS_SD_MOUNT_POINT "/novo"), ESP_ERR_INVALID_STATE);
+    CHECK(!storage_file_exists(VFS_SD_MOUNT_POINT "/ct/a.txt"));
+    CHECK(!storage_file_exists(VFS_LITTLEFS_MOUNT_POINT VFS_SD_MOUNT_POINT "/ct/new.txt"));
+    CHECK(!storage_file_exists(VFS_LITTLEFS_MOUNT_POINT VFS_SD_MOUNT_POINT "/novo"));
+    // Só o componente inteiro conta: "/sdcardx" continua relativo à flash
+    CHECK_OK(storage_write_string(VFS_SD_MOUNT_POINT "x.txt", "y"));
+    CHECK(storage_file_exists(VFS_LITTLEFS_MOUNT_POINT VFS_SD_MOUNT_POINT "x.txt"));
+    CHECK_OK(storage_file_delete(VFS_SD_MOUNT_POINT "x.txt"));
+    CHECK(storage_is_mounted());
+    CHECK_OK(storage_read_string(VFS_LITTLEFS_MOUNT_POINT "/ct/a.txt", buf, sizeof(buf)));
+
+    CHECK(vfs_sdcard_init() != ESP_OK);
+    fake_fs_set_card_present(true);
+    CHECK_OK(vfs_sdcard_init());
+    CHECK_OK(storage_read_string(VFS_SD_MOUNT_POINT "/ct/a.txt", buf, sizeof(buf)));
+    CHECK_STR(buf, "l1\nl2\nl3\n");
+}
+
+int main(void) {
+    CHECK_OK(spi_init());
+    fake_fs_set_root(host_test_tmpdir());
+
+    unmounted();
+    CHECK_OK(storage_init());
+    CHECK(vfs_sdcard_is_mounted());
+
+    suite(VFS_LITTLEFS_MOUNT_POINT "/ct", VFS_SD_MOUNT_POINT);
+    suite(VFS_SD_MOUNT_POINT "/ct", VFS_RAMFS_MOUNT_POINT);
+    suite(VFS_RAMFS_MOUNT_POINT "/ct", VFS_LITTLEFS_MOUNT_POINT);
+    relative_paths();
+    space();
+    card_removed();
+
+    host_test_section("depois do deinit");
+    char buf[64];
+    CHECK_OK(storage_deinit());
+    CHECK_EQ(storage_read_string(VFS_LITTLEFS_MOUNT_POINT "/ct/a.txt", buf, sizeof(buf)),
+             ESP_ERR_INVALID_STATE);
+    CHECK(!vfs_sdcard_is_mounted());
+    return host_test_finish("test_storage_conformance");
+}
@@ -0,0 +1,355 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Imagem de assets (vfs_assets.c) sobre a partição simulada de
+// fake_partition.c: a imagem é montada aqui no formato do
+// tools/asset_image.py, gravada num arquivo comum e mapeada pelo mesmo
+// caminho do firmware (esp_partition_read do cabeçalho e esp_partition_mmap
+// só dos bytes usados). Confere busca, leitura pelo mapeamento, janelas e
+// imagens corrompidas, que têm que ser recusadas na montagem.
+
+#include <stdlib.h>
+#include <string.h>
+#include "vfs_assets.h"
+#include "esp_partition.h"
+#include "fake_partition.h"
+#include "host_test.h"
+
+#define IMAGE_MAX       8192
+#define PARTITION_BYTES (64 * 1024)     // Arquivo da partição, maior que a imagem
+#define ICON_BYTES      1000
+
+// Layout de vfs_assets.c
+typedef struct {
+    uint32_t magic;
+    uint32_t count;
+    uint32_t image_size;
+    uint32_t data_start;
+    uint32_t index_hash;
+} img_header_t;
+
+typedef struct {
+    uint32_t name;
+    uint32_t offset;
+    uint32_t size;
+} img_entry_t;
+
+typedef struct {
+    const char *path;
+    const void *data;
+    size_t size;
+} img_file_t;
+
+static uint8_t icon[ICON_BYTES];
+static const char tv_ir[] =
+    "Filetype: IR signals file\nname: Power\ntype: parsed\nprotocol: NEC\naddress: 04 00\n";
+static const char index_html[] = "<html><body>HighBoy</body></html>";
+static const char app_js[] = "console.log(1);";
+
+// Em ordem de strcmp, como o asset_image.py grava
+static img_file_t files[] = {
+    { "icons/wifi.bin", icon, ICON_BYTES },
+    { "ir/tv.ir", tv_ir, sizeof(tv_ir) - 1 },
+    { "www/app.js", app_js, sizeof(app_js) - 1 },
+    { "www/index.html", index_html, sizeof(index_html) - 1 },
+};
+
+#define NUM_FILES (sizeof(files) / sizeof(files[0]))
+
+static uint8_t image[IMAGE_MAX];
+static size_t image_len;
+
+static uint32_t fnv1a(const uint8_t *data, size_t len) {
+    uint32_t h = 2166136261u;
+    for (size_t i = 0; i < len; i++) h = (h ^ data[i]) * 16777619u;
+    return h;
+}
+
+static uint32_t align4(uint32_t n) {
+    return (n + 3) & ~3u;
+}
+
+static img_header_t *header(void) {
+    return (img_header_t *)image;
+}
+
+static img_entry_t *entry(int i) {
+    return (img_entry_t *)(image + sizeof(img_header_t)) + i;
+}
+
+static void rehash(void) {
+    header()->index_hash = fnv1a(image + sizeof(img_header_t), header()->data_start - sizeof(img_header_t));
+}
+
+// Mesmo layout do build() do asset_image.py
+static void build_image(void) {
+    memset(image, 0, sizeof(image));
+    uint32_t names = sizeof(img_header_t) + NUM_FILES * sizeof(img_entry_t);
+    uint32_t pos = names;
+    for (size_t i = 0; i < NUM_FILES; i++) {
+        entry(i)->name = pos;
+        memcpy(image + pos, files[i].path, strlen(files[i].path) + 1);
+        pos += strlen(files[i].path) + 1;
+    }
+    uint32_t data_start = align4(pos);
+    pos = data_start;
+    for (size_t i = 0; i < NUM_FILES; i++) {
+        entry(i)->offset = pos;
+        entry(i)->size = files[i].size;
+        memcpy(image + pos, files[i].data, files[i].size);
+        pos = align4(pos + files[i].size + 1);
+    }
+    *header() = (img_header_t){
+        .magic = 0x31414248, .count = NUM_FILES, .image_size = pos, .data_start = data_start,
+    };
+    rehash();
+    image_len = pos;
+}
+
+// Grava a imagem como partição `label`, completando com 0xFF até `bytes`
+static void install(const char *label, size_t bytes) {
+    char path[512];
+    snprintf(path, sizeof(path), "%s/%s.bin", host_test_tmpdir(), label);
+    FILE *f = fopen(path, "wb");
+    CHECK(f != NULL);
+    if (!f) return;
+    fwrite(image, 1, image_len, f);
+    for (size_t i = image_len; i < bytes; i++) fputc(0xFF, f);
+    fclose(f);
+    CHECK(fake_partition_add(label, path));
+}
+
+// ========== CENÁRIOS ==========
+
+static void not_mounted(void) {
+    host_test_section("sem imagem");
+    vfs_asset_t a;
+    CHECK_EQ(vfs_assets_mount(NULL), ESP_ERR_NOT_FOUND);
+    CHECK(!vfs_assets_is_mounted());
+    CHECK_EQ(vfs_assets_unmount(), ESP_ERR_INVALID_STATE);
+    CHECK_EQ(vfs_asset_find("ir/tv.ir", &a), ESP_ERR_INVALID_STATE);
+    CHECK_EQ(vfs_asset_at(0, &a), ESP_ERR_INVALID_STATE);
+    CHECK_EQ(vfs_assets_count(), 0);
+    CHECK_EQ(fake_partition_mappings(), 0);
+}
+
+static void lookup(void) {
+    host_test_section("busca e leitura pelo mapeamento");
+    build_image();
+    install(VFS_ASSETS_PARTITION_LABEL, PARTITION_BYTES);
+
+    CHECK_OK(vfs_assets_mount(NULL));
+    CHECK(vfs_assets_is_mounted());
+    CHECK_EQ(vfs_assets_mount(NULL), ESP_ERR_INVALID_STATE);
+    CHECK_EQ(vfs_assets_count(), NUM_FILES);
+    // Só os bytes da imagem, não a partição inteira
+    CHECK_EQ(fake_partition_mappings(), 1);
+    CHECK_EQ(fake_partition_last_map_size(), image_len);
+
+    vfs_asset_t a, b;
+    for (size_t i = 0; i < NUM_FILES; i++) {
+        CHECK_OK(vfs_asset_find(files[i].path, &a));
+        CHECK_STR(a.path, files[i].path);
+        CHECK_EQ(a.size, files[i].size);
+        CHECK(memcmp(a.data, files[i].data, files[i].size) == 0);
+        CHECK_EQ(a.data[a.size], '\0');
+        CHECK_EQ((uintptr_t)a.data % 4, 0);
+        // Ponteiro para o mapeamento, sem cópia: a mesma posição a cada busca
+        CHECK_OK(vfs_asset_at(i, &b));
+        CHECK(b.data == a.data && b.path == a.path);
+    }
+
+    // '/' inicial ignorado; texto usado direto como string C
+    CHECK_OK(vfs_asset_find("/ir/tv.ir", &a));
+    CHECK(strstr((const char *)a.data, "protocol: NEC") != NULL);
+    CHECK_OK(vfs_asset_find("//www/index.html", &a));
+    CHECK_STR((const char *)a.data, index_html);
+
+    CHECK_EQ(vfs_asset_find("www", &a), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(vfs_asset_find("www/index.htm", &a), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(vfs_asset_find("zzz", &a), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(vfs_asset_find("", &a), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(vfs_asset_find(NULL, &a), ESP_ERR_INVALID_ARG);
+    CHECK_EQ(vfs_asset_at(NUM_FILES, &a), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(vfs_asset_at(UINT32_MAX, &a), ESP_ERR_NOT_FOUND);
+    CHECK_EQ(vfs_asset_at(0, NULL), ESP_ERR_INVALID_ARG);
+
+    CHECK_OK(vfs_assets_unmount());
+    CHECK(!vfs_assets_is_mounted());
+    CHECK_EQ(vfs_assets_count(), 0);
+    CHECK_EQ(fake_partition_mappings(), 0);
+}
+
+static void windows(void) {
+    host_test_section("janelas");
+    CHECK_OK(vfs_assets_mount(NULL));
+
+    vfs_asset_t a;
+    CHECK_OK(vfs_asset_find("icons/wifi.bin", &a));
+
+    // Percorre o ícone em pedaços de 64 bytes, como uma resposta em chunks
+    uint8_t copy[ICON_BYTES];
+    const uint8_t *w;
+    size_t off = 0, n, chunks = 0;
+    while ((n = vfs_asset_window(&a, off, 64, &w)) > 0) {
+        CHECK(w == a.data + off);
+        memcpy(copy + off, w, n);
+        off += n;
+        chunks++;
+    }
+    CHECK_EQ(off, ICON_BYTES);
+    CHECK_EQ(chunks, (ICON_BYTES + 63) / 64);
+    CHECK(memcmp(copy, icon, ICON_BYTES) == 0);
+
+    // Recortada no fim do asset, nunca além
+    CHECK_EQ(vfs_asset_window(&a, ICON_BYTES - 10, 64, &w), 10);
+    CHECK_EQ(vfs_asset_window(&a, 0, SIZE_MAX, &w), ICON_BYTES);
+    CHECK_EQ(vfs_asset_window(&a, 1, SIZE_MAX, &w), ICON_BYTES - 1);
+    w = NULL;
+    CHECK_EQ(vfs_asset_window(&a, ICON_BYTES, 1, &w), 0);
+    CHECK_EQ(vfs_asset_window(&a, SIZE_MAX, 1, &w), 0);
+    CHECK(w == NULL);
+    CHECK_EQ(vfs_asset_window(&a, 0, 0, &w), 0);
+    CHECK_EQ(vfs_asset_window(NULL, 0, 1, &w), 0);
+    CHECK_EQ(vfs_asset_window(&a, 0, 1, NULL), 0);
+
+    CHECK_OK(vfs_assets_unmount());
+}
+
+// ========== IMAGENS INVÁLIDAS ==========
+
+static void bad_magic(void)        { header()->magic ^= 1; }
+static void bad_hash(void)         { entry(1)->size--; }
+static void count_past_index(void) { header()->count = 1000; }
+static void name_in_data(void)     { entry(0)->name = header()->data_start; rehash(); }
+static void name_in_index(void)    { entry(0)->name = sizeof(img_header_t); rehash(); }
+static void offset_in_names(void)  { entry(0)->offset = header()->data_start - 4; rehash(); }
+static void offset_past_end(void)  { entry(3)->offset = header()->image_size; rehash(); }
+static void offset_unaligned(void) { entry(1)->offset += 1; entry(1)->size -= 1; rehash(); }
+static void unsorted(void) {
+    uint32_t t = entry(1)->name;
+    entry(1)->name = entry(2)->name;
+    entry(2)->name = t;
+    rehash();
+}
+static void data_start_past_end(void) { header()->data_start = header()->image_size + 4; }
+
+// Tamanho até o fim da imagem: o '\0' final ficaria fora
+static void size_past_end(void) {
+    entry(3)->size = header()->image_size - entry(3)->offset;
+    rehash();
+}
+
+static void size_overflow(void) {
+    entry(0)->size = UINT32_MAX - 2;
+    rehash();
+}
+
+static void no_terminator(void) {
+    image[entry(2)->offset + entry(2)->size] = 'x';
+}
+
+static const struct {
+    const char *name;
+    void (*corrupt)(void);
+} corruptions[] = {
+    { "magic", bad_magic },
+    { "hash do índice", bad_hash },
+    { "count além do índice", count_past_index },
+    { "nome nos dados", name_in_data },
+    { "nome no índice", name_in_index },
+    { "offset nos nomes", offset_in_names },
+    { "offset no fim", offset_past_end },
+    { "offset desalinhado", offset_unaligned },
+    { "fora de ordem", unsorted },
+    { "data_start além do fim", data_start_past_end },
+    { "tamanho até o fim", size_past_end },
+    { "tamanho com overflow", size_overflow },
+    { "sem terminador", no_terminator },
+};
+
+static void rejected(const char *what) {
+    esp_err_t ret = vfs_assets_mount(NULL);
+    if (ret != ESP_ERR_INVALID_VERSION) {
+        char d[96];
+        snprintf(d, sizeof(d), "%s: %s", what, esp_err_to_name(ret));
+        host_check_failed(__FILE__, __LINE__, "mount == ESP_ERR_INVALID_VERSION", d);
+    }
+    CHECK(!vfs_assets_is_mounted());
+    CHECK_EQ(vfs_assets_count(), 0);
+    CHECK_EQ(fake_partition_mappings(), 0);
+    if (ret == ESP_OK) vfs_assets_unmount();
+}
+
+static void corrupted(void) {
+    host_test_section("imagens corrompidas");
+    for (size_t i = 0; i < sizeof(corruptions) / sizeof(corruptions[0]); i++) {
+        build_image();
+        corruptions[i].corrupt();
+        install(VFS_ASSETS_PARTITION_LABEL, PARTITION_BYTES);
+        rejected(corruptions[i].name);
+    }
+
+    // Imagem maior que a partição: nada é mapeado
+    build_image();
+    header()->image_size = image_len + 4096;
+    install(VFS_ASSETS_PARTITION_LABEL, 0);
+    rejected("imagem maior que a partição");
+
+    // Partição menor que o cabeçalho
+    build_image();
+    image_len = sizeof(img_header_t) - 4;
+    install(VFS_ASSETS_PARTITION_LABEL, 0);
+    CHECK(vfs_assets_mount(NULL) != ESP_OK);
+    CHECK(!vfs_assets_is_mounted());
+    CHECK_EQ(fake_partition_mappings(), 0);
+
+    // A imagem íntegra volta a montar
+    build_image();
+    install(VFS_ASSETS_PARTITION_LABEL, PARTITION_BYTES);
+    CHECK_OK(vfs_assets_mount(NULL));
+    CHECK_OK(vfs_assets_unmount());
+}
+
+static void other_label(void) {
+    host_test_section("outro rótulo");
+    fake_partition_clear();
+    CHECK(!fake_partition_add("sounds", "/nao/existe"));
+    build_image();
+    install("icons", image_len);
+
+    CHECK_EQ(vfs_assets_mount(NULL), ESP_ERR_NOT_FOUND);
+    CHECK_OK(vfs_assets_mount("icons"));
+    // Partição do tamanho exato da imagem
+    CHECK_EQ(fake_partition_last_map_size(), image_len);
+    vfs_asset_t a;
+    CHECK_OK(vfs_asset_find("icons/wifi.bin", &a));
+    CHECK(memcmp(a.data, icon, ICON_BYTES) == 0);
+    CHECK_OK(vfs_assets_unmount());
+    fake_partition_clear();
+}
+
+int main(void) {
+    for (int i = 0; i < ICON_BYTES; i++) icon[i] = (uint8_t)(i * 7);
+
+    not_mounted();
+    lookup();
+    windows();
+    corrupted();
+    other_label();
+
+    return host_test_finish("test_vfs_assets");
+}
@@ -0,0 +1,398 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Cache de blocos do vfs_core (vfs_cache.c) sobre o backend em memória
+// instrumentado. Conta as chamadas que chegam ao backend com e sem o cache
+// (VFS_BACKEND_FLAG_NO_CACHE) em cargas de linha, confere readahead, bypass,
+// LRU e as invalidações, e compara um uso aleatório com vários descritores
+// contra um modelo do arquivo.
+
+#include <stdlib.h>
+#include <string.h>
+#include "vfs_core.h"
+#include "vfs_config.h"
+#include "vfs_ramfs.h"
+#include "mem_backend.h"
+#include "host_test.h"
+
+#define BLOCK           VFS_CACHE_BLOCK_SIZE
+#define LINES           200
+
+static mem_backend_calls_t calls;
+static vfs_cache_stats_t stats;
+
+// Remonta /mem com ou sem cache; os arquivos continuam no backend
+static void remount(bool cached) {
+    vfs_unregister_backend("/mem");
+    CHECK_OK(mem_backend_mount("/mem", cached ? 0 : VFS_BACKEND_FLAG_NO_CACHE));
+}
+
+static void reset_counters(void) {
+    mem_backend_reset_calls();
+    vfs_reset_cache_stats("/mem");
+}
+
+static void get_counters(void) {
+    mem_backend_get_calls(&calls);
+    CHECK_OK(vfs_get_cache_stats("/mem", &stats));
+}
+
+static void put_lines(const char *path) {
+    static char text[LINES * 64];
+    size_t len = 0;
+    for (int i = 0; i < LINES; i++) {
+        len += snprintf(text + len, sizeof(text) - len, "linha %d com algum texto de exemplo\n", i);
+    }
+    CHECK_OK(mem_backend_put(path, text, len));
+}
+
+// Linha `line` (1 = primeira) lida de byte em byte, como a storage API fazia
+static bool read_line(const char *path, int line, char *out, size_t size) {
+    vfs_fd_t fd = vfs_open(path, VFS_O_RDONLY, 0);
+    if (fd < 0) return false;
+    int current = 0;
+    size_t pos = 0;
+    char c;
+    bool found = false;
+    while (!found && vfs_read(fd, &c, 1) == 1) {
+        if (c == '\n') {
+            out[pos] = '\0';
+            found = ++current == line;
+            pos = 0;
+        } else if (pos < size - 1) {
+            out[pos++] = c;
+        }
+    }
+    vfs_close(fd);
+    return found;
+}
+
+// Lê as linhas 1, 21, 41... e devolve as chamadas de read no backend
+static unsigned line_workload(void) {
+    char line[128], want[128];
+    reset_counters();
+    for (int k = 1; k <= LINES; k += 20) {
+        CHECK(read_line("/mem/a.txt", k, line, sizeof(line)));
+        snprintf(want, sizeof(want), "linha %d com algum texto de exemplo", k - 1);
+        CHECK_STR(line, want);
+    }
+    get_counters();
+    return calls.read;
+}
+
+static void test_line_workload(void) {
+    host_test_section("carga de linhas");
+    put_lines("/mem/a.txt");
+
+    remount(false);
+    unsigned direct = line_workload();
+    remount(true);
+    unsigned cached = line_workload();
+    printf("linhas de byte em byte: %u reads no backend sem cache, %u com cache "
+           "(%u acertos, %u faltas, %u blocos de readahead)\n",
+           direct, cached, stats.hits, stats.misses, stats.readahead);
+
+    CHECK(direct > 10000);
+    CHECK(cached * 100 < direct);
+    CHECK_EQ(stats.backend_reads, cached);
+    CHECK(stats.hits > stats.misses * 100);
+    CHECK(stats.readahead > 0);
+
+    // Reabrir sem mudança no arquivo aproveita os blocos
+    reset_counters();
+    char line[128];
+    CHECK(read_line("/mem/a.txt", 3, line, sizeof(line)));
+    get_counters();
+    CHECK_EQ(calls.read, 0);
+}
+
+static void test_readahead(void) {
+    host_test_section("readahead sequencial");
+    static uint8_t data[32 * BLOCK], got[100];
+    for (size_t i = 0; i < sizeof(data); i++) data[i] = i * 7;
+    CHECK_OK(mem_backend_put("/mem/seq.bin", data, sizeof(data)));
+
+    // Sequencial em pedaços pequenos: a janela cresce e junta blocos
+    reset_counters();
+    vfs_fd_t fd = vfs_open("/mem/seq.bin", VFS_O_RDONLY, 0);
+    size_t at = 0;
+    ssize_t n;
+    bool same = true;
+    while ((n = vfs_read(fd, got, sizeof(got))) > 0) {
+        same = same && memcmp(got, data + at, n) == 0;
+        at += n;
+    }
+    vfs_close(fd);
+    get_counters();
+    CHECK(same);
+    CHECK_EQ(at, sizeof(data));
+    CHECK(stats.readahead > 16);
+    CHECK(calls.read < 12);
+    printf("sequencial: %zu blocos em %u reads no backend\n", sizeof(data) / BLOCK, calls.read);
+
+    // Acesso aleatório não busca blocos à frente
+    remount(true);
+    reset_counters();
+    fd = vfs_open("/mem/seq.bin", VFS_O_RDONLY, 0);
+    for (int i = 0; i < 8; i++) {
+        off_t to = ((i * 11) % 31) * BLOCK + 3;
+        CHECK_EQ(vfs_lseek(fd, to, VFS_SEEK_SET), to);
+        CHECK_EQ(vfs_read(fd, got, 10), 10);
+        CHECK(memcmp(got, data + to, 10) == 0);
+    }
+    get_counters();
+    CHECK_EQ(stats.readahead, 0);
+    CHECK_EQ(stats.misses, 8);
+
+    // Leituras grandes vão direto ao backend
+    static uint8_t big[4 * BLOCK];
+    reset_counters();
+    CHECK_EQ(vfs_lseek(fd, 100, VFS_SEEK_SET), 100);
+    CHECK_EQ(vfs_read(fd, big, sizeof(big)), sizeof(big));
+    get_counters();
+    CHECK(memcmp(big, data + 100, sizeof(big)) == 0);
+    CHECK_EQ(stats.bypass, 1);
+    CHECK_EQ(calls.read, 1);
+    vfs_close(fd);
+}
+
+static void test_lru(void) {
+    host_test_section("LRU");
+    static uint8_t data[2 * VFS_CACHE_BLOCKS * BLOCK];
+    memset(data, 'x', sizeof(data));
+    CHECK_OK(mem_backend_put("/mem/lru.bin", data, sizeof(data)));
+    remount(true);
+
+    // Blocos 0, 2, 4...: nenhum é sequencial, o cache fica cheio sem readahead
+    uint8_t c;
+    vfs_fd_t fd = vfs_open("/mem/lru.bin", VFS_O_RDONLY, 0);
+    for (int b = 0; b < VFS_CACHE_BLOCKS; b++) {
+        vfs_lseek(fd, (off_t)(b * 2) * BLOCK + 1, VFS_SEEK_SET);
+        CHECK_EQ(vfs_read(fd, &c, 1), 1);
+    }
+    // Usa o bloco 0 de novo: o mais antigo passa a ser o bloco 2
+    reset_counters();
+    vfs_lseek(fd, 1, VFS_SEEK_SET);
+    vfs_read(fd, &c, 1);
+    vfs_lseek(fd, 1 * BLOCK + 1, VFS_SEEK_SET);     // Bloco novo: despeja o 2
+    vfs_read(fd, &c, 1);
+    vfs_lseek(fd, 1, VFS_SEEK_SET);
+    vfs_read(fd, &c, 1);
+    get_counters();
+    CHECK_EQ(stats.hits, 2);
+    CHECK_EQ(stats.misses, 1);
+
+    reset_counters();
+    vfs_lseek(fd, 2 * BLOCK + 1, VFS_SEEK_SET);
+    vfs_read(fd, &c, 1);
+    get_counters();
+    CHECK_EQ(stats.misses, 1);
+    vfs_close(fd);
+}
+
+static void test_invalidation(void) {
+    host_test_section("invalidação");
+    char buf[64];
+    CHECK_OK(mem_backend_put("/mem/inv.txt", "0123456789abcdef", 16));
+    remount(true);
+
+    // Escrita por um descritor aparece na leitura do outro
+    vfs_fd_t r = vfs_open("/mem/inv.txt", VFS_O_RDONLY, 0);
+    vfs_fd_t w = vfs_open("/mem/inv.txt", VFS_O_RDWR, 0);
+    CHECK_EQ(vfs_read(r, buf, 16), 16);
+    reset_counters();
+    CHECK_EQ(vfs_lseek(w, 4, VFS_SEEK_SET), 4);
+    CHECK_EQ(vfs_write(w, "WXYZ", 4), 4);
+    get_counters();
+    CHECK(stats.invalidations > 0);
+    vfs_lseek(r, 0, VFS_SEEK_SET);
+    CHECK_EQ(vfs_read(r, buf, 16), 16);
+    CHECK(memcmp(buf, "0123WXYZ89abcdef", 16) == 0);
+
+    // Escrita que estende o arquivo: o último bloco (curto) é descartado
+    CHECK_EQ(vfs_lseek(w, 0, VFS_SEEK_END), 16);
+    CHECK_EQ(vfs_write(w, "+tail", 5), 5);
+    vfs_lseek(r, 0, VFS_SEEK_SET);
+    CHECK_EQ(vfs_read(r, buf, sizeof(buf)), 21);
+    CHECK(memcmp(buf, "0123WXYZ89abcdef+tail", 21) == 0);
+    vfs_close(w);
+    vfs_close(r);
+
+    // truncate
+    CHECK_OK(vfs_truncate("/mem/inv.txt", 6));
+    r = vfs_open("/mem/inv.txt", VFS_O_RDONLY, 0);
+    CHECK_EQ(vfs_read(r, buf, sizeof(buf)), 6);
+    vfs_close(r);
+
+    // unlink e outro arquivo com o mesmo nome
+    CHECK_OK(vfs_unlink("/mem/inv.txt"));
+    CHECK_OK(vfs_write_file("/mem/inv.txt", "novo", 4));
+    size_t got = 0;
+    CHECK_OK(vfs_read_file("/mem/inv.txt", buf, sizeof(buf), &got));
+    CHECK_EQ(got, 4);
+    CHECK(memcmp(buf, "novo", 4) == 0);
+
+    // rename por cima de um arquivo já em cache
+    CHECK_OK(vfs_write_file("/mem/other.txt", "outro conteudo", 14));
+    CHECK_OK(vfs_read_file("/mem/other.txt", buf, sizeof(buf), &got));
+    CHECK_OK(vfs_rename("/mem/inv.txt", "/mem/other.txt"));
+    CHECK_OK(vfs_read_file("/mem/other.txt", buf, sizeof(buf), &got));
+    CHECK_EQ(got, 4);
+    CHECK(memcmp(buf, "novo", 4) == 0);
+
+    // Mudança por fora do VFS: percebida no próximo open (mtime)
+    CHECK_OK(mem_backend_patch("/mem/other.txt", 0, "NO", 2));
+    CHECK_OK(vfs_read_file("/mem/other.txt", buf, sizeof(buf), &got));
+    CHECK(memcmp(buf, "NOvo", 4) == 0);
+}
+
+// Contadores são da montagem: o RAMFS (sem cache) não conta nada
+static void test_per_mount(void) {
+    host_test_section("contadores por montagem");
+    vfs_cache_stats_t ram;
+    char buf[8];
+    size_t got;
+    CHECK_OK(vfs_write_file("/ram/x.txt", "abc", 3));
+    CHECK_OK(vfs_read_file("/ram/x.txt", buf, sizeof(buf), &got));
+    CHECK_OK(vfs_get_cache_stats("/ram", &ram));
+    CHECK_EQ(ram.hits + ram.misses + ram.backend_reads, 0);
+
+    reset_counters();
+    CHECK_OK(vfs_read_file("/mem/other.txt", buf, sizeof(buf), &got));
+    get_counters();
+    CHECK(stats.hits + stats.misses > 0);
+    CHECK_OK(vfs_get_cache_stats("/ram", &ram));
+    CHECK_EQ(ram.hits + ram.misses, 0);
+}
+
+// ========== USO ALEATÓRIO CONTRA UM MODELO ==========
+
+#define FUZZ_FDS        4           // O último abre com O_APPEND
+#define FUZZ_MAX        8192
+
+static struct {
+    uint8_t data[FUZZ_MAX];
+    size_t len;
+    off_t pos[FUZZ_FDS];
+    vfs_fd_t fd[FUZZ_FDS];
+} model;
+
+static void fuzz_open_all(int extra) {
+    for (int i = 0; i < FUZZ_FDS; i++) {
+        int flags = VFS_O_RDWR | extra | (i == FUZZ_FDS - 1 ? VFS_O_APPEND : 0);
+        model.fd[i] = vfs_open("/mem/f.bin", flags, 0);
+        model.pos[i] = 0;
+        CHECK(model.fd[i] >= 0);
+    }
+}
+
+static void fuzz_close_all(void) {
+    for (int i = 0; i < FUZZ_FDS; i++) vfs_close(model.fd[i]);
+}
+
+static void test_fuzz(void) {
+    host_test_section("uso aleatório");
+    srand(3);
+    memset(&model, 0, sizeof(model));
+    fuzz_open_all(VFS_O_CREAT | VFS_O_TRUNC);
+    reset_counters();
+
+    int mismatches = 0;
+    static uint8_t buf[3000];
+    for (int it = 0; it < 100000 && !mismatches; it++) {
+        int i = rand() % FUZZ_FDS, op = rand() % 100;
+        if (op < 50) {
+            size_t n = rand() % 4 == 0 ? rand() % sizeof(buf) : rand() % 40;
+            ssize_t r = vfs_read(model.fd[i], buf, n);
+            size_t left = (size_t)model.pos[i] < model.len ? model.len - model.pos[i] : 0;
+            size_t want = n < left ? n : left;
+            if (r != (ssize_t)want || (want && memcmp(buf, model.data + model.pos[i], want))) {
+                printf("it %d: fd %d em %ld, %zu bytes: %zd, esperado %zu\n",
+                       it, i, (long)model.pos[i], n, r, want);
+                mismatches++;
+            }
+            model.pos[i] += r > 0 ? r : 0;
+        } else if (op < 70) {
+            size_t n = rand() % 300 + 1;
+            for (size_t k = 0; k < n; k++) buf[k] = rand();
+            off_t at = i == FUZZ_FDS - 1 ? (off_t)model.len : model.pos[i];
+            if (at + n > FUZZ_MAX) continue;
+            CHECK_EQ(vfs_write(model.fd[i], buf, n), n);
+            if ((size_t)at > model.len) memset(model.data + model.len, 0, at - model.len);
+            memcpy(model.data + at, buf, n);
+            model.pos[i] = at + n;
+            if (model.pos[i] > (off_t)model.len) model.len = model.pos[i];
+        } else if (op < 88) {
+            int whence = rand() % 3;
+            off_t off = whence == VFS_SEEK_SET ? rand() % (FUZZ_MAX / 2) :
+                        whence == VFS_SEEK_CUR ? rand() % 200 - 100 : -(rand() % 100);
+            off_t base = whence == VFS_SEEK_SET ? 0 :
+                         whence == VFS_SEEK_CUR ? model.pos[i] : (off_t)model.len;
+            if (base + off < 0) continue;
+            CHECK_EQ(vfs_lseek(model.fd[i], off, whence), base + off);
+            model.pos[i] = base + off;
+        } else if (op < 92) {
+            size_t len = rand() % (model.len + 1);
+            CHECK_OK(vfs_truncate("/mem/f.bin", len));
+            model.len = len;
+        } else if (op < 96) {
+            vfs_close(model.fd[i]);
+            int flags = VFS_O_RDWR | (i == FUZZ_FDS - 1 ? VFS_O_APPEND : 0);
+            model.fd[i] = vfs_open("/mem/f.bin", flags, 0);
+            model.pos[i] = 0;
+        } else if (op < 97) {
+            fuzz_close_all();
+            if (model.len > 10) {
+                CHECK_OK(mem_backend_patch("/mem/f.bin", 3, "XYZ", 3));
+                memcpy(model.data + 3, "XYZ", 3);
+            }
+            fuzz_open_all(0);
+        } else if (op < 98) {
+            fuzz_close_all();
+            CHECK_OK(vfs_unlink("/mem/f.bin"));
+            model.len = 0;
+            fuzz_open_all(VFS_O_CREAT);
+        } else {
+            fuzz_close_all();
+            CHECK_OK(vfs_rename("/mem/f.bin", "/mem/g.bin"));
+            CHECK_OK(vfs_rename("/mem/g.bin", "/mem/f.bin"));
+            fuzz_open_all(0);
+        }
+    }
+    fuzz_close_all();
+    CHECK_EQ(mismatches, 0);
+
+    get_counters();
+    printf("aleatório: %u acertos, %u faltas, %u readahead, %u bypass, %u invalidações\n",
+           stats.hits, stats.misses, stats.readahead, stats.bypass, stats.invalidations);
+    CHECK(stats.hits > 0 && stats.invalidations > 0);
+}
+
+int main(void) {
+    CHECK_OK(vfs_ramfs_init(NULL));
+    CHECK_OK(mem_backend_mount("/mem", 0));
+
+    test_line_workload();
+    test_readahead();
+    test_lru();
+    test_invalidation();
+    test_per_mount();
+    test_fuzz();
+
+    CHECK_OK(mem_backend_unmount());
+    CHECK_OK(vfs_ramfs_deinit());
+    return host_test_finish("test_vfs_cache");
+}
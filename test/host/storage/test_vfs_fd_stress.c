@@ -0,0 +1,665 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Descritores do vfs_core sob concorrência. Oito threads abrem, leem,
+// escrevem, fazem seek e fecham arquivos por dois backends de teste que
+// repassam ao RAMFS: /mock passa pelo cache de blocos e /mock_nc não
+// (VFS_BACKEND_FLAG_NO_CACHE). Os fds são compartilhados entre as threads,
+// que os usam e fecham ao mesmo tempo, e uma outra thread desmonta e remonta
+// /mock_nc no meio de tudo.
+//
+// O FreeRTOS do host registra a ordem em que os mutexes são tomados
+// (host_locks.h). Os locks do vfs_core são identificados por sondas e a
+// ordem registrada tem que ser a documentada em vfs_core.c:
+// descritor -> mount -> cache -> tabela de fds, sem ciclos no grafo todo.
+// Toda chamada ao backend, open incluído, acontece só com o lock do próprio
+// descritor, e um backend parado num arquivo não segura os outros.
+
+#include <inttypes.h>
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "vfs_core.h"
+#include "vfs_ramfs.h"
+#include "host_locks.h"
+#include "host_test.h"
+
+#define THREADS         8
+#define ITERATIONS      20000
+#define SHARED          24          // fds publicados para as outras threads
+#define FILES           8
+#define FILE_SIZE       4096
+#define MAX_OPEN_FILES  32          // vfs_core.c
+#define DEADLINE_S      30
+
+// ========== LOCKS DO VFS_CORE ==========
+
+enum { RANK_DESCRIPTOR, RANK_MOUNT, RANK_CACHE, RANK_FD_TABLE, RANK_OTHER };
+
+static SemaphoreHandle_t probe;
+static SemaphoreHandle_t mount_lock, cache_lock, fd_lock;
+static SemaphoreHandle_t ramfs_lock;
+static SemaphoreHandle_t desc_locks[MAX_OPEN_FILES];
+static int desc_count;
+
+static int rank_of(SemaphoreHandle_t l) {
+    if (l == mount_lock) return RANK_MOUNT;
+    if (l == cache_lock) return RANK_CACHE;
+    if (l == fd_lock) return RANK_FD_TABLE;
+    for (int i = 0; i < desc_count; i++) {
+        if (desc_locks[i] == l) return RANK_DESCRIPTOR;
+    }
+    return RANK_OTHER;
+}
+
+static host_lock_edge_t edges[HOST_LOCKS_MAX_EDGES];
+
+// Locks tomados por uma chamada feita com a sonda na mão
+static size_t probed(SemaphoreHandle_t *out, size_t max) {
+    size_t n = host_lock_edges(edges, HOST_LOCKS_MAX_EDGES), count = 0;
+    for (size_t i = 0; i < n && count < max; i++) {
+        if (edges[i].held == probe) out[count++] = edges[i].taken;
+    }
+    return count;
+}
+
+#define PROBE(call) do {                                                    \
+        host_lock_reset();                                                  \
+        xSemaphoreTake(probe, portMAX_DELAY);                               \
+        (void)(call);                                                       \
+        xSemaphoreGive(probe);                                              \
+    } while (0)
+
+// ========== BACKENDS DE TESTE ==========
+
+static const vfs_backend_ops_t *ram;
+
+static struct {
+    atomic_int calls;
+    atomic_int fd_table_held;       // Backend chamado com a tabela de fds travada
+    atomic_int mount_held;          // ... com o lock de mount (open incluído)
+    atomic_int cache_held;          // ... com o lock do cache, em qualquer montagem
+    atomic_int desc_bad;            // ... sem exatamente um descritor
+} cb;
+
+// Uma thread pode parar dentro do backend até ser liberada
+static struct {
+    _Atomic pthread_t thread;
+    atomic_bool armed;
+    atomic_bool inside;
+    atomic_bool release;
+} gate;
+
+#define GATE_TIMEOUT_US  3000000
+
+static void gate_pass(void) {
+    if (!atomic_load(&gate.armed) || !pthread_equal(pthread_self(), atomic_load(&gate.thread))) {
+        return;
+    }
+    atomic_store(&gate.armed, false);
+    atomic_store(&gate.inside, true);
+    uint64_t until = host_test_now_us() + GATE_TIMEOUT_US;
+    while (!atomic_load(&gate.release) && host_test_now_us() < until) {
+        usleep(1000);
+    }
+    atomic_store(&gate.inside, false);
+}
+
+// Confere os locks que a thread segura dentro de uma chamada ao backend
+static void check_held(void) {
+    SemaphoreHandle_t held[HOST_LOCKS_MAX_HELD];
+    size_t n = host_locks_held(held, HOST_LOCKS_MAX_HELD);
+    int count[RANK_OTHER + 1] = {0};
+    for (size_t i = 0; i < n; i++) count[rank_of(held[i])]++;
+
+    atomic_fetch_add(&cb.calls, 1);
+    if (count[RANK_FD_TABLE]) atomic_fetch_add(&cb.fd_table_held, 1);
+    if (count[RANK_MOUNT]) atomic_fetch_add(&cb.mount_held, 1);
+    if (count[RANK_CACHE]) atomic_fetch_add(&cb.cache_held, 1);
+    if (count[RANK_DESCRIPTOR] != 1) atomic_fetch_add(&cb.desc_bad, 1);
+}
+
+// "/mock/f1" e "/mock_nc/f1" são "/ram/f1"
+static const char *to_ram(const char *path, char *out, size_t size) {
+    const char *rest = strchr(path + 1, '/');
+    snprintf(out, size, "/ram%s", rest ? rest : "");
+    return out;
+}
+
+#define MOCK_OPS(name)                                                              \
+    static vfs_fd_t name##_open(const char *path, int flags, int mode) {           \
+        char p[VFS_MAX_PATH];                                                       \
+        check_held();                                                               \
+        return ram->open(to_ram(path, p, sizeof(p)), flags, mode);                  \
+    }                                                                               \
+    static ssize_t name##_read(vfs_fd_t fd, void *buf, size_t size) {               \
+        check_held();                                                               \
+        ssize_t n = ram->read(fd, buf, size);                                       \
+        gate_pass();                /* Já com os bytes lidos */                     \
+        return n;                                                                   \
+    }                                                                               \
+    static ssize_t name##_write(vfs_fd_t fd, const void *buf, size_t size) {        \
+        check_held();                                                               \
+        gate_pass();                                                                \
+        return ram->write(fd, buf, size);                                           \
+    }                                                                               \
+    static off_t name##_lseek(vfs_fd_t fd, off_t offset, int whence) {              \
+        check_held();                                                               \
+        return ram->lseek(fd, offset, whence);                                      \
+    }                                                                               \
+    static esp_err_t name##_close(vfs_fd_t fd) {                                    \
+        check_held();                                                               \
+        return ram->close(fd);                                                      \
+    }                                                                               \
+    static esp_err_t name##_fstat(vfs_fd_t fd, vfs_stat_t *st) {                    \
+        check_held();                                                               \
+        return ram->fstat(fd, st);                                                  \
+    }                                                                               \
+    static const vfs_backend_ops_t name##_ops = {                                   \
+        .open = name##_open, .read = name##_read, .write = name##_write,            \
+        .lseek = name##_lseek, .close = name##_close, .fstat = name##_fstat,        \
+    };
+
+MOCK_OPS(mock)
+MOCK_OPS(mock_nc)
+
+static esp_err_t mount_nc(void) {
+    return vfs_register_backend(&(vfs_backend_config_t){
+        .type = VFS_BACKEND_RAMFS,
+        .mount_point = "/mock_nc",
+        .ops = &mock_nc_ops,
+        .flags = VFS_BACKEND_FLAG_NO_CACHE,
+    });
+}
+
+static void setup(void) {
+    host_test_section("montagem");
+    CHECK_OK(vfs_ramfs_init(&(vfs_ramfs_config_t){ .size = 256 * 1024, .max_open = 64 }));
+    ram = vfs_get_backend("/ram/x")->ops;
+    CHECK_OK(vfs_register_backend(&(vfs_backend_config_t){
+        .type = VFS_BACKEND_RAMFS,
+        .mount_point = "/mock",
+        .ops = &mock_ops,
+    }));
+    CHECK_OK(mount_nc());
+
+    // Arquivo `i` é FILE_SIZE bytes 'A' + i
+    uint8_t data[FILE_SIZE];
+    char path[32];
+    for (int i = 0; i < FILES; i++) {
+        memset(data, 'A' + i, sizeof(data));
+        snprintf(path, sizeof(path), "/ram/f%d", i);
+        CHECK_OK(vfs_write_file(path, data, sizeof(data)));
+    }
+}
+
+static const char *file_path(int id, bool cached, char *out, size_t size) {
+    snprintf(out, size, "%s/f%d", cached ? "/mock" : "/mock_nc", id);
+    return out;
+}
+
+// ========== IDENTIFICAÇÃO DOS LOCKS ==========
+
+static void identify_locks(void) {
+    host_test_section("identificação dos locks");
+    SemaphoreHandle_t got[4];
+    vfs_cache_stats_t stats;
+    vfs_stat_t st;
+
+    probe = xSemaphoreCreateMutex();
+
+    PROBE(vfs_get_backend("/mock"));
+    CHECK_EQ(probed(got, 4), 1);
+    mount_lock = got[0];
+
+    PROBE(vfs_get_cache_stats("/mock", &stats));
+    CHECK_EQ(probed(got, 4), 2);
+    cache_lock = got[0] == mount_lock ? got[1] : got[0];
+
+    // Nenhum descritor aberto ainda: fstat só consulta a tabela
+    PROBE(vfs_fstat((1 << 8) | (MAX_OPEN_FILES - 1), &st));
+    CHECK_EQ(probed(got, 4), 1);
+    fd_lock = got[0];
+
+    // O RAMFS tem o próprio lock, tomado dentro das chamadas ao backend
+    PROBE(ram->stat("/ram/f0", &st));
+    CHECK_EQ(probed(got, 4), 1);
+    ramfs_lock = got[0];
+
+    CHECK(mount_lock && cache_lock && fd_lock);
+    CHECK(mount_lock != cache_lock && cache_lock != fd_lock && mount_lock != fd_lock);
+
+    // Ocupa todas as posições da tabela para criar os locks dos descritores
+    vfs_fd_t fds[MAX_OPEN_FILES];
+    char path[32];
+    for (int i = 0; i < MAX_OPEN_FILES; i++) {
+        fds[i] = vfs_open(file_path(i % FILES, i & 1, path, sizeof(path)), VFS_O_RDWR, 0);
+        CHECK(fds[i] >= 0);
+    }
+    CHECK_EQ(vfs_open(file_path(0, true, path, sizeof(path)), VFS_O_RDWR, 0), VFS_INVALID_FD);
+
+    for (int i = 0; i < MAX_OPEN_FILES; i++) {
+        PROBE(vfs_fstat(fds[i], &st));
+        size_t n = probed(got, 4);
+        CHECK_EQ(n, 3);
+        for (size_t k = 0; k < n; k++) {
+            if (got[k] != ramfs_lock && rank_of(got[k]) == RANK_OTHER) {
+                desc_locks[desc_count++] = got[k];
+            }
+        }
+        CHECK_OK(vfs_close(fds[i]));
+    }
+    CHECK_EQ(desc_count, MAX_OPEN_FILES);
+
+    // As chamadas acima rodaram antes de os descritores serem conhecidos
+    memset(&cb, 0, sizeof(cb));
+    host_lock_reset();
+}
+
+// ========== STRESS ==========
+
+// Entrada publicada: fd nos 32 bits altos, arquivo + 1 nos baixos (0 = vazia)
+static _Atomic uint64_t shared[SHARED];
+
+// Um bit por fd público: marca o close que liberou a posição
+static _Atomic uint8_t closed[(MAX_OPEN_FILES << 15) / 8 + 1];
+
+static struct {
+    atomic_int opens, open_failed;
+    atomic_int reads, writes;
+    atomic_int wrong_data;          // Leitura com bytes de outro arquivo
+    atomic_int bad_size;
+    atomic_int double_close;        // Dois closes liberaram o mesmo fd
+    atomic_int stale_close_ok;      // close de fd já fechado aceito
+    atomic_int close_error;
+    atomic_int lock_leaked;         // Thread saiu de uma chamada com lock na mão
+    atomic_int remounts;
+    atomic_bool stop;
+} st;
+
+static uint64_t entry(vfs_fd_t fd, int id) {
+    return ((uint64_t)(uint32_t)fd << 32) | (uint64_t)(id + 1);
+}
+
+static vfs_fd_t entry_fd(uint64_t e) {
+    return (vfs_fd_t)(uint32_t)(e >> 32);
+}
+
+static int entry_id(uint64_t e) {
+    return (int)(e & 0xFF) - 1;
+}
+
+// Fecha e contabiliza: ESP_OK, ou INVALID_STATE num fd que o unmount já
+// invalidou, liberam a posição; INVALID_ARG é um fd já fechado
+static esp_err_t close_fd(vfs_fd_t fd) {
+    esp_err_t ret = vfs_close(fd);
+    if (ret == ESP_OK || ret == ESP_ERR_INVALID_STATE) {
+        uint8_t bit = 1 << (fd & 7);
+        if (atomic_fetch_or(&closed[fd >> 3], bit) & bit) {
+            atomic_fetch_add(&st.double_close, 1);
+        }
+    } else if (ret != ESP_ERR_INVALID_ARG) {
+        atomic_fetch_add(&st.close_error, 1);
+    }
+    return ret;
+}
+
+static void use_fd(uint64_t e, unsigned *seed) {
+    vfs_fd_t fd = entry_fd(e);
+    int id = entry_id(e);
+    uint8_t buf[64];
+
+    off_t at = rand_r(seed) % (FILE_SIZE - sizeof(buf));
+    if (vfs_lseek(fd, at, VFS_SEEK_SET) != at) return;     // Fechado no meio
+
+    if (rand_r(seed) % 4 == 0) {
+        memset(buf, 'A' + id, 16);
+        if (vfs_write(fd, buf, 16) == 16) atomic_fetch_add(&st.writes, 1);
+        return;
+    }
+
+    ssize_t n = vfs_read(fd, buf, sizeof(buf));
+    if (n <= 0) return;
+    atomic_fetch_add(&st.reads, 1);
+    for (ssize_t i = 0; i < n; i++) {
+        if (buf[i] != 'A' + id) {
+            atomic_fetch_add(&st.wrong_data, 1);
+            break;
+        }
+    }
+}
+
+static void *worker(void *arg) {
+    unsigned seed = (unsigned)(uintptr_t)arg * 7919 + 1;
+    vfs_fd_t last_closed = VFS_INVALID_FD;
+    char path[32];
+    vfs_stat_t vst;
+
+    for (int it = 0; it < ITERATIONS; it++) {
+        int slot = rand_r(&seed) % SHARED;
+        uint64_t e = atomic_load(&shared[slot]);
+        int op = rand_r(&seed) % 10;
+
+        if (op < 2) {
+            int id = rand_r(&seed) % FILES;
+            vfs_fd_t fd = vfs_open(file_path(id, rand_r(&seed) & 1, path, sizeof(path)), VFS_O_RDWR, 0);
+            if (fd < 0) {
+                atomic_fetch_add(&st.open_failed, 1);
+            } else {
+                atomic_fetch_add(&st.opens, 1);
+                uint64_t old = atomic_exchange(&shared[slot], entry(fd, id));
+                if (old) close_fd(entry_fd(old));
+            }
+        } else if (op == 2 && e) {
+            // Dono: tira da tabela e fecha
+            if (atomic_compare_exchange_strong(&shared[slot], &e, 0)) {
+                if (close_fd(entry_fd(e)) != ESP_ERR_INVALID_ARG) last_closed = entry_fd(e);
+            }
+        } else if (op == 3 && e) {
+            // Corrida: fecha sem tirar da tabela, o dono vai falhar depois
+            if (close_fd(entry_fd(e)) != ESP_ERR_INVALID_ARG) last_closed = entry_fd(e);
+        } else if (op == 4 && last_closed != VFS_INVALID_FD) {
+            if (vfs_close(last_closed) != ESP_ERR_INVALID_ARG) {
+                atomic_fetch_add(&st.stale_close_ok, 1);
+            }
+            last_closed = VFS_INVALID_FD;
+        } else if (op == 5 && e) {
+            if (vfs_fstat(entry_fd(e), &vst) == ESP_OK && vst.size != FILE_SIZE) {
+                atomic_fetch_add(&st.bad_size, 1);
+            }
+        } else if (e) {
+            use_fd(e, &seed);
+        }
+
+        SemaphoreHandle_t held[1];
+        if (host_locks_held(held, 1)) atomic_fetch_add(&st.lock_leaked, 1);
+    }
+    return NULL;
+}
+
+// Desmonta /mock_nc com fds abertos e em uso, e monta de novo
+static void *unmounter(void *arg) {
+    (void)arg;
+    struct timespec pause = { .tv_nsec = 500 * 1000 };
+    while (!atomic_load(&st.stop)) {
+        nanosleep(&pause, NULL);
+        if (vfs_unregister_backend("/mock_nc") != ESP_OK) break;
+        nanosleep(&pause, NULL);
+        if (mount_nc() != ESP_OK) break;
+        atomic_fetch_add(&st.remounts, 1);
+    }
+    return NULL;
+}
+
+static bool join_by(pthread_t thread, const struct timespec *deadline) {
+    return pthread_timedjoin_np(thread, NULL, deadline) == 0;
+}
+
+static bool stress(void) {
+    host_test_section("stress");
+    pthread_t workers[THREADS], remount;
+    struct timespec deadline;
+    clock_gettime(CLOCK_REALTIME, &deadline);
+    deadline.tv_sec += DEADLINE_S;
+
+    CHECK_EQ(pthread_create(&remount, NULL, unmounter, NULL), 0);
+    for (int i = 0; i < THREADS; i++) {
+        CHECK_EQ(pthread_create(&workers[i], NULL, worker, (void *)(uintptr_t)i), 0);
+    }
+
+    bool finished = true;
+    for (int i = 0; i < THREADS; i++) {
+        finished = join_by(workers[i], &deadline) && finished;
+    }
+    atomic_store(&st.stop, true);
+    finished = join_by(remount, &deadline) && finished;
+    if (!finished) {
+        // Deadlock: as threads ficam presas, o processo termina com a falha
+        host_check_failed(__FILE__, __LINE__, "threads terminaram", "deadlock?");
+        return false;
+    }
+
+    for (int i = 0; i < SHARED; i++) {
+        uint64_t e = atomic_exchange(&shared[i], 0);
+        if (e) close_fd(entry_fd(e));
+    }
+
+    printf("stress: %d opens (%d falharam), %d leituras, %d escritas, %d remontagens\n",
+           st.opens, st.open_failed, st.reads, st.writes, st.remounts);
+    CHECK(st.opens > 1000);
+    CHECK(st.reads > 1000);
+    CHECK(st.writes > 100);
+    CHECK(st.remounts > 0);
+    CHECK_EQ(st.wrong_data, 0);
+    CHECK_EQ(st.bad_size, 0);
+    CHECK_EQ(st.double_close, 0);
+    CHECK_EQ(st.stale_close_ok, 0);
+    CHECK_EQ(st.close_error, 0);
+    CHECK_EQ(st.lock_leaked, 0);
+
+    CHECK(cb.calls > 1000);
+    CHECK_EQ(cb.fd_table_held, 0);
+    CHECK_EQ(cb.mount_held, 0);
+    CHECK_EQ(cb.cache_held, 0);
+    CHECK_EQ(cb.desc_bad, 0);
+    return true;
+}
+
+// ========== ORDEM ==========
+
+static bool has_edge(const host_lock_edge_t *e, size_t n, int from, int to) {
+    for (size_t i = 0; i < n; i++) {
+        if (rank_of(e[i].held) == from && rank_of(e[i].taken) == to) return true;
+    }
+    return false;
+}
+
+// Kahn: tira nós sem arestas de entrada até sobrar só ciclo (ou nada)
+static bool acyclic(const host_lock_edge_t *e, size_t n) {
+    static bool removed[HOST_LOCKS_MAX_EDGES];
+    memset(removed, 0, sizeof(removed));
+    size_t left = n;
+    bool progress = true;
+    while (left && progress) {
+        progress = false;
+        for (size_t i = 0; i < n; i++) {
+            if (removed[i]) continue;
+            bool has_incoming = false;
+            for (size_t k = 0; k < n && !has_incoming; k++) {
+                has_incoming = !removed[k] && e[k].taken == e[i].held;
+            }
+            if (!has_incoming) {
+                // Todas as arestas que saem de e[i].held
+                for (size_t k = 0; k < n; k++) {
+                    if (!removed[k] && e[k].held == e[i].held) {
+                        removed[k] = true;
+                        left--;
+                    }
+                }
+                progress = true;
+            }
+        }
+    }
+    return left == 0;
+}
+
+static void lock_order(void) {
+    host_test_section("ordem dos locks");
+    size_t n = host_lock_edges(edges, HOST_LOCKS_MAX_EDGES);
+    CHECK(n < HOST_LOCKS_MAX_EDGES);
+
+    static const char *names[] = { "descritor", "mount", "cache", "tabela de fds" };
+    int wrong = 0;
+    for (size_t i = 0; i < n; i++) {
+        int from = rank_of(edges[i].held), to = rank_of(edges[i].taken);
+        if (from == RANK_OTHER || to == RANK_OTHER || from < to) continue;
+        printf("ordem: %s -> %s\n", names[from], names[to]);
+        wrong++;
+    }
+    CHECK_EQ(wrong, 0);
+
+    // Os caminhos que a ordem documenta foram de fato exercitados
+    CHECK(has_edge(edges, n, RANK_DESCRIPTOR, RANK_CACHE));
+    CHECK(has_edge(edges, n, RANK_DESCRIPTOR, RANK_FD_TABLE));
+    CHECK(has_edge(edges, n, RANK_MOUNT, RANK_CACHE));
+    CHECK(has_edge(edges, n, RANK_MOUNT, RANK_FD_TABLE));
+    CHECK(acyclic(edges, n));
+}
+
+// ========== PROGRESSO EM PARALELO ==========
+
+static struct {
+    vfs_fd_t fd;
+    bool write;
+    ssize_t ret;
+} stalled;
+
+static void *stalled_call(void *arg) {
+    (void)arg;
+    uint8_t buf[64];
+    atomic_store(&gate.thread, pthread_self());
+    atomic_store(&gate.armed, true);
+    if (stalled.write) {
+        memset(buf, 'w', sizeof(buf));
+        stalled.ret = vfs_write(stalled.fd, buf, sizeof(buf));
+    } else {
+        stalled.ret = vfs_read(stalled.fd, buf, sizeof(buf));
+    }
+    return NULL;
+}
+
+// Um descritor parado dentro do backend (um SD lento, um pcap grande) e
+// outro, em outro arquivo da mesma montagem com cache, lendo e escrevendo
+// enquanto isso. Antes, o lock global do cache segurava o segundo até o
+// primeiro voltar.
+static void parallel_progress(bool write) {
+    host_test_section(write ? "progresso em paralelo (escrita parada)"
+                            : "progresso em paralelo (leitura parada)");
+    uint8_t data[FILE_SIZE], buf[64];
+    memset(data, 'p', sizeof(data));
+    CHECK_OK(vfs_write_file("/ram/p0", data, sizeof(data)));
+    CHECK_OK(vfs_write_file("/ram/p1", data, sizeof(data)));
+
+    vfs_fd_t a = vfs_open("/mock/p0", VFS_O_RDWR, 0);
+    vfs_fd_t b = vfs_open("/mock/p1", VFS_O_RDWR, 0);
+    CHECK(a >= 0 && b >= 0);
+
+    memset(&gate, 0, sizeof(gate));
+    stalled.fd = a;
+    stalled.write = write;
+    pthread_t thread;
+    CHECK_EQ(pthread_create(&thread, NULL, stalled_call, NULL), 0);
+    uint64_t until = host_test_now_us() + GATE_TIMEOUT_US;
+    while (!atomic_load(&gate.inside) && host_test_now_us() < until) {
+        usleep(1000);
+    }
+    CHECK(atomic_load(&gate.inside));
+
+    // Perda no cache (vai ao backend), acerto, escrita e seek em p1
+    uint64_t start = host_test_now_us();
+    CHECK_EQ(vfs_lseek(b, 1024, VFS_SEEK_SET), 1024);
+    CHECK_EQ(vfs_read(b, buf, sizeof(buf)), (ssize_t)sizeof(buf));
+    CHECK_EQ(buf[0], 'p');
+    CHECK_EQ(vfs_lseek(b, 1024, VFS_SEEK_SET), 1024);
+    CHECK_EQ(vfs_read(b, buf, sizeof(buf)), (ssize_t)sizeof(buf));
+    CHECK_EQ(vfs_write(b, buf, sizeof(buf)), (ssize_t)sizeof(buf));
+    uint64_t took = host_test_now_us() - start;
+
+    // p1 terminou com p0 ainda dentro do backend
+    CHECK(atomic_load(&gate.inside));
+    printf("progresso: p1 em %" PRIu64 " us com p0 parado\n", took);
+
+    atomic_store(&gate.release, true);
+    CHECK_EQ(pthread_join(thread, NULL), 0);
+    CHECK_EQ(stalled.ret, (ssize_t)sizeof(buf));
+    CHECK_OK(vfs_close(a));
+    CHECK_OK(vfs_close(b));
+}
+
+// Uma leitura parada com os bytes antigos enquanto outro descritor escreve
+// no mesmo arquivo: ela devolve o que leu, mas o bloco não entra no cache
+static void fill_raced_by_write(void) {
+    host_test_section("leitura concorrente com escrita");
+    uint8_t data[FILE_SIZE], buf[64];
+    memset(data, 'p', sizeof(data));
+    CHECK_OK(vfs_write_file("/ram/p2", data, sizeof(data)));
+
+    vfs_fd_t a = vfs_open("/mock/p2", VFS_O_RDONLY, 0);
+    vfs_fd_t w = vfs_open("/mock/p2", VFS_O_RDWR, 0);
+    CHECK(a >= 0 && w >= 0);
+
+    memset(&gate, 0, sizeof(gate));
+    stalled.fd = a;
+    stalled.write = false;
+    pthread_t thread;
+    CHECK_EQ(pthread_create(&thread, NULL, stalled_call, NULL), 0);
+    uint64_t until = host_test_now_us() + GATE_TIMEOUT_US;
+    while (!atomic_load(&gate.inside) && host_test_now_us() < until) {
+        usleep(1000);
+    }
+    CHECK(atomic_load(&gate.inside));
+
+    memset(buf, 'q', sizeof(buf));
+    CHECK_EQ(vfs_write(w, buf, sizeof(buf)), (ssize_t)sizeof(buf));
+    atomic_store(&gate.release, true);
+    CHECK_EQ(pthread_join(thread, NULL), 0);
+    CHECK_EQ(stalled.ret, (ssize_t)sizeof(buf));
+
+    CHECK_EQ(vfs_lseek(a, 0, VFS_SEEK_SET), 0);
+    CHECK_EQ(vfs_read(a, buf, sizeof(buf)), (ssize_t)sizeof(buf));
+    CHECK_EQ(buf[0], 'q');
+    CHECK_EQ(buf[sizeof(buf) - 1], 'q');
+    CHECK_OK(vfs_close(a));
+    CHECK_OK(vfs_close(w));
+}
+
+// Nada vazou: a tabela inteira volta a estar livre
+static void no_leaks(void) {
+    host_test_section("tabela livre no fim");
+    vfs_fd_t fds[MAX_OPEN_FILES];
+    char path[32];
+    int opened = 0;
+    for (int i = 0; i < MAX_OPEN_FILES; i++) {
+        fds[i] = vfs_open(file_path(i % FILES, i & 1, path, sizeof(path)), VFS_O_RDWR, 0);
+        opened += fds[i] >= 0;
+    }
+    CHECK_EQ(opened, MAX_OPEN_FILES);
+    CHECK_EQ(vfs_open(file_path(0, true, path, sizeof(path)), VFS_O_RDWR, 0), VFS_INVALID_FD);
+    for (int i = 0; i < MAX_OPEN_FILES; i++) {
+        if (fds[i] >= 0) CHECK_OK(vfs_close(fds[i]));
+    }
+
+    CHECK_OK(vfs_unregister_backend("/mock"));
+    CHECK_OK(vfs_unregister_backend("/mock_nc"));
+    CHECK_OK(vfs_ramfs_deinit());
+}
+
+int main(void) {
+    setup();
+    identify_locks();
+    bool finished = stress();
+    lock_order();
+    if (finished) {
+        parallel_progress(false);
+        parallel_progress(true);
+        fill_raced_by_write();
+        no_leaks();
+    }
+    return host_test_finish("test_vfs_fd_stress");
+}
@@ -0,0 +1,386 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Índice de linhas (vfs_lineindex.c) sobre arquivos sintéticos de vários MB
+// no backend em memória. Cada resposta (contagem, posição, páginas, cauda) é
+// conferida com um modelo montado do mesmo texto, e os contadores do índice
+// e do backend mostram que o arquivo é lido uma vez só: appends estendem o
+// índice, reescritas o reconstroem e o sidecar evita o rescan depois que o
+// índice sai da RAM.
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include "vfs_core.h"
+#include "vfs_config.h"
+#include "vfs_lineindex.h"
+#include "vfs_stream.h"
+#include "mem_backend.h"
+#include "host_test.h"
+
+#define LOG         "/mem/log.txt"
+#define CSV         "/mem/big.csv"
+
+// ========== MODELO ==========
+
+static struct {
+    char *text;
+    size_t len, cap;
+    size_t *starts;             // Início de cada linha, starts[lines] = len
+    uint32_t lines;
+} ref;
+
+static void ref_reserve(size_t len) {
+    if (len <= ref.cap) return;
+    ref.cap = len * 2;
+    ref.text = realloc(ref.text, ref.cap);
+}
+
+static void ref_index(void) {
+    free(ref.starts);
+    ref.starts = malloc((ref.len + 2) * sizeof(size_t));
+    ref.lines = 0;
+    size_t start = 0;
+    for (size_t i = 0; i < ref.len; i++) {
+        if (ref.text[i] == '\n') {
+            ref.starts[ref.lines++] = start;
+            start = i + 1;
+        }
+    }
+    if (start < ref.len) ref.starts[ref.lines++] = start;
+    ref.starts[ref.lines] = ref.len;
+}
+
+// Linha esperada no callback: sem '\n' e cortada em VFS_LINEINDEX_LINE_MAX - 1
+static void ref_line(uint32_t number, char *out) {
+    size_t start = ref.starts[number - 1], end = start;
+    while (end < ref.len && ref.text[end] != '\n') end++;
+    size_t len = end - start;
+    if (len > VFS_LINEINDEX_LINE_MAX - 1) len = VFS_LINEINDEX_LINE_MAX - 1;
+    memcpy(out, ref.text + start, len);
+    out[len] = '\0';
+}
+
+// Texto de ~size bytes: linhas numeradas, umas curtas, umas só com o número
+// e umas maiores que VFS_LINEINDEX_LINE_MAX
+static void generate(size_t size, unsigned seed, bool trailing_newline) {
+    ref_reserve(size + 4096);
+    ref.len = 0;
+    for (int k = 0; ref.len < size; k++) {
+        int r = rand_r(&seed) % 100;
+        int len = r < 5 ? 0 : r < 7 ? 600 + rand_r(&seed) % 900 : 10 + rand_r(&seed) % 60;
+        ref.len += sprintf(ref.text + ref.len, "%07d:", k);
+        for (int i = 0; i < len; i++) ref.text[ref.len++] = 'a' + (i + k) % 26;
+        ref.text[ref.len++] = '\n';
+    }
+    if (!trailing_newline) ref.len--;
+    ref_index();
+}
+
+static void write_file(const char *path, const char *data, size_t len, bool append) {
+    int flags = VFS_O_WRONLY | VFS_O_CREAT | (append ? VFS_O_APPEND : VFS_O_TRUNC);
+    vfs_fd_t fd = vfs_open(path, flags, 0644);
+    CHECK(fd != VFS_INVALID_FD);
+    for (size_t at = 0; at < len; ) {
+        size_t n = len - at > 8192 ? 8192 : len - at;
+        CHECK_EQ(vfs_write(fd, data + at, n), n);
+        at += n;
+    }
+    vfs_close(fd);
+}
+
+// Acrescenta ao arquivo e ao modelo
+static void append(const char *path, const char *data, size_t len) {
+    ref_reserve(ref.len + len);
+    memcpy(ref.text + ref.len, data, len);
+    ref.len += len;
+    ref_index();
+    write_file(path, data, len, true);
+}
+
+// ========== CONFERÊNCIA ==========
+
+typedef struct {
+    uint32_t next;              // Número esperado da próxima linha
+    uint32_t count;
+    int bad;
+} lines_t;
+
+static void check_line(const char *line, uint32_t number, void *user_data) {
+    lines_t *got = user_data;
+    char want[VFS_LINEINDEX_LINE_MAX];
+    ref_line(number, want);
+    if (number != got->next || strcmp(line, want) != 0) got->bad++;
+    got->next++;
+    got->count++;
+}
+
+static uint32_t min_u32(uint32_t a, uint32_t b) {
+    return a < b ? a : b;
+}
+
+static void verify(const char *path, int samples, unsigned seed) {
+    uint32_t lines = 0;
+    CHECK_OK(vfs_lineindex_count(path, &lines));
+    CHECK_EQ(lines, ref.lines);
+    if (lines != ref.lines || lines == 0) return;
+
+    int bad = 0;
+    for (int i = 0; i < samples; i++) {
+        uint32_t k = 1 + rand_r(&seed) % lines;
+        lines_t got = { .next = k };
+        size_t offset = 0;
+        bad += vfs_lineindex_read(path, k, 5, check_line, &got) != ESP_OK ||
+               got.bad || got.count != min_u32(5, lines - k + 1);
+        bad += vfs_lineindex_locate(path, k, &offset) != ESP_OK || offset != ref.starts[k - 1];
+    }
+    CHECK_EQ(bad, 0);
+
+    lines_t first = { .next = 1 };
+    CHECK_OK(vfs_lineindex_read(path, 1, 3, check_line, &first));
+    CHECK(first.bad == 0 && first.count == min_u32(3, lines));
+
+    lines_t tail = { .next = lines > 9 ? lines - 9 : 1 };
+    CHECK_OK(vfs_lineindex_tail(path, 10, check_line, &tail));
+    CHECK(tail.bad == 0 && tail.count == min_u32(10, lines));
+
+    lines_t last = { .next = lines };
+    CHECK_OK(vfs_lineindex_read(path, lines, 100, check_line, &last));
+    CHECK(last.bad == 0 && last.count == 1);
+
+    lines_t past = { 0 };
+    CHECK_EQ(vfs_lineindex_read(path, lines + 1, 1, check_line, &past), ESP_ERR_NOT_FOUND);
+    size_t offset;
+    CHECK_EQ(vfs_lineindex_locate(path, lines + 1, &offset), ESP_ERR_NOT_FOUND);
+}
+
+static vfs_lineindex_stats_t stats(void) {
+    vfs_lineindex_stats_t st;
+    vfs_lineindex_get_stats(&st);
+    return st;
+}
+
+static unsigned backend_reads(void) {
+    mem_backend_calls_t calls;
+    mem_backend_get_calls(&calls);
+    return calls.read;
+}
+
+// Tira os índices de LOG e CSV da RAM, consultando outros arquivos
+static void evict(void) {
+    uint32_t lines;
+    write_file("/mem/a.txt", "a\nb\n", 4, false);
+    write_file("/mem/b.txt", "", 0, false);
+    write_file("/mem/c.txt", "\n", 1, false);
+    CHECK_OK(vfs_lineindex_count("/mem/a.txt", &lines));
+    CHECK_EQ(lines, 2);
+    CHECK_OK(vfs_lineindex_count("/mem/b.txt", &lines));
+    CHECK_EQ(lines, 0);
+    CHECK_OK(vfs_lineindex_count("/mem/c.txt", &lines));
+    CHECK_EQ(lines, 1);
+}
+
+// ========== TESTES ==========
+
+static void test_build(void) {
+    host_test_section("4 MB");
+    generate(4 * 1024 * 1024, 1, true);
+    write_file(LOG, ref.text, ref.len, false);
+    vfs_lineindex_reset_stats();
+    mem_backend_reset_calls();
+
+    int64_t t0 = host_test_now_us();
+    verify(LOG, 300, 1);
+    vfs_lineindex_stats_t st = stats();
+    printf("%u linhas, %zu bytes: índice em %lld ms\n", ref.lines, ref.len,
+           (long long)(host_test_now_us() - t0) / 1000);
+    CHECK_EQ(st.builds, 1);
+    CHECK_EQ(st.scanned_bytes, ref.len);
+    CHECK(st.hits > 300);
+
+    // Uma linha qualquer: um seek e uma leitura curta, não um scan
+    unsigned reads = backend_reads();
+    lines_t got = { .next = ref.lines / 2 };
+    CHECK_OK(vfs_lineindex_read(LOG, ref.lines / 2, 1, check_line, &got));
+    CHECK(got.bad == 0 && got.count == 1);
+    printf("  linha do meio: %u leituras no backend\n", backend_reads() - reads);
+    CHECK(backend_reads() - reads <= 4);
+
+    reads = backend_reads();
+    lines_t tail = { .next = ref.lines - 49 };
+    CHECK_OK(vfs_lineindex_tail(LOG, 50, check_line, &tail));
+    CHECK(tail.bad == 0 && tail.count == 50);
+    // Só os blocos das últimas linhas, mais o do marco anterior a elas
+    size_t span = ref.len - ref.starts[ref.lines - 50];
+    printf("  últimas 50 (%zu bytes): %u leituras no backend\n", span, backend_reads() - reads);
+    CHECK(backend_reads() - reads <= span / VFS_CACHE_BLOCK_SIZE + 4);
+}
+
+// Páginas de 20 linhas pelo índice contra a mesma linha achada lendo do início
+static void test_paging_cost(void) {
+    host_test_section("paginação");
+    unsigned seed = 5, reads = backend_reads();
+    for (int i = 0; i < 200; i++) {
+        lines_t got = { .next = 1 + rand_r(&seed) % (ref.lines - 20) };
+        CHECK_OK(vfs_lineindex_read(LOG, got.next, 20, check_line, &got));
+        CHECK(got.bad == 0 && got.count == 20);
+    }
+    unsigned indexed = backend_reads() - reads;
+
+    reads = backend_reads();
+    for (int i = 0; i < 5; i++) {
+        uint32_t k = 1 + rand_r(&seed) % ref.lines, n = 0;
+        vfs_stream_t stream;
+        char line[VFS_LINEINDEX_LINE_MAX];
+        CHECK_OK(vfs_stream_open(&stream, LOG));
+        while (vfs_stream_gets(&stream, line, sizeof(line)) >= 0 && ++n < k) {
+        }
+        vfs_stream_close(&stream);
+    }
+    unsigned scanned = backend_reads() - reads;
+    printf("  leituras no backend por página: índice %.1f, scan %.1f\n",
+           indexed / 200.0, scanned / 5.0);
+    CHECK(indexed / 200 * 20 < scanned / 5);
+}
+
+static void test_append(void) {
+    host_test_section("append");
+    static char more[200000];
+    size_t len = 0;
+    for (int i = 0; i < 5000; i++) len += sprintf(more + len, "appended %d\n", i);
+    append(LOG, more, len);
+
+    vfs_lineindex_reset_stats();
+    verify(LOG, 100, 2);
+    vfs_lineindex_stats_t st = stats();
+    CHECK_EQ(st.builds, 0);
+    CHECK_EQ(st.rebuilds, 0);
+    CHECK_EQ(st.extends, 1);
+    CHECK_EQ(st.scanned_bytes, len);
+
+    // Última linha sem '\n', completada depois
+    append(LOG, "partial", 7);
+    verify(LOG, 20, 3);
+    append(LOG, " done\nx\n", 8);
+    verify(LOG, 20, 4);
+    CHECK_EQ(stats().builds, 0);
+}
+
+static void test_rewrite(void) {
+    host_test_section("reescrita");
+    // Mesmo tamanho, outro conteúdo
+    generate(ref.len, 7, true);
+    write_file(LOG, ref.text, ref.len, false);
+    vfs_lineindex_reset_stats();
+    verify(LOG, 50, 5);
+    CHECK_EQ(stats().rebuilds, 1);
+
+    // Menor, sem '\n' no fim
+    generate(100000, 9, false);
+    write_file(LOG, ref.text, ref.len, false);
+    verify(LOG, 50, 6);
+
+    // Alterado por fora do VFS, mesmo tamanho: o início já não bate
+    ref.text[3] = '\n';
+    ref_index();
+    CHECK_OK(mem_backend_patch(LOG, 3, "\n", 1));
+    vfs_lineindex_reset_stats();
+    verify(LOG, 50, 7);
+    CHECK_EQ(stats().rebuilds, 1);
+}
+
+static void test_sidecar(void) {
+    host_test_section("sidecar");
+    generate(3 * 1024 * 1024, 11, true);
+    write_file(CSV, ref.text, ref.len, false);
+    verify(CSV, 50, 8);
+
+    evict();
+    CHECK(vfs_exists(CSV VFS_LINEINDEX_SIDECAR_EXT));
+    vfs_lineindex_reset_stats();
+    mem_backend_reset_calls();
+    verify(CSV, 50, 9);
+    vfs_lineindex_stats_t st = stats();
+    CHECK_EQ(st.sidecar_loads, 1);
+    CHECK_EQ(st.builds, 0);
+    CHECK_EQ(st.scanned_bytes, 0);
+    mem_backend_calls_t calls;
+    mem_backend_get_calls(&calls);
+    CHECK(calls.bytes_read < ref.len / 8);
+
+    // Cresceu enquanto o índice estava só no sidecar: estende
+    append(CSV, "1,2,3\n4,5,6\n", 12);
+    evict();
+    vfs_lineindex_reset_stats();
+    verify(CSV, 20, 10);
+    st = stats();
+    CHECK_EQ(st.sidecar_loads, 1);
+    CHECK_EQ(st.extends, 1);
+    CHECK_EQ(st.scanned_bytes, 12);
+
+    // Sidecar corrompido é ignorado
+    evict();
+    write_file(CSV VFS_LINEINDEX_SIDECAR_EXT, "garbage", 7, false);
+    vfs_lineindex_reset_stats();
+    verify(CSV, 10, 11);
+    CHECK_EQ(stats().builds, 1);
+
+    vfs_lineindex_forget(CSV);
+    CHECK(!vfs_exists(CSV VFS_LINEINDEX_SIDECAR_EXT));
+}
+
+// Consultas concorrentes com um arquivo crescendo
+static volatile bool readers_stop;
+
+static void *reader(void *arg) {
+    const char *path = arg;
+    unsigned seed = 1;
+    while (!readers_stop) {
+        uint32_t lines = 0;
+        size_t offset;
+        vfs_lineindex_count(path, &lines);
+        if (lines) vfs_lineindex_locate(path, 1 + rand_r(&seed) % lines, &offset);
+    }
+    return NULL;
+}
+
+static void test_concurrent_append(void) {
+    host_test_section("append concorrente");
+    write_file("/mem/a.txt", "a\nb\n", 4, false);
+    pthread_t readers[2];
+    for (int i = 0; i < 2; i++) pthread_create(&readers[i], NULL, reader, "/mem/a.txt");
+    for (int i = 0; i < 2000; i++) write_file("/mem/a.txt", "line\n", 5, true);
+    readers_stop = true;
+    for (int i = 0; i < 2; i++) pthread_join(readers[i], NULL);
+
+    uint32_t lines = 0;
+    CHECK_OK(vfs_lineindex_count("/mem/a.txt", &lines));
+    CHECK_EQ(lines, 2002);
+}
+
+int main(void) {
+    CHECK_OK(mem_backend_mount("/mem", 0));
+    test_build();
+    test_paging_cost();
+    test_append();
+    test_rewrite();
+    test_sidecar();
+    test_concurrent_append();
+    CHECK_OK(mem_backend_unmount());
+    free(ref.text);
+    free(ref.starts);
+    return host_test_finish("test_vfs_lineindex");
+}
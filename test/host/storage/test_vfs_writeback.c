@@ -0,0 +1,316 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Serviço de write-back (vfs_writeback.c) sobre o backend em memória com
+// latência injetada: cada chamada ao "cartão" leva 2 ms e uma escrita a cada
+// dez leva 60 ms a mais. Seis threads gravam registros numerados em quatro
+// arquivos (três delas no mesmo); no fim cada arquivo tem que conter todos os
+// registros, inteiros e em ordem por thread. Também confere o alinhamento das
+// escritas, a contrapressão, os flushes por idade e por ociosidade, as falhas
+// de escrita e a remoção do backend com dados na fila.
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "vfs_core.h"
+#include "vfs_writeback.h"
+#include "mem_backend.h"
+#include "host_test.h"
+
+#define PRODUCERS       6
+#define RECORDS         400
+#define RECORD_MAX      600
+#define HDR             5           // thread, número (16 bits), tamanho (16 bits)
+#define CALL_US         2000
+#define SPIKE_US        60000
+#define SPIKE_EVERY     10
+
+static mem_backend_calls_t calls;
+
+static size_t file_len(const char *path) {
+    size_t len = 0;
+    uint8_t dummy;
+    return mem_backend_get(path, &dummy, 0, &len) ? len : 0;
+}
+
+static bool file_is(const char *path, const char *text) {
+    char buf[64];
+    size_t len = 0;
+    return mem_backend_get(path, buf, sizeof(buf), &len) &&
+           len == strlen(text) && memcmp(buf, text, len) == 0;
+}
+
+static void test_basics(void) {
+    host_test_section("básico");
+    vfs_writeback_stats_t st;
+    CHECK_EQ(vfs_writeback_append("/mem/x", "a", 1, 10), ESP_ERR_INVALID_STATE);
+
+    vfs_writeback_config_t cfg = { .flush_ms = 50, .idle_ms = 200 };
+    CHECK_OK(vfs_writeback_start(&cfg));
+    CHECK_EQ(vfs_writeback_start(&cfg), ESP_ERR_INVALID_STATE);
+    CHECK(vfs_writeback_is_running());
+
+    // Só aparece no arquivo depois do flush
+    CHECK_OK(vfs_writeback_append("/mem/log", "hello ", 6, 100));
+    CHECK_OK(vfs_writeback_append("/mem/log", "world", 5, 100));
+    CHECK_EQ(file_len("/mem/log"), 0);
+    CHECK_OK(vfs_writeback_flush("/mem/log", 1000));
+    CHECK(file_is("/mem/log", "hello world"));
+
+    mem_backend_reset_calls();
+    CHECK_OK(vfs_writeback_sync("/mem/log", 1000));
+    mem_backend_get_calls(&calls);
+    CHECK_EQ(calls.fsync, 1);
+    CHECK_EQ(vfs_writeback_flush("/mem/none", 10), ESP_ERR_NOT_FOUND);
+
+    // Pedaço parcial mais velho que flush_ms é escrito sozinho
+    CHECK_OK(vfs_writeback_append("/mem/log", "!", 1, 100));
+    usleep(150000);
+    CHECK(file_is("/mem/log", "hello world!"));
+
+    // Arquivo parado por idle_ms é fechado
+    mem_backend_reset_calls();
+    usleep(400000);
+    mem_backend_get_calls(&calls);
+    CHECK_EQ(calls.close, 1);
+    CHECK_OK(vfs_writeback_get_stats(&st));
+    CHECK_EQ(st.open_streams, 0);
+    CHECK_EQ(vfs_writeback_close("/mem/log"), ESP_ERR_NOT_FOUND);
+
+    static char big[VFS_WRITEBACK_BUDGET];
+    CHECK_EQ(vfs_writeback_append("/mem/big", big, sizeof(big), 10), ESP_ERR_INVALID_SIZE);
+}
+
+// ========== PRODUTORES ==========
+
+static struct {
+    int timeouts;
+    int errors;
+    int64_t max_us;
+    int64_t total_us;
+} producer[PRODUCERS];
+
+static const char *producer_path(int t) {
+    static const char *paths[] = { "/mem/f0", "/mem/f1", "/mem/f2", "/mem/shared" };
+    return paths[t < 3 ? t : 3];
+}
+
+static size_t make_record(uint8_t *rec, int t, int i, unsigned *seed) {
+    size_t len = HDR + rand_r(seed) % (RECORD_MAX - HDR);
+    rec[0] = t;
+    rec[1] = i & 0xFF;
+    rec[2] = i >> 8;
+    rec[3] = len & 0xFF;
+    rec[4] = len >> 8;
+    for (size_t k = HDR; k < len; k++) rec[k] = (uint8_t)(t * 31 + i + k);
+    return len;
+}
+
+static void *produce(void *arg) {
+    int t = (int)(intptr_t)arg;
+    unsigned seed = t * 7 + 1;
+    uint8_t rec[RECORD_MAX];
+    for (int i = 0; i < RECORDS; i++) {
+        size_t len = make_record(rec, t, i, &seed);
+        int64_t t0 = host_test_now_us();
+        esp_err_t ret;
+        while ((ret = vfs_writeback_append(producer_path(t), rec, len, 20)) == ESP_ERR_TIMEOUT) {
+            producer[t].timeouts++;
+        }
+        int64_t dt = host_test_now_us() - t0;
+        producer[t].total_us += dt;
+        if (dt > producer[t].max_us) producer[t].max_us = dt;
+        if (ret != ESP_OK) producer[t].errors++;
+    }
+    return NULL;
+}
+
+// Registros inteiros, e os de cada thread em ordem; devolve quantos
+static int verify(const char *path, unsigned threads) {
+    static uint8_t data[PRODUCERS * RECORDS * RECORD_MAX];
+    size_t len = 0;
+    if (!mem_backend_get(path, data, sizeof(data), &len) || len > sizeof(data)) return -1;
+
+    int next[PRODUCERS] = {0}, count = 0;
+    for (size_t at = 0; at < len; count++) {
+        if (at + HDR > len) return -1;
+        int t = data[at], i = data[at + 1] | data[at + 2] << 8;
+        size_t n = data[at + 3] | data[at + 4] << 8;
+        if (t >= PRODUCERS || !(threads & (1u << t)) || i != next[t] || at + n > len) return -1;
+        for (size_t k = HDR; k < n; k++) {
+            if (data[at + k] != (uint8_t)(t * 31 + i + k)) return -1;
+        }
+        next[t]++;
+        at += n;
+    }
+    for (int t = 0; t < PRODUCERS; t++) {
+        if ((threads & (1u << t)) && next[t] != RECORDS) return -1;
+    }
+    return count;
+}
+
+static int cmp_us(const void *a, const void *b) {
+    int64_t x = *(const int64_t *)a, y = *(const int64_t *)b;
+    return (x > y) - (x < y);
+}
+
+static int64_t median_us(int64_t *v, int n) {
+    qsort(v, n, sizeof(int64_t), cmp_us);
+    return v[n / 2];
+}
+
+static void test_latency(void) {
+    host_test_section("latência injetada");
+    vfs_writeback_stats_t st;
+    mem_backend_set_latency(CALL_US, 0);
+    mem_backend_set_spikes(SPIKE_US, SPIKE_EVERY);
+    mem_backend_reset_calls();
+    vfs_writeback_reset_stats();
+
+    pthread_t threads[PRODUCERS];
+    for (int t = 0; t < PRODUCERS; t++) {
+        pthread_create(&threads[t], NULL, produce, (void *)(intptr_t)t);
+    }
+    for (int t = 0; t < PRODUCERS; t++) pthread_join(threads[t], NULL);
+    CHECK_OK(vfs_writeback_flush(NULL, 10000));
+
+    CHECK_OK(vfs_writeback_get_stats(&st));
+    mem_backend_get_calls(&calls);
+    int64_t max_us = 0, total_us = 0;
+    int timeouts = 0, errors = 0;
+    for (int t = 0; t < PRODUCERS; t++) {
+        if (producer[t].max_us > max_us) max_us = producer[t].max_us;
+        total_us += producer[t].total_us;
+        timeouts += producer[t].timeouts;
+        errors += producer[t].errors;
+    }
+    printf("write-back: %d registros em %u escritas e %u opens no backend\n",
+           PRODUCERS * RECORDS, calls.write, calls.open);
+    printf("  fila: até %zu bytes / %u de %u pedaços; %u esperas (pior %u us), "
+           "escrita mais lenta %u us\n", st.max_queued_bytes, st.max_queued_chunks,
+           st.total_chunks, st.stalls, st.max_stall_us, st.max_write_us);
+    printf("  append: média %lld us, pior %lld us, %d timeouts\n",
+           (long long)(total_us / (PRODUCERS * RECORDS)), (long long)max_us, timeouts);
+
+    CHECK_EQ(errors, 0);
+    CHECK_EQ(st.written_bytes, st.appended_bytes);
+    CHECK_EQ(st.queued_bytes, 0);
+    CHECK_EQ(st.errors, 0);
+    CHECK(st.max_queued_chunks <= st.total_chunks);
+    CHECK(st.stalls > 0 && st.max_stall_us > 0);
+    CHECK(st.max_write_us >= SPIKE_US);
+    CHECK(calls.write * 3 < PRODUCERS * RECORDS);
+    CHECK(calls.open <= 4);
+
+    for (int t = 0; t < 3; t++) CHECK_EQ(verify(producer_path(t), 1u << t), RECORDS);
+    CHECK_EQ(verify("/mem/shared", 0x38), 3 * RECORDS);
+
+    // Pedaços inteiros começam em múltiplos do tamanho do pedaço
+    static mem_backend_write_t writes[MEM_BACKEND_MAX_WRITES];
+    size_t n = mem_backend_get_writes(writes, MEM_BACKEND_MAX_WRITES);
+    int full = 0, misaligned = 0;
+    for (size_t i = 0; i < n; i++) {
+        if (writes[i].size != VFS_WRITEBACK_CHUNK) continue;
+        full++;
+        misaligned += writes[i].offset % VFS_WRITEBACK_CHUNK != 0;
+    }
+    CHECK(full > 0);
+    CHECK_EQ(misaligned, 0);
+
+    // Uma thread só, abaixo do orçamento da fila: o append não espera o
+    // cartão. Gravando direto (abre, escreve no fim e fecha, como
+    // storage_append_binary fazia) cada registro paga as chamadas ao cartão.
+    mem_backend_set_spikes(0, 0);
+    uint8_t rec[RECORD_MAX];
+    unsigned seed = 99;
+    int64_t queued_us[20], direct_us[20];
+    for (int i = 0; i < 20; i++) {
+        size_t len = make_record(rec, 0, i, &seed);
+        int64_t t0 = host_test_now_us();
+        CHECK_OK(vfs_writeback_append("/mem/queued", rec, len, 100));
+        queued_us[i] = host_test_now_us() - t0;
+    }
+    CHECK_OK(vfs_writeback_close("/mem/queued"));
+    for (int i = 0; i < 20; i++) {
+        size_t len = make_record(rec, 0, i, &seed);
+        int64_t t0 = host_test_now_us();
+        vfs_fd_t fd = vfs_open("/mem/direct", VFS_O_WRONLY | VFS_O_CREAT | VFS_O_APPEND, 0);
+        CHECK_EQ(vfs_write(fd, rec, len), len);
+        vfs_close(fd);
+        direct_us[i] = host_test_now_us() - t0;
+    }
+    // Medianas: numa máquina carregada um append ou outro perde a CPU
+    int64_t queued = median_us(queued_us, 20), direct = median_us(direct_us, 20);
+    printf("  uma thread: append %lld us, direto %lld us por registro (medianas)\n",
+           (long long)queued, (long long)direct);
+    CHECK(queued * 10 < direct);
+    mem_backend_set_latency(0, 0);
+}
+
+static void test_failures(void) {
+    host_test_section("falhas de escrita");
+    vfs_writeback_stats_t st;
+    vfs_writeback_reset_stats();
+
+    // Reportada pelo flush; os dados da fila se perdem e o arquivo reabre
+    CHECK_OK(vfs_writeback_append("/mem/e", "abc", 3, 100));
+    mem_backend_fail_writes(1);
+    CHECK_EQ(vfs_writeback_flush("/mem/e", 1000), ESP_FAIL);
+    CHECK_OK(vfs_writeback_get_stats(&st));
+    CHECK_EQ(st.errors, 1);
+    CHECK_EQ(st.dropped_bytes, 3);
+    CHECK_OK(vfs_writeback_append("/mem/e", "xyz", 3, 100));
+    CHECK_OK(vfs_writeback_close("/mem/e"));
+    CHECK(file_is("/mem/e", "xyz"));
+
+    // Reportada pelo próximo append
+    CHECK_OK(vfs_writeback_append("/mem/e2", "abc", 3, 100));
+    mem_backend_fail_writes(1);
+    usleep(200000);
+    CHECK_EQ(vfs_writeback_append("/mem/e2", "d", 1, 100), ESP_FAIL);
+    CHECK_OK(vfs_writeback_append("/mem/e2", "d", 1, 100));
+    CHECK_OK(vfs_writeback_close("/mem/e2"));
+    CHECK(file_is("/mem/e2", "d"));
+}
+
+// Backend removido com dados na fila: erro, sem travar nem escrever no nada
+static void test_unplug(void) {
+    host_test_section("backend removido");
+    CHECK_OK(vfs_writeback_append("/mem/u", "zz", 2, 100));
+    CHECK_OK(vfs_unregister_backend("/mem"));
+    CHECK_EQ(vfs_writeback_flush("/mem/u", 1000), ESP_FAIL);
+    CHECK_EQ(vfs_writeback_append("/mem/u", "zz", 2, 100), ESP_FAIL);
+
+    CHECK_OK(mem_backend_mount("/mem", VFS_BACKEND_FLAG_NO_CACHE));
+    CHECK_OK(vfs_writeback_append("/mem/u", "zz", 2, 100));
+    CHECK_OK(vfs_writeback_stop());
+    CHECK_EQ(vfs_writeback_stop(), ESP_ERR_INVALID_STATE);
+    CHECK(file_len("/mem/u") >= 2);
+
+    CHECK_OK(vfs_writeback_start(NULL));
+    CHECK_OK(vfs_writeback_stop());
+}
+
+int main(void) {
+    CHECK_OK(mem_backend_mount("/mem", VFS_BACKEND_FLAG_NO_CACHE));
+    test_basics();
+    test_latency();
+    test_failures();
+    test_unplug();
+    CHECK_OK(mem_backend_unmount());
+    return host_test_finish("test_vfs_writeback");
+}
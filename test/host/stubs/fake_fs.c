@@ -0,0 +1,308 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Partição LittleFS e cartão SD (FAT) como diretórios do host, e as chamadas
+// POSIX redirecionadas por host_fs_redirect.h.
+
+#include <stdarg.h>
+#include <stdlib.h>
+#include <string.h>
+#include <errno.h>
+#include <ftw.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/stat.h>
+#include "esp_littlefs.h"
+#include "esp_vfs_fat.h"
+#include "fake_fs.h"
+
+#define FAKE_FS_PATH_MAX    512
+
+static char root[FAKE_FS_PATH_MAX];
+
+/* ==== Caminhos ==== */
+
+void fake_fs_set_root(const char *dir) {
+    snprintf(root, sizeof(root), "%s", dir ? dir : "");
+    if (root[0]) {
+        mkdir(root, 0755);
+    }
+}
+
+bool fake_fs_host_path(const char *path, char *out, size_t size) {
+    int n = (root[0] && path[0] == '/') ? snprintf(out, size, "%s%s", root, path)
+                                        : snprintf(out, size, "%s", path);
+    return n >= 0 && (size_t)n < size;
+}
+
+// Mapeia `path` para `out` ou retorna `fail` com ENAMETOOLONG
+#define MAP(path, out, fail) \
+    char out[FAKE_FS_PATH_MAX]; \
+    if (!fake_fs_host_path(path, out, sizeof(out))) { \
+        errno = ENAMETOOLONG; \
+        return fail; \
+    }
+
+static void make_dirs(const char *path) {
+    char dir[FAKE_FS_PATH_MAX];
+    if (!fake_fs_host_path(path, dir, sizeof(dir))) return;
+    for (char *p = dir + 1; *p; p++) {
+        if (*p == '/') {
+            *p = '\0';
+            mkdir(dir, 0755);
+            *p = '/';
+        }
+    }
+    mkdir(dir, 0755);
+}
+
+/* ==== Chamadas redirecionadas ==== */
+
+int host_fs_open(const char *path, int flags, ...) {
+    int mode = 0;
+    if (flags & O_CREAT) {
+        va_list ap;
+        va_start(ap, flags);
+        mode = va_arg(ap, int);
+        va_end(ap);
+    }
+    MAP(path, p, -1);
+    return open(p, flags, mode);
+}
+
+FILE *host_fs_fopen(const char *path, const char *mode) {
+    MAP(path, p, NULL);
+    return fopen(p, mode);
+}
+
+int host_fs_stat(const char *path, struct stat *st) {
+    MAP(path, p, -1);
+    return stat(p, st);
+}
+
+int host_fs_rename(const char *old_path, const char *new_path) {
+    MAP(old_path, a, -1);
+    MAP(new_path, b, -1);
+    return rename(a, b);
+}
+
+int host_fs_unlink(const char *path) {
+    MAP(path, p, -1);
+    return unlink(p);
+}
+
+int host_fs_remove(const char *path) {
+    MAP(path, p, -1);
+    return remove(p);
+}
+
+int host_fs_truncate(const char *path, off_t length) {
+    MAP(path, p, -1);
+    return truncate(p, length);
+}
+
+int host_fs_mkdir(const char *path, mode_t mode) {
+    MAP(path, p, -1);
+    return mkdir(p, mode);
+}
+
+int host_fs_rmdir(const char *path) {
+    MAP(path, p, -1);
+    return rmdir(p);
+}
+
+DIR *host_fs_opendir(const char *path) {
+    MAP(path, p, NULL);
+    return opendir(p);
+}
+
+struct dirent *host_fs_readdir(DIR *dir) {
+    struct dirent *ent;
+    while ((ent = readdir(dir)) != NULL &&
+           (strcmp(ent->d_name, ".") == 0 || strcmp(ent->d_name, "..") == 0)) {
+    }
+    return ent;
+}
+
+/* ==== Ocupação ==== */
+
+static uint64_t walk_unit;
+static uint64_t walk_used;
+
+static int walk_entry(const char *path, const struct stat *st, int type, struct FTW *ftw) {
+    (void)path;
+    (void)ftw;
+    if (type == FTW_F) {
+        walk_used += (st->st_size + walk_unit - 1) / walk_unit * walk_unit;
+    }
+    return 0;
+}
+
+// Bytes ocupados pelos arquivos de `mount`, arredondados para `unit`
+static uint64_t used_bytes(const char *mount, uint64_t unit) {
+    char p[FAKE_FS_PATH_MAX];
+    walk_unit = unit;
+    walk_used = 0;
+    if (fake_fs_host_path(mount, p, sizeof(p))) {
+        nftw(p, walk_entry, 16, FTW_PHYS);
+    }
+    return walk_used;
+}
+
+static int remove_entry(const char *path, const struct stat *st, int type, struct FTW *ftw) {
+    (void)st;
+    (void)type;
+    return ftw->level > 0 ? remove(path) : 0;
+}
+
+/* ==== LittleFS ==== */
+
+static struct {
+    bool mounted;
+    char label[32];
+    char base[64];
+} lfs;
+
+esp_err_t esp_vfs_littlefs_register(const esp_vfs_littlefs_conf_t *conf) {
+    if (!conf || !conf->base_path || !conf->partition_label) return ESP_ERR_INVALID_ARG;
+    if (lfs.mounted) return ESP_ERR_INVALID_STATE;
+    snprintf(lfs.label, sizeof(lfs.label), "%s", conf->partition_label);
+    snprintf(lfs.base, sizeof(lfs.base), "%s", conf->base_path);
+    make_dirs(lfs.base);
+    lfs.mounted = true;
+    return ESP_OK;
+}
+
+esp_err_t esp_vfs_littlefs_unregister(const char *partition_label) {
+    if (!lfs.mounted || strcmp(partition_label, lfs.label) != 0) return ESP_ERR_INVALID_STATE;
+    lfs.mounted = false;
+    return ESP_OK;
+}
+
+esp_err_t esp_littlefs_info(const char *partition_label, size_t *total_bytes, size_t *used_bytes_out) {
+    if (!lfs.mounted || strcmp(partition_label, lfs.label) != 0) return ESP_ERR_INVALID_STATE;
+    uint64_t used = used_bytes(lfs.base, FAKE_FS_LITTLEFS_BLOCK) + 2 * FAKE_FS_LITTLEFS_BLOCK;
+    if (total_bytes) *total_bytes = FAKE_FS_LITTLEFS_BYTES;
+    if (used_bytes_out) *used_bytes_out = used < FAKE_FS_LITTLEFS_BYTES ? used : FAKE_FS_LITTLEFS_BYTES;
+    return ESP_OK;
+}
+
+esp_err_t esp_littlefs_format(const char *partition_label) {
+    if (strcmp(partition_label, lfs.label) != 0 && lfs.label[0]) return ESP_ERR_NOT_FOUND;
+    char p[FAKE_FS_PATH_MAX];
+    if (lfs.base[0] && fake_fs_host_path(lfs.base, p, sizeof(p))) {
+        nftw(p, remove_entry, 16, FTW_DEPTH | FTW_PHYS);
+    }
+    return ESP_OK;
+}
+
+bool esp_littlefs_mounted(const char *partition_label) {
+    return lfs.mounted && strcmp(partition_label, lfs.label) == 0;
+}
+
+/* ==== Cartão SD ==== */
+
+static struct {
+    bool absent;
+    bool mounted;
+    char base[64];
+    int commands;
+    sdmmc_card_t card;
+    FATFS fs;
+} sd;
+
+void fake_fs_set_card_present(bool present) {
+    sd.absent = !present;
+}
+
+int fake_fs_card_commands(void) {
+    return sd.commands;
+}
+
+esp_err_t sdspi_host_do_transaction(int slot, sdmmc_command_t *cmd) {
+    (void)slot;
+    if (sd.absent) return ESP_ERR_TIMEOUT;
+    sd.commands++;
+    memset(cmd->response, 0, sizeof(cmd->response));
+    cmd->error = ESP_OK;
+    return ESP_OK;
+}
+
+static esp_err_t card_command(const sdmmc_host_t *host, uint32_t opcode) {
+    sdmmc_command_t cmd = { .opcode = opcode, .timeout_ms = 1000 };
+    return host->do_transaction(host->slot, &cmd);
+}
+
+esp_err_t esp_vfs_fat_sdspi_mount(const char *base_path, const sdmmc_host_t *host_config,
+                                  const sdspi_device_config_t *slot_config,
+                                  const esp_vfs_fat_mount_config_t *mount_config,
+                                  sdmmc_card_t **out_card) {
+    (void)slot_config;
+    (void)mount_config;
+    if (!base_path || !host_config || !out_card) return ESP_ERR_INVALID_ARG;
+    if (sd.mounted) return ESP_ERR_INVALID_STATE;
+
+    // Reset do cartão pelo do_transaction do host (o gancho do chamador)
+    esp_err_t ret = card_command(host_config, MMC_GO_IDLE_STATE);
+    if (ret != ESP_OK) return ret;
+
+    memset(&sd.card, 0, sizeof(sd.card));
+    sd.card.host = *host_config;
+    sd.card.ocr = SD_OCR_SDHC_CAP | SD_OCR_VOL_MASK;
+    snprintf(sd.card.cid.name, sizeof(sd.card.cid.name), "%s", FAKE_FS_CARD_NAME);
+    sd.card.csd.capacity = FAKE_FS_CARD_SECTORS;
+    sd.card.csd.sector_size = 512;
+    sd.card.max_freq_khz = host_config->max_freq_khz;
+    sd.card.real_freq_khz = FAKE_FS_CARD_FREQ_KHZ;
+
+    snprintf(sd.base, sizeof(sd.base), "%s", base_path);
+    make_dirs(sd.base);
+    sd.mounted = true;
+    *out_card = &sd.card;
+    return ESP_OK;
+}
+
+esp_err_t esp_vfs_fat_sdcard_unmount(const char *base_path, sdmmc_card_t *card) {
+    if (!sd.mounted || card != &sd.card || strcmp(base_path, sd.base) != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    sd.mounted = false;
+    return ESP_OK;
+}
+
+esp_err_t sdmmc_get_status(sdmmc_card_t *card) {
+    return card_command(&card->host, MMC_SEND_STATUS);
+}
+
+void sdmmc_card_print_info(FILE *stream, const sdmmc_card_t *card) {
+    fprintf(stream, "Name: %s\nSize: %lluMB\n", card->cid.name,
+            (unsigned long long)card->csd.capacity * card->csd.sector_size / (1024 * 1024));
+}
+
+FRESULT f_getfree(const TCHAR *path, DWORD *nclst, FATFS **fatfs) {
+    (void)path;
+    if (!sd.mounted) return FR_NOT_ENABLED;
+    uint64_t cluster = (uint64_t)FAKE_FS_CARD_CLUSTER * 512;
+    DWORD clusters = FAKE_FS_CARD_SECTORS / FAKE_FS_CARD_CLUSTER;
+    DWORD used = used_bytes(sd.base, cluster) / cluster;
+
+    sd.fs.csize = FAKE_FS_CARD_CLUSTER;
+    sd.fs.ssize = 512;
+    sd.fs.n_fatent = clusters + 2;
+    *nclst = used < clusters ? clusters - used : 0;
+    *fatfs = &sd.fs;
+    return FR_OK;
+}
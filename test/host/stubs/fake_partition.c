@@ -0,0 +1,158 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Partições de dados do esp_partition sobre arquivos comuns do host.
+
+#include <stdio.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "esp_partition.h"
+#include "fake_partition.h"
+
+#define FAKE_PARTITION_PATH_MAX     512
+#define FAKE_PARTITION_MAPS         8
+
+static struct {
+    bool used;
+    esp_partition_t part;
+    char path[FAKE_PARTITION_PATH_MAX];
+} parts[FAKE_PARTITION_MAX];
+
+static struct {
+    void *addr;                 // Início alinhado em página (munmap)
+    size_t len;
+} maps[FAKE_PARTITION_MAPS];
+
+static size_t last_map_size;
+
+/* ==== Tabela de partições ==== */
+
+bool fake_partition_add(const char *label, const char *path) {
+    struct stat st;
+    if (stat(path, &st) != 0 || !S_ISREG(st.st_mode)) return false;
+
+    int slot = -1;
+    for (int i = 0; i < FAKE_PARTITION_MAX; i++) {
+        if (parts[i].used && strcmp(parts[i].part.label, label) == 0) {
+            slot = i;
+            break;
+        }
+        if (!parts[i].used && slot < 0) slot = i;
+    }
+    if (slot < 0) return false;
+
+    memset(&parts[slot], 0, sizeof(parts[slot]));
+    parts[slot].used = true;
+    parts[slot].part.type = ESP_PARTITION_TYPE_DATA;
+    parts[slot].part.subtype = 0x40;
+    parts[slot].part.address = 0x110000 + slot * 0x100000;
+    parts[slot].part.size = (uint32_t)st.st_size;
+    parts[slot].part.erase_size = 4096;
+    parts[slot].part.readonly = true;
+    snprintf(parts[slot].part.label, sizeof(parts[slot].part.label), "%s", label);
+    snprintf(parts[slot].path, sizeof(parts[slot].path), "%s", path);
+    return true;
+}
+
+void fake_partition_clear(void) {
+    memset(parts, 0, sizeof(parts));
+}
+
+int fake_partition_mappings(void) {
+    int n = 0;
+    for (int i = 0; i < FAKE_PARTITION_MAPS; i++) {
+        n += maps[i].addr != NULL;
+    }
+    return n;
+}
+
+size_t fake_partition_last_map_size(void) {
+    return last_map_size;
+}
+
+static const char *part_path(const esp_partition_t *partition) {
+    for (int i = 0; i < FAKE_PARTITION_MAX; i++) {
+        if (parts[i].used && &parts[i].part == partition) return parts[i].path;
+    }
+    return NULL;
+}
+
+/* ==== esp_partition ==== */
+
+const esp_partition_t *esp_partition_find_first(esp_partition_type_t type, esp_partition_subtype_t subtype,
+                                                const char *label) {
+    for (int i = 0; i < FAKE_PARTITION_MAX; i++) {
+        const esp_partition_t *p = &parts[i].part;
+        if (!parts[i].used || p->type != type) continue;
+        if (subtype != ESP_PARTITION_SUBTYPE_ANY && p->subtype != subtype) continue;
+        if (label && strcmp(p->label, label) != 0) continue;
+        return p;
+    }
+    return NULL;
+}
+
+esp_err_t esp_partition_read(const esp_partition_t *partition, size_t src_offset, void *dst, size_t size) {
+    const char *path = partition ? part_path(partition) : NULL;
+    if (!path || !dst) return ESP_ERR_INVALID_ARG;
+    if (src_offset > partition->size || size > partition->size - src_offset) return ESP_ERR_INVALID_SIZE;
+
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return ESP_FAIL;
+    ssize_t n = pread(fd, dst, size, (off_t)src_offset);
+    close(fd);
+    return (n == (ssize_t)size) ? ESP_OK : ESP_FAIL;
+}
+
+esp_err_t esp_partition_mmap(const esp_partition_t *partition, size_t offset, size_t size,
+                             esp_partition_mmap_memory_t memory, const void **out_ptr,
+                             esp_partition_mmap_handle_t *out_handle) {
+    const char *path = partition ? part_path(partition) : NULL;
+    if (!path || !out_ptr || !out_handle || size == 0) return ESP_ERR_INVALID_ARG;
+    if (offset > partition->size || size > partition->size - offset) return ESP_ERR_INVALID_ARG;
+    (void)memory;
+
+    int slot = -1;
+    for (int i = 0; i < FAKE_PARTITION_MAPS && slot < 0; i++) {
+        if (!maps[i].addr) slot = i;
+    }
+    if (slot < 0) return ESP_ERR_NO_MEM;
+
+    // mmap() exige offset alinhado em página: mapeia desde a página e ajusta
+    size_t page = (size_t)sysconf(_SC_PAGESIZE);
+    size_t skew = offset % page;
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return ESP_FAIL;
+    void *addr = mmap(NULL, size + skew, PROT_READ, MAP_PRIVATE, fd, (off_t)(offset - skew));
+    close(fd);
+    if (addr == MAP_FAILED) return ESP_FAIL;
+
+    maps[slot].addr = addr;
+    maps[slot].len = size + skew;
+    last_map_size = size;
+    *out_ptr = (const uint8_t *)addr + skew;
+    *out_handle = (esp_partition_mmap_handle_t)slot + 1;
+    return ESP_OK;
+}
+
+void esp_partition_munmap(esp_partition_mmap_handle_t handle) {
+    if (handle == 0 || handle > FAKE_PARTITION_MAPS || !maps[handle - 1].addr) return;
+    munmap(maps[handle - 1].addr, maps[handle - 1].len);
+    maps[handle - 1].addr = NULL;
+    maps[handle - 1].len = 0;
+}
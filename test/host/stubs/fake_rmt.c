@@ -0,0 +1,742 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "fake_rmt.h"
+
+#define FAKE_RMT_MAX_QUEUE      16
+#define FAKE_RMT_MAX_CHANNELS   8
+#define RMT_MAX_TICKS           32767   // 15 bits por meio símbolo
+
+typedef struct {
+    rmt_encoder_handle_t encoder;
+    const void *payload;
+    size_t size;
+    uint32_t carrier_hz;
+    float duty_cycle;
+} pending_t;
+
+struct rmt_channel_t {
+    int index;
+    rmt_tx_channel_config_t cfg;
+    rmt_tx_done_callback_t on_done;
+    void *user_ctx;
+    bool enabled;
+    bool deleted;
+    uint32_t carrier_hz;
+    float duty_cycle;
+    size_t mem_free;            // Símbolos livres no bloco sendo preenchido
+    pending_t queue[FAKE_RMT_MAX_QUEUE];
+    size_t head, count;
+    bool busy;                  // A thread está tocando queue[head] (TX) ou
+                                // o callback está rodando (RX)
+    bool idle;                  // Linha parada desde a última transação
+    pthread_t thread;
+
+    // RX: sem thread, quem move a linha é fake_rmt_rx_play()
+    bool rx;
+    rmt_rx_channel_config_t rx_cfg;
+    rmt_rx_done_callback_t on_recv;
+    rmt_receive_config_t receive;
+    bool armed;                 // rmt_receive() pendente
+    bool receiving;             // Entre a primeira borda e o silêncio final
+    rmt_symbol_word_t *buf;     // Buffer do rmt_receive()
+    size_t buf_size, buf_len;
+    rmt_symbol_word_t *mem;     // Memória do canal (cópia em meios blocos)
+    size_t mem_len;
+    bool half_pending;          // Meio símbolo esperando o par
+    rmt_symbol_word_t half;
+};
+
+// Um lock para tudo: canais, registro e contadores. A thread de um canal o
+// solta enquanto dorme o tempo no ar e enquanto chama on_trans_done.
+static pthread_mutex_t lock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t changed = PTHREAD_COND_INITIALIZER;
+
+static struct rmt_channel_t *channels[FAKE_RMT_MAX_CHANNELS];
+static double realtime = 0;
+static bool drop_done = false;
+static int64_t clock_us = 0;
+static fake_rmt_counters_t counters;
+
+static fake_rmt_trans_t *log_trans = NULL;
+static size_t trans_count = 0, trans_cap = 0;
+static rmt_symbol_word_t *log_symbols = NULL;
+static size_t symbol_count = 0, symbol_cap = 0;
+
+// Entrada dos canais RX: nível atual e tempo desde a última borda
+static unsigned rx_line = 1;
+static uint64_t rx_held_us = 0;
+
+// Canal cujo encoder está rodando (só a thread dele chama encoders)
+static __thread struct rmt_channel_t *encoding = NULL;
+
+static void sleep_us(int64_t us) {
+    struct timespec ts = { .tv_sec = us / 1000000, .tv_nsec = (us % 1000000) * 1000 };
+    nanosleep(&ts, NULL);
+}
+
+// Dorme até t0 + us: atrasos de um trecho não se acumulam nos seguintes
+static void sleep_until(const struct timespec *t0, int64_t us) {
+    struct timespec at = *t0;
+    at.tv_sec += us / 1000000;
+    at.tv_nsec += (us % 1000000) * 1000;
+    if (at.tv_nsec >= 1000000000L) {
+        at.tv_sec++;
+        at.tv_nsec -= 1000000000L;
+    }
+    while (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &at, NULL) != 0) {
+    }
+}
+
+// ========== ENCODERS ==========
+
+typedef struct {
+    rmt_encoder_t base;
+    size_t next;                // Próximo símbolo do payload
+} copy_encoder_t;
+
+typedef struct {
+    rmt_encoder_t base;
+    rmt_bytes_encoder_config_t cfg;
+    size_t next;                // Próximo bit do payload
+} bytes_encoder_t;
+
+// Um símbolo no bloco do canal; false com o bloco cheio
+static bool emit(rmt_symbol_word_t symbol) {
+    if (!encoding || encoding->mem_free == 0) return false;
+    if (symbol_count == symbol_cap) {
+        symbol_cap = symbol_cap ? symbol_cap * 2 : 1024;
+        log_symbols = realloc(log_symbols, symbol_cap * sizeof(rmt_symbol_word_t));
+    }
+    log_symbols[symbol_count++] = symbol;
+    encoding->mem_free--;
+    return true;
+}
+
+static rmt_encode_state_t finish(bool complete) {
+    rmt_encode_state_t state = complete ? RMT_ENCODING_COMPLETE : RMT_ENCODING_RESET;
+    if (!encoding || encoding->mem_free == 0) state |= RMT_ENCODING_MEM_FULL;
+    return state;
+}
+
+static size_t copy_encode(rmt_encoder_t *encoder, rmt_channel_handle_t channel,
+                          const void *data, size_t size, rmt_encode_state_t *state) {
+    copy_encoder_t *copy = __containerof(encoder, copy_encoder_t, base);
+    const rmt_symbol_word_t *symbols = data;
+    size_t total = size / sizeof(rmt_symbol_word_t), done = 0;
+    while (copy->next < total && emit(symbols[copy->next])) {
+        copy->next++;
+        done++;
+    }
+    bool complete = copy->next == total;
+    if (complete) copy->next = 0;
+    *state = finish(complete);
+    return done;
+}
+
+static size_t bytes_encode(rmt_encoder_t *encoder, rmt_channel_handle_t channel,
+                           const void *data, size_t size, rmt_encode_state_t *state) {
+    bytes_encoder_t *bytes = __containerof(encoder, bytes_encoder_t, base);
+    const uint8_t *buf = data;
+    size_t done = 0;
+    while (bytes->next < size * 8) {
+        size_t byte = bytes->next / 8, bit = bytes->next % 8;
+        bool one = (buf[byte] >> (bytes->cfg.flags.msb_first ? 7 - bit : bit)) & 1;
+        if (!emit(one ? bytes->cfg.bit1 : bytes->cfg.bit0)) break;
+        bytes->next++;
+        done++;
+    }
+    bool complete = bytes->next == size * 8;
+    if (complete) bytes->next = 0;
+    *state = finish(complete);
+    return done;
+}
+
+static esp_err_t copy_reset(rmt_encoder_t *encoder) {
+    __containerof(encoder, copy_encoder_t, base)->next = 0;
+    return ESP_OK;
+}
+
+static esp_err_t bytes_reset(rmt_encoder_t *encoder) {
+    __containerof(encoder, bytes_encoder_t, base)->next = 0;
+    return ESP_OK;
+}
+
+static esp_err_t free_encoder(rmt_encoder_t *encoder) {
+    free(encoder);
+    return ESP_OK;
+}
+
+static void count_encoder(void) {
+    pthread_mutex_lock(&lock);
+    counters.encoders++;
+    counters.encoders_created++;
+    pthread_mutex_unlock(&lock);
+}
+
+void *rmt_alloc_encoder_mem(size_t size) {
+    void *mem = calloc(1, size);
+    if (mem) count_encoder();
+    return mem;
+}
+
+esp_err_t rmt_new_copy_encoder(const rmt_copy_encoder_config_t *config, rmt_encoder_handle_t *ret_encoder) {
+    if (!config || !ret_encoder) return ESP_ERR_INVALID_ARG;
+    copy_encoder_t *copy = rmt_alloc_encoder_mem(sizeof(copy_encoder_t));
+    if (!copy) return ESP_ERR_NO_MEM;
+    copy->base.encode = copy_encode;
+    copy->base.reset = copy_reset;
+    copy->base.del = free_encoder;
+    *ret_encoder = &copy->base;
+    return ESP_OK;
+}
+
+esp_err_t rmt_new_bytes_encoder(const rmt_bytes_encoder_config_t *config, rmt_encoder_handle_t *ret_encoder) {
+    if (!config || !ret_encoder) return ESP_ERR_INVALID_ARG;
+    bytes_encoder_t *bytes = rmt_alloc_encoder_mem(sizeof(bytes_encoder_t));
+    if (!bytes) return ESP_ERR_NO_MEM;
+    bytes->cfg = *config;
+    bytes->base.encode = bytes_encode;
+    bytes->base.reset = bytes_reset;
+    bytes->base.del = free_encoder;
+    *ret_encoder = &bytes->base;
+    return ESP_OK;
+}
+
+esp_err_t rmt_del_encoder(rmt_encoder_handle_t encoder) {
+    if (!encoder) return ESP_ERR_INVALID_ARG;
+    pthread_mutex_lock(&lock);
+    counters.encoders--;
+    pthread_mutex_unlock(&lock);
+    return encoder->del(encoder);
+}
+
+esp_err_t rmt_encoder_reset(rmt_encoder_handle_t encoder) {
+    if (!encoder) return ESP_ERR_INVALID_ARG;
+    return encoder->reset(encoder);
+}
+
+// ========== CANAL ==========
+
+// Passa a transação pelo encoder, um bloco de memória por vez. Com o lock.
+static bool encode(struct rmt_channel_t *ch, const pending_t *p) {
+    size_t mem = ch->cfg.mem_block_symbols ? ch->cfg.mem_block_symbols : 48;
+    encoding = ch;
+    ch->mem_free = mem;
+    rmt_encode_state_t state = RMT_ENCODING_RESET;
+    bool ok = true;
+    while (ok && !(state & RMT_ENCODING_COMPLETE)) {
+        size_t before = symbol_count;
+        p->encoder->encode(p->encoder, ch, p->payload, p->size, &state);
+        if (state & RMT_ENCODING_MEM_FULL) {
+            ch->mem_free = mem;             // Bloco enviado, o encoder continua
+        } else if (!(state & RMT_ENCODING_COMPLETE) || symbol_count == before) {
+            ok = (state & RMT_ENCODING_COMPLETE) != 0;   // Encoder parado sem avançar
+        }
+    }
+    encoding = NULL;
+    return ok;
+}
+
+static void *player(void *arg) {
+    struct rmt_channel_t *ch = arg;
+    pthread_mutex_lock(&lock);
+    for (;;) {
+        while (ch->count == 0 && !ch->deleted) pthread_cond_wait(&changed, &lock);
+        if (ch->deleted) break;
+
+        pending_t p = ch->queue[ch->head];
+        ch->busy = true;
+        fake_rmt_trans_t t = {
+            .channel = ch->index,
+            .first = symbol_count,
+            .carrier_hz = p.carrier_hz,
+            .duty_cycle = p.duty_cycle,
+            .start_us = clock_us,
+            .underrun = ch->idle,
+        };
+        if (!encode(ch, &p)) counters.misuse++;
+        t.count = symbol_count - t.first;
+
+        uint64_t ticks = 0;
+        for (size_t i = t.first; i < symbol_count; i++) {
+            ticks += log_symbols[i].duration0 + log_symbols[i].duration1;
+        }
+        uint32_t hz = ch->cfg.resolution_hz ? ch->cfg.resolution_hz : 1000000;
+        clock_us += (int64_t)(ticks * 1000000 / hz);
+        t.end_us = clock_us;
+
+        if (trans_count == trans_cap) {
+            trans_cap = trans_cap ? trans_cap * 2 : 256;
+            log_trans = realloc(log_trans, trans_cap * sizeof(fake_rmt_trans_t));
+        }
+        log_trans[trans_count++] = t;
+
+        int64_t air_us = (int64_t)((t.end_us - t.start_us) * realtime);
+        rmt_tx_done_callback_t on_done = drop_done ? NULL : ch->on_done;
+        void *ctx = ch->user_ctx;
+        pthread_mutex_unlock(&lock);
+        if (air_us > 0) sleep_us(air_us);
+
+        // Como no driver, a transação já saiu da fila quando o TX done chega
+        pthread_mutex_lock(&lock);
+        ch->head = (ch->head + 1) % FAKE_RMT_MAX_QUEUE;
+        ch->count--;
+        ch->idle = ch->count == 0;
+        pthread_cond_broadcast(&changed);
+        pthread_mutex_unlock(&lock);
+
+        if (on_done) {
+            rmt_tx_done_event_data_t edata = { .num_symbols = t.count };
+            on_done(ch, &edata, ctx);
+        }
+
+        pthread_mutex_lock(&lock);
+        ch->busy = false;
+        pthread_cond_broadcast(&changed);
+    }
+    pthread_mutex_unlock(&lock);
+    return NULL;
+}
+
+static bool add_channel(struct rmt_channel_t *ch) {
+    pthread_mutex_lock(&lock);
+    int slot = 0;
+    while (slot < FAKE_RMT_MAX_CHANNELS && channels[slot]) slot++;
+    if (slot < FAKE_RMT_MAX_CHANNELS) {
+        channels[slot] = ch;
+        ch->index = counters.channels_created++;
+        counters.channels++;
+    }
+    pthread_mutex_unlock(&lock);
+    return slot < FAKE_RMT_MAX_CHANNELS;
+}
+
+esp_err_t rmt_new_tx_channel(const rmt_tx_channel_config_t *config, rmt_channel_handle_t *ret_chan) {
+    if (!config || !ret_chan || config->trans_queue_depth == 0 ||
+        config->trans_queue_depth > FAKE_RMT_MAX_QUEUE) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct rmt_channel_t *ch = calloc(1, sizeof(struct rmt_channel_t));
+    if (!ch) return ESP_ERR_NO_MEM;
+    ch->cfg = *config;
+    ch->idle = true;
+    if (!add_channel(ch)) {
+        free(ch);
+        return ESP_ERR_NOT_FOUND;           // Sem canal livre, como no driver
+    }
+
+    pthread_create(&ch->thread, NULL, player, ch);
+    *ret_chan = ch;
+    return ESP_OK;
+}
+
+esp_err_t rmt_tx_register_event_callbacks(rmt_channel_handle_t tx_channel,
+                                          const rmt_tx_event_callbacks_t *cbs, void *user_data) {
+    if (!tx_channel || !cbs) return ESP_ERR_INVALID_ARG;
+    pthread_mutex_lock(&lock);
+    esp_err_t ret = tx_channel->enabled ? ESP_ERR_INVALID_STATE : ESP_OK;
+    if (ret == ESP_OK) {
+        tx_channel->on_done = cbs->on_trans_done;
+        tx_channel->user_ctx = user_data;
+    }
+    pthread_mutex_unlock(&lock);
+    return ret;
+}
+
+esp_err_t rmt_transmit(rmt_channel_handle_t tx_channel, rmt_encoder_handle_t encoder,
+                       const void *payload, size_t payload_bytes, const rmt_transmit_config_t *config) {
+    if (!tx_channel || !encoder || !payload || !payload_bytes || !config) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    pthread_mutex_lock(&lock);
+    if (!tx_channel->enabled) {
+        counters.misuse++;
+        pthread_mutex_unlock(&lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    while (tx_channel->count >= tx_channel->cfg.trans_queue_depth) {
+        if (config->flags.queue_nonblocking) {
+            pthread_mutex_unlock(&lock);
+            return ESP_ERR_INVALID_STATE;
+        }
+        pthread_cond_wait(&changed, &lock);
+    }
+    size_t at = (tx_channel->head + tx_channel->count) % FAKE_RMT_MAX_QUEUE;
+    tx_channel->queue[at] = (pending_t) {
+        .encoder = encoder,
+        .payload = payload,
+        .size = payload_bytes,
+        .carrier_hz = tx_channel->carrier_hz,
+        .duty_cycle = tx_channel->duty_cycle,
+    };
+    tx_channel->count++;
+    pthread_cond_broadcast(&changed);
+    pthread_mutex_unlock(&lock);
+    return ESP_OK;
+}
+
+esp_err_t rmt_tx_wait_all_done(rmt_channel_handle_t tx_channel, int timeout_ms) {
+    if (!tx_channel) return ESP_ERR_INVALID_ARG;
+    struct timespec limit;
+    clock_gettime(CLOCK_REALTIME, &limit);
+    if (timeout_ms >= 0) {
+        limit.tv_sec += timeout_ms / 1000;
+        limit.tv_nsec += (timeout_ms % 1000) * 1000000L;
+        if (limit.tv_nsec >= 1000000000L) {
+            limit.tv_sec++;
+            limit.tv_nsec -= 1000000000L;
+        }
+    }
+    esp_err_t ret = ESP_OK;
+    pthread_mutex_lock(&lock);
+    while (tx_channel->count > 0 && ret == ESP_OK) {
+        if (timeout_ms < 0) {
+            pthread_cond_wait(&changed, &lock);
+        } else if (pthread_cond_timedwait(&changed, &lock, &limit) != 0) {
+            ret = ESP_ERR_TIMEOUT;
+        }
+    }
+    pthread_mutex_unlock(&lock);
+    return ret;
+}
+
+esp_err_t rmt_apply_carrier(rmt_channel_handle_t channel, const rmt_carrier_config_t *config) {
+    if (!channel) return ESP_ERR_INVALID_ARG;
+    uint32_t hz = config ? config->frequency_hz : 0;
+    float duty = config ? config->duty_cycle : 0;
+    pthread_mutex_lock(&lock);
+    // No hardware a portadora muda na hora, também no que já está na linha
+    if (channel->count > 0 && (hz != channel->carrier_hz || duty != channel->duty_cycle)) {
+        counters.misuse++;
+    }
+    channel->carrier_hz = hz;
+    channel->duty_cycle = duty;
+    counters.carrier_changes++;
+    pthread_mutex_unlock(&lock);
+    return ESP_OK;
+}
+
+esp_err_t rmt_enable(rmt_channel_handle_t channel) {
+    if (!channel) return ESP_ERR_INVALID_ARG;
+    pthread_mutex_lock(&lock);
+    esp_err_t ret = channel->enabled ? ESP_ERR_INVALID_STATE : ESP_OK;
+    channel->enabled = true;
+    pthread_mutex_unlock(&lock);
+    return ret;
+}
+
+esp_err_t rmt_disable(rmt_channel_handle_t channel) {
+    if (!channel) return ESP_ERR_INVALID_ARG;
+    pthread_mutex_lock(&lock);
+    esp_err_t ret = channel->enabled ? ESP_OK : ESP_ERR_INVALID_STATE;
+    channel->enabled = false;
+    channel->armed = false;                 // Recepção em andamento é abortada
+    channel->receiving = false;
+    pthread_mutex_unlock(&lock);
+    return ret;
+}
+
+// O que ainda está na fila é descartado, como no driver
+esp_err_t rmt_del_channel(rmt_channel_handle_t channel) {
+    if (!channel) return ESP_ERR_INVALID_ARG;
+    pthread_mutex_lock(&lock);
+    if (channel->enabled) {
+        counters.misuse++;
+        pthread_mutex_unlock(&lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+    while (channel->busy) pthread_cond_wait(&changed, &lock);
+    channel->deleted = true;
+    channel->count = 0;
+    counters.channels--;
+    for (int i = 0; i < FAKE_RMT_MAX_CHANNELS; i++) {
+        if (channels[i] == channel) channels[i] = NULL;
+    }
+    pthread_cond_broadcast(&changed);
+    pthread_mutex_unlock(&lock);
+
+    if (!channel->rx) pthread_join(channel->thread, NULL);
+    free(channel->mem);
+    free(channel);
+    return ESP_OK;
+}
+
+// ========== RX ==========
+
+esp_err_t rmt_new_rx_channel(const rmt_rx_channel_config_t *config, rmt_channel_handle_t *ret_chan) {
+    if (!config || !ret_chan || config->resolution_hz == 0 || config->mem_block_symbols < 2) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    struct rmt_channel_t *ch = calloc(1, sizeof(struct rmt_channel_t));
+    if (!ch) return ESP_ERR_NO_MEM;
+    ch->rx = true;
+    ch->rx_cfg = *config;
+    ch->idle = true;
+    ch->mem = calloc(config->mem_block_symbols, sizeof(rmt_symbol_word_t));
+    esp_err_t ret = !ch->mem ? ESP_ERR_NO_MEM : !add_channel(ch) ? ESP_ERR_NOT_FOUND : ESP_OK;
+    if (ret != ESP_OK) {
+        free(ch->mem);
+        free(ch);
+        return ret;
+    }
+    *ret_chan = ch;
+    return ESP_OK;
+}
+
+esp_err_t rmt_rx_register_event_callbacks(rmt_channel_handle_t rx_channel,
+                                          const rmt_rx_event_callbacks_t *cbs, void *user_data) {
+    if (!rx_channel || !rx_channel->rx || !cbs) return ESP_ERR_INVALID_ARG;
+    pthread_mutex_lock(&lock);
+    esp_err_t ret = rx_channel->enabled ? ESP_ERR_INVALID_STATE : ESP_OK;
+    if (ret == ESP_OK) {
+        rx_channel->on_recv = cbs->on_recv_done;
+        rx_channel->user_ctx = user_data;
+    }
+    pthread_mutex_unlock(&lock);
+    return ret;
+}
+
+// Pode ser chamado do on_recv_done (o driver já voltou ao estado habilitado)
+esp_err_t rmt_receive(rmt_channel_handle_t rx_channel, void *buffer, size_t buffer_size,
+                      const rmt_receive_config_t *config) {
+    if (!rx_channel || !rx_channel->rx || !buffer || !config ||
+        buffer_size < sizeof(rmt_symbol_word_t)) {
+        return ESP_ERR_INVALID_ARG;
+    }
+    // O limiar de silêncio é um registrador de 15 bits em ticks
+    uint64_t idle_ticks = (uint64_t)config->signal_range_max_ns * rx_channel->rx_cfg.resolution_hz / 1000000000u;
+    if (idle_ticks > RMT_MAX_TICKS) return ESP_ERR_INVALID_ARG;
+
+    pthread_mutex_lock(&lock);
+    esp_err_t ret = ESP_OK;
+    if (!rx_channel->enabled || rx_channel->armed) {
+        counters.misuse++;
+        ret = ESP_ERR_INVALID_STATE;
+    } else {
+        rx_channel->armed = true;
+        rx_channel->receiving = false;
+        rx_channel->receive = *config;
+        rx_channel->buf = buffer;
+        rx_channel->buf_size = buffer_size / sizeof(rmt_symbol_word_t);
+        rx_channel->buf_len = 0;
+        rx_channel->mem_len = 0;
+        rx_channel->half_pending = false;
+    }
+    pthread_mutex_unlock(&lock);
+    return ret;
+}
+
+// Entrega buf ao callback, fora do lock. Com o lock.
+static void rx_deliver(struct rmt_channel_t *ch, bool last) {
+    rmt_rx_done_event_data_t edata = {
+        .received_symbols = ch->buf,
+        .num_symbols = ch->buf_len,
+        .flags.is_last = last,
+    };
+    rmt_rx_done_callback_t on_recv = ch->on_recv;
+    ch->buf_len = 0;
+    if (last) {
+        ch->armed = false;
+        ch->receiving = false;
+    }
+    if (!on_recv) return;
+
+    ch->busy = true;
+    pthread_mutex_unlock(&lock);
+    on_recv(ch, &edata, ch->user_ctx);
+    pthread_mutex_lock(&lock);
+    ch->busy = false;
+    pthread_cond_broadcast(&changed);
+}
+
+// Meio bloco da memória do canal para o buffer do usuário. Na recepção
+// parcial, o que não cabe mais vai antes ao callback e o buffer recomeça.
+static void rx_copy_mem(struct rmt_channel_t *ch) {
+    if (ch->buf_len + ch->mem_len > ch->buf_size) {
+        if (ch->receive.flags.en_partial_rx) {
+            rx_deliver(ch, false);
+        } else {
+            counters.rx_dropped += ch->buf_len + ch->mem_len - ch->buf_size;
+            ch->mem_len = ch->buf_size - ch->buf_len;
+        }
+    }
+    if (!ch->armed) return;                 // Desabilitado durante o callback
+    memcpy(ch->buf + ch->buf_len, ch->mem, ch->mem_len * sizeof(rmt_symbol_word_t));
+    ch->buf_len += ch->mem_len;
+    ch->mem_len = 0;
+}
+
+static void rx_push_half(struct rmt_channel_t *ch, unsigned level, uint32_t ticks) {
+    level ^= ch->rx_cfg.flags.invert_in;
+    if (!ch->half_pending) {
+        ch->half = (rmt_symbol_word_t) { .level0 = level, .duration0 = ticks };
+        ch->half_pending = true;
+        return;
+    }
+    ch->half.level1 = level;
+    ch->half.duration1 = ticks;
+    ch->half_pending = false;
+    ch->mem[ch->mem_len++] = ch->half;
+    if (ch->mem_len == ch->rx_cfg.mem_block_symbols / 2) rx_copy_mem(ch);
+}
+
+// Nível que durou `us`, em meios símbolos de até 15 bits
+static void rx_push_level(struct rmt_channel_t *ch, unsigned level, uint64_t us) {
+    uint64_t ticks = us * ch->rx_cfg.resolution_hz / 1000000;
+    while (ticks > 0 && ch->receiving) {
+        uint32_t part = ticks > RMT_MAX_TICKS ? RMT_MAX_TICKS : ticks;
+        rx_push_half(ch, level, part);
+        ticks -= part;
+    }
+}
+
+// Silêncio chegou ao limiar: marcador de fim (duração 0) e último evento
+static void rx_finish(struct rmt_channel_t *ch) {
+    rx_push_half(ch, rx_line, 0);
+    if (ch->half_pending) rx_push_half(ch, rx_line, 0);
+    if (ch->mem_len > 0) rx_copy_mem(ch);
+    if (ch->armed) rx_deliver(ch, true);
+}
+
+static uint64_t rx_idle_us(const struct rmt_channel_t *ch) {
+    return ch->receive.signal_range_max_ns / 1000;
+}
+
+void fake_rmt_rx_play(const fake_rmt_level_t *signal, size_t count) {
+    struct timespec t0;
+    uint64_t played_us = 0;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    pthread_mutex_lock(&lock);
+    for (size_t i = 0; i < count; i++) {
+        unsigned level = signal[i].level & 1;
+        uint64_t us = signal[i].us;
+
+        // Borda: fecha o nível anterior ou começa uma recepção
+        if (level != rx_line) {
+            for (int c = 0; c < FAKE_RMT_MAX_CHANNELS; c++) {
+                struct rmt_channel_t *ch = channels[c];
+                if (!ch || !ch->rx || !ch->enabled) continue;
+                if (ch->receiving) {
+                    rx_push_level(ch, rx_line, rx_held_us);
+                } else if (ch->armed) {
+                    ch->receiving = true;
+                } else {
+                    counters.rx_missed++;
+                }
+            }
+            rx_line = level;
+            rx_held_us = 0;
+        }
+
+        // O tempo passa em trechos, parando onde algum canal chega ao silêncio
+        while (us > 0) {
+            uint64_t step = us;
+            for (int c = 0; c < FAKE_RMT_MAX_CHANNELS; c++) {
+                struct rmt_channel_t *ch = channels[c];
+                if (!ch || !ch->rx || !ch->receiving) continue;
+                uint64_t idle = rx_idle_us(ch);
+                uint64_t left = idle > rx_held_us ? idle - rx_held_us : 0;
+                if (left > 0 && left < step) step = left;
+            }
+            double factor = realtime;
+            played_us += step;
+            pthread_mutex_unlock(&lock);
+            if (factor > 0) sleep_until(&t0, (int64_t)(played_us * factor));
+            pthread_mutex_lock(&lock);
+            rx_held_us += step;
+            us -= step;
+
+            for (int c = 0; c < FAKE_RMT_MAX_CHANNELS; c++) {
+                struct rmt_channel_t *ch = channels[c];
+                if (ch && ch->rx && ch->receiving && rx_held_us >= rx_idle_us(ch)) rx_finish(ch);
+            }
+        }
+    }
+    pthread_mutex_unlock(&lock);
+}
+
+// ========== REGISTRO ==========
+
+static bool all_idle(void) {
+    for (int i = 0; i < FAKE_RMT_MAX_CHANNELS; i++) {
+        if (channels[i] && (channels[i]->count > 0 || channels[i]->busy)) return false;
+    }
+    return true;
+}
+
+void fake_rmt_reset(void) {
+    pthread_mutex_lock(&lock);
+    while (!all_idle()) pthread_cond_wait(&changed, &lock);
+    trans_count = 0;
+    symbol_count = 0;
+    clock_us = 0;
+    pthread_mutex_unlock(&lock);
+}
+
+void fake_rmt_set_realtime(double factor) {
+    pthread_mutex_lock(&lock);
+    realtime = factor;
+    pthread_mutex_unlock(&lock);
+}
+
+void fake_rmt_drop_done(bool drop) {
+    pthread_mutex_lock(&lock);
+    drop_done = drop;
+    pthread_mutex_unlock(&lock);
+}
+
+int64_t fake_rmt_clock_us(void) {
+    pthread_mutex_lock(&lock);
+    int64_t now = clock_us;
+    pthread_mutex_unlock(&lock);
+    return now;
+}
+
+size_t fake_rmt_trans_count(void) {
+    pthread_mutex_lock(&lock);
+    size_t n = trans_count;
+    pthread_mutex_unlock(&lock);
+    return n;
+}
+
+bool fake_rmt_get_trans(size_t index, fake_rmt_trans_t *trans) {
+    pthread_mutex_lock(&lock);
+    bool found = index < trans_count;
+    if (found) *trans = log_trans[index];
+    pthread_mutex_unlock(&lock);
+    return found;
+}
+
+size_t fake_rmt_get_symbols(size_t first, rmt_symbol_word_t *out, size_t count) {
+    pthread_mutex_lock(&lock);
+    size_t n = 0;
+    if (first < symbol_count) {
+        n = (symbol_count - first < count) ? symbol_count - first : count;
+        memcpy(out, &log_symbols[first], n * sizeof(rmt_symbol_word_t));
+    }
+    pthread_mutex_unlock(&lock);
+    return n;
+}
+
+void fake_rmt_get_counters(fake_rmt_counters_t *out) {
+    pthread_mutex_lock(&lock);
+    *out = counters;
+    pthread_mutex_unlock(&lock);
+}
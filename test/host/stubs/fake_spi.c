@@ -0,0 +1,216 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <pthread.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include "fake_spi.h"
+
+struct spi_device_t {
+    spi_device_interface_config_t cfg;
+    bool removed;
+    bool in_flight;
+};
+
+#define FAKE_SPI_MAX_DEVICES    8
+
+static pthread_mutex_t bus_lock = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+static pthread_mutex_t state_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct spi_device_t devices[FAKE_SPI_MAX_DEVICES];
+static int device_count = 0;
+static bool bus_ready = false;
+
+static double realtime = 0;
+static fake_spi_sink_t sink = NULL;
+static void *sink_ctx = NULL;
+static int64_t bus_clock_us = 0;
+static int misuse = 0;
+
+static fake_spi_event_t *events = NULL;
+static size_t event_count = 0;
+static size_t event_cap = 0;
+
+void fake_spi_reset(void) {
+    pthread_mutex_lock(&bus_lock);
+    pthread_mutex_lock(&state_lock);
+    event_count = 0;
+    bus_clock_us = 0;
+    misuse = 0;
+    pthread_mutex_unlock(&state_lock);
+    pthread_mutex_unlock(&bus_lock);
+}
+
+void fake_spi_set_realtime(double factor) {
+    realtime = factor;
+}
+
+void fake_spi_set_sink(fake_spi_sink_t fn, void *ctx) {
+    sink = fn;
+    sink_ctx = ctx;
+}
+
+int64_t fake_spi_clock_us(void) {
+    pthread_mutex_lock(&state_lock);
+    int64_t now = bus_clock_us;
+    pthread_mutex_unlock(&state_lock);
+    return now;
+}
+
+size_t fake_spi_event_count(void) {
+    pthread_mutex_lock(&state_lock);
+    size_t n = event_count;
+    pthread_mutex_unlock(&state_lock);
+    return n;
+}
+
+bool fake_spi_get_event(size_t index, fake_spi_event_t *event) {
+    pthread_mutex_lock(&state_lock);
+    bool ok = index < event_count;
+    if (ok) *event = events[index];
+    pthread_mutex_unlock(&state_lock);
+    return ok;
+}
+
+int fake_spi_misuse_count(void) {
+    pthread_mutex_lock(&state_lock);
+    int n = misuse;
+    pthread_mutex_unlock(&state_lock);
+    return n;
+}
+
+static void note_misuse(void) {
+    pthread_mutex_lock(&state_lock);
+    misuse++;
+    pthread_mutex_unlock(&state_lock);
+}
+
+esp_err_t spi_bus_initialize(spi_host_device_t host, const spi_bus_config_t *config, int dma) {
+    (void)host;
+    (void)config;
+    (void)dma;
+    if (bus_ready) return ESP_ERR_INVALID_STATE;
+    bus_ready = true;
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_free(spi_host_device_t host) {
+    (void)host;
+    if (!bus_ready) return ESP_ERR_INVALID_STATE;
+    for (int i = 0; i < device_count; i++) {
+        if (!devices[i].removed) {
+            note_misuse();
+            return ESP_ERR_INVALID_STATE;
+        }
+    }
+    bus_ready = false;
+    device_count = 0;
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_add_device(spi_host_device_t host, const spi_device_interface_config_t *config,
+                             spi_device_handle_t *handle) {
+    (void)host;
+    if (!bus_ready) return ESP_ERR_INVALID_STATE;
+    if (device_count == FAKE_SPI_MAX_DEVICES) return ESP_ERR_NO_MEM;
+    struct spi_device_t *dev = &devices[device_count++];
+    memset(dev, 0, sizeof(*dev));
+    dev->cfg = *config;
+    *handle = dev;
+    return ESP_OK;
+}
+
+esp_err_t spi_bus_remove_device(spi_device_handle_t handle) {
+    pthread_mutex_lock(&state_lock);
+    if (handle->in_flight) misuse++;
+    handle->removed = true;
+    pthread_mutex_unlock(&state_lock);
+    return ESP_OK;
+}
+
+static void sleep_us(int64_t us) {
+    if (us <= 0) return;
+    struct timespec ts = { .tv_sec = us / 1000000, .tv_nsec = (us % 1000000) * 1000 };
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+    }
+}
+
+static esp_err_t run(spi_device_handle_t dev, spi_transaction_t *t, bool polling) {
+    pthread_mutex_lock(&bus_lock);
+    pthread_mutex_lock(&state_lock);
+    bool dead = dev->removed;
+    if (dead) misuse++;
+    dev->in_flight = !dead;
+    int64_t start = bus_clock_us;
+    pthread_mutex_unlock(&state_lock);
+    if (dead) {
+        pthread_mutex_unlock(&bus_lock);
+        return ESP_ERR_INVALID_STATE;
+    }
+
+    size_t len = t->length / 8;
+    int hz = dev->cfg.clock_speed_hz > 0 ? dev->cfg.clock_speed_hz : 1000000;
+    int64_t dur = ((int64_t)t->length * 1000000 + hz - 1) / hz;
+
+    if (dev->cfg.pre_cb) dev->cfg.pre_cb(t);
+    if (sink) sink(dev->cfg.spics_io_num, t, sink_ctx);
+    if (t->rx_buffer && !(t->flags & SPI_TRANS_USE_RXDATA)) {
+        memset(t->rx_buffer, 0xA5, len);
+    }
+    if (realtime > 0) sleep_us((int64_t)(dur * realtime));
+    if (dev->cfg.post_cb) dev->cfg.post_cb(t);
+
+    pthread_mutex_lock(&state_lock);
+    bus_clock_us += dur;
+    if (event_count == event_cap) {
+        event_cap = event_cap ? event_cap * 2 : 1024;
+        events = realloc(events, event_cap * sizeof(*events));
+    }
+    events[event_count++] = (fake_spi_event_t){
+        .cs = dev->cfg.spics_io_num,
+        .len = len,
+        .user = (uint32_t)(uintptr_t)t->user,
+        .tx = (t->flags & SPI_TRANS_USE_TXDATA) ? NULL : t->tx_buffer,
+        .polling = polling,
+        .task = xTaskGetCurrentTaskHandle(),
+        .start_us = start,
+        .end_us = start + dur,
+    };
+    dev->in_flight = false;
+    pthread_mutex_unlock(&state_lock);
+    pthread_mutex_unlock(&bus_lock);
+    return ESP_OK;
+}
+
+esp_err_t spi_device_transmit(spi_device_handle_t handle, spi_transaction_t *trans) {
+    return run(handle, trans, false);
+}
+
+esp_err_t spi_device_polling_transmit(spi_device_handle_t handle, spi_transaction_t *trans) {
+    return run(handle, trans, true);
+}
+
+esp_err_t spi_device_acquire_bus(spi_device_handle_t handle, TickType_t wait) {
+    (void)handle;
+    (void)wait;
+    pthread_mutex_lock(&bus_lock);
+    return ESP_OK;
+}
+
+void spi_device_release_bus(spi_device_handle_t handle) {
+    (void)handle;
+    pthread_mutex_unlock(&bus_lock);
+}
@@ -0,0 +1,572 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// FreeRTOS sobre pthreads. Filas, semáforos e event groups usam mutex +
+// variável de condição com CLOCK_MONOTONIC; timeouts são em ticks de 10 ms.
+
+#include <pthread.h>
+#include <time.h>
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/queue.h"
+#include "freertos/semphr.h"
+#include "freertos/event_groups.h"
+#include "host_locks.h"
+
+/* ==== Tempo ==== */
+
+static void cond_init(pthread_cond_t *cond) {
+    pthread_condattr_t attr;
+    pthread_condattr_init(&attr);
+    pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+    pthread_cond_init(cond, &attr);
+    pthread_condattr_destroy(&attr);
+}
+
+static void deadline_after(struct timespec *ts, TickType_t ticks) {
+    clock_gettime(CLOCK_MONOTONIC, ts);
+    int64_t ns = (int64_t)ticks * (1000000000LL / configTICK_RATE_HZ);
+    ts->tv_sec += ns / 1000000000LL;
+    ts->tv_nsec += ns % 1000000000LL;
+    if (ts->tv_nsec >= 1000000000L) {
+        ts->tv_sec++;
+        ts->tv_nsec -= 1000000000L;
+    }
+}
+
+// Espera em `cond` até o prazo; false quando o prazo passou
+static bool cond_wait_ticks(pthread_cond_t *cond, pthread_mutex_t *m, TickType_t ticks,
+                            const struct timespec *deadline) {
+    if (ticks == 0) {
+        return false;
+    }
+    if (ticks == portMAX_DELAY) {
+        pthread_cond_wait(cond, m);
+        return true;
+    }
+    return pthread_cond_timedwait(cond, m, deadline) != ETIMEDOUT;
+}
+
+TickType_t xTaskGetTickCount(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (TickType_t)(ts.tv_sec * configTICK_RATE_HZ +
+                        ts.tv_nsec / (1000000000L / configTICK_RATE_HZ));
+}
+
+void vTaskDelay(TickType_t ticks) {
+    struct timespec ts = {
+        .tv_sec = ticks / configTICK_RATE_HZ,
+        .tv_nsec = (long)(ticks % configTICK_RATE_HZ) * (1000000000L / configTICK_RATE_HZ),
+    };
+    if (ticks == 0) {
+        sched_yield();
+        return;
+    }
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR) {
+    }
+}
+
+static pthread_mutex_t critical_lock = PTHREAD_RECURSIVE_MUTEX_INITIALIZER_NP;
+
+void host_critical_enter(portMUX_TYPE *mux) {
+    (void)mux;
+    pthread_mutex_lock(&critical_lock);
+}
+
+void host_critical_exit(portMUX_TYPE *mux) {
+    (void)mux;
+    pthread_mutex_unlock(&critical_lock);
+}
+
+/* ==== Tasks ==== */
+
+struct host_task {
+    pthread_t thread;
+    TaskFunction_t fn;
+    void *arg;
+    char name[16];
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    uint32_t notify;
+    struct host_task *next;     // Registro global (mantém as tasks alcançáveis)
+};
+
+static pthread_mutex_t tasks_lock = PTHREAD_MUTEX_INITIALIZER;
+static struct host_task *tasks = NULL;
+static int live_tasks = 0;
+static __thread struct host_task *current_task = NULL;
+
+static struct host_task *task_alloc(const char *name) {
+    struct host_task *t = calloc(1, sizeof(*t));
+    if (!t) return NULL;
+    snprintf(t->name, sizeof(t->name), "%s", name ? name : "");
+    pthread_mutex_init(&t->lock, NULL);
+    cond_init(&t->cond);
+    pthread_mutex_lock(&tasks_lock);
+    t->next = tasks;
+    tasks = t;
+    pthread_mutex_unlock(&tasks_lock);
+    return t;
+}
+
+static void task_exited(void *arg) {
+    (void)arg;
+    pthread_mutex_lock(&tasks_lock);
+    live_tasks--;
+    pthread_mutex_unlock(&tasks_lock);
+}
+
+static void *task_trampoline(void *arg) {
+    struct host_task *t = arg;
+    current_task = t;
+    pthread_cleanup_push(task_exited, NULL);
+    t->fn(t->arg);
+    pthread_cleanup_pop(1);
+    return NULL;
+}
+
+BaseType_t xTaskCreate(TaskFunction_t fn, const char *name, uint32_t stack, void *arg,
+                       UBaseType_t prio, TaskHandle_t *handle) {
+    (void)stack;
+    (void)prio;
+    struct host_task *t = task_alloc(name);
+    if (!t) return pdFAIL;
+    t->fn = fn;
+    t->arg = arg;
+    if (handle) *handle = t;
+
+    pthread_mutex_lock(&tasks_lock);
+    live_tasks++;
+    pthread_mutex_unlock(&tasks_lock);
+
+    if (pthread_create(&t->thread, NULL, task_trampoline, t) != 0) {
+        task_exited(NULL);
+        if (handle) *handle = NULL;
+        return pdFAIL;
+    }
+    pthread_detach(t->thread);
+    return pdPASS;
+}
+
+BaseType_t xTaskCreatePinnedToCore(TaskFunction_t fn, const char *name, uint32_t stack,
+                                   void *arg, UBaseType_t prio, TaskHandle_t *handle,
+                                   BaseType_t core) {
+    (void)core;
+    return xTaskCreate(fn, name, stack, arg, prio, handle);
+}
+
+void vTaskDelete(TaskHandle_t handle) {
+    if (handle && handle != current_task) {
+        fprintf(stderr, "vTaskDelete de outra task não é suportado no host\n");
+        abort();
+    }
+    pthread_exit(NULL);
+}
+
+TaskHandle_t xTaskGetCurrentTaskHandle(void) {
+    // Threads criadas pelo próprio teste ganham um handle na primeira consulta
+    if (!current_task) {
+        current_task = task_alloc("host");
+        current_task->thread = pthread_self();
+    }
+    return current_task;
+}
+
+int host_task_live_count(void) {
+    pthread_mutex_lock(&tasks_lock);
+    int n = live_tasks;
+    pthread_mutex_unlock(&tasks_lock);
+    return n;
+}
+
+uint32_t ulTaskNotifyTake(BaseType_t clear, TickType_t ticks) {
+    struct host_task *t = xTaskGetCurrentTaskHandle();
+    struct timespec deadline;
+    deadline_after(&deadline, ticks);
+
+    pthread_mutex_lock(&t->lock);
+    while (t->notify == 0) {
+        if (!cond_wait_ticks(&t->cond, &t->lock, ticks, &deadline)) break;
+    }
+    uint32_t value = t->notify;
+    if (value) {
+        t->notify = clear ? 0 : value - 1;
+    }
+    pthread_mutex_unlock(&t->lock);
+    return value;
+}
+
+BaseType_t xTaskNotifyGive(TaskHandle_t handle) {
+    pthread_mutex_lock(&handle->lock);
+    handle->notify++;
+    pthread_cond_broadcast(&handle->cond);
+    pthread_mutex_unlock(&handle->lock);
+    return pdPASS;
+}
+
+/* ==== Filas e semáforos ==== */
+
+typedef enum {
+    KIND_QUEUE,
+    KIND_SEMAPHORE,
+    KIND_RECURSIVE_MUTEX,
+} queue_kind_t;
+
+struct host_queue {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    queue_kind_t kind;
+    size_t item_size;
+    size_t length;
+    size_t count;
+    size_t head;
+    uint8_t *items;
+    TaskHandle_t owner;         // Mutex recursivo
+    unsigned depth;
+    bool is_mutex;              // Entra no registro de ordem (host_locks.h)
+};
+
+/* ==== Ordem dos mutexes ==== */
+
+static pthread_mutex_t edges_lock = PTHREAD_MUTEX_INITIALIZER;
+static host_lock_edge_t edges[HOST_LOCKS_MAX_EDGES];
+static size_t edge_count;
+static __thread SemaphoreHandle_t held[HOST_LOCKS_MAX_HELD];
+static __thread size_t held_count;
+
+static void lock_taken(SemaphoreHandle_t sem) {
+    pthread_mutex_lock(&edges_lock);
+    for (size_t i = 0; i < held_count; i++) {
+        bool known = false;
+        for (size_t e = 0; e < edge_count && !known; e++) {
+            known = edges[e].held == held[i] && edges[e].taken == sem;
+        }
+        if (!known && edge_count < HOST_LOCKS_MAX_EDGES) {
+            edges[edge_count++] = (host_lock_edge_t){ .held = held[i], .taken = sem };
+        }
+    }
+    pthread_mutex_unlock(&edges_lock);
+    if (held_count < HOST_LOCKS_MAX_HELD) held[held_count++] = sem;
+}
+
+static void lock_given(SemaphoreHandle_t sem) {
+    for (size_t i = held_count; i-- > 0;) {
+        if (held[i] == sem) {
+            memmove(&held[i], &held[i + 1], (held_count - i - 1) * sizeof(held[0]));
+            held_count--;
+            return;
+        }
+    }
+}
+
+size_t host_lock_edges(host_lock_edge_t *out, size_t max) {
+    pthread_mutex_lock(&edges_lock);
+    size_t n = edge_count;
+    if (out) memcpy(out, edges, (n < max ? n : max) * sizeof(edges[0]));
+    pthread_mutex_unlock(&edges_lock);
+    return n;
+}
+
+void host_lock_reset(void) {
+    pthread_mutex_lock(&edges_lock);
+    edge_count = 0;
+    pthread_mutex_unlock(&edges_lock);
+}
+
+size_t host_locks_held(SemaphoreHandle_t *out, size_t max) {
+    size_t n = held_count < max ? held_count : max;
+    memcpy(out, held, n * sizeof(held[0]));
+    return held_count;
+}
+
+static struct host_queue *queue_new(size_t length, size_t item_size, queue_kind_t kind) {
+    struct host_queue *q = calloc(1, sizeof(*q));
+    if (!q) return NULL;
+    q->kind = kind;
+    q->length = length ? length : 1;
+    q->item_size = item_size;
+    if (item_size) {
+        q->items = calloc(q->length, item_size);
+        if (!q->items) {
+            free(q);
+            return NULL;
+        }
+    }
+    pthread_mutex_init(&q->lock, NULL);
+    cond_init(&q->cond);
+    return q;
+}
+
+QueueHandle_t xQueueCreate(UBaseType_t length, UBaseType_t item_size) {
+    return queue_new(length, item_size, KIND_QUEUE);
+}
+
+static BaseType_t queue_put(QueueHandle_t q, const void *item, TickType_t ticks, bool front) {
+    struct timespec deadline;
+    deadline_after(&deadline, ticks);
+
+    pthread_mutex_lock(&q->lock);
+    while (q->count >= q->length) {
+        if (!cond_wait_ticks(&q->cond, &q->lock, ticks, &deadline)) {
+            pthread_mutex_unlock(&q->lock);
+            return pdFALSE;
+        }
+    }
+    if (q->item_size) {
+        size_t slot;
+        if (front) {
+            q->head = (q->head + q->length - 1) % q->length;
+            slot = q->head;
+        } else {
+            slot = (q->head + q->count) % q->length;
+        }
+        memcpy(q->items + slot * q->item_size, item, q->item_size);
+    }
+    q->count++;
+    pthread_cond_broadcast(&q->cond);
+    pthread_mutex_unlock(&q->lock);
+    return pdTRUE;
+}
+
+static BaseType_t queue_get(QueueHandle_t q, void *item, TickType_t ticks, bool peek) {
+    struct timespec deadline;
+    deadline_after(&deadline, ticks);
+
+    pthread_mutex_lock(&q->lock);
+    while (q->count == 0) {
+        if (!cond_wait_ticks(&q->cond, &q->lock, ticks, &deadline)) {
+            pthread_mutex_unlock(&q->lock);
+            return pdFALSE;
+        }
+    }
+    if (q->item_size && item) {
+        memcpy(item, q->items + q->head * q->item_size, q->item_size);
+    }
+    if (!peek) {
+        q->head = (q->head + 1) % q->length;
+        q->count--;
+        pthread_cond_broadcast(&q->cond);
+    }
+    pthread_mutex_unlock(&q->lock);
+    return pdTRUE;
+}
+
+BaseType_t xQueueSend(QueueHandle_t q, const void *item, TickType_t ticks) {
+    return queue_put(q, item, ticks, false);
+}
+
+BaseType_t xQueueSendToFront(QueueHandle_t q, const void *item, TickType_t ticks) {
+    return queue_put(q, item, ticks, true);
+}
+
+BaseType_t xQueueSendFromISR(QueueHandle_t q, const void *item, BaseType_t *woken) {
+    if (woken) *woken = pdFALSE;
+    return queue_put(q, item, 0, false);
+}
+
+BaseType_t xQueueOverwrite(QueueHandle_t q, const void *item) {
+    pthread_mutex_lock(&q->lock);
+    q->head = 0;
+    q->count = 0;
+    pthread_mutex_unlock(&q->lock);
+    return queue_put(q, item, 0, false);
+}
+
+BaseType_t xQueueReceive(QueueHandle_t q, void *item, TickType_t ticks) {
+    return queue_get(q, item, ticks, false);
+}
+
+BaseType_t xQueuePeek(QueueHandle_t q, void *item, TickType_t ticks) {
+    return queue_get(q, item, ticks, true);
+}
+
+BaseType_t xQueueReset(QueueHandle_t q) {
+    pthread_mutex_lock(&q->lock);
+    q->head = 0;
+    q->count = 0;
+    pthread_cond_broadcast(&q->cond);
+    pthread_mutex_unlock(&q->lock);
+    return pdPASS;
+}
+
+UBaseType_t uxQueueMessagesWaiting(QueueHandle_t q) {
+    pthread_mutex_lock(&q->lock);
+    UBaseType_t n = q->count;
+    pthread_mutex_unlock(&q->lock);
+    return n;
+}
+
+void vQueueDelete(QueueHandle_t q) {
+    if (!q) return;
+    pthread_mutex_destroy(&q->lock);
+    pthread_cond_destroy(&q->cond);
+    free(q->items);
+    free(q);
+}
+
+SemaphoreHandle_t xSemaphoreCreateBinary(void) {
+    return queue_new(1, 0, KIND_SEMAPHORE);
+}
+
+SemaphoreHandle_t xSemaphoreCreateMutex(void) {
+    struct host_queue *q = queue_new(1, 0, KIND_SEMAPHORE);
+    if (q) {
+        q->count = 1;
+        q->is_mutex = true;
+    }
+    return q;
+}
+
+SemaphoreHandle_t xSemaphoreCreateRecursiveMutex(void) {
+    struct host_queue *q = queue_new(1, 0, KIND_RECURSIVE_MUTEX);
+    if (q) {
+        q->count = 1;
+        q->is_mutex = true;
+    }
+    return q;
+}
+
+SemaphoreHandle_t xSemaphoreCreateCounting(UBaseType_t max, UBaseType_t initial) {
+    struct host_queue *q = queue_new(max, 0, KIND_SEMAPHORE);
+    if (q) q->count = initial;
+    return q;
+}
+
+BaseType_t xSemaphoreTake(SemaphoreHandle_t sem, TickType_t ticks) {
+    if (!queue_get(sem, NULL, ticks, false)) return pdFALSE;
+    if (sem->is_mutex) lock_taken(sem);
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGive(SemaphoreHandle_t sem) {
+    if (sem->is_mutex) lock_given(sem);
+    return queue_put(sem, NULL, 0, false);
+}
+
+BaseType_t xSemaphoreGiveFromISR(SemaphoreHandle_t sem, BaseType_t *woken) {
+    if (woken) *woken = pdFALSE;
+    return queue_put(sem, NULL, 0, false);
+}
+
+BaseType_t xSemaphoreTakeRecursive(SemaphoreHandle_t sem, TickType_t ticks) {
+    TaskHandle_t self = xTaskGetCurrentTaskHandle();
+    pthread_mutex_lock(&sem->lock);
+    bool mine = sem->owner == self && sem->depth > 0;
+    if (mine) sem->depth++;
+    pthread_mutex_unlock(&sem->lock);
+    if (mine) return pdTRUE;
+
+    if (!queue_get(sem, NULL, ticks, false)) return pdFALSE;
+    pthread_mutex_lock(&sem->lock);
+    sem->owner = self;
+    sem->depth = 1;
+    pthread_mutex_unlock(&sem->lock);
+    lock_taken(sem);
+    return pdTRUE;
+}
+
+BaseType_t xSemaphoreGiveRecursive(SemaphoreHandle_t sem) {
+    pthread_mutex_lock(&sem->lock);
+    if (sem->owner != xTaskGetCurrentTaskHandle() || sem->depth == 0) {
+        pthread_mutex_unlock(&sem->lock);
+        return pdFALSE;
+    }
+    bool release = --sem->depth == 0;
+    if (release) sem->owner = NULL;
+    pthread_mutex_unlock(&sem->lock);
+    if (release) lock_given(sem);
+    return release ? queue_put(sem, NULL, 0, false) : pdTRUE;
+}
+
+UBaseType_t uxSemaphoreGetCount(SemaphoreHandle_t sem) {
+    return uxQueueMessagesWaiting(sem);
+}
+
+void vSemaphoreDelete(SemaphoreHandle_t sem) {
+    vQueueDelete(sem);
+}
+
+/* ==== Event groups ==== */
+
+struct host_event_group {
+    pthread_mutex_t lock;
+    pthread_cond_t cond;
+    EventBits_t bits;
+};
+
+EventGroupHandle_t xEventGroupCreate(void) {
+    struct host_event_group *g = calloc(1, sizeof(*g));
+    if (!g) return NULL;
+    pthread_mutex_init(&g->lock, NULL);
+    cond_init(&g->cond);
+    return g;
+}
+
+EventBits_t xEventGroupSetBits(EventGroupHandle_t g, EventBits_t bits) {
+    pthread_mutex_lock(&g->lock);
+    g->bits |= bits;
+    EventBits_t now = g->bits;
+    pthread_cond_broadcast(&g->cond);
+    pthread_mutex_unlock(&g->lock);
+    return now;
+}
+
+EventBits_t xEventGroupClearBits(EventGroupHandle_t g, EventBits_t bits) {
+    pthread_mutex_lock(&g->lock);
+    EventBits_t before = g->bits;
+    g->bits &= ~bits;
+    pthread_mutex_unlock(&g->lock);
+    return before;
+}
+
+EventBits_t xEventGroupGetBits(EventGroupHandle_t g) {
+    pthread_mutex_lock(&g->lock);
+    EventBits_t now = g->bits;
+    pthread_mutex_unlock(&g->lock);
+    return now;
+}
+
+EventBits_t xEventGroupWaitBits(EventGroupHandle_t g, EventBits_t bits, BaseType_t clear,
+                                BaseType_t all, TickType_t ticks) {
+    struct timespec deadline;
+    deadline_after(&deadline, ticks);
+
+    pthread_mutex_lock(&g->lock);
+    for (;;) {
+        EventBits_t hit = g->bits & bits;
+        if (all ? hit == bits : hit != 0) break;
+        if (!cond_wait_ticks(&g->cond, &g->lock, ticks, &deadline)) {
+            EventBits_t now = g->bits;
+            pthread_mutex_unlock(&g->lock);
+            return now;
+        }
+    }
+    EventBits_t now = g->bits;
+    if (clear) g->bits &= ~bits;
+    pthread_mutex_unlock(&g->lock);
+    return now;
+}
+
+void vEventGroupDelete(EventGroupHandle_t g) {
+    if (!g) return;
+    pthread_mutex_destroy(&g->lock);
+    pthread_cond_destroy(&g->cond);
+    free(g);
+}
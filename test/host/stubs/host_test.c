@@ -0,0 +1,69 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "host_test.h"
+
+int host_checks = 0;
+int host_failures = 0;
+
+static const char *section = "";
+static char tmpdir[256];
+
+void host_check_failed(const char *file, int line, const char *expr, const char *detail) {
+    host_failures++;
+    fprintf(stderr, "FALHA [%s] %s:%d: %s%s%s\n", section, file, line, expr,
+            detail ? " -> " : "", detail ? detail : "");
+}
+
+void host_test_section(const char *name) {
+    section = name;
+    printf("-- %s\n", name);
+    fflush(stdout);
+}
+
+const char *host_test_tmpdir(void) {
+    if (!tmpdir[0]) {
+        const char *base = getenv("TMPDIR");
+        snprintf(tmpdir, sizeof(tmpdir), "%s/host_test_XXXXXX", base ? base : "/tmp");
+        if (!mkdtemp(tmpdir)) {
+            perror("mkdtemp");
+            exit(2);
+        }
+    }
+    return tmpdir;
+}
+
+int64_t host_test_now_us(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+int host_test_finish(const char *name) {
+    if (tmpdir[0]) {
+        char cmd[300];
+        snprintf(cmd, sizeof(cmd), "rm -rf '%s'", tmpdir);
+        if (system(cmd) != 0) {
+            fprintf(stderr, "não foi possível apagar %s\n", tmpdir);
+        }
+    }
+    printf("%s: %d verificações, %d falhas\n", name, host_checks, host_failures);
+    return host_failures ? 1 : 0;
+}
@@ -0,0 +1,27 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Constantes do protocolo SD usadas pelos módulos testados.
+
+#ifndef HOST_DRIVER_SDMMC_DEFS_H
+#define HOST_DRIVER_SDMMC_DEFS_H
+
+#define MMC_GO_IDLE_STATE       0
+#define MMC_SEND_STATUS         13
+
+#define SD_OCR_SDHC_CAP         (1 << 30)
+#define SD_OCR_VOL_MASK         0xff8000
+
+#endif // HOST_DRIVER_SDMMC_DEFS_H
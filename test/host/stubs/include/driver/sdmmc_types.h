@@ -0,0 +1,75 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Tipos do driver SDMMC do IDF, só os campos que os módulos testados usam.
+
+#ifndef HOST_DRIVER_SDMMC_TYPES_H
+#define HOST_DRIVER_SDMMC_TYPES_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+
+#define SDMMC_FREQ_DEFAULT      20000       // kHz
+#define SDMMC_FREQ_PROBING      400
+
+typedef struct {
+    uint32_t opcode;
+    uint32_t arg;
+    uint32_t response[4];
+    void *data;
+    size_t datalen;
+    size_t blklen;
+    int flags;
+    esp_err_t error;
+    uint32_t timeout_ms;
+} sdmmc_command_t;
+
+typedef struct {
+    uint32_t flags;
+    int slot;
+    int max_freq_khz;
+    esp_err_t (*do_transaction)(int slot, sdmmc_command_t *cmd);
+} sdmmc_host_t;
+
+typedef struct {
+    int mfg_id;
+    int oem_id;
+    char name[8];
+    int revision;
+    int serial;
+    int date;
+} sdmmc_cid_t;
+
+typedef struct {
+    int csd_ver;
+    int mmc_ver;
+    int capacity;           // Setores
+    int sector_size;
+    int read_block_len;
+    int card_command_class;
+    int tr_speed;
+} sdmmc_csd_t;
+
+typedef struct {
+    sdmmc_host_t host;
+    uint32_t ocr;
+    sdmmc_cid_t cid;
+    sdmmc_csd_t csd;
+    int max_freq_khz;
+    int real_freq_khz;
+} sdmmc_card_t;
+
+#endif // HOST_DRIVER_SDMMC_TYPES_H
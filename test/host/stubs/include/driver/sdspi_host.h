@@ -0,0 +1,52 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Host SDSPI do IDF. O cartão simulado (fake_fs.c) responde aos comandos
+// sem passar pelo barramento SPI simulado.
+
+#ifndef HOST_DRIVER_SDSPI_HOST_H
+#define HOST_DRIVER_SDSPI_HOST_H
+
+#include "driver/sdmmc_types.h"
+#include "driver/spi_common.h"
+
+#define SDSPI_DEFAULT_HOST      SPI2_HOST
+
+typedef struct {
+    spi_host_device_t host_id;
+    int gpio_cs;
+    int gpio_cd;
+    int gpio_wp;
+    int gpio_int;
+} sdspi_device_config_t;
+
+esp_err_t sdspi_host_do_transaction(int slot, sdmmc_command_t *cmd);
+
+#define SDSPI_HOST_DEFAULT() { \
+        .flags = 0, \
+        .slot = SDSPI_DEFAULT_HOST, \
+        .max_freq_khz = SDMMC_FREQ_DEFAULT, \
+        .do_transaction = sdspi_host_do_transaction, \
+    }
+
+#define SDSPI_DEVICE_CONFIG_DEFAULT() { \
+        .host_id = SDSPI_DEFAULT_HOST, \
+        .gpio_cs = -1, \
+        .gpio_cd = -1, \
+        .gpio_wp = -1, \
+        .gpio_int = -1, \
+    }
+
+#endif // HOST_DRIVER_SDSPI_HOST_H
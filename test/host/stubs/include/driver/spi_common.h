@@ -0,0 +1,23 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// No host o barramento (spi_bus_*) fica junto do spi_master simulado.
+
+#ifndef HOST_DRIVER_SPI_COMMON_H
+#define HOST_DRIVER_SPI_COMMON_H
+
+#include "driver/spi_master.h"
+
+#endif // HOST_DRIVER_SPI_COMMON_H
@@ -0,0 +1,43 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Partição LittleFS do esp_littlefs, simulada por fake_fs.c: a partição é
+// um diretório do host (ver fake_fs.h).
+
+#ifndef HOST_ESP_LITTLEFS_H
+#define HOST_ESP_LITTLEFS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+typedef struct {
+    const char *base_path;
+    const char *partition_label;
+    const void *partition;
+    uint8_t format_if_mount_failed:1;
+    uint8_t read_only:1;
+    uint8_t dont_mount:1;
+    uint8_t grow_on_mount:1;
+} esp_vfs_littlefs_conf_t;
+
+esp_err_t esp_vfs_littlefs_register(const esp_vfs_littlefs_conf_t *conf);
+esp_err_t esp_vfs_littlefs_unregister(const char *partition_label);
+esp_err_t esp_littlefs_info(const char *partition_label, size_t *total_bytes, size_t *used_bytes);
+esp_err_t esp_littlefs_format(const char *partition_label);
+bool esp_littlefs_mounted(const char *partition_label);
+
+#endif // HOST_ESP_LITTLEFS_H
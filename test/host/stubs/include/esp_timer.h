@@ -0,0 +1,30 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Relógio do host. Por padrão é o CLOCK_MONOTONIC; um teste pode trocar a
+// fonte (ex: relógio virtual de um mock) com host_clock_set_source().
+
+#ifndef HOST_ESP_TIMER_H
+#define HOST_ESP_TIMER_H
+
+#include <stdint.h>
+#include "esp_err.h"
+
+int64_t esp_timer_get_time(void);
+
+typedef int64_t (*host_clock_fn_t)(void);
+void host_clock_set_source(host_clock_fn_t fn);
+
+#endif // HOST_ESP_TIMER_H
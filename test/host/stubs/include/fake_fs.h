@@ -0,0 +1,53 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Sistemas de arquivos do IDF no host. A partição LittleFS e o cartão SD
+// (FAT) são diretórios do host embaixo de uma raiz: os backends chamam
+// open()/stat()/fopen()... com o caminho montado ("/littlefs/x") e, quando
+// compilados com host_fs_redirect.h (-include), essas chamadas passam por
+// host_fs_*, que põem a raiz na frente do caminho.
+//
+// Diferenças conhecidas para o hardware: os nomes seguem o sistema do host
+// (o FAT do IDF não distingue maiúsculas e tem limite de nome), e rename()
+// sobre um arquivo existente o substitui (no FAT falha).
+
+#ifndef FAKE_FS_H
+#define FAKE_FS_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define FAKE_FS_LITTLEFS_BYTES      (1024 * 1024)   // Tamanho da partição
+#define FAKE_FS_LITTLEFS_BLOCK      4096
+#define FAKE_FS_CARD_NAME           "SD16G"
+#define FAKE_FS_CARD_SECTORS        (32 * 1024 * 1024)  // 16 GB em setores de 512
+#define FAKE_FS_CARD_CLUSTER        32              // Setores por cluster (16 KB)
+#define FAKE_FS_CARD_FREQ_KHZ       20000
+
+// Diretório que faz o papel de "/" para os backends (criado se preciso);
+// NULL volta aos caminhos reais
+void fake_fs_set_root(const char *dir);
+
+// Caminho no host de um caminho montado; false se não couber em `size`
+bool fake_fs_host_path(const char *path, char *out, size_t size);
+
+// Sem cartão no slot: mount e comandos falham com ESP_ERR_TIMEOUT
+void fake_fs_set_card_present(bool present);
+
+// Comandos recebidos pelo cartão (sdspi_host_do_transaction)
+int fake_fs_card_commands(void);
+
+#endif // FAKE_FS_H
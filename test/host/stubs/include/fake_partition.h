@@ -0,0 +1,41 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Partições de dados do esp_partition no host. Um rótulo aponta para um
+// arquivo comum, que faz o papel da partição inteira (o tamanho da partição
+// é o do arquivo no registro). esp_partition_mmap() mapeia só a faixa pedida,
+// somente leitura: gravar pelo ponteiro derruba o teste, como na flash.
+
+#ifndef FAKE_PARTITION_H
+#define FAKE_PARTITION_H
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#define FAKE_PARTITION_MAX      4
+
+// Registra (ou substitui) a partição `label` sobre o arquivo `path`;
+// false se o arquivo não existe ou a tabela está cheia
+bool fake_partition_add(const char *label, const char *path);
+
+// Remove todas as partições; os mapeamentos têm que ter sido desfeitos
+void fake_partition_clear(void);
+
+// Mapeamentos vivos e bytes pedidos no último esp_partition_mmap()
+int fake_partition_mappings(void);
+size_t fake_partition_last_map_size(void);
+
+#endif // FAKE_PARTITION_H
@@ -0,0 +1,94 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Periférico RMT simulado. TX: como no driver do IDF, cada transação passa
+// pelo encoder só quando chega a vez dela na linha, e em blocos de
+// mem_block_symbols: o encoder é chamado de novo a cada
+// RMT_ENCODING_MEM_FULL até RMT_ENCODING_COMPLETE. Uma thread por canal
+// atende a fila (até trans_queue_depth transações; rmt_transmit() bloqueia
+// com ela cheia), avança o relógio simulado pela soma das durações e chama
+// on_trans_done. Com fake_rmt_set_realtime() o tempo no ar também passa de
+// verdade.
+//
+// Os símbolos de todas as transações ficam registrados, com a portadora
+// aplicada no momento do rmt_transmit().
+//
+// RX: o teste toca um sinal na entrada com fake_rmt_rx_play() e cada canal RX
+// com rmt_receive() pendente o grava como o driver: começa na primeira borda,
+// passa pela memória do canal em meios blocos (recepção parcial: on_recv_done
+// com is_last = 0 quando o buffer do usuário enche) e termina quando um nível
+// dura signal_range_max_ns, com o marcador de duração 0 e is_last = 1. O
+// callback roda na thread de quem toca o sinal e pode rearmar a recepção.
+// Bordas com o canal habilitado e sem recepção pendente se perdem. O filtro
+// de glitches (signal_range_min_ns) não é simulado.
+
+#ifndef FAKE_RMT_H
+#define FAKE_RMT_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "driver/rmt_tx.h"
+#include "driver/rmt_rx.h"
+
+typedef struct {
+    int channel;                // Ordem de criação do canal
+    size_t first;               // Primeiro símbolo (fake_rmt_get_symbols)
+    size_t count;
+    uint32_t carrier_hz;        // 0 = sem portadora
+    float duty_cycle;
+    int64_t start_us;           // Relógio simulado
+    int64_t end_us;
+    bool underrun;              // A fila estava vazia quando a anterior terminou
+                                // (linha parada; só faz sentido com realtime)
+} fake_rmt_trans_t;
+
+typedef struct {
+    int channels;               // Canais vivos
+    int channels_created;
+    int encoders;               // Encoders vivos (cópia, bytes e os de protocolo)
+    int encoders_created;
+    int carrier_changes;
+    int misuse;                 // Transmit com canal desabilitado, portadora trocada
+                                // com transações na fila, canal apagado habilitado...
+    int rx_missed;              // Bordas sem recepção pendente
+    int rx_dropped;             // Símbolos além do buffer (sem recepção parcial)
+} fake_rmt_counters_t;
+
+// Trecho do sinal na entrada dos canais RX
+typedef struct {
+    uint8_t level;
+    uint32_t us;
+} fake_rmt_level_t;
+
+// Espera as filas esvaziarem e limpa o registro e o relógio
+void fake_rmt_reset(void);
+
+void fake_rmt_set_realtime(double factor);   // 0 = instantâneo, 1 = tempo no ar
+void fake_rmt_drop_done(bool drop);          // Não chama mais on_trans_done
+int64_t fake_rmt_clock_us(void);
+
+size_t fake_rmt_trans_count(void);
+bool fake_rmt_get_trans(size_t index, fake_rmt_trans_t *trans);
+size_t fake_rmt_get_symbols(size_t first, rmt_symbol_word_t *out, size_t count);
+
+void fake_rmt_get_counters(fake_rmt_counters_t *counters);
+
+// Toca o sinal na entrada dos canais RX e volta no fim. A linha começa em 1
+// (receptor ativo em 0 parado) e continua do último nível entre chamadas;
+// com fake_rmt_set_realtime() o sinal leva o tempo dele.
+void fake_rmt_rx_play(const fake_rmt_level_t *signal, size_t count);
+
+#endif // FAKE_RMT_H
@@ -0,0 +1,56 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Barramento SPI simulado. Cada transação ocupa o barramento pelo tempo que
+// levaria no clock do device (relógio simulado em fake_spi_clock_us()); com
+// fake_spi_set_realtime() esse tempo também passa de verdade, para que as
+// outras threads concorram pelo barramento como no hardware.
+
+#ifndef FAKE_SPI_H
+#define FAKE_SPI_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "driver/spi_master.h"
+#include "freertos/task.h"
+
+typedef struct {
+    int cs;                     // Pino CS do device
+    size_t len;                 // Bytes
+    uint32_t user;              // spi_transaction_t.user
+    const void *tx;
+    bool polling;
+    TaskHandle_t task;          // Quem executou a transação
+    int64_t start_us;           // Relógio simulado
+    int64_t end_us;
+} fake_spi_event_t;
+
+// Chamado com o barramento ocupado, depois do pre_cb
+typedef void (*fake_spi_sink_t)(int cs, const spi_transaction_t *trans, void *ctx);
+
+void fake_spi_reset(void);
+void fake_spi_set_realtime(double factor);   // 0 = instantâneo, 1 = tempo do barramento
+void fake_spi_set_sink(fake_spi_sink_t sink, void *ctx);
+int64_t fake_spi_clock_us(void);
+
+size_t fake_spi_event_count(void);
+bool fake_spi_get_event(size_t index, fake_spi_event_t *event);
+
+// Usos indevidos: transação em device removido, remoção com transação em
+// andamento, barramento liberado com devices ainda presentes
+int fake_spi_misuse_count(void);
+
+#endif // FAKE_SPI_H
@@ -0,0 +1,44 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// FatFs, só o f_getfree() (espaço livre do cartão simulado em fake_fs.c).
+
+#ifndef HOST_FF_H
+#define HOST_FF_H
+
+#include <stdint.h>
+
+typedef unsigned int UINT;
+typedef uint16_t WORD;
+typedef uint32_t DWORD;
+typedef char TCHAR;
+
+typedef struct {
+    WORD csize;         // Setores por cluster
+    WORD ssize;         // Bytes por setor
+    DWORD n_fatent;     // Clusters + 2
+} FATFS;
+
+typedef enum {
+    FR_OK = 0,
+    FR_DISK_ERR,
+    FR_INT_ERR,
+    FR_NOT_READY,
+    FR_NOT_ENABLED = 12,
+} FRESULT;
+
+FRESULT f_getfree(const TCHAR *path, DWORD *nclst, FATFS **fatfs);
+
+#endif // HOST_FF_H
@@ -0,0 +1,54 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// FreeRTOS sobre pthreads, só o que os módulos testados usam. Tasks são
+// threads, sem prioridade nem preempção; o tick é o do firmware (100 Hz).
+
+#ifndef HOST_FREERTOS_H
+#define HOST_FREERTOS_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_attr.h"
+
+typedef int BaseType_t;
+typedef unsigned int UBaseType_t;
+typedef uint32_t TickType_t;
+
+#define pdTRUE                  1
+#define pdFALSE                 0
+#define pdPASS                  pdTRUE
+#define pdFAIL                  pdFALSE
+#define portMAX_DELAY           ((TickType_t)0xffffffffu)
+
+#define configTICK_RATE_HZ      100
+#define configMAX_PRIORITIES    25
+#define portTICK_PERIOD_MS      (1000 / configTICK_RATE_HZ)
+#define pdMS_TO_TICKS(ms)       ((TickType_t)(((uint64_t)(ms) * configTICK_RATE_HZ) / 1000))
+
+#define portYIELD_FROM_ISR(...) do { } while (0)
+
+// Seções críticas: um único mutex recursivo global (o mux é ignorado)
+typedef int portMUX_TYPE;
+#define portMUX_INITIALIZER_UNLOCKED    0
+void host_critical_enter(portMUX_TYPE *mux);
+void host_critical_exit(portMUX_TYPE *mux);
+#define portENTER_CRITICAL(mux)         host_critical_enter(mux)
+#define portEXIT_CRITICAL(mux)          host_critical_exit(mux)
+#define portENTER_CRITICAL_ISR(mux)     host_critical_enter(mux)
+#define portEXIT_CRITICAL_ISR(mux)      host_critical_exit(mux)
+
+#endif // HOST_FREERTOS_H
@@ -0,0 +1,54 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Incluído antes do fonte de um backend de arquivos (-include): as chamadas
+// POSIX com caminho vão para host_fs_* (fake_fs.c), que trocam "/" pela raiz
+// de fake_fs_set_root(). Como no IDF, readdir() não devolve "." e "..".
+
+#ifndef HOST_FS_REDIRECT_H
+#define HOST_FS_REDIRECT_H
+
+#include <stdio.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <dirent.h>
+#include <sys/types.h>
+#include <sys/stat.h>
+
+int host_fs_open(const char *path, int flags, ...);
+FILE *host_fs_fopen(const char *path, const char *mode);
+int host_fs_stat(const char *path, struct stat *st);
+int host_fs_rename(const char *old_path, const char *new_path);
+int host_fs_unlink(const char *path);
+int host_fs_remove(const char *path);
+int host_fs_truncate(const char *path, off_t length);
+int host_fs_mkdir(const char *path, mode_t mode);
+int host_fs_rmdir(const char *path);
+DIR *host_fs_opendir(const char *path);
+struct dirent *host_fs_readdir(DIR *dir);
+
+#define open(...)           host_fs_open(__VA_ARGS__)
+#define fopen(p, m)         host_fs_fopen(p, m)
+#define stat(p, st)         host_fs_stat(p, st)
+#define rename(a, b)        host_fs_rename(a, b)
+#define unlink(p)           host_fs_unlink(p)
+#define remove(p)           host_fs_remove(p)
+#define truncate(p, l)      host_fs_truncate(p, l)
+#define mkdir(p, m)         host_fs_mkdir(p, m)
+#define rmdir(p)            host_fs_rmdir(p)
+#define opendir(p)          host_fs_opendir(p)
+#define readdir(d)          host_fs_readdir(d)
+
+#endif // HOST_FS_REDIRECT_H
@@ -0,0 +1,45 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+// Registro da ordem de aquisição dos mutexes do FreeRTOS simulado. Cada take
+// bem-sucedido de um mutex (xSemaphoreCreateMutex/RecursiveMutex) registra
+// uma aresta "segurado -> tomado" para cada mutex que a thread já segura;
+// semáforos binários e contadores não entram. As arestas são globais e sem
+// repetição, para o teste conferir a ordem e procurar ciclos.
+
+#ifndef HOST_LOCKS_H
+#define HOST_LOCKS_H
+
+#include <stddef.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+
+#define HOST_LOCKS_MAX_HELD     16      // Por thread
+#define HOST_LOCKS_MAX_EDGES    1024
+
+typedef struct {
+    SemaphoreHandle_t held;
+    SemaphoreHandle_t taken;
+} host_lock_edge_t;
+
+// Copia até `max` arestas e retorna o total registrado
+size_t host_lock_edges(host_lock_edge_t *out, size_t max);
+void host_lock_reset(void);
+
+// Mutexes que a thread atual segura, na ordem em que foram tomados
+size_t host_locks_held(SemaphoreHandle_t *out, size_t max);
+
+#endif // HOST_LOCKS_H
@@ -0,0 +1,70 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Verificações dos testes de host. Uma falha não interrompe o teste: tudo é
+// contado e host_test_finish() devolve o código de saída para o ctest.
+
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdio.h>
+#include <stdint.h>
+#include <string.h>
+#include <stdbool.h>
+
+extern int host_checks;
+extern int host_failures;
+
+void host_check_failed(const char *file, int line, const char *expr, const char *detail);
+
+#define CHECK(cond) do {                                                    \
+        host_checks++;                                                      \
+        if (!(cond)) host_check_failed(__FILE__, __LINE__, #cond, NULL);    \
+    } while (0)
+
+#define CHECK_EQ(a, b) do {                                                 \
+        long long a_ = (long long)(a), b_ = (long long)(b);                 \
+        host_checks++;                                                      \
+        if (a_ != b_) {                                                     \
+            char d_[64];                                                    \
+            snprintf(d_, sizeof(d_), "%lld != %lld", a_, b_);               \
+            host_check_failed(__FILE__, __LINE__, #a " == " #b, d_);        \
+        }                                                                   \
+    } while (0)
+
+#define CHECK_OK(x) CHECK_EQ((x), ESP_OK)
+
+#define CHECK_STR(a, b) do {                                                \
+        const char *a_ = (a), *b_ = (b);                                    \
+        host_checks++;                                                      \
+        if (strcmp(a_, b_) != 0) {                                          \
+            char d_[160];                                                   \
+            snprintf(d_, sizeof(d_), "\"%.60s\" != \"%.60s\"", a_, b_);     \
+            host_check_failed(__FILE__, __LINE__, #a " == " #b, d_);        \
+        }                                                                   \
+    } while (0)
+
+// Início de uma seção (só para o relatório de falhas)
+void host_test_section(const char *name);
+
+// Diretório temporário exclusivo do teste, apagado em host_test_finish()
+const char *host_test_tmpdir(void);
+
+int64_t host_test_now_us(void);
+
+// Resumo "nome: N verificações, F falhas"; retorna 0 se tudo passou
+int host_test_finish(const char *name);
+
+#endif // HOST_TEST_H
@@ -0,0 +1,28 @@
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Comandos de alto nível do driver SDMMC (cartão simulado em fake_fs.c).
+
+#ifndef HOST_SDMMC_CMD_H
+#define HOST_SDMMC_CMD_H
+
+#include <stdio.h>
+#include "driver/sdmmc_types.h"
+#include "driver/sdmmc_defs.h"
+
+esp_err_t sdmmc_get_status(sdmmc_card_t *card);
+void sdmmc_card_print_info(FILE *stream, const sdmmc_card_t *card);
+
+#endif // HOST_SDMMC_CMD_H
@@ -0,0 +1,164 @@
+#!/usr/bin/env python3
+# Copyright (c) 2025 HIGH CODE LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Gera a imagem da partição de assets lida por storage_vfs/vfs_assets.c.
+
+Empacota todos os arquivos de um diretório (páginas HTML, bibliotecas IR,
+pacotes de ícones...) em uma imagem somente leitura que o firmware mapeia
+com esp_partition_mmap() e consulta pelo caminho, sem copiar nada para o
+heap. Os caminhos são relativos ao diretório, com '/' como separador.
+
+Formato (little-endian):
+
+    cabeçalho   magic "HBA1", count, image_size, data_start, index_hash
+    índice      count x (nome, offset, tamanho), em ordem de strcmp
+    nomes       caminhos terminados em '\\0'
+    dados       arquivos alinhados em 4 bytes, cada um seguido de '\\0'
+
+index_hash é o FNV-1a de [cabeçalho, data_start).
+
+Uso:
+    tools/asset_image.py <diretório> -o build/assets.bin
+    tools/asset_image.py <diretório> -o build/assets.bin --size 0x100000
+    tools/asset_image.py --list build/assets.bin
+    parttool.py write_partition --partition-name assets --input build/assets.bin
+"""
+
+import argparse
+import os
+import struct
+import sys
+
+MAGIC = 0x31414248  # "HBA1"
+HEADER = struct.Struct("<5I")
+ENTRY = struct.Struct("<3I")
+
+
+class ImageError(Exception):
+    pass
+
+
+def fnv1a(data):
+    h = 2166136261
+    for b in data:
+        h = ((h ^ b) * 16777619) & 0xFFFFFFFF
+    return h
+
+
+def align4(n):
+    return (n + 3) & ~3
+
+
+def collect(root):
+    """Retorna [(caminho, bytes)] em ordem de strcmp (bytes UTF-8)."""
+    files = []
+    for dirpath, dirnames, filenames in os.walk(root):
+        dirnames.sort()
+        for name in filenames:
+            full = os.path.join(dirpath, name)
+            rel = os.path.relpath(full, root).replace(os.sep, "/")
+            with open(full, "rb") as f:
+                files.append((rel.encode("utf-8"), f.read()))
+    files.sort(key=lambda item: item[0])
+    if not files:
+        raise ImageError(f"{root}: nenhum arquivo")
+    return files
+
+
+def build(files):
+    names_start = HEADER.size + ENTRY.size * len(files)
+    names = b"".join(path + b"\0" for path, _ in files)
+    data_start = align4(names_start + len(names))
+
+    index = bytearray()
+    data = bytearray()
+    name_off = names_start
+    for path, content in files:
+        offset = data_start + len(data)
+        index += ENTRY.pack(name_off, offset, len(content))
+        name_off += len(path) + 1
+        data += content + b"\0"
+        data += b"\0" * (align4(len(data)) - len(data))
+
+    table = bytes(index) + names
+    table += b"\0" * (data_start - names_start - len(names))
+    image_size = data_start + len(data)
+    header = HEADER.pack(MAGIC, len(files), image_size, data_start, fnv1a(table))
+    return header + table + bytes(data)
+
+
+def parse(image):
+    """Inverso de build(): retorna [(caminho, bytes)] e confere a imagem."""
+    if len(image) < HEADER.size:
+        raise ImageError("imagem menor que o cabeçalho")
+    magic, count, image_size, data_start, index_hash = HEADER.unpack_from(image)
+    if magic != MAGIC:
+        raise ImageError("magic inválido")
+    if image_size > len(image) or data_start > image_size:
+        raise ImageError("tamanhos inconsistentes")
+    if fnv1a(image[HEADER.size:data_start]) != index_hash:
+        raise ImageError("checksum do índice não confere")
+
+    files = []
+    for i in range(count):
+        name, offset, size = ENTRY.unpack_from(image, HEADER.size + i * ENTRY.size)
+        path = image[name:image.index(b"\0", name)]
+        if offset % 4 or offset + size >= image_size or image[offset + size] != 0:
+            raise ImageError(f"{path.decode()}: dados fora da imagem")
+        files.append((path, image[offset:offset + size]))
+    if [p for p, _ in files] != sorted(p for p, _ in files):
+        raise ImageError("índice fora de ordem")
+    return files
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("source", help="diretório a empacotar (ou imagem, com --list)")
+    ap.add_argument("-o", "--output", help="imagem gerada")
+    ap.add_argument("--size", type=lambda v: int(v, 0),
+                    help="tamanho da partição: falha se não couber e completa com 0xFF")
+    ap.add_argument("--list", action="store_true", help="lista o conteúdo de uma imagem")
+    args = ap.parse_args()
+
+    try:
+        if args.list:
+            with open(args.source, "rb") as f:
+                files = parse(f.read())
+            for path, content in files:
+                print(f"{len(content):>10}  {path.decode()}")
+            return 0
+
+        if not args.output:
+            ap.error("informe -o ou --list")
+
+        files = collect(args.source)
+        image = build(files)
+        if parse(image) != files:
+            raise ImageError("a imagem relida difere dos arquivos")
+        if args.size is not None:
+            if len(image) > args.size:
+                raise ImageError(f"{len(image)} bytes não cabem na partição de {args.size}")
+            image += b"\xff" * (args.size - len(image))
+        with open(args.output, "wb") as f:
+            f.write(image)
+        print(f"{len(files)} arquivos, {HEADER.unpack_from(image)[2]} bytes")
+    except (ImageError, OSError) as err:
+        print(f"asset_image: {err}", file=sys.stderr)
+        return 1
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,391 @@
+#!/usr/bin/env python3
+# Copyright (c) 2025 HIGH CODE LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Empacotador de imagens para o formato de components/Service/assets/asset.h.
+
+Lê arrays C brutos (RGB565 em uint16_t ou bitmaps de 1 bit com linhas
+alinhadas em bytes) listados em um manifesto e gera um .c com as imagens
+compactadas. Toda imagem é decodificada de volta e comparada pixel a pixel
+com a original antes de o arquivo ser escrito.
+
+Manifesto (uma imagem por linha, '#' inicia comentário):
+
+    <nome> <pal|mono> <largura> <altura> <arquivo.c>:<array>
+
+O caminho do arquivo é relativo ao manifesto.
+
+Uso:
+    tools/asset_packer.py components/Service/icons/assets/icons.manifest \\
+        -o components/Service/icons/icons.c
+    tools/asset_packer.py <manifesto> --check     # só verifica e mostra o relatório
+"""
+
+import argparse
+import os
+import re
+import sys
+
+ARRAY_RE = re.compile(
+    r"(?:const\s+)?(?:static\s+)?(?:const\s+)?(uint16_t|unsigned\s+short|uint8_t)\s+(\w+)\s*\[\s*\d*\s*\]\s*=\s*\{(.*?)\}\s*;",
+    re.S,
+)
+NUMBER_RE = re.compile(r"0[xX][0-9a-fA-F]+|\d+")
+COMMENT_RE = re.compile(r"//[^\n]*|/\*.*?\*/", re.S)
+
+LICENSE = """\
+// Copyright (c) 2025 HIGH CODE LLC
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+"""
+
+
+class PackError(Exception):
+    pass
+
+
+# ---------------- Entrada ----------------
+
+_source_cache = {}
+
+
+def load_arrays(path):
+    if path not in _source_cache:
+        with open(path, encoding="utf-8") as f:
+            text = COMMENT_RE.sub("", f.read())
+        arrays = {}
+        for m in ARRAY_RE.finditer(text):
+            ctype, name, body = m.groups()
+            values = [int(v, 0) for v in NUMBER_RE.findall(body)]
+            arrays[name] = (ctype, values)
+        _source_cache[path] = arrays
+    return _source_cache[path]
+
+
+def parse_manifest(path):
+    base = os.path.dirname(os.path.abspath(path))
+    entries = []
+    with open(path, encoding="utf-8") as f:
+        for lineno, line in enumerate(f, 1):
+            line = line.split("#", 1)[0].strip()
+            if not line:
+                continue
+            parts = line.split()
+            if len(parts) != 5 or ":" not in parts[4]:
+                raise PackError(f"{path}:{lineno}: esperado '<nome> <pal|mono> <w> <h> <arquivo>:<array>'")
+            name, kind, w, h, ref = parts
+            if kind not in ("pal", "mono"):
+                raise PackError(f"{path}:{lineno}: formato desconhecido '{kind}'")
+            src, array = ref.split(":", 1)
+            entries.append({
+                "name": name,
+                "kind": kind,
+                "width": int(w),
+                "height": int(h),
+                "source": os.path.join(base, src),
+                "array": array,
+                "where": f"{path}:{lineno}",
+            })
+    return entries
+
+
+def load_pixels(entry):
+    """Retorna as linhas da imagem: cores RGB565 (pal) ou 0/1 (mono)."""
+    arrays = load_arrays(entry["source"])
+    if entry["array"] not in arrays:
+        raise PackError(f"{entry['where']}: array '{entry['array']}' não encontrado")
+    _, values = arrays[entry["array"]]
+    w, h = entry["width"], entry["height"]
+
+    if entry["kind"] == "pal":
+        if len(values) > w * h:
+            raise PackError(f"{entry['where']}: {len(values)} valores para {w}x{h}")
+        # Inicializadores curtos completam com zero, como em C
+        values = values + [0] * (w * h - len(values))
+        return [values[r * w:(r + 1) * w] for r in range(h)], len(values) * 2
+
+    row_bytes = (w + 7) // 8
+    if len(values) < row_bytes * h:
+        raise PackError(f"{entry['where']}: {len(values)} bytes para {w}x{h} (esperado {row_bytes * h})")
+    rows = []
+    for r in range(h):
+        line = values[r * row_bytes:(r + 1) * row_bytes]
+        rows.append([(line[i >> 3] >> (7 - (i & 7))) & 1 for i in range(w)])
+    return rows, row_bytes * h
+
+
+# ---------------- Codificação ----------------
+
+def encode_pal_row(indices):
+    out = bytearray()
+    literal = []
+
+    def flush_literal():
+        while literal:
+            chunk = literal[:128]
+            del literal[:128]
+            out.append(len(chunk) - 1)
+            out.extend(chunk)
+
+    i = 0
+    n = len(indices)
+    while i < n:
+        run = 1
+        while i + run < n and run < 128 and indices[i + run] == indices[i]:
+            run += 1
+        # Uma sequência de 2 só compensa se não interromper literais
+        if run >= 3 or (run == 2 and not literal):
+            flush_literal()
+            out.append(0x80 | (run - 1))
+            out.append(indices[i])
+            i += run
+        else:
+            literal.append(indices[i])
+            i += 1
+    flush_literal()
+    return bytes(out)
+
+
+def encode_mono_row(bits):
+    out = bytearray()
+    current = 0
+    i = 0
+    n = len(bits)
+    while i < n:
+        run = 0
+        while i < n and bits[i] == current:
+            run += 1
+            i += 1
+        while run >= 255:
+            out.append(255)
+            run -= 255
+        out.append(run)
+        current ^= 1
+    return bytes(out)
+
+
+def encode_bits_row(bits):
+    out = bytearray((len(bits) + 7) // 8)
+    for i, b in enumerate(bits):
+        if b:
+            out[i >> 3] |= 0x80 >> (i & 7)
+    return bytes(out)
+
+
+def pack(entry):
+    rows, raw_size = load_pixels(entry)
+    palette = []
+    fmt = "ASSET_FMT_PAL_RLE"
+    if entry["kind"] == "pal":
+        counts = {}
+        for row in rows:
+            for c in row:
+                counts[c] = counts.get(c, 0) + 1
+        if len(counts) > 256:
+            raise PackError(f"{entry['where']}: {len(counts)} cores (máximo 256)")
+        palette = sorted(counts, key=lambda c: (-counts[c], c))
+        index = {c: i for i, c in enumerate(palette)}
+        encoded = [encode_pal_row([index[c] for c in row]) for row in rows]
+    else:
+        runs = [encode_mono_row(row) for row in rows]
+        bits = [encode_bits_row(row) for row in rows]
+        # A tabela de linhas só existe em MONO_RUNS
+        if sum(map(len, runs)) + (len(rows) + 1) * 2 < sum(map(len, bits)):
+            fmt, encoded = "ASSET_FMT_MONO_RUNS", runs
+        else:
+            fmt, encoded = "ASSET_FMT_MONO_BITS", bits
+
+    offsets = [0]
+    for e in encoded:
+        offsets.append(offsets[-1] + len(e))
+    if fmt == "ASSET_FMT_MONO_BITS":
+        offsets = []
+    elif offsets[-1] > 0xFFFF:
+        raise PackError(f"{entry['where']}: {offsets[-1]} bytes não cabem na tabela de linhas de 16 bits")
+
+    return {
+        "entry": entry,
+        "format": fmt,
+        "rows": rows,
+        "raw_size": raw_size,
+        "palette": palette,
+        "offsets": offsets,
+        "data": b"".join(encoded),
+    }
+
+
+# ---------------- Decodificação (espelho de asset.c) ----------------
+
+def decode(packed):
+    entry = packed["entry"]
+    w, h = entry["width"], entry["height"]
+    data, offsets, palette = packed["data"], packed["offsets"], packed["palette"]
+    out = []
+    if packed["format"] == "ASSET_FMT_MONO_BITS":
+        stride = (w + 7) // 8
+        for r in range(h):
+            line = data[r * stride:(r + 1) * stride]
+            out.append([(line[i >> 3] >> (7 - (i & 7))) & 1 for i in range(w)])
+        return out
+    for r in range(h):
+        p = offsets[r]
+        row = []
+        if entry["kind"] == "pal":
+            while len(row) < w:
+                c = data[p]
+                p += 1
+                n = (c & 0x7F) + 1
+                if c & 0x80:
+                    row.extend([palette[data[p]]] * n)
+                    p += 1
+                else:
+                    row.extend(palette[i] for i in data[p:p + n])
+                    p += n
+        else:
+            fg = 0
+            while len(row) < w:
+                n = 0
+                while True:
+                    b = data[p]
+                    p += 1
+                    n += b
+                    if b != 255:
+                        break
+                row.extend([fg] * n)
+                fg ^= 1
+        if p != offsets[r + 1] or len(row) != w:
+            raise PackError(f"{entry['name']}: linha {r} mal formada")
+        out.append(row)
+    return out
+
+
+# Cabeçalho asset_image_t no ESP32 (ponteiros de 32 bits)
+ASSET_STRUCT_SIZE = 20
+
+
+def packed_size(packed):
+    return (ASSET_STRUCT_SIZE + len(packed["palette"]) * 2
+            + len(packed["offsets"]) * 2 + len(packed["data"]))
+
+
+# ---------------- Saída ----------------
+
+def c_array(values, per_line, fmt):
+    lines = []
+    for i in range(0, len(values), per_line):
+        lines.append("    " + ", ".join(fmt.format(v) for v in values[i:i + per_line]) + ",")
+    return "\n".join(lines)
+
+
+def emit(packs, manifest, out_path):
+    rel_manifest = os.path.relpath(manifest, os.path.dirname(os.path.abspath(out_path)))
+    parts = [LICENSE, "",
+             f"// Gerado por tools/asset_packer.py a partir de {rel_manifest}.",
+             "// Não edite à mão: altere as imagens de origem e rode o empacotador.",
+             "",
+             '#include "asset.h"',
+             ""]
+    for p in packs:
+        e = p["entry"]
+        n = e["name"]
+        parts.append(f"// {n}: {e['width']}x{e['height']}, {p['raw_size']} -> {packed_size(p)} bytes")
+        if p["palette"]:
+            parts.append(f"static const uint16_t {n}_palette[] = {{")
+            parts.append(c_array(p["palette"], 12, "0x{:04X}"))
+            parts.append("};")
+        if p["offsets"]:
+            parts.append(f"static const uint16_t {n}_rows[] = {{")
+            parts.append(c_array(p["offsets"], 12, "{}"))
+            parts.append("};")
+        parts.append(f"static const uint8_t {n}_data[] = {{")
+        parts.append(c_array(list(p["data"]), 16, "0x{:02X}"))
+        parts.append("};")
+        palette = f"{n}_palette" if p["palette"] else "NULL"
+        rows = f"{n}_rows" if p["offsets"] else "NULL"
+        parts.append(f"const asset_image_t {n} = {{")
+        parts.append(f"    .width = {e['width']},")
+        parts.append(f"    .height = {e['height']},")
+        parts.append(f"    .format = {p['format']},")
+        parts.append(f"    .palette_size = {len(p['palette'])},")
+        parts.append(f"    .palette = {palette},")
+        parts.append(f"    .rows = {rows},")
+        parts.append(f"    .data = {n}_data,")
+        parts.append("};")
+        parts.append("")
+
+    with open(out_path, "w", encoding="utf-8", newline="\n") as f:
+        f.write("\n".join(parts))
+
+
+def report(packs):
+    # Bytes lidos da flash por desenho completo: bruto = array atual
+    print(f"{'imagem':<24}{'formato':<12}{'tamanho':>10}{'bruto':>9}{'compact.':>10}{'razão':>8}")
+    total_raw = total_packed = 0
+    for p in packs:
+        e = p["entry"]
+        size = packed_size(p)
+        total_raw += p["raw_size"]
+        total_packed += size
+        kind = p["format"][len("ASSET_FMT_"):].lower()
+        print(f"{e['name']:<24}{kind:<12}{str(e['width']) + 'x' + str(e['height']):>10}"
+              f"{p['raw_size']:>9}{size:>10}{size / p['raw_size']:>8.2f}")
+    print(f"{'total':<46}{total_raw:>9}{total_packed:>10}{total_packed / max(total_raw, 1):>8.2f}")
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("manifest")
+    ap.add_argument("-o", "--output", help="arquivo .c gerado")
+    ap.add_argument("--check", action="store_true", help="só verifica a ida e volta e mostra o relatório")
+    ap.add_argument("-q", "--quiet", action="store_true", help="sem relatório")
+    args = ap.parse_args()
+
+    if not args.output and not args.check:
+        ap.error("informe -o ou --check")
+
+    try:
+        entries = parse_manifest(args.manifest)
+        names = set()
+        packs = []
+        for e in entries:
+            if e["name"] in names:
+                raise PackError(f"{e['where']}: nome '{e['name']}' repetido")
+            names.add(e["name"])
+            p = pack(e)
+            if decode(p) != p["rows"]:
+                raise PackError(f"{e['name']}: a imagem decodificada difere da original")
+            packs.append(p)
+    except (PackError, OSError) as err:
+        print(f"asset_packer: {err}", file=sys.stderr)
+        return 1
+
+    if not args.quiet:
+        report(packs)
+    if args.output and not args.check:
+        emit(packs, args.manifest, args.output)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -0,0 +1,252 @@
+#!/usr/bin/env python3
+# Copyright (c) 2025 HIGH CODE LLC
+#
+# Licensed under the Apache License, Version 2.0 (the "License");
+# you may not use this file except in compliance with the License.
+# You may obtain a copy of the License at
+#
+# http://www.apache.org/licenses/LICENSE-2.0
+#
+# Unless required by applicable law or agreed to in writing, software
+# distributed under the License is distributed on an "AS IS" BASIS,
+# WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+# See the License for the specific language governing permissions and
+# limitations under the License.
+
+"""Decodificador de referência do stream de frames (frame_codec.h).
+
+Reconstrói os frames enviados pelo display virtual (Wi-Fi) ou pelo
+usb_stream. A entrada é uma conexão TCP (--listen, o papel do servidor do
+display virtual), um arquivo, um dispositivo serial já configurado ou stdin.
+Cada frame reconstruído pode sair como framebuffer bruto (115200 bytes,
+RGB565 big endian, o formato que o firmware enviava antes) ou como PPM.
+
+Bytes que não pertencem a um pacote (logs na mesma porta USB) são
+ignorados: o decodificador procura o magic e só aplica um pacote com CRC
+correto. Depois de um pacote perdido ele espera o próximo keyframe.
+
+Uso:
+    tools/frame_stream_decoder.py --listen 1337 --ppm frames/
+    tools/frame_stream_decoder.py /dev/ttyACM0 --raw-out - | visualizador
+"""
+
+import argparse
+import os
+import socket
+import struct
+import sys
+import zlib
+
+MAGIC = 0x53464248
+VERSION = 1
+HEADER = struct.Struct("<IBBBBHHIHH")
+TILE_HDR = struct.Struct("<BBBH")
+FLAG_KEYFRAME = 0x01
+
+TILE_RAW, TILE_FILL, TILE_RLE = 0, 1, 2
+
+
+class Decoder:
+    def __init__(self):
+        self.buf = bytearray()
+        self.fb = None
+        self.width = self.height = 0
+        self.synced = False         # Há um keyframe aplicado e nenhum pacote perdido
+        self.expected_seq = None
+        self.stats = {"frames": 0, "keyframes": 0, "crc_errors": 0, "skipped_bytes": 0, "waiting_key": 0}
+
+    def feed(self, data):
+        """Acrescenta bytes e devolve a lista de frames completos (bytes)."""
+        self.buf += data
+        frames = []
+        while True:
+            result = self._parse_one()
+            if result is None:
+                break
+            if result is not False:
+                frames.append(result)
+        return frames
+
+    def _resync(self, skip=1):
+        self.buf = self.buf[skip:]
+        self.stats["skipped_bytes"] += skip
+
+    def _parse_one(self):
+        """None = faltam bytes; False = pacote descartado; bytes = frame novo."""
+        magic = struct.pack("<I", MAGIC)
+        start = self.buf.find(magic)
+        if start < 0:
+            keep = len(magic) - 1
+            if len(self.buf) > keep:
+                self._resync(len(self.buf) - keep)
+            return None
+        if start:
+            self._resync(start)
+        if len(self.buf) < HEADER.size:
+            return None
+
+        _, version, flags, tile, _, width, height, seq, count, _ = HEADER.unpack_from(self.buf)
+        tiles_x = (width + tile - 1) // tile if tile else 0
+        tiles_y = (height + tile - 1) // tile if tile else 0
+        if version != VERSION or tile == 0 or count > tiles_x * tiles_y:
+            self._resync()
+            return False
+
+        # Percorre os registros sem aplicar nada até conferir o CRC. Um pacote
+        # truncado (falha no transporte) é detectado pelo primeiro registro
+        # inválido, sem esperar bytes que nunca vão chegar.
+        pos = HEADER.size
+        tiles = []
+        for _ in range(count):
+            if len(self.buf) < pos + TILE_HDR.size:
+                return None
+            tx, ty, enc, length = TILE_HDR.unpack_from(self.buf, pos)
+            if tx >= tiles_x or ty >= tiles_y or enc > TILE_RLE or length > tile * tile * 2:
+                self.synced = False
+                self._resync()
+                return False
+            pos += TILE_HDR.size
+            if len(self.buf) < pos + length:
+                return None
+            tiles.append((tx, ty, enc, bytes(self.buf[pos:pos + length])))
+            pos += length
+        if len(self.buf) < pos + 4:
+            return None
+
+        (crc,) = struct.unpack_from("<I", self.buf, pos)
+        if crc != zlib.crc32(self.buf[:pos]) & 0xFFFFFFFF:
+            self.stats["crc_errors"] += 1
+            self.synced = False
+            self._resync()
+            return False
+        self.buf = self.buf[pos + 4:]
+
+        keyframe = bool(flags & FLAG_KEYFRAME)
+        if self.expected_seq is not None and seq != self.expected_seq:
+            self.synced = False     # Pacote perdido no meio do caminho
+        self.expected_seq = (seq + 1) & 0xFFFFFFFF
+
+        if keyframe:
+            if (width, height) != (self.width, self.height) or self.fb is None:
+                self.width, self.height = width, height
+                self.fb = bytearray(width * height * 2)
+            self.synced = True
+            self.stats["keyframes"] += 1
+        elif not self.synced:
+            self.stats["waiting_key"] += 1
+            return False
+
+        for tx, ty, enc, payload in tiles:
+            self._apply_tile(tile, tx, ty, enc, payload)
+        self.stats["frames"] += 1
+        return bytes(self.fb)
+
+    def _apply_tile(self, tile, tx, ty, enc, payload):
+        x0, y0 = tx * tile, ty * tile
+        w = min(tile, self.width - x0)
+        h = min(tile, self.height - y0)
+        if w <= 0 or h <= 0:
+            raise ValueError(f"tile fora da tela: {tx},{ty}")
+        n = w * h
+
+        if enc == TILE_RAW:
+            pixels = payload
+        elif enc == TILE_FILL:
+            pixels = payload[:2] * n
+        elif enc == TILE_RLE:
+            out = bytearray()
+            p = 0
+            while p < len(payload):
+                c = payload[p]
+                p += 1
+                count = (c & 0x7F) + 1
+                if c & 0x80:
+                    out += payload[p:p + 2] * count
+                    p += 2
+                else:
+                    out += payload[p:p + count * 2]
+                    p += count * 2
+            pixels = bytes(out)
+        else:
+            raise ValueError(f"codificação de tile desconhecida: {enc}")
+
+        if len(pixels) != n * 2:
+            raise ValueError(f"tile {tx},{ty}: {len(pixels)} bytes, esperado {n * 2}")
+        stride = self.width * 2
+        for row in range(h):
+            dst = (y0 + row) * stride + x0 * 2
+            self.fb[dst:dst + w * 2] = pixels[row * w * 2:(row + 1) * w * 2]
+
+
+def to_ppm(fb, width, height):
+    rgb = bytearray(width * height * 3)
+    for i in range(width * height):
+        v = (fb[2 * i] << 8) | fb[2 * i + 1]
+        r, g, b = (v >> 11) & 0x1F, (v >> 5) & 0x3F, v & 0x1F
+        rgb[3 * i] = (r << 3) | (r >> 2)
+        rgb[3 * i + 1] = (g << 2) | (g >> 4)
+        rgb[3 * i + 2] = (b << 3) | (b >> 2)
+    return b"P6\n%d %d\n255\n" % (width, height) + bytes(rgb)
+
+
+def open_input(args):
+    if args.listen:
+        srv = socket.socket(socket.AF_INET, socket.SOCK_STREAM)
+        srv.setsockopt(socket.SOL_SOCKET, socket.SO_REUSEADDR, 1)
+        srv.bind(("0.0.0.0", args.listen))
+        srv.listen(1)
+        print(f"aguardando conexão na porta {args.listen}...", file=sys.stderr)
+        conn, addr = srv.accept()
+        srv.close()
+        print(f"conectado: {addr[0]}", file=sys.stderr)
+        return conn.makefile("rb", buffering=0)
+    if args.input in (None, "-"):
+        return sys.stdin.buffer
+    return open(args.input, "rb", buffering=0)
+
+
+def main():
+    ap = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    ap.add_argument("input", nargs="?", help="arquivo ou dispositivo (padrão: stdin)")
+    ap.add_argument("--listen", type=int, metavar="PORTA", help="aceita uma conexão TCP do display virtual")
+    ap.add_argument("--raw-out", metavar="ARQ", help="grava cada frame bruto (RGB565 big endian); '-' = stdout")
+    ap.add_argument("--ppm", metavar="DIR", help="grava cada frame como DIR/frame_NNNNNN.ppm")
+    args = ap.parse_args()
+
+    src = open_input(args)
+    raw_out = None
+    if args.raw_out == "-":
+        raw_out = sys.stdout.buffer
+    elif args.raw_out:
+        raw_out = open(args.raw_out, "wb")
+    if args.ppm:
+        os.makedirs(args.ppm, exist_ok=True)
+
+    dec = Decoder()
+    index = 0
+    read = getattr(src, "read1", src.read)   # Devolve o que já chegou, sem esperar encher
+    try:
+        while True:
+            data = read(65536)
+            if not data:
+                break
+            for fb in dec.feed(data):
+                if raw_out:
+                    raw_out.write(fb)
+                    raw_out.flush()
+                if args.ppm:
+                    with open(os.path.join(args.ppm, f"frame_{index:06d}.ppm"), "wb") as f:
+                        f.write(to_ppm(fb, dec.width, dec.height))
+                index += 1
+    except KeyboardInterrupt:
+        pass
+    except ValueError as err:
+        print(f"frame_stream_decoder: {err}", file=sys.stderr)
+        return 1
+
+    print(" ".join(f"{k}={v}" for k, v in dec.stats.items()), file=sys.stderr)
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())